@@ -0,0 +1,475 @@
+#include "DirListing.h"
+
+#include <Logging.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#define TAG "DIRLIST"
+
+namespace {
+constexpr size_t kTableBufferEntries = 64;
+constexpr size_t kPoolBufferSize = 1024;
+constexpr size_t kFindChunkSize = 256;
+constexpr size_t kZeroChunkSize = 256;
+
+constexpr uint32_t kFnvOffset = 2166136261u;
+constexpr uint32_t kFnvPrime = 16777619u;
+
+uint32_t fnv(uint32_t hash, const char* data, const size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(data[i])) * kFnvPrime;
+  }
+  return hash;
+}
+}  // namespace
+
+bool DirListing::less(const char* a, const bool aIsDir, const char* b, const bool bIsDir) {
+  if (aIsDir != bIsDir) return aIsDir;
+  return naturalLess(a, b);
+}
+
+bool DirListing::naturalLess(const char* s1, const char* s2) {
+  while (*s1 && *s2) {
+    const auto uc = [](char c) { return static_cast<unsigned char>(c); };
+    if (std::isdigit(uc(*s1)) && std::isdigit(uc(*s2))) {
+      // Skip leading zeros
+      while (*s1 == '0') s1++;
+      while (*s2 == '0') s2++;
+
+      // Compare by digit length first
+      int len1 = 0, len2 = 0;
+      while (std::isdigit(uc(s1[len1]))) len1++;
+      while (std::isdigit(uc(s2[len2]))) len2++;
+      if (len1 != len2) return len1 < len2;
+
+      // Same length: compare digit by digit
+      for (int i = 0; i < len1; i++) {
+        if (s1[i] != s2[i]) return s1[i] < s2[i];
+      }
+      s1 += len1;
+      s2 += len2;
+    } else {
+      char c1 = std::tolower(uc(*s1));
+      char c2 = std::tolower(uc(*s2));
+      if (c1 != c2) return c1 < c2;
+      s1++;
+      s2++;
+    }
+  }
+  return *s1 == '\0' && *s2 != '\0';
+}
+
+bool DirListing::open(const std::string& path) {
+  close();
+
+  FsFile file;
+  if (!SdMan.openFileForRead(TAG, path, file)) {
+    return false;
+  }
+
+  uint8_t version = 0;
+  Key key;
+  uint32_t count = 0;
+  uint32_t poolSize = 0;
+  uint32_t hash = 0;
+  const bool valid = serialization::readPodChecked(file, version) && version == VERSION &&
+                     serialization::readPodChecked(file, key.modified) &&
+                     serialization::readPodChecked(file, key.size) && serialization::readPodChecked(file, count) &&
+                     serialization::readPodChecked(file, poolSize) && serialization::readPodChecked(file, hash) &&
+                     file.size() == HEADER_SIZE + static_cast<uint64_t>(count) * 4 + poolSize;
+  file.close();
+  if (!valid) {
+    LOG_DBG(TAG, "No valid listing in %s", path.c_str());
+    return false;
+  }
+
+  path_ = path;
+  key_ = key;
+  count_ = count;
+  poolSize_ = poolSize;
+  hash_ = hash;
+  return true;
+}
+
+void DirListing::close() {
+  path_.clear();
+  key_ = {};
+  count_ = 0;
+  poolSize_ = 0;
+  hash_ = 0;
+  windowFirst_ = 0;
+  windowTable_.clear();
+  windowTable_.shrink_to_fit();
+  windowPool_.clear();
+  windowPool_.shrink_to_fit();
+}
+
+bool DirListing::load(const uint32_t first, uint32_t count) {
+  windowFirst_ = first;
+  windowTable_.clear();
+  windowPool_.clear();
+  if (!isOpen() || first >= count_) {
+    return isOpen();
+  }
+  count = std::min(count, count_ - first);
+  if (count == 0) {
+    return true;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead(TAG, path_, file)) {
+    return false;
+  }
+
+  // The next entry's offset, if there is one, is where the window's names end
+  const bool hasNext = first + count < count_;
+  windowTable_.resize(count + (hasNext ? 1 : 0));
+  const int tableBytes = static_cast<int>(windowTable_.size() * 4);
+  bool ok = file.seekSet(HEADER_SIZE + first * 4) &&
+            file.read(reinterpret_cast<uint8_t*>(windowTable_.data()), tableBytes) == tableBytes;
+
+  uint32_t start = 0;
+  uint32_t end = poolSize_;
+  if (ok) {
+    start = windowTable_.front() & ~DIR_FLAG;
+    if (hasNext) {
+      end = windowTable_.back() & ~DIR_FLAG;
+      windowTable_.pop_back();
+    }
+    ok = start < end && end <= poolSize_;
+  }
+  if (ok) {
+    windowPool_.resize(end - start);
+    const int poolBytes = static_cast<int>(windowPool_.size());
+    ok = file.seekSet(poolStart() + start) &&
+         file.read(reinterpret_cast<uint8_t*>(windowPool_.data()), poolBytes) == poolBytes &&
+         windowPool_.back() == '\0';
+  }
+  for (size_t i = 0; ok && i < windowTable_.size(); i++) {
+    const uint32_t offset = windowTable_[i] & ~DIR_FLAG;
+    ok = offset >= start && offset < end;
+  }
+  file.close();
+
+  if (!ok) {
+    LOG_ERR(TAG, "Corrupt listing %s", path_.c_str());
+    windowTable_.clear();
+    windowPool_.clear();
+  }
+  return ok;
+}
+
+const char* DirListing::name(const uint32_t index) const {
+  if (!isLoaded(index)) {
+    return "";
+  }
+  const uint32_t base = windowTable_.front() & ~DIR_FLAG;
+  return windowPool_.data() + ((windowTable_[index - windowFirst_] & ~DIR_FLAG) - base);
+}
+
+bool DirListing::isDir(const uint32_t index) const {
+  return isLoaded(index) && (windowTable_[index - windowFirst_] & DIR_FLAG) != 0;
+}
+
+int DirListing::find(const char* name) const {
+  if (!isOpen() || count_ == 0 || !name || name[0] == '\0') {
+    return -1;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead(TAG, path_, file)) {
+    return -1;
+  }
+  if (!file.seekSet(poolStart())) {
+    file.close();
+    return -1;
+  }
+
+  // The pool holds the names in entry order, so the n-th name read is entry n
+  uint8_t chunk[kFindChunkSize];
+  char current[MAX_NAME_LENGTH + 1];
+  size_t length = 0;
+  int index = 0;
+  uint32_t remaining = poolSize_;
+  while (remaining > 0) {
+    const int bytesRead = file.read(chunk, std::min<size_t>(sizeof(chunk), remaining));
+    if (bytesRead <= 0) break;
+    remaining -= static_cast<uint32_t>(bytesRead);
+    for (int i = 0; i < bytesRead; i++) {
+      if (chunk[i] != '\0') {
+        if (length < MAX_NAME_LENGTH) current[length++] = static_cast<char>(chunk[i]);
+        continue;
+      }
+      current[length] = '\0';
+      if (strcasecmp(current, name) == 0) {
+        file.close();
+        return index;
+      }
+      index++;
+      length = 0;
+    }
+  }
+  file.close();
+  return -1;
+}
+
+void DirListingBuilder::begin(const std::string& outPath, const std::string& scratchPath) {
+  cancel();
+  outPath_ = outPath;
+  scratchPath_ = scratchPath;
+  active_ = true;
+  key_ = {};
+  count_ = 0;
+  poolSize_ = 0;
+  written_ = 0;
+  hash_ = kFnvOffset;
+  scratchSize_ = 0;
+  memoryIndex_ = 0;
+  tableFlushed_ = 0;
+  poolFlushed_ = 0;
+  poolWritten_ = 0;
+}
+
+bool DirListingBuilder::add(const char* name, const bool isDir) {
+  if (!active_ || merging_ || complete_) {
+    return false;
+  }
+
+  const size_t length = std::min(strlen(name), DirListing::MAX_NAME_LENGTH);
+  if (length == 0) {
+    return true;
+  }
+  if (!entries_.empty() && pool_.size() + length + 1 > runBytes_ && !flushRun()) {
+    return false;
+  }
+
+  entries_.push_back(static_cast<uint32_t>(pool_.size()) | (isDir ? DirListing::DIR_FLAG : 0));
+  pool_.insert(pool_.end(), name, name + length);
+  pool_.push_back('\0');
+  count_++;
+  poolSize_ += static_cast<uint32_t>(length + 1);
+  return true;
+}
+
+void DirListingBuilder::sortRun() {
+  std::sort(entries_.begin(), entries_.end(), [this](const uint32_t a, const uint32_t b) {
+    return DirListing::less(pool_.data() + (a & ~DirListing::DIR_FLAG), (a & DirListing::DIR_FLAG) != 0,
+                            pool_.data() + (b & ~DirListing::DIR_FLAG), (b & DirListing::DIR_FLAG) != 0);
+  });
+}
+
+bool DirListingBuilder::flushRun() {
+  if (!scratch_ && !SdMan.openFileForWrite(TAG, scratchPath_, scratch_)) {
+    return false;
+  }
+
+  sortRun();
+
+  // Each entry is a directory flag byte, a length byte and the name
+  Cursor run = {};
+  run.pos = scratchSize_;
+  uint8_t record[2 + DirListing::MAX_NAME_LENGTH];
+  for (const uint32_t entry : entries_) {
+    const char* name = pool_.data() + (entry & ~DirListing::DIR_FLAG);
+    const size_t length = strlen(name);
+    record[0] = (entry & DirListing::DIR_FLAG) ? 1 : 0;
+    record[1] = static_cast<uint8_t>(length);
+    memcpy(record + 2, name, length);
+    if (scratch_.write(record, length + 2) != length + 2) {
+      LOG_ERR(TAG, "Failed to write run to %s", scratchPath_.c_str());
+      return false;
+    }
+    scratchSize_ += static_cast<uint32_t>(length + 2);
+  }
+  run.end = scratchSize_;
+  cursors_.push_back(run);
+
+  entries_.clear();
+  pool_.clear();
+  return true;
+}
+
+bool DirListingBuilder::advance(Cursor& cursor) {
+  if (cursor.pos >= cursor.end) {
+    cursor.valid = false;
+    return true;
+  }
+
+  uint8_t header[2];
+  if (!scratch_.seekSet(cursor.pos) || scratch_.read(header, 2) != 2) {
+    return false;
+  }
+  cursor.isDir = header[0] != 0;
+  cursor.length = header[1];
+  if (cursor.length > 0 &&
+      scratch_.read(reinterpret_cast<uint8_t*>(cursor.name), cursor.length) != static_cast<int>(cursor.length)) {
+    return false;
+  }
+  cursor.name[cursor.length] = '\0';
+  cursor.pos += 2 + cursor.length;
+  cursor.valid = true;
+  return true;
+}
+
+bool DirListingBuilder::finish(const DirListing::Key& key) {
+  if (!active_ || merging_ || complete_) {
+    return false;
+  }
+
+  key_ = key;
+  sortRun();
+  memoryIndex_ = 0;
+  for (Cursor& cursor : cursors_) {
+    if (!advance(cursor)) {
+      LOG_ERR(TAG, "Failed to read run from %s", scratchPath_.c_str());
+      return false;
+    }
+  }
+
+  if (!SdMan.openFileForWrite(TAG, outPath_, out_)) {
+    return false;
+  }
+
+  // The header is written again at the end with the version: a listing cut short is never read
+  if (!writeHeader(0)) {
+    return false;
+  }
+  // The pool is written after the table, which is filled in as the entries are merged
+  uint8_t zeros[kZeroChunkSize] = {};
+  for (uint32_t left = count_ * 4; left > 0;) {
+    const size_t length = std::min<size_t>(left, sizeof(zeros));
+    if (out_.write(zeros, length) != length) {
+      return false;
+    }
+    left -= static_cast<uint32_t>(length);
+  }
+
+  tableBuffer_.reserve(kTableBufferEntries);
+  poolBuffer_.reserve(kPoolBufferSize);
+  merging_ = true;
+  return true;
+}
+
+bool DirListingBuilder::write(const size_t maxEntries) {
+  if (!merging_) {
+    return complete_;
+  }
+
+  for (size_t n = 0; n < maxEntries && written_ < count_; n++) {
+    // The smallest of the run in memory and the runs in the scratch file
+    const char* name = nullptr;
+    bool isDir = false;
+    Cursor* from = nullptr;
+    if (memoryIndex_ < entries_.size()) {
+      const uint32_t entry = entries_[memoryIndex_];
+      name = pool_.data() + (entry & ~DirListing::DIR_FLAG);
+      isDir = (entry & DirListing::DIR_FLAG) != 0;
+    }
+    for (Cursor& cursor : cursors_) {
+      if (cursor.valid && (!name || DirListing::less(cursor.name, cursor.isDir, name, isDir))) {
+        name = cursor.name;
+        isDir = cursor.isDir;
+        from = &cursor;
+      }
+    }
+    if (!name) {
+      return false;
+    }
+
+    const size_t length = strlen(name) + 1;
+    if ((tableBuffer_.size() == kTableBufferEntries || poolBuffer_.size() + length > kPoolBufferSize) &&
+        !flushOutput()) {
+      return false;
+    }
+    tableBuffer_.push_back(poolWritten_ | (isDir ? DirListing::DIR_FLAG : 0));
+    poolBuffer_.insert(poolBuffer_.end(), name, name + length);
+    const char dirByte = isDir ? 1 : 0;
+    hash_ = fnv(fnv(hash_, &dirByte, 1), name, length);
+    poolWritten_ += static_cast<uint32_t>(length);
+    written_++;
+
+    if (from) {
+      if (!advance(*from)) {
+        return false;
+      }
+    } else {
+      memoryIndex_++;
+    }
+  }
+
+  if (written_ < count_) {
+    return true;
+  }
+  if (!flushOutput() || !writeHeader(DirListing::VERSION)) {
+    return false;
+  }
+  out_.close();
+  merging_ = false;
+  complete_ = true;
+  LOG_DBG(TAG, "Wrote %u entries to %s", static_cast<unsigned>(count_), outPath_.c_str());
+  return true;
+}
+
+bool DirListingBuilder::flushOutput() {
+  if (!tableBuffer_.empty()) {
+    const size_t bytes = tableBuffer_.size() * 4;
+    if (!out_.seekSet(DirListing::HEADER_SIZE + tableFlushed_ * 4) ||
+        out_.write(reinterpret_cast<const uint8_t*>(tableBuffer_.data()), bytes) != bytes) {
+      return false;
+    }
+    tableFlushed_ += static_cast<uint32_t>(tableBuffer_.size());
+    tableBuffer_.clear();
+  }
+  if (!poolBuffer_.empty()) {
+    if (!out_.seekSet(DirListing::HEADER_SIZE + count_ * 4 + poolFlushed_) ||
+        out_.write(reinterpret_cast<const uint8_t*>(poolBuffer_.data()), poolBuffer_.size()) != poolBuffer_.size()) {
+      return false;
+    }
+    poolFlushed_ += static_cast<uint32_t>(poolBuffer_.size());
+    poolBuffer_.clear();
+  }
+  return true;
+}
+
+bool DirListingBuilder::writeHeader(const uint8_t version) {
+  if (!out_.seekSet(0)) {
+    return false;
+  }
+  serialization::writePod(out_, version);
+  serialization::writePod(out_, key_.modified);
+  serialization::writePod(out_, key_.size);
+  serialization::writePod(out_, count_);
+  serialization::writePod(out_, poolSize_);
+  serialization::writePod(out_, hash_);
+  return true;
+}
+
+void DirListingBuilder::cancel() {
+  if (out_) {
+    out_.close();
+  }
+  if (scratch_) {
+    scratch_.close();
+  }
+  if (!cursors_.empty()) {
+    SdMan.remove(scratchPath_.c_str());
+  }
+  active_ = false;
+  merging_ = false;
+  complete_ = false;
+
+  entries_.clear();
+  entries_.shrink_to_fit();
+  pool_.clear();
+  pool_.shrink_to_fit();
+  cursors_.clear();
+  cursors_.shrink_to_fit();
+  tableBuffer_.clear();
+  tableBuffer_.shrink_to_fit();
+  poolBuffer_.clear();
+  poolBuffer_.shrink_to_fit();
+}
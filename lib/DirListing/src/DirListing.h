@@ -0,0 +1,152 @@
+#pragma once
+
+#include <SdFat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * A directory's entries, sorted (directories first, then names in natural order) and cached in a
+ * file, so a file browser needn't list the directory again and only reads the page it shows.
+ *
+ * File layout: a header, a table with one uint32_t per entry (the name's offset in the pool, with
+ * the top bit set for directories), then the pool of NUL-terminated names in the same order.
+ */
+class DirListing {
+ public:
+  // What the directory looked like when it was listed; the listing is stale once it differs
+  struct Key {
+    uint32_t modified = 0;  // FAT date << 16 | time
+    uint32_t size = 0;
+
+    bool operator==(const Key& other) const { return modified == other.modified && size == other.size; }
+    bool operator!=(const Key& other) const { return !(*this == other); }
+  };
+
+  static constexpr uint8_t VERSION = 1;
+  static constexpr uint32_t HEADER_SIZE = 21;
+  static constexpr uint32_t DIR_FLAG = 0x80000000u;
+  static constexpr size_t MAX_NAME_LENGTH = 255;
+
+  /** Directories first, then natural order: case-insensitive, with runs of digits compared as numbers. */
+  static bool less(const char* a, bool aIsDir, const char* b, bool bIsDir);
+  static bool naturalLess(const char* a, const char* b);
+
+  /** Open a cached listing; false if there is none or it was written by another version. */
+  bool open(const std::string& path);
+  void close();
+  bool isOpen() const { return !path_.empty(); }
+
+  const Key& key() const { return key_; }
+  uint32_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+  /** Hash of the entries, to tell whether a new listing differs from this one. */
+  uint32_t hash() const { return hash_; }
+
+  /** Read entries [first, first + count) into memory; only loaded entries can be read. */
+  bool load(uint32_t first, uint32_t count);
+  bool isLoaded(uint32_t index) const { return index >= windowFirst_ && index - windowFirst_ < windowTable_.size(); }
+  const char* name(uint32_t index) const;
+  bool isDir(uint32_t index) const;
+
+  /** Index of the entry with this name (case-insensitive), or -1. Reads the names a chunk at a time. */
+  int find(const char* name) const;
+
+ private:
+  std::string path_;
+  Key key_;
+  uint32_t count_ = 0;
+  uint32_t poolSize_ = 0;
+  uint32_t hash_ = 0;
+
+  uint32_t windowFirst_ = 0;
+  std::vector<uint32_t> windowTable_;  // Table entries of the loaded window
+  std::vector<char> windowPool_;       // Their names, from the first one's offset
+
+  uint32_t poolStart() const { return HEADER_SIZE + count_ * 4; }
+};
+
+/**
+ * Writes a DirListing from entries added in directory order, in bounded memory: entries are
+ * sorted in runs of up to runBytes of names, and runs that fill up are written to a scratch file
+ * and merged at the end. Both adding and writing can be done a few entries at a time.
+ */
+class DirListingBuilder {
+ public:
+  static constexpr size_t DEFAULT_RUN_BYTES = 16 * 1024;
+
+  explicit DirListingBuilder(size_t runBytes = DEFAULT_RUN_BYTES) : runBytes_(runBytes) {}
+  ~DirListingBuilder() { cancel(); }
+
+  DirListingBuilder(const DirListingBuilder&) = delete;
+  DirListingBuilder& operator=(const DirListingBuilder&) = delete;
+
+  /** Start a listing that will be written to outPath, with full runs going to scratchPath. */
+  void begin(const std::string& outPath, const std::string& scratchPath);
+
+  /** Add an entry; names longer than MAX_NAME_LENGTH bytes are cut. */
+  bool add(const char* name, bool isDir);
+
+  /** No more entries: sort the last run and open the output. */
+  bool finish(const DirListing::Key& key);
+
+  /** Write up to maxEntries more entries; the listing is complete once done(). */
+  bool write(size_t maxEntries);
+
+  bool isActive() const { return active_; }
+  bool done() const { return complete_; }
+  uint32_t size() const { return count_; }
+  uint32_t hash() const { return hash_; }
+
+  /** Stop, close the files and remove the scratch file. The output is left as it is. */
+  void cancel();
+
+ private:
+  // A run in the scratch file and its smallest entry not yet written
+  struct Cursor {
+    uint32_t pos;
+    uint32_t end;
+    bool valid;
+    bool isDir;
+    uint8_t length;
+    char name[DirListing::MAX_NAME_LENGTH + 1];
+  };
+
+  void sortRun();
+  bool flushRun();
+  bool advance(Cursor& cursor);
+  bool flushOutput();
+  bool writeHeader(uint8_t version);
+
+  size_t runBytes_;
+  bool active_ = false;
+  bool merging_ = false;
+  bool complete_ = false;
+  std::string outPath_;
+  std::string scratchPath_;
+  FsFile scratch_;
+  FsFile out_;
+
+  // The run being added to, then the last run, which is merged from memory
+  std::vector<uint32_t> entries_;  // Offset in pool_, with DIR_FLAG for directories
+  std::vector<char> pool_;
+  size_t memoryIndex_ = 0;
+
+  std::vector<Cursor> cursors_;
+  uint32_t scratchSize_ = 0;
+
+  DirListing::Key key_;
+  uint32_t count_ = 0;
+  uint32_t poolSize_ = 0;
+  uint32_t written_ = 0;
+  uint32_t hash_ = 0;
+
+  // Output is buffered and written with a seek between the table and the pool
+  std::vector<uint32_t> tableBuffer_;
+  std::vector<char> poolBuffer_;
+  uint32_t tableFlushed_ = 0;
+  uint32_t poolFlushed_ = 0;
+  uint32_t poolWritten_ = 0;
+};
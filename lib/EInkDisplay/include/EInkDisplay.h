@@ -26,6 +26,14 @@ class EInkDisplay {
   static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
   static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
 
+  // Rectangular panel region in physical pixels; x and w must be multiples of 8
+  struct Window {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+  };
+
   // Frame buffer operations
   void clearScreen(uint8_t color = 0xFF) const;
   void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
@@ -34,11 +42,13 @@ class EInkDisplay {
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
   void swapBuffers();
 #endif
-  void setFramebuffer(const uint8_t* bwBuffer) const;
+  void setFramebuffer(const uint8_t* bwBuffer);
 
   void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
   void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer);
   void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer);
+  // Write rows [y, y + h) of both grayscale planes (full panel width)
+  void writeGrayscaleBand(uint16_t y, uint16_t h, const uint8_t* lsbBand, const uint8_t* msbBand);
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
   void cleanupGrayscaleBuffers(const uint8_t* bwBuffer);
 #endif
@@ -48,8 +58,27 @@ class EInkDisplay {
   void displayBuffer(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen = false);
+  // Fast-refresh only the given windows of the frame buffer with a single panel refresh.
+  // The rest of the panel RAM must already hold the current frame. Returns false without
+  // touching the panel when a differential update is not possible (screen off, grayscale
+  // shown, dual buffer mode, bad window); the caller should fall back to displayBuffer().
+  bool displayWindows(const Window* windows, uint8_t count, bool turnOffScreen = false);
   void displayGrayBuffer(bool turnOffScreen = false);
 
+  // Non-blocking refresh: the *Async variants load the panel RAM, start the waveform and return
+  // without waiting for BUSY. Until the refresh completes the frame buffer still belongs to the
+  // display (single buffer mode re-syncs RED RAM from it afterwards), so only work that leaves it
+  // alone - loading pages, layout, rasterizing into other buffers - should overlap the refresh.
+  // Every other panel operation waits for a pending refresh first.
+  using RefreshHandle = uint32_t;  // 0 = no refresh started
+  static constexpr uint8_t MAX_WINDOWS = 8;
+  RefreshHandle displayBufferAsync(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
+  // Same contract as displayWindows(); returns 0 where that returns false
+  RefreshHandle displayWindowsAsync(const Window* windows, uint8_t count, bool turnOffScreen = false);
+  // True once the refresh behind handle is done (finishes its RAM sync when it just completed)
+  bool isRefreshComplete(RefreshHandle handle);
+  void waitForRefresh();
+
   void refreshDisplay(RefreshMode mode = FAST_REFRESH, bool turnOffScreen = false);
 
   // debug function
@@ -88,6 +117,17 @@ class EInkDisplay {
   bool inGrayscaleMode;
   bool drawGrayscale;
 
+  // Refresh in flight (started by startRefresh, finished by finishRefresh)
+  RefreshHandle lastRefresh;
+  bool refreshPending;
+  unsigned long refreshStart;
+  const char* refreshType;
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  // Frame buffer regions to copy into RED RAM once the pending refresh is done
+  Window redSyncWindows[MAX_WINDOWS];
+  uint8_t redSyncCount;
+#endif
+
   // Low-level display control
   void resetDisplay();
   void sendCommand(uint8_t command);
@@ -95,8 +135,12 @@ class EInkDisplay {
   void sendData(const uint8_t* data, uint16_t length);
   void waitWhileBusy(const char* comment = nullptr);
   void initDisplayController();
+  void startRefresh(RefreshMode mode, bool turnOffScreen);
+  bool refreshFinished();
+  void finishRefresh();
 
   // Low-level display operations
   void setRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_t size);
+  void writeRamWindow(uint8_t ramBuffer, const Window& window);
 };
@@ -125,7 +125,14 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
       isScreenOn(false),
       customLutActive(false),
       inGrayscaleMode(false),
-      drawGrayscale(false) {
+      drawGrayscale(false),
+      lastRefresh(0),
+      refreshPending(false),
+      refreshStart(0),
+      refreshType(nullptr) {
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  redSyncCount = 0;
+#endif
   LOG_INF(TAG, "Constructor called");
   LOG_INF(TAG, "SCLK=%d, MOSI=%d, CS=%d, DC=%d, RST=%d, BUSY=%d", sclk, mosi, cs, dc, rst, busy);
 }
@@ -133,6 +140,11 @@ EInkDisplay::EInkDisplay(int8_t sclk, int8_t mosi, int8_t cs, int8_t dc, int8_t
 void EInkDisplay::begin() {
   LOG_INF(TAG, "begin() called");
 
+  refreshPending = false;
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  redSyncCount = 0;
+#endif
+
   // CRITICAL: Reset isScreenOn flag to ensure display is properly initialized
   // This is especially important after deep sleep wake-up where the display
   // controller needs to be treated as a fresh initialization
@@ -363,7 +375,10 @@ void EInkDisplay::writeRamBuffer(uint8_t ramBuffer, const uint8_t* data, uint32_
   LOG_DBG(TAG, "%s RAM write complete (%lu ms)", bufferName, duration);
 }
 
-void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) const { memcpy(frameBuffer, bwBuffer, BUFFER_SIZE); }
+void EInkDisplay::setFramebuffer(const uint8_t* bwBuffer) {
+  waitForRefresh();
+  memcpy(frameBuffer, bwBuffer, BUFFER_SIZE);
+}
 
 #ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
 void EInkDisplay::swapBuffers() {
@@ -387,16 +402,27 @@ void EInkDisplay::grayscaleRevert() {
 }
 
 void EInkDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) {
+  waitForRefresh();
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
 }
 
 void EInkDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
+  waitForRefresh();
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
 }
 
+void EInkDisplay::writeGrayscaleBand(const uint16_t y, const uint16_t h, const uint8_t* lsbBand,
+                                     const uint8_t* msbBand) {
+  waitForRefresh();
+  setRamArea(0, y, DISPLAY_WIDTH, h);
+  writeRamBuffer(CMD_WRITE_RAM_BW, lsbBand, DISPLAY_WIDTH_BYTES * h);
+  writeRamBuffer(CMD_WRITE_RAM_RED, msbBand, DISPLAY_WIDTH_BYTES * h);
+}
+
 void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  waitForRefresh();
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, lsbBuffer, BUFFER_SIZE);
   writeRamBuffer(CMD_WRITE_RAM_RED, msbBuffer, BUFFER_SIZE);
@@ -409,6 +435,7 @@ void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t*
  * grayscale display.
  */
 void EInkDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {
+  waitForRefresh();
   setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
   writeRamBuffer(CMD_WRITE_RAM_BW, bwBuffer, BUFFER_SIZE);
   writeRamBuffer(CMD_WRITE_RAM_RED, bwBuffer, BUFFER_SIZE);
@@ -416,7 +443,14 @@ void EInkDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {
 }
 #endif
 
-void EInkDisplay::displayBuffer(RefreshMode mode, bool turnOffScreen) {
+void EInkDisplay::displayBuffer(const RefreshMode mode, const bool turnOffScreen) {
+  displayBufferAsync(mode, turnOffScreen);
+  waitForRefresh();
+}
+
+EInkDisplay::RefreshHandle EInkDisplay::displayBufferAsync(RefreshMode mode, const bool turnOffScreen) {
+  waitForRefresh();
+
   if (!isScreenOn && mode == FAST_REFRESH) {
     // Force half refresh if screen is off - FAST_REFRESH requires valid
     // previous frame data in RED RAM which may be stale after power-off
@@ -451,20 +485,22 @@ void EInkDisplay::displayBuffer(RefreshMode mode, bool turnOffScreen) {
 #endif
 
   // Refresh the display
-  refreshDisplay(mode, turnOffScreen);
+  startRefresh(mode, turnOffScreen);
 
 #ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
   // In single buffer mode always sync RED RAM after refresh to prepare for next fast refresh
   // This ensures RED contains the currently displayed frame for differential comparison
-  setRamArea(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-  writeRamBuffer(CMD_WRITE_RAM_RED, frameBuffer, BUFFER_SIZE);
+  redSyncWindows[0] = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
+  redSyncCount = 1;
 #endif
+  return lastRefresh;
 }
 
 // EXPERIMENTAL: Windowed update support
 // Displays only a rectangular region of the frame buffer, preserving the rest of the screen.
 // Requirements: x and w must be byte-aligned (multiples of 8 pixels)
 void EInkDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+  waitForRefresh();
   LOG_DBG(TAG, "Displaying window at (%d,%d) size (%dx%d)", x, y, w, h);
 
   // Validate bounds
@@ -537,7 +573,73 @@ void EInkDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
   LOG_DBG(TAG, "Window display complete");
 }
 
+void EInkDisplay::writeRamWindow(const uint8_t ramBuffer, const Window& window) {
+  setRamArea(window.x, window.y, window.w, window.h);
+  sendCommand(ramBuffer);
+
+  // Rows are streamed straight from the frame buffer; full-width windows are one contiguous run
+  const uint16_t widthBytes = window.w / 8;
+  const uint8_t* src = frameBuffer + window.y * DISPLAY_WIDTH_BYTES + window.x / 8;
+  if (widthBytes == DISPLAY_WIDTH_BYTES) {
+    sendData(src, widthBytes * window.h);
+    return;
+  }
+  for (uint16_t row = 0; row < window.h; row++, src += DISPLAY_WIDTH_BYTES) {
+    sendData(src, widthBytes);
+  }
+}
+
+bool EInkDisplay::displayWindows(const Window* windows, const uint8_t count, const bool turnOffScreen) {
+  if (displayWindowsAsync(windows, count, turnOffScreen) == 0) {
+    return false;
+  }
+  waitForRefresh();
+  return true;
+}
+
+EInkDisplay::RefreshHandle EInkDisplay::displayWindowsAsync(const Window* windows, const uint8_t count,
+                                                            const bool turnOffScreen) {
+#ifndef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  // RED RAM is rewritten from frameBufferActive on every update in dual buffer mode
+  (void)windows;
+  (void)count;
+  (void)turnOffScreen;
+  return 0;
+#else
+  waitForRefresh();
+
+  // FAST_REFRESH compares against RED RAM, which is only valid while the screen stays on
+  // and no grayscale planes are loaded
+  if (!isScreenOn || inGrayscaleMode || !frameBuffer || count == 0 || count > MAX_WINDOWS) {
+    return 0;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    const Window& win = windows[i];
+    if (win.w == 0 || win.h == 0 || win.x + win.w > DISPLAY_WIDTH || win.y + win.h > DISPLAY_HEIGHT ||
+        win.x % 8 != 0 || win.w % 8 != 0) {
+      LOG_ERR(TAG, "Invalid window (%u,%u %ux%u)", win.x, win.y, win.w, win.h);
+      return 0;
+    }
+  }
+
+  uint32_t bytes = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    writeRamWindow(CMD_WRITE_RAM_BW, windows[i]);
+    bytes += static_cast<uint32_t>(windows[i].w / 8) * windows[i].h;
+  }
+  LOG_DBG(TAG, "Windowed update: %u window(s), %lu of %lu bytes", count, bytes, BUFFER_SIZE);
+
+  startRefresh(FAST_REFRESH, turnOffScreen);
+
+  // Sync RED RAM with the new content for the next differential refresh
+  memcpy(redSyncWindows, windows, count * sizeof(Window));
+  redSyncCount = count;
+  return lastRefresh;
+#endif
+}
+
 void EInkDisplay::displayGrayBuffer(const bool turnOffScreen) {
+  waitForRefresh();
   drawGrayscale = false;
   inGrayscaleMode = true;
 
@@ -548,6 +650,12 @@ void EInkDisplay::displayGrayBuffer(const bool turnOffScreen) {
 }
 
 void EInkDisplay::refreshDisplay(const RefreshMode mode, const bool turnOffScreen) {
+  waitForRefresh();
+  startRefresh(mode, turnOffScreen);
+  waitForRefresh();
+}
+
+void EInkDisplay::startRefresh(const RefreshMode mode, const bool turnOffScreen) {
   // Configure Display Update Control 1
   sendCommand(CMD_DISPLAY_UPDATE_CTRL1);
   sendData((mode == FAST_REFRESH) ? CTRL1_NORMAL : CTRL1_BYPASS_RED);  // Configure buffer comparison mode
@@ -591,19 +699,66 @@ void EInkDisplay::refreshDisplay(const RefreshMode mode, const bool turnOffScree
   }
 
   // Power on and refresh display
-  const char* refreshType = (mode == FULL_REFRESH) ? "full" : (mode == HALF_REFRESH) ? "half" : "fast";
+  refreshType = (mode == FULL_REFRESH) ? "full" : (mode == HALF_REFRESH) ? "half" : "fast";
   LOG_DBG(TAG, "Powering on display 0x%02X (%s refresh)...", displayMode, refreshType);
   sendCommand(CMD_DISPLAY_UPDATE_CTRL2);
   sendData(displayMode);
 
   sendCommand(CMD_MASTER_ACTIVATION);
 
-  // Wait for display to finish updating
-  LOG_DBG(TAG, "Waiting for display refresh...");
-  waitWhileBusy(refreshType);
+  // The waveform now runs on its own; BUSY stays high until it is done
+  refreshStart = millis();
+  refreshPending = true;
+  if (++lastRefresh == 0) lastRefresh = 1;
+}
+
+bool EInkDisplay::refreshFinished() {
+  if (digitalRead(_busy) != HIGH) {
+    return true;
+  }
+  if (millis() - refreshStart > 10000) {
+    LOG_ERR(TAG, "Timeout waiting for busy %s", refreshType);
+    return true;
+  }
+  return false;
+}
+
+void EInkDisplay::finishRefresh() {
+  refreshPending = false;
+  LOG_DBG(TAG, "Refresh complete: %s (%lu ms)", refreshType, millis() - refreshStart);
+
+#ifdef EINK_DISPLAY_SINGLE_BUFFER_MODE
+  for (uint8_t i = 0; i < redSyncCount; i++) {
+    writeRamWindow(CMD_WRITE_RAM_RED, redSyncWindows[i]);
+  }
+  redSyncCount = 0;
+#endif
+}
+
+bool EInkDisplay::isRefreshComplete(const RefreshHandle handle) {
+  // Only one refresh is ever in flight, so any older handle is already done
+  if (!refreshPending || handle != lastRefresh) {
+    return true;
+  }
+  if (!refreshFinished()) {
+    return false;
+  }
+  finishRefresh();
+  return true;
+}
+
+void EInkDisplay::waitForRefresh() {
+  if (!refreshPending) {
+    return;
+  }
+  while (!refreshFinished()) {
+    delay(1);
+  }
+  finishRefresh();
 }
 
 void EInkDisplay::setCustomLUT(const bool enabled, const unsigned char* lutData) {
+  waitForRefresh();
   if (enabled) {
     LOG_DBG(TAG, "Loading custom LUT...");
 
@@ -635,6 +790,7 @@ void EInkDisplay::setCustomLUT(const bool enabled, const unsigned char* lutData)
 
 void EInkDisplay::deepSleep() {
   LOG_INF(TAG, "Preparing display for deep sleep...");
+  waitForRefresh();
 
   // First, power down the display properly
   // This shuts down the analog power rails and clock
@@ -432,94 +432,6 @@ const std::string& Epub::getLanguage() const {
 
 std::string Epub::getCoverBmpPath() const { return cachePath + "/cover.bmp"; }
 
-std::string Epub::getCoverPreviewBmpPath() const { return cachePath + "/cover_preview.bmp"; }
-
-bool Epub::generateCoverPreviewBmp() const {
-  const auto previewPath = getCoverPreviewBmpPath();
-
-  // Already generated, return true
-  if (SdMan.exists(previewPath.c_str())) {
-    return true;
-  }
-
-  // Full cover already exists, no need for preview
-  if (SdMan.exists(getCoverBmpPath().c_str())) {
-    return false;
-  }
-
-  setupCacheDir();
-
-  // Priority 1: External cover file (bookname.jpg, etc.)
-  std::string externalCover = findCoverImage();
-  if (!externalCover.empty()) {
-    LOG_DBG(TAG, "Found external cover for preview: %s", externalCover.c_str());
-    ImageConvertConfig config;
-    config.quickMode = true;
-    config.logTag = "EBP";
-    if (ImageConverterFactory::convertToBmp(externalCover, previewPath, config)) {
-      LOG_INF(TAG, "Generated cover preview from external image");
-      return true;
-    }
-    // Conversion failed - clean up any partial output
-    SdMan.remove(previewPath.c_str());
-  }
-
-  // Priority 2: Try common internal cover paths (batch scan - single ZIP pass)
-  static const char* const commonCoverPaths[] = {
-      "cover.jpg",
-      "cover.jpeg",
-      "cover.png",
-      "images/cover.jpg",
-      "images/cover.jpeg",
-      "images/cover.png",
-      "Images/cover.jpg",
-      "Images/cover.jpeg",
-      "Images/cover.png",
-      "OEBPS/cover.jpg",
-      "OEBPS/cover.jpeg",
-      "OEBPS/cover.png",
-      "OEBPS/images/cover.jpg",
-      "OEBPS/images/cover.jpeg",
-      "OEBPS/images/cover.png",
-      "OEBPS/Images/cover.jpg",
-      "OEBPS/Images/cover.jpeg",
-      "OEBPS/Images/cover.png",
-  };
-  constexpr int commonCoverPathsCount = sizeof(commonCoverPaths) / sizeof(commonCoverPaths[0]);
-
-  ZipFile zip(filepath);
-  const int foundIndex = zip.findFirstExisting(commonCoverPaths, commonCoverPathsCount);
-  if (foundIndex >= 0) {
-    const char* path = commonCoverPaths[foundIndex];
-    LOG_DBG(TAG, "Found cover for preview via heuristic: %s", path);
-
-    const std::string ext = FsHelpers::isJpegFile(path) ? ".jpg" : ".png";
-    const auto coverTempPath = getCachePath() + "/.cover_preview" + ext;
-
-    FsFile coverFile;
-    if (SdMan.openFileForWrite("EBP", coverTempPath, coverFile)) {
-      if (readItemContentsToStream(path, coverFile, 1024)) {
-        coverFile.close();
-        ImageConvertConfig config;
-        config.quickMode = true;
-        config.logTag = "EBP";
-        if (ImageConverterFactory::convertToBmp(coverTempPath, previewPath, config)) {
-          SdMan.remove(coverTempPath.c_str());
-          return true;
-        }
-        // Conversion failed - clean up partial output
-        SdMan.remove(previewPath.c_str());
-      } else {
-        coverFile.close();
-      }
-    }
-    SdMan.remove(coverTempPath.c_str());
-  }
-
-  LOG_DBG(TAG, "No cover found for preview");
-  return false;
-}
-
 std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb.bmp"; }
 
 std::string Epub::findCoverImage() const {
@@ -556,14 +468,14 @@ bool Epub::generateThumbBmp() const {
   std::string externalCover = findCoverImage();
   if (!externalCover.empty()) {
     LOG_DBG(TAG, "Found external cover: %s", externalCover.c_str());
-    // Generate full-size cover BMP first (needed for thumbnail scaling)
+    // Generate full-size cover BMP and thumbnail from the same decode
     const auto coverPath = getCoverBmpPath();
     if (!SdMan.exists(coverPath.c_str())) {
-      if (CoverHelpers::convertImageToBmp(externalCover, coverPath, "EBP", true)) {
+      if (CoverHelpers::convertImageToCoverAndThumb(externalCover, coverPath, thumbPath, "EBP", true)) {
         LOG_INF(TAG, "Generated cover BMP from external image");
       }
     }
-    // Now generate thumbnail from cover
+    // Thumbnail from existing cover (no-op if already produced above)
     if (CoverHelpers::generateThumbFromCover(coverPath, thumbPath, "EBP")) {
       return true;
     }
@@ -602,11 +514,11 @@ bool Epub::generateThumbBmp() const {
     return false;
   }
 
-  // Extract cover image to temp file, then convert to thumbnail
-  LOG_DBG(TAG, "Generating thumb BMP from cover image");
+  // Extract cover image to temp file, then convert to cover + thumbnail in one decode.
+  // The cover is 1-bit, matching what the reader and sleep screen request.
+  LOG_DBG(TAG, "Generating cover and thumb BMP from cover image");
   const std::string ext = FsHelpers::isJpegFile(coverImageHref) ? ".jpg" : ".png";
   const auto coverTempPath = getCachePath() + "/.cover" + ext;
-  const auto thumbTempPath = thumbPath + ".tmp";
 
   FsFile coverFile;
   if (!SdMan.openFileForWrite("EBP", coverTempPath, coverFile)) {
@@ -618,27 +530,12 @@ bool Epub::generateThumbBmp() const {
   }
   coverFile.close();
 
-  // Use 1-bit dithering for JPEG thumbnails (smaller files). PNG thumbnails are
-  // always 2-bit since PngToBmpConverter doesn't support 1-bit output.
-  ImageConvertConfig config;
-  config.maxWidth = THUMB_WIDTH;
-  config.maxHeight = THUMB_HEIGHT;
-  config.oneBit = FsHelpers::isJpegFile(coverImageHref);
-  config.logTag = "EBP";
-
-  const bool success = ImageConverterFactory::convertToBmp(coverTempPath, thumbTempPath, config);
+  const bool success = CoverHelpers::convertImageToCoverAndThumb(coverTempPath, coverPath, thumbPath, "EBP", true) &&
+                       SdMan.exists(thumbPath.c_str());
   SdMan.remove(coverTempPath.c_str());
 
-  if (success) {
-    // Atomic rename: readers see either no file or complete file
-    FsFile tempFile = SdMan.open(thumbTempPath.c_str(), O_RDWR);
-    if (tempFile) {
-      tempFile.rename(thumbPath.c_str());
-      tempFile.close();
-    }
-  } else {
+  if (!success) {
     LOG_ERR(TAG, "Failed to generate thumb BMP from cover image");
-    SdMan.remove(thumbTempPath.c_str());
     // Create failure marker so we don't retry
     FsFile marker;
     if (SdMan.openFileForWrite("EBP", failedMarkerPath, marker)) {
@@ -669,7 +566,8 @@ bool Epub::generateCoverBmp(bool use1BitDithering) const {
   std::string externalCover = findCoverImage();
   if (!externalCover.empty()) {
     LOG_DBG(TAG, "Found external cover: %s", externalCover.c_str());
-    if (CoverHelpers::convertImageToBmp(externalCover, coverPath, "EBP", use1BitDithering)) {
+    if (CoverHelpers::convertImageToCoverAndThumb(externalCover, coverPath, getThumbBmpPath(), "EBP",
+                                                  use1BitDithering)) {
       LOG_INF(TAG, "Generated cover BMP from external image");
       return true;
     }
@@ -742,10 +640,8 @@ bool Epub::generateCoverBmp(bool use1BitDithering) const {
     if (SdMan.openFileForWrite("EBP", coverTempPath, coverFile)) {
       if (readItemContentsToStream(path, coverFile, 1024)) {
         coverFile.close();
-        ImageConvertConfig config;
-        config.oneBit = use1BitDithering;
-        config.logTag = "EBP";
-        if (ImageConverterFactory::convertToBmp(coverTempPath, coverPath, config)) {
+        if (CoverHelpers::convertImageToCoverAndThumb(coverTempPath, coverPath, getThumbBmpPath(), "EBP",
+                                                      use1BitDithering)) {
           SdMan.remove(coverTempPath.c_str());
           return true;
         }
@@ -801,11 +697,8 @@ bool Epub::generateCoverBmp(bool use1BitDithering) const {
   }
   coverFile.close();
 
-  ImageConvertConfig config;
-  config.oneBit = use1BitDithering;
-  config.logTag = "EBP";
-
-  const bool success = ImageConverterFactory::convertToBmp(coverTempPath, coverPath, config);
+  const bool success =
+      CoverHelpers::convertImageToCoverAndThumb(coverTempPath, coverPath, getThumbBmpPath(), "EBP", use1BitDithering);
   SdMan.remove(coverTempPath.c_str());
 
   if (!success) {
@@ -839,14 +732,14 @@ uint8_t* Epub::readItemContentsToBytes(const std::string& itemHref, size_t* size
 }
 
 bool Epub::readItemContentsToStream(const std::string& itemHref, Print& out, const size_t chunkSize,
-                                    uint8_t* dictBuffer) const {
+                                    uint8_t* dictBuffer, const char* checkpointPath, const uint32_t fromOffset) const {
   if (itemHref.empty()) {
     LOG_ERR(TAG, "Failed to read item, empty href");
     return false;
   }
 
   const std::string path = FsHelpers::normalisePath(itemHref);
-  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize, dictBuffer);
+  return ZipFile(filepath).readFileToStream(path.c_str(), out, chunkSize, dictBuffer, checkpointPath, fromOffset);
 }
 
 bool Epub::getItemSize(const std::string& itemHref, size_t* size) const {
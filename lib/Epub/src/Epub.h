@@ -1,5 +1,6 @@
 #pragma once
 
+#include <FsHelpers.h>
 #include <Print.h>
 
 #include <memory>
@@ -39,7 +40,7 @@ class Epub {
  public:
   explicit Epub(std::string filepath, const std::string& cacheDir) : filepath(std::move(filepath)) {
     // create a cache key based on the filepath
-    cachePath = cacheDir + "/epub_" + std::to_string(std::hash<std::string>{}(this->filepath));
+    cachePath = cacheDir + "/epub_" + std::to_string(FsHelpers::pathHash(this->filepath));
   }
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
@@ -52,16 +53,16 @@ class Epub {
   const std::string& getAuthor() const;
   const std::string& getLanguage() const;
   std::string getCoverBmpPath() const;
-  std::string getCoverPreviewBmpPath() const;
   bool generateCoverBmp(bool use1BitDithering = false) const;
-  bool generateCoverPreviewBmp() const;
   std::string getThumbBmpPath() const;
   bool generateThumbBmp() const;
   std::string findCoverImage() const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
+  // See ZipFile::readFileToStream for checkpointPath and fromOffset
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize,
-                                uint8_t* dictBuffer = nullptr) const;
+                                uint8_t* dictBuffer = nullptr, const char* checkpointPath = nullptr,
+                                uint32_t fromOffset = 0) const;
   bool getItemSize(const std::string& itemHref, size_t* size) const;
   BookMetadataCache::SpineEntry getSpineItem(int spineIndex) const;
   BookMetadataCache::TocEntry getTocItem(int tocIndex) const;
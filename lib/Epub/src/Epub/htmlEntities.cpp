@@ -8,7 +8,7 @@ struct HtmlEntity {
 };
 
 // Sorted by name for binary search. Covers the HTML entities commonly found in EPUBs.
-// Expat already handles the 5 XML built-in entities (&amp; &lt; &gt; &quot; &apos;).
+// The parsers already handle the 5 XML built-in entities (&amp; &lt; &gt; &quot; &apos;).
 static const HtmlEntity entities[] = {
     {"AElig", "\xC3\x86"},      {"Aacute", "\xC3\x81"},     {"Acirc", "\xC3\x82"},      {"Agrave", "\xC3\x80"},
     {"Alpha", "\xCE\x91"},      {"Aring", "\xC3\x85"},      {"Atilde", "\xC3\x83"},     {"Auml", "\xC3\x84"},
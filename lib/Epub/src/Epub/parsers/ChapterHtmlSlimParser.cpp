@@ -7,16 +7,14 @@
 #include <Logging.h>
 #include <Page.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 #include <Utf8.h>
 #include <esp_heap_caps.h>
-#include <expat.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
 #define TAG "HTML_PARSER"
 
-#include "../htmlEntities.h"
-
 const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
 constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
 
@@ -90,7 +88,7 @@ void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::BLOCK_STYLE style
 
     // If page batch limit was hit during makePages(), the text block may still
     // contain words that weren't laid out yet. Preserve them for resumeParsing()
-    // to process before the XML parser continues.
+    // to process before the tokenizer continues.
     if (stopRequested_) {
       pendingNewTextBlock_ = true;
       pendingBlockStyle_ = style;
@@ -98,15 +96,22 @@ void ChapterHtmlSlimParser::startNewTextBlock(const TextBlock::BLOCK_STYLE style
     }
   }
   currentTextBlock.reset(new ParsedText(style, config.indentLevel, config.hyphenation, true, pendingRtl_));
+
+  // Nothing is half-built at a fresh block: stop so parseLoop() can offer a checkpoint once
+  // the tokenizer is back between tokens
+  if (checkpointFn_ && pagesCreated_ >= nextCheckpointPage_) {
+    checkpointDue_ = true;
+    tokenizer_.stop();
+  }
 }
 
-void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
+void ChapterHtmlSlimParser::startElement(void* userData, const char* name, const char** atts) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
   (void)atts;
 
-  // Prevent stack overflow from deeply nested XML
+  // Prevent stack overflow from deeply nested markup
   if (self->depth >= MAX_XML_DEPTH) {
-    XML_StopParser(self->xmlParser_, XML_FALSE);
+    self->tokenizer_.abort();
     return;
   }
 
@@ -366,7 +371,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   self->depth += 1;
 }
 
-void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char* s, const int len) {
+void ChapterHtmlSlimParser::characterData(void* userData, const char* s, const int len) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
   // Middle of skip
@@ -375,9 +380,9 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
   }
 
   // Zero Width No-Break Space / BOM (U+FEFF) = 0xEF 0xBB 0xBF
-  const XML_Char FEFF_BYTE_1 = static_cast<XML_Char>(0xEF);
-  const XML_Char FEFF_BYTE_2 = static_cast<XML_Char>(0xBB);
-  const XML_Char FEFF_BYTE_3 = static_cast<XML_Char>(0xBF);
+  const char FEFF_BYTE_1 = static_cast<char>(0xEF);
+  const char FEFF_BYTE_2 = static_cast<char>(0xBB);
+  const char FEFF_BYTE_3 = static_cast<char>(0xBF);
 
   for (int i = 0; i < len; i++) {
     if (isWhitespace(s[i])) {
@@ -407,13 +412,13 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     self->partWordBuffer[self->partWordBufferIndex++] = s[i];
   }
 
-  // Flag for deferred split - handled outside XML callback to avoid stack overflow
+  // Flag for deferred split - handled outside the tokenizer callback to avoid stack overflow
   if (self->currentTextBlock && self->currentTextBlock->size() > 750) {
     self->pendingEmergencySplit_ = true;
   }
 }
 
-void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
+void ChapterHtmlSlimParser::endElement(void* userData, const char* name) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
   (void)name;
 
@@ -464,23 +469,6 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 }
 
-void XMLCALL ChapterHtmlSlimParser::defaultHandler(void* userData, const XML_Char* s, int len) {
-  // Called for text that expat doesn't handle — primarily undeclared entities.
-  // Expat handles the 5 built-in XML entities (&amp; &lt; &gt; &quot; &apos;) and any
-  // entities declared in the document's DTD. This catches HTML entities like &nbsp;,
-  // &mdash;, &ldquo; etc. that many EPUBs use without proper DTD declarations.
-  if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
-    const char* utf8 = lookupHtmlEntity(s + 1, len - 2);
-    if (utf8) {
-      characterData(userData, utf8, static_cast<int>(strlen(utf8)));
-      return;
-    }
-  }
-  // Not a recognized entity — silently drop.
-  // The default handler also receives XML/DOCTYPE declarations,
-  // comments, and processing instructions which must not become visible text.
-}
-
 bool ChapterHtmlSlimParser::shouldAbort() const {
   // Check external abort callback first (cooperative cancellation)
   if (externalAbortCallback_ && externalAbortCallback_()) {
@@ -507,13 +495,9 @@ bool ChapterHtmlSlimParser::shouldAbort() const {
 ChapterHtmlSlimParser::~ChapterHtmlSlimParser() { cleanupParser(); }
 
 void ChapterHtmlSlimParser::cleanupParser() {
-  if (xmlParser_) {
-    XML_SetElementHandler(xmlParser_, nullptr, nullptr);
-    XML_SetCharacterDataHandler(xmlParser_, nullptr);
-    XML_SetDefaultHandlerExpand(xmlParser_, nullptr);
-    XML_ParserFree(xmlParser_);
-    xmlParser_ = nullptr;
-  }
+  tokenizer_.reset();
+  chunkPos_ = 0;
+  chunkLen_ = 0;
   if (file_) {
     file_.close();
   }
@@ -532,46 +516,39 @@ bool ChapterHtmlSlimParser::initParser() {
   aborted_ = false;
   stopRequested_ = false;
   suspended_ = false;
+  checkpointDue_ = false;
+  nextCheckpointPage_ = CHECKPOINT_PAGE_INTERVAL;
   alignStack_.clear();
   dataUriStripper_.reset();
   startNewTextBlock(static_cast<TextBlock::BLOCK_STYLE>(config.paragraphAlignment));
 
-  xmlParser_ = XML_ParserCreate(nullptr);
-  if (!xmlParser_) {
-    LOG_ERR(TAG, "Couldn't allocate memory for parser");
-    return false;
-  }
+  tokenizer_.reset();
+  chunkPos_ = 0;
+  chunkLen_ = 0;
 
   if (!SdMan.openFileForRead("EHP", filepath, file_)) {
-    XML_ParserFree(xmlParser_);
-    xmlParser_ = nullptr;
     return false;
   }
 
   totalSize_ = file_.size();
-  bytesRead_ = 0;
+
+  // The byte order mark or XML declaration says how the chapter is encoded. Checkpoints are only
+  // taken in UTF-8 chapters, so a restored input (which starts mid-chapter) always reads as UTF-8.
+  const size_t headLen = file_.read(reinterpret_cast<uint8_t*>(chunk_), READ_CHUNK_SIZE);
+  bytesRead_ = transcoder_.detect(chunk_, headLen);
+  file_.seek(bytesRead_);
+  if (!transcoder_.passThrough()) {
+    LOG_DBG(TAG, "Converting %s chapter to UTF-8",
+            transcoder_.encoding() == ChapterTranscoder::Encoding::Latin1 ? "Latin-1" : "UTF-16");
+  }
   lastProgress_ = -1;
   pagesCreated_ = 0;
 
-  // Allow parsing documents with undeclared HTML entities (e.g. &nbsp;, &mdash;).
-  // Without this, Expat returns XML_ERROR_UNDEFINED_ENTITY for any entity
-  // not declared in the document's DTD. UseForeignDTD makes Expat treat
-  // undeclared entities as "skipped" rather than errors, passing them to
-  // our default handler for resolution via the HTML entity lookup table.
-  XML_UseForeignDTD(xmlParser_, XML_TRUE);
-
-  XML_SetUserData(xmlParser_, this);
-  XML_SetElementHandler(xmlParser_, startElement, endElement);
-  XML_SetCharacterDataHandler(xmlParser_, characterData);
-  XML_SetDefaultHandlerExpand(xmlParser_, defaultHandler);
-
   return true;
 }
 
 bool ChapterHtmlSlimParser::parseLoop() {
-  int done;
-
-  do {
+  for (;;) {
     // Periodic safety check and yield
     if (++loopCounter_ % YIELD_CHECK_INTERVAL == 0) {
       if (shouldAbort()) {
@@ -582,59 +559,79 @@ bool ChapterHtmlSlimParser::parseLoop() {
       vTaskDelay(1);  // Yield to prevent watchdog reset
     }
 
-    constexpr size_t kReadChunkSize = 1024;
-    constexpr size_t kDataUriPrefixSize = 10;  // max partial saved by DataUriStripper: "src=\"data:"
-    void* const buf = XML_GetBuffer(xmlParser_, kReadChunkSize + kDataUriPrefixSize);
-    if (!buf) {
-      LOG_ERR(TAG, "Couldn't allocate memory for buffer");
-      cleanupParser();
-      return false;
-    }
+    // Read the next chunk once the tokenizer has consumed the current one
+    if (chunkPos_ == chunkLen_) {
+      if (file_.available() == 0) {
+        // End of file: close whatever is still open. Closing a block may fill a page batch.
+        tokenizer_.finish();
+        if (tokenizer_.suspended()) {
+          suspended_ = true;
+          file_.close();
+          return true;
+        }
+        break;
+      }
 
-    size_t len = file_.read(static_cast<uint8_t*>(buf), kReadChunkSize);
+      // A converted chunk grows up to threefold, and the stripper may still prepend its held-back prefix
+      constexpr size_t CONVERT_CAPACITY = sizeof(chunk_) - DATA_URI_PREFIX_SIZE;
+      const size_t readSize =
+          transcoder_.passThrough() ? READ_CHUNK_SIZE : ChapterTranscoder::maxInput(CONVERT_CAPACITY);
+      size_t len = file_.read(reinterpret_cast<uint8_t*>(chunk_), readSize);
+      if (len == 0) {
+        LOG_ERR(TAG, "File read error");
+        cleanupParser();
+        return false;
+      }
+      const size_t originalLen = len;
+      len = transcoder_.convert(chunk_, len, CONVERT_CAPACITY);
+
+      // Strip data URIs before tokenizing to prevent OOM on large embedded images.
+      // This replaces src="data:image/..." with src="#" so the huge base64 string never reaches the parser.
+      const size_t heldBack = dataUriStripper_.pendingLength();
+      len = dataUriStripper_.strip(chunk_, len, sizeof(chunk_));
+      chunkPos_ = 0;
+      chunkLen_ = len;
+      chunkOffset_ = static_cast<uint32_t>(bytesRead_ - heldBack);
+      chunkMapped_ =
+          transcoder_.passThrough() && len + dataUriStripper_.pendingLength() == originalLen + heldBack;
+
+      // Update progress (call every 10% change to avoid too frequent updates)
+      // Only show progress for larger chapters where rendering overhead is worth it
+      bytesRead_ += originalLen;
+      if (progressFn && totalSize_ >= MIN_SIZE_FOR_PROGRESS) {
+        const int progress = static_cast<int>((bytesRead_ * 100) / totalSize_);
+        if (lastProgress_ / 10 != progress / 10) {
+          lastProgress_ = progress;
+          progressFn(progress);
+        }
+      }
+    }
 
-    if (len == 0) {
-      LOG_ERR(TAG, "File read error");
+    chunkPos_ += tokenizer_.feed(chunk_ + chunkPos_, chunkLen_ - chunkPos_);
+    if (tokenizer_.aborted()) {
+      LOG_ERR(TAG, "Parse aborted: nesting deeper than %d", MAX_XML_DEPTH);
       cleanupParser();
       return false;
     }
 
-    // Strip data URIs BEFORE expat parses the buffer to prevent OOM on large embedded images.
-    // This replaces src="data:image/..." with src="#" so expat never sees the huge base64 string.
-    const size_t originalLen = len;
-    len = dataUriStripper_.strip(static_cast<char*>(buf), len, kReadChunkSize + kDataUriPrefixSize);
-
-    // Update progress (call every 10% change to avoid too frequent updates)
-    // Only show progress for larger chapters where rendering overhead is worth it
-    bytesRead_ += originalLen;
-    if (progressFn && totalSize_ >= MIN_SIZE_FOR_PROGRESS) {
-      const int progress = static_cast<int>((bytesRead_ * 100) / totalSize_);
-      if (lastProgress_ / 10 != progress / 10) {
-        lastProgress_ = progress;
-        progressFn(progress);
+    if (checkpointDue_) {
+      checkpointDue_ = false;
+      if (tokenizer_.suspended() && !stopRequested_) {
+        recordCheckpoint();
+        continue;
       }
     }
 
-    done = file_.available() == 0;
-
-    const auto status = XML_ParseBuffer(xmlParser_, static_cast<int>(len), done);
-    if (status == XML_STATUS_ERROR) {
-      LOG_ERR(TAG, "Parse error at line %lu: %s", XML_GetCurrentLineNumber(xmlParser_),
-              XML_ErrorString(XML_GetErrorCode(xmlParser_)));
-      cleanupParser();
-      return false;
-    }
-
-    // XML_STATUS_SUSPENDED means completePageFn returned false (maxPages hit).
-    // Parser state is preserved for resume. Close file to free handle.
-    if (status == XML_STATUS_SUSPENDED) {
+    // A callback stopped the tokenizer because completePageFn returned false (maxPages hit).
+    // The unconsumed rest of the chunk is kept for resume. Close file to free handle.
+    if (tokenizer_.suspended()) {
       suspended_ = true;
       file_.close();
       return true;
     }
 
-    // Deferred emergency split - runs outside XML callback to avoid stack overflow.
-    // Inside characterData(), the call chain includes expat internal frames (~1-2KB).
+    // Deferred emergency split - runs outside the tokenizer callback to avoid stack overflow.
+    // Inside characterData(), the call chain includes the tokenizer's frames.
     // By splitting here, we save that stack space - critical for external fonts which
     // add extra frames through getExternalGlyphWidth() → ExternalFont::getGlyph() (SD I/O).
     if (pendingEmergencySplit_ && currentTextBlock && !currentTextBlock->isEmpty()) {
@@ -651,8 +648,14 @@ bool ChapterHtmlSlimParser::parseLoop() {
           renderer, config.fontId, config.viewportWidth,
           [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); }, false,
           [this]() -> bool { return shouldAbort(); });
+      // The split may have filled the page batch; suspend before feeding more text
+      if (stopRequested_) {
+        suspended_ = true;
+        file_.close();
+        return true;
+      }
     }
-  } while (!done);
+  }
 
   // Reached end of file or aborted — finalize
   // Process last page if there is still text
@@ -677,7 +680,7 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
 }
 
 bool ChapterHtmlSlimParser::resumeParsing() {
-  if (!suspended_ || !xmlParser_) {
+  if (!suspended_) {
     return false;
   }
 
@@ -710,7 +713,7 @@ bool ChapterHtmlSlimParser::resumeParsing() {
   }
 
   // Complete the deferred startNewTextBlock() that was interrupted by the batch limit.
-  // The XML parser already processed startElement() for the new block tag, so we must
+  // The tokenizer already reported startElement() for the new block tag, so we must
   // create the text block here before resuming — otherwise the new paragraph's text
   // would be appended to the old (now empty) text block with wrong style/no break.
   if (pendingNewTextBlock_) {
@@ -719,23 +722,123 @@ bool ChapterHtmlSlimParser::resumeParsing() {
         new ParsedText(pendingBlockStyle_, config.indentLevel, config.hyphenation, true, pendingRtl_));
   }
 
-  const auto status = XML_ResumeParser(xmlParser_);
-  if (status == XML_STATUS_ERROR) {
-    LOG_ERR(TAG, "Resume error: %s", XML_ErrorString(XML_GetErrorCode(xmlParser_)));
-    cleanupParser();
+  // Continue with the rest of the suspended chunk, then the file
+  return parseLoop();
+}
+
+void ChapterHtmlSlimParser::recordCheckpoint() {
+  // The input offset alone must say where to continue: no partial word, pending block or
+  // half-read tag, and the chunk untouched by the data URI stripper. Otherwise try at the next block.
+  if (!chunkMapped_ || !tokenizer_.idle() || partWordBufferIndex > 0 || pendingNewTextBlock_ ||
+      pendingEmergencySplit_ || !currentTextBlock || !currentTextBlock->isEmpty()) {
+    return;
+  }
+  nextCheckpointPage_ = pagesCreated_ + CHECKPOINT_PAGE_INTERVAL;
+  checkpointFn_(inputBase_ + chunkOffset_ + static_cast<uint32_t>(chunkPos_));
+}
+
+bool ChapterHtmlSlimParser::writeCheckpoint(FsFile& file) const {
+  for (const int d : {depth, skipUntilDepth, boldUntilDepth, italicUntilDepth, cssBoldUntilDepth, cssItalicUntilDepth,
+                      rtlUntilDepth_}) {
+    serialization::writePod(file, static_cast<int32_t>(d));
+  }
+  serialization::writePod(file, static_cast<uint8_t>(pendingRtl_ ? 1 : 0));
+  serialization::writePod(file, static_cast<uint8_t>(currentTextBlock->getStyle()));
+  serialization::writePod(file, pagesCreated_);
+  serialization::writePod(file, currentPageNextY);
+
+  serialization::writePod(file, static_cast<uint16_t>(alignStack_.size()));
+  for (const auto& entry : alignStack_) {
+    serialization::writePod(file, static_cast<int32_t>(entry.depth));
+    serialization::writePod(file, static_cast<uint8_t>(entry.style));
+  }
+
+  serialization::writePod(file, static_cast<uint16_t>(tokenizer_.depth()));
+  for (int i = 0; i < tokenizer_.depth(); i++) {
+    serialization::writeString(file, std::string(tokenizer_.openElement(i)));
+  }
+
+  serialization::writePod(file, static_cast<uint32_t>(anchorMap_.size()));
+  for (const auto& anchor : anchorMap_) {
+    serialization::writeString(file, anchor.first);
+    serialization::writePod(file, anchor.second);
+  }
+
+  serialization::writePod(file, static_cast<uint8_t>(currentPage ? 1 : 0));
+  return !currentPage || currentPage->serialize(file);
+}
+
+bool ChapterHtmlSlimParser::restoreCheckpoint(FsFile& file) {
+  if (!initParser()) {
     return false;
   }
 
-  // If resume itself caused a suspend (maxPages hit again immediately), we're done.
-  // Close file to free handle (same as the suspend path inside parseLoop).
-  if (status == XML_STATUS_SUSPENDED) {
-    suspended_ = true;
-    file_.close();
-    return true;
+  bool ok = true;
+  int32_t depths[7] = {};
+  for (auto& d : depths) {
+    ok = ok && serialization::readPodChecked(file, d);
   }
+  uint8_t rtl = 0;
+  uint8_t style = 0;
+  uint16_t alignCount = 0;
+  ok = ok && serialization::readPodChecked(file, rtl) && serialization::readPodChecked(file, style) &&
+       serialization::readPodChecked(file, pagesCreated_) && serialization::readPodChecked(file, currentPageNextY) &&
+       serialization::readPodChecked(file, alignCount) && alignCount <= MAX_XML_DEPTH;
 
-  // Continue the file-reading loop
-  return parseLoop();
+  for (uint16_t i = 0; ok && i < alignCount; i++) {
+    int32_t entryDepth = 0;
+    uint8_t entryStyle = 0;
+    ok = serialization::readPodChecked(file, entryDepth) && serialization::readPodChecked(file, entryStyle);
+    alignStack_.push_back({entryDepth, static_cast<TextBlock::BLOCK_STYLE>(entryStyle)});
+  }
+
+  uint16_t openCount = 0;
+  ok = ok && serialization::readPodChecked(file, openCount) && openCount <= html5::Tokenizer::MAX_DEPTH;
+  std::string name;
+  for (uint16_t i = 0; ok && i < openCount; i++) {
+    ok = serialization::readString(file, name);
+    tokenizer_.pushOpenElement(name.c_str());
+  }
+
+  uint32_t anchorCount = 0;
+  ok = ok && serialization::readPodChecked(file, anchorCount);
+  for (uint32_t i = 0; ok && i < anchorCount; i++) {
+    std::string id;
+    uint16_t page = 0;
+    ok = serialization::readString(file, id) && serialization::readPodChecked(file, page);
+    anchorMap_.emplace_back(std::move(id), page);
+  }
+
+  uint8_t hasPage = 0;
+  ok = ok && serialization::readPodChecked(file, hasPage);
+  if (ok && hasPage) {
+    currentPage = Page::deserialize(file);
+    ok = currentPage != nullptr;
+  }
+
+  if (!ok) {
+    LOG_ERR(TAG, "Invalid checkpoint");
+    anchorMap_.clear();
+    cleanupParser();
+    return false;
+  }
+
+  depth = depths[0];
+  skipUntilDepth = depths[1];
+  boldUntilDepth = depths[2];
+  italicUntilDepth = depths[3];
+  cssBoldUntilDepth = depths[4];
+  cssItalicUntilDepth = depths[5];
+  rtlUntilDepth_ = depths[6];
+  pendingRtl_ = rtl != 0;
+  currentTextBlock.reset(new ParsedText(static_cast<TextBlock::BLOCK_STYLE>(style), config.indentLevel,
+                                        config.hyphenation, true, pendingRtl_));
+  nextCheckpointPage_ = pagesCreated_ + CHECKPOINT_PAGE_INTERVAL;
+
+  // Suspended at the start of the input file; resumeParsing() reopens it
+  file_.close();
+  suspended_ = true;
+  return true;
 }
 
 void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
@@ -753,9 +856,7 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
       currentPage->elements.push_back(std::make_shared<PageLine>(line, 0, currentPageNextY));
       currentPageNextY += lineHeight;
       stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_TRUE);  // Resumable suspend
-      }
+      tokenizer_.stop();  // Resumable suspend
       return;
     }
     parseStartTime_ = millis();
@@ -831,7 +932,7 @@ std::string ChapterHtmlSlimParser::cacheImage(const std::string& src) {
   std::string resolvedPath = FsHelpers::normalisePath(chapterBasePath + src);
 
   // Generate cache filename from hash
-  size_t srcHash = std::hash<std::string>{}(resolvedPath);
+  const uint32_t srcHash = FsHelpers::pathHash(resolvedPath);
   std::string cachedBmpPath = imageCachePath + "/" + std::to_string(srcHash) + ".bmp";
 
   // Check if already cached
@@ -922,9 +1023,7 @@ void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
   if (isTallImage && currentPageNextY > 0) {
     if (!completePageFn(std::move(currentPage))) {
       stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_TRUE);  // Resumable suspend
-      }
+      tokenizer_.stop();  // Resumable suspend
       return;
     }
     parseStartTime_ = millis();
@@ -936,9 +1035,7 @@ void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
   if (currentPageNextY + imageHeight > config.viewportHeight) {
     if (!completePageFn(std::move(currentPage))) {
       stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_TRUE);  // Resumable suspend
-      }
+      tokenizer_.stop();  // Resumable suspend
       return;
     }
     parseStartTime_ = millis();
@@ -963,9 +1060,7 @@ void ChapterHtmlSlimParser::addImageToPage(std::shared_ptr<ImageBlock> image) {
   if (isTallImage) {
     if (!completePageFn(std::move(currentPage))) {
       stopRequested_ = true;
-      if (xmlParser_) {
-        XML_StopParser(xmlParser_, XML_TRUE);  // Resumable suspend
-      }
+      tokenizer_.stop();  // Resumable suspend
       return;
     }
     parseStartTime_ = millis();
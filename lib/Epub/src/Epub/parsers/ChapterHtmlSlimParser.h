@@ -1,10 +1,10 @@
 #pragma once
 
+#include <Html5Tokenizer.h>
 #include <ParsedText.h>
 #include <RenderConfig.h>
 #include <blocks/ImageBlock.h>
 #include <blocks/TextBlock.h>
-#include <expat.h>
 
 #include <climits>
 #include <cstring>
@@ -15,6 +15,8 @@
 #include <vector>
 
 #include "../css/CssParser.h"
+#include "../htmlEntities.h"
+#include "ChapterTranscoder.h"
 #include "DataUriStripper.h"
 
 class Page;
@@ -52,8 +54,8 @@ class ChapterHtmlSlimParser {
   // CSS support
   const CssParser* cssParser_ = nullptr;
 
-  // XML parser handle for stopping mid-parse
-  XML_Parser xmlParser_ = nullptr;
+  // HTML tokenizer; callbacks stop() it mid-chunk to suspend
+  html5::Tokenizer tokenizer_;
   bool stopRequested_ = false;
   bool pendingEmergencySplit_ = false;
   bool pendingNewTextBlock_ = false;
@@ -87,12 +89,31 @@ class ChapterHtmlSlimParser {
   static constexpr uint16_t CSS_HEAP_CHECK_INTERVAL = 64;  // Check heap for CSS every 64 elements
   static constexpr size_t MIN_FREE_HEAP = 8192;            // 8KB minimum free heap
 
-  // Pre-parse data URI stripper to prevent expat OOM on large embedded images
+  // Pre-parse data URI stripper so huge base64 images never reach the tokenizer
   DataUriStripper dataUriStripper_;
+  // Latin-1 and UTF-16 chapters are converted to UTF-8 before stripping and tokenizing
+  ChapterTranscoder transcoder_;
+
+  // Read chunk, kept across a suspend until the tokenizer has consumed all of it
+  static constexpr size_t READ_CHUNK_SIZE = 1024;
+  static constexpr size_t DATA_URI_PREFIX_SIZE = 10;  // max partial saved by DataUriStripper: "src=\"data:"
+  char chunk_[READ_CHUNK_SIZE + DATA_URI_PREFIX_SIZE] = {};
+  size_t chunkPos_ = 0;
+  size_t chunkLen_ = 0;
 
   // Anchor-to-page mapping: element id → page index (0-based)
   std::vector<std::pair<std::string, uint16_t>> anchorMap_;
 
+  // Resume checkpoints: every few pages, at the start of a block, the parse state is offered to
+  // checkpointFn_ together with the chapter offset to continue from
+  static constexpr uint16_t CHECKPOINT_PAGE_INTERVAL = 4;
+  std::function<void(uint32_t)> checkpointFn_;
+  uint32_t inputBase_ = 0;      // Chapter offset of the first byte of filepath
+  uint32_t chunkOffset_ = 0;    // File offset of chunk_[0]
+  bool chunkMapped_ = false;    // chunk_ positions map 1:1 to the file (UTF-8, no data URI stripped)
+  bool checkpointDue_ = false;  // A fresh block stopped the tokenizer to take a checkpoint
+  uint16_t nextCheckpointPage_ = CHECKPOINT_PAGE_INTERVAL;
+
   // Check if parsing should abort due to timeout or memory pressure
   bool shouldAbort() const;
 
@@ -101,11 +122,10 @@ class ChapterHtmlSlimParser {
   void makePages();
   std::string cacheImage(const std::string& src);
   void addImageToPage(std::shared_ptr<ImageBlock> image);
-  // XML callbacks
-  static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
-  static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
-  static void XMLCALL endElement(void* userData, const XML_Char* name);
-  static void XMLCALL defaultHandler(void* userData, const XML_Char* s, int len);
+  // Tokenizer callbacks
+  static void startElement(void* userData, const char* name, const char** atts);
+  static void characterData(void* userData, const char* s, int len);
+  static void endElement(void* userData, const char* name);
 
   // Suspend/resume state
   FsFile file_;
@@ -117,6 +137,7 @@ class ChapterHtmlSlimParser {
   bool initParser();
   bool parseLoop();
   void cleanupParser();
+  void recordCheckpoint();
 
  public:
   explicit ChapterHtmlSlimParser(const std::string& filepath, GfxRenderer& renderer, const RenderConfig& config,
@@ -135,11 +156,23 @@ class ChapterHtmlSlimParser {
         imageCachePath(imageCachePath),
         readItemFn(readItemFn),
         cssParser_(cssParser),
+        tokenizer_({this, startElement, endElement, characterData, lookupHtmlEntity}),
         externalAbortCallback_(externalAbortCallback) {}
   ~ChapterHtmlSlimParser();
   bool parseAndBuildPages();
   bool resumeParsing();
   bool isSuspended() const { return suspended_; }
+
+  // Called with a chapter offset whenever a checkpoint can be taken; the callee saves it with
+  // writeCheckpoint(). inputBase is the chapter offset the input file starts at.
+  void setCheckpointFn(const std::function<void(uint32_t)>& fn, const uint32_t inputBase = 0) {
+    checkpointFn_ = fn;
+    inputBase_ = inputBase;
+  }
+  bool writeCheckpoint(FsFile& file) const;
+  // Instead of parseAndBuildPages(): load a checkpoint, whose offset the input file must start
+  // at, and leave the parser suspended so resumeParsing() continues from there
+  bool restoreCheckpoint(FsFile& file);
   void addLineToPage(std::shared_ptr<TextBlock> line);
   bool wasAborted() const { return aborted_; }
   const std::vector<std::pair<std::string, uint16_t>>& getAnchorMap() const { return anchorMap_; }
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <strings.h>
+
+// Converts chapters stored in a legacy encoding to the UTF-8 the tokenizer and layout expect.
+//
+// Expat read the byte order mark and the XML declaration and delivered UTF-8 whatever the file
+// used; the HTML tokenizer passes bytes through, so the parser runs chunks through here first.
+// Recognised: UTF-16 (either byte order, by BOM or by the "<" it starts with) and ISO-8859-1,
+// which is decoded as windows-1252 the way browsers do, so the C1 range gives its quotes and
+// dashes rather than control codes. Anything else is left as UTF-8.
+class ChapterTranscoder {
+ public:
+  enum class Encoding : uint8_t { Utf8, Latin1, Utf16Le, Utf16Be };
+
+  // Largest input convert() can expand within capacity bytes (UTF-8 takes up to 3 bytes for each
+  // input byte, plus a few for a character split across chunks)
+  static constexpr size_t maxInput(const size_t capacity) { return capacity / 3 - 2; }
+
+  void reset() {
+    encoding_ = Encoding::Utf8;
+    carry_ = -1;
+    highSurrogate_ = 0;
+  }
+
+  // Picks the encoding from the start of the chapter. Returns the length of the byte order mark,
+  // which is not part of the text.
+  size_t detect(const char* data, const size_t len) {
+    reset();
+    const auto* p = reinterpret_cast<const uint8_t*>(data);
+    if (len >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF) return 3;
+    if (len >= 2 && p[0] == 0xFF && p[1] == 0xFE) {
+      encoding_ = Encoding::Utf16Le;
+      return 2;
+    }
+    if (len >= 2 && p[0] == 0xFE && p[1] == 0xFF) {
+      encoding_ = Encoding::Utf16Be;
+      return 2;
+    }
+    if (len >= 2 && p[0] == '<' && p[1] == 0) {
+      encoding_ = Encoding::Utf16Le;
+    } else if (len >= 2 && p[0] == 0 && p[1] == '<') {
+      encoding_ = Encoding::Utf16Be;
+    } else if (isLatin1(declaredEncoding(data, len))) {
+      encoding_ = Encoding::Latin1;
+    }
+    return 0;
+  }
+
+  Encoding encoding() const { return encoding_; }
+  bool passThrough() const { return encoding_ == Encoding::Utf8; }
+
+  // Converts the len bytes at the start of buf to UTF-8 in place; len must not exceed
+  // maxInput(capacity). Returns the new length, which may be 0 when the chunk ends in the middle
+  // of a character (the rest of it is kept for the next call).
+  size_t convert(char* buf, const size_t len, const size_t capacity) {
+    if (passThrough()) return len;
+    if (len == 0 || len > maxInput(capacity)) return 0;
+
+    // Move the input to the end so the output, written from the start, never overtakes it
+    const size_t in = capacity - len;
+    memmove(buf + in, buf, len);
+    const auto* src = reinterpret_cast<const uint8_t*>(buf + in);
+    auto* out = reinterpret_cast<uint8_t*>(buf);
+    size_t n = 0;
+
+    if (encoding_ == Encoding::Latin1) {
+      for (size_t i = 0; i < len; i++) {
+        const uint8_t c = src[i];
+        n += encodeUtf8(c >= 0x80 && c < 0xA0 ? WINDOWS_1252_C1[c - 0x80] : c, out + n);
+      }
+      return n;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+      if (carry_ < 0) {
+        carry_ = src[i];
+        continue;
+      }
+      const uint16_t unit = encoding_ == Encoding::Utf16Le ? static_cast<uint16_t>(carry_ | src[i] << 8)
+                                                           : static_cast<uint16_t>(carry_ << 8 | src[i]);
+      carry_ = -1;
+
+      if (highSurrogate_ != 0) {
+        const uint16_t high = highSurrogate_;
+        highSurrogate_ = 0;
+        if (unit >= 0xDC00 && unit <= 0xDFFF) {
+          n += encodeUtf8(0x10000 + ((high - 0xD800) << 10) + (unit - 0xDC00), out + n);
+          continue;
+        }
+        n += encodeUtf8(REPLACEMENT, out + n);
+      }
+      if (unit >= 0xD800 && unit <= 0xDBFF) {
+        highSurrogate_ = unit;
+      } else {
+        n += encodeUtf8(unit >= 0xDC00 && unit <= 0xDFFF ? REPLACEMENT : unit, out + n);
+      }
+    }
+    return n;
+  }
+
+ private:
+  static constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+  // windows-1252 for 0x80-0x9F; the five unassigned bytes keep their Latin-1 code points
+  static constexpr uint16_t WINDOWS_1252_C1[32] = {
+      0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160,
+      0x2039, 0x0152, 0x008D, 0x017D, 0x008F, 0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022,
+      0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178};
+
+  static size_t encodeUtf8(const uint32_t cp, uint8_t* out) {
+    if (cp < 0x80) {
+      out[0] = static_cast<uint8_t>(cp);
+      return 1;
+    }
+    if (cp < 0x800) {
+      out[0] = static_cast<uint8_t>(0xC0 | cp >> 6);
+      out[1] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+      return 2;
+    }
+    if (cp < 0x10000) {
+      out[0] = static_cast<uint8_t>(0xE0 | cp >> 12);
+      out[1] = static_cast<uint8_t>(0x80 | (cp >> 6 & 0x3F));
+      out[2] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+      return 3;
+    }
+    out[0] = static_cast<uint8_t>(0xF0 | cp >> 18);
+    out[1] = static_cast<uint8_t>(0x80 | (cp >> 12 & 0x3F));
+    out[2] = static_cast<uint8_t>(0x80 | (cp >> 6 & 0x3F));
+    out[3] = static_cast<uint8_t>(0x80 | (cp & 0x3F));
+    return 4;
+  }
+
+  // The value of encoding="..." in an XML declaration at the start of data, or nullptr. The
+  // value ends at its closing quote.
+  static const char* declaredEncoding(const char* data, const size_t len) {
+    if (len < 5 || strncmp(data, "<?xml", 5) != 0) return nullptr;
+    for (size_t i = 5; i + 1 < len && !(data[i] == '?' && data[i + 1] == '>'); i++) {
+      if (i + 8 > len || strncmp(data + i, "encoding", 8) != 0) continue;
+      size_t j = i + 8;
+      while (j < len && (data[j] == ' ' || data[j] == '\t' || data[j] == '\r' || data[j] == '\n')) j++;
+      if (j >= len || data[j] != '=') return nullptr;
+      j++;
+      while (j < len && (data[j] == ' ' || data[j] == '\t' || data[j] == '\r' || data[j] == '\n')) j++;
+      if (j >= len || (data[j] != '"' && data[j] != '\'')) return nullptr;
+      const char quote = data[j];
+      const char* value = data + j + 1;
+      const void* end = memchr(value, quote, len - j - 1);
+      return end ? value : nullptr;
+    }
+    return nullptr;
+  }
+
+  static bool isLatin1(const char* value) {
+    if (!value) return false;
+    static const char* const NAMES[] = {"iso-8859-1", "iso8859-1",    "iso_8859-1",
+                                        "latin1",     "windows-1252", "cp1252"};
+    for (const char* name : NAMES) {
+      const size_t n = strlen(name);
+      if (strncasecmp(value, name, n) == 0 && (value[n] == '"' || value[n] == '\'')) return true;
+    }
+    return false;
+  }
+
+  Encoding encoding_ = Encoding::Utf8;
+  int16_t carry_ = -1;          // First byte of a UTF-16 code unit split across chunks
+  uint16_t highSurrogate_ = 0;  // Waiting for the low half of a surrogate pair
+};
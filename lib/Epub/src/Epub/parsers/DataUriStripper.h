@@ -2,9 +2,9 @@
 
 #include <cstring>
 
-// Strips data URIs from HTML buffer before XML parsing to prevent expat OOM.
+// Strips data URIs from HTML buffer before parsing to prevent OOM.
 // Data URIs like src="data:image/jpeg;base64,..." are replaced with src="#"
-// which is small enough for expat to handle safely.
+// which is small enough for the parser to handle safely.
 //
 // Note: Does not handle whitespace around '=' (e.g., src = "data:...").
 // Such cases are caught by the fallback check in cacheImage().
@@ -119,6 +119,9 @@ class DataUriStripper {
     return writePos;
   }
 
+  // Bytes held back from the last buffer (a possible 'src="data:' start), prepended to the next
+  size_t pendingLength() const { return partialLen_; }
+
   void reset() {
     partialLen_ = 0;
     skippingDataUri_ = false;
@@ -8,23 +8,28 @@
 
 #include <CoverHelpers.h>
 #include <FsHelpers.h>
+#include <ImageConverter.h>
 #include <Logging.h>
 
 #define TAG "FB2"
 #include <SDCardManager.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
+#include "Fb2Image.h"
+
 namespace {
-constexpr uint8_t kMetaCacheVersion = 2;
+constexpr uint8_t kMetaCacheVersion = 4;
 constexpr char kMetaCacheFile[] = "/meta.bin";
 }  // namespace
 
 Fb2::Fb2(std::string filepath, const std::string& cacheDir)
     : filepath(std::move(filepath)), fileSize(0), loaded(false) {
   // Create cache key based on filepath (same as Epub/Xtc/Txt)
-  cachePath = cacheDir + "/fb2_" + std::to_string(std::hash<std::string>{}(this->filepath));
+  cachePath = cacheDir + "/fb2_" + std::to_string(FsHelpers::pathHash(this->filepath));
 
   // Extract title from filename
   size_t lastSlash = this->filepath.find_last_of('/');
@@ -72,6 +77,10 @@ bool Fb2::load() {
   }
 
   fileSize = file.size();
+  // Structure first, so the XML parse below can stop at the end of the main body
+  if (!index_.scan(file)) {
+    LOG_INF(TAG, "No complete main body found, parsing the whole file");
+  }
   file.close();
 
   // Stream-parse in chunks (file may exceed available RAM)
@@ -300,17 +309,29 @@ bool Fb2::parseXmlStream() {
   uint8_t buffer[kChunkSize];
   bool success = true;
 
-  while (file.available() > 0) {
-    const size_t bytesRead = file.read(buffer, kChunkSize);
-    if (bytesRead == 0) break;
-
-    const int done = (file.available() == 0) ? 1 : 0;
-    if (XML_Parse(xmlParser_, reinterpret_cast<const char*>(buffer), static_cast<int>(bytesRead), done) ==
-        XML_STATUS_ERROR) {
-      LOG_ERR(TAG, "XML parse error: %s", XML_ErrorString(XML_GetErrorCode(xmlParser_)));
-      success = false;
-      break;
+  // Metadata and TOC all come before the end of the main body; binaries are jumped over
+  const uint32_t end = std::min<uint32_t>(index_.contentEnd(), static_cast<uint32_t>(fileSize));
+  uint32_t pos = 0;
+  while (success && pos < end) {
+    const uint32_t stop = std::min(index_.spanEnd(pos), end);
+    file.seekSet(pos);
+    while (pos < stop) {
+      const size_t bytesRead = file.read(buffer, std::min<size_t>(kChunkSize, stop - pos));
+      if (bytesRead == 0) {
+        pos = end;
+        break;
+      }
+      pos += static_cast<uint32_t>(bytesRead);
+
+      const int done = (pos >= fileSize) ? 1 : 0;
+      if (XML_Parse(xmlParser_, reinterpret_cast<const char*>(buffer), static_cast<int>(bytesRead), done) ==
+          XML_STATUS_ERROR) {
+        LOG_ERR(TAG, "XML parse error: %s", XML_ErrorString(XML_GetErrorCode(xmlParser_)));
+        success = false;
+        break;
+      }
     }
+    pos = index_.nextStart(pos);
   }
 
   file.close();
@@ -414,8 +435,9 @@ bool Fb2::generateCoverBmp(bool use1BitDithering) const {
   // Setup cache directory
   setupCacheDir();
 
-  // Convert to BMP using shared helper
-  const bool success = CoverHelpers::convertImageToBmp(coverImagePath, coverPath, "FB2", use1BitDithering);
+  // Convert to BMP using shared helper (thumbnail comes out of the same decode)
+  const bool success =
+      CoverHelpers::convertImageToCoverAndThumb(coverImagePath, coverPath, getThumbBmpPath(), "FB2", use1BitDithering);
   if (!success) {
     // Create failure marker
     FsFile marker;
@@ -463,6 +485,73 @@ bool Fb2::generateThumbBmp() const {
   return success;
 }
 
+bool Fb2::cacheImage(const std::string& bmpPath, const int maxWidth, const int maxHeight) const {
+  if (SdMan.exists(bmpPath.c_str())) {
+    return true;
+  }
+
+  const std::string imageDir = getImageCachePath() + "/";
+  if (bmpPath.compare(0, imageDir.size(), imageDir) != 0) {
+    return false;
+  }
+  char* end = nullptr;
+  const unsigned long binary = strtoul(bmpPath.c_str() + imageDir.size(), &end, 10);
+  if (strcmp(end, ".bmp") != 0 || binary >= index_.binaries.size()) {
+    return false;
+  }
+
+  // Previously failed, don't retry
+  const std::string name = std::to_string(binary);
+  const std::string failedMarkerPath = imageDir + name + ".failed";
+  if (SdMan.exists(failedMarkerPath.c_str())) {
+    return false;
+  }
+
+  FsFile book;
+  if (!SdMan.openFileForRead("FB2", filepath, book)) {
+    return false;
+  }
+
+  // The converters seek in their input, so the image goes through a temp file, decoded a chunk at a time
+  ImageHeaderProbe probe;
+  std::string tempPath;
+  bool success = Fb2Image::probe(book, index_.binaries[binary], probe);
+  if (success) {
+    SdMan.mkdir(getImageCachePath().c_str());
+    tempPath = imageDir + ".tmp_" + name + (probe.format() == ImageHeaderProbe::Format::PNG ? ".png" : ".jpg");
+    FsFile temp;
+    success = SdMan.openFileForWrite("FB2", tempPath, temp);
+    if (success) {
+      success = Fb2Image::extract(book, index_.binaries[binary], temp);
+      temp.close();
+    }
+  }
+  book.close();
+
+  if (success) {
+    ImageConvertConfig config;
+    config.maxWidth = maxWidth;
+    config.maxHeight = maxHeight;
+    config.logTag = "FB2";
+    success = ImageConverterFactory::convertToBmp(tempPath, bmpPath, config);
+  }
+  if (!tempPath.empty()) {
+    SdMan.remove(tempPath.c_str());
+  }
+
+  if (!success) {
+    LOG_ERR(TAG, "Failed to convert image %s", name.c_str());
+    SdMan.remove(bmpPath.c_str());
+    FsFile marker;
+    if (SdMan.openFileForWrite("FB2", failedMarkerPath, marker)) {
+      marker.close();
+    }
+    return false;
+  }
+  LOG_DBG(TAG, "Cached image: %s", bmpPath.c_str());
+  return true;
+}
+
 bool Fb2::loadMetaCache() {
   const std::string metaPath = cachePath + kMetaCacheFile;
   FsFile file;
@@ -521,6 +610,11 @@ bool Fb2::loadMetaCache() {
     tocItems_.push_back(std::move(item));
   }
 
+  if (!index_.read(file)) {
+    file.close();
+    return false;
+  }
+
   file.close();
   return true;
 }
@@ -555,6 +649,8 @@ bool Fb2::saveMetaCache() const {
     serialization::writePod(file, idx);
   }
 
+  index_.write(file);
+
   file.close();
   LOG_INF(TAG, "Saved meta cache (%u TOC items)", tocItemCount);
   return true;
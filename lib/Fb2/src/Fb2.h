@@ -14,6 +14,8 @@
 #include <string>
 #include <vector>
 
+#include "Fb2Index.h"
+
 /**
  * Fb2 File Handler
  *
@@ -34,6 +36,7 @@ class Fb2 {
   std::string coverPath;
   size_t fileSize;
   bool loaded;
+  Fb2Index index_;
 
   // XML parsing state
   XML_Parser xmlParser_ = nullptr;
@@ -108,6 +111,11 @@ class Fb2 {
   std::string getThumbBmpPath() const;
   bool generateThumbBmp() const;
 
+  // Inline images: Fb2Parser lays them out as <image cache path>/<binary number>.bmp, and they are
+  // only decoded from the book's base64 when a page showing them is first rendered
+  std::string getImageCachePath() const { return cachePath + "/images"; }
+  bool cacheImage(const std::string& bmpPath, int maxWidth, int maxHeight) const;
+
   /**
    * Read content from file at specified offset
    * @param buffer Output buffer
@@ -126,6 +134,9 @@ class Fb2 {
   // Check if file is loaded
   bool isLoaded() const { return loaded; }
 
+  // Structure offsets (empty when the scan found no complete main body)
+  const Fb2Index& getIndex() const { return index_; }
+
   // TOC access
   uint16_t tocCount() const { return static_cast<uint16_t>(tocItems_.size()); }
   const TocItem& getTocItem(uint16_t index) const { return tocItems_[index]; }
@@ -0,0 +1,218 @@
+#include "Fb2Image.h"
+
+#include <SdFat.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// Small enough for the parser's stack: probing runs inside Expat callbacks
+constexpr size_t kProbeChunkSize = 128;
+constexpr size_t kExtractChunkSize = 512;
+
+constexpr uint8_t kPngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+int sextet(const uint8_t c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+' || c == '-') return 62;
+  if (c == '/' || c == '_') return 63;
+  return -1;
+}
+
+uint32_t readBe32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+}  // namespace
+
+size_t Fb2BinaryDecoder::feed(const uint8_t* in, const size_t length, uint8_t* out) {
+  size_t written = 0;
+  for (size_t i = 0; i < length && state_ != State::END; i++) {
+    const uint8_t c = in[i];
+    switch (state_) {
+      case State::START_TAG:
+        if (c == '"' || c == '\'') {
+          quote_ = static_cast<char>(c);
+          state_ = State::QUOTED;
+        } else if (c == '>') {
+          state_ = State::DATA;
+        }
+        break;
+      case State::QUOTED:
+        if (c == static_cast<uint8_t>(quote_)) state_ = State::START_TAG;
+        break;
+      case State::DATA: {
+        const int value = sextet(c);
+        if (value >= 0) {
+          bits_ = (bits_ << 6) | static_cast<uint32_t>(value);
+          if (++sextets_ == 4) {
+            out[written++] = static_cast<uint8_t>(bits_ >> 16);
+            out[written++] = static_cast<uint8_t>(bits_ >> 8);
+            out[written++] = static_cast<uint8_t>(bits_);
+            bits_ = 0;
+            sextets_ = 0;
+          }
+        } else if (c == '=' || c == '<') {
+          written += flush(out + written);
+          state_ = (c == '<') ? State::END : State::PADDING;
+        }
+        break;
+      }
+      case State::PADDING:
+        if (c == '<') state_ = State::END;
+        break;
+      case State::END:
+        break;
+    }
+  }
+  return written;
+}
+
+size_t Fb2BinaryDecoder::flush(uint8_t* out) {
+  size_t written = 0;
+  if (sextets_ == 2) {
+    out[written++] = static_cast<uint8_t>(bits_ >> 4);
+  } else if (sextets_ == 3) {
+    out[written++] = static_cast<uint8_t>(bits_ >> 10);
+    out[written++] = static_cast<uint8_t>(bits_ >> 2);
+  }
+  bits_ = 0;
+  sextets_ = 0;
+  return written;
+}
+
+bool ImageHeaderProbe::feed(const uint8_t* data, const size_t length) {
+  size_t i = 0;
+  while (i < length && !finished()) {
+    if (state_ == State::JPEG_SKIP) {
+      // Skip the rest of a segment (EXIF data and thumbnails can be tens of KB) in one go
+      const size_t skip = std::min<size_t>(remaining_, length - i);
+      remaining_ -= static_cast<uint32_t>(skip);
+      i += skip;
+      if (remaining_ == 0) state_ = State::JPEG_MARKER;
+      continue;
+    }
+    step(data[i++]);
+  }
+  return finished();
+}
+
+void ImageHeaderProbe::step(const uint8_t c) {
+  switch (state_) {
+    case State::SIGNATURE:
+      header_[count_++] = c;
+      if (count_ < 2) return;
+      if (header_[0] == 0xFF && header_[1] == 0xD8) {
+        format_ = Format::JPEG;
+        state_ = State::JPEG_MARKER;
+      } else if (header_[0] == kPngSignature[0] && header_[1] == kPngSignature[1]) {
+        format_ = Format::PNG;
+        state_ = State::PNG_HEADER;
+      } else {
+        state_ = State::FAILED;
+      }
+      return;
+    case State::PNG_HEADER:
+      header_[count_++] = c;
+      if (count_ < sizeof(header_)) return;
+      if (memcmp(header_, kPngSignature, sizeof(kPngSignature)) != 0 || memcmp(header_ + 12, "IHDR", 4) != 0) {
+        state_ = State::FAILED;
+        return;
+      }
+      width_ = readBe32(header_ + 16);
+      height_ = readBe32(header_ + 20);
+      state_ = (width_ > 0 && height_ > 0) ? State::DONE : State::FAILED;
+      return;
+    case State::JPEG_MARKER:
+      state_ = (c == 0xFF) ? State::JPEG_CODE : State::FAILED;
+      return;
+    case State::JPEG_CODE:
+      if (c == 0xFF) return;  // Fill bytes
+      if (c == 0xD8 || c == 0x01 || (c >= 0xD0 && c <= 0xD7)) {
+        state_ = State::JPEG_MARKER;  // Markers without a segment
+        return;
+      }
+      if (c == 0x00 || c == 0xD9 || c == 0xDA) {
+        state_ = State::FAILED;  // Scan data or the end of the image before any frame header
+        return;
+      }
+      // SOF0..SOF15, except DHT (C4), JPG (C8) and DAC (CC) which share the range
+      frame_ = c >= 0xC0 && c <= 0xCF && c != 0xC4 && c != 0xC8 && c != 0xCC;
+      count_ = 0;
+      state_ = State::JPEG_LENGTH;
+      return;
+    case State::JPEG_LENGTH:
+      header_[count_++] = c;
+      if (count_ < 2) return;
+      remaining_ = (static_cast<uint32_t>(header_[0]) << 8) | header_[1];
+      count_ = 0;
+      if (remaining_ < (frame_ ? 7u : 2u)) {
+        state_ = State::FAILED;
+      } else if (frame_) {
+        state_ = State::JPEG_FRAME;
+      } else {
+        remaining_ -= 2;
+        state_ = remaining_ > 0 ? State::JPEG_SKIP : State::JPEG_MARKER;
+      }
+      return;
+    case State::JPEG_FRAME:
+      // Precision, then height and width
+      header_[count_++] = c;
+      if (count_ < 5) return;
+      height_ = (static_cast<uint32_t>(header_[1]) << 8) | header_[2];
+      width_ = (static_cast<uint32_t>(header_[3]) << 8) | header_[4];
+      state_ = (width_ > 0 && height_ > 0) ? State::DONE : State::FAILED;
+      return;
+    case State::JPEG_SKIP:
+    case State::DONE:
+    case State::FAILED:
+      return;
+  }
+}
+
+namespace Fb2Image {
+
+bool probe(FsFile& book, const Fb2Index::Range& binary, ImageHeaderProbe& probe) {
+  if (binary.end <= binary.start || !book.seekSet(binary.start)) {
+    return false;
+  }
+
+  Fb2BinaryDecoder decoder;
+  uint8_t in[kProbeChunkSize];
+  uint8_t out[Fb2BinaryDecoder::outputSize(kProbeChunkSize)];
+  uint32_t pos = binary.start;
+  while (pos < binary.end && !probe.finished() && !decoder.finished()) {
+    const int bytesRead = book.read(in, std::min<size_t>(kProbeChunkSize, binary.end - pos));
+    if (bytesRead <= 0) break;
+    pos += static_cast<uint32_t>(bytesRead);
+    probe.feed(out, decoder.feed(in, static_cast<size_t>(bytesRead), out));
+  }
+  return probe.valid();
+}
+
+bool extract(FsFile& book, const Fb2Index::Range& binary, FsFile& out) {
+  if (binary.end <= binary.start || !book.seekSet(binary.start)) {
+    return false;
+  }
+
+  Fb2BinaryDecoder decoder;
+  uint8_t in[kExtractChunkSize];
+  uint8_t decoded[Fb2BinaryDecoder::outputSize(kExtractChunkSize)];
+  uint32_t pos = binary.start;
+  size_t total = 0;
+  while (pos < binary.end && !decoder.finished()) {
+    const int bytesRead = book.read(in, std::min<size_t>(kExtractChunkSize, binary.end - pos));
+    if (bytesRead <= 0) break;
+    pos += static_cast<uint32_t>(bytesRead);
+    const size_t length = decoder.feed(in, static_cast<size_t>(bytesRead), decoded);
+    if (length > 0 && out.write(decoded, length) != length) {
+      return false;
+    }
+    total += length;
+  }
+  return decoder.finished() && total > 0;
+}
+
+}  // namespace Fb2Image
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Fb2Index.h"
+
+class FsFile;
+
+/**
+ * Decodes the base64 of a <binary> element, fed the element's bytes from the '<' of its start tag
+ * on, in chunks split anywhere. Whitespace is skipped, and decoding ends at the end tag.
+ */
+class Fb2BinaryDecoder {
+ public:
+  /** Room the output of feed() needs for length input bytes. */
+  static constexpr size_t outputSize(const size_t length) { return (length + 3) / 4 * 3; }
+
+  /** Decode the next chunk into out; returns the bytes written. */
+  size_t feed(const uint8_t* in, size_t length, uint8_t* out);
+
+  /** True once the end tag has been reached. */
+  bool finished() const { return state_ == State::END; }
+
+ private:
+  enum class State : uint8_t { START_TAG, QUOTED, DATA, PADDING, END };
+
+  size_t flush(uint8_t* out);
+
+  State state_ = State::START_TAG;
+  char quote_ = 0;
+  uint32_t bits_ = 0;
+  uint8_t sextets_ = 0;  // Sextets in bits_
+};
+
+/**
+ * Reads the pixel size of a JPEG (from its frame header) or a PNG (from IHDR) out of its first
+ * bytes, fed in chunks, without decoding any pixels. JPEG segments before the frame header, such
+ * as EXIF thumbnails, are skipped without being kept.
+ */
+class ImageHeaderProbe {
+ public:
+  enum class Format : uint8_t { UNKNOWN, JPEG, PNG };
+
+  /** Feed the next decoded bytes; returns true once the size is known or can't be found. */
+  bool feed(const uint8_t* data, size_t length);
+
+  bool finished() const { return state_ == State::DONE || state_ == State::FAILED; }
+  bool valid() const { return state_ == State::DONE; }
+  Format format() const { return format_; }
+  uint32_t width() const { return width_; }
+  uint32_t height() const { return height_; }
+
+ private:
+  enum class State : uint8_t {
+    SIGNATURE,
+    PNG_HEADER,
+    JPEG_MARKER,
+    JPEG_CODE,
+    JPEG_LENGTH,
+    JPEG_SKIP,
+    JPEG_FRAME,
+    DONE,
+    FAILED
+  };
+
+  void step(uint8_t c);
+
+  State state_ = State::SIGNATURE;
+  Format format_ = Format::UNKNOWN;
+  uint8_t header_[24] = {};  // PNG signature and IHDR, or the JPEG frame header fields
+  uint8_t count_ = 0;        // Bytes in header_
+  bool frame_ = false;       // The segment being read is a frame header (SOFn)
+  uint32_t remaining_ = 0;   // Bytes of the segment left to skip
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+};
+
+/** Reading the images of an FB2 straight out of the base64 of its <binary> elements. */
+namespace Fb2Image {
+
+/** Read the format and size of a binary's image, decoding only as much as its header needs. */
+bool probe(FsFile& book, const Fb2Index::Range& binary, ImageHeaderProbe& probe);
+
+/** Decode a binary's image into out, a few hundred bytes at a time. */
+bool extract(FsFile& book, const Fb2Index::Range& binary, FsFile& out);
+
+}  // namespace Fb2Image
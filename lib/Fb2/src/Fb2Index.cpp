@@ -0,0 +1,286 @@
+#include "Fb2Index.h"
+
+#include <SdFat.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace {
+constexpr size_t kScanChunkSize = 4096;
+constexpr uint32_t kFnvOffset = 2166136261u;
+constexpr uint32_t kFnvPrime = 16777619u;
+
+bool isSpace(const uint8_t c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+}  // namespace
+
+void Fb2Index::clear() {
+  bodies.clear();
+  binaries.clear();
+  binaryIds.clear();
+  sections.clear();
+  state_ = State::TEXT;
+  offset_ = 0;
+  openSections_ = 0;
+  inMainBody_ = false;
+}
+
+void Fb2Index::feed(const uint8_t* data, const size_t length) {
+  size_t i = 0;
+  while (i < length) {
+    const uint8_t c = data[i];
+    switch (state_) {
+      case State::TEXT: {
+        // Text, and the base64 of binaries, has no '<' in it: skip to the next tag in one go
+        const auto* lt = static_cast<const uint8_t*>(memchr(data + i, '<', length - i));
+        if (!lt) {
+          i = length;
+          continue;
+        }
+        i = static_cast<size_t>(lt - data);
+        tagStart_ = offset_ + static_cast<uint32_t>(i);
+        state_ = State::TAG_OPEN;
+        break;
+      }
+      case State::TAG_OPEN:
+        closing_ = false;
+        selfClosing_ = false;
+        nameLength_ = 0;
+        run_ = 0;
+        id_ = 0;
+        if (c == '/') {
+          closing_ = true;
+          state_ = State::NAME;
+        } else if (c == '!') {
+          state_ = State::DECLARATION;
+        } else if (c == '?') {
+          state_ = State::PI;
+        } else {
+          state_ = State::NAME;
+          continue;  // First byte of the name
+        }
+        break;
+      case State::NAME:
+        if (c == '>') {
+          endTag(offset_ + static_cast<uint32_t>(i));
+        } else if (isSpace(c) || c == '/') {
+          state_ = State::ATTRIBUTES;
+          inAttributeName_ = false;
+          continue;
+        } else if (c == ':') {
+          nameLength_ = 0;  // Namespace prefix
+        } else {
+          if (nameLength_ < sizeof(name_)) name_[nameLength_] = static_cast<char>(c);
+          if (nameLength_ < UINT8_MAX) nameLength_++;
+        }
+        break;
+      case State::ATTRIBUTES:
+        if (c == '>') {
+          endTag(offset_ + static_cast<uint32_t>(i));
+        } else if (c == '"' || c == '\'') {
+          quote_ = static_cast<char>(c);
+          state_ = State::QUOTED;
+          selfClosing_ = false;
+          inId_ = attributeLength_ == 2 && memcmp(attribute_, "id", 2) == 0 && nameIs("binary");
+          if (inId_) id_ = kFnvOffset;
+          attributeLength_ = 0;
+          inAttributeName_ = false;
+        } else if (isSpace(c)) {
+          inAttributeName_ = false;
+        } else if (c == '=' || c == '/') {
+          selfClosing_ = (c == '/');
+          inAttributeName_ = false;
+        } else {
+          selfClosing_ = false;
+          if (!inAttributeName_) attributeLength_ = 0;
+          inAttributeName_ = true;
+          if (attributeLength_ < sizeof(attribute_)) attribute_[attributeLength_] = static_cast<char>(c);
+          if (attributeLength_ < UINT8_MAX) attributeLength_++;
+        }
+        break;
+      case State::QUOTED:
+        if (c == static_cast<uint8_t>(quote_)) {
+          state_ = State::ATTRIBUTES;
+        } else if (inId_) {
+          id_ = (id_ ^ c) * kFnvPrime;
+        }
+        break;
+      case State::DECLARATION:
+        // "<!--" starts a comment and "<![" a CDATA section; anything else (DOCTYPE) ends at '>'
+        if (run_ == 0 && c == '-') {
+          state_ = State::COMMENT;
+        } else if (run_ == 0 && c == '[') {
+          state_ = State::CDATA;
+        } else if (c == '>') {
+          state_ = State::TEXT;
+        } else {
+          run_ = 1;
+        }
+        break;
+      case State::COMMENT:
+        if (c == '-') {
+          if (run_ < 2) run_++;
+        } else {
+          if (c == '>' && run_ == 2) state_ = State::TEXT;
+          run_ = 0;
+        }
+        break;
+      case State::CDATA:
+        if (c == ']') {
+          if (run_ < 2) run_++;
+        } else {
+          if (c == '>' && run_ == 2) state_ = State::TEXT;
+          run_ = 0;
+        }
+        break;
+      case State::PI:
+        if (c == '>' && run_ == 1) state_ = State::TEXT;
+        run_ = (c == '?') ? 1 : 0;
+        break;
+    }
+    i++;
+  }
+  offset_ += static_cast<uint32_t>(length);
+}
+
+bool Fb2Index::nameIs(const char* name) const {
+  const size_t length = strlen(name);
+  return nameLength_ == length && memcmp(name_, name, length) == 0;
+}
+
+void Fb2Index::endTag(const uint32_t gt) {
+  state_ = State::TEXT;
+
+  if (closing_) {
+    if (nameIs("body")) {
+      if (!bodies.empty() && bodies.back().end == 0) bodies.back().end = gt + 1;
+      inMainBody_ = false;
+    } else if (nameIs("section")) {
+      if (inMainBody_ && openSections_ > 0) openSections_--;
+    } else if (nameIs("binary")) {
+      if (!binaries.empty() && binaries.back().end == 0) binaries.back().end = gt + 1;
+    }
+    return;
+  }
+
+  if (nameIs("body")) {
+    bodies.push_back({tagStart_, selfClosing_ ? gt + 1 : 0});
+    inMainBody_ = bodies.size() == 1 && !selfClosing_;
+  } else if (nameIs("section")) {
+    if (!inMainBody_) return;
+    sections.push_back({tagStart_, openSections_});
+    if (!selfClosing_ && openSections_ < UINT8_MAX) openSections_++;
+  } else if (nameIs("binary")) {
+    binaries.push_back({tagStart_, selfClosing_ ? gt + 1 : 0});
+    binaryIds.push_back(id_);
+  }
+}
+
+bool Fb2Index::scan(FsFile& file) {
+  clear();
+  file.seekSet(0);
+  uint8_t buffer[kScanChunkSize];
+  while (file.available() > 0) {
+    const int bytesRead = file.read(buffer, kScanChunkSize);
+    if (bytesRead <= 0) break;
+    feed(buffer, static_cast<size_t>(bytesRead));
+  }
+  file.seekSet(0);
+  return valid();
+}
+
+bool Fb2Index::valid() const {
+  if (bodies.empty() || bodies.front().end == 0) return false;
+  return std::none_of(binaries.begin(), binaries.end(), [](const Range& binary) { return binary.end == 0; });
+}
+
+uint32_t Fb2Index::contentEnd() const { return valid() ? bodies.front().end : UINT32_MAX; }
+
+uint32_t Fb2Index::spanEnd(const uint32_t pos) const {
+  if (!valid()) return UINT32_MAX;
+  const auto next = std::lower_bound(binaries.begin(), binaries.end(), pos,
+                                     [](const Range& binary, const uint32_t at) { return binary.start < at; });
+  return std::min(next == binaries.end() ? UINT32_MAX : next->start, contentEnd());
+}
+
+uint32_t Fb2Index::nextStart(const uint32_t spanEnd) const {
+  if (!valid()) return spanEnd;
+  const auto next = std::lower_bound(binaries.begin(), binaries.end(), spanEnd,
+                                     [](const Range& binary, const uint32_t at) { return binary.start < at; });
+  return (next != binaries.end() && next->start == spanEnd) ? next->end : spanEnd;
+}
+
+int Fb2Index::findBinary(const uint32_t id) const {
+  const auto found = std::find(binaryIds.begin(), binaryIds.end(), id);
+  return (id == 0 || found == binaryIds.end()) ? -1 : static_cast<int>(found - binaryIds.begin());
+}
+
+uint32_t Fb2Index::idHash(const char* id, const size_t length) {
+  uint32_t hash = kFnvOffset;
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(id[i])) * kFnvPrime;
+  }
+  return hash;
+}
+
+bool Fb2Index::write(FsFile& file) const {
+  const auto writeRanges = [&file](const std::vector<Range>& ranges) {
+    const uint16_t count = static_cast<uint16_t>(std::min<size_t>(ranges.size(), UINT16_MAX));
+    serialization::writePod(file, count);
+    for (uint16_t i = 0; i < count; i++) {
+      serialization::writePod(file, ranges[i].start);
+      serialization::writePod(file, ranges[i].end);
+    }
+  };
+  writeRanges(bodies);
+  writeRanges(binaries);
+  const size_t binaryCount = std::min<size_t>(binaries.size(), UINT16_MAX);
+  for (size_t i = 0; i < binaryCount; i++) {
+    serialization::writePod(file, i < binaryIds.size() ? binaryIds[i] : static_cast<uint32_t>(0));
+  }
+
+  // More sections than fit only lose resume points, not content
+  const uint16_t sectionCount = static_cast<uint16_t>(std::min<size_t>(sections.size(), UINT16_MAX));
+  serialization::writePod(file, sectionCount);
+  for (uint16_t i = 0; i < sectionCount; i++) {
+    serialization::writePod(file, sections[i].offset);
+    serialization::writePod(file, sections[i].level);
+  }
+  return true;
+}
+
+bool Fb2Index::read(FsFile& file) {
+  clear();
+  const auto readRanges = [&file](std::vector<Range>& ranges) {
+    uint16_t count;
+    if (!serialization::readPodChecked(file, count)) return false;
+    ranges.resize(count);
+    for (auto& range : ranges) {
+      if (!serialization::readPodChecked(file, range.start) || !serialization::readPodChecked(file, range.end)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  bool ok = readRanges(bodies) && readRanges(binaries);
+  binaryIds.resize(binaries.size());
+  for (size_t i = 0; ok && i < binaryIds.size(); i++) {
+    ok = serialization::readPodChecked(file, binaryIds[i]);
+  }
+
+  uint16_t sectionCount;
+  ok = ok && serialization::readPodChecked(file, sectionCount);
+  if (ok) {
+    sections.resize(sectionCount);
+    for (auto& section : sections) {
+      if (!serialization::readPodChecked(file, section.offset) || !serialization::readPodChecked(file, section.level)) {
+        ok = false;
+        break;
+      }
+    }
+  }
+  if (!ok) clear();
+  return ok;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class FsFile;
+
+/**
+ * Byte offsets of the structure of an FB2 file: every <body> and <binary> element (with the id
+ * images refer to it by), and every <section> of the main (first) body.
+ *
+ * Built once, when the book is first opened, by a byte-level scan that only looks at tag names,
+ * which is much cheaper than XML parsing. Kept in the book's meta.bin, so that Fb2Parser can
+ * start at a section and stop at the end of the main body, never feeding the base64 of <binary>
+ * elements (often most of the file) to Expat.
+ */
+class Fb2Index {
+ public:
+  struct Range {
+    uint32_t start;  // '<' of the start tag
+    uint32_t end;    // Just past the '>' of the end tag; 0 while the element is open
+  };
+
+  struct Section {
+    uint32_t offset;  // '<' of the start tag
+    uint8_t level;    // 0 for a section directly inside the body
+  };
+
+  std::vector<Range> bodies;
+  std::vector<Range> binaries;
+  std::vector<uint32_t> binaryIds;  // idHash() of each binary's id attribute (0 without one)
+  std::vector<Section> sections;  // Main body only, in document order, so the index is the section number
+
+  /** Scan the next chunk of the file; chunks may split tags anywhere. */
+  void feed(const uint8_t* data, size_t length);
+
+  /** Scan a whole file from the start. */
+  bool scan(FsFile& file);
+
+  void clear();
+
+  /** True once a main body has been seen and everything found was closed. */
+  bool valid() const;
+
+  /** Where the text the parser needs ends: the end of the main body, or UINT32_MAX without an index. */
+  uint32_t contentEnd() const;
+
+  /**
+   * Where the next stretch the parser needs, starting at pos, ends: the next <binary> or the end
+   * of the content. nextStart() gives where to go on from there.
+   */
+  uint32_t spanEnd(uint32_t pos) const;
+  uint32_t nextStart(uint32_t spanEnd) const;
+
+  /** The binary an <image l:href="#id"> refers to, given idHash() of the id, or -1. */
+  int findBinary(uint32_t id) const;
+
+  /** FNV-1a of an element id, as the scan records it for binaries. */
+  static uint32_t idHash(const char* id, size_t length);
+
+  bool write(FsFile& file) const;
+  bool read(FsFile& file);
+
+ private:
+  enum class State : uint8_t { TEXT, TAG_OPEN, NAME, ATTRIBUTES, QUOTED, COMMENT, CDATA, DECLARATION, PI };
+
+  void endTag(uint32_t gt);
+  bool nameIs(const char* name) const;
+
+  // Scanner state between feed() calls
+  State state_ = State::TEXT;
+  uint32_t offset_ = 0;    // File offset of the next byte fed
+  uint32_t tagStart_ = 0;  // '<' of the tag being read
+  bool closing_ = false;   // </name>
+  bool selfClosing_ = false;
+  char quote_ = 0;
+  uint8_t run_ = 0;  // Matched bytes of "-->", "]]>" or "?>"
+  char name_[8] = {};
+  uint8_t nameLength_ = 0;  // > sizeof(name_) for names too long to be one of ours
+  uint8_t openSections_ = 0;
+  bool inMainBody_ = false;
+  char attribute_[2] = {};  // Start of the attribute name being read, to spot id="..."
+  uint8_t attributeLength_ = 0;
+  bool inAttributeName_ = false;
+  bool inId_ = false;  // Reading the value of a binary's id
+  uint32_t id_ = 0;
+};
@@ -5,16 +5,28 @@
 #include <Page.h>
 #include <ParsedText.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 #include <Utf8.h>
 
+#include "Fb2Image.h"
+
 #define TAG "FB2_PARSE"
 
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
 namespace {
 constexpr size_t READ_CHUNK_SIZE = 4096;
 
+// Checkpoint file: magic (4), version (1), pages before it (2), section number (2), section offset (4),
+// then the start page of every earlier section. The magic is written last, so a file cut short is never used.
+constexpr uint32_t CHECKPOINT_MAGIC = 0x4B434246;  // "FBCK"
+constexpr uint8_t CHECKPOINT_VERSION = 1;
+
+// A resumed parse starts at a <section> of the main body, so Expat is first given the elements around it
+constexpr char RESUME_PREFIX[] = "<FictionBook><body>";
+
 bool isWhitespace(char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
 
 const char* stripNamespace(const char* name) {
@@ -23,8 +35,13 @@ const char* stripNamespace(const char* name) {
 }
 }  // namespace
 
-Fb2Parser::Fb2Parser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config)
-    : filepath_(std::move(filepath)), renderer_(renderer), config_(config) {}
+Fb2Parser::Fb2Parser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config, Fb2Index index,
+                     std::string imageCachePath)
+    : filepath_(std::move(filepath)),
+      renderer_(renderer),
+      config_(config),
+      index_(std::move(index)),
+      imageCachePath_(std::move(imageCachePath)) {}
 
 Fb2Parser::~Fb2Parser() {
   if (xmlParser_) {
@@ -51,6 +68,7 @@ void Fb2Parser::reset() {
   inParagraph_ = false;
   bodyCount_ = 0;
   sectionCounter_ = 0;
+  openSections_ = 0;
   firstSection_ = true;
   partWordBufferIndex_ = 0;
   currentTextBlock_.reset();
@@ -60,6 +78,82 @@ void Fb2Parser::reset() {
   hitMaxPages_ = false;
   fileSize_ = 0;
   anchorMap_.clear();
+  pageBase_ = 0;
+  resumePages_ = 0;
+}
+
+void Fb2Parser::saveCheckpoint() {
+  const auto section = static_cast<size_t>(sectionCounter_ - 1);
+  if (checkpointPath_.empty() || section >= index_.sections.size() || index_.sections[section].level != 0) {
+    return;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("FB2", checkpointPath_, file)) {
+    return;
+  }
+  const uint16_t pages = pageBase_ + pagesCreated_;
+  serialization::writePod(file, static_cast<uint32_t>(0));
+  serialization::writePod(file, CHECKPOINT_VERSION);
+  serialization::writePod(file, pages);
+  serialization::writePod(file, static_cast<uint16_t>(section));
+  serialization::writePod(file, index_.sections[section].offset);
+  serialization::writePod(file, static_cast<uint16_t>(anchorMap_.size()));
+  for (const auto& anchor : anchorMap_) {
+    serialization::writePod(file, anchor.second);
+  }
+  file.seek(0);
+  serialization::writePod(file, CHECKPOINT_MAGIC);
+  file.close();
+  LOG_DBG(TAG, "Checkpoint after %u pages at section %u", pages, static_cast<unsigned>(section));
+}
+
+void Fb2Parser::dropCheckpoint() {
+  if (!checkpointPath_.empty() && SdMan.exists(checkpointPath_.c_str())) {
+    SdMan.remove(checkpointPath_.c_str());
+  }
+}
+
+uint16_t Fb2Parser::resumeFromCheckpoint(const uint16_t pagesDone) {
+  resumePages_ = 0;
+  if (checkpointPath_.empty() || !index_.valid()) {
+    return 0;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("FB2", checkpointPath_, file)) {
+    return 0;
+  }
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  uint16_t pages = 0;
+  uint16_t section = 0;
+  uint32_t offset = 0;
+  uint16_t anchorCount = 0;
+  bool ok = serialization::readPodChecked(file, magic) && serialization::readPodChecked(file, version) &&
+            serialization::readPodChecked(file, pages) && serialization::readPodChecked(file, section) &&
+            serialization::readPodChecked(file, offset) && serialization::readPodChecked(file, anchorCount);
+
+  // A checkpoint past the cached pages was written by a batch that never reached the cache
+  ok = ok && magic == CHECKPOINT_MAGIC && version == CHECKPOINT_VERSION && pages > 0 && pages <= pagesDone &&
+       section < index_.sections.size() && index_.sections[section].offset == offset &&
+       index_.sections[section].level == 0 && anchorCount == section;
+  std::vector<std::pair<std::string, uint16_t>> anchors;
+  for (uint16_t i = 0; ok && i < anchorCount; i++) {
+    uint16_t page;
+    ok = serialization::readPodChecked(file, page);
+    anchors.emplace_back("section_" + std::to_string(i), page);
+  }
+  file.close();
+  if (!ok) {
+    return 0;
+  }
+
+  LOG_INF(TAG, "Resuming after %u pages at section %u", pages, section);
+  anchorMap_ = std::move(anchors);
+  resumePages_ = pages;
+  resumeSection_ = section;
+  return pages;
 }
 
 bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages,
@@ -78,6 +172,14 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
   stopRequested_ = false;
   shouldAbort_ = shouldAbort;
 
+  // Either continue at the section of a checkpoint, or start over (and forget old checkpoints)
+  const uint16_t resumedPages = resumePages_;
+  resumePages_ = 0;
+  pageBase_ = resumedPages;
+  if (resumedPages == 0) {
+    dropCheckpoint();
+  }
+
   // Single buffer reused for RTL peek and parsing (saves 4KB stack)
   uint8_t buffer[READ_CHUNK_SIZE + 1];
 
@@ -87,7 +189,6 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
     buffer[peekBytes] = '\0';
     isRtl_ = ScriptDetector::containsArabic(reinterpret_cast<const char*>(buffer));
   }
-  file.seekSet(0);
 
   // Create Expat parser
   xmlParser_ = XML_ParserCreate("UTF-8");
@@ -101,10 +202,29 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
   XML_SetElementHandler(xmlParser_, startElement, endElement);
   XML_SetCharacterDataHandler(xmlParser_, characterData);
 
+  uint32_t pos = 0;
+  if (resumedPages > 0) {
+    pos = index_.sections[resumeSection_].offset;
+    sectionCounter_ = resumeSection_;
+    firstSection_ = false;
+    XML_Parse(xmlParser_, RESUME_PREFIX, sizeof(RESUME_PREFIX) - 1, 0);
+  }
+
   startNewPage();
   uint16_t abortCheckCounter = 0;
 
-  while (file.available() > 0) {
+  // Feed the file up to the end of the main body, jumping over the base64 of <binary> elements
+  const uint32_t end = std::min<uint32_t>(index_.contentEnd(), static_cast<uint32_t>(fileSize_));
+  uint32_t spanEnd = std::min(index_.spanEnd(pos), end);
+  file.seekSet(pos);
+  while (pos < end) {
+    if (pos == spanEnd) {
+      pos = index_.nextStart(pos);
+      spanEnd = std::min(index_.spanEnd(pos), end);
+      file.seekSet(pos);
+      continue;
+    }
+
     if (shouldAbort_ && (++abortCheckCounter % 10 == 0) && shouldAbort_()) {
       LOG_INF(TAG, "Aborted by external request");
       XML_ParserFree(xmlParser_);
@@ -114,12 +234,15 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
       return false;
     }
 
-    size_t bytesRead = file.read(buffer, READ_CHUNK_SIZE);
+    size_t bytesRead = file.read(buffer, std::min<size_t>(READ_CHUNK_SIZE, spanEnd - pos));
     if (bytesRead == 0) break;
+    pos += static_cast<uint32_t>(bytesRead);
 
-    int done = (file.available() == 0) ? 1 : 0;
+    int done = (pos >= fileSize_) ? 1 : 0;
+    // Reaching the page limit aborts the parse, which Expat reports as an error
     if (XML_Parse(xmlParser_, reinterpret_cast<const char*>(buffer), static_cast<int>(bytesRead), done) ==
-        XML_STATUS_ERROR) {
+            XML_STATUS_ERROR &&
+        !stopRequested_) {
       LOG_ERR(TAG, "Parse error at line %lu: %s", XML_GetCurrentLineNumber(xmlParser_),
               XML_ErrorString(XML_GetErrorCode(xmlParser_)));
       XML_ParserFree(xmlParser_);
@@ -155,6 +278,7 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
   currentTextBlock_.reset();
   currentPage_.reset();
   hasMore_ = false;
+  dropCheckpoint();
 
   LOG_INF(TAG, "Parsed %d pages from %s", pagesCreated_, filepath_.c_str());
   return true;
@@ -162,6 +286,7 @@ bool Fb2Parser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onP
 
 void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
   auto* self = static_cast<Fb2Parser*>(userData);
+  if (self->stopRequested_) return;
   const char* localName = stripNamespace(name);
 
   // Prevent stack overflow from deeply nested XML
@@ -194,6 +319,8 @@ void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const
   }
 
   if (strcmp(localName, "section") == 0) {
+    const bool topLevel = self->openSections_ == 0;
+    self->openSections_++;
     self->sectionCounter_++;
     if (!self->firstSection_) {
       // Flush current content before new section
@@ -205,10 +332,11 @@ void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const
       if (self->currentPage_ && !self->currentPage_->elements.empty()) {
         self->onPageComplete_(std::move(self->currentPage_));
         self->pagesCreated_++;
+        if (topLevel) {
+          self->saveCheckpoint();
+        }
         if (self->maxPages_ > 0 && self->pagesCreated_ >= self->maxPages_) {
-          self->hitMaxPages_ = true;
-          self->stopRequested_ = true;
-          self->depth_++;
+          self->stopAtPageLimit();
           return;
         }
       }
@@ -216,7 +344,8 @@ void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const
     }
     self->firstSection_ = false;
     // Record anchor for TOC navigation: section_N → page where this section starts
-    self->anchorMap_.emplace_back("section_" + std::to_string(self->sectionCounter_ - 1), self->pagesCreated_);
+    self->anchorMap_.emplace_back("section_" + std::to_string(self->sectionCounter_ - 1),
+                                  self->pageBase_ + self->pagesCreated_);
   } else if (strcmp(localName, "title") == 0) {
     self->inTitle_ = true;
     self->boldUntilDepth_ = std::min(self->boldUntilDepth_, self->depth_);
@@ -252,7 +381,7 @@ void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const
     }
     self->addVerticalSpacing(1);
   } else if (strcmp(localName, "image") == 0) {
-    // Skip images in v1
+    self->addImage(atts);
   }
 
   self->depth_++;
@@ -260,6 +389,7 @@ void XMLCALL Fb2Parser::startElement(void* userData, const XML_Char* name, const
 
 void XMLCALL Fb2Parser::endElement(void* userData, const XML_Char* name) {
   auto* self = static_cast<Fb2Parser*>(userData);
+  if (self->stopRequested_) return;
   const char* localName = stripNamespace(name);
 
   self->depth_--;
@@ -289,7 +419,9 @@ void XMLCALL Fb2Parser::endElement(void* userData, const XML_Char* name) {
     return;
   }
 
-  if (strcmp(localName, "title") == 0) {
+  if (strcmp(localName, "section") == 0) {
+    if (self->openSections_ > 0) self->openSections_--;
+  } else if (strcmp(localName, "title") == 0) {
     self->inTitle_ = false;
     self->flushPartWordBuffer();
     if (self->currentTextBlock_ && !self->currentTextBlock_->isEmpty()) {
@@ -315,6 +447,7 @@ void XMLCALL Fb2Parser::endElement(void* userData, const XML_Char* name) {
 void XMLCALL Fb2Parser::characterData(void* userData, const XML_Char* s, int len) {
   auto* self = static_cast<Fb2Parser*>(userData);
 
+  if (self->stopRequested_) return;
   if (self->skipUntilDepth_ < self->depth_) return;
   if (!self->inBody_) return;
 
@@ -401,20 +534,122 @@ void Fb2Parser::addLineToPage(std::shared_ptr<TextBlock> line) {
   }
 
   if (currentPageNextY_ + lineHeight > config_.viewportHeight) {
-    onPageComplete_(std::move(currentPage_));
-    pagesCreated_++;
-    startNewPage();
-
-    if (maxPages_ > 0 && pagesCreated_ >= maxPages_) {
-      hitMaxPages_ = true;
-      stopRequested_ = true;
-    }
+    completePage();
   }
 
   currentPage_->elements.push_back(std::make_shared<PageLine>(line, 0, currentPageNextY_));
   currentPageNextY_ += lineHeight;
 }
 
+void Fb2Parser::addImage(const XML_Char** atts) {
+  if (imageCachePath_.empty() || !index_.valid() || hitMaxPages_ || !atts) {
+    return;
+  }
+
+  // <image l:href="#id"/> refers to the <binary id="id"> holding the image
+  const char* href = nullptr;
+  for (int i = 0; atts[i]; i += 2) {
+    if (strcmp(stripNamespace(atts[i]), "href") == 0) {
+      href = atts[i + 1];
+      break;
+    }
+  }
+  if (!href || href[0] != '#') {
+    return;
+  }
+  const int binary = index_.findBinary(Fb2Index::idHash(href + 1, strlen(href + 1)));
+  if (binary < 0) {
+    LOG_DBG(TAG, "No binary for image %s", href);
+    return;
+  }
+
+  // Only the image header is decoded now; the image itself is converted when its page is rendered
+  FsFile file;
+  if (!SdMan.openFileForRead("FB2", filepath_, file)) {
+    return;
+  }
+  ImageHeaderProbe probe;
+  const bool found = Fb2Image::probe(file, index_.binaries[binary], probe);
+  file.close();
+  if (!found) {
+    LOG_DBG(TAG, "Unsupported image %s", href);
+    return;
+  }
+
+  // The size the BMP will have: scaled down, keeping the aspect ratio, to fit the viewport
+  float width = static_cast<float>(probe.width());
+  float height = static_cast<float>(probe.height());
+  if (width > config_.viewportWidth || height > config_.viewportHeight) {
+    const float scale = std::min(config_.viewportWidth / width, config_.viewportHeight / height);
+    width = std::max(1.0f, static_cast<float>(static_cast<int>(width * scale)));
+    height = std::max(1.0f, static_cast<float>(static_cast<int>(height * scale)));
+  }
+  // Skip tiny decorative images (e.g. 1px-tall line separators) - invisible on e-paper
+  if (width < 20 || height < 20) {
+    return;
+  }
+
+  flushPartWordBuffer();
+  if (currentTextBlock_ && !currentTextBlock_->isEmpty()) {
+    makePages();
+  }
+  addImageToPage(std::make_shared<ImageBlock>(imageCachePath_ + "/" + std::to_string(binary) + ".bmp",
+                                              static_cast<uint16_t>(width), static_cast<uint16_t>(height)));
+}
+
+void Fb2Parser::addImageToPage(std::shared_ptr<ImageBlock> image) {
+  if (hitMaxPages_) return;
+
+  const int imageHeight = image->getHeight();
+  const int lineHeight = static_cast<int>(renderer_.getLineHeight(config_.fontId) * config_.lineCompression);
+  const bool isTallImage = imageHeight > config_.viewportHeight / 2;
+
+  if (!currentPage_) {
+    startNewPage();
+  }
+
+  // Tall images get a dedicated page, as do images that don't fit on the current one
+  if ((isTallImage && currentPageNextY_ > 0) || currentPageNextY_ + imageHeight > config_.viewportHeight) {
+    completePage();
+    if (hitMaxPages_) return;
+  }
+
+  // Center horizontally, and tall images vertically on their dedicated page
+  int xPos = (static_cast<int>(config_.viewportWidth) - static_cast<int>(image->getWidth())) / 2;
+  if (xPos < 0) xPos = 0;
+  int yPos = currentPageNextY_;
+  if (isTallImage && currentPageNextY_ == 0 && imageHeight < config_.viewportHeight) {
+    yPos = (config_.viewportHeight - imageHeight) / 2;
+  }
+
+  currentPage_->elements.push_back(std::make_shared<PageImage>(image, xPos, yPos));
+  currentPageNextY_ = yPos + imageHeight + lineHeight;
+
+  // Text continues on the page after a tall image
+  if (isTallImage) {
+    completePage();
+  }
+}
+
+void Fb2Parser::completePage() {
+  onPageComplete_(std::move(currentPage_));
+  pagesCreated_++;
+  startNewPage();
+
+  if (maxPages_ > 0 && pagesCreated_ >= maxPages_) {
+    stopAtPageLimit();
+  }
+}
+
+// Nothing may be laid out, emitted or checkpointed after the last page: the rest of the chunk Expat
+// was given would otherwise still reach the handlers, and a section starting there would checkpoint
+// pages that were never delivered
+void Fb2Parser::stopAtPageLimit() {
+  hitMaxPages_ = true;
+  stopRequested_ = true;
+  XML_StopParser(xmlParser_, XML_FALSE);
+}
+
 void Fb2Parser::startNewPage() {
   currentPage_.reset(new Page());
   currentPageNextY_ = 0;
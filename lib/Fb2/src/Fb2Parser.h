@@ -12,13 +12,18 @@
 #include <memory>
 #include <string>
 
+#include "Fb2Index.h"
+
 class Page;
 class GfxRenderer;
+class ImageBlock;
 class ParsedText;
 
 class Fb2Parser : public ContentParser {
  public:
-  Fb2Parser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config);
+  // Inline images are laid out only with an index and an image cache path (see Fb2::getImageCachePath)
+  Fb2Parser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config, Fb2Index index = {},
+            std::string imageCachePath = "");
   ~Fb2Parser() override;
 
   bool parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages = 0,
@@ -26,12 +31,16 @@ class Fb2Parser : public ContentParser {
   bool hasMoreContent() const override { return hasMore_; }
   bool canResume() const override { return false; }
   void reset() override;
+  void setCheckpointPath(const std::string& path) override { checkpointPath_ = path; }
+  uint16_t resumeFromCheckpoint(uint16_t pagesDone) override;
   const std::vector<std::pair<std::string, uint16_t>>& getAnchorMap() const override { return anchorMap_; }
 
  private:
   std::string filepath_;
   GfxRenderer& renderer_;
   RenderConfig config_;
+  Fb2Index index_;  // Empty to parse the whole file
+  std::string imageCachePath_;
   bool hasMore_ = true;
   bool isRtl_ = false;
 
@@ -50,6 +59,7 @@ class Fb2Parser : public ContentParser {
   bool inParagraph_ = false;
   int bodyCount_ = 0;
   int sectionCounter_ = 0;
+  int openSections_ = 0;
   bool firstSection_ = true;
 
   // Word buffer
@@ -65,6 +75,12 @@ class Fb2Parser : public ContentParser {
   // Anchor map for TOC navigation (section_N → page index)
   std::vector<std::pair<std::string, uint16_t>> anchorMap_;
 
+  // Resume checkpoints (see ContentParser::setCheckpointPath), taken at each top-level section
+  std::string checkpointPath_;
+  uint16_t pageBase_ = 0;       // Pages before the point this parse started from
+  uint16_t resumePages_ = 0;    // Set by resumeFromCheckpoint(): pages before the checkpoint
+  uint16_t resumeSection_ = 0;  // ...and the section to continue from
+
   // Callback state
   std::function<void(std::unique_ptr<Page>)> onPageComplete_;
   uint16_t maxPages_ = 0;
@@ -80,10 +96,16 @@ class Fb2Parser : public ContentParser {
   static void XMLCALL endElement(void* userData, const XML_Char* name);
   static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
 
+  void saveCheckpoint();
+  void dropCheckpoint();
   void flushPartWordBuffer();
   void startNewTextBlock(TextBlock::BLOCK_STYLE style);
   void makePages();
   void addLineToPage(std::shared_ptr<TextBlock> line);
+  void addImage(const XML_Char** atts);
+  void addImageToPage(std::shared_ptr<ImageBlock> image);
+  void completePage();
+  void stopAtPageLimit();
   void startNewPage();
   EpdFontFamily::Style getCurrentFontFamily() const;
   void addVerticalSpacing(int lines);
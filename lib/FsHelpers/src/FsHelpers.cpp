@@ -1,6 +1,7 @@
 #include "FsHelpers.h"
 
 #include <cstring>
+#include <functional>
 #include <vector>
 
 namespace {
@@ -51,3 +52,40 @@ std::string FsHelpers::normalisePath(const std::string& path) {
 
   return result;
 }
+
+uint32_t FsHelpers::pathHash(const std::string& s) {
+#if SIZE_MAX == UINT32_MAX
+  return std::hash<std::string>{}(s);
+#else
+  // libstdc++'s 32-bit std::hash<std::string>: MurmurHash2 over the bytes, seed 0xc70f6907
+  constexpr uint32_t m = 0x5bd1e995;
+  const auto* p = reinterpret_cast<const uint8_t*>(s.data());
+  size_t len = s.size();
+  uint32_t hash = 0xc70f6907u ^ static_cast<uint32_t>(len);
+  for (; len >= 4; p += 4, len -= 4) {
+    uint32_t k = p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    k *= m;
+    k ^= k >> 24;
+    k *= m;
+    hash = (hash * m) ^ k;
+  }
+  switch (len) {
+    case 3:
+      hash ^= p[2] << 16;
+      // fall through
+    case 2:
+      hash ^= p[1] << 8;
+      // fall through
+    case 1:
+      hash ^= p[0];
+      hash *= m;
+      break;
+    default:
+      break;
+  }
+  hash ^= hash >> 13;
+  hash *= m;
+  hash ^= hash >> 15;
+  return hash;
+#endif
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <cstring>
 #include <string>
 
@@ -6,6 +7,10 @@ class FsHelpers {
  public:
   static std::string normalisePath(const std::string& path);
 
+  // Hash for cache file and directory names: std::hash<std::string> as the device computes it
+  // (32-bit), also on 64-bit hosts, so caches built on a PC are found on the device
+  static uint32_t pathHash(const std::string& s);
+
   // Check if a filename should be hidden from file browsers
   // Note: Does NOT check for "." prefix - caller should check that separately
   static bool isHiddenFsItem(const char* name);
@@ -6,7 +6,7 @@
 // ============================================================================
 // IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
 // ============================================================================
-// Note: For cover images, dithering is done in JpegToBmpConverter.cpp
+// Note: For cover images, dithering is done in ScaledBmpWriter.cpp
 // This file handles BMP reading - use simple quantization to avoid double-dithering
 constexpr bool USE_ATKINSON = true;  // Use Atkinson dithering instead of Floyd-Steinberg
 // ============================================================================
@@ -163,6 +163,34 @@ BmpReaderError Bitmap::readRow(uint8_t* data, uint8_t* rowBuffer, int rowY) cons
 
   prevRowY += 1;
 
+  // Atkinson fast path for 8-bit and true-color rows: convert to gray in place (each gray byte
+  // lands at or before the source pixel it came from), then dither and pack the row in one pass
+  if (atkinsonDitherer && bpp >= 8) {
+    switch (bpp) {
+      case 32:
+        for (int x = 0; x < width; x++) {
+          const uint8_t* p = rowBuffer + x * 4;
+          rowBuffer[x] = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+        }
+        break;
+      case 24:
+        for (int x = 0; x < width; x++) {
+          const uint8_t* p = rowBuffer + x * 3;
+          rowBuffer[x] = (77u * p[2] + 150u * p[1] + 29u * p[0]) >> 8;
+        }
+        break;
+      case 8:
+        for (int x = 0; x < width; x++) {
+          rowBuffer[x] = paletteLum[rowBuffer[x]];
+        }
+        break;
+      default:
+        return BmpReaderError::UnsupportedBpp;
+    }
+    atkinsonDitherer->processRow(rowBuffer, data, adjustPixelLut());
+    return BmpReaderError::Ok;
+  }
+
   uint8_t* outPtr = data;
   uint8_t currentOutByte = 0;
   int bitShift = 6;
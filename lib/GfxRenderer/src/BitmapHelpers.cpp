@@ -73,7 +73,7 @@ constexpr bool USE_NOISE_DITHERING = false;   // Hash-based noise dithering
 // Integer approximation of gamma correction (brightens midtones)
 // Uses a simple curve: out = 255 * sqrt(in/255) ≈ sqrt(in * 255)
 // Kept for tuning - enable via USE_GAMMA_CORRECTION
-[[maybe_unused]] static inline int applyGamma(int gray) {
+[[maybe_unused]] static constexpr int applyGamma(int gray) {
   const int product = gray * 255;
   int x = gray;
   if (x > 0) {
@@ -85,7 +85,7 @@ constexpr bool USE_NOISE_DITHERING = false;   // Hash-based noise dithering
 
 // Apply contrast adjustment around midpoint (128)
 // factor > 1.0 increases contrast, < 1.0 decreases
-static inline int applyContrast(int gray) {
+static constexpr int applyContrast(int gray) {
   // Integer-based contrast: (gray - 128) * factor + 128
   // Using fixed-point: factor 1.15 ≈ 115/100
   constexpr int factorNum = static_cast<int>(CONTRAST_FACTOR * 100);
@@ -95,8 +95,7 @@ static inline int applyContrast(int gray) {
   return adjusted;
 }
 // Combined brightness/contrast/gamma adjustment
-// Always applied to optimize images for e-ink display
-int adjustPixel(int gray) {
+static constexpr int computeAdjustedPixel(int gray) {
   // Order: contrast first, then brightness, then gamma
   gray = applyContrast(gray);
   gray += BRIGHTNESS_BOOST;
@@ -109,7 +108,7 @@ int adjustPixel(int gray) {
 }
 // Simple quantization without dithering - divide into 4 levels
 // The thresholds are fine-tuned to the X4 display
-uint8_t quantizeSimple(int gray) {
+static constexpr uint8_t computeQuantizeSimple(int gray) {
   if (gray < 45) {
     return 0;
   } else if (gray < 70) {
@@ -121,6 +120,40 @@ uint8_t quantizeSimple(int gray) {
   }
 }
 
+namespace {
+struct PixelLut {
+  uint8_t value[256];
+};
+
+constexpr PixelLut buildAdjustLut() {
+  PixelLut lut{};
+  for (int i = 0; i < 256; i++) lut.value[i] = static_cast<uint8_t>(computeAdjustedPixel(i));
+  return lut;
+}
+
+constexpr PixelLut buildQuantizeSimpleAdjustedLut() {
+  PixelLut lut{};
+  for (int i = 0; i < 256; i++) lut.value[i] = computeQuantizeSimple(computeAdjustedPixel(i));
+  return lut;
+}
+
+// Built at compile time so the tables live in flash
+constexpr PixelLut ADJUST_LUT = buildAdjustLut();
+constexpr PixelLut QUANTIZE_SIMPLE_ADJUSTED_LUT = buildQuantizeSimpleAdjustedLut();
+}  // namespace
+
+const uint8_t* adjustPixelLut() { return ADJUST_LUT.value; }
+
+const uint8_t* quantizeSimpleAdjustedLut() { return QUANTIZE_SIMPLE_ADJUSTED_LUT.value; }
+
+// Always applied to optimize images for e-ink display
+int adjustPixel(int gray) {
+  if (gray >= 0 && gray <= 255) return ADJUST_LUT.value[gray];
+  return computeAdjustedPixel(gray);
+}
+
+uint8_t quantizeSimple(int gray) { return computeQuantizeSimple(gray); }
+
 // Hash-based noise dithering - survives downsampling without moiré artifacts
 // Uses integer hash to generate pseudo-random threshold per pixel
 static inline uint8_t quantizeNoise(int gray, int x, int y) {
@@ -237,67 +270,6 @@ static inline uint8_t palette2bitToGray(uint8_t index) {
 
 static inline uint8_t palette1bitToGray(uint8_t index) { return (index & 0x01) ? 255 : 0; }
 
-// Simple 1-bit Atkinson ditherer without contrast adjustment
-// Used when source is already contrast-enhanced (like cover.bmp)
-class RawAtkinson1BitDitherer {
- public:
-  explicit RawAtkinson1BitDitherer(int width) : width(width) {
-    errorRow0 = new int16_t[width + 4]();
-    errorRow1 = new int16_t[width + 4]();
-    errorRow2 = new int16_t[width + 4]();
-  }
-
-  ~RawAtkinson1BitDitherer() {
-    delete[] errorRow0;
-    delete[] errorRow1;
-    delete[] errorRow2;
-  }
-
-  RawAtkinson1BitDitherer(const RawAtkinson1BitDitherer&) = delete;
-  RawAtkinson1BitDitherer& operator=(const RawAtkinson1BitDitherer&) = delete;
-
-  uint8_t processPixel(int gray, int x) {
-    // NO adjustPixel() call - source is already contrast-enhanced
-    int adjusted = gray + errorRow0[x + 2];
-    if (adjusted < 0) adjusted = 0;
-    if (adjusted > 255) adjusted = 255;
-
-    uint8_t quantized;
-    int quantizedValue;
-    if (adjusted < 128) {
-      quantized = 0;
-      quantizedValue = 0;
-    } else {
-      quantized = 1;
-      quantizedValue = 255;
-    }
-
-    int error = (adjusted - quantizedValue) >> 3;
-    errorRow0[x + 3] += error;
-    errorRow0[x + 4] += error;
-    errorRow1[x + 1] += error;
-    errorRow1[x + 2] += error;
-    errorRow1[x + 3] += error;
-    errorRow2[x + 2] += error;
-
-    return quantized;
-  }
-
-  void nextRow() {
-    int16_t* temp = errorRow0;
-    errorRow0 = errorRow1;
-    errorRow1 = errorRow2;
-    errorRow2 = temp;
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
-  }
-
- private:
-  int width;
-  int16_t* errorRow0;
-  int16_t* errorRow1;
-  int16_t* errorRow2;
-};
-
 bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxWidth, int targetMaxHeight) {
   FsFile srcFile;
   if (!SdMan.openFileForRead("BMP", srcPath, srcFile)) {
@@ -378,10 +350,12 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
   // Allocate buffers for source rows needed per output row
   auto* srcRows = static_cast<uint8_t*>(malloc(srcRowBytes * maxSrcRowsPerOut));
   auto* outRow = static_cast<uint8_t*>(malloc(outRowBytes));
-  if (!srcRows || !outRow) {
+  auto* grayRow = static_cast<uint8_t*>(malloc(outWidth));
+  if (!srcRows || !outRow || !grayRow) {
     LOG_ERR(TAG, "Failed to allocate buffers");
     free(srcRows);
     free(outRow);
+    free(grayRow);
     srcFile.close();
     return false;
   }
@@ -392,20 +366,22 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
     LOG_ERR(TAG, "Failed to open destination: %s", dstPath);
     free(srcRows);
     free(outRow);
+    free(grayRow);
     srcFile.close();
     return false;
   }
 
   writeBmpHeader1bit(dstFile, outWidth, outHeight);
 
-  // Create 1-bit ditherer (raw version - no contrast adjustment since source is already processed)
-  RawAtkinson1BitDitherer ditherer(outWidth);
+  // 1-bit ditherer fed without contrast adjustment since the source is already processed
+  Atkinson1BitDitherer ditherer(outWidth);
 
   // Seek to pixel data
   if (!srcFile.seek(pixelOffset)) {
     LOG_ERR(TAG, "Failed to seek to pixel data");
     free(srcRows);
     free(outRow);
+    free(grayRow);
     srcFile.close();
     dstFile.close();
     return false;
@@ -440,6 +416,7 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
         LOG_ERR(TAG, "Failed to read row %d", srcY);
         free(srcRows);
         free(outRow);
+        free(grayRow);
         srcFile.close();
         dstFile.close();
         return false;
@@ -449,7 +426,7 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
 
     memset(outRow, 0, outRowBytes);
 
-    // Process each output pixel
+    // Average the source block of each output pixel, then dither the row in one pass
     for (int outX = 0; outX < outWidth; outX++) {
       // Calculate source X range for this output pixel using fixed-point
       const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
@@ -483,21 +460,16 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
         }
       }
 
-      const uint8_t gray = (count > 0) ? (sum / count) : 0;
-      const uint8_t bit = ditherer.processPixel(gray, outX);
-
-      // Pack 1-bit value (MSB first, 8 pixels per byte)
-      const int byteIdx = outX / 8;
-      const int bitOffset = 7 - (outX % 8);
-      outRow[byteIdx] |= (bit << bitOffset);
+      grayRow[outX] = (count > 0) ? (sum / count) : 0;
     }
 
-    ditherer.nextRow();
+    ditherer.processRow(grayRow, outRow, nullptr);
     dstFile.write(outRow, outRowBytes);
   }
 
   free(srcRows);
   free(outRow);
+  free(grayRow);
   srcFile.close();
   dstFile.close();
 
@@ -9,6 +9,13 @@ uint8_t quantizeSimple(int gray);
 uint8_t quantize1bit(int gray, int x, int y);
 int adjustPixel(int gray);
 
+// adjustPixel() precomputed for every gray level (adjustPixelLut()[g] == adjustPixel(g)).
+// Passed to the row dithering kernels so brightness/contrast/gamma costs one lookup per pixel.
+const uint8_t* adjustPixelLut();
+
+// quantizeSimple(adjustPixel(g)) fused into a single table for quick-mode conversion
+const uint8_t* quantizeSimpleAdjustedLut();
+
 // RGB to grayscale conversion using BT.601 coefficients via lookup tables.
 // Avoids 3 multiplications per pixel on ESP32-C3 (no FPU).
 // Note: Sum of max values is 254 (not 255) due to integer truncation of coefficients.
@@ -25,12 +32,15 @@ bool bmpTo1BitBmpScaled(const char* srcPath, const char* dstPath, int targetMaxW
 //     X  1/8 1/8
 // 1/8 1/8 1/8
 //     1/8
+//
+// Error terms are stored as int8_t: the clamped pixel is 0-255, so each 1/8 share is in
+// [-16, 15] and a cell collects at most 6 shares.
 class Atkinson1BitDitherer {
  public:
   explicit Atkinson1BitDitherer(int width) : width(width) {
-    errorRow0 = new int16_t[width + 4]();  // Current row
-    errorRow1 = new int16_t[width + 4]();  // Next row
-    errorRow2 = new int16_t[width + 4]();  // Row after next
+    errorRow0 = new int8_t[width + 4]();  // Current row
+    errorRow1 = new int8_t[width + 4]();  // Next row
+    errorRow2 = new int8_t[width + 4]();  // Row after next
   }
 
   ~Atkinson1BitDitherer() {
@@ -79,25 +89,66 @@ class Atkinson1BitDitherer {
     return quantized;
   }
 
+  // Dither a whole row into packed 1-bit output (MSB first, 8 pixels per byte).
+  // Produces the same bits as processPixel() for every x followed by nextRow(), but keeps
+  // same-row error in registers and writes each next-row cell once. lut is applied to the
+  // source pixels first (adjustPixelLut() matches processPixel, nullptr = no adjustment).
+  void processRow(const uint8_t* gray, uint8_t* out, const uint8_t* lut) {
+    if (lut) {
+      ditherRow<true>(gray, out, lut);
+    } else {
+      ditherRow<false>(gray, out, nullptr);
+    }
+    nextRow();
+  }
+
   void nextRow() {
-    int16_t* temp = errorRow0;
+    int8_t* temp = errorRow0;
     errorRow0 = errorRow1;
     errorRow1 = errorRow2;
     errorRow2 = temp;
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(errorRow2, 0, width + 4);
   }
 
   void reset() {
-    memset(errorRow0, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow1, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(errorRow0, 0, width + 4);
+    memset(errorRow1, 0, width + 4);
+    memset(errorRow2, 0, width + 4);
   }
 
  private:
+  template <bool UseLut>
+  void ditherRow(const uint8_t* gray, uint8_t* out, const uint8_t* lut) {
+    int carry = 0;  // Error pushed right by the previous two pixels
+    int err1 = 0;   // Error of pixel x-1
+    int err2 = 0;   // Error of pixel x-2
+    int x = 0;
+    while (x < width) {
+      const int count = (width - x) < 8 ? (width - x) : 8;
+      uint8_t packed = 0;
+      for (int i = 0; i < count; i++, x++) {
+        int adjusted = (UseLut ? lut[gray[x]] : gray[x]) + errorRow0[x + 2] + carry;
+        if (adjusted < 0) adjusted = 0;
+        if (adjusted > 255) adjusted = 255;
+        const int bit = adjusted >> 7;
+        const int error = (adjusted - (bit ? 255 : 0)) >> 3;
+
+        carry = error + err1;
+        errorRow1[x + 1] += static_cast<int8_t>(error + err1 + err2);  // Bottom-left cell is now final
+        errorRow2[x + 2] = static_cast<int8_t>(error);
+        err2 = err1;
+        err1 = error;
+        packed = static_cast<uint8_t>((packed << 1) | bit);
+      }
+      *out++ = static_cast<uint8_t>(packed << (8 - count));
+    }
+    errorRow1[width + 1] += static_cast<int8_t>(err1 + err2);
+  }
+
   int width;
-  int16_t* errorRow0;
-  int16_t* errorRow1;
-  int16_t* errorRow2;
+  int8_t* errorRow0;
+  int8_t* errorRow1;
+  int8_t* errorRow2;
 };
 
 // Atkinson dithering - distributes only 6/8 (75%) of error for cleaner results
@@ -106,12 +157,13 @@ class Atkinson1BitDitherer {
 // 1/8 1/8 1/8
 //     1/8
 // Less error buildup = fewer artifacts than Floyd-Steinberg
+// Error terms fit int8_t: each 1/8 share is in [-9, 7] and a cell collects at most 6 shares.
 class AtkinsonDitherer {
  public:
   explicit AtkinsonDitherer(int width) : width(width) {
-    errorRow0 = new int16_t[width + 4]();  // Current row
-    errorRow1 = new int16_t[width + 4]();  // Next row
-    errorRow2 = new int16_t[width + 4]();  // Row after next
+    errorRow0 = new int8_t[width + 4]();  // Current row
+    errorRow1 = new int8_t[width + 4]();  // Next row
+    errorRow2 = new int8_t[width + 4]();  // Row after next
   }
 
   ~AtkinsonDitherer() {
@@ -178,25 +230,69 @@ class AtkinsonDitherer {
     return quantized;
   }
 
+  // Dither a whole row into packed 2-bit output (MSB first, 4 pixels per byte).
+  // Produces the same bits as processPixel() for every x followed by nextRow(), but keeps
+  // same-row error in registers and writes each next-row cell once. lut is applied to the
+  // source pixels first (nullptr = pixels are already adjusted, as processPixel expects).
+  void processRow(const uint8_t* gray, uint8_t* out, const uint8_t* lut) {
+    if (lut) {
+      ditherRow<true>(gray, out, lut);
+    } else {
+      ditherRow<false>(gray, out, nullptr);
+    }
+    nextRow();
+  }
+
   void nextRow() {
-    int16_t* temp = errorRow0;
+    int8_t* temp = errorRow0;
     errorRow0 = errorRow1;
     errorRow1 = errorRow2;
     errorRow2 = temp;
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(errorRow2, 0, width + 4);
   }
 
   void reset() {
-    memset(errorRow0, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow1, 0, (width + 4) * sizeof(int16_t));
-    memset(errorRow2, 0, (width + 4) * sizeof(int16_t));
+    memset(errorRow0, 0, width + 4);
+    memset(errorRow1, 0, width + 4);
+    memset(errorRow2, 0, width + 4);
   }
 
  private:
+  template <bool UseLut>
+  void ditherRow(const uint8_t* gray, uint8_t* out, const uint8_t* lut) {
+    int carry = 0;  // Error pushed right by the previous two pixels
+    int err1 = 0;   // Error of pixel x-1
+    int err2 = 0;   // Error of pixel x-2
+    int x = 0;
+    while (x < width) {
+      const int count = (width - x) < 4 ? (width - x) : 4;
+      uint8_t packed = 0;
+      for (int i = 0; i < count; i++, x++) {
+        int adjusted = (UseLut ? lut[gray[x]] : gray[x]) + errorRow0[x + 2] + carry;
+        if (adjusted < 0) adjusted = 0;
+        if (adjusted > 255) adjusted = 255;
+        const int level = (adjusted >= 30) + (adjusted >= 50) + (adjusted >= 140);
+        const int error = (adjusted - LEVEL_VALUES[level]) >> 3;
+
+        carry = error + err1;
+        errorRow1[x + 1] += static_cast<int8_t>(error + err1 + err2);  // Bottom-left cell is now final
+        errorRow2[x + 2] = static_cast<int8_t>(error);
+        err2 = err1;
+        err1 = error;
+        packed = static_cast<uint8_t>((packed << 2) | level);
+      }
+      *out++ = static_cast<uint8_t>(packed << (2 * (4 - count)));
+    }
+    errorRow1[width + 1] += static_cast<int8_t>(err1 + err2);
+  }
+
+  // Output gray of each level, fine-tuned to X4 eink display (see processPixel)
+  static constexpr int LEVEL_VALUES[4] = {15, 30, 80, 210};
+
   int width;
-  int16_t* errorRow0;
-  int16_t* errorRow1;
-  int16_t* errorRow2;
+  int8_t* errorRow0;
+  int8_t* errorRow1;
+  int8_t* errorRow2;
 };
 
 // Floyd-Steinberg error diffusion dithering with serpentine scanning
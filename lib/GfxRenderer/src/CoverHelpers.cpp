@@ -13,23 +13,6 @@
 
 namespace CoverHelpers {
 
-bool renderCoverWithFallback(GfxRenderer& renderer, const std::string& coverPath, const std::string& previewPath,
-                             int marginTop, int marginRight, int marginBottom, int marginLeft,
-                             int& pagesUntilFullRefresh, int pagesPerRefreshValue, bool turnOffScreen) {
-  // Prefer full cover if available
-  if (SdMan.exists(coverPath.c_str())) {
-    return renderCoverFromBmp(renderer, coverPath, marginTop, marginRight, marginBottom, marginLeft,
-                              pagesUntilFullRefresh, pagesPerRefreshValue, turnOffScreen);
-  }
-  // Fall back to preview
-  if (SdMan.exists(previewPath.c_str())) {
-    LOG_DBG(TAG, "Using preview cover (full cover not ready)");
-    return renderCoverFromBmp(renderer, previewPath, marginTop, marginRight, marginBottom, marginLeft,
-                              pagesUntilFullRefresh, pagesPerRefreshValue, turnOffScreen);
-  }
-  return false;
-}
-
 bool renderCoverFromBmp(GfxRenderer& renderer, const std::string& bmpPath, int marginTop, int marginRight,
                         int marginBottom, int marginLeft, int& pagesUntilFullRefresh, int pagesPerRefreshValue,
                         bool turnOffScreen) {
@@ -122,6 +105,43 @@ bool convertImageToBmp(const std::string& inputPath, const std::string& outputPa
   return ImageConverterFactory::convertToBmp(inputPath, outputPath, config);
 }
 
+bool convertImageToCoverAndThumb(const std::string& inputPath, const std::string& coverBmpPath,
+                                 const std::string& thumbBmpPath, const char* logTag, bool use1BitDithering) {
+  const bool wantThumb = !thumbBmpPath.empty() && !SdMan.exists(thumbBmpPath.c_str());
+  if (!wantThumb || !ImageConverterFactory::canConvertMulti(inputPath)) {
+    if (!convertImageToBmp(inputPath, coverBmpPath, logTag, use1BitDithering)) {
+      return false;
+    }
+    if (wantThumb) {
+      generateThumbFromCover(coverBmpPath, thumbBmpPath, logTag);
+    }
+    return true;
+  }
+
+  const auto thumbTempPath = thumbBmpPath + ".tmp";
+  ImageConvertOutput outputs[2];
+  outputs[0].path = coverBmpPath;
+  outputs[0].oneBit = use1BitDithering;
+  outputs[1].path = thumbTempPath;
+  outputs[1].maxWidth = THUMB_WIDTH;
+  outputs[1].maxHeight = THUMB_HEIGHT;
+  outputs[1].oneBit = true;
+
+  ImageConvertConfig config;
+  config.logTag = logTag;
+  if (!ImageConverterFactory::convertToBmps(inputPath, outputs, 2, config)) {
+    return false;
+  }
+
+  FsFile tempFile = SdMan.open(thumbTempPath.c_str(), O_RDWR);
+  if (tempFile) {
+    tempFile.rename(thumbBmpPath.c_str());
+    tempFile.close();
+    LOG_INF(logTag, "Generated cover and thumbnail in one pass");
+  }
+  return true;
+}
+
 bool generateThumbFromCover(const std::string& coverBmpPath, const std::string& thumbBmpPath, const char* logTag) {
   if (SdMan.exists(thumbBmpPath.c_str())) return true;
   if (!SdMan.exists(coverBmpPath.c_str())) return false;
@@ -52,14 +52,6 @@ bool renderCoverFromBmp(GfxRenderer& renderer, const std::string& bmpPath, int m
                         int marginBottom, int marginLeft, int& pagesUntilFullRefresh, int pagesPerRefreshValue,
                         bool turnOffScreen = false);
 
-// Render cover with automatic fallback to preview if full cover not available
-// previewPath: fast-generated preview (simple threshold, no dithering)
-// coverPath: high-quality cover (with dithering)
-// Prefers coverPath when available, falls back to previewPath
-bool renderCoverWithFallback(GfxRenderer& renderer, const std::string& coverPath, const std::string& previewPath,
-                             int marginTop, int marginRight, int marginBottom, int marginLeft,
-                             int& pagesUntilFullRefresh, int pagesPerRefreshValue, bool turnOffScreen = false);
-
 // Find a cover image file in the given directory
 // Looks for: baseName.jpg, baseName.jpeg, baseName.png, baseName.bmp, cover.jpg, etc.
 // Returns empty string if no cover found
@@ -74,6 +66,15 @@ std::string findCoverImage(const std::string& dirPath, const std::string& baseNa
 bool convertImageToBmp(const std::string& inputPath, const std::string& outputPath, const char* logTag,
                        bool use1BitDithering);
 
+// Convert a cover image to the full-size cover BMP and the home screen thumbnail
+// (THUMB_WIDTH x THUMB_HEIGHT, 1-bit) with a single JPEG/PNG decode.
+// The thumbnail is skipped if thumbBmpPath is empty or already exists, and is
+// written atomically (temp file + rename). BMP input falls back to copying the
+// cover and scaling the thumbnail from it.
+// Returns true if the cover BMP was produced
+bool convertImageToCoverAndThumb(const std::string& inputPath, const std::string& coverBmpPath,
+                                 const std::string& thumbBmpPath, const char* logTag, bool use1BitDithering);
+
 // Generate thumbnail BMP from full-size cover BMP
 // Uses atomic write (temp file + rename) for safety
 // Returns true on success
@@ -0,0 +1,93 @@
+#include "DirtyTracker.h"
+
+#include <cstring>
+
+void DirtyTracker::snapshot(const uint8_t* frameBuffer) {
+  for (int tr = 0; tr < TILE_ROW_COUNT; tr++) {
+    uint32_t* sums = &pending_[tr * TILE_COLS];
+    for (int tc = 0; tc < TILE_COLS; tc++) sums[tc] = 2166136261u;  // FNV-1a offset basis
+
+    // Walk rows in memory order so every byte is read once, sequentially
+    const uint8_t* row = frameBuffer + tr * TILE_ROWS * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    for (int r = 0; r < TILE_ROWS; r++, row += EInkDisplay::DISPLAY_WIDTH_BYTES) {
+      for (int tc = 0; tc < TILE_COLS; tc++) {
+        const uint8_t* p = row + tc * TILE_BYTES;
+        uint32_t h = sums[tc];
+        for (int i = 0; i < TILE_BYTES; i++) {
+          h = (h ^ p[i]) * 16777619u;
+        }
+        sums[tc] = h;
+      }
+    }
+  }
+}
+
+int DirtyTracker::dirtyRegions(EInkDisplay::Window* regions) const {
+  struct Band {
+    int firstRow, lastRow, firstCol, lastCol;
+  };
+  Band bands[TILE_ROW_COUNT];
+  int bandCount = 0;
+  bool prevDirty = false;
+
+  // Consecutive tile rows with changes form one band spanning their changed columns
+  for (int tr = 0; tr < TILE_ROW_COUNT; tr++) {
+    int first = -1, last = -1;
+    for (int tc = 0; tc < TILE_COLS; tc++) {
+      if (pending_[tr * TILE_COLS + tc] != committed_[tr * TILE_COLS + tc]) {
+        if (first < 0) first = tc;
+        last = tc;
+      }
+    }
+    if (first < 0) {
+      prevDirty = false;
+      continue;
+    }
+    if (prevDirty) {
+      Band& b = bands[bandCount - 1];
+      b.lastRow = tr;
+      if (first < b.firstCol) b.firstCol = first;
+      if (last > b.lastCol) b.lastCol = last;
+    } else {
+      bands[bandCount++] = {tr, tr, first, last};
+    }
+    prevDirty = true;
+  }
+
+  // Too many bands: merge the pair separated by the fewest clean rows
+  while (bandCount > MAX_REGIONS) {
+    int best = 0;
+    for (int i = 1; i < bandCount - 1; i++) {
+      if (bands[i + 1].firstRow - bands[i].lastRow < bands[best + 1].firstRow - bands[best].lastRow) best = i;
+    }
+    Band& a = bands[best];
+    const Band& b = bands[best + 1];
+    a.lastRow = b.lastRow;
+    if (b.firstCol < a.firstCol) a.firstCol = b.firstCol;
+    if (b.lastCol > a.lastCol) a.lastCol = b.lastCol;
+    memmove(&bands[best + 1], &bands[best + 2], (bandCount - best - 2) * sizeof(Band));
+    bandCount--;
+  }
+
+  for (int i = 0; i < bandCount; i++) {
+    const Band& b = bands[i];
+    regions[i].x = static_cast<uint16_t>(b.firstCol * TILE_BYTES * 8);
+    regions[i].y = static_cast<uint16_t>(b.firstRow * TILE_ROWS);
+    regions[i].w = static_cast<uint16_t>((b.lastCol - b.firstCol + 1) * TILE_BYTES * 8);
+    regions[i].h = static_cast<uint16_t>((b.lastRow - b.firstRow + 1) * TILE_ROWS);
+  }
+  return bandCount;
+}
+
+void DirtyTracker::commit() {
+  memcpy(committed_, pending_, sizeof(committed_));
+  valid_ = true;
+}
+
+uint32_t DirtyTracker::regionBytes(const EInkDisplay::Window* regions, const int count) {
+  uint32_t bytes = 0;
+  for (int i = 0; i < count; i++) {
+    bytes += static_cast<uint32_t>(regions[i].w / 8) * regions[i].h;
+  }
+  return bytes;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <EInkDisplay.h>
+
+#include <cstdint>
+
+// DirtyTracker - Finds which parts of the frame buffer changed since the last panel update
+//
+// The panel buffer is split into byte-aligned tiles (80x16 physical pixels). A 32-bit checksum
+// per tile is kept for the frame last sent to the panel; comparing against the current buffer
+// yields the changed tiles, grouped into a few row bands for windowed updates.
+// Checksums are taken from the buffer itself, so every writer (text, bitmaps, raw frame
+// buffer access) is covered, including screens that clear and redraw everything.
+class DirtyTracker {
+ public:
+  static constexpr int TILE_BYTES = 10;  // 80 pixels
+  static constexpr int TILE_ROWS = 16;
+  static constexpr int TILE_COLS = EInkDisplay::DISPLAY_WIDTH_BYTES / TILE_BYTES;
+  static constexpr int TILE_ROW_COUNT = EInkDisplay::DISPLAY_HEIGHT / TILE_ROWS;
+  static constexpr int MAX_REGIONS = 4;
+  static_assert(TILE_COLS * TILE_BYTES == EInkDisplay::DISPLAY_WIDTH_BYTES, "tiles must cover the row");
+  static_assert(TILE_ROW_COUNT * TILE_ROWS == EInkDisplay::DISPLAY_HEIGHT, "tiles must cover the panel");
+
+  // Checksum the current frame buffer (pending until commit())
+  void snapshot(const uint8_t* frameBuffer);
+
+  // Regions (physical pixels) whose tiles differ between the snapshot and the committed frame.
+  // At most MAX_REGIONS; returns the count. Only meaningful while valid().
+  int dirtyRegions(EInkDisplay::Window* regions) const;
+
+  // The snapshot is now what the panel shows
+  void commit();
+
+  // Panel content no longer matches the committed frame (grayscale, manual windows)
+  void invalidate() { valid_ = false; }
+  bool valid() const { return valid_; }
+
+  static uint32_t regionBytes(const EInkDisplay::Window* regions, int count);
+
+ private:
+  uint32_t committed_[TILE_ROW_COUNT * TILE_COLS] = {};
+  uint32_t pending_[TILE_ROW_COUNT * TILE_COLS] = {};
+  bool valid_ = false;
+};
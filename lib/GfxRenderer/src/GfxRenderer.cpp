@@ -83,6 +83,20 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   const uint16_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
   const uint8_t bitPosition = 7 - (rotatedX % 8);  // MSB first
 
+  if (renderMode == GRAYSCALE_BANDS) {
+    // Same effect on both planes as a drawPixel() in the separate LSB and MSB passes
+    if (rotatedY < grayBandTop_ || rotatedY >= grayBandTop_ + grayBandRows_) return;
+    const uint16_t bandIndex = (rotatedY - grayBandTop_) * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+    if (state) {
+      grayBandLsb_[bandIndex] &= ~(1 << bitPosition);
+      grayBandMsb_[bandIndex] &= ~(1 << bitPosition);
+    } else {
+      grayBandLsb_[bandIndex] |= 1 << bitPosition;
+      grayBandMsb_[bandIndex] |= 1 << bitPosition;
+    }
+    return;
+  }
+
   if (state) {
     frameBuffer[byteIndex] &= ~(1 << bitPosition);  // Clear bit
   } else {
@@ -90,6 +104,74 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
   }
 }
 
+void GfxRenderer::drawGrayPixel(const int x, const int y, const uint8_t val) const {
+  int rotatedX = 0;
+  int rotatedY = 0;
+  rotateCoordinates(orientation, x, y, &rotatedX, &rotatedY);
+  if (rotatedX < 0 || rotatedX >= EInkDisplay::DISPLAY_WIDTH || rotatedY < grayBandTop_ ||
+      rotatedY >= grayBandTop_ + grayBandRows_) {
+    return;
+  }
+
+  const uint16_t bandIndex = (rotatedY - grayBandTop_) * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+  const uint8_t bit = 1 << (7 - (rotatedX % 8));
+  // MSB marks light and dark gray, LSB dark gray only
+  grayBandMsb_[bandIndex] |= bit;
+  if (val == 1) {
+    grayBandLsb_[bandIndex] |= bit;
+  }
+}
+
+bool GfxRenderer::inGrayBand(const int x, const int y, const int width, const int height) const {
+  if (renderMode != GRAYSCALE_BANDS) {
+    return true;
+  }
+  // Band rows are physical; opposite corners of the logical rectangle bound its physical rows
+  int x0, y0, x1, y1;
+  rotateCoordinates(orientation, x, y, &x0, &y0);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &x1, &y1);
+  const int top = std::min(y0, y1);
+  const int bottom = std::max(y0, y1);
+  return bottom >= grayBandTop_ && top < grayBandTop_ + grayBandRows_;
+}
+
+bool GfxRenderer::renderGrayscaleBands(const std::function<void()>& draw) {
+  // Largest band that can be allocated; both planes together stay well below one frame
+  int bandRows = GRAY_BAND_MAX_ROWS;
+  uint8_t* planes = nullptr;
+  while (bandRows >= GRAY_BAND_MIN_ROWS) {
+    planes = static_cast<uint8_t*>(malloc(2 * bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES));
+    if (planes) break;
+    bandRows /= 2;
+  }
+  if (!planes) {
+    LOG_ERR(TAG, "!! Failed to allocate grayscale band buffers");
+    return false;
+  }
+
+  const RenderMode previousMode = renderMode;
+  renderMode = GRAYSCALE_BANDS;
+  dirtyTracker_.invalidate();
+  grayBandLsb_ = planes;
+  grayBandMsb_ = planes + bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES;
+
+  for (int top = 0; top < EInkDisplay::DISPLAY_HEIGHT; top += bandRows) {
+    grayBandTop_ = top;
+    grayBandRows_ = std::min(bandRows, EInkDisplay::DISPLAY_HEIGHT - top);
+    memset(planes, 0, 2 * bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES);
+    draw();
+    einkDisplay.writeGrayscaleBand(top, grayBandRows_, grayBandLsb_, grayBandMsb_);
+  }
+
+  grayBandLsb_ = nullptr;
+  grayBandMsb_ = nullptr;
+  grayBandRows_ = 0;
+  renderMode = previousMode;
+  free(planes);
+  LOG_DBG(TAG, "Grayscale planes rendered in %d-row bands", bandRows);
+  return true;
+}
+
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
   if (!text || !*text) return 0;
 
@@ -116,9 +198,10 @@ int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontF
 
   // Check if text contains Arabic or Thai - use specialized width calculation
   int w = 0;
-  if (ScriptDetector::containsArabic(text)) {
+  const uint8_t scripts = ScriptDetector::scanScripts(text);
+  if (scripts & ScriptDetector::HAS_ARABIC) {
     w = getArabicTextWidth(fontId, text, style);
-  } else if (ScriptDetector::containsThai(text)) {
+  } else if (scripts & ScriptDetector::HAS_THAI) {
     w = getThaiTextWidth(fontId, text, style);
   } else if (_externalFont && _externalFont->isLoaded()) {
     // Character-by-character calculation with external font fallback (already loaded)
@@ -173,8 +256,30 @@ void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* te
   drawText(fontId, x, y, text, black, style);
 }
 
+uint8_t GfxRenderer::getTextFlags(const int fontId, const char* text, const EpdFontFamily::Style style) const {
+  if (text == nullptr || *text == '\0' || fontMap.count(fontId) == 0) {
+    return TEXT_FLAGS_SET;
+  }
+
+  // Trigger lazy loading of deferred font variant (e.g., bold custom font)
+  if (style != EpdFontFamily::REGULAR) {
+    getStreamingFont(fontId, style);
+  }
+
+  uint8_t flags = TEXT_FLAGS_SET | ScriptDetector::scanScripts(text);
+  if (fontMap.at(fontId).hasPrintableChars(text, style)) {
+    flags |= TEXT_PRINTABLE;
+  }
+  return flags;
+}
+
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
+  drawText(fontId, x, y, text, black, style, getTextFlags(fontId, text, style));
+}
+
+void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
+                           const EpdFontFamily::Style style, uint8_t textFlags) const {
   // cannot draw a NULL / empty string
   if (text == nullptr || *text == '\0') {
     return;
@@ -190,21 +295,25 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
     getStreamingFont(fontId, style);
   }
 
-  const auto font = fontMap.at(fontId);
+  const auto& font = fontMap.at(fontId);
+
+  if (!(textFlags & TEXT_FLAGS_SET)) {
+    textFlags = getTextFlags(fontId, text, style);
+  }
 
   // no printable characters
-  if (!font.hasPrintableChars(text, style)) {
+  if (!(textFlags & TEXT_PRINTABLE)) {
     return;
   }
 
   // Check if text contains Arabic script - use Arabic rendering path
-  if (ScriptDetector::containsArabic(text)) {
+  if (textFlags & ScriptDetector::HAS_ARABIC) {
     drawArabicText(fontId, x, y, text, black, style);
     return;
   }
 
   // Check if text contains Thai script - use Thai rendering path if so
-  if (ScriptDetector::containsThai(text)) {
+  if (textFlags & ScriptDetector::HAS_THAI) {
     drawThaiText(fontId, x, y, text, black, style);
     return;
   }
@@ -272,6 +381,8 @@ void GfxRenderer::fillRect(const int x, const int y, const int width, const int
 }
 
 void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  // Writes the frame buffer directly, which holds the BW page during band rendering
+  if (renderMode == GRAYSCALE_BANDS) return;
   // TODO: Rotate bits
   int rotatedX = 0;
   int rotatedY = 0;
@@ -313,6 +424,9 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   const int destWidth = isScaled ? static_cast<int>(bitmap.getWidth() * scale) : bitmap.getWidth();
   const int destHeight = isScaled ? static_cast<int>(bitmap.getHeight() * scale) : bitmap.getHeight();
   const float invScale = isScaled ? (1.0f / scale) : 1.0f;
+  if (!inGrayBand(x, y, destWidth, destHeight)) {
+    return;
+  }
 
   int lastSrcY = -1;
   for (int destY = 0; destY < destHeight; destY++) {
@@ -348,6 +462,8 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
         drawPixel(screenX, screenY, false);
       } else if (renderMode == GRAYSCALE_LSB && val == 1) {
         drawPixel(screenX, screenY, false);
+      } else if (renderMode == GRAYSCALE_BANDS && (val == 1 || val == 2)) {
+        drawGrayPixel(screenX, screenY, val);
       }
     }
   }
@@ -356,12 +472,15 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
 static unsigned long renderStartMs = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
+  if (renderMode == GRAYSCALE_BANDS) return;  // Band planes are cleared per band
+  // A new frame starts here; an async refresh may still need the frame buffer for its RAM sync
+  einkDisplay.waitForRefresh();
   renderStartMs = millis();
   einkDisplay.clearScreen(color);
 }
 
 void GfxRenderer::clearArea(const int x, const int y, const int width, const int height, const uint8_t color) const {
-  if (width <= 0 || height <= 0) {
+  if (width <= 0 || height <= 0 || renderMode == GRAYSCALE_BANDS) {
     return;
   }
 
@@ -425,14 +544,43 @@ void GfxRenderer::invertScreen() const {
   }
 }
 
-void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode, bool turnOffScreen) const {
+void GfxRenderer::displayBuffer(const EInkDisplay::RefreshMode refreshMode, const bool turnOffScreen) const {
+  displayBufferAsync(refreshMode, turnOffScreen);
+  einkDisplay.waitForRefresh();
+}
+
+EInkDisplay::RefreshHandle GfxRenderer::displayBufferAsync(const EInkDisplay::RefreshMode refreshMode,
+                                                           const bool turnOffScreen) const {
   if (renderStartMs > 0) {
     LOG_DBG(TAG, "Render took %lu ms", millis() - renderStartMs);
     renderStartMs = 0;
   }
-  einkDisplay.displayBuffer(refreshMode, turnOffScreen);
+
+  dirtyTracker_.snapshot(frameBuffer);
+  if (refreshMode == EInkDisplay::FAST_REFRESH && dirtyTracker_.valid()) {
+    EInkDisplay::Window windows[DirtyTracker::MAX_REGIONS];
+    const int count = dirtyTracker_.dirtyRegions(windows);
+    if (count == 0 && !turnOffScreen) {
+      LOG_DBG(TAG, "Frame unchanged, skipping refresh");
+      return 0;
+    }
+    // Beyond ~3/4 of the panel the per-row transfers stop paying off
+    if (count > 0 && DirtyTracker::regionBytes(windows, count) < EInkDisplay::BUFFER_SIZE * 3 / 4) {
+      const auto handle = einkDisplay.displayWindowsAsync(windows, static_cast<uint8_t>(count), turnOffScreen);
+      if (handle != 0) {
+        dirtyTracker_.commit();
+        return handle;
+      }
+    }
+  }
+
+  const auto handle = einkDisplay.displayBufferAsync(refreshMode, turnOffScreen);
+  dirtyTracker_.commit();
+  return handle;
 }
 
+void GfxRenderer::waitForRefresh() const { einkDisplay.waitForRefresh(); }
+
 void GfxRenderer::displayWindow(int x, int y, int width, int height, bool turnOffScreen) const {
   int physX, physY, physW, physH;
   switch (orientation) {
@@ -468,6 +616,8 @@ void GfxRenderer::displayWindow(int x, int y, int width, int height, bool turnOf
   physX = physX & ~7;
   physW = alignedEnd - physX;
   einkDisplay.displayWindow(physX, physY, physW, physH, turnOffScreen);
+  // Only part of the panel was updated, the checksums no longer describe what it shows
+  dirtyTracker_.invalidate();
 }
 
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
@@ -745,11 +895,21 @@ size_t GfxRenderer::getBufferSize() { return EInkDisplay::BUFFER_SIZE; }
 
 void GfxRenderer::grayscaleRevert() const { einkDisplay.grayscaleRevert(); }
 
-void GfxRenderer::copyGrayscaleLsbBuffers() const { einkDisplay.copyGrayscaleLsbBuffers(frameBuffer); }
+// Grayscale planes overwrite the panel RAM, so the next BW update must be a full one
+void GfxRenderer::copyGrayscaleLsbBuffers() const {
+  dirtyTracker_.invalidate();
+  einkDisplay.copyGrayscaleLsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::copyGrayscaleMsbBuffers() const { einkDisplay.copyGrayscaleMsbBuffers(frameBuffer); }
+void GfxRenderer::copyGrayscaleMsbBuffers() const {
+  dirtyTracker_.invalidate();
+  einkDisplay.copyGrayscaleMsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::displayGrayBuffer(bool turnOffScreen) const { einkDisplay.displayGrayBuffer(turnOffScreen); }
+void GfxRenderer::displayGrayBuffer(bool turnOffScreen) const {
+  dirtyTracker_.invalidate();
+  einkDisplay.displayGrayBuffer(turnOffScreen);
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -874,8 +1034,10 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
 
   // Bitmap lookup bypasses getStreamingFont() (no lazy resolver) for performance.
   // Font variants are already resolved during layout (word width measurement).
+  // Glyphs outside the current grayscale band are skipped before their bitmap is fetched.
+  const bool inBand = inGrayBand(*x + left, *y - glyph->top, width, height);
   const uint8_t* bitmap = nullptr;
-  auto streamingIt = _streamingFonts.find(fontId);
+  auto streamingIt = inBand ? _streamingFonts.find(fontId) : _streamingFonts.end();
   if (streamingIt != _streamingFonts.end()) {
     int idx = EpdFontFamily::externalStyleIndex(style);
     StreamingEpdFont* sf = streamingIt->second[idx];
@@ -884,7 +1046,7 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
       bitmap = sf->getGlyphBitmap(glyph);
     }
   }
-  if (!bitmap && fontFamily.getData(style)->bitmap) {
+  if (inBand && !bitmap && fontFamily.getData(style)->bitmap) {
     // Fall back to standard EpdFont bitmap access
     bitmap = &fontFamily.getData(style)->bitmap[offset];
   }
@@ -921,6 +1083,8 @@ void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, const uint32_t cp,
           } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
             // Dark gray
             drawPixel(screenX, screenY, false);
+          } else if (renderMode == GRAYSCALE_BANDS && (bmpVal == 1 || bmpVal == 2)) {
+            drawGrayPixel(screenX, screenY, bmpVal);
           }
         } else {
           const uint8_t byte = bitmap[pixelPosition / 8];
@@ -1117,6 +1281,13 @@ void GfxRenderer::drawThaiText(const int fontId, const int x, const int y, const
 void GfxRenderer::renderThaiCluster(const EpdFontFamily& fontFamily, const ThaiShaper::ThaiCluster& cluster, int* x,
                                     const int y, const bool pixelState, const EpdFontFamily::Style style,
                                     const int fontId) const {
+  for (const auto& glyph : cluster.glyphs) {
+    renderThaiGlyph(fontFamily, glyph, x, y, pixelState, style);
+  }
+}
+
+void GfxRenderer::renderThaiGlyph(const EpdFontFamily& fontFamily, const ThaiShaper::PositionedGlyph& glyph, int* x,
+                                  const int y, const bool pixelState, const EpdFontFamily::Style style) const {
   const EpdFontData* fontData = fontFamily.getData(style);
   if (!fontData) {
     return;
@@ -1127,86 +1298,77 @@ void GfxRenderer::renderThaiCluster(const EpdFontFamily& fontFamily, const ThaiS
   const int fontHeight = fontData->advanceY;
   const float yScale = fontHeight / 26.0f;
 
-  int baseX = *x;  // Store base position for combining marks
+  const EpdGlyph* glyphData = fontFamily.getGlyph(glyph.codepoint, style);
 
-  for (const auto& glyph : cluster.glyphs) {
-    const EpdGlyph* glyphData = fontFamily.getGlyph(glyph.codepoint, style);
-
-    if (!glyphData) {
-      glyphData = fontFamily.getGlyph('?', style);
-    }
-    if (!glyphData) {
-      continue;
-    }
+  if (!glyphData) {
+    glyphData = fontFamily.getGlyph('?', style);
+  }
+  if (!glyphData) {
+    return;
+  }
 
-    const int is2Bit = fontData->is2Bit;
-    const uint32_t offset = glyphData->dataOffset;
-    const uint8_t width = glyphData->width;
-    const uint8_t height = glyphData->height;
-    const int left = glyphData->left;
-
-    // Calculate x position for this glyph
-    int glyphX;
-    if (glyph.zeroAdvance) {
-      // Combining mark: position relative to base consonant
-      glyphX = baseX + glyph.xOffset;
-    } else {
-      // Normal glyph: position at current cursor
-      glyphX = *x + glyph.xOffset;
-    }
+  const int is2Bit = fontData->is2Bit;
+  const uint32_t offset = glyphData->dataOffset;
+  const uint8_t width = glyphData->width;
+  const uint8_t height = glyphData->height;
+  const int left = glyphData->left;
 
-    // Calculate y offset - only apply scaling for stacked marks
-    int yOffset = 0;
-    if (glyph.yOffset < -2) {
-      yOffset = static_cast<int>(glyph.yOffset * yScale);
-    }
-    const int glyphY = y + yOffset;
+  // Combining marks sit relative to the base consonant, which is where the cursor still is
+  // (marks don't advance it)
+  const int glyphX = *x + glyph.xOffset;
 
-    if (fontData->bitmap == nullptr) {
-      continue;
-    }
-    const uint8_t* bitmap = &fontData->bitmap[offset];
+  // Calculate y offset - only apply scaling for stacked marks
+  int yOffset = 0;
+  if (glyph.yOffset < -2) {
+    yOffset = static_cast<int>(glyph.yOffset * yScale);
+  }
+  const int glyphY = y + yOffset;
 
-    const int screenHeight = getScreenHeight();
-    const int screenWidth = getScreenWidth();
+  if (fontData->bitmap == nullptr) {
+    return;
+  }
+  const uint8_t* bitmap = &fontData->bitmap[offset];
 
-    for (int bitmapY = 0; bitmapY < height; bitmapY++) {
-      const int screenY = glyphY - glyphData->top + bitmapY;
-      if (screenY < 0 || screenY >= screenHeight) continue;
+  const int screenHeight = getScreenHeight();
+  const int screenWidth = getScreenWidth();
 
-      for (int bitmapX = 0; bitmapX < width; bitmapX++) {
-        const int pixelPosition = bitmapY * width + bitmapX;
-        const int screenX = glyphX + left + bitmapX;
-        if (screenX < 0 || screenX >= screenWidth) continue;
+  for (int bitmapY = 0; bitmapY < height; bitmapY++) {
+    const int screenY = glyphY - glyphData->top + bitmapY;
+    if (screenY < 0 || screenY >= screenHeight) continue;
 
-        if (is2Bit) {
-          const uint8_t byte = bitmap[pixelPosition / 4];
-          const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
-          const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+    for (int bitmapX = 0; bitmapX < width; bitmapX++) {
+      const int pixelPosition = bitmapY * width + bitmapX;
+      const int screenX = glyphX + left + bitmapX;
+      if (screenX < 0 || screenX >= screenWidth) continue;
 
-          if (renderMode == BW && bmpVal < 3) {
-            drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            drawPixel(screenX, screenY, false);
-          } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
-            drawPixel(screenX, screenY, false);
-          }
-        } else {
-          const uint8_t byte = bitmap[pixelPosition / 8];
-          const uint8_t bit_index = 7 - (pixelPosition % 8);
+      if (is2Bit) {
+        const uint8_t byte = bitmap[pixelPosition / 4];
+        const uint8_t bit_index = (3 - pixelPosition % 4) * 2;
+        const uint8_t bmpVal = 3 - (byte >> bit_index) & 0x3;
+
+        if (renderMode == BW && bmpVal < 3) {
+          drawPixel(screenX, screenY, pixelState);
+        } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_BANDS && (bmpVal == 1 || bmpVal == 2)) {
+          drawGrayPixel(screenX, screenY, bmpVal);
+        }
+      } else {
+        const uint8_t byte = bitmap[pixelPosition / 8];
+        const uint8_t bit_index = 7 - (pixelPosition % 8);
 
-          if ((byte >> bit_index) & 1) {
-            drawPixel(screenX, screenY, pixelState);
-          }
+        if ((byte >> bit_index) & 1) {
+          drawPixel(screenX, screenY, pixelState);
         }
       }
     }
+  }
 
-    // Track advance for non-combining glyphs
-    if (!glyph.zeroAdvance) {
-      baseX = *x + glyphData->advanceX;
-      *x += glyphData->advanceX;
-    }
+  // Track advance for non-combining glyphs
+  if (!glyph.zeroAdvance) {
+    *x += glyphData->advanceX;
   }
 }
 
@@ -1258,3 +1420,31 @@ void GfxRenderer::drawArabicText(const int fontId, const int x, const int y, con
     renderChar(font, cp, &xpos, &yPos, black, style, fontId);
   }
 }
+
+void GfxRenderer::drawShapedText(const int fontId, const int x, const int y, const ThaiShaper::PositionedGlyph* glyphs,
+                                 const size_t count, const uint8_t textFlags, const bool black,
+                                 const EpdFontFamily::Style style) const {
+  if (fontMap.count(fontId) == 0) {
+    LOG_ERR(TAG, "Font %d not found", fontId);
+    return;
+  }
+
+  // Trigger lazy loading of deferred font variant (e.g., bold custom font)
+  if (style != EpdFontFamily::REGULAR) {
+    getStreamingFont(fontId, style);
+  }
+
+  const int yPos = y + getFontAscenderSize(fontId);
+  int xpos = x;
+  const auto& font = fontMap.at(fontId);
+
+  if (textFlags & ScriptDetector::HAS_ARABIC) {
+    for (size_t i = 0; i < count; i++) {
+      renderChar(font, glyphs[i].codepoint, &xpos, &yPos, black, style, fontId);
+    }
+  } else {
+    for (size_t i = 0; i < count; i++) {
+      renderThaiGlyph(font, glyphs[i], &xpos, yPos, black, style);
+    }
+  }
+}
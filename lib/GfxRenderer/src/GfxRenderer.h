@@ -5,11 +5,13 @@
 #include <ThaiCluster.h>
 
 #include <array>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
 
 #include "Bitmap.h"
+#include "DirtyTracker.h"
 
 // Forward declaration for external CJK font support
 class ExternalFont;
@@ -18,7 +20,8 @@ class StreamingEpdFont;
 
 class GfxRenderer {
  public:
-  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
+  // GRAYSCALE_BANDS is set by renderGrayscaleBands() and draws both gray planes at once
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE_BANDS };
 
   // Logical screen orientation from the perspective of callers
   enum Orientation {
@@ -28,6 +31,13 @@ class GfxRenderer {
     LandscapeCounterClockwise  // 800x480 logical coordinates, native panel orientation
   };
 
+  // What drawText() needs to know about a string (getTextFlags()). Computed once per word at
+  // layout and stored in the page cache, so drawing a cached page doesn't rescan the text.
+  // The low bits are ScriptDetector::ScriptFlags.
+  static constexpr uint8_t TEXT_SCRIPT_MASK = 0x07;
+  static constexpr uint8_t TEXT_PRINTABLE = 0x40;  // Has glyphs with ink in the font
+  static constexpr uint8_t TEXT_FLAGS_SET = 0x80;  // Flags were computed (0 means unknown)
+
  private:
   static constexpr size_t BW_BUFFER_CHUNK_SIZE = 8000;  // 8KB chunks to allow for non-contiguous memory
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = EInkDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
@@ -39,6 +49,18 @@ class GfxRenderer {
   Orientation orientation;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  // Grayscale band target for renderGrayscaleBands(): LSB/MSB planes of physical rows
+  // [grayBandTop_, grayBandTop_ + grayBandRows_)
+  static constexpr int GRAY_BAND_MAX_ROWS = 120;  // 2 x 12KB planes, 4 bands per page
+  static constexpr int GRAY_BAND_MIN_ROWS = 8;
+  uint8_t* grayBandLsb_ = nullptr;
+  uint8_t* grayBandMsb_ = nullptr;
+  int grayBandTop_ = 0;
+  int grayBandRows_ = 0;
+  void drawGrayPixel(int x, int y, uint8_t val) const;
+  bool inGrayBand(int x, int y, int width, int height) const;
+  // Tile checksums of the frame on the panel, used to send only changed regions on fast refresh
+  mutable DirtyTracker dirtyTracker_;
   std::map<int, EpdFontFamily> fontMap;
   // Streaming fonts: [fontId] -> array of [REGULAR, BOLD] (external fonts have no italic)
   // Mutable: getStreamingFont may trigger lazy loading of bold variant via resolver
@@ -96,6 +118,8 @@ class GfxRenderer {
                   EpdFontFamily::Style style, int fontId) const;
   void renderThaiCluster(const EpdFontFamily& fontFamily, const ThaiShaper::ThaiCluster& cluster, int* x, int y,
                          bool pixelState, EpdFontFamily::Style style, int fontId) const;
+  void renderThaiGlyph(const EpdFontFamily& fontFamily, const ThaiShaper::PositionedGlyph& glyph, int* x, int y,
+                       bool pixelState, EpdFontFamily::Style style) const;
   void renderExternalGlyph(uint32_t cp, int* x, int y, bool pixelState) const;
   int getExternalGlyphWidth(uint32_t cp) const;
   bool tryResolveExternalFont() const;
@@ -164,8 +188,16 @@ class GfxRenderer {
   // Screen ops
   int getScreenWidth() const;
   int getScreenHeight() const;
+  // FAST_REFRESH only transfers the regions that changed since the last update when they are
+  // small enough, and skips the refresh entirely when nothing changed
   void displayBuffer(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH,
                      bool turnOffScreen = false) const;
+  // Starts the same update without waiting for the panel (see EInkDisplay::displayBufferAsync).
+  // Don't draw into the frame buffer before waitForRefresh(); clearScreen() waits by itself.
+  // Returns 0 when no refresh was needed.
+  EInkDisplay::RefreshHandle displayBufferAsync(EInkDisplay::RefreshMode refreshMode = EInkDisplay::FAST_REFRESH,
+                                                bool turnOffScreen = false) const;
+  void waitForRefresh() const;
   // EXPERIMENTAL: Windowed update - display only a rectangular region
   void displayWindow(int x, int y, int width, int height, bool turnOffScreen = false) const;
   void invertScreen() const;
@@ -186,6 +218,10 @@ class GfxRenderer {
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  // Same, with the text's getTextFlags() result
+  void drawText(int fontId, int x, int y, const char* text, bool black, EpdFontFamily::Style style,
+                uint8_t textFlags) const;
+  uint8_t getTextFlags(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId) const;
   int getFontAscenderSize(int fontId) const;
   int getLineHeight(int fontId) const;
@@ -208,6 +244,11 @@ class GfxRenderer {
   void drawArabicText(int fontId, int x, int y, const char* text, bool black = true,
                       EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
 
+  // Draws a word shaped at layout (TextBlock::shapeWord()): Arabic glyphs in visual order, or Thai
+  // glyphs with their mark offsets. textFlags tells which script the glyphs are.
+  void drawShapedText(int fontId, int x, int y, const ThaiShaper::PositionedGlyph* glyphs, size_t count,
+                      uint8_t textFlags, bool black = true, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+
   // UI Components
   void drawButtonHints(int fontId, const char* btn1, const char* btn2, const char* btn3, const char* btn4,
                        bool black = true) const;
@@ -220,6 +261,13 @@ class GfxRenderer {
   bool storeBwBuffer();  // Returns true if buffer was stored successfully
   void restoreBwBuffer();
   void cleanupGrayscaleWithFrameBuffer() const;
+  // Render both grayscale planes in one pass per band of panel rows and stream each band into
+  // the panel RAM, replacing the separate LSB/MSB passes. draw() is called once per band and
+  // should draw the whole page; drawing is clipped to the band and glyphs outside it are
+  // skipped. The frame buffer (the BW page) is left untouched, so cleanupGrayscaleWithFrameBuffer()
+  // can follow displayGrayBuffer() without re-rendering. Returns false if no band buffer
+  // could be allocated.
+  bool renderGrayscaleBands(const std::function<void()>& draw);
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
@@ -0,0 +1,310 @@
+#include "ScaledBmpWriter.h"
+
+#include <Logging.h>
+
+#define TAG "BMPW"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "BitmapHelpers.h"
+
+// ============================================================================
+// IMAGE PROCESSING OPTIONS - Toggle these to test different configurations
+// ============================================================================
+constexpr bool USE_8BIT_OUTPUT = false;  // true: 8-bit grayscale (no quantization), false: 2-bit (4 levels)
+// Dithering method selection (only one should be true, or all false for simple quantization):
+constexpr bool USE_ATKINSON = true;          // Atkinson dithering (cleaner than F-S, less error diffusion)
+constexpr bool USE_FLOYD_STEINBERG = false;  // Floyd-Steinberg error diffusion (can cause "worm" artifacts)
+// ============================================================================
+
+namespace {
+
+inline void write16(Print& out, const uint16_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+}
+
+inline void write32(Print& out, const uint32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+inline void write32Signed(Print& out, const int32_t value) {
+  out.write(value & 0xFF);
+  out.write((value >> 8) & 0xFF);
+  out.write((value >> 16) & 0xFF);
+  out.write((value >> 24) & 0xFF);
+}
+
+// Common BMP file + DIB header (top-down, uncompressed, palettized)
+void writeBmpHeader(Print& bmpOut, const int width, const int height, const uint16_t bpp, const uint32_t colors,
+                    const int bytesPerRow) {
+  const uint32_t imageSize = bytesPerRow * height;
+  const uint32_t dataOffset = 14 + 40 + colors * 4;
+  const uint32_t fileSize = dataOffset + imageSize;
+
+  // BMP File Header (14 bytes)
+  bmpOut.write('B');
+  bmpOut.write('M');
+  write32(bmpOut, fileSize);
+  write32(bmpOut, 0);  // Reserved
+  write32(bmpOut, dataOffset);
+
+  // DIB Header (BITMAPINFOHEADER - 40 bytes)
+  write32(bmpOut, 40);
+  write32Signed(bmpOut, width);
+  write32Signed(bmpOut, -height);  // Negative height = top-down bitmap
+  write16(bmpOut, 1);              // Color planes
+  write16(bmpOut, bpp);
+  write32(bmpOut, 0);  // BI_RGB (no compression)
+  write32(bmpOut, imageSize);
+  write32(bmpOut, 2835);  // xPixelsPerMeter (72 DPI)
+  write32(bmpOut, 2835);  // yPixelsPerMeter (72 DPI)
+  write32(bmpOut, colors);
+  write32(bmpOut, colors);
+}
+
+void writeBmpHeader8bit(Print& bmpOut, const int width, const int height, const int bytesPerRow) {
+  writeBmpHeader(bmpOut, width, height, 8, 256, bytesPerRow);
+  // Grayscale palette (BGRA)
+  for (int i = 0; i < 256; i++) {
+    bmpOut.write(static_cast<uint8_t>(i));
+    bmpOut.write(static_cast<uint8_t>(i));
+    bmpOut.write(static_cast<uint8_t>(i));
+    bmpOut.write(static_cast<uint8_t>(0));
+  }
+}
+
+void writeBmpHeader1bit(Print& bmpOut, const int width, const int height, const int bytesPerRow) {
+  writeBmpHeader(bmpOut, width, height, 1, 2, bytesPerRow);
+  // Note: In 1-bit BMP, palette index 0 = black, 1 = white
+  const uint8_t palette[8] = {
+      0x00, 0x00, 0x00, 0x00,  // Color 0: Black
+      0xFF, 0xFF, 0xFF, 0x00   // Color 1: White
+  };
+  bmpOut.write(palette, sizeof(palette));
+}
+
+void writeBmpHeader2bit(Print& bmpOut, const int width, const int height, const int bytesPerRow) {
+  writeBmpHeader(bmpOut, width, height, 2, 4, bytesPerRow);
+  const uint8_t palette[16] = {
+      0x00, 0x00, 0x00, 0x00,  // Color 0: Black
+      0x55, 0x55, 0x55, 0x00,  // Color 1: Dark gray (85)
+      0xAA, 0xAA, 0xAA, 0x00,  // Color 2: Light gray (170)
+      0xFF, 0xFF, 0xFF, 0x00   // Color 3: White
+  };
+  bmpOut.write(palette, sizeof(palette));
+}
+
+}  // namespace
+
+ScaledBmpWriter::~ScaledBmpWriter() { release(); }
+
+void ScaledBmpWriter::release() {
+  free(rowBuffer_);
+  free(grayRow_);
+  delete[] rowAccum_;
+  delete[] rowCount_;
+  delete atkinson_;
+  delete floydSteinberg_;
+  delete atkinson1Bit_;
+  rowBuffer_ = nullptr;
+  grayRow_ = nullptr;
+  rowAccum_ = nullptr;
+  rowCount_ = nullptr;
+  atkinson_ = nullptr;
+  floydSteinberg_ = nullptr;
+  atkinson1Bit_ = nullptr;
+}
+
+bool ScaledBmpWriter::begin(const BmpOutputSpec& spec, const int srcWidth, const int srcHeight) {
+  release();
+  spec_ = spec;
+  srcWidth_ = srcWidth;
+  srcY_ = 0;
+  outY_ = 0;
+
+  // Calculate output dimensions (pre-scale to fit target exactly)
+  outWidth_ = srcWidth;
+  outHeight_ = srcHeight;
+  scaleX_fp_ = 65536;  // 1.0 in 16.16 fixed point
+  scaleY_fp_ = 65536;
+  needsScaling_ = false;
+
+  if (spec.maxWidth > 0 && spec.maxHeight > 0 && (srcWidth > spec.maxWidth || srcHeight > spec.maxHeight)) {
+    // Contain mode: smaller scale factor so the image fits entirely within the target
+    const float scaleToFitWidth = static_cast<float>(spec.maxWidth) / srcWidth;
+    const float scaleToFitHeight = static_cast<float>(spec.maxHeight) / srcHeight;
+    const float scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+
+    outWidth_ = static_cast<int>(srcWidth * scale);
+    outHeight_ = static_cast<int>(srcHeight * scale);
+    if (outWidth_ < 1) outWidth_ = 1;
+    if (outHeight_ < 1) outHeight_ = 1;
+
+    scaleX_fp_ = (static_cast<uint32_t>(srcWidth) << 16) / outWidth_;
+    scaleY_fp_ = (static_cast<uint32_t>(srcHeight) << 16) / outHeight_;
+    needsScaling_ = true;
+
+    LOG_DBG(TAG, "Pre-scaling %dx%d -> %dx%d (fit to %dx%d)", srcWidth, srcHeight, outWidth_, outHeight_,
+            spec.maxWidth, spec.maxHeight);
+  }
+
+  if (spec.oneBit) {
+    bytesPerRow_ = (outWidth_ + 31) / 32 * 4;
+  } else if (USE_8BIT_OUTPUT) {
+    bytesPerRow_ = (outWidth_ + 3) / 4 * 4;
+  } else {
+    bytesPerRow_ = (outWidth_ * 2 + 31) / 32 * 4;
+  }
+
+  rowBuffer_ = static_cast<uint8_t*>(malloc(bytesPerRow_));
+  if (!rowBuffer_) {
+    LOG_ERR(TAG, "Failed to allocate row buffer");
+    return false;
+  }
+
+  if (needsScaling_) {
+    grayRow_ = static_cast<uint8_t*>(malloc(outWidth_));
+    rowAccum_ = new (std::nothrow) uint32_t[outWidth_]();
+    rowCount_ = new (std::nothrow) uint16_t[outWidth_]();
+    if (!grayRow_ || !rowAccum_ || !rowCount_) {
+      LOG_ERR(TAG, "Failed to allocate scaling buffers");
+      release();
+      return false;
+    }
+    nextOutY_srcStart_ = scaleY_fp_;  // First boundary is at scaleY_fp (source Y for outY=1)
+  }
+
+  // Skip ditherer allocation in quickMode for faster preview
+  if (!spec.quickMode) {
+    bool allocFailed = false;
+    if (spec.oneBit) {
+      atkinson1Bit_ = new (std::nothrow) Atkinson1BitDitherer(outWidth_);
+      allocFailed = !atkinson1Bit_;
+    } else if (!USE_8BIT_OUTPUT && USE_ATKINSON) {
+      atkinson_ = new (std::nothrow) AtkinsonDitherer(outWidth_);
+      allocFailed = !atkinson_;
+    } else if (!USE_8BIT_OUTPUT && USE_FLOYD_STEINBERG) {
+      floydSteinberg_ = new (std::nothrow) FloydSteinbergDitherer(outWidth_);
+      allocFailed = !floydSteinberg_;
+    }
+    if (allocFailed) {
+      LOG_ERR(TAG, "Failed to allocate ditherer");
+      release();
+      return false;
+    }
+  }
+
+  if (spec.oneBit) {
+    writeBmpHeader1bit(*spec.out, outWidth_, outHeight_, bytesPerRow_);
+  } else if (USE_8BIT_OUTPUT) {
+    writeBmpHeader8bit(*spec.out, outWidth_, outHeight_, bytesPerRow_);
+  } else {
+    writeBmpHeader2bit(*spec.out, outWidth_, outHeight_, bytesPerRow_);
+  }
+  return true;
+}
+
+void ScaledBmpWriter::pushRow(const uint8_t* srcRow) {
+  if (!rowBuffer_ || outY_ >= outHeight_) return;
+
+  if (!needsScaling_) {
+    // No scaling - direct output (1:1 mapping)
+    emitRow(srcRow);
+    return;
+  }
+
+  // Fixed-point area averaging for exact fit scaling
+  // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
+  for (int outX = 0; outX < outWidth_; outX++) {
+    const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp_) >> 16;
+    const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp_) >> 16;
+
+    int sum = 0;
+    int count = 0;
+    for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth_; srcX++) {
+      sum += srcRow[srcX];
+      count++;
+    }
+
+    // Handle edge case: if no pixels in range, use nearest
+    if (count == 0 && srcXStart < srcWidth_) {
+      sum = srcRow[srcXStart];
+      count = 1;
+    }
+
+    rowAccum_[outX] += sum;
+    rowCount_[outX] += count;
+  }
+
+  // Output row when source Y crosses the boundary of the next output row
+  srcY_++;
+  const uint32_t srcY_fp = static_cast<uint32_t>(srcY_) << 16;
+  if (srcY_fp >= nextOutY_srcStart_) {
+    for (int x = 0; x < outWidth_; x++) {
+      grayRow_[x] = (rowCount_[x] > 0) ? (rowAccum_[x] / rowCount_[x]) : 0;
+    }
+    emitRow(grayRow_);
+
+    // Reset accumulators for next output row
+    memset(rowAccum_, 0, outWidth_ * sizeof(uint32_t));
+    memset(rowCount_, 0, outWidth_ * sizeof(uint16_t));
+    nextOutY_srcStart_ = static_cast<uint32_t>(outY_ + 1) * scaleY_fp_;
+  }
+}
+
+void ScaledBmpWriter::emitRow(const uint8_t* gray) {
+  memset(rowBuffer_, 0, bytesPerRow_);
+
+  if (spec_.oneBit) {
+    if (atkinson1Bit_) {
+      // 1-bit Atkinson with brightness/contrast folded into the source lookup
+      atkinson1Bit_->processRow(gray, rowBuffer_, adjustPixelLut());
+    } else {
+      // Quick mode: plain threshold, 8 pixels per output byte (MSB first)
+      for (int x = 0; x < outWidth_; x += 8) {
+        const int count = (outWidth_ - x) < 8 ? (outWidth_ - x) : 8;
+        uint8_t packed = 0;
+        for (int i = 0; i < count; i++) {
+          packed = static_cast<uint8_t>((packed << 1) | quantize1bit(gray[x + i], x + i, outY_));
+        }
+        rowBuffer_[x / 8] = static_cast<uint8_t>(packed << (8 - count));
+      }
+    }
+  } else if (USE_8BIT_OUTPUT) {
+    const uint8_t* lut = adjustPixelLut();
+    for (int x = 0; x < outWidth_; x++) {
+      rowBuffer_[x] = lut[gray[x]];
+    }
+  } else if (atkinson_) {
+    atkinson_->processRow(gray, rowBuffer_, adjustPixelLut());
+  } else if (spec_.quickMode) {
+    // Adjust + threshold in a single lookup, 4 pixels per output byte (MSB first)
+    const uint8_t* lut = quantizeSimpleAdjustedLut();
+    for (int x = 0; x < outWidth_; x += 4) {
+      const int count = (outWidth_ - x) < 4 ? (outWidth_ - x) : 4;
+      uint8_t packed = 0;
+      for (int i = 0; i < count; i++) {
+        packed = static_cast<uint8_t>((packed << 2) | lut[gray[x + i]]);
+      }
+      rowBuffer_[x / 4] = static_cast<uint8_t>(packed << (2 * (4 - count)));
+    }
+  } else {
+    // 2-bit output
+    for (int x = 0; x < outWidth_; x++) {
+      const int adjusted = adjustPixel(gray[x]);
+      const uint8_t twoBit =
+          floydSteinberg_ ? floydSteinberg_->processPixel(adjusted, x) : quantize(adjusted, x, outY_);
+      rowBuffer_[(x * 2) / 8] |= (twoBit << (6 - ((x * 2) % 8)));
+    }
+    if (floydSteinberg_) floydSteinberg_->nextRow();
+  }
+
+  spec_.out->write(rowBuffer_, bytesPerRow_);
+  outY_++;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+
+class Print;
+class AtkinsonDitherer;
+class Atkinson1BitDitherer;
+class FloydSteinbergDitherer;
+
+// Maximum number of BMP outputs a single image decode can feed
+// (full cover, quick preview and home screen thumbnail)
+constexpr int MAX_BMP_OUTPUTS = 3;
+
+// Description of one BMP produced by a streaming image conversion
+struct BmpOutputSpec {
+  Print* out = nullptr;
+  int maxWidth = 0;   // <= 0 means no size limit
+  int maxHeight = 0;  // <= 0 means no size limit
+  bool oneBit = false;
+  bool quickMode = false;  // Simple threshold instead of dithering
+};
+
+// Streams full-resolution grayscale source rows into one BMP output.
+// Rows are area-averaged down to fit the target box (contain mode), adjusted for
+// e-ink contrast, dithered and packed. Each writer owns its own accumulators and
+// ditherer, so several writers can be fed from the same decoder pass to produce
+// a cover and its thumbnail without decoding the source image twice.
+class ScaledBmpWriter {
+ public:
+  ScaledBmpWriter() = default;
+  ~ScaledBmpWriter();
+
+  ScaledBmpWriter(const ScaledBmpWriter&) = delete;
+  ScaledBmpWriter& operator=(const ScaledBmpWriter&) = delete;
+
+  // Compute output size, allocate row state and write the BMP header.
+  // Returns false on allocation failure (nothing is written in that case).
+  bool begin(const BmpOutputSpec& spec, int srcWidth, int srcHeight);
+
+  // Feed the next source row (srcWidth grayscale pixels, 0 = black).
+  // Emits zero or one output rows depending on the vertical scale.
+  void pushRow(const uint8_t* srcRow);
+
+  int outWidth() const { return outWidth_; }
+  int outHeight() const { return outHeight_; }
+  int rowsWritten() const { return outY_; }
+
+ private:
+  void emitRow(const uint8_t* gray);
+  void release();
+
+  BmpOutputSpec spec_;
+  int srcWidth_ = 0;
+  int outWidth_ = 0;
+  int outHeight_ = 0;
+  int bytesPerRow_ = 0;
+  bool needsScaling_ = false;
+  uint32_t scaleX_fp_ = 65536;  // Source pixels per output pixel (16.16 fixed point)
+  uint32_t scaleY_fp_ = 65536;
+  int srcY_ = 0;
+  int outY_ = 0;
+  uint32_t nextOutY_srcStart_ = 0;
+
+  uint8_t* rowBuffer_ = nullptr;  // Packed output row
+  uint8_t* grayRow_ = nullptr;    // Averaged output row (scaling only)
+  uint32_t* rowAccum_ = nullptr;  // Per-output-column pixel sums (scaling only)
+  uint16_t* rowCount_ = nullptr;  // Per-output-column pixel counts (scaling only)
+  AtkinsonDitherer* atkinson_ = nullptr;
+  FloydSteinbergDitherer* floydSteinberg_ = nullptr;
+  Atkinson1BitDitherer* atkinson1Bit_ = nullptr;
+};
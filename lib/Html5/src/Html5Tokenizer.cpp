@@ -0,0 +1,652 @@
+#include "Html5Tokenizer.h"
+
+#include <cstring>
+
+namespace html5 {
+
+namespace {
+
+// HTML5 void elements that cannot have closing tags
+constexpr const char* VOID_ELEMENTS[] = {"img",  "br",  "hr",    "input", "meta",   "link",  "area",
+                                         "base", "col", "embed", "param", "source", "track", "wbr"};
+
+// Elements whose start tag closes an open element of the same name
+constexpr const char* SELF_NESTING_CLOSERS[] = {"p", "li", "dt", "dd", "option", "tr", "td", "th"};
+
+// Elements whose content is not markup and not book text
+constexpr const char* RAW_TEXT_ELEMENTS[] = {"script", "style"};
+
+template <size_t N>
+bool isOneOf(const char* name, const char* const (&list)[N]) {
+  for (const char* entry : list) {
+    if (strcmp(name, entry) == 0) return true;
+  }
+  return false;
+}
+
+bool isSpace(const char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f'; }
+bool isAlpha(const char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+bool isAlnum(const char c) { return isAlpha(c) || (c >= '0' && c <= '9'); }
+char toLowerAscii(const char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+size_t encodeUtf8(uint32_t cp, char* out) {
+  // NUL, surrogates and out-of-range code points become U+FFFD
+  if (cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) cp = 0xFFFD;
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (cp >> 6));
+    out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (cp >> 12));
+    out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (cp >> 18));
+  out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+}  // namespace
+
+Tokenizer::Tokenizer(const Handlers& handlers) : handlers_(handlers) {}
+
+void Tokenizer::reset() {
+  state_ = State::Data;
+  stopped_ = false;
+  aborted_ = false;
+  tagNameLen_ = 0;
+  attrPoolLen_ = 0;
+  attrCount_ = 0;
+  refLen_ = 0;
+  declLen_ = 0;
+  dashes_ = 0;
+  rawMatch_ = 0;
+  stackPoolLen_ = 0;
+  depth_ = 0;
+  closeTo_ = -1;
+  pendingStart_ = false;
+  pendingEnd_ = false;
+}
+
+void Tokenizer::text(const char* s, const size_t len) {
+  if (len > 0 && handlers_.characterData) {
+    handlers_.characterData(handlers_.userData, s, static_cast<int>(len));
+  }
+}
+
+bool Tokenizer::drain() {
+  while (closeTo_ >= 0 && depth_ > closeTo_) {
+    depth_--;
+    const uint16_t offset = stackOffsets_[depth_];
+    if (offset < stackPoolLen_) stackPoolLen_ = offset;
+    if (handlers_.endElement) handlers_.endElement(handlers_.userData, stackPool_ + offset);
+    if (stopped_) return false;
+  }
+  closeTo_ = -1;
+
+  if (pendingStart_) {
+    pendingStart_ = false;
+    if (!pendingEnd_) pushElement(tagName_, tagNameLen_);
+    if (handlers_.startElement) handlers_.startElement(handlers_.userData, tagName_, atts_);
+    if (stopped_) return false;
+  }
+
+  if (pendingEnd_) {
+    pendingEnd_ = false;
+    if (handlers_.endElement) handlers_.endElement(handlers_.userData, tagName_);
+    if (stopped_) return false;
+  }
+  return true;
+}
+
+void Tokenizer::pushElement(const char* name, const size_t len) {
+  // Names that don't fit the pool share the terminating '\0' at its end
+  const size_t needed = len + 1;
+  if (stackPoolLen_ + needed < STACK_POOL_SIZE) {
+    stackOffsets_[depth_] = stackPoolLen_;
+    memcpy(stackPool_ + stackPoolLen_, name, len);
+    stackPool_[stackPoolLen_ + len] = '\0';
+    stackPoolLen_ += needed;
+  } else {
+    stackOffsets_[depth_] = STACK_POOL_SIZE - 1;
+  }
+  depth_++;
+}
+
+void Tokenizer::pushOpenElement(const char* name) {
+  if (depth_ >= MAX_DEPTH) return;
+  size_t len = strlen(name);
+  if (len > MAX_NAME_LENGTH) len = MAX_NAME_LENGTH;
+  pushElement(name, len);
+}
+
+void Tokenizer::beginTag() {
+  tagNameLen_ = 0;
+  tagName_[0] = '\0';
+  attrPoolLen_ = 0;
+  attrCount_ = 0;
+  atts_[0] = nullptr;
+}
+
+void Tokenizer::beginAttr() {
+  // Needs room for at least the name and value terminators
+  attrDropped_ = attrCount_ >= MAX_ATTRS || attrPoolLen_ + 2 > ATTR_POOL_SIZE;
+  if (!attrDropped_) {
+    atts_[attrCount_ * 2] = attrPool_ + attrPoolLen_;
+  }
+}
+
+void Tokenizer::attrNameChar(const char c) {
+  // Keep room for both terminators
+  if (!attrDropped_ && attrPoolLen_ + 2 < ATTR_POOL_SIZE) {
+    attrPool_[attrPoolLen_++] = toLowerAscii(c);
+  }
+}
+
+void Tokenizer::endAttrName() {
+  if (attrDropped_) return;
+  attrPool_[attrPoolLen_++] = '\0';
+  atts_[attrCount_ * 2 + 1] = attrPool_ + attrPoolLen_;
+}
+
+void Tokenizer::attrValueChars(const char* s, size_t len) {
+  if (attrDropped_) return;
+  // Keep room for the value terminator
+  const size_t room = ATTR_POOL_SIZE - 1 - attrPoolLen_;
+  if (len > room) len = room;
+  memcpy(attrPool_ + attrPoolLen_, s, len);
+  attrPoolLen_ += len;
+}
+
+void Tokenizer::commitAttr() {
+  if (attrDropped_) return;
+  char* value = const_cast<char*>(atts_[attrCount_ * 2 + 1]);
+  const size_t valueLen = attrPool_ + attrPoolLen_ - value;
+  attrPoolLen_ = (value - attrPool_) + decodeRefsInPlace(value, valueLen);
+  attrPool_[attrPoolLen_++] = '\0';
+  attrCount_++;
+  atts_[attrCount_ * 2] = nullptr;
+  attrDropped_ = true;  // Until the next beginAttr()
+}
+
+void Tokenizer::completeStartTag(const bool selfClosing) {
+  atts_[attrCount_ * 2] = nullptr;
+
+  int depthAfterClose = depth_;
+  if (depth_ > 0 && isOneOf(tagName_, SELF_NESTING_CLOSERS) &&
+      strcmp(stackPool_ + stackOffsets_[depth_ - 1], tagName_) == 0) {
+    closeTo_ = depth_ - 1;
+    depthAfterClose = closeTo_;
+  }
+
+  const bool empty = selfClosing || isOneOf(tagName_, VOID_ELEMENTS) || depthAfterClose >= MAX_DEPTH;
+  pendingStart_ = true;
+  pendingEnd_ = empty;
+  if (!empty && isOneOf(tagName_, RAW_TEXT_ELEMENTS)) {
+    state_ = State::RawText;
+    rawMatch_ = 0;
+  } else {
+    state_ = State::Data;
+  }
+}
+
+void Tokenizer::completeEndTag() {
+  state_ = State::Data;
+  for (int i = depth_ - 1; i >= 0; i--) {
+    if (strcmp(stackPool_ + stackOffsets_[i], tagName_) == 0) {
+      closeTo_ = i;
+      return;
+    }
+  }
+  // No matching open element: ignore
+}
+
+const char* Tokenizer::resolveRef(const char* name, const size_t len, char* scratch, size_t* outLen) const {
+  if (len >= 2 && name[0] == '#') {
+    uint32_t cp = 0;
+    const bool hex = name[1] == 'x' || name[1] == 'X';
+    size_t i = hex ? 2 : 1;
+    if (i == len) return nullptr;
+    for (; i < len; i++) {
+      const char c = name[i];
+      uint32_t digit;
+      if (c >= '0' && c <= '9') {
+        digit = c - '0';
+      } else if (hex && toLowerAscii(c) >= 'a' && toLowerAscii(c) <= 'f') {
+        digit = toLowerAscii(c) - 'a' + 10;
+      } else {
+        return nullptr;
+      }
+      cp = cp * (hex ? 16 : 10) + digit;
+      if (cp > 0x10FFFF) cp = 0x110000;  // Saturate; encodeUtf8 maps it to U+FFFD
+    }
+    *outLen = encodeUtf8(cp, scratch);
+    return scratch;
+  }
+
+  struct XmlEntity {
+    const char* name;
+    const char* utf8;
+  };
+  static constexpr XmlEntity XML_ENTITIES[] = {{"amp", "&"}, {"lt", "<"}, {"gt", ">"}, {"quot", "\""}, {"apos", "'"}};
+  for (const auto& entity : XML_ENTITIES) {
+    if (strlen(entity.name) == len && memcmp(entity.name, name, len) == 0) {
+      *outLen = 1;
+      return entity.utf8;
+    }
+  }
+
+  if (handlers_.lookupEntity) {
+    const char* utf8 = handlers_.lookupEntity(name, static_cast<int>(len));
+    if (utf8) {
+      *outLen = strlen(utf8);
+      return utf8;
+    }
+  }
+  return nullptr;
+}
+
+void Tokenizer::flushRef(const bool terminated) {
+  char scratch[4];
+  size_t outLen = 0;
+  const char* utf8 = terminated ? resolveRef(ref_ + 1, refLen_ - 1, scratch, &outLen) : nullptr;
+  if (utf8) {
+    text(utf8, outLen);
+    return;
+  }
+  // Not a reference we know: keep it as written
+  if (terminated) ref_[refLen_++] = ';';
+  text(ref_, refLen_);
+}
+
+size_t Tokenizer::decodeRefsInPlace(char* s, const size_t len) const {
+  size_t out = 0;
+  for (size_t i = 0; i < len;) {
+    if (s[i] == '&') {
+      size_t end = i + 1;
+      while (end < len && end - i <= MAX_NAME_LENGTH && (isAlnum(s[end]) || s[end] == '#')) end++;
+      if (end < len && s[end] == ';') {
+        char scratch[4];
+        size_t outLen = 0;
+        const char* utf8 = resolveRef(s + i + 1, end - i - 1, scratch, &outLen);
+        // Decoded text is never longer than the reference (checked anyway)
+        if (utf8 && outLen <= end + 1 - i) {
+          memmove(s + out, utf8, outLen);
+          out += outLen;
+          i = end + 1;
+          continue;
+        }
+      }
+    }
+    s[out++] = s[i++];
+  }
+  return out;
+}
+
+size_t Tokenizer::feed(const char* data, const size_t len) {
+  if (aborted_) return len;
+  stopped_ = false;
+  if (!drain()) return 0;
+
+  size_t i = 0;
+  while (i < len) {
+    const char c = data[i];
+    switch (state_) {
+      case State::Data: {
+        size_t end = i;
+        while (end < len && data[end] != '<' && data[end] != '&') end++;
+        if (end > i) {
+          text(data + i, end - i);
+          i = end;
+          if (stopped_) return i;
+          break;
+        }
+        if (c == '<') {
+          state_ = State::TagOpen;
+        } else {
+          state_ = State::CharRef;
+          ref_[0] = '&';
+          refLen_ = 1;
+        }
+        i++;
+        break;
+      }
+
+      case State::CharRef:
+        if (c == ';') {
+          i++;
+          state_ = State::Data;
+          flushRef(true);
+          if (stopped_) return i;
+        } else if ((isAlnum(c) || (c == '#' && refLen_ == 1)) && refLen_ <= MAX_NAME_LENGTH) {
+          ref_[refLen_++] = c;
+          i++;
+        } else {
+          // Not a reference: the '&' and what followed are text; reprocess c
+          state_ = State::Data;
+          flushRef(false);
+          if (stopped_) return i;
+        }
+        break;
+
+      case State::TagOpen:
+        if (c == '/') {
+          state_ = State::EndTagOpen;
+          i++;
+        } else if (c == '!') {
+          state_ = State::MarkupDecl;
+          declLen_ = 0;
+          i++;
+        } else if (c == '?') {
+          state_ = State::BogusComment;
+          i++;
+        } else if (isAlpha(c)) {
+          beginTag();
+          state_ = State::TagName;
+        } else {
+          // A lone '<' is text; reprocess c
+          state_ = State::Data;
+          text("<", 1);
+          if (stopped_) return i;
+        }
+        break;
+
+      case State::TagName:
+        i++;
+        if (isSpace(c)) {
+          state_ = State::BeforeAttrName;
+        } else if (c == '/') {
+          state_ = State::SelfClosing;
+        } else if (c == '>') {
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else if (tagNameLen_ < MAX_NAME_LENGTH) {
+          tagName_[tagNameLen_++] = toLowerAscii(c);
+          tagName_[tagNameLen_] = '\0';
+        }
+        break;
+
+      case State::BeforeAttrName:
+        if (isSpace(c)) {
+          i++;
+        } else if (c == '/') {
+          state_ = State::SelfClosing;
+          i++;
+        } else if (c == '>') {
+          i++;
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else {
+          beginAttr();
+          state_ = State::AttrName;
+          // '=' can't start a name, so consume it here
+          if (c == '=') {
+            attrNameChar(c);
+            i++;
+          }
+        }
+        break;
+
+      case State::AttrName:
+        i++;
+        if (isSpace(c)) {
+          endAttrName();
+          state_ = State::AfterAttrName;
+        } else if (c == '=') {
+          endAttrName();
+          state_ = State::BeforeAttrValue;
+        } else if (c == '/') {
+          endAttrName();
+          commitAttr();
+          state_ = State::SelfClosing;
+        } else if (c == '>') {
+          endAttrName();
+          commitAttr();
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else {
+          attrNameChar(c);
+        }
+        break;
+
+      case State::AfterAttrName:
+        if (isSpace(c)) {
+          i++;
+        } else if (c == '=') {
+          state_ = State::BeforeAttrValue;
+          i++;
+        } else if (c == '/') {
+          commitAttr();
+          state_ = State::SelfClosing;
+          i++;
+        } else if (c == '>') {
+          i++;
+          commitAttr();
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else {
+          // Attribute without a value; c starts the next one
+          commitAttr();
+          beginAttr();
+          state_ = State::AttrName;
+        }
+        break;
+
+      case State::BeforeAttrValue:
+        if (isSpace(c)) {
+          i++;
+        } else if (c == '"' || c == '\'') {
+          quote_ = c;
+          state_ = State::AttrValueQuoted;
+          i++;
+        } else if (c == '>') {
+          i++;
+          commitAttr();
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else {
+          state_ = State::AttrValueUnquoted;
+        }
+        break;
+
+      case State::AttrValueQuoted: {
+        const char* quote = static_cast<const char*>(memchr(data + i, quote_, len - i));
+        const size_t end = quote ? quote - data : len;
+        attrValueChars(data + i, end - i);
+        i = end;
+        if (quote) {
+          commitAttr();
+          state_ = State::BeforeAttrName;
+          i++;
+        }
+        break;
+      }
+
+      case State::AttrValueUnquoted:
+        i++;
+        if (isSpace(c)) {
+          commitAttr();
+          state_ = State::BeforeAttrName;
+        } else if (c == '>') {
+          commitAttr();
+          completeStartTag(false);
+          if (!drain()) return i;
+        } else {
+          attrValueChars(&c, 1);
+        }
+        break;
+
+      case State::SelfClosing:
+        if (c == '>') {
+          i++;
+          completeStartTag(true);
+          if (!drain()) return i;
+        } else {
+          // Stray '/' inside the tag; reprocess c
+          state_ = State::BeforeAttrName;
+        }
+        break;
+
+      case State::EndTagOpen:
+        if (isAlpha(c)) {
+          tagNameLen_ = 0;
+          tagName_[0] = '\0';
+          state_ = State::EndTagName;
+        } else if (c == '>') {
+          state_ = State::Data;  // "</>" is ignored
+          i++;
+        } else {
+          state_ = State::BogusComment;
+        }
+        break;
+
+      case State::EndTagName:
+        i++;
+        if (c == '>') {
+          completeEndTag();
+          if (!drain()) return i;
+        } else if (isSpace(c) || c == '/') {
+          state_ = State::EndTagRest;
+        } else if (tagNameLen_ < MAX_NAME_LENGTH) {
+          tagName_[tagNameLen_++] = toLowerAscii(c);
+          tagName_[tagNameLen_] = '\0';
+        }
+        break;
+
+      case State::EndTagRest:
+        i++;
+        if (c == '>') {
+          completeEndTag();
+          if (!drain()) return i;
+        }
+        break;
+
+      case State::MarkupDecl: {
+        i++;
+        decl_[declLen_++] = c;
+        if (declLen_ == 2 && decl_[0] == '-' && c == '-') {
+          state_ = State::Comment;
+          dashes_ = 0;
+          break;
+        }
+        const bool cdataPrefix = memcmp(decl_, "[CDATA[", declLen_) == 0;
+        if (cdataPrefix && declLen_ == 7) {
+          state_ = State::CData;
+          dashes_ = 0;
+        } else if (!cdataPrefix && !(declLen_ == 1 && c == '-')) {
+          // <!DOCTYPE ...> and other declarations
+          state_ = c == '>' ? State::Data : State::BogusComment;
+        }
+        break;
+      }
+
+      case State::Comment:
+        i++;
+        if (c == '-') {
+          dashes_++;
+        } else if (c == '>' && dashes_ >= 2) {
+          state_ = State::Data;
+        } else {
+          dashes_ = 0;
+        }
+        break;
+
+      case State::BogusComment: {
+        const char* gt = static_cast<const char*>(memchr(data + i, '>', len - i));
+        if (!gt) return len;
+        i = gt - data + 1;
+        state_ = State::Data;
+        break;
+      }
+
+      case State::CData:
+        if (c == ']') {
+          i++;
+          if (++dashes_ > 2) {
+            dashes_ = 2;
+            text("]", 1);
+            if (stopped_) return i;
+          }
+        } else if (c == '>' && dashes_ >= 2) {
+          i++;
+          dashes_ = 0;
+          state_ = State::Data;
+        } else if (dashes_ > 0) {
+          // Brackets that didn't end the section are text; reprocess c
+          text("]]", dashes_);
+          dashes_ = 0;
+          if (stopped_) return i;
+        } else {
+          size_t end = i;
+          while (end < len && data[end] != ']') end++;
+          text(data + i, end - i);
+          i = end;
+          if (stopped_) return i;
+        }
+        break;
+
+      case State::RawText:
+        // Skip until "</name" followed by a delimiter; tagName_ still holds the element name
+        if (rawMatch_ == 0) {
+          const char* lt = static_cast<const char*>(memchr(data + i, '<', len - i));
+          if (!lt) return len;
+          i = lt - data + 1;
+          rawMatch_ = 1;
+        } else if (rawMatch_ == 1) {
+          if (c == '/') {
+            rawMatch_ = 2;
+            i++;
+          } else {
+            rawMatch_ = 0;
+          }
+        } else if (rawMatch_ < 2 + tagNameLen_) {
+          if (toLowerAscii(c) == tagName_[rawMatch_ - 2]) {
+            rawMatch_++;
+            i++;
+          } else {
+            rawMatch_ = 0;
+          }
+        } else {
+          rawMatch_ = 0;
+          if (isSpace(c) || c == '/' || c == '>') {
+            state_ = State::EndTagRest;
+          }
+        }
+        break;
+    }
+  }
+  return len;
+}
+
+void Tokenizer::finish() {
+  if (aborted_) return;
+  stopped_ = false;
+  if (!drain()) return;
+
+  // A reference or CDATA brackets cut off by the end of input are text
+  if (state_ == State::CharRef) {
+    state_ = State::Data;
+    flushRef(false);
+    if (stopped_) return;
+  } else if (state_ == State::CData && dashes_ > 0) {
+    const uint8_t brackets = dashes_;
+    dashes_ = 0;
+    text("]]", brackets);
+    if (stopped_) return;
+  }
+  // Unterminated tags are dropped
+  state_ = State::Data;
+
+  closeTo_ = 0;
+  drain();
+}
+
+}  // namespace html5
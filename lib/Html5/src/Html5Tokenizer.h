@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace html5 {
+
+// Streaming HTML tokenizer for chapter content
+//
+// Takes the document in chunks of any size and reports elements and text through Expat-style
+// callbacks, so handlers written for XML_SetElementHandler can be driven unchanged. Built for
+// what the reader needs rather than full HTML5 conformance:
+// - Tag and attribute names are lowercased; attribute values may be quoted, unquoted or missing
+// - Void elements (<br>, <img>, ...) and self-closing tags report start and end back to back
+// - An end tag closes every element opened after its start tag, stray end tags are ignored and
+//   finish() closes whatever is still open, so starts and ends always pair up
+// - <p>, <li> and the like close an open sibling of the same name, as HTML5 implies
+// - The XML entities and numeric references are decoded; other named references go through
+//   lookupEntity and stay literal text when it doesn't know them (so does a bare '&')
+// - Comments, doctype, processing instructions and script/style content are dropped; CDATA
+//   sections are text
+//
+// Nothing is allocated: names, attributes and the open element stack live in fixed buffers.
+// Overlong names and values are truncated, attributes past MAX_ATTRS dropped, and elements
+// nested deeper than MAX_DEPTH are reported as empty.
+//
+// A callback may call stop() to suspend. feed() then returns how much input it consumed; feeding
+// the rest later continues exactly where it stopped.
+class Tokenizer {
+ public:
+  using StartElementHandler = void (*)(void* userData, const char* name, const char** atts);
+  using EndElementHandler = void (*)(void* userData, const char* name);
+  using CharacterDataHandler = void (*)(void* userData, const char* s, int len);
+  // Returns the UTF-8 text for a named reference (name without '&' and ';'), or nullptr
+  using EntityLookup = const char* (*)(const char* name, int nameLen);
+
+  struct Handlers {
+    void* userData;
+    StartElementHandler startElement;
+    EndElementHandler endElement;
+    CharacterDataHandler characterData;
+    EntityLookup lookupEntity;  // Optional
+  };
+
+  static constexpr int MAX_DEPTH = 128;
+  static constexpr int MAX_ATTRS = 16;
+  static constexpr size_t MAX_NAME_LENGTH = 31;
+  static constexpr size_t ATTR_POOL_SIZE = 1024;
+  static constexpr size_t STACK_POOL_SIZE = 512;
+
+  explicit Tokenizer(const Handlers& handlers);
+
+  // Start over with a new document
+  void reset();
+
+  // Tokenize the next chunk. Returns the number of bytes consumed, which is less than len only
+  // when a callback called stop() or abort().
+  size_t feed(const char* data, size_t len);
+
+  // End of input: flushes a trailing reference and closes all open elements. Call again after
+  // a suspend to finish closing.
+  void finish();
+
+  // Suspend after the current callback returns (resumable)
+  void stop() { stopped_ = true; }
+  // Stop for good; feed() and finish() ignore further input
+  void abort() {
+    stopped_ = true;
+    aborted_ = true;
+  }
+  bool suspended() const { return stopped_ && !aborted_; }
+  bool aborted() const { return aborted_; }
+  int depth() const { return depth_; }
+
+  // Between tokens in text with no events pending: the input position alone says where to
+  // continue, so a fresh tokenizer given the open elements below picks up from there
+  bool idle() const {
+    return state_ == State::Data && closeTo_ < 0 && !pendingStart_ && !pendingEnd_ && !aborted_;
+  }
+  // Name of the open element at depth i (0 = outermost)
+  const char* openElement(int i) const { return stackPool_ + stackOffsets_[i]; }
+  // Restore an open element on a fresh tokenizer, as if its start tag had been read
+  void pushOpenElement(const char* name);
+
+ private:
+  enum class State : uint8_t {
+    Data,
+    CharRef,
+    TagOpen,
+    TagName,
+    BeforeAttrName,
+    AttrName,
+    AfterAttrName,
+    BeforeAttrValue,
+    AttrValueQuoted,
+    AttrValueUnquoted,
+    SelfClosing,
+    EndTagOpen,
+    EndTagName,
+    EndTagRest,
+    MarkupDecl,
+    Comment,
+    BogusComment,
+    CData,
+    RawText
+  };
+
+  Handlers handlers_;
+  State state_ = State::Data;
+  bool stopped_ = false;
+  bool aborted_ = false;
+
+  // Tag being parsed (start or end)
+  char tagName_[MAX_NAME_LENGTH + 1] = {};
+  uint8_t tagNameLen_ = 0;
+
+  // Attributes of the start tag being parsed: names and values back to back in the pool
+  char attrPool_[ATTR_POOL_SIZE] = {};
+  size_t attrPoolLen_ = 0;
+  const char* atts_[MAX_ATTRS * 2 + 1] = {};
+  uint8_t attrCount_ = 0;
+  bool attrDropped_ = false;
+  char quote_ = 0;
+
+  // Character reference being parsed, including the leading '&' (room for a trailing ';')
+  char ref_[MAX_NAME_LENGTH + 3] = {};
+  uint8_t refLen_ = 0;
+
+  // "<!" lookahead, and the run of '-' / ']' seen while looking for the end of a comment / CDATA
+  char decl_[8] = {};
+  uint8_t declLen_ = 0;
+  uint8_t dashes_ = 0;
+  // Characters of "</name" matched inside script/style
+  uint8_t rawMatch_ = 0;
+
+  // Open elements; the last pool byte stays '\0' for names that don't fit
+  char stackPool_[STACK_POOL_SIZE] = {};
+  uint16_t stackPoolLen_ = 0;
+  uint16_t stackOffsets_[MAX_DEPTH] = {};
+  int depth_ = 0;
+
+  // Events decided but not yet reported (a callback may stop between any two)
+  int closeTo_ = -1;  // Pop elements until depth == closeTo_
+  bool pendingStart_ = false;
+  bool pendingEnd_ = false;
+
+  bool drain();
+  void pushElement(const char* name, size_t len);
+  void text(const char* s, size_t len);
+  void beginTag();
+  void beginAttr();
+  void attrNameChar(char c);
+  void endAttrName();
+  void attrValueChars(const char* s, size_t len);
+  void commitAttr();
+  void completeStartTag(bool selfClosing);
+  void completeEndTag();
+  void flushRef(bool terminated);
+  const char* resolveRef(const char* name, size_t len, char* scratch, size_t* outLen) const;
+  size_t decodeRefsInPlace(char* s, size_t len) const;
+};
+
+}  // namespace html5
@@ -1,17 +1,17 @@
 #include "Hyphenation.h"
 
-#include "Hyphenator.h"
-
 namespace Hyphenation {
 
+size_t breakOffsets(const std::string& word, const bool includeFallback, BreakInfo* out, const size_t capacity) {
+  return Hyphenator::breakOffsets(word, includeFallback, out, capacity);
+}
+
+size_t breakOffsets(const std::string& word, const bool includeFallback, const BreakInfo*& breaks) {
+  return Hyphenator::breakOffsets(word, includeFallback, breaks);
+}
+
 std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback) {
-  auto internalBreaks = Hyphenator::breakOffsets(word, includeFallback);
-  std::vector<BreakInfo> result;
-  result.reserve(internalBreaks.size());
-  for (const auto& b : internalBreaks) {
-    result.push_back({b.byteOffset, b.requiresInsertedHyphen});
-  }
-  return result;
+  return Hyphenator::breakOffsets(word, includeFallback);
 }
 
 void setLanguage(const std::string& lang) { Hyphenator::setPreferredLanguage(lang); }
@@ -4,13 +4,20 @@
 #include <string>
 #include <vector>
 
+#include "Hyphenator.h"
+
 namespace Hyphenation {
 
-struct BreakInfo {
-  size_t byteOffset;
-  bool requiresInsertedHyphen;
-};
+using BreakInfo = Hyphenator::BreakInfo;
+
+// Room for every break of the longest word that is hyphenated
+constexpr size_t kMaxBreaks = Hyphenator::kMaxWordCodepoints;
 
+// Writes the breaks of word to out, in ascending order, and returns how many (at most capacity).
+// Allocates nothing, and words seen earlier in the chapter are answered from a memo.
+size_t breakOffsets(const std::string& word, bool includeFallback, BreakInfo* out, size_t capacity);
+// Same, into the hyphenator's own buffer (breaks points to it), valid until the next call
+size_t breakOffsets(const std::string& word, bool includeFallback, const BreakInfo*& breaks);
 std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
 void setLanguage(const std::string& lang);
 
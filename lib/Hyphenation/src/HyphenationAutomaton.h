@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// A language's Liang patterns as an Aho-Corasick automaton, generated from the hypher trie by
+// scripts/update-hyphenation.mjs. One pass over a word finds every pattern in it.
+//
+// States are numbered breadth-first, so the children of state s are the states firstChild(s) up to
+// firstChild(s + 1), sorted by label. The first denseStates states (the root and the shortest
+// prefixes, which every word passes through) have a row in dense giving the next state for every
+// symbol, with failure links already followed. The tables are in flash, so they are kept narrow:
+// about six bytes a state.
+struct HyphenationAutomaton {
+  const uint8_t* symbols;  // Byte -> symbol; 0 for bytes no pattern contains
+  size_t symbolCount;      // Including 0
+  size_t denseStates;
+  const uint16_t* dense;  // denseStates rows of symbolCount next states
+  size_t stateCount;
+  const uint8_t* label;         // Symbol on the edge into each state
+  size_t childBlockShift;       // States share a childBase entry in blocks of 1 << childBlockShift
+  const uint16_t* childBase;    // First child of the first state of each block
+  const uint8_t* childOffset;   // stateCount + 1 entries: first child, less the block's base
+  const uint16_t* fail;         // Longest proper suffix that is also a state
+  const uint16_t* levels;       // (offset << 4) | count into levelData; 0 if no pattern ends here
+  const uint8_t* levelData;     // Per pattern: its length in bytes, then its levels as distance * 10 + level
+
+  size_t firstChild(const size_t state) const { return childBase[state >> childBlockShift] + childOffset[state]; }
+};
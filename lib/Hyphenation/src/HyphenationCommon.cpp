@@ -2,8 +2,6 @@
 
 #include <Utf8.h>
 
-#include <algorithm>
-
 namespace {
 
 uint32_t toLowerLatinImpl(const uint32_t cp) {
@@ -133,37 +131,40 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
-  if (cps.empty()) {
-    return;
-  }
-
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo* cps, size_t& begin, size_t& end) {
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
-    while (end >= 0 && isPunctuation(cps[end].value)) {
-      --end;
+  if (end - begin >= 3) {
+    size_t last = end;
+    while (last > begin && isPunctuation(cps[last - 1].value)) {
+      --last;
     }
-    int pos = end;
-    if (pos >= 0 && isAsciiDigit(cps[pos].value)) {
-      while (pos >= 0 && isAsciiDigit(cps[pos].value)) {
+    size_t pos = last;
+    if (pos > begin && isAsciiDigit(cps[pos - 1].value)) {
+      while (pos > begin && isAsciiDigit(cps[pos - 1].value)) {
         --pos;
       }
-      if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+      if (pos > begin && cps[pos - 1].value == '[' && last - pos > 1) {
+        end = pos - 1;
       }
     }
   }
 
-  {
-    auto first = std::find_if(cps.begin(), cps.end(), [](const CodepointInfo& c) { return !isPunctuation(c.value); });
-    cps.erase(cps.begin(), first);
+  while (begin < end && isPunctuation(cps[begin].value)) {
+    ++begin;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+  while (end > begin && isPunctuation(cps[end - 1].value)) {
+    --end;
   }
 }
 
+void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+  size_t begin = 0;
+  size_t end = cps.size();
+  trimSurroundingPunctuationAndFootnote(cps.data(), begin, end);
+  cps.erase(cps.begin() + end, cps.end());
+  cps.erase(cps.begin(), cps.begin() + begin);
+}
+
 namespace {
 
 uint32_t composeNfc(const uint32_t base, const uint32_t combining) {
@@ -220,26 +221,34 @@ uint32_t composeNfc(const uint32_t base, const uint32_t combining) {
 
 }  // namespace
 
-std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
-  std::vector<CodepointInfo> cps;
-  cps.reserve(word.size());
-
+size_t collectCodepoints(const std::string& word, CodepointInfo* out, const size_t capacity) {
+  size_t count = 0;
   const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
   const unsigned char* ptr = base;
   while (*ptr != 0) {
     const unsigned char* current = ptr;
     const uint32_t cp = utf8NextCodepoint(&ptr);
 
-    if (!cps.empty() && cp >= 0x0300 && cp <= 0x036F) {
-      const uint32_t composed = composeNfc(cps.back().value, cp);
+    if (count > 0 && cp >= 0x0300 && cp <= 0x036F) {
+      const uint32_t composed = composeNfc(out[count - 1].value, cp);
       if (composed != 0) {
-        cps.back().value = composed;
+        out[count - 1].value = composed;
         continue;
       }
     }
 
-    cps.push_back({cp, static_cast<size_t>(current - base)});
+    if (count == capacity) {
+      return capacity + 1;
+    }
+    out[count++] = {cp, static_cast<size_t>(current - base)};
   }
 
+  return count;
+}
+
+std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
+  // A codepoint takes at least one byte, so the word always fits
+  std::vector<CodepointInfo> cps(word.size());
+  cps.resize(collectCodepoints(word, cps.data(), cps.size()));
   return cps;
 }
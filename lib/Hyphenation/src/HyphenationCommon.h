@@ -23,3 +23,8 @@ bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
 void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
 std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+
+// Allocation-free forms of the two above. collectCodepoints() fills out and returns the count, or
+// capacity + 1 if the word has more codepoints than fit; the trim narrows [begin, end) instead of erasing.
+size_t collectCodepoints(const std::string& word, CodepointInfo* out, size_t capacity);
+void trimSurroundingPunctuationAndFootnote(const CodepointInfo* cps, size_t& begin, size_t& end);
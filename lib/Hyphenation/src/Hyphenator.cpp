@@ -1,7 +1,8 @@
 #include "Hyphenator.h"
 
 #include <algorithm>
-#include <vector>
+#include <cstdint>
+#include <cstring>
 
 #include "HyphenationCommon.h"
 #include "LanguageHyphenator.h"
@@ -26,90 +27,164 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
+size_t byteOffsetForIndex(const CodepointInfo* cps, const size_t count, const size_t index) {
+  return (index < count) ? cps[index].byteOffset : (count == 0 ? 0 : cps[count - 1].byteOffset);
 }
 
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
-
-  for (size_t i = 1; i + 1 < cps.size(); ++i) {
-    const uint32_t cp = cps[i].value;
-    if (!isExplicitHyphen(cp) || !isAlphabetic(cps[i - 1].value) || !isAlphabetic(cps[i + 1].value)) {
-      continue;
-    }
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
-  }
-
-  return breaks;
+// A hyphen between two letters, which the word may break after
+bool isExplicitBreak(const CodepointInfo* cps, const size_t count, const size_t i) {
+  return i >= 1 && i + 1 < count && isExplicitHyphen(cps[i].value) && isAlphabetic(cps[i - 1].value) &&
+         isAlphabetic(cps[i + 1].value);
 }
 
-}  // namespace
+// Codepoints of the word being hyphenated. Hyphenation runs on one task at a time (the language is
+// global state too), so they live here rather than on the layout task's stack.
+CodepointInfo wordCodepoints[Hyphenator::kMaxWordCodepoints];
 
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
+size_t computeBreakOffsets(const LanguageHyphenator* hyphenator, const std::string& word, const bool includeFallback,
+                           Hyphenator::BreakInfo* out, const size_t capacity) {
+  const size_t total = collectCodepoints(word, wordCodepoints, Hyphenator::kMaxWordCodepoints);
+  if (total > Hyphenator::kMaxWordCodepoints) {
+    return 0;
   }
-
-  auto cps = collectCodepoints(word);
-  trimSurroundingPunctuationAndFootnote(cps);
-  const auto* hyphenator = cachedHyphenator_;
-
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
-    if (hyphenator) {
-      // Also run language patterns on alphabetic segments between explicit hyphens
-      std::vector<Hyphenator::BreakInfo> merged = explicitBreakInfos;
-      size_t segStart = 0;
-      for (size_t i = 0; i <= cps.size(); ++i) {
-        const bool atEnd = (i == cps.size());
-        const bool atHyphen = !atEnd && isExplicitHyphen(cps[i].value);
-        if (atEnd || atHyphen) {
-          if (i > segStart) {
-            std::vector<CodepointInfo> seg(cps.begin() + segStart, cps.begin() + i);
-            auto segIndexes = hyphenator->breakIndexes(seg);
-            for (const size_t idx : segIndexes) {
-              const size_t globalIdx = segStart + idx;
-              merged.push_back({byteOffsetForIndex(cps, globalIdx), true});
-            }
-          }
-          segStart = i + 1;
+  size_t begin = 0;
+  size_t end = total;
+  trimSurroundingPunctuationAndFootnote(wordCodepoints, begin, end);
+  const CodepointInfo* cps = wordCodepoints + begin;
+  const size_t count = end - begin;
+
+  size_t indexes[LiangWordConfig::kMaxLetters];
+  size_t written = 0;
+
+  bool hasExplicitBreaks = false;
+  for (size_t i = 1; i + 1 < count && !hasExplicitBreaks; ++i) {
+    hasExplicitBreaks = isExplicitBreak(cps, count, i);
+  }
+  if (hasExplicitBreaks) {
+    // Also run language patterns on the segments between explicit hyphens. Each segment's breaks come
+    // before the hyphen that ends it, so the result is in order as it is written.
+    size_t segStart = 0;
+    for (size_t i = 0; i <= count && written < capacity; ++i) {
+      const bool atEnd = (i == count);
+      if (!atEnd && !isExplicitHyphen(cps[i].value)) {
+        continue;
+      }
+      if (hyphenator && i > segStart) {
+        const size_t found =
+            hyphenator->breakIndexes(cps + segStart, i - segStart, indexes, LiangWordConfig::kMaxLetters);
+        for (size_t k = 0; k < found && written < capacity; ++k) {
+          out[written++] = {byteOffsetForIndex(cps, count, segStart + indexes[k]), true};
         }
       }
-      std::sort(merged.begin(), merged.end(),
-                [](const BreakInfo& a, const BreakInfo& b) { return a.byteOffset < b.byteOffset; });
-      merged.erase(std::unique(merged.begin(), merged.end(),
-                               [](const BreakInfo& a, const BreakInfo& b) { return a.byteOffset == b.byteOffset; }),
-                   merged.end());
-      return merged;
+      if (!atEnd && isExplicitBreak(cps, count, i) && written < capacity) {
+        out[written++] = {cps[i + 1].byteOffset, isSoftHyphen(cps[i].value)};
+      }
+      segStart = i + 1;
     }
-    return explicitBreakInfos;
+    return written;
+  }
+
+  // Too short for a break either way
+  const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
+  const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
+  if (count < minPrefix + minSuffix) {
+    return 0;
   }
 
-  std::vector<size_t> indexes;
   if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+    const size_t found = hyphenator->breakIndexes(cps, count, indexes, LiangWordConfig::kMaxLetters);
+    for (size_t k = 0; k < found && written < capacity; ++k) {
+      out[written++] = {byteOffsetForIndex(cps, count, indexes[k]), true};
+    }
   }
 
-  if (includeFallback && indexes.empty()) {
-    const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
-    const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
-    for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+  if (includeFallback && written == 0) {
+    for (size_t idx = minPrefix; idx + minSuffix <= count && written < capacity; ++idx) {
+      out[written++] = {byteOffsetForIndex(cps, count, idx), true};
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  return written;
+}
+
+// Results for recent words, direct-mapped by hash. Long words recur all through a chapter (names, the
+// words of its subject), and each is only hyphenated once. Short words are quick to do again and would
+// push the long ones out, so they are not kept, nor are words too long to store (few words are). Cleared
+// when the language is set, which the parsers do per chapter.
+constexpr size_t kMemoSlots = 64;
+constexpr size_t kMemoMaxBreaks = 15;
+constexpr size_t kMemoMinLength = 8;   // Bytes
+constexpr size_t kMemoMaxLength = 32;  // Bytes; 16 Cyrillic letters
+
+struct MemoEntry {
+  char word[kMemoMaxLength];  // Compared on lookup, so words with the same hash can't share results
+  uint16_t insertedHyphen;    // Bit i: break i needs a visible hyphen
+  uint8_t length;             // 0: empty
+  uint8_t count;
+  bool includeFallback;
+  uint8_t offsets[kMemoMaxBreaks];
+};
+
+MemoEntry memo[kMemoSlots];
+
+// Breaks written by the breakOffsets() overload that returns the hyphenator's own buffer
+Hyphenator::BreakInfo wordBreaks[Hyphenator::kMaxWordCodepoints];
+
+uint32_t hashWord(const std::string& word) {
+  uint32_t hash = 2166136261u;  // FNV-1a
+  for (const char c : word) {
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+size_t Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, BreakInfo* out,
+                                const size_t capacity) {
+  if (word.empty() || capacity == 0) {
+    return 0;
   }
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+  MemoEntry& entry = memo[hashWord(word) & (kMemoSlots - 1)];
+  if (entry.length == word.size() && entry.includeFallback == includeFallback &&
+      memcmp(entry.word, word.data(), word.size()) == 0) {
+    const size_t count = std::min<size_t>(entry.count, capacity);
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = {entry.offsets[i], ((entry.insertedHyphen >> i) & 1u) != 0};
+    }
+    return count;
   }
 
+  const size_t count = computeBreakOffsets(cachedHyphenator_, word, includeFallback, out, capacity);
+
+  // A result that filled the buffer may have been cut short, so it is not kept
+  if (word.size() >= kMemoMinLength && word.size() <= kMemoMaxLength && count <= kMemoMaxBreaks && count < capacity) {
+    memcpy(entry.word, word.data(), word.size());
+    entry.length = static_cast<uint8_t>(word.size());
+    entry.count = static_cast<uint8_t>(count);
+    entry.includeFallback = includeFallback;
+    entry.insertedHyphen = 0;
+    for (size_t i = 0; i < count; ++i) {
+      entry.offsets[i] = static_cast<uint8_t>(out[i].byteOffset);
+      if (out[i].requiresInsertedHyphen) entry.insertedHyphen |= static_cast<uint16_t>(1u << i);
+    }
+  }
+  return count;
+}
+
+size_t Hyphenator::breakOffsets(const std::string& word, const bool includeFallback, const BreakInfo*& breaks) {
+  breaks = wordBreaks;
+  return breakOffsets(word, includeFallback, wordBreaks, kMaxWordCodepoints);
+}
+
+std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
+  std::vector<BreakInfo> breaks(kMaxWordCodepoints);
+  breaks.resize(breakOffsets(word, includeFallback, breaks.data(), breaks.size()));
   return breaks;
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+void Hyphenator::setPreferredLanguage(const std::string& lang) {
+  cachedHyphenator_ = hyphenatorForLanguage(lang);
+  memset(memo, 0, sizeof(memo));
+}
@@ -12,6 +12,17 @@ class Hyphenator {
     size_t byteOffset;
     bool requiresInsertedHyphen;
   };
+
+  // Longest word that is hyphenated, in codepoints (the parsers cut words at 200 bytes). Also the most
+  // breaks a word can have.
+  static constexpr size_t kMaxWordCodepoints = 200;
+
+  // Writes the breaks of word to out in ascending order and returns how many there are (at most capacity).
+  // Allocates nothing; results are memoized until the language is next set.
+  static size_t breakOffsets(const std::string& word, bool includeFallback, BreakInfo* out, size_t capacity);
+  // Same, into a buffer of kMaxWordCodepoints breaks kept by the hyphenator (breaks points to it), which the
+  // next call overwrites. Hyphenation runs on one task at a time, so layout needn't hold it on its stack.
+  static size_t breakOffsets(const std::string& word, bool includeFallback, const BreakInfo*& breaks);
   static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
   static void setPreferredLanguage(const std::string& lang);
 
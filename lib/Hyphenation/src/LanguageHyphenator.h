@@ -4,19 +4,19 @@
 
 class LanguageHyphenator {
  public:
-  LanguageHyphenator(const SerializedHyphenationPatterns& patterns, bool (*isLetterFn)(uint32_t),
+  LanguageHyphenator(const HyphenationAutomaton& automaton, bool (*isLetterFn)(uint32_t),
                      uint32_t (*toLowerFn)(uint32_t), size_t minPrefix = LiangWordConfig::kDefaultMinPrefix,
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
-      : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
+      : automaton_(automaton), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
-  std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
-    return liangBreakIndexes(cps, patterns_, config_);
+  size_t breakIndexes(const CodepointInfo* cps, const size_t count, size_t* out, const size_t capacity) const {
+    return liangBreakIndexes(cps, count, automaton_, config_, out, capacity);
   }
 
   size_t minPrefix() const { return config_.minPrefix; }
   size_t minSuffix() const { return config_.minSuffix; }
 
  protected:
-  const SerializedHyphenationPatterns& patterns_;
+  const HyphenationAutomaton& automaton_;
   LiangWordConfig config_;
 };
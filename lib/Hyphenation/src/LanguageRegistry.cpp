@@ -14,13 +14,13 @@
 
 namespace {
 
-const LanguageHyphenator englishHyphenator(en_patterns, isLatinLetter, toLowerLatin, 3, 3);
-const LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
-const LanguageHyphenator germanHyphenator(de_patterns, isLatinLetter, toLowerLatin);
-const LanguageHyphenator russianHyphenator(ru_patterns, isCyrillicLetter, toLowerCyrillic);
-const LanguageHyphenator spanishHyphenator(es_patterns, isLatinLetter, toLowerLatin);
-const LanguageHyphenator italianHyphenator(it_patterns, isLatinLetter, toLowerLatin);
-const LanguageHyphenator ukrainianHyphenator(uk_patterns, isCyrillicLetter, toLowerCyrillic);
+const LanguageHyphenator englishHyphenator(en_automaton, isLatinLetter, toLowerLatin, 3, 3);
+const LanguageHyphenator frenchHyphenator(fr_automaton, isLatinLetter, toLowerLatin);
+const LanguageHyphenator germanHyphenator(de_automaton, isLatinLetter, toLowerLatin);
+const LanguageHyphenator russianHyphenator(ru_automaton, isCyrillicLetter, toLowerCyrillic);
+const LanguageHyphenator spanishHyphenator(es_automaton, isLatinLetter, toLowerLatin);
+const LanguageHyphenator italianHyphenator(it_automaton, isLatinLetter, toLowerLatin);
+const LanguageHyphenator ukrainianHyphenator(uk_automaton, isCyrillicLetter, toLowerCyrillic);
 
 using EntryArray = std::array<LanguageEntry, 7>;
 
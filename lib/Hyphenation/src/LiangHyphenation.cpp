@@ -1,200 +1,140 @@
 #include "LiangHyphenation.h"
 
 #include <algorithm>
-#include <vector>
+#include <cstring>
 
 namespace {
 
-using EmbeddedAutomaton = SerializedHyphenationPatterns;
-
+// The word as the patterns see it: '.' + lowercased letters + '.'. Lowercase Latin and Cyrillic letters
+// take at most two bytes.
 struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
-
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
+  static constexpr size_t kMaxChars = LiangWordConfig::kMaxLetters + 2;
+  static constexpr size_t kMaxBytes = LiangWordConfig::kMaxLetters * 2 + 2;
+
+  uint8_t bytes[kMaxBytes];
+  size_t byteCount = 0;
+  uint16_t charByteOffsets[kMaxChars];
+  size_t charCount = 0;
+  int8_t byteToCharIndex[kMaxBytes];  // -1 inside a multi-byte character
 };
 
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+size_t encodeUtf8(uint32_t cp, uint8_t* out) {
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
+    out[0] = static_cast<uint8_t>(cp);
     return 1;
   }
   if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    out[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    out[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 2;
   }
   if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    out[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    out[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 3;
   }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+  out[0] = static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u));
+  out[1] = static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu));
+  out[2] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+  out[3] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
   return 4;
 }
 
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
-  if (cps.empty()) {
-    return word;
-  }
-
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
-
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
-
-  for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
-    }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
-  }
-
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
-
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
-  }
-  return word;
-}
-
-struct AutomatonState {
-  const uint8_t* data = nullptr;
-  size_t size = 0;
-  size_t addr = 0;
-  uint8_t stride = 1;
-  size_t childCount = 0;
-  const uint8_t* transitions = nullptr;
-  const uint8_t* targets = nullptr;
-  const uint8_t* levels = nullptr;
-  size_t levelsLen = 0;
-
-  bool valid() const { return data != nullptr; }
-};
-
-AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
-  AutomatonState state;
-  if (addr >= automaton.size) {
-    return state;
+// False if the word is empty, too long, or has anything but letters in it
+bool buildAugmentedWord(const CodepointInfo* cps, const size_t count, const LiangWordConfig& config,
+                        AugmentedWord& word) {
+  if (count == 0 || count > LiangWordConfig::kMaxLetters) {
+    return false;
   }
 
-  const uint8_t* base = automaton.data + addr;
-  size_t remaining = automaton.size - addr;
-  size_t pos = 0;
+  word.charByteOffsets[word.charCount++] = 0;
+  word.bytes[word.byteCount++] = '.';
 
-  const uint8_t header = base[pos++];
-  const bool hasLevels = (header >> 7) != 0;
-  uint8_t stride = static_cast<uint8_t>((header >> 5) & 0x03u);
-  if (stride == 0) {
-    stride = 1;
-  }
-  size_t childCount = static_cast<size_t>(header & 0x1Fu);
-  if (childCount == 31u) {
-    if (pos >= remaining) {
-      return AutomatonState{};
-    }
-    childCount = base[pos++];
-  }
-
-  const uint8_t* levelsPtr = nullptr;
-  size_t levelsLen = 0;
-  if (hasLevels) {
-    if (pos + 1 >= remaining) {
-      return AutomatonState{};
+  for (size_t i = 0; i < count; ++i) {
+    if (!config.isLetter(cps[i].value)) {
+      return false;
     }
-    const uint8_t offsetHi = base[pos++];
-    const uint8_t offsetLoLen = base[pos++];
-    const size_t offset = (static_cast<size_t>(offsetHi) << 4) | (offsetLoLen >> 4);
-    levelsLen = offsetLoLen & 0x0Fu;
-    if (offset < 4u || offset - 4u + levelsLen > automaton.size) {
-      return AutomatonState{};
+    uint8_t utf8[4];
+    const size_t length = encodeUtf8(config.toLower(cps[i].value), utf8);
+    if (word.byteCount + length + 1 > AugmentedWord::kMaxBytes) {
+      return false;
     }
-    levelsPtr = automaton.data + offset - 4u;
+    word.charByteOffsets[word.charCount++] = static_cast<uint16_t>(word.byteCount);
+    memcpy(word.bytes + word.byteCount, utf8, length);
+    word.byteCount += length;
   }
 
-  if (pos + childCount > remaining) {
-    return AutomatonState{};
-  }
-  const uint8_t* transitions = base + pos;
-  pos += childCount;
+  word.charByteOffsets[word.charCount++] = static_cast<uint16_t>(word.byteCount);
+  word.bytes[word.byteCount++] = '.';
 
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
-    return AutomatonState{};
+  std::fill(word.byteToCharIndex, word.byteToCharIndex + word.byteCount, static_cast<int8_t>(-1));
+  for (size_t i = 0; i < word.charCount; ++i) {
+    word.byteToCharIndex[word.charByteOffsets[i]] = static_cast<int8_t>(i);
   }
-  const uint8_t* targets = base + pos;
-
-  state.data = automaton.data;
-  state.size = automaton.size;
-  state.addr = addr;
-  state.stride = stride;
-  state.childCount = childCount;
-  state.transitions = transitions;
-  state.targets = targets;
-  state.levels = levelsPtr;
-  state.levelsLen = levelsLen;
-  return state;
+  return true;
 }
 
-int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
-  if (stride == 1) {
-    return static_cast<int8_t>(buf[0]);
-  }
-  if (stride == 2) {
-    return static_cast<int16_t>((static_cast<uint16_t>(buf[0]) << 8) | static_cast<uint16_t>(buf[1]));
+// Next state after a symbol: the child with that label, or the same from the longest suffix that
+// has one. Dense states resolve it in one lookup, and every failure chain ends in one.
+size_t nextState(const HyphenationAutomaton& automaton, size_t state, const uint8_t symbol) {
+  if (symbol == 0) {
+    return 0;  // No pattern has this byte, so no match can run across it
+  }
+  while (state >= automaton.denseStates) {
+    const size_t end = automaton.firstChild(state + 1);
+    for (size_t child = automaton.firstChild(state); child < end && automaton.label[child] <= symbol; ++child) {
+      if (automaton.label[child] == symbol) {
+        return child;
+      }
+    }
+    state = automaton.fail[state];
   }
-  const int32_t unsignedVal =
-      (static_cast<int32_t>(buf[0]) << 16) | (static_cast<int32_t>(buf[1]) << 8) | static_cast<int32_t>(buf[2]);
-  return unsignedVal - (1 << 23);
+  return automaton.dense[state * automaton.symbolCount + symbol];
 }
 
-bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
-  if (!state.valid()) {
-    return false;
-  }
+// Raises the scores at the boundaries of the pattern ending at `match`, just before byteEnd
+void applyLevels(const HyphenationAutomaton& automaton, const size_t match, const size_t byteEnd,
+                 const AugmentedWord& augmented, uint8_t* scores) {
+  const uint16_t ref = automaton.levels[match];
+  const uint8_t* record = automaton.levelData + (ref >> 4);
+  const size_t byteStart = byteEnd - record[0];
+  const uint8_t* levels = record + 1;
+  const size_t levelsLen = ref & 0x0Fu;
+
+  size_t offset = 0;
+  for (size_t i = 0; i < levelsLen; ++i) {
+    const uint8_t packed = levels[i];
+    const size_t dist = static_cast<size_t>(packed / 10);
+    const uint8_t level = static_cast<uint8_t>(packed % 10);
+
+    offset += dist;
+    const size_t splitByte = byteStart + offset;
+    if (splitByte >= augmented.byteCount) {
+      continue;
+    }
 
-  for (size_t idx = 0; idx < state.childCount; ++idx) {
-    if (state.transitions[idx] != letter) {
+    const int32_t boundary = augmented.byteToCharIndex[splitByte];
+    if (boundary < 0) {
       continue;
     }
-    const uint8_t* deltaPtr = state.targets + idx * state.stride;
-    const int32_t delta = decodeDelta(deltaPtr, state.stride);
-    const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
-      return false;
+    if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount)) {
+      continue;
     }
-    out = decodeState(automaton, static_cast<size_t>(nextAddr));
-    return out.valid();
+
+    const size_t idx = static_cast<size_t>(boundary);
+    scores[idx] = std::max(scores[idx], level);
   }
-  return false;
 }
 
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+size_t collectBreakIndexes(const size_t cpCount, const uint8_t* scores, const size_t scoreCount,
+                           const size_t minPrefix, const size_t minSuffix, size_t* out, const size_t capacity) {
+  size_t count = 0;
   if (cpCount < 2) {
-    return indexes;
+    return count;
   }
 
-  for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
+  for (size_t breakIndex = 1; breakIndex < cpCount && count < capacity; ++breakIndex) {
     if (breakIndex < minPrefix) {
       continue;
     }
@@ -205,77 +145,42 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     }
 
     const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
+    if (scoreIdx >= scoreCount) {
       break;
     }
     if ((scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    out[count++] = breakIndex;
   }
 
-  return indexes;
+  return count;
 }
 
 }  // namespace
 
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
-  if (augmented.empty()) {
-    return {};
-  }
-
-  const EmbeddedAutomaton& automaton = patterns;
-
-  const AutomatonState root = decodeState(automaton, automaton.rootOffset);
-  if (!root.valid()) {
-    return {};
-  }
-
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
-
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
-    const size_t byteStart = augmented.charByteOffsets[charStart];
-    AutomatonState state = root;
-
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
-      AutomatonState next;
-      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
-        break;
-      }
-      state = next;
-
-      if (state.levels && state.levelsLen > 0) {
-        size_t offset = 0;
-        for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
-          const size_t dist = static_cast<size_t>(packed / 10);
-          const uint8_t level = static_cast<uint8_t>(packed % 10);
-
-          offset += dist;
-          const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
-            continue;
-          }
-
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
-            continue;
-          }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
-            continue;
-          }
-
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
-        }
+size_t liangBreakIndexes(const CodepointInfo* cps, const size_t count, const HyphenationAutomaton& automaton,
+                         const LiangWordConfig& config, size_t* out, const size_t capacity) {
+  AugmentedWord augmented;
+  if (!buildAugmentedWord(cps, count, config, augmented)) {
+    return 0;
+  }
+
+  uint8_t scores[AugmentedWord::kMaxChars] = {};
+
+  // One pass over the bytes finds every pattern occurrence. Patterns start with a whole character,
+  // so each one found starts at a character boundary, as when matching from each character in turn;
+  // scores keep the highest level, so the order they are found in does not matter.
+  size_t state = 0;
+  for (size_t cursor = 0; cursor < augmented.byteCount; ++cursor) {
+    state = nextState(automaton, state, automaton.symbols[augmented.bytes[cursor]]);
+    // Patterns ending here are this state's and its failure chain's
+    for (size_t match = state; match != 0; match = automaton.fail[match]) {
+      if (automaton.levels[match] != 0) {
+        applyLevels(automaton, match, cursor + 1, augmented, scores);
       }
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(count, scores, augmented.charCount, config.minPrefix, config.minSuffix, out, capacity);
 }
@@ -2,14 +2,15 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
+#include "HyphenationAutomaton.h"
 #include "HyphenationCommon.h"
-#include "SerializedHyphenationTrie.h"
 
 struct LiangWordConfig {
   static constexpr size_t kDefaultMinPrefix = 2;
   static constexpr size_t kDefaultMinSuffix = 2;
+  // Longest word the patterns are matched against, in letters; longer runs get no pattern breaks
+  static constexpr size_t kMaxLetters = 100;
   bool (*isLetter)(uint32_t);
   uint32_t (*toLower)(uint32_t);
   size_t minPrefix;
@@ -20,5 +21,7 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+// Writes the indexes into cps where the word may break, in ascending order, and returns how many there are.
+// Works in fixed buffers on the stack; nothing is allocated.
+size_t liangBreakIndexes(const CodepointInfo* cps, size_t count, const HyphenationAutomaton& automaton,
+                         const LiangWordConfig& config, size_t* out, size_t capacity);
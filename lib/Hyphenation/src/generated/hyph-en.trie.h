@@ -3,1433 +3,2199 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t en_trie_data[] = {
-    0x2C, 0x22, 0x1F, 0x21, 0x23, 0x2D, 0x37, 0x41, 0x2A, 0x20, 0x4B, 0x2B, 0x35, 0x23, 0x19, 0x2B, 0x0E, 0x29, 0x2D,
-    0x0F, 0x36, 0x04, 0x19, 0x19, 0x19, 0x0F, 0x17, 0x15, 0x04, 0x0C, 0x0D, 0x18, 0x02, 0x04, 0x18, 0x03, 0x16, 0x0E,
-    0x0E, 0x0B, 0x0F, 0x19, 0x05, 0x0F, 0x0E, 0x0F, 0x17, 0x0D, 0x02, 0x0C, 0x19, 0x18, 0x05, 0x0F, 0x18, 0x18, 0x0C,
-    0x01, 0x02, 0x0B, 0x04, 0x0B, 0x04, 0x16, 0x04, 0x22, 0x04, 0x0D, 0x02, 0x0D, 0x2D, 0x0E, 0x03, 0x17, 0x03, 0x23,
-    0x0C, 0x0C, 0x05, 0x22, 0x02, 0x0F, 0x0C, 0x04, 0x0F, 0x02, 0x22, 0x04, 0x17, 0x04, 0x15, 0x03, 0x20, 0x16, 0x0F,
-    0x01, 0x0E, 0x0E, 0x04, 0x0D, 0x0C, 0x23, 0x0E, 0x03, 0x0E, 0x01, 0x0C, 0x02, 0x0D, 0x0E, 0x16, 0x0C, 0x0B, 0x0E,
-    0x23, 0x0F, 0x0B, 0x0C, 0x01, 0x0E, 0x0D, 0x05, 0x17, 0x0E, 0x17, 0x01, 0x15, 0x04, 0x0B, 0x0E, 0x02, 0x0B, 0x0C,
-    0x0B, 0x0B, 0x18, 0x0B, 0x0F, 0x23, 0x0D, 0x21, 0x15, 0x16, 0x0E, 0x18, 0x0E, 0x0D, 0x17, 0x0B, 0x22, 0x0C, 0x0F,
-    0x20, 0x0F, 0x0B, 0x17, 0x0E, 0x0C, 0x04, 0x0B, 0x0C, 0x01, 0x18, 0x05, 0x0E, 0x03, 0x0E, 0x0E, 0x04, 0x0D, 0x0D,
-    0x05, 0x23, 0x02, 0x0F, 0x0D, 0x0F, 0x0F, 0x03, 0x22, 0x21, 0x0E, 0x18, 0x0D, 0x02, 0x18, 0x05, 0x19, 0x04, 0x0F,
-    0x0E, 0x40, 0x17, 0x17, 0x0E, 0x22, 0x05, 0x0F, 0x0C, 0x02, 0x15, 0x04, 0x23, 0x0C, 0x0F, 0x0F, 0x05, 0x0C, 0x04,
-    0x0E, 0x0E, 0x0C, 0x22, 0x0F, 0x22, 0x1F, 0x0D, 0x16, 0x0B, 0x0E, 0x19, 0x22, 0x0E, 0x19, 0x0E, 0x05, 0x23, 0x0F,
-    0x21, 0x17, 0x03, 0x18, 0x0C, 0x18, 0x01, 0x0B, 0x03, 0x15, 0x02, 0x0D, 0x0C, 0x01, 0x0C, 0x0C, 0x17, 0x19, 0x05,
-    0x18, 0x2C, 0x0D, 0x2C, 0x0F, 0x05, 0x2C, 0x16, 0x0D, 0x21, 0x0D, 0x21, 0x0C, 0x16, 0x16, 0x05, 0x21, 0x02, 0x16,
-    0x0E, 0x15, 0x2D, 0x19, 0x02, 0x0B, 0x0E, 0x01, 0x16, 0x29, 0x10, 0x0B, 0x37, 0x19, 0x22, 0x0B, 0x15, 0x23, 0x15,
-    0x21, 0x10, 0x2A, 0x0D, 0x24, 0x0B, 0x15, 0x22, 0x15, 0x2D, 0x0C, 0x0B, 0x1F, 0x0E, 0x24, 0x0D, 0x29, 0x0C, 0x33,
-    0x2D, 0x15, 0x42, 0x2E, 0x18, 0x2E, 0x15, 0x23, 0x1F, 0x21, 0x19, 0x23, 0x23, 0x20, 0x0D, 0x20, 0x0B, 0x1A, 0x15,
-    0x17, 0x19, 0x17, 0x15, 0x0C, 0x17, 0x23, 0x21, 0x15, 0x0B, 0x1A, 0x0B, 0x19, 0x0C, 0x0B, 0x0D, 0x2A, 0x0B, 0x2A,
-    0x0C, 0x1F, 0x19, 0x16, 0x0B, 0x0B, 0x24, 0x0C, 0x23, 0x0B, 0x1F, 0x0B, 0x0C, 0x1A, 0x15, 0x0D, 0x29, 0x0B, 0x0C,
-    0x21, 0x1A, 0x01, 0x16, 0x0B, 0x19, 0x29, 0x17, 0x21, 0x02, 0x0B, 0x16, 0x03, 0x19, 0x29, 0x0F, 0x0B, 0x17, 0x2D,
-    0x2B, 0x0F, 0x15, 0x15, 0x0B, 0x01, 0x10, 0x0D, 0x0D, 0x29, 0x0C, 0x0D, 0x0E, 0x0D, 0x2E, 0x1F, 0x10, 0x0B, 0x05,
-    0x16, 0x29, 0x02, 0x0B, 0x0E, 0x0D, 0x0B, 0x16, 0x0D, 0x19, 0x0D, 0x0F, 0x1F, 0x0E, 0x33, 0x0C, 0x2E, 0x0D, 0x01,
-    0x1A, 0x01, 0x19, 0x18, 0x0D, 0x0F, 0x0D, 0x2E, 0x0B, 0x01, 0x21, 0x1A, 0x17, 0x10, 0x16, 0x15, 0x1F, 0x0B, 0x01,
-    0x2B, 0x01, 0x23, 0x03, 0x1F, 0x0B, 0x21, 0x0B, 0x1F, 0x1F, 0x38, 0x0B, 0x17, 0x2B, 0x03, 0x17, 0x19, 0x1A, 0x0D,
-    0x15, 0x0C, 0x15, 0x05, 0x29, 0x15, 0x05, 0x1F, 0x15, 0x1F, 0x0F, 0x18, 0x15, 0x2E, 0x0F, 0x0F, 0x34, 0x20, 0x19,
-    0x0D, 0x16, 0x15, 0x05, 0x21, 0x15, 0x21, 0x1F, 0x0B, 0x0D, 0x38, 0x0D, 0x16, 0x0B, 0x0D, 0x18, 0x21, 0x18, 0x0F,
-    0x29, 0x21, 0x0B, 0x0B, 0x10, 0x0D, 0x0E, 0x38, 0x18, 0x23, 0x1F, 0x0D, 0x17, 0x29, 0x01, 0x35, 0x2B, 0x0D, 0x03,
-    0x2A, 0x2B, 0x10, 0x0D, 0x0C, 0x21, 0x22, 0x0F, 0x2B, 0x34, 0x0B, 0x1A, 0x0D, 0x17, 0x2D, 0x23, 0x03, 0x18, 0x0F,
-    0x0B, 0x0D, 0x1F, 0x16, 0x0D, 0x0B, 0x23, 0x10, 0x06, 0x19, 0x33, 0x0D, 0x23, 0x05, 0x17, 0x23, 0x33, 0x29, 0x01,
-    0x20, 0x17, 0x1F, 0x15, 0x1A, 0x0F, 0x03, 0x33, 0x03, 0x0C, 0x15, 0x0B, 0x3F, 0x0C, 0x0B, 0x0D, 0x1F, 0x0F, 0x2D,
-    0x0D, 0x0C, 0x0B, 0x23, 0x01, 0x29, 0x33, 0x0B, 0x1F, 0x18, 0x0B, 0x16, 0x1F, 0x10, 0x01, 0x2B, 0x0C, 0x05, 0x1F,
-    0x0B, 0x10, 0x1A, 0x05, 0x20, 0x15, 0x0F, 0x1F, 0x1F, 0x0C, 0x2B, 0x1F, 0x49, 0x0D, 0x3D, 0x03, 0x1F, 0x15, 0x03,
-    0x29, 0x0F, 0x0B, 0x15, 0x21, 0x33, 0x15, 0x0B, 0x23, 0x15, 0x15, 0x21, 0x0D, 0x35, 0x10, 0x0C, 0x29, 0x0E, 0xA0,
-    0x00, 0x41, 0x21, 0x68, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x00,
-    0x61, 0x21, 0x74, 0xFD, 0xA0, 0x00, 0x71, 0x21, 0x74, 0xFD, 0xA0, 0x00, 0x81, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD,
-    0xA0, 0x00, 0x91, 0x21, 0x6D, 0xFD, 0xA0, 0x00, 0xA1, 0x21, 0x73, 0xFD, 0xA2, 0x00, 0x41, 0x65, 0x69, 0xE5, 0xFD,
-    0x24, 0x63, 0x67, 0x69, 0x74, 0xE4, 0xC6, 0xF0, 0xF9, 0x21, 0x65, 0xC3, 0x22, 0x69, 0x79, 0xFD, 0xC0, 0x22, 0x73,
-    0x74, 0xD3, 0xFB, 0xA0, 0x00, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63, 0x70, 0x73, 0x74, 0xBF, 0xB9,
-    0xB9, 0xFD, 0x21, 0x6D, 0xCB, 0x21, 0x6F, 0xFD, 0x41, 0x64, 0xFF, 0xAA, 0x41, 0x69, 0xFF, 0x9A, 0x41, 0x6E, 0xFF,
-    0x90, 0x4C, 0x63, 0x64, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xFF, 0x8F, 0xFF, 0x9B, 0xFF,
-    0xA1, 0xFF, 0xA7, 0xFF, 0xB0, 0xFF, 0xC6, 0xFF, 0xD7, 0xFF, 0xE5, 0xFF, 0xF1, 0xFF, 0xF4, 0xFF, 0xF8, 0xFF, 0xFC,
-    0x41, 0x61, 0xFF, 0x85, 0x41, 0x65, 0xFF, 0x63, 0x43, 0x67, 0x6E, 0x73, 0xFF, 0x65, 0xFF, 0xF8, 0xFF, 0xFC, 0xC1,
-    0x00, 0x41, 0x61, 0xFF, 0x73, 0x41, 0x6F, 0xFF, 0x6D, 0x42, 0x6D, 0x74, 0xFF, 0x63, 0xFF, 0xFC, 0x22, 0x72, 0x73,
-    0xEF, 0xF9, 0xA0, 0x00, 0xC1, 0x21, 0x69, 0xFD, 0x41, 0x69, 0xFF, 0x39, 0x21, 0x74, 0xFC, 0x21, 0x74, 0xFD, 0x24,
-    0x61, 0x65, 0x72, 0x75, 0xD0, 0xEB, 0xF3, 0xFD, 0x21, 0x70, 0xC3, 0x41, 0x63, 0xFF, 0x4A, 0x41, 0x62, 0xFF, 0x4C,
-    0x21, 0x61, 0xFC, 0x41, 0x6C, 0xFF, 0x3F, 0x21, 0x6F, 0xFC, 0x45, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0xFF, 0xEB, 0xFF,
-    0xEE, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF, 0x17, 0x41, 0x61, 0xFF, 0x07, 0x21, 0x6C, 0xFC, 0x41, 0x69, 0xFF, 0x4A, 0x21,
-    0x6C, 0xFC, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x51, 0x69, 0xFD, 0x41, 0x72, 0xFF, 0x12, 0xA1, 0x00, 0xD1, 0x74, 0xFC,
-    0x21, 0x65, 0xF7, 0xA1, 0x00, 0x51, 0x6E, 0xFD, 0x21, 0x67, 0xEF, 0x43, 0x65, 0x72, 0x6E, 0xFE, 0xEF, 0xFF, 0xF8,
-    0xFF, 0xFD, 0x25, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xBC, 0xD0, 0xDD, 0xE6, 0xF6, 0x41, 0x6F, 0xFF, 0x2E, 0xC1, 0x00,
-    0x71, 0x76, 0xFF, 0x57, 0x42, 0x61, 0x69, 0xFE, 0xD0, 0xFF, 0xFA, 0x41, 0x63, 0xFE, 0xB1, 0x44, 0x6D, 0x6F, 0x72,
-    0x73, 0xFF, 0xEB, 0xFE, 0xC5, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x63, 0xFD, 0x41, 0x74, 0xFE, 0x97, 0x42, 0x63, 0x6D, 0xFE, 0x93, 0xFF, 0x6E, 0xA0, 0x04, 0xA2,
-    0x21, 0x76, 0xFD, 0x21, 0x69, 0xFD, 0x25, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xD0, 0xE9, 0xEC, 0xF0, 0xFD, 0x41, 0x68,
-    0xFE, 0xC2, 0x21, 0x74, 0xFC, 0xA0, 0x00, 0xF1, 0x21, 0x69, 0xFD, 0x22, 0x72, 0x73, 0xF7, 0xFD, 0x41, 0x72, 0xFE,
-    0x60, 0xA0, 0x00, 0xD1, 0x41, 0x6D, 0xFE, 0x71, 0x42, 0x64, 0x65, 0xFE, 0x73, 0xFF, 0xFC, 0xA0, 0x01, 0x01, 0x21,
-    0x6D, 0xFD, 0x43, 0x61, 0x67, 0x73, 0xFF, 0xFD, 0xFE, 0x60, 0xFE, 0x60, 0xA0, 0x01, 0x12, 0x21, 0x74, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x72, 0xFE, 0x9E, 0xC1, 0x00, 0x71, 0x6C, 0xFE, 0x3A, 0x41, 0x65, 0xFE, 0x4F,
-    0xA0, 0x11, 0x73, 0x21, 0x6C, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x11, 0xA2, 0x21, 0x62, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x00, 0xD1, 0x65, 0xFD, 0x4D, 0x61, 0x62, 0x65, 0x67, 0x6C,
-    0x6E, 0x71, 0x72, 0x73, 0x75, 0x79, 0x74, 0x76, 0xFF, 0x9F, 0xFE, 0x0A, 0xFF, 0xA4, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF,
-    0xBC, 0xFF, 0xCF, 0xFF, 0xD2, 0xFE, 0x1C, 0xFF, 0xD6, 0xFF, 0xDC, 0xFF, 0xE9, 0xFF, 0xFB, 0x41, 0x73, 0xFF, 0x71,
-    0x41, 0x6D, 0xFE, 0xF6, 0x21, 0x72, 0xFC, 0x22, 0x65, 0x6F, 0xF5, 0xFD, 0xA0, 0x11, 0xC3, 0x21, 0x6D, 0xFD, 0x21,
-    0x6F, 0xFD, 0xA1, 0x00, 0xD1, 0x73, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x74, 0xFD, 0xA0, 0x11, 0xF2, 0x43, 0x67, 0x6D,
-    0x74, 0xFD, 0xD3, 0xFD, 0xF8, 0xFF, 0xFD, 0xA2, 0x00, 0xD1, 0x6E, 0x6F, 0xF0, 0xF6, 0x42, 0x61, 0x62, 0xFD, 0xC2,
-    0xFD, 0xAA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF9, 0xFD, 0xA6, 0x41, 0x69, 0xFD, 0xBD,
-    0x42, 0x64, 0x6B, 0xFF, 0xFC, 0xFD, 0xB3, 0x21, 0x6E, 0xF9, 0x42, 0x69, 0x65, 0xFD, 0xAF, 0xFD, 0x9A, 0x21, 0x6F,
-    0xF9, 0xA0, 0x09, 0x02, 0x21, 0x6F, 0xFD, 0xA0, 0x12, 0x12, 0x21, 0x61, 0xFD, 0xC5, 0x00, 0xD1, 0x72, 0x73, 0x74,
-    0x6D, 0x70, 0xFF, 0xF1, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0xF7, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x72, 0x42, 0x62, 0x65,
-    0xFD, 0x6E, 0xFF, 0xFC, 0x41, 0x79, 0xFD, 0x76, 0x42, 0x65, 0x6F, 0xFF, 0xFC, 0xFE, 0xE0, 0x42, 0x6E, 0x76, 0xFF,
-    0xF9, 0xFD, 0x6B, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xB8, 0xD1, 0xE7, 0xF9, 0x41, 0x6C, 0xFE, 0xE6, 0x42, 0x6C, 0x6F,
-    0xFD, 0x36, 0xFF, 0xFC, 0x41, 0x6E, 0xFD, 0x47, 0x21, 0x69, 0xFC, 0x42, 0x6D, 0x70, 0xFD, 0x3A, 0xFF, 0xFD, 0x41,
-    0x69, 0xFD, 0x33, 0xA0, 0x04, 0xF2, 0x21, 0x74, 0xFD, 0xC5, 0x00, 0x61, 0x63, 0x65, 0x6B, 0x73, 0x75, 0xFF, 0xF6,
-    0xFD, 0xD2, 0xFE, 0xB5, 0xFD, 0x29, 0xFF, 0xFD, 0x41, 0x72, 0xFD, 0x1D, 0x45, 0x64, 0x6D, 0x6E, 0x72, 0x73, 0xFF,
-    0xCB, 0xFF, 0xD9, 0xFF, 0xEA, 0xFF, 0xFC, 0xFD, 0x67, 0x41, 0x75, 0xFF, 0x91, 0x41, 0x79, 0xFC, 0xED, 0x42, 0x65,
-    0x68, 0xFD, 0xF8, 0xFD, 0x10, 0x43, 0x63, 0x6D, 0x74, 0xFF, 0xF5, 0xFC, 0xE2, 0xFF, 0xF9, 0xA0, 0x01, 0x51, 0xA0,
-    0x12, 0x51, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0xC5, 0x00, 0xD1, 0x67, 0x6E, 0x70, 0x76, 0x69,
-    0xFE, 0x9B, 0xFC, 0xC3, 0xFC, 0xEA, 0xFF, 0xF1, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x61, 0xFC, 0xD8, 0x44, 0x67, 0x6E,
-    0x6F, 0x74, 0xFF, 0xFA, 0xFE, 0x4F, 0xFC, 0xC3, 0xFC, 0xB1, 0x23, 0x61, 0x65, 0x69, 0xC2, 0xDB, 0xF3, 0xA0, 0x01,
-    0x62, 0x21, 0x61, 0xFD, 0x41, 0x6F, 0xFC, 0xB8, 0x41, 0x61, 0xFC, 0xB4, 0x41, 0x69, 0xFC, 0xB0, 0x21, 0x74, 0xFC,
-    0x24, 0x67, 0x6C, 0x6E, 0x72, 0xEE, 0xF1, 0xF5, 0xFD, 0x41, 0x63, 0xFE, 0x0E, 0x41, 0x61, 0xFC, 0x75, 0x21, 0x6C,
-    0xFC, 0x42, 0x65, 0x61, 0xFF, 0x6F, 0xFF, 0xFD, 0xA0, 0x12, 0x82, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0xA3, 0x00,
-    0xD1, 0x72, 0x74, 0x67, 0xE5, 0xF0, 0xFD, 0xA0, 0x12, 0xD2, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xC2, 0x01, 0x51,
-    0x74, 0x65, 0xFE, 0xBC, 0xFF, 0xFD, 0xA0, 0x12, 0xA3, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x22, 0x73, 0x6D, 0xEE,
-    0xFD, 0x41, 0x65, 0xFD, 0xCA, 0x41, 0x6F, 0xFC, 0x49, 0x22, 0x6E, 0x72, 0xF8, 0xFC, 0xC1, 0x00, 0x81, 0x62, 0xFC,
-    0x55, 0x21, 0x61, 0xFA, 0x21, 0x74, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0x9A, 0xFF, 0xBE, 0xFF, 0xE2,
-    0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x12, 0xA0, 0x12, 0xF2, 0x21, 0x66, 0xFD, 0x21, 0x6F, 0xFD, 0x41, 0x68,
-    0xFF, 0x2D, 0x21, 0x74, 0xFC, 0xA0, 0x13, 0x12, 0x21, 0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x65, 0x6E, 0xF4, 0xFD,
-    0x23, 0x69, 0x65, 0x6F, 0xDE, 0xE8, 0xFB, 0xC1, 0x00, 0xD1, 0x64, 0xFC, 0x0A, 0x41, 0x65, 0xFB, 0xFB, 0x21, 0x74,
-    0xFC, 0x41, 0x74, 0xFC, 0x87, 0x44, 0x61, 0x63, 0x64, 0x74, 0xFF, 0xFC, 0xFB, 0xEA, 0xFB, 0xE4, 0xFB, 0xEA, 0x41,
-    0x6C, 0xFB, 0xCB, 0xA1, 0x00, 0x71, 0x74, 0xFC, 0x41, 0x68, 0xFD, 0x51, 0x41, 0x74, 0xFD, 0x4D, 0x26, 0x64, 0x66,
-    0x72, 0x73, 0x74, 0x75, 0xD1, 0xDB, 0xE2, 0xF3, 0xF8, 0xFC, 0x41, 0x61, 0xFC, 0x8F, 0x42, 0x65, 0x69, 0xFB, 0xC1,
-    0xFB, 0xC4, 0x22, 0x64, 0x74, 0xF5, 0xF9, 0x41, 0x6E, 0xFB, 0xBE, 0x43, 0x65, 0x6F, 0x74, 0xFB, 0x99, 0xFF, 0xFC,
-    0xFD, 0x37, 0x41, 0x6D, 0xFE, 0xB7, 0x42, 0x6D, 0x61, 0xFD, 0x1A, 0xFF, 0xFC, 0x21, 0x65, 0xF9, 0xA0, 0x13, 0x31,
-    0x21, 0x73, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x6D, 0xF7, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x73, 0xF4,
-    0xFD, 0x24, 0x65, 0x69, 0x72, 0x6F, 0xC8, 0xD1, 0xE6, 0xFB, 0x41, 0x74, 0xFB, 0x5B, 0x41, 0x61, 0xFB, 0xA7, 0x21,
-    0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x13, 0x42, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65,
-    0xFD, 0x44, 0x63, 0x6E, 0x74, 0x76, 0xFB, 0x44, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF, 0xFD, 0xC1, 0x00, 0xC1, 0x63, 0xFE,
-    0xDC, 0x41, 0x69, 0xFB, 0x4C, 0xC1, 0x00, 0xC1, 0x74, 0xFB, 0x4B, 0x23, 0x65, 0x6D, 0x73, 0xF0, 0xF6, 0xFA, 0x41,
-    0x75, 0xFB, 0x41, 0x42, 0x67, 0x74, 0xFB, 0x1C, 0xFF, 0xFC, 0x41, 0x74, 0xFB, 0x36, 0x41, 0x64, 0xFB, 0x32, 0x43,
-    0x71, 0x73, 0x77, 0xFB, 0x0D, 0xFF, 0xF8, 0xFF, 0xFC, 0x41, 0x64, 0xFB, 0x03, 0x25, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0xBB, 0xD8, 0xE3, 0xF2, 0xFC, 0x41, 0x69, 0xFE, 0xB9, 0x42, 0x66, 0x6C, 0xFB, 0x17, 0xFB, 0x17, 0x41, 0x69, 0xFF,
-    0x06, 0xA0, 0x13, 0x61, 0xA0, 0x0C, 0x31, 0xA0, 0x13, 0x72, 0xC6, 0x00, 0xA1, 0x63, 0x64, 0x70, 0x72, 0x73, 0x76,
-    0xFA, 0xD6, 0xFF, 0xF7, 0xFF, 0xFA, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0xFA, 0x21, 0x69, 0xEB, 0x44, 0x6C, 0x6E, 0x72,
-    0x6D, 0xFF, 0xD4, 0xFC, 0x62, 0xFF, 0xDB, 0xFF, 0xFD, 0xA0, 0x01, 0x81, 0x21, 0x67, 0xFD, 0xA1, 0x00, 0xD1, 0x6E,
-    0xFD, 0x41, 0x62, 0xFB, 0x8E, 0xA1, 0x00, 0x51, 0x61, 0xFC, 0xA0, 0x13, 0x92, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD,
-    0x41, 0x6F, 0xFF, 0x19, 0x21, 0x6E, 0xFC, 0x22, 0x68, 0x69, 0xF6, 0xFD, 0x47, 0x63, 0x65, 0x68, 0x69, 0x74, 0x79,
-    0x70, 0xFF, 0x9A, 0xFF, 0xCA, 0xFC, 0x2C, 0xFF, 0xDD, 0xFF, 0xE6, 0xFC, 0x2C, 0xFF, 0xFB, 0xA0, 0x13, 0xB2, 0x21,
-    0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0xA1, 0x00, 0x51, 0x70, 0xFD, 0x41, 0x61, 0xFE,
-    0xC7, 0x41, 0x67, 0xFD, 0x00, 0x21, 0x65, 0xFC, 0xA2, 0x00, 0x51, 0x6E, 0x6C, 0xF5, 0xFD, 0x41, 0x6F, 0xFD, 0xB5,
-    0x42, 0x67, 0x6B, 0xFF, 0x97, 0xFA, 0x6F, 0xC3, 0x00, 0xD1, 0x6C, 0x6D, 0x6E, 0xFA, 0x41, 0xFF, 0xF5, 0xFF, 0xF9,
-    0x41, 0x67, 0xFD, 0x66, 0xC2, 0x00, 0x51, 0x69, 0x6F, 0xFA, 0x58, 0xFF, 0xFC, 0x41, 0x73, 0xFA, 0x4F, 0x44, 0x6E,
-    0x70, 0x75, 0x71, 0xFD, 0xAF, 0xFF, 0xF3, 0xFF, 0xFC, 0xFB, 0xC8, 0x41, 0x74, 0xFA, 0x44, 0x21, 0x75, 0xFC, 0x21,
-    0x62, 0xFD, 0x21, 0x69, 0xFD, 0x46, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0xFF, 0xA7, 0xFF, 0xB7, 0xFB, 0xAE, 0xFF,
-    0xC9, 0xFF, 0xE6, 0xFF, 0xFD, 0xA0, 0x13, 0xD2, 0x21, 0x74, 0xFD, 0xA1, 0x00, 0x61, 0x74, 0xFD, 0x41, 0x65, 0xFA,
-    0x04, 0xA0, 0x13, 0xF2, 0x21, 0x72, 0xFD, 0xA1, 0x00, 0x61, 0x72, 0xFD, 0x47, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6F,
-    0x75, 0xFF, 0xEC, 0xFF, 0xF1, 0xFA, 0x33, 0xFF, 0xFB, 0xF9, 0xFB, 0xF9, 0xFB, 0xF9, 0xF5, 0x44, 0x6E, 0x70, 0x72,
-    0x73, 0xFF, 0xEA, 0xF9, 0xDF, 0xFD, 0x92, 0xFA, 0x60, 0x41, 0x64, 0xFA, 0x57, 0x42, 0x6E, 0x72, 0xFF, 0xFC, 0xFA,
-    0x4F, 0xA0, 0x14, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x22, 0x65, 0x69, 0xED, 0xFD, 0x41,
-    0x6C, 0xFD, 0x15, 0xA0, 0x14, 0x32, 0x21, 0x6C, 0xFD, 0x21, 0x62, 0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0xA0, 0x12,
-    0x32, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6C, 0xFD, 0xA0, 0x12, 0x53, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD,
-    0x21, 0x72, 0xFD, 0x22, 0x69, 0x6F, 0xF1, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x6B, 0xF9, 0xE3, 0xFA, 0x40, 0xFA, 0xA2,
-    0xFA, 0xF2, 0xFB, 0x6B, 0xFB, 0x9E, 0xFB, 0xD2, 0xFC, 0x32, 0xFC, 0x74, 0xFC, 0x84, 0xFC, 0xD1, 0xFD, 0x53, 0xFD,
-    0x85, 0xFD, 0xBB, 0xFE, 0x0B, 0xFE, 0x76, 0xFE, 0xE7, 0xFF, 0x65, 0xFF, 0xA8, 0xFF, 0xCC, 0xFF, 0xDE, 0xF9, 0xB2,
-    0xFF, 0xFB, 0xA0, 0x01, 0x91, 0xA0, 0x01, 0x71, 0x22, 0x6C, 0x6E, 0xFD, 0xFD, 0xA0, 0x01, 0x21, 0x21, 0x64, 0xFD,
-    0xA1, 0x00, 0xD1, 0x72, 0xFD, 0xA0, 0x01, 0xA2, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x42, 0x61, 0x74, 0xF9, 0x28,
-    0xFF, 0xFD, 0x21, 0x74, 0xE5, 0x21, 0x61, 0xFD, 0xA0, 0x01, 0xC2, 0x22, 0x7A, 0x63, 0xFD, 0xD4, 0x21, 0x69, 0xFB,
-    0x21, 0x6C, 0xFD, 0x21, 0x67, 0xD1, 0xA1, 0x01, 0x91, 0x6F, 0xFD, 0xA0, 0x01, 0xE1, 0x21, 0x6C, 0xFD, 0x28, 0x2E,
-    0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xB8, 0xBE, 0xC9, 0xD7, 0xE1, 0xEF, 0xF5, 0xFD, 0xA2, 0x01, 0x41, 0x64,
-    0x6F, 0xB2, 0xB2, 0xA0, 0x02, 0x11, 0x21, 0x6C, 0xFD, 0x22, 0x72, 0x62, 0xF3, 0xFD, 0x41, 0x75, 0xFF, 0x98, 0xA0,
-    0x01, 0xF1, 0x22, 0x6F, 0x72, 0xF9, 0xFD, 0x41, 0x74, 0xFF, 0x8C, 0x21, 0x65, 0xFC, 0xA0, 0x02, 0x21, 0xA3, 0x02,
-    0x02, 0x65, 0x6E, 0x6F, 0xFD, 0xEE, 0xFD, 0x41, 0x62, 0xFF, 0x81, 0x21, 0x6F, 0xFC, 0x41, 0x66, 0xF8, 0xB6, 0x21,
-    0x69, 0xFC, 0xA0, 0x02, 0x31, 0x42, 0x6C, 0x6D, 0xFF, 0xA7, 0xFF, 0xFD, 0x27, 0x61, 0x65, 0x68, 0x69, 0x72, 0x74,
-    0x75, 0xC4, 0xD0, 0xD9, 0xDF, 0xEC, 0xF3, 0xF9, 0x21, 0x6E, 0xE7, 0x21, 0x69, 0xFD, 0x41, 0x2E, 0xFF, 0x54, 0x21,
-    0x72, 0xFC, 0x41, 0x61, 0xFF, 0x84, 0xC6, 0x02, 0x41, 0x61, 0x63, 0x65, 0x6F, 0x74, 0x75, 0xFF, 0xBC, 0xFF, 0xFC,
-    0xF8, 0x70, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0x41, 0x21, 0x65, 0xC1, 0x41, 0x77, 0xFF, 0x68, 0x41, 0x6E, 0xFF, 0x2D,
-    0x21, 0x61, 0xFC, 0x21, 0x75, 0xB3, 0xC2, 0x01, 0x91, 0x63, 0x6D, 0xFF, 0x96, 0xFF, 0x23, 0xA8, 0x02, 0x11, 0x64,
-    0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0xC3, 0xCA, 0xD1, 0xE6, 0xE9, 0xF1, 0xF4, 0xF7, 0xC1, 0x02, 0x31, 0x69,
-    0xF8, 0xC2, 0x21, 0x72, 0xFA, 0xA0, 0x14, 0x51, 0x21, 0x68, 0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x00, 0x51, 0x69, 0xFD,
-    0xA1, 0x02, 0x11, 0x66, 0xFB, 0xA0, 0x01, 0x41, 0x42, 0x62, 0x6E, 0xFF, 0xFD, 0xF8, 0x0C, 0x41, 0x6C, 0xFE, 0xE1,
-    0x43, 0x6C, 0x6F, 0x75, 0xFF, 0xFC, 0xF8, 0x01, 0xFE, 0xD2, 0xA0, 0x02, 0x52, 0xA0, 0x02, 0x71, 0x41, 0x69, 0xFF,
-    0x04, 0xA2, 0x02, 0x11, 0x67, 0x6E, 0xF9, 0xFC, 0x41, 0x72, 0xFE, 0xBA, 0x42, 0x65, 0x6C, 0xFF, 0xFC, 0xFE, 0xBE,
-    0x48, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x6F, 0x75, 0x79, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0x1B, 0xFF, 0xE4, 0xFF, 0x1B,
-    0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xCC, 0x44, 0x61, 0x65, 0x6C, 0x6F, 0xFF, 0x11, 0xFF, 0x11, 0xFF, 0x2B, 0xFF, 0x11,
-    0x41, 0x2E, 0xFF, 0x04, 0x41, 0x79, 0xFE, 0x8D, 0xC2, 0x02, 0x92, 0x69, 0x6F, 0xFA, 0x7E, 0xF7, 0xC5, 0x41, 0x65,
-    0xFA, 0x75, 0xC5, 0x02, 0x81, 0x61, 0x63, 0x6C, 0x6E, 0x74, 0xFE, 0x74, 0xFF, 0xEB, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF,
-    0xFC, 0xA0, 0x02, 0xB1, 0x41, 0x6E, 0xFE, 0xCB, 0x21, 0x65, 0xFC, 0x43, 0x62, 0x64, 0x72, 0xFE, 0x60, 0xFE, 0x97,
-    0xFF, 0x75, 0x41, 0x69, 0xFE, 0x4B, 0x41, 0x69, 0xFF, 0x67, 0x42, 0x64, 0x74, 0xFE, 0x85, 0xFF, 0xFC, 0xA0, 0x02,
-    0xC2, 0xA2, 0x02, 0x41, 0x6E, 0x6F, 0xF6, 0xFD, 0x41, 0x2E, 0xFE, 0xCA, 0xC2, 0x01, 0xF1, 0x61, 0x65, 0xFF, 0xFC,
-    0xF7, 0x5D, 0x41, 0x76, 0xFE, 0x30, 0x41, 0x63, 0xFE, 0x21, 0x22, 0x65, 0x69, 0xF8, 0xFC, 0x41, 0x2E, 0xFE, 0x1B,
-    0x21, 0x67, 0xFC, 0xA0, 0x02, 0xE2, 0xA1, 0x01, 0x91, 0x74, 0xFD, 0xA0, 0x02, 0xE1, 0x44, 0x2E, 0x73, 0x74, 0x7A,
-    0xFF, 0x26, 0xFF, 0xF8, 0xFF, 0xFD, 0xFF, 0x41, 0x48, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x79, 0xFF, 0xA4,
-    0xFF, 0xAE, 0xFF, 0xC0, 0xFF, 0xCB, 0xFF, 0xDC, 0xFD, 0xF9, 0xFF, 0xE5, 0xFF, 0xF3, 0x41, 0x63, 0xFD, 0xEB, 0x41,
-    0x73, 0xFE, 0xFC, 0xA0, 0x03, 0x02, 0x22, 0x69, 0x6F, 0xF9, 0xFD, 0xC5, 0x01, 0x91, 0x62, 0x67, 0x72, 0x73, 0x74,
-    0xFD, 0xDB, 0xFE, 0x12, 0xF7, 0x92, 0xFF, 0xF0, 0xFF, 0xFB, 0x41, 0x61, 0xFD, 0xC9, 0xA0, 0x14, 0x63, 0x21, 0x62,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x22, 0x72, 0x6E, 0xF0, 0xFD, 0xC1, 0x01, 0xF1, 0x6F, 0xF6, 0xD8, 0x44,
-    0x63, 0x66, 0x6C, 0x6E, 0xFD, 0xE5, 0xFD, 0xAE, 0xFF, 0x21, 0xFF, 0xFA, 0xC2, 0x02, 0x11, 0x6E, 0x72, 0xFD, 0x99,
-    0xFA, 0x36, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x70, 0xFF, 0xBD, 0xFF, 0xDF, 0xFF, 0xEA, 0xFF, 0xF7, 0xFF, 0x18, 0x41,
-    0x65, 0xFD, 0xBF, 0xA0, 0x13, 0x71, 0xA1, 0x02, 0x71, 0x73, 0xFD, 0x21, 0x79, 0xFB, 0xC2, 0x02, 0x21, 0x63, 0x69,
-    0xFD, 0xB0, 0xF6, 0x97, 0x41, 0x69, 0xFD, 0xE3, 0x24, 0x67, 0x6C, 0x72, 0x74, 0xE4, 0xF0, 0xF3, 0xFC, 0x41, 0x73,
-    0xF6, 0x81, 0x41, 0x73, 0xFD, 0x96, 0x41, 0x77, 0xFD, 0xE8, 0xC4, 0x01, 0x91, 0x65, 0x69, 0x6C, 0x6F, 0xFF, 0xF4,
-    0xFF, 0xF8, 0xFD, 0xBB, 0xFF, 0xFC, 0x41, 0x74, 0xFD, 0xF4, 0x44, 0x65, 0x6E, 0x73, 0x75, 0xFD, 0x3C, 0xFD, 0xB7,
-    0xFF, 0xFC, 0xFD, 0xB7, 0xC2, 0x02, 0x41, 0x69, 0x6C, 0xFA, 0x78, 0xFD, 0x9B, 0xA0, 0x02, 0xA2, 0x41, 0x73, 0xFD,
-    0x9E, 0xA0, 0x03, 0x22, 0x42, 0x65, 0x69, 0xFD, 0xB1, 0xFD, 0x1C, 0x41, 0x65, 0xFD, 0x15, 0x41, 0x68, 0xFD, 0x50,
-    0x4A, 0x63, 0x65, 0x66, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xE7, 0xFF, 0xEA, 0xFF, 0xEE, 0xFF, 0xF1,
-    0xFF, 0xF8, 0xFD, 0x4C, 0xFD, 0x88, 0xFF, 0xFC, 0xFD, 0x4C, 0xFD, 0x88, 0x41, 0x69, 0xFD, 0x83, 0x21, 0x6C, 0xFC,
-    0x41, 0x7A, 0xFE, 0xDB, 0x21, 0x69, 0xFC, 0xC1, 0x01, 0x21, 0x68, 0xF6, 0x33, 0x41, 0x63, 0xF8, 0xE9, 0xA2, 0x00,
-    0x51, 0x74, 0x61, 0xF6, 0xFC, 0xA0, 0x02, 0x81, 0x41, 0x6F, 0xFD, 0x61, 0xC1, 0x02, 0x81, 0x6F, 0xF6, 0x06, 0x41,
-    0x72, 0xFD, 0x57, 0x48, 0x61, 0x63, 0x6E, 0x70, 0x74, 0x75, 0x67, 0x76, 0xFF, 0xEF, 0xFF, 0xF2, 0xFD, 0x53, 0xFF,
-    0xF6, 0xFD, 0x53, 0xFF, 0xFC, 0xF8, 0xE5, 0xF5, 0xFC, 0x41, 0x6C, 0xFB, 0x1A, 0xA0, 0x14, 0x93, 0x41, 0x65, 0xF8,
-    0xF2, 0x44, 0x65, 0x64, 0x6E, 0x72, 0xFD, 0x2F, 0xF8, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0x45, 0x61, 0x69, 0x6F, 0x72,
-    0x77, 0xFF, 0xE8, 0xFF, 0xF3, 0xFC, 0x8A, 0xFF, 0xBE, 0xFD, 0x22, 0x43, 0x61, 0x6C, 0x72, 0xFC, 0xBC, 0xFC, 0xBC,
-    0xFC, 0x7D, 0xCB, 0x02, 0x11, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x0F, 0xFF,
-    0x24, 0xFF, 0x37, 0xFF, 0x44, 0xFF, 0x66, 0xFF, 0x89, 0xFF, 0x90, 0xFF, 0x9D, 0xFF, 0xB5, 0xFF, 0xE6, 0xFF, 0xF6,
-    0x42, 0x72, 0x74, 0xF5, 0x75, 0xFC, 0x57, 0x41, 0x6F, 0xFC, 0x50, 0xA0, 0x0D, 0xF2, 0x21, 0x65, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x62, 0xFD, 0x22, 0x72, 0x61, 0xF0, 0xFD, 0x41, 0x72, 0xFC, 0xAE, 0x42, 0x65, 0x69, 0xFF, 0xFC, 0xFC,
-    0x2C, 0xC1, 0x01, 0x41, 0x72, 0xFC, 0x30, 0x21, 0x61, 0xFA, 0x21, 0x6C, 0xFD, 0x42, 0x61, 0x75, 0xFC, 0x5B, 0xFC,
-    0x97, 0x43, 0x6C, 0x6E, 0x74, 0xFF, 0xF6, 0xFC, 0x54, 0xFF, 0xF9, 0x44, 0x63, 0x6C, 0x72, 0x73, 0xF5, 0x58, 0xFE,
-    0x4A, 0xF8, 0xA8, 0xF9, 0x79, 0x41, 0x73, 0xF5, 0x42, 0x21, 0x65, 0xFC, 0x48, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F,
-    0x73, 0x75, 0xFF, 0xA8, 0xFF, 0xBF, 0xFF, 0xC8, 0xFF, 0xE2, 0xFC, 0x54, 0xFF, 0xEC, 0xFF, 0xFD, 0xFC, 0x72, 0x41,
-    0x75, 0xF6, 0xDC, 0x41, 0x74, 0xFC, 0x19, 0x41, 0x73, 0xFB, 0xDE, 0x42, 0x65, 0x69, 0xFB, 0xD2, 0xFF, 0xFC, 0x41,
-    0x74, 0xFE, 0xB6, 0x21, 0x65, 0xFC, 0x41, 0x67, 0xF4, 0xEA, 0x42, 0x6F, 0x76, 0xFB, 0xC0, 0xFB, 0xC8, 0xA1, 0x02,
-    0x31, 0x69, 0xF9, 0xA0, 0x03, 0x62, 0x4A, 0x63, 0x64, 0x6C, 0x6D, 0x6E, 0x70, 0x74, 0x75, 0x76, 0x77, 0xFF, 0xD7,
-    0xFF, 0xDF, 0xFB, 0xF0, 0xFF, 0xEA, 0xFF, 0xED, 0xF4, 0xEF, 0xFF, 0xF8, 0xFB, 0xB1, 0xFF, 0xFD, 0xF4, 0xD7, 0x41,
-    0x61, 0xFE, 0xED, 0xA0, 0x14, 0xC2, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x65, 0xFC, 0x36, 0xFF, 0xFD, 0x21, 0x68, 0xF9,
-    0x41, 0x65, 0xFB, 0x86, 0x21, 0x6E, 0xFC, 0x42, 0x69, 0x72, 0xFF, 0xFD, 0xFC, 0x0C, 0x41, 0x73, 0xFB, 0x70, 0x44,
-    0x61, 0x65, 0x6E, 0x73, 0xFF, 0x96, 0xFB, 0xE7, 0xFF, 0x92, 0xFF, 0xFC, 0x42, 0x69, 0x6C, 0xFB, 0xF4, 0xFB, 0xF4,
-    0x42, 0x6C, 0x6E, 0xFB, 0x60, 0xFB, 0x97, 0x41, 0x74, 0xFB, 0xCC, 0xC6, 0x01, 0xF1, 0x61, 0x65, 0x6D, 0x6E, 0x6F,
-    0x7A, 0xFF, 0xF5, 0xFF, 0xFC, 0xFB, 0xE2, 0xFB, 0x73, 0xFB, 0x8C, 0xFE, 0x7E, 0x41, 0x69, 0xFE, 0x69, 0x41, 0x69,
-    0xFB, 0x34, 0x43, 0x64, 0x6E, 0x6F, 0xFB, 0x59, 0xFF, 0xFC, 0xFB, 0xAB, 0x41, 0x65, 0xFE, 0x57, 0x21, 0x67, 0xFC,
-    0x21, 0x6E, 0xFD, 0x42, 0x65, 0x61, 0xF4, 0x42, 0xFF, 0xFD, 0x42, 0x61, 0x68, 0xFB, 0xAA, 0xFE, 0x46, 0xCD, 0x03,
-    0x42, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x71, 0x72, 0x73, 0xFF, 0x5D, 0xFF, 0x7C, 0xFF,
-    0x8D, 0xFF, 0x97, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xD6, 0xFF, 0xDE, 0xFE, 0x3F, 0xFB, 0x4D, 0xFF, 0xF2,
-    0xFF, 0xF9, 0x42, 0x62, 0x6E, 0xFB, 0x79, 0xFF, 0x0A, 0xA0, 0x03, 0x83, 0x44, 0x61, 0x62, 0x63, 0x74, 0xFC, 0xBF,
-    0xFB, 0x55, 0xFB, 0x55, 0xFF, 0xFD, 0x41, 0x63, 0xFB, 0xEA, 0x41, 0x68, 0xFA, 0xD1, 0x41, 0x68, 0xFB, 0x5A, 0x41,
-    0x6E, 0xFB, 0x00, 0x42, 0x65, 0x72, 0xFF, 0xFC, 0xFB, 0x29, 0x41, 0x72, 0xF7, 0x4F, 0x41, 0x6F, 0xFA, 0xD5, 0x21,
-    0x74, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0x6D, 0xFD, 0x4C, 0x2E, 0x61, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74,
-    0x75, 0x79, 0xFA, 0xA2, 0xFF, 0xC1, 0xF4, 0x92, 0xFF, 0xCB, 0xF6, 0xB0, 0xFB, 0x3A, 0xFF, 0xD8, 0xFF, 0xDC, 0xFF,
-    0xE0, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x6F, 0xFA, 0xBF, 0xC4, 0x02, 0x11, 0x62, 0x63, 0x6C, 0x70, 0xFA,
-    0xBE, 0xFA, 0x84, 0xFF, 0xFC, 0xFA, 0x84, 0xC1, 0x00, 0x81, 0x68, 0xFA, 0x75, 0x41, 0x2E, 0xFA, 0xA6, 0xC1, 0x00,
-    0x91, 0x61, 0xFA, 0x63, 0x42, 0x61, 0x6E, 0xFA, 0x9C, 0xFF, 0xFA, 0x46, 0x63, 0x67, 0x6E, 0x72, 0x73, 0x76, 0xFF,
-    0xE9, 0xFF, 0xD6, 0xFF, 0xEF, 0xFF, 0xF9, 0xFE, 0x7C, 0xFA, 0x5E, 0xA0, 0x14, 0xE3, 0x21, 0x73, 0xFD, 0x21, 0x6F,
-    0xFD, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x7E, 0xFA, 0x3A, 0xFF, 0xFD, 0xC1, 0x02, 0x31, 0x6D, 0xF3, 0x74, 0xA2, 0x01,
-    0x91, 0x65, 0x6F, 0xF0, 0xFA, 0x41, 0x72, 0xF3, 0x76, 0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x41, 0x75, 0xFA, 0x58,
-    0x47, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x6F, 0x74, 0xFA, 0x12, 0xFA, 0x15, 0xFA, 0x3E, 0xFA, 0x81, 0xFA, 0x54, 0xFF,
-    0xF9, 0xFF, 0xFC, 0x41, 0x7A, 0xFA, 0x07, 0xA1, 0x02, 0x11, 0x69, 0xFC, 0x44, 0x67, 0x6D, 0x70, 0x73, 0xFB, 0x13,
-    0xFF, 0xFB, 0xFB, 0x13, 0xFB, 0x13, 0x41, 0x70, 0xF9, 0xF1, 0xA1, 0x02, 0xB1, 0x6F, 0xFC, 0x41, 0x6B, 0xFA, 0x75,
-    0x41, 0x67, 0xFA, 0x71, 0x41, 0x2E, 0xFA, 0xE2, 0xA1, 0x01, 0x21, 0x73, 0xFC, 0x43, 0x61, 0x65, 0x68, 0xFF, 0xF3,
-    0xFF, 0xFB, 0xFA, 0x64, 0xC4, 0x02, 0x11, 0x61, 0x65, 0x6C, 0x72, 0xF9, 0xCD, 0xF9, 0xCD, 0xFA, 0x04, 0xFA, 0x80,
-    0x4A, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFF, 0x3A, 0xFF, 0x60, 0xFF, 0x8C, 0xFF, 0xA1,
-    0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xD6, 0xFF, 0xE7, 0xFF, 0xF1, 0xFA, 0x13, 0x41, 0x6C, 0xF2, 0xBD, 0xA1, 0x00, 0xF1,
-    0x74, 0xFC, 0x42, 0x68, 0x75, 0xFF, 0xFB, 0xF9, 0xCD, 0x41, 0x66, 0xF9, 0x9A, 0xA1, 0x03, 0xB2, 0x69, 0xFC, 0x41,
-    0x64, 0xF2, 0xC2, 0x41, 0x69, 0xFA, 0x01, 0x42, 0x65, 0x68, 0xF5, 0x73, 0xF9, 0xE2, 0x47, 0x62, 0x67, 0x6C, 0x6E,
-    0x72, 0x73, 0x74, 0xFA, 0x04, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF1, 0xF9, 0xAE, 0xFF, 0xF5, 0xFF, 0xF9, 0xC2, 0x02,
-    0x11, 0x67, 0x6E, 0xF9, 0x98, 0xF9, 0x59, 0x41, 0x6F, 0xF2, 0x7C, 0x43, 0x61, 0x6E, 0x79, 0xF9, 0x8B, 0xF9, 0x54,
-    0xF9, 0x54, 0x22, 0x6E, 0x72, 0xF2, 0xF6, 0xC3, 0x01, 0xF1, 0x65, 0x67, 0x6F, 0xF2, 0x6C, 0xF9, 0x7C, 0xFF, 0x24,
-    0x42, 0x63, 0x72, 0xF9, 0x39, 0xFA, 0xCF, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xD1, 0xE8, 0xED, 0xF9, 0x41, 0x79, 0xFA,
-    0x59, 0x41, 0x79, 0xF9, 0xB2, 0x44, 0x61, 0x69, 0x6C, 0x73, 0xFF, 0xF8, 0xF9, 0x58, 0xFF, 0xFC, 0xF2, 0x45, 0x42,
-    0x63, 0x64, 0xF9, 0xA1, 0xF9, 0xA1, 0x21, 0x69, 0xF9, 0x43, 0x61, 0x65, 0x73, 0xFA, 0x29, 0xF2, 0x2E, 0xF2, 0x2E,
-    0x41, 0x69, 0xF2, 0x3C, 0x42, 0x69, 0x7A, 0xF2, 0x26, 0xFF, 0xFC, 0x59, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xF9,
-    0x32, 0xF9, 0x8C, 0xF9, 0xDB, 0xF9, 0xF4, 0xFA, 0x05, 0xFA, 0x3E, 0xFA, 0x57, 0xFA, 0x79, 0xFA, 0x8B, 0xFA, 0x92,
-    0xFA, 0xF1, 0xFB, 0x5D, 0xFC, 0x7A, 0xF8, 0xEA, 0xFC, 0xF6, 0xFD, 0x0F, 0xFD, 0xDF, 0xFE, 0x48, 0xFF, 0x37, 0xFF,
-    0x7E, 0xFF, 0xC3, 0xFF, 0xD4, 0xFF, 0xE8, 0xFF, 0xEB, 0xFF, 0xF9, 0x41, 0x65, 0xF4, 0xC8, 0x21, 0x67, 0xFC, 0x41,
-    0x61, 0xF1, 0xD2, 0x41, 0x67, 0xF1, 0xDA, 0x21, 0x61, 0xFC, 0x43, 0x64, 0x65, 0x69, 0xFF, 0xFD, 0xF1, 0xBB, 0xF1,
-    0xCD, 0xA0, 0x15, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x62, 0x69, 0x6F, 0xF4, 0x0F,
-    0xF5, 0x2A, 0xFF, 0xFD, 0x41, 0x73, 0xF2, 0x01, 0x41, 0x79, 0xF8, 0xD7, 0xA1, 0x03, 0xD1, 0x68, 0xFC, 0x41, 0x2E,
-    0xF2, 0x49, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD, 0x4A, 0x2E, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73,
-    0x74, 0x7A, 0x63, 0xFA, 0x49, 0xFF, 0xB8, 0xF9, 0x29, 0xFF, 0xBB, 0xFF, 0xC6, 0xFF, 0xDC, 0xFF, 0xE6, 0xFF, 0xEE,
-    0xF8, 0xEA, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xF8, 0xB1, 0x42, 0x6E, 0x74, 0xF2, 0x55, 0xF1, 0x5C, 0xA2, 0x03,
-    0xE2, 0x65, 0x69, 0xF3, 0xF9, 0xA0, 0x04, 0x02, 0x42, 0x6B, 0x74, 0xF1, 0x45, 0xF2, 0xDA, 0xC3, 0x04, 0x22, 0x61,
-    0x65, 0x69, 0xF8, 0x57, 0xF8, 0x57, 0xF8, 0x57, 0x42, 0x69, 0x75, 0xF8, 0x4B, 0xF8, 0x14, 0xC2, 0x03, 0xD1, 0x69,
-    0x6F, 0xF8, 0x71, 0xF8, 0x44, 0xA0, 0x01, 0x92, 0x42, 0x69, 0x75, 0xF8, 0x30, 0xF8, 0x01, 0x41, 0x72, 0xF7, 0xFA,
-    0xC2, 0x04, 0x42, 0x70, 0x74, 0xF8, 0x2D, 0xFF, 0xFC, 0x41, 0x7A, 0xF1, 0x29, 0xC3, 0x02, 0x71, 0x69, 0x72, 0x77,
-    0xFF, 0xFC, 0xF7, 0xE9, 0xF8, 0x20, 0x41, 0x69, 0xFC, 0xAF, 0x4C, 0x2E, 0x61, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x73,
-    0x74, 0x77, 0x79, 0x76, 0xF7, 0xCE, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF,
-    0xE3, 0xFF, 0xF0, 0xF8, 0x10, 0xFB, 0x89, 0xFF, 0xFC, 0xA0, 0x02, 0x41, 0xA0, 0x04, 0x62, 0xA0, 0x15, 0x32, 0x21,
-    0x66, 0xFD, 0xA1, 0x02, 0x31, 0x69, 0xFD, 0xC2, 0x02, 0x71, 0x6E, 0x72, 0xF7, 0xA3, 0xF8, 0x30, 0xA0, 0x04, 0x82,
-    0x41, 0x7A, 0xF7, 0xCE, 0x41, 0x62, 0xF2, 0x55, 0x21, 0x61, 0xFC, 0xA2, 0x03, 0xD1, 0x69, 0x6C, 0xF5, 0xFD, 0x41,
-    0x72, 0xF2, 0x1D, 0x43, 0x61, 0x64, 0x65, 0xFF, 0xFC, 0xF0, 0xA5, 0xF7, 0x9C, 0x41, 0x72, 0xF7, 0xAE, 0x42, 0x62,
-    0x68, 0xF7, 0xD7, 0xF0, 0xA3, 0x44, 0x67, 0x75, 0x6D, 0x72, 0xFF, 0xF5, 0xF7, 0x6C, 0xF0, 0xA8, 0xFF, 0xF9, 0xA0,
-    0x04, 0xC2, 0xA0, 0x15, 0x52, 0x21, 0x65, 0xFD, 0x22, 0x6F, 0x76, 0xF7, 0xFD, 0xA0, 0x04, 0xE2, 0x21, 0x61, 0xFD,
-    0xC4, 0x02, 0x81, 0x69, 0x72, 0x75, 0x7A, 0xFF, 0xF5, 0xF7, 0x82, 0xFF, 0xFD, 0xF7, 0x43, 0x48, 0x62, 0x64, 0x65,
-    0x66, 0x6C, 0x6E, 0x6F, 0x74, 0xFA, 0x65, 0xFF, 0x94, 0xFF, 0x99, 0xFF, 0xA2, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xD0,
-    0xFF, 0xF1, 0x41, 0x68, 0xF0, 0x6E, 0xA0, 0x15, 0x72, 0x21, 0x64, 0xFD, 0x22, 0x74, 0x6E, 0xF6, 0xFD, 0x41, 0x70,
-    0xF9, 0x00, 0x43, 0x2E, 0x6E, 0x73, 0xF8, 0x25, 0xF0, 0x2E, 0xFF, 0xFC, 0x42, 0x73, 0x6E, 0xF7, 0x79, 0xFF, 0xEA,
-    0xA0, 0x15, 0x92, 0x21, 0x64, 0xFD, 0xA1, 0x01, 0x41, 0x6E, 0xFD, 0x41, 0x6E, 0xF4, 0xB7, 0xA5, 0x05, 0x02, 0x61,
-    0x65, 0x69, 0x6F, 0x75, 0xD7, 0xE0, 0xEA, 0xF7, 0xFC, 0xC1, 0x04, 0x62, 0x65, 0xFE, 0x45, 0xC1, 0x02, 0x71, 0x69,
-    0xF0, 0x13, 0x41, 0x63, 0xF0, 0x0D, 0x21, 0x69, 0xFC, 0x41, 0x62, 0xF0, 0x5A, 0xC1, 0x00, 0x51, 0x74, 0xF0, 0x08,
-    0x21, 0x61, 0xFA, 0xA0, 0x15, 0xB2, 0x21, 0x6F, 0xFD, 0x46, 0x2E, 0x61, 0x64, 0x65, 0x69, 0x6E, 0xF8, 0xA9, 0xFE,
-    0x93, 0xEF, 0xF9, 0xF8, 0xA9, 0xF8, 0xA9, 0xFF, 0xFD, 0xA0, 0x05, 0x22, 0xA0, 0x15, 0xD3, 0x21, 0x6C, 0xFD, 0x44,
-    0x61, 0x68, 0x6F, 0x75, 0xF6, 0x99, 0xEF, 0xE6, 0xF7, 0x2E, 0xFF, 0xFD, 0x41, 0x64, 0xF1, 0x64, 0x21, 0x6E, 0xFC,
-    0x4A, 0x64, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0xFF, 0xB0, 0xF7, 0x1A, 0xFF, 0xBA, 0xFF, 0xBD,
-    0xFF, 0xC7, 0xF7, 0xBD, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xEC, 0xFF, 0xFD, 0x41, 0x74, 0xF6, 0x63, 0x41, 0x68, 0xF1,
-    0x3A, 0x21, 0x74, 0xFC, 0x41, 0x71, 0xEF, 0x81, 0x21, 0x73, 0xFC, 0x23, 0x69, 0x6F, 0x75, 0xEE, 0xF6, 0xFD, 0xC1,
-    0x05, 0x43, 0x6F, 0xF1, 0x13, 0xC3, 0x02, 0x41, 0x6C, 0x6F, 0x72, 0xF6, 0xDC, 0xF7, 0x64, 0xF6, 0xC2, 0x41, 0x66,
-    0xEF, 0x6D, 0x41, 0x61, 0xF6, 0xCC, 0xC1, 0x02, 0x31, 0x74, 0xF0, 0x20, 0xA0, 0x16, 0x02, 0xA2, 0x00, 0x81, 0x72,
-    0x73, 0xFD, 0xFD, 0x21, 0x65, 0xF9, 0x41, 0x6E, 0xFA, 0x5C, 0x42, 0x65, 0x69, 0xEF, 0x42, 0xFF, 0xFC, 0x43, 0x69,
-    0x73, 0x74, 0xFF, 0xF2, 0xFF, 0xF9, 0xF8, 0x09, 0x41, 0x6F, 0xF7, 0x43, 0x41, 0x2E, 0xF0, 0xD1, 0x21, 0x64, 0xFC,
-    0x41, 0x65, 0xF4, 0x29, 0x45, 0x61, 0x69, 0x6F, 0x65, 0x74, 0xF5, 0xF9, 0xFF, 0xF1, 0xF5, 0xFC, 0xFF, 0xF9, 0xFF,
-    0xFC, 0x48, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xFF, 0xB1, 0xFF, 0xB5, 0xF7, 0x27, 0xEF, 0xD9, 0xFF,
-    0xB9, 0xF8, 0x6C, 0xFF, 0xD7, 0xFF, 0xF0, 0xA0, 0x05, 0x72, 0x42, 0x2E, 0x73, 0xF7, 0xC4, 0xEE, 0xFC, 0x55, 0x61,
-    0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
-    0x79, 0xFD, 0x74, 0xFD, 0xA0, 0xFD, 0xA7, 0xFD, 0xF8, 0xFE, 0x1D, 0xFE, 0x20, 0xFE, 0x95, 0xF7, 0x67, 0xF6, 0x5E,
-    0xFE, 0xE1, 0xFD, 0xA7, 0xFE, 0xEE, 0xFF, 0x44, 0xF5, 0xC6, 0xFF, 0x75, 0xFF, 0x7C, 0xFF, 0x82, 0xFF, 0xDD, 0xF7,
-    0x67, 0xFF, 0xF6, 0xFF, 0xF9, 0x41, 0x6E, 0xEE, 0xC7, 0x42, 0x69, 0x6C, 0xFF, 0xFC, 0xF5, 0xF1, 0xA0, 0x16, 0x22,
-    0x42, 0x6E, 0x6D, 0xF5, 0x83, 0xFF, 0xFD, 0x21, 0x65, 0xF9, 0xA0, 0x04, 0x42, 0xA0, 0x05, 0x42, 0x42, 0x61, 0x69,
-    0xEE, 0x97, 0xF2, 0xFA, 0x43, 0x61, 0x6C, 0x6F, 0xF9, 0x8A, 0xFF, 0xF9, 0xF5, 0x61, 0x43, 0x63, 0x73, 0x7A, 0xEE,
-    0x86, 0xEE, 0x9E, 0xEE, 0x98, 0x45, 0x64, 0x65, 0x69, 0x74, 0x79, 0xEE, 0x94, 0xEE, 0x7C, 0xFF, 0xF6, 0xF1, 0x8F,
-    0xEE, 0x76, 0x41, 0x65, 0xFD, 0x4E, 0x41, 0x6D, 0xEE, 0x80, 0x21, 0x6F, 0xFC, 0x42, 0x65, 0x69, 0xEF, 0x70, 0xFC,
-    0x9F, 0x42, 0x74, 0x79, 0xFF, 0xF9, 0xF5, 0x2B, 0x41, 0x76, 0xF5, 0x24, 0xA0, 0x16, 0x43, 0x21, 0x73, 0xFD, 0x43,
-    0x68, 0x69, 0x61, 0xF5, 0xB2, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x6C, 0xEE, 0x57, 0x21, 0x61, 0xFC, 0xCC, 0x03, 0xD1,
-    0x62, 0x63, 0x64, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0xFF, 0x87, 0xEE, 0x35, 0xFF, 0x98, 0xFF,
-    0x9B, 0xFF, 0x9E, 0xFF, 0xA8, 0xFF, 0xBC, 0xFF, 0xCC, 0xFF, 0xD4, 0xFF, 0xDE, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x70,
-    0xF2, 0xB4, 0x43, 0x6D, 0x6E, 0x75, 0xFF, 0xFC, 0xEE, 0x07, 0xF2, 0x4F, 0xC3, 0x02, 0x21, 0x68, 0x69, 0x6F, 0xF1,
-    0x70, 0xEE, 0xFC, 0xFF, 0xF6, 0x41, 0x6E, 0xF4, 0xC8, 0x42, 0x2E, 0x65, 0xF4, 0xC4, 0xFF, 0xFC, 0x42, 0x2E, 0x6C,
-    0xF6, 0xB4, 0xF5, 0xF8, 0xA0, 0x05, 0x92, 0xC4, 0x03, 0xD1, 0x63, 0x65, 0x69, 0x74, 0xF5, 0xEE, 0xFF, 0xFD, 0xF4,
-    0xB3, 0xF5, 0xEE, 0x41, 0x6D, 0xF4, 0xAF, 0x21, 0x61, 0xFC, 0xC1, 0x02, 0x71, 0x62, 0xEF, 0x88, 0x21, 0x69, 0xFA,
-    0x43, 0x61, 0x73, 0x74, 0xF4, 0x94, 0xFF, 0xFD, 0xED, 0xDB, 0xA0, 0x02, 0xF2, 0xA1, 0x00, 0x51, 0x61, 0xFD, 0x4A,
-    0x2E, 0x64, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x77, 0xFC, 0xD9, 0xFF, 0xBE, 0xF5, 0xBD, 0xFF, 0xC5, 0xFF,
-    0xCF, 0xF5, 0xBD, 0xFF, 0xE2, 0xFF, 0xEE, 0xFF, 0xFB, 0xED, 0xB1, 0xA0, 0x05, 0xB2, 0x42, 0x63, 0x73, 0xF6, 0x57,
-    0xF4, 0x8C, 0x21, 0x69, 0xF9, 0x22, 0x62, 0x6E, 0xF3, 0xFD, 0x41, 0x70, 0xEF, 0x2C, 0x41, 0x69, 0xF5, 0x88, 0x42,
-    0x2E, 0x73, 0xF4, 0x8B, 0xF4, 0x8B, 0xC6, 0x00, 0xD1, 0x61, 0x64, 0x6C, 0x6D, 0x6E, 0x72, 0xFF, 0xF1, 0xF4, 0x42,
-    0xEE, 0x1C, 0xFF, 0xF5, 0xF8, 0xC7, 0xFF, 0xF9, 0x42, 0x2E, 0x73, 0xF6, 0x24, 0xF8, 0x5A, 0xC2, 0x05, 0xD2, 0x65,
-    0x69, 0xFF, 0xF9, 0xF6, 0x1D, 0x41, 0x76, 0xF0, 0xB5, 0x45, 0x6E, 0x6F, 0x74, 0x7A, 0x65, 0xFF, 0xF3, 0xF6, 0x10,
-    0xF5, 0x54, 0xEE, 0xE6, 0xFF, 0xFC, 0xA0, 0x05, 0xF2, 0x41, 0x75, 0xED, 0x47, 0x42, 0x2E, 0x68, 0xF4, 0x02, 0xFF,
-    0xFC, 0xC7, 0x02, 0x41, 0x2E, 0x61, 0x65, 0x69, 0x6F, 0x74, 0x73, 0xF3, 0xFB, 0xFF, 0xA5, 0xFF, 0xB9, 0xFF, 0xE2,
-    0xFF, 0xF2, 0xF7, 0x10, 0xFF, 0xF9, 0xA0, 0x06, 0x12, 0xC2, 0x02, 0x71, 0x62, 0x72, 0xFF, 0xFD, 0xED, 0x27, 0x41,
-    0x72, 0xF3, 0xD7, 0x41, 0x2E, 0xF5, 0xCA, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD, 0x42, 0x61, 0x69, 0xF4, 0x61, 0xF5,
-    0x04, 0xC1, 0x01, 0x41, 0x74, 0xF4, 0xFD, 0xC1, 0x02, 0xB1, 0x2E, 0xF3, 0xBF, 0xC5, 0x02, 0x41, 0x61, 0x65, 0x67,
-    0x6F, 0x71, 0xFF, 0xF4, 0xEE, 0x86, 0xFF, 0xFA, 0xF5, 0xAD, 0xEE, 0x83, 0x43, 0x65, 0x68, 0x69, 0xF3, 0xA4, 0xF3,
-    0xE6, 0xF5, 0x83, 0x42, 0x61, 0x69, 0xF3, 0x9A, 0xF3, 0x9A, 0x21, 0x74, 0xF9, 0x41, 0x7A, 0xEC, 0xD1, 0xA1, 0x03,
-    0xE2, 0x69, 0xFC, 0xA0, 0x10, 0x42, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xCE, 0x03, 0xD1, 0x61, 0x63, 0x65, 0x66,
-    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0x67, 0xFF, 0x9E, 0xF3, 0x89, 0xFF, 0xA7, 0xFF, 0xB2, 0xF3,
-    0x7E, 0xFF, 0xB5, 0xFB, 0xD5, 0xFF, 0xC8, 0xED, 0x17, 0xFF, 0xDA, 0xFF, 0xEB, 0xFF, 0xF2, 0xF5, 0x75, 0xFF, 0xFD,
-    0xC1, 0x01, 0xF1, 0x69, 0xF3, 0x93, 0x41, 0x6F, 0xF3, 0x4E, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD, 0xC2, 0x01, 0x91,
-    0x61, 0x65, 0xFF, 0xFD, 0xF5, 0x38, 0x21, 0x72, 0xF7, 0x42, 0x6D, 0x61, 0xEC, 0x64, 0xEC, 0x67, 0x42, 0x63, 0x6D,
-    0xF3, 0x2E, 0xEC, 0x57, 0xC4, 0x06, 0x33, 0x61, 0x65, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xF9, 0xEC, 0x56,
-    0xC1, 0x02, 0x41, 0x72, 0xF3, 0xB0, 0x41, 0x63, 0xF3, 0x54, 0xA1, 0x00, 0x51, 0x6E, 0xFC, 0xC1, 0x02, 0xE1, 0x72,
-    0xEC, 0x4A, 0x42, 0x69, 0x6F, 0xEC, 0x4A, 0xFF, 0xFA, 0x44, 0x61, 0x65, 0x67, 0x74, 0xEC, 0x2B, 0xF4, 0x1C, 0xEC,
-    0x3D, 0xEC, 0x43, 0xA0, 0x16, 0x73, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x44, 0x61, 0x69, 0x6C, 0x68, 0xF3, 0x28,
-    0xFC, 0x1A, 0xF3, 0x7E, 0xFF, 0xFD, 0x41, 0x6E, 0xED, 0x97, 0x42, 0x62, 0x6F, 0xF2, 0xD5, 0xFF, 0xFC, 0xC1, 0x00,
-    0x61, 0x65, 0xEB, 0xF7, 0x42, 0x65, 0x69, 0xEC, 0x0F, 0xF2, 0xD3, 0x41, 0x74, 0xEC, 0xAE, 0x21, 0x73, 0xFC, 0xCE,
-    0x03, 0xD1, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x77, 0x7A, 0x75, 0xF2, 0xF4, 0xED,
-    0x87, 0xFF, 0xA2, 0xFF, 0xAC, 0xFF, 0xB7, 0xFA, 0x1C, 0xFF, 0xBE, 0xFF, 0xD4, 0xFF, 0xE5, 0xEC, 0x26, 0xFF, 0xEC,
-    0xEC, 0x7C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x63, 0xF4, 0x84, 0x42, 0x2E, 0x69, 0xF4, 0x80, 0xFF, 0xFC, 0x42, 0x73,
-    0x74, 0xF0, 0x9C, 0xFF, 0xF9, 0x41, 0x61, 0xFA, 0xD5, 0x44, 0x61, 0x64, 0x74, 0x76, 0xEB, 0xBB, 0xF4, 0x6E, 0xFF,
-    0xFC, 0xEB, 0xA6, 0xC1, 0x02, 0xE1, 0x65, 0xEB, 0xAB, 0x21, 0x69, 0xFA, 0xC4, 0x00, 0xD1, 0x66, 0x6E, 0x73, 0x74,
-    0xEB, 0xA8, 0xF3, 0x81, 0xEB, 0x8A, 0xFF, 0xFD, 0x42, 0x6C, 0x6F, 0xEB, 0x81, 0xEB, 0xA2, 0xA0, 0x16, 0xA2, 0x21,
-    0x64, 0xFD, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xEE, 0x54, 0x21, 0x63, 0xFC, 0x44, 0x70, 0x73, 0x63, 0x65, 0xFF, 0xE9,
-    0xEC, 0x01, 0xFF, 0xF6, 0xFF, 0xFD, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0xAC, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF,
-    0xF3, 0xF0, 0x5A, 0xA0, 0x06, 0x63, 0x42, 0x67, 0x74, 0xF2, 0x26, 0xF2, 0x1E, 0x42, 0x62, 0x6E, 0xEB, 0x43, 0xFF,
-    0xF9, 0x41, 0x75, 0xF3, 0x2D, 0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xEC, 0xCA, 0xA0, 0x16, 0xC3, 0x21, 0x63, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xC6, 0x03, 0xE2, 0x61, 0x65, 0x69, 0x75, 0x77, 0x72, 0xFF, 0xDF,
-    0xF9, 0xC0, 0xFF, 0xEA, 0xEB, 0x25, 0xF3, 0x13, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x74, 0xF3, 0x5C, 0x41, 0x73, 0xEB,
-    0x07, 0x42, 0x69, 0x75, 0xFF, 0xFC, 0xF3, 0x0F, 0x42, 0x69, 0x74, 0xF3, 0xC4, 0xFF, 0xF9, 0x43, 0x61, 0x65, 0x69,
-    0xF4, 0xFA, 0xF2, 0x44, 0xF2, 0x5E, 0x42, 0x69, 0x79, 0xF1, 0xFE, 0xF1, 0xC7, 0xA0, 0x06, 0x92, 0xA0, 0x16, 0xF3,
-    0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x22, 0x62, 0x6E, 0xF4, 0xFD, 0x42, 0x61, 0x69, 0xFF, 0xFB, 0xF3, 0xE6, 0xC1,
-    0x03, 0xD1, 0x73, 0xEB, 0x8D, 0x42, 0x65, 0x76, 0xF2, 0x2F, 0xFB, 0xC7, 0xC2, 0x06, 0xB2, 0x69, 0x72, 0xFF, 0xF9,
-    0xF1, 0x90, 0x4A, 0x64, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xEA, 0xCE, 0xF2, 0xA7, 0xFF, 0xA9,
-    0xFF, 0xBA, 0xFF, 0xC1, 0xF2, 0xC2, 0xFF, 0xCB, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF, 0xF7, 0xA0, 0x03, 0xD1, 0x50, 0x61,
-    0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x71, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xFC, 0x5C, 0xFC, 0x91,
-    0xFC, 0xE3, 0xFD, 0x6A, 0xFD, 0xE7, 0xFE, 0x14, 0xFE, 0x3E, 0xF1, 0x68, 0xFE, 0xAB, 0xF3, 0x06, 0xFF, 0x37, 0xFF,
-    0x47, 0xFF, 0x72, 0xFF, 0xDE, 0xFF, 0xFD, 0xEA, 0xD1, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x22, 0x41, 0x67, 0xEA, 0x6F,
-    0x43, 0x64, 0x6B, 0x79, 0xEA, 0x7A, 0xEA, 0x7A, 0xF1, 0x2A, 0x41, 0x62, 0xED, 0x77, 0xC3, 0x02, 0x71, 0x69, 0x6F,
-    0x61, 0xFB, 0xF8, 0xF1, 0x1C, 0xFF, 0xFC, 0xC1, 0x05, 0x22, 0x65, 0xEA, 0x57, 0x41, 0x65, 0xF9, 0x7B, 0x21, 0x6E,
-    0xFC, 0x21, 0x6F, 0xFD, 0xCC, 0x06, 0xD2, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x6C,
-    0xF2, 0xF7, 0xFF, 0xCC, 0xEA, 0x2C, 0xF1, 0x00, 0xF9, 0x57, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF,
-    0xF0, 0xF2, 0xF7, 0xFF, 0xFD, 0x41, 0x62, 0xF1, 0x05, 0xA0, 0x09, 0xA2, 0x21, 0x62, 0xFD, 0xA2, 0x07, 0x42, 0x61,
-    0x69, 0xF6, 0xFD, 0x41, 0x73, 0xF2, 0x96, 0x42, 0x66, 0x6C, 0xEA, 0x14, 0xFF, 0xFC, 0x42, 0x69, 0x6F, 0xEA, 0x07,
-    0xF1, 0x6E, 0x41, 0x6E, 0xEF, 0x2E, 0x41, 0x6C, 0xF1, 0x4A, 0xA0, 0x17, 0x22, 0x21, 0x72, 0xFD, 0x41, 0x61, 0xFC,
-    0xC5, 0x21, 0x6E, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x44, 0x61, 0x69, 0x6F, 0x6C, 0xFF, 0xE6, 0xFF, 0xEA, 0xFB,
-    0xF8, 0xFF, 0xFB, 0xA0, 0x03, 0xE2, 0x41, 0x2E, 0xF0, 0x8C, 0x41, 0x66, 0xF0, 0x93, 0xA0, 0x07, 0x62, 0x42, 0x65,
-    0x71, 0xE9, 0xAA, 0xFF, 0xFD, 0x42, 0x69, 0x6F, 0xFF, 0xF9, 0xF0, 0x85, 0xC1, 0x02, 0x71, 0x2E, 0xE9, 0xBA, 0x42,
-    0x63, 0x6C, 0xFF, 0xFA, 0xF0, 0x78, 0x41, 0x73, 0xF0, 0xFE, 0x43, 0x6E, 0x72, 0x73, 0xFF, 0xFC, 0xE9, 0xB8, 0xF3,
-    0x96, 0xC3, 0x01, 0x41, 0x2E, 0x69, 0x6F, 0xF2, 0x4F, 0xFF, 0xEB, 0xFF, 0xF6, 0x41, 0x66, 0xE9, 0xA2, 0x21, 0x69,
-    0xFC, 0xC4, 0x03, 0xD1, 0x61, 0x6F, 0x74, 0x75, 0xF3, 0x86, 0xF0, 0x87, 0xFF, 0xFD, 0xF0, 0x87, 0xC3, 0x01, 0xF1,
-    0x61, 0x69, 0x75, 0xF0, 0x78, 0xE9, 0x5F, 0xF3, 0x6A, 0x41, 0x7A, 0xE9, 0x7A, 0x21, 0x69, 0xFC, 0x44, 0x68, 0x6D,
-    0x6E, 0x73, 0xF1, 0x43, 0xF2, 0x1A, 0xFF, 0xFD, 0xE9, 0x6A, 0x42, 0x69, 0x72, 0xE9, 0x57, 0xF0, 0x58, 0xC6, 0x00,
-    0xD1, 0x2E, 0x63, 0x6F, 0x74, 0x75, 0x69, 0xF0, 0x6F, 0xF0, 0x7E, 0xFC, 0x2C, 0xFF, 0xF9, 0xF0, 0xA7, 0xF9, 0x43,
-    0x41, 0x63, 0xF3, 0x2E, 0xC2, 0x01, 0xF1, 0x6F, 0x69, 0xF3, 0x2A, 0xFF, 0xFC, 0x41, 0x6C, 0xE9, 0x2E, 0xA1, 0x01,
-    0xF1, 0x69, 0xFC, 0xA0, 0x17, 0x42, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x69, 0xFD, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x79, 0x66, 0xF8, 0x29, 0xFF, 0x0E, 0xFF, 0x15, 0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x46, 0xFF, 0x4A, 0xFF, 0x58, 0xFF,
-    0x7A, 0xFF, 0x8D, 0xFF, 0x9C, 0xF0, 0x50, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xDC, 0xFF, 0xE9, 0xEF, 0xD2, 0xFF, 0xFD,
-    0xA0, 0x02, 0x22, 0x21, 0x74, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x79, 0xF0, 0xB5, 0xFF, 0xFD, 0xF0, 0x04, 0xEF, 0xF5,
-    0xA0, 0x07, 0x82, 0xC1, 0x07, 0xA3, 0x62, 0xE8, 0xCC, 0x42, 0x6D, 0x69, 0xF0, 0x17, 0xE9, 0x10, 0x43, 0x61, 0x65,
-    0x74, 0xFF, 0xF9, 0xF0, 0x98, 0xF0, 0xB3, 0xA0, 0x07, 0xD2, 0x21, 0x6E, 0xFD, 0x41, 0x72, 0xE9, 0x2A, 0xA1, 0x02,
-    0xB1, 0x66, 0xFC, 0x41, 0x74, 0xF2, 0x96, 0x21, 0x61, 0xFC, 0x41, 0x2E, 0xF0, 0x93, 0xC1, 0x02, 0xE1, 0x7A, 0xEF,
-    0x5F, 0xC3, 0x02, 0xB1, 0x61, 0x65, 0x69, 0xFD, 0xE6, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x03, 0xD1, 0x67, 0xE8, 0x89,
-    0xC2, 0x01, 0xF1, 0x6E, 0x72, 0xF2, 0x70, 0xF2, 0x70, 0xC2, 0x00, 0xD1, 0x65, 0x74, 0xFF, 0xF7, 0xEB, 0xD3, 0xA0,
-    0x07, 0xF2, 0xC2, 0x00, 0x61, 0x69, 0x74, 0xF1, 0x1E, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0x7E, 0xA0, 0x08, 0x12, 0xA0,
-    0x0F, 0x02, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x65, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64,
-    0x65, 0x66, 0x67, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x6D, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0x90, 0xF0,
-    0x43, 0xFF, 0x9D, 0xFF, 0xA4, 0xF1, 0x8B, 0xFF, 0xAD, 0xFF, 0xBA, 0xFF, 0xC6, 0xFE, 0x56, 0xFF, 0xD5, 0xFF, 0xE1,
-    0xFF, 0xEA, 0xFF, 0xEE, 0xFF, 0xFD, 0xA0, 0x05, 0x52, 0x42, 0x2E, 0x73, 0xF0, 0x0F, 0xEE, 0xD4, 0x41, 0x64, 0xFE,
-    0x3E, 0x44, 0x2E, 0x64, 0x73, 0x61, 0xF0, 0x04, 0xF0, 0x04, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x17, 0x63, 0x21, 0x65,
-    0xFD, 0x46, 0x61, 0x65, 0x6F, 0x75, 0x79, 0x69, 0xF8, 0xE6, 0xFF, 0xED, 0xF7, 0x27, 0xF8, 0xE6, 0xF7, 0x0D, 0xFF,
-    0xFD, 0xA0, 0x08, 0x33, 0x43, 0x61, 0x69, 0x6F, 0xEF, 0x38, 0xE7, 0xC9, 0xF6, 0xB1, 0x41, 0x69, 0xF6, 0xB4, 0x42,
-    0x61, 0x69, 0xF2, 0xBB, 0xE7, 0xBB, 0x41, 0x64, 0xE7, 0xCC, 0x41, 0x70, 0xE7, 0xB6, 0x41, 0x74, 0xF8, 0xB3, 0xA0,
-    0x17, 0x92, 0x21, 0x64, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xD0, 0x03, 0xD1, 0x2E, 0x64, 0x65, 0x66, 0x67,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x78, 0x77, 0xEF, 0xAE, 0xF2, 0xF8, 0xF0, 0x6A, 0xF9, 0x08,
-    0xEF, 0x93, 0xFF, 0xD3, 0xFF, 0xDD, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xEC, 0xEF, 0x93, 0xEF, 0xAE, 0xFF, 0xF0, 0xEF,
-    0x0B, 0xEF, 0xAE, 0xFF, 0xFD, 0x41, 0x6F, 0xEB, 0xD2, 0x42, 0x67, 0x69, 0xFF, 0xFC, 0xEE, 0x3C, 0xA0, 0x17, 0xB2,
-    0x21, 0x6C, 0xFD, 0xA1, 0x02, 0xE1, 0x61, 0xFD, 0xC2, 0x00, 0x51, 0x61, 0x6E, 0xE8, 0x68, 0xFF, 0xFB, 0x41, 0x61,
-    0xF7, 0x0D, 0x21, 0x74, 0xFC, 0xA0, 0x17, 0xD3, 0x21, 0x67, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x44, 0x62,
-    0x6C, 0x66, 0x70, 0xE7, 0x3D, 0xE7, 0x37, 0xFF, 0xF1, 0xFF, 0xFD, 0xA0, 0x18, 0x02, 0x21, 0x64, 0xFD, 0x21, 0x65,
-    0xFD, 0x43, 0x70, 0x77, 0x6D, 0xE7, 0x27, 0xED, 0xF8, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0xE5, 0x21, 0x6C, 0xFC, 0x21,
-    0x70, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFF, 0xA8, 0xFF, 0xBA, 0xFF, 0xD6, 0xFF, 0xEC,
-    0xFF, 0xFD, 0xED, 0xE4, 0xC3, 0x08, 0x63, 0x70, 0x77, 0x79, 0xEE, 0x67, 0xEE, 0xEF, 0xEE, 0xEF, 0x41, 0x62, 0xEE,
-    0x41, 0x42, 0x68, 0x61, 0xEE, 0x1F, 0xFF, 0xFC, 0x41, 0x2E, 0xF0, 0xEC, 0xA1, 0x08, 0x92, 0x6C, 0xFC, 0x42, 0x2E,
-    0x73, 0xED, 0xAF, 0xED, 0xAF, 0xC3, 0x02, 0x81, 0x61, 0x65, 0x74, 0xEF, 0x49, 0xE9, 0xD2, 0xFF, 0xF9, 0x41, 0x65,
-    0xEE, 0x1A, 0x41, 0x62, 0xE7, 0x04, 0xC1, 0x01, 0x91, 0x65, 0xEE, 0x2C, 0xA0, 0x18, 0x23, 0x21, 0x6C, 0xFD, 0x21,
-    0x6F, 0xFD, 0x21, 0x70, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x63, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x6F, 0xFF, 0xCE,
-    0xFF, 0xDA, 0xEE, 0xAC, 0xEE, 0x1A, 0xFF, 0xE6, 0xFF, 0xEA, 0xEE, 0x1A, 0xFF, 0xEE, 0xFF, 0xFD, 0x42, 0x65, 0x70,
-    0xED, 0xFC, 0xE6, 0xAB, 0xC2, 0x02, 0x11, 0x6E, 0x73, 0xEF, 0x54, 0xFF, 0xF9, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFC,
-    0x54, 0xEE, 0xF5, 0xED, 0x57, 0xFC, 0x85, 0xFD, 0x82, 0xF5, 0x35, 0xFD, 0xBF, 0xFD, 0xCC, 0xFE, 0x4C, 0xEE, 0xF5,
-    0xFE, 0x7D, 0xFE, 0x9E, 0xEE, 0xF5, 0xFE, 0xB1, 0xFE, 0xE1, 0xEE, 0xF5, 0xFF, 0x70, 0xFF, 0x85, 0xFF, 0x95, 0xFF,
-    0xD2, 0xEE, 0xF5, 0xEE, 0xF5, 0xFF, 0xF7, 0xA0, 0x07, 0x42, 0xC1, 0x00, 0x61, 0x69, 0xEA, 0x57, 0xC1, 0x02, 0x31,
-    0x72, 0xED, 0x10, 0x21, 0x65, 0xFA, 0xC2, 0x02, 0x31, 0x65, 0x6F, 0xE9, 0x26, 0xF8, 0xF6, 0x41, 0x65, 0xE8, 0xC2,
-    0xA0, 0x0B, 0xA2, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0x64, 0x69, 0xEC, 0xE9, 0xFF, 0xFD, 0x42, 0x63, 0x6C,
-    0xE6, 0x0E, 0xE6, 0x0E, 0xC1, 0x00, 0xD1, 0x65, 0xE7, 0x96, 0x46, 0x61, 0x63, 0x65, 0x69, 0x6B, 0x74, 0xE6, 0x13,
-    0xE6, 0x01, 0xF0, 0xD7, 0xFF, 0xF3, 0xE6, 0x19, 0xFF, 0xFA, 0x43, 0x70, 0x73, 0x74, 0xEC, 0xCA, 0xED, 0x3D, 0xE7,
-    0x7D, 0x41, 0x66, 0xEC, 0xB8, 0xA0, 0x07, 0xB2, 0xC4, 0x02, 0x81, 0x65, 0x68, 0x69, 0x75, 0xE8, 0xAE, 0xE7, 0x6F,
-    0xFF, 0xF9, 0xFF, 0xFD, 0xC3, 0x02, 0x81, 0x65, 0x69, 0x6F, 0xF7, 0x19, 0xE5, 0xE6, 0xE5, 0xE6, 0x4B, 0x62, 0x63,
-    0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0xFF, 0x85, 0xF1, 0x45, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0x97,
-    0xFF, 0xA0, 0xFF, 0xAD, 0xFF, 0xC1, 0xFF, 0xD4, 0xFF, 0xE5, 0xFF, 0xF4, 0x42, 0x2E, 0x73, 0xED, 0x91, 0xED, 0x91,
-    0x42, 0x6C, 0x6E, 0xFF, 0xF9, 0xED, 0x8A, 0x41, 0x74, 0xED, 0x83, 0xC3, 0x03, 0xE2, 0x65, 0x69, 0x72, 0xFF, 0xF5,
-    0xFF, 0xFC, 0xEC, 0xDD, 0x42, 0x64, 0x6E, 0xED, 0x73, 0xE6, 0x59, 0x41, 0x73, 0xEE, 0x8E, 0xA1, 0x02, 0xB1, 0x73,
-    0xFC, 0x42, 0x63, 0x65, 0xEC, 0x6C, 0xEC, 0x4E, 0x42, 0x69, 0x79, 0xFF, 0xF9, 0xEC, 0x47, 0xC1, 0x00, 0x51, 0x65,
-    0xEC, 0x38, 0xC4, 0x02, 0x81, 0x62, 0x66, 0x6D, 0x74, 0xED, 0x4F, 0xFF, 0xF3, 0xEC, 0x71, 0xFF, 0xFA, 0x41, 0x6D,
-    0xED, 0x40, 0x42, 0x61, 0x75, 0xFF, 0xFC, 0xEE, 0x40, 0x41, 0x65, 0xED, 0x35, 0x42, 0x6D, 0x70, 0xED, 0x31, 0xFF,
-    0xFC, 0xC2, 0x02, 0x11, 0x61, 0x6F, 0xEC, 0x4C, 0xE5, 0x51, 0x44, 0x6C, 0x6D, 0x6E, 0x72, 0xEC, 0x61, 0xFF, 0xF0,
-    0xF1, 0x37, 0xFF, 0xF7, 0xA1, 0x02, 0xB1, 0x65, 0xD4, 0x42, 0x61, 0x65, 0xEC, 0xA0, 0xEC, 0x87, 0xC1, 0x01, 0x41,
-    0x61, 0xEC, 0x2A, 0xA1, 0x02, 0xB1, 0x6C, 0xFA, 0x41, 0x61, 0xEE, 0xBD, 0x4A, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6F,
-    0x72, 0x74, 0x75, 0x68, 0xFF, 0x86, 0xE8, 0x75, 0xFF, 0x91, 0xFF, 0xAA, 0xFF, 0xBD, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF,
-    0xEA, 0xFF, 0xF7, 0xFF, 0xFC, 0xA0, 0x03, 0x42, 0x42, 0x72, 0x73, 0xEE, 0x94, 0xE4, 0xE6, 0xC6, 0x01, 0x91, 0x61,
-    0x62, 0x63, 0x6D, 0x74, 0x7A, 0xEC, 0x2E, 0xEB, 0xF2, 0xEC, 0x6E, 0xEB, 0xF2, 0xEC, 0x1F, 0xE4, 0xF7, 0xC2, 0x01,
-    0x91, 0x6C, 0x6E, 0xEC, 0xBB, 0xE5, 0x85, 0x41, 0x67, 0xEC, 0x01, 0x21, 0x6E, 0xFC, 0xC2, 0x01, 0x41, 0x6F, 0x69,
-    0xEB, 0x96, 0xFF, 0xFD, 0x21, 0x6C, 0xF7, 0x41, 0x6C, 0xE4, 0xBA, 0x48, 0x61, 0x64, 0x65, 0x69, 0x6F, 0x72, 0x75,
-    0x67, 0xFF, 0xC1, 0xF7, 0x18, 0xFF, 0xC4, 0xFF, 0xCB, 0xFF, 0xE0, 0xED, 0x34, 0xFF, 0xF9, 0xFF, 0xFC, 0x42, 0x69,
-    0x79, 0xE4, 0xA3, 0xEB, 0xFA, 0xA0, 0x08, 0xB2, 0xC1, 0x02, 0x82, 0x74, 0xE4, 0x81, 0x4A, 0x63, 0x64, 0x66, 0x6C,
-    0x6D, 0x6E, 0x70, 0x73, 0x74, 0x78, 0xEE, 0x86, 0xE7, 0x60, 0xEE, 0x86, 0xFF, 0xF0, 0xEE, 0x86, 0xF5, 0x1E, 0xFF,
-    0xF7, 0xFF, 0xFA, 0xF2, 0x38, 0xEB, 0x55, 0x41, 0x65, 0xFE, 0x82, 0x21, 0x72, 0xFC, 0xC1, 0x01, 0x41, 0x69, 0xED,
-    0x23, 0x41, 0x65, 0xEB, 0x52, 0x21, 0x74, 0xFC, 0x42, 0x65, 0x69, 0xEB, 0x9D, 0xFF, 0xFD, 0x44, 0x63, 0x6C, 0x6E,
-    0x74, 0xFF, 0xEC, 0xE4, 0x41, 0xFF, 0xF9, 0xEC, 0x53, 0x41, 0x65, 0xEA, 0x0C, 0x21, 0x72, 0xFC, 0x41, 0x2E, 0xEC,
-    0x24, 0x21, 0x65, 0xFC, 0x21, 0x73, 0xFD, 0xC5, 0x02, 0xB1, 0x65, 0x66, 0x69, 0x6F, 0x75, 0xFF, 0xCB, 0xF9, 0x92,
-    0xFF, 0xE2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x6C, 0xEA, 0xE8, 0xA0, 0x08, 0xD2, 0x44, 0x62, 0x63, 0x6E, 0x74, 0xEA,
-    0xEC, 0xEB, 0x79, 0xEB, 0x1B, 0xFF, 0xFD, 0x42, 0x6C, 0x72, 0xEB, 0x43, 0xEA, 0xD7, 0x47, 0x61, 0x65, 0x69, 0x6E,
-    0x6F, 0x75, 0x79, 0xFF, 0xE5, 0xE5, 0x96, 0xFF, 0xEC, 0xEA, 0xD8, 0xFE, 0x5C, 0xFF, 0xF9, 0xEC, 0xC4, 0xC1, 0x07,
-    0x42, 0x65, 0xE5, 0x80, 0xC1, 0x00, 0xD1, 0x6C, 0xEA, 0xBC, 0x43, 0x66, 0x67, 0x73, 0xEB, 0x29, 0xEC, 0x4C, 0xEB,
-    0x22, 0x43, 0x65, 0x68, 0x79, 0xE3, 0xE2, 0xEA, 0xE3, 0xEA, 0xA4, 0xC7, 0x02, 0x81, 0x63, 0x64, 0x67, 0x6D, 0x6E,
-    0x72, 0x74, 0xEA, 0x9A, 0xEA, 0xA2, 0xFF, 0xE6, 0xFC, 0xD4, 0xFF, 0xEC, 0xE8, 0xC3, 0xFF, 0xF6, 0xC1, 0x01, 0x41,
-    0x69, 0xEA, 0x8A, 0x21, 0x64, 0xFA, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x41, 0x6E, 0xE3, 0xA0, 0x42, 0x69, 0x6C, 0xFF,
-    0xFC, 0xF4, 0x39, 0x41, 0x64, 0xE3, 0x8F, 0x41, 0x69, 0xEC, 0x3D, 0x41, 0x61, 0xE8, 0xD6, 0xC6, 0x02, 0xB1, 0x2E,
-    0x63, 0x6E, 0x74, 0x77, 0x78, 0xEB, 0x7A, 0xEB, 0x7A, 0xFF, 0xF4, 0xFF, 0xF8, 0xEB, 0x7A, 0xFF, 0xFC, 0x41, 0x72,
-    0xEC, 0x87, 0x48, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6E, 0x72, 0x73, 0xEA, 0xBF, 0xFF, 0xFC, 0xEC, 0x38, 0xEB, 0x61,
-    0xEA, 0xFF, 0xEA, 0x44, 0xED, 0x1E, 0xEB, 0xE2, 0x42, 0x2E, 0x61, 0xEC, 0x50, 0xEA, 0x6A, 0x41, 0x67, 0xFD, 0x70,
-    0xC1, 0x02, 0x11, 0x68, 0xEA, 0x28, 0xA0, 0x08, 0xF2, 0x41, 0x73, 0xE9, 0xA3, 0x21, 0x69, 0xFC, 0xCA, 0x02, 0x81,
-    0x62, 0x63, 0x65, 0x67, 0x6D, 0x6E, 0x6F, 0x73, 0x76, 0x74, 0xFC, 0x71, 0xFF, 0xE5, 0xED, 0xDD, 0xF0, 0x96, 0xEA,
-    0x10, 0xFF, 0xEC, 0xEA, 0x8B, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFD, 0xC1, 0x01, 0x91, 0x62, 0xEA, 0x84, 0x42, 0x61,
-    0x6F, 0xFF, 0xFA, 0xE3, 0x0F, 0x44, 0x63, 0x67, 0x70, 0x61, 0xE9, 0xE2, 0xE9, 0xEA, 0xEF, 0x7B, 0xEB, 0x80, 0x41,
-    0x68, 0xED, 0x06, 0x42, 0x64, 0x67, 0xE9, 0xD1, 0xE9, 0xD9, 0x49, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x73, 0x74,
-    0x75, 0xFF, 0x6D, 0xFF, 0x86, 0xEC, 0xFB, 0xFF, 0xBA, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF5, 0xF3, 0x93, 0xFF, 0xF9,
-    0xC1, 0x01, 0x71, 0x61, 0xE9, 0xB6, 0x43, 0x63, 0x67, 0x6E, 0xEA, 0xC5, 0xEA, 0xC5, 0xFF, 0xFA, 0xC2, 0x02, 0xB1,
-    0x6C, 0x74, 0xE9, 0xFB, 0xEA, 0xBB, 0xC2, 0x09, 0x12, 0x65, 0x69, 0xE9, 0x9D, 0xEC, 0x76, 0xC2, 0x01, 0x41, 0x68,
-    0x73, 0xE9, 0x94, 0xE9, 0x8C, 0x46, 0x63, 0x65, 0x67, 0x6E, 0x73, 0x7A, 0xEA, 0x3E, 0xE2, 0xAF, 0xFF, 0x3B, 0xFF,
-    0xEE, 0xFF, 0xF7, 0xE9, 0xC2, 0x41, 0x6F, 0xE2, 0xC3, 0x21, 0x69, 0xFC, 0x42, 0x67, 0x6E, 0xE2, 0x95, 0xFF, 0xFD,
-    0xC1, 0x01, 0x41, 0x61, 0xE9, 0x6A, 0x42, 0x6C, 0x6E, 0xFF, 0xFA, 0xE2, 0x9A, 0x49, 0x61, 0x62, 0x65, 0x69, 0x6E,
-    0x6F, 0x70, 0x75, 0x79, 0xFF, 0xAD, 0xE9, 0x5D, 0xFF, 0xB7, 0xFF, 0xD2, 0xEC, 0x72, 0xFF, 0xEC, 0xEA, 0x90, 0xFF,
-    0xF9, 0xE9, 0xD0, 0x42, 0x6D, 0x6E, 0xEC, 0xF1, 0xFC, 0xD3, 0x41, 0x65, 0xE3, 0xF8, 0x21, 0x68, 0xFC, 0x42, 0x63,
-    0x78, 0xE9, 0x6A, 0xE9, 0x97, 0x21, 0x69, 0xF9, 0x42, 0x69, 0x74, 0xE9, 0x29, 0xE9, 0x29, 0x47, 0x61, 0x65, 0x6D,
-    0x72, 0x73, 0x74, 0x77, 0xE9, 0x1A, 0xE9, 0x1A, 0xE9, 0x59, 0xEC, 0xD2, 0xFF, 0xF9, 0xF1, 0xAB, 0xE9, 0x95, 0x48,
-    0x63, 0x65, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x7A, 0xED, 0x2E, 0xE9, 0x04, 0xE9, 0x04, 0xE9, 0x7F, 0xEB, 0xF3, 0xE9,
-    0x43, 0xE9, 0x04, 0xEA, 0xF8, 0xC3, 0x01, 0x91, 0x67, 0x73, 0x76, 0xE2, 0x17, 0xEA, 0x08, 0xE9, 0x2A, 0x41, 0x67,
-    0xE6, 0x28, 0x41, 0x73, 0xE8, 0xD8, 0x21, 0x65, 0xFC, 0x22, 0x61, 0x68, 0xF5, 0xFD, 0x42, 0x61, 0x66, 0xE9, 0x0E,
-    0xE8, 0xD7, 0x4C, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xFF, 0x8F, 0xFF, 0x9A,
-    0xFF, 0xA4, 0xFF, 0xAE, 0xFF, 0xC4, 0xE8, 0xC5, 0xFF, 0xDD, 0xEB, 0x75, 0xFF, 0xF4, 0xFF, 0xF9, 0xEA, 0x3F, 0xF4,
-    0x62, 0x41, 0x70, 0xE8, 0xE2, 0x21, 0x61, 0xFC, 0xA1, 0x02, 0x81, 0x72, 0xFD, 0xA0, 0x09, 0x32, 0x41, 0x61, 0xE4,
-    0x60, 0xC2, 0x02, 0xB1, 0x65, 0x6F, 0xE8, 0xCF, 0xE9, 0xB7, 0xC1, 0x01, 0x41, 0x6F, 0xE9, 0x1C, 0x4A, 0x66, 0x67,
-    0x69, 0x6C, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xE8, 0x81, 0xFF, 0xE5, 0xFF, 0xEA, 0xE8, 0xFC, 0xFF, 0xED, 0xFF,
-    0xF1, 0xE1, 0xAD, 0xFF, 0xFA, 0xE8, 0xF5, 0xE8, 0x81, 0xC2, 0x02, 0x11, 0x69, 0x6E, 0xE8, 0xDD, 0xEA, 0x7F, 0x41,
-    0x69, 0xEC, 0x11, 0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x43, 0x6C, 0x6E, 0x74, 0xE8, 0x4F, 0xEC, 0xFE, 0xFF, 0xFD,
-    0x43, 0x63, 0x64, 0x68, 0xFE, 0xE3, 0xE9, 0x62, 0xE8, 0x84, 0xC1, 0x02, 0x21, 0x62, 0xE9, 0x58, 0x22, 0x65, 0x6F,
-    0xF0, 0xFA, 0x41, 0x69, 0xE8, 0x46, 0x41, 0x74, 0xFE, 0xCA, 0xA0, 0x18, 0x55, 0x21, 0x68, 0xFD, 0x21, 0x70, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x4A, 0x61, 0x65, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x69, 0xFF, 0xB7,
-    0xFF, 0xCA, 0xE1, 0xDC, 0xE9, 0xCF, 0xE9, 0xB7, 0xFF, 0xE4, 0xED, 0x54, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xFD, 0xA0,
-    0x09, 0x53, 0x42, 0x6C, 0x73, 0xE2, 0xB2, 0xFF, 0xFD, 0x21, 0x69, 0xF9, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x41, 0x64,
-    0xE7, 0xE5, 0x41, 0x69, 0xF7, 0x55, 0xC4, 0x01, 0xF1, 0x62, 0x6E, 0x72, 0x74, 0xE1, 0x0C, 0xFF, 0xF8, 0xE8, 0x1F,
-    0xFF, 0xFC, 0xC1, 0x02, 0x41, 0x6C, 0xE8, 0x66, 0xC1, 0x01, 0xE1, 0x65, 0xE8, 0x60, 0x21, 0x68, 0xFA, 0x41, 0x6C,
-    0xE8, 0x3D, 0x44, 0x61, 0x63, 0x65, 0x74, 0xE7, 0xC6, 0xEC, 0x40, 0xE7, 0xBB, 0xE7, 0xFD, 0x42, 0x73, 0x74, 0xE7,
-    0xB9, 0xE7, 0xF0, 0x4A, 0x2E, 0x61, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0xEF, 0xFE, 0xFF, 0xE8, 0xE1,
-    0x81, 0xF2, 0x21, 0xE8, 0x5E, 0xED, 0x2A, 0xFF, 0xEC, 0xE0, 0xD6, 0xFF, 0xF9, 0xE0, 0xD0, 0xA0, 0x18, 0xA3, 0x21,
-    0x2E, 0xFD, 0xA1, 0x09, 0x82, 0x6E, 0xFD, 0x41, 0x6B, 0xE9, 0x74, 0x42, 0x6E, 0x72, 0xE7, 0xF7, 0xE0, 0xA8, 0xC1,
-    0x00, 0x51, 0x61, 0xE8, 0x92, 0xC8, 0x01, 0xF1, 0x61, 0x63, 0x65, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xEA, 0xFF,
-    0xEF, 0xFF, 0xF3, 0xE9, 0xEF, 0xE9, 0x0D, 0xE7, 0x6C, 0xE8, 0x04, 0xFF, 0xFA, 0xA0, 0x07, 0xE2, 0x43, 0x73, 0x74,
-    0x7A, 0xE7, 0xE6, 0xE7, 0x4E, 0xE9, 0x45, 0x42, 0x69, 0x6F, 0xFF, 0xF6, 0xE7, 0x86, 0xC4, 0x02, 0x41, 0x62, 0x63,
-    0x72, 0x75, 0xE7, 0x48, 0xE7, 0x40, 0xE0, 0x6C, 0xE7, 0xAC, 0xC1, 0x01, 0xF1, 0x65, 0xEB, 0x57, 0x43, 0x65, 0x6C,
-    0x77, 0xE2, 0xF7, 0xE7, 0x28, 0xE7, 0x6A, 0xC1, 0x01, 0x91, 0x74, 0xE0, 0x4D, 0x41, 0x75, 0xE9, 0x0F, 0x21, 0x61,
-    0xFC, 0x4D, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34, 0xFF, 0x43,
-    0xFF, 0x4F, 0xFF, 0x6A, 0xE7, 0x80, 0xFF, 0xA5, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF, 0xD4, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF,
-    0xF3, 0xFF, 0xFD, 0x41, 0x65, 0xFA, 0x78, 0xA1, 0x07, 0x42, 0x67, 0xFC, 0xC1, 0x02, 0x11, 0x6E, 0xE6, 0xEB, 0xC3,
-    0x02, 0x81, 0x61, 0x72, 0x75, 0xFF, 0xFA, 0xE7, 0x58, 0xE6, 0xE5, 0xC1, 0x02, 0x11, 0x72, 0xE6, 0xD9, 0x41, 0x61,
-    0xE7, 0xE8, 0x42, 0x74, 0x76, 0xFA, 0x53, 0xFF, 0xFC, 0xC3, 0x07, 0x82, 0x63, 0x6E, 0x72, 0xFF, 0xEF, 0xE8, 0xDD,
-    0xFF, 0xF9, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xE7, 0x2F, 0xE2, 0xB1, 0xC1, 0x02, 0x11, 0x65, 0xE7, 0x86, 0x41, 0x6E,
-    0xE8, 0xE4, 0xA0, 0x09, 0x42, 0x41, 0x74, 0xE0, 0x61, 0xC7, 0x02, 0xB1, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x73, 0x75,
-    0xE6, 0xF7, 0xFF, 0xEF, 0xFF, 0xF5, 0xF5, 0xC2, 0xFF, 0xF9, 0xFF, 0xFC, 0xDF, 0xC6, 0x41, 0x6E, 0xE6, 0x82, 0x21,
-    0x69, 0xFC, 0xC1, 0x02, 0x11, 0x75, 0xE6, 0xBA, 0xC1, 0x02, 0x11, 0x61, 0xE6, 0x7D, 0x22, 0x6C, 0x6E, 0xF4, 0xFA,
-    0xA0, 0x18, 0xD2, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0xC4, 0x02, 0xB1, 0x65, 0x69, 0x72, 0x61, 0xEE, 0xF2, 0xFC,
-    0x19, 0xE7, 0x35, 0xFF, 0xFD, 0xA0, 0x03, 0xA2, 0x21, 0x62, 0xFD, 0xA1, 0x02, 0x41, 0x69, 0xFD, 0x42, 0x67, 0x6D,
-    0xE6, 0x86, 0xE6, 0x4F, 0xC1, 0x04, 0x22, 0x6E, 0xE6, 0xBB, 0x41, 0x63, 0xDF, 0xB0, 0xC2, 0x02, 0x41, 0x6F, 0x75,
-    0xE6, 0x36, 0xFF, 0xFC, 0x44, 0x61, 0x69, 0x6F, 0x72, 0xF5, 0x74, 0xFF, 0xE6, 0xFF, 0xED, 0xFF, 0xF7, 0x41, 0x72,
-    0xFF, 0x4F, 0x4D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0xFF, 0x34, 0xFF,
-    0x3F, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x82, 0xFF, 0x9E, 0xE9, 0x2E, 0xFF, 0xAD, 0xFF, 0xBB, 0xFF, 0xD0, 0xFF, 0xEF,
-    0xFF, 0xFC, 0xE6, 0xB1, 0x41, 0x62, 0xDF, 0x20, 0x42, 0x6E, 0x6F, 0xFB, 0x87, 0xE6, 0x6B, 0xA0, 0x18, 0xF3, 0x21,
-    0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x6F, 0x79, 0xEF, 0x4E, 0xFF, 0xFD, 0xC1,
-    0x00, 0x41, 0x6F, 0xDE, 0xFF, 0x41, 0x69, 0xEA, 0x0D, 0x45, 0x63, 0x64, 0x6E, 0x72, 0x74, 0xE6, 0x35, 0xE8, 0xB4,
-    0xFF, 0xF6, 0xE5, 0xC9, 0xFF, 0xFC, 0x42, 0x63, 0x66, 0xE5, 0xF8, 0xE5, 0xC1, 0x42, 0x67, 0x73, 0xE5, 0xF1, 0xE5,
-    0xBA, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xE6, 0x26, 0xE6, 0x26, 0xFF, 0xF2, 0xFF, 0xF9, 0x4A, 0x61, 0x65, 0x68, 0x69,
-    0x6E, 0x6F, 0x72, 0x75, 0x79, 0x7A, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF, 0xD5, 0xE5, 0x9B, 0xFE, 0xF9, 0xFF,
-    0xF3, 0xE6, 0x59, 0xF0, 0xF7, 0xE5, 0xA6, 0x43, 0x65, 0x69, 0x72, 0xDE, 0xA5, 0xDF, 0x8D, 0xE5, 0x87, 0xA0, 0x19,
-    0x23, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xC6, 0x01, 0x91, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x63,
-    0xE5, 0x69, 0xE5, 0xE4, 0xEA, 0xE9, 0xDE, 0x95, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0, 0x09, 0xC2, 0xC1, 0x02, 0x11, 0x74,
-    0xE5, 0x59, 0x22, 0x70, 0x73, 0xF7, 0xFA, 0x42, 0x6C, 0x6F, 0xE5, 0x85, 0xE0, 0x01, 0x42, 0x67, 0x69, 0xE5, 0x3F,
-    0xDE, 0x65, 0xC1, 0x01, 0xF1, 0x62, 0xE5, 0x38, 0x44, 0x61, 0x6C, 0x6E, 0x72, 0xE5, 0x32, 0xFF, 0xEC, 0xFF, 0xF3,
-    0xFF, 0xFA, 0xC4, 0x02, 0xB1, 0x64, 0x6C, 0x6E, 0x76, 0xE5, 0x64, 0xDE, 0x51, 0xE6, 0x42, 0xDE, 0x51, 0x41, 0x63,
-    0xE5, 0x16, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xFF, 0xC7, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xFC, 0xE5, 0x12, 0xC1,
-    0x02, 0xB1, 0x67, 0xE6, 0x1F, 0x41, 0x67, 0xE5, 0x3B, 0x43, 0x6C, 0x6E, 0x74, 0xDE, 0x45, 0xFF, 0xFC, 0xE5, 0x73,
-    0x44, 0x61, 0x65, 0x68, 0x69, 0xFF, 0xEC, 0xE7, 0xD9, 0xE5, 0x69, 0xFF, 0xF6, 0x41, 0x70, 0xF3, 0x76, 0x43, 0x63,
-    0x65, 0x73, 0xE6, 0xD1, 0xF1, 0x07, 0xDE, 0x09, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0xF8, 0x3D, 0xF8, 0x71,
-    0xF8, 0xF7, 0xF9, 0x55, 0xF9, 0x7E, 0xF9, 0xD6, 0xFA, 0x03, 0xFA, 0x19, 0xFA, 0x39, 0xFA, 0x5A, 0xFA, 0x63, 0xFB,
-    0x09, 0xFB, 0x7E, 0xFC, 0x0B, 0xFC, 0x52, 0xFC, 0xBA, 0xFC, 0xE6, 0xFD, 0xBF, 0xFE, 0xB7, 0xFF, 0x35, 0xFF, 0x6A,
-    0xFF, 0xC1, 0xFF, 0xE5, 0xFF, 0xF2, 0xFF, 0xF6, 0x42, 0x6C, 0x72, 0xE4, 0xC6, 0xDD, 0xC5, 0x41, 0x6C, 0xDF, 0x7E,
-    0x42, 0x61, 0x69, 0xE5, 0xB1, 0xE8, 0x7E, 0x41, 0x68, 0xDD, 0xB9, 0xA1, 0x02, 0xE1, 0x74, 0xFC, 0x43, 0x61, 0x68,
-    0x6F, 0xE4, 0xAB, 0xE6, 0xEC, 0xE4, 0x69, 0x41, 0x6C, 0xE3, 0x71, 0xC9, 0x03, 0xD1, 0x62, 0x63, 0x67, 0x69, 0x6C,
-    0x6D, 0x72, 0x74, 0x75, 0xFF, 0xD7, 0xE5, 0x32, 0xE4, 0x5B, 0xDD, 0xF4, 0xFF, 0xDE, 0xFF, 0xE2, 0xFF, 0xED, 0xFF,
-    0xF2, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xDD, 0x66, 0xED, 0xDE, 0x41, 0x75, 0xEB, 0x9F, 0xA1, 0x02, 0x31, 0x72, 0xFC,
-    0x42, 0x61, 0x74, 0xE4, 0x2D, 0xE6, 0x24, 0xC1, 0x00, 0xD1, 0x65, 0xDD, 0x76, 0x21, 0x64, 0xFA, 0x41, 0x69, 0xE2,
-    0xB2, 0xC2, 0x00, 0x61, 0x72, 0x6D, 0xE6, 0x10, 0xFF, 0xFC, 0x4A, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x6C, 0x6D, 0x6E,
-    0x72, 0x76, 0xE4, 0x10, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xE3, 0xEC, 0x67, 0xE5, 0x4E, 0xE7, 0x47, 0xFF, 0xF0, 0xFF,
-    0xF7, 0xDD, 0x3F, 0x43, 0x65, 0x6E, 0x73, 0xE5, 0x11, 0xE5, 0xD9, 0xF3, 0x1C, 0x41, 0x79, 0xE5, 0x07, 0xC4, 0x04,
-    0x02, 0x65, 0x69, 0x6C, 0x79, 0xE6, 0x07, 0xFF, 0xF2, 0xFF, 0xFC, 0xE4, 0x43, 0x41, 0x65, 0xE3, 0xD4, 0x43, 0x6C,
-    0x6E, 0x74, 0xEC, 0x2A, 0xE4, 0x4E, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xE4, 0x44, 0xE4, 0x08, 0xC2, 0x00, 0x51, 0x61,
-    0x65, 0xE5, 0xB6, 0xE5, 0xB6, 0x47, 0x2E, 0x61, 0x65, 0x69, 0x73, 0x75, 0x68, 0xEC, 0x27, 0xFF, 0xE6, 0xFF, 0xF0,
-    0xFF, 0xF7, 0xE3, 0xB6, 0xE3, 0xF8, 0xE4, 0xF1, 0x41, 0x65, 0xE4, 0xCA, 0x41, 0x68, 0xE2, 0xAE, 0x41, 0x69, 0xE1,
-    0x2A, 0x43, 0x69, 0x6C, 0x79, 0xDC, 0xDB, 0xFF, 0xFC, 0xE3, 0x94, 0xA0, 0x09, 0xE2, 0xC5, 0x02, 0x41, 0x61, 0x64,
-    0x65, 0x67, 0x6E, 0xE5, 0x7E, 0xFE, 0x36, 0xE6, 0xBB, 0xFF, 0xFD, 0xDC, 0xB6, 0x41, 0x74, 0xDD, 0x0A, 0x41, 0x2E,
-    0xDC, 0xB8, 0x21, 0x64, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0xC8, 0x03, 0xD1, 0x61, 0x63, 0x64, 0x67, 0x6C,
-    0x6E, 0x73, 0x74, 0xE3, 0xA6, 0xFF, 0xAE, 0xFF, 0xC4, 0xFF, 0xC8, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xEF, 0xFF, 0xFD,
-    0x41, 0x73, 0xE7, 0xDC, 0x42, 0x72, 0x77, 0xE2, 0x82, 0xEA, 0xED, 0xA0, 0x03, 0x52, 0xA0, 0x18, 0xF2, 0x21, 0x6C,
-    0xFD, 0x21, 0x65, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x72, 0xE4, 0x6A, 0x21, 0x6F, 0xFC, 0xC6, 0x0A, 0x02, 0x65, 0x69,
-    0x6F, 0x79, 0x61, 0x75, 0xFF, 0xDF, 0xDC, 0xC1, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0xE1,
-    0x64, 0x74, 0xDC, 0x7F, 0xDC, 0x42, 0x42, 0x74, 0x79, 0xE3, 0x15, 0xDC, 0x51, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69,
-    0x74, 0xFF, 0xF9, 0xE1, 0x1D, 0xDC, 0x32, 0xDF, 0x9F, 0xC3, 0x03, 0xD1, 0x6E, 0x72, 0x73, 0xFF, 0xE1, 0xFF, 0xF1,
-    0xDC, 0x3B, 0x42, 0x61, 0x73, 0xE2, 0xEB, 0xDC, 0xEE, 0xC1, 0x00, 0xD1, 0x6C, 0xDC, 0x0A, 0x44, 0x61, 0x65, 0x69,
-    0x6F, 0xDD, 0x73, 0xFF, 0xF3, 0xFF, 0xFA, 0xDC, 0xEC, 0xC2, 0x02, 0x41, 0x6F, 0x79, 0xE3, 0xEE, 0xE3, 0x2E, 0x42,
-    0x69, 0x73, 0xDB, 0xEE, 0xDB, 0xF4, 0x41, 0x61, 0xE2, 0xBE, 0xC7, 0x02, 0x71, 0x65, 0x67, 0x6D, 0x6E, 0x72, 0x73,
-    0x74, 0xE3, 0xE4, 0xE2, 0xBA, 0xE3, 0x6E, 0xE7, 0x3F, 0xE3, 0xF8, 0xFF, 0xF5, 0xFF, 0xFC, 0x51, 0x61, 0x62, 0x64,
-    0x65, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xFE, 0x47, 0xEC, 0xD2, 0xE2,
-    0xA2, 0xFE, 0x92, 0xFE, 0xBF, 0xE2, 0xA2, 0xFF, 0x3E, 0xFF, 0x7A, 0xE2, 0xA2, 0xE2, 0xA2, 0xFF, 0xAE, 0xEC, 0xD2,
-    0xFF, 0xC7, 0xEB, 0x13, 0xFF, 0xD4, 0xFF, 0xE8, 0xF1, 0x3A, 0x43, 0x2E, 0x69, 0x6F, 0xE4, 0x65, 0xE3, 0xA9, 0xE2,
-    0xB0, 0xC2, 0x02, 0x41, 0x65, 0x6F, 0xE2, 0x8A, 0xE2, 0x67, 0xC1, 0x01, 0xE1, 0x61, 0xDB, 0xAB, 0x42, 0x73, 0x7A,
-    0xDB, 0x9C, 0xFF, 0xFA, 0x42, 0x69, 0x6F, 0xFF, 0xF9, 0xE2, 0x4E, 0x41, 0x6E, 0xF0, 0x92, 0x42, 0x68, 0x69, 0xDD,
-    0x01, 0xED, 0x1F, 0xC8, 0x03, 0xD1, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0xDB, 0x6B, 0xFF, 0xCE, 0xFF,
-    0xD8, 0xFF, 0xEE, 0xFF, 0xF5, 0xE4, 0xE4, 0xFF, 0xF9, 0xE2, 0x3C, 0x41, 0x7A, 0xDB, 0x4A, 0x43, 0x6E, 0x73, 0x7A,
-    0xDB, 0x4C, 0xE2, 0x28, 0xE2, 0x28, 0x42, 0x69, 0x79, 0xFF, 0xF6, 0xE2, 0x13, 0x41, 0x74, 0xE2, 0xA4, 0x41, 0x79,
-    0xEC, 0x04, 0xC5, 0x03, 0xD1, 0x61, 0x69, 0x6F, 0x79, 0x63, 0xFF, 0xF8, 0xE8, 0x08, 0xE2, 0x04, 0xE2, 0x04, 0xFF,
-    0xFC, 0xA0, 0x09, 0x72, 0xC2, 0x03, 0xD1, 0x6D, 0x64, 0xE2, 0x31, 0xFF, 0xFD, 0x41, 0x63, 0xEB, 0xE2, 0x44, 0x68,
-    0x6F, 0x79, 0x69, 0xDB, 0x32, 0xE1, 0xE2, 0xE2, 0x7A, 0xFF, 0xFC, 0x4A, 0x2E, 0x64, 0x65, 0x6C, 0x6E, 0x6F, 0x72,
-    0x73, 0x74, 0x76, 0xEA, 0x2C, 0xEA, 0x2C, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xD1, 0xFF, 0xE6, 0xFD, 0xEE, 0xF3, 0xE7,
-    0xFF, 0xF3, 0xE2, 0x6D, 0xC3, 0x0A, 0x23, 0x65, 0x6C, 0x6F, 0xE9, 0x83, 0xDF, 0xC5, 0xDA, 0xE5, 0x41, 0x75, 0xE1,
-    0xD0, 0x41, 0x65, 0xDA, 0xE1, 0x42, 0x6F, 0x77, 0xE2, 0x3A, 0xFF, 0xFC, 0x43, 0x69, 0x6F, 0x74, 0xE6, 0xDD, 0xFF,
-    0xF1, 0xFF, 0xF9, 0xC1, 0x0A, 0x52, 0x72, 0xDA, 0xD8, 0x41, 0x61, 0xE3, 0x82, 0xC2, 0x02, 0xB1, 0x69, 0x6F, 0xFF,
-    0xFC, 0xE2, 0xA7, 0x42, 0x6E, 0x73, 0xDA, 0xCE, 0xED, 0xAB, 0x41, 0x6E, 0xE1, 0xF5, 0x21, 0x65, 0xFC, 0xA0, 0x06,
-    0xB2, 0xA0, 0x0A, 0x72, 0x43, 0x2E, 0x67, 0x73, 0xFF, 0xFA, 0xDE, 0xB6, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x6C, 0xDA,
-    0x8F, 0x4D, 0x2E, 0x61, 0x63, 0x65, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0x7A, 0xE3, 0x51, 0xFF, 0xC9,
-    0xFF, 0xD3, 0xFF, 0xDC, 0xDA, 0x89, 0xFF, 0xE7, 0xFF, 0xF0, 0xE3, 0x51, 0xFF, 0xFA, 0xF9, 0x9B, 0xE1, 0xF2, 0xE3,
-    0x51, 0xE2, 0x95, 0xC2, 0x00, 0x51, 0x64, 0x73, 0xDD, 0xD2, 0xE3, 0x29, 0x41, 0x64, 0xE2, 0xCA, 0xA1, 0x03, 0xD1,
-    0x61, 0xFC, 0x41, 0x68, 0xE9, 0x01, 0x43, 0x62, 0x67, 0x73, 0xDA, 0x4B, 0xE1, 0x9A, 0xFF, 0xFC, 0xA0, 0x0A, 0xF2,
-    0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x02, 0x71, 0x72, 0x62, 0xDA, 0x4A, 0xFF, 0xFD, 0xA4, 0x02, 0x81, 0x61,
-    0x65, 0x69, 0x6F, 0xCE, 0xDB, 0xE4, 0xF7, 0xC1, 0x02, 0xB1, 0x79, 0xE2, 0x15, 0xA0, 0x06, 0xD2, 0xC2, 0x02, 0x31,
-    0x2E, 0x63, 0xE2, 0x0C, 0xFF, 0xFD, 0x41, 0x73, 0xDE, 0x83, 0x42, 0x74, 0x69, 0xDA, 0x08, 0xFF, 0xFC, 0x21, 0x74,
-    0xF9, 0xC2, 0x02, 0xB1, 0x6E, 0x6F, 0xE1, 0x35, 0xE1, 0xF5, 0xA0, 0x07, 0x32, 0x41, 0x70, 0xE1, 0x29, 0x21, 0x73,
-    0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xC3, 0x02, 0xB1, 0x6E, 0x6D, 0x72, 0xE1, 0xDD, 0xDA, 0x97, 0xFF, 0xFB, 0x24,
-    0x61, 0x65, 0x69, 0x6F, 0xC5, 0xD9, 0xDC, 0xF4, 0xA0, 0x0A, 0x93, 0xA0, 0x0A, 0xC3, 0xA0, 0x19, 0x55, 0x21, 0x61,
-    0xFD, 0xA1, 0x01, 0xE1, 0x7A, 0xFD, 0xC3, 0x00, 0xD1, 0x61, 0x64, 0x69, 0xFF, 0xF2, 0xF7, 0x2A, 0xFF, 0xFB, 0x41,
-    0x75, 0xD9, 0xD2, 0x42, 0x69, 0x6F, 0xE6, 0x8B, 0xFF, 0xFC, 0xCA, 0x03, 0xD1, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6E,
-    0x6F, 0x72, 0x73, 0x76, 0xE1, 0xBB, 0xD9, 0xC7, 0xE2, 0x77, 0xFF, 0xD8, 0xE3, 0x2C, 0xFF, 0xE9, 0xE2, 0x77, 0xFF,
-    0xF9, 0xEC, 0xAD, 0xD9, 0xBB, 0xC1, 0x01, 0x71, 0x2E, 0xD9, 0xB5, 0x21, 0x72, 0xFA, 0x44, 0x2E, 0x65, 0x69, 0x79,
-    0xE2, 0x4D, 0xFF, 0xFD, 0xED, 0xC9, 0xE0, 0x56, 0x21, 0x68, 0xF3, 0x45, 0x64, 0x69, 0x6E, 0x70, 0x79, 0xFD, 0x88,
-    0xE1, 0x66, 0xDA, 0x30, 0xFF, 0xFD, 0xE0, 0x46, 0x41, 0x73, 0xEF, 0xAA, 0x42, 0x6E, 0x73, 0xD9, 0x61, 0xFF, 0xFC,
-    0x41, 0x76, 0xDD, 0xD9, 0x42, 0x74, 0x65, 0xE0, 0x27, 0xFF, 0xFC, 0x41, 0x66, 0xD9, 0x49, 0xC5, 0x03, 0xD1, 0x61,
-    0x65, 0x69, 0x6F, 0x75, 0xFF, 0xD6, 0xFF, 0xEA, 0xFF, 0xF5, 0xE1, 0x3C, 0xFF, 0xFC, 0xC1, 0x02, 0x81, 0x74, 0xE2,
-    0xF8, 0x41, 0x68, 0xD9, 0x45, 0x41, 0x64, 0xE1, 0x3B, 0xA1, 0x02, 0x31, 0x72, 0xFC, 0x41, 0x74, 0xFE, 0xE5, 0x41,
-    0x6E, 0xE1, 0x94, 0xA1, 0x02, 0x52, 0x61, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x6E, 0x73, 0x74, 0xFF, 0xEE, 0xE8, 0x41,
-    0xFF, 0xF3, 0xE1, 0x25, 0xE1, 0x25, 0xFF, 0xFB, 0xA0, 0x0B, 0x13, 0xC2, 0x03, 0xD1, 0x6E, 0x72, 0xFF, 0xFD, 0xE2,
-    0x16, 0x52, 0x61, 0x62, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x79, 0xFD, 0x8F, 0xE0, 0x49, 0xE0, 0x63, 0xFD, 0xF6, 0xFE, 0x15, 0xFE, 0x30, 0xFE, 0x71, 0xFE, 0xCB, 0xFE, 0xD6,
-    0xFF, 0x1A, 0xFF, 0x4B, 0xE0, 0x49, 0xFF, 0xAF, 0xFF, 0xC1, 0xFF, 0xC7, 0xFF, 0xE1, 0xE0, 0x49, 0xFF, 0xF7, 0x41,
-    0x6C, 0xEF, 0xF9, 0x42, 0x6D, 0x74, 0xD8, 0xBF, 0xD8, 0xBF, 0xC1, 0x01, 0xE1, 0x6D, 0xDA, 0x47, 0x21, 0x61, 0xFA,
-    0x42, 0x69, 0x79, 0xD8, 0xAF, 0xD8, 0xAF, 0xC2, 0x00, 0x51, 0x65, 0x6F, 0xD9, 0xB7, 0xD8, 0xC9, 0xA0, 0x0B, 0x42,
-    0x21, 0x7A, 0xFD, 0x46, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x74, 0xFF, 0xEA, 0xEB, 0x97, 0xFF, 0xF1, 0xFF, 0xFD, 0xD8,
-    0x99, 0xD8, 0xD6, 0xA0, 0x19, 0xA3, 0x21, 0x72, 0xFD, 0x21, 0x72, 0xFD, 0x43, 0x6C, 0x74, 0x61, 0xD8, 0x8F, 0xD8,
-    0x95, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xDF, 0x86, 0xDF, 0x4F, 0x41, 0x65, 0xDC, 0xCF, 0x45, 0x61, 0x64, 0x6C, 0x70,
-    0x74, 0xFF, 0xF5, 0xF2, 0x61, 0xD8, 0xA5, 0xFF, 0xFC, 0xE6, 0x9B, 0xC1, 0x02, 0xE1, 0x61, 0xD8, 0x6A, 0x41, 0x73,
-    0xDB, 0x7A, 0x21, 0x72, 0xFC, 0x41, 0x68, 0xDC, 0xCA, 0x21, 0x63, 0xFC, 0x4E, 0x62, 0x63, 0x65, 0x67, 0x6C, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0x75, 0x7A, 0x69, 0x74, 0xFF, 0x81, 0xD8, 0x41, 0xFF, 0x85, 0xDF, 0x80, 0xFF, 0x92, 0xDF,
-    0xAD, 0xFF, 0xAB, 0xFF, 0xC7, 0xFF, 0xDC, 0xE3, 0x1A, 0xD8, 0xAE, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x64,
-    0x72, 0xED, 0x82, 0xE0, 0x25, 0x42, 0x6E, 0x74, 0xDF, 0x7B, 0xDE, 0xE6, 0x21, 0x61, 0xF9, 0xC1, 0x01, 0x41, 0x6F,
-    0xDE, 0xEF, 0x42, 0x69, 0x79, 0xEC, 0xFB, 0xD8, 0x02, 0x43, 0x69, 0x6C, 0x6F, 0xF7, 0x7B, 0xFF, 0xF9, 0xDE, 0xCF,
-    0xC1, 0x00, 0x41, 0x74, 0xD8, 0x09, 0xA1, 0x02, 0x81, 0x61, 0xFA, 0xC1, 0x01, 0x41, 0x70, 0xD9, 0x75, 0x46, 0x61,
-    0x62, 0x65, 0x6E, 0x6F, 0x79, 0xFF, 0xFA, 0xD8, 0xD9, 0xDB, 0x4D, 0xDF, 0x2F, 0xDF, 0x1C, 0xDF, 0x2F, 0xC1, 0x02,
-    0xB1, 0x70, 0xEA, 0xBB, 0xC1, 0x02, 0x31, 0x65, 0xDC, 0xC4, 0x41, 0x61, 0xDE, 0x0C, 0x4D, 0x61, 0x63, 0x64, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0xFF, 0xA4, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF, 0xC2, 0xF0, 0x07,
-    0xFF, 0xD2, 0xDA, 0xB8, 0xD7, 0xD5, 0xFF, 0xDD, 0xFF, 0xF0, 0xFF, 0xF6, 0xD7, 0xBD, 0xFF, 0xFC, 0x41, 0x68, 0xD7,
-    0xB6, 0xA0, 0x07, 0x12, 0x41, 0x72, 0xDC, 0xD7, 0x21, 0x65, 0xFC, 0x41, 0x6E, 0xD8, 0x1E, 0xA0, 0x19, 0xD4, 0x21,
-    0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x02, 0x31, 0x65, 0xFD, 0x44, 0x6C, 0x6F, 0x70, 0x72, 0xD7, 0x75, 0xDE, 0x88,
-    0xD7, 0x75, 0xD7, 0x75, 0x42, 0x65, 0x73, 0xEE, 0x4C, 0xD7, 0x68, 0x41, 0x64, 0xD8, 0xF0, 0x21, 0x69, 0xFC, 0x21,
-    0x73, 0xFD, 0x42, 0x68, 0x65, 0xD8, 0x6F, 0xFF, 0xFD, 0x4C, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x76, 0xDE, 0xFF, 0xE1, 0x58, 0xFF, 0xBB, 0xFF, 0xBF, 0xFF, 0xC6, 0xF7, 0x59, 0xFF, 0xC9, 0xFF, 0xD6,
-    0xFF, 0xDB, 0xFF, 0xE8, 0xFF, 0xF9, 0xE1, 0x55, 0xC1, 0x02, 0x11, 0x72, 0xDA, 0x0A, 0xC2, 0x08, 0x33, 0x61, 0x6F,
-    0xD7, 0x8F, 0xFF, 0xFA, 0xC1, 0x04, 0x02, 0x65, 0xDB, 0xBB, 0x41, 0x7A, 0xD8, 0xA5, 0x21, 0x75, 0xFC, 0xA1, 0x03,
-    0xE2, 0x61, 0xFD, 0x41, 0x7A, 0xDD, 0xDE, 0x42, 0x69, 0x73, 0xFF, 0xFC, 0xDD, 0xDA, 0xC1, 0x02, 0x31, 0x65, 0xD6,
-    0xF9, 0xA0, 0x0B, 0x62, 0x42, 0x61, 0x65, 0xD9, 0xF1, 0xFF, 0xFD, 0x42, 0x61, 0x65, 0xDE, 0x58, 0xD8, 0x7E, 0x42,
-    0x61, 0x79, 0xD6, 0xE8, 0xDD, 0xC4, 0x42, 0x64, 0x6E, 0xDE, 0xED, 0xD6, 0xDB, 0x41, 0x2E, 0xE5, 0x29, 0x42, 0x73,
-    0x63, 0xDD, 0xB2, 0xFF, 0xFC, 0x44, 0x61, 0x69, 0x74, 0x75, 0xD6, 0xEA, 0xFF, 0xF9, 0xDA, 0x94, 0xDD, 0xAB, 0xC1,
-    0x00, 0x51, 0x6E, 0xDD, 0x9E, 0x42, 0x65, 0x70, 0xFF, 0xFA, 0xD6, 0xC8, 0xC1, 0x03, 0xD1, 0x65, 0xD8, 0x61, 0x21,
-    0x73, 0xFA, 0x41, 0x65, 0xE8, 0x6D, 0x2A, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x76, 0xA2, 0xA9,
-    0xB2, 0xB9, 0xC0, 0xC7, 0xD9, 0xEC, 0xF9, 0xFC, 0x42, 0x6E, 0x70, 0xEE, 0xCE, 0xDA, 0x5C, 0xC2, 0x02, 0x52, 0x65,
-    0x6F, 0xD8, 0x5E, 0xFF, 0xF9, 0xC1, 0x0A, 0x23, 0x68, 0xDE, 0x74, 0x41, 0x72, 0xDE, 0x6E, 0x41, 0x75, 0xFC, 0x7E,
-    0x43, 0x6E, 0x73, 0x6F, 0xDD, 0xB5, 0xDD, 0x51, 0xFF, 0xFC, 0x43, 0x61, 0x65, 0x79, 0xFF, 0xEE, 0xFF, 0xF6, 0xDE,
-    0x5C, 0x42, 0x6B, 0x74, 0xDA, 0x7E, 0xD6, 0x61, 0xA0, 0x0B, 0x82, 0x21, 0x74, 0xFD, 0x45, 0x67, 0x6D, 0x6E, 0x73,
-    0x74, 0xDD, 0xBD, 0xDD, 0xD9, 0xFF, 0xF3, 0xFF, 0xFD, 0xDD, 0xBD, 0x41, 0x72, 0xF0, 0xB2, 0xA1, 0x02, 0xB1, 0x61,
-    0xFC, 0x41, 0x61, 0xD9, 0x63, 0x21, 0x68, 0xFC, 0x21, 0x74, 0xFD, 0x43, 0x65, 0x68, 0x6F, 0xDD, 0x44, 0xDD, 0x44,
-    0xFF, 0xFD, 0x42, 0x70, 0x73, 0xFF, 0xF6, 0xE0, 0x2C, 0x52, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xFD, 0xDC, 0xDE, 0x92, 0xFE, 0x63, 0xDE, 0x92, 0xDE, 0x92,
-    0xFE, 0xD0, 0xDC, 0xF1, 0xFE, 0xFB, 0xFF, 0x04, 0xFF, 0x11, 0xFF, 0x78, 0xE7, 0x21, 0xFF, 0x94, 0xFF, 0x9D, 0xFF,
-    0xB5, 0xFF, 0xCC, 0xFF, 0xE0, 0xFF, 0xF9, 0xC1, 0x00, 0x51, 0x65, 0xDA, 0x0A, 0xC3, 0x02, 0x11, 0x63, 0x69, 0x74,
-    0xDC, 0xB4, 0xD5, 0xF5, 0xE7, 0x46, 0x41, 0x76, 0xDD, 0xC8, 0x41, 0x63, 0xDD, 0x3C, 0x21, 0x69, 0xFC, 0x43, 0x69,
-    0x72, 0x75, 0xFF, 0xF5, 0xFF, 0xFD, 0xDD, 0xBD, 0xC6, 0x03, 0xE2, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0xDC, 0xF3,
-    0xFF, 0xD9, 0xFF, 0xDF, 0xE1, 0x18, 0xDF, 0x3B, 0xFF, 0xF6, 0x42, 0x61, 0x74, 0xDC, 0xC0, 0xDC, 0x89, 0xA1, 0x00,
-    0x51, 0x72, 0xF9, 0x42, 0x2E, 0x65, 0xDC, 0x7D, 0xDC, 0x7D, 0x43, 0x61, 0x6E, 0x74, 0xDC, 0x76, 0xDC, 0xAD, 0xFF,
-    0xF9, 0xC1, 0x02, 0xB1, 0x69, 0xDC, 0xA3, 0xC1, 0x02, 0xB1, 0x69, 0xEB, 0x86, 0x46, 0x65, 0x69, 0x6C, 0x6F, 0x72,
-    0x75, 0xFF, 0xDE, 0xFF, 0xEA, 0xFF, 0xF4, 0xDC, 0x58, 0xFF, 0xFA, 0xF5, 0xD6, 0xC2, 0x01, 0x91, 0x2E, 0x61, 0xDD,
-    0x62, 0xDD, 0x62, 0x45, 0x6D, 0x70, 0x72, 0x73, 0x79, 0xDC, 0x39, 0xDE, 0x30, 0xFF, 0xF7, 0xD5, 0x89, 0xDD, 0x59,
-    0x41, 0x75, 0xD5, 0x52, 0x41, 0x6F, 0xDC, 0x25, 0xC1, 0x02, 0x11, 0x61, 0xDC, 0x63, 0xC3, 0x02, 0x41, 0x64, 0x6E,
-    0x70, 0xDC, 0x1E, 0xDE, 0x5D, 0xFF, 0xFA, 0x41, 0x63, 0xEB, 0x3A, 0xC2, 0x04, 0x02, 0x61, 0x79, 0xDE, 0x02, 0xDD,
-    0x2B, 0xC1, 0x00, 0xC1, 0x61, 0xEF, 0x13, 0x42, 0x65, 0x75, 0xDC, 0x94, 0xFF, 0xFA, 0x44, 0x6C, 0x6D, 0x6F, 0x72,
-    0xDC, 0xB3, 0xDC, 0x8D, 0xDC, 0x00, 0xDC, 0x73, 0x4A, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75,
-    0xFF, 0xAF, 0xFF, 0xBF, 0xFF, 0xC3, 0xDB, 0xE8, 0xFF, 0xCD, 0xF8, 0x01, 0xFF, 0xD9, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF,
-    0xF3, 0x42, 0x69, 0x6E, 0xDC, 0xE9, 0xDD, 0xE9, 0x42, 0x61, 0x73, 0xEB, 0xD5, 0xD4, 0xF1, 0x42, 0x6E, 0x72, 0xDB,
-    0xC6, 0xD4, 0xEA, 0xC2, 0x01, 0xE1, 0x75, 0x73, 0xD4, 0xFB, 0xDC, 0x4C, 0xC5, 0x02, 0x11, 0x61, 0x65, 0x6F, 0x74,
-    0x75, 0xFF, 0xF0, 0xDB, 0xAE, 0xFF, 0xF7, 0xDC, 0x1A, 0xDB, 0xB6, 0x42, 0x6D, 0x77, 0xDC, 0xB9, 0xDB, 0xDB, 0xC1,
-    0x02, 0x11, 0x6F, 0xDB, 0x9D, 0xC8, 0x02, 0x41, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0xFF, 0xC3, 0xDB,
-    0x97, 0xFF, 0xCA, 0xFF, 0xE1, 0xED, 0xF0, 0xFF, 0xF3, 0xDC, 0xAC, 0xFF, 0xFA, 0xA0, 0x0B, 0xE2, 0x21, 0x61, 0xFD,
-    0x44, 0x61, 0x65, 0x6E, 0x74, 0xE9, 0xB6, 0xD4, 0x9A, 0xDB, 0x6E, 0xDE, 0x06, 0x41, 0x2E, 0xDC, 0xFF, 0x42, 0x63,
-    0x74, 0xDB, 0xD8, 0xDC, 0xFB, 0xC7, 0x0B, 0xC2, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0xD4, 0xBF, 0xFF, 0xE5,
-    0xFD, 0x21, 0xFF, 0xE8, 0xFF, 0xF5, 0xFF, 0xF9, 0xDB, 0xD1, 0x41, 0x72, 0xDE, 0xF6, 0x42, 0x65, 0x72, 0xD7, 0x37,
-    0xDB, 0xCF, 0x42, 0x63, 0x65, 0xEA, 0xA4, 0xDB, 0xAE, 0x41, 0x74, 0xD7, 0x80, 0x21, 0x65, 0xFC, 0x21, 0x63, 0xFD,
-    0x47, 0x2E, 0x65, 0x66, 0x69, 0x6C, 0x74, 0x61, 0xDB, 0x1F, 0xFF, 0xE4, 0xFF, 0xE8, 0xFF, 0xEF, 0xDB, 0x9D, 0xDB,
-    0x1F, 0xFF, 0xFD, 0x41, 0x62, 0xD4, 0x50, 0x41, 0x72, 0xDB, 0xC3, 0x41, 0x74, 0xD5, 0xC2, 0xC4, 0x01, 0x91, 0x62,
-    0x6C, 0x6E, 0x74, 0xDB, 0x7B, 0xDB, 0x3F, 0xDB, 0x3F, 0xDB, 0x3F, 0xA0, 0x02, 0x92, 0xC2, 0x02, 0x11, 0x72, 0x74,
-    0xDB, 0x2D, 0xDA, 0xF6, 0x42, 0x69, 0x72, 0xD4, 0x29, 0xDB, 0x51, 0x41, 0x72, 0xD8, 0x89, 0xA1, 0x00, 0x51, 0x65,
-    0xFC, 0x21, 0x74, 0xFB, 0x21, 0x69, 0xFD, 0xC9, 0x02, 0x41, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x6E,
-    0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xCB, 0xFF, 0xCF, 0xFF, 0xDE, 0xFF, 0xE1, 0xDD, 0xBA, 0xFF, 0xEA, 0xFF, 0xFD, 0xA0,
-    0x0C, 0x03, 0xC1, 0x02, 0x21, 0x6B, 0xDB, 0xCB, 0xC4, 0x02, 0xB1, 0x62, 0x64, 0x6D, 0x72, 0xF3, 0x54, 0xEE, 0x90,
-    0xE9, 0xD0, 0xD4, 0x67, 0x43, 0x67, 0x72, 0x76, 0xDB, 0x14, 0xDB, 0x05, 0xD3, 0xBF, 0xC6, 0x01, 0xF1, 0x61, 0x62,
-    0x6F, 0x73, 0x74, 0x7A, 0xDA, 0xCE, 0xDD, 0xC0, 0xDA, 0xCE, 0xF8, 0x80, 0xE2, 0xE3, 0xDD, 0xC0, 0x41, 0x61, 0xFF,
-    0x6E, 0x41, 0x71, 0xDA, 0xB5, 0x4A, 0x61, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xCA, 0xFF,
-    0xD9, 0xDA, 0x7A, 0xFF, 0xE3, 0xFF, 0xF8, 0xDA, 0x6F, 0xFF, 0xFC, 0xE1, 0x55, 0xE2, 0x80, 0xDA, 0xB1, 0xC1, 0x01,
-    0x41, 0x65, 0xDA, 0x92, 0x41, 0x79, 0xD3, 0x91, 0x22, 0x67, 0x72, 0xF6, 0xFC, 0x41, 0x61, 0xD3, 0xBD, 0x21, 0x74,
-    0xFC, 0x42, 0x6E, 0x74, 0xFF, 0xFD, 0xDA, 0x3A, 0xC4, 0x01, 0xF1, 0x64, 0x6C, 0x6E, 0x74, 0xDC, 0x75, 0xD7, 0x7F,
-    0xDF, 0x02, 0xDA, 0x33, 0xC1, 0x02, 0x11, 0x6C, 0xDA, 0xE2, 0x41, 0x61, 0xEA, 0x3A, 0x21, 0x64, 0xFC, 0x21, 0x65,
-    0xFD, 0x47, 0x61, 0x65, 0x69, 0x6E, 0x6F, 0x75, 0x70, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF, 0xE1, 0xDD, 0x29, 0xF8, 0x9D,
-    0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x75, 0x76, 0xED, 0x4D, 0xD9, 0xFE, 0x42, 0x6C, 0x72, 0xD8, 0x6F, 0xDA, 0x39, 0x21,
-    0x65, 0xF9, 0x41, 0x6E, 0xDA, 0x27, 0x21, 0x69, 0xFC, 0xA1, 0x01, 0x91, 0x6C, 0xFD, 0x41, 0x61, 0xD4, 0xAA, 0xC3,
-    0x02, 0x41, 0x65, 0x72, 0x73, 0xDA, 0x5B, 0xFF, 0xFC, 0xDE, 0x70, 0xC1, 0x01, 0x91, 0x6E, 0xD9, 0xDC, 0x46, 0x61,
-    0x65, 0x69, 0x6C, 0x6F, 0x75, 0xD9, 0xCB, 0xFF, 0xFA, 0xD9, 0xCB, 0xFF, 0xE2, 0xD9, 0xCB, 0xD9, 0xCB, 0x41, 0x79,
-    0xDB, 0xA0, 0x42, 0x2E, 0x6C, 0xD9, 0xB7, 0xFF, 0xFC, 0x41, 0x6F, 0xDB, 0xA4, 0x43, 0x65, 0x69, 0x79, 0xFF, 0xF5,
-    0xFF, 0xFC, 0xD9, 0xEB, 0xC5, 0x02, 0x41, 0x2E, 0x61, 0x6F, 0x73, 0x74, 0xD9, 0xA2, 0xDA, 0xBF, 0xD9, 0xE1, 0xDA,
-    0x0E, 0xFF, 0xF6, 0xC3, 0x03, 0xE2, 0x63, 0x73, 0x74, 0xF0, 0xF9, 0xD2, 0xBC, 0xDA, 0xAD, 0x41, 0x61, 0xD2, 0xD7,
-    0x21, 0x72, 0xFC, 0xC2, 0x02, 0x41, 0x65, 0x75, 0xD9, 0xBC, 0xFF, 0xFD, 0xA0, 0x0B, 0xC2, 0x42, 0x2E, 0x68, 0xE1,
-    0xC5, 0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x73, 0xD9, 0x6A, 0xA0, 0x1A, 0x12, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x72, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x66,
-    0xE1, 0xAC, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x6F, 0xFF, 0x78, 0xFF, 0x8A, 0xFF, 0xB6, 0xD9, 0x55, 0xD9, 0x55, 0xE1,
-    0xAC, 0xFF, 0xC8, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF, 0xEE, 0xD9, 0x55, 0xFF, 0xFD, 0x42, 0x65, 0x72, 0xD2, 0x4D, 0xDC,
-    0x58, 0x41, 0x72, 0xD5, 0x5F, 0x43, 0x61, 0x65, 0x69, 0xD2, 0x5D, 0xFF, 0xFC, 0xD2, 0x5A, 0x43, 0x68, 0x69, 0x6F,
-    0xD9, 0x1A, 0xD9, 0x12, 0xD9, 0xA7, 0xCA, 0x02, 0x41, 0x2E, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0xD9, 0x05, 0xFF, 0xE1, 0xDA, 0xA6, 0xD9, 0x9D, 0xFF, 0xEC, 0xDE, 0x3F, 0xD5, 0x13, 0xDA, 0x25, 0xFF, 0xF6, 0xFB,
-    0xB7, 0x41, 0x73, 0xD7, 0x31, 0x21, 0x61, 0xFC, 0x21, 0x72, 0xFD, 0xC1, 0x01, 0xE1, 0x63, 0xD9, 0x72, 0x41, 0x65,
-    0xF2, 0x85, 0xC5, 0x02, 0x41, 0x65, 0x68, 0x69, 0x72, 0x75, 0xD1, 0xFF, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0xFC, 0xD9,
-    0x15, 0xA0, 0x0C, 0x42, 0x42, 0x64, 0x74, 0xD8, 0xFD, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xD9, 0x32, 0xE8, 0x2C,
-    0xFF, 0xF9, 0x21, 0x75, 0xF6, 0xC2, 0x02, 0xB1, 0x62, 0x63, 0xD1, 0xD6, 0xD9, 0xC7, 0xA0, 0x0C, 0x62, 0x44, 0x64,
-    0x66, 0x6C, 0x73, 0xD2, 0x07, 0xD9, 0xBB, 0xFF, 0xFD, 0xD9, 0xBB, 0x41, 0x69, 0xD8, 0x99, 0xA0, 0x0C, 0x83, 0xC4,
-    0x01, 0xF1, 0x64, 0x73, 0x74, 0x7A, 0xD5, 0xD3, 0xD9, 0x1F, 0xE4, 0x81, 0xFF, 0xFD, 0x42, 0x67, 0x6E, 0xD1, 0xA7,
-    0xE4, 0xA5, 0xA0, 0x1A, 0x32, 0x21, 0x63, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x76, 0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x01,
-    0x91, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6D, 0x6F, 0x75, 0x72, 0xFF, 0xBB, 0xD5, 0xAE, 0xFF, 0xC7, 0xFF, 0xD4, 0xFF,
-    0xDB, 0xD9, 0x16, 0xFF, 0xEA, 0xD9, 0x8C, 0xFF, 0xFD, 0x43, 0x67, 0x72, 0x73, 0xD8, 0x4F, 0xD8, 0x86, 0xD1, 0x94,
-    0xC1, 0x0C, 0xB2, 0x68, 0xD8, 0x7C, 0xC1, 0x01, 0x91, 0x72, 0xD8, 0x76, 0x42, 0x6E, 0x70, 0xD8, 0x70, 0xD1, 0x75,
-    0x42, 0x61, 0x6F, 0xD9, 0x05, 0xFF, 0xF9, 0x44, 0x62, 0x64, 0x73, 0x74, 0xD8, 0x62, 0xD1, 0x4F, 0xD8, 0x23, 0xED,
-    0xBE, 0x41, 0x61, 0xE7, 0x5D, 0xC1, 0x02, 0x11, 0x6D, 0xDF, 0x71, 0xC2, 0x01, 0xF1, 0x69, 0x79, 0xDB, 0x3D, 0xD8,
-    0xA1, 0x42, 0x6E, 0x73, 0xD6, 0x78, 0xD8, 0x98, 0xC2, 0x05, 0xD2, 0x61, 0x65, 0xE7, 0x47, 0xFF, 0xF9, 0x41, 0x61,
-    0xED, 0x08, 0x45, 0x61, 0x65, 0x69, 0x6C, 0x72, 0xD9, 0xBA, 0xD8, 0x5B, 0xD8, 0x5B, 0xD4, 0x2E, 0xFF, 0xFC, 0xC1,
-    0x02, 0x11, 0x73, 0xD7, 0xE7, 0x4F, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73,
-    0x74, 0x75, 0xE0, 0x2D, 0xFF, 0x92, 0xFF, 0x9C, 0xFF, 0xA2, 0xD9, 0x11, 0xFF, 0xAF, 0xFF, 0xB6, 0xD9, 0x0E, 0xFF,
-    0xC3, 0xEE, 0xFE, 0xFF, 0xC7, 0xFF, 0xCD, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF, 0xFA, 0xA0, 0x0C, 0xD2, 0x46, 0x2E, 0x62,
-    0x67, 0x6D, 0x6E, 0x74, 0xD7, 0xA5, 0xD1, 0x3A, 0xD8, 0xC5, 0xFF, 0xFD, 0xD8, 0x23, 0xD8, 0x23, 0x42, 0x61, 0x69,
-    0xD7, 0xD4, 0xD7, 0x95, 0x41, 0x61, 0xD9, 0x2C, 0x21, 0x6D, 0xFC, 0xA1, 0x02, 0x31, 0x69, 0xFD, 0xA2, 0x02, 0x41,
-    0x72, 0x73, 0xED, 0xFB, 0x41, 0x6C, 0xD3, 0x8A, 0xA1, 0x02, 0x41, 0x69, 0xFC, 0xC2, 0x02, 0x02, 0x61, 0x6B, 0xD7,
-    0xB1, 0xD9, 0x5E, 0xC1, 0x01, 0x91, 0x6D, 0xD8, 0x86, 0xA0, 0x11, 0x02, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC8, 0x02, 0xB1, 0x61, 0x63, 0x67, 0x6C, 0x6D, 0x6F, 0x73, 0x6E, 0xD7, 0x51, 0xFF,
-    0xE2, 0xD7, 0x93, 0xD8, 0x7B, 0xD7, 0xB1, 0xDF, 0xA8, 0xFF, 0xEB, 0xFF, 0xFD, 0xA0, 0x0C, 0xF3, 0x42, 0x6D, 0x6E,
-    0xFF, 0xFD, 0xD7, 0x33, 0x42, 0x61, 0x79, 0xEB, 0x0C, 0xD7, 0x37, 0x43, 0x61, 0x64, 0x6C, 0xDB, 0x4E, 0xD7, 0x28,
-    0xD7, 0x67, 0x49, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0xFF, 0x76, 0xFF, 0x9C, 0xFF, 0xA7, 0xFF,
-    0xCA, 0xFF, 0xE8, 0xFF, 0xEF, 0xD7, 0x1B, 0xFF, 0xF6, 0xE6, 0x8F, 0x42, 0x2E, 0x73, 0xEA, 0x4E, 0xEB, 0xFB, 0x43,
-    0x6C, 0x6E, 0x72, 0xD7, 0x3D, 0xDC, 0x94, 0xFF, 0xF9, 0x43, 0x6C, 0x6F, 0x74, 0xD7, 0xA5, 0xD6, 0xF9, 0xD7, 0x5D,
-    0x42, 0x65, 0x6F, 0xD6, 0xE7, 0xD9, 0xC8, 0x42, 0x72, 0x74, 0xFF, 0xF9, 0xEA, 0x2C, 0xA3, 0x02, 0x41, 0x65, 0x69,
-    0x6F, 0xDE, 0xE8, 0xF9, 0x41, 0x74, 0xD8, 0xC4, 0x21, 0x6E, 0xFC, 0x43, 0x61, 0x69, 0x6F, 0xE2, 0xEF, 0xCF, 0xF5,
-    0xFF, 0xFD, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFA, 0x29, 0xFA, 0x67, 0xFA, 0xD4, 0xFB, 0x30, 0xFB,
-    0x69, 0xFB, 0x9D, 0xFB, 0xF0, 0xD7, 0x3A, 0xFC, 0x0E, 0xFC, 0x11, 0xD6, 0xBC, 0xFC, 0x4D, 0xFC, 0xA8, 0xFD, 0x67,
-    0xFD, 0xB7, 0xFD, 0xEC, 0xFE, 0x12, 0xFE, 0x5A, 0xFE, 0xE6, 0xFF, 0xA1, 0xD8, 0x5D, 0xFF, 0xE6, 0xE0, 0xEC, 0xD9,
-    0xF3, 0xD6, 0xBC, 0xFF, 0xF6, 0x41, 0x71, 0xCF, 0x9C, 0x41, 0x65, 0xFD, 0x0B, 0x21, 0x6E, 0xFC, 0xA1, 0x02, 0x31,
-    0x61, 0xFD, 0x41, 0x61, 0xD1, 0x1B, 0x21, 0x75, 0xFC, 0xA3, 0x02, 0xE1, 0x63, 0x70, 0x6E, 0xE9, 0xF4, 0xFD, 0xA0,
-    0x18, 0x22, 0x21, 0x6D, 0xFD, 0x42, 0x73, 0x65, 0xCF, 0x8E, 0xFF, 0xFD, 0x42, 0x69, 0x79, 0xF2, 0x6C, 0xD6, 0x40,
-    0x21, 0x74, 0xF9, 0xC3, 0x03, 0xD1, 0x72, 0x73, 0x77, 0xFF, 0xEF, 0xFF, 0xFD, 0xCF, 0x77, 0x41, 0x70, 0xD6, 0xC2,
-    0x41, 0x67, 0xD8, 0x1D, 0x21, 0x64, 0xFC, 0x24, 0x61, 0x65, 0x6F, 0x75, 0xC9, 0xE9, 0xF5, 0xFD, 0x45, 0x2E, 0x62,
-    0x67, 0x69, 0x6C, 0xD7, 0x51, 0xD6, 0x94, 0xD6, 0x19, 0xD8, 0xBE, 0xCF, 0x45, 0xA0, 0x1A, 0x52, 0x21, 0x67, 0xFD,
-    0xA1, 0x01, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFB, 0x41, 0x64, 0xE6, 0x5D, 0xC1, 0x00, 0x51, 0x74, 0xD7, 0x6E, 0x48,
-    0x64, 0x65, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0xD6, 0x4E, 0xE4, 0x86, 0xD6, 0x86, 0xFF, 0xF3, 0xFF, 0xF6, 0xD7,
-    0x8F, 0xFF, 0xFA, 0xDC, 0xD4, 0xA0, 0x0D, 0x22, 0x42, 0x6C, 0x6F, 0xD6, 0xF2, 0xCF, 0x22, 0xA0, 0x1A, 0x72, 0x21,
-    0x63, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x73, 0x74, 0xDA, 0x55, 0xFF, 0xFD, 0x44, 0x2E, 0x64, 0x65, 0x67, 0xD6, 0xDB,
-    0xCF, 0x27, 0xFF, 0xF9, 0xCE, 0xEA, 0xC1, 0x00, 0x51, 0x68, 0xD5, 0xB1, 0xC7, 0x02, 0xB1, 0x2E, 0x63, 0x6C, 0x6D,
-    0x6E, 0x70, 0x73, 0xD7, 0x9F, 0xFF, 0xD3, 0xFF, 0xD6, 0xD6, 0xC8, 0xFF, 0xED, 0xD6, 0x40, 0xFF, 0xFA, 0x41, 0x79,
-    0xD5, 0x90, 0xC2, 0x02, 0xB1, 0x65, 0x79, 0xFF, 0xFC, 0xD5, 0x8C, 0x42, 0x65, 0x6F, 0xDA, 0x16, 0xF4, 0x94, 0x41,
-    0x6E, 0xE4, 0x14, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD, 0x44, 0x72, 0x73, 0x75, 0x76, 0xD5, 0x7D, 0xCE, 0x9E, 0xD5,
-    0xF0, 0xFF, 0xFD, 0x41, 0x6F, 0xD1, 0x65, 0x41, 0x61, 0xD5, 0xDF, 0xC4, 0x0A, 0x23, 0x63, 0x6C, 0x79, 0x68, 0xD6,
-    0x7D, 0xD5, 0xF5, 0xD6, 0x7D, 0xFF, 0xFC, 0x4F, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x72, 0x73, 0x74, 0x77, 0xFF, 0x38, 0xD6, 0xEF, 0xFF, 0x60, 0xD5, 0xCC, 0xD5, 0xE6, 0xFF, 0xA6, 0xD5, 0xE6, 0xFF,
-    0xC2, 0xD6, 0xEF, 0xFF, 0xCB, 0xFF, 0xDC, 0xFF, 0xE9, 0xFF, 0xF1, 0xD5, 0x51, 0xD6, 0xEF, 0x42, 0x69, 0x6F, 0xDE,
-    0x54, 0xD6, 0x40, 0xA0, 0x1A, 0x93, 0xA1, 0x00, 0x41, 0x65, 0xFD, 0x21, 0x69, 0xFB, 0x42, 0x65, 0x79, 0xD6, 0x2E,
-    0xD5, 0x50, 0x43, 0x64, 0x65, 0x74, 0xF3, 0xA7, 0xCE, 0x51, 0xCE, 0x73, 0x41, 0x6E, 0xD0, 0x6E, 0x21, 0x65, 0xFC,
-    0x43, 0x67, 0x69, 0x63, 0xCE, 0x25, 0xCE, 0x37, 0xFF, 0xFD, 0x41, 0x6C, 0xD6, 0xA1, 0x43, 0x61, 0x65, 0x69, 0xD5,
-    0xC6, 0xFF, 0xFC, 0xDF, 0xC4, 0xC1, 0x01, 0x91, 0x61, 0xEE, 0x40, 0x41, 0x73, 0xD1, 0xF9, 0x21, 0x73, 0xFC, 0x21,
-    0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x4B, 0x62, 0x63, 0x64, 0x67, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x76, 0x69, 0xFF, 0xAB,
-    0xFF, 0xBA, 0xFF, 0xBD, 0xEA, 0x5A, 0xD1, 0xC3, 0xFF, 0xC4, 0xFF, 0xD5, 0xCE, 0x37, 0xFF, 0xE3, 0xFF, 0xED, 0xFF,
-    0xFD, 0xC1, 0x03, 0xE2, 0x69, 0xCE, 0x42, 0xA0, 0x1A, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x61, 0x69,
-    0xD7, 0x35, 0xFF, 0xFD, 0xC3, 0x0A, 0x23, 0x65, 0x69, 0x68, 0xCD, 0xC2, 0xD5, 0x11, 0xFF, 0xF9, 0x42, 0x65, 0x69,
-    0xD5, 0x1F, 0xD5, 0x1F, 0xA1, 0x02, 0x11, 0x72, 0xF9, 0xC1, 0x00, 0x51, 0x73, 0xD4, 0x86, 0xC1, 0x02, 0x21, 0x69,
-    0xD5, 0x95, 0xA3, 0x02, 0x41, 0x65, 0x69, 0x72, 0xEF, 0xF4, 0xFA, 0x41, 0x2E, 0xD6, 0xED, 0x21, 0x72, 0xFC, 0x21,
-    0x65, 0xFD, 0xA0, 0x11, 0xC2, 0x21, 0x61, 0xFD, 0xA2, 0x02, 0x81, 0x64, 0x73, 0xF7, 0xFD, 0xA0, 0x1B, 0x23, 0x21,
-    0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x2E, 0x67, 0x65, 0xD6, 0x37, 0xD6, 0x37,
-    0xFF, 0xFD, 0x41, 0x63, 0xCD, 0x7D, 0xA1, 0x02, 0x31, 0x69, 0xFC, 0x21, 0x74, 0xFB, 0x21, 0x61, 0xFD, 0x41, 0x64,
-    0xE5, 0x0D, 0x21, 0x69, 0xFC, 0x45, 0x2E, 0x63, 0x65, 0x74, 0x6F, 0xD4, 0x20, 0xD5, 0x5B, 0xE0, 0x4D, 0xE2, 0xB8,
-    0xFF, 0xFD, 0x42, 0x68, 0x72, 0xD4, 0x52, 0xD4, 0xA8, 0x41, 0x62, 0xCD, 0x59, 0x45, 0x61, 0x65, 0x67, 0x69, 0x6F,
-    0xFF, 0xFC, 0xCD, 0x34, 0xD5, 0x40, 0xF2, 0x95, 0xD5, 0x25, 0xC1, 0x02, 0x71, 0x2E, 0xD5, 0xEC, 0xC3, 0x00, 0xD1,
-    0x63, 0x71, 0x73, 0xD7, 0xAA, 0xD5, 0xE6, 0xFF, 0xFA, 0x43, 0x2E, 0x61, 0x73, 0xCD, 0x12, 0xCD, 0x12, 0xCD, 0x12,
-    0x21, 0x72, 0xF6, 0x42, 0x61, 0x65, 0xD4, 0x54, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x65, 0xD3, 0xCF, 0xA0, 0x1A, 0xF3,
-    0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x4C, 0x61, 0x62, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73,
-    0x76, 0x79, 0x63, 0xFF, 0x67, 0xD6, 0xD2, 0xD1, 0xD7, 0xFF, 0x7D, 0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xAD, 0xFF, 0xB8,
-    0xFF, 0xCE, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xC1, 0x02, 0x41, 0x72, 0xD3, 0x9B, 0xC1, 0x01, 0x71, 0x72, 0xCE,
-    0x50, 0xC3, 0x08, 0x33, 0x61, 0x65, 0x6F, 0xFF, 0xFA, 0xD5, 0xB0, 0xCC, 0xCD, 0x45, 0x67, 0x6D, 0x72, 0x73, 0x74,
-    0xD4, 0x18, 0xD6, 0xB4, 0xE3, 0x5A, 0xD4, 0x18, 0xD6, 0xB7, 0x46, 0x69, 0x6F, 0x73, 0x74, 0x75, 0x79, 0xF9, 0xC3,
-    0xD6, 0xB1, 0xD3, 0x70, 0xE2, 0xE4, 0xD4, 0x90, 0xD3, 0xEE, 0x43, 0x61, 0x65, 0x69, 0xD3, 0xDB, 0xCF, 0x87, 0xD4,
-    0x98, 0x43, 0x65, 0x66, 0x6C, 0xCF, 0x22, 0xD4, 0x73, 0xD3, 0xEB, 0x41, 0x65, 0xD5, 0x40, 0x21, 0x74, 0xFC, 0x43,
-    0x61, 0x68, 0x72, 0xFF, 0xFD, 0xD4, 0x7D, 0xDD, 0x0E, 0xA0, 0x0D, 0x43, 0x44, 0x62, 0x69, 0x6F, 0x70, 0xD0, 0x99,
-    0xCC, 0x76, 0xD3, 0xCD, 0xEA, 0xA1, 0xC1, 0x06, 0x32, 0x61, 0xCC, 0x69, 0x44, 0x61, 0x65, 0x69, 0x6B, 0xD4, 0x42,
-    0xFF, 0xFA, 0xCC, 0x63, 0xCD, 0x69, 0xA0, 0x0D, 0x42, 0x42, 0x61, 0x73, 0xD5, 0x09, 0xF3, 0xA2, 0x21, 0x63, 0xF9,
-    0x41, 0x67, 0xE4, 0xD3, 0x21, 0x6F, 0xFC, 0xC3, 0x02, 0xB1, 0x2E, 0x69, 0x68, 0xD3, 0x61, 0xFF, 0xF6, 0xFF, 0xFD,
-    0x50, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x76, 0x7A, 0xFF, 0x75,
-    0xFA, 0x67, 0xFF, 0x85, 0xFF, 0x98, 0xFF, 0xA2, 0xFF, 0xB3, 0xD4, 0x30, 0xFF, 0xBD, 0xFF, 0xC0, 0xFF, 0xD3, 0xD3,
-    0x2F, 0xFF, 0xE0, 0xE4, 0x6E, 0xFF, 0xF4, 0xE6, 0x02, 0xD4, 0x96, 0xC2, 0x00, 0x71, 0x6C, 0x74, 0xD3, 0x42, 0xCB,
-    0xF3, 0x21, 0x61, 0xF7, 0x41, 0x77, 0xD3, 0xD8, 0xC6, 0x02, 0x11, 0x61, 0x63, 0x67, 0x6C, 0x6E, 0x74, 0xD2, 0xB7,
-    0xD3, 0x32, 0xD3, 0x32, 0xD3, 0x32, 0xE3, 0x19, 0xE3, 0x19, 0xC1, 0x0D, 0x72, 0x61, 0xD2, 0xA2, 0xA0, 0x02, 0x12,
-    0x21, 0x68, 0xFD, 0xA2, 0x02, 0x81, 0x6E, 0x73, 0xF4, 0xFD, 0x41, 0x75, 0xCC, 0xBB, 0xC3, 0x02, 0x31, 0x71, 0x75,
-    0x77, 0xFF, 0xFC, 0xD2, 0xAE, 0xD2, 0x8B, 0x41, 0x6C, 0xD2, 0xEB, 0xA5, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x6F, 0x66,
-    0xC0, 0xC4, 0xE5, 0xF0, 0xFC, 0x41, 0x6E, 0xED, 0x72, 0xA0, 0x01, 0xD2, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0xA1,
-    0x00, 0x41, 0x65, 0xFD, 0x42, 0x64, 0x6E, 0xD3, 0x79, 0xFF, 0xFB, 0xC3, 0x02, 0x41, 0x65, 0x69, 0x6F, 0xD2, 0xC9,
-    0xFF, 0xE7, 0xFF, 0xF9, 0xA0, 0x08, 0x63, 0xA0, 0x1B, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x6F,
-    0xDD, 0x2A, 0xFF, 0xFD, 0x41, 0x63, 0xD3, 0x6E, 0x41, 0x73, 0xE4, 0x77, 0x44, 0x69, 0x6F, 0x75, 0x65, 0xFF, 0xF8,
-    0xD2, 0x2E, 0xD3, 0x66, 0xFF, 0xFC, 0xA0, 0x0A, 0xD2, 0xA1, 0x00, 0x51, 0x7A, 0xFD, 0x42, 0x67, 0x69, 0xD4, 0x0D,
-    0xFF, 0xFB, 0x43, 0x65, 0x69, 0x6D, 0xDE, 0x3C, 0xCB, 0x50, 0xD2, 0x8D, 0xC1, 0x00, 0x41, 0x74, 0xD5, 0x3C, 0x43,
-    0x61, 0x69, 0x6F, 0xFF, 0xFA, 0xD6, 0x84, 0xF1, 0x74, 0x42, 0x69, 0x79, 0xD5, 0x11, 0xD3, 0xEC, 0x21, 0x68, 0xF9,
-    0x21, 0x70, 0xFD, 0x44, 0x2E, 0x65, 0x6F, 0x74, 0xD3, 0xDF, 0xCB, 0x32, 0xFF, 0xFD, 0xCB, 0x17, 0x42, 0x6E, 0x74,
-    0xCF, 0xF9, 0xDA, 0x32, 0x41, 0x2E, 0xCA, 0xFD, 0x42, 0x64, 0x72, 0xFF, 0xFC, 0xFD, 0x6A, 0x21, 0x65, 0xF9, 0x21,
-    0x64, 0xFD, 0x4F, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x61, 0xD2,
-    0xFE, 0xFF, 0x89, 0xD4, 0xD8, 0xD1, 0xC3, 0xFF, 0x98, 0xE4, 0xD0, 0xFF, 0xAD, 0xCF, 0xE1, 0xFF, 0xB4, 0xFF, 0xC4,
-    0xFF, 0xDB, 0xDB, 0x8F, 0xFF, 0xE8, 0xD1, 0xC3, 0xFF, 0xFD, 0x42, 0x61, 0x69, 0xD2, 0x13, 0xD1, 0x98, 0x42, 0x6E,
-    0x74, 0xD1, 0xC8, 0xD2, 0x0C, 0xC5, 0x02, 0x41, 0x61, 0x68, 0x69, 0x6C, 0x72, 0xF6, 0x7E, 0xFF, 0xF2, 0xFF, 0xF9,
-    0xD2, 0xA7, 0xD1, 0x8A, 0xC3, 0x08, 0x63, 0x63, 0x65, 0x69, 0xD2, 0x95, 0xD1, 0xD5, 0xE5, 0x60, 0x41, 0x65, 0xCA,
-    0xBF, 0x42, 0x67, 0x6E, 0xD1, 0x70, 0xFF, 0xFC, 0xC3, 0x02, 0xB1, 0x6E, 0x72, 0x61, 0xCA, 0x87, 0xE7, 0x00, 0xD1,
-    0xDC, 0x41, 0x79, 0xCD, 0x64, 0xA1, 0x00, 0x71, 0x6C, 0xFC, 0x21, 0x69, 0xFB, 0x41, 0x73, 0xD3, 0x2E, 0x42, 0x65,
-    0x73, 0xFF, 0xFC, 0xCA, 0x6B, 0xC1, 0x00, 0xD1, 0x72, 0xFA, 0xDE, 0xC6, 0x01, 0x91, 0x61, 0x65, 0x68, 0x69, 0x72,
-    0x75, 0xFF, 0xD0, 0xFF, 0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0xD2, 0xD6, 0xFF, 0xFA, 0x42, 0x68, 0x69, 0xCA, 0x49, 0xD1,
-    0x62, 0x42, 0x6E, 0x70, 0xD1, 0x5B, 0xCA, 0x54, 0x42, 0x2E, 0x69, 0xD1, 0x15, 0xEF, 0x87, 0xA0, 0x1B, 0xA2, 0x21,
-    0x2E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x61, 0x69, 0x6E, 0x62, 0xD1, 0x97, 0xD2, 0xF6, 0xFF, 0xED,
-    0xFF, 0xFD, 0xC1, 0x01, 0xE1, 0x72, 0xCA, 0x33, 0x42, 0x73, 0x74, 0xCA, 0x15, 0xD0, 0x29, 0xA0, 0x1B, 0x82, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD, 0x4C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x73,
-    0x74, 0x6E, 0xD0, 0xE4, 0xD9, 0x6D, 0xFF, 0xB9, 0xFF, 0xC0, 0xCA, 0x08, 0xD0, 0xE7, 0xFF, 0xDA, 0xFF, 0xE7, 0xD0,
-    0xD9, 0xFF, 0xED, 0xDF, 0x71, 0xFF, 0xFD, 0xA0, 0x0D, 0x92, 0x42, 0x6E, 0x74, 0xD0, 0xB4, 0xFF, 0xFD, 0x21, 0x65,
-    0xF9, 0x41, 0x79, 0xD8, 0xB8, 0xC2, 0x05, 0x92, 0x65, 0x74, 0xD0, 0xA6, 0xFF, 0xFC, 0xA0, 0x1B, 0xC3, 0x21, 0x69,
-    0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x62, 0x6D, 0x6E, 0x73, 0x67, 0xD0, 0x8E, 0xD0,
-    0x8E, 0xD5, 0x13, 0xD6, 0x11, 0xFF, 0xEB, 0xFF, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xFB, 0xAE, 0xFB, 0xD0, 0xFB,
-    0xE6, 0xFC, 0x0A, 0xFC, 0xBC, 0xFC, 0xE1, 0xFC, 0xED, 0xD8, 0xEA, 0xFD, 0x84, 0xD0, 0x79, 0xFD, 0xBE, 0xFE, 0x01,
-    0xFE, 0x27, 0xFE, 0x33, 0xFE, 0xB6, 0xFE, 0xF2, 0xD8, 0x5A, 0xFF, 0x04, 0xFF, 0x44, 0xFF, 0xA0, 0xFF, 0xCF, 0xDF,
-    0xEA, 0xFF, 0xEB, 0x41, 0x69, 0xD4, 0xBC, 0x43, 0x61, 0x68, 0x6C, 0xD3, 0x63, 0xFF, 0xFC, 0xD0, 0xC7, 0x42, 0x69,
-    0x6E, 0xCC, 0x25, 0xD2, 0x1C, 0x42, 0x67, 0x6E, 0xD0, 0x60, 0xD0, 0x29, 0x41, 0x70, 0xF9, 0xCA, 0x45, 0x64, 0x69,
-    0x6C, 0x74, 0x61, 0xD0, 0x13, 0xFF, 0xF5, 0xC9, 0xA8, 0xCC, 0x55, 0xFF, 0xFC, 0x43, 0x61, 0x73, 0x7A, 0xD1, 0xFA,
-    0xC9, 0x4A, 0xC9, 0x44, 0xA0, 0x1B, 0xF2, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x43, 0x69, 0x2E, 0x75, 0xFF, 0xED,
-    0xD0, 0x50, 0xFF, 0xFD, 0xA0, 0x1C, 0xF3, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x01, 0x91, 0x68, 0xFD, 0x41,
-    0x65, 0xD0, 0x8F, 0x42, 0x6E, 0x7A, 0xFF, 0xFC, 0xCF, 0xDF, 0xA0, 0x1C, 0x12, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD,
-    0x44, 0x69, 0x6C, 0x76, 0x67, 0xFF, 0xF0, 0xCC, 0x06, 0xC9, 0x05, 0xFF, 0xFD, 0x43, 0x63, 0x65, 0x74, 0xD4, 0x3C,
-    0xC8, 0xE6, 0xC8, 0xF2, 0x42, 0x73, 0x7A, 0xCF, 0xEF, 0xEC, 0xEF, 0x43, 0x65, 0x68, 0x69, 0xD1, 0x9D, 0xCA, 0x64,
-    0xFF, 0xF9, 0xCB, 0x03, 0xD1, 0x62, 0x63, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xD7, 0xF3, 0xFF,
-    0x6D, 0xFF, 0x77, 0xD7, 0xF3, 0xCD, 0xBA, 0xFF, 0x89, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xF6,
-    0xA0, 0x0D, 0x82, 0x21, 0x74, 0xFD, 0x43, 0x6C, 0x6E, 0x76, 0xCF, 0x75, 0xE5, 0x51, 0xC8, 0xA1, 0xA2, 0x04, 0x02,
-    0x61, 0x69, 0xF3, 0xF6, 0x41, 0x6E, 0xDB, 0xDA, 0xA1, 0x00, 0xC1, 0x69, 0xFC, 0xA0, 0x1C, 0x32, 0x21, 0x63, 0xFD,
-    0x44, 0x61, 0x65, 0x63, 0x6F, 0xD1, 0x49, 0xCF, 0x94, 0xFF, 0xF5, 0xFF, 0xFD, 0xC3, 0x02, 0x41, 0x2E, 0x69, 0x79,
-    0xCF, 0x45, 0xFF, 0xF3, 0xEF, 0xD5, 0xA0, 0x1C, 0x52, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1, 0x02, 0x81, 0x72,
-    0xFD, 0x42, 0x6F, 0x74, 0xCB, 0x2B, 0xC8, 0x5A, 0xA0, 0x0D, 0xB2, 0xA1, 0x02, 0x81, 0x6F, 0xFD, 0xC1, 0x00, 0x51,
-    0x63, 0xC8, 0x63, 0xC1, 0x00, 0x41, 0x75, 0xC8, 0x6C, 0xC1, 0x02, 0x71, 0x65, 0xC8, 0x3F, 0xC7, 0x03, 0xD1, 0x61,
-    0x64, 0x65, 0x69, 0x73, 0x74, 0x2E, 0xFF, 0xEE, 0xC8, 0x76, 0xCF, 0x0A, 0xC8, 0x39, 0xFF, 0xF4, 0xFF, 0xFA, 0xCF,
-    0x6A, 0x41, 0x61, 0xCE, 0xF5, 0x21, 0x73, 0xFC, 0xC1, 0x02, 0x41, 0x74, 0xDA, 0x9E, 0xC1, 0x02, 0x31, 0x6C, 0xC8,
-    0x26, 0x42, 0x63, 0x65, 0xD0, 0xD6, 0xCE, 0xEA, 0xC2, 0x01, 0x41, 0x69, 0x79, 0xFF, 0xF9, 0xCF, 0x1A, 0x44, 0x61,
-    0x65, 0x68, 0x72, 0xFF, 0xEA, 0xCF, 0x3E, 0xF6, 0x41, 0xFF, 0xF7, 0x4B, 0x2E, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x72, 0x73, 0x74, 0x76, 0xCE, 0xC2, 0xFF, 0x7D, 0xFF, 0x92, 0xFF, 0x97, 0xFF, 0xA1, 0xFF, 0xB8, 0xCF, 0xA0, 0xFF,
-    0xD4, 0xFF, 0xD7, 0xFF, 0xF3, 0xCF, 0x5A, 0xA0, 0x1C, 0x73, 0xA1, 0x00, 0x51, 0x62, 0xFD, 0x42, 0x61, 0x67, 0xFF,
-    0xFB, 0xC7, 0xC7, 0x41, 0x61, 0xCF, 0xCC, 0x43, 0x61, 0x65, 0x74, 0xCF, 0xC8, 0xEF, 0x1D, 0xFF, 0xFC, 0x41, 0x67,
-    0xCE, 0x12, 0x41, 0x69, 0xC9, 0x6A, 0x21, 0x6C, 0xFC, 0xA2, 0x01, 0x41, 0x61, 0x69, 0xF5, 0xFD, 0x22, 0x69, 0x6C,
-    0xE4, 0xF9, 0xC2, 0x01, 0x41, 0x69, 0x79, 0xC7, 0xB3, 0xCE, 0x6F, 0x21, 0x6C, 0xF7, 0xA0, 0x1C, 0xC3, 0x21, 0x74,
-    0xFD, 0x22, 0x72, 0x73, 0xFA, 0xFD, 0x21, 0x65, 0xFB, 0xA1, 0x01, 0x41, 0x74, 0xFD, 0xA0, 0x1C, 0xA2, 0x21, 0x2E,
-    0xFD, 0x21, 0x73, 0xFD, 0x47, 0x61, 0x64, 0x65, 0x67, 0x74, 0x75, 0x69, 0xC7, 0x73, 0xCF, 0x7F, 0xD1, 0x32, 0xFF,
-    0xE1, 0xC7, 0x73, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x2E, 0xC7, 0x5D, 0x21, 0x72, 0xFC, 0x41, 0x79, 0xCE, 0x2A, 0x42,
-    0x69, 0x72, 0xC7, 0x52, 0xFF, 0xFC, 0xC3, 0x02, 0x11, 0x65, 0x6C, 0x74, 0xFF, 0xF2, 0xC7, 0x63, 0xFF, 0xF9, 0x41,
-    0x68, 0xCE, 0x10, 0x4A, 0x2E, 0x61, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0xD0, 0x03, 0xCE, 0x4E, 0xFF,
-    0x74, 0xC7, 0x3B, 0xFF, 0x9B, 0xFF, 0xC8, 0xCB, 0xDA, 0xFF, 0xF0, 0xFF, 0xFC, 0xCE, 0x6C, 0xA0, 0x1C, 0xB2, 0x42,
-    0x72, 0x62, 0xF3, 0xA0, 0xFF, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xF9, 0x41, 0x6E, 0xCE, 0xFE, 0xC3, 0x04, 0x02, 0x61,
-    0x69, 0x6F, 0xCE, 0x72, 0xFF, 0xFC, 0xCE, 0x72, 0xC1, 0x1D, 0x23, 0x69, 0xD0, 0xEA, 0x21, 0x74, 0xFA, 0xA1, 0x01,
-    0x91, 0x61, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x0D, 0xD2, 0xC1, 0x00, 0xC1, 0x65, 0xC7, 0x01, 0x21, 0x73, 0xFA, 0xA0,
-    0x1D, 0x52, 0x42, 0x73, 0x63, 0xCD, 0xD4, 0xFF, 0xFD, 0x21, 0x65, 0xF9, 0x42, 0x74, 0x79, 0xC6, 0xEB, 0xCA, 0x69,
-    0x43, 0x61, 0x73, 0x7A, 0xC8, 0x5B, 0xEE, 0x0D, 0xCD, 0xDF, 0xA0, 0x1D, 0x72, 0x21, 0x6E, 0xFD, 0xA0, 0x11, 0x72,
-    0x44, 0x6C, 0x63, 0x65, 0x73, 0xCC, 0x02, 0xCA, 0xF7, 0xFF, 0xFA, 0xFF, 0xFD, 0x45, 0x65, 0x67, 0x69, 0x6F, 0x79,
-    0xFF, 0xD9, 0xCA, 0xC9, 0xFF, 0xE0, 0xFF, 0xF3, 0xD3, 0x19, 0xA0, 0x1D, 0x92, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x6E, 0xFD, 0xC2, 0x02, 0x81, 0x61, 0x6F, 0xDC, 0xD5, 0xFF, 0xFD, 0xC2, 0x00, 0xD1, 0x65, 0x70, 0xCE, 0xD6,
-    0xCD, 0x9A, 0xA0, 0x10, 0x12, 0x21, 0x74, 0xFD, 0xA1, 0x00, 0xF1, 0x65, 0xFD, 0x21, 0x68, 0xFB, 0x41, 0x6E, 0xE9,
-    0xB7, 0xA1, 0x02, 0x71, 0x69, 0xFC, 0x42, 0x66, 0x73, 0xCD, 0x3B, 0xFF, 0xFB, 0x41, 0x73, 0xD5, 0x8E, 0x21, 0x61,
-    0xFC, 0x21, 0x6C, 0xFD, 0xCE, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x65, 0xFF, 0x67, 0xFF, 0x6A, 0xD0, 0x5E, 0xFF, 0x73, 0xCD, 0x27, 0xFF, 0x80, 0xCF, 0xAA, 0xFF, 0xAA, 0xFF,
-    0xC6, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xEF, 0xD0, 0x5B, 0xFF, 0xFD, 0xC1, 0x00, 0xA1, 0x62, 0xC6, 0x41, 0x42, 0x61,
-    0x69, 0xFF, 0xFA, 0xC6, 0x44, 0x21, 0x72, 0xF9, 0x41, 0x73, 0xCB, 0x62, 0x21, 0x61, 0xFC, 0xC5, 0x02, 0x11, 0x61,
-    0x65, 0x6E, 0x72, 0x73, 0xC6, 0x12, 0xD1, 0x10, 0xCF, 0xC0, 0xCC, 0xE6, 0xCC, 0xEE, 0x41, 0x74, 0xC7, 0xD2, 0x21,
-    0x69, 0xFC, 0x44, 0x72, 0x73, 0x75, 0x76, 0xC8, 0xD8, 0xFF, 0xFD, 0xCE, 0xEE, 0xC6, 0x1A, 0xC7, 0x04, 0x02, 0x61,
-    0x65, 0x68, 0x69, 0x6F, 0x74, 0x79, 0xFF, 0xD0, 0xD1, 0x6F, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xF3, 0xCF, 0xFE, 0xCD,
-    0x1D, 0xA0, 0x1D, 0xB2, 0x21, 0x6B, 0xFD, 0x21, 0x63, 0xFD, 0xA1, 0x01, 0x41, 0x61, 0xFD, 0xC2, 0x0A, 0x23, 0x68,
-    0x69, 0xFF, 0xFB, 0xCC, 0x9A, 0xA0, 0x1D, 0xD2, 0xA1, 0x01, 0x01, 0x75, 0xFD, 0xA1, 0x02, 0xE1, 0x69, 0xFB, 0x42,
-    0x61, 0x74, 0xD5, 0x07, 0xFF, 0xFB, 0x41, 0x6F, 0xCF, 0xAE, 0x21, 0x72, 0xFC, 0xC6, 0x03, 0xD1, 0x6C, 0x6D, 0x6E,
-    0x70, 0x75, 0x64, 0xFF, 0xF2, 0xCD, 0xAE, 0xC7, 0x40, 0xCC, 0x73, 0xCD, 0x0B, 0xFF, 0xFD, 0x52, 0x61, 0x62, 0x63,
-    0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFC, 0xC2, 0xFC, 0xF6,
-    0xD6, 0x8E, 0xFD, 0x9C, 0xD4, 0x3F, 0xD4, 0xB5, 0xFE, 0x52, 0xCC, 0x5E, 0xD4, 0x3F, 0xFE, 0x7B, 0xFE, 0x84, 0xFF,
-    0x37, 0xFF, 0xA1, 0xD4, 0xB8, 0xFF, 0xC7, 0xCC, 0x5E, 0xFF, 0xEB, 0xCC, 0x5E, 0xC1, 0x08, 0x63, 0x75, 0xCD, 0x47,
-    0x43, 0x2E, 0x61, 0x74, 0xCC, 0x21, 0xCC, 0xB9, 0xCC, 0x24, 0x41, 0x72, 0xE8, 0xA6, 0x21, 0x65, 0xFC, 0xC1, 0x02,
-    0x31, 0x61, 0xCC, 0x1B, 0x42, 0x69, 0x74, 0xFF, 0xFA, 0xCC, 0x0A, 0x41, 0x69, 0xCC, 0x29, 0x41, 0x69, 0xCA, 0x77,
-    0xC3, 0x02, 0x11, 0x63, 0x69, 0x6B, 0xFF, 0xFC, 0xC6, 0x93, 0xC5, 0x24, 0x41, 0x2E, 0xDC, 0x54, 0x21, 0x73, 0xFC,
-    0xA1, 0x00, 0x71, 0x68, 0xFD, 0x45, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0xFF, 0xFB, 0xCB, 0xE3, 0xC5, 0x24, 0xC5, 0x12,
-    0xCB, 0xE6, 0xC2, 0x01, 0x41, 0x63, 0x74, 0xC5, 0x02, 0xD2, 0xDE, 0x41, 0x6D, 0xDB, 0xA4, 0xC2, 0x02, 0x11, 0x61,
-    0x6F, 0xCC, 0x0B, 0xFF, 0xFC, 0xC2, 0x02, 0x11, 0x73, 0x74, 0xCA, 0xFA, 0xCC, 0xF8, 0xCC, 0x03, 0xD1, 0x62, 0x63,
-    0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x76, 0xFF, 0x8D, 0xFF, 0x93, 0xFF, 0xA1, 0xC4, 0xE3, 0xFF,
-    0xAA, 0xFF, 0xB1, 0xFF, 0xB9, 0xFF, 0xD1, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF, 0xF7, 0xC5, 0x20, 0x41, 0x73, 0xE0, 0x89,
-    0xA0, 0x1D, 0xF3, 0x21, 0x74, 0xFD, 0x42, 0x6F, 0x73, 0xCB, 0x86, 0xFF, 0xFD, 0x42, 0x6C, 0x73, 0xCB, 0x7F, 0xCB,
-    0xFA, 0x43, 0x61, 0x65, 0x69, 0xCB, 0xF3, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x6E, 0x74, 0xCB, 0xDA, 0xCC, 0x03, 0x41,
-    0x75, 0xF1, 0xE7, 0x47, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0xC5, 0x9E, 0xFF, 0xD3, 0xFF, 0xEB, 0xFF, 0xF5,
-    0xFF, 0xFC, 0xCD, 0x01, 0xCD, 0x01, 0x42, 0x69, 0x6E, 0xCC, 0x6A, 0xCB, 0x4D, 0xC1, 0x02, 0xB1, 0x73, 0xCE, 0x06,
-    0x41, 0x6B, 0xCC, 0xDE, 0x21, 0x63, 0xFC, 0x45, 0x62, 0x66, 0x74, 0x7A, 0x65, 0xC4, 0x65, 0xDC, 0x5F, 0xCC, 0xD7,
-    0xCB, 0xB4, 0xFF, 0xFD, 0x42, 0x63, 0x72, 0xCB, 0x29, 0xC4, 0x55, 0x41, 0x68, 0xD3, 0xB3, 0x46, 0x61, 0x65, 0x69,
-    0x75, 0x77, 0x74, 0xFF, 0xD1, 0xFF, 0xD8, 0xFF, 0xE5, 0xFF, 0xF5, 0xCF, 0xF8, 0xFF, 0xFC, 0x41, 0x6B, 0xCB, 0x4A,
-    0x21, 0x63, 0xFC, 0xC2, 0x02, 0x81, 0x75, 0x61, 0xC4, 0x42, 0xFF, 0xFD, 0xC1, 0x02, 0x81, 0x6B, 0xCC, 0xEF, 0x41,
-    0x76, 0xC4, 0x39, 0xA1, 0x02, 0x31, 0x69, 0xFC, 0x21, 0x74, 0xFB, 0x42, 0x61, 0x65, 0xFF, 0xFD, 0xCC, 0xDD, 0x42,
-    0x61, 0x69, 0xCB, 0x77, 0xD2, 0xFD, 0x42, 0x69, 0x6F, 0xCA, 0xE3, 0xCB, 0x70, 0xC1, 0x03, 0xD1, 0x65, 0xCA, 0xD1,
-    0x42, 0x62, 0x72, 0xC4, 0x1B, 0xCB, 0xEB, 0xC4, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x72, 0xFF, 0xF9, 0xCB, 0x24, 0xCE,
-    0x83, 0xC3, 0xF3, 0xA0, 0x0C, 0xB2, 0x21, 0x69, 0xFD, 0xC5, 0x03, 0xD1, 0x2E, 0x70, 0x74, 0x77, 0x6B, 0xD3, 0x06,
-    0xCA, 0xAF, 0xD3, 0x06, 0xCA, 0xAF, 0xFF, 0xFD, 0x41, 0x69, 0xF8, 0x6A, 0xC1, 0x02, 0x31, 0x65, 0xCA, 0x9C, 0x51,
-    0x2E, 0x61, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0xD2, 0xEA,
-    0xCE, 0x63, 0xFF, 0x92, 0xFF, 0x9B, 0xD2, 0xEA, 0xFF, 0xAD, 0xFF, 0xB4, 0xFF, 0xBB, 0xFF, 0xC2, 0xCB, 0xCE, 0xCD,
-    0xCA, 0xCD, 0xC7, 0xFF, 0xCF, 0xFF, 0xE4, 0xFF, 0xF6, 0xFF, 0xFA, 0xCB, 0x2B, 0x41, 0x65, 0xF5, 0x87, 0x21, 0x74,
-    0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0xA1, 0x02, 0x21, 0x69, 0xFD, 0x41, 0x62, 0xCB, 0x6D, 0xC1, 0x0E, 0x12,
-    0x73, 0xC3, 0x90, 0x21, 0x65, 0xFA, 0x42, 0x65, 0x69, 0xCA, 0x43, 0xCA, 0xBE, 0x43, 0x6C, 0x6E, 0x72, 0xCA, 0xB7,
-    0xFF, 0xF6, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xCA, 0x3A, 0xCA, 0x9E, 0x43, 0x62, 0x6E, 0x74, 0xCA, 0xA6, 0xCA, 0x97,
-    0xCA, 0x2B, 0x41, 0x76, 0xC3, 0x47, 0x41, 0x72, 0xCA, 0x89, 0x42, 0x68, 0x70, 0xCA, 0x21, 0xFF, 0xFC, 0xC1, 0x02,
-    0xB1, 0x6D, 0xCB, 0x2F, 0x49, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x73, 0x75, 0x79, 0xFF, 0xBC, 0xFF, 0xD0, 0xFF,
-    0xDA, 0xFF, 0xE1, 0xE3, 0x41, 0xFF, 0xEB, 0xFF, 0xF3, 0xFF, 0xFA, 0xCA, 0x69, 0xC1, 0x00, 0x51, 0x62, 0xC4, 0xAB,
-    0xC2, 0x08, 0x33, 0x61, 0x65, 0xFF, 0xFA, 0xC3, 0x16, 0xC1, 0x01, 0xE1, 0x2E, 0xEF, 0x30, 0xC2, 0x06, 0xB2, 0x6E,
-    0x70, 0xFF, 0xFA, 0xCA, 0x70, 0x42, 0x61, 0x6C, 0xCA, 0x11, 0xCA, 0x67, 0xC1, 0x02, 0x31, 0x69, 0xC9, 0xD3, 0xC1,
-    0x02, 0x81, 0x63, 0xC9, 0xEB, 0x21, 0x69, 0xFA, 0xC1, 0x02, 0xB1, 0x69, 0xD2, 0x2D, 0xC2, 0x02, 0xB1, 0x65, 0x67,
-    0xD5, 0xE0, 0xC2, 0xE2, 0x42, 0x2E, 0x74, 0xCB, 0xA1, 0xC3, 0xD2, 0xC4, 0x02, 0x11, 0x68, 0x69, 0x6F, 0x72, 0xCA,
-    0xC3, 0xD3, 0x9B, 0xCD, 0x73, 0xC9, 0xE5, 0x4C, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6D, 0x6E, 0x6F, 0x73,
-    0x74, 0xFF, 0xBC, 0xFF, 0xC5, 0xFF, 0xCC, 0xCC, 0xD5, 0xFF, 0xD8, 0xCA, 0xDD, 0xC2, 0xC3, 0xFF, 0xDB, 0xFF, 0xE1,
-    0xCA, 0x2C, 0xFF, 0xEA, 0xFF, 0xF1, 0x42, 0x72, 0x74, 0xD6, 0x24, 0xC9, 0xED, 0x41, 0x75, 0xE0, 0xC8, 0xC4, 0x04,
-    0x22, 0x65, 0x69, 0x6C, 0x72, 0xFF, 0xF5, 0xCE, 0xA6, 0xCB, 0x05, 0xFF, 0xFC, 0xC1, 0x04, 0x02, 0x65, 0xE6, 0x0C,
-    0xC1, 0x00, 0x51, 0x74, 0xC2, 0x78, 0xA1, 0x01, 0x71, 0x65, 0xFA, 0x42, 0x61, 0x76, 0xD9, 0x57, 0xC2, 0x73, 0xC2,
-    0x0A, 0x23, 0x65, 0x69, 0xC2, 0x6C, 0xFF, 0xF9, 0xC1, 0x00, 0x51, 0x65, 0xC9, 0x76, 0x21, 0x6C, 0xFA, 0xA0, 0x1E,
-    0x23, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD, 0x42, 0x6C, 0x65, 0xC9, 0x22, 0xFF, 0xFD, 0xC1, 0x01,
-    0x91, 0x65, 0xC2, 0x41, 0x41, 0x73, 0xC5, 0xB2, 0xA0, 0x0E, 0x32, 0x41, 0x73, 0xCB, 0x02, 0x21, 0x69, 0xFC, 0x21,
-    0x67, 0xFD, 0x22, 0x69, 0x6F, 0xF3, 0xFD, 0xA0, 0x08, 0x92, 0x21, 0x74, 0xFD, 0x43, 0x63, 0x7A, 0x73, 0xCA, 0x31,
-    0xE9, 0x86, 0xFF, 0xFD, 0x41, 0x6F, 0xD3, 0x71, 0x21, 0x6E, 0xFC, 0x45, 0x69, 0x6F, 0x79, 0x61, 0x65, 0xFF, 0xEF,
-    0xC9, 0x7D, 0xC9, 0x27, 0xE5, 0xAD, 0xFF, 0xFD, 0x41, 0x67, 0xC2, 0x04, 0x41, 0x6F, 0xC5, 0xA5, 0xC2, 0x00, 0x81,
-    0x7A, 0x73, 0xC8, 0xD0, 0xFF, 0xFC, 0x41, 0x71, 0xC1, 0xFF, 0xA3, 0x02, 0x31, 0x61, 0x69, 0x65, 0xEB, 0xF3, 0xFC,
-    0xA0, 0x0E, 0x53, 0xA0, 0x1D, 0x22, 0x21, 0x2E, 0xFD, 0x22, 0x69, 0x79, 0xF7, 0xFD, 0x21, 0x6C, 0xFB, 0xA1, 0x01,
-    0x91, 0x6F, 0xFD, 0x42, 0x62, 0x72, 0xC1, 0xE8, 0xCF, 0x87, 0x21, 0x61, 0xF9, 0x43, 0x63, 0x65, 0x74, 0xC8, 0x97,
-    0xC1, 0xC6, 0xC1, 0xDE, 0xC1, 0x03, 0xD1, 0x6E, 0xC9, 0xC8, 0xA0, 0x0E, 0x82, 0x41, 0x62, 0xC8, 0xF3, 0x22, 0x6C,
-    0x6D, 0xF9, 0xFC, 0x21, 0x65, 0xFB, 0x41, 0x6C, 0xC3, 0x36, 0x50, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xFF, 0x46, 0xFF, 0x55, 0xD6, 0x56, 0xC9, 0xAF, 0xFF, 0x5C, 0xFF,
-    0x62, 0xFF, 0x73, 0xFF, 0x8F, 0xFF, 0xB4, 0xFF, 0xCE, 0xFF, 0xDA, 0xFF, 0xDD, 0xCA, 0xB6, 0xFF, 0xE7, 0xFF, 0xF9,
-    0xFF, 0xFC, 0x41, 0x65, 0xC2, 0xBB, 0xC2, 0x07, 0x42, 0x69, 0x72, 0xC1, 0x6E, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0x75,
-    0xC1, 0x65, 0x42, 0x62, 0x74, 0xC8, 0x3B, 0xFC, 0x31, 0xC1, 0x02, 0x31, 0x65, 0xDD, 0xC7, 0xC1, 0x02, 0x11, 0x73,
-    0xDB, 0x72, 0x42, 0x64, 0x67, 0xC4, 0x74, 0xC1, 0x46, 0xC1, 0x01, 0xE1, 0x6F, 0xCB, 0x4D, 0x41, 0x61, 0xC6, 0x93,
-    0xC9, 0x08, 0x63, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x6D, 0x6F, 0x70, 0x74, 0xFF, 0xDC, 0xFF, 0xE3, 0xFF, 0xE9, 0xFF,
-    0xEF, 0xC8, 0x6C, 0xFF, 0xF6, 0xCD, 0x42, 0xCA, 0xF3, 0xFF, 0xFC, 0x41, 0x72, 0xC3, 0x3B, 0x42, 0x65, 0x67, 0xC8,
-    0x68, 0xDB, 0x39, 0xC5, 0x02, 0x81, 0x62, 0x65, 0x66, 0x6E, 0x70, 0xC7, 0xE6, 0xC1, 0x15, 0xC2, 0xB0, 0xFF, 0xF9,
-    0xC1, 0x12, 0x41, 0x6C, 0xC3, 0x6A, 0x21, 0x6C, 0xFC, 0x41, 0x70, 0xC4, 0x21, 0x22, 0x6F, 0x65, 0xF9, 0xFC, 0x41,
-    0x6D, 0xC6, 0xFE, 0xC6, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x72, 0x73, 0x75, 0xE1, 0xCC, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF,
-    0xF7, 0xC8, 0x55, 0xFF, 0xFC, 0x41, 0x66, 0xC1, 0x14, 0x42, 0x6E, 0x74, 0xC8, 0x22, 0xD0, 0x50, 0xC2, 0x01, 0x41,
-    0x65, 0x69, 0xC8, 0x0C, 0xC7, 0xA0, 0xA0, 0x0E, 0xA2, 0x49, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x6F, 0x74,
-    0xC8, 0x00, 0xC8, 0x29, 0xC8, 0x6F, 0xFF, 0xE9, 0xFF, 0xED, 0xFF, 0xF4, 0xFF, 0xFD, 0xC8, 0x0F, 0xD0, 0x25, 0x42,
-    0x6D, 0x70, 0xC0, 0xA4, 0xC0, 0xA4, 0xC1, 0x01, 0x91, 0x61, 0xC7, 0xEC, 0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0xFB, 0xB4, 0xD8, 0xC5, 0xFC, 0x08, 0xFC, 0x4D, 0xFC, 0xD5, 0xFD, 0x16, 0xFD, 0x5F, 0xFD, 0x81, 0xFD, 0xD4, 0xC9,
-    0x09, 0xFE, 0x04, 0xFE, 0x13, 0xFE, 0x1F, 0xFE, 0x2B, 0xFE, 0xF4, 0xFF, 0x29, 0xC9, 0x09, 0xFF, 0x32, 0xFF, 0x5C,
-    0xFF, 0xAB, 0xFF, 0xD7, 0xD7, 0xE0, 0xDA, 0x5A, 0xFF, 0xF3, 0xFF, 0xFA, 0x41, 0x73, 0xE7, 0xAC, 0x21, 0x65, 0xFC,
-    0x42, 0x65, 0x74, 0xC0, 0x44, 0xC2, 0x16, 0xC5, 0x01, 0x91, 0x64, 0x6C, 0x72, 0x73, 0x74, 0xC0, 0x4F, 0xFF, 0xF6,
-    0xE8, 0xDC, 0xFF, 0xF9, 0xCE, 0x19, 0x42, 0x62, 0x72, 0xC9, 0xE0, 0xC6, 0xFF, 0xC1, 0x02, 0x11, 0x67, 0xC7, 0x00,
-    0xA1, 0x02, 0xB1, 0x6E, 0xFA, 0x41, 0x67, 0xCF, 0xD6, 0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x72, 0x75, 0x6C,
-    0xFF, 0xE7, 0xC4, 0x47, 0xFF, 0xF4, 0xC7, 0x61, 0xC7, 0x28, 0xFF, 0xFD, 0xC2, 0x00, 0x51, 0x65, 0x61, 0xCB, 0x82,
-    0xC9, 0xB0, 0x42, 0x66, 0x6C, 0xC1, 0x85, 0xC7, 0xE7, 0x41, 0x61, 0xDA, 0xA0, 0x41, 0x64, 0xC7, 0xDC, 0x41, 0x69,
-    0xCC, 0xBC, 0x42, 0x63, 0x74, 0xC6, 0xF6, 0xFF, 0xFC, 0x43, 0x61, 0x65, 0x69, 0xFF, 0xF9, 0xC1, 0x6B, 0xEF, 0xE0,
-    0x41, 0x6F, 0xED, 0x26, 0x42, 0x6C, 0x72, 0xC7, 0x5D, 0xC9, 0x8D, 0x48, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74,
-    0x75, 0xC8, 0x39, 0xFF, 0xC8, 0xFF, 0xD1, 0xFF, 0xD8, 0xFF, 0xDC, 0xFF, 0xEB, 0xFF, 0xF5, 0xFF, 0xF9, 0x41, 0x65,
-    0xC6, 0x8D, 0x41, 0x63, 0xC2, 0xD2, 0x21, 0x69, 0xFC, 0x43, 0x63, 0x6F, 0x74, 0xC6, 0xB6, 0xBF, 0xB5, 0xFF, 0xFD,
-    0xC1, 0x0E, 0xC2, 0x72, 0xC1, 0x28, 0x42, 0x2E, 0x73, 0xC6, 0x6F, 0xC6, 0x6F, 0x21, 0x74, 0xF9, 0x21, 0x63, 0xFD,
-    0x41, 0x6C, 0xC1, 0x18, 0x21, 0x6C, 0xFC, 0x25, 0x64, 0x69, 0x6F, 0x75, 0x65, 0xD1, 0xDC, 0xE6, 0xF6, 0xFD, 0x41,
-    0x67, 0xC6, 0x48, 0xA0, 0x1D, 0xC1, 0x21, 0x74, 0xFD, 0xA1, 0x02, 0x21, 0x73, 0xFD, 0x45, 0x6C, 0x6E, 0x72, 0x74,
-    0x76, 0xC7, 0x56, 0xFF, 0xF1, 0xFF, 0xFB, 0xD0, 0x02, 0xC6, 0xB4, 0x42, 0x65, 0x74, 0xC6, 0x31, 0xBF, 0x4F, 0xA1,
-    0x02, 0x11, 0x74, 0xF9, 0x21, 0x69, 0xFB, 0x42, 0x69, 0x6F, 0xC7, 0xF2, 0xC7, 0x37, 0x42, 0x72, 0x74, 0xEE, 0xDA,
-    0xFF, 0xF9, 0xC3, 0x02, 0xB1, 0x6E, 0x6F, 0x72, 0xC8, 0xF7, 0xC6, 0x0C, 0xC7, 0x29, 0xA0, 0x0E, 0xE2, 0x43, 0x65,
-    0x73, 0x74, 0xC6, 0x78, 0xFF, 0xFD, 0xC6, 0x3C, 0xC1, 0x01, 0x41, 0x79, 0xD7, 0x19, 0x41, 0x7A, 0xC7, 0x25, 0x21,
-    0x69, 0xFC, 0x41, 0x6F, 0xC7, 0x03, 0xC1, 0x03, 0xD1, 0x6E, 0xCE, 0x36, 0x48, 0x61, 0x65, 0x69, 0x6C, 0x6E, 0x72,
-    0x75, 0x79, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xF6, 0xCC, 0xE4, 0xFF, 0xFA, 0xC1,
-    0x07, 0x82, 0x61, 0xF1, 0xB7, 0x41, 0x73, 0xBE, 0xFB, 0x21, 0x65, 0xFC, 0x41, 0x65, 0xCE, 0x47, 0x41, 0x65, 0xC5,
-    0xD5, 0x42, 0x67, 0x74, 0xC6, 0x29, 0xBF, 0xF2, 0x43, 0x6D, 0x6F, 0x74, 0xC5, 0xA7, 0xC6, 0x82, 0xE6, 0x67, 0xC8,
-    0x02, 0x81, 0x63, 0x64, 0x66, 0x67, 0x6C, 0x6E, 0x73, 0x74, 0xFF, 0xE4, 0xFF, 0xE7, 0xE5, 0x7A, 0xBE, 0xC9, 0xFF,
-    0xEB, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xE7, 0x42, 0x6E, 0x73, 0xC5, 0xFD, 0xBE, 0xBD, 0xC2, 0x02, 0x41, 0x65, 0x69,
-    0xFF, 0xF9, 0xC9, 0xFD, 0xC2, 0x02, 0xB1, 0x6E, 0x73, 0xC6, 0x8F, 0xF8, 0x85, 0xC1, 0x02, 0x81, 0x65, 0xBE, 0xA1,
-    0x41, 0x72, 0xDB, 0x49, 0x21, 0x65, 0xFC, 0x42, 0x63, 0x74, 0xC5, 0xD7, 0xFF, 0xFD, 0x43, 0x72, 0x73, 0x74, 0xC5,
-    0x94, 0xFF, 0xF9, 0xC5, 0xD0, 0x42, 0x2E, 0x68, 0xC5, 0x4B, 0xC5, 0x8A, 0x42, 0x65, 0x69, 0xC5, 0x44, 0xD1, 0xF6,
-    0xA0, 0x1E, 0x53, 0x21, 0x6F, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x6F, 0xFD, 0xCB, 0x02, 0x81, 0x61, 0x63, 0x64, 0x66,
-    0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0x67, 0xC5, 0xAC, 0xD7, 0x92, 0xC5, 0xE5, 0xD5, 0x93, 0xC5, 0x31, 0xE0, 0x35,
-    0xC5, 0x31, 0xFF, 0xE6, 0xFF, 0xED, 0xC5, 0x31, 0xFF, 0xFD, 0x41, 0x69, 0xBE, 0xD0, 0xA0, 0x09, 0xE3, 0x21, 0x6D,
-    0xFD, 0x21, 0x6F, 0xFD, 0x43, 0x67, 0x72, 0x6E, 0xFE, 0x45, 0xBE, 0x2C, 0xFF, 0xFD, 0x44, 0x62, 0x6D, 0x6E, 0x73,
-    0xC5, 0x35, 0xC7, 0x76, 0xC5, 0x35, 0xC4, 0xF6, 0x4C, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75,
-    0x76, 0x79, 0xFF, 0x77, 0xFF, 0x80, 0xFF, 0x94, 0xC7, 0xFB, 0xFF, 0xB8, 0xFF, 0xDC, 0xFF, 0xE9, 0xC6, 0x10, 0xC8,
-    0x1A, 0xFF, 0xF3, 0xC8, 0x1A, 0xC5, 0x46, 0x43, 0x68, 0x6C, 0x74, 0xC4, 0xCC, 0xBE, 0x08, 0xFE, 0x09, 0x42, 0x65,
-    0x6C, 0xC7, 0xEB, 0xC5, 0x4F, 0x41, 0x73, 0xC9, 0x35, 0xC1, 0x01, 0x41, 0x72, 0xC6, 0x2A, 0xA0, 0x1E, 0x82, 0x21,
-    0x61, 0xFD, 0x21, 0x68, 0xFD, 0xC4, 0x02, 0x11, 0x6E, 0x72, 0x74, 0x63, 0xC5, 0x5B, 0xFF, 0xED, 0xFF, 0xF1, 0xFF,
-    0xFD, 0x42, 0x2E, 0x61, 0xC4, 0xD0, 0xC4, 0xD0, 0xC1, 0x01, 0xF1, 0x69, 0xC4, 0x8A, 0x44, 0x61, 0x63, 0x64, 0x6E,
-    0xC4, 0xFF, 0xFF, 0xF3, 0xC4, 0x84, 0xFF, 0xFA, 0x41, 0x64, 0xC6, 0x6B, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x42,
-    0x67, 0x6E, 0xBD, 0xD6, 0xC5, 0x8A, 0x42, 0x69, 0x72, 0xC4, 0xA5, 0xDA, 0xF6, 0x47, 0x61, 0x62, 0x65, 0x69, 0x6D,
-    0x6F, 0x70, 0xFF, 0x9B, 0xFF, 0xA5, 0xFF, 0xBF, 0xFF, 0xDB, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xF9, 0xC2, 0x01, 0xF1,
-    0x63, 0x6E, 0xC4, 0xDE, 0xC4, 0xC4, 0x41, 0x6C, 0xC5, 0x78, 0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xC1, 0x02, 0x41, 0x6F,
-    0xC4, 0x3F, 0x42, 0x6E, 0x73, 0xC4, 0xAC, 0xC4, 0x54, 0x44, 0x63, 0x6F, 0x73, 0x75, 0xC4, 0x96, 0xC4, 0xA5, 0xC4,
-    0x96, 0xC4, 0x2A, 0x41, 0x79, 0xC4, 0x5C, 0x21, 0x65, 0xFC, 0x42, 0x79, 0x69, 0xC4, 0x55, 0xFD, 0x98, 0x41, 0x6D,
-    0xEE, 0xAB, 0xA0, 0x1E, 0xA4, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x45, 0x64, 0x6D, 0x72, 0x74, 0x75, 0xC7, 0x14,
-    0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0xC4, 0x7D, 0xC1, 0x01, 0x81, 0x72, 0xC1, 0xC1, 0x21, 0x69, 0xFA, 0xC2, 0x01,
-    0xE1, 0x70, 0x75, 0xFF, 0xFD, 0xBD, 0x0F, 0xC1, 0x07, 0xE2, 0x66, 0xBD, 0x33, 0x42, 0x65, 0x69, 0xD3, 0x21, 0xFF,
-    0xFA, 0xCC, 0x02, 0x11, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xFF, 0x8A, 0xFF,
-    0x97, 0xFF, 0x9C, 0xFF, 0xA2, 0xC4, 0xB5, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xD1, 0xFF, 0xEA, 0xFF, 0xF9, 0xCF, 0x2C,
-    0xC0, 0x6C, 0x42, 0x65, 0x69, 0xBC, 0xF0, 0xBC, 0xF0, 0x41, 0x64, 0xC4, 0x20, 0xC5, 0x02, 0x81, 0x64, 0x6B, 0x70,
-    0x72, 0x73, 0xFF, 0xF5, 0xC4, 0x36, 0xBF, 0xAC, 0xFF, 0xFC, 0xC1, 0xB8, 0xC1, 0x02, 0x71, 0x67, 0xC3, 0x8C, 0xA1,
-    0x01, 0xF1, 0x61, 0xFA, 0x42, 0x64, 0x72, 0xBC, 0xC8, 0xFF, 0xFB, 0xC2, 0x02, 0x41, 0x61, 0x65, 0xDC, 0xFB, 0xC4,
-    0xC3, 0x41, 0x2E, 0xC3, 0xE0, 0x21, 0x6D, 0xFC, 0x43, 0x6E, 0x74, 0x73, 0xDE, 0x71, 0xC3, 0xE8, 0xFF, 0xFD, 0x42,
-    0x6E, 0x73, 0xC3, 0x63, 0xC5, 0x19, 0x48, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xB9, 0xFF, 0xD8,
-    0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xF9, 0xC4, 0xFA, 0xC3, 0xC8, 0xBC, 0xA0, 0x41, 0x67, 0xC7, 0xC5, 0xC4, 0x02, 0xB1,
-    0x2E, 0x67, 0x6C, 0x6E, 0xC3, 0x3F, 0xD6, 0x8B, 0xFC, 0x84, 0xFF, 0xFC, 0xC1, 0x00, 0x81, 0x6C, 0xC3, 0x30, 0x42,
-    0x68, 0x74, 0xBC, 0x6E, 0xC3, 0xDE, 0x44, 0x61, 0x69, 0x73, 0x77, 0xFF, 0xF3, 0xC3, 0x62, 0xFF, 0xF9, 0xBC, 0x49,
-    0x47, 0x61, 0x63, 0x6C, 0x6E, 0x6F, 0x74, 0x75, 0xCD, 0x43, 0xC3, 0xD1, 0xC3, 0x16, 0xC3, 0x82, 0xC4, 0xB4, 0xFE,
-    0xF9, 0xC3, 0x91, 0x41, 0x65, 0xBD, 0xCA, 0x42, 0x66, 0x75, 0xC2, 0xFC, 0xDE, 0x00, 0x41, 0x68, 0xC4, 0x2D, 0xC1,
-    0x02, 0x31, 0x6E, 0xBC, 0x35, 0x42, 0x65, 0x74, 0xFF, 0xFA, 0xBC, 0x11, 0xA0, 0x1E, 0xE3, 0x21, 0x74, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x69, 0xBF, 0x2C, 0x44, 0x69, 0x79, 0x6F, 0x72, 0xC3, 0x13, 0xC3, 0x13, 0xFF,
-    0xF9, 0xFF, 0xFC, 0x41, 0x6C, 0xC4, 0x42, 0x21, 0x65, 0xFC, 0x21, 0x76, 0xFD, 0x43, 0x68, 0x79, 0x69, 0xFF, 0xE9,
-    0xC3, 0x52, 0xFF, 0xFD, 0x41, 0x6D, 0xC2, 0xB3, 0x4D, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
-    0x74, 0x75, 0x79, 0xFF, 0x70, 0xFF, 0x8C, 0xC3, 0x91, 0xFF, 0x99, 0xC7, 0x77, 0xFF, 0xAF, 0xFF, 0xB3, 0xC7, 0x31,
-    0xFF, 0xBA, 0xFF, 0xC4, 0xFF, 0xF2, 0xFF, 0xFC, 0xC4, 0x4D, 0xC1, 0x02, 0x21, 0x69, 0xC2, 0x84, 0x21, 0x70, 0xFA,
-    0xC3, 0x02, 0x81, 0x65, 0x6F, 0x72, 0xC3, 0x13, 0xFF, 0xFD, 0xC2, 0x7E, 0x43, 0x69, 0x6F, 0x79, 0xC4, 0x4A, 0xC2,
-    0xB1, 0xC2, 0xB1, 0x43, 0x65, 0x74, 0x75, 0xDB, 0xC7, 0xFF, 0xF6, 0xBB, 0x94, 0x41, 0x72, 0xD5, 0xAA, 0x21, 0x65,
-    0xFC, 0x43, 0x61, 0x6F, 0x68, 0xC2, 0xEC, 0xC2, 0xEC, 0xFF, 0xFD, 0xC1, 0x02, 0x81, 0x74, 0xC7, 0x19, 0x42, 0x6C,
-    0x74, 0xC2, 0x4F, 0xC2, 0x4F, 0x22, 0x61, 0x69, 0xF3, 0xF9, 0x47, 0x61, 0x63, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0xC2,
-    0x7D, 0xFF, 0xBD, 0xFF, 0xD3, 0xC2, 0xD0, 0xC2, 0x98, 0xFF, 0xE4, 0xFF, 0xFB, 0x41, 0x65, 0xC0, 0x9D, 0x42, 0x2E,
-    0x73, 0xC2, 0x60, 0xC2, 0x29, 0xA0, 0x1F, 0x12, 0x21, 0x72, 0xFD, 0xA0, 0x0E, 0x72, 0x21, 0x72, 0xFD, 0x22, 0x65,
-    0x6F, 0xF7, 0xFD, 0xA1, 0x01, 0x41, 0x74, 0xFB, 0x23, 0x6C, 0x72, 0x73, 0xDF, 0xE3, 0xFB, 0xA0, 0x1F, 0x33, 0x21,
-    0x73, 0xFD, 0x42, 0x73, 0x6F, 0xC8, 0xFF, 0xFF, 0xFD, 0xC2, 0x01, 0x91, 0x65, 0x69, 0xFF, 0xF9, 0xE4, 0xC2, 0x43,
-    0x2E, 0x61, 0x65, 0xC2, 0x26, 0xC1, 0xEF, 0xC2, 0x62, 0x43, 0x63, 0x66, 0x73, 0xFF, 0xF6, 0xC2, 0x58, 0xC2, 0x58,
-    0x45, 0x61, 0x65, 0x68, 0x69, 0x6F, 0xF3, 0xF2, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xF6, 0xC5, 0xD5, 0x41, 0x6F, 0xE9,
-    0x02, 0x21, 0x64, 0xFC, 0x42, 0x6C, 0x61, 0xC1, 0xFB, 0xFF, 0xFD, 0x41, 0x68, 0xBE, 0x52, 0x42, 0x63, 0x64, 0xBB,
-    0xF5, 0xBC, 0x7B, 0xC6, 0x02, 0x81, 0x62, 0x63, 0x65, 0x6C, 0x6E, 0x76, 0xFF, 0xEE, 0xFF, 0xF5, 0xC1, 0xCD, 0xC2,
-    0x3F, 0xFF, 0xF9, 0xC1, 0xB2, 0x43, 0x6E, 0x73, 0x74, 0xBB, 0x58, 0xBC, 0x50, 0xC2, 0x2A, 0x42, 0x6E, 0x72, 0xC2,
-    0x20, 0xFF, 0xF6, 0xA0, 0x1F, 0x63, 0x21, 0x2E, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x73, 0x74, 0x61, 0xC1, 0xF6, 0xF5,
-    0x79, 0xFF, 0xFD, 0x41, 0x6C, 0xCC, 0xE4, 0x23, 0x65, 0x69, 0x6F, 0xE2, 0xF2, 0xFC, 0x42, 0x6C, 0x73, 0xC1, 0xA5,
-    0xC1, 0x89, 0x45, 0x64, 0x65, 0x69, 0x6E, 0x6F, 0xFB, 0xA9, 0xFF, 0xF9, 0xC1, 0xCB, 0xC8, 0x67, 0xC2, 0x7C, 0x41,
-    0x61, 0xC1, 0xBB, 0xA0, 0x12, 0x52, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x59,
-    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
-    0x74, 0x75, 0x76, 0x77, 0x79, 0x78, 0xFA, 0x2B, 0xFA, 0x56, 0xFA, 0xA1, 0xFA, 0xE9, 0xFB, 0x03, 0xFB, 0x1F, 0xFB,
-    0x60, 0xFB, 0x79, 0xFB, 0x9F, 0xC1, 0x3C, 0xFB, 0xC1, 0xFC, 0x53, 0xFC, 0xDD, 0xFD, 0x69, 0xFD, 0x9B, 0xFD, 0xE0,
-    0xC2, 0xDA, 0xFE, 0x8D, 0xFF, 0x01, 0xFF, 0x69, 0xFF, 0x92, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFD, 0x43,
-    0x61, 0x65, 0x74, 0xC1, 0x85, 0xC1, 0x85, 0xBA, 0x1C, 0x42, 0x6E, 0x74, 0xC2, 0xDA, 0xC1, 0x61, 0x21, 0x61, 0xF9,
-    0xC1, 0x01, 0x41, 0x6E, 0xBA, 0x02, 0x41, 0x74, 0xBD, 0x2D, 0x21, 0x61, 0xFC, 0xA1, 0x01, 0x41, 0x6D, 0xFD, 0x44,
-    0x61, 0x65, 0x74, 0x79, 0xB9, 0xF6, 0xD0, 0xDA, 0xBD, 0x09, 0xC1, 0x09, 0xC1, 0x01, 0xF1, 0x75, 0xC1, 0x52, 0xA0,
-    0x1F, 0x92, 0x21, 0x61, 0xFD, 0x42, 0x65, 0x72, 0xB9, 0xF5, 0xFF, 0xFD, 0x41, 0x65, 0xEC, 0x4B, 0xC1, 0x01, 0x81,
-    0x65, 0xBB, 0x61, 0x44, 0x62, 0x67, 0x6C, 0x6D, 0xBA, 0xAE, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFA, 0xC1, 0x02, 0x71,
-    0x6C, 0xB9, 0xD7, 0xC1, 0x02, 0x92, 0x73, 0xB9, 0xB9, 0x44, 0x61, 0x64, 0x65, 0x69, 0xFF, 0xE7, 0xC7, 0x8F, 0xFF,
-    0xF4, 0xFF, 0xFA, 0xC1, 0x02, 0x81, 0x72, 0xC0, 0x82, 0x42, 0x69, 0x79, 0xCD, 0xE4, 0xC0, 0x7C, 0x43, 0x65, 0x68,
-    0x72, 0xFF, 0xF3, 0xFF, 0xF9, 0xE3, 0xCA, 0xCB, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x74,
-    0x76, 0x79, 0xFF, 0x73, 0xC1, 0x80, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0x94, 0xFF, 0x99, 0xFF, 0xA6, 0xFF, 0xDC, 0xFF,
-    0xF6, 0xB9, 0x8F, 0xC1, 0x9B, 0xC1, 0x0E, 0xA2, 0x72, 0xC6, 0xA8, 0xC2, 0x02, 0x71, 0x61, 0x63, 0xBE, 0xAE, 0xB9,
-    0x65, 0xC2, 0x03, 0x42, 0x65, 0x69, 0xC1, 0x68, 0xFF, 0xF7, 0xC2, 0x01, 0x41, 0x64, 0x76, 0xB9, 0x53, 0xBF, 0xB3,
-    0x42, 0x61, 0x69, 0xC0, 0xB3, 0xB9, 0xE1, 0x41, 0x68, 0xB9, 0x43, 0x43, 0x61, 0x63, 0x74, 0xC0, 0xC1, 0xC1, 0x30,
-    0xFF, 0xFC, 0x43, 0x2E, 0x62, 0x67, 0xC1, 0x26, 0xBA, 0x17, 0xC1, 0x26, 0xC1, 0x01, 0x41, 0x73, 0xBE, 0x16, 0x42,
-    0x61, 0x65, 0xBD, 0x5A, 0xB9, 0x4C, 0x48, 0x61, 0x69, 0x6D, 0x6E, 0x6F, 0x74, 0x75, 0x76, 0xFF, 0xE9, 0xFF, 0xF3,
-    0xFF, 0xF9, 0xC1, 0x0F, 0xB9, 0x30, 0xBB, 0xFD, 0xBF, 0xFA, 0xB9, 0x2A, 0xC2, 0x02, 0x81, 0x65, 0x69, 0xC0, 0xB4,
-    0xC5, 0xDA, 0x4B, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x74, 0xBF, 0xCD, 0xFF, 0x91, 0xC3,
-    0x01, 0xFF, 0xA0, 0xFF, 0xA9, 0xB8, 0xFC, 0xFF, 0xB2, 0xFF, 0xBD, 0xC0, 0xAB, 0xFF, 0xDE, 0xFF, 0xF7, 0x41, 0x72,
-    0xBC, 0x4B, 0x43, 0x6E, 0x72, 0x73, 0xBC, 0x9F, 0xC0, 0x3F, 0xC1, 0x75, 0x41, 0x74, 0xD1, 0xAF, 0x41, 0x74, 0xBF,
-    0x13, 0xA0, 0x1F, 0xB3, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x6E, 0x74, 0xF3, 0xFD, 0x21, 0x61, 0xFB, 0x46,
-    0x63, 0x65, 0x6E, 0x73, 0x7A, 0x6C, 0xBF, 0xF3, 0xC1, 0x7B, 0xBF, 0xBE, 0xFF, 0xE7, 0xC0, 0xBF, 0xFF, 0xFD, 0x42,
-    0x65, 0x69, 0xC0, 0xAC, 0xC1, 0x68, 0x43, 0x62, 0x6E, 0x72, 0xC0, 0xA5, 0xFF, 0xF9, 0xB8, 0x99, 0x4A, 0x2E, 0x61,
-    0x65, 0x69, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x79, 0xBF, 0x60, 0xFF, 0xB5, 0xFF, 0xB9, 0xFF, 0xDC, 0xC2, 0x94, 0xFF,
-    0xF6, 0xBF, 0x60, 0xBF, 0xA2, 0xC1, 0x57, 0xCD, 0xF8, 0xC1, 0x01, 0xE1, 0x6E, 0xB8, 0x6A, 0xA0, 0x1E, 0xB3, 0x21,
-    0x64, 0xFD, 0x43, 0x69, 0x79, 0x61, 0xC0, 0x0C, 0xBF, 0xCD, 0xFF, 0xFD, 0xC3, 0x01, 0x41, 0x61, 0x65, 0x69, 0xBF,
-    0x2E, 0xBF, 0x6D, 0xC1, 0x22, 0x42, 0x63, 0x6E, 0xC0, 0x5A, 0xBF, 0x61, 0x41, 0x61, 0xE8, 0xEE, 0x21, 0x72, 0xFC,
-    0xC3, 0x02, 0x81, 0x2E, 0x64, 0x6F, 0xC0, 0x31, 0xB8, 0x3A, 0xC0, 0x31, 0xC1, 0x0F, 0x02, 0x6E, 0xB8, 0x2E, 0xC1,
-    0x02, 0x21, 0x61, 0xBF, 0x0A, 0x42, 0x68, 0x75, 0xFF, 0xFA, 0xC2, 0x2D, 0x49, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C,
-    0x6E, 0x6F, 0x74, 0xFF, 0xB1, 0xFF, 0xBD, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDE, 0xC4, 0x75, 0xFF, 0xE1, 0xFF, 0xED,
-    0xFF, 0xF9, 0xA0, 0x0F, 0x23, 0x42, 0x6E, 0x73, 0xC0, 0x0E, 0xBC, 0xED, 0xC1, 0x00, 0x51, 0x61, 0xBA, 0xF6, 0x41,
-    0x62, 0xBE, 0x55, 0x21, 0x61, 0xFC, 0x45, 0x61, 0x65, 0x67, 0x6E, 0x63, 0xB8, 0x00, 0xBA, 0xE9, 0xBE, 0xBF, 0xFF,
-    0xF3, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x62, 0xB7, 0xD8, 0x21, 0x6D, 0xFA, 0xC4, 0x0F, 0x53, 0x61, 0x69, 0x6F, 0x75,
-    0xFF, 0xD3, 0xFF, 0xE7, 0xB8, 0x96, 0xFF, 0xFD, 0xA0, 0x0F, 0x82, 0x42, 0x6D, 0x74, 0xBE, 0x9F, 0xFF, 0xFD, 0xA0,
-    0x0F, 0xA2, 0xC2, 0x00, 0xC1, 0x74, 0x63, 0xC0, 0x81, 0xE8, 0x2D, 0x21, 0x6E, 0xF7, 0xA0, 0x1F, 0xE2, 0x21, 0x6F,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x68, 0xFD, 0x43, 0x74, 0x65, 0x70, 0xB7, 0xBF, 0xBA, 0xC6, 0xFF,
-    0xFD, 0x41, 0x2E, 0xCC, 0xFD, 0x22, 0x79, 0x65, 0xF2, 0xFC, 0xC1, 0x06, 0x32, 0x79, 0xBE, 0xF4, 0xC1, 0x03, 0xD1,
-    0x73, 0xB7, 0x91, 0xC1, 0x01, 0x41, 0x61, 0xBE, 0xE8, 0x41, 0x6E, 0xC0, 0x41, 0x4C, 0x63, 0x64, 0x65, 0x67, 0x69,
-    0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0xBE, 0xDE, 0xCA, 0x73, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5, 0xFF, 0xE5,
-    0xC1, 0x5B, 0xBE, 0xDE, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x64, 0x6C, 0x6E, 0x72,
-    0x74, 0xBF, 0x41, 0xBE, 0x24, 0xBE, 0x9F, 0xBE, 0x9F, 0xBE, 0x9F, 0x41, 0x69, 0xBB, 0x5F, 0x21, 0x73, 0xFC, 0xC3,
-    0x04, 0x02, 0x61, 0x65, 0x6F, 0xCE, 0xA0, 0xFF, 0xE7, 0xFF, 0xFD, 0x41, 0x79, 0xB7, 0xC2, 0x42, 0x69, 0x6F, 0xBF,
-    0xEF, 0xB7, 0x3F, 0x41, 0x61, 0xB7, 0xF7, 0x41, 0x6C, 0xB7, 0xDA, 0x43, 0x65, 0x73, 0x70, 0xBE, 0x67, 0xBF, 0x24,
-    0xFF, 0xFC, 0xA0, 0x20, 0x02, 0x21, 0x63, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x75, 0xB7, 0x11, 0x21, 0x65, 0xFC, 0x4A,
-    0x63, 0x65, 0x66, 0x6C, 0x72, 0x73, 0x74, 0x76, 0x6D, 0x6E, 0xFF, 0xD7, 0xB8, 0x9F, 0xFF, 0xDE, 0xB7, 0xF7, 0xB7,
-    0x10, 0xFF, 0xE6, 0xBF, 0x5A, 0xB7, 0x10, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0F, 0xC2, 0x21, 0x74, 0xFD, 0xC1, 0x00,
-    0x51, 0x6F, 0xB8, 0x68, 0x43, 0x65, 0x6E, 0x73, 0xC7, 0x05, 0xFF, 0xF7, 0xFF, 0xFA, 0x41, 0x73, 0xB8, 0x67, 0x21,
-    0x73, 0xFC, 0xA0, 0x20, 0x22, 0x21, 0x2E, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x74, 0xFD, 0x43, 0x61, 0x65, 0x69, 0xBE,
-    0x05, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x69, 0xBB, 0x97, 0x41, 0x65, 0xBD, 0x08, 0x46, 0x63, 0x66, 0x6C, 0x73, 0x74,
-    0x67, 0xFF, 0xEE, 0xFF, 0xF8, 0xB6, 0xB6, 0xBA, 0x69, 0xB6, 0xB0, 0xFF, 0xFC, 0xC4, 0x02, 0x81, 0x61, 0x65, 0x69,
-    0x6F, 0xFF, 0x66, 0xFF, 0x93, 0xFF, 0xBE, 0xFF, 0xED, 0xA0, 0x20, 0x64, 0x22, 0x64, 0x66, 0xFD, 0xFD, 0xA1, 0x20,
-    0x42, 0x6F, 0xFB, 0x21, 0x64, 0xFB, 0xA1, 0x02, 0x11, 0x75, 0xFD, 0xC3, 0x08, 0x63, 0x65, 0x68, 0x69, 0xFF, 0xFB,
-    0xBD, 0xD6, 0xF2, 0xF1, 0x41, 0x62, 0xF4, 0x24, 0xA0, 0x20, 0xA2, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6D,
-    0xFD, 0xA0, 0x20, 0xC2, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0xC8, 0x03, 0xE2, 0x61, 0x65, 0x68, 0x69, 0x75, 0x77,
-    0x6F, 0x72, 0xFF, 0xE7, 0xBD, 0x79, 0xBD, 0x79, 0xB7, 0xE9, 0xB6, 0x4B, 0xBE, 0x39, 0xFF, 0xF4, 0xFF, 0xFD, 0xA0,
-    0x13, 0xE2, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x00, 0x71, 0x65, 0xFD, 0x42, 0x65, 0x69, 0xBB, 0x1C, 0xD2,
-    0x7F, 0xC3, 0x02, 0x81, 0x65, 0x72, 0x74, 0xC9, 0xE0, 0xBD, 0x2B, 0xFF, 0xF9, 0x49, 0x62, 0x65, 0x66, 0x6C, 0x6D,
-    0x6E, 0x72, 0x73, 0x74, 0xFF, 0xE8, 0xB6, 0x0C, 0xB6, 0x0C, 0xC6, 0x11, 0xBD, 0x75, 0xC0, 0x11, 0xB6, 0x0F, 0xBE,
-    0xD4, 0xFF, 0xF4, 0x53, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x77, 0xFC, 0x61, 0xC4, 0xA2, 0xBD, 0x59, 0xFC, 0xF4, 0xBC, 0xC1, 0xBC, 0xC1, 0xFD, 0x61, 0xFD,
-    0xCF, 0xFD, 0xEB, 0xFE, 0x1B, 0xC4, 0xA2, 0xC5, 0x32, 0xFE, 0x7B, 0xFE, 0xB9, 0xFF, 0x5F, 0xFF, 0x83, 0xFF, 0xA8,
-    0xFF, 0xE4, 0xBD, 0x3F, 0xA0, 0x20, 0xE2, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xC2, 0x21, 0x03,
-    0x72, 0x73, 0xBA, 0xC5, 0xBA, 0xC5, 0x21, 0x69, 0xF7, 0x43, 0x76, 0x69, 0x73, 0xB5, 0xB6, 0xFF, 0xF1, 0xFF, 0xFD,
-    0x43, 0x2E, 0x72, 0x74, 0xC4, 0xBC, 0xBD, 0xA0, 0xBD, 0xA0, 0xA0, 0x21, 0x32, 0x21, 0x73, 0xFD, 0x21, 0x73, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xDF, 0x21, 0x21, 0x61, 0xFC, 0x22, 0x6E, 0x76, 0xF6, 0xFD, 0xA3,
-    0x02, 0x81, 0x61, 0x65, 0x69, 0xD1, 0xDB, 0xFB, 0x21, 0x75, 0xF7, 0x41, 0x63, 0xBD, 0xD5, 0x42, 0x69, 0x6F, 0xFF,
-    0xFC, 0xEB, 0x99, 0x21, 0x6C, 0xF9, 0xC2, 0x02, 0x41, 0x69, 0x6F, 0xBC, 0x68, 0xFF, 0xFD, 0x42, 0x65, 0x75, 0xB5,
-    0x46, 0xBC, 0x5F, 0x42, 0x68, 0x6C, 0xFF, 0xF9, 0xBC, 0x19, 0x42, 0x66, 0x74, 0xC3, 0x1A, 0xB5, 0x3E, 0xA0, 0x21,
-    0x54, 0x21, 0x7A, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x72, 0xFD, 0x42, 0x74, 0x6E, 0xFF, 0xFB, 0xBC, 0x5A,
-    0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF9, 0xBC, 0x53, 0xC1, 0xDD, 0x45, 0x65, 0x67, 0x69, 0x6F, 0x68, 0xB8, 0x81, 0xB5,
-    0x55, 0xBD, 0x09, 0xBB, 0xF4, 0xEE, 0xBC, 0x42, 0x65, 0x68, 0xB7, 0xA8, 0xC2, 0xBB, 0xC1, 0x00, 0x41, 0x66, 0xB5,
-    0x19, 0x43, 0x63, 0x65, 0x69, 0xB5, 0x13, 0xFF, 0xFA, 0xD0, 0xE4, 0x41, 0x6E, 0xBA, 0x0F, 0x21, 0x6F, 0xFC, 0x21,
-    0x69, 0xFD, 0x42, 0x61, 0x65, 0xE3, 0x2A, 0xCB, 0xCB, 0x41, 0x69, 0xC0, 0x36, 0x41, 0x67, 0xEE, 0x20, 0x42, 0x67,
-    0x6F, 0xE9, 0x8B, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x50, 0x62, 0x63, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73,
-    0x74, 0x75, 0x76, 0x7A, 0x64, 0x6F, 0xFF, 0x79, 0xFF, 0x89, 0xFF, 0x90, 0xBB, 0xFF, 0xBE, 0xD6, 0xFF, 0xAC, 0xFF,
-    0xB6, 0xFF, 0xC6, 0xFF, 0xD3, 0xBB, 0xFF, 0xFF, 0xE4, 0xB6, 0x37, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xF1, 0x85,
-    0x42, 0x62, 0x67, 0xBC, 0x8E, 0xBC, 0x8E, 0xA0, 0x21, 0x92, 0x42, 0x2E, 0x65, 0xBB, 0x6F, 0xFF, 0xFD, 0xC2, 0x02,
-    0x11, 0x65, 0x67, 0xBB, 0x60, 0xFF, 0xF9, 0xC2, 0x00, 0xD1, 0x66, 0x6E, 0xB4, 0x83, 0xFF, 0xF7, 0xC3, 0x02, 0xB1,
-    0x61, 0x69, 0x6F, 0xFF, 0xDD, 0xFF, 0xF7, 0xBB, 0xE3, 0xC1, 0x02, 0x11, 0x6E, 0xB4, 0x68, 0x42, 0x61, 0x65, 0xBB,
-    0xB7, 0xB4, 0x6B, 0x42, 0x62, 0x74, 0xD2, 0x9E, 0xBB, 0xCA, 0x41, 0x6D, 0xB5, 0xE9, 0xA4, 0x02, 0xB1, 0x65, 0x68,
-    0x69, 0x75, 0xE8, 0xEE, 0xF5, 0xFC, 0x41, 0x6C, 0xBC, 0x3C, 0xC1, 0x00, 0x41, 0x67, 0xBB, 0x5A, 0xC3, 0x02, 0x81,
-    0x61, 0x65, 0x6E, 0xB4, 0x41, 0xB4, 0x44, 0xFF, 0xFA, 0x22, 0x61, 0x69, 0xEA, 0xF4, 0x45, 0x6C, 0x6E, 0x72, 0x76,
-    0x77, 0xBB, 0x70, 0xBB, 0x43, 0xC3, 0x12, 0xBC, 0xF8, 0xBB, 0x99, 0x41, 0x61, 0xBB, 0x68, 0x21, 0x72, 0xFC, 0x41,
-    0x70, 0xB8, 0x36, 0x42, 0x6C, 0x6D, 0xC5, 0xD6, 0xFF, 0xFC, 0xA0, 0x21, 0xB3, 0x21, 0x72, 0xFD, 0x21, 0x70, 0xFD,
-    0xA0, 0x21, 0xE2, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x44, 0x6F, 0x72, 0x69, 0x74, 0xFF, 0xE4,
-    0xBB, 0xA1, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xBA, 0xFF, 0xB4, 0x04, 0xC2, 0x03, 0x42, 0x65, 0x69, 0xBB,
-    0x25, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72, 0xBB, 0x64, 0x44, 0x61, 0x65, 0x69, 0x79, 0xDE, 0x03, 0xFF, 0xFA, 0xBA,
-    0xE9, 0xBB, 0x3F, 0x41, 0x69, 0xF4, 0xE0, 0x42, 0x69, 0x75, 0xBB, 0x05, 0xBA, 0xA1, 0x42, 0x61, 0x65, 0xD1, 0xFB,
-    0xB3, 0xBE, 0x21, 0x74, 0xF9, 0x41, 0x73, 0xBD, 0x9A, 0x43, 0x69, 0x6F, 0x75, 0xBB, 0x5F, 0xFF, 0xFC, 0xBA, 0xF0,
-    0xC3, 0x08, 0xA2, 0x69, 0x6F, 0x75, 0xBB, 0x97, 0xB3, 0xA0, 0xBA, 0x82, 0x41, 0x69, 0xE6, 0x62, 0xC2, 0x00, 0xD1,
-    0x61, 0x72, 0xBB, 0x91, 0xBA, 0xA9, 0x44, 0x2E, 0x70, 0x73, 0x74, 0xBB, 0x7E, 0xBD, 0x73, 0xFF, 0xF3, 0xFF, 0xF7,
-    0x41, 0x7A, 0xD4, 0x02, 0x41, 0x75, 0xCE, 0xF2, 0xA1, 0x01, 0xE1, 0x62, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x65, 0x69,
-    0x72, 0xBD, 0x82, 0xFF, 0xF0, 0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x74, 0xE1, 0xA9, 0x43, 0x2E, 0x73, 0x74, 0xBB, 0xF5,
-    0xBA, 0x3C, 0xBA, 0x3C, 0x42, 0x6C, 0x72, 0xB3, 0x68, 0xFF, 0xF6, 0x41, 0x6C, 0xD9, 0x95, 0xC4, 0x00, 0xD1, 0x61,
-    0x65, 0x69, 0x6F, 0xC9, 0x6A, 0xFF, 0xF5, 0xBB, 0x46, 0xFF, 0xFC, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0xC2, 0x64, 0xFF, 0x0C, 0xFF, 0x20, 0xFF, 0x43,
-    0xFF, 0x57, 0xFF, 0x66, 0xFF, 0x73, 0xBA, 0x33, 0xFF, 0x77, 0xFF, 0x85, 0xBA, 0x7C, 0xFF, 0x8C, 0xFF, 0x96, 0xFF,
-    0xAF, 0xFF, 0xCC, 0xFF, 0xD6, 0xFF, 0xF1, 0xBF, 0x4B, 0xC2, 0x02, 0xB1, 0x75, 0x79, 0xB3, 0x05, 0xBA, 0xF6, 0x42,
-    0x72, 0x74, 0xBA, 0x0F, 0xBA, 0x4B, 0xC1, 0x00, 0x51, 0x67, 0xBA, 0x08, 0x44, 0x63, 0x6E, 0x73, 0x74, 0xBA, 0x3E,
-    0xFF, 0xFA, 0xB9, 0xC3, 0xB9, 0xC3, 0xC5, 0x02, 0x81, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0xFF, 0xE6, 0xFF, 0xF3, 0xBB,
-    0x54, 0xCF, 0x42, 0xBA, 0x31, 0xC2, 0x02, 0x31, 0x2E, 0x61, 0xB9, 0xA1, 0xCE, 0xB9, 0xC3, 0x01, 0xE1, 0x62, 0x67,
-    0x6C, 0xB2, 0xC7, 0xBA, 0x30, 0xBB, 0x12, 0xC1, 0x01, 0x41, 0x61, 0xB2, 0xCD, 0xC2, 0x01, 0x91, 0x64, 0x65, 0xBB,
-    0x7D, 0xBA, 0x1E, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xBD, 0x82, 0xBA, 0x9D, 0xFF, 0xF7, 0xBA, 0x9D, 0x42, 0x63, 0x74,
-    0xB9, 0xB2, 0xB9, 0xB2, 0x43, 0x6E, 0x72, 0x74, 0xFF, 0xF9, 0xB9, 0xD8, 0xB9, 0x74, 0x42, 0x61, 0x69, 0xB5, 0x5F,
-    0xBB, 0x56, 0x41, 0x69, 0xC5, 0xC8, 0x44, 0x61, 0x69, 0x6F, 0x70, 0xFB, 0x0A, 0xB2, 0x9B, 0xBA, 0x8F, 0xB2, 0xC0,
-    0xC1, 0x02, 0x11, 0x2E, 0xBB, 0x3E, 0x44, 0x61, 0x64, 0x65, 0x67, 0xFF, 0xFA, 0xB2, 0x70, 0xB2, 0x70, 0xB2, 0x70,
-    0xC1, 0x02, 0xE1, 0x65, 0xB2, 0x84, 0xC1, 0x02, 0x81, 0x69, 0xE4, 0xF8, 0x22, 0x68, 0x6C, 0xF4, 0xFA, 0xC4, 0x02,
-    0x11, 0x2E, 0x63, 0x68, 0x70, 0xBA, 0x43, 0xB2, 0x52, 0xB9, 0xA1, 0xB2, 0x52, 0x41, 0x62, 0xE0, 0x56, 0x42, 0x2E,
-    0x73, 0xB2, 0x57, 0xB2, 0x57, 0x42, 0x64, 0x72, 0xBA, 0xF1, 0xFF, 0xF9, 0xC1, 0x02, 0x81, 0x72, 0xB2, 0x49, 0x44,
-    0x61, 0x65, 0x69, 0x75, 0xFF, 0xE8, 0xFF, 0xF3, 0xC2, 0x30, 0xFF, 0xFA, 0x42, 0x6C, 0x74, 0xB2, 0x36, 0xB2, 0x30,
-    0xA0, 0x16, 0x42, 0x21, 0x6C, 0xFD, 0x43, 0x65, 0x69, 0x6F, 0xFF, 0xF3, 0xB2, 0x23, 0xFF, 0xFD, 0x4F, 0x61, 0x62,
-    0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x76, 0xFF, 0x40, 0xFF, 0x4C, 0xFF, 0x5B,
-    0xC0, 0x3A, 0xFF, 0x6F, 0xFF, 0x79, 0xFF, 0x80, 0xFF, 0x84, 0xFF, 0x97, 0xB9, 0x47, 0xFF, 0xB0, 0xB9, 0xF8, 0xFF,
-    0xB5, 0xFF, 0xDC, 0xFF, 0xF6, 0x42, 0x65, 0x69, 0xB9, 0x42, 0xB9, 0x5B, 0xA0, 0x22, 0x01, 0x41, 0x6F, 0xB9, 0x0F,
-    0x41, 0x75, 0xBA, 0x3D, 0x21, 0x61, 0xFC, 0x21, 0x2E, 0xF2, 0x46, 0x65, 0x6C, 0x2E, 0x68, 0x72, 0x73, 0xBD, 0x44,
-    0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x75, 0xBA, 0x43, 0xC2, 0x00, 0x51, 0x64, 0x71,
-    0xB8, 0xDB, 0xFF, 0xFC, 0xC1, 0x01, 0x41, 0x68, 0xB8, 0x7D, 0x42, 0x67, 0x73, 0xB9, 0x8C, 0xFF, 0xFA, 0xC3, 0x02,
-    0xB1, 0x65, 0x69, 0x6F, 0xFF, 0xEA, 0xFF, 0xF9, 0xC8, 0xCA, 0xC2, 0x02, 0x11, 0x6E, 0x72, 0xB8, 0xD7, 0xBC, 0x86,
-    0xC1, 0x01, 0xE1, 0x2E, 0xB9, 0x70, 0x21, 0x67, 0xFA, 0x43, 0x6E, 0x6F, 0x74, 0xFF, 0xFD, 0xB9, 0x67, 0xB8, 0xC5,
-    0xC4, 0x02, 0xB1, 0x61, 0x65, 0x69, 0x79, 0xE4, 0x07, 0xFF, 0xE4, 0xFF, 0xF6, 0xB9, 0x5D, 0x44, 0x6C, 0x72, 0x74,
-    0x79, 0xB8, 0xAC, 0xB9, 0x4E, 0xB8, 0x31, 0xB8, 0xAC, 0xA0, 0x09, 0x82, 0x44, 0x63, 0x73, 0x74, 0x76, 0xB8, 0x21,
-    0xFF, 0xFD, 0xB8, 0x9C, 0xB8, 0x9C, 0xC1, 0x00, 0x51, 0x75, 0xB9, 0x31, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xDA,
-    0xBD, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFA, 0xB8, 0x89, 0xA0, 0x1B, 0x52, 0x21, 0x74, 0xFD, 0x42, 0x6C, 0x6F, 0xB1,
-    0x36, 0xFF, 0xFD, 0xC1, 0x02, 0x11, 0x72, 0xB8, 0x30, 0xA0, 0x22, 0x12, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0x21,
-    0x69, 0xFD, 0xC2, 0x02, 0x31, 0x6C, 0x70, 0xEA, 0xAF, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xB8, 0x42, 0xB8, 0xFD, 0xC1,
-    0x00, 0xD1, 0x65, 0xBF, 0xDD, 0x41, 0x65, 0xC3, 0xF3, 0x42, 0x74, 0x73, 0xB5, 0x0E, 0xBA, 0xB4, 0x43, 0x65, 0x69,
-    0x70, 0xFF, 0xF9, 0xB0, 0xEA, 0xB0, 0xEA, 0x41, 0x73, 0xEE, 0xA3, 0x44, 0x61, 0x65, 0x69, 0x74, 0xB5, 0x11, 0xB0,
-    0xDC, 0xFF, 0xFC, 0xB1, 0xD5, 0x42, 0x6D, 0x74, 0xC6, 0x38, 0xB9, 0x97, 0x42, 0x65, 0x69, 0xB7, 0xDE, 0xC0, 0xCD,
-    0x42, 0x69, 0x6F, 0xB0, 0xD3, 0xB7, 0x9D, 0x42, 0x70, 0x73, 0xBE, 0xED, 0xB0, 0xBA, 0x41, 0x6F, 0xB9, 0x28, 0x43,
-    0x68, 0x79, 0x72, 0xB8, 0x57, 0xB8, 0x18, 0xFF, 0xFC, 0x42, 0x61, 0x65, 0xB8, 0x0E, 0xC2, 0x66, 0x4F, 0x62, 0x63,
-    0x65, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0xFF, 0x7A, 0xFF, 0x81, 0xFF, 0x93,
-    0xFF, 0x9C, 0xFF, 0xA3, 0xFF, 0xA9, 0xFF, 0xB4, 0xFF, 0xC2, 0xFF, 0xCF, 0xFF, 0xD6, 0xFF, 0xDD, 0xFF, 0xE4, 0xFF,
-    0xEF, 0xFF, 0xF9, 0xB0, 0xB6, 0x44, 0x61, 0x6E, 0x72, 0x74, 0xB8, 0x61, 0xB7, 0xB8, 0xB7, 0xF8, 0xB7, 0xBF, 0xA0,
-    0x22, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x75, 0xFD, 0xC5, 0x02, 0xB1, 0x65, 0x68, 0x69, 0x6F, 0x61,
-    0xFF, 0xE7, 0xD0, 0x8A, 0xE4, 0xBD, 0xB7, 0xA6, 0xFF, 0xFD, 0x44, 0x63, 0x66, 0x6F, 0x73, 0xB0, 0x45, 0xB0, 0x45,
-    0xB8, 0x36, 0xB1, 0xAE, 0x42, 0x6F, 0x76, 0xB0, 0x38, 0xB0, 0x38, 0x42, 0x6E, 0x73, 0xB0, 0x2B, 0xB0, 0x2B, 0xC4,
-    0x07, 0x42, 0x65, 0x69, 0x6F, 0x79, 0xFF, 0xE5, 0xFF, 0xF2, 0xFF, 0xF9, 0xB9, 0xA3, 0xC1, 0x02, 0xB1, 0x74, 0xBD,
-    0xF7, 0xC1, 0x02, 0x21, 0x72, 0xB0, 0x15, 0x41, 0x69, 0xE7, 0x13, 0x21, 0x64, 0xFC, 0x42, 0x2E, 0x61, 0xB6, 0xE4,
-    0xFF, 0xFD, 0xC4, 0x02, 0x11, 0x63, 0x72, 0x73, 0x76, 0xFF, 0xEC, 0xFF, 0xF9, 0xB7, 0x14, 0xB2, 0xE4, 0xC1, 0x02,
-    0xB1, 0x61, 0xB6, 0xC6, 0xC1, 0x02, 0xB1, 0x62, 0xCE, 0x29, 0xC8, 0x04, 0x22, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F,
-    0x70, 0x77, 0xFF, 0xCB, 0xB7, 0x4F, 0xFF, 0xE5, 0xFF, 0xF4, 0xFF, 0xFA, 0xC3, 0xDE, 0xB8, 0x58, 0xB6, 0xBA, 0x41,
-    0x68, 0xB5, 0x14, 0x42, 0x63, 0x67, 0xFF, 0xFC, 0xB7, 0xB8, 0x43, 0x62, 0x6E, 0x6F, 0xB7, 0x0F, 0xCC, 0x2B, 0xAF,
-    0xD8, 0x43, 0x69, 0x6C, 0x79, 0xB1, 0x45, 0xAF, 0xB0, 0xB7, 0xA7, 0xC7, 0x02, 0xB1, 0x62, 0x64, 0x65, 0x67, 0x6C,
-    0x73, 0x76, 0xB6, 0x88, 0xAF, 0xAC, 0xD9, 0x2F, 0xB6, 0xFB, 0xFF, 0xF6, 0xCA, 0x1A, 0xB7, 0x9D, 0x41, 0x68, 0xB4,
-    0xB2, 0x21, 0x70, 0xFC, 0x43, 0x69, 0x6F, 0x65, 0xB6, 0xDC, 0xFF, 0xFD, 0xFD, 0xC2, 0x41, 0x6F, 0xFD, 0xB8, 0x46,
-    0x61, 0x65, 0x69, 0x72, 0x73, 0x68, 0xFF, 0xB8, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF, 0xF2, 0xBB, 0x8E, 0xFF, 0xFC, 0x42,
-    0x6C, 0x6E, 0xCE, 0xEC, 0xB6, 0x7F, 0x41, 0x70, 0xC6, 0x49, 0xC2, 0x02, 0x81, 0x6B, 0x74, 0xAF, 0x82, 0xB2, 0x74,
-    0x48, 0x61, 0x65, 0x67, 0x69, 0x6D, 0x6E, 0x73, 0x74, 0xB6, 0x6B, 0xFF, 0xEC, 0xC5, 0x77, 0xBB, 0x6B, 0xFF, 0xF3,
-    0xFF, 0xF7, 0xD1, 0x16, 0xD2, 0x91, 0x41, 0x6C, 0xB7, 0xB1, 0xC6, 0x02, 0x31, 0x6C, 0x6E, 0x72, 0x73, 0x79, 0x69,
-    0xAF, 0xFC, 0xB6, 0x8A, 0xB6, 0xC3, 0xB6, 0x83, 0xB6, 0x8A, 0xFF, 0xFC, 0x42, 0x63, 0x76, 0xB6, 0x75, 0xAF, 0x26,
-    0x43, 0x65, 0x69, 0x6F, 0xFF, 0xE4, 0xFF, 0xF9, 0xB6, 0x6E, 0x41, 0x67, 0xE2, 0x9D, 0x43, 0x63, 0x6E, 0x74, 0xB6,
-    0x7A, 0xFF, 0xFC, 0xB6, 0x24, 0x41, 0x63, 0xB6, 0x47, 0x21, 0x73, 0xFC, 0x58, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xFA,
-    0x32, 0xFA, 0x86, 0xFA, 0xAA, 0xFA, 0xCB, 0xFB, 0xC4, 0xFB, 0xFB, 0xFC, 0x1E, 0xFC, 0x30, 0xFC, 0xF9, 0xB6, 0x4F,
-    0xFD, 0x3F, 0xFD, 0x6C, 0xFD, 0x94, 0xFD, 0xC6, 0xFE, 0x62, 0xFE, 0xA9, 0xFE, 0xD6, 0xFF, 0x1A, 0xFF, 0x81, 0xFF,
-    0xA8, 0xFF, 0xE1, 0xB7, 0x72, 0xFF, 0xEF, 0xFF, 0xFD, 0x43, 0x6B, 0x72, 0x74, 0xB7, 0x7F, 0xB1, 0x96, 0xB6, 0x06,
-    0x42, 0x63, 0x77, 0xB0, 0x59, 0xAE, 0xD4, 0x21, 0x73, 0xF9, 0x45, 0x61, 0x6D, 0x6F, 0x74, 0x65, 0xD7, 0x15, 0xAE,
-    0xA3, 0xB5, 0x7F, 0xAE, 0xA3, 0xFF, 0xFD, 0x42, 0x63, 0x64, 0xB6, 0x9F, 0xAE, 0xD0, 0xA0, 0x22, 0x53, 0x21, 0x6C,
-    0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x02, 0xB1, 0x61, 0xFD, 0x41, 0x6F, 0xC5, 0xDE, 0x43, 0x61, 0x69,
-    0x75, 0xB5, 0x53, 0xFF, 0xFC, 0xAE, 0x89, 0x41, 0x6F, 0xBD, 0x4F, 0xCA, 0x02, 0x81, 0x62, 0x63, 0x69, 0x6C, 0x6E,
-    0x70, 0x74, 0x75, 0x76, 0x77, 0xC4, 0xAB, 0xFF, 0xB2, 0xB7, 0x31, 0xFF, 0xC6, 0xFF, 0xD6, 0xFF, 0xE9, 0xFF, 0xF2,
-    0xAE, 0x69, 0xFF, 0xFC, 0xB7, 0x31, 0xA0, 0x0F, 0xE2, 0x21, 0x74, 0xFD, 0x41, 0x72, 0xF3, 0xCB, 0xA1, 0x00, 0x51,
-    0x65, 0xFC, 0x41, 0x6F, 0xB4, 0x9C, 0x44, 0x6E, 0x70, 0x76, 0x74, 0xFF, 0xF0, 0xFF, 0xF7, 0xAE, 0x56, 0xFF, 0xFC,
-    0x43, 0x64, 0x69, 0x73, 0xB6, 0x19, 0xB4, 0xF9, 0xB6, 0x19, 0x41, 0x7A, 0xB6, 0x0F, 0x21, 0x74, 0xFC, 0xA0, 0x22,
-    0x82, 0x21, 0x67, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6F, 0xFD, 0xC3, 0x00, 0xD1,
-    0x6F, 0x69, 0x72, 0xB5, 0xF6, 0xFF, 0xEB, 0xFF, 0xFD, 0xA0, 0x10, 0x02, 0x21, 0x64, 0xFD, 0xA0, 0x22, 0xA2, 0x21,
-    0x74, 0xFD, 0x21, 0x74, 0xFD, 0x43, 0x65, 0x6E, 0x75, 0xD3, 0x4B, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xAE,
-    0x01, 0xB5, 0xD1, 0x43, 0x66, 0x70, 0x75, 0xAD, 0xD3, 0xDF, 0x1A, 0xDB, 0x2D, 0x41, 0x2E, 0xB3, 0x18, 0x21, 0x72,
-    0xFC, 0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x68, 0xB1, 0x52, 0x21, 0x74, 0xFC, 0x49, 0x61,
-    0x65, 0x68, 0x69, 0x6C, 0x6F, 0x75, 0x72, 0x79, 0xFF, 0x83, 0xFF, 0x90, 0xFF, 0xB3, 0xFF, 0xCE, 0xFF, 0xD8, 0xFF,
-    0xDF, 0xB6, 0x2A, 0xFF, 0xF6, 0xFF, 0xFD, 0xC2, 0x02, 0x31, 0x73, 0x77, 0xAD, 0x96, 0xAD, 0xB4, 0xA0, 0x10, 0x22,
-    0x42, 0x6F, 0x74, 0xFF, 0xFD, 0xB5, 0x9C, 0xC2, 0x0D, 0x42, 0x65, 0x6C, 0xCD, 0xBC, 0xB4, 0x5D, 0xC1, 0x02, 0x81,
-    0x72, 0xAD, 0x92, 0x43, 0x65, 0x66, 0x76, 0xB4, 0xBA, 0xB6, 0x42, 0xB6, 0x42, 0xA0, 0x22, 0xC2, 0x21, 0x74, 0xFD,
-    0xA1, 0x01, 0x91, 0x73, 0xFD, 0x41, 0x68, 0xFB, 0x4E, 0x21, 0x70, 0xFC, 0xA0, 0x22, 0xE3, 0x21, 0x63, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x74, 0xFD, 0x44, 0x65, 0x6F, 0x61, 0x69, 0xFF, 0xE8, 0xC3, 0x71, 0xFF, 0xF1, 0xFF, 0xFD, 0x41,
-    0x64, 0xB4, 0x19, 0x42, 0x64, 0x6C, 0xB4, 0x12, 0xB4, 0x12, 0x47, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x74, 0xAD,
-    0x55, 0xB4, 0x0B, 0xAD, 0x3A, 0xFF, 0xF5, 0xAD, 0x52, 0xCD, 0x8C, 0xFF, 0xF9, 0x41, 0x62, 0xAD, 0x36, 0x21, 0x6D,
-    0xFC, 0x21, 0x65, 0xFD, 0x42, 0x61, 0x74, 0xC0, 0x64, 0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x76, 0xBB, 0xC5, 0xB5,
-    0x04, 0xAD, 0x13, 0xD7, 0xBF, 0xC2, 0x07, 0x42, 0x68, 0x74, 0xB3, 0xE2, 0xAD, 0x1E, 0x41, 0x6D, 0xD8, 0x5D, 0xC1,
-    0x02, 0xE1, 0x65, 0xBE, 0x44, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75,
-    0x76, 0x77, 0x78, 0xB3, 0xC4, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x6A, 0xFF, 0x73, 0xB5, 0xBB, 0xFF, 0x79, 0xFF, 0xA1,
-    0xFF, 0xB9, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFA, 0xAD, 0x59, 0xB5, 0xBB, 0x42, 0x72, 0x76,
-    0xB4, 0x02, 0xB5, 0x8A, 0x44, 0x6E, 0x6F, 0x70, 0x76, 0xB3, 0xFB, 0xB3, 0xCE, 0xB4, 0xC7, 0xAC, 0xDC, 0xC1, 0x00,
-    0x41, 0x74, 0xAC, 0xD5, 0x41, 0x73, 0xD8, 0x50, 0xC4, 0x00, 0x51, 0x6C, 0x6E, 0x72, 0x65, 0xB3, 0x83, 0xAE, 0x33,
-    0xFF, 0xF6, 0xFF, 0xFC, 0xC5, 0x02, 0x11, 0x2E, 0x65, 0x69, 0x6F, 0x77, 0xBB, 0xBD, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF,
-    0xF1, 0xB3, 0x66, 0xC2, 0x02, 0xE1, 0x74, 0x77, 0xAC, 0xA4, 0xAC, 0xA4, 0x43, 0x2E, 0x73, 0x64, 0xB4, 0x86, 0xFF,
-    0xF7, 0xBD, 0x47, 0x42, 0x65, 0x69, 0xFF, 0xF6, 0xC3, 0xED, 0x41, 0x6E, 0xD0, 0x7C, 0x42, 0x65, 0x79, 0xAC, 0x65,
-    0xB3, 0x36, 0xC3, 0x03, 0xE2, 0x61, 0x65, 0x67, 0xB3, 0x8F, 0xBF, 0x5C, 0xB3, 0xAD, 0xC1, 0x02, 0xE1, 0x61, 0xAC,
-    0x73, 0xA1, 0x03, 0xD1, 0x6E, 0xFA, 0x41, 0x69, 0xB3, 0x26, 0x21, 0x73, 0xFC, 0xC2, 0x02, 0x81, 0x61, 0x65, 0xAC,
-    0x58, 0xFF, 0xFD, 0x41, 0x69, 0xBD, 0x00, 0x4D, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x7A, 0xB3, 0x73, 0xCD, 0xF1, 0xFF, 0xC3, 0xFF, 0xCA, 0xFF, 0xCE, 0xFF, 0xD5, 0xFF, 0xE7, 0xFF, 0xF3, 0xC1,
-    0x9C, 0xFF, 0xFC, 0xB4, 0xFB, 0xC1, 0x9C, 0xB4, 0xFB, 0xC1, 0x01, 0x91, 0x74, 0xB3, 0x5A, 0x42, 0x65, 0x67, 0xB2,
-    0xE1, 0xB2, 0xE1, 0x21, 0x6E, 0xF9, 0x41, 0x63, 0xAC, 0x07, 0x21, 0x73, 0xFC, 0xA3, 0x02, 0x81, 0x65, 0x69, 0x79,
-    0xE9, 0xF6, 0xFD, 0x41, 0x74, 0xBB, 0xA4, 0xA0, 0x23, 0x12, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6B, 0xFD,
-    0x21, 0x61, 0xFD, 0x21, 0x76, 0xFD, 0xC4, 0x07, 0x82, 0x61, 0x65, 0x69, 0x6F, 0xB7, 0x58, 0xB3, 0x06, 0xFF, 0xEA,
-    0xFF, 0xFD, 0xC2, 0x02, 0x21, 0x6C, 0x6E, 0xAE, 0x8C, 0xAD, 0x55, 0x42, 0x6C, 0x6E, 0xAB, 0xB7, 0xB2, 0x91, 0x41,
-    0x68, 0xB4, 0x7E, 0x21, 0x74, 0xFC, 0x41, 0x64, 0xAD, 0x23, 0x21, 0x6C, 0xFC, 0xA4, 0x03, 0xE2, 0x61, 0x65, 0x69,
-    0x6F, 0xE2, 0xEB, 0xF6, 0xFD, 0x41, 0x62, 0xB3, 0x06, 0xA0, 0x10, 0x62, 0x41, 0x74, 0xB7, 0x44, 0x45, 0x61, 0x64,
-    0x69, 0x76, 0x75, 0xFF, 0xF5, 0xFF, 0xF9, 0xBF, 0x51, 0xB4, 0x5A, 0xFF, 0xFC, 0x43, 0x2E, 0x61, 0x67, 0xD0, 0xE3,
-    0xAB, 0x7C, 0xAB, 0x82, 0x42, 0x63, 0x7A, 0xB4, 0x40, 0xB2, 0x4C, 0x42, 0x69, 0x79, 0xFF, 0xF9, 0xB2, 0x45, 0xA1,
-    0x01, 0x41, 0x68, 0xF9, 0x42, 0x63, 0x64, 0xAB, 0x7D, 0xAB, 0x7D, 0xC1, 0x01, 0x91, 0x69, 0xB2, 0x3A, 0xA0, 0x23,
-    0x34, 0x21, 0x79, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC9, 0x03, 0xD1, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x76, 0x67, 0xB2, 0xF4, 0xAF, 0x8E, 0xFF, 0xBA, 0xB3, 0x58, 0xFF, 0xCA, 0xFF, 0xE2, 0xFF, 0xE7, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xA0, 0x23, 0x32, 0x41, 0x6E, 0xD1, 0x0D, 0x22, 0x65, 0x69, 0xF9, 0xFC, 0xC3, 0x02, 0x41, 0x69, 0x6E,
-    0x63, 0xB3, 0xEA, 0xAB, 0x22, 0xFF, 0xFB, 0x41, 0x69, 0xAE, 0xDF, 0x44, 0x6E, 0x6F, 0x72, 0x63, 0xC7, 0x7D, 0xBC,
-    0x78, 0xBA, 0x3A, 0xFF, 0xFC, 0xC1, 0x02, 0x71, 0x6F, 0xAF, 0x84, 0xA1, 0x02, 0x11, 0x72, 0xFA, 0x42, 0x65, 0x6F,
-    0xFF, 0xFB, 0xAB, 0x1B, 0x41, 0x69, 0xB1, 0x56, 0x44, 0x6C, 0x6E, 0x6F, 0x63, 0xAA, 0xE9, 0xB1, 0xFA, 0xB1, 0xC0,
-    0xFF, 0xFC, 0xA0, 0x23, 0x71, 0x22, 0x63, 0x77, 0xFD, 0xFD, 0x21, 0x73, 0xFB, 0xA1, 0x00, 0x41, 0x74, 0xFD, 0x41,
-    0x77, 0xAB, 0x1C, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD, 0x44, 0x6E, 0x72, 0x74, 0x6B, 0xB2, 0xB9, 0xFF, 0xF1, 0xB1,
-    0x99, 0xFF, 0xFD, 0x46, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0xFF, 0x99, 0xFF, 0xA9, 0xFF, 0xC1, 0xFF, 0xCC, 0xCD,
-    0xA5, 0xFF, 0xF3, 0x41, 0x6C, 0xB4, 0xD7, 0x41, 0x6F, 0xC7, 0x5E, 0x21, 0x74, 0xFC, 0x22, 0x61, 0x69, 0xF5, 0xFD,
-    0x21, 0x75, 0xFB, 0xA0, 0x23, 0x84, 0x21, 0x75, 0xFD, 0x21, 0x68, 0xFD, 0xC2, 0x02, 0xB1, 0x73, 0x63, 0xAC, 0x1B,
-    0xFF, 0xFD, 0x44, 0x6C, 0x6E, 0x73, 0x74, 0xB1, 0xD2, 0xEB, 0x0F, 0xC6, 0x50, 0xB1, 0x57, 0xC1, 0x01, 0x41, 0x72,
-    0xAA, 0x76, 0x41, 0x6E, 0xC9, 0xBC, 0xA0, 0x23, 0xC3, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6E, 0xFD, 0xC4,
-    0x02, 0xB1, 0x65, 0x6C, 0x61, 0x67, 0xFF, 0xEA, 0xB2, 0xAF, 0xFF, 0xF0, 0xFF, 0xFD, 0xC1, 0x01, 0x41, 0x69, 0xB1,
-    0xBA, 0x41, 0x64, 0xAF, 0x69, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x61, 0xB5, 0x3B, 0xCB, 0x02, 0x41, 0x61,
-    0x63, 0x65, 0x69, 0x6C, 0x6E, 0x70, 0x74, 0x75, 0x77, 0x68, 0xFF, 0xB1, 0xC0, 0x39, 0xFF, 0xBA, 0xFF, 0xDD, 0xFF,
-    0xEC, 0xB2, 0x2E, 0xFF, 0xF9, 0xB4, 0x42, 0xB6, 0x5B, 0xB1, 0x19, 0xFF, 0xFC, 0x42, 0x69, 0x70, 0xAA, 0x13, 0xCF,
-    0xFB, 0xA0, 0x23, 0xF3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x73, 0xFD, 0x42, 0x64, 0x74, 0xB2, 0xCE, 0xFF,
-    0xFD, 0x42, 0x2E, 0x69, 0xB2, 0xC7, 0xAA, 0x0B, 0x41, 0x74, 0xEA, 0x72, 0x47, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x74,
-    0x72, 0xB1, 0x25, 0xB1, 0x25, 0xFF, 0xDB, 0xFF, 0xEE, 0xC8, 0x31, 0xFF, 0xF5, 0xFF, 0xFC, 0x42, 0x6E, 0x6F, 0xAC,
-    0x48, 0xB0, 0xB2, 0xC1, 0x00, 0xD1, 0x61, 0xA9, 0xF8, 0x43, 0x64, 0x72, 0x77, 0xB1, 0xC2, 0xFF, 0xF3, 0xFF, 0xFA,
-    0xC1, 0x02, 0xB1, 0x6B, 0xB2, 0x8F, 0xC7, 0x02, 0x81, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x6E, 0x72, 0xB1, 0xB2, 0xB0,
-    0x95, 0xFF, 0xFA, 0xB1, 0xB2, 0xB1, 0x10, 0xCB, 0x99, 0xB2, 0x89, 0x41, 0x65, 0xB2, 0x1B, 0xA0, 0x24, 0x22, 0x21,
-    0x62, 0xFD, 0x42, 0x65, 0x61, 0xB1, 0xAB, 0xFF, 0xFD, 0x45, 0x63, 0x6D, 0x6E, 0x70, 0x72, 0xC8, 0xEC, 0xDA, 0x0C,
-    0xDD, 0x20, 0xB1, 0x89, 0xFF, 0xF9, 0xA0, 0x24, 0x42, 0x21, 0x67, 0xFD, 0x42, 0x75, 0x61, 0xB2, 0x4A, 0xFF, 0xFD,
-    0x43, 0x64, 0x74, 0x79, 0xB1, 0x6C, 0xFF, 0xF9, 0xB1, 0x6C, 0x42, 0x64, 0x62, 0xB1, 0x62, 0xAF, 0x58, 0xC3, 0x02,
-    0x31, 0x61, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0x3B, 0x41, 0x69, 0xD1, 0x0C, 0xA1, 0x02, 0x11, 0x6C, 0xFC,
-    0x41, 0x63, 0xB8, 0x37, 0xA0, 0x24, 0x63, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x70, 0xFD, 0x4D, 0x2E, 0x61,
-    0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x77, 0x79, 0x62, 0x73, 0x75, 0xB8, 0x6D, 0xFF, 0x51, 0xFF, 0x74, 0xC2, 0x7A,
-    0xFF, 0x84, 0xFF, 0x9C, 0xFF, 0xAD, 0xFF, 0xDB, 0xBB, 0xB3, 0xFF, 0xEB, 0xB0, 0x21, 0xFF, 0xF0, 0xFF, 0xFD, 0x42,
-    0x73, 0x74, 0xAF, 0xF9, 0xAA, 0xAC, 0xC1, 0x02, 0x81, 0x69, 0xA9, 0x28, 0xA0, 0x24, 0x93, 0x21, 0x65, 0xFD, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x62, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x70, 0xDD, 0x59,
-    0xC2, 0xE6, 0xFB, 0x71, 0xFF, 0xE7, 0xB0, 0xF5, 0xFF, 0xEE, 0xB3, 0x09, 0xB3, 0x09, 0xFF, 0xFD, 0xA0, 0x1C, 0x31,
-    0x21, 0x6D, 0xFD, 0x21, 0x6D, 0xFD, 0xC2, 0x02, 0x81, 0x6F, 0x69, 0xAF, 0xAE, 0xFF, 0xFD, 0x42, 0x6F, 0x63, 0xA8,
-    0xEC, 0xBE, 0x3D, 0x41, 0x69, 0xB0, 0x7C, 0xA0, 0x24, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0xC5, 0x01, 0x41,
-    0x63, 0x6C, 0x6E, 0x72, 0x74, 0xAF, 0x91, 0xB0, 0xCC, 0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0x57, 0x61, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
-    0x79, 0xFA, 0x45, 0xB9, 0xAF, 0xFA, 0xF6, 0xB9, 0xAF, 0xFB, 0xBB, 0xB7, 0xD9, 0xB7, 0xF0, 0xFC, 0x19, 0xFC, 0x7B,
-    0xFC, 0xBA, 0xFC, 0xD9, 0xFD, 0x06, 0xC2, 0x71, 0xFD, 0x62, 0xFD, 0xF3, 0xFE, 0x16, 0xB1, 0x20, 0xFE, 0x71, 0xFF,
-    0x69, 0xFF, 0xAA, 0xAF, 0x7F, 0xFF, 0xD1, 0xFF, 0xEE, 0x41, 0x65, 0xB3, 0x66, 0xA0, 0x24, 0xF3, 0x21, 0x6D, 0xFD,
-    0x42, 0x7A, 0x73, 0xB1, 0x26, 0xFF, 0xFD, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0xA2, 0x02, 0x41, 0x6C, 0x6F, 0xE9,
-    0xFD, 0x41, 0x6C, 0xA8, 0xF5, 0xC1, 0x01, 0x91, 0x61, 0xC0, 0xE2, 0x41, 0x69, 0xBD, 0x39, 0xC6, 0x02, 0x81, 0x61,
-    0x65, 0x69, 0x6B, 0x6C, 0x6F, 0xAF, 0x18, 0xAB, 0x0D, 0xA8, 0x4E, 0xFF, 0xF6, 0xFF, 0xFC, 0xAF, 0x47, 0x41, 0x6E,
-    0xE5, 0xFC, 0x42, 0x6F, 0x69, 0xAE, 0xFF, 0xFF, 0xFC, 0x41, 0x61, 0xA9, 0xC8, 0x42, 0x64, 0x74, 0xA8, 0x55, 0xFF,
-    0xFC, 0xA0, 0x25, 0x22, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x43, 0x65, 0x6C, 0x61, 0xB6, 0xEA, 0xAE, 0xE4, 0xFF,
-    0xFD, 0xA0, 0x25, 0x42, 0x21, 0x68, 0xFD, 0x45, 0x61, 0x63, 0x65, 0x69, 0x72, 0xA7, 0xF8, 0xAE, 0xC9, 0xAE, 0xC9,
-    0xB7, 0x3D, 0xFF, 0xFD, 0x42, 0x65, 0x79, 0xA7, 0xE8, 0xAE, 0xC4, 0x42, 0x69, 0x75, 0xB0, 0x91, 0xB1, 0xF3, 0x41,
-    0x6E, 0xB4, 0x47, 0x21, 0x6F, 0xFC, 0xD2, 0x03, 0xD1, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x67, 0xAF, 0xDF, 0xFF, 0x82, 0xB0, 0x59, 0xB2, 0x5F, 0xB9, 0x36, 0xFF,
-    0x89, 0xFF, 0x97, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xCB, 0xFF, 0xDB, 0xFF, 0xEB, 0xFF, 0xF2, 0xA8, 0x3D, 0xA7, 0xD3,
-    0xB6, 0xFB, 0xFF, 0x93, 0xFF, 0xFD, 0x41, 0x72, 0xDE, 0x72, 0x21, 0x65, 0xFC, 0xC3, 0x01, 0x41, 0x65, 0x63, 0x69,
-    0xA7, 0xAE, 0xA7, 0x9F, 0xFF, 0xFD, 0xC2, 0x01, 0x91, 0x68, 0x72, 0xFF, 0xF4, 0xAF, 0xF9, 0x41, 0x68, 0xF9, 0xB6,
-    0x43, 0x64, 0x74, 0x63, 0xA8, 0x3B, 0xAE, 0x4B, 0xFF, 0xFC, 0x42, 0x65, 0x74, 0xA7, 0x6A, 0xB0, 0x38, 0xC1, 0x03,
-    0xE2, 0x69, 0xAE, 0x45, 0xC2, 0x00, 0x51, 0x65, 0x69, 0xB6, 0x45, 0xAE, 0x3F, 0x41, 0x6F, 0xE0, 0x9E, 0x42, 0x67,
-    0x72, 0xA8, 0x11, 0xFF, 0xFC, 0x44, 0x2E, 0x69, 0x73, 0x65, 0xAF, 0x5B, 0xA7, 0x49, 0xB0, 0x17, 0xFF, 0xF9, 0xC1,
-    0x10, 0x82, 0x74, 0xA7, 0x54, 0x21, 0x61, 0xFA, 0x41, 0x6E, 0xAF, 0x45, 0xC1, 0x03, 0xD1, 0x61, 0xE5, 0x31, 0x45,
-    0x61, 0x63, 0x64, 0x65, 0x74, 0xFF, 0xF6, 0xAF, 0x3B, 0xAF, 0x3B, 0xC5, 0x28, 0xFF, 0xFA, 0xC1, 0x02, 0x31, 0x65,
-    0xAD, 0xFB, 0xA0, 0x10, 0xA2, 0xC4, 0x03, 0xD1, 0x65, 0x73, 0x7A, 0x63, 0xB1, 0xEC, 0xA7, 0x28, 0xAA, 0x83, 0xB7,
-    0xE3, 0x41, 0x69, 0xD7, 0x0B, 0xA0, 0x1B, 0xC2, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0x46, 0x63, 0x64, 0x69, 0x6E,
-    0x76, 0x67, 0xA7, 0x0C, 0xFF, 0xE1, 0xFF, 0xE4, 0xFF, 0xF3, 0xA7, 0x12, 0xFF, 0xFD, 0xA0, 0x14, 0x22, 0x21, 0x73,
-    0xFD, 0xC2, 0x01, 0x91, 0x2E, 0x65, 0xAE, 0x30, 0xFF, 0xFD, 0x42, 0x2E, 0x73, 0xAD, 0xA9, 0xFF, 0xF7, 0x41, 0x68,
-    0xA8, 0xA3, 0x51, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78,
-    0x79, 0xAD, 0x9E, 0xFF, 0x53, 0xFF, 0x5D, 0xFF, 0x64, 0xBC, 0x36, 0xFF, 0x6A, 0xFF, 0x7E, 0xFF, 0x91, 0xFF, 0x9E,
-    0xBC, 0x36, 0xFF, 0xAE, 0xFF, 0xD3, 0xFF, 0xF5, 0xFF, 0xFC, 0xAE, 0xD9, 0xAE, 0xD9, 0xAD, 0x9E, 0x41, 0x6D, 0xD9,
-    0x0E, 0x21, 0x61, 0xFC, 0x42, 0x6E, 0x6C, 0xA6, 0x8C, 0xFF, 0xFD, 0xC2, 0x01, 0x91, 0x73, 0x74, 0xAD, 0x9E, 0xA6,
-    0xA3, 0xC3, 0x02, 0x81, 0x61, 0x69, 0x74, 0xFF, 0xF7, 0xE7, 0x99, 0xAE, 0x8E, 0x42, 0x2E, 0x61, 0xAD, 0x52, 0xAD,
-    0x52, 0x43, 0x63, 0x6C, 0x6E, 0xFF, 0xF9, 0xAD, 0x40, 0xC5, 0xC3, 0x43, 0x65, 0x69, 0x6F, 0xAD, 0x41, 0xBA, 0xA9,
-    0xB7, 0xB0, 0x42, 0x74, 0x7A, 0xA6, 0x7C, 0xA6, 0x73, 0x21, 0x69, 0xF9, 0xA0, 0x25, 0x63, 0x21, 0x69, 0xFD, 0x21,
-    0x6E, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x25, 0x92, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x45, 0x64, 0x6F, 0x72, 0x67,
-    0x6B, 0xFF, 0xD7, 0xAD, 0x0D, 0xFF, 0xE8, 0xFF, 0xF4, 0xFF, 0xFD, 0x41, 0x6E, 0xD8, 0xA1, 0x21, 0x61, 0xFC, 0x42,
-    0x6C, 0x73, 0xFF, 0xFD, 0xB6, 0x2A, 0x48, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0x79, 0xB5, 0x46, 0xFF, 0x8C,
-    0xFF, 0x9C, 0xFF, 0xAF, 0xAC, 0xEF, 0xFF, 0xE2, 0xB5, 0x46, 0xFF, 0xF9, 0x41, 0x2E, 0xBB, 0xA2, 0xC3, 0x03, 0xD1,
-    0x62, 0x74, 0x6E, 0xAD, 0x6A, 0xB0, 0x09, 0xFF, 0xFC, 0xA0, 0x10, 0xC2, 0xA0, 0x10, 0xE2, 0x43, 0x6B, 0x6F, 0x75,
-    0xAC, 0xC0, 0xAD, 0xE0, 0xFF, 0xFD, 0xC1, 0x00, 0xD1, 0x79, 0xAC, 0xC1, 0xC1, 0x02, 0x41, 0x75, 0xAE, 0xA7, 0x41,
-    0x6C, 0xC9, 0x12, 0xC2, 0x03, 0xD1, 0x70, 0x75, 0xAC, 0xA6, 0xB7, 0x96, 0x41, 0x6D, 0xF1, 0xBE, 0xC4, 0x03, 0xE2,
-    0x61, 0x65, 0x69, 0x6F, 0xAC, 0xF9, 0xBD, 0x41, 0xAD, 0xD4, 0xFF, 0xFC, 0x41, 0x65, 0xA7, 0x8B, 0xC2, 0x03, 0xD1,
-    0x63, 0x6E, 0xAC, 0x91, 0xFF, 0xFC, 0x41, 0x63, 0xCA, 0xF2, 0x21, 0x69, 0xFC, 0x46, 0x61, 0x65, 0x6D, 0x6F, 0x70,
-    0x74, 0xAC, 0xB8, 0xAD, 0xB1, 0xA5, 0xA5, 0xAC, 0x81, 0xA5, 0xA5, 0xFF, 0xFD, 0xC1, 0x03, 0xD1, 0x61, 0xA5, 0x92,
-    0xC2, 0x03, 0xD1, 0x61, 0x65, 0xAC, 0x9F, 0xB1, 0x9F, 0x51, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x71, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xFF, 0x82, 0xFF, 0x8E, 0xFF, 0x94, 0xBE, 0x66, 0xFE, 0x4A, 0xFF,
-    0x9E, 0xFF, 0xA4, 0xFF, 0xAA, 0xFF, 0xAE, 0xFF, 0xBB, 0xFF, 0xCE, 0xAE, 0x4B, 0xFF, 0xDE, 0xAC, 0x99, 0xAC, 0xEC,
-    0xFF, 0xF1, 0xFF, 0xF7, 0xC1, 0x01, 0x71, 0x6E, 0xA5, 0x49, 0x44, 0x2E, 0x64, 0x73, 0x74, 0xAD, 0x55, 0xAD, 0x55,
-    0xBC, 0xC2, 0xAE, 0x02, 0xA0, 0x17, 0x72, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0xC4, 0x02, 0x41, 0x61, 0x65, 0x6F,
-    0x69, 0xFF, 0xE4, 0xFF, 0xEA, 0xAC, 0x07, 0xFF, 0xFD, 0xC1, 0x04, 0x02, 0x65, 0xA5, 0x24, 0x41, 0x72, 0xAC, 0x18,
-    0x41, 0x72, 0xAF, 0x1F, 0x43, 0x61, 0x62, 0x79, 0xAF, 0x1B, 0xA5, 0x16, 0xAC, 0x29, 0x42, 0x6C, 0x74, 0xA5, 0x72,
-    0xAC, 0x1F, 0x43, 0x61, 0x6F, 0x79, 0xFF, 0xF9, 0xAB, 0xD6, 0xAB, 0xD6, 0x42, 0x65, 0x7A, 0xAC, 0x0E, 0xA5, 0x13,
-    0x42, 0x61, 0x69, 0xAE, 0xF9, 0xFF, 0xF9, 0x42, 0x72, 0x74, 0xAD, 0xB5, 0xAB, 0xBE, 0x41, 0x61, 0xB4, 0x4B, 0x41,
-    0x79, 0xA5, 0x9D, 0x21, 0x67, 0xFC, 0x21, 0x6F, 0xFD, 0xCE, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6D,
-    0x6E, 0x72, 0x73, 0x75, 0x77, 0x6C, 0x74, 0xAB, 0xEB, 0xFF, 0xBA, 0xCF, 0x84, 0xB4, 0x00, 0xFF, 0xBE, 0xAD, 0xC9,
-    0xFF, 0xC2, 0xFF, 0xD3, 0xFF, 0xE4, 0xA6, 0x76, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xFD, 0xB4, 0xE1, 0xC1, 0x01, 0x81,
-    0x74, 0xA4, 0xA5, 0x43, 0x68, 0x69, 0x74, 0xA4, 0xBD, 0xFF, 0xFA, 0xA5, 0x3C, 0xA0, 0x25, 0xD2, 0x21, 0x62, 0xFD,
-    0xA1, 0x00, 0x61, 0x61, 0xFD, 0x21, 0x73, 0xFB, 0x43, 0x6E, 0x73, 0x72, 0xA4, 0xA5, 0xD3, 0xFE, 0xFF, 0xFD, 0x21,
-    0x65, 0xF6, 0xA0, 0x25, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0xC5, 0x03, 0xD1, 0x62, 0x63,
-    0x73, 0x76, 0x69, 0xA4, 0x86, 0xFF, 0xCF, 0xA4, 0x6E, 0xFF, 0xF1, 0xFF, 0xFD, 0xC1, 0x00, 0x51, 0x69, 0xA4, 0x83,
-    0xA0, 0x25, 0xF1, 0x21, 0x65, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x43, 0x66, 0x6D, 0x61, 0xA4, 0x68, 0xFF,
-    0xEE, 0xFF, 0xFD, 0xC1, 0x02, 0xE1, 0x6C, 0xAC, 0xE5, 0x43, 0x65, 0x69, 0x73, 0xAF, 0x16, 0xC9, 0x86, 0xAB, 0x11,
-    0x44, 0x61, 0x63, 0x6D, 0x76, 0xFF, 0xF0, 0xFF, 0xF6, 0xB3, 0x5E, 0xA4, 0x36, 0x42, 0x69, 0x79, 0xA4, 0x4A, 0xAA,
-    0xFA, 0x41, 0x73, 0xFD, 0xDD, 0xA0, 0x26, 0x33, 0x21, 0x73, 0xFD, 0xA0, 0x26, 0x63, 0x22, 0x73, 0x74, 0xF7, 0xFD,
-    0x22, 0x65, 0x69, 0xF5, 0xFB, 0x21, 0x6C, 0xFB, 0x43, 0x68, 0x69, 0x6F, 0xA8, 0x25, 0xFF, 0xE6, 0xFF, 0xFD, 0x41,
-    0x70, 0xA4, 0x10, 0xA0, 0x26, 0x03, 0x21, 0x6D, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0x63, 0x74, 0xD8,
-    0xEB, 0xA4, 0x00, 0x21, 0x69, 0xF9, 0x47, 0x6D, 0x6E, 0x70, 0x73, 0x76, 0x6C, 0x66, 0xB1, 0xC0, 0xFF, 0xBB, 0xFF,
-    0xDC, 0xFF, 0xE6, 0xA3, 0xF6, 0xFF, 0xF3, 0xFF, 0xFD, 0x42, 0x69, 0x73, 0xA3, 0xE6, 0xA3, 0xC8, 0x45, 0x61, 0x65,
-    0x69, 0x6F, 0x75, 0xFF, 0x53, 0xFF, 0x77, 0xFF, 0x91, 0xFF, 0xE3, 0xFF, 0xF9, 0xC1, 0x01, 0x41, 0x68, 0xA8, 0xC3,
-    0xC3, 0x0A, 0x23, 0x63, 0x68, 0x77, 0xFF, 0xFA, 0xA3, 0xB1, 0xAB, 0xA2, 0xA0, 0x26, 0x92, 0x21, 0x74, 0xFD, 0x21,
-    0x75, 0xFD, 0x21, 0x62, 0xFD, 0x21, 0x69, 0xFD, 0xC4, 0x06, 0x63, 0x65, 0x6F, 0x75, 0x72, 0xAC, 0x8B, 0xAA, 0x6A,
-    0xA3, 0x96, 0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x72, 0xAA, 0x9A, 0x41, 0x69, 0xB9, 0xEC, 0x41, 0x2E, 0xB2, 0xBF, 0xC1,
-    0x02, 0xE1, 0x73, 0xA3, 0x8B, 0x41, 0x72, 0xA5, 0x02, 0x21, 0x61, 0xFC, 0x45, 0x65, 0x69, 0x6F, 0x79, 0x6E, 0xAB,
-    0x78, 0xFF, 0xF3, 0xA3, 0x84, 0xAA, 0x48, 0xFF, 0xFD, 0xCB, 0x03, 0xD1, 0x61, 0x62, 0x64, 0x65, 0x66, 0x69, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0xFF, 0xD5, 0xAD, 0x42, 0xA4, 0xFA, 0xAA, 0x2D, 0xB4, 0xBF, 0xBA, 0xBF, 0xAB, 0x68, 0xFF,
-    0xDB, 0xFF, 0xDF, 0xFF, 0xF0, 0xAB, 0x68, 0xC4, 0x02, 0x31, 0x61, 0x69, 0x6F, 0x68, 0xB1, 0xEA, 0xAC, 0xB1, 0xAA,
-    0x09, 0xAB, 0xAA, 0x41, 0x6C, 0xB6, 0x17, 0x43, 0x65, 0x68, 0x61, 0xA4, 0xB4, 0xAA, 0x01, 0xFF, 0xFC, 0xC3, 0x03,
-    0xD1, 0x61, 0x6C, 0x70, 0xA9, 0xEC, 0xB2, 0x43, 0xFF, 0xF6, 0x56, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xFB, 0x3C, 0xB9, 0x51, 0xFB,
-    0x88, 0xB1, 0xC1, 0xFC, 0x42, 0xB9, 0x51, 0xB1, 0xC1, 0xFC, 0xF1, 0xFD, 0x8C, 0xFD, 0xDC, 0xFD, 0xEB, 0xD7, 0x9A,
-    0xFE, 0x37, 0xB1, 0xC1, 0xFF, 0x48, 0xFF, 0x5E, 0xFF, 0x79, 0xFF, 0xB3, 0xA9, 0xE0, 0xFF, 0xD7, 0xFF, 0xF4, 0xBC,
-    0x4C, 0x42, 0x61, 0x69, 0xA9, 0xA8, 0xA2, 0xCC, 0x41, 0x6E, 0xA2, 0xE0, 0x44, 0x61, 0x64, 0x69, 0x74, 0xFF, 0xFC,
-    0xA4, 0x5F, 0xA2, 0xD3, 0xA2, 0xD3, 0x42, 0x69, 0x75, 0xA9, 0xC7, 0xA2, 0xC0, 0x21, 0x74, 0xF9, 0x21, 0x61, 0xFD,
-    0x21, 0x72, 0xFD, 0x47, 0x62, 0x63, 0x6E, 0x72, 0x74, 0x76, 0x64, 0xA9, 0x75, 0xA2, 0xA4, 0xFF, 0xD8, 0xFF, 0xE3,
-    0xAB, 0x16, 0xA2, 0xA4, 0xFF, 0xFD, 0xC1, 0x02, 0x21, 0x6F, 0xAA, 0x7F, 0xC2, 0x02, 0x31, 0x6C, 0x72, 0xAA, 0x79,
-    0xFF, 0xFA, 0x41, 0x67, 0xAB, 0x78, 0xA1, 0x07, 0x42, 0x6E, 0xFC, 0x41, 0x65, 0xAA, 0xC1, 0x23, 0x65, 0x69, 0x6C,
-    0xEA, 0xF7, 0xFC, 0x42, 0x62, 0x74, 0xA2, 0x6B, 0xA9, 0xD4, 0x46, 0x61, 0x69, 0x6C, 0x72, 0x75, 0x79, 0xA9, 0xB3,
-    0xFF, 0xF9, 0xA6, 0x29, 0xA9, 0xB3, 0xA9, 0xB3, 0xAA, 0x55, 0x43, 0x72, 0x73, 0x76, 0xA9, 0x64, 0xA9, 0x48, 0xA2,
-    0x4B, 0x42, 0x64, 0x73, 0xA9, 0x5A, 0xA9, 0x5A, 0x44, 0x63, 0x65, 0x73, 0x74, 0xAA, 0xB2, 0xFF, 0xF9, 0xA9, 0x1C,
-    0xA9, 0x14, 0xC1, 0x01, 0x41, 0x79, 0xD6, 0x9D, 0x21, 0x6E, 0xFA, 0x46, 0x64, 0x65, 0x69, 0x6F, 0x73, 0x75, 0xA9,
-    0x06, 0xFF, 0xD9, 0xFF, 0xEA, 0xFF, 0xFD, 0xAC, 0x10, 0xAA, 0x1B, 0x43, 0x65, 0x73, 0x74, 0xAA, 0x08, 0xA2, 0x11,
-    0xA2, 0x54, 0x41, 0x69, 0xA6, 0x42, 0x41, 0x6D, 0xA2, 0x15, 0x23, 0x6E, 0x72, 0x61, 0xEE, 0xF8, 0xFC, 0x42, 0x61,
-    0x6C, 0xAA, 0x0A, 0xA9, 0x4D, 0x41, 0x65, 0xB3, 0x42, 0x42, 0x68, 0x69, 0xFF, 0xFC, 0xA9, 0xA2, 0xC1, 0x02, 0x31,
-    0x67, 0xAA, 0x5E, 0x41, 0x6D, 0xA1, 0xE6, 0xC1, 0x00, 0x71, 0x65, 0xDA, 0x89, 0xC5, 0x10, 0xC2, 0x6C, 0x6E, 0x72,
-    0x74, 0x76, 0xBA, 0x17, 0xFF, 0xF0, 0xFF, 0xF6, 0xA5, 0x61, 0xFF, 0xFA, 0xC2, 0x02, 0xB1, 0x62, 0x74, 0xA1, 0xE2,
-    0xAD, 0x6A, 0xC1, 0x00, 0x41, 0x65, 0xAA, 0x89, 0x21, 0x68, 0xFA, 0xC1, 0x02, 0x31, 0x6E, 0xAA, 0x2A, 0xC3, 0x02,
-    0x81, 0x61, 0x6E, 0x73, 0xA8, 0x86, 0xC3, 0x8A, 0xAD, 0xBD, 0x42, 0x62, 0x73, 0xC2, 0x28, 0xA9, 0x0F, 0x42, 0x61,
-    0x69, 0xAB, 0xB1, 0xFF, 0xF9, 0xC1, 0x01, 0x91, 0x65, 0xAC, 0x6E, 0x43, 0x69, 0x72, 0x75, 0xA8, 0xD2, 0xF9, 0x76,
-    0xA8, 0x63, 0xC1, 0x02, 0x21, 0x6C, 0xA8, 0x64, 0x4D, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6F, 0x73,
-    0x74, 0x75, 0x76, 0xFF, 0xB8, 0xFF, 0xC7, 0xE2, 0xA0, 0xFF, 0xCA, 0xAB, 0x68, 0xFF, 0xD0, 0xFF, 0xE3, 0xB3, 0xF0,
-    0xBB, 0x45, 0xFF, 0xEA, 0xFF, 0xF0, 0xFF, 0xFA, 0xA8, 0x5E, 0x42, 0x69, 0x6C, 0xA8, 0xC3, 0xAF, 0x11, 0xC1, 0x02,
-    0xB1, 0x6E, 0xBE, 0x03, 0x41, 0x72, 0xA4, 0xB6, 0x45, 0x61, 0x62, 0x69, 0x6F, 0x70, 0xA8, 0xA4, 0xFF, 0xEF, 0xFF,
-    0xF6, 0xFF, 0xFC, 0xAB, 0x4E, 0xC1, 0x02, 0x11, 0x72, 0xA8, 0xA2, 0xC4, 0x02, 0xB1, 0x6D, 0x6E, 0x73, 0x76, 0xA8,
-    0x9C, 0xA8, 0x64, 0xAD, 0x3E, 0xA1, 0x45, 0xC1, 0x07, 0xE2, 0x77, 0xA8, 0x8D, 0x42, 0x72, 0x73, 0xA9, 0xBD, 0xA8,
-    0x87, 0x42, 0x61, 0x65, 0xF3, 0xF3, 0xFF, 0xF9, 0x48, 0x61, 0x65, 0x69, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xA5, 0xAF,
-    0xFF, 0xD7, 0xFF, 0xDD, 0xFF, 0xEC, 0xFF, 0xF9, 0xA1, 0x10, 0xA7, 0xEC, 0xA7, 0xEC, 0x43, 0x72, 0x73, 0x75, 0xA9,
-    0xEC, 0xA7, 0xCB, 0xA9, 0x69, 0xC1, 0x02, 0xB1, 0x72, 0xA6, 0xBF, 0x42, 0x61, 0x6E, 0xA7, 0xBB, 0xC2, 0xBF, 0x41,
-    0x74, 0xA1, 0x2A, 0x21, 0x72, 0xFC, 0xA1, 0x01, 0xE1, 0x6F, 0xFD, 0x42, 0x69, 0x75, 0xCC, 0x9C, 0xA0, 0xCE, 0x45,
-    0x65, 0x69, 0x6C, 0x70, 0x74, 0xFF, 0xE0, 0xFF, 0xE6, 0xA8, 0x1C, 0xFF, 0xF4, 0xFF, 0xF9, 0x41, 0x2E, 0xC6, 0xC2,
-    0xC4, 0x02, 0xB1, 0x2E, 0x67, 0x73, 0x6C, 0xA7, 0x8A, 0xA8, 0xAA, 0xA8, 0xAA, 0xFF, 0xFC, 0x42, 0x65, 0x72, 0xAA,
-    0xBC, 0xA8, 0x13, 0xC1, 0x02, 0x21, 0x69, 0xA4, 0x91, 0x41, 0x6C, 0xD9, 0x40, 0x46, 0x66, 0x6E, 0x6F, 0x74, 0x7A,
-    0x61, 0xFF, 0xF6, 0xA7, 0xD9, 0xA7, 0xE8, 0xA9, 0x0B, 0xA7, 0xAC, 0xFF, 0xFC, 0x41, 0x67, 0xC3, 0xE6, 0x21, 0x6E,
-    0xFC, 0xA1, 0x02, 0x81, 0x69, 0xFD, 0xC1, 0x00, 0x41, 0x65, 0xA7, 0xE3, 0x43, 0x65, 0x68, 0x69, 0xAB, 0x72, 0xA9,
-    0xC8, 0xFF, 0xFA, 0x4E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xFF,
-    0xB1, 0xA8, 0x12, 0xA0, 0x6A, 0xA7, 0xAA, 0xA0, 0x88, 0xFF, 0xC0, 0xFF, 0xD1, 0xFF, 0xEB, 0xAA, 0x72, 0xA9, 0xE3,
-    0xD2, 0xB4, 0xAE, 0x9D, 0xFF, 0xF6, 0xA7, 0xB9, 0x43, 0x64, 0x6E, 0x70, 0xA7, 0x13, 0xA7, 0x13, 0xA7, 0xA8, 0xC1,
-    0x00, 0xD1, 0x69, 0xA7, 0x48, 0x42, 0x61, 0x72, 0xA0, 0x47, 0xB9, 0x48, 0x42, 0x61, 0x63, 0xA6, 0xFC, 0xA7, 0x77,
-    0x41, 0x72, 0xAB, 0x77, 0x42, 0x65, 0x72, 0xFF, 0xFC, 0xA7, 0x5D, 0xC1, 0x02, 0x11, 0x72, 0xA0, 0x10, 0xC9, 0x02,
-    0x41, 0x61, 0x63, 0x65, 0x69, 0x6C, 0x70, 0x73, 0x74, 0x75, 0xFF, 0xD1, 0xFF, 0xDB, 0xFF, 0xE1, 0xFF, 0xE8, 0xA7,
-    0x95, 0xA7, 0x50, 0xA8, 0x0B, 0xFF, 0xF3, 0xFF, 0xFA, 0x42, 0x62, 0x74, 0x9F, 0xF2, 0xA7, 0x41, 0xC1, 0x01, 0x91,
-    0x69, 0x9F, 0xE5, 0x43, 0x2E, 0x6C, 0x6E, 0xA6, 0xB6, 0xA6, 0xB6, 0xFF, 0xFA, 0x42, 0x65, 0x67, 0xA7, 0x2A, 0xA6,
-    0xEE, 0x41, 0x6E, 0xCD, 0x24, 0xC5, 0x0A, 0x23, 0x6C, 0x6E, 0x6F, 0x73, 0x7A, 0xB8, 0x0B, 0xFF, 0xF5, 0xFF, 0xFC,
-    0xA7, 0xC1, 0xA8, 0x90, 0x41, 0x69, 0xD2, 0x59, 0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0x45, 0x66, 0x67, 0x6D, 0x6E,
-    0x75, 0xA6, 0x90, 0x9F, 0xCC, 0xFF, 0xFD, 0xA6, 0x88, 0xA7, 0xA5, 0x46, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x73, 0xFF,
-    0xB2, 0xFF, 0xBF, 0xFF, 0xD4, 0xA9, 0x52, 0xFF, 0xF0, 0x9F, 0xA4, 0xC1, 0x02, 0x21, 0x6D, 0xA6, 0xFA, 0x56, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x78, 0x7A, 0xFC, 0xE7, 0xFD, 0x19, 0xFD, 0x27, 0xFD, 0x61, 0xFD, 0x86, 0xFD, 0x8D, 0xFD, 0x98, 0xFD, 0xAF, 0xA6,
-    0x5F, 0xA6, 0x5C, 0xFE, 0x09, 0xFE, 0x42, 0xFE, 0x7B, 0xFE, 0x94, 0xFE, 0xBE, 0xFF, 0x21, 0xFF, 0x7B, 0xFF, 0xE7,
-    0xFF, 0xFA, 0xB6, 0xD4, 0xB2, 0x56, 0xA7, 0x33, 0xA0, 0x11, 0x23, 0x42, 0x69, 0x75, 0xB1, 0x06, 0x9F, 0x57, 0x41,
-    0x72, 0xA7, 0x1C, 0x21, 0x65, 0xFC, 0xC2, 0x00, 0x51, 0x65, 0x75, 0xA6, 0xA0, 0xFF, 0xFD, 0x43, 0x69, 0x6F, 0x75,
-    0xAA, 0x84, 0x9F, 0x46, 0x9F, 0x3A, 0x41, 0x65, 0xAC, 0x7A, 0x21, 0x69, 0xFC, 0x41, 0x76, 0xA7, 0x8F, 0xA1, 0x02,
-    0x71, 0x69, 0xFC, 0x41, 0x76, 0xA0, 0xC0, 0x21, 0x65, 0xFC, 0x21, 0x64, 0xFD, 0xCB, 0x03, 0xD1, 0x2E, 0x62, 0x63,
-    0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x74, 0x75, 0xA7, 0xD2, 0xFF, 0xC2, 0xFF, 0xC5, 0xFF, 0xD3, 0xFF, 0xDC, 0xA9,
-    0x96, 0xDF, 0x23, 0xCD, 0x4D, 0xFF, 0xEA, 0xFF, 0xF1, 0xFF, 0xFD, 0x44, 0x2E, 0x6C, 0x6F, 0x79, 0xA6, 0x35, 0xA1,
-    0xC5, 0xA6, 0x4F, 0xA6, 0xD7, 0x42, 0x6F, 0x75, 0xA0, 0x7A, 0xA8, 0x98, 0xC1, 0x01, 0x41, 0x79, 0xE7, 0x3E, 0xE1,
-    0x02, 0x21, 0x63, 0x7F, 0x9E, 0xE4, 0xA0, 0x11, 0xD2, 0x21, 0x67, 0xFD, 0x45, 0x2E, 0x6C, 0x6E, 0x73, 0x69, 0xA7,
-    0x87, 0xFF, 0xED, 0xFF, 0xF3, 0xA6, 0xB0, 0xFF, 0xFD, 0x41, 0x69, 0xB4, 0xCA, 0x41, 0x65, 0xA6, 0xB7, 0x46, 0x64,
-    0x65, 0x69, 0x6D, 0x73, 0x74, 0xA6, 0x98, 0xFF, 0xE8, 0xA4, 0xB5, 0xFF, 0xF8, 0xFF, 0xFC, 0xC5, 0x74, 0x41, 0x74,
-    0xC3, 0xBF, 0x62, 0x65, 0x69, 0x7F, 0x9E, 0x90, 0x7F, 0xFF, 0xFC, 0xC2, 0x0A, 0x02, 0x2E, 0x74, 0xA5, 0x58, 0xFF,
-    0xF7, 0xE1, 0x02, 0x31, 0x72, 0x7F, 0x9E, 0x90, 0x42, 0x65, 0x79, 0xFF, 0xF9, 0xA5, 0xE0, 0x68, 0x2E, 0x64, 0x67,
-    0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7F, 0xA5, 0x41, 0x7F, 0xA5, 0x41, 0x7F, 0x9E, 0x82, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF,
-    0x97, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF9, 0x42, 0x6C, 0x6E, 0xCC, 0x92, 0xA7, 0x17, 0x44, 0x2E,
-    0x64, 0x6E, 0x73, 0xA7, 0x10, 0xA7, 0x10, 0xAD, 0x73, 0xA7, 0x10, 0x42, 0x65, 0x69, 0xFF, 0xF3, 0xA7, 0x03, 0x42,
-    0x74, 0x7A, 0xA6, 0xFC, 0xD2, 0xE7, 0xA1, 0x02, 0x41, 0x69, 0xF9, 0xE4, 0x02, 0xB1, 0x61, 0x63, 0x64, 0x67, 0x7F,
-    0xA6, 0x31, 0x7F, 0xA5, 0x59, 0x7F, 0x9E, 0x40, 0x7F, 0xA4, 0xF9, 0x63, 0x6C, 0x72, 0x75, 0x7F, 0x9E, 0x27, 0x7F,
-    0xB5, 0x4B, 0x7F, 0xA5, 0x55, 0x63, 0x69, 0x6F, 0x75, 0x7F, 0x9E, 0x1D, 0x7F, 0xA5, 0x1B, 0x7F, 0xA5, 0x1B, 0x63,
-    0x69, 0x72, 0x79, 0x7F, 0xA4, 0xCC, 0x7F, 0x9E, 0x0D, 0x7F, 0xA4, 0xCC, 0xA0, 0x26, 0xE3, 0x21, 0x72, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x70, 0xFD, 0xA1, 0x02, 0x71, 0x69, 0xFD, 0x6D, 0x61, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0xA2, 0x7F, 0xA5, 0x2C, 0x7F, 0xA5, 0x8C, 0x7F, 0x9D,
-    0xDD, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xC8, 0x7F, 0xA5, 0x46, 0x7F, 0xA8, 0x69, 0x7F, 0xFF, 0xD5,
-    0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xFB, 0xA0, 0x26, 0xB3, 0x21, 0x75, 0xFD, 0x21, 0x64, 0xFD, 0x41, 0x70, 0xA2, 0x1E,
-    0x21, 0x65, 0xFC, 0xA2, 0x00, 0x51, 0x72, 0x63, 0xF6, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x76, 0xA4, 0xFA, 0xA4, 0x65,
-    0xA6, 0x59, 0xA5, 0x9D, 0x63, 0x61, 0x69, 0x79, 0x7F, 0xC9, 0x4C, 0x7F, 0x9D, 0x7E, 0x7F, 0xA4, 0xED, 0x42, 0x61,
-    0x65, 0xA4, 0xE0, 0xC0, 0x74, 0x47, 0x2E, 0x69, 0x6B, 0x6C, 0x6D, 0x72, 0x74, 0xA6, 0x38, 0xFF, 0xD8, 0xA5, 0x7C,
-    0xFF, 0xDF, 0xAB, 0x4C, 0xFF, 0xEC, 0xFF, 0xF9, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x76, 0x79, 0xFE, 0x50, 0xFE, 0xEA,
-    0xFF, 0x7D, 0xFF, 0xEA, 0xA5, 0x63, 0xA5, 0x4B, 0x41, 0x6C, 0xA4, 0x1B, 0x62, 0x65, 0x6F, 0x7F, 0xAC, 0x25, 0x7F,
-    0x9D, 0x5B, 0xA0, 0x27, 0x13, 0x21, 0x61, 0xFD, 0x21, 0x77, 0xFD, 0xA1, 0x00, 0x51, 0x65, 0xFD, 0x21, 0x74, 0xFB,
-    0x41, 0x65, 0xA4, 0x69, 0xA0, 0x27, 0x42, 0x42, 0x72, 0x67, 0xA3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF9, 0x6A, 0x62,
-    0x63, 0x67, 0x69, 0x6C, 0x6D, 0x72, 0x73, 0x74, 0x76, 0x7F, 0xFF, 0xD1, 0x7F, 0xAC, 0x40, 0x7F, 0xFF, 0xD5, 0x7F,
-    0xA2, 0x03, 0x7F, 0xA5, 0xD1, 0x7F, 0x9D, 0x18, 0x7F, 0x9E, 0x81, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF,
-    0xFD, 0x42, 0x72, 0x74, 0xA2, 0x06, 0xAD, 0x61, 0x41, 0x6E, 0xA0, 0x10, 0x63, 0x74, 0x76, 0x6B, 0x7F, 0x9E, 0x73,
-    0x7F, 0x9C, 0xFC, 0x7F, 0xFF, 0xFC, 0x47, 0x61, 0x64, 0x65, 0x6C, 0x72, 0x73, 0x76, 0xFF, 0xE8, 0xB9, 0x37, 0xFF,
-    0xF3, 0xA1, 0x0C, 0xA5, 0x49, 0xA1, 0x19, 0xA4, 0x26, 0xC1, 0x00, 0xD1, 0x6C, 0xBF, 0xFA, 0x62, 0x64, 0x67, 0x7F,
-    0x9C, 0xF8, 0x7F, 0x9C, 0xBB, 0x61, 0x70, 0x7F, 0x9C, 0xD3, 0x21, 0x73, 0xFB, 0x21, 0x65, 0xFD, 0xE7, 0x02, 0x81,
-    0x6C, 0x6E, 0x72, 0x73, 0x74, 0x7A, 0x64, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xEC, 0x7F, 0x9C, 0xA7, 0x7F, 0xFD, 0xFC,
-    0x7F, 0xA0, 0xE5, 0x7F, 0x9C, 0xBF, 0x7F, 0xFF, 0xFD, 0x42, 0x65, 0x69, 0xB2, 0xF3, 0xA8, 0x9B, 0x41, 0x65, 0xA4,
-    0x30, 0x41, 0x6E, 0xB7, 0xF3, 0x21, 0x65, 0xFC, 0xE3, 0x11, 0x52, 0x6D, 0x76, 0x6B, 0x7F, 0x9C, 0x82, 0x7F, 0xFF,
-    0xF5, 0x7F, 0xFF, 0xFD, 0x61, 0x6F, 0x7F, 0x9D, 0xF6, 0x21, 0x72, 0xFB, 0x21, 0x61, 0xFD, 0xA1, 0x00, 0x51, 0x70,
-    0xFD, 0x42, 0x61, 0x65, 0xA1, 0xA0, 0xCE, 0xC6, 0xA1, 0x00, 0x51, 0x74, 0xF9, 0x22, 0x61, 0x69, 0xEF, 0xFB, 0x44,
-    0x68, 0x6C, 0x70, 0x74, 0xA3, 0x95, 0xA3, 0xAF, 0xA3, 0xEE, 0xAE, 0x8D, 0x6F, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6B,
-    0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x63, 0x7F, 0xFF, 0x21, 0x7F, 0xA4, 0xAB, 0x7F, 0xFF, 0x62, 0x7F,
-    0x9C, 0x9F, 0x7F, 0xFF, 0x92, 0x7F, 0xA4, 0x2A, 0x7F, 0xFF, 0xB1, 0x7F, 0xDD, 0x27, 0x7F, 0xFF, 0xC3, 0x7F, 0xA3,
-    0x0D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF3, 0x7F, 0xA3, 0x0A, 0x7F, 0xA3, 0xA2, 0x7F, 0xA3, 0x88, 0xE5, 0x02, 0xB1,
-    0x63, 0x67, 0x6D, 0x70, 0x73, 0x7F, 0xA0, 0x19, 0x7F, 0xDC, 0xEA, 0x7F, 0x9C, 0x0E, 0x7F, 0xA3, 0xED, 0x7F, 0x9C,
-    0x14, 0xA0, 0x06, 0x72, 0x41, 0x75, 0xB3, 0x54, 0x62, 0x69, 0x6F, 0x7F, 0x9B, 0xDE, 0x7F, 0xA2, 0xBA, 0xC3, 0x02,
-    0xB1, 0x63, 0x64, 0x72, 0xFF, 0xF3, 0xA3, 0x06, 0xFF, 0xF7, 0xE1, 0x00, 0xD1, 0x6C, 0x7F, 0x9B, 0xEA, 0xE2, 0x02,
-    0xB1, 0x69, 0x75, 0x7F, 0xFF, 0xF9, 0x7F, 0x9B, 0xC2, 0x42, 0x65, 0x69, 0xA3, 0xA8, 0xA8, 0x8C, 0xC4, 0x02, 0x21,
-    0x61, 0x63, 0x64, 0x6D, 0xA2, 0x8C, 0xA2, 0x8C, 0xC9, 0xF3, 0xFF, 0xF9, 0x41, 0x6E, 0xB8, 0x0C, 0x61, 0x6F, 0x7F,
-    0x9B, 0xE7, 0x21, 0x74, 0xFB, 0x62, 0x63, 0x64, 0x7F, 0xFF, 0xFD, 0x7F, 0x9B, 0xA7, 0xA2, 0x02, 0x21, 0x61, 0x65,
-    0xEB, 0xF7, 0xC1, 0x07, 0x82, 0x69, 0xA2, 0xD4, 0xC1, 0x02, 0xB1, 0x61, 0xA2, 0x92, 0x61, 0x73, 0x7F, 0x9D, 0x25,
-    0x21, 0x69, 0xFB, 0xA1, 0x02, 0xB1, 0x75, 0xFD, 0x4B, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x70, 0x74, 0x75, 0x78,
-    0x71, 0xFF, 0x70, 0xFF, 0x87, 0xFF, 0x97, 0xFF, 0xAA, 0xFF, 0xBC, 0xBA, 0x05, 0xFF, 0xE0, 0xFF, 0xE7, 0xFF, 0xED,
-    0xA2, 0xD5, 0xFF, 0xFB, 0x43, 0x63, 0x72, 0x74, 0xA2, 0x1E, 0xC4, 0x51, 0xA2, 0x1E, 0xC1, 0x00, 0x51, 0x64, 0xE0,
-    0x00, 0xA1, 0x02, 0x21, 0x65, 0xFA, 0x62, 0x6D, 0x74, 0x7F, 0x9B, 0x2F, 0x7F, 0x9B, 0x2F, 0xC3, 0x02, 0xB1, 0x65,
-    0x68, 0x6F, 0xBB, 0x2F, 0xFF, 0xF2, 0xFF, 0xF7, 0xC1, 0x02, 0xB1, 0x66, 0xA3, 0x11, 0x41, 0x79, 0xA0, 0xA2, 0x21,
-    0x72, 0xFC, 0x21, 0x65, 0xFD, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x44, 0x65, 0x72, 0x73, 0x74, 0xA1, 0xDF, 0xFF, 0xEB,
-    0xFF, 0xFB, 0xA2, 0x74, 0x44, 0x61, 0x6C, 0x6F, 0x75, 0xA2, 0x4D, 0xD9, 0xBF, 0xA2, 0x4D, 0xA1, 0xD2, 0x61, 0x6C,
-    0x7F, 0x9B, 0x18, 0x21, 0x6F, 0xFB, 0x41, 0x79, 0xA1, 0xE6, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x43,
-    0x62, 0x65, 0x70, 0xFF, 0xF1, 0xFF, 0xFB, 0xCB, 0x51, 0x45, 0x63, 0x64, 0x67, 0x69, 0x78, 0xD6, 0x85, 0xA1, 0xAF,
-    0xA1, 0xAF, 0xA3, 0xC4, 0xA3, 0x9B, 0x42, 0x65, 0x73, 0xA1, 0xBA, 0xA2, 0xB4, 0xE5, 0x07, 0x42, 0x64, 0x67, 0x6D,
-    0x6E, 0x73, 0x7F, 0xA1, 0x98, 0x7F, 0xA3, 0xB5, 0x7F, 0x9A, 0xBC, 0x7F, 0xFF, 0xF9, 0x7F, 0xA2, 0xAD, 0x62, 0x64,
-    0x72, 0x7F, 0xA2, 0x96, 0x7F, 0x9A, 0xC6, 0xC1, 0x02, 0x21, 0x63, 0xA2, 0x8D, 0x41, 0x61, 0xA4, 0x9B, 0x45, 0x65,
-    0x69, 0x6F, 0x74, 0x75, 0xFF, 0xED, 0xA1, 0xA5, 0xFF, 0xF6, 0xFF, 0xFC, 0xA1, 0x66, 0x44, 0x61, 0x69, 0x6F, 0x72,
-    0xAC, 0x1A, 0xA3, 0x95, 0xA1, 0xD1, 0xA1, 0xEB, 0x43, 0x63, 0x6F, 0x73, 0xA2, 0x04, 0xA1, 0x88, 0xA2, 0x81, 0x41,
-    0x6F, 0xA2, 0xDD, 0xC2, 0x01, 0xF1, 0x61, 0x72, 0xA1, 0x7A, 0xFF, 0xFC, 0x67, 0x63, 0x65, 0x69, 0x6F, 0x73, 0x74,
-    0x75, 0x7F, 0xA1, 0xC7, 0x7F, 0xFE, 0x79, 0x7F, 0xFF, 0xE9, 0x7F, 0xA2, 0x4F, 0x7F, 0x9A, 0x5E, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x9B, 0xF8, 0x41, 0x69, 0xBF, 0x9B, 0x42, 0x68, 0x69, 0xFF, 0xFC, 0xAD, 0xFC, 0x51, 0x61, 0x62, 0x63, 0x64,
-    0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x77, 0xFE, 0xEC, 0xA2, 0xA8, 0xFF, 0x0A,
-    0xA2, 0xA8, 0xFF, 0x2B, 0xA5, 0xD6, 0xA9, 0x61, 0xA2, 0xA8, 0xFF, 0x38, 0xFF, 0x59, 0xFF, 0x63, 0xFF, 0x7A, 0xFF,
-    0xA4, 0xFF, 0xB4, 0xFF, 0xD8, 0xFF, 0xF9, 0xA2, 0xA8, 0xE2, 0x01, 0xF1, 0x62, 0x72, 0x7F, 0xB1, 0xFC, 0x7F, 0x9B,
-    0xA0, 0xC1, 0x02, 0xB1, 0x6F, 0xA1, 0x0A, 0xE4, 0x02, 0x41, 0x6E, 0x70, 0x72, 0x74, 0x7F, 0xA1, 0x5A, 0x7F, 0xA1,
-    0x5A, 0x7F, 0xFF, 0xFA, 0x7F, 0x99, 0xF1, 0x41, 0x6E, 0xA2, 0x29, 0xC3, 0x03, 0xE2, 0x6C, 0x73, 0x61, 0xA1, 0xCB,
-    0xA1, 0xCB, 0xFF, 0xFC, 0xA0, 0x19, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x68, 0xFD, 0xC3, 0x03, 0xD1, 0x6D, 0x6F, 0x70,
-    0xA1, 0x2E, 0xA1, 0xC0, 0xFF, 0xFD, 0xC2, 0x0A, 0x23, 0x79, 0x77, 0xA1, 0xAA, 0xCD, 0xF1, 0x69, 0x61, 0x62, 0x65,
-    0x69, 0x6C, 0x6D, 0x6F, 0x74, 0x7A, 0x7F, 0xFF, 0xAE, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF, 0xD6, 0x7F,
-    0xA2, 0x78, 0x7F, 0xA0, 0x81, 0x7F, 0xFF, 0xEB, 0x7F, 0x99, 0xED, 0x7F, 0xFF, 0xF7, 0x5B, 0x2E, 0x61, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0xA0, 0x16, 0xA7, 0x72, 0xAA, 0x96, 0xAE, 0xF7, 0xB3, 0x08, 0xBB, 0x8C, 0xBD, 0xBA, 0xC0,
-    0x91, 0xC3, 0x6B, 0xC9, 0xA0, 0xCA, 0x3D, 0xCB, 0x0E, 0xCF, 0xE3, 0xD3, 0xFE, 0xD8, 0xF4, 0xDF, 0x23, 0xE3, 0x9B,
-    0xE4, 0x25, 0xEA, 0x8B, 0xF0, 0xDD, 0xF6, 0x7C, 0xFA, 0x00, 0xFC, 0x31, 0xFD, 0x52, 0xFE, 0x1F, 0xFF, 0x55, 0xFF,
-    0xDB,
+// Aho-Corasick automaton for the hypher patterns: 8399 states, 28 dense.
+constexpr uint8_t en_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns en_patterns = {
-    0x68EDu,
-    en_trie_data,
-    sizeof(en_trie_data),
+constexpr uint16_t en_dense[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 1, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 18, 44,
+    45, 46, 47, 48, 49, 25, 50, 27, 0, 1, 2, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 0, 1, 76, 77, 4, 78, 79, 80, 8, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 18, 90, 91, 92, 93, 94, 95, 25, 96, 27,
+    0, 1, 97, 3, 98, 5, 99, 7, 8, 100, 101, 11, 102, 103, 14, 104,
+    105, 17, 106, 107, 108, 109, 110, 23, 24, 25, 111, 112, 0, 1, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 18, 129,
+    130, 131, 132, 133, 134, 25, 135, 27, 0, 1, 136, 137, 138, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+    158, 159, 160, 27, 0, 1, 161, 162, 4, 163, 164, 165, 8, 166, 167, 11,
+    12, 168, 169, 170, 171, 172, 18, 173, 174, 175, 176, 23, 24, 25, 177, 27,
+    0, 1, 178, 179, 4, 180, 181, 7, 182, 183, 184, 11, 12, 185, 186, 187,
+    188, 189, 18, 190, 191, 192, 193, 23, 194, 25, 195, 27, 0, 1, 196, 197,
+    4, 5, 198, 199, 8, 200, 201, 11, 202, 203, 204, 205, 206, 207, 18, 208,
+    209, 210, 211, 23, 212, 25, 213, 27, 0, 1, 214, 215, 216, 217, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 0, 1, 240, 3, 4, 5, 241, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 242, 17, 18, 19, 20, 21, 243, 23, 24, 25, 26, 27,
+    0, 1, 244, 245, 4, 5, 246, 247, 8, 248, 249, 11, 250, 251, 252, 253,
+    254, 17, 18, 255, 256, 257, 22, 23, 258, 25, 26, 27, 0, 1, 259, 260,
+    261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 18, 275,
+    276, 277, 278, 279, 280, 25, 281, 27, 0, 1, 282, 283, 284, 5, 285, 286,
+    8, 287, 288, 11, 289, 290, 291, 292, 293, 294, 18, 295, 296, 297, 298, 23,
+    299, 25, 26, 27, 0, 1, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309,
+    310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 25, 323, 324,
+    0, 1, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+    339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 27, 0, 1, 350, 351,
+    4, 352, 353, 354, 355, 356, 357, 11, 358, 359, 360, 361, 362, 363, 18, 364,
+    365, 366, 367, 23, 368, 25, 26, 27, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 369, 23,
+    24, 25, 26, 27, 0, 1, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+    380, 381, 382, 383, 384, 385, 18, 386, 387, 388, 389, 390, 391, 25, 392, 393,
+    0, 1, 394, 395, 396, 397, 398, 399, 400, 401, 402, 11, 403, 404, 405, 406,
+    407, 408, 409, 410, 411, 412, 413, 414, 415, 25, 416, 27, 0, 1, 417, 418,
+    419, 420, 421, 422, 423, 424, 425, 11, 12, 426, 427, 428, 429, 430, 18, 431,
+    432, 433, 434, 435, 436, 25, 437, 438, 0, 1, 439, 440, 441, 442, 443, 444,
+    445, 9, 446, 447, 448, 449, 450, 451, 452, 453, 18, 454, 455, 456, 457, 458,
+    24, 459, 26, 460, 0, 1, 461, 3, 4, 5, 462, 7, 8, 9, 463, 11,
+    12, 13, 14, 15, 464, 17, 18, 19, 20, 21, 22, 465, 24, 25, 466, 27,
+    0, 1, 467, 468, 469, 5, 470, 7, 8, 471, 472, 11, 473, 474, 14, 475,
+    476, 477, 18, 478, 479, 480, 22, 23, 24, 25, 481, 27, 0, 1, 482, 3,
+    483, 5, 484, 7, 8, 485, 486, 11, 12, 13, 14, 15, 487, 488, 489, 19,
+    20, 490, 491, 23, 24, 492, 26, 27, 0, 1, 493, 494, 495, 496, 497, 7,
+    498, 499, 500, 11, 12, 501, 502, 503, 504, 505, 18, 506, 507, 508, 22, 23,
+    509, 25, 26, 27, 0, 1, 510, 511, 4, 5, 512, 7, 8, 9, 513, 11,
+    12, 514, 515, 15, 516, 17, 18, 19, 20, 517, 22, 23, 24, 25, 26, 518,
+};
+
+constexpr uint8_t en_label[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x02, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x1A, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x1A, 0x1B, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x1A, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x02, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x1A, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x13, 0x14, 0x15, 0x16, 0x18, 0x1A, 0x02, 0x03, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13,
+    0x14, 0x15, 0x16, 0x18, 0x1A, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x02, 0x06, 0x10, 0x16, 0x02, 0x03, 0x06,
+    0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x18, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x02, 0x03, 0x04,
+    0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x18, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x1A, 0x1B, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x18, 0x16, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x1B, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x1A, 0x1B, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x19, 0x1B, 0x02, 0x06, 0x0A, 0x10, 0x17, 0x1A, 0x02, 0x03, 0x04, 0x06, 0x09, 0x0A, 0x0C, 0x0D,
+    0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x1A, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x10, 0x11, 0x12, 0x15, 0x16, 0x19, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x18, 0x02, 0x03, 0x06,
+    0x0A, 0x0D, 0x0E, 0x10, 0x15, 0x1B, 0x04, 0x05, 0x07, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x02,
+    0x06, 0x13, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x06, 0x0A, 0x10, 0x13, 0x16, 0x02, 0x03, 0x06, 0x08, 0x0D, 0x0F,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x1A, 0x06, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x05, 0x0E,
+    0x0F, 0x13, 0x14, 0x16, 0x0A, 0x10, 0x02, 0x06, 0x0A, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x06, 0x0A, 0x10, 0x05, 0x07,
+    0x13, 0x14, 0x15, 0x16, 0x06, 0x0A, 0x10, 0x13, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x04, 0x06, 0x09, 0x0A, 0x11, 0x15,
+    0x1A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x0F, 0x11, 0x13, 0x14, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x01, 0x02, 0x06,
+    0x0A, 0x0D, 0x10, 0x13, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x13, 0x15, 0x16, 0x05, 0x06, 0x0A, 0x0D, 0x10, 0x13, 0x14,
+    0x16, 0x13, 0x07, 0x02, 0x06, 0x0A, 0x0D, 0x0F, 0x10, 0x16, 0x1A, 0x02, 0x06, 0x0D, 0x10, 0x02, 0x04, 0x0D, 0x0F,
+    0x15, 0x06, 0x02, 0x05, 0x06, 0x0A, 0x0D, 0x0E, 0x10, 0x1A, 0x02, 0x06, 0x0A, 0x10, 0x11, 0x02, 0x05, 0x06, 0x08,
+    0x0A, 0x0C, 0x0F, 0x10, 0x14, 0x15, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x14, 0x16, 0x16, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x0A, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x01, 0x02, 0x09, 0x0A, 0x0C, 0x0D, 0x10, 0x11, 0x14,
+    0x15, 0x16, 0x1A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x14, 0x15, 0x16, 0x1A, 0x03, 0x08, 0x0D, 0x0F, 0x13, 0x14,
+    0x15, 0x02, 0x06, 0x0A, 0x10, 0x02, 0x0A, 0x0D, 0x14, 0x0A, 0x02, 0x06, 0x14, 0x0A, 0x1B, 0x01, 0x04, 0x05, 0x08,
+    0x0D, 0x0F, 0x13, 0x14, 0x15, 0x1B, 0x06, 0x0A, 0x01, 0x02, 0x05, 0x08, 0x0D, 0x0E, 0x0F, 0x14, 0x15, 0x17, 0x18,
+    0x1A, 0x03, 0x05, 0x06, 0x07, 0x0D, 0x0F, 0x10, 0x15, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x06, 0x05, 0x06, 0x0D, 0x0E,
+    0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x0A, 0x10, 0x16, 0x10, 0x0D, 0x10, 0x13, 0x07, 0x08, 0x0D, 0x0E, 0x0F, 0x13,
+    0x14, 0x15, 0x01, 0x14, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0D, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x17, 0x09, 0x0A, 0x10,
+    0x01, 0x05, 0x0A, 0x0D, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x18, 0x01, 0x02, 0x06, 0x0A, 0x10, 0x14, 0x15, 0x02, 0x04,
+    0x06, 0x07, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x14, 0x15, 0x1B, 0x0A, 0x02, 0x06, 0x0A, 0x1A, 0x02, 0x06,
+    0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18, 0x1B, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x02, 0x06,
+    0x0A, 0x13, 0x16, 0x18, 0x05, 0x07, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x06, 0x01, 0x03, 0x04, 0x07,
+    0x08, 0x0D, 0x0E, 0x0F, 0x13, 0x15, 0x17, 0x1A, 0x02, 0x0A, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0D,
+    0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x1A, 0x02, 0x06, 0x0A, 0x1A, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x17, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x1A, 0x01, 0x05, 0x06,
+    0x07, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18, 0x19, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x1A,
+    0x11, 0x18, 0x1A, 0x02, 0x09, 0x02, 0x04, 0x06, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x0F, 0x14, 0x03, 0x04, 0x05,
+    0x08, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x06, 0x0A, 0x13, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x13,
+    0x15, 0x16, 0x02, 0x05, 0x06, 0x08, 0x0A, 0x10, 0x13, 0x16, 0x04, 0x05, 0x07, 0x0D, 0x0E, 0x0F, 0x11, 0x14, 0x15,
+    0x19, 0x06, 0x07, 0x0A, 0x10, 0x16, 0x02, 0x06, 0x0A, 0x0F, 0x10, 0x16, 0x1A, 0x06, 0x04, 0x05, 0x08, 0x0E, 0x0F,
+    0x13, 0x15, 0x16, 0x0A, 0x0D, 0x02, 0x06, 0x07, 0x0A, 0x0D, 0x10, 0x14, 0x15, 0x16, 0x02, 0x03, 0x06, 0x0A, 0x0F,
+    0x10, 0x11, 0x16, 0x1A, 0x02, 0x04, 0x05, 0x06, 0x0A, 0x0F, 0x10, 0x14, 0x15, 0x16, 0x1A, 0x1B, 0x07, 0x08, 0x0A,
+    0x0D, 0x11, 0x13, 0x14, 0x15, 0x16, 0x18, 0x02, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x13, 0x14, 0x15, 0x16, 0x16, 0x02,
+    0x03, 0x04, 0x06, 0x09, 0x0A, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x16, 0x18, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0C, 0x0E,
+    0x10, 0x11, 0x14, 0x15, 0x16, 0x18, 0x02, 0x06, 0x09, 0x0A, 0x0F, 0x10, 0x13, 0x16, 0x1A, 0x1B, 0x04, 0x0F, 0x11,
+    0x13, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x11, 0x04, 0x06, 0x14, 0x03, 0x04, 0x08,
+    0x0A, 0x0D, 0x0E, 0x13, 0x15, 0x16, 0x01, 0x02, 0x03, 0x04, 0x05, 0x0D, 0x0E, 0x0F, 0x13, 0x17, 0x06, 0x0A, 0x0D,
+    0x1A, 0x02, 0x04, 0x05, 0x08, 0x0D, 0x0F, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x1A, 0x0F, 0x13, 0x14, 0x02,
+    0x06, 0x0A, 0x10, 0x10, 0x1A, 0x06, 0x08, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x07, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15,
+    0x1B, 0x01, 0x05, 0x06, 0x0D, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x17, 0x06, 0x0D, 0x10, 0x0A, 0x10, 0x15, 0x01, 0x02,
+    0x04, 0x06, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x16, 0x17, 0x1B, 0x02, 0x06, 0x0A, 0x10, 0x1A, 0x02, 0x06, 0x0A,
+    0x10, 0x01, 0x03, 0x06, 0x08, 0x0A, 0x0F, 0x10, 0x13, 0x14, 0x17, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x15, 0x09, 0x02,
+    0x06, 0x0A, 0x0F, 0x14, 0x15, 0x0F, 0x13, 0x03, 0x04, 0x06, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15,
+    0x16, 0x1B, 0x02, 0x04, 0x05, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x19, 0x02, 0x04, 0x08, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x17, 0x02, 0x10, 0x06, 0x02, 0x05, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x13,
+    0x14, 0x16, 0x17, 0x06, 0x10, 0x09, 0x02, 0x06, 0x1A, 0x08, 0x0E, 0x0F, 0x14, 0x15, 0x02, 0x11, 0x14, 0x0D, 0x0E,
+    0x0F, 0x11, 0x14, 0x15, 0x06, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x13, 0x15,
+    0x16, 0x02, 0x05, 0x06, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x05, 0x08, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x01, 0x02, 0x06,
+    0x07, 0x0A, 0x0D, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x0D, 0x0F, 0x10, 0x13, 0x16, 0x0C, 0x02, 0x06, 0x07, 0x0A, 0x0D,
+    0x0F, 0x10, 0x15, 0x16, 0x17, 0x02, 0x06, 0x0A, 0x0F, 0x10, 0x11, 0x16, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x14, 0x15, 0x16, 0x1A, 0x01, 0x08, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x16,
+    0x06, 0x09, 0x0A, 0x13, 0x16, 0x16, 0x02, 0x05, 0x06, 0x08, 0x0A, 0x0E, 0x10, 0x13, 0x16, 0x01, 0x02, 0x04, 0x06,
+    0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x14, 0x15, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x15, 0x16,
+    0x1B, 0x06, 0x0A, 0x10, 0x10, 0x02, 0x0A, 0x10, 0x04, 0x0F, 0x11, 0x13, 0x14, 0x18, 0x11, 0x05, 0x01, 0x03, 0x08,
+    0x0A, 0x0D, 0x05, 0x06, 0x08, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x01, 0x04, 0x0D, 0x0E, 0x0F, 0x11, 0x14, 0x06, 0x1A,
+    0x06, 0x10, 0x13, 0x14, 0x16, 0x17, 0x10, 0x04, 0x09, 0x0D, 0x1A, 0x03, 0x04, 0x05, 0x08, 0x0A, 0x0E, 0x0F, 0x13,
+    0x14, 0x15, 0x17, 0x0A, 0x06, 0x09, 0x0A, 0x06, 0x0A, 0x13, 0x02, 0x03, 0x04, 0x07, 0x08, 0x0E, 0x0F, 0x11, 0x13,
+    0x14, 0x17, 0x1A, 0x13, 0x02, 0x06, 0x10, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12,
+    0x14, 0x15, 0x17, 0x1B, 0x02, 0x02, 0x06, 0x07, 0x0A, 0x10, 0x06, 0x0A, 0x10, 0x01, 0x02, 0x03, 0x04, 0x07, 0x08,
+    0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x02, 0x09, 0x0A, 0x0D, 0x13, 0x04, 0x06, 0x0A, 0x02, 0x06,
+    0x09, 0x0A, 0x13, 0x16, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x0E, 0x0F, 0x10, 0x11, 0x14, 0x15, 0x06, 0x02, 0x03,
+    0x08, 0x0E, 0x0F, 0x14, 0x03, 0x04, 0x08, 0x09, 0x0A, 0x0D, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x02, 0x0A, 0x01, 0x05,
+    0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x17, 0x01, 0x02, 0x05, 0x08, 0x0D, 0x0F, 0x10, 0x14, 0x15, 0x1B,
+    0x02, 0x02, 0x0A, 0x10, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x17, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x15, 0x1A, 0x09, 0x0A, 0x05, 0x0D, 0x0E, 0x0F, 0x11, 0x16, 0x03, 0x04, 0x08, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x17, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16, 0x02, 0x06, 0x0A, 0x15, 0x16,
+    0x18, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x0A,
+    0x02, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x14, 0x16, 0x1A, 0x02, 0x06, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x0C, 0x0E,
+    0x0F, 0x10, 0x14, 0x15, 0x06, 0x0A, 0x0D, 0x13, 0x06, 0x06, 0x06, 0x0A, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0D,
+    0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x0A, 0x13, 0x16, 0x02, 0x04, 0x06, 0x0A, 0x0D, 0x0E, 0x10,
+    0x11, 0x15, 0x02, 0x06, 0x0A, 0x13, 0x14, 0x16, 0x02, 0x05, 0x06, 0x07, 0x0A, 0x0E, 0x0F, 0x10, 0x15, 0x0E, 0x11,
+    0x02, 0x05, 0x0D, 0x13, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x0D, 0x13, 0x16, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x13, 0x15,
+    0x16, 0x05, 0x06, 0x0A, 0x10, 0x16, 0x0D, 0x0F, 0x13, 0x15, 0x17, 0x0A, 0x02, 0x06, 0x0A, 0x0D, 0x0F, 0x13, 0x16,
+    0x1A, 0x02, 0x04, 0x05, 0x07, 0x08, 0x0D, 0x0F, 0x14, 0x15, 0x06, 0x0A, 0x02, 0x05, 0x06, 0x07, 0x0A, 0x0D, 0x10,
+    0x11, 0x15, 0x16, 0x17, 0x1A, 0x02, 0x03, 0x06, 0x0A, 0x0E, 0x10, 0x11, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0C,
+    0x10, 0x14, 0x15, 0x16, 0x17, 0x05, 0x0C, 0x11, 0x13, 0x14, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16, 0x1A, 0x02,
+    0x06, 0x08, 0x0A, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x1A, 0x02, 0x04, 0x0A, 0x0D, 0x10, 0x11, 0x15,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x03, 0x04, 0x06, 0x0D, 0x0F, 0x17, 0x06, 0x0A, 0x10, 0x05, 0x06, 0x0A, 0x0F, 0x10,
+    0x0A, 0x02, 0x04, 0x05, 0x08, 0x0A, 0x0D, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x1A, 0x01, 0x02, 0x04, 0x05, 0x06, 0x0C,
+    0x0D, 0x0F, 0x10, 0x13, 0x15, 0x01, 0x02, 0x06, 0x0A, 0x0D, 0x10, 0x14, 0x15, 0x16, 0x1A, 0x02, 0x04, 0x05, 0x06,
+    0x08, 0x0D, 0x0F, 0x10, 0x15, 0x02, 0x0A, 0x10, 0x16, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0D, 0x0F, 0x11, 0x13, 0x14,
+    0x15, 0x16, 0x02, 0x06, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x06, 0x09, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16,
+    0x18, 0x03, 0x06, 0x07, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x03, 0x04, 0x05, 0x07, 0x0A, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x1B, 0x02, 0x0A, 0x10, 0x06, 0x09, 0x0A, 0x16, 0x02, 0x0A,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x16,
+    0x1A, 0x06, 0x0A, 0x0D, 0x10, 0x16, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x14, 0x15, 0x17, 0x01, 0x06, 0x09, 0x0D, 0x13, 0x14, 0x06, 0x0A, 0x10, 0x02, 0x06, 0x0A, 0x1A, 0x02, 0x06,
+    0x0A, 0x10, 0x16, 0x03, 0x04, 0x06, 0x07, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x17, 0x19, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x06, 0x0A, 0x10, 0x1A, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x10, 0x11, 0x18, 0x02, 0x06, 0x09,
+    0x0A, 0x13, 0x14, 0x02, 0x06, 0x08, 0x0A, 0x0E, 0x0F, 0x14, 0x15, 0x06, 0x0A, 0x10, 0x04, 0x0F, 0x15, 0x14, 0x03,
+    0x04, 0x0A, 0x0D, 0x0F, 0x11, 0x15, 0x16, 0x17, 0x18, 0x02, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x1A, 0x01,
+    0x02, 0x04, 0x05, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18, 0x19, 0x01, 0x06, 0x0A, 0x10,
+    0x18, 0x03, 0x04, 0x05, 0x08, 0x0D, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x17, 0x1B, 0x06, 0x0A, 0x1A, 0x02, 0x06,
+    0x0A, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x04, 0x07, 0x08, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x17, 0x02, 0x06, 0x09, 0x0A,
+    0x0D, 0x10, 0x16, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0D, 0x0F, 0x11, 0x15, 0x16, 0x18, 0x01, 0x02, 0x03, 0x06, 0x09,
+    0x0A, 0x0D, 0x10, 0x13, 0x14, 0x16, 0x18, 0x1A, 0x02, 0x03, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x0A, 0x10,
+    0x04, 0x0D, 0x0F, 0x13, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x09, 0x13, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14,
+    0x15, 0x16, 0x19, 0x1A, 0x01, 0x02, 0x06, 0x0A, 0x0D, 0x10, 0x14, 0x1A, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x16, 0x17, 0x1B, 0x02, 0x06, 0x0A, 0x10, 0x06, 0x03, 0x04, 0x05, 0x07,
+    0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x18, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x04, 0x09, 0x18, 0x06,
+    0x10, 0x13, 0x16, 0x02, 0x03, 0x05, 0x06, 0x07, 0x0A, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x02, 0x09, 0x0A, 0x10, 0x02,
+    0x0D, 0x11, 0x06, 0x03, 0x04, 0x05, 0x0F, 0x13, 0x15, 0x17, 0x06, 0x0A, 0x0D, 0x02, 0x0A, 0x0D, 0x13, 0x16, 0x1A,
+    0x05, 0x06, 0x0A, 0x10, 0x14, 0x16, 0x02, 0x0F, 0x13, 0x02, 0x0D, 0x09, 0x0A, 0x0D, 0x0F, 0x13, 0x15, 0x17, 0x02,
+    0x04, 0x05, 0x06, 0x08, 0x0A, 0x0D, 0x0E, 0x10, 0x14, 0x15, 0x16, 0x17, 0x02, 0x03, 0x0A, 0x10, 0x11, 0x02, 0x06,
+    0x0A, 0x14, 0x15, 0x16, 0x1A, 0x1B, 0x13, 0x14, 0x16, 0x06, 0x0A, 0x0D, 0x11, 0x15, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x0A, 0x0D, 0x0F, 0x10, 0x11, 0x14, 0x15, 0x16, 0x02, 0x04, 0x06, 0x0A, 0x0D, 0x11, 0x14, 0x15, 0x16, 0x02,
+    0x06, 0x0A, 0x0D, 0x10, 0x14, 0x0E, 0x16, 0x06, 0x01, 0x03, 0x04, 0x08, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x15, 0x16,
+    0x01, 0x05, 0x08, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x02, 0x05, 0x07, 0x08, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x14,
+    0x15, 0x17, 0x01, 0x0A, 0x0C, 0x0D, 0x0E, 0x13, 0x15, 0x03, 0x04, 0x08, 0x0A, 0x0D, 0x0E, 0x13, 0x14, 0x15, 0x17,
+    0x02, 0x05, 0x06, 0x0D, 0x13, 0x14, 0x17, 0x0A, 0x05, 0x0D, 0x0F, 0x13, 0x14, 0x15, 0x1B, 0x06, 0x0A, 0x10, 0x0C,
+    0x0E, 0x17, 0x02, 0x0A, 0x09, 0x0D, 0x11, 0x15, 0x04, 0x08, 0x0E, 0x11, 0x14, 0x04, 0x05, 0x13, 0x0A, 0x16, 0x02,
+    0x04, 0x05, 0x0E, 0x03, 0x02, 0x06, 0x16, 0x0A, 0x02, 0x04, 0x13, 0x15, 0x06, 0x09, 0x10, 0x06, 0x13, 0x14, 0x15,
+    0x0A, 0x02, 0x0D, 0x10, 0x16, 0x03, 0x06, 0x11, 0x04, 0x05, 0x08, 0x0A, 0x19, 0x05, 0x08, 0x0E, 0x0F, 0x14, 0x06,
+    0x0A, 0x10, 0x15, 0x16, 0x02, 0x0A, 0x10, 0x13, 0x04, 0x06, 0x0A, 0x10, 0x14, 0x15, 0x16, 0x09, 0x0A, 0x03, 0x13,
+    0x0F, 0x11, 0x13, 0x15, 0x02, 0x0D, 0x14, 0x0E, 0x10, 0x11, 0x06, 0x18, 0x1A, 0x09, 0x05, 0x15, 0x15, 0x02, 0x04,
+    0x08, 0x0A, 0x15, 0x14, 0x15, 0x04, 0x11, 0x14, 0x15, 0x10, 0x05, 0x0A, 0x0F, 0x08, 0x0F, 0x14, 0x13, 0x14, 0x0A,
+    0x15, 0x0E, 0x0F, 0x11, 0x13, 0x15, 0x0D, 0x0A, 0x15, 0x06, 0x0F, 0x13, 0x0E, 0x10, 0x13, 0x14, 0x04, 0x15, 0x0A,
+    0x04, 0x0E, 0x13, 0x14, 0x13, 0x05, 0x06, 0x02, 0x08, 0x14, 0x16, 0x13, 0x09, 0x0D, 0x06, 0x06, 0x14, 0x13, 0x14,
+    0x0F, 0x10, 0x02, 0x03, 0x13, 0x0F, 0x0E, 0x11, 0x13, 0x14, 0x15, 0x03, 0x06, 0x0F, 0x17, 0x0D, 0x10, 0x0E, 0x11,
+    0x04, 0x06, 0x0C, 0x14, 0x16, 0x13, 0x0A, 0x13, 0x0D, 0x13, 0x04, 0x0E, 0x15, 0x08, 0x0A, 0x0F, 0x11, 0x17, 0x08,
+    0x0F, 0x10, 0x15, 0x08, 0x0D, 0x0F, 0x13, 0x08, 0x13, 0x15, 0x0E, 0x14, 0x0F, 0x13, 0x15, 0x10, 0x04, 0x06, 0x0F,
+    0x05, 0x15, 0x02, 0x04, 0x05, 0x15, 0x15, 0x09, 0x15, 0x05, 0x15, 0x06, 0x10, 0x15, 0x0D, 0x14, 0x06, 0x04, 0x0F,
+    0x15, 0x17, 0x06, 0x0E, 0x14, 0x08, 0x15, 0x12, 0x14, 0x18, 0x05, 0x0A, 0x0D, 0x0E, 0x0F, 0x13, 0x0F, 0x09, 0x0A,
+    0x02, 0x11, 0x0D, 0x0F, 0x0D, 0x0E, 0x0F, 0x0F, 0x11, 0x12, 0x16, 0x0A, 0x02, 0x04, 0x05, 0x06, 0x0C, 0x10, 0x16,
+    0x06, 0x02, 0x0F, 0x13, 0x04, 0x03, 0x0D, 0x0D, 0x0F, 0x13, 0x02, 0x15, 0x02, 0x0D, 0x10, 0x0D, 0x03, 0x13, 0x10,
+    0x13, 0x06, 0x06, 0x0F, 0x10, 0x10, 0x0A, 0x0D, 0x0E, 0x0A, 0x13, 0x02, 0x04, 0x06, 0x10, 0x15, 0x16, 0x06, 0x18,
+    0x02, 0x16, 0x04, 0x0E, 0x0A, 0x0A, 0x03, 0x0F, 0x0D, 0x10, 0x16, 0x08, 0x0F, 0x06, 0x0D, 0x01, 0x1A, 0x0A, 0x10,
+    0x06, 0x0F, 0x03, 0x05, 0x13, 0x0A, 0x0F, 0x10, 0x02, 0x06, 0x06, 0x0A, 0x08, 0x01, 0x14, 0x15, 0x1B, 0x03, 0x08,
+    0x13, 0x14, 0x15, 0x0F, 0x13, 0x04, 0x07, 0x0D, 0x0F, 0x0F, 0x13, 0x06, 0x08, 0x0D, 0x13, 0x15, 0x06, 0x0A, 0x0D,
+    0x10, 0x06, 0x0F, 0x14, 0x16, 0x0A, 0x0D, 0x04, 0x06, 0x07, 0x0E, 0x0F, 0x10, 0x11, 0x14, 0x15, 0x16, 0x0D, 0x0A,
+    0x02, 0x15, 0x02, 0x04, 0x08, 0x0F, 0x11, 0x15, 0x16, 0x17, 0x02, 0x0A, 0x10, 0x13, 0x18, 0x02, 0x0D, 0x13, 0x13,
+    0x15, 0x02, 0x13, 0x06, 0x0A, 0x0D, 0x0F, 0x15, 0x04, 0x0D, 0x13, 0x14, 0x06, 0x06, 0x04, 0x05, 0x0D, 0x0E, 0x0F,
+    0x11, 0x15, 0x16, 0x17, 0x18, 0x02, 0x09, 0x0A, 0x13, 0x02, 0x06, 0x0F, 0x14, 0x0A, 0x0D, 0x02, 0x06, 0x0E, 0x0F,
+    0x10, 0x1B, 0x0A, 0x05, 0x0F, 0x10, 0x02, 0x06, 0x02, 0x09, 0x03, 0x0F, 0x0A, 0x02, 0x03, 0x04, 0x15, 0x0A, 0x04,
+    0x09, 0x09, 0x06, 0x13, 0x13, 0x0E, 0x03, 0x04, 0x0D, 0x11, 0x04, 0x08, 0x0F, 0x13, 0x14, 0x17, 0x06, 0x10, 0x01,
+    0x02, 0x03, 0x04, 0x07, 0x10, 0x15, 0x08, 0x0E, 0x11, 0x14, 0x10, 0x0C, 0x02, 0x06, 0x09, 0x02, 0x06, 0x0D, 0x13,
+    0x09, 0x16, 0x0A, 0x05, 0x0A, 0x06, 0x09, 0x08, 0x0F, 0x0F, 0x13, 0x06, 0x08, 0x10, 0x04, 0x13, 0x1A, 0x1A, 0x04,
+    0x05, 0x0D, 0x06, 0x0A, 0x0C, 0x08, 0x06, 0x02, 0x05, 0x06, 0x0A, 0x03, 0x0A, 0x10, 0x14, 0x09, 0x13, 0x0F, 0x15,
+    0x0C, 0x15, 0x02, 0x06, 0x0A, 0x0A, 0x16, 0x0A, 0x10, 0x0A, 0x16, 0x11, 0x15, 0x0A, 0x13, 0x18, 0x0A, 0x10, 0x0A,
+    0x0F, 0x13, 0x0A, 0x0D, 0x02, 0x05, 0x06, 0x08, 0x0E, 0x13, 0x16, 0x0A, 0x13, 0x16, 0x1B, 0x0F, 0x15, 0x01, 0x0F,
+    0x14, 0x0F, 0x14, 0x0F, 0x0F, 0x08, 0x0A, 0x0A, 0x03, 0x02, 0x01, 0x02, 0x05, 0x06, 0x0A, 0x0F, 0x02, 0x09, 0x10,
+    0x16, 0x0F, 0x15, 0x15, 0x14, 0x13, 0x07, 0x02, 0x0A, 0x0A, 0x15, 0x06, 0x0A, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x10,
+    0x15, 0x0A, 0x0D, 0x09, 0x06, 0x02, 0x0D, 0x10, 0x05, 0x06, 0x0A, 0x15, 0x1A, 0x06, 0x10, 0x15, 0x1A, 0x02, 0x09,
+    0x0A, 0x02, 0x02, 0x02, 0x0E, 0x0F, 0x16, 0x01, 0x06, 0x01, 0x0D, 0x04, 0x06, 0x0A, 0x15, 0x02, 0x02, 0x14, 0x15,
+    0x02, 0x03, 0x0F, 0x02, 0x05, 0x0D, 0x0E, 0x0F, 0x13, 0x06, 0x0F, 0x10, 0x15, 0x1B, 0x01, 0x09, 0x0A, 0x03, 0x13,
+    0x13, 0x0A, 0x02, 0x02, 0x0A, 0x02, 0x06, 0x08, 0x10, 0x12, 0x0F, 0x06, 0x09, 0x0A, 0x15, 0x0A, 0x13, 0x02, 0x0E,
+    0x04, 0x0E, 0x08, 0x13, 0x0F, 0x0A, 0x10, 0x06, 0x02, 0x06, 0x08, 0x15, 0x02, 0x09, 0x0A, 0x0D, 0x03, 0x10, 0x06,
+    0x14, 0x06, 0x02, 0x06, 0x0A, 0x14, 0x15, 0x02, 0x05, 0x15, 0x17, 0x07, 0x0F, 0x14, 0x15, 0x04, 0x06, 0x11, 0x14,
+    0x05, 0x03, 0x0F, 0x13, 0x04, 0x0E, 0x10, 0x13, 0x15, 0x0A, 0x15, 0x02, 0x06, 0x0A, 0x0A, 0x1A, 0x02, 0x0A, 0x14,
+    0x0A, 0x13, 0x09, 0x10, 0x08, 0x05, 0x0C, 0x1A, 0x02, 0x0A, 0x10, 0x06, 0x03, 0x03, 0x07, 0x0D, 0x0A, 0x10, 0x02,
+    0x0A, 0x0D, 0x10, 0x01, 0x0A, 0x07, 0x0A, 0x10, 0x01, 0x0A, 0x10, 0x02, 0x10, 0x15, 0x16, 0x02, 0x0A, 0x16, 0x09,
+    0x0E, 0x0F, 0x14, 0x01, 0x04, 0x0A, 0x10, 0x15, 0x16, 0x0A, 0x10, 0x0A, 0x15, 0x03, 0x02, 0x06, 0x15, 0x0F, 0x07,
+    0x06, 0x02, 0x06, 0x02, 0x06, 0x0A, 0x08, 0x0D, 0x06, 0x15, 0x0A, 0x15, 0x0A, 0x01, 0x02, 0x05, 0x14, 0x06, 0x06,
+    0x02, 0x0A, 0x10, 0x0A, 0x02, 0x0A, 0x05, 0x11, 0x15, 0x10, 0x08, 0x0A, 0x02, 0x0F, 0x03, 0x07, 0x0D, 0x11, 0x0E,
+    0x11, 0x18, 0x11, 0x03, 0x0D, 0x02, 0x06, 0x15, 0x0D, 0x06, 0x03, 0x11, 0x06, 0x06, 0x11, 0x15, 0x0A, 0x06, 0x06,
+    0x10, 0x06, 0x05, 0x0A, 0x02, 0x04, 0x06, 0x0A, 0x0C, 0x15, 0x11, 0x14, 0x15, 0x06, 0x09, 0x0A, 0x16, 0x06, 0x0A,
+    0x10, 0x0D, 0x0F, 0x15, 0x05, 0x0F, 0x02, 0x14, 0x02, 0x03, 0x07, 0x0E, 0x15, 0x02, 0x16, 0x0D, 0x0E, 0x0F, 0x13,
+    0x06, 0x02, 0x06, 0x0D, 0x13, 0x14, 0x0D, 0x02, 0x03, 0x04, 0x0E, 0x15, 0x1B, 0x0D, 0x0F, 0x0A, 0x0D, 0x0A, 0x0A,
+    0x1A, 0x02, 0x15, 0x1A, 0x13, 0x04, 0x0D, 0x0F, 0x15, 0x13, 0x14, 0x0D, 0x13, 0x03, 0x04, 0x0F, 0x15, 0x01, 0x14,
+    0x0D, 0x13, 0x13, 0x0D, 0x03, 0x07, 0x08, 0x14, 0x05, 0x06, 0x09, 0x1A, 0x05, 0x0F, 0x02, 0x01, 0x04, 0x0F, 0x15,
+    0x18, 0x19, 0x02, 0x03, 0x04, 0x05, 0x08, 0x0F, 0x13, 0x14, 0x03, 0x04, 0x06, 0x08, 0x0E, 0x0F, 0x10, 0x14, 0x15,
+    0x17, 0x02, 0x10, 0x02, 0x04, 0x08, 0x11, 0x09, 0x02, 0x05, 0x08, 0x04, 0x08, 0x0F, 0x0D, 0x15, 0x04, 0x06, 0x08,
+    0x0F, 0x14, 0x1B, 0x0A, 0x08, 0x0F, 0x0A, 0x0D, 0x0F, 0x0E, 0x0F, 0x09, 0x0A, 0x02, 0x06, 0x0E, 0x13, 0x14, 0x15,
+    0x18, 0x04, 0x06, 0x0D, 0x10, 0x14, 0x15, 0x16, 0x1B, 0x08, 0x14, 0x17, 0x18, 0x02, 0x09, 0x02, 0x07, 0x01, 0x13,
+    0x02, 0x06, 0x10, 0x10, 0x15, 0x0A, 0x0F, 0x0D, 0x0F, 0x15, 0x06, 0x0F, 0x0A, 0x06, 0x10, 0x09, 0x0A, 0x15, 0x0A,
+    0x03, 0x0F, 0x13, 0x15, 0x0D, 0x09, 0x01, 0x02, 0x04, 0x0A, 0x0D, 0x0E, 0x0F, 0x12, 0x14, 0x15, 0x02, 0x04, 0x06,
+    0x0F, 0x10, 0x15, 0x16, 0x17, 0x0A, 0x10, 0x03, 0x04, 0x13, 0x16, 0x06, 0x06, 0x0D, 0x18, 0x15, 0x02, 0x08, 0x02,
+    0x13, 0x16, 0x04, 0x0F, 0x13, 0x02, 0x06, 0x04, 0x05, 0x08, 0x0E, 0x0F, 0x14, 0x16, 0x0A, 0x0A, 0x0D, 0x0F, 0x02,
+    0x06, 0x0A, 0x13, 0x0A, 0x02, 0x0A, 0x10, 0x13, 0x13, 0x03, 0x0F, 0x10, 0x10, 0x1A, 0x04, 0x05, 0x0F, 0x13, 0x15,
+    0x0F, 0x02, 0x06, 0x0A, 0x10, 0x02, 0x0E, 0x0D, 0x10, 0x06, 0x0A, 0x13, 0x11, 0x14, 0x02, 0x0D, 0x0F, 0x13, 0x05,
+    0x0D, 0x0F, 0x17, 0x04, 0x08, 0x06, 0x0D, 0x0F, 0x15, 0x01, 0x0D, 0x13, 0x06, 0x0F, 0x0D, 0x02, 0x0A, 0x15, 0x02,
+    0x09, 0x10, 0x0D, 0x14, 0x15, 0x13, 0x02, 0x15, 0x0A, 0x10, 0x05, 0x0E, 0x13, 0x14, 0x06, 0x0F, 0x14, 0x1A, 0x01,
+    0x02, 0x06, 0x09, 0x0A, 0x14, 0x16, 0x06, 0x09, 0x0A, 0x0D, 0x1A, 0x02, 0x05, 0x06, 0x08, 0x0F, 0x15, 0x15, 0x08,
+    0x14, 0x0F, 0x13, 0x18, 0x10, 0x05, 0x15, 0x02, 0x06, 0x0A, 0x15, 0x15, 0x02, 0x14, 0x0D, 0x0D, 0x0D, 0x0A, 0x06,
+    0x0A, 0x0A, 0x14, 0x02, 0x01, 0x0A, 0x10, 0x06, 0x10, 0x0A, 0x10, 0x0F, 0x14, 0x09, 0x0A, 0x1B, 0x0A, 0x1A, 0x02,
+    0x04, 0x0A, 0x10, 0x1A, 0x05, 0x0E, 0x1A, 0x0A, 0x09, 0x0A, 0x10, 0x1A, 0x13, 0x16, 0x0F, 0x16, 0x10, 0x18, 0x13,
+    0x0A, 0x10, 0x0F, 0x14, 0x06, 0x01, 0x08, 0x14, 0x0D, 0x0D, 0x05, 0x14, 0x02, 0x03, 0x08, 0x14, 0x03, 0x13, 0x01,
+    0x04, 0x15, 0x0F, 0x10, 0x0E, 0x0F, 0x13, 0x14, 0x02, 0x05, 0x0A, 0x0A, 0x10, 0x01, 0x05, 0x0A, 0x0F, 0x11, 0x1A,
+    0x0F, 0x14, 0x06, 0x15, 0x07, 0x06, 0x13, 0x15, 0x02, 0x02, 0x0D, 0x09, 0x0E, 0x15, 0x16, 0x13, 0x02, 0x04, 0x05,
+    0x08, 0x0A, 0x0C, 0x15, 0x02, 0x0D, 0x15, 0x02, 0x05, 0x0D, 0x11, 0x15, 0x14, 0x04, 0x0F, 0x02, 0x05, 0x13, 0x02,
+    0x10, 0x0A, 0x0D, 0x10, 0x11, 0x02, 0x13, 0x02, 0x03, 0x06, 0x0F, 0x10, 0x1A, 0x11, 0x06, 0x02, 0x0F, 0x10, 0x09,
+    0x06, 0x02, 0x0F, 0x06, 0x0D, 0x10, 0x11, 0x13, 0x06, 0x14, 0x06, 0x09, 0x0F, 0x13, 0x15, 0x16, 0x0A, 0x14, 0x06,
+    0x02, 0x06, 0x02, 0x06, 0x02, 0x1A, 0x05, 0x0F, 0x02, 0x0A, 0x15, 0x16, 0x06, 0x11, 0x14, 0x06, 0x06, 0x0F, 0x11,
+    0x13, 0x0F, 0x10, 0x14, 0x0A, 0x0C, 0x15, 0x15, 0x13, 0x06, 0x09, 0x10, 0x06, 0x04, 0x0A, 0x15, 0x06, 0x14, 0x0A,
+    0x13, 0x16, 0x13, 0x02, 0x0F, 0x15, 0x0A, 0x0A, 0x0F, 0x0E, 0x11, 0x13, 0x14, 0x1A, 0x16, 0x10, 0x05, 0x0F, 0x11,
+    0x1A, 0x04, 0x02, 0x1A, 0x06, 0x16, 0x0D, 0x0E, 0x10, 0x13, 0x0A, 0x0F, 0x02, 0x14, 0x02, 0x06, 0x10, 0x15, 0x16,
+    0x06, 0x0E, 0x18, 0x10, 0x06, 0x02, 0x05, 0x02, 0x06, 0x0F, 0x15, 0x01, 0x04, 0x15, 0x04, 0x13, 0x06, 0x13, 0x04,
+    0x06, 0x03, 0x13, 0x15, 0x03, 0x0D, 0x0F, 0x15, 0x0A, 0x13, 0x15, 0x06, 0x0A, 0x13, 0x03, 0x05, 0x0E, 0x13, 0x08,
+    0x13, 0x17, 0x02, 0x03, 0x10, 0x14, 0x15, 0x1B, 0x02, 0x12, 0x1A, 0x13, 0x08, 0x13, 0x0F, 0x15, 0x05, 0x0D, 0x0F,
+    0x15, 0x0A, 0x0F, 0x06, 0x0D, 0x16, 0x17, 0x06, 0x0D, 0x06, 0x13, 0x14, 0x13, 0x02, 0x06, 0x0A, 0x0D, 0x10, 0x16,
+    0x01, 0x02, 0x10, 0x14, 0x15, 0x04, 0x14, 0x15, 0x06, 0x16, 0x01, 0x09, 0x14, 0x06, 0x13, 0x02, 0x06, 0x0A, 0x09,
+    0x0A, 0x09, 0x0A, 0x10, 0x13, 0x13, 0x04, 0x06, 0x0D, 0x02, 0x06, 0x0A, 0x03, 0x04, 0x06, 0x05, 0x07, 0x0D, 0x14,
+    0x0A, 0x05, 0x14, 0x15, 0x1B, 0x0A, 0x08, 0x0F, 0x06, 0x0D, 0x08, 0x13, 0x14, 0x09, 0x13, 0x02, 0x10, 0x03, 0x05,
+    0x14, 0x15, 0x02, 0x14, 0x0E, 0x0A, 0x1A, 0x02, 0x06, 0x02, 0x06, 0x0A, 0x0D, 0x13, 0x14, 0x01, 0x03, 0x08, 0x0E,
+    0x0F, 0x15, 0x13, 0x14, 0x0A, 0x02, 0x04, 0x08, 0x0D, 0x0E, 0x0F, 0x10, 0x14, 0x0E, 0x0F, 0x02, 0x1A, 0x02, 0x05,
+    0x0D, 0x01, 0x0D, 0x0F, 0x13, 0x0D, 0x10, 0x15, 0x13, 0x15, 0x13, 0x0F, 0x12, 0x16, 0x02, 0x06, 0x14, 0x15, 0x08,
+    0x14, 0x0A, 0x05, 0x15, 0x1A, 0x0D, 0x10, 0x01, 0x05, 0x06, 0x08, 0x09, 0x1A, 0x14, 0x09, 0x0A, 0x0F, 0x02, 0x0A,
+    0x10, 0x0A, 0x06, 0x1A, 0x0F, 0x0F, 0x10, 0x05, 0x06, 0x15, 0x04, 0x08, 0x0A, 0x06, 0x02, 0x06, 0x0A, 0x02, 0x0F,
+    0x02, 0x0A, 0x13, 0x14, 0x0A, 0x05, 0x14, 0x0A, 0x15, 0x15, 0x01, 0x06, 0x08, 0x02, 0x01, 0x04, 0x06, 0x10, 0x15,
+    0x09, 0x13, 0x02, 0x06, 0x08, 0x0A, 0x10, 0x04, 0x12, 0x14, 0x02, 0x06, 0x06, 0x13, 0x14, 0x08, 0x0E, 0x13, 0x14,
+    0x15, 0x0A, 0x0A, 0x10, 0x14, 0x15, 0x16, 0x1A, 0x02, 0x06, 0x0A, 0x06, 0x07, 0x0D, 0x02, 0x09, 0x13, 0x03, 0x0A,
+    0x10, 0x11, 0x02, 0x06, 0x0A, 0x0C, 0x08, 0x11, 0x01, 0x09, 0x0A, 0x06, 0x0D, 0x15, 0x18, 0x02, 0x04, 0x08, 0x0D,
+    0x0F, 0x15, 0x0D, 0x0F, 0x14, 0x12, 0x16, 0x18, 0x15, 0x0F, 0x05, 0x0F, 0x05, 0x02, 0x10, 0x0A, 0x06, 0x0A, 0x10,
+    0x16, 0x06, 0x08, 0x0A, 0x05, 0x06, 0x0A, 0x0E, 0x02, 0x0A, 0x10, 0x01, 0x06, 0x10, 0x15, 0x02, 0x0F, 0x15, 0x03,
+    0x02, 0x0A, 0x0F, 0x15, 0x06, 0x08, 0x0F, 0x02, 0x0F, 0x13, 0x0A, 0x06, 0x14, 0x13, 0x13, 0x09, 0x0A, 0x0F, 0x11,
+    0x05, 0x02, 0x03, 0x0A, 0x0F, 0x0C, 0x13, 0x14, 0x15, 0x0F, 0x15, 0x02, 0x06, 0x10, 0x06, 0x15, 0x02, 0x09, 0x0D,
+    0x0A, 0x0F, 0x05, 0x02, 0x05, 0x0A, 0x0D, 0x15, 0x01, 0x0A, 0x16, 0x09, 0x08, 0x0A, 0x0D, 0x17, 0x04, 0x06, 0x15,
+    0x06, 0x09, 0x0A, 0x15, 0x0D, 0x0F, 0x17, 0x01, 0x0A, 0x1A, 0x13, 0x10, 0x15, 0x10, 0x01, 0x02, 0x05, 0x06, 0x0A,
+    0x14, 0x15, 0x0F, 0x14, 0x15, 0x02, 0x06, 0x09, 0x13, 0x02, 0x08, 0x0A, 0x0D, 0x02, 0x05, 0x06, 0x08, 0x0A, 0x15,
+    0x16, 0x15, 0x06, 0x0D, 0x15, 0x09, 0x03, 0x13, 0x0F, 0x13, 0x0D, 0x10, 0x14, 0x06, 0x06, 0x06, 0x08, 0x0A, 0x10,
+    0x1A, 0x02, 0x10, 0x06, 0x11, 0x09, 0x07, 0x14, 0x13, 0x15, 0x02, 0x02, 0x06, 0x0F, 0x13, 0x14, 0x13, 0x14, 0x16,
+    0x17, 0x13, 0x02, 0x13, 0x02, 0x15, 0x16, 0x01, 0x02, 0x15, 0x06, 0x0A, 0x15, 0x0A, 0x04, 0x0A, 0x0C, 0x04, 0x06,
+    0x0A, 0x0D, 0x0E, 0x04, 0x15, 0x02, 0x10, 0x14, 0x15, 0x06, 0x13, 0x14, 0x02, 0x06, 0x0A, 0x0F, 0x15, 0x16, 0x0A,
+    0x0F, 0x14, 0x03, 0x06, 0x07, 0x15, 0x1B, 0x09, 0x04, 0x13, 0x06, 0x13, 0x02, 0x16, 0x0C, 0x02, 0x06, 0x02, 0x0A,
+    0x0A, 0x10, 0x06, 0x10, 0x02, 0x06, 0x0A, 0x13, 0x01, 0x0C, 0x11, 0x15, 0x18, 0x0A, 0x06, 0x0F, 0x03, 0x0D, 0x0F,
+    0x13, 0x02, 0x10, 0x03, 0x0F, 0x15, 0x02, 0x17, 0x09, 0x11, 0x0E, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x0A, 0x13, 0x0A,
+    0x13, 0x0A, 0x06, 0x08, 0x01, 0x15, 0x09, 0x0A, 0x10, 0x13, 0x13, 0x15, 0x0F, 0x16, 0x14, 0x15, 0x02, 0x17, 0x0D,
+    0x06, 0x0D, 0x06, 0x14, 0x0A, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x1A, 0x02, 0x06, 0x0A, 0x10, 0x02, 0x04, 0x06, 0x15,
+    0x02, 0x0F, 0x06, 0x0D, 0x06, 0x03, 0x15, 0x06, 0x14, 0x05, 0x08, 0x10, 0x04, 0x06, 0x0A, 0x02, 0x03, 0x13, 0x03,
+    0x06, 0x07, 0x0F, 0x11, 0x06, 0x10, 0x0E, 0x0F, 0x07, 0x0F, 0x15, 0x06, 0x0A, 0x13, 0x06, 0x05, 0x06, 0x15, 0x0A,
+    0x03, 0x13, 0x0D, 0x0F, 0x0A, 0x0D, 0x02, 0x06, 0x07, 0x0D, 0x02, 0x05, 0x02, 0x06, 0x0A, 0x10, 0x0D, 0x13, 0x06,
+    0x0D, 0x04, 0x10, 0x15, 0x13, 0x04, 0x08, 0x14, 0x02, 0x15, 0x13, 0x15, 0x0F, 0x10, 0x13, 0x06, 0x14, 0x15, 0x1A,
+    0x0A, 0x10, 0x0A, 0x0F, 0x03, 0x06, 0x06, 0x07, 0x06, 0x08, 0x15, 0x0E, 0x10, 0x15, 0x06, 0x0F, 0x14, 0x06, 0x0F,
+    0x14, 0x06, 0x13, 0x14, 0x15, 0x0A, 0x02, 0x04, 0x05, 0x07, 0x08, 0x0D, 0x0F, 0x10, 0x14, 0x15, 0x17, 0x0A, 0x08,
+    0x0F, 0x13, 0x0D, 0x03, 0x0E, 0x0F, 0x14, 0x09, 0x0D, 0x15, 0x06, 0x0D, 0x04, 0x0F, 0x13, 0x15, 0x02, 0x04, 0x05,
+    0x0F, 0x06, 0x08, 0x0F, 0x0A, 0x13, 0x04, 0x0F, 0x0A, 0x10, 0x0F, 0x14, 0x16, 0x04, 0x10, 0x14, 0x16, 0x06, 0x05,
+    0x0E, 0x13, 0x15, 0x16, 0x11, 0x16, 0x06, 0x0A, 0x0E, 0x02, 0x06, 0x0A, 0x0A, 0x05, 0x15, 0x05, 0x13, 0x02, 0x06,
+    0x0F, 0x14, 0x15, 0x0F, 0x14, 0x01, 0x08, 0x0D, 0x0F, 0x02, 0x0A, 0x14, 0x18, 0x16, 0x02, 0x04, 0x0D, 0x0F, 0x10,
+    0x15, 0x16, 0x0A, 0x06, 0x07, 0x16, 0x06, 0x09, 0x06, 0x15, 0x09, 0x0A, 0x1A, 0x0E, 0x0D, 0x06, 0x10, 0x13, 0x06,
+    0x15, 0x16, 0x02, 0x09, 0x10, 0x02, 0x0A, 0x0F, 0x0D, 0x13, 0x14, 0x06, 0x0A, 0x04, 0x07, 0x14, 0x14, 0x02, 0x0D,
+    0x09, 0x15, 0x04, 0x05, 0x0F, 0x13, 0x02, 0x14, 0x15, 0x0D, 0x06, 0x0D, 0x14, 0x0A, 0x05, 0x02, 0x06, 0x15, 0x02,
+    0x0F, 0x0E, 0x02, 0x06, 0x15, 0x1A, 0x16, 0x02, 0x05, 0x06, 0x0A, 0x06, 0x09, 0x13, 0x13, 0x06, 0x0A, 0x05, 0x17,
+    0x02, 0x0A, 0x02, 0x04, 0x15, 0x0F, 0x02, 0x0A, 0x0E, 0x0F, 0x10, 0x15, 0x16, 0x17, 0x06, 0x0A, 0x13, 0x0F, 0x13,
+    0x14, 0x04, 0x06, 0x0D, 0x0F, 0x14, 0x1B, 0x03, 0x0F, 0x13, 0x0F, 0x02, 0x0A, 0x1A, 0x02, 0x06, 0x0A, 0x04, 0x0F,
+    0x13, 0x10, 0x01, 0x05, 0x10, 0x0F, 0x09, 0x16, 0x0F, 0x14, 0x02, 0x04, 0x06, 0x08, 0x0F, 0x0A, 0x0E, 0x01, 0x0E,
+    0x15, 0x0F, 0x06, 0x1A, 0x0A, 0x1A, 0x14, 0x02, 0x0F, 0x13, 0x05, 0x0D, 0x0F, 0x13, 0x15, 0x14, 0x1A, 0x04, 0x06,
+    0x07, 0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x17, 0x06, 0x0F, 0x14, 0x04, 0x07, 0x08, 0x0D, 0x14, 0x15, 0x16, 0x03,
+    0x03, 0x0E, 0x0E, 0x10, 0x13, 0x06, 0x04, 0x13, 0x06, 0x13, 0x15, 0x0A, 0x14, 0x17, 0x01, 0x13, 0x15, 0x0F, 0x17,
+    0x0A, 0x10, 0x09, 0x0D, 0x0A, 0x07, 0x15, 0x10, 0x06, 0x0A, 0x10, 0x06, 0x08, 0x09, 0x0A, 0x10, 0x13, 0x06, 0x09,
+    0x04, 0x06, 0x0A, 0x0A, 0x15, 0x02, 0x06, 0x0A, 0x03, 0x08, 0x07, 0x0F, 0x0F, 0x02, 0x06, 0x03, 0x15, 0x0E, 0x0D,
+    0x02, 0x06, 0x0F, 0x0D, 0x0F, 0x13, 0x17, 0x18, 0x13, 0x0A, 0x10, 0x13, 0x15, 0x06, 0x0A, 0x02, 0x06, 0x0A, 0x1A,
+    0x0A, 0x15, 0x0A, 0x16, 0x15, 0x0A, 0x10, 0x16, 0x0A, 0x10, 0x16, 0x01, 0x11, 0x14, 0x15, 0x06, 0x0A, 0x13, 0x15,
+    0x02, 0x06, 0x0A, 0x10, 0x09, 0x13, 0x15, 0x04, 0x0F, 0x14, 0x15, 0x0F, 0x0D, 0x03, 0x08, 0x0D, 0x02, 0x02, 0x06,
+    0x0A, 0x10, 0x06, 0x0F, 0x13, 0x15, 0x02, 0x0A, 0x0A, 0x02, 0x0A, 0x10, 0x11, 0x02, 0x05, 0x06, 0x08, 0x09, 0x0D,
+    0x01, 0x04, 0x09, 0x11, 0x02, 0x06, 0x0A, 0x16, 0x06, 0x0A, 0x10, 0x15, 0x10, 0x06, 0x0A, 0x02, 0x01, 0x05, 0x12,
+    0x08, 0x14, 0x04, 0x0F, 0x13, 0x0F, 0x10, 0x15, 0x13, 0x0D, 0x13, 0x15, 0x1A, 0x04, 0x14, 0x15, 0x17, 0x16, 0x0D,
+    0x10, 0x13, 0x0D, 0x11, 0x06, 0x0A, 0x06, 0x06, 0x06, 0x0A, 0x11, 0x02, 0x06, 0x0A, 0x15, 0x0E, 0x15, 0x06, 0x0A,
+    0x0A, 0x10, 0x11, 0x14, 0x09, 0x13, 0x1A, 0x02, 0x06, 0x16, 0x02, 0x0F, 0x13, 0x15, 0x0F, 0x04, 0x07, 0x10, 0x14,
+    0x10, 0x17, 0x0F, 0x14, 0x14, 0x15, 0x04, 0x13, 0x14, 0x17, 0x02, 0x03, 0x0F, 0x04, 0x08, 0x03, 0x0F, 0x10, 0x10,
+    0x03, 0x05, 0x06, 0x08, 0x0D, 0x14, 0x17, 0x06, 0x0A, 0x10, 0x09, 0x0D, 0x0F, 0x0D, 0x0F, 0x11, 0x0C, 0x15, 0x04,
+    0x0A, 0x0A, 0x0D, 0x0F, 0x13, 0x14, 0x1A, 0x04, 0x17, 0x08, 0x04, 0x0C, 0x13, 0x15, 0x02, 0x06, 0x0E, 0x10, 0x15,
+    0x04, 0x05, 0x02, 0x02, 0x0A, 0x16, 0x10, 0x0F, 0x11, 0x15, 0x17, 0x05, 0x0A, 0x14, 0x0A, 0x10, 0x13, 0x06, 0x0F,
+    0x16, 0x06, 0x0A, 0x07, 0x11, 0x16, 0x02, 0x15, 0x14, 0x18, 0x10, 0x15, 0x06, 0x0D, 0x13, 0x06, 0x07, 0x17, 0x02,
+    0x06, 0x0A, 0x10, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x15, 0x02, 0x15, 0x01, 0x0D, 0x10, 0x17, 0x09, 0x15, 0x0E,
+    0x06, 0x0A, 0x13, 0x17, 0x0F, 0x10, 0x11, 0x17, 0x06, 0x0D, 0x0F, 0x13, 0x04, 0x06, 0x0A, 0x0F, 0x06, 0x1A, 0x02,
+    0x06, 0x08, 0x0F, 0x02, 0x06, 0x0A, 0x15, 0x0F, 0x14, 0x15, 0x15, 0x17, 0x0D, 0x0F, 0x0D, 0x0F, 0x15, 0x0D, 0x06,
+    0x15, 0x02, 0x02, 0x05, 0x0A, 0x16, 0x17, 0x01, 0x02, 0x08, 0x09, 0x04, 0x05, 0x0A, 0x04, 0x0A, 0x0F, 0x04, 0x0F,
+    0x10, 0x13, 0x06, 0x10, 0x04, 0x0D, 0x0F, 0x10, 0x1A, 0x0C, 0x0F, 0x13, 0x15, 0x02, 0x0A, 0x04, 0x14, 0x0D, 0x0F,
+    0x14, 0x15, 0x02, 0x02, 0x06, 0x08, 0x0D, 0x0A, 0x06, 0x13, 0x08, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x15, 0x05, 0x13,
+    0x18, 0x06, 0x01, 0x02, 0x04, 0x06, 0x07, 0x0F, 0x13, 0x06, 0x04, 0x0E, 0x0F, 0x11, 0x13, 0x02, 0x0A, 0x1A, 0x04,
+    0x11, 0x0D, 0x0D, 0x14, 0x15, 0x0A, 0x06, 0x0E, 0x04, 0x10, 0x0A, 0x09, 0x0D, 0x10, 0x0A, 0x10, 0x10, 0x0D, 0x02,
+    0x06, 0x0A, 0x0C, 0x0D, 0x10, 0x0A, 0x10, 0x05, 0x15, 0x02, 0x06, 0x0D, 0x02, 0x04, 0x06, 0x0A, 0x13, 0x06, 0x1A,
+    0x0A, 0x16, 0x0F, 0x0A, 0x04, 0x06, 0x0A, 0x04, 0x05, 0x15, 0x06, 0x15, 0x0A, 0x06, 0x0A, 0x01, 0x06, 0x0A, 0x14,
+    0x02, 0x02, 0x04, 0x05, 0x06, 0x15, 0x06, 0x04, 0x05, 0x08, 0x0A, 0x0F, 0x17, 0x01, 0x14, 0x09, 0x0D, 0x0F, 0x02,
+    0x0A, 0x15, 0x04, 0x0D, 0x0F, 0x05, 0x08, 0x0C, 0x10, 0x13, 0x0D, 0x14, 0x03, 0x0F, 0x15, 0x0C, 0x10, 0x16, 0x0A,
+    0x0F, 0x1A, 0x16, 0x0D, 0x11, 0x16, 0x02, 0x06, 0x0A, 0x10, 0x04, 0x0F, 0x02, 0x06, 0x0E, 0x10, 0x11, 0x15, 0x0D,
+    0x02, 0x02, 0x06, 0x0F, 0x01, 0x05, 0x14, 0x15, 0x06, 0x13, 0x10, 0x13, 0x04, 0x10, 0x02, 0x03, 0x1A, 0x02, 0x10,
+    0x1A, 0x02, 0x0A, 0x0A, 0x13, 0x15, 0x02, 0x03, 0x04, 0x0A, 0x14, 0x17, 0x02, 0x07, 0x0E, 0x02, 0x04, 0x0E, 0x17,
+    0x07, 0x0D, 0x0E, 0x0F, 0x11, 0x14, 0x17, 0x0A, 0x14, 0x09, 0x14, 0x0A, 0x13, 0x0A, 0x0A, 0x01, 0x06, 0x0A, 0x0F,
+    0x10, 0x1A, 0x14, 0x02, 0x06, 0x09, 0x13, 0x02, 0x0A, 0x02, 0x05, 0x0A, 0x15, 0x0D, 0x13, 0x0F, 0x06, 0x03, 0x15,
+    0x06, 0x13, 0x14, 0x17, 0x04, 0x06, 0x14, 0x15, 0x0F, 0x0A, 0x0E, 0x06, 0x14, 0x15, 0x0A, 0x06, 0x0F, 0x0A, 0x08,
+    0x0E, 0x02, 0x06, 0x03, 0x15, 0x09, 0x06, 0x0F, 0x0A, 0x02, 0x0F, 0x14, 0x02, 0x0A, 0x06, 0x0A, 0x13, 0x16, 0x0D,
+    0x03, 0x0A, 0x0D, 0x0F, 0x13, 0x15, 0x13, 0x0E, 0x0F, 0x14, 0x17, 0x18, 0x02, 0x06, 0x14, 0x13, 0x02, 0x0F, 0x10,
+    0x0A, 0x16, 0x01, 0x08, 0x0D, 0x14, 0x06, 0x02, 0x06, 0x13, 0x02, 0x07, 0x0F, 0x10, 0x15, 0x1B, 0x0A, 0x10, 0x14,
+    0x06, 0x0A, 0x06, 0x06, 0x09, 0x0A, 0x05, 0x0F, 0x11, 0x0A, 0x02, 0x13, 0x02, 0x04, 0x0A, 0x0D, 0x06, 0x13, 0x13,
+    0x03, 0x15, 0x01, 0x0D, 0x0F, 0x0D, 0x0F, 0x10, 0x14, 0x1B, 0x07, 0x08, 0x0E, 0x0F, 0x16, 0x0A, 0x16, 0x06, 0x16,
+    0x0A, 0x10, 0x16, 0x10, 0x0A, 0x0A, 0x0A, 0x0A, 0x05, 0x01, 0x0D, 0x10, 0x1A, 0x10, 0x16, 0x05, 0x06, 0x0A, 0x0E,
+    0x14, 0x15, 0x01, 0x15, 0x06, 0x1A, 0x0D, 0x0F, 0x06, 0x0A, 0x0F, 0x0A, 0x02, 0x04, 0x05, 0x08, 0x0D, 0x13, 0x16,
+    0x10, 0x0A, 0x10, 0x16, 0x0A, 0x13, 0x1A, 0x0A, 0x04, 0x13, 0x02, 0x06, 0x15, 0x17, 0x0A, 0x02, 0x0A, 0x1A, 0x02,
+    0x06, 0x0D, 0x06, 0x10, 0x15, 0x01, 0x15, 0x15, 0x06, 0x06, 0x13, 0x15, 0x0F, 0x0C, 0x15, 0x17, 0x0D, 0x15, 0x06,
+    0x0D, 0x05, 0x08, 0x06, 0x09, 0x14, 0x0F, 0x06, 0x06, 0x11, 0x15, 0x06, 0x06, 0x10, 0x16, 0x0A, 0x10, 0x0D, 0x0A,
+    0x06, 0x0A, 0x0F, 0x04, 0x05, 0x0A, 0x13, 0x06, 0x0E, 0x15, 0x07, 0x15, 0x02, 0x10, 0x15, 0x02, 0x09, 0x04, 0x06,
+    0x14, 0x05, 0x13, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x10, 0x14, 0x02, 0x13, 0x13, 0x0A, 0x04, 0x10, 0x0F, 0x0D, 0x09,
+    0x06, 0x15, 0x0E, 0x06, 0x0A, 0x0A, 0x1A, 0x06, 0x0E, 0x02, 0x06, 0x02, 0x0E, 0x15, 0x15, 0x11, 0x04, 0x02, 0x10,
+    0x02, 0x0D, 0x13, 0x08, 0x0F, 0x10, 0x02, 0x0A, 0x04, 0x15, 0x17, 0x03, 0x15, 0x0A, 0x0E, 0x0E, 0x0A, 0x0A, 0x1A,
+    0x06, 0x13, 0x0E, 0x10, 0x15, 0x08, 0x0E, 0x15, 0x05, 0x0C, 0x10, 0x02, 0x10, 0x13, 0x06, 0x10, 0x0D, 0x0A, 0x0A,
+    0x15, 0x0F, 0x15, 0x1A, 0x06, 0x09, 0x06, 0x04, 0x02, 0x02, 0x10, 0x02, 0x15, 0x02, 0x04, 0x02, 0x06, 0x0A, 0x06,
+    0x15, 0x06, 0x10, 0x02, 0x07, 0x15, 0x06, 0x06, 0x15, 0x0D, 0x02, 0x06, 0x0A, 0x0F, 0x1A, 0x15, 0x02, 0x0E, 0x15,
+    0x0A, 0x06, 0x04, 0x0A, 0x15, 0x16, 0x15, 0x05, 0x06, 0x07, 0x0D, 0x0A, 0x0A, 0x08, 0x0A, 0x0F, 0x03, 0x06, 0x06,
+    0x02, 0x10, 0x08, 0x0C, 0x02, 0x0A, 0x10, 0x14, 0x03, 0x15, 0x06, 0x06, 0x13, 0x05, 0x02, 0x02, 0x0D, 0x0A, 0x05,
+    0x02, 0x15, 0x0A, 0x08, 0x0D, 0x05, 0x10, 0x16, 0x15, 0x03, 0x07, 0x0F, 0x01, 0x02, 0x13, 0x0F, 0x06, 0x14, 0x0D,
+    0x0A, 0x13, 0x0F, 0x0F, 0x05, 0x15, 0x01, 0x17, 0x04, 0x01, 0x15, 0x02, 0x04, 0x0A, 0x10, 0x15, 0x02, 0x1A, 0x10,
+    0x0A, 0x0F, 0x06, 0x1A, 0x04, 0x0A, 0x0A, 0x14, 0x14, 0x18, 0x15, 0x06, 0x14, 0x06, 0x0A, 0x06, 0x09, 0x0A, 0x1B,
+    0x04, 0x09, 0x10, 0x13, 0x10, 0x13, 0x0D, 0x05, 0x06, 0x0F, 0x13, 0x03, 0x10, 0x13, 0x0D, 0x02, 0x16, 0x02, 0x0A,
+    0x15, 0x14, 0x15, 0x06, 0x0A, 0x06, 0x08, 0x0A, 0x0D, 0x02, 0x06, 0x0F, 0x14, 0x15, 0x14, 0x0D, 0x0F, 0x15, 0x02,
+    0x0A, 0x0F, 0x15, 0x01, 0x0F, 0x02, 0x11, 0x0D, 0x10, 0x09, 0x10, 0x01, 0x02, 0x0F, 0x15, 0x0E, 0x0F, 0x13, 0x0E,
+    0x0F, 0x16, 0x0A, 0x11, 0x08, 0x14, 0x02, 0x15, 0x07, 0x03, 0x0F, 0x10, 0x02, 0x0F, 0x1A, 0x13, 0x16, 0x13, 0x06,
+    0x06, 0x02, 0x0A, 0x02, 0x0F, 0x0A, 0x1A, 0x02, 0x08, 0x13, 0x1B, 0x06, 0x07, 0x1B, 0x02, 0x13, 0x15, 0x13, 0x03,
+    0x09, 0x10, 0x17, 0x02, 0x05, 0x09, 0x11, 0x05, 0x05, 0x15, 0x04, 0x0A, 0x15, 0x10, 0x0D, 0x05, 0x09, 0x12, 0x06,
+    0x0A, 0x06, 0x06, 0x0A, 0x05, 0x10, 0x06, 0x0F, 0x0E, 0x0F, 0x15, 0x02, 0x0A, 0x04, 0x14, 0x1B, 0x1A, 0x13, 0x0E,
+    0x06, 0x0A, 0x14, 0x17, 0x0D, 0x11, 0x15, 0x0F, 0x0E, 0x0A, 0x0A, 0x11, 0x10, 0x0A, 0x06, 0x01, 0x14, 0x17, 0x06,
+    0x0A, 0x16, 0x04, 0x13, 0x15, 0x0E, 0x01, 0x04, 0x02, 0x0A, 0x1B, 0x02, 0x06, 0x13, 0x04, 0x13, 0x13, 0x10, 0x04,
+    0x0F, 0x15, 0x15, 0x01, 0x0A, 0x15, 0x02, 0x0A, 0x10, 0x04, 0x0D, 0x10, 0x06, 0x08, 0x15, 0x16, 0x0A, 0x0E, 0x1A,
+    0x0A, 0x16, 0x03, 0x0F, 0x02, 0x0A, 0x06, 0x17, 0x0F, 0x03, 0x17, 0x14, 0x15, 0x0F, 0x0F, 0x0D, 0x02, 0x0A, 0x0E,
+    0x0F, 0x06, 0x12, 0x04, 0x0D, 0x0F, 0x13, 0x14, 0x13, 0x0A, 0x0A, 0x04, 0x0A, 0x13, 0x04, 0x0D, 0x0A, 0x0E, 0x13,
+    0x15, 0x15, 0x01, 0x1B, 0x0F, 0x13, 0x0A, 0x05, 0x01, 0x14, 0x13, 0x1B, 0x15, 0x13, 0x10, 0x13, 0x02, 0x15, 0x0D,
+    0x06, 0x0D, 0x01, 0x13, 0x01, 0x14, 0x06, 0x10, 0x06, 0x13, 0x13, 0x16, 0x13, 0x06, 0x14, 0x04, 0x0D, 0x06, 0x0F,
+    0x0A, 0x07, 0x0F, 0x01, 0x14, 0x04, 0x14, 0x14, 0x0A, 0x1A, 0x06, 0x0E, 0x14, 0x0E, 0x11, 0x04, 0x02, 0x10, 0x0E,
+    0x0F, 0x02, 0x02, 0x0A, 0x10, 0x06, 0x0A, 0x06, 0x0A, 0x06, 0x06, 0x08, 0x15, 0x0A, 0x05, 0x0A, 0x02, 0x13, 0x02,
+    0x06, 0x01, 0x02, 0x13, 0x0A, 0x08, 0x09, 0x0A, 0x03, 0x01, 0x02, 0x02, 0x13, 0x06, 0x0A, 0x09, 0x14, 0x1B, 0x0A,
+    0x02, 0x10, 0x15, 0x06, 0x04, 0x19, 0x10, 0x0A, 0x15, 0x13, 0x14, 0x09, 0x08, 0x06, 0x02, 0x13, 0x0D, 0x04, 0x15,
+    0x0A, 0x06, 0x04, 0x05, 0x09, 0x03, 0x03, 0x02, 0x0D, 0x14, 0x05, 0x0A, 0x06, 0x0D, 0x10, 0x0F, 0x01, 0x10, 0x02,
+    0x04, 0x06, 0x15, 0x14, 0x15, 0x0F, 0x0C, 0x0F, 0x13, 0x06, 0x02, 0x14, 0x15, 0x1B, 0x15, 0x13, 0x16, 0x06, 0x0F,
+    0x13, 0x04, 0x15, 0x17, 0x0F, 0x06, 0x0F, 0x15, 0x0F, 0x16, 0x02, 0x04, 0x13, 0x13, 0x06, 0x03, 0x0F, 0x08, 0x0E,
+    0x0F, 0x10, 0x16, 0x13, 0x05, 0x05, 0x0D, 0x06, 0x10, 0x0A, 0x02, 0x04, 0x07, 0x08, 0x14, 0x0A, 0x0D, 0x15, 0x0D,
+    0x10, 0x08, 0x0A, 0x03, 0x08, 0x06, 0x14, 0x09, 0x06, 0x15, 0x09, 0x16, 0x06, 0x0A, 0x01, 0x0D, 0x0F, 0x15, 0x0F,
+    0x13, 0x02, 0x06, 0x0D, 0x15, 0x0A, 0x0A, 0x06, 0x06, 0x14, 0x06, 0x06, 0x13, 0x06, 0x15, 0x1A, 0x15, 0x02, 0x04,
+    0x0F, 0x15, 0x14, 0x1B, 0x17, 0x0F, 0x14, 0x1B, 0x15, 0x1A, 0x1B, 0x04, 0x15, 0x06, 0x02, 0x01, 0x0F, 0x06, 0x0A,
+    0x05, 0x09, 0x0A, 0x0A, 0x15, 0x10, 0x01, 0x06, 0x10, 0x1B, 0x1B, 0x16, 0x02, 0x09, 0x14, 0x17, 0x05, 0x0F, 0x14,
+    0x0E, 0x0A, 0x1A, 0x01, 0x06, 0x10, 0x1B, 0x06, 0x13, 0x0F, 0x14, 0x06, 0x06, 0x06, 0x06, 0x09, 0x0F, 0x15, 0x0A,
+    0x1A, 0x15, 0x11, 0x02, 0x02, 0x16, 0x05, 0x13, 0x06, 0x0D, 0x0D, 0x14, 0x06, 0x0A, 0x1B, 0x1B, 0x13, 0x15, 0x04,
+    0x14, 0x06, 0x0F, 0x06, 0x0D, 0x0A, 0x10, 0x16, 0x0F, 0x06, 0x15, 0x15, 0x15, 0x17, 0x0A, 0x02, 0x15, 0x01, 0x06,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x0D, 0x0F, 0x13, 0x14, 0x16, 0x0A, 0x06, 0x10, 0x0F, 0x01, 0x02, 0x0A,
+    0x15, 0x06, 0x02, 0x15, 0x03, 0x06, 0x1A, 0x15, 0x02, 0x06, 0x0A, 0x05, 0x02, 0x0D, 0x13, 0x0A, 0x02, 0x14, 0x02,
+    0x0F, 0x0A, 0x06, 0x0A, 0x1A, 0x13, 0x15, 0x13, 0x02, 0x07, 0x05, 0x15, 0x06, 0x06, 0x16, 0x0F, 0x01, 0x17, 0x0F,
+    0x0F, 0x11, 0x0A, 0x0F, 0x06, 0x0D, 0x0F, 0x14, 0x01, 0x1A, 0x02, 0x0A, 0x02, 0x0A, 0x0A, 0x0D, 0x02, 0x0C, 0x0D,
+    0x06, 0x0E, 0x0E, 0x15, 0x0D, 0x01, 0x01, 0x14, 0x01, 0x06, 0x10, 0x15, 0x02, 0x0F, 0x0E, 0x0A, 0x1A, 0x0F, 0x01,
+    0x06, 0x14, 0x15, 0x02, 0x04, 0x06, 0x06, 0x0D, 0x15, 0x06, 0x06, 0x0F, 0x0D, 0x17, 0x0A, 0x0D, 0x06, 0x0A, 0x06,
+    0x02, 0x02, 0x0F, 0x15, 0x01, 0x0A, 0x03, 0x10, 0x01, 0x13, 0x0A, 0x10, 0x10, 0x13, 0x01, 0x13, 0x13, 0x15, 0x02,
+    0x0D, 0x02, 0x06, 0x10, 0x04, 0x13, 0x02, 0x09, 0x16, 0x15, 0x08, 0x06, 0x06, 0x0D, 0x15, 0x14, 0x04, 0x13, 0x1B,
+    0x01, 0x15, 0x06, 0x16, 0x15, 0x11, 0x05, 0x08, 0x06, 0x02, 0x0D, 0x14, 0x02, 0x0A, 0x01, 0x0A, 0x06, 0x06, 0x0E,
+    0x1A, 0x0A, 0x0F, 0x11, 0x08, 0x0F, 0x0A, 0x1A, 0x02, 0x14, 0x1B, 0x14, 0x13, 0x0A, 0x0F, 0x1B, 0x1A, 0x06, 0x14,
+    0x1B, 0x08, 0x02, 0x04, 0x06, 0x10, 0x02, 0x0F, 0x04, 0x06, 0x16, 0x06, 0x02, 0x0A, 0x0D, 0x0A, 0x0A, 0x1A, 0x03,
+    0x02, 0x06, 0x15, 0x02, 0x0A, 0x06, 0x0D, 0x14, 0x15, 0x13, 0x0A, 0x13, 0x1A, 0x02, 0x02, 0x06, 0x04, 0x14, 0x15,
+    0x1A, 0x06, 0x02, 0x14, 0x1B, 0x04, 0x06, 0x0D, 0x14, 0x01, 0x01, 0x0F, 0x1A, 0x06, 0x0A, 0x02, 0x0A, 0x14, 0x14,
+    0x0A, 0x0A, 0x14, 0x04, 0x10, 0x13, 0x0A, 0x13, 0x02, 0x15, 0x0A, 0x15, 0x09, 0x0A, 0x0D, 0x0E, 0x06, 0x01, 0x10,
+    0x14, 0x0D, 0x14, 0x13, 0x15, 0x04, 0x13, 0x04, 0x15, 0x1B, 0x03, 0x13, 0x0A, 0x04, 0x0A, 0x06, 0x06, 0x0A, 0x13,
+    0x01, 0x04, 0x1B, 0x01, 0x02, 0x10, 0x13, 0x10, 0x11, 0x14, 0x0D, 0x06, 0x13, 0x0A, 0x08, 0x0D, 0x0F, 0x04, 0x14,
+    0x1B, 0x08, 0x12, 0x14, 0x1B, 0x0D, 0x03, 0x13, 0x0D, 0x0E, 0x04, 0x0A, 0x0A, 0x10, 0x03, 0x14, 0x13, 0x06, 0x08,
+    0x11, 0x0D, 0x06, 0x06, 0x14, 0x06, 0x08, 0x08, 0x14, 0x15, 0x0E, 0x04, 0x15, 0x15, 0x13, 0x02, 0x06, 0x05, 0x0D,
+    0x0A, 0x15, 0x15, 0x06, 0x15, 0x0A, 0x10, 0x06, 0x1B, 0x14, 0x13, 0x15, 0x06, 0x0F, 0x06, 0x13, 0x15, 0x14, 0x04,
+    0x15, 0x06, 0x01, 0x10, 0x08, 0x01, 0x09, 0x06, 0x0A, 0x06, 0x0A, 0x10, 0x06, 0x0A, 0x09, 0x02, 0x14, 0x13, 0x01,
+    0x02, 0x0A, 0x0F, 0x06, 0x10, 0x0D, 0x15, 0x1A, 0x0A, 0x0A, 0x1A, 0x0E, 0x10, 0x0A, 0x0F, 0x07, 0x02, 0x0F, 0x13,
+    0x08, 0x0E, 0x0A, 0x0A, 0x08, 0x0D, 0x09, 0x15, 0x02, 0x1A, 0x08, 0x0F, 0x0A, 0x10, 0x13, 0x1A, 0x17, 0x11, 0x0A,
+    0x10, 0x1A, 0x06, 0x15, 0x0D, 0x15, 0x06, 0x01, 0x14, 0x15, 0x10, 0x14, 0x01, 0x02, 0x06, 0x05, 0x0A, 0x06, 0x0F,
+    0x14, 0x15, 0x0F, 0x0A, 0x13, 0x15, 0x0A, 0x0F, 0x15, 0x02, 0x0D, 0x1A, 0x03, 0x08, 0x0D, 0x0E, 0x0A, 0x0D, 0x14,
+    0x13, 0x0A, 0x1A, 0x0A, 0x0D, 0x02, 0x04, 0x06, 0x0F, 0x09, 0x01, 0x03, 0x08, 0x14, 0x02, 0x06, 0x0A, 0x0F, 0x1B,
+    0x0A, 0x10, 0x01, 0x02, 0x08, 0x15, 0x06, 0x0A, 0x05, 0x06, 0x02, 0x02, 0x15, 0x02, 0x13, 0x02, 0x03, 0x04, 0x15,
+    0x01, 0x06, 0x11, 0x15, 0x02, 0x0A, 0x06, 0x0A, 0x10, 0x0E, 0x02, 0x02, 0x02, 0x06, 0x06, 0x11, 0x14, 0x06, 0x15,
+    0x10, 0x02, 0x06, 0x0A, 0x0A, 0x06, 0x06, 0x05, 0x02, 0x0D, 0x14, 0x13, 0x06, 0x0A, 0x0F, 0x0A, 0x15, 0x02, 0x0D,
+    0x06, 0x16, 0x08, 0x10, 0x0A, 0x0F, 0x15, 0x16, 0x10, 0x06, 0x02, 0x13, 0x1A, 0x07, 0x0D, 0x10, 0x0A, 0x0D, 0x06,
+    0x06, 0x08, 0x13, 0x13, 0x08, 0x13, 0x02, 0x11, 0x0D, 0x0E, 0x06, 0x02, 0x14, 0x15, 0x04, 0x13, 0x14, 0x02, 0x06,
+    0x0F, 0x14, 0x0A, 0x0A, 0x02, 0x13, 0x13, 0x1B, 0x0A, 0x0A, 0x0D, 0x0D, 0x13, 0x0D, 0x0D, 0x08, 0x01, 0x14, 0x05,
+    0x06, 0x13, 0x04, 0x15, 0x0F, 0x1B, 0x0F, 0x06, 0x01, 0x06, 0x0A, 0x03, 0x05, 0x13, 0x04, 0x13, 0x0D, 0x15, 0x0D,
+    0x0F, 0x16, 0x16, 0x09, 0x14, 0x08, 0x15, 0x02, 0x0A, 0x0D, 0x13, 0x01, 0x14, 0x15, 0x0D, 0x14, 0x02, 0x0D, 0x04,
+    0x06, 0x06, 0x10, 0x0D, 0x0D, 0x15, 0x01, 0x08, 0x15, 0x0A, 0x13, 0x01, 0x02, 0x09, 0x05, 0x16, 0x13, 0x0A, 0x0D,
+    0x1A, 0x15, 0x16, 0x11, 0x0D, 0x1A, 0x0F, 0x0D, 0x0A, 0x01, 0x15, 0x06, 0x0A, 0x13, 0x14, 0x06, 0x13, 0x10, 0x13,
+    0x15, 0x06, 0x10, 0x15, 0x10, 0x05, 0x15, 0x1A, 0x13, 0x11, 0x09, 0x11, 0x14, 0x15, 0x0D, 0x15, 0x05, 0x0F, 0x05,
+    0x0D, 0x06, 0x10, 0x0F, 0x14, 0x05, 0x15, 0x01, 0x05, 0x14, 0x1B, 0x02, 0x01, 0x02, 0x14, 0x10, 0x06, 0x08, 0x04,
+    0x09, 0x02, 0x0D, 0x09, 0x05, 0x0E, 0x03, 0x04, 0x15, 0x0A, 0x1A, 0x06, 0x0A, 0x0A, 0x05, 0x13, 0x0A, 0x08, 0x06,
+    0x15, 0x0D, 0x15, 0x09, 0x08, 0x01, 0x15, 0x0F, 0x13, 0x0F, 0x1A, 0x0F, 0x02, 0x0A, 0x11, 0x05, 0x15, 0x15, 0x01,
+    0x0A, 0x0F, 0x10, 0x02, 0x0C, 0x08, 0x0C, 0x02, 0x06, 0x02, 0x06, 0x05, 0x15, 0x1A, 0x03, 0x05, 0x13, 0x0A, 0x0A,
+    0x13, 0x0E, 0x0F, 0x0A, 0x06, 0x0D, 0x0F, 0x10, 0x0F, 0x02, 0x0A, 0x08, 0x0F, 0x06, 0x02, 0x15, 0x13, 0x1B, 0x09,
+    0x04, 0x13, 0x14, 0x15, 0x06, 0x09, 0x0A, 0x13, 0x08, 0x13, 0x15, 0x0F, 0x14, 0x02, 0x06, 0x04, 0x06, 0x14, 0x1B,
+    0x0A, 0x01, 0x06, 0x06, 0x02, 0x14, 0x15, 0x14, 0x01, 0x02, 0x0C, 0x06, 0x0A, 0x10, 0x06, 0x06, 0x0A, 0x02, 0x04,
+    0x01, 0x10, 0x0A, 0x0D, 0x01, 0x0E, 0x06, 0x0A, 0x0F, 0x01, 0x01, 0x13, 0x02, 0x08, 0x0D, 0x15, 0x06, 0x1B, 0x04,
+    0x13, 0x09, 0x0A, 0x15, 0x15, 0x06, 0x04, 0x0A, 0x0D, 0x06, 0x0A, 0x14, 0x0A, 0x06, 0x0A, 0x0A, 0x1A, 0x09, 0x0A,
+    0x10, 0x11, 0x0A, 0x03, 0x14, 0x14, 0x02, 0x0D, 0x02, 0x0F, 0x10, 0x08, 0x01, 0x15, 0x05, 0x14, 0x1A, 0x06, 0x0D,
+    0x0F, 0x1B, 0x13, 0x0A, 0x06, 0x13, 0x08, 0x09, 0x13, 0x03, 0x14, 0x14, 0x02, 0x1A, 0x08, 0x10, 0x09, 0x03, 0x13,
+    0x14, 0x14, 0x08, 0x13, 0x03, 0x01, 0x15, 0x13, 0x0D, 0x0A, 0x0F, 0x13, 0x14, 0x06, 0x06, 0x01, 0x0F, 0x13, 0x0A,
+    0x0A, 0x06, 0x08, 0x0F, 0x02, 0x0D, 0x06, 0x06, 0x1B, 0x06, 0x17, 0x06, 0x0A, 0x0E, 0x06, 0x01, 0x0A, 0x0D, 0x0F,
+    0x14, 0x06, 0x0A, 0x06, 0x09, 0x06, 0x0A, 0x13, 0x0A, 0x01, 0x05, 0x0F, 0x14, 0x15, 0x1B, 0x15, 0x11, 0x06, 0x05,
+    0x03, 0x06, 0x13, 0x06, 0x08, 0x13, 0x0A, 0x09, 0x0F, 0x14, 0x0A, 0x06, 0x0F, 0x0F, 0x02, 0x02, 0x06, 0x15, 0x1B,
+    0x05, 0x15, 0x14, 0x05, 0x06, 0x03, 0x0D, 0x13, 0x13, 0x15, 0x02, 0x10, 0x0F, 0x01, 0x13, 0x13, 0x14, 0x06, 0x13,
+    0x10, 0x0A, 0x06, 0x03, 0x0D, 0x0D, 0x13, 0x06, 0x0A, 0x17, 0x0A, 0x09, 0x15, 0x0D, 0x13, 0x14, 0x06, 0x0E, 0x06,
+    0x0A, 0x06, 0x0A, 0x1A, 0x0F, 0x0A, 0x06, 0x13, 0x06, 0x0A, 0x0D, 0x0D, 0x13, 0x04, 0x13, 0x0A, 0x03, 0x09, 0x0E,
+    0x10, 0x0D, 0x15, 0x14, 0x02, 0x0E, 0x10, 0x0F, 0x15, 0x02, 0x04, 0x05, 0x11, 0x13, 0x14, 0x17, 0x06, 0x0F, 0x10,
+    0x0D, 0x14, 0x08, 0x0F, 0x08, 0x16, 0x15, 0x13, 0x13, 0x06, 0x13, 0x03, 0x04, 0x1B, 0x09, 0x0A, 0x14, 0x02, 0x14,
+    0x01, 0x06, 0x0D, 0x02, 0x14, 0x15, 0x10, 0x17, 0x0F, 0x15, 0x06, 0x15, 0x08, 0x15, 0x02, 0x10, 0x02, 0x1B, 0x01,
+    0x0D, 0x13, 0x13, 0x08, 0x0A, 0x03, 0x06, 0x13, 0x13, 0x14, 0x0F, 0x01, 0x05, 0x0F, 0x13, 0x08, 0x02, 0x03, 0x04,
+    0x14, 0x10, 0x01, 0x14, 0x01, 0x15, 0x0F, 0x0A, 0x04, 0x06, 0x05, 0x10, 0x06, 0x14, 0x04, 0x06, 0x01, 0x13, 0x0F,
+    0x0A, 0x01, 0x14, 0x07, 0x1B, 0x05, 0x02, 0x10, 0x09, 0x05, 0x0F, 0x0D, 0x02, 0x06, 0x05, 0x0A, 0x0D, 0x14, 0x02,
+    0x04, 0x06, 0x06, 0x0F, 0x15, 0x14, 0x01, 0x17, 0x02, 0x03, 0x14, 0x02, 0x10, 0x13, 0x06, 0x14, 0x11, 0x15, 0x11,
+    0x02, 0x01, 0x06, 0x01, 0x01, 0x14, 0x01, 0x14, 0x02, 0x0F, 0x02, 0x06, 0x0A, 0x02, 0x04, 0x06, 0x10, 0x17, 0x05,
+    0x02, 0x10, 0x06, 0x0F, 0x05, 0x0D, 0x13, 0x02, 0x01, 0x01, 0x0F, 0x14, 0x14, 0x02, 0x01, 0x06, 0x0A, 0x1A, 0x01,
+    0x13, 0x13, 0x0F, 0x13, 0x14, 0x02, 0x0A, 0x13, 0x01, 0x1B, 0x09, 0x06, 0x04, 0x15, 0x06, 0x02, 0x02, 0x0F, 0x13,
+    0x14, 0x0F, 0x01, 0x0D, 0x10, 0x02, 0x1A, 0x14, 0x10, 0x17, 0x13, 0x0D, 0x0E, 0x13, 0x01, 0x06, 0x06, 0x08, 0x14,
+    0x0A, 0x0F, 0x14, 0x0F, 0x0A, 0x05, 0x13, 0x03, 0x05, 0x0A, 0x05, 0x01, 0x02, 0x14, 0x1B, 0x06, 0x13, 0x08, 0x02,
+    0x14, 0x0A, 0x0D, 0x05, 0x13, 0x10, 0x01, 0x10, 0x09, 0x1A, 0x01, 0x02, 0x02, 0x13, 0x0A, 0x13, 0x0F, 0x04, 0x10,
+    0x0F, 0x06, 0x02, 0x0A, 0x04, 0x0F, 0x04, 0x06, 0x02, 0x08, 0x0D, 0x0A, 0x1A, 0x01, 0x06, 0x01, 0x1A, 0x15, 0x14,
+    0x15, 0x0D, 0x0E, 0x15, 0x09, 0x0F, 0x0A, 0x15, 0x0F, 0x03, 0x15, 0x0C, 0x16, 0x01, 0x14, 0x0A, 0x15, 0x02, 0x01,
+    0x0C, 0x0C, 0x0A, 0x15, 0x14, 0x02, 0x10, 0x0A, 0x10, 0x15, 0x10, 0x0A, 0x1A, 0x1A, 0x03, 0x17, 0x0D, 0x0D, 0x0A,
+    0x02, 0x0A, 0x04, 0x01, 0x14, 0x17, 0x13, 0x0F, 0x06, 0x11, 0x10, 0x1B, 0x0E, 0x1B, 0x02, 0x06, 0x1A, 0x05, 0x04,
+    0x02, 0x0F, 0x13, 0x08, 0x01, 0x1B, 0x06, 0x01, 0x0F, 0x0A, 0x06, 0x0A, 0x17, 0x13, 0x0A, 0x08, 0x06, 0x10, 0x14,
+    0x0A, 0x10, 0x13, 0x06, 0x01, 0x04, 0x15, 0x0D, 0x06, 0x13, 0x06, 0x06, 0x04, 0x04, 0x0D, 0x15, 0x0D, 0x0F, 0x15,
+    0x0A, 0x11, 0x03, 0x13, 0x02, 0x09, 0x15, 0x04, 0x04, 0x16, 0x0D, 0x0F, 0x14, 0x15, 0x15, 0x10, 0x15, 0x04, 0x05,
+    0x0F, 0x15, 0x13, 0x14, 0x06, 0x13, 0x0A, 0x10, 0x08, 0x13, 0x14, 0x0F, 0x01, 0x06, 0x15, 0x13, 0x0D, 0x11, 0x0F,
+    0x01, 0x0A, 0x03, 0x0D, 0x03, 0x01, 0x14, 0x15, 0x16, 0x04, 0x01, 0x01, 0x14, 0x01, 0x14, 0x05, 0x09, 0x06, 0x13,
+    0x0F, 0x0A, 0x05, 0x09, 0x04, 0x18, 0x0A, 0x13, 0x0D, 0x1B, 0x05, 0x15, 0x02, 0x06, 0x09, 0x15, 0x0A, 0x0E, 0x15,
+    0x01, 0x15, 0x18, 0x0A, 0x0C, 0x1A, 0x06, 0x04, 0x1B, 0x0F, 0x10, 0x10, 0x0D, 0x14, 0x14, 0x0D, 0x10, 0x16, 0x01,
+    0x02, 0x05, 0x14, 0x0D, 0x0A, 0x03, 0x02, 0x16, 0x16, 0x05, 0x14, 0x06, 0x14, 0x0A, 0x01, 0x14, 0x09, 0x13, 0x06,
+    0x10, 0x08, 0x0A, 0x01, 0x14, 0x02, 0x15, 0x14, 0x0E, 0x04, 0x0F, 0x0F, 0x13, 0x15, 0x1B, 0x0F, 0x0F, 0x06, 0x04,
+    0x15, 0x1A, 0x0A, 0x15, 0x06, 0x10, 0x0F, 0x13, 0x14, 0x09, 0x01, 0x14, 0x02, 0x04, 0x15, 0x16, 0x06, 0x14, 0x0D,
+    0x06, 0x16, 0x13, 0x15, 0x15, 0x01, 0x01, 0x15, 0x01, 0x04, 0x08, 0x06, 0x1B, 0x02, 0x15, 0x13, 0x05, 0x17, 0x08,
+    0x1A, 0x04, 0x0F, 0x15, 0x02, 0x11, 0x16, 0x18, 0x06, 0x11, 0x0F, 0x13, 0x13, 0x10, 0x10, 0x13, 0x0D, 0x1A, 0x0A,
+    0x13, 0x02, 0x10, 0x0A, 0x13, 0x14, 0x02, 0x14, 0x0E, 0x0F, 0x10, 0x15, 0x15, 0x13, 0x15, 0x03, 0x06, 0x13, 0x06,
+    0x06, 0x10, 0x14, 0x13, 0x01, 0x06, 0x08, 0x14, 0x0A, 0x04, 0x06, 0x02, 0x15, 0x1A, 0x08, 0x02, 0x08, 0x06, 0x0A,
+    0x09, 0x0F, 0x01, 0x01, 0x0E, 0x11, 0x13, 0x04, 0x05, 0x02, 0x13, 0x13, 0x08, 0x08, 0x1A, 0x04, 0x02, 0x02, 0x14,
+    0x04, 0x14, 0x01, 0x13, 0x04, 0x0D, 0x01, 0x01, 0x0A, 0x1A, 0x01, 0x06, 0x01, 0x0F, 0x0A, 0x13, 0x14, 0x0A, 0x14,
+    0x06, 0x01, 0x1B, 0x17, 0x06, 0x15, 0x14, 0x14, 0x01, 0x0A, 0x1B, 0x13, 0x10, 0x02, 0x0A, 0x0D, 0x13, 0x13, 0x02,
+    0x15, 0x06, 0x10, 0x06, 0x0A, 0x14, 0x1A, 0x05, 0x07, 0x06, 0x14, 0x04, 0x0A, 0x0A, 0x06, 0x08, 0x16, 0x06, 0x0A,
+    0x0D, 0x0A, 0x13, 0x04, 0x03, 0x05, 0x0A, 0x18, 0x04, 0x18, 0x03, 0x09, 0x0A, 0x08, 0x15, 0x14, 0x1B, 0x13, 0x0A,
+    0x02, 0x13, 0x14, 0x06, 0x01, 0x0E, 0x06, 0x0A, 0x15, 0x0A, 0x16, 0x01, 0x0A, 0x01, 0x06, 0x13, 0x02, 0x10, 0x01,
+    0x1A, 0x03, 0x02, 0x13, 0x15, 0x10, 0x0A, 0x15, 0x10, 0x06, 0x01, 0x01, 0x13, 0x06, 0x1B, 0x15, 0x1B, 0x14, 0x15,
+    0x1A, 0x0D, 0x0F, 0x01, 0x14, 0x1B, 0x0F, 0x01, 0x02, 0x0A, 0x0E, 0x01, 0x02, 0x14, 0x14, 0x15, 0x04, 0x10, 0x08,
+    0x03,
+};
+
+constexpr uint16_t en_child_base[] = {
+    1, 178, 325, 467, 545, 579, 619, 649, 691, 746, 780, 794, 819, 872, 907, 944,
+    982, 1004, 1059, 1119, 1172, 1206, 1221, 1252, 1290, 1326, 1352, 1378, 1420, 1478, 1509, 1530,
+    1546, 1580, 1609, 1651, 1681, 1716, 1749, 1795, 1832, 1863, 1893, 1957, 1989, 2023, 2062, 2110,
+    2150, 2199, 2238, 2276, 2318, 2360, 2409, 2442, 2469, 2526, 2567, 2592, 2611, 2626, 2637, 2654,
+    2679, 2693, 2708, 2723, 2736, 2747, 2754, 2770, 2784, 2808, 2820, 2838, 2851, 2869, 2876, 2885,
+    2898, 2912, 2922, 2924, 2938, 2957, 2985, 3010, 3030, 3048, 3059, 3077, 3097, 3108, 3118, 3123,
+    3135, 3148, 3156, 3177, 3183, 3198, 3203, 3216, 3231, 3241, 3252, 3269, 3282, 3289, 3303, 3317,
+    3333, 3341, 3347, 3356, 3367, 3385, 3395, 3403, 3414, 3420, 3428, 3434, 3443, 3450, 3457, 3480,
+    3492, 3503, 3516, 3520, 3534, 3542, 3563, 3586, 3602, 3625, 3630, 3640, 3648, 3674, 3691, 3713,
+    3725, 3733, 3748, 3755, 3765, 3773, 3787, 3801, 3812, 3818, 3830, 3837, 3852, 3861, 3867, 3878,
+    3887, 3899, 3903, 3911, 3929, 3940, 3951, 3962, 3971, 3987, 3995, 4003, 4016, 4029, 4047, 4058,
+    4067, 4075, 4093, 4101, 4112, 4128, 4138, 4147, 4161, 4174, 4184, 4204, 4226, 4233, 4237, 4240,
+    4248, 4252, 4258, 4273, 4280, 4296, 4309, 4330, 4344, 4361, 4372, 4388, 4394, 4404, 4415, 4422,
+    4438, 4456, 4474, 4486, 4494, 4504, 4514, 4528, 4533, 4551, 4561, 4574, 4583, 4596, 4609, 4618,
+    4630, 4638, 4651, 4660, 4668, 4681, 4687, 4692, 4699, 4712, 4721, 4733, 4740, 4755, 4776, 4794,
+    4811, 4821, 4831, 4851, 4863, 4877, 4887, 4897, 4908, 4917, 4937, 4950, 4961, 4976, 4984, 5005,
+    5017, 5022, 5033, 5046, 5061, 5072, 5092, 5107, 5122, 5132, 5149, 5164, 5176, 5189, 5206, 5220,
+    5231, 5243, 5259, 5272, 5284, 5299, 5311, 5332, 5343, 5357, 5364, 5372, 5384, 5404, 5422, 5432,
+    5453, 5458, 5461, 5469, 5491, 5498, 5516, 5526, 5541, 5552, 5568, 5577, 5589, 5612, 5617, 5620,
+    5627, 5637, 5644, 5653, 5660, 5669, 5680, 5687, 5696, 5706, 5718, 5731, 5743, 5753, 5764, 5778,
+    5788, 5803, 5816, 5824, 5832, 5839, 5844, 5847, 5852, 5858, 5864, 5867, 5870, 5876, 5881, 5886,
+    5889, 5891, 5897, 5899, 5907, 5913, 5920, 5925, 5930, 5936, 5942, 5947, 5950, 5955, 5960, 5970,
+    5975, 5979, 5986, 5992, 5999, 6006, 6015, 6018, 6023, 6031, 6034, 6038, 6040, 6043, 6046, 6049,
+    6053, 6059, 6067, 6072, 6077, 6081, 6086, 6091, 6095, 6101, 6107, 6112, 6118, 6120, 6122, 6124,
+    6130, 6137, 6140, 6143, 6148, 6154, 6155, 6159, 6164, 6164, 6168, 6172, 6179, 6183, 6188, 6189,
+    6194, 6198, 6204, 6211, 6218, 6221, 6223, 6227, 6233, 6236, 6239, 6246, 6249, 6251, 6254, 6258,
+    6266, 6272, 6276, 6279, 6282, 6290, 6298, 6300, 6304, 6307, 6312, 6316, 6320, 6323, 6328, 6333,
+    6336, 6341, 6346, 6351, 6356, 6364, 6367, 6368, 6371, 6376, 6377, 6378, 6380, 6384, 6389, 6393,
+    6394, 6399, 6404, 6410, 6415, 6416, 6420, 6423, 6432, 6436, 6446, 6452, 6457, 6460, 6467, 6471,
+    6480, 6486, 6492, 6496, 6502, 6503, 6505, 6510, 6512, 6518, 6523, 6526, 6533, 6536, 6537, 6540,
+    6547, 6548, 6550, 6554, 6556, 6560, 6566, 6569, 6573, 6575, 6583, 6590, 6594, 6598, 6600, 6603,
+    6608, 6610, 6615, 6619, 6623, 6625, 6631, 6633, 6635, 6638, 6643, 6643, 6647, 6650, 6651, 6653,
+    6655, 6661, 6665, 6670, 6674, 6675, 6677, 6678, 6682, 6685, 6687, 6692, 6697, 6700, 6707, 6710,
+    6716, 6720, 6725, 6729, 6731, 6734, 6739, 6744, 6748, 6751, 6754, 6756, 6760, 6763, 6766, 6770,
+    6770, 6774, 6780, 6784, 6789, 6791, 6794, 6796, 6800, 6803, 6806, 6816, 6820, 6827, 6831, 6836,
+    6845, 6850, 6855, 6869, 6876, 6879, 6885, 6888, 6891, 6895, 6901, 6904, 6906, 6909, 6910, 6915,
+    6916, 6917, 6921, 6926, 6930, 6937, 6943, 6948, 6950, 6956, 6958, 6960, 6965, 6972, 6976, 6981,
+    6982, 6987, 6991, 6995, 7002, 7005, 7009, 7015, 7018, 7022, 7027, 7028, 7033, 7038, 7040, 7046,
+    7048, 7055, 7064, 7067, 7074, 7078, 7086, 7094, 7100, 7105, 7110, 7115, 7117, 7118, 7123, 7129,
+    7130, 7138, 7145, 7152, 7155, 7160, 7167, 7173, 7177, 7182, 7185, 7188, 7196, 7199, 7203, 7212,
+    7217, 7218, 7224, 7229, 7231, 7239, 7242, 7245, 7245, 7248, 7254, 7258, 7263, 7266, 7269, 7272,
+    7275, 7281, 7284, 7288, 7292, 7295, 7299, 7303, 7307, 7308, 7313, 7318, 7319, 7322, 7328, 7334,
+    7339, 7343, 7347, 7350, 7354, 7359, 7365, 7373, 7377, 7381, 7391, 7394, 7399, 7405, 7409, 7413,
+    7417, 7422, 7425, 7434, 7444, 7450, 7451, 7455, 7456, 7460, 7462, 7467, 7474, 7482, 7489, 7493,
+    7495, 7498, 7500, 7503, 7507, 7511, 7518, 7521, 7525, 7529, 7534, 7535, 7539, 7542, 7544, 7548,
+    7551, 7556, 7565, 7571, 7577, 7578, 7581, 7583, 7587, 7590, 7593, 7599, 7602, 7605, 7610, 7611,
+    7614, 7618, 7620, 7625, 7630, 7633, 7638, 7642, 7646, 7648, 7654, 7658, 7663, 7667, 7675, 7680,
+    7684, 7688, 7690, 7690, 7692, 7693, 7694, 7696, 7696, 7696, 7699, 7700, 7706, 7708, 7709, 7711,
+    7714, 7715, 7718, 7719, 7720, 7721, 7721, 7726, 7728, 7730, 7734, 7737, 7738, 7739, 7742, 7745,
+    7747, 7749, 7752, 7755, 7757, 7761, 7761, 7767, 7769, 7770, 7770, 7773, 7774, 7778, 7780, 7782,
+    7783, 7785, 7786, 7790, 7791, 7792, 7794, 7794, 7799, 7803, 7804, 7806, 7809, 7809, 7811, 7812,
+    7815, 7816, 7817, 7819, 7821, 7823, 7828, 7830, 7832, 7833, 7836, 7837, 7839, 7841, 7841, 7842,
+    7843, 7845, 7851, 7855, 7856, 7858, 7860, 7861, 7862, 7866, 7869, 7872, 7877, 7881, 7884, 7888,
+    7892, 7894, 7899, 7902, 7905, 7907, 7910, 7912, 7918, 7923, 7927, 7930, 7934, 7937, 7939, 7943,
+    7946, 7948, 7948, 7952, 7956, 7959, 7960, 7961, 7966, 7967, 7969, 7971, 7976, 7979, 7982, 7985,
+    7988, 7992, 7996, 8000, 8004, 8006, 8011, 8013, 8016, 8019, 8021, 8024, 8026, 8030, 8034, 8041,
+    8046, 8048, 8051, 8055, 8057, 8060, 8065, 8065, 8066, 8069, 8072, 8074, 8077, 8078, 8078, 8079,
+    8082, 8087, 8092, 8094, 8097, 8099, 8103, 8107, 8112, 8115, 8118, 8119, 8125, 8128, 8130, 8132,
+    8134, 8140, 8141, 8148, 8151, 8154, 8157, 8166, 8170, 8175, 8175, 8176, 8176, 8178, 8181, 8183,
+    8186, 8189, 8192, 8193, 8196, 8200, 8203, 8207, 8207, 8207, 8211, 8213, 8214, 8216, 8218, 8220,
+    8222, 8223, 8224, 8227, 8231, 8233, 8234, 8234, 8236, 8239, 8240, 8242, 8245, 8245, 8247, 8247,
+    8248, 8250, 8252, 8254, 8256, 8259, 8262, 8265, 8267, 8270, 8271, 8275, 8277, 8279, 8282, 8283,
+    8285, 8287, 8292, 8294, 8295, 8297, 8298, 8300, 8302, 8302, 8303, 8306, 8310, 8313, 8317, 8319,
+    8320, 8321, 8322, 8324, 8327, 8329, 8332, 8336, 8339, 8340, 8341, 8342, 8344, 8347, 8352, 8353,
+    8355, 8358, 8361, 8362, 8364, 8365, 8367, 8370, 8371, 8373, 8374, 8375, 8377, 8378, 8380, 8383,
+    8385, 8387, 8389, 8392, 8395, 8396, 8396, 8396, 8397, 8399,
+};
+
+constexpr uint8_t en_child_offset[] = {
+    0x00, 0x1B, 0x32, 0x4B, 0x60, 0x70, 0x87, 0xA0, 0x00, 0x12, 0x24, 0x3E, 0x42, 0x51, 0x68, 0x7A, 0x00, 0x19, 0x2C,
+    0x2D, 0x45, 0x5C, 0x72, 0x88, 0x00, 0x0F, 0x1A, 0x2B, 0x34, 0x40, 0x44, 0x49, 0x00, 0x0D, 0x0F, 0x13, 0x17, 0x1C,
+    0x1D, 0x1F, 0x00, 0x05, 0x08, 0x0E, 0x12, 0x17, 0x1E, 0x24, 0x00, 0x02, 0x04, 0x05, 0x0D, 0x14, 0x1C, 0x1D, 0x00,
+    0x08, 0x0C, 0x11, 0x11, 0x12, 0x1A, 0x1F, 0x00, 0x00, 0x08, 0x09, 0x16, 0x22, 0x2C, 0x33, 0x00, 0x04, 0x05, 0x08,
+    0x0A, 0x14, 0x16, 0x16, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x0D, 0x0D, 0x00, 0x0A, 0x0A, 0x0D, 0x0E, 0x11, 0x19,
+    0x19, 0x00, 0x02, 0x0E, 0x11, 0x1B, 0x22, 0x30, 0x31, 0x00, 0x00, 0x0E, 0x0E, 0x13, 0x13, 0x19, 0x23, 0x00, 0x01,
+    0x0D, 0x0D, 0x0D, 0x0F, 0x21, 0x21, 0x00, 0x00, 0x10, 0x10, 0x10, 0x16, 0x16, 0x16, 0x00, 0x00, 0x06, 0x09, 0x0B,
+    0x14, 0x14, 0x14, 0x00, 0x0B, 0x0E, 0x18, 0x20, 0x2A, 0x2F, 0x36, 0x00, 0x07, 0x08, 0x0A, 0x13, 0x1C, 0x28, 0x32,
+    0x00, 0x01, 0x0E, 0x1B, 0x25, 0x2B, 0x30, 0x34, 0x00, 0x03, 0x0C, 0x0C, 0x0C, 0x16, 0x1A, 0x1A, 0x00, 0x06, 0x06,
+    0x06, 0x09, 0x09, 0x0D, 0x0D, 0x00, 0x07, 0x07, 0x0F, 0x0F, 0x0F, 0x19, 0x1C, 0x00, 0x0D, 0x11, 0x12, 0x16, 0x20,
+    0x20, 0x25, 0x00, 0x01, 0x07, 0x07, 0x09, 0x17, 0x17, 0x24, 0x00, 0x00, 0x0C, 0x0C, 0x0E, 0x0F, 0x10, 0x1A, 0x00,
+    0x02, 0x03, 0x06, 0x0B, 0x0C, 0x0E, 0x14, 0x00, 0x0A, 0x12, 0x19, 0x20, 0x29, 0x29, 0x29, 0x00, 0x00, 0x0A, 0x11,
+    0x21, 0x2B, 0x30, 0x31, 0x00, 0x0F, 0x18, 0x18, 0x1B, 0x1B, 0x1C, 0x1C, 0x00, 0x03, 0x06, 0x07, 0x08, 0x0D, 0x0D,
+    0x15, 0x00, 0x00, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0F, 0x00, 0x04, 0x04, 0x04, 0x0F, 0x10, 0x13, 0x16, 0x00, 0x01,
+    0x04, 0x04, 0x14, 0x14, 0x15, 0x1A, 0x00, 0x00, 0x0F, 0x14, 0x14, 0x17, 0x1D, 0x29, 0x00, 0x00, 0x06, 0x11, 0x13,
+    0x13, 0x1E, 0x1E, 0x00, 0x0A, 0x0A, 0x0A, 0x0B, 0x0E, 0x1C, 0x23, 0x00, 0x02, 0x02, 0x08, 0x08, 0x14, 0x14, 0x1B,
+    0x00, 0x11, 0x12, 0x1B, 0x1D, 0x29, 0x29, 0x2D, 0x00, 0x01, 0x03, 0x13, 0x15, 0x15, 0x16, 0x1F, 0x00, 0x09, 0x09,
+    0x09, 0x0B, 0x0C, 0x11, 0x17, 0x00, 0x05, 0x0A, 0x0B, 0x13, 0x14, 0x1C, 0x1C, 0x00, 0x0C, 0x13, 0x1F, 0x24, 0x2C,
+    0x2C, 0x39, 0x00, 0x05, 0x0B, 0x0E, 0x13, 0x14, 0x15, 0x20, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x15, 0x1E, 0x1E, 0x00,
+    0x00, 0x00, 0x0C, 0x0F, 0x13, 0x16, 0x1E, 0x00, 0x00, 0x03, 0x13, 0x16, 0x1A, 0x1C, 0x2E, 0x00, 0x05, 0x07, 0x16,
+    0x16, 0x1C, 0x1F, 0x23, 0x00, 0x0F, 0x14, 0x18, 0x20, 0x26, 0x2E, 0x31, 0x00, 0x03, 0x04, 0x0E, 0x0E, 0x17, 0x17,
+    0x27, 0x00, 0x00, 0x05, 0x12, 0x15, 0x19, 0x1D, 0x1D, 0x00, 0x06, 0x07, 0x07, 0x12, 0x1F, 0x28, 0x28, 0x00, 0x05,
+    0x17, 0x17, 0x19, 0x19, 0x2A, 0x2A, 0x00, 0x08, 0x19, 0x1D, 0x1E, 0x1E, 0x2C, 0x2C, 0x00, 0x03, 0x07, 0x12, 0x12,
+    0x16, 0x19, 0x1A, 0x00, 0x03, 0x09, 0x0F, 0x12, 0x14, 0x16, 0x1B, 0x00, 0x00, 0x0D, 0x12, 0x1A, 0x1D, 0x22, 0x30,
+    0x00, 0x06, 0x07, 0x07, 0x08, 0x09, 0x14, 0x1C, 0x00, 0x07, 0x07, 0x07, 0x11, 0x11, 0x11, 0x18, 0x00, 0x07, 0x07,
+    0x09, 0x0A, 0x0D, 0x0D, 0x0F, 0x00, 0x00, 0x00, 0x05, 0x05, 0x08, 0x0A, 0x0E, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x08, 0x08, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x09, 0x0C, 0x00, 0x05, 0x0A, 0x0E, 0x15, 0x17, 0x17, 0x19, 0x00,
+    0x04, 0x07, 0x07, 0x07, 0x0A, 0x0B, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x08, 0x0A, 0x0E, 0x00, 0x01, 0x02, 0x03,
+    0x06, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x06, 0x0A, 0x0B, 0x0C, 0x00, 0x02, 0x04, 0x04, 0x05, 0x05, 0x07,
+    0x0A, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x0C, 0x0E, 0x00, 0x02,
+    0x04, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x03, 0x08, 0x0C, 0x10, 0x13, 0x15, 0x17, 0x00, 0x01, 0x02, 0x04, 0x05,
+    0x06, 0x0A, 0x0B, 0x00, 0x01, 0x03, 0x06, 0x08, 0x09, 0x0D, 0x10, 0x00, 0x03, 0x04, 0x05, 0x09, 0x09, 0x0A, 0x0C,
+    0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x02,
+    0x03, 0x05, 0x06, 0x07, 0x08, 0x00, 0x02, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x00, 0x01, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0D, 0x00, 0x01, 0x03, 0x06, 0x06, 0x06, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x02, 0x03, 0x04, 0x07, 0x08, 0x0A, 0x0C, 0x00, 0x00, 0x01, 0x05, 0x0A, 0x0C, 0x10, 0x12, 0x00, 0x04, 0x08, 0x0C,
+    0x0E, 0x18, 0x19, 0x1A, 0x00, 0x08, 0x0D, 0x10, 0x12, 0x14, 0x16, 0x19, 0x00, 0x04, 0x05, 0x05, 0x06, 0x10, 0x11,
+    0x12, 0x00, 0x04, 0x06, 0x0C, 0x0D, 0x10, 0x10, 0x10, 0x00, 0x02, 0x02, 0x04, 0x05, 0x09, 0x0A, 0x0A, 0x00, 0x01,
+    0x02, 0x04, 0x05, 0x06, 0x0A, 0x10, 0x00, 0x07, 0x0B, 0x0C, 0x0D, 0x10, 0x14, 0x14, 0x00, 0x02, 0x03, 0x04, 0x04,
+    0x05, 0x07, 0x09, 0x00, 0x03, 0x05, 0x06, 0x06, 0x07, 0x07, 0x09, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x00, 0x01, 0x04, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x00, 0x00, 0x02, 0x05, 0x07, 0x09, 0x09, 0x0B, 0x00, 0x03, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x08, 0x00, 0x02, 0x05, 0x09, 0x0D, 0x0F, 0x12, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04,
+    0x05, 0x06, 0x00, 0x06, 0x06, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x00,
+    0x01, 0x04, 0x09, 0x09, 0x09, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x03, 0x08, 0x09, 0x0A, 0x0C, 0x00, 0x01, 0x02, 0x03,
+    0x06, 0x06, 0x08, 0x08, 0x00, 0x04, 0x04, 0x05, 0x08, 0x09, 0x09, 0x09, 0x00, 0x06, 0x0B, 0x0B, 0x0D, 0x0E, 0x10,
+    0x10, 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x05, 0x07, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x05, 0x06, 0x0A, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x00, 0x04, 0x08, 0x09, 0x0B,
+    0x0C, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x06, 0x06, 0x00, 0x02, 0x03, 0x05, 0x05, 0x05, 0x05, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x05, 0x08, 0x09, 0x00, 0x01, 0x02, 0x02, 0x04, 0x06, 0x0A, 0x0A, 0x00, 0x01, 0x02,
+    0x04, 0x07, 0x0B, 0x0E, 0x0E, 0x00, 0x06, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x00, 0x00, 0x01, 0x04, 0x04, 0x05,
+    0x06, 0x07, 0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0B, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x04, 0x06, 0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x00, 0x04, 0x07, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x05,
+    0x06, 0x00, 0x02, 0x03, 0x05, 0x0B, 0x0E, 0x12, 0x15, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06, 0x0A, 0x00, 0x04,
+    0x05, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x00, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x04, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0C, 0x0C, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05,
+    0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x0D, 0x15, 0x00, 0x0A, 0x0C, 0x10, 0x11, 0x12, 0x14, 0x17, 0x00, 0x02, 0x08,
+    0x09, 0x0B, 0x0C, 0x0E, 0x0E, 0x00, 0x01, 0x02, 0x09, 0x11, 0x11, 0x14, 0x15, 0x00, 0x02, 0x03, 0x03, 0x03, 0x04,
+    0x04, 0x04, 0x00, 0x02, 0x02, 0x03, 0x04, 0x04, 0x06, 0x09, 0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x06, 0x07, 0x00,
+    0x04, 0x05, 0x06, 0x10, 0x10, 0x18, 0x18, 0x00, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0E, 0x00, 0x02, 0x09, 0x0A,
+    0x0B, 0x0D, 0x11, 0x12, 0x00, 0x01, 0x01, 0x02, 0x04, 0x06, 0x0B, 0x0B, 0x00, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x03, 0x05, 0x09, 0x0D, 0x0E, 0x0E, 0x00, 0x01, 0x01, 0x04, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x05, 0x06, 0x09, 0x00, 0x00, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x00, 0x02, 0x02, 0x03, 0x06,
+    0x07, 0x07, 0x07, 0x00, 0x01, 0x02, 0x05, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x03, 0x04, 0x04, 0x06, 0x0A, 0x0A,
+    0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x08, 0x0A, 0x00, 0x01, 0x02,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x05, 0x07, 0x08, 0x09, 0x0D, 0x0D, 0x0E, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04,
+    0x05, 0x07, 0x00, 0x00, 0x01, 0x04, 0x04, 0x05, 0x06, 0x06, 0x00, 0x00, 0x02, 0x03, 0x06, 0x08, 0x08, 0x0A, 0x00,
+    0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x00, 0x00, 0x02, 0x03, 0x03, 0x08, 0x0A, 0x0C, 0x00, 0x01, 0x02, 0x02,
+    0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x00, 0x01, 0x01, 0x07, 0x0A, 0x0F, 0x10,
+    0x11, 0x00, 0x01, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x09, 0x00, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x00, 0x02, 0x04, 0x06, 0x08,
+    0x0C, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x03, 0x04, 0x07, 0x07, 0x07, 0x00, 0x02, 0x03, 0x03, 0x04, 0x07, 0x07, 0x07,
+    0x00, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x07, 0x08, 0x09, 0x09, 0x0C, 0x00, 0x01, 0x03,
+    0x05, 0x09, 0x0B, 0x0B, 0x0D, 0x00, 0x01, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x03, 0x03, 0x03, 0x04,
+    0x05, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x07, 0x07, 0x00, 0x02, 0x03, 0x05, 0x05, 0x09, 0x0C, 0x0C, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x00, 0x01, 0x04, 0x05,
+    0x0B, 0x10, 0x10, 0x10, 0x00, 0x03, 0x05, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x08,
+    0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0x09, 0x0A, 0x00, 0x01, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x00, 0x01,
+    0x02, 0x02, 0x04, 0x08, 0x08, 0x09, 0x00, 0x01, 0x03, 0x05, 0x0A, 0x0B, 0x11, 0x13, 0x00, 0x08, 0x0A, 0x0C, 0x0C,
+    0x0F, 0x10, 0x13, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x00, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x04, 0x04, 0x08, 0x00, 0x01, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x00, 0x02, 0x03, 0x04, 0x05, 0x08,
+    0x0B, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x05, 0x06, 0x00, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0E, 0x00,
+    0x05, 0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x05, 0x06, 0x0C, 0x0F, 0x12, 0x15, 0x15, 0x00, 0x04, 0x08, 0x09,
+    0x09, 0x0A, 0x0D, 0x0E, 0x00, 0x02, 0x03, 0x09, 0x0A, 0x0C, 0x0F, 0x10, 0x00, 0x02, 0x02, 0x03, 0x05, 0x06, 0x06,
+    0x0A, 0x00, 0x02, 0x03, 0x06, 0x09, 0x0D, 0x0E, 0x10, 0x00, 0x01, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x02,
+    0x05, 0x06, 0x08, 0x08, 0x09, 0x09, 0x00, 0x02, 0x04, 0x04, 0x05, 0x09, 0x0A, 0x0B, 0x00, 0x02, 0x02, 0x04, 0x04,
+    0x04, 0x05, 0x06, 0x00, 0x02, 0x02, 0x05, 0x07, 0x07, 0x08, 0x0D, 0x00, 0x01, 0x05, 0x08, 0x0B, 0x0C, 0x0F, 0x0F,
+    0x00, 0x01, 0x03, 0x04, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x0B, 0x00, 0x03, 0x04,
+    0x04, 0x06, 0x06, 0x07, 0x07, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x02, 0x04, 0x05, 0x07, 0x07,
+    0x08, 0x09, 0x00, 0x05, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x00,
+    0x02, 0x03, 0x06, 0x0B, 0x0D, 0x0F, 0x11, 0x00, 0x01, 0x02, 0x05, 0x07, 0x08, 0x08, 0x08, 0x00, 0x01, 0x06, 0x07,
+    0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x01, 0x03, 0x05, 0x07, 0x08, 0x08, 0x00, 0x00, 0x04, 0x09, 0x0A, 0x0B, 0x0B,
+    0x0C, 0x00, 0x03, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x00, 0x01, 0x01, 0x03, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00,
+    0x01, 0x03, 0x03, 0x05, 0x09, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x04, 0x09, 0x0C, 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x00, 0x00, 0x02, 0x03, 0x04, 0x06, 0x06, 0x07,
+    0x00, 0x02, 0x03, 0x04, 0x05, 0x0A, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x00, 0x02, 0x04, 0x05, 0x06, 0x09,
+    0x0A, 0x0C, 0x00, 0x01, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x00, 0x00, 0x01, 0x03, 0x06, 0x09, 0x0A, 0x0B, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x00, 0x02, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0C, 0x00, 0x01, 0x0C, 0x0D,
+    0x10, 0x11, 0x11, 0x15, 0x00, 0x00, 0x03, 0x05, 0x09, 0x0D, 0x0E, 0x10, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0B,
+    0x0C, 0x00, 0x02, 0x04, 0x05, 0x06, 0x08, 0x08, 0x09, 0x00, 0x01, 0x01, 0x03, 0x05, 0x08, 0x0A, 0x0A, 0x00, 0x00,
+    0x04, 0x08, 0x09, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x04, 0x07, 0x08, 0x08, 0x09, 0x00, 0x03, 0x03, 0x03, 0x06,
+    0x08, 0x09, 0x0C, 0x00, 0x03, 0x04, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x00, 0x02, 0x05, 0x06, 0x07, 0x09, 0x09, 0x0A,
+    0x00, 0x01, 0x01, 0x04, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x05, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x02, 0x04,
+    0x04, 0x06, 0x09, 0x0A, 0x12, 0x00, 0x00, 0x01, 0x04, 0x0A, 0x0A, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07,
+    0x09, 0x0A, 0x00, 0x03, 0x04, 0x06, 0x08, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x03, 0x04, 0x06, 0x07, 0x07, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x09, 0x0A, 0x0B, 0x00, 0x03, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x05, 0x08, 0x00, 0x02, 0x04, 0x06, 0x07, 0x09, 0x09,
+    0x0A, 0x00, 0x05, 0x06, 0x08, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x03, 0x05, 0x05, 0x06, 0x08, 0x0A, 0x00, 0x01,
+    0x04, 0x04, 0x09, 0x0A, 0x0E, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x08, 0x0B, 0x00, 0x03, 0x04, 0x08, 0x09,
+    0x09, 0x09, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x05, 0x06, 0x00, 0x01, 0x04, 0x06, 0x07, 0x0B, 0x0F, 0x0F,
+    0x00, 0x00, 0x04, 0x08, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x07, 0x09, 0x00, 0x00, 0x01,
+    0x05, 0x09, 0x0A, 0x0A, 0x0C, 0x00, 0x02, 0x04, 0x05, 0x06, 0x09, 0x0D, 0x0F, 0x00, 0x02, 0x04, 0x07, 0x09, 0x09,
+    0x0A, 0x0E, 0x00, 0x01, 0x01, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x00, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x09, 0x00,
+    0x01, 0x08, 0x0B, 0x0C, 0x0C, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x04, 0x05, 0x0B, 0x0D, 0x0D, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x05, 0x05, 0x0A, 0x00, 0x01, 0x04, 0x04, 0x05, 0x05, 0x09, 0x0C, 0x00, 0x03, 0x05, 0x08, 0x09, 0x09, 0x0A,
+    0x0A, 0x00, 0x02, 0x04, 0x05, 0x05, 0x08, 0x0C, 0x13, 0x00, 0x04, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x00, 0x04,
+    0x08, 0x08, 0x08, 0x09, 0x0B, 0x0C, 0x00, 0x03, 0x04, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x04, 0x05, 0x06, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0C, 0x00, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x0E, 0x10,
+    0x00, 0x01, 0x05, 0x07, 0x09, 0x09, 0x0D, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03,
+    0x04, 0x0B, 0x0C, 0x11, 0x14, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x00, 0x02, 0x03, 0x04, 0x04, 0x06, 0x07, 0x08, 0x00, 0x01, 0x02, 0x08, 0x0A, 0x0C, 0x0F, 0x14, 0x00,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x07, 0x07, 0x00, 0x03, 0x05, 0x06, 0x06, 0x08, 0x0C, 0x0D, 0x00, 0x00, 0x01, 0x07,
+    0x09, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x02, 0x05, 0x08, 0x08, 0x0D, 0x0D, 0x00, 0x03, 0x03, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x00, 0x02, 0x06, 0x08, 0x08, 0x0E, 0x0F, 0x0F, 0x00, 0x02, 0x03, 0x07, 0x08, 0x08, 0x08, 0x08, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x07, 0x0A, 0x00, 0x00, 0x01, 0x03, 0x04, 0x09, 0x0C, 0x10, 0x00, 0x02, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07,
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x07, 0x08, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x07, 0x08, 0x00, 0x01, 0x02, 0x05, 0x07, 0x07, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x00,
+    0x01, 0x05, 0x06, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x04, 0x06, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x04, 0x0A, 0x0B, 0x00, 0x01, 0x03, 0x04, 0x07, 0x07, 0x0A, 0x0B, 0x00, 0x02, 0x03, 0x03, 0x04, 0x06, 0x07,
+    0x09, 0x00, 0x05, 0x05, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x06, 0x08, 0x00, 0x02, 0x04, 0x06, 0x08, 0x08, 0x09, 0x09, 0x00, 0x04, 0x07, 0x07, 0x08,
+    0x0B, 0x0E, 0x0F, 0x00, 0x02, 0x02, 0x06, 0x07, 0x0A, 0x0C, 0x0D, 0x00, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07,
+    0x00, 0x02, 0x03, 0x06, 0x07, 0x07, 0x08, 0x08, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05, 0x06, 0x06, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x02, 0x02, 0x03, 0x05, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x02, 0x02,
+    0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x05,
+    0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x06, 0x06,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x06, 0x06, 0x06, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x05,
+    0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x00, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x07,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x03, 0x03, 0x04,
+    0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x02, 0x03, 0x03, 0x06, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x04, 0x00, 0x01, 0x02,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x06, 0x07, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05,
+    0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x01, 0x03, 0x04, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x03, 0x04, 0x06, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x05,
+    0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
+    0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x06, 0x07, 0x07, 0x00, 0x00, 0x02, 0x02, 0x02, 0x04, 0x07, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x03, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x03, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x05, 0x00, 0x02,
+    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x04, 0x05, 0x05, 0x06, 0x07,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x08, 0x08, 0x0A, 0x00, 0x01, 0x02,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x03, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x00, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x02,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x04, 0x06, 0x00, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04,
+    0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0x04, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x03, 0x05, 0x06, 0x06, 0x07, 0x08, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x03, 0x03, 0x05, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x03, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x04,
+    0x04, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x02, 0x03, 0x04, 0x04, 0x07, 0x08, 0x09, 0x00, 0x02, 0x03, 0x03, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x07, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x03, 0x04, 0x04, 0x07, 0x09, 0x09, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x05, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x03, 0x03, 0x05, 0x06, 0x09,
+    0x0D, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x03, 0x05, 0x05, 0x05, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x06, 0x06, 0x06, 0x00, 0x01, 0x03, 0x04, 0x06, 0x06, 0x06,
+    0x06, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x04, 0x04, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x06, 0x06, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x03,
+    0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x00, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x07, 0x00, 0x01, 0x03, 0x04, 0x06, 0x06, 0x09, 0x09, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x06, 0x07, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x08, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x04,
+    0x05, 0x06, 0x07, 0x00, 0x01, 0x01, 0x04, 0x05, 0x05, 0x05, 0x06, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x03, 0x03, 0x04, 0x06, 0x06, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x06, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02,
+    0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x05, 0x06, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x03, 0x05, 0x05, 0x06, 0x00, 0x00,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x02, 0x05, 0x07, 0x07,
+    0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03,
+    0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x04, 0x05, 0x05, 0x05, 0x07, 0x08, 0x09, 0x00,
+    0x02, 0x03, 0x03, 0x05, 0x05, 0x06, 0x09, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x02,
+    0x02, 0x02, 0x02, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x04, 0x05, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x05, 0x05,
+    0x05, 0x06, 0x07, 0x00, 0x02, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04,
+    0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x06, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x07, 0x08,
+    0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x05, 0x06, 0x00, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00,
+    0x02, 0x02, 0x03, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00,
+};
+
+constexpr uint16_t en_fail[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22,
+    23, 24, 26, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 2, 3, 5, 6,
+    7, 9, 10, 11, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 24,
+    26, 2, 4, 6, 9, 10, 12, 13, 15, 16, 18, 19, 20, 21, 22, 26,
+    27, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 19, 20, 21, 22, 23, 24, 26, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 2, 3, 5, 6, 7, 9, 10, 13, 14, 15, 16, 17, 19, 20, 21,
+    22, 26, 2, 3, 5, 6, 8, 9, 10, 13, 14, 15, 16, 17, 19, 20,
+    21, 22, 24, 26, 2, 3, 6, 7, 9, 10, 12, 13, 14, 15, 16, 17,
+    19, 20, 21, 22, 24, 26, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    2, 6, 16, 22, 2, 3, 6, 7, 9, 10, 12, 13, 14, 15, 16, 19,
+    20, 21, 24, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 19, 20, 21, 22, 23, 24, 26, 2, 3, 4, 6, 7, 9,
+    10, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 24, 2, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 26, 27, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 2, 3,
+    5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 19, 20, 21, 22,
+    24, 22, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 19, 20, 21, 22, 23, 24, 26, 27, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    26, 2, 3, 4, 5, 6, 7, 8, 9, 10, 13, 14, 15, 16, 17, 19,
+    20, 21, 22, 23, 24, 26, 27, 2, 3, 4, 5, 6, 7, 8, 10, 11,
+    12, 13, 14, 15, 16, 17, 19, 20, 21, 22, 23, 25, 27, 2, 6, 10,
+    16, 23, 26, 2, 3, 4, 6, 9, 10, 12, 13, 15, 16, 17, 19, 20,
+    21, 26, 2, 4, 6, 9, 10, 16, 17, 18, 21, 22, 25, 2, 3, 4,
+    5, 6, 8, 9, 10, 13, 14, 15, 16, 17, 19, 20, 21, 24, 2, 3,
+    6, 10, 13, 14, 16, 21, 27, 52, 53, 55, 61, 62, 63, 67, 68, 69,
+    70, 71, 72, 76, 79, 90, 93, 97, 99, 100, 101, 105, 117, 121, 127, 129,
+    132, 136, 137, 140, 142, 147, 149, 152, 153, 154, 155, 156, 157, 160, 164, 171,
+    178, 181, 184, 188, 196, 198, 201, 206, 217, 226, 227, 231, 232, 243, 249, 254,
+    259, 263, 267, 282, 285, 288, 293, 298, 304, 308, 314, 328, 330, 342, 343, 344,
+    345, 353, 357, 362, 364, 370, 374, 378, 384, 389, 396, 398, 401, 402, 408, 412,
+    416, 417, 421, 424, 425, 429, 431, 451, 453, 454, 455, 462, 463, 470, 472, 497,
+    1, 76, 79, 82, 85, 88, 90, 93, 97, 99, 100, 101, 107, 109, 110, 116,
+    117, 121, 124, 127, 129, 130, 132, 153, 165, 178, 181, 184, 185, 187, 188, 193,
+    195, 196, 198, 203, 206, 214, 216, 225, 227, 233, 246, 259, 262, 263, 267, 270,
+    271, 273, 281, 282, 285, 288, 293, 294, 300, 303, 304, 306, 308, 310, 313, 314,
+    318, 319, 320, 350, 353, 356, 357, 359, 362, 365, 367, 369, 370, 371, 372, 373,
+    374, 375, 378, 382, 384, 385, 18, 386, 387, 1, 394, 401, 402, 403, 404, 407,
+    408, 411, 412, 413, 416, 417, 421, 424, 425, 429, 431, 432, 433, 434, 437, 440,
+    445, 449, 451, 454, 455, 456, 461, 462, 463, 464, 467, 472, 474, 479, 486, 493,
+    497, 507, 513, 518, 1, 52, 53, 56, 61, 63, 67, 68, 69, 75, 79, 82,
+    1, 136, 139, 142, 147, 148, 149, 154, 155, 157, 158, 160, 215, 217, 218, 219,
+    225, 227, 228, 233, 259, 263, 267, 273, 278, 304, 328, 329, 336, 337, 338, 339,
+    342, 343, 344, 345, 378, 384, 389, 407, 426, 429, 431, 444, 445, 449, 450, 451,
+    454, 455, 456, 1, 507, 51, 52, 53, 56, 57, 61, 63, 65, 67, 68, 69,
+    71, 100, 101, 105, 1, 139, 144, 147, 149, 151, 153, 154, 155, 158, 1, 196,
+    198, 201, 206, 209, 210, 214, 216, 218, 219, 220, 222, 225, 226, 227, 228, 229,
+    232, 233, 239, 249, 259, 263, 267, 281, 325, 329, 331, 333, 336, 337, 338, 340,
+    342, 343, 345, 346, 347, 27, 370, 374, 378, 384, 389, 417, 421, 425, 431, 434,
+    436, 442, 444, 446, 449, 450, 451, 453, 454, 455, 456, 512, 1, 51, 52, 55,
+    56, 61, 62, 63, 67, 69, 71, 74, 113, 121, 1, 136, 137, 138, 139, 140,
+    141, 144, 147, 148, 149, 151, 152, 153, 154, 155, 157, 160, 178, 181, 184, 195,
+    1, 214, 216, 217, 218, 219, 220, 225, 226, 227, 228, 229, 231, 232, 233, 235,
+    259, 263, 267, 273, 278, 281, 1, 328, 329, 330, 331, 336, 337, 338, 339, 340,
+    342, 343, 345, 346, 347, 348, 370, 374, 378, 384, 389, 392, 408, 415, 416, 417,
+    424, 439, 441, 443, 445, 449, 450, 451, 452, 453, 503, 507, 51, 52, 53, 56,
+    61, 62, 63, 67, 68, 69, 71, 79, 82, 90, 97, 98, 99, 100, 101, 103,
+    105, 107, 109, 110, 113, 116, 117, 119, 121, 127, 129, 132, 138, 139, 141, 147,
+    148, 149, 151, 154, 155, 159, 164, 165, 167, 171, 176, 178, 181, 184, 187, 188,
+    193, 195, 198, 216, 217, 220, 226, 227, 231, 233, 243, 249, 251, 259, 263, 264,
+    267, 270, 273, 276, 277, 278, 282, 283, 285, 288, 292, 293, 294, 298, 26, 300,
+    302, 303, 304, 308, 313, 314, 318, 319, 320, 323, 324, 330, 331, 333, 336, 340,
+    342, 343, 344, 345, 347, 350, 353, 356, 357, 359, 362, 364, 365, 366, 367, 369,
+    370, 371, 372, 374, 377, 378, 382, 383, 384, 387, 388, 389, 391, 394, 396, 398,
+    401, 402, 403, 405, 407, 408, 411, 412, 413, 415, 417, 421, 424, 425, 428, 429,
+    431, 434, 437, 438, 441, 451, 453, 454, 455, 456, 461, 462, 463, 464, 22, 467,
+    470, 471, 472, 488, 495, 497, 507, 51, 52, 56, 58, 61, 62, 67, 69, 70,
+    1, 136, 137, 138, 139, 147, 148, 149, 153, 157, 164, 167, 168, 177, 214, 216,
+    217, 220, 225, 227, 232, 233, 259, 263, 267, 273, 278, 281, 338, 342, 343, 370,
+    374, 378, 384, 429, 437, 443, 445, 450, 451, 454, 455, 456, 55, 61, 62, 63,
+    67, 68, 69, 75, 1, 139, 140, 147, 149, 150, 153, 154, 155, 157, 181, 185,
+    188, 201, 206, 210, 1, 214, 216, 218, 225, 226, 227, 228, 231, 232, 234, 235,
+    239, 259, 263, 267, 273, 26, 300, 304, 308, 314, 1, 326, 329, 331, 333, 338,
+    339, 342, 343, 346, 370, 374, 378, 384, 389, 412, 424, 439, 443, 446, 451, 455,
+    456, 503, 506, 51, 52, 54, 56, 58, 61, 62, 63, 65, 67, 68, 69, 70,
+    75, 136, 138, 139, 147, 148, 149, 150, 151, 153, 154, 155, 156, 159, 214, 216,
+    220, 225, 226, 227, 228, 229, 231, 232, 233, 235, 259, 273, 285, 300, 328, 331,
+    336, 337, 338, 339, 342, 343, 345, 346, 374, 384, 401, 417, 421, 437, 445, 450,
+    451, 455, 456, 467, 505, 507, 61, 62, 63, 65, 68, 69, 79, 82, 85, 88,
+    90, 93, 97, 98, 99, 100, 101, 103, 105, 107, 109, 110, 113, 116, 117, 121,
+    124, 127, 129, 132, 139, 142, 147, 149, 153, 154, 155, 1, 161, 164, 165, 167,
+    168, 175, 178, 181, 183, 184, 185, 187, 188, 190, 193, 12, 259, 263, 264, 267,
+    270, 272, 273, 277, 278, 279, 282, 285, 288, 292, 293, 294, 298, 1, 300, 302,
+    303, 304, 305, 306, 308, 310, 311, 313, 314, 318, 319, 320, 323, 1, 331, 336,
+    337, 338, 340, 342, 343, 344, 345, 353, 356, 357, 364, 367, 369, 370, 373, 374,
+    376, 378, 382, 384, 386, 389, 1, 394, 396, 398, 399, 401, 402, 403, 404, 405,
+    407, 408, 411, 412, 413, 417, 421, 424, 425, 429, 431, 433, 434, 438, 462, 463,
+    464, 487, 510, 513, 516, 52, 63, 65, 153, 154, 158, 340, 442, 1, 51, 56,
+    58, 61, 139, 140, 142, 147, 149, 153, 154, 155, 1, 216, 225, 226, 227, 229,
+    232, 263, 281, 304, 314, 342, 343, 345, 346, 384, 396, 401, 404, 416, 51, 52,
+    53, 56, 58, 62, 63, 67, 68, 69, 71, 82, 99, 100, 101, 117, 121, 129,
+    136, 137, 138, 141, 142, 148, 149, 151, 153, 154, 157, 160, 173, 178, 181, 188,
+    214, 215, 216, 217, 219, 220, 224, 225, 226, 227, 228, 230, 232, 233, 235, 239,
+    244, 259, 263, 264, 267, 273, 285, 288, 293, 1, 325, 326, 327, 330, 331, 337,
+    338, 339, 340, 342, 343, 344, 345, 346, 350, 356, 357, 359, 364, 396, 398, 402,
+    417, 421, 424, 425, 431, 434, 439, 440, 441, 443, 444, 446, 450, 451, 452, 453,
+    455, 456, 462, 493, 494, 498, 502, 503, 507, 51, 52, 56, 57, 58, 61, 63,
+    65, 67, 68, 69, 76, 82, 1, 139, 142, 147, 148, 149, 150, 153, 154, 155,
+    157, 1, 214, 217, 220, 225, 227, 228, 232, 233, 239, 282, 300, 308, 314, 327,
+    328, 329, 331, 333, 335, 336, 337, 338, 342, 343, 344, 345, 346, 350, 353, 356,
+    357, 362, 366, 26, 401, 402, 442, 449, 450, 451, 453, 457, 51, 52, 56, 60,
+    61, 62, 63, 67, 68, 69, 70, 71, 97, 99, 100, 101, 105, 107, 110, 113,
+    117, 121, 131, 132, 134, 1, 136, 137, 138, 139, 142, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 157, 158, 167, 178, 181, 183, 184, 185, 188, 191, 193, 195,
+    196, 198, 214, 215, 217, 218, 219, 220, 224, 226, 227, 228, 232, 233, 246, 249,
+    251, 255, 263, 285, 304, 308, 326, 327, 328, 329, 331, 333, 336, 337, 338, 340,
+    342, 343, 344, 345, 346, 347, 357, 364, 389, 394, 396, 398, 402, 404, 405, 407,
+    408, 412, 417, 421, 425, 431, 432, 434, 439, 442, 443, 444, 446, 450, 451, 452,
+    456, 502, 505, 510, 53, 61, 67, 68, 69, 76, 79, 82, 85, 90, 93, 99,
+    100, 101, 103, 105, 107, 109, 110, 116, 117, 121, 127, 132, 147, 149, 153, 155,
+    157, 167, 178, 181, 184, 185, 187, 190, 193, 195, 196, 216, 217, 219, 220, 225,
+    227, 232, 233, 246, 249, 259, 262, 263, 264, 267, 270, 273, 274, 277, 278, 279,
+    281, 282, 283, 285, 288, 291, 293, 294, 300, 302, 303, 304, 306, 308, 310, 314,
+    318, 319, 320, 321, 328, 335, 340, 342, 343, 350, 353, 356, 357, 362, 364, 367,
+    26, 370, 374, 376, 378, 382, 383, 384, 385, 386, 387, 388, 389, 392, 394, 396,
+    402, 404, 407, 408, 412, 417, 421, 424, 425, 429, 440, 441, 443, 449, 451, 458,
+    462, 463, 464, 5, 470, 472, 475, 476, 486, 493, 52, 53, 56, 58, 61, 63,
+    65, 67, 69, 71, 74, 1, 136, 138, 139, 140, 146, 147, 149, 150, 153, 155,
+    1, 196, 198, 201, 203, 206, 209, 210, 211, 213, 214, 216, 217, 218, 220, 225,
+    227, 228, 233, 259, 267, 273, 278, 327, 328, 329, 331, 333, 336, 338, 340, 342,
+    343, 344, 345, 350, 353, 362, 370, 374, 378, 384, 398, 401, 402, 417, 421, 424,
+    425, 429, 431, 434, 436, 440, 443, 444, 449, 450, 451, 454, 455, 456, 439, 443,
+    446, 51, 52, 53, 55, 58, 61, 62, 63, 64, 65, 67, 68, 69, 70, 71,
+    75, 76, 82, 88, 99, 100, 101, 110, 113, 121, 1, 136, 137, 138, 139, 141,
+    142, 144, 147, 149, 150, 151, 153, 154, 155, 156, 157, 158, 176, 177, 181, 184,
+    185, 188, 193, 1, 196, 214, 215, 216, 217, 218, 220, 225, 226, 227, 228, 229,
+    230, 232, 233, 235, 1, 246, 248, 251, 255, 256, 263, 267, 273, 282, 285, 288,
+    26, 300, 304, 308, 314, 320, 326, 327, 329, 330, 335, 336, 337, 338, 339, 340,
+    342, 343, 344, 346, 348, 350, 353, 356, 357, 362, 374, 378, 384, 392, 394, 396,
+    398, 401, 402, 407, 408, 415, 417, 421, 424, 425, 431, 432, 439, 443, 445, 446,
+    450, 451, 455, 456, 462, 463, 464, 495, 503, 508, 20, 51, 52, 58, 61, 63,
+    65, 69, 70, 71, 72, 97, 99, 100, 101, 103, 105, 107, 110, 111, 1, 136,
+    138, 139, 142, 144, 147, 148, 149, 151, 153, 154, 156, 157, 158, 159, 1, 198,
+    201, 206, 212, 215, 216, 217, 220, 225, 227, 228, 231, 232, 233, 234, 235, 239,
+    246, 249, 26, 259, 263, 267, 273, 282, 285, 288, 293, 327, 330, 331, 336, 337,
+    338, 340, 342, 346, 350, 353, 356, 357, 359, 362, 369, 394, 396, 398, 401, 402,
+    404, 406, 408, 412, 413, 415, 1, 417, 418, 421, 424, 425, 426, 429, 431, 432,
+    434, 436, 437, 439, 440, 445, 446, 449, 450, 451, 453, 454, 472, 476, 495, 501,
+    503, 506, 508, 1, 51, 52, 53, 55, 56, 58, 61, 62, 63, 65, 67, 68,
+    69, 70, 71, 72, 73, 100, 107, 1, 136, 138, 139, 140, 142, 147, 148, 149,
+    150, 151, 153, 154, 155, 156, 159, 160, 1, 196, 198, 201, 203, 206, 209, 213,
+    214, 215, 216, 217, 218, 219, 220, 225, 226, 227, 228, 230, 232, 233, 234, 235,
+    239, 259, 263, 267, 273, 285, 326, 327, 328, 330, 331, 333, 336, 337, 338, 342,
+    343, 344, 345, 347, 370, 374, 378, 384, 389, 396, 401, 415, 421, 429, 431, 434,
+    439, 440, 442, 443, 444, 446, 450, 451, 453, 454, 455, 467, 471, 472, 476, 493,
+    501, 505, 512, 51, 52, 53, 63, 67, 69, 71, 79, 82, 85, 97, 101, 103,
+    107, 110, 111, 116, 117, 121, 127, 130, 132, 136, 149, 153, 161, 168, 183, 184,
+    225, 227, 231, 233, 235, 259, 261, 262, 263, 265, 267, 270, 271, 273, 276, 277,
+    278, 279, 282, 283, 288, 293, 294, 300, 304, 308, 318, 319, 320, 323, 324, 342,
+    343, 345, 353, 357, 359, 363, 366, 370, 371, 372, 373, 374, 375, 378, 381, 383,
+    384, 385, 387, 388, 389, 394, 396, 398, 402, 404, 408, 411, 412, 413, 417, 421,
+    425, 426, 429, 432, 450, 491, 512, 1, 51, 52, 56, 61, 62, 63, 65, 67,
+    69, 70, 1, 139, 142, 147, 149, 153, 154, 155, 214, 217, 219, 220, 224, 225,
+    227, 228, 229, 231, 232, 233, 235, 1, 333, 335, 336, 337, 342, 344, 51, 52,
+    56, 58, 61, 62, 67, 68, 69, 71, 136, 139, 140, 147, 153, 154, 157, 201,
+    217, 225, 227, 231, 232, 233, 239, 263, 267, 314, 335, 337, 346, 370, 378, 401,
+    404, 408, 412, 52, 56, 62, 65, 68, 138, 139, 153, 201, 211, 214, 216, 217,
+    226, 326, 350, 353, 369, 425, 439, 52, 67, 69, 99, 100, 105, 140, 153, 154,
+    155, 184, 259, 270, 273, 278, 283, 285, 294, 302, 303, 306, 308, 25, 328, 331,
+    337, 338, 343, 353, 357, 362, 366, 367, 370, 378, 384, 386, 396, 398, 402, 407,
+    411, 412, 413, 424, 425, 51, 67, 149, 151, 153, 155, 214, 225, 232, 337, 339,
+    340, 421, 24, 26, 634, 639, 175, 277, 675, 302, 683, 684, 689, 712, 388, 396,
+    720, 721, 722, 729, 442, 744, 475, 759, 761, 763, 153, 775, 804, 818, 62, 827,
+    828, 829, 831, 839, 849, 865, 873, 878, 880, 931, 150, 935, 936, 946, 344, 984,
+    994, 998, 1011, 1012, 153, 262, 1070, 1087, 306, 1094, 1119, 386, 1148, 449, 1163, 1173,
+    154, 1213, 1233, 1240, 1241, 1253, 215, 1281, 1306, 1317, 1320, 1321, 1322, 1323, 215, 218,
+    1346, 1351, 1392, 1393, 291, 1435, 1439, 1441, 1445, 1449, 1451, 1476, 1484, 454, 1532, 1541,
+    1551, 1555, 1559, 1572, 144, 1574, 1575, 1578, 1589, 1593, 1594, 1597, 1659, 1662, 1663, 1665,
+    1672, 1677, 1679, 226, 1688, 1703, 1704, 456, 1758, 216, 1801, 1806, 1863, 175, 1937, 372,
+    373, 1947, 1956, 1959, 456, 1992, 1999, 2013, 2017, 2018, 2028, 2032, 2039, 2066, 2072, 2077,
+    2079, 140, 148, 2103, 2122, 2130, 341, 2161, 347, 442, 2216, 2228, 2229, 2230, 2232, 2248,
+    2278, 2279, 2295, 2333, 2349, 2351, 2375, 2376, 2377, 2398, 340, 341, 2402, 2406, 2487, 302,
+    303, 2488, 310, 314, 2492, 2507, 2517, 2550, 2551, 216, 137, 2593, 760, 761, 153, 214,
+    787, 788, 796, 805, 813, 821, 829, 150, 842, 848, 855, 861, 862, 889, 893, 900,
+    901, 921, 935, 945, 946, 948, 954, 958, 234, 961, 980, 982, 413, 994, 998, 1125,
+    1195, 51, 1231, 1239, 1241, 156, 1277, 1279, 1292, 449, 1, 281, 1444, 1448, 1494, 1526,
+    1550, 1552, 1557, 1566, 1574, 150, 1584, 218, 1602, 1604, 1614, 1, 1656, 508, 27, 1657,
+    1659, 1665, 1666, 1667, 1675, 1677, 216, 219, 1685, 1686, 1703, 1704, 1710, 1726, 1728, 1731,
+    1733, 1744, 1745, 124, 127, 140, 1757, 1762, 156, 1770, 1771, 216, 1781, 1782, 1785, 1786,
+    1787, 229, 1788, 1789, 234, 1792, 1797, 325, 1810, 1817, 1818, 400, 406, 1824, 1825, 413,
+    414, 1826, 1828, 429, 1829, 436, 1832, 449, 454, 1985, 1986, 1990, 1998, 2002, 2003, 2015,
+    2016, 2018, 2023, 2028, 2031, 2032, 2042, 2063, 2066, 2067, 2070, 2071, 2072, 2074, 2077, 2078,
+    2079, 72, 2081, 2085, 2089, 129, 2091, 140, 2099, 2103, 167, 168, 2117, 2121, 2124, 2125,
+    2126, 239, 2143, 328, 2157, 2158, 370, 2170, 2174, 2177, 2203, 2207, 2240, 214, 2243, 2244,
+    2252, 2257, 2267, 2278, 2286, 2297, 2302, 2315, 502, 2324, 2325, 2330, 2333, 2345, 2348, 2351,
+    2354, 2355, 157, 2362, 2365, 1, 2368, 2369, 2370, 2373, 2378, 2381, 2394, 2397, 340, 2400,
+    2407, 403, 417, 2412, 424, 2416, 2419, 449, 2425, 2462, 193, 2474, 303, 2520, 2527, 424,
+    2538, 2541, 2550, 2551, 218, 2557, 2561, 327, 2572, 74, 281, 2622, 2623, 61, 218, 513,
+    102, 119, 650, 667, 681, 682, 684, 701, 706, 708, 721, 727, 153, 785, 787, 60,
+    1013, 1028, 1030, 1032, 1053, 1056, 1072, 1074, 1091, 1096, 1141, 1143, 1149, 1152, 436, 1164,
+    504, 1391, 1399, 1400, 1423, 1424, 1438, 1440, 1441, 1454, 1456, 1459, 1462, 1496, 1498, 1500,
+    1501, 1556, 1559, 1, 1574, 1577, 1593, 1596, 1616, 1645, 1754, 1865, 1897, 1906, 1912, 1,
+    1937, 373, 1938, 1940, 1942, 1957, 1959, 1961, 434, 1966, 2130, 2162, 2194, 2274, 165, 178,
+    2474, 2484, 2491, 2507, 2520, 2523, 2524, 2526, 2527, 2528, 2530, 433, 627, 628, 634, 640,
+    667, 671, 673, 681, 682, 684, 689, 323, 692, 708, 722, 724, 725, 727, 728, 742,
+    847, 853, 877, 878, 882, 1, 1030, 1, 1073, 1088, 1090, 1091, 1095, 1120, 1133, 1142,
+    1143, 1146, 1299, 1306, 1313, 1315, 1316, 1317, 1318, 1321, 218, 1331, 1332, 1336, 239, 1,
+    1354, 425, 51, 67, 1400, 1407, 1410, 1420, 1423, 1438, 1441, 1443, 1448, 316, 1457, 1463,
+    1464, 1465, 1491, 1496, 1557, 1568, 1573, 1586, 1592, 56, 1879, 1888, 1897, 1899, 1907, 1912,
+    1915, 1916, 1921, 1929, 1931, 1932, 359, 371, 1943, 398, 455, 1968, 467, 512, 513, 2076,
+    2077, 2091, 2094, 2104, 2106, 219, 2125, 2129, 2130, 2151, 2152, 2159, 2161, 442, 2324, 2332,
+    2354, 2370, 2376, 2407, 2425, 2467, 2474, 2479, 2482, 285, 2484, 2499, 26, 2503, 2509, 2523,
+    2528, 431, 634, 673, 683, 703, 380, 392, 725, 728, 729, 743, 909, 215, 55, 1008,
+    1016, 88, 1018, 1022, 1023, 1024, 1, 1048, 219, 1072, 1074, 1, 1081, 1083, 1087, 1093,
+    1095, 1096, 1109, 1112, 1118, 1124, 1126, 1127, 1129, 1, 1134, 1137, 1140, 1143, 1144, 1149,
+    1151, 1164, 1244, 51, 1378, 1380, 1386, 1399, 1406, 1411, 1420, 1431, 1438, 1441, 1444, 1454,
+    359, 1471, 388, 1484, 1491, 1496, 1, 1568, 139, 1577, 218, 1864, 1893, 1897, 1899, 1908,
+    1912, 1917, 1924, 363, 456, 1975, 56, 2069, 2091, 2099, 2118, 219, 2123, 2127, 2156, 2159,
+    347, 453, 2324, 61, 2445, 99, 109, 147, 2472, 2483, 340, 2498, 2669, 408, 637, 641,
+    650, 669, 673, 676, 681, 684, 700, 702, 704, 706, 380, 388, 720, 721, 722, 726,
+    727, 728, 733, 743, 744, 745, 772, 774, 787, 823, 827, 97, 843, 847, 215, 856,
+    860, 865, 868, 278, 876, 877, 878, 880, 887, 891, 892, 900, 935, 936, 185, 945,
+    215, 946, 952, 958, 239, 971, 973, 984, 997, 1032, 1072, 281, 1087, 1143, 1154, 1192,
+    1199, 1202, 1203, 1205, 1213, 1226, 1229, 1242, 215, 1254, 1258, 233, 1274, 1282, 449, 454,
+    1321, 1414, 283, 1442, 1443, 1449, 1470, 1494, 1495, 437, 1516, 1534, 259, 1, 1551, 1556,
+    1559, 72, 73, 1568, 1569, 1570, 139, 1572, 1574, 1576, 1577, 1585, 1586, 218, 1589, 1592,
+    1593, 1594, 1596, 1597, 1598, 1601, 1605, 1610, 1612, 1614, 1618, 401, 1632, 442, 445, 1658,
+    1659, 1663, 1673, 1679, 216, 218, 1684, 1686, 1688, 1690, 1693, 1698, 1703, 1712, 1719, 1721,
+    1729, 1730, 1738, 1745, 1750, 140, 1756, 1761, 1762, 1763, 1765, 216, 1781, 225, 1787, 1788,
+    1789, 234, 239, 1802, 1809, 1812, 415, 1826, 424, 1832, 1835, 1, 1879, 1929, 1938, 1943,
+    1961, 456, 1981, 1983, 1995, 1996, 1999, 2002, 2016, 2020, 2039, 2041, 2043, 2048, 2061, 2064,
+    2065, 2072, 2075, 2077, 85, 2085, 2090, 2091, 2093, 2097, 2098, 148, 2099, 152, 2103, 2104,
+    2117, 2119, 2121, 2125, 2126, 2130, 234, 2131, 2147, 2148, 2150, 2151, 2160, 345, 2176, 2183,
+    426, 436, 2195, 467, 56, 2213, 2219, 2220, 2224, 2230, 2232, 196, 2239, 2244, 2245, 2246,
+    226, 2248, 2251, 2253, 2257, 2265, 2270, 2272, 2276, 2277, 2279, 364, 2287, 2295, 2299, 2301,
+    2302, 2315, 2324, 2351, 2352, 2365, 2367, 2370, 2371, 2377, 231, 2381, 2398, 2404, 2405, 2406,
+    2407, 2416, 502, 2447, 2512, 2527, 2528, 431, 2542, 68, 136, 2549, 2550, 2551, 2555, 2559,
+    2560, 2566, 327, 2576, 2586, 2593, 2594, 2597, 1, 628, 630, 633, 664, 671, 675, 677,
+    388, 725, 727, 729, 737, 1012, 1013, 1017, 1018, 1026, 1072, 1083, 1089, 1126, 386, 154,
+    218, 1203, 1204, 1211, 1, 1378, 1380, 1381, 1382, 108, 1387, 1390, 1412, 1423, 1424, 281,
+    1438, 1440, 1441, 1443, 1447, 1491, 1499, 1553, 1577, 1593, 1619, 347, 1646, 1914, 1921, 1937,
+    1938, 1940, 1947, 2077, 2091, 2103, 2123, 2155, 147, 2484, 2488, 2509, 2520, 2523, 2526, 1,
+    670, 673, 676, 678, 684, 687, 383, 721, 727, 728, 27, 1072, 281, 1087, 1088, 1091,
+    1093, 1097, 328, 337, 392, 1137, 1148, 1149, 1151, 1154, 1242, 278, 1331, 1350, 429, 436,
+    67, 1382, 1384, 1399, 1401, 1431, 1437, 1443, 1449, 381, 1486, 1552, 1558, 1568, 1585, 1589,
+    1596, 1611, 1619, 1, 1725, 1763, 1786, 1787, 1805, 1806, 1808, 1889, 1912, 1914, 1917, 1940,
+    1943, 1, 2067, 2069, 2072, 2074, 74, 2099, 2103, 2121, 2130, 444, 2297, 2439, 2467, 2526,
+    2664, 628, 634, 148, 155, 655, 231, 667, 302, 681, 683, 684, 685, 689, 691, 695,
+    366, 700, 703, 381, 709, 388, 721, 419, 738, 510, 1006, 1011, 1018, 1033, 1072, 1073,
+    1074, 1084, 1087, 1104, 1120, 1121, 1123, 1127, 1128, 392, 1141, 1147, 482, 1368, 1384, 1412,
+    1431, 1438, 1457, 1463, 381, 1475, 385, 1476, 1481, 1490, 1494, 1495, 1556, 1619, 1679, 1734,
+    1865, 130, 1875, 1893, 1895, 1905, 1907, 1912, 323, 1924, 338, 1937, 1940, 1947, 1948, 398,
+    1955, 455, 1968, 140, 2157, 2159, 2334, 2351, 2352, 2355, 2484, 310, 2491, 2524, 2580, 2659,
+    356, 2661, 676, 302, 684, 689, 692, 721, 728, 730, 733, 153, 214, 785, 787, 790,
+    804, 815, 62, 828, 829, 830, 74, 110, 150, 217, 861, 863, 871, 327, 886, 392,
+    892, 895, 900, 901, 452, 904, 58, 915, 923, 936, 945, 948, 954, 958, 234, 961,
+    972, 980, 1000, 1030, 1051, 262, 1087, 1090, 1092, 1095, 1, 1134, 1143, 1176, 1192, 1194,
+    173, 1199, 218, 51, 1242, 1251, 215, 1256, 1258, 233, 1272, 1281, 344, 1285, 1293, 454,
+    1550, 1552, 1555, 1557, 1572, 1576, 1578, 1584, 1585, 1594, 1596, 1597, 1599, 1601, 341, 437,
+    454, 1659, 1665, 1675, 1679, 1683, 1685, 1686, 1689, 1693, 1703, 1710, 1719, 1734, 1735, 1737,
+    124, 140, 1761, 1762, 173, 1767, 1768, 1770, 1771, 1772, 1774, 1, 1778, 1787, 1788, 1789,
+    1799, 1809, 1810, 1819, 413, 1, 424, 455, 1875, 1879, 1912, 1915, 1917, 1931, 1940, 1959,
+    1960, 1961, 454, 208, 2011, 2039, 2056, 2062, 2063, 2064, 2065, 2066, 117, 2094, 2095, 2098,
+    2103, 2111, 2120, 2129, 2130, 239, 2143, 331, 2157, 2170, 449, 56, 67, 68, 2215, 2232,
+    196, 2241, 2243, 2245, 2251, 2252, 2259, 296, 2271, 2279, 26, 2283, 2285, 2295, 2297, 2299,
+    2300, 2302, 455, 2323, 2324, 2328, 2331, 2332, 2336, 2354, 2355, 2363, 2368, 2370, 2374, 2375,
+    2376, 2377, 2378, 2380, 2397, 2398, 2404, 392, 2416, 2418, 449, 1, 2549, 2550, 2551, 2559,
+    2561, 2565, 2572, 2573, 2678, 338, 106, 690, 691, 1123, 1129, 1143, 119, 232, 1072, 1089,
+    1143, 1154, 1424, 1426, 1437, 1440, 1441, 1443, 1483, 1579, 1762, 401, 1969, 2157, 196, 627,
+    629, 635, 640, 135, 653, 664, 678, 681, 682, 689, 702, 376, 706, 398, 725, 726,
+    728, 742, 785, 847, 849, 935, 957, 984, 1006, 1012, 1016, 1026, 175, 1, 1052, 182,
+    1078, 1, 1088, 1090, 1093, 1095, 1111, 1115, 1120, 1123, 376, 1125, 1128, 1134, 409, 1142,
+    1162, 1163, 1173, 1232, 1243, 56, 1367, 67, 1370, 1371, 1373, 1382, 1384, 108, 1386, 1387,
+    111, 1388, 1390, 1391, 1405, 1406, 1408, 1410, 1412, 1417, 283, 1432, 1434, 1435, 1438, 1441,
+    1444, 1445, 1454, 1489, 1, 1495, 1496, 1502, 1521, 69, 72, 1568, 1570, 1572, 147, 1574,
+    155, 168, 1593, 1596, 341, 1622, 347, 1679, 1686, 1696, 1703, 1844, 1849, 88, 1857, 1875,
+    1876, 188, 1880, 1907, 1916, 1917, 1924, 1930, 1932, 360, 1937, 1940, 1943, 1, 398, 1954,
+    1956, 1957, 1966, 456, 51, 2001, 2003, 2016, 2018, 218, 2328, 2332, 2344, 2351, 2354, 2363,
+    2372, 2380, 2425, 90, 100, 2446, 2458, 151, 217, 2482, 2483, 2484, 292, 310, 2495, 2523,
+    2524, 2550, 2553, 178, 2647, 314, 2669, 2673, 632, 634, 103, 651, 653, 217, 667, 668,
+    670, 671, 277, 1, 684, 690, 693, 376, 706, 381, 390, 396, 398, 722, 726, 727,
+    728, 764, 784, 785, 235, 1, 1032, 135, 190, 1074, 1076, 1083, 1, 1087, 1089, 1090,
+    1091, 1094, 1095, 338, 1129, 1143, 1146, 1147, 1148, 1152, 1388, 119, 1423, 1424, 1438, 1440,
+    1441, 1443, 1444, 1450, 1451, 1461, 1481, 1486, 1491, 1495, 1657, 1665, 1786, 1860, 1868, 188,
+    1889, 1895, 1907, 1915, 1916, 1917, 1919, 323, 1937, 1943, 398, 1955, 1959, 444, 455, 1985,
+    1999, 2001, 2010, 2013, 2016, 231, 232, 2031, 2032, 2034, 346, 2050, 196, 129, 2469, 2479,
+    631, 1, 632, 637, 650, 670, 277, 677, 302, 684, 685, 702, 704, 706, 381, 707,
+    396, 722, 725, 729, 740, 741, 743, 829, 843, 847, 848, 849, 861, 865, 882, 58,
+    915, 936, 215, 948, 949, 958, 239, 992, 994, 454, 470, 1011, 76, 93, 102, 1051,
+    1052, 1069, 1072, 1081, 1083, 1090, 1114, 1120, 1123, 1125, 386, 1, 1138, 1141, 1143, 1145,
+    1149, 1163, 1203, 51, 1239, 1240, 1242, 196, 1250, 215, 1258, 233, 1265, 1283, 401, 408,
+    450, 1299, 1368, 1369, 76, 1374, 1391, 1400, 1407, 1417, 1432, 1441, 1443, 1478, 1491, 1495,
+    1496, 1497, 1498, 1527, 1529, 1534, 389, 1577, 1679, 1778, 235, 1852, 1855, 1858, 1875, 1889,
+    1897, 1899, 1905, 1907, 1908, 1910, 26, 1912, 1915, 1917, 1933, 1937, 1951, 398, 1956, 1957,
+    1966, 1968, 474, 2039, 2203, 2209, 2214, 2233, 2245, 2246, 2266, 2267, 2277, 2279, 2295, 2324,
+    2354, 2369, 2372, 2373, 2377, 229, 2405, 2407, 2422, 2458, 165, 2465, 2467, 285, 2484, 431,
+    669, 703, 398, 722, 728, 51, 762, 772, 785, 790, 813, 847, 848, 856, 859, 868,
+    328, 886, 887, 888, 429, 900, 904, 117, 930, 946, 954, 958, 976, 994, 306, 1129,
+    1146, 1205, 1232, 1234, 1240, 1241, 1242, 1255, 1261, 233, 281, 1272, 1287, 1293, 1297, 1299,
+    1380, 1390, 1406, 1421, 1443, 1450, 1487, 1488, 1491, 1494, 1526, 1528, 218, 1556, 1558, 1565,
+    1576, 1577, 155, 167, 1584, 1586, 1587, 1588, 1589, 1591, 1593, 1594, 1596, 1597, 1598, 1604,
+    1614, 1616, 1619, 1627, 1639, 1644, 1645, 1648, 1660, 1662, 1667, 79, 85, 138, 1675, 1677,
+    1679, 1682, 216, 1683, 1686, 285, 1698, 1703, 1712, 364, 1725, 1730, 1739, 127, 1757, 1762,
+    1774, 216, 1787, 1788, 234, 1790, 1800, 1805, 1808, 1810, 1811, 1824, 413, 1827, 1828, 1837,
+    461, 1864, 1865, 1932, 373, 1956, 1992, 1998, 2001, 2002, 2016, 232, 2018, 2029, 2032, 1,
+    56, 2070, 2072, 2091, 2097, 2103, 2107, 2114, 2117, 2119, 2123, 2125, 2126, 2130, 234, 2143,
+    2146, 2153, 345, 2166, 377, 2176, 412, 2184, 2185, 437, 2192, 2206, 2214, 2218, 2219, 218,
+    2252, 2253, 2276, 2278, 2281, 2295, 2299, 2332, 2349, 2354, 2355, 2362, 2363, 2370, 2373, 2380,
+    2400, 76, 2444, 100, 155, 302, 303, 2550, 2551, 2554, 2564, 2565, 2570, 117, 2587, 2589,
+    308, 2623, 632, 633, 637, 649, 664, 672, 680, 682, 689, 323, 698, 700, 703, 704,
+    706, 726, 727, 730, 1011, 1030, 1032, 1037, 157, 1069, 1072, 1087, 1088, 1095, 338, 1120,
+    1125, 1126, 1127, 1128, 1130, 1131, 390, 1147, 1149, 1308, 1318, 1321, 1322, 1327, 218, 1329,
+    1331, 1335, 239, 326, 1346, 1348, 1368, 1378, 1382, 111, 1388, 1390, 1391, 138, 1399, 1417,
+    1426, 1437, 1440, 1448, 1457, 1495, 1500, 1556, 1558, 1584, 1586, 218, 1589, 1593, 333, 1644,
+    1, 148, 1871, 1888, 1895, 1904, 1917, 1949, 411, 1957, 1966, 1985, 1992, 1995, 1996, 1998,
+    1999, 2032, 74, 2093, 140, 2095, 2098, 148, 2099, 2102, 2103, 2104, 2106, 2121, 2125, 2129,
+    2151, 2153, 331, 2155, 2161, 2162, 2234, 2243, 2324, 2376, 2397, 2407, 2425, 2442, 2470, 386,
+    2527, 431, 433, 58, 68, 2441, 1, 2459, 155, 2465, 2468, 627, 629, 634, 103, 641,
+    648, 175, 673, 676, 677, 678, 682, 683, 307, 684, 687, 342, 692, 693, 702, 704,
+    706, 728, 741, 742, 743, 754, 51, 759, 783, 785, 840, 847, 848, 215, 865, 901,
+    913, 945, 948, 953, 1008, 1010, 1011, 1014, 72, 1017, 1022, 1024, 1025, 1026, 1030, 1032,
+    161, 1046, 1048, 177, 1053, 1065, 1072, 1077, 1095, 1112, 1114, 1118, 1125, 1128, 1131, 1,
+    1141, 1142, 1143, 1147, 1149, 1152, 1161, 1162, 1163, 1164, 1165, 1169, 1242, 1244, 1254, 1258,
+    1261, 233, 1279, 1304, 51, 56, 1366, 76, 1378, 1380, 1382, 1384, 1390, 1399, 1400, 1402,
+    1410, 1413, 1423, 1430, 1432, 1434, 1435, 1438, 1440, 1441, 1443, 1464, 359, 1478, 1480, 1483,
+    1489, 1493, 1494, 1496, 1500, 1502, 1503, 1504, 1529, 206, 1537, 267, 370, 1, 139, 152,
+    1589, 1596, 1658, 1675, 1677, 1686, 1687, 1689, 1731, 1755, 1761, 1763, 160, 216, 1788, 1789,
+    235, 1811, 1852, 88, 1860, 1868, 151, 164, 1873, 1891, 1895, 1907, 1908, 1911, 1912, 1915,
+    1917, 1921, 337, 344, 1930, 1932, 1940, 1943, 1955, 411, 1959, 431, 437, 461, 1968, 70,
+    1990, 1996, 1998, 1999, 2016, 2093, 2095, 2100, 2103, 2126, 2131, 2157, 2161, 507, 2209, 2224,
+    2232, 2233, 2235, 196, 2243, 2272, 2325, 2328, 137, 2351, 2352, 2365, 2369, 2371, 2372, 2374,
+    2375, 2380, 2383, 2405, 2406, 2407, 2410, 147, 2458, 185, 2465, 2486, 310, 2491, 2518, 2528,
+    144, 2549, 2550, 2551, 2552, 160, 216, 2566, 2651, 396, 102, 636, 637, 667, 669, 672,
+    673, 277, 302, 681, 691, 725, 728, 733, 745, 827, 828, 831, 832, 837, 838, 843,
+    849, 850, 208, 855, 861, 234, 869, 870, 330, 879, 882, 886, 508, 1012, 72, 1024,
+    1026, 1030, 124, 190, 1070, 1071, 279, 1078, 1080, 1081, 1083, 1087, 1088, 1089, 1090, 306,
+    1091, 1095, 1109, 1117, 1, 381, 1128, 390, 1136, 1143, 450, 1163, 1170, 1321, 157, 1331,
+    1332, 1333, 1337, 329, 1344, 1346, 1348, 1379, 1390, 1391, 1415, 1421, 281, 1438, 1441, 1443,
+    1457, 1469, 1471, 1496, 1529, 1534, 507, 1559, 1597, 1623, 1662, 1663, 1673, 1675, 1689, 1701,
+    1855, 175, 1874, 1893, 1894, 1897, 1902, 1903, 1, 1912, 1916, 1931, 372, 373, 1969, 1978,
+    1981, 1983, 1991, 1996, 1997, 1998, 2002, 2005, 2011, 2015, 2016, 2017, 281, 335, 2029, 2031,
+    2033, 2062, 2064, 2204, 68, 2228, 2230, 2233, 155, 196, 214, 218, 2246, 2247, 2261, 2277,
+    2315, 2328, 2330, 2331, 2332, 2333, 2334, 2336, 2346, 2354, 158, 2362, 1, 2368, 2370, 2372,
+    2373, 2377, 231, 2386, 2391, 2397, 2398, 340, 2399, 2404, 2406, 392, 2409, 2424, 2432, 61,
+    232, 2467, 2484, 2498, 226, 2649, 314, 2665, 2675, 628, 629, 635, 643, 654, 663, 667,
+    669, 670, 269, 671, 673, 677, 678, 681, 689, 691, 692, 695, 700, 702, 704, 706,
+    711, 398, 724, 728, 733, 738, 750, 4, 848, 849, 1005, 1006, 1013, 1020, 1026, 1032,
+    1052, 1053, 1, 1070, 1072, 1075, 1078, 1087, 1088, 1089, 1090, 1095, 1110, 1122, 373, 376,
+    1125, 1127, 390, 1, 1142, 1148, 1304, 1306, 1313, 144, 1323, 1327, 1329, 1331, 1342, 1343,
+    335, 1347, 1348, 501, 1365, 51, 1368, 1371, 102, 1384, 1387, 1391, 1399, 177, 1418, 1424,
+    1435, 1436, 1438, 1441, 1444, 1448, 327, 1457, 1479, 1481, 1487, 1488, 1489, 1491, 426, 461,
+    1506, 512, 1556, 1, 139, 1577, 155, 218, 1860, 1866, 1879, 1883, 1899, 1905, 1906, 26,
+    1912, 1919, 323, 1937, 1940, 1960, 454, 456, 467, 2065, 2066, 2069, 2076, 2079, 2091, 2095,
+    148, 2117, 2119, 2124, 2131, 2153, 2155, 2156, 2157, 2159, 2161, 2163, 2191, 2194, 2215, 2355,
+    2406, 2439, 2443, 2489, 1, 2507, 2509, 2511, 2512, 392, 2596, 350, 2659, 356, 644, 680,
+    684, 700, 703, 706, 388, 772, 153, 785, 789, 215, 865, 869, 935, 936, 938, 946,
+    948, 957, 958, 973, 402, 1009, 1090, 1094, 1095, 1125, 198, 1258, 1423, 1443, 1474, 1493,
+    1502, 1550, 1559, 1563, 1565, 1574, 184, 1584, 1593, 1596, 1601, 1604, 1630, 1635, 1636, 1637,
+    449, 1657, 1669, 85, 1686, 1704, 1733, 1761, 1785, 1786, 1788, 235, 415, 1826, 1827, 1946,
+    1998, 2010, 2016, 2037, 2048, 2051, 1, 56, 2070, 2076, 79, 2091, 164, 173, 2117, 219,
+    2125, 2126, 2130, 239, 2139, 2148, 2161, 2166, 2168, 2176, 2183, 2184, 2185, 53, 2207, 2208,
+    2216, 2223, 2232, 214, 2244, 2261, 2288, 2297, 2302, 2315, 2324, 2336, 2343, 2349, 2351, 2375,
+    2377, 2378, 2380, 2384, 2393, 2394, 2397, 2398, 2402, 635, 638, 650, 655, 670, 673, 278,
+    678, 684, 694, 706, 728, 442, 1, 1073, 1074, 281, 1093, 1096, 373, 1123, 1125, 1126,
+    1129, 1130, 1, 1143, 1147, 1154, 1366, 1368, 1390, 1391, 1415, 1423, 1438, 1439, 1440, 1443,
+    1455, 1459, 1462, 1475, 1484, 1488, 1492, 1496, 1498, 437, 1503, 1883, 231, 1893, 1895, 1901,
+    1903, 1908, 1937, 1940, 1949, 1957, 1958, 628, 650, 654, 665, 1, 388, 722, 726, 743,
+    1011, 1013, 126, 146, 1044, 157, 1073, 1143, 1390, 1424, 1440, 1443, 1481, 1495, 1577, 1593,
+    1891, 1968, 2074, 2130, 2277, 633, 654, 1027, 1125, 1128, 1329, 1391, 1431, 1432, 1983, 1991,
+    1992, 2064, 842, 848, 877, 344, 375, 1143, 1601, 88, 1679, 1709, 1738, 216, 1915, 1920,
+    1992, 1998, 2023, 2045, 2071, 2117, 2244, 2249, 2251, 2295, 2302, 2315, 2363, 2370, 1128, 1368,
+    336, 1931, 117, 2947, 2974, 1827, 2994, 2185, 437, 3061, 3085, 680, 398, 1120, 1139, 3147,
+    3211, 679, 302, 691, 3225, 1069, 1329, 1498, 3297, 1942, 3373, 1120, 1125, 3386, 3398, 2131,
+    3449, 3467, 716, 1573, 3600, 3647, 2171, 3718, 2472, 3741, 1941, 719, 1095, 1100, 3843, 1106,
+    3913, 3916, 1083, 1109, 3944, 1400, 1915, 1919, 971, 1712, 1739, 1840, 1425, 1947, 111, 4271,
+    727, 4286, 1059, 4327, 649, 673, 680, 388, 1051, 1122, 4470, 4471, 1432, 4486, 4488, 4499,
+    4505, 2526, 1099, 1871, 4648, 421, 2077, 2300, 1028, 4935, 4936, 4964, 4981, 1956, 2091, 4999,
+    689, 5057, 5060, 1036, 1081, 5106, 5156, 1956, 1971, 5299, 5317, 1073, 5321, 1125, 5359, 2003,
+    5402, 2324, 5482, 5507, 5511, 1434, 1443, 1445, 5584, 1932, 1933, 455, 2118, 5686, 1737, 1744,
+    5687, 1089, 1120, 1378, 85, 1423, 373, 1493, 3170, 3180, 331, 3213, 703, 3225, 1107, 1323,
+    2150, 2373, 953, 1, 3396, 1400, 2072, 3666, 3778, 1073, 3886, 2459, 1786, 2351, 1089, 4293,
+    1, 1578, 1586, 1, 4423, 700, 4443, 4448, 729, 4466, 1120, 281, 1448, 1940, 1996, 4532,
+    674, 4539, 4541, 728, 4561, 957, 980, 4590, 1255, 1401, 1431, 4618, 4619, 1483, 267, 239,
+    52, 1959, 2218, 190, 2281, 2315, 2330, 2371, 4674, 4676, 231, 1004, 4931, 4939, 1424, 1493,
+    4966, 1893, 1940, 1956, 2233, 637, 640, 5039, 5043, 5047, 5057, 760, 5067, 5068, 5075, 1012,
+    5096, 5105, 5126, 1368, 5135, 5143, 5200, 2072, 689, 1, 2351, 2503, 2648, 5465, 5476, 1021,
+    1055, 1, 1120, 5521, 1143, 1317, 1318, 1321, 1345, 5559, 1500, 1908, 5609, 2328, 5615, 2503,
+    1251, 1588, 2243, 5742, 5770, 1120, 1127, 392, 1400, 5794, 1400, 246, 941, 1743, 2082, 3036,
+    3044, 2287, 2367, 3158, 1783, 3712, 2384, 218, 949, 4092, 4093, 1731, 1763, 4137, 371, 377,
+    4210, 2383, 4216, 4263, 727, 1141, 1440, 1914, 2491, 4757, 1669, 1733, 2148, 449, 4886, 5210,
+    409, 1194, 1828, 218, 2285, 2287, 2346, 5745, 2412, 785, 931, 932, 1559, 1601, 2937, 2971,
+    2978, 239, 437, 3004, 2156, 3061, 2299, 2335, 2383, 2539, 1911, 456, 932, 2071, 3708, 3915,
+    65, 3936, 1081, 1090, 1, 1129, 157, 1441, 1444, 211, 4065, 1232, 1733, 1756, 1, 4148,
+    4189, 4191, 2384, 700, 704, 1011, 1439, 4770, 4783, 2005, 2011, 2157, 2524, 722, 1, 5057,
+    1013, 1146, 5155, 1859, 138, 359, 1933, 398, 683, 5480, 5546, 1432, 5607, 437, 5677, 5679,
+    2065, 2072, 5710, 2287, 2372, 2383, 1616, 3065, 2383, 276, 3480, 798, 3482, 859, 3490, 870,
+    3493, 3522, 3565, 1595, 3588, 1685, 3596, 1704, 1705, 1731, 1828, 3672, 3693, 3710, 3712, 3719,
+    3743, 58, 4018, 4064, 1559, 4100, 1749, 239, 2099, 2102, 2185, 4280, 1, 4303, 4770, 1690,
+    1733, 342, 654, 5078, 1087, 1409, 5148, 5195, 2500, 1, 842, 1, 432, 79, 1933, 2901,
+    1242, 1576, 1622, 2949, 2972, 3033, 2119, 2123, 2183, 3071, 2363, 3081, 3106, 1, 1075, 302,
+    3247, 1309, 3269, 177, 1494, 1555, 1648, 1909, 1911, 1913, 1937, 3304, 148, 3327, 2469, 3396,
+    2474, 2477, 1123, 3784, 3794, 1444, 3808, 2519, 3863, 1825, 2453, 4263, 4272, 482, 1017, 1051,
+    1372, 1, 1378, 1400, 1413, 1443, 1483, 4342, 1550, 1, 680, 1378, 1417, 4480, 4482, 1483,
+    1490, 239, 4501, 4526, 678, 689, 4554, 946, 237, 1128, 1137, 4590, 1152, 108, 1483, 2328,
+    2362, 1284, 1985, 2155, 302, 4925, 4936, 1441, 4995, 2094, 143, 2150, 2369, 2526, 2464, 232,
+    681, 5057, 5068, 5076, 5083, 1063, 1, 1083, 1087, 1088, 1090, 5096, 5105, 5106, 1368, 102,
+    5133, 5134, 5145, 461, 5182, 5183, 239, 155, 2354, 70, 650, 5289, 1025, 5324, 1130, 5335,
+    1318, 5352, 5354, 1491, 5365, 5382, 5385, 5391, 5397, 231, 2039, 2243, 5428, 2374, 2376, 5446,
+    2407, 2408, 386, 5513, 5534, 5539, 1390, 5557, 1496, 5584, 5602, 219, 331, 5610, 870, 5743,
+    722, 5767, 5768, 306, 1091, 1121, 5835, 2936, 1688, 2184, 3075, 2479, 3472, 806, 1744, 2143,
+    1437, 826, 827, 831, 840, 842, 853, 855, 930, 4069, 1604, 4191, 2412, 650, 4303, 1938,
+    1972, 4414, 1744, 2077, 74, 2104, 2182, 1134, 5684, 1679, 2978, 239, 2383, 3568, 3570, 1599,
+    1733, 111, 3618, 3719, 456, 470, 853, 1, 4099, 4118, 641, 4280, 1483, 1851, 4592, 433,
+    4645, 1, 1938, 4797, 239, 239, 4850, 113, 5053, 5105, 157, 5634, 2332, 387, 1555, 1739,
+    111, 1, 1768, 1772, 239, 1827, 3001, 3020, 2076, 117, 2138, 2166, 2183, 2341, 3482, 831,
+    1604, 281, 1733, 2074, 2081, 3655, 3677, 2346, 1677, 4139, 1995, 2228, 4202, 2362, 4379, 460,
+    239, 1557, 2077, 4841, 2129, 2183, 2230, 2519, 2549, 5200, 1933, 1107, 5684, 1790, 5820, 2033,
+    1679, 2383, 2406, 1120, 1130, 1, 1494, 1, 700, 3273, 350, 2416, 2469, 302, 3359, 1368,
+    67, 1460, 1462, 1828, 3755, 1128, 1191, 3780, 1120, 425, 1789, 4258, 700, 1491, 1550, 650,
+    392, 4466, 4474, 1421, 4482, 1992, 4526, 839, 842, 962, 4583, 1142, 1215, 4597, 1267, 1494,
+    4624, 437, 2315, 1733, 1761, 370, 141, 217, 2467, 5086, 5132, 5156, 5173, 1, 2106, 1306,
+    5349, 340, 5363, 1556, 1907, 2206, 5414, 5415, 2323, 281, 5449, 627, 1120, 5520, 1137, 5532,
+    1378, 5544, 5551, 5555, 5562, 2071, 2440, 5767, 1, 1, 5776, 1, 1938, 1943, 1921, 2998,
+    1983, 3659, 3710, 2306, 3568, 2294, 1744, 4115, 1763, 4889, 216, 2890, 1441, 2963, 1763, 1827,
+    2084, 2332, 2349, 2383, 1303, 1329, 1123, 1125, 640, 714, 3497, 1240, 1667, 1749, 1803, 3648,
+    2218, 1, 3741, 706, 729, 862, 880, 1, 935, 4062, 1234, 1284, 85, 1750, 1790, 2365,
+    4205, 4222, 4334, 1483, 369, 4387, 4481, 4499, 640, 760, 802, 1243, 1254, 4783, 239, 1989,
+    2077, 2121, 4850, 155, 2273, 4886, 1443, 682, 1120, 5532, 1401, 2503, 5682, 1, 1693, 1790,
+    5735, 1230, 2306, 849, 1258, 65, 1589, 1593, 2937, 437, 1778, 2978, 239, 455, 208, 2111,
+    3039, 3041, 281, 2214, 2380, 2384, 1443, 3503, 3505, 948, 954, 1284, 1616, 1725, 1744, 413,
+    1827, 2174, 3710, 2330, 2363, 3727, 392, 909, 4087, 218, 4091, 4093, 1604, 4113, 4120, 4126,
+    1840, 4175, 4191, 4193, 392, 4705, 1069, 1481, 1570, 4753, 1763, 160, 1768, 1778, 4803, 239,
+    1799, 1801, 1804, 1809, 1, 4831, 2157, 160, 4875, 2520, 4909, 4912, 1309, 1401, 1940, 1952,
+    455, 1300, 985, 1557, 5677, 1242, 2934, 1689, 1739, 2979, 3027, 2299, 3067, 3085, 2519, 1,
+    1319, 1322, 1329, 1335, 454, 3389, 138, 208, 757, 1234, 1599, 3648, 3650, 3700, 3719, 1444,
+    1090, 1123, 1125, 364, 1, 4065, 1690, 1749, 4189, 4210, 2399, 1128, 453, 4303, 1366, 789,
+    842, 1484, 4768, 4777, 4782, 4786, 1688, 1690, 1726, 1760, 4803, 239, 2028, 2065, 2075, 2549,
+    148, 4995, 5286, 5294, 339, 2324, 1129, 1400, 5555, 1443, 2101, 5606, 285, 1194, 1577, 3061,
+    1443, 1589, 1309, 1323, 1555, 2066, 3312, 3320, 2399, 2469, 2507, 926, 1073, 3413, 3446, 412,
+    1494, 3798, 3833, 729, 1090, 239, 843, 935, 155, 1827, 2272, 4190, 4201, 4240, 721, 4301,
+    1143, 1380, 1, 1416, 1443, 1478, 1483, 1494, 4342, 218, 4368, 1919, 285, 4448, 1021, 4461,
+    4468, 4473, 1, 1378, 4482, 1675, 1875, 2041, 859, 4590, 160, 1865, 4644, 4646, 1941, 1961,
+    4669, 2351, 4675, 4927, 1306, 4939, 1443, 1487, 1952, 670, 5047, 5076, 1136, 5106, 5128, 437,
+    445, 2230, 2363, 5243, 208, 2367, 5250, 5305, 5363, 1497, 437, 5398, 5431, 2375, 2381, 5507,
+    1, 1129, 1143, 1319, 1322, 1, 1378, 1380, 758, 849, 1737, 1127, 5776, 5777, 5783, 5799,
+    935, 5831, 5851, 2914, 1234, 282, 1755, 437, 2065, 56, 3018, 3019, 3028, 2098, 2129, 3072,
+    2363, 2367, 2406, 381, 3503, 3505, 3565, 3601, 3624, 1, 3648, 56, 2129, 2141, 2142, 2185,
+    3715, 2384, 706, 1093, 1, 1420, 1443, 1491, 1915, 1917, 823, 855, 1284, 2361, 722, 1378,
+    1400, 4334, 4410, 1439, 4741, 1, 497, 505, 508, 4909, 1952, 752, 5082, 5083, 1040, 5088,
+    1069, 1078, 1090, 1135, 5104, 5105, 5107, 1450, 1488, 97, 1855, 1857, 5192, 1875, 398, 442,
+    5581, 5606, 775, 2354, 2412, 425, 664, 716, 1450, 461, 2882, 2889, 211, 950, 2902, 2912,
+    2948, 1679, 1707, 1758, 1768, 1776, 3004, 2009, 2095, 2123, 3082, 58, 2549, 3118, 3160, 1443,
+    3257, 1400, 1443, 711, 370, 863, 3492, 3493, 3496, 3497, 957, 3507, 1176, 3519, 1261, 3623,
+    1827, 3640, 2032, 3706, 3708, 3709, 3712, 2354, 2384, 3727, 3734, 2539, 3739, 3741, 3743, 2570,
+    3863, 1, 4021, 4025, 855, 935, 1088, 4057, 1231, 4092, 1663, 4107, 1, 2002, 2020, 4196,
+    2346, 4201, 4205, 2425, 4220, 2553, 2570, 1593, 2078, 1119, 1483, 4468, 4481, 802, 1069, 1112,
+    1202, 1527, 1, 1678, 4784, 1728, 4803, 1826, 1995, 2011, 2277, 4875, 2407, 2549, 737, 4925,
+    1, 1443, 5106, 5286, 1025, 5332, 1120, 634, 5513, 1350, 1400, 1423, 5551, 281, 5565, 2105,
+    5609, 359, 437, 5744, 225, 1072, 1, 5779, 1768, 888, 2930, 1577, 2961, 3001, 3082, 3112,
+    3222, 3224, 729, 3261, 1353, 1440, 456, 1936, 454, 2074, 2675, 1664, 1678, 1689, 1701, 1733,
+    1753, 1786, 420, 426, 2046, 2198, 3740, 154, 1894, 3981, 922, 926, 4041, 239, 1270, 1749,
+    4138, 4160, 4210, 4246, 4247, 2668, 4341, 461, 4433, 4489, 1894, 1230, 1550, 4757, 1649, 2003,
+    2009, 4899, 635, 1022, 1089, 4939, 4952, 1443, 1891, 1947, 61, 2467, 634, 5327, 1, 1310,
+    1368, 1400, 5354, 5356, 5395, 2503, 5477, 679, 5479, 5480, 388, 1, 5491, 5521, 1128, 1167,
+    5544, 1443, 102, 5581, 1915, 5587, 1938, 2067, 2077, 74, 2118, 2120, 2219, 2499, 267, 5696,
+    291, 2125, 5884, 789, 2882, 2919, 1426, 2932, 1600, 2937, 2938, 2953, 2961, 2993, 3002, 3004,
+    3041, 377, 3080, 3096, 232, 1323, 3258, 634, 3455, 3527, 3559, 3561, 1667, 3601, 3608, 3623,
+    2110, 3665, 3666, 2129, 239, 3672, 1, 2285, 2362, 3911, 1012, 1013, 232, 1, 1378, 1445,
+    1864, 3968, 1866, 3970, 1891, 3980, 2642, 2668, 1, 729, 1604, 4108, 1749, 1805, 4139, 4191,
+    2679, 1, 1, 1400, 4705, 4768, 1728, 1733, 2121, 239, 4877, 2580, 5037, 635, 637, 665,
+    5060, 1005, 1081, 5126, 5129, 5130, 108, 5192, 5194, 5196, 5200, 323, 1931, 5205, 1933, 5208,
+    5296, 2118, 5690, 2129, 2145, 1982, 2907, 3020, 1128, 1443, 3171, 3389, 1396, 1401, 323, 1827,
+    2123, 1318, 4092, 4222, 4272, 848, 4277, 1443, 1483, 1557, 1585, 4355, 2233, 2404, 281, 4481,
+    4505, 1483, 4671, 4672, 2355, 1129, 1443, 2031, 2369, 1, 1013, 1192, 5126, 1407, 1593, 5232,
+    2355, 2362, 5246, 5332, 1593, 5433, 1091, 1423, 5555, 1443, 5559, 5581, 859, 2920, 2935, 239,
+    3037, 2383, 2452, 1604, 1805, 1834, 3654, 3657, 3658, 3660, 3662, 3666, 2143, 3678, 2184, 2297,
+    3710, 2354, 670, 922, 926, 932, 4041, 4091, 4092, 4181, 2562, 4736, 1470, 2065, 2347, 1242,
+    3061, 2548, 3107, 3465, 3472, 253, 4041, 1604, 1744, 4746, 4887, 691, 5153, 5154, 906, 1690,
+    681, 1026, 232, 3253, 2297, 1550, 796, 4473, 208, 1763, 1378, 2407, 5533, 1, 208, 935,
+    2380, 5246, 5433, 3711, 425, 2956, 51, 2155, 1424, 190, 4848, 1699, 3671, 893, 2184, 2467,
+    6485, 1576, 5776, 2142, 2271, 1907, 2962, 2152, 333, 160, 4516, 308, 2183, 3072, 1380, 2185,
+    3526, 6835, 2354, 216, 6849, 6850, 5738, 1148, 1756, 729, 913, 3723, 1656, 4869, 1009, 7178,
+    3106, 1689, 7205, 3588, 1683, 229, 231, 3592, 235, 3666, 4944, 4963, 5465, 154, 7418, 7421,
+    2026, 1377, 732, 935, 4586, 1744, 4020, 4196, 6185, 1599, 1483, 1828, 6820, 3623, 2940, 2294,
+    1471, 628, 4093, 957, 7169, 7178, 2383, 3251, 1323, 3405, 1733, 5047, 1714, 2145, 3944, 4138,
+    1690, 5523, 426, 1527, 1242, 912, 6118, 6654, 1502, 1192, 1400, 1401, 2248, 1, 2346, 4354,
+    5433, 2374, 1709, 6475, 2971, 2978, 1165, 1749, 4115, 6647, 3022, 4948, 2299, 3080, 2372, 4704,
+    1024, 5195, 4401, 302, 1915, 1, 3284, 1593, 6373, 1, 1920, 4675, 6454, 217, 1215, 729,
+    4472, 373, 2919, 1728, 417, 263, 1671, 2020, 2028, 6073, 2283, 6234, 4066, 1710, 5672, 4127,
+    4837, 2222, 6739, 370, 4070, 4211, 1284, 4802, 3257, 650, 1322, 3893, 3723, 1759, 1018, 3077,
+    1737, 1, 1236, 1243, 1, 2187, 461, 932, 7326, 4190, 7346, 1469, 441, 263, 4210, 2383,
+    1587, 2188, 5174, 726, 4354, 2346, 2915, 2588, 1506, 1, 1, 4696, 2380, 4837, 1506, 2000,
+    3005, 3006, 7175, 1, 4598, 711, 5217, 2354, 4355, 4921, 6702, 1321, 1, 239, 1959, 4471,
+    5602, 844, 1494, 3623, 1028, 1593, 6908, 2076, 1593, 2343, 2349, 6921, 2503, 392, 2076, 5114,
+    2383, 4783, 2070, 3696, 4114, 1, 4905, 5439, 6389, 6667, 4592, 7070, 4115, 5066, 5508, 262,
+    2898, 3326, 1089, 4448, 1884, 1, 1120, 5776, 3041, 726, 4627, 5535, 6704, 108, 2064, 1755,
+    926, 2898, 3191, 1, 729, 5387, 281, 1, 214, 1778, 4627, 677, 506, 3259, 2518, 1353,
+    5119, 5145, 5568, 1382, 327, 3892, 6490, 2121, 1493, 1553, 1591, 6670, 281, 4621, 2527, 5332,
+    5451, 6966, 1558, 6992, 501, 1487, 4622, 1856, 1869, 5200, 5530, 2248, 7080, 4864, 102, 2382,
+    1, 851, 6139, 1143, 2503, 2294, 102, 3120, 3833, 4127, 3608, 3781, 1128, 7002, 1093, 4488,
+    1488, 1897, 4981, 392, 1079, 235, 5465, 1898, 6255, 5587, 1604, 4205, 6331, 6332, 6540, 4672,
+    2351, 2297, 340, 4210, 1264, 4807, 6821, 3485, 3678, 6838, 4462, 6933, 2141, 2398, 231, 7099,
+    1, 1599, 7172, 2294, 1346, 378, 1502, 3301, 2383, 7349, 7372, 7418, 2297, 3711, 1105, 1137,
+    643, 842, 2146, 1, 946, 1667, 628, 650, 190, 669, 6104, 5531, 5602, 628, 1491, 1662,
+    1556, 1559, 4191, 3893, 821, 1731, 1736, 356, 4864, 7196, 3583, 156, 2280, 3715, 843, 865,
+    4721, 2454, 4778, 1134, 2346, 2377, 1450, 2250, 2251, 1827, 2543, 6025, 1899, 3407, 4473, 1309,
+    6137, 1, 4118, 2077, 1466, 1898, 6360, 6365, 1, 1952, 6475, 5426, 2118, 1, 5776, 5777,
+    1902, 4970, 1, 1, 1129, 1, 1558, 2012, 1136, 4471, 5397, 5608, 3099, 2067, 7484, 4301,
+    1145, 4912, 6211, 2396, 1501, 328, 433, 2503, 5052, 4438, 4469, 1496, 2350, 1143, 1, 3389,
+    1145, 1137, 60, 26, 2527, 4941, 4946, 2891, 862, 3944, 859, 4747, 2187, 671, 1497, 211,
+    1, 7326, 7348, 1830, 426, 7429, 2065, 725, 733, 1377, 2012, 1596, 1123, 3173, 6025, 1,
+    4355, 4914, 1400, 2889, 4300, 6415, 144, 1, 1401, 1506, 6453, 5415, 6574, 4713, 973, 4724,
+    1527, 4845, 239, 1556, 4354, 140, 5438, 6966, 1881, 4533, 865, 892, 1497, 3106, 3107, 2552,
+    634, 7217, 843, 853, 1199, 4721, 156, 4825, 4827, 2028, 3258, 1377, 5176, 2077, 689, 6713,
+    1, 1947, 7217, 4065, 1443, 1123, 4092, 4138, 4778, 6043, 1396, 5646, 1061, 281, 6441, 5173,
+    2381, 350, 841, 132, 5434, 3037, 1141, 4354, 3001, 7233, 2530, 429, 5433, 628, 6838, 1604,
+    5178, 6451, 2378, 2178, 5172, 843, 5471, 1129, 5427, 8048, 6148, 5431, 1143, 190, 818, 4671,
+    789, 1557, 4471, 7172, 2049, 2161, 1731, 1, 1781, 5359, 6667, 6106, 4781, 1737, 4334, 7775,
+    3718, 1572, 3781, 7511, 6671, 6488, 1111, 1574, 1, 1, 5562, 5104, 6093, 4941, 3694, 2361,
+    4201, 2334, 1443, 1443, 281, 3746, 1430, 6666, 2967, 6910, 6667, 6035, 129, 3080, 1073, 1,
+    6035, 7343, 7344, 1, 6231, 1749, 4026, 1423, 2354, 2355, 7960, 7254, 1494, 3263, 7712, 6540,
+    6671, 6515, 2161, 4728, 1, 4767, 2384, 5433, 1933, 1469, 1917, 4220, 5433, 5448, 1284, 4265,
+    4271, 2005, 1494, 2020, 3247, 437, 967, 969, 1827, 2355, 7688, 333, 6837, 7773, 6264, 1377,
+    4955, 5039, 2123, 1865, 7174, 4205, 1079, 3694, 249, 1145, 2409, 2411, 1724, 2410, 2387, 2328,
+    818, 4764, 7689, 3257, 3839, 1378, 2399, 5776, 2889, 3780, 450, 4980, 1897, 818, 5057, 733,
+    1, 7005, 1, 1494, 1985, 7375, 708, 8067, 392, 5236, 7711, 3712, 2401, 7701, 6672, 6515,
+    7806, 4291, 1, 1, 7846, 983, 8102, 1143, 8294, 4202, 1789, 5769, 6738, 4948, 1, 5524,
+    239, 953, 1, 214, 2240, 1487, 6228, 2174, 4753, 4764, 4765, 3080, 1919, 1443, 2203,
+};
+
+constexpr uint16_t en_levels[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 33, 65, 0, 0, 0, 1,
+    97, 0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 226, 0,
+    273, 306, 0, 65, 353, 386, 226, 306, 0, 97, 0, 435, 273, 0, 65, 498,
+    0, 545, 577, 0, 273, 545, 609, 643, 705, 545, 65, 0, 739, 178, 0, 545,
+    0, 802, 65, 705, 850, 0, 226, 0, 898, 0, 65, 946, 0, 65, 995, 545,
+    65, 545, 1059, 0, 545, 65, 65, 1, 0, 178, 0, 0, 0, 65, 0, 850,
+    33, 65, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 97, 0, 0, 0,
+    0, 545, 498, 97, 0, 226, 97, 545, 1122, 97, 97, 545, 498, 0, 1170, 273,
+    1217, 545, 545, 577, 353, 0, 1251, 0, 0, 33, 65, 0, 545, 577, 545, 33,
+    0, 0, 577, 545, 0, 65, 0, 65, 65, 0, 97, 995, 226, 178, 0, 498,
+    1314, 1251, 0, 0, 65, 0, 178, 0, 0, 273, 1362, 0, 273, 577, 1411, 577,
+    97, 0, 0, 0, 273, 273, 0, 97, 0, 0, 65, 273, 498, 0, 97, 0,
+    1473, 545, 0, 0, 0, 65, 0, 577, 353, 65, 353, 65, 65, 0, 0, 0,
+    1251, 705, 65, 0, 178, 1251, 273, 0, 273, 995, 1170, 0, 97, 0, 65, 273,
+    1059, 0, 273, 226, 1059, 97, 0, 0, 178, 545, 545, 226, 498, 0, 226, 273,
+    0, 97, 226, 65, 226, 545, 226, 306, 1251, 97, 545, 97, 545, 995, 0, 0,
+    0, 577, 0, 995, 0, 65, 1506, 226, 705, 1251, 0, 850, 65, 65, 1059, 65,
+    0, 898, 850, 0, 97, 97, 0, 0, 0, 0, 0, 0, 898, 33, 705, 273,
+    0, 0, 1, 33, 0, 65, 0, 0, 0, 33, 0, 0, 0, 0, 545, 226,
+    353, 0, 97, 97, 0, 0, 1555, 1619, 226, 1170, 0, 226, 33, 1059, 178, 0,
+    577, 33, 0, 65, 65, 0, 0, 65, 33, 353, 0, 577, 0, 65, 65, 0,
+    0, 65, 850, 1506, 0, 0, 0, 65, 0, 0, 33, 498, 0, 498, 0, 306,
+    1170, 1, 0, 33, 898, 178, 850, 545, 0, 0, 65, 273, 0, 545, 97, 33,
+    1681, 545, 178, 97, 226, 0, 178, 226, 0, 0, 273, 226, 1059, 545, 226, 0,
+    1251, 739, 545, 97, 353, 545, 97, 0, 0, 0, 0, 0, 0, 0, 1714, 705,
+    97, 0, 0, 0, 0, 0, 0, 273, 0, 577, 898, 0, 0, 545, 0, 0,
+    0, 1314, 1681, 0, 65, 577, 0, 0, 33, 1681, 0, 0, 1762, 705, 0, 0,
+    97, 353, 65, 1810, 65, 65, 577, 577, 577, 65, 898, 65, 353, 0, 65, 65,
+    65, 0, 0, 306, 65, 0, 0, 0, 850, 0, 0, 0, 0, 65, 609, 97,
+    273, 178, 1473, 97, 545, 0, 1251, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1857, 1889, 0, 0, 0, 0, 0,
+    0, 0, 1857, 0, 1889, 0, 0, 0, 0, 1921, 0, 1921, 1889, 0, 0, 0,
+    1889, 1889, 0, 0, 0, 1889, 0, 0, 0, 0, 1953, 0, 0, 0, 0, 0,
+    0, 1889, 0, 0, 1889, 0, 0, 0, 0, 0, 0, 1889, 0, 0, 1921, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1889, 1889, 0, 1857,
+    1889, 1857, 1857, 1889, 1889, 0, 0, 0, 1921, 0, 0, 0, 0, 0, 0, 1857,
+    1985, 0, 1889, 0, 0, 0, 1985, 0, 0, 0, 0, 2018, 0, 0, 0, 0,
+    0, 2065, 0, 0, 0, 0, 1985, 2097, 1857, 0, 0, 2129, 2162, 2129, 2209, 0,
+    2241, 2273, 2273, 2097, 2273, 2305, 0, 0, 2338, 0, 0, 0, 0, 2065, 2129, 0,
+    1985, 0, 0, 1985, 0, 0, 2209, 0, 0, 1985, 0, 2065, 0, 0, 0, 1857,
+    0, 0, 0, 0, 0, 0, 0, 2209, 0, 0, 2273, 0, 0, 0, 0, 0,
+    0, 0, 2129, 0, 0, 2385, 2417, 0, 0, 1985, 0, 0, 0, 0, 2097, 0,
+    0, 0, 0, 0, 0, 2209, 0, 1985, 0, 0, 2449, 0, 0, 2209, 2209, 2097,
+    0, 2482, 0, 2417, 0, 0, 2209, 0, 2129, 0, 0, 2417, 0, 1857, 0, 0,
+    1857, 1857, 0, 0, 2529, 0, 0, 0, 0, 0, 0, 0, 2561, 2097, 2209, 0,
+    1985, 0, 2594, 0, 2561, 2642, 0, 2690, 2737, 0, 2417, 0, 2385, 2097, 2737, 2770,
+    2561, 0, 0, 2385, 0, 0, 0, 2241, 0, 0, 2737, 2097, 0, 0, 0, 2737,
+    0, 2818, 0, 0, 0, 0, 0, 0, 2097, 2241, 2273, 0, 0, 0, 0, 2097,
+    0, 0, 0, 2529, 1857, 0, 0, 0, 2690, 2866, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2065, 0, 2737, 0, 2561, 2737, 0, 0, 1857, 1857, 1985, 0,
+    1889, 0, 2914, 0, 0, 2737, 2961, 0, 0, 0, 1985, 0, 2065, 2065, 0, 0,
+    0, 2994, 2529, 2417, 0, 0, 0, 1857, 0, 1889, 2065, 1857, 0, 0, 0, 0,
+    0, 0, 0, 1953, 0, 0, 0, 0, 1889, 0, 0, 0, 2209, 0, 0, 0,
+    2241, 3041, 2241, 2241, 0, 0, 2737, 0, 0, 2561, 3074, 1857, 2529, 3123, 0, 1985,
+    2065, 0, 3186, 0, 0, 2737, 2818, 2529, 0, 0, 2065, 0, 0, 0, 2994, 0,
+    0, 0, 0, 2241, 2561, 2129, 2273, 0, 1889, 2129, 2129, 1985, 2241, 0, 2129, 2209,
+    2529, 3235, 0, 2737, 0, 2449, 0, 0, 0, 2449, 2561, 0, 1889, 1953, 0, 3298,
+    3346, 0, 0, 2770, 3346, 2065, 2737, 0, 2529, 2866, 2241, 0, 0, 0, 0, 0,
+    2241, 2737, 0, 2097, 0, 2737, 0, 1857, 0, 0, 0, 1985, 2097, 2241, 2241, 0,
+    2209, 3394, 2385, 0, 2097, 0, 0, 2097, 0, 1985, 2529, 0, 3442, 0, 1953, 0,
+    2097, 0, 0, 0, 0, 2385, 2385, 0, 0, 2273, 0, 0, 2449, 0, 2385, 0,
+    0, 2449, 0, 2449, 3490, 3538, 0, 0, 1985, 1985, 0, 0, 2385, 0, 2385, 0,
+    2385, 0, 3586, 3634, 0, 2305, 0, 2561, 0, 0, 0, 0, 0, 0, 2961, 0,
+    0, 2529, 0, 2305, 2961, 1889, 0, 0, 0, 0, 0, 0, 0, 2449, 0, 2385,
+    2385, 0, 0, 0, 0, 0, 0, 2961, 2449, 0, 0, 0, 0, 0, 2273, 0,
+    0, 0, 0, 0, 1985, 1985, 0, 0, 0, 0, 3538, 2305, 2385, 3682, 2273, 0,
+    2449, 1857, 2241, 0, 2305, 2209, 0, 0, 0, 0, 2449, 0, 0, 0, 0, 0,
+    2129, 2065, 0, 0, 2129, 2129, 3730, 0, 2065, 2129, 0, 1985, 0, 3442, 2385, 3778,
+    1985, 2449, 0, 0, 0, 2449, 2065, 0, 0, 2097, 0, 0, 0, 0, 1985, 0,
+    0, 0, 0, 2961, 0, 2305, 2273, 0, 1857, 0, 0, 0, 2449, 0, 2305, 2449,
+    0, 2273, 0, 2561, 2529, 0, 1857, 0, 0, 1985, 0, 0, 0, 2529, 0, 0,
+    1985, 0, 2097, 0, 2065, 0, 0, 0, 1953, 1857, 0, 0, 0, 2209, 2417, 0,
+    0, 0, 0, 2065, 0, 0, 0, 0, 0, 0, 0, 3826, 2529, 2385, 3041, 0,
+    0, 1889, 0, 2241, 2209, 0, 1985, 0, 0, 0, 0, 0, 1857, 0, 2065, 0,
+    0, 0, 0, 1985, 2065, 2065, 0, 0, 2561, 2561, 0, 0, 0, 2097, 2209, 0,
+    1857, 0, 0, 0, 2529, 3874, 2449, 0, 1857, 0, 0, 2529, 2737, 0, 2097, 2529,
+    2737, 1857, 2561, 0, 2737, 2241, 2097, 0, 2449, 2449, 2737, 3041, 2529, 3923, 0, 1889,
+    2529, 0, 0, 1953, 0, 0, 0, 2241, 0, 0, 1921, 2097, 2065, 0, 2737, 2737,
+    2162, 3987, 0, 0, 0, 0, 0, 0, 0, 2097, 0, 0, 0, 0, 0, 0,
+    2529, 0, 0, 2241, 0, 0, 2385, 0, 3041, 0, 2449, 2097, 1857, 0, 0, 0,
+    0, 4050, 0, 0, 0, 2097, 0, 0, 0, 2385, 0, 2209, 0, 0, 0, 2097,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2241, 0, 0, 2241, 2097, 0,
+    0, 0, 2097, 0, 0, 2385, 2209, 1857, 2209, 0, 0, 0, 1857, 0, 2449, 2305,
+    2449, 0, 0, 0, 0, 1985, 2065, 0, 0, 4098, 0, 0, 0, 2961, 0, 2209,
+    0, 0, 2241, 2209, 0, 0, 0, 0, 0, 0, 2273, 1985, 0, 0, 0, 0,
+    2273, 1985, 0, 0, 0, 1985, 2338, 0, 2209, 0, 0, 2241, 2449, 0, 2961, 2129,
+    0, 1985, 0, 0, 0, 2417, 0, 0, 2129, 0, 0, 0, 2209, 2065, 0, 0,
+    1985, 2065, 0, 0, 2065, 1985, 1985, 2065, 2994, 2065, 0, 2129, 1985, 1985, 0, 2449,
+    2097, 0, 0, 0, 2241, 0, 0, 1857, 0, 2417, 0, 0, 0, 2449, 0, 0,
+    0, 2129, 0, 0, 0, 0, 2065, 0, 4146, 1985, 2737, 0, 0, 2162, 0, 0,
+    2209, 2129, 4194, 0, 2209, 0, 2065, 2065, 2449, 0, 0, 1985, 0, 0, 0, 0,
+    0, 2097, 0, 1857, 0, 0, 0, 2097, 0, 0, 1921, 2097, 0, 2737, 2273, 2305,
+    0, 1857, 2209, 2561, 2097, 0, 0, 2449, 1857, 0, 2529, 4242, 0, 2241, 0, 2097,
+    1857, 0, 1985, 0, 4290, 2961, 0, 2273, 0, 0, 2241, 0, 2097, 2241, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1985, 0, 1857, 0, 2273, 2209, 1857, 2273,
+    2385, 0, 0, 0, 0, 0, 0, 0, 0, 1889, 0, 2737, 2305, 2305, 0, 1921,
+    0, 0, 0, 0, 0, 0, 2737, 4339, 0, 0, 0, 4402, 0, 2449, 0, 2449,
+    1921, 0, 2209, 0, 2385, 2097, 0, 0, 0, 2737, 0, 0, 0, 1985, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1985, 0, 0, 0, 2241, 2305, 2241, 2209, 0,
+    0, 2449, 0, 0, 2449, 1889, 2961, 0, 0, 0, 1857, 0, 0, 0, 2417, 1985,
+    0, 2561, 0, 1985, 1985, 0, 0, 0, 4450, 2065, 0, 0, 2065, 0, 0, 0,
+    1985, 0, 0, 0, 0, 0, 1985, 2065, 2385, 0, 2385, 2561, 0, 0, 2065, 0,
+    2097, 2529, 2417, 0, 1857, 0, 0, 0, 2209, 0, 2209, 0, 2097, 0, 2097, 0,
+    4498, 0, 0, 0, 1985, 0, 0, 0, 2385, 1889, 0, 0, 2385, 0, 0, 0,
+    2209, 0, 0, 2209, 2241, 2305, 0, 0, 2737, 1889, 1985, 2097, 4547, 0, 0, 1857,
+    0, 0, 2209, 0, 2241, 2209, 2209, 0, 0, 0, 0, 0, 0, 2449, 2449, 0,
+    2449, 0, 0, 0, 0, 2065, 0, 2385, 2385, 2065, 0, 0, 0, 2561, 2737, 0,
+    2385, 2449, 2561, 0, 2097, 2097, 0, 0, 0, 0, 0, 0, 0, 0, 2449, 2209,
+    1857, 1857, 3074, 0, 2097, 0, 0, 0, 1857, 2449, 2449, 2097, 0, 2209, 0, 0,
+    2449, 0, 0, 1857, 1857, 0, 0, 0, 4611, 2737, 1985, 0, 0, 0, 2097, 1985,
+    0, 0, 0, 2561, 0, 0, 1857, 0, 1857, 0, 2097, 2209, 0, 2209, 2417, 0,
+    0, 0, 0, 0, 2385, 0, 2097, 0, 2129, 2097, 0, 0, 0, 2241, 4674, 2273,
+    0, 1857, 1857, 2273, 1921, 0, 0, 0, 0, 0, 0, 2449, 0, 2273, 0, 2449,
+    1857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4722, 0, 2241, 0, 2273, 0,
+    2273, 2209, 0, 2449, 0, 2241, 0, 0, 0, 2561, 0, 0, 0, 0, 1857, 0,
+    0, 0, 0, 0, 0, 2449, 2385, 0, 0, 2385, 0, 0, 0, 2385, 0, 2385,
+    2209, 0, 0, 2209, 0, 0, 0, 0, 2129, 2129, 2065, 0, 0, 0, 0, 0,
+    2417, 0, 0, 0, 0, 2097, 0, 0, 0, 2209, 0, 2065, 0, 0, 2449, 2129,
+    3041, 2449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2449, 0, 2385,
+    0, 2097, 2209, 0, 0, 0, 0, 1985, 0, 0, 0, 0, 0, 2097, 0, 2961,
+    0, 0, 0, 0, 0, 2129, 0, 2241, 0, 2129, 0, 2241, 0, 2241, 2241, 0,
+    2129, 0, 0, 1857, 2737, 1985, 4674, 2385, 3490, 2241, 1857, 0, 0, 0, 0, 2385,
+    1985, 0, 0, 0, 2385, 0, 1985, 2417, 2529, 2561, 2417, 0, 2241, 0, 0, 0,
+    2385, 4770, 0, 0, 0, 0, 0, 2097, 0, 0, 4818, 0, 0, 0, 2097, 4866,
+    2561, 2241, 0, 0, 2209, 0, 0, 0, 0, 0, 2209, 2097, 0, 0, 2209, 2209,
+    0, 0, 0, 0, 2241, 1921, 1857, 1857, 0, 2097, 2385, 0, 2529, 2385, 0, 0,
+    0, 2065, 0, 0, 0, 2209, 0, 0, 0, 0, 0, 0, 2209, 0, 0, 0,
+    0, 0, 1889, 2097, 2209, 0, 0, 0, 0, 2385, 2065, 0, 0, 0, 3490, 0,
+    0, 0, 0, 0, 2129, 0, 4914, 0, 0, 1889, 1889, 0, 1857, 2241, 0, 0,
+    2449, 0, 2273, 1985, 0, 2417, 2241, 0, 0, 0, 0, 0, 0, 0, 2129, 0,
+    2241, 2209, 0, 0, 4961, 0, 0, 0, 0, 0, 1857, 0, 4994, 0, 2209, 0,
+    2241, 0, 0, 0, 1857, 2273, 0, 2209, 2097, 0, 1889, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3041, 0, 0, 5042, 0, 2273, 0, 0, 0, 0, 2449, 2097,
+    2209, 2449, 2449, 0, 2449, 2305, 0, 0, 0, 2449, 0, 0, 2417, 0, 0, 0,
+    0, 2385, 0, 0, 2097, 0, 2273, 2097, 0, 2417, 0, 2994, 0, 2529, 0, 0,
+    2449, 0, 1857, 0, 2529, 0, 0, 1889, 0, 0, 0, 0, 2449, 0, 1985, 2097,
+    0, 4402, 2385, 2529, 0, 0, 0, 0, 0, 3442, 0, 2529, 0, 2529, 2065, 0,
+    0, 1857, 1985, 2129, 0, 0, 0, 0, 2994, 2561, 2385, 2561, 0, 2529, 2561, 2529,
+    1985, 0, 0, 0, 2209, 0, 0, 2273, 0, 0, 0, 0, 0, 0, 0, 2737,
+    0, 2241, 0, 1985, 2065, 0, 0, 0, 0, 0, 0, 2449, 5090, 0, 0, 2449,
+    2241, 2241, 0, 2385, 0, 2961, 2065, 0, 2961, 0, 0, 2385, 0, 0, 2097, 0,
+    0, 3538, 2209, 0, 5138, 5186, 0, 2241, 2385, 2385, 0, 2385, 0, 1985, 1985, 2737,
+    0, 0, 0, 2737, 2065, 0, 0, 2690, 0, 0, 2385, 0, 0, 0, 0, 0,
+    0, 0, 1857, 2065, 0, 2241, 2449, 1985, 0, 0, 2994, 2561, 1857, 0, 0, 0,
+    2561, 2097, 0, 0, 0, 2737, 2737, 1985, 2065, 0, 2385, 0, 1985, 0, 2065, 0,
+    2561, 5234, 0, 0, 0, 1889, 2065, 0, 2561, 2994, 2561, 2529, 0, 0, 2097, 2561,
+    2561, 2305, 0, 0, 2305, 1857, 2417, 0, 0, 2065, 0, 0, 0, 0, 0, 0,
+    1889, 0, 0, 0, 2561, 0, 0, 0, 0, 2241, 1857, 2241, 0, 2305, 0, 1857,
+    2129, 0, 1889, 1985, 2690, 5282, 2737, 0, 0, 0, 2737, 4098, 2449, 0, 1985, 1985,
+    2065, 0, 2097, 1985, 1857, 0, 0, 0, 2449, 1857, 2097, 3442, 0, 2273, 0, 0,
+    2273, 2273, 2241, 2961, 0, 0, 0, 0, 2241, 0, 0, 0, 2737, 2273, 0, 0,
+    0, 2097, 0, 0, 1921, 2449, 0, 0, 2097, 0, 2385, 0, 3538, 3442, 1985, 0,
+    2273, 2961, 0, 0, 2449, 0, 2385, 0, 2209, 2449, 3730, 0, 1857, 2961, 2961, 0,
+    2305, 2449, 2449, 0, 2273, 2417, 0, 2449, 0, 1857, 2129, 0, 0, 0, 2385, 0,
+    0, 0, 0, 0, 2273, 0, 1889, 0, 0, 0, 2129, 0, 0, 2209, 0, 0,
+    5331, 5394, 0, 1857, 2097, 1921, 2097, 2529, 5443, 0, 1857, 0, 0, 0, 0, 0,
+    2737, 0, 1985, 1985, 1921, 0, 0, 0, 5506, 0, 0, 0, 2273, 0, 1857, 2065,
+    2449, 0, 2097, 0, 0, 0, 2737, 2529, 1857, 2737, 0, 0, 0, 0, 0, 2065,
+    0, 0, 0, 1857, 0, 0, 0, 0, 0, 0, 0, 0, 2449, 0, 2273, 1857,
+    0, 1889, 0, 1857, 0, 0, 3041, 0, 0, 2241, 0, 1953, 0, 1857, 1857, 2273,
+    2097, 0, 5554, 0, 0, 1921, 2241, 3041, 0, 2209, 0, 1889, 1857, 2961, 2961, 0,
+    0, 2241, 0, 0, 0, 2273, 2417, 2305, 5602, 2305, 2209, 2273, 0, 2305, 2449, 1857,
+    2097, 2305, 2273, 0, 2273, 2305, 0, 1857, 0, 0, 2961, 2961, 0, 2529, 2961, 5650,
+    1857, 0, 2241, 0, 2417, 2273, 0, 2305, 0, 0, 2273, 2097, 2097, 5698, 0, 2241,
+    1857, 2129, 0, 0, 0, 5746, 1889, 2097, 2097, 2449, 1857, 0, 2241, 2241, 2097, 0,
+    0, 1857, 5794, 2241, 5841, 0, 5873, 5905, 0, 5937, 5841, 0, 5841, 5937, 0, 5905,
+    5873, 5873, 0, 0, 5873, 5969, 5841, 5969, 0, 0, 5841, 0, 6001, 0, 0, 0,
+    0, 0, 5969, 0, 0, 0, 5905, 0, 5969, 0, 5905, 0, 0, 0, 5969, 0,
+    5969, 0, 0, 0, 5841, 5937, 0, 0, 5905, 5905, 0, 0, 0, 0, 0, 6033,
+    6065, 0, 0, 0, 0, 5937, 5969, 5969, 0, 0, 0, 0, 6065, 6065, 5905, 0,
+    0, 6033, 5969, 0, 5905, 0, 0, 6001, 6097, 5905, 0, 5937, 5969, 5905, 0, 0,
+    0, 5969, 0, 0, 0, 5841, 6033, 6129, 5969, 6097, 5905, 5969, 0, 0, 0, 0,
+    0, 0, 0, 0, 6129, 0, 0, 0, 0, 5969, 0, 0, 6033, 0, 0, 5905,
+    5873, 5905, 0, 6065, 6065, 0, 0, 5969, 0, 6097, 0, 0, 0, 5969, 0, 0,
+    0, 6001, 0, 6001, 5969, 0, 5969, 0, 0, 5969, 0, 0, 0, 6097, 0, 0,
+    0, 0, 0, 0, 0, 0, 5841, 0, 0, 0, 5969, 6097, 0, 0, 5873, 0,
+    0, 5873, 5937, 5937, 5905, 6065, 5937, 0, 0, 0, 0, 0, 6161, 6161, 0, 5937,
+    0, 0, 0, 0, 6193, 0, 6225, 0, 6257, 0, 6289, 6257, 6289, 0, 0, 6193,
+    6321, 0, 0, 6289, 0, 0, 6289, 6289, 6161, 6321, 6193, 0, 6321, 6289, 6353, 0,
+    0, 6225, 5969, 0, 5969, 6385, 6417, 0, 0, 6353, 6289, 6353, 0, 5937, 0, 6257,
+    6353, 6193, 6225, 6385, 0, 6450, 0, 5969, 0, 0, 0, 6225, 6385, 6497, 6417, 6353,
+    6193, 0, 0, 0, 0, 0, 6193, 6353, 0, 6257, 6161, 0, 0, 0, 0, 6289,
+    0, 0, 0, 6257, 0, 6161, 6289, 0, 6289, 0, 6257, 6530, 0, 6578, 0, 0,
+    6193, 6289, 0, 6193, 6289, 0, 0, 0, 6353, 6625, 0, 0, 6321, 6625, 6321, 0,
+    5905, 0, 0, 6385, 6625, 6321, 6193, 6193, 6161, 5841, 6353, 0, 0, 0, 6385, 0,
+    6193, 0, 6033, 0, 0, 0, 0, 6033, 0, 0, 6193, 0, 0, 5905, 6321, 6161,
+    6658, 5841, 0, 0, 0, 6321, 0, 6289, 0, 0, 6321, 6321, 0, 0, 6321, 0,
+    6193, 6625, 6625, 6706, 0, 6289, 0, 5841, 6321, 6625, 6321, 0, 5841, 0, 6289, 6289,
+    6755, 5905, 6225, 6353, 6321, 0, 6257, 0, 0, 0, 6353, 0, 6353, 5937, 0, 0,
+    0, 0, 6353, 0, 6321, 6385, 6161, 6706, 6257, 6193, 0, 0, 6225, 6817, 6225, 6225,
+    0, 6321, 0, 6353, 6321, 6353, 6353, 6193, 0, 6065, 6193, 0, 5937, 0, 0, 6257,
+    6193, 6161, 0, 0, 0, 6193, 0, 6353, 6849, 6417, 6321, 6321, 6321, 6353, 0, 5937,
+    0, 0, 6321, 5873, 0, 5969, 5905, 0, 0, 0, 0, 0, 6289, 0, 5969, 5841,
+    6065, 6193, 6193, 6193, 6193, 6353, 6257, 6193, 0, 6353, 6193, 0, 0, 6353, 6193, 0,
+    6353, 0, 6353, 6321, 0, 0, 0, 5969, 0, 0, 5937, 0, 6353, 0, 6193, 0,
+    6161, 0, 0, 6225, 5841, 0, 0, 6289, 0, 0, 5937, 5905, 0, 0, 5969, 6497,
+    6882, 5937, 6497, 6497, 0, 6161, 6033, 6321, 0, 0, 6385, 0, 0, 5841, 0, 6321,
+    6193, 5841, 0, 6193, 0, 0, 6497, 6385, 0, 0, 6161, 0, 0, 6257, 5841, 0,
+    0, 0, 6385, 5937, 5969, 0, 0, 5841, 0, 0, 0, 6385, 0, 6321, 0, 0,
+    6033, 5969, 0, 5841, 0, 6385, 0, 6497, 6417, 6417, 6930, 6385, 6417, 0, 6385, 0,
+    5937, 6978, 7026, 0, 0, 6385, 0, 0, 0, 0, 0, 7074, 6497, 6417, 6097, 6385,
+    0, 6321, 7122, 5937, 6385, 0, 0, 6321, 6417, 6225, 0, 6849, 6497, 6097, 5841, 6385,
+    6193, 0, 0, 0, 6385, 0, 5969, 6385, 5841, 6353, 6321, 0, 5937, 6497, 0, 5969,
+    6225, 5905, 5937, 6193, 0, 0, 6321, 6385, 0, 5969, 0, 5841, 5937, 5937, 6353, 0,
+    0, 0, 6497, 0, 5969, 5937, 6225, 5841, 0, 0, 0, 0, 0, 5969, 5969, 0,
+    6289, 0, 0, 0, 5969, 0, 6497, 0, 6625, 6289, 6321, 6193, 6353, 0, 0, 0,
+    0, 6385, 5841, 0, 5905, 6033, 6033, 6385, 0, 0, 6385, 5937, 6706, 7170, 6033, 0,
+    0, 0, 0, 0, 0, 0, 6385, 0, 6353, 0, 6353, 6497, 0, 0, 0, 6193,
+    0, 6193, 6193, 5841, 6625, 6225, 6497, 0, 5937, 6817, 6257, 0, 7122, 0, 6321, 0,
+    6625, 0, 7218, 5937, 0, 6225, 6417, 7266, 0, 6193, 0, 0, 7313, 0, 6497, 5937,
+    6321, 6257, 0, 6497, 7346, 6817, 6417, 0, 6417, 0, 7395, 6353, 6321, 5841, 0, 0,
+    0, 5841, 5905, 5969, 7458, 0, 0, 6385, 0, 6497, 5969, 0, 5841, 0, 0, 5969,
+    6385, 0, 6289, 0, 6849, 0, 0, 6353, 6289, 0, 0, 6321, 6321, 5937, 6289, 0,
+    6321, 0, 0, 0, 6161, 0, 5905, 5969, 0, 0, 5937, 6097, 6353, 6289, 6065, 0,
+    0, 0, 7506, 0, 5937, 5937, 0, 6225, 6225, 6225, 0, 6033, 0, 0, 6225, 0,
+    6193, 5969, 0, 0, 6817, 0, 0, 6817, 0, 0, 6321, 6225, 6530, 5969, 5873, 6289,
+    6193, 0, 6193, 6257, 5937, 6225, 6001, 6225, 6225, 5905, 5905, 6321, 6321, 5841, 6321, 0,
+    6225, 5841, 0, 6417, 0, 0, 6385, 5841, 6353, 6321, 0, 7554, 6225, 6225, 6257, 6161,
+    5841, 6353, 6289, 6289, 6849, 0, 5969, 5905, 6193, 6161, 6225, 5969, 6321, 6225, 6225, 0,
+    0, 6225, 0, 6289, 0, 6497, 6225, 0, 6161, 6530, 6849, 0, 0, 0, 0, 6161,
+    0, 6289, 6817, 0, 7602, 6385, 5841, 6849, 6161, 6353, 0, 6625, 6321, 6161, 6353, 6225,
+    6225, 6161, 6817, 6225, 0, 5969, 0, 7650, 6225, 6193, 0, 5969, 0, 6193, 6225, 5905,
+    0, 0, 0, 0, 6161, 6161, 6193, 0, 0, 0, 6289, 0, 6161, 6161, 6289, 0,
+    6193, 6161, 6497, 5969, 6225, 6193, 6321, 0, 0, 6193, 6353, 6289, 0, 0, 6193, 0,
+    6321, 6161, 6289, 0, 6161, 0, 0, 5841, 0, 6225, 0, 6289, 6321, 0, 6225, 0,
+    5969, 0, 6193, 0, 6321, 6193, 7697, 0, 0, 0, 0, 0, 0, 5969, 0, 5841,
+    7730, 0, 0, 0, 6849, 6385, 6321, 5969, 0, 6193, 6353, 6161, 5969, 6257, 0, 0,
+    6385, 6193, 5969, 0, 0, 6817, 6289, 6353, 6817, 0, 0, 6289, 0, 6817, 6817, 0,
+    7170, 7778, 0, 5969, 0, 6321, 6817, 6817, 0, 0, 0, 0, 0, 0, 0, 7826,
+    7697, 6817, 5969, 0, 6289, 0, 0, 6257, 0, 5841, 6161, 0, 0, 6289, 6289, 0,
+    0, 6193, 6353, 0, 6193, 5841, 0, 6353, 7874, 6817, 6161, 0, 0, 6257, 6193, 5969,
+    6225, 5969, 6161, 6225, 6161, 6033, 0, 6289, 6497, 6193, 5905, 6321, 5841, 0, 7922, 0,
+    0, 6193, 0, 6385, 0, 5841, 0, 0, 6385, 6497, 6193, 6321, 6097, 0, 6497, 6225,
+    6225, 0, 7170, 6225, 7970, 0, 0, 6417, 5969, 6385, 6193, 0, 0, 5937, 0, 6385,
+    6497, 7874, 6625, 8018, 5969, 0, 0, 0, 0, 5841, 0, 0, 0, 0, 5969, 0,
+    0, 5969, 0, 5969, 6161, 0, 5841, 6033, 6353, 0, 6353, 6193, 5841, 5969, 6385, 6497,
+    6417, 6193, 0, 6161, 0, 6385, 8066, 5841, 6065, 0, 5841, 0, 6385, 0, 0, 0,
+    6385, 6385, 8114, 6193, 6225, 6497, 6033, 0, 6385, 6321, 6289, 6033, 6193, 0, 6321, 0,
+    5937, 0, 6225, 6033, 0, 0, 8162, 0, 8210, 5969, 6289, 0, 6497, 0, 5969, 6289,
+    0, 0, 5905, 6225, 8258, 0, 6817, 6225, 0, 6225, 0, 6193, 8307, 0, 6193, 0,
+    0, 6497, 0, 6225, 6001, 0, 6385, 5969, 0, 0, 6385, 5841, 6161, 0, 8370, 0,
+    6353, 7218, 5841, 5969, 5969, 6161, 0, 6193, 0, 0, 5969, 0, 5969, 0, 0, 5905,
+    5937, 0, 6097, 0, 0, 0, 5937, 0, 5841, 5905, 7313, 6417, 0, 8418, 8466, 0,
+    6161, 5969, 5841, 5937, 6225, 0, 0, 6289, 0, 6289, 7122, 0, 8514, 6353, 6321, 6033,
+    0, 6225, 0, 0, 5969, 6193, 5969, 5969, 0, 5969, 0, 0, 5841, 0, 5841, 0,
+    0, 6161, 5841, 0, 8562, 6321, 6065, 5969, 6353, 6417, 5841, 0, 0, 0, 6353, 5969,
+    5873, 7313, 0, 6033, 0, 0, 6225, 6257, 0, 6353, 0, 0, 5969, 8610, 0, 6193,
+    6193, 0, 0, 6385, 5905, 8658, 6353, 5841, 0, 0, 6225, 0, 6353, 6193, 0, 6193,
+    7170, 6161, 6385, 6497, 6385, 6033, 6225, 5841, 6385, 6161, 0, 6817, 6225, 7170, 6497, 6225,
+    6321, 6001, 0, 6321, 6353, 6289, 6225, 0, 0, 5969, 0, 6161, 6193, 6257, 6353, 6289,
+    6225, 6193, 6353, 5969, 8706, 6065, 8066, 5969, 6161, 0, 6849, 6289, 6849, 0, 0, 0,
+    6321, 0, 6289, 5937, 0, 0, 6289, 6193, 6193, 6193, 0, 6193, 6353, 6161, 5937, 6257,
+    8466, 0, 7170, 0, 6289, 6257, 5841, 6193, 6625, 6193, 0, 7697, 6625, 0, 6193, 6321,
+    6353, 6225, 0, 0, 6385, 0, 0, 0, 6385, 6321, 6289, 0, 0, 7506, 6385, 0,
+    0, 6289, 0, 0, 0, 6385, 6385, 6385, 0, 6385, 6385, 6161, 6225, 6193, 6257, 0,
+    8754, 5969, 6225, 6193, 0, 7697, 8802, 6161, 5841, 6625, 0, 0, 5905, 6353, 5905, 6353,
+    6161, 6321, 6225, 0, 6321, 8850, 6193, 6289, 0, 0, 5969, 6225, 5937, 0, 6225, 8898,
+    6225, 6353, 0, 6321, 0, 8947, 0, 5969, 0, 0, 6353, 6353, 6193, 6033, 6193, 6193,
+    0, 0, 6193, 5969, 6161, 0, 0, 6385, 0, 6625, 6321, 0, 0, 0, 6257, 6257,
+    0, 0, 6353, 6385, 0, 6225, 9010, 6289, 6289, 0, 6321, 0, 6385, 9058, 6193, 0,
+    6817, 0, 7697, 6385, 9107, 6385, 0, 6353, 0, 6161, 6193, 6385, 0, 0, 0, 0,
+    6353, 6257, 0, 7506, 6385, 0, 5969, 0, 0, 0, 5937, 0, 6497, 5841, 6353, 7218,
+    0, 6321, 6225, 6033, 6225, 0, 0, 5969, 6161, 6385, 6161, 5841, 0, 5937, 6289, 0,
+    6225, 5841, 6225, 6193, 5969, 0, 5905, 6417, 0, 0, 0, 5969, 5905, 5969, 0, 0,
+    0, 7778, 5841, 0, 0, 0, 6353, 6225, 0, 0, 6321, 0, 6033, 6497, 0, 6497,
+    0, 6385, 6417, 0, 0, 7313, 6193, 6321, 0, 5969, 6417, 8162, 6225, 0, 6497, 6417,
+    6289, 0, 6385, 6065, 6225, 6321, 6625, 0, 6321, 0, 6353, 0, 0, 6385, 0, 6225,
+    6289, 6289, 0, 6417, 0, 6225, 6321, 0, 6417, 0, 0, 5905, 6321, 8754, 6225, 9170,
+    5905, 0, 6353, 5969, 6817, 0, 0, 0, 6289, 5969, 6225, 6161, 6289, 6289, 6289, 7218,
+    7218, 6257, 9218, 0, 0, 0, 6161, 6161, 0, 6225, 5841, 0, 0, 0, 6321, 0,
+    0, 6161, 6417, 0, 6497, 5969, 6033, 0, 5905, 6289, 5841, 0, 0, 6497, 0, 0,
+    5969, 6321, 0, 7697, 5937, 6289, 6161, 0, 6289, 6225, 6353, 0, 6289, 5841, 0, 5905,
+    0, 5841, 0, 6193, 5841, 6193, 6193, 5873, 6353, 6321, 0, 6497, 0, 0, 5905, 5841,
+    0, 6161, 9266, 0, 6353, 6193, 6161, 0, 6625, 0, 6321, 0, 6497, 6033, 0, 6385,
+    0, 0, 0, 6817, 0, 0, 0, 0, 0, 0, 5905, 0, 5969, 5873, 6497, 6065,
+    0, 9314, 6161, 0, 5969, 6385, 0, 9362, 0, 0, 5969, 9410, 6817, 5969, 0, 6385,
+    5969, 5841, 6417, 6353, 0, 0, 6321, 6257, 0, 6225, 5969, 5969, 0, 6225, 5969, 6417,
+    0, 0, 0, 5969, 6225, 5841, 0, 5937, 0, 6385, 9458, 0, 6225, 6385, 0, 6321,
+    6001, 0, 6193, 0, 0, 0, 0, 0, 0, 0, 0, 6193, 6065, 6161, 6417, 0,
+    6289, 0, 5969, 0, 6530, 6161, 6353, 0, 0, 0, 6033, 6321, 0, 0, 0, 6497,
+    6225, 6385, 6321, 6161, 0, 6321, 6385, 0, 0, 0, 5841, 5905, 6385, 5905, 5969, 6161,
+    5969, 0, 0, 0, 0, 6417, 5969, 6033, 0, 6289, 0, 0, 6257, 6321, 0, 6225,
+    6161, 0, 5969, 0, 9506, 6849, 6289, 0, 6161, 5969, 6625, 6289, 0, 5905, 6497, 0,
+    6497, 6321, 0, 6353, 6321, 6385, 6321, 0, 6817, 9554, 5969, 7697, 0, 6385, 7697, 6385,
+    0, 6161, 0, 6225, 6289, 0, 0, 6353, 6257, 6289, 6257, 6161, 6225, 5841, 6353, 0,
+    6225, 6065, 6193, 6321, 6193, 6321, 6353, 6321, 6625, 6161, 0, 0, 5969, 6497, 0, 6225,
+    0, 0, 6193, 0, 6289, 6193, 0, 0, 5841, 0, 5969, 5969, 0, 6161, 5841, 0,
+    9602, 0, 0, 0, 0, 6321, 6193, 0, 0, 5937, 0, 0, 6385, 5969, 5937, 6353,
+    6417, 0, 6065, 0, 6353, 0, 0, 7506, 6129, 5841, 0, 6225, 6321, 6161, 0, 5969,
+    0, 6161, 0, 6097, 0, 5969, 0, 0, 0, 6353, 0, 6289, 9650, 6257, 6161, 6193,
+    0, 6065, 5969, 0, 5937, 6578, 6161, 5969, 6817, 0, 6193, 0, 0, 6065, 6225, 0,
+    6225, 0, 6065, 0, 0, 0, 0, 0, 0, 6193, 5905, 0, 6065, 0, 6161, 0,
+    6321, 0, 9107, 0, 0, 6161, 6225, 6289, 9698, 6193, 9506, 0, 6225, 5937, 7697, 6033,
+    0, 0, 5841, 0, 6289, 0, 6161, 0, 0, 0, 6289, 0, 6353, 6225, 0, 5873,
+    6193, 0, 6289, 6321, 6289, 0, 0, 7218, 0, 6161, 0, 6161, 0, 0, 6161, 0,
+    0, 0, 5969, 6353, 6193, 0, 6193, 6161, 6353, 5937, 0, 6625, 6321, 0, 0, 0,
+    6225, 6289, 0, 6161, 6257, 0, 0, 6225, 6193, 0, 6321, 6289, 0, 6353, 6289, 0,
+    6321, 6257, 6289, 6257, 6161, 0, 0, 0, 0, 0, 6289, 0, 5841, 0, 8466, 6353,
+    6033, 5937, 5937, 5905, 6289, 6033, 5937, 6257, 0, 0, 0, 0, 6289, 6161, 0, 6161,
+    7506, 0, 0, 5937, 6193, 0, 5841, 6321, 7458, 0, 6161, 6257, 6849, 0, 6289, 6625,
+    6097, 6161, 0, 6353, 6417, 6321, 5841, 0, 0, 6321, 6161, 6193, 6321, 0, 6161, 7778,
+    0, 5969, 6321, 0, 6321, 6625, 0, 6225, 0, 0, 6225, 0, 8610, 0, 6289, 6289,
+    5937, 0, 6193, 0, 6353, 0, 6097, 6321, 0, 0, 6289, 0, 6978, 0, 6193, 0,
+    5937, 0, 6321, 6321, 5969, 0, 5841, 0, 5969, 0, 0, 6193, 6321, 0, 0, 6417,
+    9746, 6625, 0, 0, 0, 6417, 6417, 5969, 9794, 6321, 0, 0, 6225, 0, 6353, 0,
+    6225, 0, 6225, 5905, 0, 6353, 5873, 0, 0, 0, 0, 6321, 0, 6257, 6497, 0,
+    0, 0, 6417, 6417, 0, 5969, 5841, 0, 0, 6321, 6161, 6193, 6497, 6417, 6193, 0,
+    6193, 6225, 5841, 6225, 5841, 6289, 6625, 6417, 0, 5905, 0, 0, 6385, 5969, 5841, 5969,
+    6497, 6353, 9842, 6001, 0, 0, 6321, 6321, 5873, 6321, 6497, 0, 6225, 6161, 6289, 6289,
+    6289, 0, 0, 0, 0, 0, 0, 0, 0, 5905, 0, 0, 5905, 9890, 0, 5969,
+    0, 0, 0, 5905, 0, 5873, 0, 6225, 9602, 5905, 0, 0, 5969, 0, 5905, 5969,
+    6497, 6193, 0, 0, 0, 5937, 7697, 6417, 6417, 0, 0, 6193, 0, 0, 6161, 0,
+    0, 5969, 6321, 0, 6817, 0, 0, 0, 0, 6225, 6353, 6257, 0, 0, 5937, 5841,
+    0, 0, 5969, 0, 0, 0, 6225, 6225, 5969, 6817, 5841, 6289, 0, 8754, 6321, 6065,
+    6225, 5969, 0, 5841, 6257, 6193, 0, 6497, 6321, 0, 0, 0, 0, 0, 6257, 0,
+    0, 6625, 6193, 6321, 0, 6353, 6257, 6353, 0, 0, 0, 6257, 6225, 5841, 6353, 6225,
+    0, 0, 6097, 0, 0, 0, 0, 0, 0, 0, 0, 6321, 6193, 6289, 6289, 5969,
+    6161, 6161, 5969, 6385, 5969, 6321, 0, 5905, 0, 6225, 6385, 6225, 0, 0, 6257, 6353,
+    0, 6497, 0, 0, 5937, 6417, 0, 6817, 5969, 5969, 5969, 6497, 6625, 6225, 5969, 6289,
+    5969, 0, 0, 0, 6625, 0, 5905, 0, 6289, 6257, 6321, 0, 0, 9937, 6817, 0,
+    6225, 6225, 5937, 6289, 0, 0, 6225, 6289, 6225, 6289, 6225, 6161, 6289, 6161, 7730, 6289,
+    6289, 6225, 5905, 0, 6193, 0, 0, 6257, 0, 0, 0, 0, 5969, 5969, 0, 5969,
+    0, 0, 7313, 6497, 0, 0, 5905, 6353, 0, 5969, 0, 0, 6321, 6321, 0, 0,
+    6225, 0, 0, 6289, 0, 5969, 5969, 6225, 0, 5969, 5969, 5841, 5841, 5841, 0, 6289,
+    0, 6193, 9970, 6161, 8754, 6065, 0, 6225, 6289, 0, 5937, 0, 6353, 5969, 0, 6289,
+    0, 0, 6225, 0, 6289, 0, 6321, 8466, 6193, 6321, 6193, 0, 6033, 0, 6161, 0,
+    0, 0, 6289, 0, 0, 6289, 6289, 5969, 0, 6257, 6497, 0, 6289, 0, 0, 5969,
+    6353, 5969, 6417, 0, 0, 6353, 0, 5905, 0, 0, 5969, 0, 6033, 6225, 6385, 6225,
+    0, 6225, 0, 8162, 0, 0, 6033, 6225, 5841, 0, 0, 0, 0, 5841, 5937, 10018,
+    6417, 7778, 6161, 5905, 6257, 6497, 6497, 0, 6385, 0, 0, 0, 6385, 5969, 0, 5937,
+    0, 0, 10066, 0, 6882, 6225, 5969, 0, 6353, 5937, 8706, 0, 5969, 6257, 6497, 6257,
+    6193, 6417, 6033, 0, 0, 6065, 5841, 6161, 0, 6497, 0, 5969, 6385, 6817, 0, 6289,
+    6497, 5937, 0, 0, 6289, 0, 0, 6289, 0, 0, 0, 6065, 5841, 6161, 0, 0,
+    6321, 6065, 0, 0, 10114, 0, 0, 6497, 8162, 5841, 5969, 0, 5937, 5937, 6353, 0,
+    6497, 5969, 0, 0, 10162, 7697, 6817, 6033, 0, 5841, 0, 6385, 6225, 0, 6225, 5841,
+    6385, 0, 0, 0, 6065, 6289, 0, 0, 6161, 0, 0, 6225, 0, 0, 6321, 0,
+    0, 6817, 6817, 0, 0, 8754, 0, 0, 6225, 0, 6097, 6289, 6225, 6161, 6849, 6225,
+    6289, 0, 6497, 6849, 0, 0, 0, 6225, 0, 0, 0, 6385, 0, 0, 0, 6257,
+    6353, 6065, 5905, 0, 0, 7313, 5937, 0, 0, 0, 0, 6385, 6353, 0, 0, 6353,
+    0, 5905, 6385, 0, 0, 0, 6353, 0, 0, 0, 0, 6353, 5969, 6385, 6385, 0,
+    0, 5969, 6353, 0, 0, 5841, 0, 5873, 0, 0, 0, 0, 6385, 5841, 6497, 6353,
+    0, 6353, 6417, 0, 5841, 6497, 10210, 0, 6417, 6417, 0, 7313, 6353, 5905, 10258, 0,
+    7313, 0, 5937, 6385, 6385, 0, 0, 5841, 6385, 0, 6417, 0, 6385, 0, 0, 0,
+    0, 6385, 0, 0, 0, 6321, 0, 0, 6385, 6225, 10306, 6497, 6417, 6353, 6497, 0,
+    6385, 0, 6817, 0, 6417, 0, 6353, 0, 6193, 6417, 5969, 6353, 5969, 0, 6193, 5969,
+    6193, 0, 5841, 6417, 6417, 0, 0, 0, 0, 6385, 6625, 6353, 0, 6625, 5969, 6193,
+    0, 6385, 6385, 6625, 0, 0, 6497, 6385, 0, 5905, 0, 0, 5841, 0, 0, 5937,
+    5969, 6497, 0, 7697, 5969, 0, 0, 0, 0, 0, 0, 5905, 5937, 5841, 0, 6225,
+    0, 6193, 6321, 0, 7970, 6417, 6497, 0, 5937, 6353, 5841, 0, 6065, 6353, 0, 6353,
+    5969, 0, 6097, 5905, 5905, 6225, 6289, 0, 0, 5969, 6321, 6065, 6193, 0, 5841, 6849,
+    0, 6353, 6161, 6225, 6321, 5873, 6225, 5841, 0, 0, 0, 6353, 0, 6849, 5969, 5841,
+    0, 5937, 0, 5841, 0, 6849, 6321, 6161, 0, 0, 0, 0, 0, 6257, 0, 6385,
+    6353, 6353, 6321, 0, 0, 0, 5841, 6321, 6321, 6817, 0, 5905, 6321, 0, 0, 6225,
+    0, 6161, 0, 0, 0, 5841, 6385, 6225, 0, 6225, 6321, 0, 0, 6321, 0, 6289,
+    6257, 6289, 6849, 6193, 0, 6321, 5841, 6321, 6321, 0, 0, 0, 5841, 6161, 6161, 6321,
+    6193, 5937, 0, 6161, 6289, 0, 6353, 0, 6257, 5841, 5969, 6289, 6385, 6385, 6385, 0,
+    0, 0, 6225, 10354, 6353, 5937, 0, 6161, 6225, 0, 5905, 6321, 0, 0, 5937, 5873,
+    6353, 0, 6353, 0, 0, 0, 6289, 0, 6321, 6225, 0, 0, 6225, 0, 0, 0,
+    0, 0, 6385, 0, 6321, 6321, 0, 6497, 0, 6497, 6353, 0, 7922, 6817, 5937, 6385,
+    5905, 7218, 6257, 6353, 0, 6193, 6193, 6385, 5905, 6385, 0, 0, 0, 6321, 6161, 6497,
+    6417, 5937, 0, 5841, 6321, 6321, 0, 6161, 0, 5937, 6033, 6161, 5969, 5969, 6257, 0,
+    0, 0, 5969, 0, 6065, 5937, 5969, 6065, 0, 0, 0, 5969, 6417, 6065, 6321, 6193,
+    0, 0, 0, 0, 6321, 5937, 6225, 0, 5969, 6353, 6033, 6353, 6225, 0, 0, 0,
+    5905, 0, 6353, 5969, 5841, 5841, 6225, 0, 0, 0, 0, 6065, 0, 6353, 0, 6225,
+    6225, 6033, 6225, 6625, 5937, 6353, 0, 6193, 6417, 6193, 0, 5841, 0, 6193, 6193, 0,
+    6353, 0, 0, 10401, 10433, 10465, 0, 0, 10497, 0, 10529, 10401, 10561, 10401, 10465, 0,
+    0, 0, 10433, 0, 0, 10497, 0, 10433, 0, 0, 0, 10465, 10465, 10561, 0, 10594,
+    10529, 0, 10641, 10465, 10673, 0, 10497, 0, 0, 0, 0, 0, 10706, 10401, 0, 10754,
+    0, 10433, 10802, 10850, 0, 10465, 0, 10641, 10673, 0, 10465, 10898, 0, 0, 10497, 0,
+    10529, 10433, 0, 10433, 10946, 10433, 10433, 0, 0, 10641, 0, 0, 0, 0, 0, 10641,
+    10465, 10401, 10994, 0, 0, 10401, 0, 10497, 0, 10401, 0, 10433, 0, 0, 0, 10641,
+    10561, 0, 0, 11042, 0, 0, 10433, 10433, 10433, 10641, 10529, 10529, 10529, 0, 11089, 0,
+    0, 0, 0, 0, 0, 10946, 11089, 10433, 10561, 10433, 0, 10433, 0, 0, 10465, 0,
+    0, 0, 10401, 0, 11122, 10433, 11169, 0, 11169, 0, 11169, 11201, 11169, 11169, 11233, 11233,
+    11169, 10401, 11265, 11169, 11297, 10497, 11169, 10561, 0, 11169, 11297, 11233, 10401, 10401, 11297, 0,
+    11265, 11169, 11329, 11233, 11362, 10401, 11169, 0, 11410, 0, 11169, 11169, 10497, 10433, 10401, 11297,
+    11457, 11297, 10561, 11489, 10561, 11297, 11265, 0, 10401, 11489, 11265, 11233, 11233, 11297, 11265, 11521,
+    10898, 10529, 11265, 10401, 10465, 11265, 11089, 11553, 11265, 11587, 0, 0, 11169, 11489, 0, 11297,
+    11489, 11169, 10433, 10641, 10401, 11297, 11233, 0, 0, 10561, 0, 11089, 0, 0, 0, 11169,
+    11297, 11233, 11169, 11297, 11489, 0, 11233, 0, 11297, 11233, 11297, 10433, 0, 11297, 11297, 11169,
+    11297, 11297, 11297, 10433, 11297, 10401, 11233, 0, 10401, 0, 11297, 0, 11169, 11265, 0, 11297,
+    0, 11650, 11169, 10401, 10497, 11297, 11169, 11169, 10497, 11297, 10497, 0, 0, 0, 10529, 10561,
+    0, 10497, 11697, 10497, 11169, 11169, 10401, 11729, 11762, 11297, 0, 10594, 11169, 11297, 11697, 11809,
+    11842, 0, 11890, 11938, 10529, 11521, 11938, 11986, 10561, 10465, 10497, 10401, 12034, 12083, 10673, 10673,
+    10561, 0, 10561, 10401, 10561, 0, 0, 11457, 0, 10465, 12146, 11169, 11297, 10497, 0, 10497,
+    10401, 10465, 10497, 11169, 10401, 0, 0, 12195, 11329, 10401, 0, 10641, 11329, 11169, 11457, 0,
+    10673, 10401, 11457, 11169, 11297, 11297, 0, 0, 11521, 10465, 0, 12258, 11457, 10465, 11233, 11329,
+    11329, 11329, 10465, 0, 11521, 10497, 11297, 10465, 10401, 0, 10465, 10641, 0, 10433, 11521, 0,
+    10465, 12306, 11521, 0, 0, 10497, 10433, 10561, 11169, 11233, 12353, 10641, 0, 11169, 0, 11457,
+    12386, 0, 11169, 10561, 11265, 12434, 0, 11553, 11329, 0, 10401, 11265, 11089, 11265, 0, 0,
+    11169, 0, 10561, 12482, 11457, 11169, 0, 10529, 11729, 11265, 0, 0, 10465, 10465, 11297, 11729,
+    10465, 0, 11265, 0, 0, 0, 11457, 11169, 11729, 11729, 10433, 12530, 11457, 11329, 11169, 10401,
+    11297, 0, 0, 10433, 0, 0, 0, 0, 0, 11729, 10401, 11329, 11329, 10497, 0, 10401,
+    11169, 10401, 10465, 10465, 0, 10401, 10497, 10497, 10641, 10401, 10641, 11233, 10465, 12353, 12353, 10433,
+    0, 11489, 0, 11169, 11233, 12353, 12353, 12353, 0, 12353, 11297, 10401, 12353, 11265, 11297, 11297,
+    0, 11169, 12578, 11521, 11489, 0, 0, 0, 11169, 11233, 11169, 10561, 0, 11089, 0, 11297,
+    11489, 11410, 11297, 11489, 0, 12578, 11169, 0, 11265, 11297, 11169, 11297, 0, 11169, 12626, 11169,
+    11233, 11521, 0, 11169, 11169, 12353, 0, 11297, 11697, 11169, 11169, 11169, 11297, 11169, 11297, 0,
+    0, 0, 10465, 11169, 11169, 11489, 0, 0, 12353, 12353, 11297, 12353, 11650, 11169, 10641, 12675,
+    11329, 0, 11265, 11489, 10401, 10465, 11169, 11297, 11169, 0, 11329, 11297, 11169, 11297, 0, 11521,
+    11489, 10497, 11297, 12353, 11265, 11329, 11521, 11297, 10465, 11521, 0, 11169, 11169, 11169, 0, 0,
+    10401, 0, 0, 0, 11233, 11297, 11169, 0, 11297, 0, 11265, 12738, 11089, 11297, 11169, 11489,
+    11233, 0, 11169, 10561, 10673, 0, 11233, 10497, 0, 11169, 11297, 11169, 11297, 11169, 0, 10433,
+    11169, 11297, 10641, 11233, 10561, 11233, 11297, 10433, 10401, 10401, 11297, 10529, 10673, 0, 10433, 0,
+    11233, 12306, 11489, 0, 11489, 11297, 11521, 11521, 11169, 10529, 0, 10497, 0, 0, 11233, 10465,
+    0, 11457, 10497, 11169, 10401, 10433, 10433, 10433, 11265, 11169, 10401, 11297, 11329, 10497, 11169, 11169,
+    11265, 0, 11169, 0, 11169, 11809, 11521, 11521, 11489, 10401, 10433, 12785, 12818, 0, 0, 10561,
+    10401, 12866, 0, 10529, 0, 11169, 10401, 11329, 0, 0, 12913, 11457, 12785, 11553, 10641, 10497,
+    10497, 11521, 0, 10433, 12946, 10497, 0, 11297, 11169, 10641, 10497, 0, 0, 12913, 11265, 11233,
+    0, 10497, 10401, 10641, 10497, 10433, 11233, 10497, 11089, 10561, 0, 10465, 0, 0, 10465, 10641,
+    11233, 10401, 10401, 0, 11169, 10641, 11169, 10673, 10401, 0, 10465, 12866, 11265, 10401, 12353, 0,
+    0, 12353, 0, 11297, 11169, 11169, 11169, 12353, 12353, 11169, 11297, 12994, 11297, 11169, 10465, 11169,
+    10497, 11265, 10401, 11489, 0, 11169, 10401, 11329, 11297, 10641, 10497, 12353, 10401, 11265, 10401, 11297,
+    10401, 0, 11169, 10401, 11233, 0, 11297, 11089, 11297, 0, 0, 11233, 0, 11169, 0, 0,
+    0, 11297, 0, 10465, 0, 0, 11169, 11297, 13042, 10497, 10401, 10465, 11265, 11521, 0, 11169,
+    11297, 10401, 0, 11089, 0, 11265, 11089, 11265, 11265, 10497, 0, 10497, 11297, 11233, 0, 10898,
+    11297, 11362, 11169, 0, 12353, 12353, 11297, 11297, 11297, 12578, 0, 11169, 11233, 12626, 11521, 10641,
+    0, 13090, 0, 11329, 0, 11489, 10497, 0, 0, 0, 10465, 13139, 0, 10497, 10401, 10497,
+    0, 11169, 0, 11329, 11489, 0, 11265, 11265, 0, 13202, 0, 0, 11265, 11521, 0, 10433,
+    11169, 11521, 0, 0, 11265, 11521, 11265, 11329, 10401, 10465, 0, 11265, 10497, 10465, 0, 0,
+    0, 10465, 11233, 13250, 0, 11169, 11297, 0, 0, 10401, 0, 0, 11457, 10465, 13298, 11521,
+    0, 11169, 10401, 10401, 0, 10433, 11169, 10529, 11089, 0, 0, 10641, 0, 11233, 0, 0,
+    10465, 0, 0, 0, 10401, 13090, 11297, 11169, 10497, 10497, 11521, 10401, 10465, 0, 0, 0,
+    0, 11169, 10497, 11169, 11297, 0, 12578, 11521, 13345, 11297, 0, 0, 10401, 10401, 10497, 10529,
+    10497, 11233, 11457, 10465, 11169, 0, 11297, 13379, 11457, 12946, 0, 0, 0, 11233, 12353, 0,
+    0, 0, 10497, 0, 10401, 0, 0, 10401, 13442, 0, 10401, 0, 10401, 10641, 0, 11297,
+    0, 0, 11089, 13490, 11297, 11329, 0, 11169, 0, 0, 10529, 10433, 11089, 11169, 10465, 0,
+    12353, 0, 11729, 10594, 10673, 0, 11169, 11169, 11089, 10497, 0, 10401, 11297, 0, 10465, 12353,
+    11233, 0, 11233, 11489, 0, 0, 0, 11297, 0, 11265, 10401, 10433, 12353, 13538, 11457, 0,
+    13586, 11233, 11489, 11697, 13635, 0, 11297, 11521, 10497, 11457, 11489, 11233, 11297, 11233, 10465, 11297,
+    0, 10433, 0, 13698, 0, 11457, 0, 12946, 10497, 11809, 0, 11233, 0, 10401, 0, 13746,
+    0, 10561, 11089, 0, 11265, 0, 10641, 10497, 11489, 12578, 11553, 0, 10465, 10497, 12946, 10433,
+    11169, 11938, 11489, 11489, 12353, 11297, 0, 11521, 0, 11297, 11233, 11169, 0, 0, 0, 13793,
+    11169, 10561, 0, 12353, 11233, 11457, 10465, 11297, 11169, 0, 11169, 0, 11297, 11809, 11089, 11489,
+    0, 11489, 11169, 0, 11297, 11233, 11297, 11233, 0, 10561, 0, 0, 11297, 0, 0, 11297,
+    0, 0, 11297, 11297, 11233, 0, 10497, 10529, 11457, 11169, 11297, 11265, 0, 11297, 0, 0,
+    11089, 11089, 10529, 11457, 11233, 11233, 11297, 0, 12353, 0, 0, 11233, 10401, 0, 11297, 11297,
+    11297, 10401, 11297, 0, 0, 11297, 0, 11489, 0, 11297, 11297, 0, 0, 11169, 11169, 0,
+    11297, 11169, 0, 0, 0, 11297, 11169, 11489, 0, 10433, 0, 0, 10641, 11265, 0, 11089,
+    11297, 11169, 0, 11521, 11489, 0, 10465, 10497, 0, 0, 0, 11089, 10401, 10401, 10497, 11169,
+    0, 11169, 0, 10561, 11089, 10497, 10561, 11265, 10497, 12353, 0, 12353, 0, 0, 10529, 10465,
+    11169, 11169, 10433, 10465, 11265, 0, 11169, 0, 11457, 11521, 13827, 11265, 0, 11169, 10433, 0,
+    10401, 0, 10561, 0, 11521, 13889, 11553, 0, 10433, 10401, 0, 10561, 11521, 10401, 10465, 0,
+    10497, 0, 0, 11489, 0, 11457, 0, 13922, 10641, 11489, 0, 0, 0, 11122, 10641, 13970,
+    0, 14018, 0, 10465, 0, 0, 0, 14067, 0, 0, 0, 10561, 11297, 13298, 0, 10401,
+    11201, 10465, 11297, 10433, 10497, 0, 10465, 11457, 10401, 11329, 0, 11169, 10465, 11169, 11233, 0,
+    10497, 10497, 11297, 11169, 0, 0, 0, 0, 11265, 0, 11297, 10401, 11265, 0, 10465, 14130,
+    10497, 11169, 0, 11265, 0, 0, 11297, 11265, 12738, 11297, 11169, 11265, 10465, 0, 11169, 0,
+    11297, 11489, 10401, 11521, 11265, 10401, 11297, 11297, 10401, 10465, 11521, 10497, 11521, 10433, 0, 13042,
+    0, 0, 10465, 10401, 10401, 10465, 14178, 11265, 12785, 14226, 11169, 11169, 11297, 14274, 0, 0,
+    11169, 11169, 11521, 0, 0, 10497, 14322, 10497, 11297, 10465, 0, 11265, 0, 10401, 0, 11233,
+    11169, 11297, 10497, 10401, 10497, 11169, 0, 11089, 10561, 12785, 12353, 10641, 10561, 12353, 12353, 12785,
+    0, 10465, 10497, 10433, 12785, 10561, 11169, 11233, 11521, 10465, 11089, 0, 10497, 0, 14370, 11169,
+    14418, 0, 0, 0, 0, 14466, 0, 11329, 0, 0, 14514, 0, 0, 0, 11265, 10401,
+    11233, 11233, 11329, 11329, 0, 11329, 10465, 0, 11169, 10529, 11457, 0, 11521, 11169, 11329, 11521,
+    10433, 0, 11457, 11169, 11169, 11809, 10529, 0, 10673, 11521, 10594, 0, 11265, 11297, 0, 0,
+    11233, 14562, 0, 0, 10561, 11457, 0, 11169, 0, 0, 0, 0, 0, 11233, 12353, 11297,
+    0, 10497, 0, 11169, 0, 10433, 10561, 14610, 11521, 0, 0, 11521, 11809, 0, 11233, 10433,
+    11521, 11297, 11521, 10641, 11521, 0, 11457, 12353, 0, 12353, 0, 12353, 11169, 0, 0, 0,
+    14657, 11169, 14691, 0, 0, 0, 10401, 10401, 14754, 0, 11169, 14802, 10497, 10673, 0, 11169,
+    11297, 14850, 11329, 11265, 10497, 10401, 0, 0, 10561, 11169, 13345, 0, 10465, 11457, 11329, 0,
+    0, 0, 0, 10465, 0, 0, 11489, 0, 10433, 0, 11297, 10401, 10465, 11169, 11169, 11521,
+    11169, 0, 0, 0, 0, 0, 0, 10465, 14899, 11265, 0, 10401, 11457, 14963, 0, 0,
+    11297, 11457, 11233, 15026, 0, 0, 0, 11297, 11297, 10401, 10465, 11297, 10401, 11089, 0, 0,
+    0, 0, 10433, 0, 0, 0, 11329, 0, 0, 10401, 10433, 11329, 0, 0, 0, 10465,
+    0, 0, 11265, 10465, 0, 15074, 0, 0, 12353, 11410, 11489, 11169, 11297, 11297, 15122, 10497,
+    10497, 10465, 10401, 0, 11233, 11521, 11297, 11297, 11169, 11265, 12738, 11265, 10401, 10673, 11265, 12578,
+    10433, 11169, 10465, 0, 11265, 10433, 11297, 0, 10401, 12866, 10401, 11265, 0, 0, 0, 10401,
+    11169, 11297, 11265, 11729, 11265, 0, 10561, 0, 11489, 11297, 0, 0, 10401, 0, 11169, 11169,
+    0, 12785, 0, 10465, 10465, 11233, 11521, 0, 12353, 11489, 12353, 10465, 0, 11457, 10465, 10497,
+    0, 10465, 11169, 11521, 11521, 12306, 11521, 11521, 13298, 10465, 0, 0, 0, 10401, 11329, 11169,
+    0, 15170, 11169, 0, 10673, 11553, 0, 0, 10497, 15218, 11169, 0, 11089, 0, 0, 11169,
+    10561, 0, 10673, 15266, 0, 0, 10529, 0, 11297, 11169, 11297, 12785, 11489, 11489, 15314, 15361,
+    15393, 15361, 15425, 15457, 15489, 15489, 15393, 15521, 0, 15521, 0, 15361, 0, 0, 15425, 15554,
+    15603, 15361, 0, 0, 15667, 15361, 15393, 15729, 15393, 15521, 15457, 15762, 15811, 15521, 0, 15521,
+    15874, 0, 15457, 15923, 0, 15393, 15393, 15985, 16018, 15457, 15521, 15457, 16065, 0, 15985, 0,
+    0, 15457, 0, 15489, 16097, 16129, 16129, 16162, 16129, 15457, 16210, 16065, 15521, 0, 0, 15521,
+    16257, 0, 16290, 15425, 16338, 15489, 16386, 16434, 16481, 16514, 16561, 16593, 16593, 0, 16625, 16657,
+    15985, 0, 16593, 16657, 0, 16481, 16657, 16689, 16722, 16657, 16657, 0, 0, 16481, 0, 0,
+    16657, 16561, 15489, 0, 15457, 15457, 0, 16769, 16802, 15361, 16850, 16850, 0, 16769, 15361, 15521,
+    15521, 15457, 15425, 15554, 16897, 16514, 15521, 16897, 0, 16897, 0, 16931, 16993, 16897, 15729, 17026,
+    17074, 0, 15361, 0, 17122, 16689, 17170, 0, 0, 15457, 16689, 15393, 15521, 17217, 15457, 16689,
+    0, 17250, 15521, 17298, 17346, 0, 17394, 16897, 17443, 17506, 16657, 0, 16657, 16593, 0, 0,
+    15521, 16593, 16657, 16657, 16657, 17554, 16657, 15393, 15489, 15457, 17601, 17633, 0, 0, 16657, 17601,
+    16657, 17667, 16593, 16593, 16593, 16593, 16593, 16657, 16657, 15489, 17730, 16657, 15425, 0, 16481, 16657,
+    17779, 17217, 16065, 17601, 15521, 0, 17842, 0, 15521, 16769, 16769, 17890, 0, 0, 17941, 16897,
+    0, 0, 17601, 17601, 15521, 18035, 15521, 15457, 15361, 18100, 0, 15521, 18178, 15457, 0, 15457,
+    16689, 15985, 0, 0, 18226, 0, 15489, 18274, 0, 16481, 0, 16897, 15393, 15361, 16129, 0,
+    16657, 15457, 17601, 0, 0, 16593, 0, 17601, 18322, 16481, 0, 18369, 0, 18402, 17601, 18451,
+    0, 18515, 0, 0, 18578, 15361, 15361, 15361, 15521, 16897, 15521, 17298, 16897, 18626, 15425, 0,
+    0, 0, 18675, 18737, 16689, 0, 17074, 16481, 0, 16897, 18770, 18819, 16657, 0, 18882, 18931,
+    18994, 0, 17601, 0, 19042, 19090, 16897, 16657, 19137, 17554, 0, 15457, 16481, 19170, 0, 15361,
+    16481, 19219, 19282, 16657, 15874, 15361, 15361, 19329, 19362, 0, 19410, 19458, 15457, 0, 19506, 19554,
+    15457, 0, 0, 19603, 15393, 16657, 19665, 17633, 0, 0, 15457, 0, 0, 0, 19698, 19746,
+    19794, 19843, 0, 16689, 19905, 16657, 15521, 0, 0, 15393, 19329, 15985, 16657, 16657, 16657, 15521,
+    15521, 0, 0, 16481, 16657, 19939, 16657, 20002, 16657, 16657, 16897, 15985, 20049, 20084, 0, 17601,
+    19905, 16657, 16657, 16657, 0, 15985, 0, 17601, 16657, 20162, 16481, 20209, 0, 0, 20243, 15457,
+    20306, 15521, 15489, 20355, 20418, 16257, 15521, 15457, 0, 20466, 19329, 16897, 16689, 15521, 15521, 15361,
+    0, 0, 16897, 16689, 17554, 15457, 19329, 0, 0, 15521, 20514, 17217, 0, 15457, 0, 0,
+    15521, 0, 20562, 20610, 15361, 15361, 0, 16097, 16097, 0, 20658, 0, 0, 20706, 0, 19282,
+    16129, 16657, 20754, 16481, 20803, 15457, 0, 0, 16657, 16689, 15521, 16657, 0, 20866, 16657, 16657,
+    15457, 15457, 16481, 15457, 15457, 16593, 19282, 0, 17633, 15457, 15457, 19905, 20914, 0, 16129, 20961,
+    15393, 0, 20418, 17554, 16593, 0, 20994, 15393, 0, 21042, 21090, 0, 0, 15985, 16769, 15521,
+    15521, 0, 0, 21140, 18737, 16897, 16481, 21218, 15729, 16065, 17554, 0, 0, 20209, 21266, 21316,
+    17667, 0, 16129, 0, 0, 15393, 21394, 0, 16897, 0, 21443, 15985, 21507, 16657, 0, 17633,
+    15361, 21570, 18882, 0, 20706, 15361, 21618, 16769, 15457, 15521, 16897, 21666, 20466, 16897, 15729, 0,
+    21714, 15521, 15457, 20466, 15521, 15521, 0, 16657, 16993, 15361, 15489, 15489, 0, 15457, 0, 21762,
+    0, 16689, 15457, 16897, 0, 15729, 0, 15457, 21714, 0, 19329, 0, 19329, 0, 15457, 15361,
+    16689, 15425, 15361, 15361, 0, 16657, 15457, 15393, 0, 16561, 15457, 20961, 21810, 0, 15457, 20209,
+    0, 0, 16065, 21859, 0, 15457, 15521, 15521, 0, 0, 16689, 15425, 0, 15521, 16514, 21921,
+    21953, 21985, 22017, 0, 21953, 22049, 22081, 22114, 22161, 0, 22194, 21985, 0, 22241, 22273, 22307,
+    22370, 22417, 22449, 22481, 0, 22515, 22273, 22577, 22610, 22081, 22417, 0, 22659, 22723, 22786, 0,
+    22834, 22883, 0, 22945, 22978, 0, 23029, 0, 21985, 22577, 23121, 23153, 22449, 23185, 23217, 23121,
+    22161, 21921, 22417, 22417, 0, 23250, 23297, 0, 23330, 23378, 23426, 23473, 0, 21985, 23506, 22081,
+    23473, 0, 23185, 23554, 22417, 22417, 23602, 23650, 23699, 0, 0, 23762, 21953, 23810, 21953, 21985,
+    0, 22417, 23859, 23185, 23922, 22273, 22417, 23970, 24019, 21921, 0, 0, 24082, 24130, 24178, 24226,
+    0, 0, 21985, 22577, 24273, 0, 24308, 24308, 24386, 0, 23297, 24435, 0, 21985, 24498, 24546,
+    24594, 24642, 24691, 0, 0, 24755, 22241, 22417, 0, 21921, 24817, 24817, 24851, 0, 23217, 24914,
+    22273, 0, 23185, 0, 24963, 23185, 25026, 25073, 25105, 22081, 25139, 0, 0, 25202, 25249, 25073,
+    21985, 0, 25281, 25073, 25315, 25379, 23217, 23473, 25442, 25490, 25537, 25570, 25617, 25649, 25682, 25617,
+    25617, 25731, 25793, 25649, 25826, 25875, 25937, 25971, 25937, 26034, 26083, 25617, 26147, 0, 26210, 26258,
+    26308, 0, 26385, 26418, 26467, 26531, 26385, 0, 26595, 26595, 26659, 26721, 26754, 26802, 26850,
+};
+
+constexpr uint8_t en_level_data[] = {
+    0x02, 0x0C, 0x02, 0x16, 0x02, 0x0B, 0x02, 0x04, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0B, 0x02, 0x04, 0x0B, 0x02, 0x02,
+    0x02, 0x04, 0x0D, 0x02, 0x18, 0x02, 0x0C, 0x0C, 0x02, 0x02, 0x0F, 0x0C, 0x02, 0x04, 0x0F, 0x02, 0x01, 0x02, 0x0D,
+    0x02, 0x15, 0x02, 0x01, 0x0E, 0x0E, 0x02, 0x0F, 0x02, 0x04, 0x0D, 0x0C, 0x02, 0x01, 0x0C, 0x02, 0x0B, 0x0E, 0x02,
+    0x0B, 0x0C, 0x02, 0x0F, 0x0C, 0x02, 0x04, 0x0B, 0x0E, 0x02, 0x02, 0x0B, 0x0C, 0x02, 0x0E, 0x0C, 0x02, 0x02, 0x0D,
+    0x02, 0x03, 0x02, 0x04, 0x0B, 0x0C, 0x02, 0x04, 0x18, 0x02, 0x02, 0x18, 0x02, 0x04, 0x0F, 0x0E, 0x02, 0x05, 0x02,
+    0x04, 0x16, 0x02, 0x02, 0x0D, 0x0C, 0x02, 0x01, 0x0C, 0x0C, 0x02, 0x0E, 0x02, 0x02, 0x16, 0x02, 0x01, 0x16, 0x02,
+    0x0D, 0x0C, 0x03, 0x22, 0x03, 0x20, 0x03, 0x21, 0x03, 0x1F, 0x03, 0x04, 0x03, 0x04, 0x0C, 0x03, 0x02, 0x03, 0x18,
+    0x03, 0x15, 0x03, 0x04, 0x18, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x0D, 0x03, 0x0F, 0x03, 0x0E, 0x0E, 0x03, 0x16, 0x03,
+    0x17, 0x03, 0x0B, 0x03, 0x18, 0x0C, 0x03, 0x05, 0x03, 0x01, 0x03, 0x04, 0x16, 0x03, 0x04, 0x19, 0x03, 0x04, 0x22,
+    0x03, 0x03, 0x03, 0x02, 0x0D, 0x03, 0x05, 0x22, 0x03, 0x02, 0x0F, 0x03, 0x03, 0x20, 0x03, 0x19, 0x03, 0x02, 0x0B,
+    0x03, 0x23, 0x03, 0x03, 0x0E, 0x03, 0x02, 0x0D, 0x0E, 0x03, 0x16, 0x0C, 0x03, 0x01, 0x0E, 0x0D, 0x03, 0x01, 0x15,
+    0x03, 0x04, 0x0F, 0x03, 0x0B, 0x0B, 0x03, 0x0B, 0x0E, 0x03, 0x02, 0x0C, 0x03, 0x04, 0x17, 0x03, 0x18, 0x0B, 0x03,
+    0x16, 0x0E, 0x03, 0x0E, 0x18, 0x03, 0x17, 0x0E, 0x03, 0x0B, 0x0C, 0x03, 0x0C, 0x19, 0x03, 0x01, 0x18, 0x03, 0x03,
+    0x0E, 0x0E, 0x03, 0x02, 0x0F, 0x0D, 0x03, 0x0E, 0x16, 0x03, 0x04, 0x0B, 0x03, 0x02, 0x15, 0x03, 0x04, 0x15, 0x03,
+    0x05, 0x0C, 0x03, 0x01, 0x0C, 0x03, 0x04, 0x0E, 0x0E, 0x03, 0x04, 0x0E, 0x03, 0x02, 0x22, 0x03, 0x16, 0x0B, 0x03,
+    0x02, 0x0B, 0x0C, 0x03, 0x04, 0x0D, 0x0C, 0x03, 0x03, 0x18, 0x03, 0x0C, 0x18, 0x03, 0x03, 0x15, 0x03, 0x05, 0x18,
+    0x03, 0x01, 0x0E, 0x03, 0x0B, 0x18, 0x03, 0x06, 0x03, 0x0D, 0x18, 0x03, 0x18, 0x0E, 0x03, 0x0C, 0x0F, 0x03, 0x18,
+    0x0D, 0x03, 0x16, 0x0D, 0x03, 0x02, 0x16, 0x03, 0x05, 0x17, 0x03, 0x04, 0x0B, 0x0C, 0x03, 0x0E, 0x0B, 0x03, 0x02,
+    0x0B, 0x0E, 0x03, 0x0E, 0x0C, 0x03, 0x0F, 0x0E, 0x03, 0x03, 0x22, 0x03, 0x0E, 0x0F, 0x03, 0x0D, 0x0C, 0x03, 0x0F,
+    0x0C, 0x03, 0x0C, 0x0D, 0x04, 0x2C, 0x04, 0x1F, 0x04, 0x21, 0x04, 0x23, 0x04, 0x22, 0x04, 0x2A, 0x04, 0x2D, 0x04,
+    0x2B, 0x04, 0x20, 0x04, 0x29, 0x04, 0x0F, 0x04, 0x17, 0x04, 0x0E, 0x04, 0x15, 0x04, 0x0D, 0x04, 0x18, 0x04, 0x19,
+    0x04, 0x04, 0x04, 0x03, 0x04, 0x0F, 0x19, 0x04, 0x05, 0x04, 0x0E, 0x0B, 0x04, 0x17, 0x0D, 0x04, 0x16, 0x04, 0x19,
+    0x18, 0x04, 0x19, 0x0F, 0x04, 0x05, 0x0F, 0x18, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x04, 0x0B, 0x04, 0x02, 0x22, 0x04,
+    0x0F, 0x0E, 0x04, 0x04, 0x17, 0x04, 0x04, 0x15, 0x04, 0x16, 0x0F, 0x04, 0x0C, 0x0F, 0x04, 0x0D, 0x18, 0x04, 0x05,
+    0x17, 0x04, 0x01, 0x04, 0x0E, 0x17, 0x04, 0x02, 0x0B, 0x16, 0x04, 0x04, 0x0F, 0x04, 0x0E, 0x0D, 0x04, 0x0F, 0x23,
+    0x04, 0x0D, 0x21, 0x04, 0x15, 0x16, 0x04, 0x02, 0x04, 0x0B, 0x22, 0x04, 0x18, 0x0E, 0x04, 0x04, 0x16, 0x04, 0x20,
+    0x0F, 0x04, 0x04, 0x18, 0x04, 0x02, 0x0D, 0x04, 0x0B, 0x17, 0x04, 0x23, 0x0E, 0x04, 0x17, 0x0B, 0x04, 0x03, 0x0E,
+    0x04, 0x05, 0x0E, 0x04, 0x01, 0x0C, 0x04, 0x04, 0x0D, 0x0D, 0x04, 0x05, 0x23, 0x04, 0x19, 0x19, 0x04, 0x17, 0x0E,
+    0x04, 0x20, 0x0D, 0x04, 0x03, 0x22, 0x04, 0x21, 0x0E, 0x04, 0x04, 0x22, 0x04, 0x05, 0x19, 0x04, 0x0E, 0x18, 0x04,
+    0x02, 0x18, 0x04, 0x18, 0x18, 0x04, 0x0E, 0x22, 0x04, 0x05, 0x0F, 0x0C, 0x04, 0x04, 0x23, 0x04, 0x04, 0x0C, 0x04,
+    0x0C, 0x0F, 0x0F, 0x04, 0x01, 0x0E, 0x04, 0x0C, 0x22, 0x04, 0x0F, 0x22, 0x04, 0x22, 0x0F, 0x04, 0x0F, 0x0F, 0x04,
+    0x1F, 0x0D, 0x04, 0x0D, 0x15, 0x04, 0x0F, 0x0C, 0x04, 0x0E, 0x19, 0x04, 0x19, 0x0E, 0x04, 0x03, 0x17, 0x04, 0x01,
+    0x0B, 0x04, 0x0E, 0x0E, 0x04, 0x20, 0x0B, 0x04, 0x17, 0x19, 0x04, 0x05, 0x22, 0x04, 0x06, 0x04, 0x23, 0x0C, 0x04,
+    0x16, 0x0D, 0x04, 0x21, 0x0D, 0x04, 0x21, 0x0C, 0x04, 0x02, 0x0F, 0x04, 0x16, 0x16, 0x04, 0x05, 0x21, 0x04, 0x0E,
+    0x15, 0x04, 0x05, 0x0F, 0x05, 0x23, 0x05, 0x2D, 0x05, 0x21, 0x05, 0x22, 0x05, 0x37, 0x05, 0x2C, 0x05, 0x2D, 0x0E,
+    0x05, 0x2B, 0x05, 0x35, 0x05, 0x2B, 0x0E, 0x05, 0x23, 0x15, 0x05, 0x21, 0x15, 0x05, 0x21, 0x10, 0x05, 0x23, 0x0C,
+    0x05, 0x2D, 0x0F, 0x05, 0x24, 0x0D, 0x05, 0x1F, 0x0E, 0x05, 0x36, 0x05, 0x20, 0x0B, 0x05, 0x19, 0x05, 0x0C, 0x05,
+    0x0F, 0x05, 0x18, 0x05, 0x17, 0x05, 0x04, 0x05, 0x05, 0x0F, 0x05, 0x0E, 0x0F, 0x05, 0x03, 0x05, 0x0D, 0x05, 0x05,
+    0x05, 0x29, 0x05, 0x17, 0x15, 0x0C, 0x05, 0x19, 0x19, 0x05, 0x15, 0x05, 0x16, 0x05, 0x19, 0x0C, 0x05, 0x1F, 0x05,
+    0x03, 0x17, 0x05, 0x03, 0x23, 0x05, 0x2A, 0x0B, 0x05, 0x2A, 0x0C, 0x05, 0x1F, 0x19, 0x05, 0x16, 0x0B, 0x0B, 0x05,
+    0x23, 0x0B, 0x05, 0x1F, 0x0B, 0x0C, 0x05, 0x21, 0x0D, 0x05, 0x04, 0x0D, 0x05, 0x0E, 0x05, 0x23, 0x0E, 0x05, 0x04,
+    0x0F, 0x05, 0x23, 0x0F, 0x05, 0x02, 0x0B, 0x05, 0x0E, 0x0D, 0x05, 0x17, 0x0D, 0x05, 0x0E, 0x0D, 0x17, 0x05, 0x18,
+    0x18, 0x05, 0x0B, 0x05, 0x04, 0x0B, 0x05, 0x0C, 0x0B, 0x05, 0x33, 0x05, 0x0F, 0x0F, 0x05, 0x18, 0x0D, 0x05, 0x17,
+    0x17, 0x05, 0x15, 0x15, 0x05, 0x18, 0x0D, 0x0F, 0x05, 0x22, 0x0B, 0x05, 0x0C, 0x0D, 0x05, 0x0D, 0x0D, 0x05, 0x2A,
+    0x05, 0x03, 0x17, 0x19, 0x05, 0x1F, 0x0F, 0x05, 0x29, 0x10, 0x05, 0x02, 0x15, 0x05, 0x22, 0x0E, 0x05, 0x04, 0x0F,
+    0x0E, 0x05, 0x1F, 0x10, 0x05, 0x21, 0x17, 0x05, 0x34, 0x05, 0x16, 0x0B, 0x0D, 0x05, 0x01, 0x05, 0x2C, 0x0D, 0x05,
+    0x03, 0x2A, 0x05, 0x0F, 0x2B, 0x05, 0x1A, 0x0D, 0x17, 0x05, 0x0E, 0x18, 0x05, 0x1F, 0x0B, 0x05, 0x0F, 0x19, 0x05,
+    0x15, 0x1F, 0x05, 0x19, 0x0E, 0x05, 0x05, 0x17, 0x05, 0x2C, 0x0F, 0x05, 0x05, 0x2C, 0x05, 0x22, 0x15, 0x05, 0x03,
+    0x0C, 0x05, 0x01, 0x0C, 0x05, 0x38, 0x05, 0x01, 0x2B, 0x0C, 0x05, 0x29, 0x0F, 0x05, 0x0B, 0x0B, 0x05, 0x05, 0x20,
+    0x05, 0x02, 0x0D, 0x0E, 0x05, 0x16, 0x0D, 0x0B, 0x05, 0x0B, 0x16, 0x05, 0x16, 0x0F, 0x05, 0x0F, 0x17, 0x05, 0x29,
+    0x0E, 0x05, 0x18, 0x0B, 0x05, 0x0F, 0x21, 0x05, 0x0D, 0x0B, 0x06, 0x22, 0x06, 0x37, 0x06, 0x41, 0x06, 0x23, 0x06,
+    0x2C, 0x06, 0x2D, 0x06, 0x23, 0x19, 0x06, 0x29, 0x10, 0x0B, 0x06, 0x22, 0x0B, 0x15, 0x06, 0x21, 0x06, 0x2A, 0x0D,
+    0x06, 0x24, 0x0B, 0x15, 0x06, 0x22, 0x15, 0x06, 0x2D, 0x0C, 0x0B, 0x06, 0x29, 0x06, 0x29, 0x0C, 0x06, 0x33, 0x06,
+    0x42, 0x06, 0x40, 0x06, 0x2E, 0x18, 0x06, 0x2E, 0x15, 0x06, 0x24, 0x06, 0x21, 0x19, 0x06, 0x23, 0x23, 0x06, 0x20,
+    0x0D, 0x06, 0x19, 0x19, 0x06, 0x0F, 0x06, 0x19, 0x0F, 0x06, 0x1A, 0x06, 0x0E, 0x06, 0x2E, 0x06, 0x19, 0x06, 0x18,
+    0x06, 0x17, 0x23, 0x06, 0x20, 0x06, 0x0B, 0x0D, 0x06, 0x24, 0x0C, 0x06, 0x05, 0x06, 0x1A, 0x15, 0x0D, 0x06, 0x2A,
+    0x06, 0x29, 0x0B, 0x06, 0x23, 0x0C, 0x06, 0x02, 0x0D, 0x06, 0x19, 0x29, 0x06, 0x1F, 0x06, 0x03, 0x19, 0x06, 0x29,
+    0x0F, 0x06, 0x2A, 0x0B, 0x06, 0x2B, 0x0F, 0x06, 0x15, 0x15, 0x0B, 0x06, 0x18, 0x0D, 0x06, 0x20, 0x0B, 0x06, 0x04,
+    0x06, 0x17, 0x06, 0x0C, 0x0D, 0x0E, 0x06, 0x0D, 0x2E, 0x06, 0x05, 0x16, 0x29, 0x06, 0x1F, 0x10, 0x06, 0x05, 0x23,
+    0x06, 0x02, 0x0B, 0x0E, 0x0D, 0x0B, 0x06, 0x16, 0x0D, 0x19, 0x06, 0x0D, 0x0F, 0x1F, 0x0E, 0x06, 0x1A, 0x0B, 0x06,
+    0x17, 0x21, 0x06, 0x33, 0x0C, 0x06, 0x01, 0x1A, 0x06, 0x01, 0x06, 0x23, 0x15, 0x06, 0x0D, 0x2E, 0x0B, 0x06, 0x01,
+    0x21, 0x1A, 0x06, 0x01, 0x15, 0x06, 0x0F, 0x0F, 0x06, 0x15, 0x1F, 0x0B, 0x06, 0x16, 0x06, 0x01, 0x2B, 0x06, 0x03,
+    0x1F, 0x0B, 0x06, 0x21, 0x0B, 0x06, 0x05, 0x29, 0x15, 0x06, 0x1F, 0x1F, 0x06, 0x38, 0x0B, 0x06, 0x17, 0x2B, 0x06,
+    0x03, 0x06, 0x1A, 0x0D, 0x06, 0x05, 0x1F, 0x15, 0x06, 0x19, 0x0C, 0x06, 0x2B, 0x06, 0x18, 0x15, 0x06, 0x2C, 0x16,
+    0x06, 0x0B, 0x17, 0x06, 0x0F, 0x34, 0x06, 0x20, 0x19, 0x06, 0x0D, 0x16, 0x15, 0x06, 0x0B, 0x06, 0x23, 0x0B, 0x06,
+    0x0B, 0x0B, 0x06, 0x1F, 0x0E, 0x06, 0x05, 0x23, 0x0F, 0x06, 0x15, 0x06, 0x0B, 0x17, 0x0E, 0x06, 0x0D, 0x38, 0x06,
+    0x0D, 0x06, 0x0D, 0x16, 0x0B, 0x0D, 0x06, 0x0E, 0x0D, 0x06, 0x36, 0x06, 0x21, 0x0B, 0x0B, 0x06, 0x17, 0x17, 0x06,
+    0x10, 0x0D, 0x0E, 0x06, 0x24, 0x0B, 0x06, 0x22, 0x0B, 0x06, 0x01, 0x35, 0x06, 0x21, 0x22, 0x06, 0x19, 0x23, 0x06,
+    0x21, 0x0E, 0x06, 0x29, 0x10, 0x06, 0x0D, 0x1F, 0x06, 0x16, 0x0D, 0x0B, 0x06, 0x0F, 0x19, 0x06, 0x0D, 0x23, 0x06,
+    0x35, 0x06, 0x01, 0x20, 0x06, 0x1F, 0x0B, 0x06, 0x17, 0x1F, 0x06, 0x03, 0x0C, 0x15, 0x0B, 0x06, 0x01, 0x0C, 0x06,
+    0x0D, 0x21, 0x06, 0x0C, 0x0B, 0x0D, 0x1F, 0x06, 0x01, 0x29, 0x06, 0x1F, 0x18, 0x0B, 0x06, 0x16, 0x1F, 0x10, 0x06,
+    0x10, 0x1A, 0x06, 0x03, 0x1F, 0x06, 0x0D, 0x20, 0x06, 0x1F, 0x0C, 0x06, 0x2D, 0x19, 0x06, 0x0B, 0x15, 0x06, 0x0B,
+    0x23, 0x15, 0x07, 0x41, 0x07, 0x2D, 0x07, 0x23, 0x07, 0x4B, 0x07, 0x24, 0x07, 0x2C, 0x07, 0x1F, 0x0E, 0x07, 0x33,
+    0x07, 0x2D, 0x15, 0x07, 0x21, 0x07, 0x37, 0x07, 0x15, 0x17, 0x19, 0x07, 0x0E, 0x19, 0x07, 0x19, 0x07, 0x0F, 0x07,
+    0x16, 0x07, 0x21, 0x15, 0x0B, 0x07, 0x2A, 0x07, 0x1A, 0x0B, 0x07, 0x0C, 0x21, 0x1A, 0x07, 0x01, 0x16, 0x0B, 0x07,
+    0x16, 0x0F, 0x07, 0x03, 0x15, 0x07, 0x0B, 0x17, 0x2D, 0x07, 0x15, 0x07, 0x19, 0x0F, 0x07, 0x01, 0x10, 0x0D, 0x0D,
+    0x29, 0x07, 0x29, 0x07, 0x0C, 0x07, 0x05, 0x07, 0x2B, 0x07, 0x2E, 0x0D, 0x07, 0x0B, 0x07, 0x33, 0x0C, 0x07, 0x01,
+    0x19, 0x07, 0x24, 0x0D, 0x07, 0x2E, 0x07, 0x0F, 0x17, 0x07, 0x01, 0x23, 0x07, 0x21, 0x0D, 0x07, 0x23, 0x19, 0x07,
+    0x15, 0x0C, 0x15, 0x07, 0x2E, 0x0F, 0x07, 0x0D, 0x18, 0x07, 0x05, 0x21, 0x15, 0x07, 0x05, 0x1F, 0x07, 0x0D, 0x21,
+    0x07, 0x21, 0x1F, 0x0B, 0x07, 0x0F, 0x29, 0x07, 0x0F, 0x21, 0x07, 0x38, 0x18, 0x07, 0x20, 0x0D, 0x07, 0x20, 0x07,
+    0x2B, 0x10, 0x0D, 0x0C, 0x07, 0x34, 0x0B, 0x07, 0x03, 0x1F, 0x0B, 0x07, 0x23, 0x10, 0x07, 0x18, 0x0B, 0x07, 0x19,
+    0x33, 0x07, 0x1F, 0x1F, 0x07, 0x05, 0x17, 0x23, 0x07, 0x15, 0x1A, 0x0F, 0x07, 0x3F, 0x07, 0x0F, 0x2D, 0x0D, 0x07,
+    0x33, 0x0B, 0x07, 0x15, 0x0F, 0x1F, 0x07, 0x2B, 0x1F, 0x07, 0x1F, 0x07, 0x3D, 0x07, 0x03, 0x1F, 0x15, 0x07, 0x33,
+    0x15, 0x07, 0x17, 0x07, 0x01, 0x07, 0x15, 0x21, 0x0D, 0x07, 0x35, 0x10, 0x0C, 0x07, 0x23, 0x1F, 0x08, 0x37, 0x19,
+    0x08, 0x41, 0x08, 0x23, 0x1F, 0x08, 0x19, 0x08, 0x0F, 0x08, 0x17, 0x21, 0x08, 0x1F, 0x10, 0x0B, 0x08, 0x37, 0x08,
+    0x2D, 0x19, 0x08, 0x17, 0x10, 0x16, 0x08, 0x05, 0x08, 0x15, 0x0C, 0x15, 0x08, 0x24, 0x0D, 0x08, 0x18, 0x21, 0x18,
+    0x08, 0x23, 0x1F, 0x0D, 0x08, 0x2B, 0x0D, 0x08, 0x2D, 0x23, 0x08, 0x03, 0x18, 0x0F, 0x0B, 0x08, 0x36, 0x08, 0x03,
+    0x33, 0x08, 0x0C, 0x0B, 0x23, 0x08, 0x05, 0x1F, 0x0B, 0x08, 0x03, 0x29, 0x0F, 0x08, 0x0B, 0x15, 0x21, 0x08, 0x23,
+    0x09, 0x17, 0x29, 0x09, 0x33, 0x29, 0x09, 0x49, 0x0D,
+};
+
+constexpr HyphenationAutomaton en_automaton = {
+    en_symbols,
+    28u,
+    28u,
+    en_dense,
+    8399u,
+    en_label,
+    3u,
+    en_child_base,
+    en_child_offset,
+    en_fail,
+    en_levels,
+    en_level_data,
 };
@@ -3,733 +3,2022 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t es_trie_data[] = {
-    0x01, 0x04, 0x16, 0x02, 0x0E, 0x0C, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x22, 0x0F, 0x2C, 0x0F, 0x22, 0x0D, 0x2C, 0x0D,
-    0x0B, 0x16, 0x0B, 0x20, 0x15, 0x16, 0x15, 0x0C, 0x02, 0x0C, 0x17, 0x0E, 0x04, 0x2C, 0x05, 0x04, 0x0D, 0x04, 0x21,
-    0x04, 0x18, 0x0D, 0x04, 0x17, 0x04, 0x0D, 0x17, 0x04, 0x0E, 0x0D, 0x04, 0x0D, 0x21, 0x04, 0x0D, 0x21, 0x21, 0x0F,
-    0x0E, 0x0F, 0x0E, 0x0D, 0x0F, 0x0E, 0x17, 0x33, 0x33, 0x0C, 0x33, 0x16, 0x29, 0x29, 0x0C, 0x29, 0x16, 0x21, 0x0C,
-    0x21, 0x0E, 0x34, 0x0D, 0x3E, 0x36, 0x0D, 0x3F, 0x2B, 0x16, 0x0D, 0x3D, 0x3D, 0x0C, 0x3D, 0x16, 0x1F, 0x1F, 0x16,
-    0x2A, 0x2C, 0x0D, 0x0E, 0x0E, 0x21, 0x1F, 0x0C, 0x2A, 0x0D, 0x2A, 0x0B, 0x2A, 0x0B, 0x0C, 0x2A, 0x0B, 0x16, 0x37,
-    0x20, 0x0C, 0x20, 0x16, 0x35, 0x24, 0x47, 0x47, 0x0C, 0x47, 0x16, 0x20, 0x0B, 0x20, 0x0D, 0x0C, 0x20, 0x0D, 0x16,
-    0x20, 0x20, 0x03, 0x17, 0x0E, 0x0D, 0x23, 0x0E, 0x17, 0x17, 0x17, 0x21, 0x16, 0x0D, 0x18, 0x48, 0x49, 0x16, 0x0C,
-    0x0C, 0x16, 0x0C, 0x16, 0x2D, 0x2B, 0x0E, 0x0D, 0x2B, 0x0E, 0x17, 0x17, 0x2B, 0x34, 0x0B, 0x34, 0x0B, 0x0C, 0x34,
-    0x0B, 0x16, 0x21, 0x20, 0x0D, 0x21, 0x0E, 0x17, 0x20, 0x0D, 0x04, 0x0F, 0x19, 0x0C, 0x0D, 0x2E, 0x0F, 0x0E, 0x21,
-    0x17, 0x0E, 0x2D, 0x0E, 0x2B, 0x0E, 0x22, 0x17, 0x17, 0x0E, 0x22, 0x0D, 0x0E, 0x38, 0x19, 0x18, 0x03, 0x0C, 0x22,
-    0x0B, 0x0E, 0x22, 0x0B, 0x18, 0x40, 0x2A, 0x0C, 0x0C, 0x2A, 0x0C, 0x16, 0x18, 0x0D, 0x0C, 0x18, 0x0D, 0x0E, 0x2B,
-    0x21, 0x2B, 0x17, 0x2A, 0x16, 0x02, 0x33, 0x02, 0x33, 0x0C, 0x02, 0x33, 0x16, 0x35, 0x0E, 0x04, 0x0C, 0x20, 0x0C,
-    0x0C, 0x20, 0x0C, 0x16, 0x2B, 0x0E, 0x0E, 0x2B, 0x0E, 0x18, 0x04, 0x0D, 0x0E, 0x0D, 0x19, 0x0E, 0x41, 0x10, 0x2A,
-    0x20, 0x04, 0x0C, 0x0D, 0x03, 0x0E, 0x16, 0x0D, 0x0E, 0x18, 0x0F, 0x05, 0x0E, 0x07, 0x0E, 0xA0, 0x00, 0x51, 0xA0,
-    0x00, 0x71, 0xA0, 0x00, 0xC3, 0xA3, 0x00, 0x71, 0x74, 0x6E, 0x7A, 0xFD, 0xFD, 0xFD, 0xA1, 0x00, 0x71, 0x74, 0xF4,
-    0xA1, 0x00, 0x71, 0x6E, 0xEF, 0xA3, 0x00, 0x71, 0x74, 0x73, 0x6E, 0xEA, 0xEA, 0xEA, 0xA2, 0x00, 0x71, 0x7A, 0x73,
-    0xE1, 0xE1, 0xA0, 0x00, 0xA2, 0xB6, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xD1, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x01, 0xD2, 0x21, 0xAD,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x05, 0xB1, 0xA0, 0x05, 0xC2, 0xA0, 0x05, 0xE2, 0x25, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF,
-    0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F, 0xF1, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0, 0x05, 0x81, 0xA0, 0x06, 0x72,
-    0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0xA2, 0x05, 0x81, 0x6F, 0x61, 0xFA, 0xFD, 0xAE, 0x06, 0x31, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6C, 0x6D, 0x70, 0x71, 0x73, 0x74, 0x76, 0x7A, 0xED, 0xED, 0xF9, 0xED, 0xED, 0xED, 0xED, 0xED,
-    0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0x21, 0x6E, 0xE1, 0xA0, 0x06, 0x01, 0xA0, 0x06, 0x92, 0xA0, 0x06, 0x12, 0x25,
-    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x51, 0x21, 0x61, 0xFD, 0x21, 0xAD, 0xFD,
-    0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6F, 0xFD, 0x28, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x6C, 0xDA,
-    0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xE3, 0xFD, 0x44, 0x75, 0x62, 0x65, 0x6F, 0xFF, 0x65, 0xFF, 0x91, 0xFF, 0xC6, 0xFF,
-    0xEF, 0xA0, 0x04, 0x41, 0xA0, 0x04, 0x52, 0xA0, 0x04, 0x72, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x61,
-    0xF1, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0x75, 0xFE, 0xC5, 0xFE, 0xC8,
-    0xFE, 0xCE, 0xFE, 0xC8, 0xFE, 0xD7, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xDC, 0xFE, 0xC8, 0xFE,
-    0xE1, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xEA, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xF4,
-    0xFE, 0xF4, 0xFF, 0xC7, 0xFF, 0xFD, 0x41, 0x6C, 0xFF, 0x45, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x72, 0xFF,
-    0x3B, 0x22, 0x6E, 0x75, 0xF9, 0xFC, 0x41, 0x78, 0xFF, 0x32, 0x41, 0x78, 0xFF, 0x34, 0x21, 0xB3, 0xFC, 0x41, 0x6E,
-    0xFF, 0x27, 0xA0, 0x01, 0x52, 0x21, 0x64, 0xFD, 0xA0, 0x06, 0x43, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFA, 0x23, 0x6E,
-    0x70, 0x76, 0xF4, 0xFA, 0xFD, 0x21, 0x74, 0xEA, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFA, 0x21, 0x69, 0xED, 0x21, 0x6C,
-    0xFD, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xEA, 0xF4, 0xF7, 0xFD, 0x21, 0x6E, 0xF7, 0x25, 0x61, 0x6F, 0xC3, 0x75, 0x65,
-    0xBB, 0xC0, 0xC8, 0xCB, 0xFD, 0xA1, 0x00, 0x61, 0x69, 0xF5, 0xA0, 0x07, 0xB1, 0x21, 0x62, 0xFD, 0xA0, 0x00, 0xF1,
-    0x21, 0x68, 0xFD, 0x22, 0x69, 0x6F, 0xFA, 0xFA, 0x21, 0x74, 0xF5, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x63,
-    0x73, 0x72, 0x74, 0xEF, 0xF2, 0xFD, 0xEC, 0xA2, 0x06, 0x01, 0x69, 0x65, 0xE0, 0xF7, 0xA0, 0x02, 0x91, 0x21, 0x72,
-    0xFD, 0x21, 0x65, 0xFA, 0x21, 0x65, 0xFD, 0x22, 0x65, 0x72, 0xF7, 0xFD, 0x21, 0x6E, 0xEF, 0x41, 0x6C, 0xFE, 0x6F,
-    0x22, 0x65, 0x75, 0xF9, 0xFC, 0x21, 0x74, 0xE3, 0x21, 0x73, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x41, 0x63,
-    0xFE, 0x5A, 0x21, 0x73, 0xFC, 0x22, 0x65, 0x69, 0xFD, 0xF9, 0x21, 0x64, 0xCB, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x61, 0xD3, 0x21, 0x69, 0xFD, 0x21, 0x6F, 0xB9, 0x21, 0x74, 0xFD, 0xA7, 0x07, 0x62, 0x63,
-    0x67, 0x70, 0x6C, 0x72, 0x78, 0x75, 0xBF, 0xCB, 0xD9, 0xE3, 0xF1, 0xF7, 0xFD, 0x42, 0x63, 0x74, 0xFF, 0xA2, 0xFF,
-    0xA2, 0x41, 0x63, 0xFF, 0x9B, 0x22, 0x69, 0x75, 0xF5, 0xFC, 0x41, 0x69, 0xFF, 0x92, 0x21, 0x63, 0xFC, 0x21, 0x69,
-    0xFD, 0x41, 0xA1, 0xFE, 0x0B, 0x21, 0xC3, 0xFC, 0x41, 0x73, 0xFF, 0x81, 0x21, 0x69, 0xFC, 0xA4, 0x07, 0x62, 0x64,
-    0x66, 0x74, 0x78, 0xE3, 0xEF, 0xF6, 0xFD, 0x41, 0x75, 0xFF, 0x8C, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFD, 0xEB, 0xA2,
-    0x07, 0x62, 0x6D, 0x74, 0xF9, 0xFC, 0xA0, 0x00, 0xF2, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21,
-    0xA9, 0xFD, 0x43, 0x65, 0xC3, 0x74, 0xFF, 0xFA, 0xFF, 0xFD, 0xFF, 0x2A, 0x41, 0x6E, 0xFF, 0x20, 0x21, 0xAD, 0xFC,
-    0x23, 0x65, 0x69, 0xC3, 0xF9, 0xF9, 0xFD, 0x21, 0x64, 0xF9, 0xA3, 0x05, 0x02, 0x6B, 0x70, 0x72, 0xD9, 0xE5, 0xFD,
-    0xA0, 0x07, 0x62, 0xA0, 0x07, 0xA1, 0x21, 0x6C, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x07, 0x82, 0x67, 0xFD, 0xA0, 0x07,
-    0x82, 0xC1, 0x07, 0x82, 0x70, 0xFE, 0xFD, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF2, 0xF7, 0xF7, 0xFA, 0xF7, 0xA0,
-    0x01, 0xA1, 0x21, 0x62, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0x6E, 0xFE, 0xF2, 0xFF, 0x46, 0xFF, 0x7F, 0xFF, 0x95, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE9, 0xFF, 0xFD, 0xA0, 0x0A,
-    0x01, 0x21, 0x74, 0xFD, 0x21, 0x75, 0xFD, 0xA2, 0x00, 0x61, 0x6F, 0x61, 0xDE, 0xFD, 0xA0, 0x08, 0x12, 0xA0, 0x08,
-    0x33, 0xC2, 0x07, 0x82, 0x6D, 0x6E, 0xFD, 0x4D, 0xFD, 0x4D, 0xA0, 0x0B, 0x45, 0x23, 0xA1, 0xA9, 0xB3, 0xFD, 0xFD,
-    0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0x21, 0x73, 0xF7, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0xA1, 0x07, 0x82, 0x6E, 0xFD, 0xA0, 0x08, 0x63, 0xA0, 0x08, 0x92, 0x25, 0xA1,
-    0xA9, 0xAD, 0xB3, 0xBA, 0xFA, 0xFD, 0xFD, 0xFD, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xB9,
-    0xFF, 0xBC, 0xFF, 0xBF, 0xFF, 0xEA, 0xFF, 0x70, 0xFF, 0x70, 0xFF, 0xF5, 0x42, 0x73, 0x75, 0xFF, 0xEA, 0xFF, 0x96,
-    0xA0, 0x09, 0x91, 0x21, 0x68, 0xFD, 0xA1, 0x09, 0x81, 0x63, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x69, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x65, 0xFD, 0xA2, 0x00, 0x61, 0x65, 0x69, 0xE2, 0xFD, 0xA0, 0x00, 0x61, 0xA0, 0x0C, 0xC3, 0x21, 0x75,
-    0xFD, 0xA0, 0x04, 0x91, 0x21, 0x74, 0xFD, 0x22, 0x64, 0x73, 0xF7, 0xFD, 0x22, 0x6E, 0x73, 0xF5, 0xF5, 0x21, 0x6F,
-    0xFB, 0x22, 0x74, 0x7A, 0xED, 0xED, 0x21, 0x6E, 0xFB, 0x21, 0x61, 0xFD, 0x21, 0x64, 0xFD, 0x43, 0x63, 0x65, 0x6E,
-    0xFF, 0xEF, 0xFD, 0x20, 0xFF, 0xFD, 0x21, 0x6E, 0xD8, 0x23, 0x65, 0x61, 0x69, 0xD8, 0xF3, 0xFD, 0x21, 0x6C, 0xF9,
-    0x41, 0x69, 0xFD, 0x1D, 0xA0, 0x04, 0xA2, 0xA0, 0x04, 0xC2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xB3, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x22, 0x6C,
-    0x6F, 0xDC, 0xF1, 0xA2, 0x00, 0x61, 0x61, 0x69, 0xD4, 0xFB, 0xA0, 0x0D, 0x43, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x62, 0xF4, 0x21, 0xA1, 0xFD, 0x22, 0xC3, 0x61, 0xFD, 0xFA, 0x23, 0x66, 0x6D, 0x72, 0xEF,
-    0xF2, 0xFB, 0xA0, 0x0D, 0x73, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x0D, 0x42, 0x21, 0x69,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x70, 0xFD, 0x22, 0xA1, 0xB3, 0xF1, 0xFD, 0x21, 0x70, 0xEF, 0x21, 0x6F, 0xFD, 0x21,
-    0x72, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x6D, 0xE3, 0x21, 0xA1, 0xFD, 0x22, 0x61, 0xC3, 0xFA, 0xFD, 0x21, 0x6C, 0xFB,
-    0x21, 0x73, 0xFD, 0x41, 0x70, 0xFE, 0x28, 0x21, 0x73, 0xFC, 0x21, 0x6C, 0xCB, 0x22, 0x69, 0x65, 0xFA, 0xFD, 0x45,
-    0x61, 0xC3, 0x65, 0x69, 0x68, 0xFF, 0xB0, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xFB, 0x21, 0x6E, 0xF0, 0xA0,
-    0x06, 0xD2, 0x41, 0x69, 0xFB, 0xE3, 0xA0, 0x0E, 0x92, 0x21, 0x65, 0xFD, 0xC3, 0x0D, 0xB3, 0x63, 0x72, 0x6A, 0xFF,
-    0xF6, 0xFB, 0xD9, 0xFF, 0xFD, 0x21, 0x6F, 0xEE, 0x21, 0xAD, 0xFD, 0x43, 0x67, 0x69, 0xC3, 0xFB, 0xC7, 0xFF, 0xE8,
-    0xFF, 0xFD, 0xA0, 0x06, 0xB2, 0xA1, 0x0E, 0x92, 0x61, 0xDB, 0x22, 0x63, 0x72, 0xF8, 0xFB, 0x21, 0x65, 0xFB, 0x41,
-    0x72, 0xFB, 0xAD, 0xA1, 0x0E, 0x92, 0x73, 0xCA, 0x23, 0x65, 0x61, 0x69, 0xC5, 0xFB, 0xC5, 0x21, 0x61, 0xBE, 0xC6,
-    0x0D, 0xB3, 0x72, 0x6C, 0x61, 0x6D, 0x74, 0x6F, 0xFF, 0xD3, 0xFF, 0xEA, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0xFB,
-    0x9A, 0xA0, 0x05, 0x71, 0x21, 0x6F, 0xFD, 0x21, 0x64, 0xFD, 0xC3, 0x05, 0x81, 0x64, 0x65, 0x75, 0xFC, 0x8E, 0xFF,
-    0x9D, 0xFF, 0xFD, 0xC1, 0x0E, 0x92, 0x6F, 0xFF, 0x91, 0x43, 0xA1, 0xA9, 0xB3, 0xFF, 0x8B, 0xFF, 0x8B, 0xFF, 0x8B,
-    0x45, 0x61, 0x65, 0x6C, 0x6F, 0xC3, 0xFF, 0x81, 0xFF, 0x81, 0xFF, 0xF0, 0xFF, 0x81, 0xFF, 0xF6, 0x42, 0x61, 0x6F,
-    0xFF, 0x71, 0xFF, 0x71, 0x41, 0x72, 0xFF, 0x8C, 0x21, 0x70, 0xFC, 0x41, 0x72, 0xFF, 0x63, 0x21, 0x65, 0xFC, 0x41,
-    0x61, 0xFB, 0x3B, 0x42, 0x6D, 0x74, 0xFB, 0x37, 0xFF, 0xFC, 0xC7, 0x0D, 0xB3, 0x6E, 0x67, 0x6C, 0x7A, 0x6D, 0x63,
-    0x73, 0xFF, 0xB4, 0xFF, 0x63, 0xFF, 0xD0, 0xFF, 0xE0, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0x41, 0x65, 0xFF, 0x5B,
-    0x41, 0x73, 0xFF, 0x8F, 0x21, 0x65, 0xFC, 0xA2, 0x0D, 0xB3, 0x70, 0x72, 0xF5, 0xFD, 0x42, 0x61, 0x65, 0xFF, 0x27,
-    0xFF, 0x39, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFF, 0x20, 0xFF, 0x95, 0xFF, 0x20, 0xFF, 0x20, 0xA2, 0x0D, 0xB3, 0x72,
-    0x6C, 0xEC, 0xF3, 0xA0, 0x0D, 0xE3, 0xC1, 0x0D, 0xE3, 0x6E, 0xFA, 0xE8, 0xA0, 0x0E, 0x72, 0xA1, 0x05, 0x81, 0x69,
-    0xFD, 0xA1, 0x0D, 0xE3, 0x6E, 0xFB, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xEA, 0xEA, 0xED, 0xFB, 0xEA, 0x41, 0x76,
-    0xFF, 0x0D, 0x41, 0x6D, 0xFF, 0x09, 0x22, 0x65, 0x6F, 0xF8, 0xFC, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0x72, 0xFE, 0xD7, 0xFE, 0xE4, 0xFF, 0x23, 0xFF, 0x8D, 0xFF, 0xB0, 0xFF, 0xCB, 0xFF, 0xE8, 0xFF, 0xFB, 0x21, 0x74,
-    0xE7, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFB, 0xB0, 0x21, 0xBA, 0xFC, 0x22, 0x75, 0xC3, 0xF9, 0xFD, 0xA0, 0x01, 0x11,
-    0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x21, 0x64, 0xFB, 0xA2, 0x04, 0xA2, 0x63, 0x72,
-    0xEA, 0xFD, 0x21, 0x6C, 0xE8, 0x21, 0x75, 0xFD, 0x21, 0x62, 0xFD, 0xA1, 0x04, 0xC2, 0x6D, 0xFD, 0x45, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xFD, 0xE3, 0xFD, 0xE3, 0xFD, 0xE3, 0xFD, 0xE3, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0xFD, 0x94, 0xFD, 0xD0, 0xFD, 0xD0, 0xFD, 0xD0, 0xFF, 0xDB, 0xFD, 0xD0, 0xFF, 0xF0, 0x22, 0xA1, 0xAD,
-    0xB4, 0xB4, 0x24, 0x61, 0xC3, 0x65, 0x69, 0xAF, 0xFB, 0xAF, 0xAF, 0x21, 0x62, 0xF7, 0xC2, 0x01, 0x11, 0x61, 0x6F,
-    0xFF, 0xA3, 0xFF, 0xA3, 0x21, 0x62, 0xF7, 0x21, 0xAD, 0xFD, 0xA2, 0x04, 0x91, 0x69, 0xC3, 0xEE, 0xFD, 0x41, 0x74,
-    0xFA, 0x1F, 0x21, 0x72, 0xFC, 0x21, 0x6F, 0xFD, 0xA1, 0x0D, 0xB2, 0x62, 0xFD, 0x41, 0x72, 0xFE, 0x63, 0x21, 0x61,
-    0xFC, 0xA1, 0x0D, 0xB2, 0x74, 0xFD, 0xA0, 0x0D, 0xB2, 0xA0, 0x0E, 0xB2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xDE, 0xEA, 0xEF, 0xEF, 0xEF, 0xF5,
-    0x42, 0x65, 0x6F, 0xFF, 0x88, 0xFF, 0xF1, 0xC3, 0x00, 0x61, 0x61, 0x6F, 0x72, 0xFD, 0xF4, 0xFF, 0x3C, 0xFF, 0xF9,
-    0x41, 0x72, 0xFB, 0x6B, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xFB, 0x4A, 0x42, 0x6F, 0xC3, 0xFB, 0x46, 0xFF, 0xFC, 0x43,
-    0x72, 0x69, 0x73, 0xFB, 0x3C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x73, 0x74, 0xFB, 0x32, 0xFB, 0x32, 0x41, 0xAD, 0xFB,
-    0x48, 0x22, 0x69, 0xC3, 0xF5, 0xFC, 0x21, 0x6D, 0xFB, 0x41, 0x6D, 0xFB, 0x1F, 0x21, 0x72, 0xFC, 0x21, 0xAD, 0xFD,
-    0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x41, 0x76, 0xFB, 0x10, 0x21, 0xA1, 0xFC, 0xA0, 0x04, 0xE2, 0x21, 0x70, 0xFD, 0x23,
-    0x61, 0xC3, 0x75, 0xF3, 0xF7, 0xFD, 0x21, 0x72, 0xF9, 0x41, 0x69, 0xFB, 0x5E, 0x21, 0x64, 0xFC, 0x21, 0x6E, 0xFD,
-    0x41, 0xB1, 0xFA, 0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xBA, 0xFD, 0x23, 0x6F, 0x75, 0xC3, 0xF3, 0xFA, 0xFD, 0x41, 0x73,
-    0xFF, 0x42, 0x21, 0xBA, 0xFC, 0x42, 0x75, 0xC3, 0xFA, 0xF7, 0xFF, 0xFD, 0x41, 0x67, 0xFA, 0xD3, 0x41, 0x7A, 0xFE,
-    0x14, 0x41, 0x6A, 0xFA, 0xC8, 0x23, 0xA9, 0xAD, 0xB3, 0xF4, 0xF8, 0xFC, 0x42, 0x61, 0xC3, 0xF9, 0x40, 0xFB, 0x35,
-    0x42, 0x6D, 0x74, 0xF9, 0x39, 0xF9, 0x39, 0x43, 0x7A, 0x6D, 0x73, 0xFF, 0xF2, 0xFA, 0xAF, 0xFF, 0xF9, 0x45, 0x65,
-    0xC3, 0x69, 0x6F, 0x71, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xF6, 0xFF, 0xDD, 0xFA, 0xA5, 0x41, 0xAD, 0xFF, 0x76, 0x42,
-    0x69, 0xC3, 0xFF, 0x72, 0xFF, 0xFC, 0x43, 0xA1, 0xA9, 0xB3, 0xFA, 0x8A, 0xFA, 0x8A, 0xFA, 0x8A, 0x44, 0x61, 0xC3,
-    0x65, 0x6F, 0xFA, 0x80, 0xFF, 0xF6, 0xFA, 0x80, 0xFA, 0x80, 0x41, 0x65, 0xFA, 0xD8, 0x21, 0x72, 0xFC, 0x42, 0x6E,
-    0x74, 0xFA, 0xA1, 0xFA, 0x6C, 0xA0, 0x00, 0x40, 0x21, 0x74, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0xA9, 0xAD, 0xFA, 0x94,
-    0xFF, 0xFD, 0x22, 0x65, 0xC3, 0xE9, 0xF9, 0x22, 0x61, 0x72, 0xE1, 0xFB, 0x41, 0x67, 0xFF, 0x42, 0x41, 0xBA, 0xFF,
-    0x28, 0x42, 0x75, 0xC3, 0xFF, 0x24, 0xFF, 0xFC, 0xCE, 0x07, 0x62, 0x62, 0x64, 0x66, 0x67, 0x63, 0x6A, 0x6C, 0x6E,
-    0x6D, 0x70, 0x65, 0x71, 0x7A, 0x73, 0xFF, 0x00, 0xFF, 0x1A, 0xFF, 0x27, 0xFF, 0x40, 0xFF, 0x57, 0xFF, 0x65, 0xFF,
-    0x97, 0xFF, 0xAB, 0xFF, 0xBC, 0xFF, 0xEC, 0xFF, 0xF1, 0xFF, 0x33, 0xFF, 0x33, 0xFF, 0xF9, 0xA0, 0x05, 0x02, 0x49,
-    0x6F, 0x63, 0x69, 0x66, 0x67, 0x76, 0x61, 0x73, 0x74, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x71, 0xFA, 0x0C, 0xFA, 0x0C,
-    0xFA, 0x0C, 0xF8, 0x8F, 0xFA, 0x0C, 0xFA, 0x0C, 0x41, 0x64, 0xF8, 0x73, 0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0xC3,
-    0x07, 0x62, 0x6E, 0x6D, 0x76, 0xFF, 0xDA, 0xFE, 0xDD, 0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0xF7, 0x21, 0x65, 0xFC, 0x41,
-    0x61, 0xF9, 0xD3, 0x22, 0x69, 0x67, 0xF9, 0xFC, 0xC4, 0x07, 0x62, 0x62, 0x72, 0x63, 0x6A, 0xFE, 0xC1, 0xFF, 0xFB,
-    0xF9, 0xCA, 0xFA, 0x73, 0x42, 0xA1, 0xB3, 0xF9, 0xBB, 0xF9, 0xBB, 0x43, 0x61, 0xC3, 0x6F, 0xF9, 0xB4, 0xFF, 0xF9,
-    0xF9, 0xB4, 0x42, 0x63, 0x71, 0xFF, 0xF6, 0xF9, 0xAA, 0x42, 0x63, 0x71, 0xFF, 0xD0, 0xF9, 0xA3, 0x21, 0xAD, 0xF9,
-    0x22, 0x69, 0xC3, 0xEF, 0xFD, 0xC1, 0x05, 0x81, 0x74, 0xFC, 0x34, 0x41, 0x74, 0xFC, 0x2E, 0x21, 0xA1, 0xFC, 0x22,
-    0x61, 0xC3, 0xF3, 0xFD, 0x42, 0xA9, 0xB3, 0xF8, 0x05, 0xF8, 0x05, 0x48, 0x72, 0x61, 0x73, 0x6D, 0x65, 0xC3, 0x64,
-    0x66, 0xF7, 0xFE, 0xF7, 0xFE, 0xF7, 0xFE, 0xFF, 0x16, 0xF7, 0xFE, 0xFF, 0xF9, 0xF7, 0xFE, 0xF9, 0x7B, 0xC1, 0x05,
-    0x81, 0x72, 0xF7, 0xE5, 0x42, 0xAD, 0xA1, 0xFF, 0xFA, 0xF7, 0xDF, 0x43, 0x69, 0xC3, 0x74, 0xFF, 0xDA, 0xFF, 0xF9,
-    0xF9, 0x55, 0x41, 0xA1, 0xF9, 0x4E, 0x42, 0x61, 0xC3, 0xF9, 0x4A, 0xFF, 0xFC, 0x41, 0x7A, 0xF9, 0x40, 0x21, 0xAD,
-    0xFC, 0x22, 0x69, 0xC3, 0xF9, 0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x69, 0xFD, 0xC5, 0x07, 0x62, 0x62, 0x6D, 0x6E, 0x73,
-    0x74, 0xFF, 0x95, 0xFF, 0xA7, 0xFF, 0xD9, 0xFF, 0xE7, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x6F, 0xF9, 0x1C, 0xF9, 0x1C,
-    0xF9, 0x1C, 0xC2, 0x07, 0x82, 0x62, 0x6D, 0xF9, 0x15, 0xFF, 0xF6, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xF7,
-    0xF9, 0xF0, 0xF9, 0xF0, 0xF9, 0xF0, 0xF9, 0xF0, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFE, 0xBD, 0xFE, 0xEA,
-    0xFF, 0x13, 0xFF, 0x2F, 0xFF, 0xCB, 0xFF, 0xF0, 0xA1, 0x00, 0x61, 0x65, 0xED, 0x43, 0x6E, 0x72, 0x73, 0xFE, 0xD2,
-    0xF8, 0xE1, 0xF8, 0xE1, 0xA0, 0x0C, 0x12, 0xA1, 0x0C, 0x12, 0x72, 0xFD, 0x21, 0x6E, 0xF8, 0x21, 0xB3, 0xFD, 0x23,
-    0x61, 0x6F, 0xC3, 0xF2, 0xF5, 0xFD, 0x41, 0x70, 0xF7, 0x45, 0x41, 0x6E, 0xF7, 0x41, 0x21, 0x65, 0xFC, 0x21, 0x64,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x73, 0x74, 0xEC, 0xFD, 0x41, 0xA9, 0xF8, 0xBA, 0x21, 0x65, 0xD6,
-    0x21, 0x69, 0xFD, 0xC7, 0x0F, 0x93, 0x65, 0x6C, 0x64, 0x6E, 0x72, 0xC3, 0x6D, 0xFF, 0xBE, 0xF9, 0x7B, 0xFF, 0xD6,
-    0xFF, 0xF1, 0xF8, 0x9F, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xA1, 0xFC, 0xEB, 0x21, 0xC3, 0xFC, 0x42, 0x70, 0x74, 0xF8,
-    0xA9, 0xF7, 0x03, 0x22, 0x75, 0x65, 0xF6, 0xF9, 0x41, 0xA1, 0xF8, 0x74, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xF8, 0x70,
-    0xFF, 0xFC, 0xF8, 0x70, 0xF8, 0x70, 0x21, 0x74, 0xF3, 0x41, 0x65, 0xF6, 0xE3, 0x21, 0x75, 0xFC, 0x21, 0x6C, 0xFD,
-    0x41, 0x61, 0xFA, 0xF6, 0x41, 0x6E, 0xFC, 0xB6, 0x21, 0x65, 0xFC, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF8, 0x4B, 0x23,
-    0x63, 0x69, 0x74, 0xEE, 0xF9, 0xFC, 0x41, 0x69, 0xF8, 0x66, 0x21, 0x6D, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD,
-    0xC6, 0x0F, 0x93, 0x63, 0x73, 0x66, 0x6C, 0x72, 0x74, 0xFF, 0xB7, 0xFF, 0xCD, 0xFF, 0xD7, 0xFF, 0xEC, 0xFB, 0x06,
-    0xFF, 0xFD, 0x41, 0x75, 0xFC, 0x7F, 0x21, 0x63, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6D, 0xFF, 0x57, 0x21, 0x65, 0xFC,
-    0x21, 0x6C, 0xAA, 0x21, 0x70, 0xFD, 0x41, 0x74, 0xFF, 0x4A, 0x41, 0x65, 0xF8, 0x29, 0x41, 0x6D, 0xF6, 0x7F, 0x21,
-    0xAD, 0xFC, 0x41, 0x75, 0xF8, 0x1E, 0x44, 0x61, 0x69, 0xC3, 0x72, 0xF8, 0x1A, 0xFF, 0xF5, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x22, 0x70, 0x74, 0xE4, 0xF3, 0xA5, 0x0F, 0x93, 0x6A, 0x6C, 0x6D, 0x6E, 0x73, 0xCB, 0xD2, 0xD8, 0xDB, 0xFB, 0x41,
-    0x69, 0xFC, 0x36, 0x21, 0x70, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x41, 0x63, 0xFA, 0x65, 0x21, 0x69, 0xFC,
-    0x41, 0xAD, 0xF7, 0xCF, 0x42, 0x69, 0xC3, 0xF7, 0xCB, 0xFF, 0xFC, 0x21, 0x64, 0xF9, 0xA3, 0x0F, 0x93, 0x63, 0x66,
-    0x72, 0xE8, 0xEF, 0xFD, 0x41, 0x62, 0xFA, 0xEF, 0xA1, 0x0F, 0x93, 0x72, 0xFC, 0x42, 0xA9, 0xB3, 0xF7, 0x9E, 0xF7,
-    0x9E, 0x42, 0x61, 0xC3, 0xF7, 0x97, 0xFF, 0xF9, 0x21, 0x74, 0xF9, 0x41, 0x74, 0xFF, 0x50, 0xA2, 0x0F, 0xC3, 0x73,
-    0x72, 0xF9, 0xFC, 0xA0, 0x0F, 0xC3, 0xC3, 0x0F, 0xC3, 0x6E, 0x6D, 0x72, 0xFD, 0x8F, 0xFA, 0x1F, 0xF7, 0x7F, 0x25,
-    0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xEA, 0xF1, 0xF4, 0xF1, 0xF1, 0x41, 0x79, 0xF8, 0x11, 0x21, 0x61, 0xFC, 0x48, 0x69,
-    0x68, 0x61, 0x65, 0x6F, 0x75, 0xC3, 0x72, 0xFE, 0xC2, 0xF8, 0x91, 0xFF, 0x31, 0xFF, 0x82, 0xFF, 0xB1, 0xFF, 0xBE,
-    0xFF, 0xEE, 0xFF, 0xFD, 0x41, 0x74, 0xF8, 0x78, 0x21, 0x73, 0xFC, 0x41, 0x73, 0xF8, 0x71, 0x21, 0x65, 0xFC, 0x22,
-    0x65, 0x6F, 0xF6, 0xFD, 0x22, 0x62, 0x72, 0xD4, 0xFB, 0x41, 0x73, 0xFD, 0x21, 0x21, 0x61, 0xFC, 0x41, 0x61, 0xFD,
-    0x39, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x62, 0xFD, 0xA3, 0x00, 0x61,
-    0x75, 0x6F, 0x65, 0xE1, 0xEA, 0xFD, 0x41, 0x70, 0xF6, 0x09, 0x21, 0x6D, 0xFC, 0x41, 0x6A, 0xF6, 0x02, 0xA0, 0x05,
-    0x52, 0x21, 0x74, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xC3, 0xFD, 0x22, 0x62, 0x6C, 0xF0, 0xFD, 0x22, 0x69, 0x6F, 0xE8,
-    0xFB, 0x21, 0x65, 0xFB, 0x21, 0x6C, 0xFD, 0xC1, 0x0E, 0xB2, 0x67, 0xF9, 0x8A, 0x41, 0x67, 0xF5, 0x63, 0xA1, 0x0E,
-    0xB2, 0x65, 0xFC, 0x41, 0xB1, 0xF9, 0x7B, 0xA1, 0x0E, 0xB2, 0xC3, 0xFC, 0x43, 0xA1, 0xA9, 0xB3, 0xF5, 0x51, 0xF5,
-    0x51, 0xF5, 0x51, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xF5, 0x47, 0xFF, 0xF6, 0xF5, 0x47, 0xF5, 0x47, 0x21, 0x74, 0xF3,
-    0xC2, 0x0E, 0xB2, 0x64, 0x6E, 0xFA, 0x38, 0xFF, 0xFD, 0xA0, 0x10, 0xD2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF9, 0x3A, 0xFB, 0x1F, 0xFF, 0xB7, 0xFF,
-    0xC1, 0xFF, 0xCA, 0xFF, 0xE9, 0xFF, 0xF5, 0x21, 0x73, 0xEA, 0x41, 0x78, 0xF8, 0x7E, 0x21, 0xB3, 0xFC, 0x21, 0xC3,
-    0xFD, 0x22, 0x61, 0x69, 0xF3, 0xFD, 0xC2, 0x00, 0x61, 0x65, 0x72, 0xFF, 0x8C, 0xFF, 0xFB, 0x42, 0x61, 0x6F, 0xF6,
-    0x48, 0xF6, 0x48, 0x21, 0x65, 0xF9, 0x21, 0x6D, 0xFD, 0x41, 0x65, 0xF6, 0x3B, 0x21, 0x65, 0xFC, 0x21, 0x6D, 0xFD,
-    0x22, 0x75, 0x65, 0xF3, 0xFD, 0x41, 0x65, 0xF5, 0x60, 0x21, 0x72, 0xFC, 0x41, 0x6F, 0xF5, 0x59, 0x21, 0x72, 0xFC,
-    0x41, 0x72, 0xFB, 0x39, 0x21, 0x67, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x70, 0xFD, 0x41, 0x68, 0xFB, 0x2C, 0x21, 0x6F,
-    0xFC, 0x21, 0x63, 0xFD, 0x41, 0x69, 0xF6, 0x72, 0x21, 0x6E, 0xFC, 0x41, 0x72, 0xF6, 0x6B, 0x23, 0x6C, 0x6D, 0x65,
-    0xF2, 0xF9, 0xFC, 0x41, 0xB3, 0xFC, 0x0A, 0x42, 0x6F, 0xC3, 0xFC, 0x06, 0xFF, 0xFC, 0x21, 0x73, 0xF9, 0xA0, 0x05,
-    0x22, 0x21, 0x65, 0xFD, 0x42, 0x6A, 0x6E, 0xFF, 0xFD, 0xF9, 0x78, 0x21, 0x6F, 0xF9, 0x42, 0x65, 0x69, 0xFF, 0xFD,
-    0xF5, 0x0B, 0x24, 0x65, 0x61, 0x69, 0x74, 0xBC, 0xD4, 0xE6, 0xF9, 0x41, 0x74, 0xFF, 0xA2, 0xC4, 0x02, 0xB1, 0x62,
-    0x63, 0x6E, 0x74, 0xFF, 0x9B, 0xFF, 0xA2, 0xFF, 0xF3, 0xFF, 0xFC, 0x41, 0x74, 0xF6, 0xD3, 0x21, 0x73, 0xFC, 0xA1,
-    0x01, 0x82, 0x65, 0xFD, 0x42, 0x6F, 0xC3, 0xF8, 0xA2, 0xFA, 0x85, 0x41, 0x69, 0xF5, 0xE2, 0x21, 0x65, 0xFC, 0x41,
-    0xA9, 0xFD, 0x00, 0x42, 0x65, 0xC3, 0xFC, 0xFC, 0xFF, 0xFC, 0x41, 0x62, 0xF5, 0xB3, 0xA4, 0x09, 0xA3, 0x6D, 0x63,
-    0x6A, 0x72, 0xE3, 0xEE, 0xF5, 0xFC, 0x41, 0xAD, 0xFA, 0xC6, 0x42, 0x69, 0xC3, 0xFA, 0xC2, 0xFF, 0xFC, 0xA1, 0x09,
-    0xA3, 0x6D, 0xF9, 0xA0, 0x09, 0xA3, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFC, 0x2F, 0xFE, 0xC3, 0xF4, 0x14, 0xF4, 0x14,
-    0xA1, 0x09, 0xA3, 0x6A, 0xF3, 0x43, 0x61, 0xC3, 0x65, 0xF4, 0x02, 0xF5, 0xF7, 0xF4, 0x02, 0x21, 0x72, 0xF6, 0x21,
-    0x65, 0xFD, 0xA1, 0x09, 0xA3, 0x6D, 0xFD, 0xA0, 0x09, 0xD3, 0xC1, 0x09, 0xD3, 0x6A, 0xF6, 0x40, 0x25, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xF7, 0xF7, 0xF7, 0xFA, 0xF7, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0x85, 0xFF,
-    0xA7, 0xFF, 0xBD, 0xFF, 0xC2, 0xFF, 0xD2, 0xFF, 0xE7, 0xFF, 0xF5, 0x41, 0x73, 0xF6, 0x3B, 0x42, 0x6C, 0x75, 0xF6,
-    0x37, 0xFF, 0xFC, 0x41, 0x6C, 0xF6, 0x30, 0x41, 0x72, 0xFF, 0x59, 0x41, 0x6D, 0xF6, 0x28, 0x44, 0xA1, 0xAD, 0xB3,
-    0xBA, 0xFF, 0xF4, 0xF6, 0x27, 0xFF, 0xF8, 0xFF, 0xFC, 0xC5, 0x01, 0x82, 0x61, 0xC3, 0x69, 0x6F, 0x75, 0xFF, 0xE0,
-    0xFF, 0xF3, 0xF6, 0x1A, 0xFF, 0xEB, 0xFF, 0xEF, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xA0, 0xFF, 0xA0, 0xFF,
-    0xA0, 0xFF, 0xA0, 0xFF, 0xA0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xFF, 0xDE, 0xFF, 0x66, 0xFF, 0x66,
-    0xFF, 0x66, 0xFF, 0x66, 0xFF, 0x66, 0xFF, 0xF0, 0x42, 0x6E, 0x78, 0xFF, 0x8E, 0xFF, 0xEA, 0xA0, 0x01, 0x82, 0x41,
-    0x72, 0xF5, 0x3F, 0x41, 0x72, 0xF5, 0x0B, 0x22, 0x61, 0x6F, 0xF8, 0xFC, 0x42, 0x6E, 0x70, 0xF4, 0xEA, 0xF4, 0xEA,
-    0x21, 0x65, 0xF9, 0x41, 0x70, 0xF4, 0xE0, 0x22, 0x61, 0x6F, 0xFC, 0xFC, 0x41, 0x61, 0xFA, 0xE0, 0x21, 0x75, 0xFC,
-    0x41, 0x6D, 0xFF, 0x00, 0x21, 0xA1, 0xFC, 0x41, 0x65, 0xF4, 0xBD, 0x22, 0xC3, 0x69, 0xF9, 0xFC, 0x41, 0x69, 0xFB,
-    0x63, 0x21, 0x6C, 0xFC, 0x42, 0x6D, 0x63, 0xF4, 0x9C, 0xF3, 0x1F, 0x22, 0x61, 0x69, 0xF6, 0xF9, 0x41, 0x61, 0xFE,
-    0xDD, 0x21, 0x67, 0xFC, 0x41, 0x6C, 0xF4, 0x89, 0x42, 0x61, 0x69, 0xFB, 0x45, 0xF4, 0xEA, 0x43, 0x63, 0x68, 0x6E,
-    0xF4, 0xEC, 0xFF, 0xD2, 0xF4, 0xFD, 0x21, 0x65, 0xF6, 0x24, 0x61, 0x65, 0x6C, 0x72, 0xE5, 0xE8, 0xEC, 0xFD, 0x41,
-    0x63, 0xF4, 0x85, 0x21, 0x65, 0xFC, 0x41, 0xB3, 0xF4, 0x72, 0x21, 0xC3, 0xFC, 0x41, 0x67, 0xF4, 0x5A, 0x21, 0x75,
-    0xFC, 0x22, 0x6D, 0x72, 0xF6, 0xFD, 0x41, 0x69, 0xF4, 0x6E, 0x41, 0x62, 0xF2, 0xCD, 0x21, 0x69, 0xFC, 0x21, 0x76,
-    0xFD, 0x21, 0x6F, 0xFD, 0xCC, 0x09, 0xA3, 0x62, 0x63, 0x64, 0x67, 0x6C, 0x6E, 0x70, 0x66, 0x72, 0x73, 0x74, 0x6D,
-    0xFF, 0x6B, 0xFF, 0x77, 0xFF, 0x7E, 0xFF, 0x87, 0xFF, 0x95, 0xFF, 0xA8, 0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xEA, 0xFF,
-    0xEF, 0xFA, 0x67, 0xFF, 0xFD, 0xC1, 0x02, 0x91, 0x69, 0xF4, 0x16, 0x21, 0x63, 0xFA, 0x21, 0x69, 0xFD, 0x41, 0x64,
-    0xF4, 0x78, 0x22, 0x75, 0x65, 0xFC, 0xAC, 0x41, 0x6F, 0xFA, 0x27, 0x42, 0x63, 0x61, 0xFF, 0xFC, 0xF8, 0x70, 0x41,
-    0x76, 0xF2, 0x79, 0x21, 0xAD, 0xFC, 0x42, 0x69, 0xC3, 0xF4, 0x24, 0xFF, 0xFD, 0x21, 0x75, 0xF9, 0xC2, 0x02, 0x91,
-    0x61, 0x68, 0xFF, 0x7D, 0xFA, 0x12, 0xC6, 0x09, 0xA3, 0x66, 0x6C, 0x6E, 0x71, 0x78, 0x76, 0xFF, 0xCF, 0xFF, 0xD6,
-    0xFF, 0xDF, 0xFF, 0xF4, 0xFF, 0xF7, 0xFE, 0x17, 0x42, 0x6F, 0x61, 0xF2, 0x4A, 0xF2, 0x4A, 0x21, 0x75, 0xF9, 0x41,
-    0x6C, 0xFF, 0x2D, 0x21, 0x61, 0xFC, 0x21, 0x75, 0xFD, 0xC3, 0x09, 0xA3, 0x63, 0x67, 0x6E, 0xFF, 0xF3, 0xFF, 0xFD,
-    0xF3, 0xB3, 0x41, 0x73, 0xFB, 0x5F, 0x44, 0x74, 0x61, 0xC3, 0x65, 0xF3, 0xA3, 0xF2, 0x26, 0xF4, 0x1B, 0xF2, 0x26,
-    0x43, 0x6F, 0x61, 0x6C, 0xF2, 0x19, 0xF2, 0x19, 0xFF, 0xF3, 0x42, 0x63, 0x74, 0xF2, 0x0F, 0xF2, 0x0F, 0x21, 0x6E,
-    0xF9, 0x22, 0x75, 0x65, 0xEC, 0xFD, 0x41, 0x73, 0xF2, 0x00, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x6F, 0xF8,
-    0x25, 0xA4, 0x09, 0xA3, 0x62, 0x63, 0x66, 0x70, 0xC8, 0xED, 0xF9, 0xFC, 0x41, 0x7A, 0xF1, 0xE7, 0x21, 0x69, 0xFC,
-    0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x09, 0xA3, 0x74, 0xFD, 0x41, 0x6D, 0xF4, 0x2B, 0x21, 0x69, 0xFC, 0xA1,
-    0x09, 0xD3, 0x6E, 0xFD, 0x41, 0x74, 0xF4, 0x1F, 0x21, 0x69, 0xFC, 0xA1, 0x09, 0xD3, 0x64, 0xFD, 0x41, 0x69, 0xF4,
-    0x16, 0xA1, 0x09, 0xD3, 0x74, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xE6, 0xFF, 0xF2, 0xFD, 0xC7, 0xFD,
-    0xC7, 0xFF, 0xFB, 0xA0, 0x0C, 0x13, 0x21, 0x67, 0xFD, 0x22, 0x63, 0x74, 0xFA, 0xFA, 0x21, 0x70, 0xF5, 0x22, 0x70,
-    0x6D, 0xF8, 0xFD, 0xA2, 0x05, 0x22, 0x6F, 0x75, 0xF0, 0xFB, 0xA0, 0x0A, 0x92, 0xA0, 0x0A, 0xB3, 0xA0, 0x0B, 0x13,
-    0x23, 0xA1, 0xA9, 0xB3, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0x65, 0x6F, 0xC3, 0xF6, 0xF6, 0xF6, 0xF9, 0xA1, 0x0A, 0xB3,
-    0x73, 0xF7, 0xA0, 0x0A, 0xE3, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x28, 0x72, 0x68,
-    0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xCD, 0xD4, 0xD7, 0xED, 0xD7, 0xD7, 0xD7, 0xF5, 0x21, 0x72, 0xEF, 0x21, 0x65,
-    0xFD, 0x48, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x74, 0xFD, 0xE7, 0xFE, 0x87, 0xFE, 0xE8, 0xFF, 0x11, 0xFF,
-    0x55, 0xFF, 0x6D, 0xFF, 0x93, 0xFF, 0xFD, 0x21, 0x6E, 0xE7, 0x58, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6A, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68, 0x61, 0x65, 0x69, 0xF2, 0x79, 0xF3,
-    0xD1, 0xF4, 0x53, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0xC4, 0xF4, 0x5A, 0xF7, 0x4E,
-    0xF4, 0x5A, 0xF9, 0xC2, 0xFB, 0x92, 0xFC, 0x33, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xF4, 0x5A, 0xFC,
-    0x53, 0xFC, 0xC1, 0xFD, 0xC4, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x16, 0xA0, 0x0D, 0x22, 0x21, 0x72, 0xFD, 0x21, 0x6F,
-    0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x69, 0x65, 0xF0, 0x3F, 0xFF, 0xF3, 0xFF, 0xFD, 0xC3, 0x00, 0x71, 0x2E, 0x7A, 0x73,
-    0xF0, 0x33, 0xF0, 0x39, 0xF0, 0x39, 0xC1, 0x00, 0x71, 0x2E, 0xF0, 0x27, 0xD6, 0x00, 0x81, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xF0,
-    0x21, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF3, 0xE6,
-    0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF3, 0xE6, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0, 0x24, 0xF0,
-    0x24, 0xF0, 0x24, 0xF0, 0x24, 0x41, 0x74, 0xF0, 0x69, 0x21, 0x70, 0xFC, 0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65,
-    0xEF, 0xD5, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0,
-    0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01,
-    0xF0, 0x01, 0xF0, 0x01, 0xF0, 0x01, 0xFF, 0xFD, 0x42, 0x6F, 0x70, 0xF3, 0xA8, 0xFF, 0xB1, 0x41, 0x6E, 0xFB, 0x50,
-    0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73,
-    0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x69, 0x6F, 0xEF, 0x82, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF,
-    0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE,
-    0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xEF, 0xAE, 0xFF, 0xF5, 0xFF, 0xFC, 0x41,
-    0x74, 0xF1, 0xF3, 0x21, 0x70, 0xFC, 0x41, 0x6F, 0xFC, 0x90, 0x21, 0x6C, 0xFC, 0x41, 0x74, 0xF0, 0x5B, 0x41, 0x6D,
-    0xFA, 0xEF, 0x41, 0x61, 0xEF, 0x9F, 0x21, 0x72, 0xFC, 0x21, 0x74, 0xFD, 0x25, 0x6D, 0x75, 0x72, 0x73, 0x6E, 0xE4,
-    0xEB, 0xEE, 0xF2, 0xFD, 0xA0, 0x02, 0x32, 0x21, 0x61, 0xFD, 0x41, 0x2E, 0xEF, 0x06, 0xA1, 0x02, 0x32, 0x73, 0xFC,
-    0x22, 0x6F, 0x61, 0xF1, 0xFB, 0x41, 0x64, 0xEF, 0x88, 0x23, 0x63, 0x67, 0x72, 0xEB, 0xF7, 0xFC, 0x21, 0x6F, 0xE1,
-    0x41, 0x75, 0xEF, 0x68, 0x21, 0x72, 0xFC, 0x42, 0x64, 0x73, 0xFF, 0xFD, 0xF2, 0xE9, 0x22, 0x6C, 0x61, 0xEF, 0xF9,
-    0x41, 0x6C, 0xEF, 0x64, 0x21, 0x61, 0xFC, 0xA0, 0x07, 0x51, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFD, 0xA1, 0x04, 0x72,
-    0x72, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFF, 0xFB, 0xEF, 0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0xEF, 0xD7, 0x47,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEF, 0xC1, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4, 0xEF, 0xC4,
-    0xFF, 0xF0, 0x21, 0x69, 0xEA, 0x21, 0x74, 0xFD, 0x22, 0x66, 0x6E, 0xC3, 0xFD, 0x42, 0x68, 0x6F, 0xF2, 0x5F, 0xEF,
-    0xB4, 0x21, 0x6E, 0xF9, 0xA0, 0x06, 0xF3, 0xA0, 0x07, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF3, 0x4F, 0xF3, 0x26, 0xFF, 0xEF, 0xFF, 0xEF,
-    0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xF5, 0x21, 0x72, 0xE7, 0x21, 0x65, 0xFD, 0x41, 0x6C, 0xFA, 0x21, 0x41,
-    0x6F, 0xF2, 0x6E, 0x24, 0x61, 0x62, 0x63, 0x74, 0xC5, 0xF5, 0xF8, 0xFC, 0x41, 0x6F, 0xEF, 0x25, 0x21, 0x63, 0xFC,
-    0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x68,
-    0x6C, 0x72, 0x6F, 0x61, 0x75, 0x65, 0x69, 0xC3, 0xEE, 0x30, 0xEE, 0x33, 0xEE, 0x39, 0xEE, 0x33, 0xEE, 0x42, 0xEE,
-    0x47, 0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x47, 0xFD, 0xF1, 0xEE, 0x4C, 0xEE, 0x33, 0xEE, 0x33, 0xFD, 0xFD, 0xEE, 0x33,
-    0xEE, 0x33, 0xEE, 0x33, 0xEE, 0x33, 0xFE, 0x09, 0xFE, 0x0F, 0xFE, 0x5B, 0xFE, 0xAE, 0xFF, 0x19, 0xFF, 0x3C, 0xFF,
-    0x54, 0xFF, 0x9A, 0xFF, 0xE1, 0xFF, 0xFD, 0x41, 0x74, 0xF2, 0xB2, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x69,
-    0xFD, 0xA1, 0x04, 0xA2, 0x6D, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xF1, 0x95, 0xF1, 0xD1, 0xF1,
-    0xD1, 0xFF, 0xFB, 0xF1, 0xD1, 0xF1, 0xD1, 0xF1, 0xD7, 0x21, 0x61, 0xEA, 0xA0, 0x07, 0xC1, 0xA0, 0x07, 0xD2, 0xA0,
-    0x07, 0xF2, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F, 0xF1, 0x21, 0x74, 0xFD, 0x42, 0x61, 0x6F, 0xFF,
-    0xFD, 0xEE, 0xA8, 0x21, 0x6D, 0xF9, 0xA0, 0x05, 0x92, 0x21, 0x65, 0xFD, 0x21, 0x64, 0xFD, 0xA0, 0x09, 0x32, 0x21,
-    0x61, 0xFD, 0x22, 0x72, 0x6C, 0xF7, 0xFD, 0xA0, 0x02, 0x12, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD,
-    0x41, 0x61, 0xEF, 0x4A, 0x22, 0x68, 0x6C, 0xF9, 0xFC, 0x22, 0x61, 0x65, 0xE0, 0xE0, 0x21, 0x68, 0xFB, 0x21, 0x74,
-    0xE3, 0x22, 0x63, 0x72, 0xFA, 0xFD, 0x23, 0xB3, 0xA1, 0xA9, 0xD6, 0xEB, 0xFB, 0x21, 0x6A, 0xC0, 0x21, 0x6C, 0xBD,
-    0x21, 0x74, 0xBA, 0x21, 0x6E, 0xFD, 0x22, 0x6C, 0x65, 0xF7, 0xFD, 0xA0, 0x02, 0x11, 0x21, 0x6A, 0xFD, 0x21, 0x69,
-    0xFD, 0x41, 0x69, 0xFF, 0xA6, 0x21, 0x6E, 0xFC, 0x21, 0x61, 0xFD, 0x41, 0x6D, 0xFF, 0x9C, 0x21, 0x61, 0xFC, 0x46,
-    0x64, 0x65, 0x69, 0x74, 0x67, 0x6E, 0xFF, 0x98, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42,
-    0x63, 0x7A, 0xFF, 0x82, 0xFF, 0x82, 0x41, 0x6E, 0xFF, 0x7B, 0x21, 0x65, 0xFC, 0x22, 0x65, 0x69, 0xF2, 0xFD, 0x21,
-    0x64, 0xFB, 0x41, 0x67, 0xFF, 0x6C, 0x21, 0x69, 0xFC, 0x41, 0x72, 0xFF, 0x65, 0x21, 0x74, 0xFC, 0x23, 0x65, 0x6C,
-    0x73, 0xEF, 0xF6, 0xFD, 0xA0, 0x09, 0x12, 0x21, 0x73, 0xFD, 0x41, 0x70, 0xFF, 0x51, 0x21, 0xBA, 0xFC, 0x23, 0x61,
-    0x75, 0xC3, 0xF6, 0xF9, 0xFD, 0x21, 0x6F, 0xDE, 0xC2, 0x09, 0x12, 0x63, 0x64, 0xFF, 0x91, 0xFF, 0x91, 0x23, 0xA1,
-    0xA9, 0xB3, 0xE0, 0xE0, 0xE0, 0x45, 0x61, 0xC3, 0x65, 0x6F, 0x6C, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0xD9, 0xFF, 0xD9,
-    0xFF, 0x81, 0x41, 0x69, 0xFF, 0x84, 0x21, 0x72, 0xFC, 0x41, 0x65, 0xFF, 0x6A, 0x21, 0x63, 0xFC, 0x42, 0xA1, 0xA9,
-    0xFF, 0x12, 0xFF, 0x12, 0x43, 0x61, 0xC3, 0x69, 0xFF, 0x0B, 0xFF, 0xF9, 0xFF, 0x0B, 0x41, 0xA9, 0xFF, 0x01, 0x42,
-    0x65, 0xC3, 0xFE, 0xFD, 0xFF, 0xFC, 0x41, 0x67, 0xFF, 0x0A, 0x21, 0x65, 0xFC, 0x4B, 0x72, 0x62, 0x63, 0x64, 0x6C,
-    0x70, 0x6E, 0x76, 0x78, 0x79, 0x73, 0xFF, 0x5A, 0xFF, 0x91, 0xFF, 0xA5, 0xFF, 0xAC, 0xFF, 0xBF, 0xFF, 0xD3, 0xFF,
-    0xDA, 0xFF, 0xE4, 0xFF, 0x49, 0xFF, 0xF2, 0xFF, 0xFD, 0xA0, 0x08, 0xC3, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD, 0x21,
-    0x72, 0xF7, 0x22, 0x72, 0x6F, 0xFA, 0xFD, 0x22, 0x7A, 0x63, 0xEF, 0xEF, 0x21, 0x69, 0xFB, 0x21, 0x6C, 0xFD, 0x21,
-    0x61, 0xFD, 0x21, 0x72, 0xFD, 0x23, 0xA1, 0xA9, 0xB3, 0xDE, 0xDE, 0xDE, 0x22, 0x61, 0xC3, 0xD7, 0xF9, 0x23, 0x61,
-    0x65, 0x6F, 0xD2, 0xD2, 0xD2, 0x21, 0xAD, 0xF9, 0x22, 0x69, 0xC3, 0xF1, 0xFD, 0xA0, 0x08, 0xF2, 0x21, 0x73, 0xC0,
-    0x22, 0x61, 0x69, 0xFA, 0xFD, 0x21, 0x75, 0xFB, 0x21, 0xAD, 0xC6, 0x22, 0x69, 0xC3, 0xC3, 0xFD, 0x42, 0x76, 0x6E,
-    0xFF, 0xAD, 0xFF, 0xFB, 0x42, 0x61, 0x69, 0xED, 0xDD, 0xFF, 0xF9, 0x41, 0x6C, 0xFE, 0x80, 0x42, 0x72, 0x65, 0xFE,
-    0x7C, 0xFF, 0xFC, 0x21, 0x67, 0xF9, 0x41, 0x76, 0xFF, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x41, 0x6C, 0xFF, 0x7E, 0x21, 0x6C, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x72, 0xFD,
-    0x41, 0x72, 0xFE, 0x52, 0x43, 0x61, 0x65, 0x74, 0xF1, 0xB9, 0xF1, 0xB9, 0xFF, 0xFC, 0x41, 0x73, 0xFF, 0xA0, 0x21,
-    0x65, 0xFC, 0x41, 0x6E, 0xFF, 0x5C, 0x21, 0x75, 0xFC, 0x21, 0xB3, 0xF9, 0x22, 0xC3, 0x6F, 0xFD, 0xF6, 0x4D, 0x62,
-    0x63, 0x66, 0x67, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x79, 0x7A, 0xFF, 0x59, 0xFF, 0x6C, 0xFF, 0x85, 0xFF,
-    0x95, 0xFE, 0x37, 0xFF, 0xA7, 0xFF, 0xB9, 0xFF, 0xCC, 0xFF, 0xD9, 0xFF, 0xE0, 0xFF, 0xEE, 0xFF, 0xF5, 0xFF, 0xFB,
-    0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFF, 0x25, 0xFF, 0x47, 0xFF, 0x25, 0xFF, 0x25, 0x21, 0x6A, 0xF3, 0x41, 0x6A, 0xFF,
-    0x43, 0x21, 0xA9, 0xFC, 0x41, 0xB1, 0xFD, 0xEF, 0x21, 0xC3, 0xFC, 0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3, 0xFA, 0xFD,
-    0x23, 0x65, 0xC3, 0x70, 0xE7, 0xEE, 0xFB, 0x41, 0x6E, 0xFD, 0xD9, 0x21, 0xA9, 0xFC, 0x22, 0x65, 0xC3, 0xF9, 0xFD,
-    0x21, 0x72, 0xFB, 0x21, 0x66, 0xFD, 0xC6, 0x02, 0x11, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFE, 0x04, 0xFE, 0x04,
-    0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0xFE, 0x04, 0x46, 0x6E, 0x72, 0x62, 0x64, 0x6D, 0x73, 0xFD, 0xEF, 0xFD, 0xEF,
-    0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0xFD, 0xEF, 0x21, 0xA1, 0xED, 0xC6, 0x09, 0x12, 0x6E, 0x72, 0x62, 0x64, 0x6D,
-    0x73, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0xFE, 0x31, 0x42, 0xA1, 0xB3, 0xFF, 0xEB, 0xFE,
-    0x1C, 0x44, 0x61, 0xC3, 0x65, 0x6F, 0xFE, 0x15, 0xFE, 0x35, 0xFE, 0x15, 0xFE, 0x15, 0x44, 0x6F, 0x61, 0xC3, 0x68,
-    0xFE, 0x08, 0xFF, 0xD7, 0xFF, 0xEC, 0xFF, 0xF3, 0x41, 0xA9, 0xFE, 0x85, 0x42, 0x65, 0xC3, 0xFE, 0x81, 0xFF, 0xFC,
-    0xA1, 0x05, 0x92, 0x75, 0xF9, 0x41, 0x66, 0xFD, 0x42, 0x42, 0x63, 0x71, 0xFD, 0x3E, 0xFD, 0x3E, 0x22, 0x69, 0x75,
-    0xF5, 0xF9, 0x41, 0x62, 0xFD, 0xCD, 0x21, 0x6D, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x7A, 0xFD, 0x28, 0x42, 0x63, 0x6E,
-    0xFD, 0x75, 0xFF, 0xFC, 0x21, 0x61, 0xF9, 0x21, 0x72, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x75, 0xFD, 0x17, 0xFF, 0xFD,
-    0xFD, 0x9C, 0xFD, 0x7B, 0x41, 0x69, 0xFD, 0x4D, 0x41, 0x69, 0xFD, 0x8B, 0x43, 0x62, 0x63, 0x6C, 0xFF, 0xF8, 0xFD,
-    0x5C, 0xFF, 0xFC, 0x41, 0x73, 0xFC, 0xF8, 0x41, 0x63, 0xFC, 0xF4, 0x22, 0x65, 0x75, 0xF8, 0xFC, 0x43, 0x61, 0x69,
-    0x72, 0xFF, 0xE9, 0xFD, 0x4F, 0xFF, 0xFB, 0x23, 0x63, 0x70, 0x74, 0xB6, 0xCA, 0xF6, 0x42, 0x63, 0x74, 0xFC, 0xF1,
-    0xFC, 0xEE, 0x4A, 0x6D, 0x6E, 0x6F, 0x61, 0xC3, 0x63, 0x71, 0x64, 0x73, 0x72, 0xFF, 0x07, 0xFF, 0x1D, 0xFD, 0x24,
-    0xFF, 0x20, 0xFF, 0x48, 0xFF, 0x74, 0xFF, 0x8C, 0xFF, 0x9C, 0xFF, 0xF2, 0xFF, 0xF9, 0x42, 0x72, 0x6F, 0xFD, 0x05,
-    0xFC, 0xF7, 0x42, 0x61, 0x6F, 0xFC, 0xFE, 0xFC, 0xFE, 0x22, 0x65, 0x69, 0xF2, 0xF9, 0x41, 0x74, 0xFC, 0xF2, 0x21,
-    0x72, 0xFC, 0x41, 0xA1, 0xFC, 0xDD, 0x42, 0x61, 0xC3, 0xFC, 0xD9, 0xFF, 0xFC, 0x42, 0x6E, 0x75, 0xFC, 0xE0, 0xFF,
-    0xF9, 0x41, 0xB3, 0xFD, 0x0D, 0x42, 0x6F, 0xC3, 0xFD, 0x09, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21,
-    0x75, 0xFD, 0x42, 0x67, 0x6E, 0xFF, 0x6E, 0xFC, 0x74, 0x41, 0x65, 0xFF, 0x75, 0x42, 0x6F, 0x72, 0xFC, 0xEE, 0xFF,
-    0xFC, 0x22, 0x61, 0x70, 0xEE, 0xF9, 0x41, 0x72, 0xFD, 0x0C, 0x41, 0x73, 0xFC, 0x9F, 0x21, 0x75, 0xFC, 0x44, 0x65,
-    0x6C, 0x6F, 0x72, 0xFC, 0x9B, 0xFF, 0x4C, 0xFF, 0xF5, 0xFF, 0xFD, 0x42, 0x63, 0x74, 0xFC, 0xEE, 0xFC, 0xEE, 0x21,
-    0x6E, 0xF9, 0x41, 0x63, 0xFC, 0x8C, 0x41, 0x72, 0xFC, 0x7D, 0xC1, 0x05, 0x92, 0x61, 0xFC, 0x97, 0x41, 0x72, 0xFC,
-    0x91, 0x24, 0x65, 0x61, 0x6C, 0x6F, 0xEE, 0xF2, 0xF6, 0xFC, 0x41, 0x62, 0xFC, 0x20, 0x21, 0x69, 0xFC, 0x41, 0x63,
-    0xFC, 0x5F, 0x41, 0x61, 0xFC, 0x58, 0x22, 0x65, 0x74, 0xF8, 0xFC, 0x42, 0x67, 0x72, 0xFD, 0xCE, 0xFC, 0x20, 0x41,
-    0x78, 0xFC, 0x05, 0x23, 0x65, 0x6F, 0x75, 0xF5, 0xFC, 0xE1, 0x41, 0x65, 0xFC, 0x95, 0x47, 0x63, 0x65, 0x66, 0x68,
-    0x73, 0x74, 0x76, 0xFF, 0xA4, 0xFF, 0xB8, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0xE5, 0xFF, 0xF5, 0xFF, 0xFC, 0x41, 0x6E,
-    0xFC, 0x31, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x47, 0x64, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x73, 0xFF, 0x30, 0xFF,
-    0x39, 0xFF, 0x47, 0xFF, 0x5F, 0xFF, 0x74, 0xFF, 0xE0, 0xFF, 0xFD, 0x43, 0x72, 0x73, 0x6E, 0xFC, 0x69, 0xFC, 0x69,
-    0xFC, 0x69, 0x21, 0x61, 0xF6, 0x41, 0x6C, 0xFC, 0x04, 0x21, 0x6C, 0xFC, 0x41, 0x61, 0xFD, 0xE7, 0x21, 0x74, 0xFC,
-    0xA0, 0x09, 0x53, 0x22, 0x63, 0x71, 0xFD, 0xFD, 0x22, 0x73, 0x69, 0xF5, 0xFB, 0xC1, 0x05, 0x92, 0x61, 0xFB, 0x98,
-    0x43, 0x6E, 0x72, 0x73, 0xFB, 0x92, 0xFF, 0xFA, 0xFB, 0x92, 0x43, 0x6E, 0x72, 0x73, 0xFB, 0x88, 0xFB, 0x88, 0xFB,
-    0x88, 0x42, 0xA9, 0xB3, 0xFF, 0xF6, 0xFB, 0x7E, 0x45, 0x72, 0x64, 0x65, 0xC3, 0x6D, 0xFB, 0x77, 0xFB, 0x77, 0xFF,
-    0xE5, 0xFF, 0xF9, 0xFB, 0x77, 0x42, 0x6E, 0x73, 0xFB, 0x67, 0xFB, 0x67, 0x42, 0xA1, 0xAD, 0xFB, 0x60, 0xFF, 0xC8,
-    0x45, 0x69, 0x61, 0x65, 0x6F, 0xC3, 0xFF, 0xE2, 0xFF, 0xF2, 0xFB, 0x59, 0xFB, 0x59, 0xFF, 0xF9, 0x41, 0xA1, 0xFB,
-    0x49, 0x42, 0x61, 0xC3, 0xFB, 0x45, 0xFF, 0xFC, 0x21, 0xB1, 0xF9, 0x41, 0x62, 0xFB, 0x9C, 0x47, 0x64, 0x65, 0x62,
-    0x73, 0x6E, 0xC3, 0x72, 0xFF, 0x81, 0xFF, 0x88, 0xFF, 0x9A, 0xFF, 0x8F, 0xFF, 0xDE, 0xFF, 0xF9, 0xFF, 0xFC, 0x46,
-    0xC3, 0x6F, 0x61, 0x65, 0x69, 0x75, 0xFB, 0x5A, 0xFC, 0x32, 0xFD, 0x07, 0xFE, 0x4E, 0xFF, 0x4B, 0xFF, 0xEA, 0x41,
-    0x69, 0xFB, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD, 0x45, 0x63, 0x6E, 0x72, 0x73, 0x69, 0xFA, 0xCE, 0xF4, 0xA7,
-    0xFB, 0x01, 0xFF, 0xE3, 0xFF, 0xFD, 0xA0, 0x11, 0x72, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3, 0xFA,
-    0xFD, 0x21, 0x6C, 0xFB, 0x21, 0x65, 0xFD, 0xD8, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x69, 0xE8, 0x5B, 0xE8, 0x5E,
-    0xE8, 0x64, 0xE8, 0x5E, 0xE8, 0x6D, 0xE8, 0x72, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x72, 0xE8,
-    0x5E, 0xE8, 0x77, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x80, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E, 0xE8, 0x5E,
-    0xE8, 0x8A, 0xFF, 0xDC, 0xFF, 0xFD, 0x42, 0x6D, 0x72, 0xF4, 0x38, 0xF3, 0xDE, 0x41, 0x69, 0xF3, 0xD3, 0x43, 0x6C,
-    0x73, 0x74, 0xF9, 0xB2, 0xFF, 0xFC, 0xF9, 0xB2, 0x42, 0x6E, 0x74, 0xF9, 0xA8, 0xF9, 0xA8, 0x41, 0x69, 0xEB, 0x9B,
-    0x21, 0x72, 0xFC, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0xDA,
-    0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x6C, 0x72, 0x65, 0x69, 0x6F, 0x61, 0xE7, 0xDE, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1,
-    0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xF7,
-    0xB7, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE7, 0xE1, 0xE8, 0x0D, 0xE8, 0x0D, 0xFF, 0xCE, 0xFF, 0xD9,
-    0xFF, 0xE3, 0xFF, 0xFD, 0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x75, 0xE7, 0x8D, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9,
-    0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7,
-    0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xE7, 0xB9, 0xF7, 0x41,
-    0xA0, 0x08, 0xB1, 0x21, 0x2E, 0xFD, 0x49, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0x2E, 0x73, 0xE8, 0x4E, 0xE8,
-    0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x51, 0xE8, 0x57, 0xFF, 0xFA, 0xFF, 0xFD, 0x22, 0x2E, 0x73, 0xDE,
-    0xE1, 0x21, 0x61, 0xFB, 0x21, 0xAD, 0xFD, 0x23, 0x6F, 0x61, 0xC3, 0xD9, 0xF5, 0xFD, 0x21, 0x66, 0xF9, 0xD7, 0x00,
-    0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76,
-    0x77, 0x78, 0x79, 0x7A, 0x61, 0xE7, 0x0E, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A,
-    0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7,
-    0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xE7, 0x3A, 0xFF, 0xFD, 0x41, 0x73, 0xFF, 0x84, 0x42, 0x2E,
-    0x65, 0xFF, 0x7D, 0xFF, 0xFC, 0x21, 0x6C, 0xF9, 0x42, 0x6F, 0x61, 0xFF, 0x95, 0xFF, 0xFD, 0x21, 0x6E, 0xF9, 0x41,
-    0x72, 0xF9, 0x23, 0x42, 0x65, 0x72, 0xFF, 0xFC, 0xE7, 0x37, 0x21, 0x74, 0xF9, 0x42, 0x6C, 0x73, 0xF8, 0x4D, 0xFF,
-    0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE7, 0x64, 0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x67, 0xE7, 0x67,
-    0xE7, 0x67, 0xE7, 0x6D, 0x41, 0x6E, 0xF8, 0xFB, 0x21, 0x6F, 0xFC, 0x22, 0x6F, 0x72, 0xE3, 0xFD, 0x41, 0x63, 0xE7,
-    0x04, 0x21, 0x65, 0xFC, 0x41, 0x61, 0xEA, 0x8B, 0x22, 0x6E, 0x67, 0xF9, 0xFC, 0x41, 0x64, 0xF7, 0x46, 0x21, 0x72,
-    0xFC, 0x21, 0x61, 0xFD, 0xDB, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70,
-    0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x6F, 0x61, 0x65, 0x69, 0x75, 0xE6, 0x5D, 0xE6, 0x60,
-    0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xF6, 0x36, 0xE6,
-    0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xE6, 0x60, 0xFE, 0xD0,
-    0xFF, 0x4F, 0xFF, 0xAC, 0xFF, 0xBD, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x2E, 0xE6, 0x0C, 0x42, 0x2E, 0x73,
-    0xE6, 0x08, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x21, 0x6C, 0xFB, 0x42, 0x6F, 0x61, 0xE6, 0xD5, 0xE6, 0xD5,
-    0x21, 0x6E, 0xF9, 0x21, 0x61, 0xFD, 0x22, 0x65, 0x6D, 0xF0, 0xFD, 0x41, 0x65, 0xFE, 0x9F, 0x21, 0x74, 0xFC, 0x21,
-    0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFA, 0x22, 0x6C, 0x69, 0xFA, 0xFD, 0x42, 0x6C, 0x62, 0xF7, 0x7C, 0xFF,
-    0xFB, 0x42, 0x63, 0x6F, 0xE6, 0x55, 0xE6, 0xEB, 0x21, 0x69, 0xF9, 0x41, 0x2E, 0xE8, 0xAA, 0x42, 0x2E, 0x73, 0xE8,
-    0xA6, 0xFF, 0xFC, 0x21, 0x61, 0xF9, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xE9, 0x79, 0xE9, 0xB5, 0xE9, 0xB5, 0xE9, 0xB5, 0xFF, 0xFB, 0xE9, 0xB5, 0xE9, 0xBB, 0x43, 0x61, 0x69, 0x6F, 0xF5,
-    0xB9, 0xFF, 0xEA, 0xE9, 0xB0, 0x42, 0x61, 0x74, 0xF5, 0xAF, 0xE6, 0xBD, 0x41, 0x72, 0xE6, 0x11, 0x21, 0x65, 0xFC,
-    0x46, 0x63, 0x6C, 0x6D, 0x70, 0x74, 0x78, 0xF1, 0xA5, 0xFF, 0xBC, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0x0D,
-    0xA0, 0x0A, 0x13, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0xA1, 0x06, 0xF3, 0x63,
-    0xFD, 0x21, 0x69, 0xEC, 0x21, 0x6D, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xFA, 0xFD, 0x21, 0x61, 0xDE, 0x21,
-    0x69, 0xFD, 0xA2, 0x06, 0xF3, 0x6E, 0x78, 0xF5, 0xFD, 0xA0, 0x0A, 0x43, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x21,
-    0x69, 0xFD, 0xA1, 0x07, 0x23, 0x6E, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xF6, 0xA6, 0xF6, 0xA6, 0xF6, 0xA6,
-    0xFF, 0xFB, 0xF6, 0xA6, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE9, 0xF3, 0xE9, 0xCA, 0xF6, 0x93,
-    0xF6, 0x93, 0xFF, 0xBF, 0xFF, 0xD8, 0xF6, 0x93, 0xFF, 0xF0, 0x21, 0x72, 0xE7, 0x42, 0x65, 0x6F, 0xFF, 0xFD, 0xE9,
-    0x19, 0x43, 0x64, 0x70, 0x73, 0xF0, 0xC5, 0xFF, 0xF9, 0xF1, 0x1F, 0x42, 0x6F, 0x65, 0xE9, 0x08, 0xF0, 0xB7, 0x42,
-    0x6C, 0x6D, 0xF6, 0x93, 0xFF, 0xF9, 0x5B, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x75, 0x61, 0x65, 0x69, 0x6F, 0xE4, 0xDF, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4,
-    0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2, 0xE4, 0xE2,
-    0xE4, 0xE2, 0xFE, 0xF6, 0xFF, 0x10, 0xFF, 0x62, 0xFF, 0xE8, 0xFF, 0xF9, 0xD6, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xE4,
-    0x8D, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90,
-    0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4, 0x90, 0xE4,
-    0x90, 0xE4, 0x90, 0xE4, 0x90, 0x41, 0x6C, 0xF5, 0xF5, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
-    0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x69, 0xE4, 0x44, 0xE4,
-    0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47,
-    0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4, 0x47, 0xE4,
-    0x73, 0xE4, 0x73, 0xFF, 0xFC, 0xD6, 0x00, 0x81, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xE3, 0xFC, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF,
-    0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3,
-    0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0xE3, 0xFF, 0x41, 0x75,
-    0xF3, 0x6B, 0x41, 0x66, 0xEF, 0x7D, 0xA0, 0x0D, 0x02, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21,
-    0xA1, 0xFD, 0x44, 0x6E, 0x70, 0x74, 0xC3, 0xFF, 0xED, 0xF5, 0x4D, 0xF5, 0x4D, 0xFF, 0xFD, 0x41, 0x61, 0xFC, 0x4E,
-    0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
-    0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x65, 0x69, 0x6F, 0xE3,
-    0x86, 0xE3, 0x89, 0xE3, 0x8F, 0xE3, 0x89, 0xE3, 0x98, 0xE3, 0x9D, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x9D,
-    0xE3, 0x89, 0xE3, 0xA2, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0xAB, 0xE3, 0x89, 0xE3, 0x89, 0xE3, 0x89, 0xE3,
-    0x89, 0xE3, 0x89, 0xFF, 0x8A, 0xFF, 0xCF, 0xFF, 0xE6, 0xFF, 0xFD, 0x42, 0x2E, 0x73, 0xE3, 0x38, 0xF4, 0x32, 0x21,
-    0x65, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x62, 0xFD, 0x41, 0x2E, 0xE4, 0x07, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x48,
-    0x6C, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE3, 0xAB, 0xE6, 0xEC, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x28, 0xE7,
-    0x28, 0xE7, 0x28, 0xE7, 0x2E, 0x21, 0x61, 0xE7, 0x41, 0x6E, 0xE3, 0x8F, 0x21, 0x61, 0xFC, 0x47, 0x6F, 0x61, 0x6E,
-    0x67, 0x6C, 0x73, 0x74, 0xF3, 0xF5, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xF6, 0xFF, 0xFD, 0xF4, 0xA8, 0xFC, 0x8B, 0xA0,
-    0x05, 0x51, 0x21, 0x61, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0xA0, 0x02, 0xB2, 0xCC, 0x01, 0xA1, 0x68, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x6D, 0x70, 0x71, 0x73, 0x74, 0x76, 0xFF, 0xFD, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4,
-    0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0xE4, 0xE9, 0x41, 0x69, 0xE6, 0xCA,
-    0x44, 0x6E, 0x63, 0x6C, 0x78, 0xFF, 0xCF, 0xEE, 0x79, 0xFF, 0xD5, 0xFF, 0xFC, 0x41, 0x72, 0xE8, 0xA2, 0x21, 0x61,
-    0xFC, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0xA1, 0x04, 0xA2, 0x74, 0xFD, 0x47,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE6, 0x54, 0xFF, 0xFB, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x90, 0xE6, 0x90,
-    0xE6, 0x96, 0x21, 0x69, 0xEA, 0x41, 0x69, 0xE3, 0x9F, 0x44, 0x63, 0x6C, 0x6E, 0x72, 0xEE, 0x37, 0xFF, 0xD2, 0xFF,
-    0xF9, 0xFF, 0xFC, 0x41, 0x74, 0xE6, 0x62, 0x21, 0x6C, 0xFC, 0x43, 0x6E, 0x72, 0x74, 0xF4, 0x02, 0xFE, 0xA2, 0xF4,
-    0x02, 0xDB, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x65, 0x61, 0x69, 0x75, 0x6F, 0xE2, 0x4B, 0xE2, 0x4E, 0xE2, 0x54, 0xE2,
-    0x4E, 0xE2, 0x5D, 0xE2, 0x62, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x62, 0xF2, 0x24, 0xE2, 0x67,
-    0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x70, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xE2, 0x4E, 0xFF,
-    0x50, 0xFF, 0xA0, 0xFF, 0xE2, 0xFF, 0xF3, 0xFF, 0xF6, 0xA0, 0x0B, 0x95, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21,
-    0x72, 0xFD, 0xC3, 0x00, 0x71, 0x7A, 0x73, 0x65, 0xE1, 0xF1, 0xE1, 0xF1, 0xFF, 0xFD, 0x41, 0x74, 0xED, 0xA2, 0x42,
-    0x2E, 0x72, 0xE1, 0xDE, 0xFF, 0xFC, 0x43, 0x6D, 0x6E, 0x72, 0xF3, 0x81, 0xF3, 0x81, 0xF1, 0x88, 0x45, 0x63, 0x66,
-    0x6F, 0x74, 0x75, 0xED, 0x98, 0xED, 0x98, 0xFB, 0x31, 0xF3, 0x77, 0xF2, 0xA5, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x6F, 0x61, 0x65, 0xE1, 0xBA, 0xE1, 0xBD, 0xE1, 0xC3, 0xE1, 0xBD, 0xE1, 0xCC, 0xE1, 0xD1, 0xE1, 0xBD, 0xE1, 0xBD,
-    0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xD1, 0xE1, 0xBD, 0xE1, 0xD6, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xCF, 0xE1,
-    0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xE1, 0xBD, 0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xF0, 0xC1, 0x0D, 0x22, 0x6F,
-    0xE2, 0x8F, 0x42, 0x63, 0x71, 0xFF, 0xFA, 0xF1, 0x1E, 0xC2, 0x00, 0x71, 0x2E, 0x69, 0xE1, 0x5F, 0xFF, 0xF9, 0xC2,
-    0x00, 0x71, 0x2E, 0x65, 0xE1, 0x56, 0xED, 0x24, 0x41, 0x74, 0xFE, 0xB9, 0x21, 0x63, 0xFC, 0x21, 0x6E, 0xFD, 0x41,
-    0x72, 0xE5, 0x49, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x75, 0xE1, 0x3F, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B,
-    0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1,
-    0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xE1, 0x6B, 0xFF, 0xF9,
-    0xFF, 0xFC, 0x41, 0x70, 0xE2, 0xB2, 0x42, 0x6D, 0x74, 0xFF, 0xFC, 0xEC, 0xBA, 0xD7, 0x00, 0x91, 0x2E, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x6F, 0xE0, 0xE9, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15,
-    0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1,
-    0x15, 0xE1, 0x15, 0xE1, 0x15, 0xE1, 0x15, 0xFF, 0xF9, 0x42, 0x61, 0x6F, 0xF1, 0x95, 0xF1, 0x95, 0x21, 0x74, 0xF9,
-    0x41, 0x61, 0xF4, 0x4F, 0x21, 0x69, 0xFC, 0x21, 0x6D, 0xFD, 0xA0, 0x10, 0x92, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA0, 0x10, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x23,
-    0x65, 0x61, 0x70, 0xE2, 0xEE, 0xFD, 0x44, 0x64, 0x72, 0x6E, 0x74, 0xF1, 0x7E, 0xFF, 0xF9, 0xF1, 0x42, 0xF9, 0xFB,
-    0x41, 0x6E, 0xEB, 0x6F, 0x21, 0x6F, 0xFC, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x65, 0xEC, 0x1B, 0xA0, 0x06,
-    0x31, 0x41, 0xB1, 0xE1, 0xF2, 0x21, 0xC3, 0xFC, 0x22, 0x2E, 0x65, 0xF6, 0xFD, 0xA1, 0x04, 0xA2, 0x73, 0xFB, 0x41,
-    0x61, 0xE6, 0x3D, 0x21, 0x74, 0xFC, 0x21, 0x61, 0xFD, 0xA1, 0x04, 0xA2, 0x6C, 0xFD, 0x41, 0x6F, 0xE6, 0x2E, 0xA1,
-    0x04, 0xC2, 0x73, 0xFC, 0x45, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xE4, 0x2E, 0xE4, 0x2E, 0xFF, 0xFB, 0xE4, 0x2E, 0xE4,
-    0x2E, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE3, 0xDF, 0xE4, 0x1B, 0xE4, 0x1B, 0xFF, 0xD3, 0xE4, 0x1B,
-    0xFF, 0xE2, 0xFF, 0xF0, 0x21, 0x61, 0xEA, 0x23, 0x6E, 0x6C, 0x72, 0xA4, 0xA7, 0xFD, 0x41, 0x7A, 0xEB, 0xBB, 0x43,
-    0x63, 0x65, 0x72, 0xF1, 0x9A, 0xFF, 0xFC, 0xF1, 0x9A, 0x42, 0x71, 0x63, 0xE5, 0xE7, 0xFF, 0xAA, 0x41, 0x65, 0xFF,
-    0xA3, 0x42, 0x64, 0x74, 0xFD, 0x3A, 0xFF, 0xFC, 0xA2, 0x04, 0xA2, 0x72, 0x6E, 0xEE, 0xF9, 0x41, 0x65, 0xFD, 0x36,
-    0x21, 0x69, 0xFC, 0xA1, 0x04, 0xA2, 0x6D, 0xFD, 0xC1, 0x04, 0xA2, 0x72, 0xE1, 0x66, 0x41, 0x71, 0xE5, 0xBC, 0xA1,
-    0x04, 0xC2, 0x72, 0xFC, 0x41, 0x65, 0xE5, 0xB3, 0x21, 0x74, 0xFC, 0xA1, 0x04, 0xC2, 0x73, 0xFD, 0x45, 0xA1, 0xA9,
-    0xAD, 0xB3, 0xBA, 0xFF, 0xEF, 0xFF, 0xFB, 0xE3, 0xB0, 0xE3, 0xB0, 0xE3, 0xB0, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F,
-    0x75, 0xC3, 0xE3, 0x61, 0xFF, 0xC2, 0xE3, 0x9D, 0xE3, 0x9D, 0xFF, 0xD0, 0xFF, 0xD5, 0xFF, 0xF0, 0x21, 0x69, 0xEA,
-    0x41, 0x6F, 0xEA, 0x8B, 0xA1, 0x04, 0x52, 0x72, 0xFC, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xE0, 0x80,
-    0xE0, 0x83, 0xFF, 0xFB, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x83, 0xE0, 0x89, 0x21, 0x61, 0xEA, 0x21, 0x74, 0xFD, 0x41,
-    0x72, 0xFC, 0x7C, 0x21, 0x70, 0xFC, 0x41, 0x64, 0xFC, 0x75, 0x22, 0x6D, 0x6E, 0xF9, 0xFC, 0xA0, 0x0E, 0x13, 0x21,
-    0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x70, 0xFD, 0xA0, 0x0E, 0x43, 0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x65,
-    0xFD, 0x21, 0x74, 0xD8, 0x22, 0x6C, 0x73, 0xFA, 0xFD, 0x41, 0x2E, 0xE1, 0x38, 0x42, 0x2E, 0x73, 0xE1, 0x34, 0xFF,
-    0xFC, 0x42, 0x61, 0x73, 0xFF, 0xF9, 0xE1, 0xD0, 0x24, 0x69, 0x6F, 0x65, 0x74, 0xC9, 0xD7, 0xE9, 0xF9, 0x43, 0x6C,
-    0x72, 0x73, 0xFF, 0x8D, 0xFF, 0xB2, 0xFF, 0xF7, 0xDB, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A,
-    0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72, 0x75, 0x65, 0x61, 0x69, 0x6F,
-    0xDF, 0x00, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF,
-    0x03, 0xEE, 0xD9, 0xDF, 0x03, 0xDF, 0x03, 0xFD, 0xA1, 0xFD, 0xAA, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03, 0xDF, 0x03,
-    0xDF, 0x03, 0xFD, 0xC1, 0xFE, 0x17, 0xFE, 0x66, 0xFE, 0x95, 0xFF, 0x08, 0xFF, 0x13, 0xFF, 0xF6, 0x42, 0x6D, 0x72,
-    0xDF, 0x3C, 0xEA, 0x76, 0x42, 0x65, 0x69, 0xFC, 0xC6, 0xFF, 0xF9, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x75, 0xDE,
-    0x9E, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1,
-    0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xDE,
-    0xA1, 0xDE, 0xA1, 0xDE, 0xA1, 0xFF, 0xF9, 0xC2, 0x00, 0x71, 0x6E, 0x61, 0xDE, 0x5C, 0xEE, 0xD0, 0x41, 0xA1, 0xF0,
-    0xDB, 0x43, 0x61, 0xC3, 0x65, 0xF0, 0xD7, 0xFF, 0xFC, 0xF0, 0xD7, 0x21, 0x69, 0xF6, 0x21, 0x63, 0xFD, 0xA0, 0x0A,
-    0x72, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0xAD, 0xFD, 0x22, 0x69, 0xC3, 0xEE, 0xFD, 0x21,
-    0x6E, 0xFB, 0x42, 0x65, 0x72, 0xE2, 0x3D, 0xE9, 0xEC, 0x22, 0x69, 0x74, 0xF6, 0xF9, 0xA0, 0x0B, 0xB1, 0x23, 0xA1,
-    0xA9, 0xAD, 0xFD, 0xFD, 0xFD, 0x24, 0x61, 0xC3, 0x65, 0x6F, 0xF6, 0xF9, 0xF6, 0xF6, 0x43, 0x64, 0x6E, 0x72, 0xF5,
-    0xFA, 0xED, 0xB7, 0xFF, 0xF7, 0x41, 0x6D, 0xEF, 0xA6, 0xD9, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x72, 0x65, 0x61, 0x6F, 0xDD,
-    0xF5, 0xDD, 0xF8, 0xDD, 0xFE, 0xDD, 0xF8, 0xDE, 0x07, 0xDE, 0x0C, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8,
-    0xFF, 0x9F, 0xDD, 0xF8, 0xDE, 0x11, 0xDD, 0xF8, 0xDD, 0xF8, 0xDE, 0x1A, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD, 0xF8, 0xDD,
-    0xF8, 0xDD, 0xF8, 0xDE, 0x24, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xFC, 0xC4, 0x00, 0x71, 0x74, 0x73, 0x6E, 0x61, 0xDD,
-    0xAD, 0xDD, 0xAD, 0xDD, 0xAD, 0xEE, 0x21, 0xA0, 0x00, 0xD1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0,
-    0x03, 0x02, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x22, 0x2E, 0x65, 0xEC, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x2E, 0x73,
-    0xEF, 0xF2, 0x21, 0x6E, 0xED, 0x21, 0xB3, 0xFD, 0x21, 0x65, 0xEA, 0x21, 0x6E, 0xFD, 0x23, 0x61, 0xC3, 0x6F, 0xEF,
-    0xF7, 0xFD, 0x21, 0x6C, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xC9, 0x23, 0x2E, 0x61, 0x65, 0xC3, 0xC9, 0xFD, 0x21,
-    0x72, 0xF9, 0xC6, 0x00, 0x71, 0x7A, 0x73, 0x65, 0x61, 0x69, 0x6F, 0xDD, 0x57, 0xDD, 0x57, 0xFF, 0xBF, 0xFF, 0xD2,
-    0xFF, 0xF0, 0xFF, 0xFD, 0x41, 0x74, 0xDF, 0xF2, 0x21, 0x63, 0xFC, 0x41, 0x76, 0xDE, 0x67, 0x44, 0x6E, 0x2E, 0x73,
-    0x6C, 0xFF, 0xF9, 0xF5, 0xEC, 0xF5, 0xEF, 0xFF, 0xFC, 0x41, 0x65, 0xFA, 0x22, 0x41, 0x76, 0xE8, 0xEA, 0xA0, 0x0E,
-    0xD2, 0xA0, 0x0E, 0xF3, 0xA0, 0x0F, 0x23, 0x25, 0xA1, 0xA9, 0xAD, 0xB3, 0xBA, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x27,
-    0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xEC, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xF5, 0x21, 0x6F, 0xF1, 0x21, 0x64,
-    0xFD, 0x44, 0x6C, 0x6D, 0x72, 0x75, 0xFF, 0xCF, 0xFA, 0x44, 0xFF, 0xD3, 0xFF, 0xFD, 0xA0, 0x0F, 0x52, 0xA1, 0x0F,
-    0x52, 0x73, 0xFD, 0x21, 0x61, 0xFB, 0xA1, 0x04, 0x52, 0x73, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3,
-    0xDD, 0xE5, 0xFF, 0xFB, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xE8, 0xDD, 0xEE, 0x21, 0x65, 0xEA, 0x21, 0x72,
-    0xFD, 0x42, 0x62, 0x63, 0xFF, 0xFD, 0xF4, 0xB1, 0xA0, 0x0F, 0xF3, 0xA1, 0x06, 0xF3, 0x72, 0xFD, 0x41, 0x72, 0xF9,
-    0xC6, 0xA1, 0x06, 0xF3, 0x6F, 0xFC, 0xA0, 0x10, 0x23, 0x41, 0x2E, 0xF7, 0x64, 0x42, 0x2E, 0x73, 0xF7, 0x60, 0xFF,
-    0xFC, 0x21, 0x74, 0xF9, 0x21, 0x69, 0xFD, 0xA2, 0x07, 0x23, 0x72, 0x76, 0xEC, 0xFD, 0x45, 0xA1, 0xA9, 0xAD, 0xB3,
-    0xBA, 0xFF, 0xF9, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x03, 0xEE, 0x03, 0x48, 0x72, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75,
-    0xC3, 0xE1, 0x50, 0xE1, 0x27, 0xFF, 0xC7, 0xED, 0xF0, 0xFF, 0xD0, 0xED, 0xF0, 0xED, 0xF0, 0xFF, 0xF0, 0x21, 0x72,
-    0xE7, 0xC7, 0x07, 0xB1, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDD, 0x6A, 0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x6D,
-    0xDD, 0x6D, 0xDD, 0x6D, 0xDD, 0x73, 0x21, 0x61, 0xE8, 0x22, 0x65, 0x72, 0xE2, 0xFD, 0xA0, 0x11, 0x43, 0x21, 0x6E,
-    0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD,
-    0x21, 0x61, 0xFD, 0x23, 0x70, 0x64, 0x72, 0xE0, 0xFD, 0xFD, 0xDA, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67,
-    0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x65, 0x6F,
-    0x75, 0xDC, 0x19, 0xDC, 0x1C, 0xDC, 0x22, 0xDC, 0x1C, 0xDC, 0x2B, 0xDC, 0x30, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C,
-    0xDC, 0x1C, 0xDC, 0x30, 0xDC, 0x1C, 0xFE, 0x72, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xC8, 0xDC, 0x1C, 0xDC,
-    0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xDC, 0x1C, 0xFE, 0xE8, 0xFF, 0x26, 0xFF, 0x5F, 0xFF, 0xF9, 0x41, 0x65, 0xE1, 0x23,
-    0x41, 0x6E, 0xDF, 0x92, 0x21, 0x69, 0xFC, 0x22, 0x74, 0x64, 0xF5, 0xFD, 0x41, 0x6C, 0xDF, 0x86, 0x21, 0x65, 0xFC,
-    0x21, 0x75, 0xFD, 0x41, 0x62, 0xDF, 0x7C, 0x21, 0x6F, 0xFC, 0x41, 0x72, 0xDF, 0x75, 0x21, 0x61, 0xFC, 0x43, 0x63,
-    0x70, 0x74, 0xFF, 0xF6, 0xDF, 0x6E, 0xFF, 0xFD, 0x41, 0xA1, 0xDF, 0x8F, 0x21, 0xC3, 0xFC, 0x21, 0x6C, 0xFD, 0x24,
-    0x6E, 0x62, 0x6C, 0x74, 0xCF, 0xDB, 0xEC, 0xFD, 0x21, 0xA1, 0xBF, 0x21, 0xC3, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63,
-    0xFD, 0x41, 0x2E, 0xE4, 0xB3, 0x42, 0x2E, 0x73, 0xE4, 0xAF, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x21, 0x72,
-    0xFB, 0x23, 0x61, 0x6F, 0x65, 0xD8, 0xEA, 0xFD, 0x41, 0x73, 0xDE, 0x49, 0x21, 0x61, 0xFC, 0x21, 0x6E, 0xFD, 0x21,
-    0x69, 0xFD, 0x41, 0x64, 0xE0, 0x00, 0x41, 0x6C, 0xDF, 0xFC, 0x41, 0x69, 0xE9, 0x65, 0x42, 0x63, 0x74, 0xDF, 0xF7,
-    0xFF, 0xFC, 0xA4, 0x0E, 0xB2, 0x6D, 0x6E, 0x74, 0x63, 0xEA, 0xED, 0xF1, 0xF9, 0x41, 0xBA, 0xE4, 0x87, 0x41, 0x75,
-    0xDF, 0xE5, 0xA2, 0x0E, 0xB2, 0xC3, 0x78, 0xF8, 0xFC, 0x41, 0x6E, 0xDF, 0xDA, 0x21, 0x61, 0xFC, 0x21, 0x69, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0xB3, 0xF0, 0x22, 0x6F, 0xC3, 0xED, 0xFD, 0x21, 0x69, 0xFB, 0x41, 0x2E,
-    0xDB, 0x9E, 0x42, 0x2E, 0x73, 0xDB, 0x9A, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x41, 0xAD, 0xDF, 0xAF, 0x43,
-    0x69, 0xC3, 0x65, 0xDF, 0xAB, 0xFF, 0xFC, 0xDF, 0xAB, 0x41, 0xA1, 0xDF, 0xA1, 0x43, 0x61, 0xC3, 0x6F, 0xDF, 0x9D,
-    0xFF, 0xFC, 0xDF, 0x9D, 0x41, 0x61, 0xE4, 0x31, 0x21, 0x76, 0xFC, 0x41, 0x74, 0xDD, 0x80, 0x41, 0x69, 0xDF, 0x88,
-    0xA1, 0x0E, 0x92, 0x72, 0xFC, 0x41, 0x76, 0xDF, 0x7F, 0x45, 0x61, 0xC3, 0x65, 0x6F, 0x69, 0xDF, 0x7B, 0xDF, 0xF0,
-    0xDF, 0x7B, 0xFF, 0xF7, 0xFF, 0xFC, 0xC8, 0x0E, 0xB2, 0x62, 0x63, 0x64, 0x67, 0x6A, 0x6C, 0x73, 0x74, 0xFF, 0x9E,
-    0xFF, 0xA9, 0xFF, 0xB7, 0xFF, 0xC0, 0xFF, 0xCE, 0xFF, 0xDC, 0xFF, 0xDF, 0xFF, 0xF0, 0x41, 0x65, 0xDF, 0x49, 0x41,
-    0x69, 0xDD, 0x81, 0x21, 0x63, 0xFC, 0x21, 0x61, 0xFD, 0xA2, 0x0E, 0xB2, 0x63, 0x72, 0xF2, 0xFD, 0xC3, 0x0E, 0xB2,
-    0x72, 0x62, 0x73, 0xDF, 0x34, 0xE1, 0xB9, 0xE0, 0xFB, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xDF, 0x28,
-    0xFF, 0x3B, 0xFF, 0x4E, 0xFF, 0xC4, 0xFF, 0xED, 0xFF, 0xF4, 0xE5, 0xE3, 0x21, 0x73, 0xEA, 0x42, 0x73, 0x6E, 0xFE,
-    0xFB, 0xFF, 0xFD, 0x41, 0x70, 0xE6, 0x22, 0xD8, 0x00, 0x91, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x61, 0x6F, 0xDA, 0x54, 0xDA, 0x80,
-    0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA,
-    0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80, 0xDA, 0x80,
-    0xDA, 0x80, 0xFF, 0xF5, 0xFF, 0xFC, 0x41, 0x68, 0xEC, 0xA2, 0x21, 0x63, 0xFC, 0xC2, 0x01, 0xF2, 0x2E, 0x73, 0xDA,
-    0x02, 0xFF, 0xFD, 0xC1, 0x01, 0xF2, 0x2E, 0xD9, 0xF9, 0xA0, 0x01, 0xF2, 0x42, 0x61, 0x72, 0xF6, 0xB8, 0xDB, 0x22,
-    0x41, 0x65, 0xDE, 0x04, 0x42, 0x61, 0x6D, 0xDE, 0x00, 0xE5, 0xAF, 0x44, 0x74, 0x6C, 0x63, 0x72, 0xFF, 0xEE, 0xFF,
-    0xF5, 0xEA, 0x58, 0xFF, 0xF9, 0x41, 0x75, 0xEC, 0x56, 0x41, 0x6F, 0xEC, 0x52, 0x22, 0x71, 0x63, 0xF8, 0xFC, 0x21,
-    0x6F, 0xFB, 0x41, 0x6C, 0xEA, 0x9C, 0x41, 0x70, 0xEB, 0x6A, 0x41, 0x62, 0xE5, 0x83, 0x21, 0x72, 0xFC, 0x41, 0x63,
-    0xDA, 0x91, 0x21, 0x69, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0xDC, 0x00, 0x41, 0x2E, 0x62,
-    0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x74, 0x76, 0x77, 0x79, 0x72, 0x7A, 0x73, 0x6C,
-    0x78, 0x65, 0x69, 0x61, 0x6F, 0x75, 0xC3, 0xD9, 0xA2, 0xD9, 0xA5, 0xD9, 0xAB, 0xD9, 0xA5, 0xD9, 0xB4, 0xD9, 0xB9,
-    0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xA5, 0xD9, 0xB9, 0xD9, 0xA5, 0xD9, 0xBE, 0xD9, 0xA5, 0xD9, 0xC7, 0xD9, 0xA5, 0xD9,
-    0xA5, 0xD9, 0xA5, 0xFF, 0x4E, 0xFF, 0xA0, 0xFF, 0xA9, 0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xC4, 0xFF, 0xDE, 0xFF, 0xE1,
-    0xFF, 0xE5, 0xFF, 0xED, 0xFF, 0xFD, 0x42, 0x63, 0x64, 0xFF, 0x62, 0xF8, 0xFA, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6D, 0x6E, 0x70, 0x71, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6C, 0x72,
-    0x69, 0xD9, 0x44, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47,
-    0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9, 0x47, 0xD9,
-    0x47, 0xD9, 0x47, 0xD9, 0x73, 0xD9, 0x73, 0xFF, 0xF9, 0x41, 0x73, 0xFE, 0xF3, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63,
-    0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0x61, 0xD8, 0xF8, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB,
-    0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8,
-    0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xD8, 0xFB, 0xFF, 0xFC, 0x42, 0x6E, 0x72, 0xEA, 0x5D, 0xEA, 0x5D, 0xD8, 0x00, 0x41,
-    0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
-    0x78, 0x79, 0x7A, 0x65, 0x69, 0xD8, 0xA9, 0xD8, 0xAC, 0xD8, 0xB2, 0xD8, 0xAC, 0xD8, 0xBB, 0xD8, 0xC0, 0xD8, 0xAC,
-    0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xC0, 0xD8, 0xAC, 0xD8, 0xC5, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8,
-    0xCE, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xD8, 0xAC, 0xFF, 0xF9, 0xF4, 0x61, 0xD6, 0x00, 0x41, 0x2E,
-    0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78,
-    0x79, 0x7A, 0xD8, 0x5E, 0xD8, 0x61, 0xD8, 0x67, 0xD8, 0x61, 0xD8, 0x70, 0xD8, 0x75, 0xD8, 0x61, 0xD8, 0x61, 0xD8,
-    0x61, 0xD8, 0x61, 0xD8, 0x75, 0xD8, 0x61, 0xD8, 0x7A, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x83, 0xD8, 0x61,
-    0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0xD8, 0x61, 0x41, 0x6F, 0xF1, 0x80, 0xD7, 0x00, 0x41, 0x2E, 0x62, 0x63, 0x64,
-    0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x6F,
-    0xD8, 0x15, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8,
-    0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18,
-    0xD8, 0x18, 0xD8, 0x18, 0xD8, 0x18, 0xFF, 0xFC, 0xC1, 0x00, 0x41, 0x2E, 0xD7, 0xCD, 0x41, 0x73, 0xE8, 0xC1, 0xA0,
-    0x02, 0x82, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x80, 0xF4, 0x80, 0xFF,
-    0xFB, 0x21, 0x6C, 0xF6, 0x21, 0x65, 0xFD, 0x43, 0x65, 0x6F, 0x61, 0xF4, 0x70, 0xF4, 0x70, 0xF4, 0x70, 0x21, 0x6C,
-    0xF6, 0x21, 0x65, 0xFD, 0x21, 0x73, 0xFA, 0x21, 0x6F, 0xFD, 0xA0, 0x02, 0xD2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB, 0xFB, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x25, 0x6D, 0x74, 0x73, 0x6E, 0x72,
-    0xD1, 0xD1, 0xE1, 0xE7, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xE5, 0xE5, 0xE5, 0x21, 0x6C, 0xF9, 0x21, 0x73, 0xFD, 0x25,
-    0x6D, 0x74, 0x73, 0x6E, 0x6F, 0xB9, 0xB9, 0xC9, 0xCF, 0xFD, 0x46, 0x73, 0x69, 0x2E, 0x64, 0x6F, 0x72, 0xD7, 0x59,
-    0xFF, 0x92, 0xD7, 0x59, 0xFF, 0xDD, 0xFF, 0xC1, 0xFF, 0xF5, 0x41, 0x73, 0xFF, 0x86, 0x21, 0x6F, 0xFC, 0x45, 0x2E,
-    0x73, 0x6D, 0x69, 0x6E, 0xD7, 0x3F, 0xE8, 0x39, 0xFF, 0xFD, 0xFF, 0x78, 0xE8, 0x39, 0xA0, 0x02, 0xA3, 0x21, 0x2E,
-    0xFD, 0x23, 0x2E, 0x73, 0x69, 0xFA, 0xFD, 0xE3, 0x42, 0x6F, 0x61, 0xF3, 0xEA, 0xF3, 0xEA, 0x21, 0x63, 0xF9, 0x43,
-    0x65, 0x61, 0x69, 0xFF, 0xEF, 0xF3, 0xE0, 0xFF, 0xFD, 0x41, 0x6F, 0xF3, 0xD6, 0x22, 0x74, 0x6D, 0xF2, 0xFC, 0x41,
-    0x73, 0xFF, 0x76, 0x21, 0x65, 0xFC, 0x21, 0x6F, 0xF9, 0x41, 0x65, 0xFF, 0x6F, 0x21, 0x6C, 0xFC, 0x47, 0x61, 0x2E,
-    0x73, 0x74, 0x6D, 0x64, 0x62, 0xFF, 0xB5, 0xD6, 0xF4, 0xFF, 0xEA, 0xFF, 0xF3, 0xFF, 0xF6, 0xFF, 0x6D, 0xFF, 0xFD,
-    0x21, 0x6D, 0xE0, 0x42, 0x2E, 0x65, 0xD6, 0xDB, 0xFF, 0xFD, 0x21, 0x61, 0xF6, 0xA0, 0x02, 0xA2, 0x42, 0x2E, 0x73,
-    0xFF, 0xFD, 0xFF, 0xA2, 0x42, 0x2E, 0x73, 0xFF, 0x98, 0xFF, 0x9B, 0x23, 0x65, 0x6F, 0x61, 0xF2, 0xF2, 0xF9, 0x21,
-    0x6C, 0xF9, 0x21, 0x65, 0xFD, 0x23, 0x65, 0x6F, 0x61, 0xEC, 0xEC, 0xEC, 0x21, 0x6C, 0xF9, 0x21, 0x65, 0xFD, 0x21,
-    0x73, 0xFA, 0x21, 0x6F, 0xFD, 0x47, 0x61, 0x65, 0x6D, 0x74, 0x73, 0x6E, 0x6F, 0xFF, 0xC2, 0xFF, 0xC2, 0xFF, 0xEA,
-    0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0x08, 0x44, 0x6D, 0x74, 0x73, 0x6E, 0xFE, 0xDF, 0xFE, 0xDF, 0xFE, 0xEF,
-    0xFE, 0xF5, 0x41, 0x6F, 0xFE, 0xB6, 0x43, 0x6F, 0x61, 0x65, 0xF3, 0x41, 0xF3, 0x41, 0xF3, 0x41, 0x42, 0x2E, 0x6C,
-    0xD6, 0x6F, 0xFF, 0xF6, 0x21, 0x65, 0xF9, 0x41, 0x65, 0xE7, 0x5F, 0x44, 0x2E, 0x6D, 0x6C, 0x6E, 0xD6, 0x61, 0xFF,
-    0xFC, 0xFF, 0xE8, 0xFF, 0xE4, 0x21, 0x65, 0xF3, 0x46, 0x6C, 0x6E, 0x6F, 0x6D, 0x74, 0x73, 0xFE, 0xA9, 0xFF, 0xD4,
-    0xFE, 0x8A, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0xFD, 0x21, 0x6F, 0xED, 0x21, 0x64, 0xFD, 0x47, 0x73, 0x69, 0x62, 0x72,
-    0x64, 0x6F, 0x6E, 0xFF, 0x5D, 0xFE, 0x71, 0xFF, 0x64, 0xFF, 0x98, 0xFF, 0xAE, 0xFE, 0xA0, 0xFF, 0xFD, 0x41, 0x67,
-    0xFE, 0x9B, 0x21, 0x6F, 0xFC, 0x41, 0x63, 0xD6, 0x1E, 0x21, 0x69, 0xFC, 0x41, 0x65, 0xFF, 0x06, 0x21, 0x74, 0xFC,
-    0x45, 0x2E, 0x6C, 0x74, 0x6E, 0x73, 0xD6, 0x0D, 0xFF, 0xEF, 0xFF, 0xF6, 0xE7, 0x07, 0xFF, 0xFD, 0x45, 0xB1, 0xA9,
-    0xAD, 0xA1, 0xB3, 0xFE, 0x30, 0xFE, 0xA4, 0xFF, 0x09, 0xFF, 0xC5, 0xFF, 0xF0, 0xA0, 0x01, 0x72, 0xA0, 0x01, 0x92,
-    0x21, 0xB3, 0xFD, 0x22, 0x75, 0xC3, 0xF7, 0xFD, 0x21, 0x65, 0xF2, 0xA0, 0x02, 0x62, 0x21, 0x2E, 0xFD, 0x22, 0x2E,
-    0x73, 0xFA, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x65, 0xF5, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23,
-    0x2E, 0x73, 0x6D, 0xE6, 0xE9, 0xFD, 0x22, 0x6F, 0x61, 0xE5, 0xF9, 0x21, 0x63, 0xFB, 0x21, 0x69, 0xFD, 0x21, 0x67,
-    0xFD, 0x21, 0xB3, 0xFD, 0x21, 0x61, 0xD4, 0x21, 0xAD, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x67, 0xFD, 0x41, 0x67, 0xE1,
-    0x68, 0x23, 0xC3, 0x6F, 0x69, 0xED, 0xF9, 0xFC, 0xA0, 0x00, 0xC2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD,
-    0x21, 0x65, 0xF8, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xE9, 0xEC, 0xFD,
-    0x44, 0x2E, 0x6F, 0x61, 0x74, 0xD5, 0x78, 0xFF, 0xE8, 0xFF, 0xF9, 0xF5, 0x24, 0x42, 0x6F, 0x61, 0xD9, 0x83, 0xD9,
-    0x83, 0x21, 0x74, 0xF9, 0x41, 0x6E, 0xF2, 0xAF, 0x43, 0x63, 0x74, 0x65, 0xE7, 0x07, 0xE7, 0x07, 0xFD, 0x93, 0x41,
-    0x74, 0xE6, 0xFD, 0x41, 0x69, 0xE5, 0x70, 0x41, 0x61, 0xD6, 0xF0, 0x21, 0xAD, 0xFC, 0x21, 0xC3, 0xFD, 0xA1, 0x04,
-    0xA2, 0x70, 0xFD, 0x47, 0x68, 0x61, 0x65, 0x69, 0x6F, 0x75, 0xC3, 0xD9, 0x07, 0xD9, 0x43, 0xFF, 0xFB, 0xD9, 0x43,
-    0xD9, 0x43, 0xD9, 0x43, 0xD9, 0x49, 0x21, 0x6F, 0xEA, 0x22, 0x6E, 0x74, 0xD4, 0xFD, 0xA0, 0x00, 0x91, 0x21, 0x2E,
-    0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x0F, 0x72, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x22, 0x6F, 0x61, 0xFB,
-    0xFB, 0xA0, 0x03, 0x32, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x10, 0xF3, 0x21, 0x2E, 0xFD, 0x23,
-    0x61, 0x2E, 0x73, 0xF5, 0xFA, 0xFD, 0x21, 0x73, 0xEB, 0x22, 0x2E, 0x65, 0xE5, 0xFD, 0x21, 0x6C, 0xFB, 0x22, 0x65,
-    0x61, 0xEE, 0xFD, 0x22, 0x63, 0x64, 0xD3, 0xFB, 0x4D, 0x65, 0x61, 0x2E, 0x78, 0x6C, 0x73, 0x63, 0x6D, 0x6E, 0x70,
-    0x72, 0x6F, 0x69, 0xFE, 0xF1, 0xFE, 0xF6, 0xD4, 0xD5, 0xFF, 0x04, 0xFF, 0x3B, 0xFF, 0x60, 0xFF, 0x74, 0xFF, 0x77,
-    0xFF, 0x7B, 0xFF, 0x85, 0xFF, 0xB5, 0xFF, 0xC0, 0xFF, 0xFB, 0x42, 0x65, 0xC3, 0xFE, 0xC0, 0xFE, 0xC6, 0xA0, 0x03,
-    0x23, 0x21, 0x2E, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x67, 0xFD, 0x43, 0x2E, 0x73, 0x69, 0xD4, 0x97,
-    0xE5, 0x91, 0xFC, 0xD0, 0x21, 0x65, 0xF6, 0x41, 0x73, 0xFE, 0xB1, 0x44, 0x2E, 0x73, 0x69, 0x6E, 0xFE, 0xAA, 0xFE,
-    0xAD, 0xFF, 0xFC, 0xFE, 0xAD, 0x43, 0x2E, 0x74, 0x65, 0xD4, 0x79, 0xFF, 0xEC, 0xFF, 0xF3, 0xA0, 0x0C, 0xF1, 0x21,
-    0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0xA0, 0x11, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x63,
-    0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x23, 0x6F, 0x69, 0x65, 0xC7, 0xEB, 0xFD, 0x42, 0x6F, 0x72, 0xD4, 0x4A,
-    0xE0, 0x14, 0x45, 0x2E, 0x64, 0x66, 0x67, 0x74, 0xD4, 0x43, 0xFF, 0xF9, 0xF1, 0x94, 0xE5, 0xEC, 0xFA, 0x5A, 0x41,
-    0x65, 0xFC, 0x6C, 0x42, 0x6E, 0x73, 0xFE, 0x56, 0xFE, 0x56, 0x41, 0x6F, 0xFF, 0x9E, 0x41, 0x73, 0xFE, 0x48, 0x45,
-    0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFE, 0x44, 0xFE, 0x47, 0xFF, 0xF8, 0xFF, 0xFC, 0xFE, 0x47, 0x42, 0x61, 0x73, 0xFF,
-    0xF0, 0xFE, 0x37, 0x43, 0x2E, 0x73, 0x69, 0xFE, 0x2D, 0xFE, 0x30, 0xFF, 0x7F, 0x43, 0x73, 0x2E, 0x6E, 0xFE, 0x26,
-    0xFE, 0x23, 0xFE, 0x26, 0x23, 0xAD, 0xA9, 0xA1, 0xE5, 0xEC, 0xF6, 0x45, 0x6D, 0x2E, 0x73, 0x69, 0x6E, 0xFF, 0xC6,
-    0xFE, 0x12, 0xFE, 0x15, 0xFF, 0x64, 0xFE, 0x15, 0xA0, 0x03, 0x22, 0x21, 0x2E, 0xFD, 0x21, 0x65, 0xFD, 0x41, 0x65,
-    0xFF, 0x32, 0x42, 0x2E, 0x73, 0xFF, 0x2B, 0xFF, 0x2E, 0x23, 0x65, 0x61, 0x6F, 0xF9, 0xF9, 0xF9, 0x41, 0x73, 0xFF,
-    0x20, 0x21, 0x6F, 0xFC, 0x41, 0x68, 0xD7, 0xC2, 0xC2, 0x00, 0xD1, 0x2E, 0x73, 0xFD, 0xDC, 0xFD, 0xDF, 0x22, 0x6F,
-    0x61, 0xF7, 0xF7, 0x4C, 0x6F, 0xC3, 0x65, 0x61, 0x2E, 0x6D, 0x74, 0x6C, 0x73, 0x6E, 0x63, 0x69, 0xFF, 0x7B, 0xFF,
-    0xB5, 0xFF, 0xBC, 0xFF, 0x24, 0xD3, 0xAA, 0xFF, 0xD2, 0xFF, 0xD5, 0xFF, 0xE0, 0xFF, 0xD5, 0xFF, 0xEB, 0xFF, 0xEE,
-    0xFF, 0xFB, 0x41, 0x61, 0xFE, 0xFF, 0x43, 0x65, 0x6F, 0x61, 0xF0, 0x49, 0xF0, 0x49, 0xFB, 0xBA, 0x43, 0x2E, 0x61,
-    0x65, 0xFD, 0x9B, 0xFD, 0xA1, 0xFE, 0xED, 0x43, 0x2E, 0x73, 0x72, 0xFD, 0x91, 0xFD, 0x94, 0xFF, 0xF6, 0x48, 0x2E,
-    0x6D, 0x74, 0x6C, 0x6E, 0x6F, 0x61, 0x65, 0xD3, 0x63, 0xFC, 0xFE, 0xFC, 0xFE, 0xFF, 0xE2, 0xFC, 0xE6, 0xFF, 0xF6,
-    0xFD, 0x8D, 0xE3, 0xDD, 0xA0, 0x05, 0x41, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xFD,
-    0x65, 0x21, 0xB3, 0xFC, 0x41, 0x65, 0xFE, 0xAD, 0x21, 0x6E, 0xFC, 0x22, 0xC3, 0x6F, 0xF6, 0xFD, 0x43, 0x74, 0x61,
-    0x69, 0xE4, 0xD8, 0xFF, 0xEA, 0xFF, 0xFB, 0x41, 0x72, 0xE4, 0xCE, 0x41, 0x64, 0xFE, 0xBA, 0x21, 0x61, 0xFC, 0x21,
-    0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x42, 0x72, 0x69, 0xE4, 0xB7, 0xFF, 0xFD, 0x41,
-    0x69, 0xE2, 0xB7, 0x41, 0x74, 0xED, 0x7B, 0x43, 0x64, 0x73, 0x74, 0xEA, 0xF2, 0xFF, 0xFC, 0xE4, 0xA8, 0x41, 0x73,
-    0xEC, 0xE8, 0x42, 0x2E, 0x65, 0xD2, 0xF0, 0xFF, 0xFC, 0xA0, 0x08, 0xF1, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA,
-    0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x73, 0xFD, 0x21, 0xAD, 0xFD, 0x53, 0x61, 0x69, 0x73, 0x2E, 0x6D, 0x6E, 0x74, 0x72,
-    0x62, 0x64, 0x6F, 0x63, 0x65, 0x66, 0x67, 0x70, 0x75, 0x6C, 0xC3, 0xFE, 0x25, 0xFE, 0x38, 0xFE, 0x59, 0xD2, 0xD2,
-    0xFE, 0x81, 0xFE, 0x8F, 0xFE, 0x9F, 0xFF, 0x28, 0xFF, 0x4D, 0xFF, 0x6F, 0xFB, 0x0B, 0xFF, 0xA7, 0xFF, 0xB1, 0xFF,
-    0xC8, 0xFF, 0xB1, 0xFF, 0xCF, 0xFF, 0xD7, 0xFF, 0xE5, 0xFF, 0xFD, 0xA0, 0x01, 0xB2, 0x21, 0xA1, 0xFD, 0x43, 0xC3,
-    0x65, 0x73, 0xFF, 0xFD, 0xD2, 0xF0, 0xE3, 0x8C, 0x41, 0x65, 0xEB, 0xDA, 0x21, 0x6C, 0xFC, 0x41, 0x65, 0xE4, 0xF6,
-    0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0x43, 0x2E, 0x63, 0x74, 0xD2, 0x77, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x61, 0xD2,
-    0x6D, 0x21, 0x63, 0xFC, 0x21, 0x6F, 0xFD, 0x41, 0x6F, 0xD5, 0x4C, 0x43, 0x6F, 0x62, 0x69, 0xFD, 0xD5, 0xFF, 0xF9,
-    0xFF, 0xFC, 0xA0, 0x01, 0xB1, 0x21, 0x72, 0xFD, 0x21, 0x62, 0xFD, 0x21, 0x65, 0xFD, 0x43, 0x65, 0x6F, 0x72, 0xEC,
-    0xC5, 0xD6, 0x64, 0xDE, 0x0C, 0x45, 0x2E, 0x68, 0x64, 0x65, 0x74, 0xD2, 0x3F, 0xFF, 0xF3, 0xE3, 0xEC, 0xEB, 0xCF,
-    0xFF, 0xF6, 0xA0, 0x04, 0x13, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x42, 0x2E,
-    0x65, 0xFC, 0x44, 0xFF, 0xFD, 0xA0, 0x03, 0xC2, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x61, 0xED, 0x22, 0x61,
-    0x65, 0xEA, 0xEA, 0x46, 0x73, 0x2E, 0x6E, 0x69, 0x62, 0x72, 0xFF, 0xE8, 0xFC, 0x2C, 0xFC, 0x2F, 0xFF, 0xF5, 0xFF,
-    0xF8, 0xFF, 0xFB, 0x45, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xFC, 0x19, 0xFC, 0x1C, 0xFD, 0xCD, 0xFD, 0x6B, 0xFC, 0x1C,
-    0x42, 0x73, 0x61, 0xFC, 0x0C, 0xFF, 0xF0, 0x43, 0xA9, 0xA1, 0xAD, 0xFD, 0xD5, 0xFF, 0xD6, 0xFF, 0xF9, 0xA0, 0x02,
-    0xF3, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6D, 0xFD, 0x43, 0x65, 0x61, 0x6F, 0xEE, 0x8D,
-    0xEE, 0x8D, 0xEE, 0x8D, 0x43, 0x2E, 0x73, 0x69, 0xFF, 0xA2, 0xFF, 0xA5, 0xFF, 0xA8, 0x21, 0x65, 0xF6, 0xA0, 0x03,
-    0xE3, 0x21, 0x2E, 0xFD, 0x21, 0x73, 0xFD, 0x24, 0x2E, 0x73, 0x69, 0x6E, 0xF7, 0xFA, 0xFD, 0xFA, 0x43, 0x2E, 0x74,
-    0x65, 0xFF, 0x83, 0xFF, 0xEB, 0xFF, 0xF7, 0x21, 0x6F, 0xEA, 0x41, 0x65, 0xFF, 0x7C, 0x21, 0x6E, 0xE0, 0x21, 0x73,
-    0xDA, 0x25, 0x2E, 0x73, 0x6D, 0x69, 0x6E, 0xD7, 0xDA, 0xF3, 0xFD, 0xDA, 0x22, 0x61, 0x73, 0xF5, 0xCF, 0x23, 0x2E,
-    0x73, 0x69, 0xC7, 0xCA, 0xCD, 0x23, 0x73, 0x2E, 0x6E, 0xC3, 0xC0, 0xC3, 0x23, 0xAD, 0xA9, 0xA1, 0xED, 0xF2, 0xF9,
-    0x45, 0x6D, 0x2E, 0x73, 0x69, 0x6E, 0xFF, 0xCE, 0xFF, 0xB2, 0xFF, 0xB5, 0xFF, 0xB8, 0xFF, 0xB5, 0x44, 0x6F, 0xC3,
-    0x65, 0x61, 0xFF, 0xC5, 0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xAB, 0xA0, 0x10, 0x54, 0x21, 0x2E, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x23, 0x2E, 0x73, 0x6D, 0xEE, 0xF1, 0xFD, 0x21, 0x65, 0xF9,
-    0x42, 0x61, 0x6C, 0xFF, 0x82, 0xFF, 0xFD, 0x42, 0x2E, 0x73, 0xFF, 0x72, 0xFF, 0x75, 0x43, 0x2E, 0x61, 0x65, 0xFF,
-    0x6B, 0xFF, 0xF9, 0xFF, 0x71, 0x43, 0x2E, 0x73, 0x72, 0xFF, 0x61, 0xFF, 0x64, 0xFF, 0xF6, 0x43, 0x2E, 0x6F, 0x61,
-    0xFE, 0xEC, 0xFF, 0xF6, 0xFF, 0xE5, 0x47, 0x73, 0x6D, 0x6E, 0x74, 0x72, 0x62, 0x64, 0xFF, 0x5F, 0xFF, 0x69, 0xFE,
-    0xE5, 0xFF, 0x6C, 0xFF, 0xAB, 0xFF, 0xD4, 0xFF, 0xF6, 0x42, 0x2E, 0x65, 0xFB, 0x09, 0xFC, 0x5B, 0x21, 0x64, 0xF9,
-    0x21, 0x61, 0xFD, 0x21, 0x64, 0xFD, 0x45, 0x2E, 0x65, 0x61, 0x6D, 0x69, 0xFA, 0xF9, 0xFC, 0x4B, 0xFA, 0xFF, 0xFB,
-    0x10, 0xFF, 0xFD, 0x21, 0x72, 0xF0, 0x21, 0x6F, 0xFD, 0x4B, 0xC3, 0x65, 0x2E, 0x6D, 0x74, 0x6C, 0x73, 0x6E, 0x6F,
-    0x61, 0x69, 0xFE, 0xE1, 0xFE, 0xF7, 0xD0, 0xBF, 0xFA, 0x5A, 0xFA, 0x5A, 0xFE, 0xFA, 0xFA, 0x5A, 0xFA, 0x42, 0xFC,
-    0x35, 0xFF, 0xC4, 0xFF, 0xFD, 0x46, 0x2E, 0x6D, 0x74, 0x6C, 0x6E, 0x72, 0xD0, 0x9D, 0xFA, 0x38, 0xFA, 0x38, 0xFD,
-    0x1C, 0xFA, 0x20, 0xFA, 0xCC, 0x41, 0x61, 0xE1, 0x84, 0x21, 0x6C, 0xFC, 0x21, 0x64, 0xFD, 0x41, 0x6F, 0xFB, 0x7E,
-    0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x69, 0xFD, 0x41, 0x2E, 0xE3, 0x46, 0x42, 0x2E, 0x73,
-    0xE3, 0x42, 0xFF, 0xFC, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x21, 0x69, 0xFB, 0x23, 0x64, 0x6D, 0x63, 0xD7, 0xEA, 0xFD,
-    0xA0, 0x00, 0x81, 0x21, 0x6F, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0xA1, 0xFD, 0x42, 0x6F, 0x72, 0xD4,
-    0x62, 0xDC, 0x11, 0xA0, 0x11, 0x92, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x72, 0xFD, 0x21,
-    0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0x44, 0x61, 0x6F, 0x74, 0x75, 0xE0, 0xA2, 0xE9, 0x8F, 0xFF, 0xE1,
-    0xFF, 0xFD, 0x41, 0x6E, 0xE1, 0xC8, 0x42, 0x63, 0x72, 0xE1, 0xC4, 0xE1, 0xC4, 0x42, 0x6D, 0x72, 0xD9, 0x69, 0xD4,
-    0xC3, 0x41, 0x67, 0xD9, 0xBC, 0x42, 0x61, 0x6F, 0xD0, 0x9B, 0xD0, 0x9B, 0x43, 0x61, 0x65, 0x6F, 0xD0, 0x94, 0xD0,
-    0x94, 0xD0, 0x94, 0x21, 0x69, 0xF6, 0x44, 0x61, 0x69, 0x65, 0x6F, 0xD0, 0x87, 0xD0, 0x87, 0xD0, 0x87, 0xD0, 0x87,
-    0x44, 0x6A, 0x67, 0x6C, 0x6D, 0xFF, 0xDF, 0xD9, 0x97, 0xFF, 0xF0, 0xFF, 0xF3, 0x44, 0xA1, 0xA9, 0xB3, 0xAD, 0xFF,
-    0xC7, 0xFF, 0xCE, 0xD8, 0x5C, 0xFF, 0xF3, 0x41, 0x72, 0xDC, 0x2A, 0x21, 0x65, 0xFC, 0x41, 0x6D, 0xE2, 0x99, 0x21,
-    0x75, 0xFC, 0x41, 0x69, 0xD1, 0xE0, 0x44, 0x63, 0x67, 0x6C, 0x6D, 0xFF, 0xF2, 0xD9, 0x83, 0xFF, 0xF9, 0xFF, 0xFC,
-    0x41, 0x74, 0xD2, 0x2C, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD, 0x41, 0x69, 0xD7, 0xE1, 0x21, 0x75, 0xFC, 0x43, 0x63,
-    0x67, 0x71, 0xD1, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x61, 0xC3, 0x6F, 0xD1, 0xA3, 0xD9, 0x2F, 0xD1, 0xA3, 0x41,
-    0xAD, 0xD1, 0x99, 0x43, 0x65, 0x69, 0xC3, 0xD1, 0x95, 0xD1, 0x95, 0xFF, 0xFC, 0x42, 0x69, 0x61, 0xD7, 0x0B, 0xD1,
-    0x8E, 0x44, 0xA1, 0xAD, 0xA9, 0xB3, 0xD1, 0x84, 0xD1, 0x84, 0xD1, 0x84, 0xD1, 0x84, 0x45, 0x61, 0xC3, 0x69, 0x65,
-    0x6F, 0xD1, 0x77, 0xFF, 0xF3, 0xD1, 0x77, 0xD1, 0x77, 0xD1, 0x77, 0x41, 0x6F, 0xD1, 0xE6, 0x25, 0x6A, 0x67, 0x6C,
-    0x6D, 0x74, 0xC0, 0xCE, 0xD8, 0xEC, 0xFC, 0x41, 0xB3, 0xD1, 0x58, 0x21, 0xC3, 0xFC, 0x21, 0x69, 0xFD, 0x41, 0x72,
-    0xFF, 0x7F, 0x41, 0xA9, 0xD1, 0x4D, 0x43, 0x63, 0x71, 0x73, 0xD1, 0x46, 0xD1, 0x46, 0xD6, 0x27, 0x22, 0xC3, 0x69,
-    0xF2, 0xF6, 0x41, 0x6D, 0xD1, 0xA5, 0x21, 0xA1, 0xFC, 0x22, 0x61, 0xC3, 0xF9, 0xFD, 0x41, 0x71, 0xD1, 0x2B, 0x21,
-    0x73, 0xFC, 0x41, 0x61, 0xD1, 0x35, 0x21, 0x6C, 0xFC, 0x47, 0x62, 0x6E, 0x63, 0x74, 0x67, 0x65, 0x70, 0xFF, 0xCC,
-    0xD8, 0xD5, 0xFF, 0xCF, 0xFF, 0xE1, 0xFF, 0xED, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0x72, 0x74, 0x63, 0xD1, 0x07, 0xD1,
-    0x07, 0xD1, 0x07, 0x21, 0x61, 0xF6, 0x42, 0x62, 0x64, 0xD8, 0xB2, 0xFF, 0xFD, 0x41, 0x72, 0xD0, 0x12, 0xA0, 0x0D,
-    0xA1, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x48, 0xC3, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x74, 0x70,
-    0xFE, 0xF9, 0xFF, 0x18, 0xFF, 0x36, 0xFF, 0x80, 0xFF, 0xC6, 0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xFD, 0x41, 0x72, 0xFA,
-    0x54, 0x21, 0x74, 0xFC, 0x21, 0x63, 0xFD, 0x21, 0xA9, 0xFD, 0x22, 0x65, 0xC3, 0xFA, 0xFD, 0x4F, 0x6F, 0x73, 0x2E,
-    0x6D, 0x6E, 0x72, 0x64, 0x65, 0x61, 0xC3, 0x63, 0x74, 0x75, 0x78, 0x6C, 0xFC, 0x13, 0xFC, 0x2E, 0xCE, 0xA5, 0xFC,
-    0x46, 0xFC, 0x66, 0xFD, 0xE6, 0xFE, 0x08, 0xFE, 0x22, 0xFE, 0x48, 0xFE, 0x5B, 0xFE, 0x7D, 0xFE, 0x8A, 0xFE, 0x8E,
-    0xFF, 0xD5, 0xFF, 0xFB, 0x43, 0x2E, 0x73, 0x6D, 0xF8, 0x9B, 0xF8, 0x9E, 0xFA, 0x4F, 0xA0, 0x03, 0x53, 0x21, 0x2E,
-    0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0xA0, 0x03, 0x84, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73, 0xFA, 0xFD, 0x23, 0x65,
-    0x6F, 0x61, 0xF0, 0xF0, 0xFB, 0x22, 0x2E, 0x6C, 0xE3, 0xF9, 0x21, 0x65, 0xFB, 0x23, 0x65, 0x61, 0x6F, 0xE1, 0xE1,
-    0xE1, 0x23, 0x65, 0x6F, 0x61, 0xDA, 0xDA, 0xDA, 0x21, 0x6C, 0xF9, 0x24, 0x6D, 0x74, 0x6C, 0x65, 0xEC, 0xEC, 0xEF,
-    0xFD, 0x22, 0x2E, 0x6C, 0xC1, 0xED, 0x21, 0x73, 0xFB, 0x21, 0x6F, 0xFD, 0x23, 0x73, 0x6E, 0x6F, 0xEC, 0xFD, 0xFA,
-    0x21, 0x6F, 0xF9, 0x43, 0x73, 0x69, 0x6D, 0xF8, 0x40, 0xF9, 0x8F, 0xFF, 0xFD, 0x21, 0xA1, 0xF6, 0x43, 0x6F, 0x61,
-    0xC3, 0xF8, 0x33, 0xFF, 0x95, 0xFF, 0xFD, 0x41, 0x69, 0xF9, 0x78, 0x21, 0x74, 0xFC, 0x41, 0x73, 0xF8, 0xEC, 0x42,
-    0x2E, 0x65, 0xF8, 0xE5, 0xFF, 0xFC, 0x21, 0x6C, 0xF9, 0x43, 0x69, 0x61, 0x65, 0xFF, 0xEF, 0xFF, 0xFD, 0xF8, 0x1C,
-    0x41, 0x61, 0xEA, 0xAB, 0x42, 0x6F, 0x69, 0xCE, 0x5D, 0xCE, 0xBE, 0x21, 0x6D, 0xF9, 0x41, 0x69, 0xCE, 0xB4, 0x21,
-    0x6D, 0xFC, 0x21, 0xA1, 0xFD, 0x22, 0x61, 0xC3, 0xF3, 0xFD, 0x44, 0x6D, 0x74, 0x6C, 0x6F, 0xF6, 0xB8, 0xFF, 0xE3,
-    0xFF, 0xFB, 0xE7, 0x2D, 0xC3, 0x02, 0x91, 0x61, 0xC3, 0x65, 0xCF, 0xCC, 0xD7, 0x58, 0xCF, 0xCC, 0x21, 0x69, 0xF4,
-    0x21, 0x63, 0xFD, 0xC1, 0x05, 0x81, 0x61, 0xCE, 0x3D, 0x21, 0x69, 0xFA, 0x21, 0x63, 0xFD, 0x21, 0xAD, 0xFD, 0xA0,
-    0x02, 0xB1, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x23, 0x62, 0x65, 0xC3, 0xF4, 0xFA, 0xFD, 0x21,
-    0x62, 0xED, 0x21, 0x6C, 0xEA, 0x21, 0x6D, 0xE7, 0x21, 0x69, 0xE7, 0x21, 0x70, 0xFD, 0x21, 0x73, 0xFD, 0x25, 0xAD,
-    0xA1, 0xA9, 0xBA, 0xB3, 0xEE, 0xF1, 0xE1, 0xF4, 0xFD, 0x22, 0x74, 0x69, 0xD0, 0xD0, 0x21, 0x6E, 0xCE, 0x21, 0x65,
-    0xFD, 0x22, 0x73, 0x72, 0xF5, 0xFD, 0x25, 0x69, 0xC3, 0x61, 0x65, 0x75, 0xCC, 0xE5, 0xD6, 0xFB, 0xD9, 0x41, 0x75,
-    0xEA, 0x4B, 0xA0, 0x0B, 0xE3, 0x22, 0x75, 0x74, 0xFD, 0xFD, 0x22, 0x73, 0x64, 0xFB, 0xF8, 0xA0, 0x0C, 0x63, 0x21,
-    0x72, 0xFD, 0xA0, 0x0C, 0x93, 0x21, 0x2E, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xEF, 0xF7, 0xFD, 0x41, 0x73, 0xEA, 0x44,
-    0x21, 0xA9, 0xFC, 0xA0, 0x0A, 0x12, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x0C, 0x42, 0x21,
-    0x6F, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x65, 0xFD, 0x24, 0x69, 0xC3, 0x65, 0x72, 0xD7, 0xE2, 0xEE,
-    0xFD, 0x21, 0x72, 0xF7, 0x42, 0x65, 0x72, 0xFF, 0xFD, 0xCE, 0x2D, 0x41, 0x72, 0xFC, 0xB4, 0x21, 0x74, 0xFC, 0x21,
-    0x73, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x72, 0xCD, 0xC6, 0x21, 0x65, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
-    0x65, 0xFD, 0x4A, 0x69, 0xC3, 0x68, 0x66, 0x6D, 0x74, 0x6F, 0x61, 0x64, 0x67, 0xFF, 0x2D, 0xFF, 0x3C, 0xFF, 0x7F,
-    0xFD, 0xF7, 0xFF, 0x8A, 0xFF, 0xDC, 0xE9, 0x9F, 0xE9, 0x9F, 0xFF, 0xED, 0xFF, 0xFD, 0x41, 0x65, 0xD8, 0x86, 0x43,
-    0x6E, 0x2E, 0x73, 0xD8, 0x7E, 0xF7, 0x21, 0xF7, 0x24, 0x42, 0x6F, 0x61, 0xFF, 0xF6, 0xF7, 0x1D, 0x42, 0x2E, 0x73,
-    0xF8, 0xC5, 0xF8, 0xC8, 0x22, 0x6F, 0x61, 0xF9, 0xF9, 0x41, 0x2E, 0xEE, 0x81, 0x21, 0x73, 0xFC, 0x21, 0x65, 0xFD,
-    0x44, 0x6E, 0x72, 0x2E, 0x73, 0xFF, 0xF1, 0xFF, 0xFD, 0xF7, 0x72, 0xF7, 0x75, 0x41, 0x61, 0xDE, 0x29, 0x41, 0x72,
-    0xF8, 0xA1, 0x42, 0x2E, 0x73, 0xF7, 0x5D, 0xF7, 0x60, 0x4A, 0x67, 0x64, 0x73, 0x6E, 0x62, 0x63, 0x61, 0x74, 0x65,
-    0x6F, 0xFE, 0x65, 0xFE, 0x84, 0xFE, 0xAB, 0xFF, 0x9A, 0xFF, 0xB9, 0xFF, 0xC7, 0xFF, 0xE4, 0xFF, 0xF1, 0xFF, 0xF5,
-    0xFF, 0xF9, 0x41, 0x69, 0xFB, 0xFC, 0x21, 0x72, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x74, 0xFD, 0x68, 0xA0, 0x11, 0xB2,
-    0x42, 0x64, 0x74, 0xFF, 0xFD, 0xFC, 0x01, 0x21, 0x69, 0xF9, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD,
-    0x21, 0x76, 0xFD, 0x21, 0x69, 0xFD, 0x23, 0x74, 0x6C, 0x6E, 0xDD, 0xE0, 0xFD, 0x5C, 0x62, 0x2E, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x6F,
-    0x61, 0x65, 0x69, 0x75, 0xCD, 0x5C, 0xDB, 0x8C, 0xDD, 0xF1, 0xE3, 0xC6, 0xE4, 0x43, 0xE5, 0xC4, 0xE7, 0x42, 0xE7,
-    0x94, 0xE7, 0xDD, 0xE8, 0x9B, 0xE9, 0xD6, 0xEA, 0x67, 0xED, 0x21, 0xED, 0x83, 0xEE, 0x2C, 0xF0, 0x08, 0xF2, 0x7F,
-    0xF2, 0xDD, 0xF3, 0x29, 0xF3, 0x78, 0xF3, 0xC3, 0xF4, 0x0C, 0xF6, 0x24, 0xF7, 0x4C, 0xF9, 0x4F, 0xFD, 0x7C, 0xFF,
-    0xB0, 0xFF, 0xF9,
+// Aho-Corasick automaton for the hypher patterns: 7741 states, 29 dense.
+constexpr uint8_t es_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00,
+    0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns es_patterns = {
-    0x34F8u,
-    es_trie_data,
-    sizeof(es_trie_data),
+constexpr uint16_t es_dense[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 0, 0, 0, 0,
+    0, 0, 28, 0, 1, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 16, 43, 44, 45, 46, 47, 22, 48, 49, 50, 51, 52, 0,
+    0, 0, 0, 0, 0, 28, 0, 53, 54, 55, 56, 57, 58, 59, 60, 9,
+    61, 11, 12, 62, 63, 64, 65, 66, 18, 67, 68, 69, 70, 23, 24, 25,
+    26, 27, 0, 0, 0, 0, 0, 0, 71, 0, 72, 2, 73, 74, 75, 6,
+    76, 77, 78, 79, 80, 81, 82, 83, 84, 16, 85, 86, 87, 88, 89, 90,
+    91, 92, 93, 94, 95, 0, 0, 0, 0, 0, 0, 28, 0, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 123, 0,
+    124, 2, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 16,
+    138, 139, 140, 141, 142, 22, 143, 144, 145, 146, 147, 0, 0, 0, 0, 0,
+    0, 28, 0, 148, 149, 3, 150, 151, 152, 7, 8, 9, 10, 11, 12, 153,
+    154, 155, 156, 17, 18, 157, 158, 159, 160, 23, 24, 161, 26, 27, 0, 0,
+    0, 0, 0, 0, 162, 0, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 22, 184, 185, 186, 187,
+    188, 0, 0, 0, 0, 0, 0, 28, 0, 189, 190, 191, 192, 193, 194, 195,
+    196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+    212, 213, 214, 215, 0, 0, 0, 0, 0, 0, 28, 0, 216, 217, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 240, 241, 242, 0, 0, 0, 0, 0, 0, 28, 0, 1,
+    243, 244, 245, 246, 247, 7, 248, 9, 10, 11, 12, 13, 14, 249, 250, 17,
+    18, 19, 251, 252, 22, 23, 24, 25, 26, 27, 0, 0, 0, 0, 0, 0,
+    28, 0, 253, 2, 254, 255, 256, 6, 257, 258, 259, 10, 260, 261, 262, 263,
+    264, 16, 265, 266, 267, 268, 269, 22, 270, 271, 272, 273, 274, 0, 0, 0,
+    0, 0, 0, 28, 0, 275, 2, 276, 277, 278, 6, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 16, 288, 289, 290, 291, 292, 22, 293, 294, 295, 296, 297,
+    0, 0, 0, 0, 0, 0, 28, 0, 298, 2, 299, 300, 301, 302, 303, 304,
+    305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 22, 318, 319,
+    320, 321, 322, 0, 0, 0, 0, 0, 0, 28, 0, 323, 324, 325, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343,
+    344, 345, 346, 347, 348, 349, 0, 0, 0, 0, 0, 0, 28, 0, 350, 351,
+    352, 353, 354, 355, 356, 357, 358, 10, 359, 360, 361, 362, 363, 364, 365, 366,
+    367, 368, 369, 22, 370, 371, 372, 373, 374, 0, 0, 0, 0, 0, 0, 28,
+    0, 375, 376, 3, 377, 5, 378, 7, 8, 9, 379, 11, 12, 380, 381, 382,
+    383, 384, 18, 385, 386, 21, 22, 23, 24, 387, 26, 27, 0, 0, 0, 0,
+    0, 0, 28, 0, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399,
+    400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 0,
+    0, 0, 0, 0, 0, 28, 0, 415, 2, 416, 417, 418, 6, 419, 420, 421,
+    10, 422, 423, 424, 425, 426, 16, 427, 428, 429, 430, 431, 432, 433, 434, 435,
+    436, 437, 0, 0, 0, 0, 0, 0, 28, 0, 438, 439, 440, 441, 442, 443,
+    444, 445, 446, 10, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 22,
+    458, 459, 460, 461, 462, 0, 0, 0, 0, 0, 0, 28, 0, 463, 464, 465,
+    466, 467, 468, 469, 470, 471, 10, 472, 473, 474, 475, 476, 477, 478, 479, 480,
+    481, 482, 483, 484, 485, 486, 487, 488, 0, 0, 0, 0, 0, 0, 28, 0,
+    489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504,
+    505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 0, 0, 0, 0, 0,
+    0, 516, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 517,
+    14, 518, 16, 17, 18, 19, 20, 519, 22, 23, 24, 25, 26, 27, 0, 0,
+    0, 0, 0, 0, 28, 0, 520, 2, 521, 522, 523, 6, 524, 525, 526, 527,
+    528, 529, 530, 531, 532, 16, 533, 534, 535, 536, 537, 22, 538, 539, 540, 541,
+    542, 0, 0, 0, 0, 0, 0, 28, 0, 543, 544, 545, 546, 547, 6, 548,
+    549, 550, 10, 551, 552, 553, 554, 555, 16, 556, 557, 558, 559, 560, 22, 561,
+    562, 563, 564, 565, 0, 0, 0, 0, 0, 0, 28, 0, 566, 2, 567, 568,
+    569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 16, 580, 581, 582, 583,
+    584, 22, 585, 586, 587, 588, 589, 0, 0, 0, 0, 0, 0, 28, 0, 590,
+    2, 591, 592, 593, 6, 594, 595, 596, 10, 597, 598, 599, 600, 601, 16, 602,
+    603, 604, 605, 606, 22, 607, 608, 609, 610, 611, 0, 0, 0, 0, 0, 0,
+    28, 0, 612, 2, 613, 614, 615, 6, 616, 617, 618, 10, 619, 620, 621, 622,
+    623, 624, 625, 626, 627, 628, 629, 22, 630, 631, 632, 633, 634, 0, 0, 0,
+    0, 0, 0, 28, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    635, 636, 637, 638, 639, 0, 28,
+};
+
+constexpr uint8_t es_label[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x22, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x22, 0x01, 0x03, 0x04, 0x05,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x22, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x04, 0x05,
+    0x06, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x15, 0x16, 0x19, 0x22, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x08, 0x0F, 0x10, 0x14, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x04, 0x06, 0x0A,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x19, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04,
+    0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x22, 0x0D, 0x0F, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x03, 0x04, 0x0F, 0x15, 0x0A, 0x02,
+    0x10, 0x06, 0x0A, 0x0F, 0x19, 0x06, 0x16, 0x0F, 0x02, 0x0A, 0x02, 0x10, 0x13, 0x06, 0x06, 0x10, 0x16, 0x06, 0x13,
+    0x06, 0x22, 0x02, 0x02, 0x0A, 0x15, 0x01, 0x02, 0x06, 0x0D, 0x0E, 0x0F, 0x10, 0x15, 0x13, 0x0A, 0x13, 0x13, 0x08,
+    0x01, 0x06, 0x06, 0x0A, 0x10, 0x01, 0x05, 0x07, 0x08, 0x15, 0x14, 0x0A, 0x01, 0x02, 0x04, 0x06, 0x0A, 0x0D, 0x0E,
+    0x0F, 0x10, 0x14, 0x15, 0x22, 0x01, 0x06, 0x15, 0x06, 0x05, 0x14, 0x15, 0x1E, 0x0F, 0x15, 0x1B, 0x15, 0x0F, 0x03,
+    0x06, 0x10, 0x16, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x0F, 0x0F, 0x14, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x14, 0x1B, 0x14, 0x04, 0x08, 0x13,
+    0x0F, 0x15, 0x1B, 0x07, 0x0F, 0x15, 0x0F, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x02, 0x03, 0x04, 0x15, 0x01, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x0F,
+    0x01, 0x06, 0x0A, 0x0E, 0x0F, 0x13, 0x14, 0x16, 0x0F, 0x14, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x14, 0x1B,
+    0x02, 0x0D, 0x01, 0x1D, 0x0F, 0x15, 0x1B, 0x04, 0x0A, 0x0F, 0x13, 0x14, 0x15, 0x0F, 0x06, 0x0F, 0x0F, 0x14, 0x15,
+    0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x14, 0x1B, 0x04, 0x05, 0x0E, 0x02, 0x10, 0x15, 0x16, 0x01, 0x0D, 0x0E, 0x0F, 0x13, 0x15, 0x05,
+    0x06, 0x22, 0x03, 0x0A, 0x10, 0x01, 0x05, 0x06, 0x09, 0x15, 0x06, 0x14, 0x22, 0x01, 0x02, 0x06, 0x0A, 0x0D, 0x0E,
+    0x0F, 0x10, 0x14, 0x15, 0x22, 0x01, 0x04, 0x15, 0x0F, 0x04, 0x13, 0x02, 0x06, 0x0A, 0x10, 0x11, 0x15, 0x16, 0x22,
+    0x1C, 0x0E, 0x0E, 0x13, 0x0D, 0x14, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x0F, 0x15, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x0D, 0x14, 0x10,
+    0x13, 0x08, 0x0F, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x0F, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x02, 0x03, 0x0D, 0x04, 0x0D, 0x0E,
+    0x11, 0x15, 0x19, 0x05, 0x11, 0x14, 0x0D, 0x0E, 0x06, 0x0E, 0x01, 0x0F, 0x13, 0x14, 0x06, 0x02, 0x10, 0x02, 0x06,
+    0x0A, 0x13, 0x02, 0x10, 0x22, 0x02, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0E, 0x10, 0x15, 0x22, 0x01, 0x14, 0x0D, 0x0E,
+    0x10, 0x15, 0x02, 0x0D, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x0F, 0x15, 0x1B, 0x16, 0x15, 0x0F, 0x0F, 0x11, 0x15,
+    0x22, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x0F, 0x08, 0x0F, 0x14, 0x15, 0x14, 0x1B, 0x04, 0x0D, 0x0F, 0x19, 0x0F, 0x15, 0x1B, 0x02,
+    0x08, 0x0D, 0x0F, 0x10, 0x14, 0x15, 0x15, 0x0F, 0x04, 0x0D, 0x0F, 0x13, 0x0F, 0x01, 0x0F, 0x13, 0x15, 0x0F, 0x14,
+    0x15, 0x14, 0x1B, 0x0D, 0x0E, 0x0F, 0x13, 0x0F, 0x15, 0x1B, 0x04, 0x07, 0x10, 0x15, 0x16, 0x15, 0x0F, 0x0F, 0x01,
+    0x13, 0x0F, 0x14, 0x15, 0x06, 0x14, 0x1B, 0x06, 0x15, 0x16, 0x22, 0x04, 0x05, 0x0A, 0x10, 0x22, 0x0F, 0x04, 0x06,
+    0x15, 0x14, 0x15, 0x0F, 0x15, 0x01, 0x02, 0x10, 0x15, 0x10, 0x0D, 0x0F, 0x13, 0x05, 0x0F, 0x13, 0x15, 0x04, 0x06,
+    0x13, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x0D, 0x13, 0x14, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x0A, 0x01, 0x06, 0x15,
+    0x06, 0x0A, 0x05, 0x0F, 0x13, 0x0F, 0x15, 0x1B, 0x0A, 0x15, 0x15, 0x0F, 0x02, 0x0F, 0x0E, 0x0F, 0x14, 0x15, 0x01,
+    0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x14, 0x1B, 0x01, 0x0D, 0x0F, 0x14, 0x0F, 0x15, 0x1B, 0x0D, 0x0E, 0x13, 0x16, 0x15, 0x0F, 0x0F, 0x03,
+    0x04, 0x02, 0x0F, 0x14, 0x15, 0x02, 0x06, 0x0A, 0x10, 0x14, 0x1B, 0x05, 0x11, 0x13, 0x0D, 0x0F, 0x15, 0x1B, 0x04,
+    0x0D, 0x13, 0x15, 0x15, 0x0F, 0x10, 0x0F, 0x11, 0x0F, 0x14, 0x15, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x14, 0x1B,
+    0x13, 0x01, 0x14, 0x1D, 0x15, 0x0A, 0x06, 0x04, 0x05, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x14, 0x0F, 0x15, 0x1B,
+    0x0F, 0x13, 0x15, 0x0F, 0x0D, 0x0F, 0x0F, 0x14, 0x15, 0x14, 0x1B, 0x0F, 0x15, 0x1B, 0x15, 0x0F, 0x0F, 0x0F, 0x14,
+    0x15, 0x14, 0x1B, 0x10, 0x03, 0x05, 0x0A, 0x0F, 0x10, 0x13, 0x14, 0x01, 0x05, 0x0A, 0x10, 0x13, 0x14, 0x01, 0x02,
+    0x03, 0x05, 0x0E, 0x14, 0x15, 0x01, 0x01, 0x0D, 0x0F, 0x14, 0x15, 0x13, 0x13, 0x02, 0x06, 0x0A, 0x15, 0x15, 0x02,
+    0x06, 0x10, 0x16, 0x22, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x0F, 0x10, 0x16, 0x22, 0x14, 0x16, 0x06, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0E, 0x0E, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x15,
+    0x16, 0x22, 0x0D, 0x0D, 0x10, 0x0F, 0x14, 0x06, 0x10, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x22, 0x03, 0x02, 0x03, 0x13,
+    0x0D, 0x02, 0x0A, 0x20, 0x01, 0x0A, 0x0F, 0x14, 0x0F, 0x10, 0x22, 0x10, 0x01, 0x14, 0x0F, 0x02, 0x06, 0x10, 0x06,
+    0x10, 0x01, 0x13, 0x14, 0x06, 0x10, 0x04, 0x10, 0x10, 0x02, 0x14, 0x13, 0x0D, 0x14, 0x10, 0x13, 0x0A, 0x0D, 0x06,
+    0x01, 0x04, 0x01, 0x0A, 0x0F, 0x14, 0x09, 0x01, 0x0A, 0x0E, 0x0F, 0x14, 0x02, 0x10, 0x02, 0x06, 0x10, 0x06, 0x10,
+    0x0F, 0x14, 0x06, 0x06, 0x1C, 0x1D, 0x1E, 0x01, 0x0A, 0x0F, 0x14, 0x06, 0x14, 0x0A, 0x15, 0x10, 0x14, 0x0D, 0x0F,
+    0x02, 0x06, 0x09, 0x0A, 0x0D, 0x10, 0x16, 0x22, 0x0F, 0x04, 0x02, 0x02, 0x10, 0x05, 0x02, 0x15, 0x0F, 0x06, 0x0D,
+    0x10, 0x11, 0x10, 0x04, 0x11, 0x15, 0x15, 0x0E, 0x0D, 0x10, 0x11, 0x0F, 0x05, 0x14, 0x10, 0x0F, 0x02, 0x14, 0x15,
+    0x0E, 0x02, 0x06, 0x0A, 0x10, 0x16, 0x22, 0x0D, 0x0A, 0x0D, 0x0A, 0x0F, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x10, 0x13, 0x02, 0x02, 0x06, 0x10, 0x06, 0x10, 0x10, 0x06, 0x0D, 0x04, 0x1D, 0x10, 0x10, 0x14, 0x10, 0x02, 0x06,
+    0x06, 0x10, 0x13, 0x01, 0x1C, 0x03, 0x05, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x0E, 0x10, 0x02, 0x06, 0x10, 0x06, 0x10,
+    0x14, 0x06, 0x06, 0x1C, 0x1D, 0x1E, 0x0D, 0x06, 0x10, 0x10, 0x10, 0x04, 0x08, 0x0D, 0x0E, 0x04, 0x08, 0x12, 0x08,
+    0x0B, 0x0D, 0x0E, 0x15, 0x03, 0x04, 0x06, 0x08, 0x0F, 0x11, 0x15, 0x10, 0x13, 0x03, 0x05, 0x1C, 0x1D, 0x1E, 0x20,
+    0x0F, 0x0A, 0x15, 0x13, 0x10, 0x0A, 0x10, 0x10, 0x10, 0x10, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10,
+    0x02, 0x06, 0x04, 0x02, 0x10, 0x07, 0x13, 0x0A, 0x0D, 0x10, 0x15, 0x0A, 0x02, 0x0A, 0x10, 0x02, 0x15, 0x06, 0x02,
+    0x13, 0x06, 0x10, 0x15, 0x10, 0x06, 0x10, 0x0D, 0x02, 0x02, 0x10, 0x06, 0x01, 0x13, 0x01, 0x14, 0x01, 0x0F, 0x14,
+    0x0D, 0x10, 0x15, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x1C, 0x01, 0x14, 0x16, 0x13, 0x06, 0x02, 0x06, 0x0A, 0x16, 0x22,
+    0x04, 0x16, 0x01, 0x14, 0x06, 0x13, 0x1E, 0x01, 0x02, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02,
+    0x0D, 0x10, 0x04, 0x07, 0x10, 0x10, 0x1C, 0x22, 0x13, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0E, 0x11, 0x12, 0x14,
+    0x15, 0x17, 0x15, 0x0A, 0x03, 0x02, 0x02, 0x15, 0x01, 0x10, 0x02, 0x13, 0x0A, 0x0A, 0x0A, 0x10, 0x07, 0x10, 0x15,
+    0x10, 0x10, 0x04, 0x13, 0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x0E, 0x15, 0x13, 0x02, 0x10, 0x20,
+    0x02, 0x10, 0x02, 0x06, 0x08, 0x08, 0x20, 0x0A, 0x10, 0x14, 0x10, 0x01, 0x10, 0x0A, 0x10, 0x01, 0x0E, 0x14, 0x01,
+    0x14, 0x06, 0x01, 0x14, 0x06, 0x15, 0x02, 0x10, 0x15, 0x02, 0x06, 0x11, 0x02, 0x10, 0x1B, 0x10, 0x0F, 0x13, 0x0A,
+    0x15, 0x06, 0x0A, 0x10, 0x15, 0x0E, 0x15, 0x04, 0x12, 0x13, 0x02, 0x10, 0x15, 0x0E, 0x13, 0x0A, 0x04, 0x02, 0x06,
+    0x10, 0x22, 0x0F, 0x06, 0x13, 0x0F, 0x10, 0x17, 0x04, 0x01, 0x06, 0x0A, 0x17, 0x05, 0x13, 0x0A, 0x0F, 0x0D, 0x01,
+    0x14, 0x0D, 0x13, 0x02, 0x06, 0x13, 0x02, 0x0E, 0x0F, 0x06, 0x02, 0x0E, 0x02, 0x13, 0x04, 0x12, 0x10, 0x0F, 0x14,
+    0x11, 0x03, 0x04, 0x04, 0x13, 0x17, 0x13, 0x06, 0x06, 0x09, 0x10, 0x10, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x02, 0x0E, 0x0F, 0x14, 0x15, 0x14, 0x05, 0x14, 0x02, 0x06, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x01, 0x06, 0x0E,
+    0x0F, 0x13, 0x14, 0x15, 0x14, 0x14, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x01, 0x0A, 0x0E, 0x0F, 0x14, 0x0D, 0x02, 0x10,
+    0x10, 0x0E, 0x15, 0x06, 0x10, 0x01, 0x15, 0x0A, 0x06, 0x10, 0x06, 0x0D, 0x0E, 0x11, 0x14, 0x06, 0x0A, 0x10, 0x0F,
+    0x16, 0x0F, 0x19, 0x0F, 0x20, 0x15, 0x04, 0x08, 0x0D, 0x11, 0x13, 0x16, 0x19, 0x05, 0x07, 0x15, 0x19, 0x06, 0x0A,
+    0x0E, 0x15, 0x16, 0x0C, 0x11, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15,
+    0x04, 0x04, 0x0B, 0x0E, 0x13, 0x0E, 0x06, 0x0B, 0x0E, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x0A, 0x10, 0x16, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x06, 0x06, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0D, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15,
+    0x07, 0x0D, 0x0F, 0x12, 0x17, 0x19, 0x04, 0x08, 0x0F, 0x03, 0x04, 0x07, 0x11, 0x06, 0x15, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x02, 0x06, 0x0A, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x22, 0x15, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x0B, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x14, 0x1B, 0x0E, 0x0F, 0x17, 0x03, 0x04, 0x0B, 0x13, 0x03, 0x0E, 0x0F, 0x14,
+    0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x06, 0x14, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16, 0x22, 0x06, 0x10, 0x06,
+    0x14, 0x22, 0x14, 0x01, 0x01, 0x15, 0x0F, 0x20, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x10, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x02, 0x06, 0x01, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0F, 0x01, 0x0A, 0x0A, 0x01, 0x10,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x14, 0x01, 0x01,
+    0x0A, 0x14, 0x10, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x0F, 0x14, 0x01, 0x0A, 0x14, 0x02, 0x14, 0x14, 0x01, 0x01, 0x01, 0x0A, 0x14, 0x01, 0x10, 0x13,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x0A, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0D, 0x0E, 0x11, 0x12,
+    0x14, 0x15, 0x17, 0x1B, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x22, 0x02, 0x14, 0x0A, 0x0D, 0x0A, 0x09, 0x10, 0x13,
+    0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15, 0x13, 0x10, 0x15, 0x13, 0x02, 0x10, 0x10, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x15, 0x10, 0x13, 0x0A, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15, 0x10, 0x02,
+    0x10, 0x03, 0x04, 0x07, 0x08, 0x09, 0x0D, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x1A, 0x1B, 0x02, 0x04, 0x05, 0x0E, 0x0F,
+    0x10, 0x12, 0x13, 0x14, 0x22, 0x05, 0x06, 0x08, 0x0D, 0x0E, 0x0F, 0x14, 0x03, 0x04, 0x05, 0x0D, 0x0F, 0x11, 0x13,
+    0x14, 0x17, 0x19, 0x1A, 0x03, 0x05, 0x06, 0x0F, 0x13, 0x14, 0x22, 0x1C, 0x1D, 0x20, 0x06, 0x22, 0x02, 0x10, 0x02,
+    0x06, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x15, 0x14, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x02, 0x15, 0x04, 0x04, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x03, 0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x06, 0x02, 0x0D,
+    0x01, 0x02, 0x10, 0x10, 0x01, 0x02, 0x06, 0x10, 0x22, 0x01, 0x06, 0x15, 0x06, 0x10, 0x13, 0x01, 0x14, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x03, 0x0A, 0x0F, 0x13, 0x14, 0x01, 0x0A, 0x14, 0x02, 0x14, 0x06,
+    0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x06, 0x06, 0x16, 0x0A, 0x13, 0x22, 0x16, 0x06, 0x0A, 0x22, 0x02, 0x10, 0x22, 0x02, 0x0A, 0x02,
+    0x06, 0x0A, 0x10, 0x22, 0x10, 0x0A, 0x13, 0x14, 0x02, 0x22, 0x06, 0x0D, 0x0A, 0x22, 0x0D, 0x02, 0x06, 0x02, 0x0E,
+    0x13, 0x08, 0x08, 0x0B, 0x0D, 0x0E, 0x15, 0x05, 0x0D, 0x10, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10,
+    0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x06, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0F, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x16, 0x22, 0x04, 0x10, 0x0D, 0x01, 0x14, 0x02, 0x10, 0x22, 0x05, 0x06, 0x02, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x10, 0x04, 0x10, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x15, 0x02, 0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x13, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x02, 0x10, 0x0F, 0x01, 0x14, 0x01, 0x14, 0x14, 0x10, 0x01, 0x10, 0x01, 0x01, 0x06, 0x01, 0x14, 0x0A, 0x10, 0x01,
+    0x0A, 0x0E, 0x14, 0x01, 0x14, 0x02, 0x0F, 0x0D, 0x13, 0x14, 0x03, 0x06, 0x22, 0x0E, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x0A, 0x0F, 0x01, 0x13, 0x02, 0x04, 0x0E, 0x1C, 0x01, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x14, 0x10, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x13, 0x1E, 0x10, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0D, 0x02, 0x06, 0x09, 0x0A,
+    0x0D, 0x10, 0x16, 0x22, 0x0F, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x10, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x10, 0x10, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10,
+    0x06, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x14, 0x01,
+    0x14, 0x0D, 0x01, 0x02, 0x14, 0x10, 0x22, 0x08, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x06, 0x01, 0x01, 0x10, 0x01, 0x10, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10,
+    0x16, 0x22, 0x02, 0x0F, 0x0E, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x04, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02,
+    0x0D, 0x14, 0x0E, 0x0F, 0x11, 0x02, 0x14, 0x11, 0x10, 0x10, 0x10, 0x06, 0x0A, 0x10, 0x10, 0x10, 0x1C, 0x1D, 0x1E,
+    0x0A, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02,
+    0x15, 0x0F, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x10, 0x06, 0x10, 0x10, 0x01, 0x06, 0x01, 0x0D, 0x01,
+    0x02, 0x06, 0x0E, 0x13, 0x02, 0x0E, 0x10, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x10, 0x01, 0x14, 0x02, 0x10, 0x16, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x14, 0x02, 0x06,
+    0x10, 0x10, 0x10, 0x09, 0x0F, 0x02, 0x06, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x0E, 0x06, 0x10, 0x06, 0x06, 0x01, 0x10, 0x0D, 0x0E, 0x0E, 0x06, 0x10, 0x14, 0x06, 0x06,
+    0x0E, 0x06, 0x10, 0x0A, 0x06, 0x06, 0x01, 0x0D, 0x06, 0x10, 0x14, 0x06, 0x06, 0x14, 0x10, 0x01, 0x01, 0x06, 0x01,
+    0x14, 0x01, 0x14, 0x14, 0x10, 0x02, 0x06, 0x0A, 0x14, 0x08, 0x06, 0x04, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x13, 0x04, 0x0F, 0x0A, 0x10, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10,
+    0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x16, 0x13, 0x02, 0x06, 0x0A, 0x10, 0x19, 0x06, 0x13, 0x06,
+    0x16, 0x06, 0x0A, 0x22, 0x13, 0x15, 0x0A, 0x0A, 0x16, 0x0A, 0x22, 0x0A, 0x04, 0x13, 0x14, 0x15, 0x03, 0x11, 0x10,
+    0x13, 0x0A, 0x06, 0x15, 0x22, 0x05, 0x08, 0x11, 0x0E, 0x0F, 0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0A, 0x06, 0x06,
+    0x22, 0x10, 0x22, 0x03, 0x0A, 0x22, 0x14, 0x02, 0x06, 0x10, 0x22, 0x06, 0x0B, 0x0D, 0x16, 0x03, 0x13, 0x0E, 0x1C,
+    0x1E, 0x20, 0x21, 0x06, 0x02, 0x10, 0x02, 0x10, 0x06, 0x02, 0x10, 0x06, 0x16, 0x0A, 0x22, 0x10, 0x02, 0x0A, 0x02,
+    0x06, 0x0D, 0x13, 0x0E, 0x13, 0x0A, 0x06, 0x0A, 0x06, 0x16, 0x02, 0x04, 0x16, 0x0A, 0x02, 0x09, 0x16, 0x16, 0x14,
+    0x06, 0x16, 0x06, 0x10, 0x13, 0x0A, 0x0F, 0x05, 0x15, 0x04, 0x06, 0x0F, 0x05, 0x14, 0x0F, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x07, 0x0E, 0x13, 0x16, 0x06, 0x0A, 0x14, 0x1C, 0x20, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x13, 0x16, 0x22, 0x04, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x03, 0x15, 0x0A, 0x22, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x0A, 0x13, 0x14, 0x10, 0x16, 0x22, 0x0E, 0x08, 0x0A, 0x22, 0x13, 0x16, 0x22, 0x06, 0x0A, 0x10,
+    0x12, 0x22, 0x02, 0x06, 0x10, 0x22, 0x0A, 0x22, 0x02, 0x13, 0x16, 0x22, 0x02, 0x04, 0x07, 0x08, 0x0A, 0x10, 0x14,
+    0x15, 0x17, 0x0A, 0x08, 0x0A, 0x0A, 0x22, 0x02, 0x22, 0x0A, 0x15, 0x22, 0x02, 0x22, 0x0A, 0x03, 0x0E, 0x0F, 0x04,
+    0x07, 0x0D, 0x13, 0x14, 0x15, 0x0B, 0x0D, 0x0E, 0x0F, 0x14, 0x05, 0x06, 0x0D, 0x0E, 0x0F, 0x13, 0x22, 0x04, 0x07,
+    0x13, 0x02, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x14, 0x06, 0x0A, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x20, 0x01, 0x06, 0x06, 0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x14, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x01, 0x04, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x01,
+    0x0A, 0x0E, 0x0F, 0x14, 0x01, 0x01, 0x14, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x01, 0x14, 0x10, 0x02, 0x10, 0x08, 0x1E, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x10, 0x10,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10,
+    0x13, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x0E, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x16, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x13, 0x0E, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x13, 0x13, 0x0A, 0x22, 0x16, 0x16, 0x02, 0x0A, 0x08, 0x13, 0x13,
+    0x02, 0x06, 0x15, 0x06, 0x16, 0x10, 0x22, 0x03, 0x05, 0x0E, 0x0F, 0x13, 0x14, 0x02, 0x09, 0x10, 0x22, 0x0A, 0x16,
+    0x06, 0x11, 0x22, 0x07, 0x16, 0x04, 0x15, 0x04, 0x11, 0x15, 0x1C, 0x06, 0x0A, 0x13, 0x0F, 0x16, 0x16, 0x02, 0x11,
+    0x04, 0x06, 0x07, 0x09, 0x14, 0x15, 0x17, 0x15, 0x06, 0x0D, 0x14, 0x02, 0x16, 0x22, 0x10, 0x02, 0x06, 0x0D, 0x10,
+    0x22, 0x04, 0x13, 0x05, 0x06, 0x08, 0x0A, 0x0F, 0x15, 0x06, 0x02, 0x0A, 0x22, 0x0A, 0x06, 0x22, 0x0A, 0x14, 0x02,
+    0x0D, 0x02, 0x06, 0x0A, 0x10, 0x22, 0x03, 0x15, 0x1F, 0x09, 0x0D, 0x04, 0x13, 0x0D, 0x13, 0x04, 0x1D, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x0F, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x13, 0x15, 0x02, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x01, 0x0A, 0x0F, 0x14, 0x06, 0x01, 0x14, 0x01, 0x13, 0x14, 0x14, 0x01, 0x0A, 0x0F, 0x14, 0x01, 0x0A, 0x0E, 0x0F,
+    0x14, 0x0F, 0x1C, 0x1D, 0x1E, 0x01, 0x0A, 0x0F, 0x14, 0x06, 0x14, 0x14, 0x01, 0x02, 0x06, 0x0A, 0x0E, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x14, 0x01, 0x02, 0x06, 0x01, 0x06, 0x14, 0x01, 0x01, 0x0A, 0x0E, 0x0F, 0x14, 0x01, 0x13, 0x06,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x13, 0x0E, 0x0F,
+    0x1D, 0x0A, 0x1E, 0x1C, 0x13, 0x02, 0x06, 0x10, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x14, 0x22, 0x0A, 0x12, 0x0E, 0x1C,
+    0x13, 0x02, 0x04, 0x12, 0x14, 0x1D, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x13, 0x04, 0x13, 0x15, 0x06,
+    0x0A, 0x06, 0x06, 0x02, 0x10, 0x0A, 0x02, 0x06, 0x0A, 0x10, 0x0A, 0x10, 0x0A, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x13, 0x10, 0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01,
+    0x06, 0x01, 0x01, 0x14, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x14, 0x16, 0x22, 0x1E, 0x02, 0x0F, 0x0F, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10,
+    0x0D, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13,
+    0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x14, 0x01, 0x14, 0x02, 0x10, 0x01,
+    0x01, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x14, 0x01, 0x14,
+    0x14, 0x14, 0x10, 0x01, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A, 0x06, 0x0A, 0x15, 0x14, 0x1D, 0x0D,
+    0x14, 0x03, 0x14, 0x0E, 0x02, 0x06, 0x22, 0x10, 0x06, 0x0A, 0x13, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x0A, 0x0A, 0x10, 0x0E, 0x01, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x06, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x06, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x13, 0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10,
+    0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x01, 0x06, 0x01, 0x14, 0x01, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1E, 0x0A, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x11, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0F, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x14, 0x0D, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x15, 0x0A, 0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x15, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x0F, 0x13, 0x0E, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x06, 0x15, 0x11, 0x05, 0x06, 0x01, 0x14, 0x15, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x04, 0x1E, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x14,
+    0x02, 0x10, 0x22, 0x01, 0x14, 0x14, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x02, 0x06,
+    0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x03, 0x0D,
+    0x0F, 0x15, 0x13, 0x04, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x0D, 0x14,
+    0x0D, 0x0D, 0x0D, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x02, 0x06, 0x10, 0x10, 0x10, 0x0D, 0x14, 0x0D, 0x0D, 0x0D, 0x10,
+    0x0D, 0x14, 0x04, 0x0D, 0x0D, 0x02, 0x06, 0x10, 0x0D, 0x14, 0x0D, 0x0D, 0x0D, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01,
+    0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x0A, 0x14, 0x04, 0x01, 0x02, 0x10, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x10, 0x10, 0x0A, 0x08, 0x20, 0x0B, 0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x02, 0x0F, 0x11, 0x17, 0x14, 0x0F, 0x0D, 0x13, 0x06, 0x0F, 0x0D, 0x14, 0x04, 0x20, 0x06, 0x10, 0x02,
+    0x04, 0x15, 0x04, 0x04, 0x1C, 0x14, 0x09, 0x06, 0x0A, 0x10, 0x16, 0x03, 0x13, 0x1D, 0x06, 0x0A, 0x22, 0x16, 0x15,
+    0x15, 0x10, 0x0A, 0x0F, 0x1D, 0x13, 0x20, 0x14, 0x1E, 0x15, 0x13, 0x1C, 0x1D, 0x20, 0x13, 0x14, 0x15, 0x0D, 0x03,
+    0x13, 0x0E, 0x13, 0x13, 0x0F, 0x11, 0x11, 0x11, 0x04, 0x02, 0x06, 0x1C, 0x17, 0x0D, 0x04, 0x0E, 0x08, 0x0D, 0x02,
+    0x0A, 0x06, 0x22, 0x16, 0x14, 0x0F, 0x04, 0x08, 0x05, 0x13, 0x10, 0x0A, 0x22, 0x15, 0x04, 0x02, 0x02, 0x10, 0x02,
+    0x06, 0x0F, 0x02, 0x0D, 0x10, 0x0F, 0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x13, 0x16, 0x22, 0x0D, 0x0A, 0x0A, 0x0A,
+    0x10, 0x05, 0x16, 0x15, 0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x06, 0x02, 0x22, 0x13, 0x0D, 0x14, 0x0D, 0x13,
+    0x11, 0x04, 0x0B, 0x13, 0x02, 0x0D, 0x0E, 0x10, 0x13, 0x15, 0x04, 0x08, 0x0D, 0x0E, 0x0F, 0x14, 0x1B, 0x11, 0x13,
+    0x06, 0x10, 0x0D, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x16, 0x22, 0x05, 0x0E, 0x10, 0x02, 0x03, 0x1E, 0x06, 0x10,
+    0x22, 0x0F, 0x22, 0x21, 0x0A, 0x22, 0x13, 0x1E, 0x02, 0x16, 0x22, 0x14, 0x21, 0x08, 0x0E, 0x14, 0x1B, 0x0B, 0x1D,
+    0x1E, 0x20, 0x1C, 0x1D, 0x20, 0x0E, 0x1E, 0x13, 0x06, 0x22, 0x0E, 0x21, 0x04, 0x0F, 0x02, 0x06, 0x04, 0x12, 0x1E,
+    0x15, 0x1C, 0x02, 0x05, 0x06, 0x07, 0x0E, 0x13, 0x14, 0x22, 0x1C, 0x1E, 0x13, 0x1C, 0x0D, 0x13, 0x02, 0x06, 0x10,
+    0x15, 0x06, 0x16, 0x0D, 0x04, 0x0A, 0x15, 0x13, 0x15, 0x22, 0x06, 0x06, 0x11, 0x15, 0x11, 0x15, 0x02, 0x10, 0x22,
+    0x0F, 0x13, 0x14, 0x0D, 0x0A, 0x14, 0x15, 0x1D, 0x04, 0x0A, 0x05, 0x1A, 0x03, 0x13, 0x14, 0x0E, 0x0F, 0x13, 0x15,
+    0x14, 0x0E, 0x03, 0x0D, 0x08, 0x06, 0x22, 0x05, 0x0F, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x19, 0x14, 0x01, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x01, 0x01, 0x0F, 0x02, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x14, 0x10, 0x01, 0x01, 0x01, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x01, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x14, 0x01, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16,
+    0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x03, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0A, 0x0A,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x0A, 0x02, 0x02, 0x22, 0x1E, 0x02, 0x0A,
+    0x04, 0x0F, 0x17, 0x06, 0x13, 0x06, 0x10, 0x13, 0x14, 0x0F, 0x0F, 0x20, 0x03, 0x05, 0x0E, 0x0F, 0x13, 0x14, 0x02,
+    0x06, 0x10, 0x22, 0x1C, 0x20, 0x07, 0x04, 0x12, 0x0B, 0x06, 0x22, 0x1D, 0x13, 0x06, 0x22, 0x0A, 0x10, 0x02, 0x06,
+    0x0A, 0x16, 0x02, 0x0A, 0x13, 0x03, 0x05, 0x0E, 0x0F, 0x13, 0x14, 0x10, 0x13, 0x02, 0x10, 0x15, 0x02, 0x22, 0x14,
+    0x08, 0x0F, 0x10, 0x13, 0x06, 0x0D, 0x10, 0x13, 0x0F, 0x02, 0x06, 0x0D, 0x10, 0x0A, 0x06, 0x15, 0x06, 0x10, 0x16,
+    0x06, 0x06, 0x05, 0x0A, 0x15, 0x14, 0x11, 0x21, 0x13, 0x04, 0x05, 0x1C, 0x1D, 0x20, 0x06, 0x0A, 0x06, 0x0B, 0x02,
+    0x06, 0x0D, 0x02, 0x0A, 0x08, 0x1C, 0x1D, 0x1D, 0x04, 0x12, 0x15, 0x0F, 0x13, 0x14, 0x0D, 0x0F, 0x14, 0x05, 0x06,
+    0x0E, 0x13, 0x22, 0x1C, 0x1E, 0x02, 0x02, 0x02, 0x22, 0x16, 0x02, 0x09, 0x15, 0x02, 0x05, 0x04, 0x01, 0x01, 0x15,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x13, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x14, 0x01, 0x01, 0x01, 0x0E, 0x14, 0x01, 0x01, 0x02, 0x06, 0x01, 0x01, 0x14, 0x01,
+    0x01, 0x14, 0x10, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x14, 0x01, 0x0A, 0x14, 0x02, 0x14, 0x14, 0x01, 0x01, 0x01, 0x0A,
+    0x14, 0x01, 0x01, 0x01, 0x14, 0x14, 0x05, 0x06, 0x0E, 0x01, 0x0E, 0x0E, 0x0E, 0x01, 0x14, 0x10, 0x01, 0x01, 0x10,
+    0x10, 0x03, 0x15, 0x02, 0x1C, 0x1D, 0x20, 0x20, 0x0F, 0x0A, 0x0E, 0x0F, 0x0E, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x0F, 0x02, 0x06, 0x10, 0x02, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x10, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x14, 0x01, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22,
+    0x15, 0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x04, 0x0F, 0x19, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x10, 0x14, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x06,
+    0x0F, 0x15, 0x14, 0x15, 0x11, 0x1C, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x14, 0x0E, 0x0F, 0x10, 0x06, 0x1D,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x14, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x16,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x14, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x04, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x22,
+    0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0F, 0x01, 0x06, 0x02, 0x14, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x06, 0x02, 0x05, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x05, 0x15, 0x04, 0x12,
+    0x0A, 0x13, 0x14, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x04, 0x13, 0x13, 0x13, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A,
+    0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0A,
+    0x04, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09,
+    0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x14, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x14, 0x0F, 0x20, 0x01, 0x01, 0x13,
+    0x13, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x04, 0x0E, 0x0F, 0x15, 0x19,
+    0x22, 0x03, 0x04, 0x05, 0x08, 0x0B, 0x0D, 0x14, 0x15, 0x04, 0x13, 0x03, 0x13, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x16, 0x04, 0x11, 0x15, 0x05, 0x15, 0x0D, 0x02, 0x10, 0x06, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20,
+    0x21, 0x04, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x14, 0x02, 0x06, 0x10, 0x0D, 0x02,
+    0x06, 0x10, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x06, 0x10, 0x14, 0x06, 0x06, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14,
+    0x14, 0x14, 0x02, 0x06, 0x10, 0x0D, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x14, 0x02, 0x06, 0x10,
+    0x0D, 0x02, 0x10, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x02, 0x06, 0x10, 0x0D,
+    0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x02, 0x10, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x09, 0x10, 0x13, 0x06, 0x06, 0x0D, 0x05, 0x02, 0x06, 0x15, 0x15, 0x0A, 0x06, 0x04, 0x14,
+    0x0F, 0x0D, 0x0A, 0x0F, 0x15, 0x13, 0x0F, 0x0F, 0x1E, 0x0D, 0x06, 0x04, 0x15, 0x0F, 0x13, 0x15, 0x14, 0x02, 0x06,
+    0x22, 0x15, 0x04, 0x05, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0F, 0x0F, 0x0E, 0x0A, 0x0A, 0x02, 0x1B, 0x04, 0x04, 0x09,
+    0x0F, 0x20, 0x08, 0x15, 0x15, 0x0A, 0x0A, 0x13, 0x0F, 0x05, 0x1E, 0x15, 0x0D, 0x13, 0x04, 0x15, 0x02, 0x06, 0x15,
+    0x22, 0x14, 0x15, 0x14, 0x10, 0x16, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x0A, 0x0E, 0x15, 0x0D, 0x0F, 0x14, 0x02, 0x0A,
+    0x13, 0x03, 0x1C, 0x10, 0x11, 0x02, 0x22, 0x02, 0x15, 0x0A, 0x06, 0x13, 0x06, 0x02, 0x06, 0x0A, 0x08, 0x0A, 0x22,
+    0x02, 0x06, 0x10, 0x02, 0x06, 0x0D, 0x10, 0x22, 0x11, 0x05, 0x06, 0x16, 0x0E, 0x15, 0x02, 0x10, 0x06, 0x06, 0x17,
+    0x0E, 0x02, 0x06, 0x10, 0x22, 0x02, 0x06, 0x0F, 0x0F, 0x11, 0x21, 0x0A, 0x22, 0x03, 0x13, 0x13, 0x02, 0x06, 0x0A,
+    0x22, 0x03, 0x13, 0x13, 0x20, 0x05, 0x1F, 0x22, 0x14, 0x15, 0x1E, 0x0E, 0x13, 0x17, 0x11, 0x1C, 0x15, 0x14, 0x13,
+    0x0E, 0x15, 0x02, 0x22, 0x08, 0x1B, 0x0B, 0x0E, 0x06, 0x0F, 0x15, 0x1D, 0x1E, 0x0E, 0x05, 0x0F, 0x02, 0x10, 0x22,
+    0x04, 0x12, 0x0A, 0x15, 0x1D, 0x20, 0x13, 0x13, 0x0A, 0x22, 0x13, 0x11, 0x15, 0x22, 0x16, 0x02, 0x0E, 0x06, 0x02,
+    0x06, 0x10, 0x22, 0x20, 0x04, 0x0E, 0x0D, 0x06, 0x06, 0x02, 0x0A, 0x13, 0x22, 0x13, 0x20, 0x06, 0x11, 0x06, 0x0F,
+    0x0A, 0x04, 0x0A, 0x22, 0x02, 0x15, 0x15, 0x0A, 0x05, 0x11, 0x0B, 0x22, 0x08, 0x1F, 0x02, 0x06, 0x10, 0x22, 0x15,
+    0x01, 0x02, 0x0F, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x1E, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x13, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x04, 0x06, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x05,
+    0x0D, 0x1C, 0x1D, 0x20, 0x02, 0x06, 0x10, 0x14, 0x0A, 0x0A, 0x22, 0x0D, 0x0F, 0x0D, 0x0F, 0x1C, 0x1D, 0x20, 0x03,
+    0x05, 0x0E, 0x0F, 0x13, 0x14, 0x02, 0x06, 0x10, 0x22, 0x22, 0x1D, 0x0B, 0x06, 0x22, 0x1D, 0x0E, 0x13, 0x0F, 0x0E,
+    0x03, 0x04, 0x0D, 0x0E, 0x06, 0x16, 0x0D, 0x0D, 0x1C, 0x0A, 0x0A, 0x0F, 0x06, 0x0F, 0x0A, 0x13, 0x16, 0x04, 0x15,
+    0x13, 0x04, 0x02, 0x13, 0x03, 0x04, 0x02, 0x08, 0x13, 0x19, 0x03, 0x13, 0x0F, 0x06, 0x0A, 0x08, 0x13, 0x11, 0x0E,
+    0x0F, 0x0F, 0x0D, 0x0E, 0x0B, 0x02, 0x0F, 0x13, 0x14, 0x1D, 0x20, 0x02, 0x0F, 0x0F, 0x1C, 0x04, 0x02, 0x06, 0x06,
+    0x10, 0x0A, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x06, 0x01, 0x01, 0x14, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x14,
+    0x01, 0x01, 0x0A, 0x0E, 0x0F, 0x14, 0x01, 0x01, 0x14, 0x01, 0x01, 0x01, 0x02, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x01,
+    0x14, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x0A, 0x0A, 0x13, 0x02,
+    0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x09, 0x0A, 0x10, 0x16, 0x22, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x06, 0x06, 0x1C, 0x1D, 0x1E, 0x20, 0x21,
+    0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x22, 0x0A,
+    0x22, 0x0A, 0x0F, 0x10, 0x14, 0x06, 0x0D, 0x0E, 0x15, 0x13, 0x15, 0x15, 0x0A, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02,
+    0x01, 0x05, 0x14, 0x13, 0x08, 0x14, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D,
+    0x1E, 0x20, 0x21, 0x13, 0x01, 0x01, 0x14, 0x02, 0x10, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1E, 0x06, 0x22, 0x15, 0x10,
+    0x13, 0x13, 0x06, 0x02, 0x06, 0x12, 0x15, 0x10, 0x15, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x02, 0x06, 0x22, 0x0A, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x02, 0x01, 0x06, 0x0F, 0x0A, 0x13, 0x13, 0x17, 0x0A, 0x04, 0x15, 0x0A, 0x05, 0x0D, 0x16,
+    0x21, 0x06, 0x0A, 0x02, 0x10, 0x06, 0x0A, 0x22, 0x02, 0x10, 0x22, 0x17, 0x15, 0x02, 0x06, 0x0A, 0x10, 0x22, 0x06,
+    0x02, 0x14, 0x15, 0x06, 0x10, 0x02, 0x0A, 0x06, 0x22, 0x01, 0x14, 0x01, 0x14, 0x22, 0x0A, 0x01, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x0D, 0x14, 0x01, 0x01, 0x0D, 0x0E, 0x0F, 0x01, 0x0D, 0x0E, 0x0F, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x02,
+    0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x14,
+    0x06, 0x15, 0x05, 0x15, 0x0F, 0x13, 0x09, 0x15, 0x1C, 0x15, 0x03, 0x03, 0x1B, 0x03, 0x0A, 0x06, 0x14, 0x0F, 0x15,
+    0x17, 0x02, 0x1C, 0x02, 0x06, 0x10, 0x22, 0x08, 0x0E, 0x11, 0x1B, 0x0F, 0x0A, 0x03, 0x11, 0x0E, 0x1C, 0x03, 0x0A,
+    0x04, 0x13, 0x14, 0x1E, 0x13, 0x10, 0x1C, 0x1D, 0x20, 0x13, 0x05, 0x02, 0x14, 0x1C, 0x1D, 0x20, 0x10, 0x0A, 0x11,
+    0x0F, 0x1E, 0x16, 0x15, 0x13, 0x1C, 0x1E, 0x02, 0x10, 0x15, 0x13, 0x0A, 0x1F, 0x15, 0x0E, 0x17, 0x15, 0x1C, 0x13,
+    0x02, 0x04, 0x05, 0x0F, 0x06, 0x15, 0x1C, 0x20, 0x02, 0x0A, 0x1B, 0x1E, 0x02, 0x04, 0x1C, 0x06, 0x0A, 0x06, 0x13,
+    0x1C, 0x0E, 0x16, 0x06, 0x06, 0x0F, 0x04, 0x04, 0x0E, 0x16, 0x1E, 0x0F, 0x0F, 0x0F, 0x11, 0x0A, 0x0F, 0x1E, 0x0A,
+    0x02, 0x22, 0x20, 0x1C, 0x1D, 0x20, 0x02, 0x06, 0x10, 0x22, 0x05, 0x01, 0x02, 0x06, 0x10, 0x0F, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x0A, 0x04, 0x1B, 0x1E, 0x14, 0x0D, 0x1C, 0x1D, 0x20, 0x1F, 0x22, 0x02, 0x06, 0x10, 0x0F, 0x1D, 0x03,
+    0x02, 0x0A, 0x0A, 0x0A, 0x14, 0x04, 0x0D, 0x10, 0x22, 0x0F, 0x14, 0x15, 0x0F, 0x11, 0x14, 0x15, 0x0E, 0x0E, 0x15,
+    0x0D, 0x13, 0x04, 0x1B, 0x06, 0x0A, 0x15, 0x0F, 0x02, 0x0F, 0x13, 0x14, 0x0A, 0x0A, 0x02, 0x0F, 0x01, 0x01, 0x01,
+    0x01, 0x14, 0x10, 0x01, 0x01, 0x01, 0x05, 0x15, 0x14, 0x14, 0x14, 0x14, 0x01, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C,
+    0x1D, 0x1E, 0x20, 0x21, 0x0A, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x1C, 0x1D, 0x1E, 0x20, 0x21, 0x01, 0x01, 0x1E, 0x0E,
+    0x1E, 0x02, 0x0A, 0x14, 0x01, 0x0D, 0x0D, 0x02, 0x06, 0x10, 0x06, 0x06, 0x15, 0x13, 0x15, 0x16, 0x0F, 0x01, 0x01,
+    0x0E, 0x14, 0x01, 0x14, 0x02, 0x01, 0x1F, 0x02, 0x02, 0x06, 0x1C, 0x02, 0x14, 0x14, 0x01, 0x04, 0x0A, 0x04, 0x0A,
+    0x0A, 0x0F, 0x0F, 0x13, 0x10, 0x22, 0x01, 0x14, 0x01, 0x14, 0x1E, 0x1C, 0x02, 0x10, 0x17, 0x13, 0x1C, 0x1D, 0x20,
+    0x04, 0x15, 0x0D, 0x03, 0x13, 0x0F, 0x02, 0x1C, 0x01, 0x01, 0x1C, 0x05, 0x15, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06, 0x10, 0x01, 0x02, 0x06, 0x10,
+    0x06, 0x10, 0x02, 0x06, 0x10, 0x06, 0x10, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x0F, 0x03, 0x1C, 0x1D, 0x20, 0x11, 0x04, 0x15, 0x15, 0x1B, 0x0E, 0x02, 0x10,
+    0x10, 0x0F, 0x0D, 0x04, 0x05, 0x15, 0x1B, 0x05, 0x15, 0x0F, 0x0A, 0x15, 0x0F, 0x04, 0x0E, 0x05, 0x0A, 0x0F, 0x04,
+    0x1D, 0x20, 0x15, 0x1C, 0x1D, 0x20, 0x02, 0x15, 0x04, 0x1B, 0x04, 0x1B, 0x0A, 0x1F, 0x0F, 0x13, 0x04, 0x0F, 0x0D,
+    0x0F, 0x0F, 0x20, 0x15, 0x0F, 0x0D, 0x15, 0x14, 0x01, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x0A, 0x0E, 0x0E,
+    0x01, 0x0D, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x0D, 0x01, 0x0D, 0x10,
+    0x06, 0x01, 0x01, 0x01, 0x02, 0x15, 0x02, 0x17, 0x02, 0x0A, 0x0F, 0x20, 0x01, 0x01, 0x0F, 0x0A, 0x0A, 0x0F, 0x0F,
+    0x01, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14, 0x15, 0x04, 0x06,
+    0x15, 0x17, 0x1B, 0x0F, 0x06, 0x01, 0x14, 0x01, 0x06, 0x0A, 0x10, 0x02, 0x06, 0x10, 0x01, 0x14, 0x01, 0x14, 0x01,
+    0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x02, 0x06, 0x10, 0x02, 0x06, 0x10, 0x0F, 0x0F, 0x01,
+    0x14, 0x0F, 0x14, 0x02, 0x0F, 0x15, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x06,
+    0x10, 0x22, 0x0F, 0x01, 0x01, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x14,
+    0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01, 0x14, 0x15, 0x01, 0x0F, 0x1C, 0x1D, 0x20, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x01,
+};
+
+constexpr uint16_t es_child_base[] = {
+    1, 189, 375, 543, 647, 654, 665, 668, 689, 716, 725, 773, 776, 786, 844, 876,
+    881, 889, 917, 930, 959, 971, 998, 1023, 1025, 1029, 1077, 1078, 1086, 1091, 1093, 1104,
+    1124, 1124, 1124, 1124, 1147, 1169, 1174, 1202, 1208, 1215, 1228, 1238, 1242, 1252, 1258, 1261,
+    1275, 1286, 1293, 1346, 1349, 1349, 1349, 1354, 1361, 1389, 1391, 1404, 1411, 1420, 1429, 1432,
+    1464, 1470, 1472, 1516, 1516, 1517, 1517, 1517, 1525, 1529, 1531, 1536, 1542, 1542, 1542, 1543,
+    1569, 1592, 1620, 1635, 1646, 1659, 1666, 1674, 1691, 1704, 1708, 1719, 1719, 1719, 1719, 1719,
+    1719, 1720, 1726, 1726, 1726, 1726, 1730, 1731, 1731, 1734, 1738, 1740, 1741, 1741, 1745, 1755,
+    1756, 1756, 1756, 1759, 1775, 1783, 1791, 1806, 1815, 1839, 1850, 1850, 1850, 1852, 1852, 1852,
+    1853, 1864, 1864, 1865, 1868, 1868, 1868, 1872, 1884, 1893, 1904, 1919, 1929, 1940, 1940, 1940,
+    1940, 1940, 1940, 1942, 1945, 1945, 1945, 1946, 1962, 1968, 1974, 1977, 1988, 1991, 1994, 2004,
+    2013, 2023, 2031, 2031, 2032, 2034, 2038, 2040, 2040, 2049, 2057, 2059, 2059, 2059, 2059, 2064,
+    2069, 2074, 2079, 2087, 2090, 2090, 2091, 2092, 2099, 2099, 2099, 2099, 2099, 2099, 2100, 2103,
+    2103, 2111, 2132, 2147, 2154, 2165, 2183, 2204, 2218, 2229, 2257, 2293, 2326, 2340, 2353, 2364,
+    2390, 2409, 2414, 2426, 2437, 2449, 2474, 2482, 2489, 2503, 2516, 2558, 2586, 2598, 2609, 2622,
+    2641, 2656, 2667, 2701, 2711, 2727, 2737, 2754, 2785, 2799, 2816, 2837, 2869, 2878, 2886, 2893,
+    2908, 2914, 2917, 2948, 2951, 2952, 2984, 3010, 3027, 3042, 3065, 3096, 3108, 3120, 3146, 3163,
+    3168, 3182, 3201, 3209, 3219, 3246, 3256, 3286, 3293, 3301, 3308, 3316, 3323, 3335, 3354, 3378,
+    3386, 3398, 3408, 3412, 3423, 3432, 3442, 3448, 3463, 3474, 3482, 3491, 3499, 3521, 3530, 3544,
+    3563, 3575, 3589, 3601, 3620, 3633, 3639, 3649, 3653, 3659, 3664, 3672, 3679, 3691, 3713, 3716,
+    3719, 3723, 3732, 3740, 3750, 3750, 3751, 3776, 3791, 3819, 3825, 3842, 3864, 3875, 3895, 3908,
+    3928, 3947, 3961, 3974, 3982, 3995, 3999, 4004, 4009, 4016, 4032, 4048, 4064, 4068, 4073, 4085,
+    4090, 4095, 4103, 4107, 4113, 4124, 4142, 4154, 4169, 4181, 4186, 4196, 4202, 4204, 4217, 4234,
+    4240, 4256, 4262, 4276, 4296, 4308, 4320, 4331, 4348, 4352, 4364, 4371, 4389, 4394, 4402, 4421,
+    4426, 4441, 4447, 4453, 4455, 4465, 4474, 4486, 4498, 4510, 4520, 4541, 4553, 4561, 4571, 4578,
+    4587, 4592, 4597, 4607, 4614, 4630, 4645, 4647, 4657, 4669, 4681, 4700, 4737, 4753, 4772, 4784,
+    4785, 4826, 4848, 4863, 4868, 4888, 4904, 4929, 4934, 4946, 4951, 4956, 4961, 4975, 4983, 4992,
+    4997, 5010, 5015, 5021, 5027, 5032, 5042, 5049, 5058, 5065, 5072, 5074, 5080, 5088, 5092, 5098,
+    5106, 5116, 5125, 5136, 5150, 5154, 5159, 5168, 5191, 5200, 5204, 5212, 5223, 5231, 5237, 5240,
+    5256, 5267, 5277, 5290, 5300, 5306, 5316, 5318, 5323, 5325, 5326, 5327, 5332, 5332, 5337, 5342,
+    5347, 5348, 5353, 5354, 5366, 5377, 5382, 5396, 5406, 5411, 5416, 5423, 5435, 5440, 5446, 5453,
+    5465, 5472, 5477, 5483, 5492, 5500, 5503, 5519, 5531, 5548, 5567, 5575, 5583, 5591, 5600, 5612,
+    5620, 5624, 5629, 5629, 5635, 5636, 5643, 5643, 5651, 5660, 5667, 5679, 5689, 5692, 5697, 5701,
+    5701, 5702, 5704, 5709, 5713, 5714, 5720, 5723, 5724, 5729, 5734, 5739, 5739, 5739, 5748, 5755,
+    5762, 5769, 5778, 5790, 5802, 5803, 5810, 5822, 5827, 5835, 5835, 5840, 5845, 5846, 5847, 5852,
+    5860, 5865, 5873, 5876, 5890, 5903, 5904, 5909, 5914, 5919, 5920, 5925, 5934, 5941, 5941, 5946,
+    5947, 5952, 5952, 5957, 5962, 5962, 5967, 5972, 5977, 5977, 5987, 5987, 5988, 5989, 5996, 5996,
+    6003, 6005, 6010, 6019, 6020, 6028, 6028, 6033, 6033, 6043, 6046, 6054, 6056, 6061, 6066, 6071,
+    6083, 6093, 6099, 6100, 6105, 6110, 6115, 6122, 6127, 6133, 6138, 6143, 6155, 6158, 6168, 6174,
+    6179, 6179, 6184, 6189, 6195, 6220, 6223, 6233, 6239, 6240, 6245, 6245, 6253, 6266, 6282, 6300,
+    6317, 6320, 6327, 6331, 6334, 6336, 6339, 6344, 6348, 6350, 6356, 6361, 6366, 6369, 6377, 6382,
+    6391, 6396, 6405, 6409, 6421, 6422, 6430, 6438, 6455, 6467, 6474, 6485, 6494, 6502, 6506, 6513,
+    6521, 6524, 6528, 6539, 6549, 6553, 6561, 6566, 6574, 6575, 6577, 6577, 6577, 6578, 6578, 6583,
+    6589, 6590, 6595, 6601, 6601, 6601, 6606, 6606, 6611, 6611, 6616, 6616, 6623, 6630, 6635, 6643,
+    6646, 6646, 6660, 6666, 6675, 6676, 6682, 6691, 6700, 6706, 6707, 6712, 6713, 6718, 6723, 6727,
+    6727, 6728, 6733, 6736, 6741, 6744, 6753, 6758, 6764, 6780, 6781, 6781, 6782, 6782, 6789, 6801,
+    6806, 6807, 6814, 6816, 6821, 6821, 6828, 6833, 6838, 6842, 6843, 6843, 6843, 6849, 6851, 6853,
+    6863, 6865, 6870, 6870, 6870, 6871, 6876, 6881, 6882, 6882, 6882, 6882, 6882, 6883, 6887, 6894,
+    6894, 6897, 6898, 6900, 6905, 6906, 6906, 6906, 6906, 6911, 6911, 6915, 6915, 6915, 6920, 6921,
+    6921, 6923, 6928, 6928, 6929, 6929, 6933, 6946, 6957, 6959, 6968, 6968, 6969, 6974, 6991, 7009,
+    7014, 7031, 7046, 7063, 7070, 7087, 7097, 7103, 7106, 7107, 7110, 7113, 7115, 7116, 7122, 7124,
+    7127, 7133, 7136, 7138, 7144, 7147, 7150, 7156, 7157, 7164, 7170, 7176, 7179, 7183, 7187, 7191,
+    7195, 7201, 7207, 7214, 7219, 7223, 7231, 7232, 7233, 7233, 7234, 7234, 7236, 7242, 7242, 7247,
+    7247, 7257, 7262, 7268, 7273, 7279, 7282, 7284, 7290, 7292, 7293, 7296, 7301, 7305, 7309, 7314,
+    7320, 7325, 7325, 7330, 7331, 7331, 7332, 7334, 7345, 7347, 7351, 7351, 7351, 7357, 7361, 7363,
+    7363, 7365, 7370, 7375, 7383, 7388, 7396, 7402, 7407, 7415, 7419, 7426, 7435, 7437, 7445, 7449,
+    7453, 7457, 7465, 7469, 7472, 7480, 7484, 7488, 7491, 7492, 7492, 7494, 7500, 7503, 7505, 7506,
+    7508, 7509, 7509, 7511, 7515, 7518, 7522, 7527, 7530, 7532, 7537, 7538, 7544, 7546, 7547, 7548,
+    7550, 7554, 7558, 7558, 7558, 7561, 7576, 7581, 7584, 7585, 7591, 7595, 7598, 7599, 7600, 7603,
+    7607, 7619, 7625, 7628, 7628, 7631, 7631, 7634, 7634, 7635, 7635, 7635, 7637, 7639, 7639, 7641,
+    7644, 7647, 7660, 7667, 7674, 7680, 7682, 7684, 7688, 7692, 7693, 7698, 7700, 7708, 7712, 7722,
+    7727, 7727, 7727, 7732, 7733, 7737, 7740, 7740,
+};
+
+constexpr uint8_t es_child_offset[] = {
+    0x00, 0x1C, 0x34, 0x47, 0x5F, 0x7B, 0x93, 0xA2, 0x00, 0x1B, 0x36, 0x40, 0x56, 0x6D, 0x86, 0xA1, 0x00, 0x0D, 0x28,
+    0x3F, 0x58, 0x72, 0x8E, 0x91, 0x00, 0x17, 0x2F, 0x45, 0x5C, 0x61, 0x65, 0x66, 0x00, 0x02, 0x04, 0x04, 0x04, 0x06,
+    0x07, 0x07, 0x00, 0x00, 0x02, 0x02, 0x05, 0x05, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x03, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x05, 0x06, 0x07, 0x13, 0x16, 0x17, 0x1A, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x16, 0x17, 0x17, 0x1A, 0x1A, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x06, 0x06, 0x08, 0x09, 0x00, 0x16, 0x1A, 0x1A, 0x1A, 0x31, 0x32, 0x35, 0x00, 0x03,
+    0x03, 0x1B, 0x1B, 0x1E, 0x20, 0x20, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x05, 0x00, 0x05, 0x06, 0x07, 0x07,
+    0x08, 0x08, 0x08, 0x00, 0x01, 0x01, 0x04, 0x04, 0x1A, 0x1A, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07,
+    0x00, 0x01, 0x03, 0x06, 0x0B, 0x0E, 0x19, 0x1C, 0x00, 0x02, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0C, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x17, 0x17, 0x18, 0x19, 0x19, 0x19, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x00, 0x00, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x07,
+    0x0A, 0x00, 0x03, 0x0D, 0x0F, 0x13, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x17, 0x17, 0x00, 0x00, 0x00, 0x16, 0x16, 0x16, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04,
+    0x00, 0x01, 0x01, 0x05, 0x05, 0x05, 0x1B, 0x1C, 0x00, 0x01, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x07, 0x00, 0x07, 0x08, 0x09, 0x09, 0x0D, 0x0D, 0x0D, 0x00, 0x01, 0x02, 0x05, 0x08, 0x08,
+    0x08, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03, 0x08, 0x09, 0x0A, 0x0A, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x06, 0x06, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x04,
+    0x06, 0x09, 0x0A, 0x0D, 0x00, 0x01, 0x03, 0x07, 0x08, 0x08, 0x0B, 0x0B, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x07,
+    0x07, 0x00, 0x18, 0x18, 0x19, 0x1C, 0x1C, 0x1C, 0x33, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x06, 0x06,
+    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x04, 0x04, 0x07, 0x07, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x07, 0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04,
+    0x04, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x04, 0x04, 0x1C, 0x1D, 0x1F, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+    0x16, 0x16, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x05, 0x06, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04, 0x04, 0x00, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0D, 0x14, 0x15, 0x00, 0x01, 0x02, 0x06, 0x07, 0x0C,
+    0x0D, 0x15, 0x00, 0x01, 0x08, 0x0F, 0x10, 0x11, 0x19, 0x1A, 0x00, 0x01, 0x02, 0x04, 0x0A, 0x0B, 0x0C, 0x0E, 0x00,
+    0x02, 0x02, 0x03, 0x07, 0x08, 0x0A, 0x0B, 0x00, 0x02, 0x03, 0x06, 0x07, 0x08, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x04, 0x05, 0x0A, 0x0C, 0x0F,
+    0x10, 0x00, 0x02, 0x03, 0x04, 0x07, 0x07, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x01, 0x02, 0x0A, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x0A, 0x0A, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x08, 0x0A, 0x0B, 0x0B, 0x0E, 0x0F, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x01, 0x02, 0x03, 0x06, 0x06, 0x07, 0x00, 0x00, 0x07, 0x08, 0x09, 0x0C,
+    0x0D, 0x0E, 0x00, 0x01, 0x02, 0x05, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x05, 0x08, 0x0D, 0x14, 0x15, 0x16, 0x00,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x02,
+    0x05, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x08, 0x00, 0x01, 0x02, 0x04, 0x07, 0x08,
+    0x09, 0x0A, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x07, 0x08, 0x00,
+    0x01, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03,
+    0x05, 0x06, 0x08, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x06, 0x08, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00,
+    0x01, 0x02, 0x04, 0x06, 0x06, 0x06, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x05, 0x06, 0x07, 0x0E, 0x10, 0x10, 0x00, 0x01, 0x02, 0x07, 0x07, 0x07,
+    0x0C, 0x0D, 0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x08, 0x0A, 0x00,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0E, 0x00, 0x02, 0x04, 0x05, 0x08, 0x08, 0x0D, 0x14, 0x00, 0x01, 0x05, 0x06,
+    0x07, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x0A, 0x00, 0x01, 0x0D, 0x13, 0x13, 0x16, 0x1A,
+    0x1B, 0x00, 0x05, 0x08, 0x09, 0x10, 0x15, 0x16, 0x1D, 0x00, 0x0E, 0x0E, 0x11, 0x15, 0x1A, 0x1F, 0x20, 0x00, 0x08,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x04, 0x06,
+    0x07, 0x08, 0x08, 0x00, 0x01, 0x02, 0x09, 0x0A, 0x11, 0x18, 0x19, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x0B, 0x0C,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x08, 0x0A, 0x00, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x03, 0x05, 0x05, 0x06, 0x07, 0x08, 0x0B, 0x00, 0x01, 0x02, 0x09, 0x0A, 0x0B,
+    0x19, 0x19, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x06, 0x07, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x06, 0x00,
+    0x01, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x08, 0x09,
+    0x0A, 0x0C, 0x19, 0x23, 0x00, 0x0B, 0x12, 0x15, 0x17, 0x19, 0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x00, 0x07,
+    0x08, 0x09, 0x10, 0x11, 0x11, 0x11, 0x00, 0x03, 0x04, 0x05, 0x09, 0x0C, 0x0D, 0x0E, 0x00, 0x02, 0x04, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x00, 0x06, 0x09, 0x0B, 0x0C, 0x0D, 0x14, 0x1B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x00, 0x03, 0x05, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x06, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x03, 0x04, 0x0B, 0x12, 0x13, 0x14, 0x00,
+    0x07, 0x08, 0x09, 0x10, 0x11, 0x18, 0x19, 0x00, 0x02, 0x03, 0x05, 0x07, 0x08, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02,
+    0x03, 0x05, 0x07, 0x08, 0x00, 0x00, 0x01, 0x02, 0x02, 0x05, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x05, 0x08, 0x09,
+    0x0E, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x05,
+    0x07, 0x08, 0x0F, 0x10, 0x11, 0x18, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x11, 0x12, 0x12, 0x19, 0x00, 0x01, 0x02, 0x09, 0x0A, 0x11, 0x12, 0x19,
+    0x00, 0x07, 0x0E, 0x0F, 0x10, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x0D, 0x0E, 0x00, 0x07, 0x0E,
+    0x0E, 0x10, 0x12, 0x13, 0x16, 0x00, 0x01, 0x02, 0x09, 0x10, 0x11, 0x18, 0x18, 0x00, 0x01, 0x08, 0x08, 0x09, 0x0A,
+    0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x09, 0x10, 0x11, 0x18, 0x19, 0x00,
+    0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x05, 0x07, 0x00, 0x01, 0x02, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07,
+    0x07, 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x07, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x08, 0x09, 0x09, 0x10, 0x17, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x03,
+    0x05, 0x06, 0x07, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x09, 0x10, 0x11, 0x12, 0x00, 0x01, 0x03, 0x04, 0x0B, 0x12,
+    0x13, 0x14, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x07, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x06, 0x07, 0x09, 0x00, 0x01, 0x03, 0x04, 0x08, 0x09, 0x09, 0x09, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06,
+    0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0D, 0x00, 0x01,
+    0x02, 0x03, 0x05, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x02, 0x03, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x07, 0x00, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x05, 0x08, 0x09, 0x0B, 0x0C, 0x0E, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0x08, 0x00, 0x02, 0x02, 0x02, 0x02, 0x07, 0x0A, 0x0D, 0x00, 0x01, 0x03,
+    0x04, 0x06, 0x0B, 0x0F, 0x11, 0x00, 0x00, 0x02, 0x02, 0x02, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x02, 0x04, 0x06, 0x09,
+    0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x00, 0x00, 0x07, 0x0A, 0x0B, 0x0C, 0x11, 0x12, 0x00,
+    0x02, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x07, 0x08,
+    0x08, 0x09, 0x09, 0x0A, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x07, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x05, 0x0C, 0x0D, 0x0D,
+    0x0D, 0x14, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x07,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x05, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x08, 0x09, 0x0A, 0x0B, 0x12, 0x12, 0x00,
+    0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x05, 0x06, 0x06, 0x0D, 0x0D, 0x0E, 0x15, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x08, 0x09, 0x10, 0x11, 0x11, 0x11, 0x00, 0x01, 0x01, 0x01, 0x06, 0x07, 0x0E,
+    0x0F, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0E, 0x12, 0x00, 0x03,
+    0x04, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x00, 0x01, 0x03, 0x04, 0x06, 0x0D, 0x0E, 0x11, 0x00, 0x01, 0x06, 0x07, 0x08,
+    0x0E, 0x0F, 0x12, 0x00, 0x02, 0x04, 0x05, 0x06, 0x0B, 0x0C, 0x0D, 0x00, 0x02, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0C,
+    0x00, 0x01, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00,
+    0x01, 0x01, 0x03, 0x06, 0x07, 0x07, 0x0B, 0x00, 0x01, 0x04, 0x04, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x02, 0x02, 0x03, 0x04, 0x09, 0x0A,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x02, 0x06,
+    0x06, 0x06, 0x06, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x04, 0x05, 0x06, 0x0D, 0x0E, 0x11,
+    0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x0A, 0x0B, 0x00, 0x01, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x05,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x00, 0x02, 0x02, 0x03, 0x05, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x07, 0x08, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x00, 0x01, 0x01, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x00, 0x00, 0x05, 0x06, 0x0D, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x14, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x07, 0x09, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x0B, 0x0C, 0x00, 0x01, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x00, 0x01, 0x02,
+    0x03, 0x06, 0x07, 0x07, 0x0B, 0x00, 0x01, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x13, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x05,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x00, 0x07, 0x0E, 0x15, 0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x04, 0x04, 0x06, 0x00, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x08, 0x08, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x07, 0x0E, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x01, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x05,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x01, 0x08, 0x0F, 0x16, 0x1D, 0x1E, 0x00, 0x07, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x0C, 0x13, 0x1A, 0x21, 0x28, 0x28, 0x00, 0x00, 0x03,
+    0x03, 0x05, 0x06, 0x07, 0x0F, 0x00, 0x01, 0x08, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x05, 0x0C, 0x0C, 0x0D, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x00,
+    0x01, 0x02, 0x09, 0x10, 0x10, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x01, 0x01, 0x03,
+    0x03, 0x04, 0x04, 0x00, 0x01, 0x03, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x09, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x06, 0x06, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x06, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
+    0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x02,
+    0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x00, 0x01, 0x02, 0x04, 0x05,
+    0x06, 0x07, 0x0A, 0x00, 0x01, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x04,
+    0x0A, 0x0A, 0x11, 0x13, 0x15, 0x00, 0x05, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0x08, 0x00,
+    0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x07, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x0E, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x07, 0x08,
+    0x0A, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x02, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0C, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x00, 0x00, 0x01, 0x02, 0x04,
+    0x09, 0x0A, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x00, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x00, 0x02, 0x04, 0x05,
+    0x06, 0x06, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x06, 0x0A, 0x0A, 0x0C, 0x0D,
+    0x0F, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x08, 0x00, 0x03, 0x09, 0x0B, 0x0D, 0x0E, 0x0E, 0x10, 0x00, 0x02,
+    0x04, 0x08, 0x09, 0x0D, 0x0E, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x03, 0x03, 0x03,
+    0x03, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x05, 0x06,
+    0x00, 0x01, 0x03, 0x03, 0x08, 0x08, 0x0A, 0x0B, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x06, 0x07, 0x00, 0x03, 0x03, 0x04, 0x04, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05,
+    0x06, 0x00, 0x01, 0x04, 0x07, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x03, 0x04, 0x05, 0x05, 0x07, 0x08, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x05,
+    0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x00, 0x07, 0x08, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06,
+    0x07, 0x00, 0x01, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x06, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x08, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x07, 0x09, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x07, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x05,
+    0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x08, 0x0A, 0x0D, 0x12, 0x13,
+    0x16, 0x18, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04,
+    0x05, 0x00, 0x03, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x02, 0x04, 0x05, 0x06, 0x09, 0x0A, 0x0D, 0x00, 0x03,
+    0x04, 0x07, 0x08, 0x0A, 0x0D, 0x10, 0x00, 0x02, 0x04, 0x07, 0x08, 0x0B, 0x0E, 0x11, 0x00, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x05, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x00,
+    0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x07,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x08, 0x00, 0x03, 0x04, 0x05, 0x06, 0x0B, 0x0C, 0x0F, 0x00, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x0A, 0x0C, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x06, 0x00, 0x01, 0x02, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x08, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x03, 0x05, 0x05, 0x06, 0x06, 0x07, 0x00, 0x01, 0x04, 0x04,
+    0x06, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x0A, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x03, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x03, 0x03,
+    0x04, 0x05, 0x07, 0x07, 0x08, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05, 0x05, 0x06, 0x00,
+    0x01, 0x02, 0x03, 0x06, 0x07, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07,
+    0x08, 0x00, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x02, 0x03, 0x03, 0x03, 0x04,
+    0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x07, 0x08, 0x09, 0x09, 0x09, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01,
+    0x08, 0x0F, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x07, 0x09, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x05,
+    0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x07, 0x0A, 0x00, 0x01, 0x02, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x02, 0x05,
+    0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x00, 0x02, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0E, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
+    0x03, 0x04, 0x00, 0x02, 0x04, 0x06, 0x09, 0x0B, 0x0D, 0x0F, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0B, 0x0D, 0x00,
+    0x02, 0x05, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x00, 0x02, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x02, 0x04, 0x06,
+    0x09, 0x0B, 0x0D, 0x0F, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x05,
+    0x06, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x05, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x08, 0x09, 0x00, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x05, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x01, 0x03, 0x05, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x00, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x02, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x00, 0x02, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x05, 0x08, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x06, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00,
+    0x02, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x06, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x04, 0x06, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x00, 0x01, 0x03, 0x03, 0x06, 0x09, 0x0B, 0x0D, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x04, 0x06,
+    0x08, 0x09, 0x0A, 0x00, 0x02, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x01,
+    0x02, 0x02, 0x05, 0x07, 0x09, 0x0B, 0x00, 0x02, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x03, 0x03, 0x06,
+    0x06, 0x07, 0x07, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x04, 0x06, 0x06, 0x07, 0x07, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x06, 0x08, 0x00, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+};
+
+constexpr uint16_t es_fail[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21,
+    23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 6, 7, 8, 10, 13, 14,
+    15, 16, 17, 19, 20, 21, 22, 28, 1, 3, 4, 5, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 1, 3, 4, 5,
+    6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23,
+    24, 25, 26, 27, 1, 2, 4, 5, 6, 13, 14, 15, 16, 19, 20, 21,
+    22, 25, 28, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 2, 3, 4, 5, 6, 8, 15, 16, 20, 21, 1, 3, 4,
+    5, 7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24,
+    25, 26, 27, 1, 3, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 1, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24,
+    25, 26, 27, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 23, 24, 25, 26, 27, 1, 2, 4, 6, 10, 13, 14, 15, 16,
+    17, 19, 20, 25, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 1,
+    3, 4, 5, 7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 13, 15, 21, 1, 3, 4, 5, 7, 8, 9, 10,
+    11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 1,
+    2, 3, 4, 5, 7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20,
+    21, 23, 24, 25, 26, 27, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 1, 3,
+    4, 5, 7, 8, 9, 11, 12, 13, 14, 15, 17, 18, 19, 20, 21, 23,
+    24, 25, 26, 27, 1, 3, 4, 5, 7, 8, 9, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 23, 24, 25, 26, 27, 0, 0, 0, 0, 0,
+    55, 56, 64, 69, 79, 97, 111, 128, 132, 155, 161, 221, 237, 249, 324, 332,
+    389, 403, 406, 443, 468, 477, 483, 494, 507, 58, 71, 2, 97, 105, 116, 124,
+    2, 128, 135, 136, 137, 16, 142, 157, 172, 181, 207, 248, 298, 302, 328, 332,
+    338, 350, 354, 356, 357, 369, 386, 397, 438, 439, 441, 443, 10, 449, 450, 451,
+    452, 456, 457, 28, 463, 468, 482, 494, 5, 20, 519, 637, 110, 116, 122, 183,
+    203, 244, 247, 250, 22, 298, 299, 300, 301, 303, 304, 305, 307, 308, 309, 310,
+    311, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 337, 402, 407, 408, 438,
+    440, 441, 442, 444, 445, 446, 447, 448, 449, 450, 451, 453, 454, 455, 456, 457,
+    458, 459, 460, 461, 462, 508, 515, 20, 56, 60, 67, 110, 116, 122, 7, 155,
+    183, 203, 216, 218, 219, 220, 222, 223, 224, 226, 227, 228, 229, 230, 232, 233,
+    234, 235, 236, 238, 239, 240, 241, 242, 243, 244, 245, 252, 298, 299, 300, 301,
+    302, 303, 304, 305, 307, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318, 319,
+    320, 321, 322, 337, 350, 355, 10, 381, 382, 385, 386, 22, 402, 407, 408, 438,
+    440, 441, 442, 444, 445, 446, 10, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+    456, 457, 458, 459, 460, 461, 462, 489, 508, 515, 2, 517, 612, 636, 110, 116,
+    122, 150, 10, 155, 157, 158, 183, 203, 247, 337, 402, 407, 408, 438, 440, 441,
+    442, 444, 445, 446, 447, 448, 449, 450, 451, 453, 454, 455, 456, 457, 458, 459,
+    460, 461, 462, 508, 515, 56, 57, 63, 97, 111, 116, 117, 124, 135, 136, 137,
+    140, 142, 151, 302, 28, 325, 332, 338, 350, 354, 355, 358, 369, 378, 386, 28,
+    438, 439, 443, 10, 449, 450, 451, 452, 456, 457, 28, 463, 466, 482, 503, 4,
+    19, 2, 570, 574, 16, 580, 584, 22, 28, 635, 63, 154, 157, 13, 251, 252,
+    298, 299, 300, 301, 303, 304, 305, 307, 308, 309, 310, 311, 313, 314, 315, 316,
+    317, 318, 319, 320, 321, 322, 382, 21, 438, 440, 441, 442, 444, 445, 446, 447,
+    448, 449, 450, 451, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 489, 62,
+    68, 156, 157, 248, 249, 298, 299, 300, 301, 303, 304, 305, 307, 308, 309, 310,
+    311, 313, 314, 315, 316, 317, 22, 318, 319, 320, 321, 322, 350, 382, 438, 439,
+    440, 441, 442, 444, 445, 446, 447, 448, 449, 450, 451, 453, 454, 455, 456, 457,
+    458, 459, 460, 461, 462, 2, 55, 62, 150, 153, 154, 17, 159, 161, 246, 17,
+    251, 380, 381, 6, 14, 53, 64, 67, 68, 6, 97, 111, 2, 128, 132, 157,
+    190, 204, 28, 351, 354, 356, 357, 358, 10, 362, 364, 369, 28, 375, 386, 474,
+    475, 477, 482, 490, 13, 298, 299, 300, 301, 303, 304, 305, 307, 308, 309, 310,
+    311, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 438, 440, 441, 442, 444,
+    445, 446, 447, 448, 449, 450, 451, 453, 454, 455, 456, 457, 458, 459, 460, 461,
+    462, 110, 116, 122, 160, 183, 203, 249, 17, 252, 28, 298, 299, 300, 301, 303,
+    304, 305, 307, 308, 309, 310, 311, 313, 314, 315, 316, 317, 318, 319, 320, 321,
+    322, 337, 8, 402, 407, 408, 508, 515, 56, 62, 64, 25, 110, 116, 122, 149,
+    8, 153, 155, 156, 158, 159, 183, 203, 245, 13, 249, 19, 337, 350, 382, 385,
+    21, 402, 407, 408, 508, 515, 517, 63, 64, 67, 110, 116, 122, 150, 7, 156,
+    159, 160, 183, 203, 337, 375, 385, 402, 407, 408, 494, 508, 515, 58, 116, 160,
+    162, 245, 246, 306, 312, 28, 337, 353, 355, 369, 386, 408, 451, 457, 463, 464,
+    477, 482, 16, 62, 64, 67, 151, 155, 157, 159, 245, 247, 19, 298, 2, 299,
+    300, 301, 303, 304, 305, 307, 308, 309, 310, 311, 313, 314, 315, 316, 317, 22,
+    318, 319, 320, 321, 322, 350, 380, 385, 386, 438, 440, 441, 442, 444, 445, 446,
+    447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+    463, 10, 489, 494, 519, 6, 10, 57, 64, 67, 110, 116, 122, 10, 159, 183,
+    203, 324, 337, 381, 402, 407, 408, 438, 440, 441, 442, 444, 445, 446, 447, 448,
+    449, 450, 451, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 508, 515, 53,
+    62, 64, 68, 110, 116, 122, 153, 154, 157, 160, 183, 203, 337, 3, 377, 389,
+    402, 407, 408, 490, 494, 498, 504, 508, 515, 5, 17, 19, 62, 110, 116, 122,
+    150, 153, 157, 159, 183, 203, 250, 337, 384, 402, 407, 408, 438, 439, 440, 441,
+    442, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+    459, 460, 461, 462, 463, 508, 515, 19, 612, 628, 636, 317, 10, 494, 245, 246,
+    298, 299, 300, 301, 303, 304, 305, 307, 308, 309, 310, 311, 313, 314, 315, 316,
+    317, 318, 319, 320, 321, 322, 438, 440, 441, 442, 444, 445, 446, 447, 448, 449,
+    450, 451, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 68, 110, 116, 122,
+    155, 157, 183, 203, 13, 337, 402, 407, 408, 508, 515, 110, 116, 122, 183, 203,
+    337, 402, 407, 408, 508, 515, 383, 3, 5, 10, 15, 16, 19, 20, 1, 5,
+    10, 16, 19, 20, 1, 2, 3, 5, 14, 20, 21, 1, 1, 13, 15, 20,
+    21, 87, 114, 351, 355, 10, 693, 509, 243, 722, 723, 724, 28, 70, 376, 378,
+    9, 379, 840, 383, 843, 28, 885, 160, 888, 351, 938, 939, 10, 364, 22, 28,
+    961, 962, 573, 963, 964, 967, 968, 1082, 1092, 1107, 355, 1111, 1112, 1114, 1115, 22,
+    1116, 1209, 1225, 250, 1284, 1320, 443, 1333, 149, 152, 1357, 156, 160, 162, 3, 376,
+    3, 1419, 1425, 1437, 10, 639, 53, 61, 64, 68, 64, 250, 28, 504, 53, 68,
+    883, 2, 302, 312, 328, 364, 375, 385, 386, 494, 951, 245, 452, 452, 1104, 158,
+    157, 1225, 386, 16, 140, 172, 201, 1258, 1278, 1290, 53, 61, 1352, 68, 104, 148,
+    1357, 154, 155, 158, 243, 250, 2, 302, 312, 328, 364, 382, 386, 468, 494, 635,
+    636, 637, 148, 10, 155, 158, 1412, 158, 132, 482, 504, 1561, 82, 155, 376, 378,
+    9, 379, 380, 383, 22, 28, 518, 466, 668, 190, 204, 442, 164, 940, 1094, 1097,
+    108, 504, 17, 1247, 245, 339, 1273, 1277, 475, 517, 250, 17, 382, 57, 68, 312,
+    15, 920, 251, 940, 949, 464, 468, 10, 477, 483, 28, 153, 669, 674, 687, 64,
+    376, 378, 9, 379, 383, 843, 28, 504, 507, 874, 2, 302, 312, 328, 364, 452,
+    494, 925, 150, 636, 16, 250, 386, 16, 149, 221, 1258, 504, 507, 1278, 635, 55,
+    1351, 63, 1352, 1353, 68, 69, 154, 250, 2, 302, 312, 328, 364, 386, 468, 494,
+    635, 636, 637, 108, 1412, 364, 111, 452, 56, 60, 62, 63, 150, 8, 18, 248,
+    11, 1524, 14, 252, 3, 377, 378, 8, 382, 384, 21, 403, 507, 3, 5, 635,
+    636, 637, 639, 1546, 687, 343, 455, 312, 10, 504, 364, 504, 312, 710, 376, 941,
+    9, 379, 383, 22, 943, 951, 1104, 355, 4, 351, 364, 59, 67, 79, 82, 312,
+    922, 306, 324, 934, 935, 389, 408, 494, 961, 140, 393, 403, 1122, 1268, 328, 338,
+    153, 324, 351, 364, 699, 708, 157, 53, 68, 375, 840, 842, 62, 156, 252, 944,
+    53, 63, 1024, 375, 635, 53, 68, 22, 181, 194, 217, 221, 225, 237, 28, 245,
+    344, 1253, 386, 1258, 507, 637, 1278, 2, 28, 338, 376, 378, 9, 379, 383, 22,
+    28, 1411, 1420, 312, 959, 1109, 403, 504, 635, 28, 114, 299, 300, 301, 303, 304,
+    305, 310, 313, 314, 316, 317, 318, 693, 574, 55, 190, 2, 940, 375, 477, 490,
+    114, 306, 1112, 10, 364, 444, 504, 1467, 688, 364, 698, 114, 181, 376, 941, 9,
+    379, 383, 22, 943, 504, 14, 1277, 1426, 490, 504, 639, 1098, 1099, 1100, 1101, 248,
+    1202, 639, 10, 111, 158, 504, 1278, 504, 10, 504, 1391, 63, 1394, 375, 386, 1412,
+    375, 386, 685, 693, 697, 16, 940, 945, 946, 453, 490, 1099, 27, 452, 64, 19,
+    1267, 1277, 468, 10, 1280, 1281, 1363, 21, 245, 18, 1426, 490, 504, 159, 14, 19,
+    132, 353, 697, 699, 704, 707, 249, 494, 507, 1210, 338, 318, 353, 708, 931, 934,
+    458, 5, 87, 105, 1284, 1420, 148, 158, 13, 385, 2, 393, 406, 439, 310, 110,
+    931, 945, 949, 490, 507, 377, 18, 403, 1352, 68, 384, 440, 466, 4, 507, 23,
+    1426, 101, 1101, 471, 364, 951, 312, 376, 378, 9, 379, 383, 22, 28, 2, 136,
+    137, 141, 142, 251, 354, 386, 439, 443, 450, 451, 452, 456, 457, 463, 468, 136,
+    137, 140, 141, 142, 251, 386, 450, 451, 452, 456, 457, 53, 61, 63, 64, 68,
+    82, 2, 16, 338, 475, 482, 494, 312, 350, 482, 498, 443, 860, 58, 62, 1239,
+    17, 251, 1671, 498, 504, 1094, 70, 1709, 387, 1718, 639, 714, 56, 60, 62, 66,
+    67, 70, 25, 151, 7, 159, 161, 221, 225, 14, 252, 22, 12, 384, 385, 635,
+    636, 637, 639, 0, 1749, 1750, 471, 1751, 1752, 1753, 1754, 519, 150, 56, 11, 1239,
+    1241, 154, 1785, 11, 14, 635, 636, 637, 639, 0, 217, 225, 231, 237, 28, 1839,
+    1840, 1841, 1842, 0, 328, 328, 55, 56, 57, 59, 60, 62, 1239, 1240, 66, 1241,
+    1910, 69, 1246, 153, 155, 18, 23, 161, 1919, 248, 249, 3, 377, 7, 384, 1923,
+    519, 635, 636, 1925, 639, 0, 2, 685, 306, 1969, 376, 378, 9, 379, 383, 22,
+    28, 351, 355, 358, 10, 28, 2037, 149, 152, 9, 1357, 156, 160, 162, 376, 378,
+    9, 379, 383, 22, 28, 55, 917, 918, 58, 59, 60, 11, 62, 919, 64, 66,
+    18, 68, 27, 14, 2054, 23, 3, 377, 11, 385, 3, 14, 518, 20, 519, 969,
+    636, 637, 639, 0, 6, 68, 2, 6, 78, 79, 16, 87, 90, 28, 443, 452,
+    2080, 2089, 28, 251, 689, 708, 693, 382, 639, 376, 378, 9, 379, 383, 22, 28,
+    708, 364, 68, 148, 158, 375, 386, 148, 386, 438, 439, 443, 1278, 148, 376, 378,
+    9, 379, 383, 22, 28, 105, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9,
+    379, 383, 22, 28, 64, 955, 947, 1969, 1278, 452, 243, 247, 9, 10, 250, 22,
+    28, 312, 149, 152, 9, 10, 156, 160, 162, 2027, 251, 689, 708, 225, 251, 935,
+    936, 955, 1093, 1096, 1117, 1118, 53, 68, 148, 158, 375, 386, 148, 386, 350, 1278,
+    148, 148, 1, 1546, 1549, 1550, 1552, 1555, 1557, 1561, 251, 936, 955, 2070, 10, 2071,
+    955, 250, 507, 376, 378, 9, 379, 383, 22, 28, 477, 306, 352, 353, 937, 356,
+    357, 939, 361, 362, 365, 366, 368, 940, 370, 374, 1268, 635, 636, 637, 639, 0,
+    28, 97, 1024, 132, 62, 498, 358, 1891, 1894, 312, 376, 378, 9, 379, 383, 22,
+    28, 408, 385, 1099, 1235, 507, 490, 338, 312, 376, 378, 9, 379, 383, 22, 28,
+    408, 364, 140, 10, 369, 54, 58, 9, 61, 65, 70, 71, 1122, 1787, 1361, 338,
+    55, 56, 59, 60, 9, 1392, 1393, 66, 67, 1394, 69, 26, 27, 149, 150, 151,
+    1399, 155, 156, 18, 1400, 158, 162, 246, 247, 248, 13, 14, 249, 251, 1405, 1406,
+    5, 380, 382, 384, 385, 386, 23, 387, 26, 3, 1417, 6, 518, 1419, 20, 28,
+    635, 636, 639, 931, 932, 808, 1643, 1649, 247, 364, 635, 636, 637, 639, 0, 376,
+    378, 9, 379, 383, 22, 28, 1449, 69, 68, 148, 158, 375, 386, 148, 386, 375,
+    386, 148, 1770, 922, 4, 377, 1278, 376, 378, 9, 379, 383, 22, 28, 54, 58,
+    9, 61, 65, 70, 71, 3, 1991, 376, 378, 9, 379, 383, 22, 28, 443, 667,
+    82, 671, 672, 677, 688, 689, 2050, 2051, 2052, 2053, 708, 709, 710, 711, 935, 385,
+    53, 68, 148, 158, 375, 386, 148, 386, 1278, 148, 148, 1, 1543, 1545, 1546, 1548,
+    1549, 1550, 1552, 1555, 1557, 1561, 816, 1426, 376, 378, 9, 379, 383, 22, 28, 376,
+    378, 9, 379, 383, 843, 28, 376, 378, 9, 379, 383, 22, 28, 101, 194, 22,
+    687, 114, 28, 432, 194, 198, 1106, 2, 16, 28, 2, 306, 324, 328, 332, 338,
+    28, 504, 79, 114, 158, 190, 28, 1272, 400, 498, 516, 1318, 1437, 6, 2, 14,
+    1548, 8, 8, 11, 13, 1560, 1568, 2116, 1665, 504, 452, 376, 378, 9, 379, 383,
+    22, 28, 250, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22,
+    28, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28, 1702,
+    507, 1790, 636, 637, 639, 0, 382, 54, 58, 9, 61, 65, 70, 71, 1245, 111,
+    62, 1253, 386, 164, 178, 28, 442, 722, 2, 376, 378, 9, 379, 383, 22, 28,
+    1767, 245, 250, 69, 243, 247, 9, 10, 1781, 22, 28, 376, 378, 9, 379, 383,
+    22, 28, 69, 490, 1426, 54, 58, 9, 61, 65, 70, 71, 452, 1288, 376, 378,
+    9, 379, 383, 22, 28, 1414, 376, 378, 9, 379, 383, 22, 28, 1219, 376, 378,
+    9, 379, 383, 22, 28, 2, 312, 1210, 53, 68, 1253, 386, 1683, 951, 708, 364,
+    1278, 684, 685, 375, 942, 498, 688, 708, 1545, 14, 1549, 708, 20, 439, 155, 1079,
+    157, 158, 244, 247, 28, 1092, 635, 636, 637, 639, 0, 105, 518, 1278, 1991, 1437,
+    4, 63, 635, 375, 386, 635, 636, 637, 639, 0, 53, 68, 312, 376, 378, 9,
+    379, 383, 22, 28, 1814, 178, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9,
+    379, 383, 22, 28, 1548, 637, 860, 1671, 243, 247, 9, 10, 250, 22, 28, 82,
+    54, 58, 9, 61, 1023, 65, 70, 71, 64, 1786, 376, 378, 9, 379, 383, 22,
+    28, 54, 58, 9, 61, 65, 70, 71, 860, 243, 243, 247, 9, 10, 250, 22,
+    28, 243, 376, 378, 9, 379, 383, 22, 28, 178, 376, 378, 9, 379, 383, 22,
+    28, 498, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28,
+    111, 860, 452, 1790, 636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 338,
+    494, 947, 54, 58, 9, 61, 65, 70, 71, 376, 378, 9, 379, 383, 22, 28,
+    1895, 1896, 1897, 1899, 1900, 148, 149, 885, 1105, 1945, 8, 243, 247, 9, 10, 250,
+    22, 28, 376, 378, 9, 379, 383, 843, 28, 955, 376, 378, 9, 379, 383, 22,
+    28, 376, 378, 9, 379, 383, 22, 28, 252, 376, 378, 9, 379, 383, 22, 28,
+    686, 2061, 1278, 156, 1278, 156, 1671, 54, 58, 9, 1675, 65, 70, 71, 490, 1794,
+    1798, 403, 54, 58, 9, 61, 65, 70, 71, 376, 378, 9, 379, 383, 843, 28,
+    624, 376, 378, 9, 379, 383, 22, 28, 353, 10, 243, 247, 9, 10, 250, 22,
+    1178, 490, 1398, 158, 14, 249, 384, 1411, 1415, 339, 504, 1099, 951, 494, 332, 452,
+    250, 111, 1695, 1696, 1697, 1112, 1116, 149, 152, 9, 10, 156, 160, 162, 1449, 364,
+    376, 378, 9, 379, 383, 22, 28, 2, 1243, 155, 243, 247, 9, 10, 1781, 22,
+    28, 16, 16, 443, 250, 364, 684, 685, 955, 309, 438, 439, 443, 63, 1288, 439,
+    63, 338, 364, 149, 152, 9, 10, 156, 1172, 162, 54, 58, 9, 61, 65, 70,
+    71, 338, 53, 68, 1437, 111, 432, 376, 378, 9, 379, 383, 22, 28, 368, 464,
+    709, 477, 403, 16, 104, 110, 1437, 6, 947, 149, 152, 9, 10, 156, 160, 162,
+    1901, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28, 376,
+    378, 9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 63, 328, 364, 468, 494,
+    463, 16, 474, 63, 154, 328, 364, 386, 468, 494, 1399, 328, 364, 10, 468, 494,
+    463, 474, 328, 364, 386, 468, 494, 251, 688, 689, 708, 302, 53, 68, 375, 386,
+    386, 338, 1411, 1412, 1413, 158, 1202, 1412, 245, 149, 152, 9, 1357, 156, 160, 162,
+    376, 378, 9, 379, 383, 22, 28, 679, 300, 337, 397, 1121, 28, 2406, 243, 247,
+    9, 10, 1430, 22, 28, 376, 378, 9, 379, 383, 22, 28, 22, 19, 351, 938,
+    10, 364, 25, 101, 114, 194, 210, 685, 306, 28, 455, 714, 574, 132, 22, 172,
+    516, 963, 1080, 157, 158, 1084, 244, 339, 504, 19, 282, 393, 1275, 28, 442, 8,
+    17, 2544, 2545, 2556, 2576, 2577, 637, 2578, 0, 105, 101, 6, 28, 1976, 28, 440,
+    934, 28, 158, 2, 6, 16, 28, 328, 11, 1079, 70, 244, 385, 1092, 635, 637,
+    639, 0, 152, 1215, 1219, 667, 16, 101, 672, 677, 168, 210, 306, 28, 1976, 351,
+    10, 389, 393, 400, 406, 702, 455, 10, 711, 172, 931, 22, 351, 353, 432, 527,
+    961, 573, 117, 210, 88, 101, 117, 168, 403, 2910, 498, 1546, 1551, 21, 56, 58,
+    64, 151, 1663, 1175, 2985, 247, 9, 10, 250, 22, 1178, 635, 636, 637, 639, 0,
+    59, 1239, 1241, 1249, 221, 225, 251, 635, 639, 3159, 2015, 497, 1413, 1414, 507, 510,
+    516, 377, 385, 969, 636, 637, 639, 0, 55, 159, 225, 28, 635, 636, 637, 639,
+    0, 79, 87, 88, 111, 117, 123, 675, 8, 680, 28, 682, 22, 28, 685, 306,
+    312, 314, 28, 324, 686, 688, 28, 10, 28, 389, 406, 483, 28, 1107, 353, 1109,
+    1110, 3173, 1114, 368, 1115, 370, 527, 445, 10, 79, 28, 324, 28, 1468, 369, 28,
+    464, 28, 498, 1543, 14, 155, 56, 59, 62, 67, 68, 69, 11, 153, 154, 155,
+    158, 246, 722, 13, 14, 249, 19, 28, 377, 7, 385, 439, 19, 635, 636, 637,
+    639, 0, 158, 378, 3222, 3223, 3247, 3248, 471, 10, 3249, 483, 28, 639, 463, 1671,
+    1272, 1566, 635, 636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 708, 955,
+    1278, 1278, 53, 68, 158, 635, 636, 637, 639, 0, 250, 635, 636, 637, 639, 0,
+    635, 636, 637, 639, 0, 689, 245, 2985, 376, 378, 9, 379, 383, 22, 28, 635,
+    636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 969, 636, 637, 639, 0,
+    3129, 3130, 3131, 3132, 3133, 3134, 3135, 463, 243, 247, 9, 10, 250, 22, 28, 463,
+    1782, 1893, 1926, 708, 955, 1278, 1278, 350, 2125, 2132, 463, 2139, 2140, 2141, 2142, 2143,
+    463, 463, 251, 3208, 376, 378, 9, 379, 383, 22, 28, 1449, 635, 636, 637, 639,
+    0, 375, 386, 250, 2, 1783, 2000, 637, 54, 58, 9, 61, 65, 70, 71, 708,
+    250, 312, 243, 247, 9, 10, 1430, 22, 28, 376, 378, 9, 379, 383, 22, 28,
+    945, 946, 446, 947, 2877, 455, 22, 954, 376, 378, 9, 379, 383, 22, 28, 635,
+    636, 637, 639, 0, 504, 376, 378, 9, 379, 383, 843, 28, 1437, 54, 58, 9,
+    61, 65, 70, 71, 376, 378, 9, 379, 383, 22, 28, 381, 635, 636, 637, 639,
+    0, 504, 376, 378, 9, 379, 383, 22, 28, 22, 243, 247, 9, 10, 250, 22,
+    28, 507, 14, 635, 636, 715, 639, 0, 1413, 2631, 2632, 2633, 2634, 2635, 2636, 2637,
+    69, 376, 378, 9, 379, 383, 22, 28, 16, 87, 114, 680, 28, 210, 237, 2,
+    306, 692, 406, 455, 464, 709, 710, 711, 22, 624, 28, 55, 918, 919, 64, 67,
+    68, 920, 104, 921, 123, 132, 22, 328, 339, 28, 356, 432, 441, 953, 956, 478,
+    957, 969, 1101, 1102, 1103, 203, 210, 22, 324, 339, 353, 355, 1109, 1111, 368, 1115,
+    370, 1122, 6, 82, 88, 97, 117, 123, 16, 2, 302, 309, 1268, 1269, 1271, 406,
+    442, 443, 445, 10, 1276, 1277, 468, 2, 527, 28, 574, 6, 28, 79, 88, 2074,
+    153, 351, 355, 1468, 364, 28, 440, 482, 638, 9, 13, 4, 1554, 1565, 19, 1778,
+    1779, 1093, 1096, 1117, 1118, 53, 155, 376, 378, 9, 379, 383, 22, 28, 635, 636,
+    637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 504, 708, 955, 1278, 1278, 1278,
+    53, 1768, 116, 97, 635, 636, 637, 639, 0, 635, 636, 715, 639, 0, 87, 951,
+    635, 636, 637, 639, 0, 149, 152, 9, 1357, 156, 160, 162, 1638, 1639, 1640, 1641,
+    302, 1646, 1647, 1654, 1655, 1656, 1666, 1674, 1675, 1676, 1677, 1679, 1680, 1681, 1682, 1683,
+    1691, 3170, 3171, 3172, 1698, 1699, 1700, 1701, 1702, 1703, 1782, 438, 439, 443, 10, 450,
+    708, 955, 1278, 1278, 2110, 2115, 350, 2118, 2119, 2125, 2126, 2132, 463, 2139, 2140, 2141,
+    2142, 2143, 463, 157, 946, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635,
+    636, 637, 639, 0, 157, 1026, 14, 1226, 636, 1350, 637, 635, 67, 243, 247, 250,
+    1178, 635, 636, 637, 639, 386, 28, 854, 479, 63, 635, 157, 1294, 245, 18, 251,
+    1466, 2032, 54, 58, 9, 61, 65, 70, 71, 157, 56, 67, 69, 328, 10, 194,
+    194, 2, 16, 306, 324, 328, 332, 2147, 2154, 3297, 2391, 376, 378, 9, 379, 383,
+    22, 28, 376, 378, 9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 376, 378,
+    9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635,
+    636, 637, 639, 0, 635, 636, 637, 639, 0, 1426, 1449, 1273, 635, 636, 715, 639,
+    0, 921, 376, 378, 9, 379, 383, 843, 28, 684, 685, 1278, 53, 68, 375, 376,
+    378, 9, 379, 383, 386, 22, 28, 637, 2, 1709, 64, 635, 636, 637, 639, 0,
+    2591, 2592, 2593, 2594, 2595, 2596, 2597, 1099, 376, 378, 9, 379, 383, 22, 28, 504,
+    380, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 504, 54, 58, 9, 61,
+    65, 70, 71, 951, 635, 636, 715, 639, 0, 376, 378, 9, 379, 383, 22, 28,
+    2023, 2024, 446, 947, 951, 455, 22, 954, 635, 636, 637, 639, 0, 376, 378, 9,
+    379, 383, 22, 28, 635, 636, 637, 639, 0, 376, 941, 9, 379, 383, 22, 943,
+    635, 636, 637, 639, 0, 53, 68, 375, 386, 351, 364, 708, 1278, 2417, 376, 378,
+    9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28, 1663, 1789, 251, 1666,
+    2115, 338, 2125, 482, 54, 58, 9, 61, 65, 70, 71, 10, 946, 10, 957, 158,
+    636, 13, 1555, 1558, 1567, 14, 808, 247, 28, 364, 946, 3041, 455, 954, 54, 58,
+    9, 61, 65, 70, 71, 105, 687, 688, 14, 1278, 708, 376, 378, 9, 379, 383,
+    22, 28, 635, 636, 637, 639, 0, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 376, 378,
+    9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 2119,
+    1557, 376, 378, 9, 379, 383, 22, 28, 2402, 635, 636, 637, 639, 0, 302, 1852,
+    635, 636, 715, 639, 0, 364, 148, 635, 636, 637, 639, 0, 635, 636, 715, 639,
+    0, 376, 378, 9, 379, 383, 22, 28, 1095, 69, 635, 636, 637, 639, 0, 54,
+    58, 9, 61, 65, 70, 71, 635, 636, 637, 639, 0, 376, 378, 9, 379, 383,
+    22, 28, 635, 636, 637, 639, 0, 243, 247, 9, 10, 1430, 22, 28, 635, 636,
+    637, 639, 0, 635, 636, 637, 639, 0, 376, 378, 9, 379, 383, 843, 28, 376,
+    378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28, 635, 636, 637,
+    639, 0, 376, 378, 9, 379, 383, 22, 28, 149, 152, 9, 10, 156, 160, 162,
+    249, 635, 636, 715, 639, 0, 635, 636, 637, 639, 0, 2878, 2880, 2881, 2882, 53,
+    68, 955, 376, 378, 9, 379, 383, 22, 28, 2949, 198, 635, 636, 637, 639, 0,
+    635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 504,
+    17, 635, 636, 637, 639, 0, 1218, 376, 941, 9, 379, 383, 22, 943, 376, 941,
+    9, 379, 383, 22, 943, 2406, 2410, 517, 635, 636, 715, 639, 0, 54, 58, 9,
+    61, 65, 70, 71, 693, 934, 382, 635, 636, 715, 639, 0, 635, 636, 637, 639,
+    0, 376, 378, 9, 379, 1542, 22, 28, 635, 636, 637, 639, 0, 1243, 243, 247,
+    9, 10, 250, 22, 28, 1094, 1095, 381, 19, 1944, 636, 637, 639, 0, 54, 58,
+    9, 61, 65, 70, 71, 2062, 957, 339, 1108, 393, 53, 68, 1235, 376, 378, 9,
+    379, 383, 22, 28, 376, 378, 9, 379, 383, 843, 28, 376, 378, 9, 379, 383,
+    22, 28, 149, 152, 9, 10, 156, 160, 162, 250, 376, 378, 9, 379, 383, 22,
+    28, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 843, 28, 1919,
+    1925, 969, 636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9,
+    379, 383, 22, 28, 635, 636, 637, 639, 0, 54, 58, 9, 61, 65, 70, 71,
+    364, 635, 636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9,
+    379, 383, 22, 28, 149, 152, 9, 1357, 156, 160, 162, 376, 378, 9, 379, 383,
+    22, 28, 376, 378, 9, 379, 383, 22, 28, 1663, 2, 312, 28, 53, 68, 158,
+    686, 2023, 2024, 446, 947, 951, 455, 22, 954, 54, 58, 9, 61, 65, 70, 71,
+    686, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9, 379, 383, 22, 28, 969,
+    636, 637, 639, 0, 635, 636, 715, 639, 0, 376, 378, 9, 379, 383, 22, 28,
+    708, 54, 58, 9, 61, 65, 70, 71, 635, 636, 637, 639, 0, 464, 468, 471,
+    10, 477, 483, 28, 55, 1392, 1393, 69, 1400, 1406, 376, 378, 9, 379, 383, 22,
+    28, 376, 378, 9, 379, 383, 22, 28, 838, 54, 58, 9, 61, 65, 70, 71,
+    157, 969, 636, 637, 639, 0, 376, 941, 9, 379, 383, 22, 943, 635, 636, 637,
+    639, 0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 688, 1217, 386, 1398,
+    1425, 380, 381, 382, 383, 386, 21, 2, 302, 312, 688, 935, 1217, 386, 474, 1398,
+    1425, 935, 1217, 386, 245, 1398, 1425, 2, 302, 312, 1217, 386, 474, 1398, 1425, 463,
+    1666, 148, 158, 708, 1278, 1278, 375, 386, 53, 68, 2070, 10, 2071, 245, 955, 190,
+    204, 156, 969, 636, 637, 639, 0, 635, 636, 637, 639, 0, 1658, 111, 10, 248,
+    639, 11, 382, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 2, 1240, 66,
+    23, 158, 249, 380, 157, 443, 155, 517, 1663, 245, 639, 443, 1706, 243, 245, 252,
+    4, 245, 635, 251, 104, 946, 10, 477, 409, 440, 1288, 636, 128, 132, 28, 210,
+    408, 3919, 250, 10, 155, 636, 1231, 639, 251, 637, 957, 67, 635, 636, 639, 157,
+    713, 1277, 13, 1558, 19, 14, 67, 385, 783, 17, 66, 384, 150, 1077, 247, 635,
+    23, 62, 245, 14, 60, 153, 1294, 306, 443, 28, 22, 251, 155, 245, 8, 5,
+    1241, 111, 1350, 28, 252, 1816, 217, 874, 16, 1077, 468, 783, 874, 875, 16, 155,
+    1319, 2081, 4378, 446, 4379, 951, 4380, 22, 4381, 13, 10, 132, 498, 111, 690, 22,
+    957, 1115, 1944, 636, 637, 639, 0, 681, 686, 697, 707, 960, 1081, 1088, 1119, 1548,
+    17, 56, 11, 67, 149, 1425, 154, 3107, 1426, 1427, 245, 248, 2072, 14, 249, 251,
+    27, 1432, 2073, 443, 1449, 517, 1463, 635, 1466, 637, 639, 0, 117, 123, 442, 14,
+    16, 490, 244, 637, 722, 477, 28, 840, 28, 0, 332, 28, 19, 637, 1055, 22,
+    28, 20, 0, 8, 14, 251, 27, 11, 636, 637, 639, 635, 636, 639, 14, 637,
+    1285, 443, 28, 14, 0, 4751, 249, 190, 247, 245, 18, 637, 69, 635, 243, 246,
+    247, 7, 14, 19, 251, 28, 635, 637, 67, 635, 13, 87, 324, 328, 338, 940,
+    101, 117, 175, 300, 306, 317, 455, 710, 516, 6, 931, 339, 940, 478, 957, 1100,
+    16, 28, 1709, 1103, 158, 309, 332, 368, 1115, 636, 99, 172, 442, 26, 440, 1548,
+    1549, 1560, 15, 19, 957, 158, 14, 3, 380, 8, 247, 28, 1417, 518, 635, 636,
+    637, 639, 0, 25, 2004, 2152, 635, 636, 637, 639, 0, 708, 955, 382, 1098, 635,
+    636, 637, 639, 0, 635, 636, 637, 639, 0, 4652, 4653, 4654, 4655, 4656, 635, 636,
+    637, 639, 0, 2614, 3312, 3319, 3320, 3321, 3322, 463, 635, 636, 637, 639, 0, 376,
+    378, 9, 379, 383, 22, 28, 1278, 376, 378, 9, 379, 383, 22, 28, 68, 375,
+    3065, 635, 636, 715, 639, 0, 376, 378, 9, 379, 383, 22, 28, 376, 378, 9,
+    379, 383, 22, 28, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 1808, 1809,
+    1810, 639, 0, 635, 636, 637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 635,
+    636, 637, 639, 0, 54, 58, 9, 61, 65, 70, 71, 635, 636, 715, 639, 0,
+    635, 636, 637, 639, 0, 325, 376, 378, 9, 379, 383, 22, 28, 635, 636, 637,
+    639, 0, 2, 6, 9, 10, 16, 22, 28, 635, 636, 637, 639, 0, 10, 332,
+    4016, 4017, 4018, 4019, 4020, 504, 635, 636, 637, 639, 0, 385, 10, 439, 243, 28,
+    637, 1077, 10, 4, 1175, 23, 194, 207, 443, 452, 507, 1703, 518, 382, 639, 55,
+    57, 63, 1759, 778, 68, 217, 221, 231, 28, 635, 639, 7, 4, 18, 11, 393,
+    28, 636, 181, 1349, 28, 105, 111, 1407, 393, 397, 409, 1411, 1413, 507, 1543, 1544,
+    14, 1843, 1548, 1549, 1901, 884, 243, 250, 953, 1077, 28, 20, 60, 1210, 403, 406,
+    101, 108, 111, 114, 155, 164, 168, 175, 178, 1916, 468, 482, 1923, 504, 510, 6,
+    1412, 151, 306, 482, 68, 17, 0, 385, 56, 57, 635, 636, 2001, 101, 10, 128,
+    11, 190, 247, 13, 351, 498, 8, 635, 636, 636, 245, 18, 482, 64, 67, 68,
+    309, 1240, 68, 246, 247, 14, 19, 28, 635, 637, 2, 1411, 2, 28, 237, 2,
+    104, 2138, 2, 442, 2612, 1893, 1926, 940, 635, 636, 637, 639, 0, 635, 636, 637,
+    639, 0, 385, 507, 376, 378, 9, 379, 383, 22, 28, 969, 636, 637, 639, 0,
+    2339, 2340, 2341, 148, 154, 158, 2352, 2361, 2362, 2363, 2364, 2392, 2410, 2411, 2412, 2414,
+    2415, 2416, 2417, 2430, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445,
+    2446, 2447, 2448, 2614, 53, 68, 158, 246, 328, 3291, 3296, 3299, 3300, 3306, 3312, 3319,
+    3320, 3321, 3322, 951, 156, 440, 21, 243, 1944, 636, 639, 639, 249, 687, 14, 2030,
+    1120, 1554, 635, 636, 715, 639, 0, 1218, 243, 247, 250, 3671, 635, 636, 637, 639,
+    0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 951, 376, 378, 9, 379,
+    383, 22, 28, 2005, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 635, 636, 637, 639, 0,
+    1663, 708, 1278, 635, 636, 637, 639, 0, 1557, 54, 58, 9, 61, 65, 70, 71,
+    2471, 693, 3982, 3983, 3984, 3985, 3986, 376, 378, 9, 379, 383, 843, 28, 635, 636,
+    637, 639, 0, 376, 378, 9, 379, 383, 22, 28, 2, 376, 378, 9, 379, 383,
+    22, 28, 635, 636, 715, 639, 0, 376, 378, 9, 379, 383, 22, 28, 635, 636,
+    637, 639, 0, 245, 382, 387, 1808, 1809, 1810, 639, 0, 635, 636, 637, 639, 0,
+    1790, 636, 637, 639, 0, 708, 1278, 635, 636, 637, 639, 0, 635, 636, 637, 639,
+    0, 2389, 463, 2392, 3296, 1230, 383, 386, 507, 635, 636, 715, 639, 0, 247, 155,
+    957, 1555, 482, 478, 635, 376, 378, 9, 379, 383, 22, 28, 158, 14, 4560, 1799,
+    443, 1809, 635, 636, 715, 639, 0, 808, 376, 378, 9, 379, 383, 22, 28, 332,
+    635, 636, 637, 639, 0, 4090, 4091, 4092, 4093, 4094, 635, 636, 637, 639, 0, 149,
+    635, 636, 637, 639, 0, 148, 158, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 376, 378,
+    9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 510, 635, 636, 715, 639, 0,
+    635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635,
+    636, 637, 639, 0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 969, 636,
+    637, 639, 0, 4348, 708, 635, 636, 637, 639, 0, 4432, 245, 376, 378, 9, 379,
+    383, 22, 28, 28, 1964, 1790, 636, 637, 639, 0, 1790, 636, 637, 639, 0, 382,
+    3703, 468, 2, 1707, 635, 636, 715, 639, 0, 1671, 243, 354, 635, 636, 637, 639,
+    0, 635, 636, 637, 639, 0, 690, 693, 698, 454, 332, 2948, 1555, 679, 635, 636,
+    715, 639, 0, 1778, 507, 406, 1288, 708, 635, 636, 637, 639, 0, 635, 636, 637,
+    639, 0, 635, 636, 637, 639, 0, 969, 636, 637, 639, 0, 376, 378, 9, 379,
+    383, 22, 28, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635, 636, 637,
+    639, 0, 2907, 2912, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635, 636,
+    715, 639, 0, 376, 378, 9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 635,
+    636, 637, 639, 0, 68, 969, 636, 637, 639, 0, 635, 636, 637, 639, 0, 635,
+    636, 637, 639, 0, 2389, 53, 68, 382, 639, 708, 955, 1664, 1795, 1799, 1808, 1809,
+    1810, 639, 0, 635, 636, 715, 639, 0, 1664, 635, 636, 637, 639, 0, 635, 636,
+    637, 639, 0, 635, 636, 637, 639, 0, 635, 636, 715, 639, 0, 56, 63, 1393,
+    69, 161, 162, 244, 245, 246, 248, 11, 13, 251, 252, 1406, 385, 3, 1419, 20,
+    635, 636, 637, 639, 0, 90, 300, 313, 317, 690, 693, 501, 945, 951, 101, 635,
+    636, 637, 639, 0, 635, 636, 637, 639, 0, 1732, 635, 636, 715, 639, 0, 952,
+    1790, 636, 637, 639, 0, 1666, 1963, 931, 312, 474, 2, 2062, 312, 2, 2080, 312,
+    2, 302, 1268, 328, 364, 1274, 468, 494, 53, 68, 148, 158, 375, 386, 1666, 1782,
+    1963, 931, 312, 474, 2, 302, 312, 2, 2062, 312, 2, 2080, 312, 1782, 1963, 931,
+    312, 474, 1098, 1099, 2, 2062, 312, 2, 2080, 312, 53, 68, 148, 158, 375, 386,
+    1963, 931, 312, 474, 2, 302, 312, 2, 2062, 312, 2, 2080, 312, 2392, 955, 1278,
+    708, 251, 3208, 1098, 1099, 53, 1024, 375, 386, 375, 942, 9, 250, 207, 6, 1272,
+    62, 690, 389, 6, 957, 1115, 1267, 152, 956, 1567, 155, 62, 105, 155, 1348, 1554,
+    883, 249, 637, 517, 5564, 377, 252, 15, 19, 1122, 1561, 945, 946, 954, 457, 698,
+    442, 1725, 408, 408, 1275, 922, 64, 155, 14, 527, 306, 190, 27, 245, 150, 9,
+    155, 639, 8, 1122, 940, 105, 132, 455, 840, 246, 637, 670, 62, 1400, 353, 1725,
+    2, 302, 1467, 28, 368, 2033, 5884, 452, 22, 1808, 5889, 1810, 639, 0, 306, 14,
+    252, 13, 840, 842, 2, 10, 1664, 55, 1695, 1815, 478, 1927, 1928, 2118, 408, 669,
+    6, 67, 2080, 324, 328, 934, 445, 947, 954, 2083, 101, 1105, 2, 302, 3209, 312,
+    28, 339, 1108, 355, 22, 1120, 1122, 2, 624, 393, 3212, 23, 1363, 2, 302, 312,
+    28, 439, 443, 15, 1566, 17, 0, 132, 28, 325, 385, 67, 2, 1097, 79, 28,
+    1558, 1103, 385, 639, 354, 638, 28, 251, 252, 637, 450, 19, 23, 17, 635, 482,
+    20, 207, 1120, 1122, 2, 28, 8, 27, 11, 1560, 699, 155, 1358, 636, 637, 14,
+    1108, 155, 1098, 1099, 123, 4, 18, 498, 21, 636, 639, 19, 1548, 306, 28, 1788,
+    17, 159, 28, 22, 97, 14, 494, 1411, 1702, 1414, 516, 639, 150, 154, 400, 1786,
+    393, 1411, 1413, 507, 516, 385, 639, 247, 478, 1923, 15, 105, 245, 132, 28, 2,
+    2124, 482, 332, 354, 339, 80, 1269, 8, 638, 2074, 128, 16, 28, 369, 3081, 351,
+    64, 4992, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 708, 4585, 635, 636,
+    637, 639, 0, 635, 636, 637, 639, 0, 1548, 635, 636, 637, 639, 0, 635, 636,
+    715, 639, 0, 635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 245, 247, 376,
+    378, 9, 379, 383, 22, 28, 246, 62, 635, 636, 639, 1557, 6, 16, 251, 105,
+    1112, 1116, 153, 155, 380, 1566, 635, 636, 639, 1543, 1544, 14, 1546, 1548, 1549, 2,
+    6, 16, 28, 162, 636, 11, 443, 28, 636, 839, 1288, 249, 14, 55, 56, 2069,
+    14, 443, 22, 380, 62, 635, 10, 198, 382, 443, 783, 306, 841, 22, 353, 940,
+    67, 150, 2, 385, 2898, 150, 1411, 8, 2910, 387, 3, 157, 155, 128, 132, 248,
+    507, 17, 14, 64, 155, 309, 1239, 11, 1411, 155, 1103, 158, 636, 639, 1557, 64,
+    64, 635, 4, 217, 221, 128, 1787, 10, 635, 636, 637, 639, 0, 3630, 328, 955,
+    3650, 3651, 3652, 3703, 3711, 3712, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728,
+    3729, 3730, 3731, 708, 955, 1100, 1218, 4956, 4970, 4971, 4977, 4991, 4992, 376, 378, 9,
+    379, 383, 22, 28, 376, 941, 9, 379, 383, 22, 943, 498, 332, 4472, 376, 378,
+    9, 379, 383, 22, 28, 635, 636, 637, 639, 0, 3082, 3083, 3084, 3085, 3086, 3087,
+    3088, 2586, 2587, 2588, 2589, 2590, 2389, 2139, 2143, 635, 636, 715, 639, 0, 1786, 1671,
+    635, 636, 637, 639, 0, 635, 636, 637, 639, 0, 53, 68, 635, 636, 637, 639,
+    0, 635, 636, 637, 639, 0, 123, 10, 28, 574, 1566, 1972, 1274, 468, 474, 475,
+    1281, 1103, 940, 482, 397, 635, 636, 637, 639, 0, 464, 323, 1108, 368, 2655, 8,
+    2675, 635, 636, 637, 639, 0, 955, 4196, 4197, 4198, 4199, 4200, 635, 636, 637, 639,
+    0, 1463, 5857, 2139, 2143, 1098, 1099, 635, 636, 637, 639, 0, 637, 2969, 162, 69,
+    2458, 140, 1668, 1671, 97, 247, 454, 482, 1658, 2611, 635, 636, 637, 639, 0, 4374,
+    4375, 4376, 4389, 635, 636, 637, 639, 0, 464, 708, 1272, 1566, 2390, 2655, 2671, 23,
+    2390, 99, 670, 687, 690, 501, 967, 0, 1097, 105, 1100, 16, 194, 198, 1106, 2,
+    16, 28, 318, 1122, 1123, 494, 498, 504, 516, 101, 439, 88, 482, 6, 111, 490,
+    132, 1671, 28, 53, 1796, 375, 1805, 162, 10, 2392, 53, 68, 148, 158, 375, 386,
+    2, 302, 312, 53, 68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386, 53,
+    68, 148, 158, 375, 386, 148, 1217, 386, 2006, 148, 1398, 1399, 155, 148, 1425, 154,
+    155, 708, 955, 1278, 2392, 2614, 53, 68, 148, 158, 375, 386, 2, 302, 312, 53,
+    68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386, 53, 68, 148, 158, 375,
+    386, 2614, 53, 68, 148, 158, 375, 386, 2, 302, 312, 1895, 1896, 1897, 1899, 53,
+    68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386, 708, 955, 1278, 53, 68,
+    148, 158, 375, 386, 2, 302, 312, 53, 68, 148, 158, 375, 386, 53, 68, 148,
+    158, 375, 386, 53, 68, 148, 158, 375, 386, 463, 1895, 1896, 1897, 1899, 708, 1278,
+    1789, 2004, 247, 2153, 937, 940, 15, 6696, 104, 2149, 1808, 693, 325, 244, 27, 55,
+    105, 221, 368, 1566, 1734, 23, 2, 635, 6858, 468, 477, 28, 8, 14, 17, 27,
+    64, 2390, 1543, 384, 2913, 2914, 55, 498, 1778, 157, 68, 1810, 157, 4827, 635, 636,
+    639, 406, 5, 1937, 4831, 635, 636, 639, 156, 10, 17, 249, 637, 90, 1277, 455,
+    635, 637, 2, 16, 953, 19, 132, 638, 1562, 450, 23, 482, 635, 207, 2, 150,
+    937, 15, 6, 940, 635, 639, 97, 498, 27, 637, 1437, 391, 635, 6, 61, 328,
+    1426, 635, 14, 923, 328, 302, 155, 150, 56, 14, 22, 637, 1566, 155, 155, 17,
+    105, 249, 637, 498, 1411, 516, 2001, 635, 636, 639, 490, 1258, 504, 516, 57, 6317,
+    5994, 2119, 1099, 155, 635, 636, 637, 639, 0, 306, 1919, 27, 1925, 368, 309, 635,
+    636, 639, 638, 28, 2, 6, 16, 155, 636, 325, 2023, 79, 669, 306, 158, 4,
+    13, 250, 28, 1028, 158, 1725, 1175, 453, 20, 706, 63, 450, 922, 2069, 207, 881,
+    27, 888, 10, 940, 64, 945, 15, 1554, 1555, 10, 105, 243, 1218, 5323, 5324, 5347,
+    5348, 5349, 5350, 5351, 5352, 5353, 57, 1964, 6245, 6270, 6271, 6285, 6317, 635, 636, 637,
+    639, 0, 1790, 636, 637, 639, 0, 700, 635, 636, 637, 639, 0, 4597, 4598, 4599,
+    4600, 4601, 3322, 708, 637, 14, 637, 243, 10, 386, 2006, 474, 1398, 2, 302, 312,
+    328, 2015, 252, 67, 482, 483, 203, 3322, 1895, 63, 1896, 1897, 1899, 1557, 4454, 638,
+    490, 2402, 1412, 5876, 5895, 1394, 2004, 2152, 3670, 527, 3670, 105, 498, 1226, 15, 1894,
+    250, 28, 53, 68, 375, 386, 637, 635, 2, 1414, 23, 385, 635, 1466, 639, 56,
+    482, 153, 3, 67, 249, 2402, 635, 2650, 2664, 969, 246, 252, 708, 955, 1278, 53,
+    68, 148, 158, 375, 386, 708, 955, 1278, 708, 955, 1278, 708, 955, 1278, 1963, 931,
+    312, 1278, 2, 2062, 312, 328, 364, 2, 2080, 312, 328, 364, 708, 955, 1278, 53,
+    68, 148, 158, 375, 386, 708, 955, 1278, 708, 955, 1278, 708, 955, 1278, 708, 955,
+    1278, 53, 68, 148, 158, 375, 386, 2878, 2880, 708, 955, 1278, 708, 955, 1278, 708,
+    955, 1278, 53, 68, 148, 158, 375, 386, 708, 955, 1278, 708, 955, 1278, 708, 955,
+    1278, 2878, 2880, 4378, 155, 55, 635, 636, 639, 339, 391, 408, 693, 374, 4392, 945,
+    16, 16, 15, 517, 245, 354, 159, 27, 1351, 21, 1218, 332, 519, 1218, 4, 1560,
+    937, 397, 15, 245, 1466, 639, 1568, 635, 1466, 639, 149, 940, 245, 27, 2912, 27,
+    10, 638, 15, 87, 56, 3119, 13, 1175, 382, 639, 482, 155, 62, 1964, 6577, 671,
+    673, 2969, 6969, 7012, 7013, 7041, 15, 332, 1560, 14, 1278, 474, 2, 302, 312, 2,
+    2062, 312, 53, 68, 148, 158, 375, 386, 148, 1217, 2070, 1425, 364, 686, 2878, 2880,
+    3081, 5326, 252, 5326, 23, 1107, 947, 382, 639, 708, 1278, 64, 10, 669, 1546, 1843,
+    708, 955, 1278, 53, 68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386, 148,
+    386, 53, 68, 148, 158, 375, 386, 148, 386, 708, 955, 1278, 708, 955, 1278, 708,
+    955, 1278, 5884, 1964, 1224, 128, 252, 23, 374, 1566, 2969, 7231, 885, 4454, 355, 332,
+    338, 2, 302, 312, 53, 68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386,
+    708, 955, 1278, 1963, 931, 312, 2, 2080, 312, 1218, 6576, 489, 508, 6576, 1910, 243,
+    1566, 369, 708, 955, 1278, 708, 955, 1278, 1278, 708, 955, 1278, 1278, 6858, 468, 477,
+    28, 883, 4454, 955, 53, 68, 148, 158, 375, 386, 708, 955, 1278, 708, 955, 1278,
+    53, 68, 148, 158, 375, 386, 53, 68, 148, 158, 375, 386, 1964, 1460, 1094, 635,
+    636, 639, 708, 955, 1278, 708, 955, 1278, 708, 955, 1278, 2969, 4454,
+};
+
+constexpr uint16_t es_levels[] = {
+    0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 33, 65, 65,
+    65, 0, 65, 65, 0, 0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 129, 129, 129, 129, 129, 129, 0,
+    129, 129, 161, 129, 129, 129, 129, 161, 129, 129, 0, 129, 129, 129, 129, 129,
+    97, 0, 129, 129, 129, 0, 129, 129, 193, 0, 129, 129, 161, 129, 129, 0,
+    129, 129, 161, 129, 129, 0, 129, 129, 129, 129, 129, 0, 97, 129, 129, 129,
+    0, 129, 129, 129, 0, 129, 129, 129, 129, 129, 129, 129, 161, 129, 129, 129,
+    129, 129, 129, 129, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 97, 0, 129, 129, 129, 0, 129, 129, 129, 0, 129, 129, 161,
+    129, 129, 0, 129, 129, 161, 129, 129, 129, 129, 129, 129, 129, 97, 0, 129,
+    129, 129, 0, 129, 129, 129, 0, 129, 129, 161, 129, 129, 0, 129, 129, 161,
+    129, 129, 0, 129, 129, 129, 129, 129, 97, 0, 129, 129, 129, 0, 129, 129,
+    129, 0, 129, 129, 129, 129, 129, 0, 129, 129, 129, 129, 129, 0, 129, 129,
+    129, 129, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 129, 129,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 97, 129, 129, 129, 129, 129, 129, 0, 129, 129, 161, 129, 129,
+    129, 129, 161, 129, 129, 129, 129, 129, 129, 129, 97, 129, 129, 129, 0, 129,
+    129, 129, 0, 129, 129, 193, 129, 129, 0, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 97, 0, 129, 129, 129, 0, 129, 129, 129, 0, 129, 129, 129,
+    129, 129, 0, 129, 129, 129, 129, 129, 0, 129, 129, 129, 129, 129, 97, 0,
+    129, 129, 129, 0, 129, 129, 129, 129, 129, 129, 129, 129, 0, 129, 129, 129,
+    129, 129, 129, 129, 129, 129, 129, 97, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 97, 0, 129, 129, 129, 0, 129, 129, 129, 0, 129, 129,
+    161, 129, 129, 0, 129, 129, 161, 129, 129, 0, 129, 129, 129, 129, 129, 97,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    0, 129, 129, 129, 129, 129, 97, 0, 129, 129, 129, 0, 129, 129, 129, 129,
+    129, 129, 129, 129, 0, 129, 129, 161, 129, 129, 129, 129, 129, 129, 129, 97,
+    0, 129, 129, 129, 0, 129, 129, 129, 129, 129, 129, 129, 129, 0, 129, 129,
+    129, 129, 129, 0, 129, 129, 129, 129, 129, 97, 0, 129, 129, 129, 0, 129,
+    129, 129, 0, 129, 129, 226, 129, 129, 0, 129, 129, 161, 226, 129, 0, 129,
+    129, 226, 129, 226, 0, 0, 0, 0, 97, 129, 129, 129, 129, 129, 129, 0,
+    129, 129, 161, 129, 129, 129, 129, 161, 129, 129, 129, 129, 129, 129, 129, 97,
+    0, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 129, 129, 129, 97, 129, 129, 129, 0, 129, 129, 129, 0, 129,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 97, 129,
+    129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    129, 129, 129, 129, 97, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+    0, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 0, 0, 0, 273, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 0, 0, 0, 0, 0, 353,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0, 0, 0,
+    0, 353, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 419, 419, 419, 419,
+    419, 0, 0, 0, 0, 353, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 419, 419, 419, 419, 353,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 419, 419, 0, 0, 0, 0, 419, 419, 419, 0, 0,
+    419, 419, 353, 385, 385, 385, 385, 385, 385, 385, 385, 529, 385, 385, 385, 385,
+    529, 385, 385, 385, 385, 385, 385, 385, 0, 0, 0, 0, 353, 482, 482, 482,
+    0, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 419, 353, 0, 0, 0, 0, 0, 0, 0, 419, 419, 419, 353,
+    482, 482, 482, 482, 482, 482, 0, 482, 482, 482, 482, 482, 0, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 353, 419, 419, 0, 0, 353, 0, 419, 419,
+    419, 0, 0, 0, 0, 0, 419, 419, 0, 419, 419, 419, 419, 353, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 419, 419, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 562, 0, 0,
+    353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    353, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 0, 0, 353, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 353, 0,
+    0, 0, 0, 0, 0, 353, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 0, 482, 482, 482, 482, 482, 353, 0, 353, 0,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 609, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 609, 0, 0,
+    0, 0, 0, 0, 0, 353, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 353, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 419, 419, 419, 0, 419, 419, 0, 0, 0, 0, 353, 385, 385, 385, 385,
+    385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385, 385,
+    385, 419, 0, 419, 419, 419, 419, 419, 0, 641, 0, 0, 419, 419, 419, 0,
+    0, 0, 0, 0, 0, 0, 419, 419, 0, 0, 0, 0, 419, 353, 0, 0,
+    0, 419, 419, 419, 419, 419, 0, 0, 0, 0, 419, 419, 419, 0, 0, 0,
+    0, 0, 419, 419, 419, 385, 0, 419, 419, 419, 0, 419, 419, 306, 0, 306,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 0,
+    482, 482, 482, 482, 482, 353, 0, 0, 0, 353, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 0, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    353, 0, 353, 0, 0, 0, 0, 0, 0, 0, 419, 419, 419, 0, 0, 419,
+    419, 0, 419, 0, 419, 419, 419, 353, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 419, 419, 673,
+    0, 0, 0, 419, 419, 419, 0, 0, 0, 0, 419, 419, 419, 0, 0, 0,
+    419, 419, 419, 0, 0, 0, 0, 419, 419, 0, 0, 0, 0, 419, 419, 419,
+    0, 0, 0, 0, 419, 419, 0, 419, 0, 419, 419, 419, 353, 0, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 0, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 353, 419, 419, 0, 353, 0, 0, 0, 0, 0, 0, 0,
+    353, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 353, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 0, 419, 419, 419,
+    0, 0, 419, 419, 0, 419, 419, 419, 419, 419, 419, 419, 419, 419, 419, 419,
+    419, 419, 419, 419, 419, 419, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0,
+    0, 0, 0, 353, 353, 0, 0, 0, 0, 0, 0, 353, 353, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 706,
+    753, 706, 0, 786, 706, 0, 0, 0, 0, 835, 835, 898, 835, 835, 835, 0,
+    835, 835, 898, 835, 835, 835, 0, 0, 0, 835, 835, 898, 835, 835, 0, 835,
+    0, 0, 0, 0, 0, 0, 0, 0, 706, 786, 706, 706, 706, 0, 0, 0,
+    0, 0, 0, 0, 0, 946, 994, 0, 0, 0, 0, 0, 0, 0, 994, 0,
+    0, 0, 0, 0, 0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1041, 0, 0, 0, 0, 1041, 0, 994, 0, 0, 0, 0, 994,
+    0, 0, 0, 0, 1073, 1073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1105, 1138, 1138,
+    753, 1138, 0, 1138, 1138, 0, 0, 0, 1186, 1186, 1186, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1186,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1138, 1138, 753, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 706, 0, 0, 0, 0, 0, 0, 0, 1041, 1234, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1138, 1138,
+    753, 1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1281, 0, 1314, 0, 1314, 0, 0, 0, 0, 0, 1362,
+    994, 0, 0, 994, 0, 1041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1041, 0, 0, 0, 0, 1281, 0, 0, 0, 1138, 1138, 753, 1138, 1138, 1138,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1409, 1409, 1409, 1409, 1409,
+    1442, 1409, 1409, 1409, 1409, 1409, 1409, 0, 0, 0, 0, 0, 0, 1041, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1138, 1138, 753,
+    1138, 1138, 1138, 0, 0, 0, 0, 0, 0, 0, 946, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1281, 0, 0, 0, 1314, 0, 0, 1314, 0, 0,
+    994, 0, 0, 0, 0, 1186, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1490, 1490, 0, 1186, 1186, 0, 0, 0,
+    0, 0, 1537, 1537, 1537, 0, 0, 0, 0, 0, 0, 0, 0, 1569, 0, 0,
+    0, 0, 0, 0, 0, 0, 1073, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1602, 0, 0, 0, 1138, 1138, 753, 1138, 1138, 1138, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1041, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1041, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1041, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1649, 1649, 0, 1681, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1714,
+    1714, 1714, 1714, 1714, 1763, 1714, 1826, 1714, 1714, 1714, 0, 1681, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1875, 1875, 1875, 1875, 1875, 0, 0, 0, 0, 0, 1875,
+    1875, 1875, 1875, 1875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1937, 0, 0, 1937, 0, 0, 0, 0, 0,
+    0, 1875, 1875, 1875, 1875, 1875, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 2050, 2050,
+    2017, 2050, 2050, 2050, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2098, 0, 2098, 2098, 0, 0, 2098, 1937, 2146, 0, 0, 0, 0, 0, 0, 1714,
+    1714, 1714, 1714, 1714, 0, 2194, 2243, 2243, 1826, 2243, 2243, 0, 2243, 0, 0, 0,
+    0, 0, 0, 0, 2306, 2306, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    2306, 0, 0, 2353, 0, 2353, 0, 2353, 0, 2306, 0, 0, 2306, 2353, 1970, 1970,
+    2017, 1970, 1970, 1970, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017,
+    1970, 1970, 1970, 0, 0, 2385, 0, 0, 2306, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 2306, 2306, 0, 0, 0,
+    2306, 2306, 2306, 0, 2306, 0, 2419, 0, 2419, 0, 2419, 0, 2482, 0, 2306, 2306,
+    2419, 2419, 2306, 0, 0, 2306, 0, 0, 0, 0, 0, 2306, 2306, 2353, 0, 0,
+    2353, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 2529, 2529, 2529, 2529,
+    2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 2529, 0, 2562, 2562, 2562, 2562, 2562,
+    0, 0, 0, 0, 0, 0, 2017, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 2610, 0, 2146, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2657, 0, 0,
+    0, 0, 2657, 2690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2562, 2562, 2562, 2562, 2562, 1970,
+    1970, 2017, 1970, 1970, 1970, 0, 0, 0, 0, 2353, 0, 2353, 0, 2353, 0, 2306,
+    0, 2353, 0, 0, 0, 0, 2306, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970,
+    2017, 1970, 1970, 1970, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0,
+    0, 2738, 0, 0, 0, 2738, 0, 0, 0, 0, 2738, 0, 0, 0, 0, 0,
+    2353, 0, 2353, 0, 2353, 0, 2353, 0, 2306, 2353, 2353, 2306, 0, 0, 0, 0,
+    0, 2306, 0, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970,
+    1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 0,
+    0, 1937, 0, 0, 1937, 1937, 0, 1937, 1937, 0, 0, 0, 1937, 1937, 1937, 1937,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970,
+    1970, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0,
+    0, 2562, 2562, 2562, 2562, 2562, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0,
+    0, 2785, 0, 0, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970,
+    1970, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 1970, 1970,
+    2017, 1970, 1970, 1970, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 1970, 1970,
+    2017, 1970, 1970, 1970, 0, 0, 0, 0, 2482, 0, 2482, 0, 0, 0, 2818, 0,
+    2818, 2866, 0, 2306, 0, 0, 0, 2306, 0, 0, 0, 2353, 0, 0, 0, 2913,
+    0, 0, 2913, 0, 0, 2913, 0, 0, 0, 0, 0, 1937, 0, 2353, 0, 0,
+    0, 0, 0, 2353, 0, 2562, 2562, 2562, 2562, 2562, 2353, 0, 0, 1970, 1970, 2017,
+    1970, 1970, 1970, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017,
+    1970, 1970, 1970, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0,
+    1970, 1970, 2017, 1970, 0, 1970, 1970, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 0, 0, 2562, 2562, 2562, 2562, 2562, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0,
+    0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    2866, 0, 2866, 0, 0, 2947, 0, 0, 0, 0, 0, 1970, 1970, 2017, 1970, 1970,
+    1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 2353, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 2818, 2818, 0, 2306, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0,
+    0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 0, 0, 0, 0, 0, 0, 3010, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3057, 3057, 3057, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0,
+    1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 3010, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 0, 0, 0, 0, 3089, 0, 3089, 0, 3089, 0, 0, 0, 0, 3121,
+    0, 0, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970,
+    0, 0, 2353, 0, 0, 2690, 2690, 1970, 1970, 2017, 1970, 1970, 1970, 0, 0, 0,
+    0, 0, 0, 0, 3154, 0, 0, 0, 3201, 1970, 1970, 2017, 1970, 1970, 1970, 0,
+    0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970, 1970, 2017, 1970, 1970, 1970, 0, 1970,
+    1970, 2017, 1970, 1970, 1970, 0, 2562, 2562, 2562, 2562, 2562, 0, 0, 0, 0, 0,
+    2353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2353, 0, 0, 0, 0, 0, 0, 0, 0, 2353, 2353, 0, 3234, 0, 3234, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2385, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 0, 0, 0, 3362, 0, 0, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3409, 0, 0,
+    0, 0, 3442, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3489, 3521, 0, 3553, 0, 3586, 0, 3489, 0, 0, 0,
+    0, 3553, 3553, 0, 3635, 3698, 3698, 3698, 3698, 0, 0, 0, 0, 0, 0, 3745,
+    0, 0, 0, 3553, 3553, 3553, 0, 0, 3777, 3809, 0, 3809, 0, 3809, 0, 0,
+    0, 0, 3489, 3489, 3489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3329,
+    0, 0, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3891, 3891, 3954, 3891, 3891, 0, 3891,
+    0, 0, 0, 3842, 3842, 3842, 3842, 3842, 0, 0, 0, 0, 4002, 4002, 4002, 4002,
+    4002, 0, 3745, 0, 0, 0, 0, 0, 4050, 0, 0, 0, 0, 0, 0, 0,
+    0, 3745, 0, 3745, 3745, 3745, 0, 0, 0, 0, 0, 0, 0, 3553, 3745, 3745,
+    3745, 0, 3553, 3745, 3745, 3745, 0, 0, 0, 0, 0, 3553, 0, 0, 3745, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3745, 0, 0, 0, 0, 0, 0, 4099, 4099, 4099,
+    4099, 4099, 0, 0, 0, 0, 4002, 4002, 3954, 4002, 4002, 4002, 0, 0, 4162, 4209,
+    0, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 4241, 4241,
+    4241, 4241, 4162, 0, 0, 3842, 3842, 3842, 3842, 3842, 0, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 4275, 0, 4337, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842,
+    3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842,
+    3282, 3282, 3329, 3282, 3282, 3282, 0, 4162, 3282, 3282, 3329, 3282, 3282, 3282, 0, 4162,
+    0, 4162, 4162, 4275, 4275, 4275, 4275, 4162, 4162, 0, 4162, 4162, 0, 0, 0, 0,
+    4162, 4162, 0, 4241, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3842, 3842, 3842, 3842,
+    3842, 4369, 0, 0, 0, 0, 0, 4402, 3282, 3282, 3329, 3282, 3282, 3282, 0, 4241,
+    0, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    4451, 4451, 3954, 4451, 4451, 4514, 4451, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842,
+    3842, 3842, 3842, 3842, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3282, 3282, 3329,
+    3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3842, 3842, 3842, 3842,
+    3842, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282,
+    0, 0, 0, 3842, 3842, 3842, 3842, 3842, 4561, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 0, 0, 0, 0, 0, 0, 3489,
+    0, 0, 0, 0, 4593, 4593, 0, 0, 0, 0, 0, 4561, 4561, 4561, 4561, 4561,
+    4561, 4626, 0, 4626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4674, 0, 0,
+    0, 0, 0, 0, 0, 4561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4626, 4626, 4561, 4626, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4722, 4722, 0, 4722, 4722, 0, 0, 0, 0,
+    0, 0, 4722, 0, 4722, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4770,
+    0, 4561, 0, 4561, 0, 4241, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842,
+    3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 4241, 4241, 4241, 4241, 4162,
+    4241, 4818, 0, 4241, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 4865, 0,
+    3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 4899, 0, 0, 0,
+    0, 4899, 0, 4899, 0, 0, 0, 4899, 0, 0, 0, 4899, 0, 0, 0, 0,
+    0, 0, 0, 0, 4899, 0, 0, 0, 0, 0, 0, 4162, 0, 0, 0, 0,
+    4241, 4241, 4241, 4241, 0, 0, 4162, 0, 0, 4162, 0, 0, 4162, 4162, 0, 0,
+    0, 0, 4162, 0, 0, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 0, 3745, 4561, 3745, 0, 0, 3745, 3745, 3745, 3745, 3745, 3745,
+    0, 3745, 3745, 3745, 3745, 3745, 0, 0, 3745, 0, 0, 3745, 0, 3745, 3745, 0,
+    0, 4961, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3745, 3745, 3745, 3745, 0, 3553, 3553,
+    3553, 3553, 3553, 0, 3553, 3553, 3553, 3553, 3553, 4993, 0, 3282, 3282, 3329, 3282, 3282,
+    3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 0, 0, 0, 3842, 3842, 3842, 3842,
+    3842, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 5025, 0, 5025, 5025, 0, 5025, 3282,
+    3282, 3329, 3282, 3282, 0, 3282, 0, 0, 0, 0, 0, 3842, 3842, 3842, 3842, 3842,
+    3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0,
+    0, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 0, 3282, 3282, 3329, 3282,
+    3282, 3282, 0, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    4451, 4451, 3954, 4451, 4451, 4514, 4451, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329,
+    3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    3842, 3842, 3842, 3842, 3842, 5057, 0, 5057, 0, 5089, 5089, 5122, 5122, 5169, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 4162, 0, 0,
+    0, 0, 4162, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 0, 5201, 5201, 0,
+    0, 5201, 0, 5201, 0, 5201, 3745, 3745, 0, 0, 0, 0, 0, 0, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 3553, 5089, 0, 0, 4241, 4241, 3282, 3282, 3329, 3282, 3282,
+    3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 0,
+    5025, 3282, 3282, 3329, 3282, 3282, 3282, 0, 5233, 3842, 3842, 3842, 3842, 3842, 0, 0,
+    3842, 3842, 3842, 3842, 3842, 0, 5089, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+    3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 4593, 0, 3842, 3842, 3842, 3842, 3842, 3282,
+    3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282,
+    3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282,
+    3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842,
+    3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    5269, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 5362, 5362, 5410, 0, 5410,
+    0, 5459, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 0, 3842, 3842, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 0,
+    0, 3842, 3842, 3842, 3842, 3842, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 0, 0, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329,
+    3282, 3282, 3282, 0, 0, 0, 0, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842,
+    3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 5522, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 0, 0, 0, 5570, 3842, 3842, 3842, 3842, 3842, 3282, 3282,
+    3329, 3282, 3282, 3282, 0, 0, 0, 0, 5618, 0, 3745, 0, 5570, 3282, 3282, 3329,
+    3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282,
+    3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282,
+    0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0,
+    0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329,
+    3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 5667, 5667, 5730,
+    5667, 5667, 5667, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282,
+    3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 0, 0, 0, 5777, 0, 0,
+    0, 4451, 4451, 3954, 4451, 4451, 4514, 4451, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    4241, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842, 3842, 3842, 4002, 4002, 3954,
+    4002, 4002, 4002, 0, 0, 0, 0, 0, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282,
+    0, 3282, 3282, 3329, 3282, 3282, 3282, 0, 0, 3282, 3282, 3329, 3282, 3282, 3282, 0,
+    0, 3842, 3842, 3842, 3842, 3842, 3282, 3282, 3329, 3282, 3282, 3282, 0, 3842, 3842, 3842,
+    3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 3842, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4241,
+    0, 5810, 0, 5810, 5810, 5810, 4241, 0, 4241, 0, 5859, 0, 0, 0, 5810, 0,
+    0, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5969, 0, 0, 0,
+    6002, 0, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 0, 0, 0,
+    0, 0, 0, 0, 5969, 0, 5969, 6049, 0, 6049, 0, 0, 5969, 0, 5969, 5969,
+    5969, 0, 6049, 5969, 6081, 0, 6081, 6081, 0, 6113, 6146, 0, 0, 0, 0, 0,
+    6081, 0, 6193, 0, 6049, 0, 6049, 0, 0, 0, 6113, 6049, 6049, 6049, 6049, 0,
+    6113, 6113, 6113, 6113, 0, 6113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6049, 5969, 0, 5969, 0, 0, 0, 0, 0, 0, 0, 5969, 5969, 0,
+    0, 0, 0, 0, 5969, 0, 5969, 6049, 6049, 0, 0, 0, 6049, 0, 6049, 0,
+    0, 6227, 6227, 6290, 6227, 6227, 6338, 6227, 0, 0, 0, 0, 0, 0, 0, 6387,
+    6449, 6449, 5922, 5922, 5922, 5922, 5922, 0, 0, 0, 0, 0, 6482, 0, 0, 0,
+    0, 0, 0, 6049, 0, 0, 0, 6049, 0, 0, 0, 0, 0, 0, 6049, 0,
+    0, 0, 0, 0, 0, 0, 0, 6531, 6531, 6531, 6531, 6531, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5969, 0, 0, 5969, 0, 0, 0, 5969, 5969, 5969, 5969, 0,
+    0, 0, 0, 5969, 0, 5969, 0, 5969, 0, 0, 5969, 0, 0, 0, 6049, 6049,
+    6049, 5969, 0, 6049, 6049, 0, 6049, 6049, 5969, 0, 0, 5969, 5969, 5969, 5969, 0,
+    0, 0, 0, 0, 0, 0, 6049, 0, 0, 0, 0, 0, 0, 0, 0, 6594,
+    6594, 0, 6002, 5969, 5969, 6641, 0, 0, 0, 0, 0, 0, 0, 6146, 0, 0,
+    0, 0, 0, 5969, 6674, 6674, 0, 0, 0, 6722, 0, 0, 0, 0, 6770, 6770,
+    6770, 6770, 6770, 6818, 0, 6866, 5922, 5922, 5922, 5922, 5922, 6866, 6866, 0, 0, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 6866, 6866, 6866, 0, 6866, 6866, 6913, 5922, 5922, 5922, 5922, 5922, 6946,
+    6946, 6993, 6946, 6946, 6946, 0, 7025, 6946, 6946, 6993, 6946, 6946, 6946, 0, 0, 7058,
+    0, 5922, 5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 6946, 6946, 6993,
+    6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 7107, 7107,
+    7107, 7107, 7107, 5922, 5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922,
+    5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5969, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922,
+    5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922, 0, 0,
+    5922, 5922, 5922, 5922, 5922, 0, 5922, 5922, 5922, 5922, 5922, 7171, 0, 0, 7171, 0,
+    0, 7234, 0, 0, 0, 7171, 0, 7282, 0, 0, 7282, 7234, 7171, 7171, 0, 7330,
+    7330, 7330, 7330, 7330, 7330, 7330, 7330, 7330, 0, 7330, 7330, 7378, 7378, 7378, 0, 0,
+    0, 0, 0, 7171, 0, 7282, 0, 7378, 0, 0, 0, 0, 0, 0, 7425, 7425,
+    7425, 7425, 7425, 7425, 0, 7425, 7425, 7425, 7425, 0, 0, 0, 0, 7378, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7378, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7330, 7378, 0, 7378, 7425, 7425, 7330, 7330, 7330, 7425, 0, 7378,
+    7378, 0, 0, 0, 0, 0, 7282, 7378, 7378, 7378, 7459, 7459, 0, 7330, 7330, 7330,
+    7425, 7378, 7378, 7378, 0, 7378, 7378, 0, 7378, 7378, 0, 0, 7378, 0, 0, 6081,
+    0, 7282, 7522, 0, 7570, 7425, 7425, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 0, 7618, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922,
+    0, 7667, 7667, 7732, 0, 0, 7667, 7667, 0, 0, 7667, 7667, 0, 7667, 7667, 0,
+    0, 7667, 7667, 7667, 7667, 0, 0, 7667, 0, 0, 0, 0, 0, 7667, 7667, 7810,
+    0, 0, 7810, 7859, 6866, 0, 0, 0, 0, 0, 7810, 0, 0, 0, 6866, 0,
+    0, 6866, 6866, 0, 0, 5969, 0, 5969, 5969, 5969, 5969, 5969, 5969, 5969, 0, 5969,
+    5969, 5969, 5922, 5922, 5922, 5922, 5922, 6049, 6049, 6049, 6049, 0, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 0, 6946, 6946, 6993, 6946,
+    6946, 6946, 0, 0, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922,
+    0, 7921, 7921, 5922, 5922, 5922, 5922, 5922, 0, 6946, 6946, 6993, 6946, 6946, 6946, 0,
+    0, 0, 5922, 5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922,
+    5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 0, 6946, 6946, 6993, 6946, 6946,
+    6946, 0, 5922, 5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922,
+    5922, 5922, 5922, 0, 0, 0, 7107, 7107, 7107, 7107, 7107, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 7953, 7953, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 7986, 6866, 6866, 6866, 0, 0, 0, 8034, 5922, 5922, 5922, 5922, 5922, 0, 0,
+    8081, 0, 8081, 0, 5969, 6946, 6946, 6993, 6946, 6946, 6946, 0, 0, 0, 0, 0,
+    0, 0, 5922, 5922, 5922, 5922, 5922, 6049, 6946, 6946, 6993, 6946, 6946, 6946, 0, 8113,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 8146,
+    5922, 5922, 5922, 5922, 5922, 6913, 0, 6946, 6946, 6993, 6946, 6946, 6946, 0, 6946, 6946,
+    6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922, 0, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 0, 8194, 5922, 5922, 5922, 5922, 5922, 0, 0, 6946, 6946, 6993, 6946,
+    6946, 6946, 0, 0, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 8242,
+    8289, 0, 0, 0, 5922, 5922, 5922, 5922, 5922, 8322, 7171, 0, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 0, 0, 0, 8369, 0, 0, 0, 0, 5922, 5922,
+    5922, 5922, 5922, 0, 8402, 8402, 8451, 5969, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 6946, 6946, 6993, 6946,
+    6946, 6946, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 0, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 6946, 6946, 6993, 6946, 6946, 6946, 0, 5922, 5922, 5922, 5922, 5922, 8515,
+    8515, 8515, 8515, 8515, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 8578, 8578, 0, 0, 0, 8625, 8625, 0, 8659, 0, 7107, 7107,
+    7107, 7107, 7107, 5922, 5922, 5922, 5922, 5922, 0, 5922, 5922, 5922, 5922, 5922, 5922, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8722, 0,
+    6770, 6770, 6770, 6770, 6770, 0, 0, 6449, 0, 0, 0, 0, 0, 0, 0, 5922,
+    5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 5922, 8113, 5922, 5922, 5922, 5922, 5922, 0,
+    5922, 5922, 5922, 5922, 5922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6913, 0, 6913, 0, 6913, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6913, 0, 6913, 0, 6913, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8770, 8818, 6913,
+    6913, 0, 8867, 0, 0, 8818, 0, 8818, 0, 6913, 0, 8930, 8977, 8930, 9010, 0,
+    9057, 9090, 9139, 9139, 9090, 9090, 0, 8977, 9201, 0, 0, 9201, 8977, 0, 8977, 9234,
+    9281, 9281, 0, 9313, 0, 0, 8977, 9201, 8977, 9201, 0, 9201, 9201, 0, 9345, 8977,
+    8977, 8977, 8977, 8977, 8977, 8977, 0, 8977, 0, 0, 0, 0, 8977, 8977, 0, 0,
+    0, 0, 8977, 8977, 8977, 8977, 8977, 9201, 0, 8977, 0, 8977, 0, 8977, 9201, 9201,
+    9201, 9201, 8977, 0, 9201, 8977, 0, 0, 0, 9379, 9379, 9379, 9379, 9379, 0, 9313,
+    9313, 9313, 9441, 9441, 0, 9475, 0, 9475, 0, 0, 9538, 0, 0, 0, 0, 9201,
+    9586, 9201, 0, 9586, 9586, 9586, 9201, 9586, 0, 9586, 0, 9586, 9586, 9586, 9586, 9586,
+    0, 0, 9090, 9586, 0, 9201, 0, 9586, 9586, 9634, 0, 9634, 9634, 9586, 9586, 9586,
+    0, 9586, 0, 9201, 9201, 9090, 0, 0, 0, 0, 0, 0, 9681, 9681, 9681, 0,
+    9681, 0, 8977, 0, 0, 8977, 0, 8977, 8977, 0, 8977, 0, 8977, 8930, 0, 8977,
+    0, 8977, 9201, 9201, 9201, 0, 0, 0, 8977, 8977, 0, 0, 8977, 0, 0, 8977,
+    9201, 0, 8977, 8977, 0, 0, 8977, 9201, 0, 9201, 9201, 9201, 8977, 0, 0, 0,
+    0, 9201, 0, 0, 0, 0, 0, 8977, 8977, 8977, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9714, 0, 0, 9201, 0, 8977, 0, 0, 0, 0, 9201,
+    0, 0, 9201, 9201, 9761, 9761, 0, 9201, 9586, 9586, 9586, 9586, 0, 0, 9794, 0,
+    9842, 0, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9938, 0, 9890, 9890,
+    9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 0, 9890, 9890, 9890, 9890, 9890, 9890, 9890,
+    9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 0, 0, 9986,
+    9986, 10033, 9986, 9986, 9986, 0, 10067, 0, 10067, 10067, 10067, 10067, 10067, 10067, 10067, 10130,
+    0, 0, 10130, 0, 0, 10067, 10178, 10178, 10178, 10178, 10178, 10178, 10178, 10178, 10178, 10067,
+    10067, 10067, 0, 0, 0, 0, 0, 0, 10067, 0, 0, 10226, 10226, 0, 0, 0,
+    10226, 0, 0, 10226, 10226, 0, 0, 0, 10226, 0, 0, 0, 0, 0, 10178, 10178,
+    0, 10273, 0, 0, 10226, 0, 0, 0, 10130, 10226, 10226, 10226, 10273, 0, 0, 10226,
+    10226, 10226, 10226, 0, 0, 10226, 10226, 10273, 0, 10226, 10226, 10226, 0, 10226, 10226, 0,
+    10130, 10226, 0, 10306, 10306, 10226, 10354, 0, 9890, 9890, 9890, 9890, 9890, 10403, 0, 10468,
+    10403, 0, 0, 10403, 10403, 0, 10403, 10403, 0, 10403, 10403, 0, 0, 0, 0, 10403,
+    10403, 0, 10546, 9794, 9794, 0, 0, 0, 0, 0, 0, 9794, 0, 9986, 9986, 10033,
+    9986, 9986, 9986, 0, 9986, 9986, 10033, 9986, 9986, 9986, 0, 8977, 8977, 0, 9986, 9986,
+    10033, 9986, 9986, 9986, 0, 9890, 9890, 9890, 9890, 9890, 9986, 9986, 10033, 9986, 9986, 9986,
+    0, 9890, 9890, 9890, 9890, 9890, 10593, 10593, 0, 9890, 9890, 9890, 9890, 9890, 10593, 10593,
+    9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9313, 0, 9890, 9890, 9890, 9890,
+    9890, 9890, 9890, 9890, 9890, 9890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10625, 10657, 10657, 0, 9890, 9890, 9890, 9890, 9890, 0, 10691, 10755, 0, 10819, 0,
+    10881, 9890, 9890, 9890, 9890, 9890, 10913, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890, 9890,
+    9890, 10946, 10354, 9794, 0, 0, 0, 9890, 9890, 9890, 9890, 9890, 0, 0, 0, 0,
+    9681, 10994, 9681, 0, 9681, 10946, 9681, 0, 11042, 11091, 9890, 9890, 9890, 9890, 9890, 10306,
+    10306, 0, 0, 9890, 9890, 9890, 9890, 9890, 11154, 11202, 0, 0, 0, 10881, 11251, 0,
+    0, 0, 0, 0, 11314, 11314, 9586, 0, 0, 0, 0, 0, 9586, 9586, 0, 9586,
+    9586, 0, 0, 0, 9586, 9586, 0, 9586, 0, 11314, 0, 0, 9201, 0, 0, 0,
+    0, 0, 0, 9714, 0, 9714, 0, 0, 0, 11362, 11410, 0, 10913, 0, 10913, 0,
+    0, 0, 0, 10913, 0, 10913, 0, 10913, 0, 11410, 0, 10913, 0, 10913, 0, 10913,
+    0, 10913, 0, 10913, 0, 10913, 0, 0, 10913, 10913, 0, 0, 0, 10913, 0, 0,
+    0, 10913, 10913, 10913, 11362, 11362, 11459, 0, 11522, 0, 11522, 0, 0, 0, 0, 10913,
+    0, 10913, 0, 10913, 0, 11459, 0, 11459, 0, 11459, 0, 11459, 0, 11459, 0, 11459,
+    0, 11362, 11410, 0, 10913, 0, 10913, 0, 0, 0, 0, 11362, 0, 11362, 0, 10913,
+    0, 10913, 0, 10913, 0, 11410, 0, 10913, 0, 10913, 0, 10913, 10913, 10913, 11410, 0,
+    10913, 0, 10913, 0, 0, 0, 0, 11362, 0, 11362, 0, 11362, 0, 10913, 0, 10913,
+    0, 10913, 0, 11410, 0, 10913, 0, 10913, 0, 11410, 10913, 0, 10913, 0, 11362, 11362,
+    10913, 11569, 11603, 11665, 11665, 11697, 11697, 0, 11729, 11761, 11761, 11665, 11665, 11761, 11665, 11665,
+    11665, 0, 11665, 11665, 11665, 11761, 0, 11761, 11795, 11795, 11795, 0, 11859, 0, 0, 11761,
+    0, 11923, 11923, 11986, 11986, 0, 12035, 11986, 12098, 12146, 12146, 0, 12146, 12146, 12146, 12146,
+    12146, 12098, 0, 11761, 11569, 12146, 12146, 12146, 12146, 12194, 12242, 12289, 0, 0, 11761, 11761,
+    12289, 12289, 12289, 12289, 11665, 11665, 0, 11665, 11665, 11665, 11665, 11761, 11761, 11665, 11761, 11665,
+    11665, 0, 0, 11665, 11665, 11665, 11665, 11761, 11665, 0, 0, 11761, 0, 11761, 11761, 0,
+    11665, 11665, 0, 0, 0, 11761, 11761, 11761, 11761, 11761, 0, 0, 12322, 12322, 0, 0,
+    11761, 11665, 0, 0, 11665, 0, 0, 12146, 12146, 12146, 11761, 11761, 11761, 0, 12370, 12418,
+    12465, 0, 12465, 0, 12498, 12498, 12498, 12498, 12498, 0, 12547, 12547, 0, 0, 12547, 12547,
+    12547, 12547, 12610, 0, 12547, 12547, 12547, 12610, 0, 0, 0, 0, 12658, 0, 12658, 12658,
+    12658, 0, 0, 12658, 12658, 12658, 12658, 12658, 0, 12658, 12658, 12658, 12658, 12658, 12610, 12658,
+    12658, 0, 12658, 12658, 12610, 12658, 12658, 12658, 12658, 12658, 12610, 0, 0, 12707, 12707, 12707,
+    12707, 12707, 0, 12707, 12707, 12770, 0, 0, 0, 0, 0, 0, 12418, 12498, 12498, 12498,
+    12498, 12498, 12498, 12498, 12498, 12498, 12498, 11729, 12498, 12498, 12498, 12498, 12498, 12498, 12498, 12498,
+    12498, 12498, 12817, 12849, 0, 0, 0, 12883, 0, 0, 12947, 0, 0, 0, 0, 0,
+    0, 0, 13009, 13042, 13091, 13091, 0, 12418, 12418, 0, 0, 12418, 0, 12242, 13154, 12242,
+    12289, 12289, 12289, 13202, 13250, 13298, 0, 13346, 0, 0, 0, 11761, 0, 0, 11761, 0,
+    0, 0, 11761, 0, 11761, 0, 12146, 12146, 0, 11761, 12146, 0, 12146, 12146, 12146, 0,
+    11761, 13393, 13393, 13393, 13393, 11761, 0, 12322, 12322, 0, 13426, 13474, 13522, 13569, 13569, 13569,
+    0, 13569, 0, 13569, 0, 13569, 13569, 13569, 13522, 13569, 13569, 13569, 13569, 13569, 0, 0,
+    0, 13569, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13603, 13603, 13603, 13603,
+    0, 13603, 0, 13603, 0, 13569, 13569, 13569, 13603, 13603, 13603, 13603, 13603, 13603, 13522, 13569,
+    13569, 13569, 0, 13569, 0, 13569, 0, 13666, 13666, 13569, 13569, 13569, 13522, 13569, 13569, 13522,
+    13569, 13569, 13569, 0, 13569, 0, 13569, 0, 13666, 13666, 13666, 13569, 13569, 13569, 13522, 13569,
+    13569, 13569, 13569, 0, 13713, 13713, 13747, 13747, 13747, 13811, 13811, 13811, 13873, 13873, 13906, 13954,
+    13954, 14001, 14033, 14033, 13713, 13713, 0, 13713, 14065, 14065, 0, 0, 14065, 14065, 14065, 14065,
+    0, 0, 13713, 14065, 13713, 13713, 14098, 14065, 14065, 14065, 14145, 14178, 14227, 14227, 14227, 14227,
+    0, 14290, 14290, 14338, 14385, 0, 14338, 14338, 14338, 0, 14338, 14338, 14418, 0, 0, 14466,
+    0, 0, 14515, 14515, 14515, 14515, 0, 14579, 0, 0, 14643, 0, 0, 0, 0, 0,
+    0, 0, 14643, 0, 14643, 0, 14643, 0, 14643, 0, 14643, 0, 14706, 0, 14466, 14466,
+    14754, 0, 0, 0, 14065, 0, 0, 13954, 0, 14065, 14065, 14065, 13954, 14801, 0, 13873,
+    14833, 14833, 14833, 14833, 0, 14833, 0, 14833, 0, 14833, 0, 14833, 0, 14833, 0, 14833,
+    0, 14833, 0, 14833, 0, 14833, 0, 14833, 0, 14867, 14867, 14867, 14833, 14833, 14833, 14833,
+    14833, 14833, 0, 14929, 14929, 0, 14929, 14963, 15026, 15026, 0, 15075, 0, 15138, 15187, 15187,
+    15251, 0, 0, 0, 15315, 0, 15315, 0, 15315, 0, 15315, 0, 15315, 0, 15315, 0,
+    15315, 15315, 15315, 0, 0, 0, 0, 0, 0, 0, 15379, 15251, 0, 15379, 15441, 0,
+    15474, 15521, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15589, 15589, 15589,
+    0, 15681, 15716, 15794, 15843, 0, 15843, 0, 15843, 0, 15843, 15843, 15843, 15843, 15843, 15843,
+    15908, 0, 15843, 0, 15843, 0, 15908, 0, 15843, 0, 15843, 0, 0, 15987, 16050, 16101,
+    16101, 16101, 16195, 16195, 16195, 16260, 16195, 16195, 16260, 16195, 16195, 0, 16338,
+};
+
+constexpr uint8_t es_level_data[] = {
+    0x01, 0x01, 0x02, 0x18, 0x02, 0x16, 0x02, 0x04, 0x02, 0x02, 0x02, 0x0C, 0x02, 0x0E, 0x02, 0x02, 0x0C, 0x02, 0x01,
+    0x03, 0x0B, 0x16, 0x03, 0x04, 0x03, 0x02, 0x03, 0x02, 0x0D, 0x0C, 0x03, 0x02, 0x16, 0x03, 0x16, 0x03, 0x15, 0x0C,
+    0x03, 0x0C, 0x03, 0x20, 0x03, 0x03, 0x04, 0x20, 0x0C, 0x04, 0x1F, 0x04, 0x21, 0x0E, 0x04, 0x16, 0x0C, 0x0C, 0x04,
+    0x16, 0x0B, 0x04, 0x0B, 0x20, 0x04, 0x04, 0x0D, 0x04, 0x04, 0x04, 0x0D, 0x04, 0x2A, 0x04, 0x1F, 0x0C, 0x04, 0x04,
+    0x2C, 0x04, 0x15, 0x16, 0x04, 0x0C, 0x04, 0x02, 0x0D, 0x04, 0x04, 0x0E, 0x04, 0x21, 0x04, 0x18, 0x0D, 0x04, 0x03,
+    0x0C, 0x04, 0x19, 0x04, 0x03, 0x04, 0x17, 0x0E, 0x05, 0x1F, 0x05, 0x2D, 0x05, 0x20, 0x16, 0x05, 0x20, 0x0D, 0x0C,
+    0x05, 0x20, 0x0B, 0x05, 0x16, 0x0C, 0x16, 0x05, 0x21, 0x05, 0x29, 0x0C, 0x05, 0x29, 0x05, 0x2A, 0x0C, 0x05, 0x21,
+    0x0C, 0x05, 0x22, 0x0D, 0x05, 0x21, 0x0E, 0x05, 0x20, 0x0C, 0x0C, 0x05, 0x04, 0x0D, 0x05, 0x04, 0x05, 0x02, 0x05,
+    0x04, 0x0E, 0x0D, 0x05, 0x04, 0x0E, 0x05, 0x2B, 0x05, 0x1F, 0x16, 0x05, 0x03, 0x0C, 0x05, 0x17, 0x05, 0x16, 0x0D,
+    0x05, 0x0F, 0x0E, 0x05, 0x03, 0x05, 0x02, 0x0D, 0x05, 0x04, 0x0C, 0x05, 0x18, 0x05, 0x04, 0x0C, 0x0D, 0x05, 0x22,
+    0x0F, 0x05, 0x19, 0x05, 0x0D, 0x05, 0x24, 0x05, 0x17, 0x0E, 0x05, 0x0E, 0x05, 0x04, 0x17, 0x06, 0x33, 0x0C, 0x06,
+    0x33, 0x06, 0x21, 0x0E, 0x06, 0x1F, 0x06, 0x1F, 0x16, 0x06, 0x22, 0x06, 0x24, 0x06, 0x2B, 0x06, 0x22, 0x0F, 0x06,
+    0x20, 0x0D, 0x16, 0x06, 0x20, 0x20, 0x06, 0x21, 0x06, 0x35, 0x06, 0x20, 0x06, 0x29, 0x16, 0x06, 0x2A, 0x0C, 0x0C,
+    0x06, 0x2A, 0x0B, 0x06, 0x2A, 0x16, 0x06, 0x21, 0x0C, 0x06, 0x20, 0x0C, 0x16, 0x06, 0x04, 0x0D, 0x06, 0x3E, 0x06,
+    0x04, 0x06, 0x04, 0x0E, 0x0D, 0x06, 0x38, 0x06, 0x23, 0x06, 0x15, 0x0C, 0x06, 0x2A, 0x0B, 0x0C, 0x06, 0x2A, 0x0D,
+    0x06, 0x17, 0x06, 0x2C, 0x06, 0x17, 0x17, 0x06, 0x17, 0x0E, 0x06, 0x16, 0x0D, 0x06, 0x18, 0x0F, 0x06, 0x03, 0x0E,
+    0x06, 0x15, 0x06, 0x0F, 0x0E, 0x0D, 0x06, 0x40, 0x06, 0x0E, 0x06, 0x03, 0x06, 0x02, 0x06, 0x05, 0x06, 0x04, 0x0E,
+    0x06, 0x19, 0x06, 0x18, 0x06, 0x36, 0x06, 0x04, 0x0F, 0x19, 0x0C, 0x0D, 0x06, 0x04, 0x0C, 0x06, 0x0E, 0x0D, 0x06,
+    0x04, 0x0C, 0x0D, 0x06, 0x2C, 0x0F, 0x06, 0x2C, 0x0D, 0x06, 0x18, 0x0D, 0x06, 0x02, 0x33, 0x0C, 0x06, 0x02, 0x33,
+    0x06, 0x0D, 0x06, 0x04, 0x17, 0x06, 0x04, 0x18, 0x0D, 0x07, 0x33, 0x16, 0x07, 0x21, 0x07, 0x21, 0x0E, 0x07, 0x2B,
+    0x07, 0x22, 0x07, 0x20, 0x07, 0x22, 0x0D, 0x07, 0x48, 0x07, 0x34, 0x0B, 0x0C, 0x07, 0x34, 0x0B, 0x07, 0x34, 0x0D,
+    0x07, 0x22, 0x0D, 0x0E, 0x07, 0x29, 0x07, 0x22, 0x0B, 0x07, 0x2A, 0x0C, 0x16, 0x07, 0x21, 0x17, 0x07, 0x35, 0x07,
+    0x20, 0x0B, 0x07, 0x2B, 0x17, 0x07, 0x2A, 0x20, 0x07, 0x29, 0x16, 0x07, 0x04, 0x0D, 0x07, 0x04, 0x07, 0x3D, 0x0C,
+    0x07, 0x3D, 0x07, 0x23, 0x07, 0x0E, 0x21, 0x07, 0x2A, 0x0B, 0x16, 0x07, 0x17, 0x0E, 0x0D, 0x07, 0x23, 0x0E, 0x07,
+    0x17, 0x0E, 0x07, 0x17, 0x17, 0x07, 0x16, 0x0D, 0x07, 0x17, 0x07, 0x16, 0x0D, 0x18, 0x07, 0x17, 0x21, 0x07, 0x18,
+    0x0F, 0x07, 0x03, 0x0E, 0x07, 0x0F, 0x0E, 0x0D, 0x07, 0x04, 0x0D, 0x0E, 0x0D, 0x07, 0x0F, 0x0E, 0x07, 0x04, 0x0D,
+    0x17, 0x07, 0x03, 0x07, 0x02, 0x07, 0x04, 0x0C, 0x07, 0x05, 0x0E, 0x07, 0x18, 0x07, 0x05, 0x07, 0x19, 0x18, 0x07,
+    0x0E, 0x0D, 0x07, 0x36, 0x0D, 0x07, 0x2A, 0x07, 0x19, 0x0E, 0x07, 0x2C, 0x07, 0x18, 0x0D, 0x07, 0x18, 0x0D, 0x0C,
+    0x07, 0x02, 0x33, 0x16, 0x07, 0x0D, 0x17, 0x07, 0x0D, 0x07, 0x2B, 0x0E, 0x0E, 0x07, 0x2A, 0x0B, 0x07, 0x04, 0x21,
+    0x07, 0x04, 0x17, 0x07, 0x04, 0x18, 0x0D, 0x08, 0x21, 0x0C, 0x08, 0x21, 0x08, 0x34, 0x0D, 0x08, 0x1F, 0x08, 0x2C,
+    0x0D, 0x08, 0x2C, 0x0D, 0x0E, 0x08, 0x2B, 0x08, 0x22, 0x0D, 0x08, 0x22, 0x08, 0x35, 0x08, 0x20, 0x08, 0x34, 0x0B,
+    0x16, 0x08, 0x29, 0x08, 0x22, 0x0B, 0x0E, 0x08, 0x22, 0x0F, 0x08, 0x2B, 0x17, 0x08, 0x2A, 0x0D, 0x08, 0x2C, 0x08,
+    0x21, 0x17, 0x08, 0x33, 0x08, 0x04, 0x0D, 0x08, 0x03, 0x0E, 0x08, 0x3D, 0x16, 0x08, 0x0E, 0x21, 0x08, 0x47, 0x0C,
+    0x08, 0x47, 0x08, 0x17, 0x0E, 0x0D, 0x08, 0x17, 0x0E, 0x08, 0x17, 0x17, 0x08, 0x16, 0x0D, 0x08, 0x17, 0x08, 0x17,
+    0x21, 0x08, 0x0E, 0x0D, 0x08, 0x0F, 0x0E, 0x0D, 0x08, 0x04, 0x0D, 0x0E, 0x0D, 0x08, 0x0F, 0x0E, 0x08, 0x03, 0x08,
+    0x05, 0x08, 0x18, 0x08, 0x17, 0x17, 0x0E, 0x08, 0x2E, 0x0F, 0x0E, 0x08, 0x2B, 0x0E, 0x22, 0x08, 0x36, 0x08, 0x04,
+    0x08, 0x2C, 0x0F, 0x08, 0x41, 0x10, 0x08, 0x36, 0x0D, 0x08, 0x18, 0x0D, 0x0E, 0x08, 0x35, 0x0E, 0x08, 0x0D, 0x17,
+    0x08, 0x2B, 0x0E, 0x18, 0x08, 0x2A, 0x0B, 0x08, 0x04, 0x17, 0x08, 0x04, 0x21, 0x08, 0x04, 0x18, 0x0D, 0x08, 0x04,
+    0x18, 0x09, 0x3F, 0x09, 0x2C, 0x0D, 0x0E, 0x09, 0x21, 0x09, 0x22, 0x09, 0x49, 0x09, 0x2B, 0x09, 0x21, 0x20, 0x0D,
+    0x09, 0x21, 0x17, 0x0E, 0x09, 0x22, 0x0B, 0x0E, 0x09, 0x22, 0x0B, 0x09, 0x22, 0x0B, 0x18, 0x09, 0x2A, 0x0D, 0x09,
+    0x2B, 0x17, 0x09, 0x2B, 0x21, 0x09, 0x2C, 0x0D, 0x09, 0x2C, 0x09, 0x21, 0x17, 0x09, 0x03, 0x0E, 0x09, 0x04, 0x0D,
+    0x09, 0x05, 0x09, 0x47, 0x16, 0x09, 0x17, 0x0E, 0x0D, 0x09, 0x17, 0x0E, 0x09, 0x16, 0x0D, 0x09, 0x0F, 0x0E, 0x0D,
+    0x09, 0x0F, 0x0E, 0x09, 0x03, 0x09, 0x35, 0x09, 0x2B, 0x0E, 0x0D, 0x09, 0x04, 0x0D, 0x21, 0x09, 0x18, 0x09, 0x2B,
+    0x0E, 0x09, 0x2E, 0x0F, 0x0E, 0x09, 0x02, 0x0D, 0x09, 0x17, 0x21, 0x09, 0x17, 0x2B, 0x09, 0x35, 0x0E, 0x09, 0x0D,
+    0x17, 0x09, 0x29, 0x09, 0x07, 0x0E, 0x09, 0x05, 0x0E, 0x09, 0x04, 0x21, 0x09, 0x04, 0x09, 0x04, 0x18, 0x0D, 0x09,
+    0x04, 0x17, 0x0A, 0x21, 0x0A, 0x21, 0x20, 0x0D, 0x0A, 0x21, 0x17, 0x0E, 0x0A, 0x29, 0x0A, 0x22, 0x0B, 0x0A, 0x2B,
+    0x17, 0x0A, 0x3F, 0x0A, 0x2C, 0x0A, 0x2B, 0x0A, 0x36, 0x0D, 0x0A, 0x37, 0x0A, 0x2A, 0x0D, 0x0A, 0x17, 0x0E, 0x0D,
+    0x0A, 0x17, 0x0E, 0x0A, 0x16, 0x0D, 0x0A, 0x17, 0x0A, 0x05, 0x0E, 0x0A, 0x04, 0x0D, 0x0A, 0x0F, 0x0E, 0x17, 0x0A,
+    0x2B, 0x0E, 0x0D, 0x0A, 0x04, 0x0D, 0x21, 0x0A, 0x2D, 0x0E, 0x0A, 0x0D, 0x17, 0x0A, 0x35, 0x0A, 0x04, 0x0A, 0x04,
+    0x18, 0x0D, 0x0B, 0x2B, 0x0B, 0x17, 0x0E, 0x0D, 0x0B, 0x16, 0x0D, 0x0B, 0x0F, 0x0E, 0x0D, 0x0B, 0x04, 0x0D, 0x0B,
+    0x2B, 0x0E, 0x0D, 0x0B, 0x2B, 0x0E, 0x17, 0x0B, 0x04, 0x0D, 0x21, 0x0B, 0x16, 0x0D, 0x0E, 0x0B, 0x35, 0x0B, 0x2B,
+    0x17, 0x0B, 0x29, 0x0B, 0x04, 0x0C, 0x21, 0x0E, 0x17, 0x20, 0x0D, 0x0C, 0x2B, 0x0C, 0x04, 0x0D, 0x0E, 0x0D, 0x0C,
+    0x04, 0x0D, 0x0C, 0x04, 0x0D, 0x21, 0x0C, 0x04, 0x0D, 0x21, 0x21, 0x0C, 0x2B, 0x0E, 0x17, 0x0C, 0x2B, 0x17, 0x0D,
+    0x21, 0x0E, 0x17, 0x20, 0x0D, 0x0D, 0x04, 0x0D, 0x21, 0x0D, 0x04, 0x0D, 0x21, 0x21, 0x0E, 0x04, 0x0D,
+};
+
+constexpr HyphenationAutomaton es_automaton = {
+    es_symbols,
+    35u,
+    29u,
+    es_dense,
+    7741u,
+    es_label,
+    3u,
+    es_child_base,
+    es_child_offset,
+    es_fail,
+    es_levels,
+    es_level_data,
 };
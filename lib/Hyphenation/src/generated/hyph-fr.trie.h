@@ -3,382 +3,908 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t fr_trie_data[] = {
-    0x02, 0x0C, 0x18, 0x22, 0x16, 0x21, 0x0B, 0x16, 0x21, 0x0E, 0x01, 0x0C, 0x0B, 0x3D, 0x0C, 0x2B, 0x0E, 0x0C, 0x0C,
-    0x33, 0x0C, 0x33, 0x16, 0x34, 0x2A, 0x0D, 0x20, 0x0D, 0x0C, 0x0D, 0x2A, 0x17, 0x04, 0x1F, 0x0C, 0x29, 0x0C, 0x20,
-    0x0B, 0x0C, 0x17, 0x17, 0x0C, 0x3F, 0x35, 0x53, 0x4A, 0x36, 0x34, 0x21, 0x2A, 0x0D, 0x0C, 0x2A, 0x0D, 0x16, 0x02,
-    0x17, 0x15, 0x15, 0x0C, 0x15, 0x16, 0x2C, 0x47, 0x0C, 0x49, 0x2B, 0x0C, 0x0D, 0x34, 0x0D, 0x2A, 0x0B, 0x16, 0x2B,
-    0x0C, 0x17, 0x2A, 0x0B, 0x0C, 0x03, 0x0C, 0x16, 0x0D, 0x01, 0x16, 0x0C, 0x0B, 0x0C, 0x3E, 0x48, 0x2C, 0x0B, 0x29,
-    0x16, 0x37, 0x40, 0x1F, 0x16, 0x20, 0x17, 0x36, 0x0D, 0x52, 0x3D, 0x16, 0x1F, 0x0C, 0x16, 0x3E, 0x0D, 0x49, 0x0C,
-    0x03, 0x16, 0x35, 0x0C, 0x22, 0x0F, 0x02, 0x0D, 0x51, 0x0C, 0x21, 0x0C, 0x20, 0x0B, 0x16, 0x21, 0x0C, 0x17, 0x21,
-    0x0C, 0x0D, 0xA0, 0x00, 0x91, 0x21, 0x61, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00,
-    0xC2, 0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD,
-    0x21, 0x6F, 0xFD, 0x21, 0x63, 0xFD, 0xA0, 0x01, 0x12, 0x21, 0x63, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6F, 0xFD, 0x21,
-    0x6E, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x01,
-    0x52, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD,
-    0x21, 0x73, 0xFD, 0xA0, 0x01, 0x72, 0xA0, 0x01, 0xB1, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0xA1, 0x01, 0x72, 0x6E,
-    0xFD, 0xA0, 0x01, 0x92, 0x21, 0xA9, 0xFD, 0x24, 0x61, 0x65, 0xC3, 0x73, 0xE9, 0xF5, 0xFD, 0xE9, 0x21, 0x69, 0xF7,
-    0x23, 0x61, 0x65, 0x74, 0xC2, 0xDA, 0xFD, 0xA0, 0x01, 0xC2, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD,
-    0x21, 0x6F, 0xFD, 0xA0, 0x01, 0xE1, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x41, 0x2E, 0xFF, 0x5E, 0x21, 0x74, 0xFC,
-    0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x22, 0x67, 0x70, 0xFD, 0xFD, 0xA0, 0x05, 0x72, 0x21, 0x74, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x6E, 0xFD, 0xC9, 0x00, 0x61, 0x62, 0x65, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x72, 0x67, 0xFF, 0x4C, 0xFF,
-    0x58, 0xFF, 0x67, 0xFF, 0x79, 0xFF, 0xC3, 0xFF, 0xD6, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xFD, 0xA0, 0x00, 0x71, 0x27,
-    0xA2, 0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x52, 0x22, 0x61,
-    0x6F, 0xFD, 0xFD, 0xA0, 0x02, 0x93, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0xA2, 0x00, 0x61, 0x6E, 0x75, 0xF2, 0xFD,
-    0x21, 0xA9, 0xAC, 0x42, 0xC3, 0x69, 0xFF, 0xFD, 0xFF, 0xA9, 0x21, 0x6E, 0xF9, 0x41, 0x74, 0xFF, 0x06, 0x21, 0x61,
-    0xFC, 0x21, 0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xA0, 0x01, 0xE2, 0x21, 0x74, 0xFD, 0x21, 0x69, 0xFD,
-    0x41, 0x72, 0xFF, 0x6B, 0x21, 0x75, 0xFC, 0x21, 0x67, 0xFD, 0xA2, 0x02, 0x52, 0x6E, 0x75, 0xF3, 0xFD, 0x41, 0x62,
-    0xFF, 0x5A, 0x21, 0x61, 0xFC, 0x21, 0x66, 0xFD, 0x41, 0x74, 0xFF, 0x50, 0x41, 0x72, 0xFF, 0x4F, 0x21, 0x6F, 0xFC,
-    0xC4, 0x02, 0x52, 0x66, 0x70, 0x72, 0x78, 0xFF, 0xF2, 0xFF, 0xF5, 0xFF, 0x45, 0xFF, 0xFD, 0xA0, 0x06, 0x82, 0x21,
-    0x61, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x72, 0xF4, 0x21, 0x72, 0xFD, 0x21, 0x61,
-    0xFD, 0xA2, 0x06, 0x62, 0x6C, 0x6E, 0xF4, 0xFD, 0x21, 0xA9, 0xF9, 0x41, 0x69, 0xFF, 0xA0, 0x21, 0x74, 0xFC, 0x21,
-    0x69, 0xFD, 0xC3, 0x02, 0x52, 0x6D, 0x71, 0x74, 0xFF, 0xFD, 0xFF, 0x96, 0xFF, 0x96, 0x41, 0x6C, 0xFF, 0x8A, 0x21,
-    0x75, 0xFC, 0x41, 0x64, 0xFE, 0xF7, 0xA2, 0x02, 0x52, 0x63, 0x6E, 0xF9, 0xFC, 0x41, 0x62, 0xFF, 0x43, 0x21, 0x61,
-    0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x05, 0xF1, 0xA0, 0x06, 0xC1, 0x21, 0xA9, 0xFD, 0xA7, 0x06, 0xA2, 0x61, 0x65, 0xC3,
-    0x69, 0x6F, 0x75, 0x73, 0xF7, 0xF7, 0xFD, 0xF7, 0xF7, 0xF7, 0xF7, 0x21, 0x72, 0xEF, 0x21, 0x65, 0xFD, 0xC2, 0x02,
-    0x52, 0x69, 0x6C, 0xFF, 0x72, 0xFF, 0x4E, 0x49, 0x66, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x74, 0x75, 0xFF, 0x42,
-    0xFF, 0x58, 0xFF, 0x74, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xC6, 0xFF, 0xD4, 0xFF, 0xF4, 0xFF, 0xF7, 0xC2, 0x00, 0x61,
-    0x67, 0x6E, 0xFF, 0x16, 0xFF, 0xE4, 0x41, 0x75, 0xFE, 0xA7, 0x21, 0x67, 0xFC, 0x41, 0x65, 0xFF, 0x09, 0x21, 0x74,
-    0xFC, 0xA0, 0x02, 0x71, 0x21, 0x75, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x02, 0x72, 0x21, 0x63, 0xFD,
-    0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0xA4, 0x00, 0x61, 0x6E, 0x63, 0x75, 0x76, 0xDE, 0xE5, 0xF1, 0xFD, 0xA0, 0x00,
-    0x61, 0xC7, 0x00, 0x42, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xFE, 0x87, 0xFE, 0xA8, 0xFE, 0xC8, 0xFF, 0xC3,
-    0xFF, 0xF2, 0xFF, 0xFD, 0xFF, 0xFD, 0x42, 0x61, 0x74, 0xFD, 0xF4, 0xFE, 0x2F, 0x43, 0x64, 0x67, 0x70, 0xFE, 0x54,
-    0xFE, 0x54, 0xFE, 0x54, 0xC8, 0x00, 0x61, 0x62, 0x65, 0x6D, 0x6E, 0x70, 0x73, 0x72, 0x67, 0xFD, 0xAA, 0xFD, 0xB6,
-    0xFD, 0xD7, 0xFF, 0xEF, 0xFE, 0x34, 0xFE, 0x3D, 0xFF, 0xF6, 0xFE, 0x5B, 0xA0, 0x03, 0x01, 0x21, 0x2E, 0xFD, 0x21,
-    0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0x71, 0x6D, 0xFD,
-    0x47, 0xA2, 0xAA, 0xA9, 0xA8, 0xAE, 0xB4, 0xBB, 0xFE, 0x47, 0xFE, 0x47, 0xFF, 0xFB, 0xFE, 0x47, 0xFE, 0x47, 0xFE,
-    0x47, 0xFE, 0x47, 0xA0, 0x02, 0x22, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6D, 0xFD, 0x21,
-    0x65, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x02, 0x51, 0x43, 0x63, 0x74, 0x75, 0xFE, 0x28, 0xFE, 0x28,
-    0xFF, 0xFD, 0x41, 0x61, 0xFF, 0x4D, 0x44, 0x61, 0x6F, 0x73, 0x75, 0xFF, 0xF2, 0xFF, 0xFC, 0xFE, 0x25, 0xFE, 0x1A,
-    0x22, 0x61, 0x69, 0xDF, 0xF3, 0xA0, 0x03, 0x42, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x75, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x66, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x76, 0xFD,
-    0x21, 0xA8, 0xFD, 0xA1, 0x00, 0x71, 0xC3, 0xFD, 0xA0, 0x02, 0x92, 0x21, 0x70, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x73, 0xFD, 0xA0, 0x03, 0x31, 0xA0, 0x04, 0x42, 0x21, 0x63, 0xFD, 0xA0, 0x04, 0x61, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0xAE, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x61, 0xFD, 0x22, 0x73, 0x6D, 0xE8,
-    0xFD, 0x21, 0x65, 0xFB, 0x21, 0x72, 0xFD, 0xA2, 0x04, 0x31, 0x73, 0x74, 0xD7, 0xFD, 0x41, 0x65, 0xFD, 0xD5, 0x21,
-    0x69, 0xFC, 0xA1, 0x02, 0x52, 0x6C, 0xFD, 0xA0, 0x01, 0x31, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x23, 0x6E, 0x6F, 0x6D, 0xDB, 0xE9, 0xFD, 0xA0, 0x04, 0x31, 0x21, 0x6C, 0xFD,
-    0x44, 0x68, 0x69, 0x6F, 0x75, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x61, 0xFF, 0x9B, 0x21, 0x6F,
-    0xFC, 0x21, 0x79, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x63, 0xFD, 0x41, 0x6F, 0xFE, 0x7B, 0xA0, 0x04, 0x73, 0x21, 0x72,
-    0xFD, 0xA0, 0x04, 0xA2, 0x21, 0x6C, 0xF7, 0x21, 0x6C, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x04, 0x72, 0x21, 0x72, 0xFD,
-    0x21, 0x74, 0xFD, 0x24, 0x63, 0x6D, 0x74, 0x73, 0xE8, 0xEB, 0xF4, 0xFD, 0xA0, 0x04, 0xF3, 0x21, 0x72, 0xFD, 0xA1,
-    0x04, 0xC3, 0x67, 0xFD, 0x21, 0xA9, 0xFB, 0x21, 0x62, 0xE0, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x74, 0xD7,
-    0x21, 0x75, 0xD4, 0x23, 0x6E, 0x72, 0x78, 0xF7, 0xFA, 0xFD, 0x21, 0x6E, 0xB8, 0x21, 0x69, 0xB5, 0x21, 0x6F, 0xC4,
-    0x22, 0x65, 0x76, 0xF7, 0xFD, 0xC6, 0x05, 0x23, 0x64, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0xFF, 0xAA, 0xFF, 0xF2, 0xFF,
-    0xF5, 0xFF, 0xFB, 0xFF, 0xAA, 0xFF, 0xE5, 0x41, 0xA9, 0xFF, 0x95, 0x21, 0xC3, 0xFC, 0x41, 0x69, 0xFF, 0x97, 0x42,
-    0x6D, 0x70, 0xFF, 0x9C, 0xFF, 0x9C, 0x41, 0x66, 0xFF, 0x98, 0x45, 0x64, 0x6C, 0x70, 0x72, 0x75, 0xFF, 0xEE, 0xFF,
-    0x7F, 0xFF, 0xF1, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x04, 0xC2, 0x21, 0x93, 0xFD, 0xA0, 0x05, 0x23, 0x21, 0x6E, 0xFD,
-    0xCA, 0x01, 0xC1, 0x61, 0x63, 0xC3, 0x65, 0x69, 0x6F, 0xC5, 0x70, 0x74, 0x75, 0xFF, 0x7E, 0xFF, 0x75, 0xFF, 0x92,
-    0xFF, 0xA4, 0xFF, 0xB9, 0xFF, 0xE4, 0xFF, 0xF7, 0xFF, 0x75, 0xFF, 0x75, 0xFF, 0xFD, 0x44, 0x61, 0x69, 0x6F, 0x73,
-    0xFD, 0xC5, 0xFF, 0x3E, 0xFD, 0xC5, 0xFF, 0xDF, 0x21, 0xA9, 0xF3, 0x41, 0xA9, 0xFC, 0x86, 0x41, 0x64, 0xFC, 0x82,
-    0x22, 0xC3, 0x69, 0xF8, 0xFC, 0x41, 0x64, 0xFE, 0x4E, 0x41, 0x69, 0xFC, 0x75, 0x41, 0x6D, 0xFC, 0x71, 0x21, 0x6F,
-    0xFC, 0x24, 0x63, 0x6C, 0x6D, 0x74, 0xEC, 0xF1, 0xF5, 0xFD, 0x41, 0x6E, 0xFC, 0x61, 0x41, 0x68, 0xFC, 0x92, 0x23,
-    0x61, 0x65, 0x73, 0xEF, 0xF8, 0xFC, 0xC4, 0x01, 0xE2, 0x61, 0x69, 0x6F, 0x75, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A,
-    0xFC, 0x5A, 0x21, 0x73, 0xF1, 0x41, 0x6C, 0xFB, 0xFC, 0x45, 0x61, 0xC3, 0x69, 0x79, 0x6F, 0xFE, 0xE1, 0xFF, 0xB3,
-    0xFF, 0xE3, 0xFF, 0xF9, 0xFF, 0xFC, 0x48, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x74, 0x75, 0xFC, 0x74, 0xFC, 0x90,
-    0xFC, 0xBE, 0xFC, 0xCB, 0xFC, 0xE2, 0xFC, 0xF0, 0xFD, 0x10, 0xFD, 0x13, 0xC2, 0x00, 0x61, 0x67, 0x6E, 0xFC, 0x35,
-    0xFF, 0xE7, 0x41, 0x64, 0xFE, 0x6A, 0x21, 0x69, 0xFC, 0x41, 0x61, 0xFC, 0x3B, 0x21, 0x63, 0xFC, 0x21, 0x69, 0xFD,
-    0x22, 0x63, 0x66, 0xF3, 0xFD, 0x41, 0x6D, 0xFC, 0x29, 0x22, 0x69, 0x75, 0xF7, 0xFC, 0x21, 0x6E, 0xFB, 0x41, 0x73,
-    0xFB, 0x25, 0x21, 0x6F, 0xFC, 0x42, 0x6B, 0x72, 0xFC, 0x16, 0xFF, 0xFD, 0x41, 0x73, 0xFB, 0xE2, 0x42, 0x65, 0x6F,
-    0xFF, 0xFC, 0xFB, 0xDE, 0x21, 0x72, 0xF9, 0x41, 0xA9, 0xFD, 0xED, 0x21, 0xC3, 0xFC, 0x21, 0x73, 0xFD, 0x44, 0x64,
-    0x69, 0x70, 0x76, 0xFF, 0xF3, 0xFF, 0xFD, 0xFD, 0xE3, 0xFB, 0xCA, 0x41, 0x6E, 0xFD, 0xD6, 0x41, 0x74, 0xFD, 0xD2,
-    0x21, 0x6E, 0xFC, 0x42, 0x63, 0x64, 0xFD, 0xCB, 0xFB, 0xB2, 0x24, 0x61, 0x65, 0x69, 0x6F, 0xE1, 0xEE, 0xF6, 0xF9,
-    0x41, 0x78, 0xFD, 0xBB, 0x24, 0x67, 0x63, 0x6C, 0x72, 0xAB, 0xB5, 0xF3, 0xFC, 0x41, 0x68, 0xFE, 0xCA, 0x21, 0x6F,
-    0xFC, 0xC1, 0x01, 0xC1, 0x6E, 0xFD, 0xF2, 0x41, 0x73, 0xFE, 0xBD, 0x41, 0x73, 0xFE, 0xBF, 0x44, 0x61, 0x65, 0x69,
-    0x75, 0xFF, 0xF2, 0xFF, 0xF8, 0xFE, 0xB5, 0xFF, 0xFC, 0x41, 0x61, 0xFA, 0xA5, 0x21, 0x74, 0xFC, 0x21, 0x73, 0xFD,
-    0x21, 0x61, 0xFD, 0x23, 0x67, 0x73, 0x74, 0xD5, 0xE6, 0xFD, 0x21, 0xA9, 0xF9, 0xA0, 0x01, 0x11, 0x21, 0x6D, 0xFD,
-    0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41, 0xC3, 0xFA, 0xC6, 0x21, 0x64, 0xFC,
-    0x42, 0xA9, 0xAF, 0xFA, 0xBC, 0xFF, 0xFD, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0x73, 0xFA, 0xA4, 0xFA, 0xA4,
-    0xFF, 0xF9, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0xFA, 0xA4, 0x21, 0x6F, 0xEA, 0x21, 0x6E, 0xFD, 0x44, 0x61, 0xC3,
-    0x69, 0x6F, 0xFF, 0x82, 0xFF, 0xC1, 0xFF, 0xD3, 0xFF, 0xFD, 0x41, 0x68, 0xFA, 0xA5, 0x21, 0x74, 0xFC, 0x21, 0x61,
-    0xFD, 0x21, 0x6E, 0xFD, 0xA0, 0x06, 0x22, 0x21, 0xA9, 0xFD, 0x41, 0xA9, 0xFC, 0x27, 0x21, 0xC3, 0xFC, 0x21, 0x63,
-    0xFD, 0xA0, 0x07, 0x82, 0x21, 0x68, 0xFD, 0x21, 0x64, 0xFD, 0x24, 0x67, 0xC3, 0x73, 0x75, 0xE4, 0xEA, 0xF4, 0xFD,
-    0x41, 0x61, 0xFD, 0x8E, 0xC2, 0x01, 0x72, 0x6C, 0x75, 0xFF, 0xFC, 0xFA, 0x4B, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F,
-    0x75, 0x73, 0xFF, 0xF7, 0xFA, 0x53, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0xFA, 0x3F, 0x21, 0xA9, 0xEA,
-    0x22, 0x6F, 0xC3, 0xD1, 0xFD, 0x41, 0xA9, 0xFA, 0xB9, 0x21, 0xC3, 0xFC, 0x43, 0x66, 0x6D, 0x72, 0xFA, 0xB2, 0xFF,
-    0xFD, 0xFA, 0xB5, 0x41, 0x73, 0xFC, 0xC1, 0x42, 0x68, 0x74, 0xFA, 0xA4, 0xFC, 0xBD, 0x21, 0x70, 0xF9, 0x23, 0x61,
-    0x69, 0x6F, 0xE8, 0xF2, 0xFD, 0x41, 0xA8, 0xFA, 0x93, 0x42, 0x65, 0xC3, 0xFA, 0x8F, 0xFF, 0xFC, 0x21, 0x68, 0xF9,
-    0x42, 0x63, 0x73, 0xFF, 0xFD, 0xF9, 0xED, 0x41, 0xA9, 0xFA, 0xAB, 0x21, 0xC3, 0xFC, 0x43, 0x61, 0x68, 0x65, 0xFF,
-    0xF2, 0xFF, 0xFD, 0xFA, 0x28, 0x43, 0x6E, 0x72, 0x74, 0xFF, 0xD3, 0xFF, 0xF6, 0xFA, 0x21, 0xA0, 0x01, 0xC1, 0x21,
-    0x61, 0xFD, 0x21, 0x74, 0xFD, 0xC6, 0x00, 0x71, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x75, 0xFB, 0x81, 0xFB, 0x81, 0xFF,
-    0x57, 0xFB, 0x81, 0xFB, 0x81, 0xFB, 0x81, 0x22, 0x6E, 0x72, 0xE8, 0xEB, 0x41, 0x73, 0xFE, 0xE4, 0xA0, 0x07, 0x22,
-    0x21, 0x61, 0xFD, 0xA2, 0x01, 0x12, 0x73, 0x74, 0xFA, 0xFD, 0x43, 0x6F, 0x73, 0x75, 0xFF, 0xEF, 0xFF, 0xF9, 0xF9,
-    0x61, 0x21, 0x69, 0xF6, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0xA0, 0x07, 0x42, 0x21, 0x74, 0xFD, 0x21, 0x73, 0xFD,
-    0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x6C, 0xFD, 0xA1, 0x00, 0x71, 0x61, 0xFD, 0x41, 0x61, 0xFE, 0xA9, 0x21,
-    0x69, 0xFC, 0x21, 0x72, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x74, 0xFF, 0x95, 0x21, 0x65, 0xFC, 0x21, 0x74, 0xFD, 0x41,
-    0x6E, 0xFD, 0x23, 0x45, 0x68, 0x69, 0x6F, 0x72, 0x73, 0xF9, 0x7C, 0xFF, 0xFC, 0xFD, 0x25, 0xF9, 0x7C, 0xF9, 0x52,
-    0x21, 0x74, 0xF0, 0x22, 0x6E, 0x73, 0xE6, 0xFD, 0x41, 0x6E, 0xFB, 0xFD, 0x21, 0x61, 0xFC, 0x21, 0x6F, 0xFD, 0x21,
-    0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x79, 0xFD, 0x41, 0x6C, 0xFA, 0xE6, 0x21, 0x64, 0xFC, 0x21, 0x64, 0xFD, 0x49,
-    0x72, 0x61, 0x65, 0xC3, 0x68, 0x6C, 0x6F, 0x73, 0x75, 0xFE, 0xF7, 0xFF, 0x48, 0xFF, 0x70, 0xFF, 0x96, 0xFF, 0xAB,
-    0xFF, 0xBA, 0xFF, 0xDE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x6E, 0xF9, 0x2B, 0x21, 0x67, 0xFC, 0x41, 0x6C, 0xFB, 0x17,
-    0x21, 0x6C, 0xFC, 0x22, 0x61, 0x69, 0xF6, 0xFD, 0x41, 0x67, 0xFE, 0x7D, 0x21, 0x6E, 0xFC, 0x41, 0x72, 0xFB, 0xF2,
-    0x41, 0x65, 0xFF, 0x18, 0x21, 0x6C, 0xFC, 0x42, 0x72, 0x75, 0xFB, 0xE7, 0xFF, 0xFD, 0x41, 0x68, 0xFB, 0xEA, 0xA0,
-    0x08, 0x02, 0x21, 0x74, 0xFD, 0xA1, 0x02, 0x93, 0x6C, 0xFD, 0xA0, 0x08, 0x53, 0xA1, 0x08, 0x23, 0x72, 0xFD, 0x21,
-    0xA9, 0xFB, 0x41, 0x6E, 0xF9, 0x80, 0x21, 0x69, 0xFC, 0x42, 0x6D, 0x6E, 0xFF, 0xFD, 0xF9, 0x79, 0x42, 0x69, 0x75,
-    0xFF, 0xF9, 0xF9, 0x72, 0x41, 0x72, 0xFB, 0x57, 0x45, 0x61, 0xC3, 0x69, 0x6C, 0x75, 0xFF, 0xD7, 0xFF, 0xE4, 0xFD,
-    0x7D, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x08, 0x83, 0xA1, 0x02, 0x93, 0x74, 0xFD, 0x21, 0x75, 0xB9, 0x21, 0x6C, 0xB6,
-    0xA3, 0x02, 0x93, 0x61, 0x6C, 0x74, 0xFA, 0xFD, 0xB3, 0xA0, 0x08, 0x23, 0x21, 0xA9, 0xFD, 0x42, 0x66, 0x74, 0xFB,
-    0x26, 0xFB, 0x26, 0x42, 0x6D, 0x6E, 0xF9, 0x06, 0xFF, 0xF9, 0x42, 0x66, 0x78, 0xFB, 0x18, 0xFB, 0x18, 0x46, 0x61,
-    0x65, 0xC3, 0x68, 0x69, 0x6F, 0xFF, 0xD1, 0xFF, 0xDC, 0xFF, 0xE8, 0xF9, 0x25, 0xFF, 0xF2, 0xFF, 0xF9, 0x22, 0x62,
-    0x72, 0xAB, 0xED, 0x41, 0x76, 0xFB, 0x50, 0x21, 0x75, 0xFC, 0x48, 0x74, 0x79, 0x61, 0x65, 0x63, 0x68, 0x75, 0x6F,
-    0xFF, 0x4E, 0xFF, 0x57, 0xFF, 0x5A, 0xFF, 0x65, 0xFF, 0x6C, 0xF8, 0xBF, 0xFF, 0xF4, 0xFF, 0xFD, 0xC3, 0x00, 0x61,
-    0x6E, 0x75, 0x76, 0xF9, 0xD1, 0xF9, 0xE4, 0xF9, 0xF0, 0x41, 0x68, 0xF8, 0x9A, 0x43, 0x63, 0x6E, 0x74, 0xF9, 0xD7,
-    0xF9, 0xD7, 0xF9, 0xD7, 0x41, 0x6E, 0xF9, 0xCD, 0x22, 0x61, 0x6F, 0xF2, 0xFC, 0x21, 0x69, 0xFB, 0x43, 0x61, 0x68,
-    0x72, 0xFC, 0x52, 0xF8, 0x80, 0xFF, 0xFD, 0x41, 0x2E, 0xFE, 0x2D, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65,
-    0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x65, 0xFD, 0x41, 0x62, 0xFD, 0xD2, 0x21, 0x6F, 0xFC, 0x21, 0x6E,
-    0xFD, 0x21, 0x6F, 0xFD, 0x42, 0x73, 0x74, 0xF7, 0xFF, 0xF7, 0xFF, 0x42, 0x65, 0x69, 0xF7, 0xF8, 0xFF, 0xF9, 0x41,
-    0x78, 0xFD, 0xFC, 0xA2, 0x02, 0x72, 0x6C, 0x75, 0xF5, 0xFC, 0x41, 0x72, 0xFD, 0xF1, 0x42, 0xA9, 0xA8, 0xFD, 0x4A,
-    0xFF, 0xFC, 0xC2, 0x02, 0x72, 0x6C, 0x72, 0xFD, 0xE6, 0xFD, 0xE6, 0x41, 0x69, 0xF7, 0xD2, 0xA1, 0x02, 0x72, 0x66,
-    0xFC, 0x41, 0x73, 0xFD, 0xD4, 0xA1, 0x01, 0xB1, 0x73, 0xFC, 0x41, 0x72, 0xFA, 0xC2, 0x47, 0x61, 0xC3, 0x65, 0x69,
-    0x6F, 0x75, 0x74, 0xFF, 0xCF, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF, 0xEE, 0xF9, 0x51, 0xFF, 0xF7, 0xFF, 0xFC, 0x21, 0xA9,
-    0xEA, 0x41, 0x70, 0xF8, 0x3E, 0x42, 0x69, 0x6F, 0xF8, 0x3A, 0xF8, 0x3A, 0x21, 0x73, 0xF9, 0x41, 0x75, 0xF8, 0x30,
-    0x44, 0x61, 0x69, 0x6F, 0x72, 0xFF, 0xEE, 0xFF, 0xF9, 0xFF, 0xFC, 0xF8, 0x8C, 0x41, 0x63, 0xF8, 0x22, 0x41, 0x72,
-    0xF8, 0x1B, 0x41, 0x64, 0xF8, 0x17, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0x41, 0x73, 0xF8, 0x0D, 0x21, 0x6E, 0xFC,
-    0x24, 0x65, 0x69, 0x6C, 0x6F, 0xE7, 0xEB, 0xF6, 0xFD, 0x41, 0x69, 0xF8, 0x73, 0x21, 0x75, 0xFC, 0xC1, 0x01, 0xE2,
-    0x65, 0xFA, 0x36, 0x41, 0x64, 0xF6, 0xDA, 0x44, 0x62, 0x67, 0x6E, 0x74, 0xF6, 0xD6, 0xF6, 0xD6, 0xFF, 0xFC, 0xF6,
-    0xD6, 0x42, 0x6E, 0x72, 0xF6, 0xC9, 0xF6, 0xC9, 0x21, 0xA9, 0xF9, 0x42, 0x6D, 0x70, 0xF6, 0xBF, 0xF6, 0xBF, 0x42,
-    0x63, 0x70, 0xF6, 0xB8, 0xF6, 0xB8, 0xA0, 0x07, 0xA2, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xF7, 0x22,
-    0x63, 0x6E, 0xFD, 0xF4, 0xA2, 0x00, 0xC2, 0x65, 0x69, 0xF5, 0xFB, 0xC7, 0x01, 0xE2, 0x61, 0xC3, 0x69, 0x6F, 0x72,
-    0x75, 0x79, 0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF, 0xF9, 0xF6, 0x99, 0xF6, 0x99, 0xC5, 0x02, 0x52,
-    0x63, 0x70, 0x71, 0x73, 0x74, 0xFF, 0x6B, 0xFF, 0x91, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF, 0xE8, 0x21, 0x73, 0xEE, 0x42,
-    0xC3, 0x65, 0xFF, 0x41, 0xFF, 0xFD, 0x41, 0x74, 0xF7, 0x02, 0x21, 0x61, 0xFC, 0x53, 0x61, 0xC3, 0x62, 0x63, 0x64,
-    0x65, 0x69, 0x6D, 0x70, 0x73, 0x6F, 0x6B, 0x74, 0x67, 0x6E, 0x72, 0x6C, 0x75, 0x79, 0xF8, 0xB1, 0xF8, 0xE6, 0xF9,
-    0x32, 0xF9, 0xCA, 0xFB, 0x03, 0xF7, 0x50, 0xFB, 0x2C, 0xFC, 0x27, 0xFD, 0x92, 0xFE, 0x6E, 0xFE, 0x87, 0xFE, 0x93,
-    0xFE, 0xAD, 0xFE, 0xCA, 0xFE, 0xD7, 0xFF, 0xF2, 0xFF, 0xFD, 0xF8, 0x85, 0xF8, 0x85, 0xA0, 0x00, 0x81, 0x41, 0xAE,
-    0xFE, 0x87, 0xA0, 0x02, 0x31, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x42, 0x74, 0x65, 0xF8, 0x91,
-    0xFF, 0xFD, 0x23, 0x68, 0xC3, 0x73, 0xE6, 0xE9, 0xF9, 0x21, 0x68, 0xDF, 0xA0, 0x00, 0xA2, 0x21, 0x65, 0xFD, 0x21,
-    0x72, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0xA8, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F,
-    0xFD, 0xA0, 0x00, 0xF2, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x22, 0x63, 0x61, 0xF1, 0xFD, 0xA0,
-    0x00, 0xE2, 0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74,
-    0xFD, 0x21, 0x73, 0xFD, 0x41, 0x2E, 0xF6, 0x46, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D,
-    0xFD, 0x41, 0x2E, 0xF8, 0xC6, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x72,
-    0xFD, 0x21, 0x65, 0xFD, 0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0x23, 0x65, 0x69, 0x74, 0xD1, 0xE1, 0xFD, 0x41, 0x74,
-    0xFE, 0x84, 0x21, 0x73, 0xFC, 0x41, 0x72, 0xF8, 0xDB, 0x21, 0x61, 0xFC, 0x22, 0x6F, 0x70, 0xF6, 0xFD, 0x41, 0x73,
-    0xF5, 0xD8, 0x21, 0x69, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x68,
-    0xFD, 0xA0, 0x06, 0x41, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x41, 0x2E, 0xFF, 0x33, 0x21, 0x74, 0xFC, 0x21, 0x6E,
-    0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0x22, 0x63, 0x6D, 0xE5, 0xFB, 0xA0, 0x02, 0x02, 0x21, 0x6F, 0xFD, 0x21, 0x72,
-    0xFD, 0x21, 0x65, 0xEA, 0x22, 0x74, 0x6D, 0xFA, 0xFD, 0x41, 0x65, 0xFF, 0x1E, 0xA0, 0x03, 0x21, 0x21, 0x2E, 0xFD,
-    0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x65, 0xFD, 0x21,
-    0x69, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x63, 0x71, 0xDE, 0xFD, 0x21, 0x73, 0xC8, 0x21, 0x6F, 0xFD, 0x21, 0x6E, 0xFD,
-    0x41, 0x6C, 0xF8, 0x6B, 0x21, 0x69, 0xFC, 0xA0, 0x05, 0xE1, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD,
-    0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x41,
-    0x6D, 0xFF, 0xA3, 0x4E, 0x62, 0x64, 0xC3, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x63, 0x67, 0x76, 0x6D, 0x69, 0x75, 0xFE,
-    0xCF, 0xFE, 0xD6, 0xFE, 0xE5, 0xFF, 0x00, 0xFF, 0x49, 0xFF, 0x5E, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xC9, 0xFF, 0xD4,
-    0xFF, 0xDB, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFC, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFE, 0xBD, 0xFE,
-    0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xA0, 0x02, 0x41, 0x21, 0x2E, 0xFD, 0xA0, 0x00,
-    0x41, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0xA3, 0x00, 0xE1, 0x2E, 0x73, 0x6E, 0xF1, 0xF4, 0xFD, 0x23, 0x2E, 0x73,
-    0x6E, 0xE8, 0xEB, 0xF4, 0xA1, 0x00, 0xE2, 0x65, 0xF9, 0xA0, 0x02, 0xF1, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21,
-    0x69, 0xFD, 0x42, 0x74, 0x6D, 0xFF, 0xFD, 0xFE, 0xB6, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0xC2, 0x00, 0xE2, 0x65, 0x75,
-    0xFF, 0xDC, 0xFE, 0xAD, 0x49, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xFE, 0x62, 0xFF, 0xA5, 0xFF,
-    0xCA, 0xFE, 0x62, 0xFF, 0xDA, 0xFF, 0xF2, 0xFF, 0xF7, 0xFE, 0x62, 0xFE, 0x62, 0x43, 0x65, 0x69, 0x75, 0xFE, 0x23,
-    0xFC, 0x9D, 0xFC, 0x9D, 0x41, 0x69, 0xF4, 0xB7, 0xA0, 0x05, 0x92, 0x21, 0x65, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x65,
-    0x71, 0xF7, 0xFD, 0x21, 0x69, 0xFB, 0x43, 0x65, 0x68, 0x72, 0xFE, 0x04, 0xFF, 0xEB, 0xFF, 0xFD, 0x21, 0x72, 0xE5,
-    0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x74, 0xDC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21,
-    0xA9, 0xFD, 0x41, 0x75, 0xF7, 0x4F, 0x21, 0x71, 0xFC, 0x44, 0x65, 0xC3, 0x69, 0x6F, 0xFF, 0xE7, 0xFF, 0xF6, 0xFC,
-    0x55, 0xFF, 0xFD, 0x21, 0x67, 0xB9, 0x21, 0x72, 0xFD, 0x41, 0x74, 0xF7, 0x35, 0x22, 0x65, 0x69, 0xF9, 0xFC, 0xC1,
-    0x01, 0xC2, 0x65, 0xF4, 0x00, 0x21, 0x70, 0xFA, 0x21, 0x6F, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69,
-    0xFD, 0x41, 0x6C, 0xF6, 0xCF, 0x21, 0x6C, 0xFC, 0x21, 0x69, 0xFD, 0x41, 0x6C, 0xFE, 0x92, 0x21, 0x61, 0xFC, 0x41,
-    0x74, 0xFE, 0x0B, 0x21, 0x6F, 0xFC, 0x22, 0x76, 0x70, 0xF6, 0xFD, 0x42, 0x69, 0x65, 0xFF, 0xFB, 0xFD, 0x8D, 0x21,
-    0x75, 0xF9, 0x48, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x6D, 0x71, 0x72, 0xFF, 0x60, 0xFF, 0x7F, 0xFF, 0xA8, 0xFF, 0xBF,
-    0xFF, 0xD6, 0xFF, 0xE0, 0xFF, 0xFD, 0xFE, 0x65, 0x45, 0xA7, 0xA9, 0xA2, 0xA8, 0xB4, 0xFD, 0x8D, 0xFF, 0xE7, 0xFE,
-    0xA1, 0xFE, 0xA1, 0xFE, 0xA1, 0xA0, 0x02, 0xC3, 0x21, 0x74, 0xFD, 0x21, 0x75, 0xFD, 0x41, 0x69, 0xFA, 0xC0, 0x41,
-    0x2E, 0xF3, 0xB5, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xAA, 0xFD, 0x21,
-    0xC3, 0xFD, 0xA3, 0x00, 0xE1, 0x6F, 0x70, 0x72, 0xE3, 0xE6, 0xFD, 0xA0, 0x06, 0x51, 0x21, 0x6C, 0xFD, 0x21, 0x6C,
-    0xFD, 0x21, 0x69, 0xFD, 0x44, 0x2E, 0x73, 0x6E, 0x76, 0xFE, 0x9E, 0xFE, 0xA1, 0xFE, 0xAA, 0xFF, 0xFD, 0x42, 0x2E,
-    0x73, 0xFE, 0x91, 0xFE, 0x94, 0xA0, 0x03, 0x63, 0x21, 0x63, 0xFD, 0xA0, 0x03, 0x93, 0x21, 0x74, 0xFD, 0x21, 0xA9,
-    0xFD, 0x22, 0x61, 0xC3, 0xF4, 0xFD, 0x21, 0x72, 0xFB, 0xA2, 0x00, 0x81, 0x65, 0x6F, 0xE2, 0xFD, 0xC2, 0x00, 0x81,
-    0x65, 0x6F, 0xFF, 0xDB, 0xFB, 0x6A, 0x41, 0x64, 0xF5, 0x75, 0x21, 0x6E, 0xFC, 0x21, 0x65, 0xFD, 0xCD, 0x00, 0xE2,
-    0x2E, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x77, 0x69, 0xFE, 0x59, 0xFE, 0x5F, 0xFF, 0xBB,
-    0xFE, 0x5F, 0xFF, 0xE6, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xED, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF,
-    0xFD, 0x41, 0x6C, 0xF2, 0xB8, 0xA1, 0x00, 0xE1, 0x6C, 0xFC, 0xA0, 0x03, 0xC2, 0xC9, 0x00, 0xE2, 0x2E, 0x62, 0x65,
-    0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0xFE, 0x23, 0xFE, 0x29, 0xFE, 0x3B, 0xFE, 0x29, 0xFE, 0x29, 0xFF, 0xFD, 0xFE,
-    0x29, 0xFE, 0x29, 0xFE, 0x29, 0xC2, 0x00, 0xE2, 0x65, 0x61, 0xFE, 0x1D, 0xFC, 0xEE, 0xA0, 0x03, 0xE1, 0x22, 0x63,
-    0x71, 0xFD, 0xFD, 0xA0, 0x03, 0xF2, 0x21, 0x63, 0xF5, 0x21, 0x72, 0xF2, 0x22, 0x6F, 0x75, 0xFA, 0xFD, 0x21, 0x73,
-    0xFB, 0x27, 0x63, 0x64, 0x70, 0x72, 0x73, 0x75, 0x78, 0xEA, 0xEF, 0xE7, 0xE7, 0xFD, 0xE7, 0xE7, 0xA0, 0x04, 0x12,
-    0x21, 0xA9, 0xFD, 0x23, 0x66, 0x6E, 0x78, 0xD2, 0xD2, 0xD2, 0x41, 0x62, 0xFC, 0x3B, 0x21, 0x72, 0xFC, 0x41, 0x69,
-    0xFF, 0x5D, 0x41, 0x2E, 0xFD, 0xE0, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x42, 0x67, 0x65, 0xFF,
-    0xFD, 0xF4, 0xBE, 0x21, 0x6E, 0xF9, 0x21, 0x69, 0xFD, 0x41, 0x76, 0xF4, 0xB4, 0x21, 0x69, 0xFC, 0x24, 0x75, 0x66,
-    0x74, 0x6E, 0xD8, 0xDB, 0xF6, 0xFD, 0x41, 0x69, 0xF2, 0xCF, 0x21, 0x74, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD,
-    0x41, 0x6C, 0xF4, 0x97, 0x21, 0x75, 0xFC, 0x21, 0x70, 0xFD, 0x21, 0x74, 0xC9, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD,
-    0x21, 0x70, 0xFD, 0xC7, 0x00, 0xE1, 0x61, 0xC3, 0x65, 0x6E, 0x67, 0x72, 0x6D, 0xFF, 0x8C, 0xFF, 0x9E, 0xFF, 0xA1,
-    0xFF, 0xD4, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x93, 0xFB, 0xFE, 0x41, 0x72, 0xF2, 0x88, 0xA1, 0x00, 0xE1,
-    0x72, 0xFC, 0xC1, 0x00, 0xE1, 0x72, 0xFE, 0x7D, 0x41, 0x64, 0xF2, 0x79, 0x21, 0x69, 0xFC, 0x4D, 0x61, 0xC3, 0x65,
-    0x68, 0x69, 0x6B, 0x6C, 0x6F, 0xC5, 0x72, 0x75, 0x79, 0x63, 0xFE, 0x8A, 0xFD, 0x27, 0xFD, 0x4C, 0xFE, 0xE4, 0xFF,
-    0x12, 0xFF, 0x1A, 0xFF, 0x38, 0xFF, 0xCE, 0xFF, 0xE6, 0xFD, 0x5C, 0xFF, 0xEE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x63,
-    0xFC, 0x7B, 0xC3, 0x00, 0xE1, 0x61, 0x6B, 0x65, 0xFF, 0xFC, 0xFD, 0x17, 0xFD, 0x29, 0x41, 0x63, 0xFF, 0x53, 0x21,
-    0x69, 0xFC, 0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0xE1, 0x6E, 0xFD, 0x41, 0x74, 0xF2, 0x5A, 0xA1, 0x00,
-    0x91, 0x65, 0xFC, 0x21, 0x6C, 0xFB, 0xC3, 0x00, 0xE1, 0x6C, 0x6D, 0x74, 0xFF, 0xFD, 0xFC, 0x45, 0xFB, 0x1A, 0x41,
-    0x6C, 0xFF, 0x29, 0x21, 0x61, 0xFC, 0x21, 0x76, 0xFD, 0x41, 0x61, 0xF2, 0xF5, 0x21, 0xA9, 0xFC, 0x21, 0xC3, 0xFD,
-    0x21, 0x72, 0xFD, 0x22, 0x6F, 0x74, 0xF0, 0xFD, 0xA0, 0x04, 0xC3, 0x21, 0x67, 0xFD, 0x21, 0xA2, 0xFD, 0x21, 0xC3,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0xA2, 0x00, 0xE1, 0x6E, 0x79, 0xE9, 0xFD, 0x41, 0x6E, 0xFF, 0x2B, 0x21,
-    0x6F, 0xFC, 0xA1, 0x00, 0xE1, 0x63, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFB, 0x41, 0xFF, 0xFB,
-    0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xFB, 0x41, 0xC2, 0x00, 0xE1, 0x2E, 0x73, 0xFC, 0x84, 0xFC, 0x87,
-    0x41, 0x6F, 0xFB, 0x3F, 0x42, 0x6D, 0x73, 0xFF, 0xFC, 0xFB, 0x3E, 0x41, 0x73, 0xFB, 0x34, 0x22, 0xA9, 0xA8, 0xF5,
-    0xFC, 0x21, 0xC3, 0xFB, 0xA0, 0x02, 0xA2, 0x4A, 0x75, 0x69, 0x6F, 0x61, 0xC3, 0x65, 0x6E, 0xC5, 0x73, 0x79, 0xFF,
-    0x69, 0xFF, 0x7A, 0xFF, 0xB4, 0xFB, 0x08, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF, 0xFA, 0xFF, 0x0A, 0xFF, 0xFD, 0xFB, 0x08,
-    0x41, 0x63, 0xF3, 0x54, 0x21, 0x69, 0xFC, 0x41, 0x67, 0xFE, 0x89, 0x21, 0x72, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x61,
-    0xF3, 0x46, 0xC4, 0x00, 0xE1, 0x74, 0x67, 0x73, 0x6D, 0xFF, 0xEF, 0xF1, 0x62, 0xFF, 0xF9, 0xFF, 0xFC, 0x47, 0xA9,
-    0xA2, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xFF, 0xF1, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA, 0xC5, 0xFA,
-    0xC5, 0x41, 0x67, 0xF1, 0x3D, 0xC2, 0x00, 0xE1, 0x6E, 0x6D, 0xFF, 0xFC, 0xFB, 0x62, 0x42, 0x65, 0x69, 0xFA, 0x7F,
-    0xF8, 0xF9, 0xC5, 0x00, 0xE1, 0x6C, 0x70, 0x2E, 0x73, 0x6E, 0xFF, 0xF9, 0xFB, 0x5A, 0xFB, 0xF4, 0xFB, 0xF7, 0xFC,
-    0x00, 0xC1, 0x00, 0xE1, 0x6C, 0xFB, 0x48, 0x41, 0x6D, 0xF1, 0x11, 0x41, 0x61, 0xF0, 0xC1, 0x21, 0x6F, 0xFC, 0x21,
-    0x69, 0xFD, 0xC3, 0x00, 0xE1, 0x6D, 0x69, 0x64, 0xFB, 0x2C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x68, 0xF8, 0xC0, 0xA1,
-    0x00, 0xE1, 0x74, 0xFC, 0xA0, 0x07, 0xC2, 0x21, 0x72, 0xFD, 0x43, 0x2E, 0x73, 0x75, 0xFB, 0xB3, 0xFB, 0xB6, 0xFF,
-    0xFD, 0x21, 0x64, 0xF3, 0xA2, 0x00, 0xE2, 0x65, 0x79, 0xF3, 0xFD, 0x4A, 0xC3, 0x69, 0x63, 0x6D, 0x65, 0x75, 0x61,
-    0x79, 0x68, 0x6F, 0xFF, 0x81, 0xFF, 0x9B, 0xFB, 0x39, 0xFB, 0x39, 0xFF, 0xAB, 0xFF, 0xBD, 0xFF, 0xD1, 0xFF, 0xE1,
-    0xFF, 0xF9, 0xFA, 0x46, 0xA0, 0x03, 0x11, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD,
-    0x22, 0x63, 0x7A, 0xFD, 0xFD, 0x21, 0x6F, 0xFB, 0x21, 0x64, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x76,
-    0xFD, 0x21, 0x6E, 0xE9, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD, 0x42, 0xC3, 0x73, 0xFF, 0xFD, 0xF3,
-    0x42, 0x21, 0xA9, 0xF9, 0x41, 0x6E, 0xFA, 0x3D, 0x21, 0x69, 0xFC, 0x21, 0x6D, 0xFD, 0x21, 0xA9, 0xFD, 0x41, 0x74,
-    0xF4, 0xB0, 0x22, 0xC3, 0x73, 0xF9, 0xFC, 0xC5, 0x00, 0xE2, 0x69, 0x75, 0xC3, 0x6F, 0x65, 0xFF, 0xD1, 0xFD, 0xED,
-    0xFF, 0xE7, 0xFF, 0xFB, 0xFB, 0x49, 0x41, 0x65, 0xF0, 0x5C, 0x21, 0x6C, 0xFC, 0x42, 0x62, 0x63, 0xFF, 0xFD, 0xF0,
-    0x55, 0x21, 0x61, 0xF9, 0x21, 0x6E, 0xFD, 0xC3, 0x00, 0xE1, 0x67, 0x70, 0x73, 0xFF, 0xFD, 0xFC, 0x3E, 0xFC, 0x3E,
-    0x41, 0x6D, 0xF2, 0x05, 0x44, 0x61, 0x65, 0x69, 0x6F, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xFF, 0xFC, 0x21, 0x6C,
-    0xF3, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x06, 0xD2, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6F, 0xFD,
-    0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00, 0xE1, 0x70, 0x6C, 0xEB, 0xFD, 0x42, 0xA9, 0xA8, 0xF5, 0x47, 0xF5,
-    0x47, 0x48, 0x76, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x75, 0xFD, 0xEE, 0xF1, 0x6D, 0xF1, 0x6D, 0xFF, 0xF9, 0xF1,
-    0x6D, 0xF1, 0x6D, 0xF1, 0x6D, 0xF1, 0x6D, 0x21, 0x79, 0xE7, 0x41, 0x65, 0xFC, 0xAD, 0x21, 0x72, 0xFC, 0x21, 0x74,
-    0xFD, 0x21, 0x73, 0xFD, 0xA2, 0x00, 0xE1, 0x6C, 0x61, 0xF0, 0xFD, 0xC2, 0x00, 0xE2, 0x75, 0x65, 0xF9, 0x7E, 0xFA,
-    0xAD, 0x43, 0x6D, 0x74, 0x68, 0xFE, 0x5B, 0xF1, 0xA4, 0xEF, 0x15, 0xC4, 0x00, 0xE1, 0x72, 0x2E, 0x73, 0x6E, 0xFF,
-    0xF6, 0xFA, 0x82, 0xFA, 0x85, 0xFA, 0x8E, 0x41, 0x6C, 0xEF, 0x95, 0x21, 0x75, 0xFC, 0xA0, 0x06, 0xF3, 0x21, 0x71,
-    0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0xA2, 0x00, 0xE1, 0x6E, 0x72, 0xF1, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA,
-    0xAE, 0xB4, 0xBB, 0xF9, 0x00, 0xFF, 0xF9, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0xC1, 0x00,
-    0x81, 0x65, 0xFB, 0xB2, 0x41, 0x73, 0xEF, 0x26, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0xA0, 0x07, 0x62, 0x21, 0xA9,
-    0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x73, 0xF4, 0xA2, 0x00, 0x41, 0x61, 0x69, 0xFA, 0xFD, 0xC8, 0x00,
-    0xE2, 0x2E, 0x65, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xFA, 0x1D, 0xFA, 0x35, 0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xE7,
-    0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xF9, 0x41, 0xA9, 0xF8, 0xC6, 0x41, 0x75, 0xF8, 0xC2, 0x22, 0xC3, 0x65, 0xF8, 0xFC,
-    0x41, 0x68, 0xF8, 0xB9, 0x21, 0x63, 0xFC, 0x21, 0x79, 0xFD, 0x41, 0x72, 0xF8, 0xAF, 0x22, 0xA8, 0xA9, 0xFC, 0xFC,
-    0x21, 0xC3, 0xFB, 0x4D, 0x72, 0x75, 0x61, 0x69, 0x6F, 0x6C, 0x65, 0xC3, 0x68, 0x6E, 0x73, 0x74, 0x79, 0xFE, 0xAE,
-    0xFE, 0xD4, 0xFF, 0x0C, 0xFC, 0x95, 0xFF, 0x43, 0xFF, 0x4A, 0xFF, 0x5D, 0xFF, 0x86, 0xFF, 0xC2, 0xFF, 0xE5, 0xFF,
-    0xF1, 0xFF, 0xFD, 0xF8, 0x86, 0x41, 0x63, 0xF1, 0xA8, 0x21, 0x6F, 0xFC, 0x41, 0x64, 0xF1, 0xA1, 0x21, 0x69, 0xFC,
-    0x41, 0x67, 0xF1, 0x9A, 0x41, 0x67, 0xF0, 0xB7, 0x21, 0x6C, 0xFC, 0x41, 0x6C, 0xF1, 0x8F, 0x23, 0x69, 0x75, 0x6F,
-    0xF1, 0xF9, 0xFC, 0x41, 0x67, 0xF8, 0x89, 0x21, 0x69, 0xFC, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x65, 0x69,
-    0xFF, 0xFD, 0xF6, 0x84, 0x42, 0x74, 0x6F, 0xF9, 0xAC, 0xFF, 0xE1, 0x41, 0x74, 0xF8, 0x1F, 0x21, 0x61, 0xFC, 0x21,
-    0x6D, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0x26, 0x6E, 0x63, 0x64, 0x74, 0x73, 0x66, 0xB5, 0xBC, 0xCE, 0xE2,
-    0xE9, 0xFD, 0x41, 0xA9, 0xF8, 0xB0, 0x42, 0x61, 0x6F, 0xF8, 0xAC, 0xF8, 0xAC, 0x22, 0xC3, 0x69, 0xF5, 0xF9, 0x42,
-    0x65, 0x68, 0xF7, 0xCF, 0xFF, 0xFB, 0x41, 0x74, 0xFC, 0xE0, 0x21, 0x61, 0xFC, 0x22, 0x63, 0x74, 0xF2, 0xFD, 0x41,
-    0x2E, 0xF0, 0xE1, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x63, 0xFD, 0x42, 0x73, 0x6E, 0xFF,
-    0xFD, 0xF1, 0x19, 0x41, 0x6E, 0xF1, 0x12, 0x22, 0x69, 0x61, 0xF5, 0xFC, 0x42, 0x75, 0x6F, 0xFF, 0x68, 0xF9, 0xD4,
-    0x22, 0x6D, 0x70, 0xF4, 0xF9, 0xA0, 0x00, 0xA1, 0x21, 0x69, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x72, 0xF7, 0x21, 0x68,
-    0xFD, 0x21, 0x74, 0xFD, 0x22, 0x6C, 0x72, 0xF4, 0xFD, 0x41, 0x6C, 0xF7, 0x69, 0x41, 0x72, 0xFA, 0x24, 0x41, 0x74,
-    0xFA, 0xF9, 0x21, 0x63, 0xFC, 0x21, 0x79, 0xDA, 0x22, 0x61, 0x78, 0xFA, 0xFD, 0x41, 0x61, 0xF2, 0x17, 0x49, 0x6E,
-    0x73, 0x6D, 0x61, 0xC3, 0x6C, 0x62, 0x6F, 0x76, 0xFF, 0x72, 0xFF, 0x9D, 0xFF, 0xC9, 0xFF, 0xE0, 0xF7, 0x7E, 0xFF,
-    0xE5, 0xFF, 0xE9, 0xFF, 0xF7, 0xFF, 0xFC, 0x41, 0x70, 0xF8, 0x13, 0x43, 0x65, 0x6F, 0x68, 0xF7, 0x3E, 0xFF, 0xFC,
-    0xF8, 0x0F, 0x41, 0x69, 0xF5, 0xAE, 0x22, 0x63, 0x74, 0xF2, 0xFC, 0xA0, 0x05, 0xB3, 0x21, 0x72, 0xFD, 0x21, 0x76,
-    0xFD, 0x41, 0x65, 0xFE, 0xF9, 0x21, 0x72, 0xFC, 0x22, 0x69, 0x74, 0xF6, 0xFD, 0x41, 0x61, 0xFF, 0xA5, 0x21, 0x74,
-    0xFC, 0x21, 0x73, 0xFD, 0xC2, 0x01, 0x71, 0x63, 0x69, 0xED, 0x74, 0xED, 0x74, 0x21, 0x61, 0xF7, 0x21, 0x72, 0xFD,
-    0x21, 0x74, 0xFD, 0x45, 0x73, 0x6E, 0x75, 0x78, 0x72, 0xFF, 0xCA, 0xFF, 0xDF, 0xFF, 0xEB, 0xFF, 0xFD, 0xF8, 0x31,
-    0xC1, 0x00, 0xE1, 0x6D, 0xF7, 0xC4, 0x41, 0x61, 0xF9, 0xFD, 0x41, 0x6D, 0xFA, 0xAA, 0x21, 0x69, 0xFC, 0x21, 0x72,
-    0xFD, 0xA2, 0x00, 0xE1, 0x63, 0x74, 0xF2, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF6, 0xF2, 0xFF,
-    0xF9, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0xF6, 0xF2, 0x41, 0x68, 0xFB, 0xD1, 0x41, 0x70, 0xED, 0x6E,
-    0x21, 0x6F, 0xFC, 0x43, 0x73, 0x63, 0x74, 0xFA, 0x6A, 0xFF, 0xFD, 0xF8, 0x57, 0x41, 0x69, 0xFE, 0x77, 0x41, 0x2E,
-    0xEE, 0x5F, 0x21, 0x74, 0xFC, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x70, 0xFD, 0xA3, 0x00, 0xE1, 0x73, 0x6C, 0x61, 0xD3, 0xDD, 0xFD,
-    0xA0, 0x05, 0x52, 0x21, 0x6C, 0xFD, 0x21, 0x64, 0xFA, 0x21, 0x75, 0xFD, 0x22, 0x61, 0x6F, 0xF7, 0xFD, 0x41, 0x6E,
-    0xF7, 0xEF, 0x21, 0x65, 0xFC, 0x4D, 0x27, 0x61, 0xC3, 0x64, 0x65, 0x69, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79,
-    0xF6, 0x83, 0xFF, 0x76, 0xFF, 0x91, 0xFF, 0xA7, 0xF7, 0xEB, 0xFF, 0xDF, 0xFF, 0xF4, 0xFF, 0xFD, 0xF6, 0x83, 0xF7,
-    0xFB, 0xFB, 0x78, 0xF6, 0x83, 0xF6, 0x83, 0x41, 0x63, 0xFA, 0x33, 0x41, 0x72, 0xF6, 0xA6, 0xA1, 0x01, 0xC2, 0x61,
-    0xFC, 0x41, 0x73, 0xEF, 0xDE, 0xC2, 0x05, 0x23, 0x63, 0x74, 0xF0, 0x03, 0xFF, 0xFC, 0x45, 0x70, 0x61, 0x68, 0x6F,
-    0x75, 0xFF, 0xEE, 0xFF, 0xF7, 0xEC, 0xAD, 0xF0, 0x56, 0xF0, 0x56, 0x21, 0x73, 0xF0, 0x21, 0x6E, 0xFD, 0xC4, 0x00,
-    0xE2, 0x69, 0x75, 0x61, 0x65, 0xFA, 0x40, 0xFF, 0xD0, 0xFF, 0xFD, 0xF7, 0x9C, 0x41, 0x79, 0xFB, 0x9D, 0x21, 0x68,
-    0xFC, 0xC3, 0x00, 0xE1, 0x6E, 0x6D, 0x63, 0xFB, 0x66, 0xF6, 0xCC, 0xFF, 0xFD, 0x41, 0x6D, 0xFB, 0xEE, 0x21, 0x61,
-    0xFC, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x70, 0xFD, 0x41, 0x6D, 0xEE, 0x61, 0x21, 0x61,
-    0xFC, 0x42, 0x74, 0x2E, 0xFF, 0xFD, 0xF7, 0x48, 0xC5, 0x00, 0xE1, 0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xFB, 0x39, 0xFF,
-    0xEF, 0xFF, 0xF9, 0xF7, 0x41, 0xF7, 0x4D, 0xC2, 0x00, 0x81, 0x69, 0x65, 0xF3, 0x22, 0xF8, 0x9E, 0x41, 0x73, 0xEB,
-    0xD9, 0x21, 0x6F, 0xFC, 0x21, 0x6D, 0xFD, 0x44, 0x2E, 0x73, 0x72, 0x75, 0xF7, 0x1C, 0xF7, 0x1F, 0xFF, 0xFD, 0xFB,
-    0x66, 0xC7, 0x00, 0xE2, 0x72, 0x2E, 0x65, 0x6C, 0x6D, 0x6E, 0x73, 0xFF, 0xE0, 0xF7, 0x0F, 0xFF, 0xF3, 0xF7, 0x15,
-    0xF7, 0x15, 0xF7, 0x15, 0xF7, 0x15, 0x41, 0x62, 0xF9, 0x76, 0x41, 0x73, 0xEC, 0x06, 0x21, 0x67, 0xFC, 0xC3, 0x00,
-    0xE1, 0x72, 0x6D, 0x6E, 0xFF, 0xF5, 0xF6, 0x4A, 0xFF, 0xFD, 0xC2, 0x00, 0xE1, 0x6D, 0x72, 0xF6, 0x3E, 0xF9, 0x8D,
-    0x42, 0x62, 0x70, 0xEB, 0x8A, 0xEB, 0x8A, 0x44, 0x65, 0x69, 0x6F, 0x73, 0xEB, 0x83, 0xEB, 0x83, 0xFF, 0xF9, 0xEB,
-    0x83, 0x21, 0xA9, 0xF3, 0x21, 0xC3, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE,
-    0xB4, 0xBB, 0xF5, 0x5F, 0xF5, 0x5F, 0xFF, 0xFB, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0xF5, 0x5F, 0x41,
-    0x74, 0xF1, 0x2A, 0x21, 0x6E, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x68, 0xFD, 0x41, 0x6C, 0xFA, 0x2E, 0x4B, 0x72, 0x61,
-    0x65, 0x68, 0x75, 0x6F, 0xC3, 0x63, 0x69, 0x74, 0x79, 0xFF, 0x0A, 0xFF, 0x20, 0xFF, 0x4D, 0xFF, 0x7F, 0xFF, 0xA2,
-    0xFF, 0xAE, 0xFF, 0xD6, 0xFF, 0xF9, 0xF5, 0x35, 0xFF, 0xFC, 0xF5, 0x35, 0xC1, 0x00, 0xE1, 0x63, 0xF8, 0xEB, 0x47,
-    0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF5, 0x0D, 0xFF, 0xFA, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D, 0xF5, 0x0D,
-    0xF5, 0x0D, 0x41, 0x75, 0xFF, 0x01, 0x21, 0x68, 0xFC, 0xC2, 0x00, 0xE1, 0x72, 0x63, 0xF5, 0x32, 0xFF, 0xFD, 0xC2,
-    0x00, 0xE2, 0x65, 0x61, 0xF6, 0x58, 0xF3, 0x41, 0x41, 0x74, 0xF6, 0x64, 0xC2, 0x00, 0xE2, 0x65, 0x69, 0xF6, 0x4B,
-    0xFF, 0xFC, 0x4A, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xFD, 0xC4, 0xFF, 0xC4, 0xF6, 0x39,
-    0xFF, 0xE1, 0xFF, 0xEA, 0xF4, 0xD1, 0xFF, 0xF7, 0xF9, 0xC6, 0xFD, 0xC4, 0xF4, 0xD1, 0x45, 0x61, 0x65, 0x69, 0x6F,
-    0x79, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0x41, 0x75, 0xFA, 0x87, 0x21, 0x71, 0xFC, 0x21,
-    0x6F, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x42, 0x6D, 0x6E, 0xF2, 0xE6, 0xFF, 0xFD, 0xC2,
-    0x00, 0xE2, 0x65, 0x61, 0xF5, 0xF9, 0xFF, 0xF9, 0xC1, 0x00, 0xE1, 0x65, 0xF5, 0xF0, 0x4C, 0x61, 0xC3, 0x65, 0x68,
-    0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0x73, 0x79, 0xF4, 0x79, 0xF5, 0xBC, 0xF5, 0xE1, 0xFF, 0xC7, 0xF7, 0xA7, 0xF5,
-    0xF1, 0xF5, 0xF1, 0xF4, 0x79, 0xFF, 0xF1, 0xFF, 0xFA, 0xF9, 0x6E, 0xF4, 0x79, 0x41, 0x69, 0xEF, 0xBB, 0x21, 0x75,
-    0xFC, 0x42, 0x71, 0x2E, 0xFF, 0xFD, 0xF5, 0xA6, 0xC5, 0x00, 0xE1, 0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xEA, 0xD7, 0xF6,
-    0x80, 0xFF, 0xF9, 0xF5, 0x9F, 0xF5, 0xAB, 0x41, 0x69, 0xF6, 0xD1, 0x42, 0x6C, 0x73, 0xFF, 0xFC, 0xEB, 0x02, 0xA0,
-    0x02, 0xD2, 0x21, 0x68, 0xFD, 0x42, 0xC3, 0x61, 0xFA, 0x3F, 0xFF, 0xFD, 0xC2, 0x06, 0x02, 0x6F, 0x73, 0xF5, 0x12,
-    0xF5, 0x12, 0x21, 0x72, 0xF7, 0x21, 0x65, 0xFD, 0xC5, 0x00, 0xE1, 0x63, 0x62, 0x6D, 0x72, 0x70, 0xFD, 0xB2, 0xFF,
-    0xDD, 0xF4, 0xC4, 0xFF, 0xEA, 0xFF, 0xFD, 0x41, 0x6C, 0xFC, 0x26, 0xA1, 0x00, 0xE2, 0x75, 0xFC, 0x21, 0x72, 0xFB,
-    0x41, 0x61, 0xF4, 0x0C, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD, 0x41, 0x6D, 0xF4, 0x02, 0x21, 0x72, 0xFC, 0x41, 0x6C,
-    0xF3, 0xFB, 0x41, 0x6F, 0xF8, 0xC3, 0x22, 0x65, 0x72, 0xF8, 0xFC, 0x45, 0x6F, 0x61, 0x65, 0x68, 0x69, 0xFF, 0xDF,
-    0xFF, 0xE9, 0xFF, 0xF0, 0xFB, 0x48, 0xFF, 0xFB, 0x41, 0x6F, 0xF6, 0x5E, 0x42, 0x6C, 0x76, 0xFF, 0xFC, 0xF3, 0xDA,
-    0x41, 0x76, 0xF3, 0xD3, 0x22, 0x61, 0x6F, 0xF5, 0xFC, 0x41, 0x70, 0xFB, 0x11, 0x41, 0xA9, 0xFB, 0x17, 0x21, 0xC3,
-    0xFC, 0x41, 0x70, 0xF3, 0xBF, 0xC3, 0x00, 0xE2, 0x2E, 0x65, 0x73, 0xF4, 0xF7, 0xF6, 0x66, 0xF4, 0xFD, 0x24, 0x61,
-    0x6C, 0x6F, 0x68, 0xE5, 0xED, 0xF0, 0xF4, 0x41, 0x6D, 0xF9, 0x29, 0xC6, 0x00, 0xE2, 0x2E, 0x65, 0x6D, 0x6F, 0x72,
-    0x73, 0xF4, 0xDE, 0xF4, 0xF6, 0xF4, 0xE4, 0xFF, 0xFC, 0xF4, 0xE4, 0xF4, 0xE4, 0x41, 0x64, 0xF3, 0x8D, 0x21, 0x72,
-    0xFC, 0x21, 0x61, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6E, 0xF3, 0x7D, 0x21, 0x69, 0xFC, 0xA0, 0x07,
-    0xE2, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0xA9, 0xFD,
-    0x41, 0x67, 0xFF, 0x5F, 0x41, 0x6B, 0xF3, 0x5D, 0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xFF, 0x62, 0x41, 0x74, 0xFA, 0x90,
-    0x21, 0x63, 0xFC, 0x42, 0x6F, 0x75, 0xFF, 0x81, 0xFF, 0xFD, 0x41, 0x65, 0xF3, 0x44, 0x21, 0x6C, 0xFC, 0x27, 0x61,
-    0x65, 0xC3, 0x69, 0x6F, 0x72, 0x79, 0xBD, 0xC4, 0xD9, 0xDC, 0xE4, 0xF2, 0xFD, 0x4D, 0x65, 0x75, 0x70, 0x6C, 0x61,
-    0xC3, 0x63, 0x68, 0x69, 0x6F, 0xC5, 0x74, 0x79, 0xFE, 0xCB, 0xFF, 0x04, 0xFF, 0x40, 0xFF, 0x5F, 0xF3, 0x11, 0xF4,
-    0x54, 0xFF, 0x7F, 0xFF, 0x8C, 0xF3, 0x11, 0xF3, 0x11, 0xF7, 0x13, 0xFF, 0xF1, 0xF3, 0x11, 0x41, 0x69, 0xF3, 0x97,
-    0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x22, 0x6D, 0x73, 0xFD, 0xF6, 0x21, 0x6F, 0xFB, 0x21, 0x6E, 0xFD, 0x41, 0x75,
-    0xED, 0x66, 0x41, 0x73, 0xEC, 0x54, 0x21, 0x64, 0xFC, 0x21, 0x75, 0xFD, 0x41, 0x6F, 0xF6, 0xA4, 0x42, 0x73, 0x70,
-    0xEA, 0xC3, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x43, 0x6D, 0x62, 0x6E, 0xF3, 0x6F, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0x67,
-    0xF3, 0x5C, 0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFA, 0x82, 0x21, 0x74, 0xFC, 0x41,
-    0x6E, 0xFA, 0xEA, 0x21, 0x6F, 0xFC, 0x42, 0x73, 0x74, 0xF7, 0x88, 0xF7, 0x88, 0x41, 0x6F, 0xF7, 0x81, 0x21, 0x72,
-    0xFC, 0x21, 0xA9, 0xFD, 0x41, 0x6D, 0xF7, 0x77, 0x41, 0x75, 0xF7, 0x73, 0x42, 0x64, 0x74, 0xF7, 0x6F, 0xFF, 0xFC,
-    0x41, 0x6E, 0xF7, 0x68, 0x21, 0x6F, 0xFC, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x63, 0xFD, 0x22, 0x61, 0x69,
-    0xE9, 0xFD, 0x25, 0x61, 0xC3, 0x69, 0x6F, 0x72, 0xCB, 0xD9, 0xDC, 0xDC, 0xFB, 0x21, 0x74, 0xF5, 0x41, 0x61, 0xE9,
-    0x22, 0x21, 0x79, 0xFC, 0x4B, 0x67, 0x70, 0x6D, 0x72, 0x62, 0x63, 0x64, 0xC3, 0x69, 0x73, 0x78, 0xFF, 0x72, 0xFF,
-    0x75, 0xFF, 0x91, 0xF3, 0x5D, 0xFF, 0xA5, 0xFF, 0xAC, 0xFD, 0x10, 0xF2, 0x46, 0xFF, 0xB3, 0xFF, 0xF6, 0xFF, 0xFD,
-    0x41, 0x6E, 0xE8, 0xBD, 0xA1, 0x00, 0xE1, 0x67, 0xFC, 0x46, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x72, 0xFF, 0xFB, 0xF3,
-    0x86, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x1E, 0xF2, 0x3B, 0xA0, 0x01, 0x71, 0x21, 0xA9, 0xFD, 0x21, 0xC3, 0xFD, 0x41,
-    0x74, 0xE8, 0x44, 0x21, 0x70, 0xFC, 0x22, 0x69, 0x6F, 0xF6, 0xFD, 0xA1, 0x00, 0xE1, 0x6D, 0xFB, 0x47, 0xA2, 0xA9,
-    0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF1, 0xF1, 0xFF, 0xFB, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1, 0xF1,
-    0x41, 0xA9, 0xE9, 0x74, 0xC7, 0x06, 0x02, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73, 0x75, 0xF2, 0xCD, 0xF2, 0xCD, 0xFF,
-    0xFC, 0xF2, 0xCD, 0xF2, 0xCD, 0xF2, 0xCD, 0xF2, 0xCD, 0x21, 0x72, 0xE8, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x73,
-    0x75, 0xE9, 0xBD, 0xE9, 0xBD, 0xED, 0x93, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0xE9, 0xBD, 0x22, 0x65, 0x6F, 0xE7,
-    0xEA, 0xA1, 0x00, 0xE1, 0x70, 0xFB, 0x47, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x79, 0xF1, 0x9C, 0xFF, 0xAB, 0xF6,
-    0x71, 0xF4, 0xCA, 0xF1, 0x9C, 0xFA, 0x8F, 0xFF, 0xFB, 0x41, 0x76, 0xF3, 0xC0, 0x41, 0x76, 0xE8, 0x54, 0x41, 0x78,
-    0xE8, 0x50, 0x22, 0x6F, 0x61, 0xF8, 0xFC, 0x21, 0x69, 0xFB, 0x41, 0x72, 0xF2, 0x20, 0x21, 0x74, 0xFC, 0x45, 0x63,
-    0x65, 0x76, 0x6E, 0x73, 0xF2, 0x5E, 0xFF, 0xE5, 0xF2, 0x5E, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xE9, 0xBA,
-    0xE9, 0xBA, 0x21, 0x69, 0xF9, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x69, 0xFD, 0xC2, 0x00, 0xE1, 0x63, 0x6E,
-    0xF3, 0x82, 0xFF, 0xFD, 0xC2, 0x00, 0xE1, 0x6C, 0x64, 0xF4, 0x69, 0xF9, 0xE8, 0x41, 0x74, 0xF7, 0x1B, 0x21, 0x6F,
-    0xFC, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x72, 0x2E, 0xFF, 0xFD, 0xF2, 0x88, 0x42, 0x69, 0x74, 0xEF, 0x79,
-    0xFF, 0xF9, 0xC3, 0x00, 0xE1, 0x6E, 0x2E, 0x73, 0xFF, 0xF9, 0xF2, 0x74, 0xF2, 0x77, 0x41, 0x69, 0xE7, 0x51, 0x21,
-    0x6B, 0xFC, 0x21, 0x73, 0xFD, 0x21, 0x6F, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE,
-    0xB4, 0xBB, 0xF0, 0xFD, 0xFF, 0xFB, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0xF0, 0xFD, 0x41, 0x6D, 0xE9,
-    0xDD, 0x21, 0x61, 0xFC, 0x21, 0x74, 0xFD, 0xA1, 0x00, 0xE1, 0x6C, 0xFD, 0x48, 0x61, 0x69, 0x65, 0xC3, 0x6F, 0x72,
-    0x75, 0x79, 0xFF, 0x90, 0xFF, 0x99, 0xFF, 0xBD, 0xFF, 0xDB, 0xFF, 0xFB, 0xF2, 0x50, 0xF0, 0xD8, 0xF0, 0xD8, 0xA0,
-    0x01, 0xD1, 0x21, 0x6E, 0xFD, 0x21, 0x6F, 0xFD, 0x42, 0x69, 0x75, 0xFF, 0xFD, 0xF0, 0xF8, 0x41, 0x72, 0xF6, 0xE9,
-    0xA1, 0x00, 0xE1, 0x77, 0xFC, 0x48, 0xA2, 0xA0, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0,
-    0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA6, 0x41, 0x2E, 0xE6, 0x8A, 0x21, 0x74, 0xFC, 0x21,
-    0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x4A, 0x69, 0x6C, 0x61, 0xC3, 0x65, 0x6F, 0x73, 0x75, 0x79, 0x6D, 0xF3, 0xAE, 0xFF,
-    0xCA, 0xFF, 0xD5, 0xFF, 0xDA, 0xF1, 0xE8, 0xF0, 0x80, 0xF8, 0x95, 0xF0, 0x80, 0xF0, 0x80, 0xFF, 0xFD, 0x41, 0x6C,
-    0xF3, 0x8B, 0x42, 0x69, 0x65, 0xFF, 0xFC, 0xF9, 0xD3, 0xC1, 0x00, 0xE2, 0x2E, 0xF1, 0xAF, 0x49, 0x61, 0xC3, 0x65,
-    0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xF0, 0x50, 0xF1, 0x93, 0xF1, 0xB8, 0xFF, 0xFA, 0xF0, 0x50, 0xF0, 0x50, 0xF0,
-    0x6D, 0xF0, 0x50, 0xF0, 0x50, 0x42, 0x61, 0x65, 0xF0, 0x76, 0xF1, 0xA5, 0xA1, 0x00, 0xE1, 0x75, 0xF9, 0x41, 0x69,
-    0xFA, 0x32, 0x21, 0x72, 0xFC, 0xA1, 0x00, 0xE1, 0x74, 0xFD, 0xA0, 0x01, 0xF2, 0x21, 0x2E, 0xFD, 0x22, 0x2E, 0x73,
-    0xFA, 0xFD, 0x21, 0x74, 0xFB, 0x21, 0x61, 0xFD, 0x4A, 0x75, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0xC5, 0x73, 0x78, 0x79,
-    0xFF, 0xEA, 0xF0, 0x0B, 0xF1, 0x4E, 0xF1, 0x73, 0xF0, 0x0B, 0xF0, 0x0B, 0xF4, 0x0D, 0xFF, 0xFD, 0xF8, 0x58, 0xF0,
-    0x0B, 0x41, 0x68, 0xF8, 0x39, 0x21, 0x74, 0xFC, 0x42, 0x73, 0x6C, 0xFF, 0xFD, 0xF8, 0x38, 0x41, 0x6F, 0xFD, 0x5C,
-    0x21, 0x74, 0xFC, 0x22, 0x61, 0x73, 0xF2, 0xFD, 0x42, 0xA9, 0xA8, 0xEF, 0xD2, 0xEF, 0xD2, 0x47, 0x61, 0x65, 0xC3,
-    0x69, 0x6F, 0x75, 0x79, 0xEF, 0xCB, 0xF1, 0x33, 0xFF, 0xF9, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0x5D,
-    0x27, 0x2E, 0x61, 0x62, 0xC3, 0x63, 0x6A, 0x6D, 0x72, 0x70, 0x69, 0x65, 0x64, 0x74, 0x66, 0x67, 0x73, 0x6F, 0x77,
-    0x68, 0x75, 0x76, 0x6C, 0x78, 0x6B, 0x71, 0x6E, 0x79, 0x7A, 0xE7, 0xD0, 0xEF, 0x48, 0xF0, 0xCD, 0xF1, 0x53, 0xF2,
-    0x28, 0xF3, 0xD1, 0xF3, 0xFD, 0xF4, 0xAD, 0xF5, 0x6F, 0xF7, 0x2F, 0xF8, 0x34, 0xF8, 0x98, 0xF9, 0x32, 0xFA, 0x80,
-    0xFA, 0xE4, 0xFB, 0x3C, 0xFC, 0xA4, 0xFD, 0x6C, 0xFD, 0x97, 0xFE, 0x19, 0xFE, 0x4A, 0xFE, 0xDD, 0xFF, 0x35, 0xFF,
-    0x58, 0xFF, 0x65, 0xFF, 0x88, 0xFF, 0xAA, 0xFF, 0xDE, 0xFF, 0xEA,
+// Aho-Corasick automaton for the hypher patterns: 3144 states, 30 dense.
+constexpr uint8_t fr_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x22, 0x23,
+    0x00, 0x00, 0x00, 0x24, 0x25, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns fr_patterns = {
-    0x1AF0u,
-    fr_trie_data,
-    sizeof(fr_trie_data),
+constexpr uint16_t fr_dense[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 1, 2, 30, 4, 5,
+    6, 31, 8, 9, 10, 32, 12, 13, 14, 15, 16, 33, 18, 19, 20, 21,
+    22, 34, 24, 25, 26, 35, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 0, 0, 1, 2, 37, 38, 39, 40, 41, 8, 42, 10, 43,
+    12, 44, 45, 46, 47, 48, 49, 19, 50, 51, 52, 53, 24, 25, 26, 54,
+    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 1,
+    2, 3, 56, 57, 58, 7, 8, 59, 10, 60, 12, 13, 61, 62, 63, 17,
+    64, 19, 65, 66, 22, 67, 68, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 69, 0, 0, 1, 2, 70, 4, 5, 6, 71,
+    8, 9, 10, 72, 12, 13, 73, 15, 16, 74, 18, 19, 75, 21, 22, 76,
+    24, 25, 26, 77, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    78, 0, 0, 1, 2, 79, 4, 80, 6, 81, 8, 9, 82, 83, 12, 84,
+    85, 15, 16, 86, 18, 19, 87, 21, 22, 88, 24, 25, 26, 89, 28, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 91, 0, 92, 2, 93,
+    4, 5, 94, 95, 8, 9, 96, 97, 12, 13, 98, 15, 16, 99, 18, 19,
+    100, 101, 22, 102, 24, 25, 26, 103, 28, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 104, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 105, 17, 18, 19, 106, 107, 22, 108, 24, 25,
+    109, 27, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0,
+    0, 1, 2, 110, 4, 5, 6, 111, 8, 9, 10, 112, 12, 13, 113, 15,
+    16, 114, 18, 19, 115, 116, 22, 117, 24, 25, 26, 118, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 1, 2, 120, 4, 5,
+    6, 121, 8, 9, 122, 123, 12, 13, 124, 15, 125, 126, 18, 19, 127, 128,
+    22, 129, 24, 25, 26, 130, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 1, 2, 132, 4, 5, 6, 133, 8, 9, 10, 134,
+    12, 13, 14, 15, 16, 135, 18, 19, 20, 21, 22, 136, 24, 25, 26, 137,
+    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 1,
+    2, 139, 140, 5, 6, 7, 8, 9, 10, 11, 12, 13, 141, 142, 143, 144,
+    18, 19, 20, 145, 22, 23, 146, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 147, 0, 0, 1, 2, 148, 4, 5, 6, 149,
+    8, 9, 10, 11, 12, 150, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    29, 0, 0, 1, 2, 151, 4, 5, 6, 152, 8, 9, 153, 154, 12, 13,
+    14, 15, 16, 155, 18, 19, 156, 21, 22, 157, 24, 25, 26, 158, 28, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159, 0, 0, 1, 2, 160,
+    4, 5, 6, 161, 8, 9, 10, 162, 12, 13, 163, 164, 16, 165, 18, 19,
+    20, 166, 22, 167, 24, 25, 26, 168, 28, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 169, 0, 0, 1, 2, 170, 4, 5, 6, 171, 8, 9,
+    10, 172, 12, 13, 14, 15, 173, 174, 18, 19, 20, 175, 22, 176, 24, 25,
+    26, 177, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 179,
+    0, 1, 2, 180, 4, 5, 6, 181, 8, 9, 10, 182, 12, 13, 14, 15,
+    16, 183, 18, 19, 20, 184, 22, 185, 24, 25, 186, 187, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 0, 1, 2, 3, 190, 191,
+    192, 7, 8, 193, 10, 194, 12, 13, 14, 195, 16, 17, 196, 19, 197, 198,
+    22, 23, 24, 25, 199, 27, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 200, 0, 0, 1, 2, 201, 4, 5, 6, 202, 8, 9, 203, 204,
+    12, 13, 205, 15, 206, 207, 18, 19, 208, 209, 210, 211, 24, 25, 26, 212,
+    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 213, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 214, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 29, 0, 0, 1, 2, 215, 4, 216, 6, 217,
+    8, 9, 218, 219, 12, 13, 14, 220, 16, 221, 18, 19, 20, 21, 22, 222,
+    24, 25, 26, 223, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    224, 0, 0, 1, 2, 225, 4, 226, 6, 227, 8, 9, 228, 229, 12, 13,
+    230, 15, 16, 231, 232, 19, 20, 21, 233, 234, 24, 25, 26, 235, 28, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 237, 0, 1, 2, 238,
+    4, 239, 6, 240, 8, 9, 241, 242, 12, 13, 14, 15, 16, 243, 18, 19,
+    244, 21, 245, 246, 24, 25, 26, 247, 28, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 248, 0, 0, 1, 2, 3, 4, 249, 6, 250, 8, 9,
+    10, 11, 12, 13, 14, 15, 251, 17, 18, 19, 20, 252, 22, 23, 253, 25,
+    26, 27, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0,
+    0, 1, 2, 254, 4, 5, 6, 255, 8, 9, 10, 256, 12, 13, 14, 15,
+    16, 257, 18, 19, 258, 21, 22, 259, 24, 25, 26, 260, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 261, 0, 0, 1, 2, 262, 4, 5,
+    6, 263, 8, 9, 10, 264, 12, 13, 14, 15, 16, 265, 18, 19, 266, 21,
+    22, 267, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 29, 0, 0, 1, 2, 3, 4, 5, 6, 268, 8, 9, 10, 269,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 1,
+    2, 270, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 271, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 29, 0, 0, 1, 2, 272, 4, 5, 6, 273,
+    8, 9, 10, 274, 12, 13, 14, 15, 16, 275, 18, 19, 20, 21, 22, 276,
+    24, 25, 26, 277, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    278, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0,
+    0, 279, 280, 281, 282, 0, 0, 0, 283, 0, 29, 0,
+};
+
+constexpr uint8_t fr_label[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x28, 0x03, 0x07, 0x0B, 0x11, 0x17, 0x1B, 0x28, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x17, 0x1B, 0x28, 0x04,
+    0x05, 0x06, 0x09, 0x0B, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x17, 0x18, 0x28, 0x03, 0x07, 0x0B, 0x0E, 0x11, 0x14,
+    0x17, 0x1B, 0x28, 0x03, 0x05, 0x07, 0x0A, 0x0B, 0x0D, 0x0E, 0x11, 0x14, 0x17, 0x1B, 0x28, 0x29, 0x01, 0x03, 0x06,
+    0x07, 0x0A, 0x0B, 0x0E, 0x11, 0x14, 0x15, 0x17, 0x1B, 0x28, 0x10, 0x14, 0x15, 0x17, 0x1A, 0x03, 0x07, 0x0B, 0x0E,
+    0x11, 0x14, 0x15, 0x17, 0x1B, 0x28, 0x03, 0x07, 0x0A, 0x0B, 0x0E, 0x10, 0x11, 0x14, 0x15, 0x17, 0x1B, 0x28, 0x03,
+    0x07, 0x0B, 0x11, 0x17, 0x1B, 0x28, 0x03, 0x04, 0x0E, 0x0F, 0x10, 0x11, 0x15, 0x18, 0x28, 0x03, 0x07, 0x0D, 0x03,
+    0x07, 0x0A, 0x0B, 0x11, 0x14, 0x17, 0x1B, 0x28, 0x03, 0x07, 0x0B, 0x0E, 0x0F, 0x11, 0x15, 0x17, 0x1B, 0x28, 0x03,
+    0x07, 0x0B, 0x10, 0x11, 0x15, 0x17, 0x1B, 0x28, 0x29, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x1A, 0x1B, 0x28, 0x29,
+    0x04, 0x05, 0x06, 0x09, 0x0B, 0x0F, 0x12, 0x14, 0x15, 0x1A, 0x28, 0x03, 0x07, 0x0A, 0x0B, 0x0E, 0x10, 0x11, 0x14,
+    0x15, 0x16, 0x17, 0x1B, 0x28, 0x17, 0x03, 0x05, 0x07, 0x0A, 0x0B, 0x0F, 0x11, 0x17, 0x1B, 0x28, 0x03, 0x05, 0x07,
+    0x0A, 0x0B, 0x0E, 0x11, 0x12, 0x16, 0x17, 0x1B, 0x28, 0x29, 0x03, 0x05, 0x07, 0x0A, 0x0B, 0x11, 0x14, 0x16, 0x17,
+    0x1B, 0x28, 0x05, 0x07, 0x10, 0x15, 0x18, 0x03, 0x07, 0x0B, 0x11, 0x14, 0x17, 0x1B, 0x28, 0x03, 0x07, 0x0B, 0x11,
+    0x14, 0x17, 0x07, 0x0B, 0x03, 0x15, 0x03, 0x07, 0x0B, 0x11, 0x17, 0x1B, 0x28, 0x1F, 0x20, 0x21, 0x22, 0x26, 0x04,
+    0x07, 0x09, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x10, 0x17, 0x09, 0x10, 0x05, 0x10, 0x17, 0x18, 0x1F, 0x21, 0x22,
+    0x23, 0x24, 0x26, 0x27, 0x04, 0x07, 0x09, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x03, 0x0B, 0x0A, 0x0B, 0x11, 0x17, 0x03,
+    0x0B, 0x11, 0x1B, 0x28, 0x10, 0x17, 0x07, 0x09, 0x10, 0x0A, 0x03, 0x03, 0x0B, 0x11, 0x28, 0x11, 0x10, 0x17, 0x18,
+    0x03, 0x07, 0x0A, 0x0E, 0x11, 0x14, 0x15, 0x17, 0x28, 0x07, 0x28, 0x03, 0x05, 0x07, 0x0A, 0x11, 0x16, 0x17, 0x1B,
+    0x03, 0x0A, 0x14, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x0A, 0x15, 0x28, 0x05, 0x13, 0x0A, 0x10, 0x0F, 0x03,
+    0x05, 0x03, 0x07, 0x0B, 0x16, 0x11, 0x12, 0x05, 0x0F, 0x0F, 0x16, 0x0F, 0x0B, 0x21, 0x02, 0x10, 0x15, 0x07, 0x17,
+    0x07, 0x17, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x11, 0x12, 0x14, 0x0B, 0x02, 0x10, 0x15, 0x02, 0x04, 0x07,
+    0x09, 0x0B, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x16, 0x19, 0x0E, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x12, 0x15,
+    0x16, 0x03, 0x07, 0x03, 0x07, 0x09, 0x0F, 0x10, 0x14, 0x28, 0x07, 0x14, 0x14, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26,
+    0x27, 0x1D, 0x0F, 0x0A, 0x02, 0x10, 0x15, 0x03, 0x11, 0x03, 0x0E, 0x15, 0x07, 0x07, 0x1F, 0x21, 0x22, 0x23, 0x24,
+    0x26, 0x27, 0x0B, 0x16, 0x0F, 0x05, 0x16, 0x15, 0x16, 0x0F, 0x02, 0x10, 0x15, 0x05, 0x14, 0x03, 0x07, 0x07, 0x0B,
+    0x0F, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x02, 0x10, 0x15, 0x03, 0x07, 0x0B, 0x11, 0x1B, 0x0E, 0x07, 0x07,
+    0x03, 0x07, 0x07, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x02, 0x15, 0x0E, 0x0F, 0x12, 0x1F, 0x21, 0x22, 0x23,
+    0x24, 0x26, 0x27, 0x0E, 0x14, 0x14, 0x0E, 0x0F, 0x12, 0x05, 0x06, 0x08, 0x10, 0x15, 0x16, 0x03, 0x1A, 0x05, 0x16,
+    0x03, 0x21, 0x05, 0x02, 0x10, 0x15, 0x02, 0x10, 0x15, 0x02, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x19, 0x02,
+    0x10, 0x15, 0x0E, 0x0B, 0x17, 0x07, 0x16, 0x1E, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x02, 0x15, 0x0E, 0x0F,
+    0x16, 0x28, 0x10, 0x1B, 0x10, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x1D, 0x02, 0x10, 0x15, 0x03, 0x16, 0x1F,
+    0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x1D, 0x0E, 0x16, 0x0E, 0x10, 0x11, 0x04, 0x0F, 0x10, 0x17, 0x0F, 0x16, 0x1B,
+    0x21, 0x0E, 0x12, 0x02, 0x10, 0x14, 0x15, 0x02, 0x07, 0x0E, 0x10, 0x11, 0x14, 0x15, 0x16, 0x14, 0x07, 0x17, 0x07,
+    0x28, 0x03, 0x0E, 0x07, 0x0B, 0x11, 0x17, 0x28, 0x1B, 0x28, 0x09, 0x12, 0x15, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26,
+    0x27, 0x03, 0x07, 0x06, 0x0B, 0x0F, 0x0B, 0x02, 0x0E, 0x10, 0x12, 0x15, 0x07, 0x1B, 0x0F, 0x10, 0x0B, 0x0E, 0x16,
+    0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x03, 0x0A, 0x0E, 0x11, 0x02, 0x0F, 0x10, 0x14, 0x15, 0x02, 0x07, 0x0F,
+    0x11, 0x14, 0x15, 0x03, 0x11, 0x03, 0x07, 0x0A, 0x0B, 0x11, 0x03, 0x07, 0x0B, 0x11, 0x14, 0x1B, 0x28, 0x04, 0x05,
+    0x0F, 0x12, 0x14, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x1D, 0x05, 0x0F, 0x10, 0x0A, 0x02, 0x0F, 0x10, 0x14,
+    0x15, 0x02, 0x07, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x0F, 0x14, 0x03, 0x07, 0x0B, 0x17, 0x0E, 0x0F, 0x10, 0x14, 0x1E,
+    0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x0B, 0x18, 0x0B, 0x16, 0x0B, 0x05, 0x10, 0x02, 0x10, 0x15, 0x06, 0x0E,
+    0x0E, 0x07, 0x1F, 0x21, 0x22, 0x23, 0x24, 0x26, 0x27, 0x09, 0x02, 0x10, 0x15, 0x10, 0x0E, 0x0E, 0x15, 0x16, 0x02,
+    0x10, 0x15, 0x21, 0x22, 0x0F, 0x0F, 0x05, 0x06, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x0F, 0x14, 0x15, 0x10, 0x05,
+    0x0B, 0x03, 0x07, 0x16, 0x11, 0x09, 0x12, 0x16, 0x03, 0x11, 0x14, 0x10, 0x03, 0x07, 0x08, 0x0B, 0x11, 0x15, 0x16,
+    0x17, 0x28, 0x16, 0x09, 0x03, 0x0B, 0x14, 0x15, 0x10, 0x0B, 0x03, 0x16, 0x11, 0x06, 0x09, 0x12, 0x16, 0x0B, 0x03,
+    0x11, 0x15, 0x17, 0x28, 0x15, 0x0F, 0x10, 0x11, 0x0E, 0x05, 0x03, 0x07, 0x15, 0x0E, 0x15, 0x22, 0x03, 0x11, 0x14,
+    0x0F, 0x10, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x16, 0x17, 0x28, 0x16, 0x05, 0x09, 0x0E, 0x14, 0x0E, 0x10, 0x22, 0x10,
+    0x09, 0x03, 0x0B, 0x10, 0x14, 0x16, 0x10, 0x14, 0x03, 0x17, 0x10, 0x15, 0x11, 0x28, 0x1B, 0x06, 0x22, 0x15, 0x22,
+    0x14, 0x0A, 0x14, 0x17, 0x17, 0x03, 0x0B, 0x04, 0x14, 0x10, 0x0E, 0x0B, 0x0F, 0x07, 0x16, 0x24, 0x07, 0x17, 0x11,
+    0x07, 0x0E, 0x11, 0x0E, 0x15, 0x0F, 0x0B, 0x15, 0x03, 0x0A, 0x07, 0x0B, 0x07, 0x14, 0x07, 0x0E, 0x06, 0x16, 0x02,
+    0x02, 0x10, 0x15, 0x0F, 0x16, 0x02, 0x10, 0x15, 0x0F, 0x17, 0x0B, 0x28, 0x06, 0x16, 0x02, 0x02, 0x10, 0x15, 0x18,
+    0x07, 0x07, 0x11, 0x07, 0x11, 0x0E, 0x02, 0x10, 0x15, 0x0F, 0x02, 0x10, 0x15, 0x05, 0x06, 0x12, 0x14, 0x15, 0x17,
+    0x1A, 0x08, 0x10, 0x1A, 0x10, 0x12, 0x08, 0x10, 0x16, 0x17, 0x12, 0x22, 0x02, 0x10, 0x15, 0x14, 0x0B, 0x07, 0x16,
+    0x02, 0x0E, 0x17, 0x12, 0x0B, 0x05, 0x15, 0x16, 0x10, 0x02, 0x10, 0x15, 0x05, 0x16, 0x18, 0x14, 0x07, 0x07, 0x0A,
+    0x11, 0x0B, 0x16, 0x14, 0x07, 0x16, 0x02, 0x0A, 0x0F, 0x0F, 0x02, 0x10, 0x15, 0x02, 0x10, 0x15, 0x16, 0x07, 0x05,
+    0x16, 0x02, 0x0E, 0x02, 0x10, 0x15, 0x02, 0x10, 0x15, 0x0F, 0x10, 0x02, 0x10, 0x15, 0x02, 0x10, 0x15, 0x02, 0x0E,
+    0x07, 0x07, 0x11, 0x0F, 0x09, 0x16, 0x0B, 0x03, 0x0B, 0x11, 0x17, 0x0B, 0x0B, 0x11, 0x17, 0x11, 0x11, 0x11, 0x16,
+    0x07, 0x0B, 0x05, 0x1B, 0x07, 0x0A, 0x03, 0x0E, 0x06, 0x07, 0x16, 0x02, 0x16, 0x02, 0x14, 0x16, 0x02, 0x0E, 0x11,
+    0x0F, 0x10, 0x02, 0x0E, 0x07, 0x16, 0x21, 0x22, 0x11, 0x16, 0x07, 0x0B, 0x05, 0x16, 0x02, 0x16, 0x14, 0x11, 0x07,
+    0x11, 0x10, 0x17, 0x07, 0x0B, 0x0E, 0x07, 0x03, 0x0B, 0x11, 0x14, 0x28, 0x03, 0x06, 0x28, 0x0B, 0x16, 0x0A, 0x0F,
+    0x16, 0x02, 0x02, 0x10, 0x15, 0x07, 0x16, 0x07, 0x03, 0x0B, 0x0B, 0x02, 0x10, 0x15, 0x0F, 0x17, 0x22, 0x15, 0x1B,
+    0x02, 0x10, 0x15, 0x18, 0x15, 0x28, 0x06, 0x22, 0x05, 0x21, 0x22, 0x10, 0x0B, 0x0B, 0x10, 0x14, 0x0F, 0x02, 0x10,
+    0x15, 0x0B, 0x0F, 0x07, 0x0E, 0x07, 0x0B, 0x16, 0x07, 0x02, 0x02, 0x15, 0x17, 0x06, 0x07, 0x09, 0x0E, 0x07, 0x0A,
+    0x09, 0x0F, 0x15, 0x16, 0x12, 0x02, 0x07, 0x15, 0x28, 0x12, 0x0B, 0x16, 0x09, 0x12, 0x02, 0x13, 0x02, 0x10, 0x15,
+    0x0F, 0x0E, 0x18, 0x18, 0x16, 0x14, 0x28, 0x07, 0x14, 0x14, 0x10, 0x0B, 0x09, 0x05, 0x0F, 0x11, 0x17, 0x0E, 0x22,
+    0x0E, 0x15, 0x05, 0x07, 0x07, 0x03, 0x28, 0x0A, 0x07, 0x09, 0x0B, 0x12, 0x16, 0x09, 0x02, 0x16, 0x02, 0x14, 0x15,
+    0x17, 0x07, 0x0B, 0x07, 0x14, 0x10, 0x02, 0x10, 0x15, 0x06, 0x05, 0x07, 0x09, 0x04, 0x0E, 0x0E, 0x0B, 0x03, 0x11,
+    0x14, 0x0E, 0x0B, 0x0B, 0x0B, 0x16, 0x02, 0x0B, 0x0E, 0x16, 0x02, 0x10, 0x15, 0x0E, 0x10, 0x16, 0x02, 0x16, 0x0E,
+    0x09, 0x16, 0x11, 0x16, 0x02, 0x07, 0x07, 0x07, 0x0B, 0x17, 0x07, 0x0A, 0x14, 0x07, 0x0B, 0x11, 0x28, 0x0B, 0x07,
+    0x0B, 0x0B, 0x17, 0x07, 0x07, 0x28, 0x05, 0x03, 0x11, 0x10, 0x15, 0x15, 0x0B, 0x15, 0x07, 0x07, 0x03, 0x03, 0x0B,
+    0x28, 0x10, 0x17, 0x08, 0x12, 0x14, 0x1A, 0x11, 0x0F, 0x13, 0x16, 0x05, 0x10, 0x16, 0x07, 0x0B, 0x0E, 0x22, 0x07,
+    0x17, 0x11, 0x15, 0x28, 0x05, 0x03, 0x10, 0x15, 0x0B, 0x15, 0x07, 0x07, 0x07, 0x03, 0x15, 0x05, 0x16, 0x17, 0x03,
+    0x03, 0x21, 0x03, 0x0F, 0x15, 0x16, 0x0E, 0x14, 0x05, 0x0E, 0x0F, 0x16, 0x10, 0x0A, 0x07, 0x03, 0x0B, 0x11, 0x17,
+    0x03, 0x0B, 0x11, 0x15, 0x03, 0x0F, 0x0B, 0x28, 0x10, 0x17, 0x08, 0x12, 0x14, 0x1A, 0x0F, 0x13, 0x16, 0x05, 0x10,
+    0x16, 0x07, 0x0B, 0x0E, 0x22, 0x07, 0x0D, 0x14, 0x10, 0x03, 0x07, 0x0B, 0x11, 0x1A, 0x0E, 0x11, 0x09, 0x15, 0x16,
+    0x11, 0x17, 0x11, 0x15, 0x03, 0x0B, 0x11, 0x03, 0x07, 0x0A, 0x07, 0x16, 0x03, 0x07, 0x0B, 0x11, 0x17, 0x28, 0x0E,
+    0x14, 0x16, 0x16, 0x09, 0x15, 0x17, 0x28, 0x22, 0x05, 0x06, 0x14, 0x05, 0x12, 0x13, 0x15, 0x16, 0x03, 0x07, 0x0B,
+    0x11, 0x16, 0x17, 0x28, 0x0F, 0x0F, 0x0E, 0x18, 0x09, 0x0E, 0x03, 0x0B, 0x0E, 0x17, 0x28, 0x03, 0x07, 0x0A, 0x0B,
+    0x11, 0x28, 0x09, 0x07, 0x03, 0x11, 0x0B, 0x10, 0x0B, 0x0F, 0x10, 0x0B, 0x15, 0x10, 0x09, 0x11, 0x09, 0x16, 0x07,
+    0x08, 0x16, 0x14, 0x0B, 0x10, 0x0E, 0x10, 0x11, 0x10, 0x0E, 0x14, 0x02, 0x16, 0x02, 0x07, 0x0B, 0x16, 0x02, 0x07,
+    0x16, 0x0E, 0x23, 0x07, 0x02, 0x16, 0x02, 0x0B, 0x10, 0x02, 0x15, 0x14, 0x02, 0x15, 0x0F, 0x16, 0x02, 0x07, 0x16,
+    0x02, 0x05, 0x13, 0x15, 0x0B, 0x28, 0x0B, 0x0B, 0x0B, 0x14, 0x17, 0x16, 0x02, 0x07, 0x0E, 0x10, 0x02, 0x06, 0x0A,
+    0x09, 0x11, 0x0B, 0x0B, 0x16, 0x16, 0x02, 0x03, 0x14, 0x14, 0x07, 0x10, 0x10, 0x12, 0x0F, 0x03, 0x03, 0x10, 0x02,
+    0x17, 0x07, 0x0F, 0x16, 0x02, 0x16, 0x02, 0x0B, 0x10, 0x17, 0x02, 0x16, 0x02, 0x16, 0x02, 0x0F, 0x06, 0x16, 0x02,
+    0x16, 0x02, 0x10, 0x14, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x28, 0x0B, 0x11, 0x0B, 0x0A, 0x0E, 0x10, 0x10, 0x15,
+    0x16, 0x06, 0x06, 0x09, 0x0E, 0x0E, 0x14, 0x05, 0x0E, 0x0B, 0x0E, 0x0F, 0x16, 0x10, 0x0B, 0x28, 0x16, 0x07, 0x14,
+    0x10, 0x02, 0x02, 0x07, 0x02, 0x10, 0x07, 0x16, 0x07, 0x10, 0x07, 0x15, 0x0F, 0x15, 0x18, 0x14, 0x10, 0x08, 0x11,
+    0x02, 0x02, 0x15, 0x0B, 0x10, 0x16, 0x0F, 0x15, 0x0B, 0x06, 0x10, 0x12, 0x15, 0x07, 0x10, 0x15, 0x16, 0x0F, 0x0F,
+    0x03, 0x0B, 0x22, 0x14, 0x22, 0x0E, 0x02, 0x03, 0x0B, 0x16, 0x02, 0x02, 0x15, 0x11, 0x02, 0x15, 0x0E, 0x15, 0x0E,
+    0x16, 0x02, 0x07, 0x16, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x18, 0x28, 0x16, 0x02, 0x03, 0x16, 0x22, 0x07, 0x15,
+    0x28, 0x0A, 0x14, 0x14, 0x03, 0x0E, 0x0E, 0x17, 0x28, 0x07, 0x16, 0x02, 0x11, 0x07, 0x10, 0x0E, 0x10, 0x0F, 0x02,
+    0x10, 0x02, 0x14, 0x14, 0x10, 0x07, 0x0E, 0x10, 0x0F, 0x07, 0x03, 0x17, 0x0B, 0x0A, 0x02, 0x15, 0x22, 0x0E, 0x02,
+    0x07, 0x07, 0x17, 0x16, 0x02, 0x11, 0x0B, 0x0F, 0x21, 0x22, 0x0E, 0x11, 0x17, 0x06, 0x10, 0x0F, 0x0D, 0x11, 0x12,
+    0x05, 0x07, 0x14, 0x0B, 0x17, 0x10, 0x14, 0x0A, 0x22, 0x1B, 0x10, 0x07, 0x10, 0x28, 0x02, 0x07, 0x03, 0x0F, 0x02,
+    0x14, 0x02, 0x15, 0x0E, 0x10, 0x07, 0x15, 0x16, 0x02, 0x07, 0x17, 0x10, 0x15, 0x17, 0x28, 0x0E, 0x0E, 0x1A, 0x18,
+    0x0E, 0x0E, 0x0E, 0x0F, 0x02, 0x14, 0x0F, 0x03, 0x16, 0x02, 0x11, 0x02, 0x02, 0x0B, 0x0A, 0x0F, 0x02, 0x10, 0x10,
+    0x10, 0x0F, 0x0F, 0x10, 0x0B, 0x0B, 0x05, 0x0F, 0x13, 0x22, 0x0E, 0x14, 0x16, 0x15, 0x07, 0x0B, 0x10, 0x10, 0x22,
+    0x0A, 0x16, 0x11, 0x11, 0x16, 0x16, 0x03, 0x07, 0x15, 0x28, 0x16, 0x10, 0x10, 0x22, 0x0B, 0x09, 0x08, 0x16, 0x11,
+    0x14, 0x0B, 0x17, 0x06, 0x03, 0x14, 0x16, 0x0E, 0x10, 0x16, 0x07, 0x17, 0x05, 0x22, 0x0A, 0x16, 0x11, 0x16, 0x03,
+    0x07, 0x15, 0x28, 0x16, 0x10, 0x10, 0x10, 0x07, 0x18, 0x0E, 0x07, 0x14, 0x0B, 0x1B, 0x0B, 0x28, 0x06, 0x0B, 0x11,
+    0x10, 0x11, 0x03, 0x05, 0x07, 0x0B, 0x11, 0x12, 0x16, 0x17, 0x28, 0x29, 0x07, 0x22, 0x0B, 0x09, 0x08, 0x16, 0x11,
+    0x0B, 0x17, 0x06, 0x03, 0x14, 0x16, 0x0E, 0x10, 0x10, 0x11, 0x0B, 0x17, 0x06, 0x0B, 0x12, 0x18, 0x10, 0x10, 0x05,
+    0x06, 0x0B, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x28, 0x11, 0x03, 0x07, 0x0B, 0x17, 0x03, 0x04, 0x07, 0x17, 0x05,
+    0x08, 0x0F, 0x14, 0x15, 0x12, 0x05, 0x15, 0x10, 0x28, 0x10, 0x03, 0x22, 0x03, 0x0B, 0x07, 0x0A, 0x0B, 0x11, 0x14,
+    0x15, 0x10, 0x05, 0x06, 0x22, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x28, 0x0A, 0x0E, 0x0B, 0x03, 0x0B, 0x11, 0x14,
+    0x07, 0x0B, 0x0E, 0x11, 0x17, 0x07, 0x03, 0x0B, 0x11, 0x14, 0x17, 0x1B, 0x28, 0x0E, 0x17, 0x0E, 0x14, 0x08, 0x14,
+    0x15, 0x21, 0x22, 0x07, 0x07, 0x07, 0x07, 0x10, 0x0E, 0x0E, 0x10, 0x0B, 0x17, 0x14, 0x22, 0x16, 0x03, 0x0E, 0x16,
+    0x0F, 0x10, 0x08, 0x1A, 0x22, 0x10, 0x10, 0x05, 0x10, 0x16, 0x10, 0x10, 0x16, 0x10, 0x07, 0x16, 0x07, 0x16, 0x0B,
+    0x0E, 0x03, 0x0A, 0x10, 0x07, 0x14, 0x07, 0x28, 0x16, 0x0E, 0x16, 0x16, 0x07, 0x02, 0x10, 0x0E, 0x02, 0x10, 0x0E,
+    0x0F, 0x10, 0x02, 0x0E, 0x06, 0x02, 0x03, 0x28, 0x02, 0x07, 0x02, 0x10, 0x02, 0x11, 0x17, 0x16, 0x22, 0x06, 0x18,
+    0x10, 0x04, 0x0E, 0x02, 0x10, 0x0E, 0x16, 0x14, 0x07, 0x12, 0x06, 0x0E, 0x02, 0x02, 0x06, 0x0B, 0x09, 0x16, 0x16,
+    0x07, 0x16, 0x05, 0x0B, 0x16, 0x0F, 0x10, 0x07, 0x02, 0x02, 0x0E, 0x16, 0x0E, 0x02, 0x02, 0x07, 0x0B, 0x02, 0x02,
+    0x16, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x28, 0x22, 0x28, 0x12, 0x14, 0x0E, 0x07, 0x07, 0x05, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x09, 0x0F, 0x07, 0x07, 0x0E, 0x0E, 0x07, 0x16, 0x03, 0x11, 0x22, 0x10, 0x07, 0x16, 0x10, 0x02, 0x16,
+    0x16, 0x10, 0x11, 0x0B, 0x03, 0x28, 0x28, 0x0B, 0x10, 0x02, 0x0F, 0x09, 0x11, 0x0B, 0x15, 0x16, 0x11, 0x10, 0x16,
+    0x06, 0x16, 0x05, 0x14, 0x07, 0x11, 0x0E, 0x10, 0x10, 0x02, 0x02, 0x15, 0x02, 0x28, 0x0E, 0x02, 0x10, 0x14, 0x03,
+    0x21, 0x22, 0x02, 0x16, 0x03, 0x0F, 0x10, 0x07, 0x22, 0x04, 0x05, 0x0E, 0x0E, 0x0E, 0x22, 0x10, 0x02, 0x03, 0x10,
+    0x16, 0x16, 0x07, 0x16, 0x16, 0x10, 0x16, 0x07, 0x10, 0x10, 0x14, 0x05, 0x02, 0x14, 0x0E, 0x10, 0x10, 0x0B, 0x02,
+    0x0F, 0x03, 0x14, 0x14, 0x15, 0x0E, 0x03, 0x15, 0x0A, 0x16, 0x28, 0x0F, 0x0E, 0x16, 0x11, 0x15, 0x0F, 0x03, 0x16,
+    0x10, 0x16, 0x22, 0x10, 0x0F, 0x11, 0x02, 0x0E, 0x16, 0x10, 0x03, 0x0A, 0x11, 0x12, 0x17, 0x02, 0x10, 0x0E, 0x16,
+    0x0E, 0x22, 0x0E, 0x0E, 0x0E, 0x07, 0x0B, 0x07, 0x0F, 0x02, 0x15, 0x16, 0x16, 0x16, 0x07, 0x07, 0x16, 0x07, 0x13,
+    0x16, 0x07, 0x17, 0x0F, 0x0E, 0x09, 0x07, 0x05, 0x10, 0x12, 0x18, 0x16, 0x16, 0x03, 0x0E, 0x03, 0x14, 0x0A, 0x10,
+    0x22, 0x03, 0x16, 0x16, 0x16, 0x17, 0x03, 0x14, 0x0F, 0x16, 0x0E, 0x04, 0x03, 0x07, 0x0B, 0x11, 0x15, 0x17, 0x28,
+    0x17, 0x03, 0x10, 0x03, 0x03, 0x14, 0x10, 0x22, 0x03, 0x16, 0x16, 0x16, 0x0F, 0x14, 0x12, 0x10, 0x07, 0x07, 0x11,
+    0x06, 0x22, 0x0F, 0x16, 0x05, 0x0F, 0x15, 0x16, 0x10, 0x14, 0x1A, 0x06, 0x09, 0x0E, 0x10, 0x14, 0x15, 0x06, 0x0E,
+    0x12, 0x14, 0x17, 0x10, 0x22, 0x1D, 0x10, 0x16, 0x17, 0x03, 0x14, 0x16, 0x0E, 0x04, 0x03, 0x07, 0x0B, 0x11, 0x15,
+    0x17, 0x28, 0x17, 0x03, 0x16, 0x15, 0x05, 0x08, 0x0F, 0x14, 0x15, 0x16, 0x03, 0x22, 0x25, 0x0A, 0x10, 0x15, 0x15,
+    0x15, 0x15, 0x10, 0x28, 0x03, 0x0A, 0x16, 0x0A, 0x16, 0x22, 0x16, 0x10, 0x03, 0x16, 0x10, 0x03, 0x28, 0x0A, 0x0E,
+    0x17, 0x22, 0x11, 0x11, 0x15, 0x17, 0x12, 0x15, 0x17, 0x0B, 0x05, 0x14, 0x07, 0x10, 0x0B, 0x10, 0x04, 0x09, 0x10,
+    0x16, 0x0F, 0x12, 0x05, 0x12, 0x07, 0x0B, 0x22, 0x07, 0x0B, 0x1A, 0x0B, 0x11, 0x15, 0x14, 0x10, 0x10, 0x10, 0x16,
+    0x0F, 0x10, 0x14, 0x17, 0x0E, 0x08, 0x16, 0x03, 0x16, 0x07, 0x02, 0x07, 0x10, 0x02, 0x15, 0x02, 0x0F, 0x28, 0x16,
+    0x14, 0x10, 0x22, 0x02, 0x02, 0x02, 0x16, 0x0E, 0x16, 0x07, 0x16, 0x0E, 0x07, 0x05, 0x22, 0x10, 0x16, 0x05, 0x14,
+    0x0B, 0x16, 0x07, 0x07, 0x07, 0x09, 0x07, 0x16, 0x02, 0x03, 0x10, 0x07, 0x0E, 0x07, 0x0F, 0x07, 0x02, 0x02, 0x10,
+    0x02, 0x07, 0x16, 0x10, 0x0E, 0x02, 0x07, 0x10, 0x0E, 0x02, 0x22, 0x22, 0x16, 0x10, 0x10, 0x07, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x07, 0x03, 0x10, 0x10, 0x0E, 0x0B, 0x10, 0x02, 0x16, 0x02, 0x16, 0x02, 0x16, 0x0E, 0x22, 0x1F, 0x05,
+    0x16, 0x07, 0x10, 0x02, 0x16, 0x16, 0x02, 0x17, 0x16, 0x11, 0x28, 0x03, 0x07, 0x0B, 0x11, 0x07, 0x07, 0x22, 0x16,
+    0x07, 0x0E, 0x06, 0x16, 0x0B, 0x16, 0x10, 0x0F, 0x0E, 0x13, 0x16, 0x16, 0x02, 0x02, 0x10, 0x02, 0x02, 0x16, 0x02,
+    0x10, 0x16, 0x07, 0x09, 0x07, 0x16, 0x16, 0x03, 0x07, 0x07, 0x14, 0x17, 0x22, 0x07, 0x07, 0x02, 0x0B, 0x02, 0x16,
+    0x14, 0x16, 0x07, 0x15, 0x02, 0x16, 0x05, 0x16, 0x03, 0x16, 0x07, 0x02, 0x07, 0x07, 0x0B, 0x11, 0x15, 0x0B, 0x10,
+    0x12, 0x10, 0x12, 0x0D, 0x02, 0x02, 0x02, 0x10, 0x10, 0x02, 0x17, 0x14, 0x10, 0x07, 0x07, 0x10, 0x11, 0x16, 0x11,
+    0x03, 0x02, 0x02, 0x05, 0x28, 0x10, 0x02, 0x02, 0x14, 0x04, 0x03, 0x03, 0x0B, 0x22, 0x05, 0x14, 0x16, 0x05, 0x10,
+    0x02, 0x02, 0x02, 0x03, 0x07, 0x16, 0x0F, 0x15, 0x03, 0x02, 0x14, 0x16, 0x07, 0x15, 0x16, 0x17, 0x10, 0x0B, 0x07,
+    0x18, 0x16, 0x28, 0x0B, 0x0F, 0x12, 0x08, 0x09, 0x16, 0x14, 0x04, 0x03, 0x0B, 0x22, 0x05, 0x14, 0x02, 0x05, 0x0B,
+    0x0B, 0x07, 0x11, 0x28, 0x0F, 0x06, 0x16, 0x16, 0x22, 0x07, 0x28, 0x02, 0x02, 0x15, 0x16, 0x22, 0x03, 0x03, 0x15,
+    0x15, 0x16, 0x0B, 0x11, 0x16, 0x10, 0x15, 0x0E, 0x16, 0x06, 0x0B, 0x05, 0x10, 0x10, 0x14, 0x15, 0x16, 0x03, 0x16,
+    0x16, 0x16, 0x0B, 0x16, 0x02, 0x10, 0x10, 0x16, 0x05, 0x07, 0x22, 0x02, 0x0F, 0x16, 0x12, 0x02, 0x02, 0x10, 0x02,
+    0x10, 0x16, 0x16, 0x02, 0x07, 0x10, 0x10, 0x10, 0x07, 0x10, 0x02, 0x09, 0x16, 0x10, 0x10, 0x07, 0x10, 0x16, 0x10,
+    0x02, 0x16, 0x10, 0x16, 0x11, 0x16, 0x16, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x10, 0x16, 0x16, 0x16, 0x09, 0x16,
+    0x02, 0x02, 0x02, 0x07, 0x03, 0x09, 0x07, 0x07, 0x10, 0x0B, 0x07, 0x02, 0x0B, 0x22, 0x0F, 0x10, 0x10, 0x02, 0x07,
+    0x11, 0x10, 0x02, 0x16, 0x0B, 0x07, 0x02, 0x02, 0x16, 0x02, 0x16, 0x02, 0x10, 0x07, 0x10, 0x02, 0x02, 0x10, 0x10,
+    0x06, 0x11, 0x10, 0x10, 0x10, 0x02, 0x03, 0x02, 0x10, 0x02, 0x16, 0x15, 0x14, 0x02, 0x10, 0x10, 0x04, 0x12, 0x10,
+    0x15, 0x16, 0x11, 0x16, 0x0B, 0x16, 0x16, 0x07, 0x16, 0x10, 0x10, 0x16, 0x12, 0x02, 0x16, 0x0E, 0x22, 0x07, 0x16,
+    0x16, 0x14, 0x02, 0x07, 0x0B, 0x08, 0x02, 0x03, 0x05, 0x14, 0x0E, 0x0B, 0x10, 0x11, 0x22, 0x0E, 0x14, 0x14, 0x02,
+    0x16, 0x14, 0x06, 0x05, 0x15, 0x22, 0x28, 0x03, 0x02, 0x21, 0x16, 0x0A, 0x10, 0x03, 0x06, 0x02, 0x10, 0x16, 0x02,
+    0x02, 0x02, 0x10, 0x0A, 0x16, 0x16, 0x02, 0x07, 0x10, 0x15, 0x07, 0x02, 0x0B, 0x16, 0x16, 0x02, 0x10, 0x16, 0x16,
+    0x16, 0x10, 0x16, 0x0F, 0x02, 0x16, 0x16, 0x10, 0x16, 0x02, 0x16, 0x02, 0x16, 0x02, 0x13, 0x02, 0x02, 0x16, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x16, 0x02, 0x02, 0x07, 0x02, 0x10, 0x0E, 0x10, 0x10, 0x16, 0x10, 0x11, 0x16, 0x16, 0x10,
+    0x05, 0x1C, 0x07, 0x02, 0x10, 0x02, 0x02, 0x16, 0x10, 0x16, 0x16, 0x16, 0x15, 0x16, 0x16, 0x07, 0x0F, 0x16, 0x07,
+    0x16, 0x16, 0x02, 0x16, 0x02, 0x02, 0x02, 0x02, 0x16, 0x16, 0x02, 0x07, 0x07, 0x07, 0x15, 0x03, 0x03, 0x10, 0x07,
+    0x28, 0x0E, 0x04, 0x03, 0x03, 0x07, 0x03, 0x22, 0x02, 0x02, 0x10, 0x16, 0x0B, 0x10, 0x15, 0x02, 0x02, 0x16, 0x02,
+    0x02, 0x02, 0x16, 0x02, 0x07, 0x02, 0x02, 0x16, 0x02, 0x02, 0x02, 0x17, 0x02, 0x02, 0x10, 0x16, 0x16, 0x16, 0x02,
+    0x16, 0x10, 0x02, 0x02, 0x16, 0x07, 0x07, 0x10, 0x07, 0x02, 0x16, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x07, 0x02,
+    0x10, 0x02, 0x02, 0x07, 0x02, 0x10, 0x10, 0x0B, 0x17, 0x24, 0x16, 0x16, 0x02, 0x16, 0x02, 0x02, 0x10, 0x02, 0x07,
+    0x16, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x10, 0x16, 0x10, 0x02, 0x16, 0x10, 0x16, 0x10, 0x16, 0x16, 0x0B, 0x16,
+    0x02, 0x02, 0x16, 0x10, 0x02, 0x16, 0x16, 0x02, 0x16, 0x02, 0x16, 0x02, 0x16, 0x02, 0x02, 0x0E, 0x14, 0x02, 0x16,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x0E, 0x07, 0x02, 0x07,
+};
+
+constexpr uint16_t fr_child_base[] = {
+    1, 180, 295, 339, 385, 411, 463, 488, 515, 547, 568, 593, 617, 649, 684, 737,
+    777, 797, 817, 842, 860, 890, 911, 925, 937, 958, 965, 978, 1003, 1009, 1024, 1044,
+    1051, 1067, 1080, 1097, 1104, 1112, 1119, 1127, 1148, 1170, 1183, 1201, 1217, 1235, 1245, 1260,
+    1270, 1287, 1297, 1319, 1338, 1358, 1375, 1406, 1429, 1467, 1492, 1508, 1521, 1535, 1543, 1556,
+    1570, 1582, 1594, 1613, 1629, 1642, 1658, 1677, 1691, 1712, 1727, 1741, 1753, 1767, 1782, 1796,
+    1811, 1822, 1837, 1856, 1867, 1886, 1895, 1912, 1924, 1952, 1968, 1995, 2022, 2044, 2059, 2070,
+    2082, 2094, 2106, 2119, 2136, 2145, 2160, 2170, 2182, 2193, 2203, 2213, 2226, 2235, 2247, 2259,
+    2271, 2285, 2293, 2310, 2322, 2339, 2349, 2364, 2387, 2405, 2413, 2424, 2433, 2447, 2466, 2475,
+    2483, 2495, 2504, 2516, 2527, 2536, 2543, 2556, 2566, 2580, 2587, 2597, 2610, 2619, 2630, 2643,
+    2656, 2666, 2673, 2684, 2695, 2708, 2716, 2725, 2734, 2745, 2754, 2761, 2771, 2781, 2792, 2802,
+    2814, 2826, 2836, 2846, 2858, 2870, 2880, 2888, 2897, 2904, 2912, 2920, 2925, 2937, 2948, 2962,
+    2974, 2985, 2993, 3002, 3012, 3022, 3028, 3029, 3040, 3052, 3057, 3070, 3082, 3088, 3093, 3099,
+    3108, 3116, 3122, 3135, 3143,
+};
+
+constexpr uint8_t fr_child_offset[] = {
+    0x00, 0x1D, 0x24, 0x37, 0x45, 0x4E, 0x5B, 0x68, 0x6D, 0x77, 0x83, 0x8A, 0x93, 0x96, 0x9F, 0xA9, 0x00, 0x0A, 0x15,
+    0x22, 0x23, 0x2D, 0x3A, 0x45, 0x4A, 0x52, 0x58, 0x5A, 0x5C, 0x63, 0x68, 0x71, 0x00, 0x02, 0x06, 0x06, 0x06, 0x0D,
+    0x15, 0x17, 0x1B, 0x20, 0x22, 0x23, 0x25, 0x26, 0x27, 0x2B, 0x00, 0x03, 0x0C, 0x0E, 0x16, 0x19, 0x19, 0x19, 0x20,
+    0x23, 0x25, 0x26, 0x27, 0x28, 0x2A, 0x2B, 0x00, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0C, 0x0C, 0x0D, 0x0E,
+    0x10, 0x10, 0x10, 0x17, 0x00, 0x01, 0x04, 0x11, 0x12, 0x1B, 0x1D, 0x24, 0x25, 0x26, 0x27, 0x2E, 0x2F, 0x2F, 0x30,
+    0x31, 0x00, 0x02, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x00, 0x02,
+    0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x0E, 0x0E, 0x11, 0x16, 0x17, 0x18, 0x19, 0x19, 0x00, 0x00, 0x01, 0x01, 0x08,
+    0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x14, 0x16, 0x17, 0x18, 0x1A, 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0A,
+    0x0A, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x01, 0x04, 0x05, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x11,
+    0x11, 0x13, 0x16, 0x17, 0x19, 0x00, 0x01, 0x01, 0x08, 0x09, 0x09, 0x0C, 0x0C, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x15,
+    0x16, 0x17, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x11, 0x19, 0x1A, 0x1C, 0x1E, 0x00,
+    0x05, 0x06, 0x07, 0x0A, 0x0A, 0x11, 0x13, 0x16, 0x17, 0x1C, 0x1E, 0x20, 0x21, 0x21, 0x22, 0x00, 0x07, 0x07, 0x0B,
+    0x10, 0x16, 0x16, 0x18, 0x18, 0x1D, 0x24, 0x29, 0x29, 0x30, 0x31, 0x34, 0x00, 0x05, 0x0C, 0x0C, 0x0E, 0x12, 0x13,
+    0x16, 0x16, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x25, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x0B, 0x0C, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x10, 0x11, 0x13, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x06, 0x06, 0x07, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x00, 0x01, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x19,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x0B, 0x0C, 0x10, 0x11, 0x00, 0x03, 0x04,
+    0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x18, 0x18, 0x19, 0x1D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x06, 0x08, 0x0A,
+    0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x10,
+    0x12, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x00, 0x00,
+    0x04, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x04, 0x0B, 0x0E, 0x0F, 0x10, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x0A, 0x0A, 0x0A, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0C, 0x0D, 0x0E, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0F, 0x12,
+    0x13, 0x14, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00,
+    0x03, 0x05, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x08, 0x09, 0x0C, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x06, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0E, 0x0F, 0x0F, 0x12, 0x13, 0x13, 0x14, 0x00, 0x00, 0x02, 0x03, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0E, 0x0E, 0x12, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0C, 0x0F,
+    0x0F, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x00, 0x02,
+    0x03, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x06, 0x06, 0x0A, 0x0A, 0x0A, 0x0A, 0x0C, 0x0C, 0x0D, 0x0E, 0x00, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x09, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x08, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0C, 0x0E, 0x12, 0x00, 0x03, 0x05, 0x06,
+    0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x01, 0x05, 0x06, 0x07, 0x08, 0x0C, 0x10, 0x10, 0x10,
+    0x11, 0x12, 0x14, 0x16, 0x1A, 0x1D, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0D, 0x0E, 0x0F, 0x10, 0x13,
+    0x14, 0x15, 0x16, 0x00, 0x03, 0x06, 0x07, 0x08, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1F,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x0B, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04,
+    0x04, 0x05, 0x06, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0B, 0x0C, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0E, 0x0F, 0x00,
+    0x01, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x11, 0x12, 0x00, 0x01, 0x02, 0x02,
+    0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04,
+    0x0C, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x02, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07,
+    0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x10, 0x11, 0x12, 0x13, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x11, 0x12, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x07, 0x07, 0x11, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09,
+    0x0A, 0x0B, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x05, 0x07, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x10, 0x17, 0x18, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x14, 0x15, 0x16, 0x17, 0x00, 0x04, 0x05, 0x06, 0x0D, 0x0F, 0x11,
+    0x12, 0x12, 0x13, 0x14, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x0B, 0x0B,
+    0x0D, 0x0F, 0x10, 0x11, 0x12, 0x15, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x07, 0x08,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x09, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0E, 0x0F, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06,
+    0x07, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08,
+    0x08, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C,
+    0x0C, 0x0C, 0x0D, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x0F, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09,
+    0x0A, 0x0B, 0x0B, 0x0F, 0x00, 0x03, 0x09, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x12, 0x13, 0x14, 0x15, 0x15,
+    0x16, 0x00, 0x01, 0x01, 0x02, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x12, 0x12, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x05, 0x06, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04,
+    0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x05, 0x07, 0x09, 0x0B, 0x0B, 0x0B, 0x0C, 0x0E, 0x0F, 0x0F, 0x0F, 0x10,
+    0x11, 0x12, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x00,
+    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05,
+    0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08,
+    0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x09, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x09,
+    0x0A, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x03, 0x03,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x04, 0x04, 0x05, 0x06,
+    0x06, 0x07, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x08, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x06, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07,
+    0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0B, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09,
+    0x0A, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x06, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08,
+    0x09, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0B, 0x0C, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+};
+
+constexpr uint16_t fr_fail[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 7,
+    11, 17, 23, 27, 29, 3, 4, 5, 6, 7, 9, 11, 13, 14, 15, 16,
+    17, 18, 20, 21, 22, 23, 27, 29, 4, 5, 6, 9, 11, 14, 15, 16,
+    18, 20, 21, 23, 24, 29, 3, 7, 11, 14, 17, 20, 23, 27, 29, 3,
+    5, 7, 10, 11, 13, 14, 17, 20, 23, 27, 29, 0, 1, 3, 6, 7,
+    10, 11, 14, 17, 20, 21, 23, 27, 29, 16, 20, 21, 23, 26, 3, 7,
+    11, 14, 17, 20, 21, 23, 27, 29, 3, 7, 10, 11, 14, 16, 17, 20,
+    21, 23, 27, 29, 3, 7, 11, 17, 23, 27, 29, 3, 4, 14, 15, 16,
+    17, 21, 24, 29, 3, 7, 13, 3, 7, 10, 11, 17, 20, 23, 27, 29,
+    3, 7, 11, 14, 15, 17, 21, 23, 27, 29, 3, 7, 11, 16, 17, 21,
+    23, 27, 29, 0, 3, 7, 11, 17, 21, 23, 26, 27, 29, 0, 4, 5,
+    6, 9, 11, 15, 18, 20, 21, 26, 29, 3, 7, 10, 11, 14, 16, 17,
+    20, 21, 22, 23, 27, 29, 23, 3, 5, 7, 10, 11, 15, 17, 23, 27,
+    29, 3, 5, 7, 10, 11, 14, 17, 18, 22, 23, 27, 29, 0, 3, 5,
+    7, 10, 11, 17, 20, 22, 23, 27, 29, 5, 7, 16, 21, 24, 3, 7,
+    11, 17, 20, 23, 27, 29, 3, 7, 11, 17, 20, 23, 7, 11, 3, 21,
+    3, 7, 11, 17, 23, 27, 29, 0, 0, 0, 0, 0, 56, 7, 59, 61,
+    62, 63, 64, 65, 66, 105, 108, 9, 143, 191, 16, 23, 24, 279, 281, 282,
+    0, 0, 283, 0, 56, 7, 59, 62, 63, 64, 65, 66, 70, 72, 82, 83,
+    86, 88, 93, 97, 99, 103, 104, 105, 108, 121, 9, 143, 153, 160, 170, 172,
+    174, 178, 183, 16, 23, 24, 201, 202, 203, 205, 207, 208, 209, 211, 213, 217,
+    224, 225, 226, 227, 228, 231, 233, 234, 235, 238, 241, 244, 279, 281, 282, 0,
+    0, 283, 0, 10, 21, 78, 80, 19, 96, 125, 142, 160, 5, 170, 181, 182,
+    22, 207, 18, 216, 220, 15, 233, 15, 256, 281, 2, 105, 107, 161, 23, 217,
+    222, 279, 281, 282, 0, 0, 283, 0, 17, 64, 65, 83, 2, 105, 107, 2,
+    4, 133, 9, 134, 14, 15, 16, 18, 20, 21, 22, 25, 141, 2, 4, 152,
+    8, 9, 153, 18, 21, 22, 160, 161, 3, 7, 193, 195, 16, 197, 200, 217,
+    20, 20, 279, 281, 282, 0, 0, 283, 0, 0, 62, 96, 2, 105, 107, 132,
+    135, 139, 141, 145, 161, 217, 279, 281, 282, 0, 0, 283, 0, 182, 22, 220,
+    226, 233, 252, 22, 62, 2, 105, 107, 5, 20, 160, 161, 217, 219, 15, 279,
+    281, 282, 0, 0, 283, 0, 2, 105, 107, 132, 133, 134, 135, 137, 141, 161,
+    181, 215, 217, 250, 279, 281, 282, 0, 0, 283, 0, 2, 107, 141, 15, 18,
+    279, 281, 282, 0, 0, 283, 0, 61, 65, 75, 163, 15, 18, 5, 6, 8,
+    16, 184, 22, 3, 199, 226, 233, 254, 281, 57, 2, 105, 107, 2, 105, 107,
+    2, 279, 281, 282, 0, 0, 283, 0, 25, 2, 105, 107, 141, 162, 167, 171,
+    233, 0, 279, 281, 282, 0, 0, 283, 0, 2, 107, 141, 142, 22, 188, 16,
+    27, 251, 279, 281, 282, 0, 0, 283, 0, 0, 2, 105, 107, 225, 22, 279,
+    281, 282, 0, 0, 283, 0, 0, 73, 22, 98, 125, 144, 4, 15, 173, 211,
+    220, 233, 27, 281, 61, 64, 2, 105, 106, 107, 2, 133, 14, 16, 135, 20,
+    21, 22, 20, 161, 167, 181, 188, 3, 14, 217, 219, 221, 222, 224, 235, 248,
+    9, 18, 252, 279, 281, 282, 0, 0, 283, 0, 3, 250, 58, 60, 62, 83,
+    2, 14, 105, 18, 107, 133, 137, 142, 143, 172, 14, 22, 279, 281, 282, 0,
+    0, 283, 0, 79, 82, 85, 86, 2, 15, 105, 106, 107, 2, 133, 15, 135,
+    20, 21, 160, 165, 201, 202, 203, 204, 207, 238, 240, 242, 243, 244, 247, 248,
+    4, 249, 15, 18, 20, 279, 281, 282, 0, 0, 283, 0, 0, 57, 62, 63,
+    82, 2, 15, 105, 106, 107, 2, 133, 14, 15, 16, 20, 21, 195, 197, 215,
+    217, 219, 222, 14, 15, 251, 20, 0, 279, 281, 282, 0, 0, 283, 0, 83,
+    24, 182, 233, 256, 57, 63, 2, 105, 107, 6, 141, 14, 217, 279, 281, 282,
+    0, 0, 283, 0, 59, 2, 105, 107, 105, 141, 61, 66, 233, 2, 105, 107,
+    281, 282, 15, 15, 5, 6, 14, 15, 16, 18, 19, 20, 15, 75, 107, 377,
+    380, 172, 180, 382, 384, 385, 9, 18, 390, 180, 183, 20, 125, 180, 181, 543,
+    182, 183, 545, 546, 185, 188, 616, 9, 3, 256, 75, 107, 377, 172, 180, 384,
+    385, 6, 9, 18, 390, 60, 139, 144, 145, 23, 138, 145, 443, 444, 17, 14,
+    57, 465, 7, 467, 14, 271, 472, 180, 183, 20, 15, 125, 180, 181, 182, 183,
+    545, 546, 185, 188, 22, 57, 59, 61, 65, 587, 591, 596, 16, 9, 3, 256,
+    63, 65, 22, 631, 632, 132, 644, 16, 198, 651, 653, 654, 6, 661, 676, 686,
+    65, 692, 698, 108, 23, 713, 715, 720, 724, 16, 61, 753, 807, 227, 233, 405,
+    81, 214, 183, 171, 61, 86, 61, 604, 142, 242, 198, 201, 82, 171, 681, 171,
+    717, 171, 778, 6, 478, 2, 569, 570, 571, 15, 22, 672, 674, 676, 15, 23,
+    204, 224, 6, 478, 2, 523, 105, 524, 24, 7, 161, 165, 217, 221, 538, 557,
+    558, 559, 62, 569, 570, 571, 57, 58, 64, 65, 66, 67, 26, 8, 105, 109,
+    618, 18, 8, 16, 22, 185, 18, 282, 672, 674, 676, 20, 219, 171, 478, 2,
+    61, 23, 64, 162, 549, 21, 550, 570, 672, 674, 676, 804, 22, 146, 244, 171,
+    81, 692, 694, 715, 770, 244, 171, 478, 2, 82, 220, 62, 569, 570, 571, 672,
+    674, 676, 22, 171, 804, 478, 2, 538, 569, 570, 571, 602, 603, 604, 670, 63,
+    672, 674, 676, 2, 105, 107, 2, 538, 171, 202, 207, 807, 9, 22, 219, 170,
+    172, 207, 211, 83, 97, 99, 102, 114, 183, 231, 233, 240, 242, 57, 626, 81,
+    692, 713, 61, 6, 81, 478, 2, 478, 2, 266, 478, 2, 538, 144, 15, 105,
+    2, 538, 171, 245, 608, 609, 183, 22, 7, 769, 804, 478, 2, 22, 244, 165,
+    240, 183, 16, 76, 171, 182, 14, 171, 713, 715, 716, 717, 719, 270, 6, 169,
+    204, 478, 218, 479, 22, 2, 523, 105, 524, 161, 22, 217, 238, 242, 219, 569,
+    570, 571, 15, 108, 609, 66, 168, 672, 674, 676, 146, 198, 200, 6, 686, 5,
+    761, 762, 125, 204, 229, 808, 811, 62, 2, 105, 107, 97, 378, 171, 428, 161,
+    162, 478, 202, 2, 523, 524, 108, 6, 171, 9, 587, 161, 241, 9, 807, 21,
+    22, 409, 415, 417, 425, 169, 196, 172, 478, 9, 18, 2, 19, 523, 105, 524,
+    195, 61, 68, 24, 22, 632, 138, 7, 642, 197, 735, 11, 9, 191, 749, 221,
+    754, 14, 762, 73, 21, 80, 171, 202, 215, 224, 82, 171, 9, 419, 18, 478,
+    9, 2, 481, 523, 106, 524, 108, 217, 219, 171, 20, 63, 672, 674, 676, 6,
+    249, 171, 9, 4, 806, 428, 256, 139, 144, 717, 778, 83, 383, 477, 478, 2,
+    97, 538, 22, 672, 674, 676, 806, 377, 478, 2, 478, 538, 9, 390, 716, 478,
+    2, 171, 171, 81, 83, 88, 95, 96, 100, 161, 162, 165, 169, 172, 181, 182,
+    204, 214, 217, 171, 224, 480, 180, 933, 143, 66, 935, 937, 938, 121, 202, 713,
+    215, 182, 188, 63, 67, 8, 18, 106, 109, 1079, 142, 19, 22, 191, 16, 1082,
+    1083, 11, 14, 609, 1120, 129, 17, 145, 224, 480, 180, 143, 66, 937, 938, 95,
+    121, 202, 713, 145, 57, 22, 67, 547, 225, 529, 225, 621, 184, 996, 14, 87,
+    57, 535, 62, 22, 105, 228, 161, 225, 229, 231, 234, 3, 11, 17, 21, 215,
+    15, 182, 188, 63, 67, 8, 18, 106, 109, 142, 19, 22, 191, 16, 1082, 1083,
+    11, 14, 609, 240, 84, 87, 377, 379, 161, 162, 165, 26, 1105, 1110, 9, 21,
+    22, 183, 129, 17, 145, 180, 383, 183, 215, 217, 218, 240, 1137, 215, 217, 219,
+    221, 222, 224, 61, 20, 22, 625, 193, 1163, 23, 1164, 1166, 1167, 94, 1174, 480,
+    232, 19, 21, 481, 3, 7, 11, 17, 1200, 23, 29, 388, 479, 14, 253, 59,
+    141, 70, 72, 1235, 76, 78, 1240, 217, 218, 219, 221, 1241, 9, 161, 139, 144,
+    1309, 697, 715, 15, 413, 11, 198, 105, 9, 17, 9, 481, 171, 8, 625, 65,
+    419, 105, 1194, 105, 1231, 105, 1281, 100, 2, 1098, 1099, 171, 242, 1185, 1187, 171,
+    22, 141, 687, 95, 2, 478, 1062, 256, 105, 569, 571, 197, 672, 676, 195, 1095,
+    1096, 171, 1098, 1099, 374, 375, 21, 182, 213, 112, 182, 242, 20, 211, 1185, 1187,
+    217, 141, 105, 2, 6, 203, 9, 694, 229, 715, 1098, 1185, 1187, 79, 244, 258,
+    752, 105, 413, 1206, 142, 713, 751, 105, 2, 136, 171, 15, 1098, 1099, 1185, 1187,
+    242, 105, 1301, 2, 1098, 1099, 1115, 1116, 15, 6, 1185, 1187, 478, 2, 105, 632,
+    647, 7, 194, 17, 198, 23, 200, 1309, 174, 123, 241, 141, 63, 143, 145, 22,
+    6, 6, 9, 14, 14, 197, 191, 14, 715, 14, 142, 22, 413, 419, 138, 22,
+    161, 100, 413, 2, 2, 217, 2, 16, 171, 478, 161, 105, 240, 21, 807, 21,
+    24, 244, 105, 8, 86, 2, 2, 21, 753, 16, 22, 195, 198, 182, 6, 105,
+    18, 145, 161, 105, 66, 22, 142, 1230, 751, 753, 1234, 100, 580, 141, 2, 170,
+    242, 478, 1062, 569, 571, 243, 672, 676, 61, 145, 141, 1098, 1099, 171, 390, 270,
+    7, 11, 17, 271, 23, 24, 29, 1185, 1187, 551, 625, 282, 95, 1199, 29, 82,
+    20, 811, 180, 141, 141, 185, 224, 171, 478, 2, 144, 931, 105, 974, 570, 142,
+    2, 631, 1062, 20, 100, 105, 121, 1105, 570, 745, 121, 170, 234, 242, 203, 965,
+    967, 580, 587, 2, 121, 202, 214, 478, 1062, 165, 242, 1139, 529, 530, 14, 221,
+    222, 6, 143, 15, 84, 174, 196, 1264, 161, 811, 162, 88, 105, 632, 10, 686,
+    137, 105, 121, 143, 213, 2, 121, 713, 479, 1062, 20, 672, 676, 141, 105, 217,
+    184, 1185, 1187, 95, 88, 105, 128, 76, 1308, 974, 778, 26, 24, 1281, 428, 141,
+    142, 2, 1022, 142, 238, 1185, 1187, 1307, 2, 2, 123, 241, 1230, 2, 105, 105,
+    413, 142, 15, 461, 134, 219, 5, 142, 19, 580, 587, 106, 22, 145, 667, 11,
+    674, 105, 686, 1025, 22, 1497, 183, 390, 1499, 139, 7, 145, 147, 1502, 503, 631,
+    609, 383, 9, 8, 210, 17, 1621, 172, 88, 6, 713, 740, 22, 806, 808, 1658,
+    515, 23, 549, 686, 1025, 22, 183, 390, 139, 7, 145, 147, 1502, 461, 503, 631,
+    227, 24, 61, 1124, 244, 162, 223, 83, 90, 6, 172, 243, 570, 144, 225, 226,
+    227, 229, 231, 232, 233, 234, 236, 237, 171, 609, 383, 9, 8, 210, 17, 172,
+    88, 6, 713, 740, 22, 806, 808, 739, 221, 182, 185, 58, 60, 64, 68, 570,
+    143, 191, 192, 573, 3, 7, 194, 17, 198, 23, 200, 126, 225, 227, 229, 234,
+    238, 190, 515, 23, 549, 8, 62, 65, 145, 196, 57, 66, 674, 138, 739, 238,
+    686, 379, 219, 240, 241, 1129, 1130, 1131, 21, 618, 226, 6, 1707, 3, 7, 11,
+    17, 1709, 23, 1710, 1711, 98, 219, 691, 83, 1026, 87, 709, 711, 205, 712, 214,
+    227, 713, 1027, 716, 717, 246, 718, 719, 61, 67, 14, 106, 8, 244, 252, 281,
+    282, 941, 1023, 161, 255, 377, 538, 61, 143, 1770, 167, 20, 403, 22, 3, 673,
+    22, 679, 680, 8, 199, 1775, 125, 570, 57, 63, 22, 16, 143, 1208, 143, 171,
+    963, 7, 478, 123, 14, 120, 241, 105, 111, 1131, 217, 147, 478, 1735, 478, 478,
+    469, 1638, 105, 141, 1728, 105, 538, 15, 461, 2, 778, 6, 1099, 215, 224, 1187,
+    171, 1636, 105, 1638, 231, 234, 22, 661, 6, 146, 143, 4, 14, 1728, 674, 538,
+    478, 639, 121, 1206, 6, 141, 1638, 1728, 58, 753, 9, 478, 963, 171, 22, 57,
+    669, 478, 526, 105, 171, 1638, 1728, 141, 478, 14, 1638, 1653, 171, 97, 1728, 2,
+    478, 215, 217, 219, 221, 21, 222, 224, 282, 147, 196, 747, 538, 382, 181, 549,
+    240, 95, 95, 121, 161, 9, 624, 81, 161, 141, 163, 171, 963, 139, 144, 530,
+    570, 469, 963, 105, 2, 22, 478, 739, 174, 229, 254, 224, 188, 112, 444, 2,
+    679, 9, 174, 229, 101, 478, 207, 570, 478, 668, 22, 5, 1769, 469, 17, 538,
+    63, 143, 2, 1099, 198, 1187, 169, 538, 1638, 105, 944, 254, 281, 282, 1728, 22,
+    1128, 807, 461, 227, 282, 56, 57, 538, 538, 14, 686, 105, 2, 547, 1495, 478,
+    1098, 171, 1137, 478, 503, 1098, 171, 503, 63, 724, 5, 1526, 811, 1105, 503, 631,
+    11, 2, 195, 139, 20, 811, 198, 682, 93, 198, 203, 22, 224, 142, 14, 478,
+    221, 21, 1198, 270, 478, 503, 546, 661, 503, 734, 174, 1187, 538, 478, 674, 605,
+    228, 231, 232, 234, 1728, 461, 14, 478, 14, 1833, 1281, 974, 538, 171, 753, 171,
+    734, 1728, 198, 478, 478, 963, 171, 171, 1006, 7, 19, 22, 171, 214, 807, 1105,
+    9, 240, 549, 1177, 18, 146, 1185, 478, 3, 2052, 3, 944, 2054, 105, 282, 1128,
+    1045, 1137, 22, 129, 110, 197, 2150, 589, 14, 56, 215, 217, 219, 221, 21, 222,
+    224, 167, 180, 1060, 3, 3, 944, 105, 282, 1128, 1006, 1045, 1137, 696, 258, 18,
+    1663, 752, 7, 17, 6, 452, 749, 1098, 57, 62, 66, 22, 697, 698, 109, 6,
+    9, 141, 143, 20, 145, 192, 14, 196, 197, 23, 251, 727, 732, 105, 22, 129,
+    110, 197, 589, 14, 56, 215, 217, 219, 221, 21, 222, 224, 167, 180, 1247, 198,
+    5, 8, 15, 100, 145, 546, 139, 282, 0, 10, 63, 699, 252, 66, 21, 1060,
+    178, 215, 203, 210, 82, 1185, 530, 1247, 63, 139, 22, 143, 180, 90, 96, 61,
+    67, 2212, 135, 144, 145, 23, 1201, 145, 23, 219, 5, 1224, 643, 16, 11, 697,
+    56, 59, 1226, 22, 1572, 18, 1229, 196, 752, 753, 1234, 161, 162, 26, 112, 221,
+    21, 20, 1505, 1569, 775, 22, 2253, 143, 811, 67, 163, 543, 546, 180, 1098, 181,
+    1747, 181, 105, 1524, 107, 2, 62, 138, 478, 106, 674, 282, 2, 2, 2, 478,
+    538, 478, 171, 1006, 1281, 95, 57, 686, 105, 478, 191, 724, 242, 22, 95, 255,
+    181, 9, 161, 1185, 2, 215, 503, 95, 538, 95, 679, 121, 2, 1524, 105, 2,
+    1064, 478, 105, 538, 2, 161, 105, 466, 2, 686, 282, 210, 603, 603, 1087, 739,
+    461, 461, 503, 570, 121, 170, 413, 570, 538, 573, 105, 1524, 1098, 1524, 478, 2,
+    1247, 61, 686, 607, 488, 996, 1192, 591, 2, 22, 1098, 2, 246, 22, 221, 200,
+    160, 161, 573, 165, 382, 181, 580, 478, 752, 61, 6, 1669, 1309, 1006, 697, 807,
+    73, 810, 478, 2050, 2, 1638, 105, 1678, 2, 1045, 1638, 105, 1045, 382, 9, 81,
+    1045, 1137, 139, 171, 1195, 65, 246, 686, 171, 161, 2, 1309, 2, 1045, 1174, 1045,
+    1243, 198, 2, 1185, 57, 1117, 708, 1006, 161, 2, 161, 7, 11, 17, 21, 573,
+    105, 18, 105, 18, 13, 2, 2, 1524, 105, 105, 1555, 214, 244, 105, 667, 171,
+    739, 694, 1720, 207, 551, 1728, 2, 57, 2487, 16, 1587, 1678, 20, 56, 215, 2549,
+    242, 686, 249, 65, 1596, 57, 16, 1555, 1587, 1678, 170, 780, 2181, 15, 1262, 3,
+    1638, 87, 390, 240, 184, 22, 23, 125, 162, 181, 24, 550, 104, 204, 624, 18,
+    8, 9, 478, 20, 56, 215, 242, 686, 249, 65, 1781, 226, 83, 112, 469, 221,
+    236, 62, 6, 390, 1596, 596, 417, 138, 1728, 1781, 184, 22, 452, 379, 3, 198,
+    21, 550, 229, 231, 22, 1152, 184, 141, 1208, 1761, 11, 5, 680, 808, 1769, 145,
+    22, 3, 2060, 2107, 1278, 172, 22, 1638, 603, 603, 478, 480, 171, 530, 2, 479,
+    1185, 809, 2, 2, 105, 1555, 461, 1200, 478, 2, 240, 461, 775, 603, 121, 570,
+    1728, 59, 1045, 461, 461, 1192, 503, 478, 1598, 2, 478, 570, 478, 165, 1115, 1115,
+    1628, 1247, 1006, 1006, 1045, 1098, 503, 22, 963, 1098, 9, 478, 1638, 2, 1781, 161,
+    3, 9, 81, 240, 1733, 182, 240, 1638, 242, 282, 195, 603, 603, 2, 161, 99,
+    143, 1555, 1208, 1309, 397, 2, 2485, 478, 1587, 478, 1587, 603, 121, 413, 1587, 1678,
+    105, 1736, 6, 17, 105, 570, 143, 1587, 215, 1587, 1777, 1728, 22, 1655, 65, 1555,
+    570, 570, 190, 196, 143, 145, 478, 207, 478, 154, 478, 478, 667, 478, 1177, 105,
+    1247, 1206, 2220, 22, 1090, 2765, 181, 2807, 22, 20, 2127, 181, 60, 8, 2568, 170,
+    480, 944, 14, 229, 603, 257, 472, 141, 115, 127, 2, 22, 20, 6, 488, 1018,
+    727, 104, 713, 2127, 529, 233, 241, 63, 1089, 6, 1747, 143, 22, 2492, 2524, 1809,
+    143, 241, 1115, 1115, 2, 1024, 105, 21, 1023, 1728, 1312, 478, 1006, 2, 739, 1006,
+    1278, 1115, 503, 1098, 15, 1587, 1006, 1006, 1733, 1045, 2, 2128, 2, 1098, 2, 19,
+    1653, 1653, 2156, 1781, 1555, 1555, 1587, 1638, 1045, 1524, 1638, 121, 2, 570, 61, 413,
+    739, 2227, 739, 144, 1115, 1115, 570, 191, 28, 181, 1747, 143, 2, 2, 1115, 503,
+    963, 478, 2229, 198, 478, 1098, 181, 670, 2260, 217, 1098, 1098, 2, 22, 2, 2,
+    2, 2, 1720, 478, 1781, 202, 240, 1632, 2935, 238, 215, 143, 111, 69, 163, 140,
+    238, 215, 95, 79, 472, 1653, 1653, 1570, 478, 229, 1569, 1837, 2, 1555, 1247, 1555,
+    1809, 1653, 1045, 1638, 171, 1555, 1555, 2227, 1587, 2536, 1638, 214, 2555, 1587, 503, 1098,
+    963, 1247, 2600, 1247, 16, 1653, 1653, 1098, 81, 273, 603, 181, 1653, 1045, 1524, 2,
+    2602, 2, 1638, 603, 1181, 2620, 674, 1638, 1638, 240, 2220, 739, 2160, 3033, 108, 0,
+    22, 2108, 2, 2107, 1781, 1587, 105, 2600, 667, 1045, 1638, 1524, 1781, 1781, 1638, 413,
+    798, 1115, 603, 1587, 1115, 1724, 1185, 739, 1247, 2556, 11, 22, 2525, 2524, 478, 1177,
+    1587, 963, 1295, 1653, 1115, 1653, 2223, 1728, 1247, 1781, 2812, 141, 244, 2, 1720, 1524,
+    1821, 1653, 2596, 1781, 538, 752, 2220, 161,
+};
+
+constexpr uint16_t fr_levels[] = {
+    0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 81,
+    81, 81, 81, 81, 0, 81, 0, 0, 0, 81, 0, 81, 0, 0, 0, 0,
+    81, 0, 0, 0, 0, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 113, 113, 113, 146, 113, 146, 113, 113, 0, 113,
+    0, 113, 146, 113, 146, 146, 113, 146, 113, 113, 0, 0, 113, 113, 0, 113,
+    0, 113, 0, 113, 146, 194, 113, 113, 0, 0, 0, 0, 0, 0, 113, 113,
+    113, 146, 113, 146, 194, 113, 113, 0, 113, 113, 0, 113, 146, 146, 113, 146,
+    194, 113, 113, 0, 113, 113, 113, 113, 113, 113, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 241, 113, 113, 146, 113, 113, 146, 113, 113, 0,
+    113, 113, 113, 0, 0, 113, 0, 113, 113, 0, 113, 113, 113, 0, 113, 194,
+    113, 113, 0, 0, 113, 113, 113, 113, 0, 113, 273, 113, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 113, 146, 113, 146, 0, 113,
+    146, 0, 0, 113, 113, 0, 0, 113, 0, 113, 146, 113, 0, 113, 113, 113,
+    0, 113, 0, 113, 146, 113, 0, 113, 0, 0, 113, 113, 0, 0, 113, 0,
+    113, 146, 113, 113, 146, 0, 113, 113, 0, 0, 0, 0, 0, 0, 113, 113,
+    113, 113, 146, 113, 113, 0, 113, 113, 113, 113, 146, 113, 0, 0, 0, 0,
+    113, 113, 113, 113, 113, 113, 0, 0, 113, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305,
+    305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 305, 0, 0, 0, 0, 0, 305, 0, 305, 305, 305, 305,
+    305, 305, 305, 337, 0, 0, 0, 0, 337, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 369, 0, 0, 0, 0, 0,
+    0, 401, 401, 401, 401, 401, 401, 401, 0, 0, 0, 0, 369, 0, 0, 369,
+    433, 0, 433, 0, 337, 433, 433, 433, 337, 433, 433, 433, 0, 369, 433, 0,
+    433, 433, 466, 433, 433, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 401, 401, 401, 401, 401, 401, 401, 401, 0, 514, 369, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 401, 401, 401, 401, 401, 401, 401, 0, 0, 0,
+    0, 0, 0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 401,
+    401, 401, 401, 401, 401, 401, 369, 0, 0, 562, 562, 562, 562, 562, 0, 0,
+    0, 0, 0, 0, 401, 401, 401, 401, 401, 401, 401, 369, 0, 0, 0, 0,
+    401, 401, 401, 401, 401, 401, 401, 0, 0, 0, 337, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 369, 0, 0, 369, 0, 0,
+    369, 401, 401, 401, 401, 401, 401, 401, 0, 369, 0, 0, 0, 0, 0, 0,
+    514, 401, 401, 401, 401, 401, 401, 401, 401, 369, 0, 0, 0, 0, 0, 0,
+    0, 0, 401, 401, 401, 401, 401, 401, 401, 401, 369, 0, 0, 0, 0, 401,
+    401, 401, 401, 401, 401, 401, 401, 0, 0, 514, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 369, 0, 0, 0, 369, 0, 337, 433, 0, 337,
+    433, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 401, 401, 401, 401, 401, 401, 401, 0, 0, 0, 0, 0, 0,
+    369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 401, 401, 401, 401,
+    401, 401, 401, 0, 562, 0, 0, 369, 0, 0, 0, 0, 369, 0, 433, 0,
+    433, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 401, 401, 401, 401, 401, 401, 401, 401, 0, 0, 0,
+    0, 369, 0, 0, 0, 0, 369, 0, 433, 433, 433, 337, 433, 0, 0, 0,
+    0, 0, 0, 514, 0, 0, 0, 401, 401, 401, 401, 401, 401, 401, 401, 0,
+    0, 0, 0, 0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 401, 401, 401,
+    401, 401, 401, 401, 0, 369, 0, 0, 0, 0, 0, 0, 0, 369, 0, 0,
+    401, 401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 610, 0, 0, 610, 610, 0,
+    610, 610, 0, 0, 610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0, 0, 0, 657, 610, 657,
+    0, 0, 0, 0, 0, 690, 0, 610, 610, 0, 0, 0, 610, 610, 610, 610,
+    0, 0, 610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 737, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0,
+    0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 769, 769, 0, 0, 0, 0, 769, 0, 0, 0, 0,
+    0, 0, 0, 0, 769, 769, 0, 0, 0, 0, 0, 0, 0, 0, 801, 769,
+    0, 0, 0, 769, 0, 0, 0, 834, 881, 881, 0, 881, 881, 881, 881, 881,
+    0, 0, 0, 0, 0, 0, 0, 914, 769, 0, 0, 0, 0, 0, 0, 769,
+    962, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0,
+    0, 1010, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 769, 0, 0, 769,
+    0, 0, 0, 0, 0, 0, 769, 801, 769, 0, 0, 769, 0, 0, 0, 0,
+    769, 0, 0, 769, 0, 0, 769, 801, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1057, 0,
+    0, 0, 0, 0, 0, 0, 769, 0, 769, 0, 0, 769, 801, 0, 0, 0,
+    769, 801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0, 0,
+    0, 0, 801, 0, 0, 769, 769, 0, 0, 0, 0, 0, 0, 0, 0, 769,
+    0, 0, 0, 1090, 1090, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 769, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 769, 0, 1137, 0, 1090, 0, 0, 0, 0, 769, 0, 769, 0, 0,
+    1170, 0, 1090, 1090, 0, 0, 0, 0, 0, 1090, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 769, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1010, 0, 0, 0, 0, 0, 769,
+    0, 801, 0, 769, 0, 0, 0, 1218, 0, 769, 0, 801, 0, 0, 0, 0,
+    769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1265,
+    1299, 1362, 0, 0, 0, 0, 0, 1265, 0, 0, 0, 1410, 1410, 0, 0, 0,
+    0, 0, 1410, 1458, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1265, 0, 1506, 1506, 1553, 1586, 1299, 0, 0, 0, 1633, 0, 0, 0,
+    0, 0, 0, 0, 1506, 1410, 0, 1299, 1299, 1299, 1299, 1586, 0, 1586, 1665, 1299,
+    0, 1362, 0, 0, 0, 0, 0, 1265, 0, 0, 1410, 1410, 0, 0, 0, 0,
+    0, 1410, 1458, 0, 1410, 0, 0, 0, 0, 0, 0, 1698, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1586, 1586, 1586,
+    1586, 1586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1410, 1410, 1586, 1586, 1586, 1586, 0, 1745, 0, 0, 0, 0, 0, 0,
+    0, 1299, 0, 0, 0, 0, 1299, 1299, 1410, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1778, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1778, 0, 1825, 0, 1857, 0, 1889, 0, 0, 0, 1889, 0,
+    1923, 0, 0, 0, 1857, 0, 1889, 0, 0, 1889, 0, 0, 1889, 0, 0, 0,
+    1889, 0, 0, 1889, 1985, 1985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1889,
+    0, 0, 0, 1857, 2018, 0, 0, 0, 0, 0, 0, 0, 1889, 0, 0, 2067,
+    0, 0, 0, 1778, 0, 0, 2129, 0, 1857, 0, 0, 0, 0, 1889, 0, 1889,
+    0, 0, 0, 1857, 0, 1889, 0, 1889, 0, 0, 0, 1889, 0, 1889, 0, 2162,
+    1586, 1586, 1586, 1586, 1586, 1586, 0, 0, 0, 2209, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2242, 0, 0, 0, 2290,
+    0, 0, 0, 1857, 1857, 1362, 1857, 2337, 0, 0, 0, 0, 0, 2370, 0, 0,
+    0, 0, 0, 0, 0, 1857, 2418, 0, 0, 0, 2465, 0, 0, 2209, 0, 0,
+    0, 1586, 0, 0, 2290, 2290, 2290, 2290, 0, 0, 0, 0, 0, 0, 1857, 0,
+    0, 0, 1889, 1889, 0, 0, 1889, 0, 0, 2498, 0, 0, 1889, 0, 0, 1586,
+    1586, 1586, 1586, 1586, 1586, 0, 0, 0, 1889, 0, 0, 0, 0, 0, 0, 2370,
+    2370, 2370, 0, 0, 0, 0, 0, 0, 0, 1889, 0, 0, 0, 1825, 0, 0,
+    1857, 0, 1889, 2546, 2546, 0, 0, 1825, 0, 0, 0, 0, 0, 0, 2370, 1889,
+    0, 0, 0, 1857, 0, 0, 0, 0, 1889, 0, 0, 2370, 0, 0, 2370, 0,
+    0, 0, 2370, 2370, 2370, 0, 0, 0, 2370, 0, 0, 0, 0, 2162, 2594, 0,
+    0, 0, 0, 0, 0, 1857, 0, 0, 0, 1889, 2546, 1889, 0, 0, 0, 0,
+    0, 0, 1889, 0, 0, 0, 2642, 0, 0, 1825, 0, 1506, 1506, 1825, 0, 0,
+    0, 1857, 0, 0, 0, 0, 1889, 0, 1857, 1857, 2209, 2209, 2290, 1857, 0, 0,
+    0, 0, 0, 0, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2690, 2738, 0, 0, 0, 0, 2786, 2786, 2786, 0, 0, 0, 0,
+    2738, 0, 0, 0, 2833, 0, 0, 0, 0, 2833, 0, 2866, 2833, 0, 0, 2913,
+    0, 2945, 2978, 0, 2690, 2738, 0, 0, 2786, 2786, 2786, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3025, 3058, 0, 0, 2945, 0, 3106,
+    0, 3155, 0, 3106, 3106, 0, 0, 0, 0, 2738, 0, 0, 0, 2833, 0, 0,
+    0, 2833, 0, 2866, 2833, 0, 0, 0, 0, 0, 0, 0, 0, 3218, 3267, 3218,
+    0, 3218, 3267, 0, 2786, 2786, 2786, 2786, 2786, 2786, 0, 0, 3329, 0, 3362, 0,
+    0, 0, 0, 2945, 2978, 3267, 0, 0, 3218, 0, 0, 2786, 0, 0, 0, 3329,
+    3410, 0, 0, 0, 3458, 0, 3155, 3458, 2786, 0, 0, 0, 3410, 2786, 2786, 2786,
+    2786, 2786, 2786, 0, 0, 2978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2690, 2690, 2690, 0, 0, 0, 3329, 3329, 0, 0, 0, 0,
+    3410, 0, 0, 3329, 0, 3458, 3505, 0, 3218, 0, 3538, 3218, 3587, 3651, 0, 0,
+    3714, 3267, 0, 3218, 3218, 3587, 0, 0, 2978, 2978, 2978, 2978, 0, 0, 0, 0,
+    0, 0, 0, 3762, 3809, 0, 0, 0, 0, 3538, 0, 0, 0, 3841, 0, 0,
+    3874, 3921, 0, 0, 3921, 0, 3505, 0, 0, 3921, 0, 0, 3953, 0, 0, 3953,
+    0, 3921, 0, 3921, 0, 0, 0, 0, 0, 0, 0, 3985, 0, 3921, 0, 3505,
+    0, 0, 0, 2738, 0, 0, 3921, 3921, 0, 0, 0, 0, 0, 0, 4018, 4065,
+    4065, 0, 0, 0, 0, 3921, 3921, 0, 0, 0, 3921, 3921, 0, 0, 3921, 3921,
+    0, 4097, 4097, 4097, 4097, 4097, 4097, 0, 3410, 0, 0, 4129, 3505, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4162, 4162, 4162,
+    0, 3874, 0, 0, 2913, 4209, 0, 0, 4242, 4242, 0, 0, 0, 0, 0, 4290,
+    0, 4162, 0, 4162, 4338, 0, 0, 0, 0, 4386, 0, 0, 0, 3874, 0, 0,
+    0, 0, 3921, 3953, 2786, 3953, 0, 3505, 3921, 0, 0, 0, 3410, 3410, 3921, 0,
+    0, 0, 0, 0, 0, 0, 2738, 3505, 3505, 2833, 0, 0, 3921, 2786, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3953, 4242, 4433, 0, 0,
+    0, 3921, 0, 4242, 4242, 4242, 4242, 0, 0, 4242, 4242, 0, 0, 0, 0, 0,
+    4097, 4097, 0, 2786, 0, 0, 4466, 0, 0, 0, 0, 3953, 3505, 0, 0, 3155,
+    3458, 3155, 3458, 3155, 3921, 0, 0, 0, 0, 0, 4433, 4433, 0, 0, 0, 0,
+    0, 3921, 0, 0, 0, 0, 0, 0, 0, 4514, 0, 0, 0, 0, 0, 4433,
+    4514, 0, 0, 0, 0, 0, 0, 0, 4561, 4593, 0, 4626, 0, 0, 4674, 4722,
+    0, 0, 4770, 0, 0, 0, 0, 0, 4770, 4818, 4865, 4865, 4865, 4865, 4865, 4865,
+    0, 0, 0, 0, 4561, 0, 4626, 0, 4674, 4722, 0, 0, 0, 0, 0, 4898,
+    0, 0, 4770, 0, 4818, 4818, 4818, 0, 0, 4946, 0, 0, 0, 0, 0, 4995,
+    0, 0, 0, 4995, 0, 0, 4995, 0, 0, 0, 5059, 5123, 5186, 0, 4770, 0,
+    0, 0, 0, 4770, 4818, 4865, 4865, 4865, 4865, 4865, 4865, 0, 0, 0, 0, 0,
+    0, 0, 4770, 0, 0, 4898, 0, 4674, 0, 5186, 5233, 5186, 5059, 0, 4898, 0,
+    0, 5267, 5267, 4898, 0, 0, 4770, 0, 0, 5329, 5361, 5186, 0, 0, 5394, 0,
+    5441, 4674, 0, 0, 5474, 5474, 4770, 0, 4770, 4770, 0, 4770, 0, 0, 0, 0,
+    5522, 5522, 0, 5522, 5522, 5522, 5522, 5522, 0, 0, 0, 4722, 0, 5361, 4722, 0,
+    5361, 5361, 0, 0, 0, 5570, 0, 4770, 5619, 5570, 5570, 4898, 4898, 0, 0, 0,
+    5681, 0, 0, 5681, 0, 5713, 0, 0, 0, 0, 0, 0, 5713, 5713, 5713, 0,
+    5745, 0, 0, 0, 5777, 0, 5811, 0, 0, 0, 5873, 5873, 5906, 0, 0, 0,
+    0, 0, 0, 0, 5713, 0, 0, 0, 5745, 0, 0, 0, 5713, 5681, 0, 5713,
+    0, 0, 0, 5745, 5713, 0, 0, 0, 5713, 4865, 5953, 5986, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5745, 0, 0, 5681, 0, 5681, 0, 5713,
+    0, 0, 0, 0, 0, 0, 0, 0, 5713, 0, 0, 5713, 6034, 0, 6034, 0,
+    6081, 6081, 6081, 0, 0, 0, 6114, 0, 5873, 0, 0, 4770, 0, 0, 0, 0,
+    0, 6163, 0, 0, 5713, 5681, 0, 5681, 5713, 0, 5681, 0, 0, 0, 0, 0,
+    0, 0, 5474, 0, 0, 0, 6226, 0, 0, 0, 5713, 0, 5713, 0, 0, 0,
+    0, 5474, 5713, 0, 0, 0, 0, 0, 0, 5713, 0, 5474, 5474, 0, 5474, 0,
+    0, 0, 0, 4898, 0, 5713, 5713, 5681, 0, 0, 5681, 0, 6274, 0, 0, 0,
+    0, 0, 0, 0, 0, 5681, 5713, 6322, 0, 0, 6369, 6369, 6401, 6401, 6401, 0,
+    6434, 6481, 0, 0, 0, 6322, 0, 6369, 6369, 6369, 0, 0, 0, 0, 0, 6514,
+    6369, 6563, 0, 0, 0, 6626, 6626, 6563, 6563, 0, 0, 6626, 0, 0, 6626, 6626,
+    0, 0, 0, 6401, 6401, 6401, 6434, 6481, 0, 0, 6369, 6322, 0, 0, 0, 6675,
+    0, 6737, 0, 0, 0, 6675, 6675, 0, 6369, 6369, 0, 0, 6770, 6818, 0, 6737,
+    6866, 0, 6434, 6434, 6434, 0, 6434, 6434, 0, 6914, 0, 0, 6962, 6914, 6914, 7010,
+    7010, 6514, 0, 0, 0, 0, 0, 6369, 0, 0, 0, 0, 0, 0, 6401, 0,
+    0, 0, 6401, 6401, 0, 6369, 0, 7059, 0, 6401, 0, 0, 0, 0, 0, 0,
+    6369, 0, 0, 0, 0, 0, 0, 0, 0, 6401, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7121, 0, 0, 0, 0, 6369, 6401, 6369, 0,
+    0, 7155, 0, 0, 0, 7218, 0, 6369, 0, 7266, 7313, 0, 0, 6401, 0, 0,
+    0, 6369, 0, 0, 7346, 6401, 6369, 0, 6369, 0, 6369, 0, 0, 0, 6369, 6369,
+    0, 0, 7394, 0, 0, 0, 0, 6369, 0, 6369, 0, 6369, 6626, 6626, 0, 6369,
+    0, 0, 6322, 6322, 7313, 7313, 0, 0, 0, 7442, 0, 0, 7490, 0, 0, 0,
+    0, 7010, 7537, 0, 0, 0, 7569, 7601, 0, 0, 7633, 7569, 0, 0, 7665, 0,
+    7698, 7746, 0, 0, 7795, 7746, 7795, 7795, 7746, 7859, 7921, 0, 0, 0, 0, 7955,
+    8018, 0, 8066, 7633, 7955, 8114, 8162, 7698, 8210, 8258, 7665, 8306, 8306, 7665, 7665, 7665,
+    8258, 8162, 0, 0, 7921, 0, 0, 0, 0, 7665, 0, 0, 0, 7921, 0, 0,
+    0, 0, 0, 0, 0, 7665, 0, 0, 0, 0, 7921, 0, 7921, 0, 7921, 0,
+    7665, 7665, 0, 7665, 7665, 7665, 7665, 7665, 0, 7665, 7665, 0, 7921, 0, 8258, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7665, 0, 7921, 7921, 0, 0,
+    0, 0, 0, 8354, 0, 0, 0, 0, 0, 0, 0, 0, 7921, 0, 7921, 7921,
+    7921, 7921, 0, 8402, 7665, 8450, 0, 0, 0, 8498, 8498, 8546, 0, 0, 8595, 8658,
+    8498, 8498, 8706, 0, 8754, 8801, 8801, 0, 0, 8834, 0, 8754, 8881, 8801, 0, 8801,
+    8801, 8801, 0, 8801, 0, 8801, 8801, 0, 8801, 8801, 8801, 0, 8913, 8801, 0, 0,
+    0, 0, 8801, 0, 8946, 8801, 8801, 0, 0, 0, 0, 0, 8801, 0, 8801, 8881,
+    8913, 8881, 8801, 0, 0, 8801, 0, 8801, 8801, 0, 8993, 0, 0, 9026, 0, 0,
+    9074, 0, 9121, 0, 9153, 9153, 0, 9153, 0, 0, 9153, 9153, 9153, 9153, 9153, 0,
+    0, 0, 0, 9153, 0, 0, 0, 0, 0, 0, 0, 0, 9185, 9217, 0, 0,
+    9217, 0, 0, 9217, 0, 9217, 0, 9217, 0, 9217, 9185, 0, 0, 9249, 0, 9281,
+    9281, 9281, 9281, 9281, 0, 9313, 9345, 9378,
+};
+
+constexpr uint8_t fr_level_data[] = {
+    0x01, 0x02, 0x0C, 0x01, 0x01, 0x02, 0x18, 0x02, 0x01, 0x02, 0x01, 0x0C, 0x02, 0x0B, 0x0C, 0x02, 0x02, 0x02, 0x0B,
+    0x03, 0x22, 0x03, 0x16, 0x03, 0x04, 0x03, 0x01, 0x03, 0x02, 0x03, 0x02, 0x17, 0x03, 0x0B, 0x0C, 0x03, 0x01, 0x0C,
+    0x04, 0x1F, 0x0C, 0x04, 0x2C, 0x04, 0x20, 0x0D, 0x04, 0x22, 0x04, 0x04, 0x04, 0x21, 0x04, 0x15, 0x0C, 0x04, 0x15,
+    0x04, 0x15, 0x16, 0x04, 0x03, 0x0C, 0x04, 0x0C, 0x0D, 0x04, 0x0B, 0x04, 0x01, 0x0C, 0x04, 0x02, 0x04, 0x02, 0x0D,
+    0x04, 0x16, 0x0D, 0x05, 0x20, 0x05, 0x20, 0x0B, 0x0C, 0x05, 0x16, 0x0D, 0x05, 0x20, 0x0D, 0x05, 0x1F, 0x16, 0x05,
+    0x1F, 0x0C, 0x05, 0x1F, 0x05, 0x29, 0x0C, 0x05, 0x36, 0x05, 0x2A, 0x05, 0x20, 0x0B, 0x05, 0x34, 0x05, 0x0C, 0x0D,
+    0x05, 0x2C, 0x05, 0x02, 0x05, 0x04, 0x05, 0x17, 0x17, 0x0C, 0x05, 0x15, 0x05, 0x03, 0x0C, 0x05, 0x0C, 0x0B, 0x0C,
+    0x05, 0x33, 0x05, 0x2C, 0x0B, 0x05, 0x0B, 0x05, 0x15, 0x0C, 0x05, 0x0B, 0x0C, 0x05, 0x0D, 0x05, 0x01, 0x0C, 0x05,
+    0x0D, 0x0C, 0x05, 0x01, 0x05, 0x03, 0x16, 0x05, 0x02, 0x0D, 0x05, 0x17, 0x0C, 0x05, 0x2A, 0x0D, 0x06, 0x21, 0x0E,
+    0x06, 0x16, 0x0D, 0x06, 0x33, 0x0C, 0x06, 0x20, 0x06, 0x36, 0x0D, 0x06, 0x0C, 0x06, 0x29, 0x06, 0x29, 0x0C, 0x06,
+    0x1F, 0x06, 0x1F, 0x0C, 0x06, 0x2B, 0x0C, 0x06, 0x2A, 0x0B, 0x0C, 0x06, 0x20, 0x0B, 0x06, 0x20, 0x0B, 0x0C, 0x06,
+    0x2A, 0x06, 0x2A, 0x0B, 0x06, 0x29, 0x16, 0x06, 0x2A, 0x0D, 0x06, 0x35, 0x06, 0x20, 0x0D, 0x06, 0x20, 0x0B, 0x16,
+    0x06, 0x21, 0x0C, 0x0D, 0x06, 0x21, 0x0C, 0x06, 0x0C, 0x0B, 0x06, 0x01, 0x06, 0x37, 0x06, 0x0B, 0x16, 0x06, 0x02,
+    0x06, 0x04, 0x06, 0x16, 0x06, 0x15, 0x0C, 0x06, 0x34, 0x06, 0x3E, 0x06, 0x0B, 0x06, 0x0C, 0x0D, 0x06, 0x22, 0x06,
+    0x01, 0x0C, 0x06, 0x0D, 0x0C, 0x06, 0x34, 0x0D, 0x06, 0x0B, 0x0C, 0x06, 0x36, 0x06, 0x35, 0x0C, 0x06, 0x01, 0x16,
+    0x07, 0x21, 0x07, 0x0C, 0x07, 0x2B, 0x0E, 0x07, 0x33, 0x16, 0x07, 0x2A, 0x0D, 0x07, 0x20, 0x0D, 0x07, 0x1F, 0x0C,
+    0x07, 0x48, 0x07, 0x20, 0x0B, 0x07, 0x34, 0x0D, 0x07, 0x2B, 0x0C, 0x0D, 0x07, 0x2A, 0x0B, 0x0C, 0x07, 0x2A, 0x0B,
+    0x16, 0x07, 0x2A, 0x0B, 0x07, 0x2B, 0x07, 0x20, 0x0B, 0x0C, 0x07, 0x3D, 0x07, 0x2A, 0x07, 0x35, 0x0C, 0x07, 0x34,
+    0x07, 0x3D, 0x0C, 0x07, 0x21, 0x0E, 0x07, 0x21, 0x0C, 0x07, 0x21, 0x0C, 0x17, 0x07, 0x17, 0x07, 0x16, 0x07, 0x3F,
+    0x07, 0x40, 0x07, 0x2A, 0x0D, 0x0C, 0x07, 0x15, 0x07, 0x16, 0x0D, 0x07, 0x33, 0x07, 0x33, 0x0C, 0x07, 0x0B, 0x0C,
+    0x07, 0x35, 0x07, 0x03, 0x16, 0x07, 0x1F, 0x0C, 0x16, 0x07, 0x01, 0x0C, 0x07, 0x01, 0x16, 0x08, 0x3D, 0x0C, 0x08,
+    0x21, 0x08, 0x20, 0x08, 0x20, 0x0D, 0x08, 0x52, 0x08, 0x47, 0x0C, 0x08, 0x2B, 0x0C, 0x0D, 0x08, 0x2B, 0x0C, 0x08,
+    0x20, 0x0B, 0x0C, 0x08, 0x3D, 0x08, 0x29, 0x0C, 0x08, 0x34, 0x0D, 0x08, 0x3E, 0x0D, 0x08, 0x21, 0x0E, 0x08, 0x22,
+    0x0F, 0x08, 0x2A, 0x0D, 0x08, 0x2A, 0x0D, 0x16, 0x08, 0x01, 0x08, 0x2A, 0x0B, 0x16, 0x08, 0x0C, 0x0D, 0x08, 0x3D,
+    0x16, 0x08, 0x35, 0x08, 0x16, 0x0D, 0x08, 0x01, 0x0C, 0x08, 0x33, 0x0C, 0x08, 0x01, 0x16, 0x08, 0x17, 0x09, 0x34,
+    0x09, 0x0C, 0x09, 0x21, 0x09, 0x2B, 0x09, 0x47, 0x0C, 0x09, 0x2B, 0x0C, 0x09, 0x2B, 0x0C, 0x0D, 0x09, 0x2B, 0x0C,
+    0x17, 0x09, 0x2A, 0x09, 0x20, 0x0B, 0x0C, 0x09, 0x20, 0x0B, 0x09, 0x3D, 0x0C, 0x09, 0x49, 0x0C, 0x09, 0x2A, 0x0D,
+    0x09, 0x3E, 0x0D, 0x09, 0x20, 0x0D, 0x09, 0x22, 0x0F, 0x09, 0x51, 0x0C, 0x09, 0x01, 0x16, 0x09, 0x2B, 0x0E, 0x0A,
+    0x20, 0x17, 0x0A, 0x2A, 0x17, 0x0A, 0x2B, 0x0C, 0x0D, 0x0A, 0x2B, 0x0C, 0x0A, 0x20, 0x0D, 0x0A, 0x33, 0x16, 0x0A,
+    0x35, 0x0A, 0x01, 0x0C, 0x0A, 0x34, 0x0A, 0x36, 0x0A, 0x0B, 0x0C, 0x0A, 0x2B, 0x0B, 0x0C, 0x0C, 0x0B, 0x20, 0x0D,
+    0x0B, 0x3E, 0x0B, 0x3F, 0x0C, 0x4A, 0x0C, 0x49, 0x0D, 0x52, 0x0D, 0x53, 0x0E, 0x49, 0x0E, 0x53, 0x0F, 0x34, 0x21,
+};
+
+constexpr HyphenationAutomaton fr_automaton = {
+    fr_symbols,
+    42u,
+    30u,
+    fr_dense,
+    3144u,
+    fr_label,
+    4u,
+    fr_child_base,
+    fr_child_offset,
+    fr_fail,
+    fr_levels,
+    fr_level_data,
 };
@@ -3,96 +3,225 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t it_trie_data[] = {
-    0x17, 0x0C, 0x33, 0x35, 0x0C, 0x29, 0x22, 0x0D, 0x3E, 0x0B, 0x47, 0x20, 0x0D, 0x16, 0x0B, 0x34, 0x0D, 0x21, 0x0C,
-    0x3D, 0x1F, 0x0C, 0x2A, 0x17, 0x2A, 0x0B, 0x02, 0x0C, 0x01, 0x02, 0x16, 0x02, 0x0D, 0x0C, 0x0C, 0x0D, 0x03, 0x0C,
-    0x01, 0x0C, 0x0E, 0x0D, 0x04, 0x02, 0x0B, 0xA0, 0x00, 0x42, 0x21, 0x6E, 0xFD, 0xA0, 0x00, 0x72, 0x21, 0x6E, 0xFD,
-    0xA1, 0x00, 0x61, 0x6D, 0xFD, 0x21, 0x69, 0xFB, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x6E, 0xEC, 0xFD, 0xA0, 0x00, 0x91,
-    0x21, 0x6F, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x00, 0xA2, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0xA0, 0x00, 0xC2, 0x21,
-    0x6D, 0xFD, 0x21, 0x75, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6F, 0xFD, 0x21, 0x72,
-    0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0xA3, 0x01, 0x11, 0x61, 0x69, 0x6F, 0xDF, 0xEE, 0xFD, 0xA0, 0x00, 0xF2,
-    0x21, 0x65, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0xA1, 0x01, 0x11, 0x69,
-    0xFD, 0xA0, 0x01, 0x12, 0x21, 0x75, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x78, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x6B, 0xFD,
-    0x21, 0x6E, 0xFD, 0xA0, 0x00, 0x71, 0x21, 0x65, 0xFD, 0x22, 0x61, 0x65, 0xF7, 0xFD, 0x21, 0x72, 0xFB, 0xA0, 0x01,
-    0x52, 0x21, 0x61, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x70, 0xFD, 0x21, 0x69, 0xFD, 0xA0, 0x01, 0x71, 0x21, 0x6F, 0xFD,
-    0x21, 0x63, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xA0, 0x00, 0x61, 0x21, 0x6F, 0xFD, 0x21, 0x74, 0xFD, 0x41,
-    0x70, 0xFF, 0x50, 0x21, 0x6F, 0xFC, 0x21, 0x74, 0xFD, 0x22, 0x70, 0x72, 0xF3, 0xFD, 0x21, 0x61, 0xE8, 0x21, 0x72,
-    0xFD, 0xA0, 0x00, 0xF1, 0x22, 0x6C, 0x72, 0xFD, 0xFD, 0x21, 0x69, 0xE3, 0x21, 0x6C, 0xFD, 0x41, 0x65, 0xFF, 0x43,
-    0xA0, 0x01, 0x11, 0x25, 0x61, 0x68, 0x6F, 0x72, 0x73, 0xE8, 0xEE, 0xF6, 0xF9, 0xFD, 0xA0, 0x01, 0x82, 0x21, 0x72,
-    0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x65, 0xFD, 0xA0, 0x01, 0xA2, 0x21, 0x65, 0xFD,
-    0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x75, 0xFF, 0x4C, 0x42, 0x6C, 0x72, 0xFF, 0xFC, 0xFF, 0x48, 0x21, 0x62,
-    0xF9, 0x22, 0x68, 0x75, 0xEF, 0xFD, 0x47, 0x63, 0x64, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF,
-    0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x5C, 0x21, 0x73, 0xEA, 0x21, 0x6E, 0xFD, 0x21, 0x61, 0xFD, 0xA1,
-    0x01, 0x11, 0x72, 0xFD, 0x41, 0x6E, 0xFF, 0x15, 0x21, 0x67, 0xFC, 0xA0, 0x01, 0xC2, 0x21, 0x74, 0xFD, 0x21, 0x6C,
-    0xFD, 0x22, 0x61, 0x65, 0xF4, 0xFD, 0x52, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73,
-    0x74, 0x77, 0x68, 0x6A, 0x6B, 0x7A, 0xFE, 0xC2, 0xFE, 0xCD, 0xFE, 0xF7, 0xFF, 0x12, 0xFF, 0x20, 0xFF, 0x37, 0xFF,
-    0x46, 0xFF, 0x55, 0xFF, 0x6B, 0xFF, 0x8B, 0xFF, 0xA5, 0xFF, 0xC2, 0xFF, 0xE6, 0xFF, 0xFB, 0xFF, 0x88, 0xFF, 0x88,
-    0xFF, 0x88, 0xFF, 0x88, 0xA0, 0x01, 0xE2, 0xA0, 0x00, 0xD1, 0x24, 0x61, 0x65, 0x6F, 0x75, 0xFD, 0xFD, 0xFD, 0xFD,
-    0x21, 0x6F, 0xF4, 0x21, 0x61, 0xF1, 0xA0, 0x01, 0xE1, 0x21, 0x2E, 0xFD, 0x24, 0x69, 0x75, 0x79, 0x74, 0xEB, 0xF4,
-    0xF7, 0xFD, 0x21, 0x75, 0xDF, 0xA0, 0x00, 0x51, 0x22, 0x69, 0x77, 0xFA, 0xFD, 0x21, 0x69, 0xD7, 0xAE, 0x02, 0x01,
-    0x62, 0x63, 0x64, 0x66, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0x6C, 0x72, 0x2E, 0x27, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
-    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF5, 0xF5, 0xE3, 0xE3, 0x22, 0x2E, 0x27, 0xC4, 0xC7, 0xC6, 0x00, 0x51, 0x68, 0x2E,
-    0x27, 0x62, 0x72, 0x6E, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFE, 0xFB, 0xFF, 0xBF, 0xD0, 0x02, 0x01,
-    0x62, 0x63, 0x64, 0x66, 0x6B, 0x6D, 0x6E, 0x71, 0x73, 0x74, 0x7A, 0x68, 0x6C, 0x72, 0x2E, 0x27, 0xFF, 0xAA, 0xFF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA, 0xFF, 0xAA,
-    0xFF, 0xEB, 0xFF, 0xBC, 0xFF, 0xBC, 0xFF, 0xAA, 0xFF, 0xAA, 0xCE, 0x02, 0x01, 0x62, 0x64, 0x67, 0x6C, 0x6D, 0x6E,
-    0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF,
-    0x77, 0xFF, 0x77, 0xFF, 0x89, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xFF, 0x77, 0xCA, 0x02,
-    0x01, 0x62, 0x67, 0x66, 0x6E, 0x6C, 0x72, 0x73, 0x74, 0x2E, 0x27, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A,
-    0xFF, 0x5C, 0xFF, 0x5C, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xFF, 0x4A, 0xA0, 0x02, 0x12, 0xA1, 0x00, 0x51, 0x74,
-    0xFD, 0xD1, 0x02, 0x01, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x7A,
-    0x2E, 0x27, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0xFB, 0xFF, 0x33, 0xFF, 0x21, 0xFF, 0x33, 0xFF,
-    0x21, 0xFF, 0x33, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0xFF, 0x21, 0x41, 0x70,
-    0xFD, 0x4D, 0xCB, 0x02, 0x01, 0x62, 0x64, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x76, 0x2E, 0x27, 0xFE, 0xE7, 0xFE,
-    0xE7, 0xFE, 0xE7, 0xFF, 0xFC, 0xFE, 0xF9, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7, 0xFE, 0xE7,
-    0xC2, 0x02, 0x01, 0x2E, 0x27, 0xFE, 0xC3, 0xFE, 0xC3, 0xCB, 0x02, 0x01, 0x67, 0x66, 0x68, 0x6B, 0x6C, 0x6D, 0x72,
-    0x73, 0x74, 0x2E, 0x27, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE, 0xBA, 0xFE, 0xCC, 0xFE,
-    0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xFE, 0xBA, 0xA0, 0x02, 0x33, 0x42, 0x2E, 0x27, 0xFE, 0x93, 0xFE, 0x93, 0xD5, 0x02,
-    0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77,
-    0x7A, 0x2E, 0x27, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFF, 0xF6, 0xFE, 0x8C, 0xFE, 0x9E, 0xFE, 0x9E, 0xFE, 0x8C,
-    0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFE,
-    0x8C, 0xFE, 0x8C, 0xFE, 0x8C, 0xFF, 0xF9, 0xCF, 0x02, 0x01, 0x62, 0x63, 0x66, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x76, 0x77, 0x2E, 0x27, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE,
-    0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xFE, 0x4A, 0xA0, 0x02,
-    0x62, 0xA1, 0x01, 0xE1, 0x6E, 0xFD, 0x21, 0x72, 0xF8, 0x21, 0x65, 0xFD, 0xA1, 0x01, 0xE1, 0x66, 0xFD, 0x41, 0x74,
-    0xFE, 0x07, 0x21, 0x69, 0xFC, 0x21, 0x65, 0xFD, 0xD3, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x7A, 0x68, 0x2E, 0x27, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFF, 0xE6, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xF1, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xA0, 0x02, 0x82, 0xA1, 0x01, 0xE1, 0x65, 0xFD,
-    0x21, 0x63, 0xF8, 0xA1, 0x01, 0xE1, 0x69, 0xFD, 0xCB, 0x02, 0x01, 0x64, 0x68, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x7A, 0x2E, 0x27, 0xFD, 0xB1, 0xFD, 0xC3, 0xFD, 0xC3, 0xFF, 0xF3, 0xFD, 0xB1, 0xFD, 0xC3, 0xFF, 0xFB, 0xFD, 0xB1,
-    0xFD, 0xB1, 0xFD, 0xB1, 0xFD, 0xB1, 0xC3, 0x02, 0x01, 0x71, 0x2E, 0x27, 0xFD, 0x8D, 0xFD, 0x8D, 0xFD, 0x8D, 0xA0,
-    0x02, 0x53, 0xA1, 0x01, 0xE1, 0x73, 0xFD, 0xD5, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x68, 0x67, 0x6B, 0x6C, 0x6D,
-    0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x78, 0x77, 0x7A, 0x2E, 0x27, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD,
-    0x79, 0xFD, 0x8B, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79,
-    0xFD, 0x79, 0xFF, 0xFB, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0xFD, 0x79, 0x43, 0x6D, 0x2E,
-    0x27, 0xFD, 0x37, 0xFD, 0x37, 0xFD, 0x37, 0xA0, 0x02, 0xC2, 0xA1, 0x02, 0x32, 0x6D, 0xFD, 0x41, 0x6E, 0xFE, 0x8F,
-    0x4B, 0x62, 0x63, 0x64, 0x66, 0x67, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x76, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD,
-    0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xFD, 0x21, 0xA0, 0x02, 0xE1, 0x22,
-    0x2E, 0x27, 0xFD, 0xFD, 0xC7, 0x02, 0xA2, 0x68, 0x73, 0x70, 0x74, 0x7A, 0x2E, 0x27, 0xFF, 0xC0, 0xFF, 0xCD, 0xFF,
-    0xD2, 0xFF, 0xD6, 0xFC, 0xF7, 0xFF, 0xF8, 0xFF, 0xFB, 0xC1, 0x00, 0x51, 0x2E, 0xFC, 0xDF, 0x41, 0x68, 0xFF, 0x18,
-    0xA1, 0x00, 0x51, 0x63, 0xFC, 0xC1, 0x01, 0xE1, 0x73, 0xFE, 0xB6, 0xC2, 0x00, 0x51, 0x6B, 0x73, 0xFC, 0xCA, 0xFC,
-    0x06, 0xD2, 0x02, 0x01, 0x62, 0x63, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77,
-    0x7A, 0x2E, 0x27, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFF, 0xE2, 0xFC, 0xD3, 0xFC, 0xC1,
-    0xFC, 0xC1, 0xFC, 0xC1, 0xFC, 0xD3, 0xFF, 0xEC, 0xFF, 0xF1, 0xFC, 0xC1, 0xFC, 0xC1, 0xFF, 0xF7, 0xFC, 0xC1, 0xFE,
-    0x2E, 0xC6, 0x02, 0x01, 0x63, 0x6C, 0x72, 0x76, 0x2E, 0x27, 0xFC, 0x88, 0xFC, 0x9A, 0xFC, 0x9A, 0xFC, 0x88, 0xFC,
-    0x88, 0xFD, 0xF5, 0x41, 0x72, 0xFB, 0xAF, 0xA0, 0x02, 0xF2, 0xC5, 0x02, 0x01, 0x68, 0x61, 0x79, 0x2E, 0x27, 0xFC,
-    0x7E, 0xFF, 0xF9, 0xFF, 0xFD, 0xFC, 0x6C, 0xFC, 0x6C, 0xCA, 0x02, 0x01, 0x62, 0x63, 0x66, 0x68, 0x6D, 0x70, 0x74,
-    0x77, 0x2E, 0x27, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A, 0xFC, 0x5A,
-    0xFC, 0x5A, 0xFC, 0x5A, 0x42, 0x6F, 0x69, 0xFC, 0x48, 0xFC, 0x27, 0xCB, 0x02, 0x01, 0x62, 0x64, 0x6C, 0x6E, 0x70,
-    0x74, 0x73, 0x76, 0x7A, 0x2E, 0x27, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC,
-    0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFC, 0x32, 0xFD, 0x9F, 0x5A, 0x2E, 0x27, 0x61, 0x65, 0x6F, 0x62, 0x63, 0x64, 0x66,
-    0x67, 0x68, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xFB, 0xC2,
-    0xFB, 0xF9, 0xFC, 0x14, 0xFC, 0x23, 0xFC, 0x28, 0xFC, 0x2B, 0xFC, 0x64, 0xFC, 0x97, 0xFC, 0xC4, 0xFC, 0xED, 0xFD,
-    0x27, 0xFD, 0x4B, 0xFD, 0x54, 0xFD, 0x82, 0xFD, 0xC4, 0xFE, 0x11, 0xFE, 0x5D, 0xFE, 0x81, 0xFE, 0x95, 0xFF, 0x17,
-    0xFF, 0x4D, 0xFF, 0x86, 0xFF, 0xA2, 0xFF, 0xB4, 0xFF, 0xD5, 0xFF, 0xDC,
+// Aho-Corasick automaton for the hypher patterns: 461 states, 27 dense.
+constexpr uint8_t it_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns it_patterns = {
-    0x5C0u,
-    it_trie_data,
-    sizeof(it_trie_data),
+constexpr uint16_t it_dense[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 0, 22, 23, 24, 25, 26, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 0, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 0, 22, 23, 24, 25, 26, 0, 1, 2, 27, 28, 29,
+    30, 31, 32, 9, 33, 0, 34, 35, 36, 14, 37, 38, 39, 18, 40, 41,
+    42, 0, 22, 43, 24, 25, 44, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 45, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 46, 47, 22,
+    23, 24, 48, 26, 0, 49, 50, 3, 51, 52, 53, 7, 54, 9, 10, 0,
+    11, 12, 55, 56, 57, 16, 58, 18, 59, 60, 61, 0, 62, 23, 24, 25,
+    26, 0, 63, 64, 3, 65, 66, 67, 7, 68, 9, 69, 0, 11, 70, 71,
+    72, 73, 16, 17, 74, 75, 76, 77, 0, 22, 23, 24, 25, 78, 0, 79,
+    80, 3, 81, 5, 82, 7, 8, 83, 10, 0, 11, 12, 84, 85, 86, 16,
+    87, 18, 88, 89, 90, 0, 91, 92, 24, 25, 26, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 93, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 0, 22, 94, 24, 25, 26, 0, 95, 96, 3, 97, 5, 6, 7,
+    98, 99, 10, 0, 11, 12, 100, 14, 101, 16, 17, 18, 102, 103, 104, 0,
+    22, 23, 24, 25, 26, 0, 105, 106, 3, 107, 5, 108, 7, 109, 110, 111,
+    0, 11, 12, 112, 113, 114, 16, 115, 18, 116, 117, 118, 0, 119, 120, 24,
+    25, 121, 0, 122, 123, 3, 124, 5, 125, 7, 8, 9, 126, 127, 11, 12,
+    128, 129, 130, 16, 17, 18, 131, 20, 21, 0, 132, 23, 24, 25, 26, 0,
+    133, 134, 3, 4, 5, 6, 7, 8, 9, 10, 0, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 0, 22, 23, 24, 25, 26, 0, 135, 136, 3,
+    4, 5, 6, 7, 137, 138, 139, 0, 11, 140, 141, 142, 15, 16, 17, 18,
+    143, 144, 145, 0, 22, 23, 24, 25, 26, 0, 146, 147, 3, 148, 149, 150,
+    7, 151, 152, 153, 0, 154, 155, 156, 157, 158, 16, 159, 160, 161, 162, 163,
+    0, 164, 165, 24, 25, 166, 0, 167, 168, 3, 169, 170, 6, 7, 171, 9,
+    10, 0, 11, 12, 172, 173, 174, 16, 175, 176, 177, 178, 179, 0, 180, 181,
+    24, 25, 26, 0, 182, 183, 3, 184, 185, 186, 7, 187, 188, 189, 0, 11,
+    190, 191, 192, 193, 16, 194, 195, 196, 197, 198, 0, 199, 23, 24, 25, 200,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 201, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 0, 22, 23, 24, 25, 26, 0, 202, 203,
+    3, 4, 5, 204, 7, 8, 9, 205, 0, 11, 12, 206, 14, 207, 16, 208,
+    18, 209, 210, 211, 0, 22, 23, 24, 25, 212, 0, 213, 214, 3, 4, 5,
+    6, 7, 8, 9, 10, 0, 11, 12, 13, 14, 15, 16, 17, 215, 19, 20,
+    21, 0, 22, 23, 24, 25, 26, 0, 216, 217, 3, 218, 219, 220, 7, 221,
+    222, 223, 0, 11, 224, 225, 226, 227, 16, 228, 229, 230, 231, 232, 0, 233,
+    234, 235, 25, 236, 0, 237, 238, 3, 4, 5, 6, 7, 8, 9, 239, 0,
+    11, 12, 13, 14, 15, 16, 240, 18, 19, 241, 242, 0, 22, 23, 24, 25,
+    243, 0, 244, 245, 3, 246, 247, 248, 7, 249, 250, 251, 0, 11, 12, 252,
+    253, 254, 16, 255, 18, 256, 257, 258, 0, 259, 260, 24, 25, 261, 0, 262,
+    263, 3, 4, 264, 6, 7, 8, 9, 10, 0, 11, 12, 265, 14, 15, 16,
+    17, 18, 266, 20, 21, 0, 267, 23, 24, 25, 26, 0, 268, 269, 270, 4,
+    5, 6, 7, 8, 9, 271, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 0, 22, 23, 24, 272, 26, 0, 273, 274, 3, 275, 276, 6, 7,
+    277, 9, 278, 0, 11, 12, 13, 279, 15, 16, 280, 18, 19, 20, 281, 0,
+    22, 282, 24, 25, 26, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    283, 11, 12, 13, 14, 15, 284, 17, 18, 19, 20, 21, 0, 22, 23, 24,
+    25, 26, 0, 285, 286, 3, 287, 5, 288, 7, 8, 9, 10, 0, 11, 12,
+    289, 14, 290, 16, 291, 18, 19, 292, 293, 0, 294, 23, 24, 25, 295,
+};
+
+constexpr uint8_t it_label[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x10,
+    0x11, 0x12, 0x14, 0x15, 0x16, 0x19, 0x1C, 0x0B, 0x16, 0x17, 0x1B, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0E, 0x0F,
+    0x10, 0x12, 0x14, 0x15, 0x16, 0x18, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14,
+    0x15, 0x16, 0x1C, 0x01, 0x02, 0x04, 0x06, 0x09, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19, 0x0B, 0x19,
+    0x01, 0x02, 0x04, 0x08, 0x09, 0x0E, 0x10, 0x14, 0x15, 0x16, 0x01, 0x02, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0E, 0x0F,
+    0x10, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1C, 0x01, 0x02, 0x04, 0x06, 0x0A, 0x0B, 0x0E, 0x0F, 0x10, 0x14, 0x18,
+    0x01, 0x02, 0x01, 0x02, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x14, 0x15, 0x16, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08,
+    0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1C, 0x01, 0x02, 0x04, 0x05,
+    0x08, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A,
+    0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x1C, 0x0B, 0x01, 0x02, 0x06, 0x0A, 0x0E, 0x10, 0x12,
+    0x14, 0x15, 0x16, 0x1C, 0x01, 0x02, 0x13, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x01, 0x02, 0x0A, 0x12, 0x15, 0x16, 0x1C, 0x01, 0x02, 0x04,
+    0x05, 0x06, 0x08, 0x09, 0x0A, 0x0E, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1C, 0x01, 0x02, 0x05, 0x0E,
+    0x14, 0x18, 0x01, 0x02, 0x03, 0x0A, 0x1B, 0x01, 0x02, 0x04, 0x05, 0x08, 0x0A, 0x0F, 0x12, 0x16, 0x19, 0x0B, 0x11,
+    0x01, 0x02, 0x04, 0x06, 0x0E, 0x10, 0x12, 0x15, 0x16, 0x18, 0x1C, 0x10, 0x12, 0x0B, 0x03, 0x0B, 0x11, 0x0B, 0x1A,
+    0x14, 0x0B, 0x03, 0x12, 0x14, 0x03, 0x0A, 0x11, 0x14, 0x15, 0x07, 0x0A, 0x17, 0x14, 0x03, 0x07, 0x03, 0x07, 0x11,
+    0x17, 0x02, 0x11, 0x03, 0x01, 0x02, 0x04, 0x0A, 0x10, 0x14, 0x17, 0x16, 0x12, 0x01, 0x02, 0x10, 0x07, 0x08, 0x03,
+    0x07, 0x11, 0x17, 0x07, 0x0B, 0x15, 0x01, 0x02, 0x01, 0x02, 0x0F, 0x10, 0x0F, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0F,
+    0x10, 0x12, 0x15, 0x16, 0x18, 0x01, 0x02, 0x02, 0x05, 0x15, 0x0D, 0x15, 0x01, 0x02, 0x14, 0x17, 0x01, 0x02, 0x16,
+    0x10, 0x11, 0x12, 0x14, 0x10, 0x15, 0x07, 0x03, 0x07, 0x12, 0x14, 0x16, 0x16, 0x14, 0x0E, 0x14, 0x0E, 0x07, 0x0B,
+    0x03, 0x04, 0x03, 0x09, 0x0E, 0x01, 0x02, 0x10, 0x0B, 0x07, 0x05, 0x0A, 0x0B, 0x15, 0x05, 0x16, 0x05, 0x17, 0x10,
+    0x07, 0x15, 0x05, 0x11, 0x11, 0x03, 0x0B, 0x15, 0x14, 0x0E, 0x14, 0x10, 0x10, 0x16, 0x02, 0x16, 0x14, 0x0F, 0x17,
+    0x14, 0x0B, 0x0D, 0x03, 0x11, 0x12, 0x12, 0x05, 0x07, 0x17, 0x15, 0x10, 0x0F, 0x11, 0x10, 0x14, 0x05, 0x06, 0x0E,
+    0x10, 0x12, 0x14, 0x16, 0x07,
+};
+
+constexpr uint16_t it_child_base[] = {
+    1, 201, 304, 326, 327, 333, 334, 335, 336, 336, 338, 338, 340, 346, 347, 353,
+    369, 376, 379, 387, 404, 407, 410, 410, 414, 427, 439, 448, 460,
+};
+
+constexpr uint8_t it_child_offset[] = {
+    0x00, 0x1A, 0x1A, 0x2C, 0x30, 0x3E, 0x4E, 0x5C, 0x5E, 0x68, 0x79, 0x84, 0x86, 0x91, 0xA6, 0xB5, 0x00, 0x01, 0x0C,
+    0x0F, 0x24, 0x2B, 0x3D, 0x43, 0x48, 0x52, 0x54, 0x5F, 0x61, 0x62, 0x65, 0x66, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x05, 0x0A, 0x0B, 0x0D, 0x0E, 0x10, 0x10, 0x14, 0x15, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x01, 0x02, 0x0D, 0x0D, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x04, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B,
+    0x0C, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+constexpr uint16_t it_fail[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 6, 7,
+    8, 10, 11, 12, 13, 15, 16, 17, 19, 20, 21, 23, 26, 0, 21, 0,
+    25, 1, 2, 4, 5, 6, 8, 13, 14, 15, 17, 19, 20, 21, 22, 1,
+    2, 4, 5, 6, 8, 10, 12, 13, 14, 15, 18, 19, 20, 21, 26, 1,
+    2, 4, 6, 9, 13, 14, 15, 17, 19, 20, 21, 22, 23, 0, 23, 1,
+    2, 4, 8, 9, 13, 15, 19, 20, 21, 1, 2, 4, 6, 8, 9, 10,
+    13, 14, 15, 17, 19, 20, 21, 22, 23, 26, 1, 2, 4, 6, 10, 0,
+    13, 14, 15, 19, 22, 1, 2, 1, 2, 8, 9, 10, 12, 13, 14, 19,
+    20, 21, 1, 2, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, 17,
+    18, 19, 20, 21, 22, 23, 26, 1, 2, 4, 5, 8, 13, 14, 15, 17,
+    18, 19, 20, 21, 22, 23, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13,
+    14, 15, 17, 18, 19, 20, 21, 22, 26, 0, 1, 2, 6, 10, 13, 15,
+    17, 19, 20, 21, 26, 1, 2, 18, 1, 2, 4, 5, 6, 8, 9, 10,
+    12, 13, 14, 15, 17, 18, 19, 20, 21, 22, 23, 24, 26, 1, 2, 10,
+    17, 20, 21, 26, 1, 2, 4, 5, 6, 8, 9, 10, 13, 14, 15, 17,
+    19, 20, 21, 22, 23, 26, 1, 2, 5, 13, 19, 22, 1, 2, 3, 10,
+    25, 1, 2, 4, 5, 8, 10, 14, 17, 21, 23, 0, 16, 1, 2, 4,
+    6, 13, 15, 17, 20, 21, 22, 26, 15, 17, 0, 3, 0, 16, 0, 24,
+    102, 0, 3, 17, 19, 3, 205, 16, 209, 210, 7, 239, 0, 256, 270, 7,
+    3, 7, 16, 0, 245, 16, 3, 122, 123, 124, 126, 130, 131, 0, 21, 17,
+    1, 2, 114, 7, 8, 3, 7, 16, 0, 7, 0, 257, 1, 2, 122, 123,
+    129, 207, 14, 246, 247, 248, 249, 250, 253, 254, 255, 257, 258, 259, 1, 2,
+    123, 5, 257, 12, 292, 1, 2, 19, 0, 1, 2, 198, 207, 16, 17, 19,
+    15, 20, 7, 3, 7, 17, 19, 211, 232, 19, 128, 131, 13, 7, 93, 3,
+    4, 3, 9, 13, 1, 2, 207, 93, 7, 5, 69, 0, 210, 219, 198, 5,
+    0, 15, 7, 210, 219, 16, 16, 3, 0, 20, 19, 55, 59, 15, 114, 163,
+    2, 21, 19, 14, 0, 256, 0, 190, 3, 16, 17, 17, 5, 7, 0, 197,
+    174, 14, 16, 15, 75, 5, 6, 13, 15, 240, 19, 242, 7,
+};
+
+constexpr uint16_t it_levels[] = {
+    0, 2, 0, 0, 49, 49, 49, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+    0, 49, 49, 49, 82, 49, 49, 49, 49, 0, 49, 0, 0, 129, 129, 0,
+    0, 129, 129, 129, 0, 0, 0, 0, 0, 0, 129, 0, 129, 0, 0, 0,
+    0, 161, 161, 161, 161, 161, 161, 193, 161, 161, 161, 193, 161, 161, 161, 161,
+    161, 161, 161, 161, 161, 193, 161, 193, 161, 161, 161, 193, 161, 161, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 193, 161, 161, 161, 161, 0, 193, 161,
+    161, 161, 161, 161, 193, 161, 193, 161, 161, 161, 161, 161, 161, 161, 161, 193,
+    193, 161, 193, 161, 193, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0,
+    193, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 193, 161, 193, 161, 193,
+    161, 161, 0, 161, 161, 161, 161, 227, 161, 193, 193, 161, 161, 161, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 161, 161, 161, 193, 193, 161,
+    161, 193, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 193,
+    161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 0, 289, 0,
+    0, 322, 0, 161, 0, 161, 161, 161, 161, 161, 161, 193, 193, 161, 161, 161,
+    193, 193, 161, 161, 161, 193, 0, 161, 161, 193, 193, 161, 161, 161, 0, 193,
+    370, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 417, 0, 0, 161, 161,
+    161, 161, 161, 161, 161, 161, 161, 161, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 449, 0, 0, 0, 0, 0, 0,
+    481, 481, 481, 481, 513, 481, 481, 0, 513, 513, 513, 513, 449, 481, 546, 0,
+    513, 513, 594, 0, 0, 481, 481, 481, 481, 642, 0, 691, 753, 753, 513, 513,
+    513, 787, 850, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+    513, 0, 594, 513, 449, 513, 513, 449, 481, 513, 513, 0, 898, 945, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 977, 977, 0, 945, 0, 0,
+    0, 0, 0, 0, 0, 1009, 898, 0, 0, 1042, 1042, 1089, 1122, 0, 0, 0,
+    1170, 0, 1217, 0, 0, 1089, 0, 1089, 0, 0, 0, 0, 1250, 0, 1250, 1298,
+    1345, 1345, 1378, 0, 0, 0, 0, 1426, 1474, 1521, 1554, 1554, 0, 1602, 1650, 0,
+    1698, 1746, 1793, 0, 1826, 1874, 1874, 1874, 1874, 1874, 1874, 1874, 1922,
+};
+
+constexpr uint8_t it_level_data[] = {
+    0x01, 0x02, 0x0C, 0x01, 0x01, 0x01, 0x01, 0x0C, 0x02, 0x16, 0x02, 0x02, 0x02, 0x0C, 0x02, 0x02, 0x0D, 0x0C, 0x02,
+    0x04, 0x02, 0x02, 0x0D, 0x02, 0x02, 0x0B, 0x02, 0x0B, 0x03, 0x16, 0x03, 0x0B, 0x03, 0x02, 0x03, 0x02, 0x16, 0x03,
+    0x0C, 0x0D, 0x03, 0x03, 0x0C, 0x03, 0x0C, 0x0C, 0x0D, 0x03, 0x04, 0x03, 0x02, 0x0D, 0x0C, 0x03, 0x0E, 0x0D, 0x04,
+    0x17, 0x0C, 0x04, 0x29, 0x04, 0x20, 0x04, 0x02, 0x04, 0x03, 0x0C, 0x05, 0x33, 0x05, 0x22, 0x0D, 0x05, 0x16, 0x0B,
+    0x05, 0x35, 0x05, 0x20, 0x0D, 0x05, 0x2A, 0x0B, 0x05, 0x02, 0x05, 0x0C, 0x0D, 0x06, 0x34, 0x0D, 0x06, 0x21, 0x0C,
+    0x06, 0x3D, 0x06, 0x35, 0x0C, 0x06, 0x2A, 0x17, 0x06, 0x20, 0x0D, 0x07, 0x35, 0x0C, 0x07, 0x3E, 0x0B, 0x07, 0x47,
+    0x07, 0x1F, 0x0C, 0x07, 0x34, 0x0D, 0x08, 0x20, 0x0D,
+};
+
+constexpr HyphenationAutomaton it_automaton = {
+    it_symbols,
+    29u,
+    27u,
+    it_dense,
+    461u,
+    it_label,
+    4u,
+    it_child_base,
+    it_child_offset,
+    it_fail,
+    it_levels,
+    it_level_data,
 };
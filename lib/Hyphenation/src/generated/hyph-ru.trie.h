@@ -3,1769 +3,3270 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t ru_trie_data[] = {
-    0x33, 0x48, 0x34, 0x49, 0x34, 0x15, 0x16, 0x47, 0x34, 0x17, 0x35, 0x16, 0x36, 0x5B, 0x34, 0x29, 0x33, 0x16, 0x49,
-    0x16, 0x5C, 0x04, 0x17, 0x2A, 0x3F, 0x2B, 0x3E, 0x3D, 0x17, 0x16, 0x02, 0x3D, 0x16, 0x16, 0x15, 0x40, 0x17, 0x2A,
-    0x15, 0x01, 0x51, 0x52, 0x16, 0x15, 0x16, 0x29, 0x16, 0x02, 0x15, 0x3F, 0x16, 0x02, 0x29, 0x03, 0x03, 0x2A, 0x41,
-    0x18, 0x01, 0x16, 0x53, 0x16, 0x02, 0x17, 0x16, 0x3D, 0x02, 0x16, 0x2B, 0x16, 0x3E, 0x15, 0x02, 0x15, 0x16, 0x2C,
-    0x03, 0x16, 0x02, 0x2A, 0x2A, 0x29, 0x01, 0x16, 0x16, 0x2A, 0x15, 0x16, 0x2A, 0x17, 0x03, 0x3F, 0x01, 0x29, 0x01,
-    0x16, 0x15, 0x29, 0x2A, 0x66, 0x16, 0x17, 0x04, 0x17, 0x29, 0x15, 0x2A, 0x17, 0x3E, 0x17, 0x02, 0x2A, 0x15, 0x67,
-    0x18, 0x17, 0x3D, 0x18, 0x18, 0x15, 0x15, 0x18, 0x04, 0x16, 0x02, 0x15, 0x16, 0x15, 0x01, 0x3E, 0x01, 0x16, 0x17,
-    0x02, 0x15, 0x2B, 0x52, 0x15, 0x65, 0x52, 0x17, 0x29, 0x16, 0x17, 0x29, 0x18, 0x04, 0x15, 0x03, 0x29, 0x16, 0x02,
-    0x3F, 0x03, 0x2B, 0x16, 0x51, 0x16, 0x54, 0x01, 0x2A, 0x02, 0x3F, 0x16, 0x04, 0x19, 0x01, 0x18, 0x2C, 0x15, 0x03,
-    0x3E, 0x03, 0x16, 0x2A, 0x04, 0x15, 0x16, 0x54, 0x17, 0x17, 0x18, 0x29, 0x17, 0x15, 0x29, 0x16, 0x06, 0x2B, 0x18,
-    0x2C, 0x15, 0x16, 0x66, 0x15, 0x3F, 0x16, 0x17, 0x02, 0x65, 0x3A, 0x08, 0x08, 0x11, 0x1C, 0x30, 0x26, 0x1C, 0x08,
-    0x1C, 0xA0, 0x00, 0x41, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xF7, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0xA0, 0x00, 0x51, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x00, 0x61, 0xA0, 0x00, 0x71, 0x21,
-    0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x26, 0xB1, 0xB3, 0xB4, 0xB8, 0xBA, 0xBB, 0xD6,
-    0xE2, 0xEB, 0xEE, 0xD6, 0xFD, 0xA0, 0x00, 0x83, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0xA0, 0x00, 0xB1, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xB7, 0xFD, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x23,
-    0x80, 0x81, 0x83, 0xEC, 0xFD, 0xC1, 0xA0, 0x0D, 0x11, 0x23, 0xD0, 0xD1, 0x2D, 0xC9, 0xF6, 0xFD, 0x41, 0xBE, 0xFF,
-    0xB0, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xFF, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB4,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB8, 0xBE, 0xEA, 0xFD, 0x22, 0xD0, 0x2D, 0xFB, 0xD7, 0xA0, 0x00, 0xC2, 0x21, 0xBB,
-    0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x00, 0xE2, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB1, 0xB6, 0xF4, 0xFD, 0x21,
-    0xD0, 0xFB, 0x21, 0xBE, 0xFD, 0x41, 0x80, 0xFF, 0x66, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xFF, 0xA5, 0x41, 0x84, 0xFF, 0x55, 0x21, 0xD1, 0xFC,
-    0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFF, 0x91, 0x41, 0xB2, 0xFF, 0x26, 0xA1, 0x00, 0x51, 0xD0, 0xFC,
-    0x21, 0xBA, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0xBA, 0xFF, 0x35, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xFF,
-    0x10, 0x21, 0xD0, 0xF9, 0xA0, 0x00, 0xE1, 0x41, 0xBB, 0xFF, 0x18, 0x21, 0xD0, 0xFC, 0xA0, 0x01, 0x42, 0x22, 0xB5,
-    0xB8, 0xFA, 0xFD, 0x21, 0x91, 0xF5, 0x22, 0xD0, 0xD1, 0xF8, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x22, 0xBF,
-    0xB1, 0xE0, 0xFD, 0x41, 0x82, 0xFF, 0x7C, 0x22, 0xD0, 0xD1, 0xF7, 0xFC, 0x23, 0xB5, 0xB8, 0xBE, 0xBE, 0xCF, 0xFB,
-    0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xFF, 0x35, 0x41, 0xB8, 0xFE, 0xEB, 0x21, 0xD0, 0xFC, 0x21, 0xBF, 0xFD, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xFF, 0x24, 0x41, 0xBD, 0xFF, 0x54, 0x21, 0xD0, 0xFC, 0x43, 0xB2, 0xBC, 0xBF, 0xFF, 0x65, 0xFF,
-    0xFD, 0xFF, 0xAC, 0x21, 0xD0, 0xF6, 0x21, 0xB0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFF, 0x06, 0x42, 0xB3, 0xBD,
-    0xFE, 0xB0, 0xFF, 0x95, 0x21, 0xD0, 0xF9, 0xA0, 0x01, 0x01, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0xA1, 0x00, 0x61, 0xD0, 0xFD, 0x45, 0xB3, 0xB7, 0xB8, 0xBA, 0xBE, 0xFE, 0x86, 0xFF, 0xEC, 0xFE, 0x9E, 0xFE, 0x86,
-    0xFF, 0xFB, 0x41, 0x81, 0xFF, 0x6A, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFC, 0xFE, 0xD0, 0x41, 0x80, 0xFE,
-    0xF4, 0x21, 0xD1, 0xFC, 0x42, 0xBE, 0xBF, 0xFE, 0x79, 0xFF, 0xFD, 0x41, 0xBA, 0xFE, 0xA0, 0x21, 0xD0, 0xFC, 0x21,
-    0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xEF, 0xFD, 0x21, 0xB5, 0xFB, 0xA0, 0x01, 0x11, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x8C, 0x8E, 0xFE, 0x51, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7,
-    0xFF, 0xF9, 0xFE, 0x90, 0x41, 0x83, 0xFE, 0x5F, 0x21, 0xD1, 0xFC, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC,
-    0xFE, 0x15, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x00, 0x82, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x23, 0xB5, 0xB8, 0xBE, 0xE7, 0xF4, 0xFD, 0xA0, 0x01, 0x22, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x88,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xFE, 0x4A, 0x42, 0x82,
-    0x88, 0xFE, 0xD6, 0xFE, 0x77, 0x42, 0xD0, 0xD1, 0xFE, 0xAF, 0xFF, 0xF9, 0x41, 0xBD, 0xFE, 0xC8, 0x21, 0xD0, 0xFC,
-    0x43, 0xB2, 0xB4, 0xB7, 0xFF, 0xFD, 0xFD, 0xCD, 0xFE, 0xCB, 0x41, 0xBB, 0xFD, 0xBD, 0x41, 0x86, 0xFE, 0xBD, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0x81, 0x82, 0xFF, 0xFB, 0xFE, 0xAA, 0xA2, 0x0C, 0xC1, 0xD0, 0xD1, 0xE2, 0xF9, 0x41,
-    0xD1, 0xFF, 0x55, 0x23, 0xB0, 0xB5, 0xBE, 0xC9, 0xF5, 0xFC, 0x41, 0xBB, 0xFD, 0xE3, 0x21, 0xD0, 0xFC, 0x21, 0xBA,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFD, 0xEB, 0xA0, 0x01,
-    0x62, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x8E, 0xFD, 0x92, 0x21, 0xD1, 0xFC, 0x21, 0x8E, 0xFD, 0x21, 0xD1,
-    0xFD, 0x22, 0xBE, 0xBB, 0xF0, 0xFD, 0x42, 0xB5, 0xB9, 0xFD, 0x80, 0xFD, 0x80, 0x22, 0xD0, 0xD1, 0xF9, 0xE7, 0x42,
-    0xB2, 0xBB, 0xFD, 0x74, 0xFD, 0x74, 0x41, 0x82, 0xFD, 0x6D, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x22, 0xB5, 0xB8, 0xEB,
-    0xFB, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xD4, 0xFD, 0x41, 0xBE, 0xFD, 0x82, 0x21, 0xD0, 0xFC,
-    0x44, 0xB1, 0xB2, 0xB3, 0xB7, 0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0x65, 0xFE, 0x9E, 0x41, 0xB8, 0xFE, 0x1C, 0xA1, 0x00,
-    0x61, 0xD0, 0xFC, 0x42, 0xBA, 0xBF, 0xFD, 0x92, 0xFF, 0xFB, 0x21, 0xD0, 0xF9, 0x41, 0x83, 0xFD, 0x0F, 0x42, 0xD0,
-    0xD1, 0xFD, 0x14, 0xFF, 0xFC, 0x41, 0xB6, 0xFD, 0x04, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x83, 0xF2, 0xFD, 0x42, 0xD0,
-    0xD1, 0xFD, 0xD2, 0xFF, 0xFB, 0x22, 0x81, 0x82, 0xDF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xFB, 0xFD,
-    0x50, 0x41, 0xBD, 0xFC, 0xF7, 0x21, 0xD0, 0xFC, 0x41, 0x83, 0xFC, 0xF0, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x44, 0xB2, 0xB6, 0xB7, 0xBC, 0xFD, 0x69, 0xFD, 0x69, 0xFF, 0xF0, 0xFF, 0xFD, 0x21, 0xD0, 0xF3, 0x41,
-    0x81, 0xFE, 0xB6, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22,
-    0xBE, 0xB0, 0xEA, 0xFD, 0xA0, 0x01, 0x81, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFC, 0xF8, 0x41, 0x2D, 0xFC, 0xEE, 0x50, 0xB0,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBA, 0xFC, 0xED, 0xFD, 0x13,
-    0xFD, 0x45, 0xFD, 0x59, 0xFD, 0xB5, 0xFD, 0xC6, 0xFD, 0xE4, 0xFE, 0x1A, 0xFE, 0x5A, 0xFE, 0xA0, 0xFE, 0xFF, 0xFF,
-    0x9A, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFC, 0xE7, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD,
-    0x21, 0xD1, 0xFD, 0x41, 0x80, 0xFC, 0x66, 0x21, 0xD1, 0xFC, 0x41, 0xB2, 0xFC, 0xD3, 0x21, 0xD0, 0xFC, 0x43, 0xB1,
-    0xB7, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD, 0xFF, 0x5C, 0x21, 0xD0, 0xF6, 0x42, 0x81, 0x87, 0xFD, 0x1A, 0xFC, 0x4B, 0x21,
-    0xD1, 0xF9, 0x21, 0xB7, 0xE6, 0x41, 0xB8, 0xFC, 0xB2, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xBF, 0xFC, 0xAB, 0xFF, 0xFD,
-    0x21, 0xD0, 0xF9, 0x42, 0x81, 0x85, 0xFF, 0xFD, 0xFC, 0x2D, 0x22, 0xD0, 0xD1, 0xE5, 0xF9, 0x24, 0xB0, 0xB5, 0xB8,
-    0xBE, 0xB8, 0xD3, 0xDD, 0xFB, 0x21, 0xB1, 0xB6, 0x21, 0xD0, 0xFD, 0x21, 0x91, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xEE, 0xFF, 0xFD, 0xFC, 0x55, 0x41, 0x82, 0xFF, 0x41, 0x21, 0xD1, 0xFC, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xBB, 0xFC, 0x53, 0x21, 0xD0, 0xFC, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB5, 0xBA, 0xBE, 0xFF, 0xF0, 0xFB,
-    0xEB, 0xFF, 0xFD, 0x41, 0xB6, 0xFB, 0xE1, 0x21, 0xD0, 0xFC, 0x42, 0x82, 0x83, 0xFB, 0xDA, 0xFF, 0xFD, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9, 0xFC, 0x19, 0x41, 0xBE, 0xFC, 0x3D, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0x61, 0xD1,
-    0xFB, 0xF3, 0x43, 0xB0, 0xB3, 0xBE, 0xFB, 0xBF, 0xFF, 0xFA, 0xFB, 0xBC, 0x21, 0xD0, 0xF6, 0x22, 0xB5, 0xB8, 0xEA,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFB, 0xF0, 0x41, 0xBD, 0xFB, 0xFE, 0x21, 0xD0, 0xFC, 0x41, 0x87, 0xFB, 0x9C,
-    0x21, 0xD1, 0xFC, 0x48, 0xB1, 0xB4, 0xB5, 0xB7, 0xBA, 0xBC, 0xBE, 0xBF, 0xFB, 0x95, 0xFB, 0x95, 0xFB, 0x95, 0xFF,
-    0xF6, 0xFB, 0x95, 0xFF, 0xFD, 0xFC, 0x71, 0xFB, 0x95, 0x41, 0xB2, 0xFB, 0x7C, 0x21, 0xD0, 0xFC, 0x45, 0x80, 0x81,
-    0x82, 0x8E, 0x91, 0xFF, 0xFD, 0xFB, 0x75, 0xFF, 0x13, 0xFB, 0x75, 0xFB, 0x75, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0,
-    0xFF, 0xF0, 0xFB, 0xAB, 0x41, 0x80, 0xFF, 0x00, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xFB, 0x97, 0x41, 0x81, 0xFD, 0x2A, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xFA, 0xFF, 0xFD, 0xFB, 0x83, 0x41, 0x81, 0xFB, 0x15, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFB, 0x75, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x85, 0x87, 0x8E, 0x91, 0x84, 0x86, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8F, 0xFF, 0x19, 0xFF,
-    0x55, 0xFF, 0x7E, 0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xEB, 0xFF, 0xF9, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
-    0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0x42, 0xD0, 0xD1, 0xFE, 0x50, 0xFF, 0xCC,
-    0xA0, 0x01, 0xB1, 0x21, 0xBF, 0xFD, 0x22, 0x80, 0x86, 0xFA, 0xFA, 0xA0, 0x0D, 0x42, 0xA3, 0x01, 0x92, 0xD0, 0xD1,
-    0x2D, 0xF5, 0xF8, 0xFD, 0xA0, 0x01, 0xC1, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0xA0, 0x00, 0xD1, 0x21, 0xB0, 0xFD, 0x21, 0x8E, 0xD4, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0x22, 0xB5, 0xBB, 0xEF, 0xFB,
-    0xA0, 0x01, 0x31, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x83, 0xFD, 0xE4, 0xA3, 0x00, 0x91, 0xD0, 0xD1,
-    0x2D, 0xED, 0xFB, 0xC4, 0xA0, 0x00, 0x91, 0xA0, 0x01, 0xD1, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x01, 0xE1,
-    0x21, 0xB0, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0xA0, 0x01, 0xF1, 0xA0, 0x00, 0xA1, 0x22, 0x81, 0x82, 0xFA, 0xFD,
-    0xA1, 0x00, 0x91, 0xD1, 0xFB, 0x25, 0xB2, 0xB5, 0xB7, 0xB8, 0xBE, 0xC2, 0xD9, 0xE2, 0xEB, 0xFB, 0x21, 0xB0, 0xB7,
-    0x21, 0xD0, 0xFD, 0x41, 0xB5, 0xFF, 0x78, 0x21, 0xD0, 0xFC, 0xA0, 0x02, 0x02, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x27, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x91, 0xED, 0xF4, 0xD2, 0xB8, 0xD2, 0xFD, 0xB8, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xD0, 0xFF, 0xF1, 0xFF, 0x64, 0xA0, 0x02, 0x32, 0x21, 0x81, 0xFD, 0xA1, 0x02, 0x21, 0xD1, 0xFD, 0x41, 0xB8,
-    0xFF, 0xAE, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xA1, 0xFF, 0x37, 0x21,
-    0xD1, 0xF9, 0x43, 0xB5, 0xB8, 0xBE, 0xFF, 0x97, 0xFF, 0x2D, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0xA0, 0x02, 0x21, 0x45,
-    0xB0, 0xB4, 0xB8, 0xBB, 0xBE, 0xFF, 0xD4, 0xFF, 0x87, 0xFF, 0xE3, 0xFF, 0xFA, 0xFF, 0xFD, 0x41, 0x83, 0xFF, 0x33,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFC, 0xFF, 0x14, 0x41, 0xB5, 0xFF, 0x69, 0x41, 0x91, 0xFF, 0x65, 0xA2,
-    0x02, 0x21, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xB8, 0xFE, 0xF0, 0x21, 0xD0, 0xFC, 0x41, 0xB4, 0xFF, 0x45, 0x21, 0xD0,
-    0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0x52, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD,
-    0x21, 0xD0, 0xFD, 0x45, 0xB2, 0xB6, 0xB8, 0xBB, 0xBE, 0xFF, 0xD6, 0xFF, 0xE1, 0xFF, 0xEE, 0xFF, 0x37, 0xFF, 0xFD,
-    0x41, 0xBE, 0xFE, 0xF6, 0x21, 0x83, 0xDD, 0x22, 0xD0, 0xD1, 0xF9, 0xFD, 0x41, 0x87, 0xFE, 0xC8, 0x21, 0xD1, 0xFC,
-    0x41, 0xBD, 0xFF, 0x14, 0x21, 0xD0, 0xFC, 0x44, 0x80, 0x83, 0x86, 0x8B, 0xFF, 0xED, 0xFF, 0xF6, 0xFE, 0xA3, 0xFF,
-    0xFD, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF3, 0xFE, 0xA1, 0x41, 0xBE, 0xFE, 0x8A, 0x21, 0xD0,
-    0xFC, 0x44, 0xB3, 0xB4, 0xBB, 0xBF, 0xFF, 0xFD, 0xFF, 0x97, 0xFE, 0x83, 0xFE, 0xED, 0x42, 0x80, 0x81, 0xFF, 0x02,
-    0xFE, 0x76, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xFE, 0x7A, 0xA0, 0x02, 0x72, 0x21, 0x88,
-    0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB7, 0xFE, 0xAD, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xBB, 0xFF, 0xFD, 0xFE, 0x8C, 0x21,
-    0x91, 0xF6, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xF6, 0xFD, 0x41, 0x80, 0xFE, 0x7B, 0x21, 0xD1, 0xFC, 0xA0, 0x02, 0x92,
-    0x21, 0x80, 0xFD, 0xA1, 0x01, 0x31, 0xD1, 0xFD, 0x41, 0x8C, 0xFE, 0x9A, 0x21, 0xD1, 0xFC, 0x23, 0xB1, 0xB2, 0xBB,
-    0xF4, 0xFD, 0xFD, 0x41, 0xB8, 0xFE, 0x72, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x81, 0xFD, 0xE0, 0x22, 0xD0, 0xD1, 0xED,
-    0xFB, 0x45, 0xB0, 0xB2, 0xB3, 0xB4, 0xBE, 0xFF, 0xB4, 0xFF, 0xC8, 0xFE, 0x6D, 0xFF, 0xD3, 0xFF, 0xFB, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xBF, 0xFE, 0x0C, 0x41, 0xBB, 0xFE, 0x4A, 0xA1, 0x02, 0x92, 0xD0, 0xFC, 0x21, 0xB3,
-    0xFB, 0x41, 0x85, 0xFE, 0x55, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFF, 0xFC, 0xFD, 0xF2, 0xA0, 0x02,
-    0xB1, 0x41, 0xBC, 0xFE, 0x2B, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xA1, 0x01, 0xB1, 0xD0, 0xFD, 0x41, 0x81, 0xFE,
-    0xA9, 0x21, 0xD1, 0xFC, 0x42, 0xB1, 0xBD, 0xFE, 0x73, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFD, 0xD5, 0x44,
-    0xB2, 0xBA, 0xBB, 0xBE, 0xFD, 0xED, 0xFF, 0xD9, 0xFF, 0xE6, 0xFF, 0xF9, 0x41, 0xB8, 0xFE, 0x87, 0x21, 0xD0, 0xFC,
-    0x42, 0x80, 0x81, 0xFF, 0xFD, 0xFD, 0xD9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE5, 0xFF, 0xF9, 0xFD, 0xA4,
-    0x41, 0xB3, 0xFD, 0xB3, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41, 0xBA, 0xFE, 0x64, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41,
-    0xB7, 0xFD, 0xE2, 0x21, 0xD0, 0xFC, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xEB, 0xFF, 0xF4, 0xFD, 0x9A, 0xFF, 0xFD,
-    0xA0, 0x02, 0xC1, 0x21, 0x82, 0xFD, 0xA1, 0x01, 0xE1, 0xD1, 0xFD, 0x21, 0x88, 0xFB, 0xA1, 0x00, 0x91, 0xD1, 0xFD,
-    0x41, 0x89, 0xFD, 0xBE, 0x21, 0xD1, 0xFC, 0x45, 0x83, 0x8B, 0x8C, 0x8E, 0x91, 0xFF, 0xF4, 0xFD, 0x9D, 0xFF, 0xFD,
-    0xFD, 0x9D, 0xFF, 0xCD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF0, 0xFD, 0x48, 0xA0, 0x02, 0x71, 0x41, 0x82,
-    0xFE, 0x10, 0x21, 0xD1, 0xFC, 0x41, 0x82, 0xFD, 0x93, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0x82, 0xFD, 0x1C, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0xA0, 0x02,
-    0xD1, 0x42, 0xB7, 0xB8, 0xFD, 0xB8, 0xFF, 0xFD, 0xA1, 0x02, 0x21, 0xD0, 0xF9, 0x46, 0xB0, 0xB1, 0xB5, 0xB8, 0xBD,
-    0xBE, 0xFD, 0xDB, 0xFF, 0xC8, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xEC, 0xFF, 0xFB, 0x42, 0x87, 0x91, 0xFD, 0x52, 0xFF,
-    0xBC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xFC, 0xEC, 0x41, 0x86, 0xFD, 0x33, 0x21, 0xD1, 0xFC, 0xA0,
-    0x02, 0xE3, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xBC, 0xF4, 0xFD, 0x41, 0x84, 0xFD, 0x2C, 0x22, 0xD0,
-    0xD1, 0xF7, 0xFC, 0x41, 0xB0, 0xFC, 0xB9, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xDC,
-    0xA0, 0x03, 0x12, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x85, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x23, 0xB0,
-    0xB4, 0xBE, 0xDA, 0xE9, 0xFB, 0x41, 0x80, 0xFC, 0x91, 0xA1, 0x01, 0xF1, 0xD1, 0xFC, 0x21, 0x83, 0xFB, 0x42, 0xD0,
-    0xD1, 0xFC, 0x88, 0xFF, 0xFD, 0x41, 0xB7, 0xFD, 0xA2, 0x21, 0xD0, 0xFC, 0x41, 0x88, 0xFC, 0xE1, 0xA1, 0x00, 0x91,
-    0xD1, 0xFC, 0x44, 0x80, 0x81, 0x83, 0x8C, 0xFC, 0xA7, 0xFF, 0xE9, 0xFF, 0xF4, 0xFF, 0xFB, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xC9, 0xFF, 0xF3, 0xFC, 0x6C, 0x42, 0xB4, 0xBA, 0xFC, 0x57, 0xFC, 0x57, 0xC1, 0x01, 0xB1, 0xD1, 0xFE, 0xEC,
-    0x42, 0x80, 0x81, 0xFC, 0x4A, 0xFF, 0xFA, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xFC, 0x4E,
-    0x41, 0xBC, 0xFC, 0x37, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xFC, 0x56, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41, 0x81,
-    0xFE, 0xF3, 0x21, 0xD1, 0xFC, 0x21, 0xB2, 0xFD, 0xA0, 0x03, 0x52, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x87,
-    0xFD, 0xA2, 0x02, 0x21, 0xD0, 0xD1, 0xF1, 0xFD, 0x22, 0xBB, 0xBE, 0xE0, 0xF9, 0x41, 0xBB, 0xFC, 0x3D, 0x21, 0xD0,
-    0xFC, 0x42, 0xB0, 0xB5, 0xFB, 0xFD, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE7, 0xFF, 0xFD, 0xFB, 0xFB, 0x41, 0x2D, 0xFB, 0xF1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA,
-    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFB, 0xF0, 0xFC, 0x29, 0xFC, 0x89, 0xFC, 0xD9, 0xFD, 0x4C, 0xFD, 0x73,
-    0xFD, 0xE1, 0xFD, 0xFB, 0xFE, 0x49, 0xFE, 0xA5, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x9F, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF,
-    0xFC, 0x41, 0x82, 0xFC, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0xBA, 0xFB,
-    0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xFB, 0x95, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x83, 0xFD, 0xAD, 0x21, 0xD1, 0xFC, 0x41, 0xB2, 0xFB, 0xE8, 0x21, 0xD0, 0xFC, 0x41,
-    0xBB, 0xFB, 0xE1, 0x21, 0xD0, 0xFC, 0x22, 0xB4, 0xBE, 0xF6, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFB, 0x48, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB5, 0xB6, 0xB8, 0xBE, 0xFF, 0xC2, 0xFF, 0xD1, 0xFF, 0xDE, 0xFF, 0xE5, 0xFF, 0xFB, 0xFE, 0xB4, 0xFB,
-    0xB9, 0xFB, 0xB9, 0x41, 0xD1, 0xFE, 0xBF, 0x21, 0xBE, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xFD, 0x11, 0x47, 0x82,
-    0x83, 0x85, 0x8B, 0x8E, 0x8F, 0x91, 0xFF, 0xF9, 0xFB, 0x92, 0xFB, 0x7B, 0xFB, 0x92, 0xFB, 0x92, 0xFB, 0x92, 0xFB,
-    0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC3, 0xFF, 0xEA, 0xFB, 0x37, 0xA0, 0x03, 0x72, 0x41, 0xB8, 0xFB, 0x72, 0x21,
-    0xD0, 0xFC, 0x43, 0xBA, 0xBC, 0xBD, 0xFF, 0xF6, 0xFF, 0xFD, 0xFB, 0x71, 0x41, 0xB3, 0xFD, 0x33, 0x21, 0xD0, 0xFC,
-    0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x83, 0xFB, 0x68, 0x21, 0xD1, 0xFC, 0x41, 0xBD, 0xFA, 0xFA, 0x41, 0x8F,
-    0xFA, 0xF6, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xD0, 0xFC, 0x30, 0x44, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0xEC, 0xFD,
-    0x15, 0xFF, 0xF7, 0xFF, 0xFC, 0x41, 0x85, 0xFB, 0x15, 0x21, 0xD1, 0xFC, 0x41, 0xB5, 0xFB, 0x25, 0x21, 0xD0, 0xFC,
-    0x43, 0x83, 0x8C, 0x91, 0xFF, 0xF6, 0xFF, 0xFD, 0xFC, 0xFA, 0x22, 0xD0, 0xD1, 0xDB, 0xF6, 0x41, 0xB4, 0xFA, 0xBF,
-    0x41, 0x81, 0xFA, 0xBB, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x44, 0x81, 0x82, 0x88,
-    0x8C, 0xFF, 0xA8, 0xFF, 0xE8, 0xFF, 0xFD, 0xFC, 0x8E, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x87, 0xFF, 0xF3, 0xFA, 0xAA,
-    0x41, 0xBA, 0xFC, 0xBA, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x42, 0xB0, 0xB8, 0xFA, 0xDF, 0xFA, 0xC5, 0x41, 0x83, 0xFA,
-    0xBE, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB7, 0xFB, 0x5C, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xFA, 0xAE, 0x21, 0xD0,
-    0xFC, 0x42, 0xB1, 0xBC, 0xFF, 0xFD, 0xFB, 0xC8, 0x41, 0x88, 0xFA, 0xC3, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF5, 0xFC,
-    0x45, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0xCB, 0xFF, 0xDB, 0xFF, 0xE4, 0xFA, 0xAC, 0xFF, 0xF9, 0x41, 0xBA, 0xFD,
-    0x42, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xB0, 0xB8, 0xBE, 0xFF, 0x67, 0xFA, 0x78, 0xFF,
-    0xFD, 0x21, 0xD0, 0xF6, 0x43, 0x8E, 0x8F, 0x91, 0xFA, 0x58, 0xFA, 0x58, 0xFA, 0x82, 0x42, 0xD0, 0xD1, 0xFF, 0x53,
-    0xFF, 0xF6, 0x47, 0x80, 0x83, 0x85, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xEC, 0xFA, 0x71, 0xFA, 0x21, 0xFA, 0x71, 0xFF,
-    0xF9, 0xFA, 0x71, 0xFA, 0x71, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAF, 0xFF, 0xEA, 0xFA, 0x16, 0xC1, 0x01, 0xB1, 0xD0,
-    0xFA, 0x57, 0x41, 0xD0, 0xFA, 0xFC, 0x43, 0xB1, 0xB4, 0xBB, 0xFA, 0x61, 0xFF, 0xF6, 0xFF, 0xFC, 0x41, 0x80, 0xFA,
-    0x54, 0x21, 0xD1, 0xFC, 0x41, 0x8C, 0xFA, 0x39, 0xA1, 0x01, 0xB1, 0xD1, 0xFC, 0x44, 0x82, 0x85, 0x87, 0x8D, 0xFF,
-    0xF4, 0xF9, 0xDD, 0xFF, 0xFB, 0xFA, 0x44, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF3, 0xF9, 0xDB,
-    0x42, 0xD0, 0x2D, 0xFA, 0xEB, 0xF9, 0xCF, 0x41, 0xB8, 0xFC, 0xB3, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBC, 0xF9, 0xB6,
-    0xFF, 0xFD, 0x41, 0x81, 0xFA, 0x02, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xF9, 0xB6, 0x42, 0xB0, 0xBB,
-    0xFA, 0x81, 0xFA, 0x0B, 0x41, 0x82, 0xF9, 0xD3, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xF9,
-    0xA1, 0x41, 0xBB, 0xF9, 0xF4, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xF9, 0x91, 0x41, 0xBB, 0xFA, 0x93, 0x41, 0x80, 0xF9,
-    0xE5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xF9, 0x82, 0x41, 0x82, 0xF9, 0xF2, 0x42, 0xD1, 0x2D, 0xFF,
-    0xFC, 0xF9, 0x74, 0x43, 0xB1, 0xB2, 0xB7, 0xF9, 0x62, 0xF9, 0x62, 0xF9, 0x62, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF,
-    0xF6, 0xF9, 0x63, 0xC1, 0x00, 0x91, 0x2D, 0xF9, 0x5A, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8D,
-    0x8E, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x1D, 0xFE, 0xAA, 0xFF, 0x3E, 0xFF, 0x79, 0xFF, 0x85, 0xFF,
-    0x9E, 0xFF, 0xB3, 0xFF, 0xC3, 0xFF, 0xD2, 0xFF, 0xE0, 0xFF, 0xF1, 0xFF, 0xFA, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63,
-    0xFD, 0x63, 0xFD, 0x63, 0x42, 0xD0, 0xD1, 0xFD, 0x33, 0xFF, 0xCC, 0x41, 0xB2, 0xF9, 0x0E, 0x21, 0xD0, 0xFC, 0x41,
-    0xD1, 0xFA, 0xCF, 0x41, 0x83, 0xF9, 0x56, 0xA1, 0x01, 0x31, 0xD1, 0xFC, 0x41, 0x8E, 0xFB, 0x93, 0x21, 0xD1, 0xFC,
-    0x46, 0xB1, 0xB3, 0xB4, 0xB7, 0xBB, 0xBE, 0xFF, 0xE9, 0xFF, 0xEC, 0xFD, 0xA3, 0xFF, 0xF4, 0xFF, 0xFD, 0xF8, 0xF3,
-    0x41, 0xBC, 0xF8, 0xF7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xFF, 0x42, 0x42, 0x81, 0x82, 0xFF, 0xF9, 0xFA, 0x97, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xDB, 0xFF, 0xF9, 0xF8, 0xD9, 0xC1, 0x03, 0x32, 0x2D, 0xF8, 0xCD, 0x41, 0x8B,
-    0xF9, 0x18, 0xC2, 0x00, 0x91, 0xD1, 0x2D, 0xFF, 0xFC, 0xF8, 0xC3, 0xC1, 0x01, 0xB1, 0x2D, 0xF8, 0xBA, 0xA0, 0x03,
-    0x91, 0x42, 0xBB, 0xBD, 0xF8, 0xA6, 0xF8, 0xA6, 0x21, 0xD0, 0xF9, 0xA0, 0x03, 0xC2, 0x45, 0xB0, 0xB4, 0xB8, 0xBD,
-    0xBE, 0xF9, 0x4A, 0xFF, 0xFD, 0xF8, 0xEC, 0xF8, 0xB0, 0xF9, 0x4A, 0x41, 0x81, 0xFB, 0x7F, 0x21, 0xD1, 0xFC, 0x42,
-    0x80, 0x83, 0xF8, 0xE9, 0xFF, 0xFD, 0xA2, 0x03, 0xA2, 0xD0, 0xD1, 0xE2, 0xF9, 0x45, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7,
-    0xFF, 0xCB, 0xFF, 0xD5, 0xFF, 0x6D, 0xFF, 0xCB, 0xFF, 0xF9, 0x42, 0xBA, 0xBF, 0xFA, 0x29, 0xF8, 0x7B, 0x42, 0xB5,
-    0xB8, 0xF8, 0x74, 0xF8, 0x74, 0xA1, 0x02, 0x92, 0xD0, 0xF9, 0x21, 0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xEA, 0xFD, 0x43,
-    0x81, 0x86, 0x89, 0xFF, 0xFB, 0xFF, 0xA0, 0xF9, 0x29, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xCB, 0xFF, 0xF6,
-    0xF8, 0x4A, 0xC1, 0x02, 0x21, 0x2D, 0xF8, 0x3E, 0xC1, 0x00, 0x92, 0x2D, 0xF8, 0x38, 0xA0, 0x04, 0x02, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB1, 0xB4, 0xBD, 0xF8, 0x18, 0xF8, 0x18, 0xF8,
-    0x18, 0xC2, 0x03, 0x91, 0xD0, 0xD1, 0xFF, 0xF6, 0xFB, 0x7D, 0x41, 0xBE, 0xFD, 0xC3, 0x21, 0xD0, 0xFC, 0x47, 0xB0,
-    0xB1, 0xB6, 0xBA, 0xBB, 0xBE, 0xBD, 0xFF, 0x55, 0xF7, 0xFE, 0xF8, 0xDE, 0xFF, 0x55, 0xFF, 0xE3, 0xFF, 0xF0, 0xFF,
-    0xFD, 0x42, 0x82, 0x85, 0xFE, 0xDE, 0xF8, 0x21, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3, 0xFF, 0xF9, 0xF7,
-    0xEC, 0xC1, 0x04, 0x22, 0x2D, 0xF7, 0xE0, 0x41, 0xB8, 0xF7, 0xF5, 0xA1, 0x03, 0xE2, 0xD0, 0xFC, 0x43, 0xB3, 0xB7,
-    0xBD, 0xF9, 0xEB, 0xFF, 0xFB, 0xF8, 0x30, 0x21, 0xD0, 0xF6, 0xA0, 0x03, 0xE2, 0x42, 0xB5, 0xBD, 0xFF, 0xFD, 0xF7,
-    0xDC, 0xA0, 0x04, 0x42, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x81, 0x8F, 0xFD, 0xED, 0x22, 0xD0, 0xD1, 0xEB,
-    0xFB, 0x22, 0xB0, 0xB5, 0xE0, 0xFB, 0x42, 0xB4, 0xB6, 0xF8, 0x01, 0xFF, 0xDE, 0x21, 0xD0, 0xF9, 0xA0, 0x04, 0x62,
-    0xA0, 0x04, 0x22, 0x43, 0xB4, 0xB5, 0xBB, 0xF7, 0xF1, 0xF7, 0xF1, 0xF7, 0xF1, 0x21, 0x8C, 0xF3, 0x21, 0xD1, 0xFD,
-    0x42, 0x81, 0x91, 0xFF, 0xFD, 0xF7, 0xE1, 0x23, 0x2E, 0xD0, 0xD1, 0xE6, 0xE9, 0xF9, 0x41, 0xBD, 0xF7, 0x8F, 0x21,
-    0x81, 0xBC, 0x22, 0xD0, 0xD1, 0xF9, 0xFD, 0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xCD, 0xF8, 0x3D, 0xFF,
-    0xD0, 0xFF, 0xED, 0xF8, 0x3D, 0xFF, 0xFB, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xAE, 0xFF, 0xED, 0xF7, 0x55,
-    0x41, 0x80, 0xF7, 0xC3, 0x21, 0xD1, 0xFC, 0x41, 0x88, 0xF7, 0x8A, 0x21, 0xD1, 0xFC, 0x41, 0xD0, 0xFC, 0x71, 0x41,
-    0xB6, 0xFA, 0x83, 0x41, 0x81, 0xF7, 0x61, 0x21, 0xD1, 0xFC, 0x21, 0x8C, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0xA0,
-    0x04, 0x82, 0x21, 0xBB, 0xFD, 0x42, 0x87, 0x88, 0xF7, 0x13, 0xF7, 0x66, 0x22, 0xD0, 0xD1, 0xF6, 0xF9, 0x41, 0x83,
-    0xF9, 0xA0, 0x21, 0xD1, 0xFC, 0x48, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xFF, 0xC6, 0xFF, 0xCD, 0xFF,
-    0xD0, 0xFF, 0xC6, 0xFA, 0x57, 0xFF, 0xE2, 0xFF, 0xF4, 0xFF, 0xFD, 0x41, 0xD1, 0xFC, 0x62, 0xC1, 0x01, 0x31, 0xD0,
-    0xF7, 0x39, 0x42, 0xB0, 0xBA, 0xF6, 0xDD, 0xFF, 0xFA, 0x41, 0x82, 0xFB, 0xBB, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41,
-    0x80, 0xF7, 0x29, 0xC2, 0x03, 0x91, 0xD0, 0xD1, 0xFD, 0xBB, 0xFF, 0xFC, 0x21, 0xD1, 0xF3, 0x24, 0x80, 0x81, 0x82,
-    0x8F, 0xD6, 0xEB, 0xF4, 0xFD, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4, 0xFF, 0xF7, 0xF6, 0xBF, 0x50, 0xB0,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xB9, 0xBC, 0xBF, 0xFD, 0xDA, 0xFD, 0xE6,
-    0xFD, 0xF0, 0xFD, 0xF9, 0xFD, 0xE6, 0xFE, 0x69, 0xFE, 0x75, 0xFE, 0x7B, 0xFE, 0xC7, 0xFE, 0xD3, 0xFF, 0x5E, 0xFE,
-    0xD3, 0xFF, 0xF4, 0xFA, 0xC2, 0xFA, 0xC2, 0xFA, 0xC2, 0x41, 0xBE, 0xF6, 0xDE, 0x21, 0xD0, 0xFC, 0xA0, 0x03, 0x32,
-    0x46, 0xB1, 0xB2, 0xB7, 0xBB, 0xBC, 0xBD, 0xF6, 0x93, 0xF6, 0xD7, 0xFF, 0xFA, 0xFE, 0xB4, 0xFF, 0xFD, 0xF6, 0xD7,
-    0x45, 0x81, 0x82, 0x85, 0x87, 0x8F, 0xF8, 0x7F, 0xF8, 0x2E, 0xF6, 0xAA, 0xFE, 0xA1, 0xFE, 0xD0, 0x22, 0xD0, 0xD1,
-    0xDD, 0xF0, 0x44, 0xB4, 0xB9, 0xBA, 0xBC, 0xFE, 0x8C, 0xF6, 0x95, 0xF6, 0x95, 0xF6, 0xAF, 0x42, 0xD0, 0xD1, 0xFF,
-    0xF3, 0xF8, 0x4D, 0x41, 0xB4, 0xF6, 0x9B, 0x41, 0xBE, 0xF6, 0x97, 0x41, 0x8B, 0xF6, 0x93, 0x22, 0xD0, 0xD1, 0xF8,
-    0xFC, 0x21, 0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x41, 0xB8, 0xFE, 0x5F, 0x21, 0xD0, 0xFC, 0x41, 0x2E, 0xF6,
-    0x61, 0x43, 0xB4, 0xBB, 0xBC, 0xFF, 0xF9, 0xF6, 0x5D, 0xFF, 0xFC, 0xA0, 0x04, 0xA2, 0x42, 0xB8, 0xBA, 0xFE, 0x47,
-    0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xE6, 0xFD, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF,
-    0xA4, 0xFF, 0xB6, 0xFF, 0xD1, 0xFF, 0xFB, 0x41, 0x81, 0xFD, 0x38, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0xA1, 0x00,
-    0x91, 0xD0, 0xFD, 0xC1, 0x03, 0xE2, 0x2E, 0xFE, 0x48, 0x42, 0xBA, 0xBC, 0xF6, 0x1C, 0xF6, 0x36, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xF7, 0xDA, 0x46, 0x81, 0x83, 0x8C, 0x8E, 0x8F, 0x91, 0xF6, 0x9E, 0xFF, 0xE7, 0xF6, 0x9E, 0xFF, 0xEC,
-    0xF6, 0x0E, 0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF6, 0x8B, 0xFF, 0xBD, 0xFF, 0xED, 0xF5, 0xB6, 0xA0, 0x04,
-    0xF1, 0x42, 0xBA, 0xBB, 0xF5, 0xC1, 0xFF, 0xFD, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xF9, 0xF5, 0x9F, 0x42, 0xB3,
-    0xBA, 0xFC, 0x84, 0xFA, 0x15, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFE, 0x5C, 0xF5, 0x8F, 0x41, 0xB3,
-    0xF7, 0x3D, 0x41, 0xBA, 0xF5, 0xDB, 0xC2, 0x01, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xF8, 0x0C, 0x21, 0x81, 0xF7, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xF5, 0x6F, 0x42, 0x81, 0x82, 0xF6, 0x38, 0xF6, 0x38, 0xC3,
-    0x02, 0xB1, 0x2E, 0xD1, 0x2D, 0xF6, 0x31, 0xFF, 0xF9, 0xF5, 0x5C, 0x42, 0xD1, 0x2D, 0xF7, 0x03, 0xF5, 0x50, 0xC2,
-    0x05, 0x02, 0xD1, 0x2D, 0xFB, 0xD1, 0xF5, 0x49, 0xC1, 0x02, 0xB1, 0x2D, 0xF5, 0x40, 0x41, 0xB4, 0xFC, 0x28, 0xC2,
-    0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xF5, 0x36, 0xA0, 0x0C, 0xD1, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF5, 0x2A, 0x51,
-    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x8A, 0xFF, 0x6D,
-    0xFF, 0x84, 0xFB, 0xC9, 0xFF, 0x94, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC, 0xE5, 0xFF,
-    0xB4, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xF9, 0x42, 0xD0, 0xD1, 0xFE, 0x3C, 0xFF,
-    0xCC, 0x42, 0x80, 0x8C, 0xF6, 0xA2, 0xF7, 0xD3, 0x21, 0xD1, 0xF9, 0x41, 0xB4, 0xFD, 0xBA, 0x21, 0xD0, 0xFC, 0x46,
-    0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBD, 0xF9, 0x7C, 0xFC, 0x23, 0xFF, 0xF6, 0xFF, 0xFD, 0xF5, 0x05, 0xFC, 0x47, 0xC1,
-    0x01, 0x31, 0xD1, 0xF8, 0x28, 0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x45, 0x81, 0x82, 0x85, 0x86, 0x8F, 0xFF, 0xFD,
-    0xF6, 0x6F, 0xF5, 0x14, 0xFC, 0x04, 0xFC, 0x04, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xF0, 0xF4,
-    0xA8, 0x41, 0x80, 0xF4, 0xE1, 0x43, 0xD0, 0xD1, 0x2D, 0xF6, 0x6B, 0xFF, 0xFC, 0xF4, 0x98, 0xC1, 0x05, 0x22, 0x2D,
-    0xF4, 0x8E, 0x41, 0xD1, 0xF6, 0x92, 0x21, 0xBE, 0xFC, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFD, 0xF4, 0x81, 0x42,
-    0x80, 0x83, 0xF4, 0xD4, 0xF4, 0xC0, 0x21, 0xD1, 0xF9, 0x42, 0xB5, 0xBB, 0xFB, 0xBA, 0xFB, 0xBA, 0x42, 0x83, 0x91,
-    0xF4, 0xB8, 0xFB, 0xB3, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xF2, 0xF9, 0x41, 0x2E, 0xF6, 0x73, 0x47, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB7, 0xB9, 0xBF, 0xF6, 0x6F, 0xFB, 0xA1, 0xFF, 0xE4, 0xF6, 0x6F, 0xFF, 0xF5, 0xFF, 0xFC, 0xF6, 0x0F, 0x41,
-    0xB4, 0xF5, 0x14, 0x21, 0xD0, 0xFC, 0x41, 0xBA, 0xF5, 0xF2, 0xA0, 0x05, 0x42, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x82, 0xFD, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xF0, 0xFD, 0x41, 0x80, 0xF4, 0x2D, 0x21, 0xD1, 0xFC, 0x47, 0x80,
-    0x81, 0x82, 0x86, 0x8E, 0x8F, 0x91, 0xFF, 0xDF, 0xFF, 0xF2, 0xFF, 0xFD, 0xF6, 0x34, 0xF6, 0x34, 0xF6, 0x34, 0xF6,
-    0x34, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAF, 0xFF, 0xEA, 0xF4, 0x04, 0x41, 0xB1, 0xF4, 0x56, 0x21, 0xD0, 0xFC, 0x43,
-    0xB3, 0xB4, 0xBE, 0xF4, 0x44, 0xF4, 0x44, 0xFF, 0xFD, 0xA0, 0x04, 0x01, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB5, 0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD, 0x21, 0x8A, 0xFB, 0xC3, 0x05, 0x63, 0xD0, 0xD1, 0x2D, 0xFF, 0xE2, 0xFF,
-    0xFD, 0xF3, 0xD5, 0x42, 0xB7, 0xBA, 0xF3, 0xBE, 0xF3, 0xBE, 0xA0, 0x05, 0x93, 0x44, 0x80, 0x81, 0x82, 0x84, 0xF3,
-    0xB4, 0xFF, 0xFD, 0xF4, 0x1B, 0xF4, 0x07, 0x22, 0xD0, 0xD1, 0xE9, 0xF3, 0x42, 0xB2, 0xBB, 0xF3, 0xA2, 0xF3, 0xA2,
-    0x21, 0xD0, 0xF9, 0x41, 0xBD, 0xF3, 0xF4, 0x21, 0xD0, 0xFC, 0x21, 0xB3, 0xFD, 0xA1, 0x02, 0xB1, 0xD0, 0xFD, 0x42,
-    0x82, 0x87, 0xF5, 0xAE, 0xF5, 0xAE, 0x21, 0xD1, 0xF9, 0x45, 0xB0, 0xB3, 0xB7, 0xBD, 0xBE, 0xFF, 0xD8, 0xFF, 0xE4,
-    0xFF, 0xF1, 0xFF, 0xFD, 0xF3, 0xB8, 0x41, 0xB8, 0xF6, 0xC6, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD,
-    0x43, 0x81, 0x83, 0x84, 0xFF, 0xFD, 0xF3, 0x79, 0xF3, 0x62, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF6, 0xF3,
-    0x63, 0xA0, 0x05, 0x02, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D,
-    0xF7, 0xAD, 0xFF, 0xFD, 0xF3, 0x4D, 0x41, 0xB1, 0xFB, 0xAC, 0xA1, 0x00, 0xA1, 0xD0, 0xFC, 0x42, 0xB2, 0xBA, 0xF3,
-    0x97, 0xF3, 0x97, 0x42, 0x82, 0x87, 0xF3, 0x90, 0xF3, 0x90, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x41, 0x8F, 0xF3, 0x84,
-    0xA1, 0x02, 0x21, 0xD1, 0xFC, 0x23, 0xB0, 0xB5, 0xB8, 0xDF, 0xF2, 0xFB, 0x41, 0xB1, 0xF3, 0x74, 0xA1, 0x02, 0x21,
-    0xD0, 0xFC, 0x41, 0xBA, 0xF3, 0x6B, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF5, 0xD4, 0x43, 0x8E, 0x8F, 0x91, 0xFF, 0xF0,
-    0xF3, 0xD6, 0xFF, 0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDB, 0xFF, 0xF6, 0xF2, 0xF7, 0x41, 0xB5, 0xF5,
-    0x05, 0x41, 0x91, 0xF5, 0x01, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xF2, 0xE3, 0xA0, 0x01,
-    0x92, 0x41, 0x81, 0xF3, 0x33, 0x21, 0xD1, 0xFC, 0x43, 0xB0, 0xB5, 0xBE, 0xFF, 0xF6, 0xFF, 0xFD, 0xF3, 0x29, 0x41,
-    0xBA, 0xFF, 0x6A, 0x41, 0x87, 0xFF, 0x66, 0x43, 0x2E, 0xD0, 0xD1, 0xF2, 0xD6, 0xFF, 0xF8, 0xFF, 0xFC, 0x43, 0x83,
-    0x8B, 0x91, 0xFF, 0xF6, 0xF2, 0xCC, 0xFF, 0xE1, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF, 0xF6, 0xF2,
-    0xA7, 0xA0, 0x05, 0xC2, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0xA1, 0x03, 0x12, 0xD0, 0xFD, 0x41,
-    0xBA, 0xF2, 0xD2, 0xA1, 0x01, 0xE1, 0xD0, 0xFC, 0x41, 0xB2, 0xF2, 0xAF, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC,
-    0xF4, 0x30, 0x41, 0xB6, 0xF2, 0x69, 0x21, 0xD0, 0xFC, 0x41, 0x81, 0xFC, 0x5F, 0x21, 0xD1, 0xFC, 0x49, 0xB1, 0xB2,
-    0xB4, 0xB5, 0xB6, 0xB8, 0xBA, 0xBC, 0xBF, 0xFF, 0xD7, 0xFF, 0xE0, 0xFF, 0xE9, 0xF7, 0x0B, 0xFF, 0xF6, 0xFF, 0xFD,
-    0xF4, 0x80, 0xFB, 0x42, 0xF2, 0xB7, 0x43, 0x83, 0x86, 0x8C, 0xF2, 0x78, 0xF3, 0x1F, 0xF3, 0x1F, 0x21, 0xD1, 0xF6,
-    0x41, 0xB5, 0xF2, 0x49, 0x21, 0xD0, 0xFC, 0x44, 0xBA, 0xBC, 0xBD, 0xBF, 0xF2, 0x92, 0xF2, 0x64, 0xF2, 0x64, 0xFF,
-    0xFD, 0x41, 0x82, 0xF6, 0xCE, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x41, 0x82, 0xFA, 0xFC, 0xC2, 0x02, 0xB1, 0xD0, 0xD1,
-    0xF6, 0x0D, 0xFF, 0xFC, 0x45, 0x80, 0x81, 0x82, 0x85, 0x8E, 0xFF, 0xD3, 0xFF, 0xEE, 0xFB, 0x48, 0xFF, 0xF7, 0xF4,
-    0x2D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x9D, 0xFF, 0xF0, 0xF2, 0x03, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFD, 0x51, 0xF9, 0x2C, 0xFD, 0x61, 0xFD, 0x6B, 0xFD, 0x78,
-    0xFD, 0xF5, 0xFE, 0x24, 0xFE, 0x96, 0xFE, 0xAC, 0xFF, 0x02, 0xFF, 0x16, 0xFF, 0x52, 0xFF, 0xF6, 0xFD, 0x6B, 0xF6,
-    0x08, 0xF6, 0x08, 0x42, 0xB2, 0xBC, 0xF2, 0x27, 0xFB, 0x4D, 0x43, 0x81, 0x85, 0x86, 0xF2, 0x06, 0xFB, 0x46, 0xF2,
-    0x96, 0x43, 0x2E, 0xD0, 0xD1, 0xF2, 0x8C, 0xFF, 0xEF, 0xFF, 0xF6, 0x41, 0xBD, 0xFB, 0x32, 0x42, 0x2E, 0xD0, 0xF2,
-    0x7E, 0xFF, 0xFC, 0x45, 0xB4, 0xB7, 0xB8, 0xBA, 0xBB, 0xF3, 0xBC, 0xF9, 0xDE, 0xF1, 0xE7, 0xF1, 0xE7, 0xF1, 0xE7,
-    0x42, 0x81, 0x82, 0xF1, 0xD7, 0xF1, 0xD7, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0xC1, 0x03, 0x32, 0xD1, 0xF5, 0x62, 0x24,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xC9, 0xD7, 0xF5, 0xFA, 0x21, 0xD0, 0xCA, 0x44, 0x8B, 0x8E, 0x8F, 0x91, 0xFA, 0xF9, 0xF3,
-    0x8E, 0xF1, 0xB9, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF2, 0x3C, 0xFF, 0xE7, 0xFF, 0xF3, 0xF1, 0x67, 0xA0,
-    0x05, 0xE2, 0x41, 0x8F, 0xF1, 0x72, 0x21, 0xD1, 0xFC, 0x42, 0xB0, 0xB8, 0xFF, 0xFD, 0xFE, 0x79, 0x41, 0x83, 0xFE,
-    0x72, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x43, 0xB5, 0xBA, 0xBF, 0xFF, 0xE6, 0xFF, 0xFB, 0xFD, 0xE7, 0x42, 0x8E, 0x91,
-    0xFD, 0xDD, 0xFF, 0xDC, 0xC3, 0x04, 0xC3, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xF1, 0x2F, 0x41, 0xB1, 0xF1,
-    0xC9, 0x41, 0x88, 0xF1, 0x2B, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBE, 0xFB, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xF1, 0x13, 0xA0, 0x06, 0x02, 0x46, 0xB0, 0xB3, 0xB7, 0xB8, 0xBA, 0xBF, 0xF3, 0x21, 0xF1, 0x4F, 0xFF, 0xFD,
-    0xF1, 0xDC, 0xF5, 0xDA, 0xF1, 0x4F, 0x42, 0xB0, 0xB2, 0xF2, 0xAE, 0xF1, 0x00, 0x21, 0xD0, 0xF9, 0x43, 0x81, 0x85,
-    0x87, 0xF4, 0x36, 0xFF, 0xFD, 0xF4, 0xDF, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF6, 0xF0, 0xE0, 0x41, 0xBE,
-    0xF2, 0xF0, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xF0, 0xD2, 0x41, 0xB2, 0xFD, 0x72, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD,
-    0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xFD, 0xF0, 0xC1, 0xC2, 0x01, 0xB1, 0x2E, 0x2D, 0xFB, 0x8B, 0xF0, 0xB8, 0x41,
-    0xBD, 0xF0, 0xF7, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xF0, 0xF9, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x44, 0xB3, 0xB7, 0xBF, 0xB1, 0xF9, 0x77, 0xFF, 0xF0, 0xF0, 0xEC, 0xFF, 0xFD, 0x41, 0xD0, 0xF9, 0x6D, 0x43, 0x82,
-    0x85, 0x88, 0xF9, 0x66, 0xF0, 0xDB, 0xFF, 0xFC, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE5, 0xFF, 0xF6, 0xF0,
-    0x80, 0x41, 0xBD, 0xF2, 0x8E, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xB8, 0xF2, 0x87, 0xFF, 0xFD, 0x45, 0x81, 0x82, 0x8E,
-    0x8F, 0x91, 0xF1, 0x3B, 0xF1, 0x3B, 0xF2, 0x80, 0xF2, 0x80, 0xF2, 0x80, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF1, 0x2B,
-    0xFF, 0xE9, 0xFF, 0xF0, 0xF0, 0x56, 0xC1, 0x06, 0x23, 0x2D, 0xF0, 0x49, 0xC1, 0x03, 0xE2, 0x2D, 0xF0, 0x43, 0x42,
-    0xB4, 0xB7, 0xF6, 0x49, 0xF2, 0x57, 0x42, 0x80, 0x81, 0xFB, 0xFB, 0xF2, 0x50, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2,
-    0xFF, 0xF9, 0xF0, 0x2F, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
-    0x8E, 0x8F, 0x91, 0xFE, 0xBE, 0xFE, 0xF6, 0xFF, 0x12, 0xFF, 0x45, 0xF7, 0x6B, 0xFF, 0x53, 0xF7, 0xE7, 0xF7, 0x58,
-    0xFF, 0x64, 0xF7, 0xE7, 0xFF, 0x6D, 0xFF, 0xA5, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xE2, 0xFA, 0xE5, 0xFF, 0xF6, 0x42,
-    0xD0, 0xD1, 0xFD, 0xF8, 0xFF, 0xCC, 0x41, 0xB7, 0xF0, 0x18, 0xA0, 0x06, 0x52, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x42, 0x81, 0x83, 0xFF, 0xFD, 0xEF, 0xD2, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xEF, 0xD6,
-    0xC2, 0x04, 0x22, 0xD0, 0x2D, 0xF0, 0x1E, 0xEF, 0xCA, 0x42, 0xD0, 0x2D, 0xF1, 0x94, 0xEF, 0xC1, 0x41, 0xD0, 0xF8,
-    0x46, 0x42, 0xB0, 0xB8, 0xFF, 0xFC, 0xF8, 0x21, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xEF, 0xAF, 0x41, 0xBE, 0xF2, 0x36,
-    0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB4, 0xEF, 0x96, 0xEF, 0x96, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF1, 0x4D, 0x43, 0xB1,
-    0xBD, 0xBE, 0xF1, 0x4D, 0xFF, 0xEF, 0xFF, 0xF9, 0x43, 0x2E, 0xD0, 0x2D, 0xF6, 0xD5, 0xFF, 0xF6, 0xEF, 0x89, 0x41,
-    0x80, 0xEF, 0xC7, 0x42, 0xD0, 0xD1, 0xF3, 0xDB, 0xFF, 0xFC, 0x42, 0xB1, 0xB3, 0xFF, 0xF9, 0xF4, 0x19, 0x41, 0x82,
-    0xF2, 0x58, 0x42, 0xD0, 0xD1, 0xF3, 0x5A, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xEB, 0xFF, 0xFD, 0xEF, 0x5F, 0x43, 0xB2, 0xB9, 0xBC, 0xEF, 0xB2, 0xEF, 0x98, 0xF1, 0x2A, 0x41, 0x8C, 0xF0, 0x1E,
-    0x21, 0xD1, 0xFC, 0x42, 0x81, 0x8F, 0xFF, 0xFD, 0xF0, 0x17, 0x43, 0x2E, 0xD0, 0xD1, 0xF0, 0x10, 0xFF, 0xE8, 0xFF,
-    0xF9, 0xC1, 0x00, 0x91, 0xD1, 0xF1, 0xFD, 0x41, 0x84, 0xFB, 0xD2, 0x43, 0x2E, 0xD0, 0xD1, 0xEF, 0xFC, 0xF0, 0x72,
-    0xFF, 0xFC, 0x41, 0xBB, 0xEF, 0x38, 0x21, 0xD0, 0xFC, 0x45, 0xB1, 0xB2, 0xB3, 0xB5, 0xB9, 0xFF, 0xFD, 0xEF, 0xEB,
-    0xEF, 0xEB, 0xEF, 0xEB, 0xEF, 0xEB, 0x41, 0x8E, 0xEF, 0xDB, 0x43, 0x2E, 0xD0, 0xD1, 0xEF, 0xD7, 0xFF, 0xEC, 0xFF,
-    0xFC, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xBD, 0xC7, 0xD1, 0xF6, 0x21, 0xD1, 0xE9, 0x42, 0xB6, 0xBA, 0xEF, 0x4B, 0xEF,
-    0xC1, 0x21, 0xD0, 0xF9, 0x44, 0x83, 0x8B, 0x8F, 0x91, 0xFF, 0xF3, 0xF8, 0x67, 0xFF, 0xFD, 0xFF, 0xB1, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xDD, 0xFF, 0xF3, 0xEE, 0xD5, 0x42, 0xB2, 0xBD, 0xEF, 0x2A, 0xEF, 0x2A, 0x21, 0xD0, 0xF9, 0x43,
-    0xB2, 0xBD, 0xBF, 0xEF, 0x20, 0xEE, 0xDC, 0xEE, 0xDC, 0x41, 0x81, 0xEE, 0xD2, 0x43, 0x2E, 0xD0, 0xD1, 0xEE, 0xCE,
-    0xFF, 0xF2, 0xFF, 0xFC, 0x41, 0x80, 0xF1, 0x94, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x82, 0xEF, 0x01, 0xFF, 0xFD, 0x21,
-    0xD1, 0xF9, 0x42, 0xB5, 0xB8, 0xEE, 0xF7, 0xEE, 0xF7, 0x42, 0x81, 0x91, 0xEE, 0xF0, 0xEE, 0xF0, 0x22, 0xD0, 0xD1,
-    0xF2, 0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xC1, 0xD2, 0xEA, 0xFB, 0x42, 0xB2, 0xBD, 0xEE, 0xDB, 0xEE, 0x97, 0x21,
-    0xD0, 0xF9, 0x42, 0x8F, 0x91, 0xEE, 0x8D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xEE, 0x6B,
-    0x42, 0xBB, 0xBD, 0xEE, 0x56, 0xEE, 0xB2, 0xA1, 0x01, 0x31, 0xD0, 0xF9, 0x41, 0xB3, 0xF1, 0x40, 0x21, 0xD0, 0xFC,
-    0x48, 0xB1, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xF1, 0x9A, 0xF2, 0xB2, 0xF9, 0x74, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xF5, 0x9A, 0xEE, 0xAD, 0xF4, 0x8A, 0x45, 0xB0, 0xB4, 0xBA, 0xBD, 0xBF, 0xEF, 0xEF, 0xEE, 0x2A, 0xF2, 0x2A, 0xEE,
-    0x63, 0xEE, 0xAF, 0x21, 0xD0, 0xF0, 0x45, 0x81, 0x82, 0x83, 0x87, 0x8E, 0xFF, 0xFD, 0xF9, 0xE7, 0xEE, 0x34, 0xF2,
-    0x17, 0xF5, 0x6E, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC4, 0xFF, 0xF0, 0xEE, 0x12, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x32, 0xFE, 0x3E, 0xFE, 0x47, 0xF5, 0xCA,
-    0xFE, 0x59, 0xFE, 0x7F, 0xF6, 0x28, 0xF5, 0x3B, 0xFE, 0xA9, 0xF5, 0x3B, 0xFF, 0x33, 0xF6, 0x28, 0xFF, 0x9D, 0xFF,
-    0xF6, 0xF5, 0xCA, 0xF2, 0x17, 0x42, 0xB5, 0xB9, 0xEE, 0x1C, 0xEE, 0x1C, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF9, 0x34,
-    0x42, 0xB3, 0xBA, 0xEE, 0x0E, 0xEE, 0x0E, 0x41, 0x86, 0xEE, 0x07, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xBD, 0xEF,
-    0x4B, 0x21, 0xD0, 0xFC, 0x44, 0xB2, 0xBA, 0xBB, 0xBD, 0xFF, 0xFD, 0xED, 0xF7, 0xED, 0xF7, 0xED, 0xF7, 0x42, 0x81,
-    0x87, 0xED, 0xEA, 0xED, 0xEA, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x45, 0xB2, 0xB7, 0xBA, 0xBD, 0xBF, 0xED, 0xDE, 0xED,
-    0xF8, 0xED, 0xDE, 0xED, 0xDE, 0xED, 0xDE, 0x42, 0x82, 0x84, 0xED, 0xCE, 0xED, 0xCE, 0x22, 0xD0, 0xD1, 0xE9, 0xF9,
-    0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xAD, 0xBF, 0xDF, 0xFB, 0x41, 0xBF, 0xED, 0xC5, 0x21, 0xD0, 0xFC, 0x41, 0xB2, 0xED,
-    0xB2, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xBB, 0xED, 0xAB, 0xED, 0xAB, 0x41, 0x82, 0xED, 0xA4, 0x22, 0xD0, 0xD1, 0xF5,
-    0xFC, 0x44, 0x83, 0x8B, 0x8E, 0x8F, 0xFF, 0xE6, 0xFF, 0xED, 0xEE, 0x2B, 0xFF, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xEE, 0x1E, 0xFF, 0xCC, 0xFF, 0xF3, 0xED, 0x49, 0xA0, 0x03, 0xD1, 0x22, 0xB0, 0xB1, 0xFD, 0xFD, 0x41, 0x80, 0xEF,
-    0xF6, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x04, 0x23, 0xD0, 0xD1, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xED, 0x2A,
-    0xC1, 0x01, 0x31, 0xD0, 0xF8, 0xE6, 0x21, 0x81, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFA, 0x94, 0xFF, 0xFD, 0xED, 0x15,
-    0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x87, 0x88, 0x8D, 0x8A, 0x91, 0x85, 0x86, 0x89, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF,
-    0xC2, 0xFF, 0xE1, 0xF5, 0x2B, 0xFF, 0xF6, 0xF4, 0xCD, 0xF4, 0x3E, 0xF5, 0x2B, 0xF5, 0x2B, 0xF7, 0xE1, 0xF1, 0x1A,
-    0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1,
-    0xFE, 0xCF, 0xFF, 0xCC, 0x41, 0xD0, 0xF1, 0xC9, 0x21, 0xB5, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xF0, 0x2B, 0x44,
-    0xB1, 0xB3, 0xB7, 0xBE, 0xEE, 0x7A, 0xFF, 0xF9, 0xEC, 0xEE, 0xEC, 0xB5, 0x41, 0x80, 0xEF, 0x41, 0x21, 0xD1, 0xFC,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xFD, 0xF2, 0xB2, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xDF, 0xFF, 0xF9, 0xEC, 0x9F, 0x42, 0x82, 0x87, 0xED, 0x68, 0xED, 0x68, 0x21, 0xD1, 0xF9, 0x43, 0xB4, 0xB7,
-    0xBD, 0xF6, 0x0E, 0xED, 0x5E, 0xFF, 0xFD, 0x42, 0x81, 0x82, 0xF6, 0x04, 0xF6, 0x04, 0xA2, 0x02, 0xB1, 0xD0, 0xD1,
-    0xEF, 0xF9, 0x42, 0xB4, 0xB7, 0xED, 0x46, 0xEC, 0xB6, 0x41, 0x8C, 0xEE, 0x84, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD,
-    0x22, 0xD0, 0xD1, 0xEF, 0xFD, 0x45, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE, 0xEC, 0xA0, 0xFF, 0xE3, 0xEC, 0x76, 0xEC, 0xA0,
-    0xFF, 0xFB, 0x42, 0x8F, 0x91, 0xED, 0x20, 0xEC, 0x90, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF9,
-    0xEC, 0x44, 0xC1, 0x04, 0xC3, 0x2D, 0xEC, 0x38, 0x41, 0xBB, 0xEF, 0x7E, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xEF, 0x7D,
-    0x41, 0x80, 0xF3, 0x73, 0x21, 0xD1, 0xFC, 0x43, 0xB0, 0xB8, 0xBE, 0xF8, 0x5E, 0xEC, 0x15, 0xEC, 0xC6, 0x41, 0x83,
-    0xEC, 0x0B, 0xA2, 0x03, 0x91, 0xD0, 0xD1, 0xF2, 0xFC, 0x41, 0xBE, 0xEE, 0xF6, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xF3,
-    0x50, 0x21, 0xD0, 0xFC, 0x42, 0xB4, 0xBF, 0xEB, 0xF2, 0xEC, 0x09, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xED, 0xF1, 0x48,
-    0xB1, 0xB2, 0xB7, 0xB8, 0xBA, 0xBC, 0xBE, 0xBF, 0xFF, 0xC1, 0xFF, 0xCC, 0xFF, 0xDD, 0xFF, 0xE8, 0xEF, 0xE4, 0xFF,
-    0xEF, 0xFF, 0xF9, 0xFF, 0xFC, 0xA0, 0x06, 0x71, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x42, 0xB2, 0xBA, 0xF9, 0x2C, 0xEC, 0x18, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xEF, 0x24, 0x43, 0x80, 0x81, 0x85,
-    0xFF, 0xEF, 0xFF, 0xF9, 0xEF, 0xAE, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xF6, 0xEB, 0xAF, 0x41,
-    0xBC, 0xEC, 0x02, 0x21, 0xD0, 0xFC, 0xA0, 0x06, 0x82, 0x22, 0xB0, 0xBC, 0xFA, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xEC, 0x69, 0xFF, 0xFB, 0xED, 0xC0, 0xEB, 0x94, 0x42, 0xB8, 0xBE, 0xEB, 0x7C, 0xEB, 0x7C, 0x21, 0xD0, 0xF9, 0x43,
-    0xB4, 0xB7, 0xBB, 0xEB, 0x72, 0xEB, 0xCE, 0xFF, 0xFD, 0x42, 0x80, 0x81, 0xEB, 0x68, 0xEB, 0x68, 0x22, 0xD0, 0xD1,
-    0xEF, 0xF9, 0x42, 0xB1, 0xB4, 0xEB, 0x5C, 0xF9, 0x2E, 0x43, 0x80, 0x81, 0x82, 0xEB, 0x55, 0xEB, 0xBC, 0xEB, 0x94,
-    0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x41, 0x82, 0xEB, 0x99, 0xC2, 0x01, 0xE1, 0xD0, 0xD1, 0xEC, 0x52, 0xFF, 0xFC, 0x23,
-    0xB0, 0xBE, 0xBF, 0xD8, 0xEE, 0xF7, 0x41, 0x82, 0xF2, 0x2B, 0x41, 0xB2, 0xEE, 0x85, 0x21, 0xD0, 0xFC, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x22, 0xD1, 0xD0, 0xEC, 0xFD, 0x42, 0x80, 0x82, 0xEB, 0x6C, 0xEB, 0x72,
-    0x21, 0xD1, 0xF9, 0x44, 0x81, 0x83, 0x84, 0x85, 0xFF, 0xF1, 0xEB, 0x26, 0xFF, 0xFD, 0xEB, 0x48, 0xC3, 0x02, 0xB1,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xC9, 0xFF, 0xF3, 0xEB, 0x0D, 0x41, 0xB2, 0xEB, 0x60, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD,
-    0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFD, 0xEA, 0xF7, 0xC1, 0x04, 0x23, 0x2D, 0xEA, 0xEE, 0x41, 0xBD, 0xF2, 0x34,
-    0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB2, 0xED, 0xCC, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41, 0xB4, 0xEE, 0xB0, 0xC2, 0x06,
-    0xA3, 0xD0, 0xD1, 0xFF, 0xFC, 0xF2, 0x3F, 0x43, 0xB0, 0xB5, 0xBE, 0xEA, 0xE5, 0xFF, 0xF0, 0xFF, 0xF7, 0x41, 0x88,
-    0xF7, 0x67, 0x21, 0xD1, 0xFC, 0x42, 0x8B, 0x8F, 0xF7, 0xE2, 0xFF, 0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE8, 0xFF, 0xF9, 0xEA, 0xB2, 0xA0, 0x04, 0xC3, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xF4, 0x22, 0xA1,
-    0x01, 0xB1, 0xD0, 0xFC, 0x22, 0xB5, 0xBB, 0xF4, 0xFB, 0x41, 0xB0, 0xED, 0xDB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x42, 0xBB, 0xBC, 0xEA, 0xD1, 0xF3, 0x5C, 0x21, 0xD0, 0xF9, 0xC1, 0x03, 0x12, 0xD0,
-    0xF9, 0xC7, 0xC1, 0x01, 0x31, 0xD0, 0xF6, 0xCD, 0x41, 0xBC, 0xEB, 0x3F, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0xB5, 0xEB, 0x32, 0x41, 0x91, 0xEB, 0x2E, 0xA2, 0x01, 0xD1, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBB,
-    0xF9, 0x41, 0x91, 0xEA, 0x40, 0x42, 0xD0, 0xD1, 0xEA, 0xC4, 0xFF, 0xFC, 0x21, 0x80, 0xF9, 0xA2, 0x01, 0xE1, 0xD0,
-    0xD1, 0xEF, 0xFD, 0x4A, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBF, 0xFF, 0xB1, 0xFF, 0xBD, 0xFF,
-    0xC0, 0xF5, 0x5C, 0xFF, 0xC6, 0xF3, 0x6B, 0xEC, 0xFF, 0xFF, 0xD6, 0xF1, 0x24, 0xFF, 0xF9, 0x41, 0xB1, 0xEA, 0x0C,
-    0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00, 0x92, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xBE, 0xF3, 0x86, 0x41, 0x8F, 0xEA, 0x4E, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x44, 0xB5, 0xB8, 0xBD, 0xBF, 0xFF, 0xF0,
-    0xFF, 0xF0, 0xFF, 0xFB, 0xEA, 0x45, 0xA1, 0x01, 0x31, 0xD0, 0xF3, 0x42, 0xB4, 0xBB, 0xEA, 0xB7, 0xEA, 0xB7, 0x41,
-    0xB8, 0xEA, 0x2C, 0x41, 0x8F, 0xF3, 0x5C, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x43, 0x80, 0x8A, 0x8C, 0xFF, 0xFB, 0xEA,
-    0xA3, 0xEA, 0x16, 0x22, 0xD0, 0xD1, 0xE2, 0xF6, 0x41, 0xBB, 0xF1, 0x0B, 0x21, 0xD0, 0xFC, 0x41, 0x8B, 0xE9, 0xAD,
-    0x21, 0xD1, 0xFC, 0x43, 0xB2, 0xBA, 0xBB, 0xF7, 0x16, 0xF2, 0x8D, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x41, 0xD1, 0xFD,
-    0x8E, 0x46, 0x80, 0x81, 0x82, 0x85, 0x88, 0x89, 0xFF, 0x93, 0xFF, 0xB9, 0xFF, 0xDC, 0xFF, 0xE5, 0xFF, 0xF9, 0xFF,
-    0xFC, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0x57, 0xFF, 0xED, 0xE9, 0x8D, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xE2, 0xF0, 0xB4, 0xFD, 0x3D, 0xF4, 0xF3,
-    0xFD, 0x49, 0xFD, 0xD2, 0xFD, 0xED, 0xFD, 0x49, 0xFE, 0x74, 0xF0, 0xB4, 0xFE, 0x8A, 0xFE, 0x93, 0xFE, 0xCF, 0xFF,
-    0xF4, 0xF1, 0x43, 0xED, 0x90, 0x41, 0x88, 0xEB, 0x6A, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xBD, 0xEA, 0x1E, 0xF1, 0x85,
-    0x21, 0xD0, 0xF9, 0x44, 0xB1, 0xB2, 0xB7, 0xBD, 0xE9, 0x84, 0xFF, 0xF3, 0xFF, 0xFD, 0xEE, 0x63, 0xA0, 0x06, 0xD3,
-    0x45, 0x80, 0x81, 0x85, 0x87, 0x8E, 0xE9, 0x74, 0xFF, 0xFD, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x8E, 0x22, 0xD0, 0xD1,
-    0xE0, 0xF0, 0x43, 0xB0, 0xBB, 0xBD, 0xEB, 0x34, 0xEB, 0x34, 0xF5, 0x31, 0x41, 0x8B, 0xEB, 0x2A, 0xA2, 0x00, 0xA1,
-    0xD0, 0xD1, 0xF2, 0xFC, 0x46, 0xB1, 0xB6, 0xB7, 0xBB, 0xBC, 0xBD, 0xE9, 0x64, 0xF1, 0x70, 0xE9, 0xDA, 0xE9, 0x64,
-    0xFF, 0xF9, 0xF1, 0x70, 0x41, 0xBA, 0xE9, 0x43, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF6, 0x1A, 0x21, 0x81, 0xF9, 0xA2,
-    0x00, 0x91, 0xD0, 0xD1, 0xDF, 0xFD, 0x43, 0xB9, 0xBD, 0xBF, 0xE9, 0x3C, 0xE9, 0xB2, 0xE9, 0x3C, 0xC2, 0x00, 0x91,
-    0xD0, 0xD1, 0xFF, 0xF6, 0xEA, 0xDD, 0xA0, 0x07, 0x02, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xF7, 0xA1,
-    0x03, 0xE2, 0xD0, 0xFD, 0x48, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9, 0xBB, 0xBD, 0xFF, 0xF5, 0xE8, 0xFE, 0xE8, 0xFE,
-    0xFF, 0xFB, 0xF1, 0x24, 0xE8, 0xFE, 0xE8, 0xFE, 0xE8, 0xFE, 0x43, 0x81, 0x82, 0x8E, 0xE8, 0xE5, 0xE8, 0xE5, 0xE8,
-    0xE5, 0x22, 0xD0, 0xD1, 0xDD, 0xF6, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0x72, 0xFF, 0xAD, 0xFF, 0xBE, 0xFF, 0xFB,
-    0x41, 0xB9, 0xE9, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xA1, 0x02, 0xB1, 0xD0, 0xFD, 0x44, 0xB1, 0xB3, 0xB6,
-    0xBC, 0xE8, 0xBA, 0xEA, 0x8F, 0xFF, 0xFB, 0xE8, 0xBA, 0x41, 0x8E, 0xE8, 0xAD, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x42,
-    0xB2, 0xB3, 0xE9, 0x34, 0xF0, 0x9B, 0xA1, 0x00, 0x91, 0xD0, 0xF9, 0x42, 0xB1, 0xB3, 0xE8, 0xB2, 0xF0, 0x8F, 0xC2,
-    0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xF9, 0xEA, 0x56, 0x41, 0xB0, 0xEA, 0x5D, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xFC,
-    0xFF, 0x2F, 0x44, 0xB1, 0xB6, 0xBC, 0xBD, 0xE8, 0x95, 0xF0, 0xA1, 0xFF, 0xF7, 0xF0, 0xA1, 0xA1, 0x00, 0x91, 0xD0,
-    0xF3, 0x24, 0x83, 0x8B, 0x8F, 0x91, 0xC0, 0xCC, 0xD8, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xE8, 0xF0, 0xFF, 0x8A,
-    0xFF, 0xF7, 0xE8, 0x1B, 0xC1, 0x01, 0xE1, 0xD0, 0xF7, 0x5F, 0x21, 0xBA, 0xFA, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xE8, 0x05, 0xC1, 0x03, 0x32, 0xD0, 0xEB, 0x38, 0x45, 0xB1, 0xB3, 0xB4, 0xBE, 0xBF, 0xF3, 0xD9, 0xE8, 0x3E,
-    0xFF, 0xFA, 0xE7, 0xEB, 0xEC, 0x75, 0x42, 0xBA, 0xBB, 0xE8, 0x42, 0xE8, 0x2B, 0xC1, 0x01, 0x31, 0xD0, 0xEB, 0x1B,
-    0x21, 0x82, 0xFA, 0x22, 0xD0, 0xD1, 0xF0, 0xFD, 0xA0, 0x02, 0x22, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x82,
-    0xE8, 0x24, 0x21, 0xD1, 0xFC, 0x45, 0x81, 0x82, 0x85, 0x87, 0x8D, 0xFF, 0xEB, 0xFF, 0xF6, 0xE7, 0xEF, 0xE8, 0xCA,
-    0xFF, 0xFD, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xBB, 0xFF, 0xF0, 0xE7, 0xB1, 0x41, 0xB5, 0xF0, 0x10, 0x42,
-    0x83, 0x8B, 0xE8, 0x76, 0xE8, 0x76, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xF9, 0xE7, 0x9A, 0x41, 0xBC, 0xE7,
-    0xE1, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0xC4, 0x02, 0x21, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xFA,
-    0xFF, 0xFD, 0xF2, 0x56, 0xE7, 0x83, 0xC1, 0x02, 0x21, 0xD1, 0xE9, 0x31, 0x41, 0xD0, 0xFD, 0x11, 0x43, 0xB3, 0xB4,
-    0xBC, 0xFF, 0xF6, 0xE8, 0x3F, 0xFF, 0xFC, 0xA0, 0x07, 0x23, 0x43, 0x81, 0x82, 0x89, 0xFF, 0xFD, 0xE8, 0x32, 0xE8,
-    0x32, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xE7, 0x53, 0x42, 0xB5, 0xBA, 0xE9, 0x61, 0xE8,
-    0x1C, 0xC1, 0x02, 0xB1, 0xD1, 0xF7, 0xC1, 0x44, 0x82, 0x8E, 0x8F, 0x91, 0xE8, 0x0F, 0xE9, 0x54, 0xFF, 0xFA, 0xE9,
-    0x54, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xE8, 0x02, 0xFF, 0xE6, 0xFF, 0xF3, 0xE7, 0x2D, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x8D, 0xFF, 0x05, 0xFF, 0x1B, 0xEE, 0x53,
-    0xFF, 0x6F, 0xEE, 0xE2, 0xED, 0xC6, 0xFF, 0x86, 0xEE, 0x53, 0xFC, 0x32, 0xEE, 0xE2, 0xFF, 0x9D, 0xFF, 0xCD, 0xFF,
-    0xF3, 0xF6, 0xDD, 0xF1, 0xE0, 0xF1, 0xE0, 0xEB, 0x2F, 0x42, 0xD0, 0xD1, 0xFD, 0x6B, 0xFF, 0xCC, 0x42, 0xB8, 0xBE,
-    0xF2, 0xFC, 0xE7, 0x2D, 0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x41, 0x80, 0xF0, 0xCB, 0x21, 0xD1, 0xFC, 0x21, 0xB4, 0xFD,
-    0x21, 0xD0, 0xFD, 0x43, 0xB4, 0xB7, 0xBD, 0xFF, 0xEE, 0xE6, 0xC1, 0xFF, 0xFD, 0x41, 0x82, 0xEC, 0xCE, 0xC3, 0x00,
-    0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xE6, 0xBE, 0x41, 0x81, 0xE7, 0x03, 0x21, 0xD1, 0xFC, 0x21, 0xB0,
-    0xFD, 0x41, 0xBD, 0xE6, 0xD6, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0x91, 0xD0, 0xF4, 0x20, 0x44, 0xB0, 0xB5, 0xB8, 0xBE,
-    0xE6, 0xE0, 0xFF, 0xF7, 0xE6, 0xC9, 0xFF, 0xFA, 0x43, 0x8B, 0x8E, 0x91, 0xE6, 0xBC, 0xFA, 0xF2, 0xFF, 0xEA, 0x22,
-    0xD0, 0xD1, 0xE9, 0xF6, 0x21, 0x80, 0xFB, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xFD, 0xE6, 0x7C,
-    0x41, 0x80, 0xE7, 0x45, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x41, 0xB8, 0xEA, 0x29, 0x41, 0x8F, 0xE9, 0x40, 0x22, 0xD0,
-    0xD1, 0xF8, 0xFC, 0x41, 0xBB, 0xE7, 0x2F, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x45, 0xB5, 0xB8, 0xBC, 0xBD, 0xBE, 0xFF,
-    0xE5, 0xE6, 0x96, 0xE6, 0xDB, 0xFF, 0xF2, 0xFF, 0xFB, 0x41, 0x81, 0xE8, 0xCF, 0x21, 0xD1, 0xFC, 0x42, 0xB5, 0xB9,
-    0xE6, 0x68, 0xE6, 0x68, 0x41, 0x8F, 0xE6, 0x61, 0xA2, 0x03, 0x32, 0xD0, 0xD1, 0xF5, 0xFC, 0x43, 0xB0, 0xB5, 0xB8,
-    0xFF, 0xEB, 0xFF, 0xF9, 0xE6, 0x56, 0x41, 0x91, 0xEF, 0xA3, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0xC1, 0x00, 0x91, 0xD0,
-    0xE7, 0x80, 0x46, 0x80, 0x82, 0x83, 0x85, 0x8C, 0x91, 0xFF, 0xF5, 0xE6, 0x6E, 0xE6, 0x54, 0xFF, 0xFA, 0xE6, 0x54,
-    0xFF, 0xA3, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAB, 0xFF, 0xED, 0xE5, 0xFC, 0x41, 0xD1, 0xE6, 0x9B, 0x44, 0xB0, 0xB5,
-    0xB8, 0xBE, 0xE7, 0x3D, 0xE6, 0x4D, 0xE6, 0x4D, 0xE6, 0x4D, 0x42, 0xD0, 0xD1, 0xFF, 0xF3, 0xE6, 0xDB, 0x42, 0xB0,
-    0xBE, 0xE5, 0xCF, 0xE5, 0xCF, 0x21, 0xD0, 0xF9, 0x44, 0xB0, 0xB4, 0xBB, 0xBD, 0xFF, 0xDE, 0xE5, 0xC5, 0xFF, 0xEF,
-    0xFF, 0xFD, 0xA0, 0x05, 0x22, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xE5, 0xBD, 0xC1,
-    0x01, 0xB1, 0xD0, 0xEA, 0xD3, 0x41, 0xB8, 0xFB, 0xA9, 0x21, 0xD0, 0xFC, 0xA0, 0x07, 0x51, 0x21, 0x83, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBF, 0xE7, 0x4E, 0x43, 0x82, 0x85, 0x89, 0xFA, 0x96, 0xE5,
-    0xF2, 0xE6, 0xAC, 0x22, 0xD0, 0xD1, 0xF2, 0xF6, 0x45, 0xB2, 0xB6, 0xBB, 0xBD, 0xBE, 0xEA, 0x8C, 0xFF, 0xD1, 0xFF,
-    0xDB, 0xFF, 0xEA, 0xFF, 0xFB, 0xC1, 0x00, 0x91, 0x2E, 0xE5, 0xD3, 0x21, 0x83, 0xFA, 0x21, 0xD1, 0xFD, 0xC1, 0x05,
-    0x82, 0xD0, 0xE6, 0xA0, 0x43, 0xB1, 0xB2, 0xB3, 0xFF, 0xFA, 0xEB, 0x5C, 0xE5, 0xC1, 0xC1, 0x00, 0xA1, 0xD1, 0xEB,
-    0xB3, 0x42, 0x81, 0x88, 0xFF, 0xFA, 0xED, 0xBD, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x43, 0x80, 0x83, 0x8B, 0xFF, 0xDB,
-    0xFF, 0xFB, 0xE6, 0x95, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB8, 0xFF, 0xF6, 0xE5, 0x3C, 0x41, 0xD0, 0xEE, 0xF6, 0x21,
-    0xB8, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xE6, 0xE8, 0x42, 0xB2, 0xB3, 0xFF, 0xF9, 0xE6, 0x2D, 0xC1, 0x01, 0xB1,
-    0xD1, 0xF8, 0x6A, 0x21, 0x82, 0xFA, 0xA1, 0x03, 0x12, 0xD1, 0xFD, 0x42, 0x81, 0x85, 0xFF, 0xFB, 0xE5, 0x04, 0xC3,
-    0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xF9, 0xE5, 0x08, 0x41, 0xB2, 0xF7, 0xC0, 0x21, 0xD0, 0xFC, 0x42,
-    0xB5, 0xB8, 0xFF, 0xFD, 0xE5, 0x3D, 0x21, 0xD0, 0xF9, 0x43, 0xB3, 0xB4, 0xB5, 0xE5, 0x4A, 0xFF, 0xFD, 0xE5, 0xC0,
-    0x42, 0x80, 0x91, 0xE5, 0xFA, 0xE5, 0xB6, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xE4, 0xDA, 0x41, 0xB2,
-    0xEE, 0x05, 0x41, 0x83, 0xF0, 0xE3, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xB0, 0xFA, 0xB9, 0x21, 0xD0, 0xFC, 0x21,
-    0xD1, 0xF0, 0x41, 0x82, 0xE4, 0xD4, 0x21, 0xD1, 0xFC, 0x44, 0xB1, 0xB3, 0xBC, 0xBF, 0xE4, 0xE0, 0xE7, 0xFE, 0xE4,
-    0xF7, 0xE4, 0xE0, 0x43, 0x80, 0x82, 0x88, 0xE7, 0xF1, 0xE4, 0xD3, 0xE4, 0xD3, 0x22, 0xD0, 0xD1, 0xE9, 0xF6, 0x47,
-    0xB0, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xBE, 0xFF, 0xCE, 0xFF, 0xD7, 0xEA, 0xA2, 0xE4, 0xB1, 0xFF, 0xDA, 0xFF, 0xE1,
-    0xFF, 0xFB, 0x41, 0xD1, 0xE9, 0x7F, 0x43, 0xB4, 0xBA, 0xBF, 0xE7, 0xC8, 0xE7, 0xC8, 0xE4, 0xAA, 0x41, 0xBE, 0xE4,
-    0xC3, 0xC2, 0x01, 0x31, 0xD0, 0xD1, 0xFF, 0xFC, 0xEB, 0xA7, 0x43, 0x81, 0x85, 0x87, 0xFF, 0xF7, 0xE7, 0xB1, 0xE4,
-    0xDF, 0x22, 0xD0, 0xD1, 0xDF, 0xF6, 0x44, 0x80, 0x83, 0x8F, 0x91, 0xFF, 0xD6, 0xFF, 0xFB, 0xE4, 0x71, 0xE4, 0x71,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xF3, 0xE4, 0x49, 0x44, 0xB3, 0xB4, 0xBC, 0xBE, 0xE5, 0xF9, 0xE4, 0x34,
-    0xE4, 0x34, 0xE4, 0x34, 0x42, 0xD0, 0xD1, 0xE8, 0xAD, 0xFD, 0x70, 0x21, 0x81, 0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xE4, 0x28, 0x41, 0xB1, 0xE4, 0x6D, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x44, 0xB0, 0xB7,
-    0xB8, 0xBE, 0xFF, 0xFB, 0xE4, 0x08, 0xE4, 0x58, 0xED, 0x98, 0xC1, 0x03, 0x32, 0xD0, 0xE5, 0x71, 0x41, 0xBA, 0xE4,
-    0x2E, 0x41, 0x82, 0xE9, 0x80, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x43, 0x80, 0x81, 0x83, 0xFF, 0xED, 0xFF, 0xFB, 0xE4,
-    0x38, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD6, 0xFF, 0xF6, 0xE3, 0xE9, 0x41, 0xBA, 0xE3, 0xEB, 0x41, 0x86, 0xE4, 0x37,
-    0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0x81, 0xFB, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x42, 0xB0, 0xB5, 0xE4, 0x0F, 0xFF,
-    0xFB, 0x45, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xE4, 0x08, 0xE4, 0x08, 0xE4, 0x08, 0xE3, 0xDE, 0xE4, 0x08, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF0, 0xE3, 0xB3, 0x42, 0xB4, 0xBA, 0xE7, 0x82, 0xE3, 0xB5, 0x21, 0xD0, 0xF9, 0x41,
-    0x81, 0xE3, 0xFB, 0x21, 0xD1, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x41, 0xB6, 0xE4, 0x68, 0x21, 0xD0, 0xFC, 0x44,
-    0x83, 0x87, 0x8B, 0x8C, 0xFF, 0xFD, 0xE3, 0xEB, 0xE5, 0xBC, 0xFE, 0x5A, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF,
-    0xF3, 0xE3, 0x7F, 0x42, 0xB0, 0xB4, 0xE3, 0x90, 0xEA, 0x63, 0x44, 0x80, 0x81, 0x88, 0x8D, 0xEC, 0xF3, 0xE3, 0xBF,
-    0xEC, 0x4A, 0xE3, 0xB3, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF3, 0xE3, 0x61, 0x41, 0xD0, 0xFE, 0xE5, 0x21,
-    0x80, 0xFC, 0xA1, 0x00, 0x92, 0xD1, 0xFD, 0x41, 0xBB, 0xF7, 0xAF, 0x41, 0x80, 0xE4, 0xB6, 0x22, 0xD0, 0xD1, 0xF8,
-    0xFC, 0x41, 0xB7, 0xEF, 0x55, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x43, 0xB0, 0xB5, 0xBE, 0xE3, 0x7D, 0xFF, 0xFB, 0xE3,
-    0x2A, 0xA1, 0x00, 0x91, 0xD0, 0xF6, 0x43, 0xB0, 0xB8, 0xBA, 0xE3, 0x6B, 0xE3, 0x6E, 0xE3, 0x6B, 0x42, 0x8B, 0x8C,
-    0xE3, 0x61, 0xE3, 0x61, 0x43, 0x2E, 0xD0, 0xD1, 0xE3, 0x5A, 0xFF, 0xEF, 0xFF, 0xF9, 0x43, 0xB0, 0xB8, 0xBE, 0xE3,
-    0x6A, 0xE3, 0x6A, 0xE3, 0x53, 0x41, 0x81, 0xE3, 0x46, 0x43, 0x2E, 0xD0, 0xD1, 0xE3, 0x42, 0xFF, 0xF2, 0xFF, 0xFC,
-    0x41, 0xBE, 0xF7, 0x57, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x41, 0xB8, 0xF7, 0x44, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB5, 0xBB, 0xBE, 0xE3, 0x18,
-    0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x80, 0x83, 0xE2, 0xBE, 0xED, 0x20, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xEF, 0xF9, 0x4A,
-    0xB1, 0xB3, 0xB4, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0x6B, 0xFF, 0x78, 0xFF, 0x90, 0xF8, 0xB1, 0xE3,
-    0x1A, 0xF6, 0xC8, 0xFF, 0xA6, 0xE3, 0x1A, 0xFF, 0xBE, 0xFF, 0xF9, 0x41, 0xB8, 0xF8, 0x92, 0x21, 0xD0, 0xFC, 0x44,
-    0xB2, 0xBA, 0xBC, 0xBD, 0xFF, 0xFD, 0xE2, 0xC3, 0xE2, 0xDA, 0xE2, 0xDA, 0x42, 0x82, 0x85, 0xF5, 0xD9, 0xE2, 0xD0,
-    0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xEC, 0xF9, 0x41, 0xBB, 0xE2, 0xBF, 0x41, 0x83, 0xE2, 0xC7, 0x21, 0xD1, 0xFC, 0x21,
-    0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x45, 0x80, 0x81, 0x82, 0x87, 0x89, 0xFF, 0x78, 0xFF, 0xE6, 0xFF, 0xFB,
-    0xF8, 0x5D, 0xF8, 0x5D, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0x9C, 0xFF, 0xF0, 0xE2, 0x57, 0xC1, 0x02, 0xD1,
-    0xD1, 0xE8, 0x53, 0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x41, 0x88, 0xE2, 0x6D, 0x21, 0xD1, 0xFC, 0x41, 0xB4, 0xE2,
-    0xBC, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xB5, 0xBE, 0xE2, 0x4C, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x89, 0xE2, 0x55, 0x21,
-    0xD1, 0xFC, 0x43, 0x83, 0x8B, 0x8E, 0xE2, 0x4E, 0xE2, 0x3B, 0xFF, 0xFD, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xE5, 0xF6,
-    0x46, 0xB0, 0xB5, 0xB8, 0xBB, 0xBD, 0xBE, 0xFF, 0xCD, 0xE2, 0xE4, 0xE7, 0xC2, 0xFF, 0xF9, 0xF4, 0xD3, 0xE2, 0xE4,
-    0xA0, 0x07, 0x62, 0x43, 0x81, 0x82, 0x91, 0xFF, 0xFD, 0xF4, 0xBD, 0xE2, 0xCE, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE0,
-    0xFF, 0xF6, 0xE1, 0xEF, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
-    0xBF, 0xB9, 0xFB, 0x27, 0xFB, 0x69, 0xFB, 0xE9, 0xFC, 0x28, 0xFC, 0xA9, 0xFC, 0xDD, 0xFD, 0x0B, 0xFD, 0x9C, 0xFD,
-    0xBD, 0xFD, 0xFC, 0xFE, 0x32, 0xFE, 0x66, 0xFE, 0x84, 0xFF, 0x8E, 0xFF, 0xF6, 0xE5, 0xF4, 0x41, 0xD1, 0xE8, 0x0F,
-    0x21, 0xBA, 0xFC, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x41, 0x91, 0xE1, 0xD6, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xE7, 0x24,
-    0xFF, 0xFC, 0x41, 0xBE, 0xE1, 0xA7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xE7, 0x9F, 0x41, 0xBD, 0xE5, 0x69, 0x21, 0xD0,
-    0xFC, 0x44, 0xB4, 0xBA, 0xBC, 0xBF, 0xFF, 0xF2, 0xE2, 0x2F, 0xFF, 0xFD, 0xE1, 0x95, 0xA0, 0x07, 0x82, 0x41, 0xBE,
-    0xE5, 0x52, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x85, 0x81, 0xF0, 0xFD, 0xC3, 0x00, 0x91,
-    0x2E, 0xD0, 0xD1, 0xE1, 0x82, 0xFF, 0xDE, 0xFF, 0xFB, 0x41, 0xD0, 0xFE, 0x1D, 0x21, 0xBE, 0xFC, 0xA1, 0x00, 0x91,
-    0xD0, 0xFD, 0xC1, 0x01, 0xE1, 0xD0, 0xE5, 0x40, 0x41, 0xD1, 0xFA, 0xD9, 0x44, 0xB1, 0xB2, 0xBA, 0xBB, 0xFF, 0xF6,
-    0xE3, 0x97, 0xFF, 0xFC, 0xE2, 0x1A, 0x41, 0x84, 0xE5, 0x11, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xEF, 0xFC, 0x45, 0xB0,
-    0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0x80, 0xFF, 0x89, 0xFF, 0xC6, 0xFF, 0xD9, 0xFF, 0xF9, 0x41, 0xD0, 0xEE, 0x93, 0x41,
-    0xBF, 0xE4, 0x3E, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x41, 0xD0, 0xFF, 0x75, 0x42, 0xB4, 0xBA, 0xFF, 0xFC, 0xE1, 0xB2,
-    0xA1, 0x00, 0x91, 0xD0, 0xF9, 0x46, 0x81, 0x83, 0x8B, 0x8E, 0x8F, 0x91, 0xFF, 0xE3, 0xFF, 0xEB, 0xE1, 0x45, 0xE1,
-    0x45, 0xE1, 0x45, 0xFF, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xED, 0xE0, 0xED, 0x42, 0x2E, 0xD0, 0xE1,
-    0xFC, 0xE4, 0xD4, 0x43, 0xB0, 0xB5, 0xBE, 0xFF, 0xF9, 0xE1, 0x3B, 0xF5, 0xDF, 0xA0, 0x07, 0xA2, 0x21, 0x2E, 0xFD,
-    0x21, 0x83, 0xFD, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xED, 0xFD, 0x42, 0xB2, 0xBC, 0xE0, 0xB7, 0xE0, 0xB7, 0x21, 0xD0,
-    0xF9, 0x43, 0xB0, 0xB8, 0xBE, 0xE9, 0x89, 0xF3, 0xEA, 0xFF, 0xFD, 0x42, 0x83, 0x8B, 0xE0, 0xF3, 0xE0, 0xF3, 0xA2,
-    0x02, 0x21, 0xD0, 0xD1, 0xEF, 0xF9, 0xA0, 0x07, 0xC2, 0x42, 0xB5, 0xBE, 0xE4, 0xF4, 0xF4, 0xAA, 0x41, 0x83, 0xE0,
-    0xF5, 0xA2, 0x02, 0x21, 0xD0, 0xD1, 0xF5, 0xFC, 0x48, 0xB0, 0xB1, 0xB3, 0xBA, 0xBB, 0xBC, 0xBE, 0xBF, 0xE1, 0x0F,
-    0xE3, 0xCB, 0xE0, 0xD0, 0xFF, 0xC2, 0xFF, 0xE4, 0xFF, 0xEB, 0xE0, 0xA6, 0xFF, 0xF9, 0x42, 0xB0, 0xBB, 0xF3, 0xA4,
-    0xE0, 0xD1, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1, 0x53, 0x42, 0x82, 0x87, 0xFF, 0xF7, 0xE3, 0x48, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xF9, 0xE0, 0x5B, 0x43, 0xB5, 0xB8, 0xBE, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x96,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xFE, 0x9F, 0x41, 0x87, 0xE1, 0x15, 0x21, 0xD1, 0xFC, 0xC1, 0x00, 0x91, 0xD1, 0xFC,
-    0x9A, 0x45, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xE0, 0x78, 0xFF, 0xEC, 0xFF, 0xF7, 0xE0, 0x78, 0xFF, 0xFA, 0xC1, 0x01,
-    0x31, 0xD1, 0xE5, 0x22, 0x46, 0x80, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xFA, 0xE0, 0x62, 0xE0, 0x62, 0xE5, 0xEA,
-    0xE0, 0x62, 0xE0, 0x62, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xED, 0xE0, 0x0A, 0xC1, 0x02, 0x21, 0xD1, 0xEB,
-    0xDF, 0x41, 0xBB, 0xFC, 0xA3, 0x21, 0xD0, 0xFC, 0x43, 0xB1, 0xB7, 0xBA, 0xFF, 0xF3, 0xE0, 0x44, 0xFF, 0xFD, 0xC2,
-    0x00, 0x92, 0xD0, 0x2D, 0xFF, 0xF6, 0xDF, 0xE9, 0x41, 0xB1, 0xE3, 0xB9, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xBB, 0xFF,
-    0xFD, 0xDF, 0xCE, 0x41, 0x80, 0xE5, 0x56, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDF, 0xCE, 0xC1, 0x01,
-    0xE1, 0xD0, 0xE0, 0xFC, 0x21, 0x82, 0xFA, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xF3, 0xC5, 0x21, 0xD0, 0xFC, 0x41, 0xBF,
-    0xDF, 0xF9, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB1, 0xBF, 0xDF, 0xD2, 0xE4, 0xAC, 0x21,
-    0xD0, 0xF9, 0x24, 0xB0, 0xB2, 0xBB, 0xBE, 0xDF, 0xE6, 0xF3, 0xFD, 0x42, 0xD0, 0xD1, 0xE5, 0x11, 0xE5, 0x01, 0x41,
-    0x87, 0xE2, 0xD6, 0x21, 0xD1, 0xFC, 0x22, 0x80, 0x83, 0xF2, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xFB,
-    0xDF, 0x7E, 0x41, 0xB2, 0xE0, 0x49, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x70, 0x42, 0xD0, 0x2D, 0xFC, 0xEF, 0xDF,
-    0x69, 0x41, 0xB3, 0xDF, 0x57, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x5E, 0x41, 0xB7, 0xDF, 0x4C, 0xC2, 0x00, 0x91,
-    0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x53, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E, 0x8F,
-    0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x5D, 0xFE, 0xEF, 0xFF, 0x40, 0xFF, 0x61, 0xFF, 0x7C, 0xFF, 0xCC, 0xFF, 0xDA,
-    0xFF, 0xE1, 0xE5, 0xB9, 0xE6, 0x90, 0xFF, 0xEC, 0xFF, 0xF7, 0xE5, 0xF0, 0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0xE3,
-    0x59, 0x42, 0xD0, 0xD1, 0xFD, 0x31, 0xFF, 0xCC, 0x42, 0xD0, 0xD1, 0xE3, 0x6F, 0xE2, 0x73, 0x42, 0xB1, 0xB7, 0xFF,
-    0xF9, 0xDF, 0x36, 0x41, 0x82, 0xE3, 0x79, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDE, 0xFD, 0x43, 0xB0,
-    0xB8, 0xBB, 0xDF, 0xC8, 0xDF, 0x52, 0xEB, 0x9A, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFE, 0x53, 0xDE,
-    0xE9, 0x41, 0x87, 0xDF, 0x3C, 0x42, 0xD0, 0xD1, 0xEB, 0xCD, 0xFF, 0xFC, 0xA0, 0x01, 0x91, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0x43, 0xBB, 0xBC, 0xBF, 0xEB, 0x70, 0xFF, 0xFD, 0xDF, 0x28, 0x21, 0xD0, 0xF6, 0x41, 0xBA, 0xEB, 0xE5,
-    0x41, 0x87, 0xEB, 0xE1, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xF8, 0xFC, 0xA0, 0x07, 0xE2, 0x45, 0xB0, 0xB5, 0xB8, 0xBB,
-    0xBE, 0xFF, 0xD1, 0xFF, 0xEB, 0xFF, 0xF6, 0xFF, 0xFD, 0xDE, 0xB6, 0x43, 0x83, 0x8C, 0x8F, 0xDE, 0xF6, 0xFF, 0xC8,
-    0xEB, 0x41, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE6, 0xFF, 0xF6, 0xDE, 0x90, 0x42, 0xB2, 0xBB, 0xE1, 0xD0,
-    0xDE, 0xB2, 0x21, 0xD0, 0xF9, 0x45, 0xB2, 0xB4, 0xBA, 0xBE, 0xBF, 0xE5, 0xC6, 0xE7, 0x56, 0xFF, 0xFD, 0xE1, 0xC6,
-    0xE7, 0x56, 0xC1, 0x03, 0x12, 0xD0, 0xEB, 0xE0, 0x21, 0x81, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD,
-    0xDE, 0x61, 0xC1, 0x00, 0xA1, 0xD0, 0xFE, 0xE3, 0x42, 0xB0, 0xB5, 0xDF, 0x26, 0xFF, 0xFA, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF9, 0xDF, 0x44, 0xDE, 0x4A, 0x41, 0x80, 0xFC, 0xF7, 0x43, 0xD0, 0xD1, 0x2D, 0xDF, 0x74, 0xFF, 0xFC, 0xDE,
-    0x3C, 0x42, 0xB0, 0xBE, 0xDE, 0x4D, 0xE6, 0x9D, 0xC2, 0x00, 0xA1, 0xD0, 0x2D, 0xFF, 0xF9, 0xDE, 0x2B, 0xC2, 0x03,
-    0x32, 0xD0, 0x2D, 0xE7, 0xA0, 0xDE, 0x22, 0x41, 0xB1, 0xE7, 0x9E, 0xA0, 0x08, 0x04, 0xC1, 0x01, 0xC1, 0xD1, 0xFA,
-    0x73, 0x22, 0x82, 0x83, 0xF7, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFB, 0xDE, 0x07, 0xC2, 0x05, 0x22,
-    0xD0, 0x2D, 0xE7, 0x7B, 0xDD, 0xFD, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0xF7, 0xF1, 0xBC, 0xE5, 0x27, 0xFF, 0x0B, 0xFF, 0x64, 0xFF, 0x93, 0xFF, 0xAA, 0xF1,
-    0xBC, 0xFF, 0xB8, 0xE5, 0x27, 0xE5, 0x27, 0xFF, 0xC9, 0xFF, 0xD2, 0xFF, 0xED, 0xFF, 0xF7, 0xE2, 0x03, 0x42, 0xD1,
-    0x2D, 0xFD, 0x2D, 0xDD, 0xC3, 0xC2, 0x02, 0x21, 0x2E, 0x2D, 0xE8, 0x8F, 0xDD, 0xBC, 0x43, 0x2E, 0xD1, 0x2D, 0xDE,
-    0x88, 0xE8, 0x50, 0xDD, 0xB3, 0x41, 0xB2, 0xE4, 0xF5, 0x41, 0x81, 0xE0, 0xF1, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF8,
-    0xFF, 0xFC, 0xDD, 0xA1, 0x51, 0x80, 0x81, 0x84, 0x86, 0x87, 0x8A, 0x8C, 0x91, 0x82, 0x83, 0x85, 0x88, 0x89, 0x8B,
-    0x8D, 0x8E, 0x8F, 0xFF, 0xD4, 0xE4, 0xCA, 0xE5, 0x59, 0xE5, 0x59, 0xE4, 0xCA, 0xFF, 0xDB, 0xFF, 0xE4, 0xFF, 0xF6,
-    0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xC2,
-    0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x6F, 0xFF, 0xCC, 0x41, 0xB8, 0xDF, 0x14, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF1, 0x40,
-    0x42, 0x80, 0x83, 0xFF, 0xF9, 0xDD, 0x94, 0x21, 0xD1, 0xF9, 0x41, 0xD1, 0xE8, 0xA9, 0x41, 0x85, 0xDD, 0x92, 0x42,
-    0xD0, 0xD1, 0xDE, 0x49, 0xFF, 0xFC, 0x41, 0xD1, 0xEF, 0xD7, 0x41, 0xB5, 0xDD, 0x7A, 0x41, 0x91, 0xDD, 0x76, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBD, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xDD, 0x67, 0xC2, 0x05, 0x02, 0xD0, 0xD1,
-    0xFF, 0xFC, 0xE4, 0x87, 0x41, 0xBB, 0xDD, 0x63, 0x21, 0xD0, 0xFC, 0x41, 0xB7, 0xDD, 0x5C, 0x21, 0xD0, 0xFC, 0x4E,
-    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB8, 0xBE, 0xDD, 0x55, 0xDD, 0x55, 0xFF,
-    0xBC, 0xDF, 0xC6, 0xFF, 0xBF, 0xFF, 0xC7, 0xE8, 0x2A, 0xE5, 0xE0, 0xFF, 0xCE, 0xFF, 0xE2, 0xFF, 0xE9, 0xDD, 0x55,
-    0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0xB2, 0xB4, 0xB6, 0xDD, 0x2A, 0xE5, 0xB5, 0xDD, 0x2A, 0x21, 0xD0, 0xF6, 0xC1, 0x01,
-    0xE1, 0xD1, 0xED, 0x5F, 0x41, 0xB2, 0xF2, 0x20, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD,
-    0x49, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8F, 0x8E, 0xFF, 0xE8, 0xFF, 0xEB, 0xEA, 0x31, 0xDD, 0x08, 0xFF,
-    0xFB, 0xE0, 0xFF, 0xE5, 0x93, 0xDD, 0x08, 0xFF, 0xA9, 0xC3, 0x06, 0x02, 0xD0, 0xD1, 0x2D, 0xFF, 0x97, 0xFF, 0xE4,
-    0xDC, 0x9B, 0x41, 0x8C, 0xDC, 0xAA, 0x21, 0xD1, 0xFC, 0x43, 0xB2, 0xBB, 0xBD, 0xDC, 0xE7, 0xFF, 0xFD, 0xDC, 0xE7,
-    0x41, 0x8F, 0xDD, 0x53, 0x43, 0x2E, 0xD0, 0xD1, 0xE4, 0xE5, 0xFF, 0xF2, 0xFF, 0xFC, 0x41, 0xB7, 0xDC, 0xCF, 0xA1,
-    0x00, 0x91, 0xD0, 0xFC, 0x41, 0xB0, 0xDC, 0xAC, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xBD, 0xDD, 0x35, 0xE4, 0x9C, 0xA1,
-    0x00, 0x91, 0xD0, 0xF9, 0x46, 0xB0, 0xB5, 0xB8, 0xBA, 0xBB, 0xBE, 0xFF, 0xDA, 0xFF, 0xE8, 0xDC, 0x99, 0xDC, 0xD8,
-    0xFF, 0xF1, 0xFF, 0xFB, 0x41, 0x8E, 0xE5, 0xC6, 0xA1, 0x02, 0xB1, 0xD1, 0xFC, 0x44, 0x80, 0x83, 0x8C, 0x91, 0xDC,
-    0x7D, 0xFF, 0xFB, 0xDC, 0x7D, 0xFF, 0xCC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xF3, 0xDC, 0x2B, 0x42, 0xD0,
-    0xD1, 0xDF, 0x5D, 0xFB, 0x8B, 0x43, 0xB0, 0xBB, 0xBD, 0xDC, 0x35, 0xDC, 0xCF, 0xFF, 0xF9, 0xC2, 0x02, 0x21, 0xD0,
-    0x2D, 0xFF, 0xF6, 0xDC, 0x10, 0x41, 0xD1, 0xDF, 0x85, 0x41, 0xB6, 0xE8, 0x1A, 0x21, 0xD0, 0xFC, 0x43, 0xB2, 0xB5,
-    0xBE, 0xF1, 0xF2, 0xFF, 0xF5, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xDB, 0xF2, 0x43, 0xB1, 0xB5, 0xBE, 0xDD,
-    0xA5, 0xE2, 0xD6, 0xE4, 0xB0, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xF6, 0xDB, 0xE1, 0xC1, 0x02, 0x02, 0x2D, 0xDB,
-    0xD8, 0x41, 0x2E, 0xE3, 0x1E, 0x43, 0xB7, 0xBD, 0xBF, 0xDB, 0xC3, 0xDD, 0x3D, 0xDB, 0xFC, 0x21, 0xD0, 0xF6, 0x43,
-    0xB9, 0xBD, 0xBE, 0xFF, 0xEF, 0xFE, 0x8B, 0xFF, 0xFD, 0x41, 0x80, 0xE4, 0x93, 0x21, 0xD1, 0xFC, 0x41, 0xD0, 0xE2,
-    0xC5, 0x44, 0x81, 0x82, 0x83, 0x87, 0xE2, 0xF8, 0xFF, 0xF9, 0xFF, 0xFC, 0xE2, 0xF8, 0xC4, 0x02, 0xB1, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xE2, 0xEB, 0xFF, 0xDE, 0xFF, 0xF3, 0xDB, 0x9F, 0x41, 0xBF, 0xDF, 0x69, 0xA1, 0x01, 0xF1, 0xD0, 0xFC,
-    0x21, 0xBE, 0xFB, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFD, 0xDB, 0x84, 0x42, 0xB1, 0xBF, 0xDB, 0xDA, 0xDB, 0xDA,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1, 0xEE, 0x42, 0xB0, 0xBE, 0xDE, 0x12, 0xFF, 0xF9, 0x41, 0x8E, 0xDE, 0x0B, 0xC3,
-    0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDB, 0x62, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xE3, 0xE2, 0xDB,
-    0x56, 0x45, 0xB2, 0xB5, 0xB9, 0xBA, 0xBD, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB, 0xAC, 0xDB, 0xAC, 0x44, 0x82,
-    0x8E, 0x8F, 0x91, 0xDB, 0x9C, 0xDB, 0x9C, 0xDC, 0x12, 0xDB, 0x9C, 0x43, 0x2E, 0xD0, 0xD1, 0xDC, 0x05, 0xFF, 0xE3,
-    0xFF, 0xF3, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xF6, 0xDB, 0xFB, 0xE3, 0x91, 0xDB, 0xFB, 0x43, 0x83, 0x8B, 0x91,
-    0xDB, 0xEE, 0xE3, 0x84, 0xDB, 0xEE, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xDB, 0x0F, 0x42,
-    0xB5, 0xB8, 0xDB, 0x62, 0xDA, 0xF8, 0x21, 0xD0, 0xF9, 0x41, 0xBC, 0xE3, 0xD5, 0xA1, 0x02, 0xB1, 0xD0, 0xFC, 0x42,
-    0x2E, 0xD1, 0xDD, 0x0A, 0xF7, 0xEF, 0x42, 0xB3, 0xB6, 0xDB, 0x17, 0xDB, 0x17, 0xA1, 0x08, 0x42, 0xD0, 0xF9, 0x41,
-    0xBD, 0xDB, 0xB2, 0xC2, 0x04, 0x82, 0x2E, 0xD0, 0xDC, 0xF3, 0xFF, 0xFC, 0xC1, 0x02, 0xB1, 0xD1, 0xF4, 0x60, 0x41,
-    0xBF, 0xE8, 0x2F, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xE0, 0x00, 0x42, 0xB0, 0xBB, 0xDA, 0xB2, 0xDB, 0x1C,
-    0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xE1, 0x30, 0x4E, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xFF, 0xB3, 0xFF, 0xBA, 0xDF, 0x13, 0xDC, 0x66, 0xDC, 0xC9, 0xDD, 0xFB, 0xDC, 0xC9, 0xE6, 0x56,
-    0xFF, 0xBF, 0xFF, 0xCD, 0xFF, 0xD6, 0xFF, 0xDF, 0xFF, 0xE9, 0xFF, 0xF9, 0xA0, 0x08, 0x63, 0x42, 0xB3, 0xB5, 0xDA,
-    0xC6, 0xFF, 0xFD, 0x21, 0x91, 0xF6, 0x22, 0xD0, 0xD1, 0xF6, 0xFD, 0x42, 0xBD, 0xBF, 0xDA, 0xB7, 0xDA, 0xA0, 0xA1,
-    0x01, 0xE1, 0xD0, 0xF9, 0x44, 0xB2, 0xB5, 0xBA, 0xBE, 0xDA, 0x5B, 0xDA, 0xC5, 0xDA, 0xAB, 0xDA, 0xC5, 0x42, 0xB5,
-    0xB8, 0xDA, 0xAA, 0xDA, 0xAA, 0x41, 0x91, 0xDA, 0xA3, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x42, 0x80, 0x91, 0xFF, 0xFB,
-    0xDA, 0xA8, 0x22, 0xD0, 0xD1, 0xDC, 0xF9, 0xC1, 0x01, 0xE1, 0xD0, 0xDB, 0x42, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88,
-    0x8D, 0x8E, 0xFF, 0xC0, 0xFF, 0xCC, 0xFF, 0xF5, 0xDC, 0x51, 0xFF, 0xFA, 0xDC, 0x51, 0xDC, 0x51, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0x72, 0xFF, 0xEA, 0xDA, 0x21, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBE, 0xB9, 0xBF, 0xFD, 0x7C, 0xE1, 0xDF, 0xFD, 0xEC, 0xFE, 0x07, 0xFE, 0x25, 0xFE, 0x36, 0xE5, 0x89,
-    0xFE, 0x3F, 0xFE, 0x78, 0xFE, 0x93, 0xFE, 0xB5, 0xFE, 0xC1, 0xFF, 0x08, 0xFF, 0xF6, 0xDE, 0x26, 0xDE, 0x26, 0x42,
-    0x81, 0x87, 0xDA, 0x37, 0xDA, 0x45, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xE6, 0xD3, 0xFF, 0xF9, 0x42, 0xD0, 0xD1, 0xDB,
-    0x21, 0xF6, 0xD5, 0x41, 0x81, 0xF1, 0x05, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xE7,
-    0xFF, 0xF0, 0xFD, 0xBF, 0xFF, 0xFB, 0x43, 0x83, 0x8E, 0x8F, 0xD9, 0xFE, 0xDA, 0x18, 0xEA, 0x88, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xD9, 0xAF, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xDB, 0x78, 0xD9, 0xA5, 0x41, 0xB5, 0xEE,
-    0xF6, 0x41, 0x80, 0xE6, 0xFD, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0xC1, 0x01, 0x31, 0xD0, 0xEF, 0x32, 0xA0, 0x08, 0x93,
-    0x42, 0xB5, 0xBE, 0xE0, 0xD2, 0xEF, 0x7C, 0x41, 0x8C, 0xD9, 0x74, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0xC1, 0x02, 0x21,
-    0xD1, 0xDC, 0xDA, 0x48, 0xB1, 0xB2, 0xB3, 0xB5, 0xB7, 0xBA, 0xBC, 0xBF, 0xFF, 0xDC, 0xFF, 0xE1, 0xF3, 0xAD, 0xE0,
-    0xBC, 0xFF, 0xE7, 0xDE, 0x43, 0xFF, 0xF5, 0xFF, 0xFA, 0x41, 0xB1, 0xD9, 0x9C, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xEF,
-    0x46, 0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xDE, 0x83, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x44, 0x80, 0x82, 0x87, 0x91,
-    0xFF, 0xEC, 0xFF, 0xF3, 0xFF, 0xFD, 0xE0, 0x8B, 0xC4, 0x02, 0xB1, 0x2E, 0xD0, 0xD1, 0x2D, 0xE0, 0x7E, 0xFF, 0xC2,
-    0xFF, 0xF3, 0xD9, 0x32, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xF1, 0x9A, 0xF1, 0x9D, 0xE3, 0xF6, 0xD9, 0x23, 0x42, 0x87,
-    0x91, 0xD9, 0xEB, 0xD9, 0xEB, 0x42, 0xD0, 0xD1, 0xEE, 0xB2, 0xFF, 0xF9, 0x43, 0xB3, 0xB7, 0xBC, 0xF1, 0xA8, 0xD8,
-    0xFD, 0xFF, 0xF9, 0x42, 0x81, 0x89, 0xF1, 0x9E, 0xD9, 0xD3, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF,
-    0xF9, 0xD8, 0xF7, 0x42, 0xB5, 0xB8, 0xDB, 0x05, 0xDB, 0x05, 0x42, 0x8E, 0x8F, 0xDA, 0xFE, 0xE0, 0x30, 0xA0, 0x0B,
-    0xF1, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFD, 0xD8, 0xDA, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x84, 0x85, 0x89, 0x8D, 0xFF, 0x1E, 0xE0, 0x00, 0xFF, 0x28,
-    0xFF, 0x9B, 0xE0, 0x8F, 0xDF, 0x73, 0xE0, 0x8F, 0xFF, 0xAA, 0xFF, 0xD6, 0xFF, 0xF3, 0xE8, 0x8A, 0xE3, 0x8D, 0xE3,
-    0x8D, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFE, 0x82, 0xFF, 0xCC, 0xC1, 0x01, 0xE1,
-    0xD1, 0xDF, 0x0C, 0x41, 0xD0, 0xE9, 0xF4, 0x41, 0xBE, 0xDF, 0x73, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xD1, 0xD0, 0xDC,
-    0xE1, 0x42, 0xB0, 0xB4, 0xFF, 0xFA, 0xDB, 0x66, 0x21, 0xD0, 0xF9, 0x49, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBC, 0xBD,
-    0xBE, 0xBF, 0xD8, 0xD0, 0xD8, 0xD0, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF, 0xED, 0xEE, 0xCD, 0xFF, 0xFD, 0xD8, 0xC2, 0xD8,
-    0xD0, 0x41, 0xBA, 0xDB, 0xA1, 0x42, 0xB0, 0xBE, 0xD8, 0x7F, 0xD8, 0x7F, 0x21, 0xD0, 0xF9, 0x21, 0x82, 0xFD, 0x22,
-    0xD0, 0xD1, 0xEF, 0xFD, 0x42, 0x80, 0x83, 0xE1, 0xC1, 0xD8, 0x5A, 0x21, 0xD1, 0xF9, 0x45, 0x81, 0x82, 0x84, 0x85,
-    0x86, 0xFF, 0xF1, 0xFF, 0xFD, 0xD8, 0x94, 0xD9, 0x4E, 0xD8, 0xB6, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4,
-    0xFF, 0xF0, 0xD8, 0x25, 0x41, 0x80, 0xD9, 0x32, 0xC2, 0x03, 0x32, 0xD1, 0x2D, 0xFF, 0xFC, 0xD8, 0x15, 0x45, 0xB0,
-    0xB5, 0xB7, 0xB8, 0xBE, 0xF4, 0x7D, 0xE1, 0x91, 0xEC, 0x70, 0xD8, 0x51, 0xE1, 0x91, 0x46, 0x80, 0x81, 0x83, 0x85,
-    0x8B, 0x91, 0xED, 0xF2, 0xD8, 0x80, 0xD8, 0x41, 0xD9, 0x6B, 0xD8, 0xD1, 0xE1, 0x81, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xDD, 0xFF, 0xED, 0xD7, 0xE9, 0xC1, 0x02, 0x21, 0xD0, 0xE9, 0x47, 0x41, 0xB8, 0xE3, 0xF0, 0xA1, 0x00, 0xA1, 0xD0,
-    0xFC, 0x44, 0xB4, 0xB5, 0xBB, 0xBD, 0xD7, 0xC5, 0xD7, 0xEB, 0xFF, 0xF1, 0xFF, 0xFB, 0x42, 0xB5, 0xBE, 0xF1, 0x1F,
-    0xD7, 0xF1, 0x44, 0x83, 0x8B, 0x8F, 0x91, 0xD7, 0xEA, 0xD7, 0xEA, 0xD8, 0xD5, 0xF1, 0x18, 0x22, 0xD0, 0xD1, 0xEC,
-    0xF3, 0x21, 0x80, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xFD, 0xD7, 0xA7, 0x41, 0xB9, 0xD7, 0xFC, 0x21,
-    0xD0, 0xFC, 0x41, 0xBC, 0xD7, 0xF2, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xEF, 0xCA, 0x21, 0xBE, 0xF9, 0x21, 0xD0, 0xFD,
-    0x44, 0xB2, 0xB5, 0xB6, 0xB8, 0xD7, 0xCA, 0xFF, 0xEC, 0xED, 0x7B, 0xFF, 0xFD, 0x42, 0x80, 0x8C, 0xD7, 0xA6, 0xD7,
-    0xBD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xD7, 0x71, 0x41, 0xBE, 0xF2, 0x35, 0x21, 0xD0, 0xFC, 0xC1,
-    0x01, 0xB1, 0xD0, 0xFA, 0x2E, 0x41, 0xD0, 0xDF, 0x80, 0x41, 0xB8, 0xD9, 0xE4, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3,
-    0xB4, 0xB7, 0xBD, 0xBE, 0xBF, 0xFF, 0xEC, 0xD7, 0x44, 0xFF, 0xEF, 0xED, 0xAB, 0xFF, 0xF5, 0xDA, 0x9B, 0xFF, 0xFD,
-    0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xEA, 0xDA, 0x9D, 0xD7, 0x39, 0x42, 0xD0, 0x2D, 0xF4, 0xF5, 0xD7, 0x2D,
-    0x41, 0xBD, 0xD7, 0xA7, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0x91, 0xD0, 0xF2, 0xAD, 0x45, 0xB2, 0xB3, 0xB4, 0xBD, 0xBE,
-    0xDA, 0x65, 0xFF, 0xF7, 0xE6, 0x0F, 0xDB, 0x83, 0xFF, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xD8, 0xBC, 0xD7,
-    0x09, 0x42, 0xD1, 0x2D, 0xF0, 0x4D, 0xD6, 0xFF, 0xC1, 0x02, 0x02, 0xD1, 0xD7, 0xA1, 0x42, 0xB0, 0xB8, 0xD6, 0xE7,
-    0xD7, 0x51, 0x21, 0xD0, 0xF9, 0x41, 0xD1, 0xE3, 0xC3, 0x44, 0xB0, 0xB2, 0xBB, 0xBE, 0xFF, 0xEC, 0xFF, 0xF9, 0xFF,
-    0xFC, 0xD6, 0xFF, 0x41, 0x82, 0xD8, 0x91, 0x42, 0xD0, 0xD1, 0xF2, 0xD3, 0xFF, 0xFC, 0x43, 0x80, 0x81, 0x83, 0xDB,
-    0xD4, 0xFF, 0xF9, 0xD6, 0xE7, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDE, 0xFF, 0xF6, 0xD6, 0xC2, 0x41, 0x86,
-    0xD9, 0xDB, 0x41, 0xBD, 0xD9, 0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x22,
-    0xD1, 0xD0, 0xEC, 0xFD, 0x41, 0xD0, 0xE1, 0x1E, 0x21, 0x81, 0xFC, 0x21, 0xD1, 0xFD, 0x41, 0xBA, 0xDE, 0x61, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x44, 0xB0, 0xBE, 0xBF, 0xBB, 0xFF, 0xE4, 0xFF, 0xF0, 0xD6, 0xD7,
-    0xFF, 0xFD, 0x41, 0xD0, 0xF5, 0x60, 0xC1, 0x00, 0xA1, 0xD1, 0xE7, 0x08, 0x22, 0x83, 0x8C, 0xF6, 0xFA, 0xC3, 0x00,
-    0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xFB, 0xD6, 0x6A, 0x42, 0x83, 0x8C, 0xD6, 0xBD, 0xD7, 0x33, 0x42, 0xD0,
-    0xD1, 0xE0, 0x1F, 0xFF, 0xF9, 0x21, 0xBD, 0xF9, 0x21, 0xD0, 0xFD, 0x45, 0xB0, 0xB5, 0xB8, 0xBE, 0xBF, 0xD7, 0x1F,
-    0xFF, 0xFD, 0xD6, 0x65, 0xDC, 0x86, 0xEA, 0x57, 0xC1, 0x00, 0xA1, 0xD0, 0xD9, 0x76, 0x42, 0x80, 0x87, 0xD7, 0x4D,
-    0xFF, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3, 0xFF, 0xF9, 0xD6, 0x2D, 0x41, 0xBB, 0xED, 0x59, 0x21, 0xD0, 0xFC,
-    0x41, 0xBB, 0xD9, 0xF5, 0x21, 0xD0, 0xFC, 0x22, 0xBA, 0xBF, 0xF6, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xFB, 0xF2, 0x71,
-    0x43, 0xB4, 0xB6, 0xBE, 0xD6, 0x5A, 0xD8, 0x23, 0xFF, 0xF9, 0x41, 0xBF, 0xD8, 0x19, 0x41, 0xB8, 0xD8, 0x15, 0x21,
-    0xD0, 0xFC, 0x42, 0x82, 0x83, 0xFF, 0xFD, 0xD8, 0x0E, 0xA2, 0x01, 0xE1, 0xD0, 0xD1, 0xEE, 0xF9, 0x43, 0x81, 0x84,
-    0x8A, 0xFF, 0xF9, 0xD8, 0x00, 0xD8, 0x00, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD3, 0xFF, 0xF6, 0xD5, 0xDC, 0xC1, 0x00,
-    0x91, 0xD0, 0xD6, 0x4F, 0xC1, 0x00, 0x91, 0xD0, 0xD6, 0x17, 0x41, 0xD1, 0xF2, 0xC5, 0x41, 0xB2, 0xD5, 0xDD, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x49, 0xB1, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBD,
-    0xBF, 0xEF, 0x9E, 0xDA, 0x58, 0xD6, 0x12, 0xFF, 0xE1, 0xFF, 0xE7, 0xFF, 0xED, 0xDA, 0xD7, 0xFF, 0xFB, 0xF8, 0x7D,
-    0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xD5, 0xB5, 0xDB, 0x07, 0x43, 0xB0, 0xBA, 0xBF, 0xD5, 0x83, 0xE9, 0x9B, 0xD8, 0xDA,
-    0x21, 0xD0, 0xF6, 0x43, 0xB0, 0xB2, 0xBA, 0xD5, 0xC6, 0xD7, 0x3B, 0xD5, 0xC6, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xF2,
-    0x76, 0x46, 0x80, 0x81, 0x82, 0x83, 0x85, 0x88, 0xFF, 0xD9, 0xFF, 0xEC, 0xFF, 0xF9, 0xE7, 0x1F, 0xD6, 0xDF, 0xD5,
-    0xB5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAA, 0xFF, 0xED, 0xD5, 0x5D, 0x41, 0xBA, 0xD9, 0x2C, 0x21, 0xD0, 0xFC, 0x44,
-    0xB0, 0xBB, 0xBD, 0xBE, 0xF3, 0x0A, 0xF0, 0xCC, 0xD5, 0x94, 0xFF, 0xFD, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xF3,
-    0xD5, 0x3F, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xFD, 0x11, 0xFD, 0x21, 0xFD, 0x4D, 0xFD, 0x8F, 0xFD, 0xC5, 0xFD, 0xFD, 0xFE, 0x09, 0xFE, 0x2D, 0xDB, 0xDC, 0xFE,
-    0x37, 0xFE, 0x74, 0xFE, 0xCC, 0xFF, 0x09, 0xFF, 0x5A, 0xFF, 0xD9, 0xFF, 0xF7, 0x42, 0x81, 0x83, 0xD9, 0x4D, 0xD6,
-    0x1E, 0x21, 0xD1, 0xF9, 0x41, 0xD0, 0xEC, 0x09, 0x42, 0x81, 0x83, 0xFF, 0xFC, 0xE1, 0x0E, 0x21, 0xD1, 0xF9, 0x41,
-    0xB7, 0xD5, 0x93, 0x21, 0xD0, 0xFC, 0x45, 0xB0, 0xB2, 0xB6, 0xB8, 0xBE, 0xFF, 0xE8, 0xD5, 0x45, 0xD5, 0x45, 0xFF,
-    0xF6, 0xFF, 0xFD, 0x41, 0x80, 0xD6, 0xF0, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFC, 0xD4, 0xD2,
-    0xA0, 0x08, 0xC2, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x85, 0xD4, 0xFF,
-    0x43, 0x2E, 0xD0, 0xD1, 0xD4, 0xFB, 0xD6, 0xD0, 0xFF, 0xFC, 0x41, 0xB2, 0xD4, 0xF1, 0x21, 0xD0, 0xFC, 0x44, 0xB0,
-    0xB5, 0xB8, 0xBE, 0xFF, 0xEF, 0xD4, 0xEA, 0xD4, 0xEA, 0xFF, 0xFD, 0x41, 0x2E, 0xD4, 0xDD, 0x21, 0x83, 0xFC, 0xA2,
-    0x01, 0x31, 0xD0, 0xD1, 0xEC, 0xFD, 0x41, 0xB0, 0xE8, 0xE8, 0x41, 0x8B, 0xD4, 0xB1, 0x22, 0xD0, 0xD1, 0xF8, 0xFC,
-    0x42, 0xD0, 0xD1, 0xF7, 0x48, 0xDB, 0x6C, 0x41, 0x81, 0xFF, 0x78, 0x21, 0xD1, 0xFC, 0x41, 0x80, 0xE8, 0xD0, 0x21,
-    0xD1, 0xFC, 0x49, 0xB0, 0xB1, 0xB4, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xAB, 0xD4, 0xC4, 0xD4, 0xC4, 0xFF,
-    0xD7, 0xFF, 0xE6, 0xFF, 0xEB, 0xD4, 0xB3, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x03, 0x02, 0x42, 0xB2, 0xBB, 0xFF, 0xFD,
-    0xD4, 0xA5, 0x41, 0xD0, 0xE4, 0x55, 0x21, 0x8F, 0xFC, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF2, 0xFD, 0x43, 0x81, 0x82,
-    0x8C, 0xE6, 0xF5, 0xFF, 0xF9, 0xD6, 0x08, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC2, 0xFF, 0xF6, 0xD4, 0x27, 0x41, 0xB2,
-    0xD4, 0x6E, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xB5, 0xB8, 0xD4, 0x5E, 0xD5, 0x2F, 0xD4, 0x44, 0x42, 0xD0, 0xD1, 0xFF,
-    0xF6, 0xD9, 0x7C, 0x43, 0xB0, 0xB2, 0xBC, 0xFF, 0xEC, 0xFF, 0xF9, 0xD4, 0x64, 0x42, 0xB5, 0xBE, 0xFA, 0xB2, 0xD6,
-    0x1C, 0xA1, 0x02, 0x52, 0xD0, 0xF9, 0x41, 0x87, 0xD5, 0x08, 0x21, 0xD1, 0xFC, 0x42, 0x8E, 0x8F, 0xD4, 0x03, 0xD4,
-    0x03, 0x21, 0xD1, 0xF9, 0x23, 0x80, 0x83, 0x8C, 0xEA, 0xF3, 0xFD, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xD2,
-    0xFF, 0xF9, 0xD3, 0xD7, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xF4, 0x1A, 0xD3, 0xCB, 0xC1, 0x01, 0x31, 0xD1, 0xD3, 0xE3,
-    0x21, 0xBB, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xDA, 0x33, 0xD3, 0xB9, 0x41, 0xB4, 0xD3, 0xBB, 0x41, 0x81,
-    0xD4, 0xC4, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0xA0, 0x08, 0xE1, 0x21, 0x80, 0xFD, 0xA1, 0x05, 0x32, 0xD1, 0xFD, 0x21,
-    0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0xC1, 0x02, 0x02, 0xD0, 0xEF, 0xB2, 0x23, 0xB0, 0xBB, 0xBE, 0xE4, 0xF7, 0xFA, 0x42,
-    0xB5, 0xB8, 0xD3, 0xB2, 0xD3, 0xB2, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF1, 0xD5, 0x42, 0x80, 0x83, 0xFF, 0xF9, 0xD3,
-    0xBB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xF9, 0xD3, 0x6F, 0x42, 0xD0, 0xD1, 0xD4, 0x6A, 0xDD, 0x31, 0x21,
-    0xBB, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xD6, 0x27, 0xD3, 0x5B, 0x42, 0xBB, 0xBD, 0xDD, 0xA8, 0xD3, 0x46,
-    0xC1, 0x01, 0xB1, 0xD0, 0xF6, 0x2B, 0x21, 0x82, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xD3, 0x41,
-    0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xD8, 0x6D, 0xD3, 0x37, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8E,
-    0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0xFE, 0x5C, 0xFF, 0x07, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x75, 0xFF,
-    0xBF, 0xD9, 0xD4, 0xFF, 0xD3, 0xFF, 0xED, 0xFF, 0xF7, 0xD9, 0xD4, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D,
-    0xD7, 0x3D, 0xD7, 0x3D, 0x42, 0xD0, 0xD1, 0xFD, 0xC4, 0xFF, 0xCC, 0x41, 0xB2, 0xE7, 0x57, 0xC2, 0x01, 0xB1, 0xD0,
-    0x2D, 0xFF, 0xFC, 0xD2, 0xEF, 0x42, 0xD0, 0x2D, 0xDC, 0x64, 0xD2, 0xE6, 0x42, 0x81, 0x82, 0xD3, 0xF8, 0xD7, 0x84,
-    0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xD2, 0xD8, 0x42, 0xD0, 0x2D, 0xD7, 0x31, 0xD2, 0xD1, 0x42, 0xD1, 0x2D, 0xD4, 0x8F,
-    0xD2, 0xCA, 0x50, 0xB4, 0xBD, 0xBE, 0xBF, 0xBA, 0xB0, 0xB1, 0xB2, 0xB3, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC,
-    0xFF, 0xD4, 0xFF, 0xDD, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6,
-    0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0x42, 0xB0, 0xB5, 0xD2, 0xAD, 0xD2,
-    0x87, 0x21, 0xD0, 0xF9, 0x41, 0xBE, 0xDC, 0xDF, 0x41, 0x83, 0xE6, 0xE8, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x44, 0xB1,
-    0xBA, 0xBC, 0xBD, 0xD2, 0xDA, 0xFF, 0xF0, 0xFF, 0xFB, 0xD2, 0xDA, 0x42, 0x84, 0x88, 0xE6, 0xD2, 0xD2, 0xCD, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xD2, 0x67, 0x42, 0xD0, 0x2D, 0xE6, 0xBA, 0xD2, 0x5D, 0x41, 0x81, 0xDF,
-    0xBB, 0x43, 0xD0, 0xD1, 0x2D, 0xE6, 0xAF, 0xFF, 0xFC, 0xD2, 0x52, 0xC1, 0x01, 0x31, 0x2D, 0xD2, 0x48, 0x51, 0x81,
-    0x82, 0x85, 0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0xFF, 0xDB, 0xFF,
-    0xE5, 0xFF, 0xF0, 0xFF, 0xFA, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
-    0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xC2, 0x03, 0x32, 0xD0, 0xD1, 0xFF, 0x4B,
-    0xFF, 0xCC, 0x41, 0x80, 0xD3, 0x0E, 0x42, 0xD0, 0xD1, 0xD6, 0x61, 0xFF, 0xFC, 0x41, 0xD0, 0xF4, 0xC8, 0x21, 0xBD,
-    0xFC, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xFD, 0xD3, 0xB0, 0x42, 0xBD, 0xBE, 0xD1, 0xF6, 0xD2, 0x18, 0x21, 0xD0,
-    0xF9, 0x41, 0x81, 0xD3, 0xFA, 0x43, 0x2E, 0xD0, 0xD1, 0xD3, 0xF6, 0xE1, 0x06, 0xFF, 0xFC, 0x41, 0xBB, 0xD3, 0x8C,
-    0x41, 0x80, 0xD2, 0x4F, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x4A, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB9, 0xBB, 0xBC, 0xBD,
-    0xBF, 0xFF, 0xC4, 0xD3, 0xDF, 0xFF, 0xD2, 0xD3, 0xDF, 0xFF, 0xE2, 0xD3, 0xDF, 0xFF, 0xE9, 0xD3, 0xDF, 0xD3, 0xDF,
-    0xFF, 0xFB, 0x41, 0x82, 0xDD, 0x89, 0x21, 0xD1, 0xFC, 0xC1, 0x05, 0x02, 0xD1, 0xD7, 0xFA, 0xC1, 0x02, 0xB1, 0xD1,
-    0xD4, 0xE8, 0x41, 0xD1, 0xFA, 0xBC, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8E, 0x91, 0xFF, 0xED, 0xFF, 0xF0, 0xFF,
-    0xF6, 0xD3, 0xA9, 0xFF, 0xFC, 0xD3, 0xA9, 0xD3, 0xA9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4, 0xFF, 0xEA, 0xD1, 0x79,
-    0x42, 0x81, 0x88, 0xD1, 0xCE, 0xD1, 0xCE, 0x42, 0xD0, 0xD1, 0xDE, 0x5C, 0xFF, 0xF9, 0x41, 0xD0, 0xF4, 0xF1, 0x43,
-    0xB0, 0xB8, 0xBE, 0xFF, 0xF5, 0xD1, 0xA2, 0xFF, 0xFC, 0x41, 0x83, 0xD1, 0x98, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xD1, 0x4F, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xD1, 0x99, 0xD1, 0x45, 0x43, 0xB0, 0xB3, 0xB4, 0xD2, 0x11,
-    0xD5, 0xA0, 0xD7, 0x48, 0x41, 0x82, 0xDC, 0xFE, 0x42, 0xD0, 0xD1, 0xDC, 0xF6, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0xC3,
-    0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xFD, 0xD1, 0x24, 0xC1, 0x01, 0x31, 0xD1, 0xEA, 0xD7, 0x43, 0xB2,
-    0xBE, 0xBF, 0xD3, 0x2C, 0xFF, 0xFA, 0xD5, 0x76, 0x42, 0x81, 0x82, 0xDD, 0x98, 0xD3, 0x22, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xEF, 0xFF, 0xF9, 0xD1, 0x01, 0xC2, 0x04, 0xC3, 0xD1, 0x2D, 0xD7, 0x3D, 0xD0, 0xF7, 0x41, 0x81, 0xD9, 0x69,
-    0x42, 0x2E, 0xD1, 0xD9, 0x55, 0xFF, 0xFC, 0xC1, 0x02, 0x21, 0x2E, 0xD0, 0xFE, 0x43, 0xBC, 0xBD, 0xBE, 0xFF, 0xFA,
-    0xD0, 0xF8, 0xD1, 0x22, 0x42, 0x2E, 0xD0, 0xD9, 0x3E, 0xFF, 0xF6, 0x43, 0xB2, 0xBA, 0xBD, 0xD9, 0x37, 0xD1, 0x2B,
-    0xD1, 0x2B, 0x42, 0x81, 0x8F, 0xD9, 0x2D, 0xD0, 0xDD, 0x43, 0x2E, 0xD0, 0xD1, 0xD9, 0x26, 0xFF, 0xEF, 0xFF, 0xF9,
-    0x42, 0xB7, 0xBC, 0xD1, 0x10, 0xD0, 0xCC, 0x42, 0x81, 0x82, 0xD9, 0x15, 0xD0, 0xB6, 0x43, 0x2E, 0xD0, 0xD1, 0xD9,
-    0x0E, 0xFF, 0xF2, 0xFF, 0xF9, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xAF, 0xC6, 0xDE, 0xF6, 0x41, 0xD0, 0xD5, 0xF0, 0xC1,
-    0x02, 0xB1, 0x2E, 0xD8, 0xF7, 0x41, 0x85, 0xD1, 0x5B, 0x43, 0x2E, 0xD0, 0xD1, 0xD1, 0x57, 0xE6, 0x18, 0xFF, 0xFC,
-    0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xE8, 0xD0, 0x93, 0xD1, 0x4D, 0xFF, 0xEC, 0xFF, 0xF6, 0xE0, 0xBE,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xCC, 0xFF, 0xED, 0xD0, 0x65, 0x41, 0xB6, 0xDD, 0x02, 0x21, 0xD0, 0xFC, 0x41, 0xBF,
-    0xD0, 0xB3, 0x21, 0xD0, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0x8F, 0xF1, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF8, 0xFF, 0xFD, 0xD0, 0x45, 0x41, 0x80, 0xDC, 0xC3, 0x21, 0xD1, 0xFC, 0x41, 0xB0, 0xD7, 0x7E, 0xA1, 0x02,
-    0xB1, 0xD0, 0xFC, 0xC1, 0x02, 0xB1, 0xD1, 0xD1, 0xDC, 0x41, 0xD1, 0xFE, 0x43, 0x21, 0x8C, 0xFC, 0x21, 0xD1, 0xFD,
-    0x41, 0xD0, 0xF5, 0x3C, 0x21, 0xB8, 0xFC, 0x21, 0xD0, 0xFD, 0x48, 0xB1, 0xB2, 0xB4, 0xB7, 0xBB, 0xBC, 0xBD, 0xBF,
-    0xFF, 0xDA, 0xFF, 0xE1, 0xFF, 0xE6, 0xD2, 0x29, 0xFF, 0xF3, 0xFF, 0xFD, 0xDA, 0x27, 0xD9, 0x44, 0x41, 0xB2, 0xDD,
-    0x5B, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xD5, 0x62, 0x43, 0xBA, 0xBC, 0xBF, 0xD0, 0x19, 0xCF, 0xF7, 0xD0, 0x19, 0xA1,
-    0x02, 0xB1, 0xD0, 0xF6, 0xA0, 0x08, 0xF2, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x46, 0x80, 0x81, 0x82, 0x84, 0x85, 0x88, 0xFF, 0xDB, 0xFF, 0xEC, 0xDF, 0x5D, 0xD4, 0x72, 0xFF, 0xFD, 0xD1, 0xE7,
-    0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xAB, 0xFF, 0xED, 0xCF, 0xBA, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFE, 0x35, 0xD6, 0xE1, 0xFE, 0x5F, 0xD7, 0x70, 0xFE,
-    0x69, 0xFE, 0x8A, 0xD6, 0xE1, 0xFE, 0xAD, 0xFE, 0xB7, 0xFF, 0x49, 0xD7, 0x70, 0xFF, 0x69, 0xFF, 0xF4, 0xD7, 0x70,
-    0xD3, 0xBD, 0xD3, 0xBD, 0x42, 0xBB, 0xBE, 0xCF, 0xC2, 0xCF, 0xD9, 0x42, 0x81, 0x87, 0xF2, 0x68, 0xCF, 0xBB, 0x22,
-    0xD0, 0xD1, 0xF2, 0xF9, 0x44, 0xB1, 0xB4, 0xB7, 0xBE, 0xD1, 0x84, 0xCF, 0xAF, 0xCF, 0xC9, 0xE6, 0xA0, 0x42, 0x82,
-    0x85, 0xCF, 0xBC, 0xCF, 0xA2, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x45, 0xB0, 0xB1, 0xB5, 0xBA, 0xBE, 0xCF, 0x96, 0xCF,
-    0x96, 0xCF, 0xB0, 0xCF, 0x96, 0xCF, 0x96, 0x46, 0x80, 0x81, 0x84, 0x85, 0x8D, 0x91, 0xCF, 0x86, 0xCF, 0x86, 0xCF,
-    0x86, 0xCF, 0x86, 0xCF, 0x86, 0xCF, 0xA0, 0x22, 0xD0, 0xD1, 0xDD, 0xED, 0x23, 0xB5, 0xB8, 0xBE, 0xBA, 0xD3, 0xFB,
-    0x41, 0xB4, 0xCF, 0x67, 0x21, 0xD0, 0xFC, 0x42, 0x83, 0x8F, 0xEB, 0x80, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xCF, 0xE9, 0xFF, 0xEB, 0xFF, 0xF9, 0xCF, 0x14, 0x41, 0xB4, 0xE3, 0x31, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0xD0, 0xDB, 0xE5, 0x43, 0xB8, 0xBB, 0xBE, 0xCF, 0x3B, 0xCF, 0x24, 0xCF, 0x3B, 0x21, 0xD0, 0xF6,
-    0x48, 0xB0, 0xB2, 0xB3, 0xB4, 0xB8, 0xBA, 0xBC, 0xBE, 0xFF, 0xEC, 0xE3, 0x4D, 0xCF, 0x31, 0xE3, 0x4D, 0xFF, 0xEF,
-    0xFF, 0xFD, 0xCF, 0x31, 0xCF, 0x04, 0x42, 0xBC, 0xBD, 0xCF, 0x15, 0xCF, 0x15, 0x21, 0xD0, 0xF9, 0x43, 0xB0, 0xB5,
-    0xBE, 0xFF, 0xFD, 0xCF, 0x0E, 0xCF, 0x0B, 0x42, 0x80, 0x83, 0xCE, 0xEA, 0xCF, 0x01, 0x22, 0xD0, 0xD1, 0xEF, 0xF9,
-    0x42, 0x82, 0x83, 0xFF, 0xFB, 0xCE, 0xCB, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xC0, 0xFF, 0xF9, 0xCE, 0xA9,
-    0x42, 0x2E, 0xD1, 0xDB, 0x44, 0xEA, 0xFE, 0x42, 0xB0, 0xBE, 0xF9, 0x9B, 0xFF, 0xF9, 0xC3, 0x03, 0x32, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF9, 0xD1, 0xF3, 0xCE, 0x8F, 0x41, 0x8F, 0xD0, 0x9D, 0x21, 0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xD2, 0xF7,
-    0xD0, 0x39, 0x46, 0xB2, 0xB5, 0xB9, 0xBB, 0xBC, 0xBF, 0xD3, 0xF9, 0xD5, 0xC1, 0xD0, 0x8F, 0xFF, 0xF6, 0xD5, 0xC1,
-    0xFF, 0xF9, 0xC1, 0x02, 0xB1, 0xD0, 0xCE, 0xAD, 0x42, 0xD0, 0xD1, 0xD8, 0xDD, 0xD4, 0xB7, 0xC1, 0x02, 0xB1, 0xD1,
-    0xD4, 0x64, 0x41, 0xD0, 0xDB, 0x64, 0x42, 0x82, 0x89, 0xD0, 0x65, 0xD5, 0x97, 0x21, 0xD1, 0xF9, 0x46, 0x80, 0x81,
-    0x82, 0x87, 0x8E, 0x91, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF, 0xFD, 0xD5, 0x8D, 0xC3, 0x00, 0xA1,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xED, 0xCE, 0x2E, 0xC1, 0x00, 0xA1, 0x2D, 0xCE, 0x22, 0x51, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8C, 0x8E, 0x91, 0x8A, 0x89, 0x8B, 0x8D, 0x8F, 0xFF, 0x08, 0xFF, 0x73, 0xFF,
-    0x8D, 0xFF, 0xEE, 0xD5, 0xDE, 0xE1, 0xE4, 0xD5, 0xDE, 0xD5, 0x4F, 0xD5, 0xDE, 0xD8, 0xDC, 0xFF, 0xFA, 0xD8, 0xDC,
-    0xD8, 0xF2, 0xD2, 0x2B, 0xD2, 0x2B, 0xD2, 0x2B, 0xD2, 0x2B, 0x42, 0xD0, 0xD1, 0xFE, 0x3A, 0xFF, 0xCC, 0x42, 0xB5,
-    0xBB, 0xCE, 0xB6, 0xCD, 0xD6, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCF, 0x97, 0x41, 0xBE, 0xCE, 0xA8, 0x42, 0xD0, 0xD1,
-    0xFF, 0xFC, 0xD1, 0x33, 0x41, 0xD0, 0xD8, 0x45, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0xC1, 0x00, 0xA1, 0xD1, 0xD6,
-    0xE6, 0x41, 0xB8, 0xD9, 0x5F, 0x42, 0x2E, 0xD0, 0xCF, 0xCE, 0xFF, 0xFC, 0x49, 0xB1, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
-    0xBA, 0xBC, 0xBD, 0xFF, 0xD3, 0xFF, 0xDE, 0xFF, 0xEC, 0xCF, 0xC7, 0xD8, 0xD3, 0xD2, 0xB5, 0xFF, 0xEF, 0xFF, 0xF9,
-    0xE6, 0xDE, 0x44, 0xB0, 0xB2, 0xB5, 0xBE, 0xCD, 0xBF, 0xD0, 0x1F, 0xCD, 0xBF, 0xCD, 0xBF, 0x44, 0x80, 0x83, 0x8F,
-    0x91, 0xD9, 0x50, 0xCD, 0xB2, 0xCD, 0xB2, 0xCD, 0xB2, 0x22, 0xD0, 0xD1, 0xE6, 0xF3, 0x21, 0x82, 0xFB, 0x21, 0xD1,
-    0xFD, 0xC1, 0x01, 0xF1, 0xD1, 0xD2, 0xA6, 0x46, 0x81, 0x82, 0x83, 0x84, 0x85, 0x8F, 0xFF, 0xF7, 0xD0, 0xB8, 0xFF,
-    0xFA, 0xD2, 0x0B, 0xDC, 0x5C, 0xCF, 0x80, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCF, 0x6D, 0xFF, 0xA6, 0xFF, 0xED, 0xCD,
-    0x53, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xD8, 0xAA, 0xCD, 0x46, 0x43, 0xB5, 0xB8, 0xBE, 0xCD, 0x82, 0xCD, 0x82, 0xCD,
-    0x82, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFB, 0xE0, 0xCD, 0x33, 0x41, 0xBB, 0xD5, 0x65, 0x21, 0xD0, 0xFC, 0x43,
-    0xB0, 0xBB, 0xBE, 0xFF, 0xFD, 0xCD, 0x81, 0xCD, 0x7E, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCD, 0x18, 0x41, 0xB0, 0xCD,
-    0x6D, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x42, 0xD0, 0xD1, 0xD0, 0xF8, 0xFF, 0xFD, 0x41, 0xD0, 0xFB, 0x2E, 0x42,
-    0xB6, 0xBE, 0xCD, 0x2A, 0xCD, 0x44, 0x21, 0xD0, 0xF9, 0xA0, 0x09, 0x13, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0xD1, 0xFF,
-    0xFD, 0xCE, 0x9F, 0x41, 0xBD, 0xEB, 0x31, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xEF, 0x3C, 0x48, 0xB2, 0xB3, 0xB4, 0xB7,
-    0xBA, 0xBC, 0xBD, 0xBE, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE5, 0xFF, 0xEE, 0xD1, 0x59, 0xFC, 0xC1, 0xCE, 0xF4, 0xFF,
-    0xF9, 0x41, 0xB0, 0xD7, 0x18, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x44, 0xB1, 0xBA, 0xBB, 0xBF, 0xCC, 0xAD, 0xFF, 0xFB,
-    0xD0, 0x04, 0xD2, 0x3C, 0x21, 0xD0, 0xF3, 0x42, 0xD0, 0xD1, 0xDA, 0x27, 0xCF, 0xF7, 0x43, 0x81, 0x82, 0x85, 0xFF,
-    0xF6, 0xFF, 0xF9, 0xFC, 0x78, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCE, 0xB1, 0xFF, 0xBD, 0xFF, 0xF6, 0xCC, 0x97, 0x41,
-    0xBE, 0xCC, 0xCF, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xCC, 0x86, 0x41, 0xBE, 0xD3, 0xCB, 0x41, 0x8B, 0xD3, 0xC7, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xD0, 0xD1, 0xEF, 0x60, 0xE9, 0x2B, 0x41, 0xBF, 0xCD, 0x40, 0x21, 0xD0, 0xFC, 0x48,
-    0xB0, 0xB2, 0xB3, 0xB5, 0xBA, 0xBC, 0xBE, 0xBF, 0xE4, 0xD8, 0xFF, 0xED, 0xFF, 0xF2, 0xD8, 0x47, 0xD3, 0x4F, 0xFF,
-    0xFD, 0xE8, 0xC9, 0xD0, 0xC8, 0x42, 0xBC, 0xBF, 0xCC, 0x57, 0xD5, 0xD0, 0x21, 0xD0, 0xF9, 0x42, 0xB2, 0xBB, 0xD9,
-    0xA6, 0xCC, 0x6F, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCD, 0xED, 0x44, 0x81, 0x82, 0x83, 0x85, 0xFF, 0xEF, 0xD3, 0x1E,
-    0xF0, 0x83, 0xFF, 0xF9, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xC2, 0xFF, 0xF3, 0xCC, 0x26, 0x42, 0xB2, 0xBB,
-    0xCC, 0x0F, 0xCD, 0x33, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xF9, 0xCC, 0x13, 0x42, 0x8C, 0x8E, 0xCC, 0x69, 0xCC,
-    0x66, 0xC2, 0x03, 0x32, 0xD1, 0x2D, 0xFF, 0xF9, 0xCC, 0x03, 0x41, 0xB8, 0xDB, 0x56, 0xC2, 0x03, 0x32, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xCB, 0xF6, 0x42, 0xD0, 0xD1, 0xD0, 0x4D, 0xCF, 0x3C, 0x41, 0xD1, 0xEF, 0x68, 0x41, 0xB4, 0xD3, 0x2E,
-    0x21, 0xD0, 0xFC, 0x43, 0xB8, 0xBB, 0xBE, 0xFF, 0xF5, 0xCB, 0xD0, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x42, 0xB4, 0xBE,
-    0xD9, 0x33, 0xE5, 0x91, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xD9, 0x43, 0x41, 0x83, 0xD7, 0xFE, 0x21, 0xD1, 0xFC, 0x41,
-    0xB0, 0xCB, 0xC5, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x22, 0xB0, 0xBB, 0xF4, 0xFB, 0x21, 0xD0, 0xFB, 0x41, 0xB0, 0xD5,
-    0xC0, 0x21, 0xD0, 0xFC, 0x48, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBF, 0xFF, 0xB4, 0xFF, 0xD0, 0xFF, 0xDA,
-    0xCD, 0x58, 0xFB, 0x88, 0xFF, 0xDD, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0xB2, 0xB3, 0xCB, 0x7D, 0xD5, 0x0D, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xD0, 0xF1, 0x42, 0xBA, 0xBF, 0xCB, 0xD6, 0xCE, 0xC6, 0x21, 0xD0, 0xF9, 0x42, 0xD0, 0xD1, 0xD7,
-    0x31, 0xD4, 0x98, 0x45, 0x80, 0x81, 0x82, 0x88, 0x91, 0xFF, 0xE8, 0xFF, 0xF6, 0xFF, 0xF9, 0xCF, 0xCD, 0xFB, 0x50,
-    0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB8, 0xFF, 0xF0, 0xCB, 0x59, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFD, 0xFA, 0xFE, 0x07, 0xFE, 0x1A, 0xFE, 0x35, 0xE0,
-    0x5F, 0xFE, 0xB6, 0xFE, 0xC7, 0xFF, 0x27, 0xFF, 0x3A, 0xFF, 0x4A, 0xD3, 0x0F, 0xFF, 0x57, 0xFF, 0xF4, 0xD3, 0x0F,
-    0xCF, 0x5C, 0xCF, 0x5C, 0x41, 0xB1, 0xCB, 0x64, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xCB, 0x18, 0xA0, 0x09,
-    0x42, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xD3, 0xE2, 0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
-    0xFD, 0x4A, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBD, 0xBE, 0xBF, 0xCC, 0xB0, 0xCB, 0x27, 0xCB, 0x41, 0xFF,
-    0xF0, 0xCD, 0x13, 0xE4, 0x55, 0xCC, 0xB0, 0xCD, 0x13, 0xCC, 0x09, 0xFF, 0xFD, 0xA0, 0x0C, 0x02, 0x21, 0xBD, 0xFD,
-    0xA1, 0x01, 0x31, 0xD0, 0xFD, 0x41, 0xD1, 0xD0, 0xDE, 0x44, 0x81, 0x82, 0x8E, 0x91, 0xFF, 0xF7, 0xFF, 0xFC, 0xCC,
-    0xE5, 0xCC, 0xE5, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0xD8, 0xFF, 0xC5, 0xFF, 0xF3, 0xCA, 0xBE, 0xC2, 0x04, 0xC3,
-    0xD0, 0x2D, 0xF7, 0xBE, 0xCA, 0xB1, 0x44, 0xB5, 0xB6, 0xB9, 0xBC, 0xCC, 0xC2, 0xCC, 0xC2, 0xCC, 0xC2, 0xCC, 0xC2,
-    0x41, 0x85, 0xD6, 0x42, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0xB1, 0xFF, 0xEF, 0xFF, 0xFC, 0xCA, 0x97, 0x47, 0xB4,
-    0xB5, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xCB, 0x5F, 0xD1, 0xD6, 0xD1, 0xD6, 0xCB, 0x5F, 0xCB, 0x5F, 0xCB, 0x5F, 0xD1,
-    0xD6, 0x42, 0xD0, 0xD1, 0xF4, 0x79, 0xFB, 0xF1, 0x21, 0x82, 0xF9, 0x42, 0xD0, 0xD1, 0xCC, 0xDB, 0xFF, 0xFD, 0x42,
-    0xB0, 0xB5, 0xCC, 0x7D, 0xCC, 0x7D, 0x42, 0x83, 0x91, 0xCC, 0x76, 0xCC, 0x76, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x48,
-    0x81, 0x82, 0x86, 0x87, 0x89, 0x8E, 0x8F, 0x91, 0xFF, 0xE6, 0xCB, 0x25, 0xCB, 0x25, 0xCB, 0x25, 0xFF, 0xFB, 0xD1,
-    0x9C, 0xD1, 0x9C, 0xD1, 0x9C, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEB, 0x65, 0xFF, 0xAD, 0xFF, 0xE7, 0xCA, 0x37, 0x41,
-    0xB6, 0xCC, 0x44, 0x42, 0x81, 0x82, 0xDD, 0xC0, 0xCA, 0xA0, 0xC4, 0x00, 0xA1, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0x39,
-    0xFF, 0xF5, 0xFF, 0xF9, 0xCA, 0x1F, 0x42, 0xB8, 0xBE, 0xCA, 0x3E, 0xD1, 0x5C, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFD,
-    0x8E, 0x43, 0xB2, 0xB4, 0xBC, 0xFF, 0xF9, 0xCA, 0xD7, 0xD1, 0x4E, 0x42, 0x80, 0x85, 0xEA, 0x67, 0xD1, 0x44, 0xC4,
-    0x02, 0xB1, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x3D, 0xFF, 0xEF, 0xFF, 0xF9, 0xC9, 0xF1, 0x41, 0xD0, 0xFC, 0xF3, 0x44,
-    0xB4, 0xB7, 0xBA, 0xBD, 0xCA, 0x2C, 0xFF, 0xFC, 0xCE, 0x5D, 0xCB, 0xF8, 0x41, 0xBA, 0xFD, 0x14, 0x21, 0xD0, 0xFC,
-    0x42, 0x81, 0x85, 0xFF, 0xFD, 0xCB, 0xE4, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE5, 0xFF, 0xF9, 0xC9, 0xC3, 0x51, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x8A, 0x80, 0x88, 0x89, 0x8D, 0xFE, 0xA1, 0xD0,
-    0x5F, 0xFE, 0xFB, 0xDE, 0xCB, 0xFF, 0x08, 0xD1, 0x7B, 0xD0, 0x5F, 0xFF, 0x22, 0xFF, 0x82, 0xFF, 0x9A, 0xFF, 0xC8,
-    0xFF, 0xF6, 0xD4, 0x8F, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0x42, 0xD0, 0xD1, 0xFE, 0x38, 0xFF, 0xCC,
-    0x41, 0xD0, 0xEA, 0x27, 0xC1, 0x03, 0x91, 0xD0, 0xCE, 0x75, 0x42, 0x80, 0x8C, 0xC9, 0x69, 0xC9, 0x69, 0x21, 0xD1,
-    0xF9, 0x41, 0xBB, 0xD2, 0xEF, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBD, 0xFF, 0xE5, 0xFF,
-    0xE9, 0xFF, 0xF6, 0xCE, 0x6B, 0xD0, 0x51, 0xFF, 0xFD, 0xE2, 0x94, 0x41, 0xBB, 0xC9, 0x59, 0x41, 0x82, 0xFE, 0x3A,
-    0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xBE, 0xDF, 0x2D, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xCA, 0xF9, 0xC1, 0x03, 0x91,
-    0xD1, 0xCC, 0x0E, 0x45, 0x81, 0x82, 0x83, 0x84, 0x87, 0xFF, 0xEA, 0xFF, 0xF3, 0xC9, 0x24, 0xC9, 0x80, 0xFF, 0xFA,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBC, 0xFF, 0xF0, 0xC9, 0x1F, 0xC1, 0x01, 0xB1, 0xD1, 0xD7, 0xBE, 0x42, 0xB8, 0xBB,
-    0xC9, 0x2A, 0xFF, 0xFA, 0xC2, 0x09, 0x62, 0xD0, 0x2D, 0xFF, 0xF9, 0xC9, 0x08, 0x41, 0xBB, 0xD5, 0xA6, 0xC2, 0x05,
-    0x22, 0xD0, 0x2D, 0xFF, 0xFC, 0xC8, 0xFB, 0x41, 0xBD, 0xCB, 0xDD, 0x21, 0xD0, 0xFC, 0x42, 0xB3, 0xBB, 0xC8, 0xE0,
-    0xC8, 0xE0, 0x21, 0xD0, 0xF9, 0x41, 0xB0, 0xF7, 0x4E, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xEF, 0x91, 0x21, 0xD0, 0xFC,
-    0x41, 0xBC, 0xD5, 0x11, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB8, 0xBE, 0xF0, 0xFD, 0x21,
-    0xD0, 0xFB, 0x45, 0xB0, 0xB5, 0xB6, 0xB7, 0xB4, 0xFF, 0xD0, 0xFF, 0xDA, 0xFF, 0xE1, 0xCD, 0xC6, 0xFF, 0xFD, 0x41,
-    0x80, 0xD4, 0x7A, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x42, 0xD0, 0xD1, 0xD4, 0x6C, 0xFF, 0xFD, 0x41, 0xBC, 0xF3,
-    0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD,
-    0x21, 0xD0, 0xFD, 0x43, 0x81, 0x87, 0x82, 0xFF, 0xE0, 0xE0, 0xC0, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBC,
-    0xFF, 0xF6, 0xC8, 0x7A, 0x41, 0xD1, 0xF6, 0xA2, 0x43, 0xB2, 0xB4, 0xBD, 0xC8, 0x9A, 0xC9, 0x41, 0xC8, 0x9A, 0x21,
-    0xD0, 0xF6, 0x41, 0xB8, 0xC8, 0xBB, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x42, 0xB7,
-    0xBF, 0xC8, 0x45, 0xC8, 0x84, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCB, 0xAD, 0x24, 0xB3, 0xB7, 0xBA, 0xBE, 0xD2, 0xE0,
-    0xEF, 0xF9, 0x41, 0x81, 0xDA, 0x84, 0x42, 0xD0, 0xD1, 0xDC, 0x03, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xC8, 0x2B, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xDD, 0x39, 0xC8, 0x21, 0x42, 0xB5, 0xBB,
-    0xC8, 0x77, 0xC8, 0x77, 0x21, 0xD0, 0xF9, 0x21, 0xB5, 0xFD, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFD, 0xC8, 0x0B,
-    0x41, 0xB4, 0xC8, 0x5E, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDD, 0x3E, 0x44, 0xB5, 0xB6, 0xB9, 0xBC, 0xE9, 0x25, 0xC8,
-    0x56, 0xE9, 0x25, 0xE9, 0x25, 0x42, 0x80, 0x8E, 0xC8, 0x49, 0xE9, 0x18, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x43, 0xB0,
-    0xB5, 0xBE, 0xD5, 0x07, 0xFF, 0xE0, 0xFF, 0xFB, 0x43, 0x83, 0x8B, 0x91, 0xCA, 0xA4, 0xD4, 0xFD, 0xDD, 0x18, 0xC3,
-    0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF6, 0xC7, 0xCA, 0xC1, 0x03, 0x91, 0xD1, 0xC9, 0x71, 0x42, 0xD0,
-    0xD1, 0xD5, 0x37, 0xC9, 0x6B, 0x41, 0xD1, 0xCA, 0x42, 0x21, 0x81, 0xFC, 0x21, 0xD1, 0xFD, 0x41, 0xD0, 0xF7, 0xB1,
-    0x4A, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBF, 0xCA, 0xEF, 0xDB, 0xB0, 0xFF, 0xE5, 0xD5, 0x33,
-    0xFF, 0xEB, 0xFF, 0xF9, 0xFF, 0xFC, 0xD0, 0x7F, 0xCE, 0xEF, 0xCE, 0xEF, 0x44, 0xBA, 0xBC, 0xBD, 0xBF, 0xFA, 0x77,
-    0xC7, 0xB2, 0xC7, 0xB2, 0xCA, 0xD0, 0x21, 0xD0, 0xF3, 0x41, 0xB8, 0xCE, 0xC0, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xC9,
-    0x2D, 0x44, 0x80, 0x81, 0x82, 0x84, 0xD0, 0x77, 0xFF, 0xF2, 0xFF, 0xF9, 0xCE, 0xB5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xB9, 0xFF, 0xF3, 0xC7, 0x5C, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xCB, 0xB2, 0xC7, 0x52, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x2A, 0xFE, 0x41, 0xDC, 0x5B, 0xFE,
-    0x4E, 0xCE, 0x7C, 0xFE, 0xCF, 0xCF, 0x0B, 0xDB, 0x11, 0xFF, 0x1E, 0xFF, 0x28, 0xFF, 0x3E, 0xCF, 0x0B, 0xFF, 0x7F,
-    0xFF, 0xED, 0xFF, 0xF7, 0xCB, 0x58, 0x43, 0xB0, 0xB8, 0xBE, 0xED, 0xC5, 0xC7, 0xED, 0xD0, 0x9D, 0x41, 0x8B, 0xC7,
-    0x53, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xC7, 0x0A, 0x41, 0xD1, 0xEE, 0xE7, 0x43, 0xBA, 0xBD, 0xBE,
-    0xC6, 0xF1, 0xC6, 0xF1, 0xFF, 0xFC, 0x41, 0xB8, 0xD3, 0x99, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x03, 0x32,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xC6, 0xE8, 0x42, 0xBA, 0xBB, 0xCA, 0x28, 0xFB, 0xCD, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xCD, 0x30, 0x42, 0x80, 0x8C, 0xC7, 0x2A, 0xC7, 0x16, 0x21, 0xD1, 0xF9, 0x22, 0x81, 0x82, 0xEF, 0xFD,
-    0x42, 0xD1, 0x2D, 0xFF, 0xFB, 0xC6, 0xBF, 0x41, 0xB8, 0xC6, 0xC4, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xFC, 0xC6,
-    0xB4, 0x42, 0xB2, 0xBB, 0xC7, 0x0A, 0xC7, 0x0A, 0x21, 0xD0, 0xF9, 0x42, 0x82, 0x88, 0xC7, 0x00, 0xC7, 0x00, 0x21,
-    0xD1, 0xF9, 0x22, 0xB0, 0xB8, 0xF3, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xC6, 0x92, 0x41, 0xB5, 0xD3, 0x32, 0x41,
-    0x91, 0xD3, 0x2E, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xC6, 0x83, 0x41, 0xBC, 0xC9, 0xDF,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFC, 0xCB, 0xAD, 0xC6, 0x73, 0x42, 0x81, 0x8E, 0xC7, 0x3E, 0xC6, 0xC5, 0x43, 0x2E,
-    0xD1, 0x2D, 0xC7, 0x37, 0xFF, 0xF9, 0xC6, 0x62, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xC8, 0x0B, 0xC6, 0x58, 0x42, 0x80,
-    0x81, 0xC6, 0x7D, 0xE4, 0x9B, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xC6, 0x48, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x8A, 0x91, 0xFF, 0x37, 0xFF, 0x59, 0xCD, 0x74, 0xFF, 0x82,
-    0xFF, 0x8D, 0xCD, 0x74, 0xCE, 0x03, 0xFF, 0xAF, 0xD1, 0xB3, 0xFF, 0xBE, 0xFF, 0xCE, 0xFF, 0xDF, 0xFF, 0xE9, 0xF8,
-    0x1F, 0xFF, 0xF9, 0xD1, 0x17, 0xCA, 0x50, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xC4, 0xFF, 0xCC, 0x41, 0xB8, 0xD6,
-    0x60, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xCF, 0x28, 0x41, 0xB4, 0xC6, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0x81, 0xD2, 0x30,
-    0x42, 0xD0, 0xD1, 0xCD, 0x3D, 0xFF, 0xFC, 0x41, 0xBA, 0xE7, 0x15, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xCE, 0xBC, 0x21,
-    0xD0, 0xFC, 0x49, 0xB1, 0xB2, 0xB3, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBF, 0xFF, 0xD9, 0xC9, 0x2B, 0xD2, 0x3A, 0xFF,
-    0xE4, 0xC9, 0x25, 0xFF, 0xEB, 0xFF, 0xF6, 0xFF, 0xFD, 0xE8, 0xCB, 0xC1, 0x01, 0x31, 0xD1, 0xCA, 0x01, 0x42, 0xB0,
-    0xB8, 0xFF, 0xFA, 0xC9, 0x03, 0x21, 0xD0, 0xF9, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xDB, 0x9D, 0x21,
-    0xD1, 0xFC, 0x4A, 0x80, 0x81, 0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x8D, 0x8F, 0xFF, 0xF6, 0xC8, 0xEC, 0xF8, 0xF8,
-    0xFF, 0xFD, 0xC8, 0xEC, 0xC6, 0x75, 0xD5, 0x12, 0xC6, 0x75, 0xCB, 0xAC, 0xCC, 0xEC, 0xC3, 0x02, 0xB1, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xA8, 0xFF, 0xE1, 0xC5, 0x81, 0x44, 0xB2, 0xB8, 0xBB, 0xBE, 0xC6, 0x8E, 0xE2, 0x1E, 0xCF, 0xCC, 0xE1,
-    0xDA, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xC8, 0xCC, 0xC5, 0x68, 0x41, 0xD0, 0xD2, 0x50, 0x41, 0xB7,
-    0xC5, 0x64, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDE, 0xA2, 0x46, 0xB0, 0xB2, 0xB5, 0xB6, 0xB7, 0xBB, 0xFF, 0xF1, 0xC6,
-    0x66, 0xFF, 0xF9, 0xC5, 0x42, 0xC5, 0xD1, 0xC5, 0xAC, 0x41, 0xD0, 0xEA, 0x51, 0x43, 0xB0, 0xB5, 0xB8, 0xFF, 0xFC,
-    0xC5, 0x2B, 0xC8, 0x76, 0x42, 0x8F, 0x91, 0xC5, 0x8B, 0xC5, 0x21, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x41, 0xD0, 0xC5,
-    0x18, 0x43, 0x80, 0x81, 0x86, 0xFF, 0xF7, 0xFF, 0xFC, 0xC5, 0x7B, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xC5,
-    0xFF, 0xF6, 0xC5, 0x12, 0x41, 0x8F, 0xC5, 0x4E, 0xA1, 0x02, 0x21, 0xD1, 0xFC, 0x42, 0xB4, 0xBD, 0xC8, 0x49, 0xFF,
-    0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xBB, 0xBE, 0xC8, 0x3F, 0xC5, 0x44, 0x42, 0xB0, 0xBE, 0xC4, 0xE1, 0xC5, 0x1A, 0x21,
-    0xD0, 0xF9, 0x42, 0x80, 0x83, 0xFF, 0xFD, 0xC5, 0x2A, 0xA2, 0x03, 0x91, 0xD0, 0xD1, 0xE8, 0xF9, 0xC1, 0x01, 0xD1,
-    0xD0, 0xC5, 0xE0, 0x44, 0xB2, 0xBB, 0xBD, 0xBE, 0xC4, 0xFC, 0xC8, 0x1A, 0xC4, 0xFC, 0xC4, 0xFC, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF3, 0xC6, 0x74, 0x42, 0xB4, 0xBB, 0xC7, 0xFA, 0xC4, 0xAF, 0x41, 0xB5, 0xD2, 0x18, 0x21, 0xD0, 0xFC, 0x21,
-    0x80, 0xFD, 0xA2, 0x09, 0x83, 0xD0, 0xD1, 0xEF, 0xFD, 0x4C, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA,
-    0xBC, 0xBE, 0xBF, 0xC7, 0xEE, 0xFF, 0xAC, 0xC4, 0xF3, 0xFF, 0xC7, 0xFF, 0xCE, 0xCF, 0xC8, 0xFF, 0xE1, 0xC4, 0xF3,
-    0xE6, 0x25, 0xFE, 0xC6, 0xFF, 0xF9, 0xCD, 0x7E, 0x42, 0xB6, 0xBE, 0xC7, 0xC9, 0xF2, 0xEA, 0x21, 0xD0, 0xF9, 0x43,
-    0xBA, 0xBD, 0xBF, 0xC4, 0xC4, 0xCD, 0x4F, 0xC7, 0xBF, 0x43, 0x82, 0x85, 0x87, 0xC7, 0x54, 0xC7, 0xB5, 0xC7, 0xB5,
-    0x22, 0xD0, 0xD1, 0xEC, 0xF6, 0x42, 0xB2, 0xBB, 0xC7, 0xA6, 0xCD, 0x36, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xC7, 0xA2,
-    0x49, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0x8F, 0x91, 0xFF, 0xD6, 0xFF, 0xED, 0xFF, 0xF9, 0xCB, 0x98, 0xC8,
-    0xF1, 0xC6, 0x03, 0xE3, 0x2F, 0xC4, 0x9D, 0xC4, 0x94, 0xC4, 0x02, 0xB1, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0x8E, 0xFF,
-    0xE4, 0xCF, 0x03, 0xC4, 0x30, 0x41, 0xBE, 0xE0, 0x86, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x1D, 0x42,
-    0xBB, 0xBC, 0xC5, 0xCE, 0xC5, 0xCE, 0xA1, 0x02, 0xD1, 0xD0, 0xF9, 0x21, 0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0x82,
-    0xCD, 0x87, 0x42, 0xD0, 0xD1, 0xF7, 0x93, 0xFF, 0xFC, 0x21, 0x81, 0xF9, 0x21, 0xD1, 0xFD, 0x46, 0xB1, 0xB5, 0xB9,
-    0xBA, 0xBB, 0xBD, 0xCC, 0xCD, 0xD7, 0x23, 0xCB, 0x3D, 0xC8, 0x55, 0xFF, 0xEC, 0xFF, 0xFD, 0x41, 0xD0, 0xD7, 0xAC,
-    0x21, 0xBE, 0xFC, 0x21, 0xD0, 0xFD, 0x43, 0xBB, 0xBF, 0xBA, 0xC4, 0x02, 0xC3, 0xE0, 0xFF, 0xFD, 0x41, 0x2E, 0xCE,
-    0x21, 0x42, 0x82, 0x8C, 0xD5, 0x21, 0xFF, 0xFC, 0x22, 0xD0, 0xD1, 0xEB, 0xF9, 0x45, 0x81, 0x83, 0x85, 0x86, 0x89,
-    0xFF, 0xFB, 0xC3, 0xC6, 0xC3, 0xE8, 0xCB, 0x06, 0xCB, 0x06, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF,
-    0xF0, 0xC3, 0xAA, 0x42, 0xB1, 0xBF, 0xC6, 0x89, 0xC7, 0x77, 0x21, 0xD0, 0xF9, 0x43, 0xB2, 0xBB, 0xBE, 0xC3, 0x89,
-    0xC3, 0x89, 0xFF, 0xFD, 0x41, 0xBE, 0xC4, 0xA3, 0x21, 0xD0, 0xFC, 0x42, 0x80, 0x81, 0xFF, 0xFD, 0xC3, 0xB1, 0xC3,
-    0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9, 0xC3, 0x7C, 0x41, 0xD0, 0xE7, 0xE0, 0x21, 0xBE, 0xFC, 0xC2,
-    0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xFD, 0xC3, 0x69, 0xC1, 0x01, 0xE1, 0xD1, 0xC5, 0x13, 0x43, 0xB2, 0xB4, 0xBE, 0xC3,
-    0x88, 0xC3, 0x4F, 0xCC, 0x36, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xC5, 0x03, 0x42, 0x88, 0x91, 0xC3, 0x55, 0xCA, 0x95,
-    0x42, 0xD0, 0xD1, 0xD7, 0x3E, 0xFF, 0xF9, 0xA0, 0x0C, 0x23, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x48, 0xB1, 0xB2, 0xB4,
-    0xB5, 0xB7, 0xBA, 0xBC, 0xBB, 0xFF, 0xC0, 0xC7, 0x84, 0xFB, 0x68, 0xC7, 0xC5, 0xFF, 0xD0, 0xD2, 0x75, 0xFF, 0xDE,
-    0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xC9, 0xEE, 0xC8, 0x77, 0x43, 0xBA, 0xBB, 0xBF, 0xC6, 0xF5, 0xC4, 0x09, 0xC6, 0x4C,
-    0x41, 0x87, 0xC2, 0xEB, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x45, 0x80, 0x81, 0x82, 0x84, 0x8D, 0xFF, 0xE6, 0xFF, 0xFB,
-    0xCE, 0xB2, 0xCB, 0xC9, 0xC3, 0x3E, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xF0, 0xC2, 0xDD, 0x50,
-    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBC, 0xFD, 0x50, 0xD6,
-    0x99, 0xCA, 0x04, 0xFD, 0x69, 0xFD, 0xBF, 0xFE, 0xA1, 0xFE, 0xB4, 0xFF, 0x27, 0xFF, 0x55, 0xC9, 0x77, 0xFF, 0x68,
-    0xFF, 0xF4, 0xE6, 0xF9, 0xC6, 0xE0, 0xC6, 0xE0, 0xC6, 0xE0, 0x43, 0xB5, 0xB8, 0xBE, 0xCC, 0x25, 0xCC, 0x25, 0xC2,
-    0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xC2, 0x96, 0x42, 0xB5, 0xBE, 0xC2, 0x84, 0xC3, 0xDE, 0x21, 0xD0, 0xF9, 0xC1,
-    0x00, 0xA1, 0xD0, 0xC2, 0xA3, 0x41, 0xBA, 0xC3, 0x98, 0x21, 0xD0, 0xFC, 0x48, 0xB2, 0xB3, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBE, 0xBF, 0xD6, 0xDC, 0xC2, 0xD7, 0xFF, 0xF0, 0xFF, 0xF3, 0xD6, 0xDC, 0xC2, 0xD7, 0xFF, 0xFD, 0xC3, 0x02, 0xA0,
-    0x04, 0x72, 0x44, 0x82, 0x83, 0x84, 0x8A, 0xCB, 0x91, 0xCB, 0x91, 0xD6, 0xC0, 0xFF, 0xFD, 0xC3, 0x03, 0x32, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xF3, 0xC2, 0x4F, 0x41, 0xBA, 0xC2, 0xE9, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x43, 0xB2, 0xB8, 0xBC, 0xC3, 0x4F, 0xFF, 0xFD, 0xC2, 0x95, 0xA0, 0x03, 0x03, 0x42, 0xB3, 0xB6, 0xFF,
-    0xFD, 0xC2, 0x85, 0xC1, 0x06, 0x71, 0xD1, 0xCF, 0x4E, 0x42, 0x80, 0x81, 0xC2, 0x7B, 0xFF, 0xFA, 0xA2, 0x01, 0xB1,
-    0xD0, 0xD1, 0xEC, 0xF9, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xF9, 0xC2, 0x03, 0xD7, 0x11, 0xFC, 0xB2, 0xC1, 0x01,
-    0xB1, 0xD0, 0xF9, 0xFF, 0x43, 0x83, 0x8B, 0x8F, 0xFF, 0xFA, 0xC1, 0xF0, 0xC3, 0x14, 0x22, 0xD0, 0xD1, 0xE3, 0xF6,
-    0x21, 0x80, 0xFB, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xFD, 0xC1, 0xE9, 0x43, 0x82, 0x85, 0x8E,
-    0xC7, 0xE9, 0xC2, 0x0B, 0xC9, 0x29, 0xC2, 0x02, 0xB1, 0xD1, 0x2D, 0xFF, 0xF6, 0xC1, 0xD3, 0xC2, 0x00, 0x91, 0xD0,
-    0x2D, 0xCB, 0x48, 0xC1, 0xCA, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xC8, 0x2C, 0xC1, 0xC1, 0xC2, 0x02, 0x21, 0xD1, 0x2D,
-    0xC4, 0x91, 0xC1, 0xB8, 0xC2, 0x02, 0xB1, 0x2E, 0x2D, 0xC8, 0xFB, 0xC1, 0xAF, 0x44, 0xB5, 0xB8, 0xBA, 0xBE, 0xC3,
-    0xC0, 0xC3, 0xC0, 0xC2, 0x7B, 0xC3, 0xC0, 0x46, 0x81, 0x82, 0x87, 0x8E, 0x8F, 0x91, 0xC2, 0x6E, 0xC2, 0x6E, 0xC2,
-    0x6E, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xC2, 0x5B, 0xFF, 0xE0, 0xFF, 0xED, 0xC1,
-    0x86, 0xA0, 0x04, 0x23, 0x21, 0x80, 0xFD, 0xC2, 0x03, 0xE2, 0xD1, 0x2D, 0xFF, 0xFD, 0xC1, 0x73, 0x41, 0xB2, 0xC1,
-    0x9E, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xC1, 0x66, 0x41, 0xB1, 0xC4, 0xA9, 0xC2, 0x02, 0xB1, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xC1, 0x59, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E,
-    0x8F, 0x91, 0x8A, 0xFE, 0xBA, 0xFF, 0x01, 0xFF, 0x67, 0xFF, 0x7D, 0xCC, 0xC2, 0xFF, 0x86, 0xC9, 0x12, 0xFF, 0x8F,
-    0xFF, 0x98, 0xC9, 0x12, 0xFF, 0xA1, 0xFF, 0xCA, 0xF3, 0x2E, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF, 0xF7, 0xCC, 0x26, 0x42,
-    0xD0, 0xD1, 0xFE, 0x4B, 0xFF, 0xCC, 0x42, 0xB2, 0xBF, 0xC1, 0x30, 0xC1, 0x71, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF,
-    0xF9, 0xC1, 0x0E, 0x41, 0xD0, 0xF3, 0x32, 0x41, 0xB5, 0xE0, 0x46, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xD8, 0x95, 0x41,
-    0xB3, 0xC1, 0x9C, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xBC, 0xFF, 0xFD, 0xC4, 0xC8, 0x42, 0x81, 0x82, 0xC1, 0x39, 0xC1,
-    0xBD, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x45, 0xB0, 0xB8, 0xBB, 0xBC, 0xBE, 0xC1, 0xB1, 0xFF, 0xD7, 0xFF, 0xDF, 0xC2,
-    0xF6, 0xFF, 0xFB, 0x42, 0xB2, 0xBD, 0xC1, 0x11, 0xC1, 0x11, 0x42, 0x2E, 0xD0, 0xC1, 0x24, 0xFF, 0xF9, 0x21, 0xB0,
-    0xF9, 0xA1, 0x01, 0x31, 0xD0, 0xFD, 0x43, 0x80, 0x8A, 0x8C, 0xFF, 0xFB, 0xC2, 0xD0, 0xC1, 0x8B, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xD0, 0xFF, 0xF6, 0xC0, 0xAC, 0x42, 0xB0, 0xBE, 0xC0, 0xBD, 0xC1, 0x26, 0x21, 0xD0, 0xF9, 0x41, 0x88,
-    0xC1, 0x1C, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x42, 0xD0, 0xD1, 0xC0, 0xD9, 0xFF, 0xFD, 0x22, 0xBB, 0xBD, 0xEC,
-    0xF9, 0x41, 0xB8, 0xC1, 0x9B, 0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xBA, 0xC0, 0x70, 0xC0, 0xC9, 0x21, 0xD0, 0xF9, 0x44,
-    0x80, 0x81, 0x82, 0x85, 0xFF, 0xF3, 0xFF, 0xFD, 0xC0, 0x66, 0xC0, 0xD0, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xDD, 0xFF, 0xF3, 0xC0, 0x64, 0x43, 0xB0, 0xB8, 0xBE, 0xEB, 0xC3, 0xEB, 0xC3, 0xEB, 0xC3, 0x21, 0xD0, 0xF6, 0x42,
-    0xB5, 0xBB, 0xC8, 0xB6, 0xFF, 0xFD, 0x41, 0x80, 0xCE, 0xF1, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF,
-    0xFC, 0xC0, 0x40, 0x41, 0xBE, 0xC5, 0xB8, 0x21, 0xD0, 0xFC, 0x41, 0x8F, 0xF3, 0x08, 0x42, 0x2E, 0xD1, 0xC0, 0x44,
-    0xFF, 0xFC, 0xA0, 0x09, 0xB2, 0x42, 0xB0, 0xBC, 0xFF, 0xFD, 0xC8, 0x8A, 0x21, 0xD0, 0xF9, 0x41, 0xB8, 0xC2, 0xF2,
-    0x21, 0xD0, 0xFC, 0x42, 0x80, 0x8B, 0xC0, 0x1A, 0xC3, 0x33, 0x42, 0xD0, 0xD1, 0xC3, 0x2F, 0xFF, 0xF9, 0x41, 0xBB,
-    0xC3, 0x25, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBF, 0xB1, 0xEC, 0xFD, 0x42, 0x81, 0x82,
-    0xC0, 0xA3, 0xEC, 0x03, 0x22, 0xD0, 0xD1, 0xF4, 0xF9, 0x46, 0xB0, 0xB2, 0xB5, 0xB8, 0xBB, 0xBE, 0xEF, 0xC9, 0xFF,
-    0xB2, 0xFF, 0xB9, 0xFF, 0xCA, 0xFF, 0xD1, 0xFF, 0xFB, 0x45, 0xB3, 0xB6, 0xB7, 0xBA, 0xBB, 0xC0, 0x14, 0xBF, 0xFD,
-    0xBF, 0xFD, 0xBF, 0xFD, 0xC0, 0x14, 0x21, 0xD0, 0xF0, 0x41, 0xD0, 0xF4, 0xA0, 0x42, 0xB1, 0xB2, 0xBF, 0xFD, 0xBF,
-    0xE6, 0x21, 0xD0, 0xF9, 0x23, 0xB0, 0xB5, 0xBE, 0xEF, 0xF2, 0xFD, 0x21, 0x91, 0xEB, 0x22, 0xD0, 0xD1, 0xF6, 0xFD,
-    0x41, 0x87, 0xC2, 0xC4, 0x21, 0xD1, 0xFC, 0x41, 0xB0, 0xBF, 0xF7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xDE, 0xFE, 0x42,
-    0xBC, 0xBD, 0xFF, 0xF9, 0xBF, 0xEC, 0x21, 0xD0, 0xF9, 0xC1, 0x00, 0x91, 0xD0, 0xCC, 0x6E, 0x24, 0x80, 0x83, 0x8B,
-    0x8C, 0xD9, 0xE2, 0xF7, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x92, 0xFF, 0xF7, 0xBF, 0x74, 0x41, 0xBA, 0xBF, 0x85,
-    0x21, 0xD0, 0xFC, 0x42, 0xB5, 0xB8, 0xFF, 0xFD, 0xBF, 0x58, 0x21, 0xD0, 0xF9, 0x45, 0xB1, 0xB2, 0xB4, 0xB6, 0xBE,
-    0xBF, 0x87, 0xC0, 0x78, 0xBF, 0x4E, 0xFF, 0xFD, 0xBF, 0x87, 0xC1, 0x03, 0x12, 0xD1, 0xC2, 0x22, 0x41, 0xD0, 0xC9,
-    0x0B, 0x43, 0x81, 0x82, 0x86, 0xFF, 0xF6, 0xFF, 0xFC, 0xBF, 0x34, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDC,
-    0xFF, 0xF6, 0xBF, 0x35, 0x41, 0xB2, 0xDD, 0x2D, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xB5, 0xBF, 0x3D, 0xFF, 0xFD, 0x41,
-    0x83, 0xBF, 0x9F, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x21, 0xB4, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x0F, 0x41,
-    0xB2, 0xD6, 0x3E, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB2, 0xFF, 0xFD, 0xBF, 0xD6, 0x21, 0xD0, 0xF9, 0x43, 0xB0, 0xB5,
-    0xB8, 0xD4, 0xED, 0xD2, 0x29, 0xBE, 0xEC, 0x41, 0x8F, 0xD4, 0xE3, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x41, 0xBB, 0xC0,
-    0x53, 0x21, 0xD0, 0xFC, 0x42, 0xD0, 0xD1, 0xC3, 0x86, 0xCA, 0x41, 0x43, 0xB1, 0xBD, 0xBF, 0xBF, 0xEF, 0xBF, 0xAB,
-    0xBF, 0x35, 0x41, 0x80, 0xC3, 0xC4, 0xA2, 0x00, 0x91, 0xD0, 0xD1, 0xF2, 0xFC, 0x47, 0xB0, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xBD, 0xBE, 0xFF, 0xC7, 0xFF, 0xD8, 0xFF, 0xE1, 0xFF, 0xE4, 0xC8, 0x43, 0xBF, 0x0F, 0xFF, 0xF9, 0x41, 0xB3, 0xBE,
-    0xD9, 0x21, 0xD0, 0xFC, 0x42, 0xD0, 0xD1, 0xD3, 0x01, 0xCF, 0xED, 0x22, 0x83, 0x8B, 0xF6, 0xF9, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xD7, 0xFF, 0xFB, 0xBE, 0x98, 0xC1, 0x02, 0x92, 0xD0, 0xCA, 0xEB, 0x45, 0xB3, 0xB5, 0xB7, 0xBC, 0xBE,
-    0xFF, 0xFA, 0xBE, 0x94, 0xBE, 0x7D, 0xC4, 0x7C, 0xBE, 0x7D, 0xA0, 0x08, 0x13, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC3, 0x00, 0xD1, 0xD0, 0xD1, 0x2D, 0xFF, 0xDE, 0xFF, 0xFD,
-    0xBE, 0x66, 0x41, 0xB2, 0xC1, 0x1C, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0xA1,
-    0x01, 0xE1, 0xD0, 0xFD, 0x21, 0x81, 0xFB, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xFF, 0xFD, 0xBE, 0x42, 0x41, 0xBD, 0xC6,
-    0xA4, 0x21, 0xD0, 0xFC, 0x41, 0x8E, 0xBE, 0x4D, 0xA1, 0x05, 0x22, 0xD1, 0xFC, 0x43, 0xB1, 0xBB, 0xBF, 0xBE, 0x85,
-    0xC6, 0x94, 0xE8, 0x11, 0x21, 0xD0, 0xF6, 0x44, 0xB0, 0xB2, 0xBB, 0xBE, 0xFF, 0xE7, 0xBE, 0x11, 0xFF, 0xEE, 0xFF,
-    0xFD, 0x41, 0xD0, 0xDA, 0x0F, 0xC1, 0x02, 0xB1, 0xD0, 0xC0, 0x59, 0x43, 0x81, 0x82, 0x83, 0xFF, 0xF6, 0xFF, 0xFA,
-    0xD3, 0x9F, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xF6, 0xBD, 0xFB, 0x41, 0xB0, 0xD1, 0x21, 0x21,
-    0xD0, 0xFC, 0x41, 0xD0, 0xE7, 0xE9, 0x21, 0xBC, 0xFC, 0x21, 0xD0, 0xFD, 0x45, 0xB0, 0xB3, 0xB5, 0xB8, 0xBE, 0xBD,
-    0xF9, 0xFF, 0xF3, 0xBE, 0x23, 0xFF, 0xFD, 0xBD, 0xF9, 0xC1, 0x00, 0x91, 0xD0, 0xD2, 0xF7, 0x45, 0x83, 0x8B, 0x8E,
-    0x8F, 0x91, 0xFF, 0xFA, 0xBE, 0x0D, 0xBE, 0x0D, 0xBD, 0xE3, 0xBE, 0x0D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF,
-    0xF0, 0xBD, 0xB8, 0x41, 0xBC, 0xBE, 0x32, 0x41, 0x82, 0xBE, 0x2E, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0xB6, 0xBD,
-    0xBC, 0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xBE, 0xF4, 0xFD, 0x21, 0x91, 0xEF, 0x22, 0xD0, 0xD1, 0xF8, 0xFD, 0x44, 0xB0,
-    0xB1, 0xB5, 0xBD, 0xBD, 0xA8, 0xC1, 0xF1, 0xBE, 0x62, 0xFF, 0xFB, 0x41, 0x2E, 0xD1, 0xE4, 0x21, 0xB5, 0xFC, 0xA1,
-    0x01, 0xB1, 0xD0, 0xFD, 0xC1, 0x00, 0xA1, 0xD1, 0xCC, 0x1D, 0x45, 0x80, 0x87, 0x88, 0x8C, 0x91, 0xBD, 0xA2, 0xFF,
-    0xF5, 0xBD, 0xEF, 0xFF, 0xFA, 0xBE, 0x43, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD1, 0xFF, 0xF0, 0xBD, 0x5E, 0x41, 0xD1,
-    0xDC, 0x1C, 0x41, 0xBC, 0xC1, 0x29, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21,
-    0xD0, 0xFD, 0x45, 0xB0, 0xB4, 0xB5, 0xBE, 0xB8, 0xBD, 0x58, 0xBD, 0x8E, 0xFF, 0xE9, 0xC9, 0x47, 0xFF, 0xFD, 0x41,
-    0xB0, 0xC0, 0x0A, 0x42, 0xD1, 0xD0, 0xD1, 0x13, 0xFF, 0xFC, 0x21, 0x80, 0xF9, 0x21, 0xD1, 0xFD, 0x43, 0x80, 0x81,
-    0x82, 0xBD, 0x61, 0xBD, 0x6D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD5, 0xFF, 0xF6, 0xBD, 0x12, 0x41, 0xD1,
-    0xC3, 0x4E, 0x42, 0xBB, 0xBF, 0xBD, 0x63, 0xFF, 0xFC, 0x42, 0xD0, 0xD1, 0xC4, 0x12, 0xD0, 0x51, 0x43, 0x81, 0x82,
-    0x84, 0xFF, 0xF9, 0xBD, 0xAB, 0xBD, 0x55, 0xC3, 0x00, 0x92, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF6, 0xBC, 0xEC,
-    0x41, 0x80, 0xBC, 0xFB, 0x42, 0xD0, 0xD1, 0xFD, 0x72, 0xFF, 0xFC, 0x41, 0xB9, 0xBD, 0xEE, 0x42, 0x2E, 0xD0, 0xBD,
-    0x30, 0xFF, 0xFC, 0xC1, 0x00, 0xA1, 0xD1, 0xBF, 0xA3, 0x43, 0xB5, 0xB8, 0xBE, 0xFF, 0xF3, 0xFF, 0xFA, 0xBC, 0xB9,
-    0x42, 0x2E, 0xD1, 0xBD, 0x02, 0xC9, 0xE6, 0xC1, 0x00, 0xA1, 0xD1, 0xCD, 0xFC, 0x21, 0xD0, 0xD8, 0x23, 0x8E, 0x8F,
-    0x91, 0xF0, 0xF7, 0xFD, 0x22, 0xD0, 0xD1, 0xDF, 0xF9, 0x42, 0xB2, 0xB7, 0xC0, 0x71, 0xF3, 0xB0, 0x41, 0x88, 0xE6,
-    0x78, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x23, 0xB0, 0xBB, 0xBE, 0xB2, 0xEB, 0xFB, 0x42, 0xB5, 0xBE, 0xBD, 0x0B, 0xBC,
-    0x7C, 0x21, 0xD0, 0xF9, 0x42, 0x80, 0x82, 0xBD, 0x86, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xF9,
-    0xBC, 0x76, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xFB, 0x5E, 0xFB, 0xC0, 0xFC, 0x08, 0xFC, 0x2C, 0xFC, 0xF8, 0xFD, 0x37, 0xFD, 0x5D, 0xFD, 0xD4, 0xFE, 0x06, 0xFE,
-    0x2A, 0xFE, 0x71, 0xFE, 0xB4, 0xFF, 0x0E, 0xFF, 0x5A, 0xFF, 0x80, 0xFF, 0xF6, 0x41, 0xBB, 0xC9, 0xA0, 0x21, 0xD0,
-    0xFC, 0x41, 0xB3, 0xC4, 0x9F, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xFC, 0xE7, 0xBD, 0x41, 0xBF, 0xBC, 0x55, 0x21,
-    0xD0, 0xFC, 0x21, 0x81, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0x81, 0xE5, 0xF9, 0xA1, 0x00, 0x91, 0xD1, 0xFC,
-    0x46, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBE, 0xE2, 0x44, 0xFF, 0xD8, 0xD2, 0x05, 0xFF, 0xDF, 0xFF, 0xF2, 0xFF, 0xFB,
-    0xC1, 0x00, 0x91, 0xD1, 0xC4, 0xC9, 0x42, 0xB5, 0xBA, 0xBC, 0x3B, 0xFF, 0xFA, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xD8,
-    0xEE, 0x47, 0x82, 0x83, 0x86, 0x8B, 0x8E, 0x8F, 0x91, 0xC0, 0x8D, 0xFF, 0xF9, 0xBC, 0xBD, 0xBC, 0x2D, 0xBC, 0x2D,
-    0xBC, 0x2D, 0xBC, 0x2D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xC3, 0xFF, 0xEA, 0xBB, 0xD2, 0x42, 0xB4, 0xB6, 0xBB, 0xE3,
-    0xBF, 0xA1, 0x21, 0xD0, 0xF9, 0x41, 0xB0, 0xD0, 0x22, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x42, 0x2E, 0xD1, 0xBC, 0xCE,
-    0xCC, 0x36, 0xC1, 0x01, 0x31, 0x2E, 0xBC, 0x0D, 0x44, 0xB2, 0xB9, 0xBC, 0xBF, 0xBC, 0x07, 0xBB, 0xD6, 0xBB, 0xD6,
-    0xD1, 0x9E, 0x41, 0x8E, 0xBB, 0xC9, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x45, 0xB0, 0xB2, 0xB5, 0xB8, 0xBE, 0xFF, 0xDD,
-    0xC5, 0x14, 0xBB, 0xF1, 0xFF, 0xE4, 0xFF, 0xFB, 0x42, 0x2E, 0xD1, 0xBC, 0x9B, 0xFF, 0xE7, 0x42, 0x83, 0x91, 0xFF,
-    0xF9, 0xBB, 0xDA, 0x22, 0xD0, 0xD1, 0xE2, 0xF9, 0x41, 0xB9, 0xBB, 0xB7, 0x21, 0xD0, 0xFC, 0x41, 0xB3, 0xBB, 0xB0,
-    0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xBE, 0xF6, 0xFD, 0x41, 0xD1, 0xE6, 0xA5, 0x21, 0x8B, 0xFC, 0xA2, 0x00, 0x92, 0xD0,
-    0xD1, 0xF4, 0xFD, 0x42, 0xB8, 0xBE, 0xBB, 0x96, 0xFE, 0x46, 0x21, 0xD0, 0xF9, 0x41, 0xBC, 0xD1, 0x3A, 0x21, 0xD0,
-    0xFC, 0x21, 0xB8, 0xFD, 0x41, 0x8F, 0xBF, 0x9E, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x42, 0x83, 0x8F, 0xD1, 0x27, 0xBB,
-    0x26, 0x42, 0xD0, 0xD1, 0xE1, 0xE5, 0xFF, 0xF9, 0x41, 0xBC, 0xCD, 0x6E, 0x21, 0xD0, 0xFC, 0x48, 0xB0, 0xB1, 0xBA,
-    0xBB, 0xBC, 0xBD, 0xBF, 0xBE, 0xFF, 0x5B, 0xFF, 0x62, 0xFF, 0xA8, 0xFF, 0xC7, 0xFF, 0xD5, 0xFF, 0xE6, 0xFF, 0xF2,
-    0xFF, 0xFD, 0x42, 0xB2, 0xBC, 0xBA, 0xF8, 0xC8, 0x68, 0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xBB, 0x17, 0x21, 0x80, 0xFC,
-    0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xBE, 0x2E, 0xFF, 0xFD, 0x41, 0xD1, 0xDC, 0x0C, 0x41, 0xD0, 0xCE, 0x1B, 0x41, 0xB2,
-    0xD0, 0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x47, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x88,
-    0xFF, 0xD8, 0xFF, 0xE2, 0xFF, 0xEB, 0xBB, 0xA9, 0xFF, 0xEF, 0xD0, 0xCA, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xA2, 0xFF, 0xEA, 0xBA, 0xBE, 0x44, 0xB0, 0xB5, 0xB8, 0xBB, 0xBA, 0xFC, 0xBA, 0xE2, 0xBA, 0xE2, 0xBA, 0xE2, 0xC2,
-    0x01, 0xE1, 0xD0, 0xD1, 0xFF, 0xF3, 0xD8, 0xFF, 0x41, 0xBA, 0xC3, 0x09, 0x42, 0x80, 0x85, 0xBA, 0xB5, 0xC3, 0x05,
-    0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x41, 0xBD, 0xBD, 0x50, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0xA1, 0x00, 0xD1, 0xD0,
-    0xFD, 0x41, 0xB0, 0xCB, 0x66, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xFF, 0xD1, 0xBC,
-    0x92, 0xBC, 0x92, 0xFF, 0xE5, 0xFF, 0xF4, 0xFF, 0xFD, 0xBA, 0xD7, 0x43, 0xB1, 0xB4, 0xB7, 0xBA, 0x90, 0xBA, 0x90,
-    0xBA, 0x90, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xC1, 0xC4, 0x42, 0xB6, 0xBA, 0xBA, 0x7F, 0xBA, 0x7F, 0x42, 0x87, 0x88,
-    0xBA, 0x78, 0xBA, 0x78, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x43, 0xB4, 0xB5, 0xBA, 0xBA, 0x6C, 0xBA, 0x6C, 0xBA, 0x6C,
-    0x42, 0x81, 0x87, 0xBA, 0x62, 0xBA, 0x62, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xD0,
-    0xFF, 0xE5, 0xBA, 0x56, 0xFF, 0xFB, 0x42, 0xD0, 0xD1, 0xD6, 0x1B, 0xD7, 0xDC, 0x42, 0x83, 0x91, 0xFB, 0x6D, 0xFF,
-    0xF9, 0x22, 0xD0, 0xD1, 0xE5, 0xF9, 0x42, 0xD0, 0xD1, 0xBA, 0x5C, 0xDA, 0x7E, 0x42, 0xD0, 0xD1, 0xFF, 0x63, 0xFD,
-    0x21, 0x46, 0x80, 0x81, 0x83, 0x85, 0x8C, 0x91, 0xFF, 0xED, 0xBC, 0x1B, 0xFF, 0xF2, 0xBC, 0x14, 0xE6, 0x19, 0xFF,
-    0xF9, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0x6F, 0xFF, 0xED, 0xB9, 0xE7, 0x42, 0xB0, 0xBE, 0xBA, 0x23, 0xBA,
-    0x23, 0x21, 0xD0, 0xF9, 0x42, 0x81, 0x82, 0xE4, 0xD6, 0xFF, 0xFD, 0xC3, 0x00, 0x92, 0xD0, 0xD1, 0x2D, 0xCC, 0x56,
-    0xFF, 0xF9, 0xB9, 0xCA, 0x41, 0x88, 0xBA, 0x93, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x82, 0xBA, 0x6C, 0xBA, 0x8C, 0x42,
-    0xD0, 0xD1, 0xDE, 0xD3, 0xFF, 0xF9, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xEF, 0xB9, 0xC4, 0xBC, 0x72, 0xFF, 0xF9,
-    0x42, 0x80, 0x91, 0xBA, 0x51, 0xB9, 0xB7, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xB9, 0x95, 0x42, 0x8B,
-    0x8F, 0xB9, 0xB9, 0xB9, 0xEA, 0x21, 0xD1, 0xF9, 0x44, 0xB8, 0xBB, 0xBC, 0xBE, 0xBA, 0x56, 0xFF, 0xFD, 0xBA, 0x02,
-    0xD8, 0x38, 0x42, 0x80, 0x83, 0xB9, 0xB9, 0xB9, 0xB9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xB9, 0x6D,
-    0x42, 0xD0, 0x2D, 0xC3, 0x2B, 0xB9, 0x63, 0x42, 0xB5, 0xB8, 0xB9, 0x8A, 0xB9, 0x77, 0xA1, 0x01, 0xB1, 0xD0, 0xF9,
-    0x42, 0xB0, 0xBB, 0xD5, 0xB5, 0xFF, 0xFB, 0xC1, 0x00, 0x91, 0xD0, 0xF5, 0xBF, 0x21, 0x82, 0xFA, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xB9, 0x40, 0x41, 0xD0, 0xDC, 0x17, 0x41, 0xBA, 0xE9, 0x56, 0x21, 0xD0, 0xFC, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xBB, 0xBF, 0xFF, 0xEF, 0xBC, 0x65, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF6, 0xBB, 0xF4, 0xB9, 0x1B, 0x41, 0x82, 0xB9, 0x45, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xB9, 0x0D, 0x43, 0xB2,
-    0xB4, 0xB7, 0xB8, 0xFB, 0xB8, 0xFB, 0xB8, 0xFB, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xE6, 0xF7, 0xB8,
-    0xFC, 0x41, 0xB6, 0xB9, 0xF9, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFC, 0xB8, 0xEC, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFD, 0x11, 0xFE, 0x25, 0xFE, 0xFC,
-    0xFF, 0x19, 0xFF, 0x4E, 0xFF, 0x76, 0xFF, 0x80, 0xFF, 0xA3, 0xFF, 0xC8, 0xFF, 0xD6, 0xC0, 0xA5, 0xFF, 0xE7, 0xFF,
-    0xF7, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0x42, 0xD0, 0xD1, 0xFC, 0x43, 0xFF, 0xCC, 0x42, 0xB8, 0xBB,
-    0xC4, 0xBF, 0xB8, 0xB4, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xDF, 0x22, 0x44, 0xB2, 0xB4, 0xB5, 0xB7, 0xFF, 0xF9, 0xBD,
-    0x3F, 0xCB, 0xCC, 0xBD, 0xA2, 0x43, 0xB0, 0xB5, 0xBE, 0xB8, 0xE9, 0xB8, 0xBB, 0xB8, 0xE9, 0x42, 0x83, 0x8B, 0xB8,
-    0xDF, 0xBA, 0x3D, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x21, 0x82, 0xFB, 0x42, 0xD0, 0xD1, 0xBC, 0xEF, 0xFF, 0xFD, 0x41,
-    0x80, 0xBD, 0x75, 0x21, 0xD1, 0xFC, 0x46, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0xFF, 0xF2, 0xFF, 0xFD, 0xCB, 0x98,
-    0xB8, 0xAE, 0xC1, 0x74, 0xBB, 0x43, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xED, 0xB8, 0x53, 0x41, 0xBD, 0xBA,
-    0x03, 0x21, 0xD0, 0xFC, 0x42, 0xB2, 0xB8, 0xB8, 0x37, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0xC1, 0x01, 0xB1, 0xD0, 0xFE,
-    0x5D, 0x41, 0xB0, 0xB9, 0xEC, 0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xD1, 0xDE, 0xA6, 0x41,
-    0xBB, 0xC2, 0x78, 0x21, 0xD0, 0xFC, 0x25, 0xB4, 0xB7, 0xBA, 0xBB, 0xBF, 0xDF, 0xE2, 0xF2, 0xF5, 0xFD, 0xA0, 0x0A,
-    0x02, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB8, 0xB5, 0xC8, 0x5C, 0xFF,
-    0xFD, 0x21, 0xD0, 0xF9, 0x42, 0xBA, 0xBD, 0xB9, 0xB0, 0xB7, 0xEB, 0x43, 0x82, 0x86, 0x87, 0xEF, 0x45, 0xB7, 0xE4,
-    0xB7, 0xE4, 0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x44, 0x80, 0x81, 0x82, 0x88, 0xFF, 0xE7, 0xFF, 0xFB, 0xBC, 0x85, 0xBA,
-    0xBD, 0xC3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xF3, 0xB7, 0xD3, 0x41, 0x82, 0xE4, 0x25, 0x21, 0xD1,
-    0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBC, 0xC5, 0x1F, 0x21, 0xD0, 0xFC, 0x41, 0xBA, 0xBE, 0xFF, 0x21,
-    0xD0, 0xFC, 0x44, 0xB0, 0xB6, 0xBA, 0xBD, 0xFF, 0xEF, 0xFF, 0xF6, 0xBE, 0x9A, 0xFF, 0xFD, 0x41, 0x8F, 0xBE, 0xEB,
-    0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xB7, 0x95, 0xC1, 0x01, 0x92,
-    0x2D, 0xB7, 0x8B, 0x42, 0x2E, 0xD1, 0xD8, 0xB3, 0xD3, 0xE6, 0x42, 0x2E, 0xD1, 0xB7, 0xC3, 0xD4, 0x7D, 0xC1, 0x02,
-    0x21, 0xD0, 0xC4, 0x6B, 0xA0, 0x06, 0xD2, 0x23, 0xBC, 0xBD, 0xBE, 0xF0, 0xF7, 0xFD, 0x41, 0xBA, 0xB9, 0xF5, 0x21,
-    0xD0, 0xFC, 0x42, 0x81, 0x8E, 0xFF, 0xFD, 0xB7, 0xA5, 0x22, 0xD0, 0xD1, 0xEB, 0xF9, 0x42, 0xB2, 0xBA, 0xB8, 0x29,
-    0xC3, 0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xB2, 0xB3, 0xB8, 0x1F, 0xB8, 0x1F, 0x42, 0x2E, 0xD0, 0xB8, 0x18, 0xFF, 0xF9,
-    0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xB7, 0xE3, 0xEF, 0xF9, 0x43, 0xB9, 0xBC, 0xBD, 0xB8, 0x08, 0xB8, 0x08, 0xB7, 0x78,
-    0x41, 0x85, 0xB7, 0x6E, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x42, 0x2E, 0xD1, 0xB7, 0xF5, 0xC9, 0xC1, 0x41, 0xD1, 0xE5,
-    0xAA, 0x41, 0xBD, 0xFF, 0x9E, 0x22, 0xD0, 0xD1, 0xFC, 0xB1, 0x24, 0x8B, 0x8E, 0x8F, 0x91, 0xE7, 0xEC, 0xF3, 0xFB,
-    0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB7, 0xD8, 0xFF, 0xC7, 0xFF, 0xF7, 0xB7, 0x03, 0xA0, 0x06, 0xB2, 0x42, 0xB0, 0xBE,
-    0xB7, 0x0E, 0xFF, 0xFD, 0x41, 0x8B, 0xB7, 0x07, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xB6,
-    0xE8, 0x41, 0x81, 0xBF, 0xB8, 0x42, 0xD0, 0xD1, 0xB8, 0xD6, 0xFF, 0xFC, 0x43, 0xBA, 0xBC, 0xB4, 0xC3, 0x0F, 0xBE,
-    0x9F, 0xB7, 0x52, 0x21, 0xD0, 0xF6, 0x42, 0xB2, 0xBE, 0xC0, 0x46, 0xFF, 0xFD, 0x41, 0xBE, 0xC2, 0xFB, 0x21, 0xD0,
-    0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x22, 0xD0, 0xD1, 0xE9, 0xFD, 0x42, 0xBB, 0xB6, 0xB6,
-    0xF9, 0xB6, 0xF9, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xD9, 0x60, 0x44, 0xB2, 0xB4, 0xBB, 0xBD, 0xBC, 0x1E, 0xBB, 0xA2,
-    0xB9, 0xE6, 0xB6, 0xC8, 0x21, 0xD0, 0xF3, 0x41, 0x89, 0xB6, 0xDB, 0x21, 0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xB6, 0xCE,
-    0xBD, 0x75, 0x21, 0xBD, 0xF9, 0x21, 0xD0, 0xFD, 0xA0, 0x09, 0xD3, 0x4A, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xB9,
-    0xBB, 0xBC, 0xBF, 0xB9, 0xBF, 0xFF, 0x9B, 0xFF, 0xC6, 0xFF, 0xD2, 0xFF, 0xE6, 0xFF, 0xED, 0xBD, 0xBF, 0xFE, 0xC4,
-    0xFF, 0xFA, 0xFF, 0xFD, 0x42, 0xB3, 0xB6, 0xB6, 0x99, 0xB6, 0xA5, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xBB, 0xBD, 0x41,
-    0xB8, 0xC9, 0x78, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x82, 0xB6, 0x87, 0xFF, 0xFD, 0xC2, 0x09, 0x42, 0xD0, 0xD1, 0xCC,
-    0x79, 0xFF, 0xF9, 0x42, 0xD0, 0xD1, 0xE2, 0x12, 0xBF, 0x57, 0x42, 0x8B, 0x8F, 0xB6, 0x1D, 0xB6, 0x1D, 0x42, 0xD0,
-    0xD1, 0xB7, 0x8C, 0xFF, 0xF9, 0x21, 0xBB, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0xB6, 0xB6, 0x65, 0x21, 0xD0, 0xFC, 0x47,
-    0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x91, 0xFF, 0xC0, 0xFF, 0xD5, 0xFF, 0xDE, 0xB9, 0x59, 0xFF, 0xF6, 0xDA, 0x5D,
-    0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x84, 0xFF, 0xEA, 0xB5, 0xF7, 0x41, 0xD0, 0xED, 0xEB, 0x21, 0xBE, 0xFC,
-    0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFD, 0xB5, 0xE6, 0x50, 0xB0, 0xB2, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE,
-    0xBF, 0xB1, 0xB3, 0xB6, 0xB7, 0xB9, 0xBC, 0xFD, 0x8A, 0xC9, 0xA5, 0xBD, 0x10, 0xFE, 0x0A, 0xFE, 0x48, 0xFE, 0x52,
-    0xFE, 0xDA, 0xFE, 0xF5, 0xFF, 0xE6, 0xFF, 0xF7, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9,
-    0xEC, 0x41, 0xB3, 0xB6, 0x08, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xC9, 0x9E, 0x21, 0xD0, 0xFC, 0x46, 0xB2, 0xB7, 0xB9,
-    0xBB, 0xBE, 0xBC, 0xBC, 0xEA, 0xB5, 0xFA, 0xB8, 0x89, 0xB5, 0xFA, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0x82, 0xBC, 0xD7,
-    0x22, 0xD0, 0xD1, 0xE9, 0xFC, 0x41, 0x8C, 0xC9, 0xAC, 0xA1, 0x01, 0xC1, 0xD1, 0xFC, 0x46, 0xB2, 0xB3, 0xB4, 0xBA,
-    0xBB, 0xBF, 0xB5, 0x85, 0xB8, 0x64, 0xB9, 0x52, 0xB5, 0x85, 0xFF, 0xFB, 0xB8, 0x64, 0xA0, 0x0C, 0x52, 0x21, 0xBA,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0x91, 0xFA, 0x22, 0xD0, 0xD1,
-    0xFA, 0xFD, 0x42, 0x86, 0x87, 0xB5, 0xAB, 0xFF, 0xFB, 0xA2, 0x01, 0xF1, 0xD0, 0xD1, 0xCC, 0xF9, 0x41, 0xBB, 0xB8,
-    0x29, 0x21, 0xD0, 0xFC, 0xC1, 0x02, 0x32, 0xD0, 0xE8, 0xAD, 0x46, 0xB1, 0xB4, 0xB6, 0xB7, 0xB8, 0xBF, 0xB9, 0xB0,
-    0xFF, 0xF7, 0xB9, 0x0A, 0xFF, 0xFA, 0xBC, 0x7D, 0xB5, 0x3D, 0x41, 0xBE, 0xC9, 0x48, 0x21, 0xD0, 0xFC, 0x21, 0x84,
-    0xFD, 0x22, 0xD0, 0xD1, 0xE3, 0xFD, 0x43, 0xB5, 0xB8, 0xBE, 0xFF, 0x88, 0xFF, 0xCA, 0xFF, 0xFB, 0x41, 0xD1, 0xFF,
-    0x7A, 0x43, 0x81, 0x83, 0x91, 0xB5, 0xD6, 0xB5, 0x60, 0xFF, 0xFC, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB5, 0xCC, 0xFF,
-    0xE8, 0xFF, 0xF6, 0xB4, 0xF7, 0x41, 0xD0, 0xEB, 0xEB, 0x41, 0x85, 0xC1, 0x8D, 0x42, 0xD0, 0xD1, 0xBD, 0x6E, 0xFF,
-    0xFC, 0x43, 0xB0, 0xB8, 0xBE, 0xFF, 0xF1, 0xFF, 0xF9, 0xB4, 0xF6, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xF6, 0xB4,
-    0xD1, 0x42, 0xD1, 0xD0, 0xFF, 0xE2, 0xFA, 0x41, 0x42, 0xB2, 0xB8, 0xC9, 0x25, 0xFF, 0xF9, 0xC3, 0x03, 0x32, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xB5, 0xA2, 0xB4, 0xBA, 0x41, 0xBD, 0xB4, 0xBA, 0x21, 0xD0, 0xFC, 0x42, 0xB1, 0xB3, 0xBB,
-    0xF3, 0xFF, 0xFD, 0x41, 0xBA, 0xB9, 0x98, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xBA, 0xF7, 0x42, 0x81, 0x82, 0xFF, 0xF9,
-    0xE9, 0xC6, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xF9, 0xB4, 0x8E, 0x43, 0x2E, 0xD1, 0x2D, 0xB5, 0x59, 0xB7,
-    0x49, 0xB4, 0x84, 0x42, 0xD1, 0x2D, 0xBD, 0x31, 0xB4, 0x7A, 0xC1, 0x02, 0x52, 0x2D, 0xB4, 0x73, 0x41, 0xD1, 0xEB,
-    0xC6, 0x42, 0x81, 0x82, 0xFF, 0xFC, 0xB9, 0x0E, 0xC2, 0x01, 0x31, 0xD1, 0x2D, 0xFF, 0xF9, 0xB4, 0x62, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8D, 0x8E, 0x91, 0x8A, 0x8B, 0x8F, 0xFF, 0x62, 0xFF,
-    0x88, 0xFF, 0x9F, 0xFF, 0xCB, 0xBF, 0xCB, 0xBB, 0x9F, 0xBC, 0x1B, 0xFC, 0xCE, 0xBC, 0x1B, 0xBC, 0x1B, 0xFF, 0xD5,
-    0xFF, 0xDF, 0xFF, 0xE6, 0xFF, 0xF7, 0xBF, 0x2F, 0xB8, 0x68, 0xB8, 0x68, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0x48,
-    0xFF, 0xCC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xBA, 0xFC, 0xBF, 0x2D, 0xC4, 0x2B, 0xC7, 0x45, 0xCD, 0x30, 0xD5, 0x06, 0xD6, 0xB9, 0xDB, 0x83, 0xE1, 0x22, 0xE2,
-    0x0E, 0xE6, 0x34, 0xEA, 0x97, 0xEE, 0x0F, 0xF3, 0x00, 0xFB, 0x6D, 0xFF, 0xF7, 0x42, 0xBB, 0xBE, 0xB3, 0xE0, 0xB6,
-    0x05, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB5, 0xA1, 0x41, 0xBD, 0xE5, 0x5E, 0x21, 0xD0, 0xFC, 0x41, 0xB1, 0xFB, 0xC7,
-    0x21, 0xD0, 0xFC, 0x42, 0xB6, 0xBE, 0xB4, 0x20, 0xFF, 0xFD, 0x41, 0x86, 0xB3, 0xBD, 0x22, 0xD0, 0xD1, 0xF5, 0xFC,
-    0x41, 0x83, 0xB8, 0x64, 0x21, 0xD1, 0xFC, 0x41, 0xB9, 0xB3, 0xAD, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x42, 0xD0,
-    0xD1, 0xFF, 0xFD, 0xC9, 0x9E, 0x41, 0xB7, 0xB5, 0xC1, 0x21, 0xD0, 0xFC, 0x43, 0xB2, 0xB8, 0xBB, 0xB3, 0xF1, 0xFF,
-    0xFD, 0xC1, 0x05, 0x21, 0xD0, 0xF6, 0x42, 0xBA, 0xBD, 0xB5, 0xAD, 0xB5, 0xAD, 0x21, 0xD0, 0xF9, 0x41, 0x85, 0xB3,
-    0x7E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x41, 0x81, 0xB6, 0xA1, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x4C, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB3, 0xC7, 0xFF, 0x92, 0xFF, 0x9D, 0xBF, 0xD0, 0xFF,
-    0xB2, 0xFF, 0xBB, 0xFF, 0xC8, 0xFF, 0xE0, 0xB8, 0x61, 0xFF, 0xEA, 0xFF, 0xFB, 0xE6, 0x76, 0x43, 0xBA, 0xBB, 0xBF,
-    0xB7, 0x2A, 0xB5, 0x6B, 0xB3, 0x5D, 0x42, 0xB0, 0xBB, 0xB5, 0x61, 0xB7, 0x20, 0xA1, 0x01, 0xF1, 0xD0, 0xF9, 0x21,
-    0x82, 0xFB, 0x22, 0xD0, 0xD1, 0xE7, 0xFD, 0x42, 0xB0, 0xB2, 0xB7, 0x8A, 0xB3, 0x8F, 0x42, 0xD0, 0xD1, 0xFF, 0xF9,
-    0xB6, 0x7B, 0xC1, 0x02, 0xB1, 0xD1, 0xB5, 0xEA, 0x46, 0x81, 0x82, 0x85, 0x89, 0x8E, 0x8F, 0xFF, 0xE7, 0xFF, 0xF3,
-    0xB5, 0x71, 0xDD, 0x28, 0xB5, 0x39, 0xFF, 0xFA, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB5, 0x26, 0xFF, 0x96, 0xFF, 0xED,
-    0xB3, 0x0C, 0x43, 0xB0, 0xB5, 0xBE, 0xB2, 0xF4, 0xB3, 0x5E, 0xB2, 0xF4, 0x42, 0x8E, 0x91, 0xB2, 0xEA, 0xB3, 0x54,
-    0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x41, 0x81, 0xB2, 0xF5, 0x21, 0xD1, 0xFC, 0x22, 0xBB, 0xBE, 0xF4, 0xFD, 0xC2, 0x03,
-    0x32, 0xD0, 0x2D, 0xFF, 0xFB, 0xB2, 0xDD, 0x42, 0xB2, 0xBA, 0xBB, 0x10, 0xB2, 0xEF, 0x42, 0x80, 0x82, 0xB2, 0xE8,
-    0xF7, 0xD4, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x42, 0xB6, 0xBE, 0xB2, 0xDC, 0xB3, 0x20, 0x41, 0x82, 0xB4, 0xD4, 0x22,
-    0xD0, 0xD1, 0xF5, 0xFC, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xBB, 0x3D, 0xB5, 0x7D, 0x41, 0xB4, 0xB3, 0x4E, 0x21, 0xD0,
-    0xFC, 0x21, 0xB7, 0xFD, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xD3, 0xE3, 0xE8, 0xFB, 0x21,
-    0xD1, 0xD6, 0x42, 0x8C, 0x91, 0xB2, 0xD2, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xF9, 0xB2, 0x86,
-    0x43, 0xB2, 0xBB, 0xBD, 0xB2, 0xDB, 0xB3, 0x95, 0xB2, 0xDB, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xB5,
-    0xD6, 0xB2, 0x72, 0x41, 0xD0, 0xB2, 0xBA, 0x46, 0xB0, 0xB2, 0xB6, 0xB8, 0xBB, 0xBE, 0xCE, 0xC7, 0xB3, 0x7B, 0xB2,
-    0x57, 0xFF, 0xFC, 0xB2, 0xC1, 0xB9, 0xD2, 0x41, 0x86, 0xB2, 0xAE, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9,
-    0xFF, 0xFC, 0xB2, 0x4B, 0x41, 0xD1, 0xC8, 0x42, 0x42, 0xBB, 0xBD, 0xFF, 0xFC, 0xB2, 0x8C, 0x21, 0xD0, 0xF9, 0xA0,
-    0x0A, 0x21, 0x21, 0xBB, 0xFD, 0xA1, 0x05, 0x93, 0xD0, 0xFD, 0x21, 0xBF, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB7,
-    0x5D, 0x21, 0xBE, 0xF9, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xB4, 0xBB, 0xB2, 0x67, 0xB2, 0x67, 0xB2, 0x67, 0x21, 0xD0,
-    0xF6, 0x41, 0xB8, 0xB4, 0xCB, 0xA1, 0x04, 0x82, 0xD0, 0xFC, 0x21, 0xB4, 0xFB, 0x21, 0xD0, 0xFD, 0x44, 0xBA, 0xBB,
-    0xBD, 0xBE, 0xB4, 0x14, 0xB5, 0x46, 0xB2, 0x74, 0xC0, 0xF0, 0x42, 0x80, 0x83, 0xB2, 0x1B, 0xB2, 0x3E, 0x22, 0xD0,
-    0xD1, 0xEC, 0xF9, 0x42, 0xD0, 0xD1, 0xC5, 0xAF, 0xC8, 0x91, 0x41, 0xB3, 0xE1, 0xFE, 0xA1, 0x03, 0x91, 0xD0, 0xFC,
-    0x42, 0xBD, 0xBE, 0xB2, 0x1F, 0xFF, 0xFB, 0x21, 0xD0, 0xF9, 0x42, 0xD0, 0xD1, 0xB7, 0x27, 0xC5, 0x5D, 0x42, 0xBD,
-    0xBF, 0xB1, 0xEE, 0xB1, 0xEE, 0x44, 0x80, 0x84, 0x85, 0x86, 0xB5, 0x05, 0xB5, 0x05, 0xB1, 0xE7, 0xB5, 0x05, 0x22,
-    0xD0, 0xD1, 0xEC, 0xF3, 0x4C, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB9, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xB3, 0x5E,
-    0xFF, 0x73, 0xFF, 0x8E, 0xFF, 0x9B, 0xFF, 0xAA, 0xFF, 0xC1, 0xC8, 0x5B, 0xFF, 0xC6, 0xFF, 0xDD, 0xFF, 0xE0, 0xFF,
-    0xFB, 0xC5, 0x41, 0x41, 0xD0, 0xE9, 0x23, 0x43, 0xBA, 0xBB, 0xBF, 0xFF, 0xFC, 0xB1, 0xAC, 0xB4, 0xCA, 0x41, 0xBC,
-    0xC8, 0xAA, 0x21, 0xD0, 0xFC, 0x43, 0x81, 0x82, 0x87, 0xFF, 0xFD, 0xF7, 0x99, 0xB1, 0x9B, 0x22, 0xD0, 0xD1, 0xE5,
-    0xF6, 0x41, 0x82, 0xBD, 0x75, 0x21, 0xD1, 0xFC, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x46, 0x80, 0x81, 0x82, 0x83,
-    0x87, 0x88, 0xBA, 0x2D, 0xFF, 0xEE, 0xE4, 0xA9, 0xFF, 0xFD, 0xCF, 0x9D, 0xC5, 0x5E, 0x44, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xB3, 0x58, 0xFF, 0x97, 0xFF, 0xED, 0xB1, 0x3E, 0x42, 0xBC, 0xBD, 0xB1, 0x4C, 0xB1, 0x4C, 0x42, 0x2E, 0xD0, 0xB1,
-    0x45, 0xFF, 0xF9, 0x42, 0xB0, 0xB4, 0xFF, 0xF9, 0xB1, 0xA7, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xB1, 0x1C, 0x42, 0xB2,
-    0xBE, 0xC7, 0x0B, 0xB1, 0x5A, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xF9, 0xB1, 0x0E, 0xC1, 0x01, 0xE1, 0xD1, 0xC1,
-    0x86, 0x43, 0xB8, 0xBB, 0xBD, 0xB1, 0xD4, 0xB2, 0x6E, 0xB9, 0xDB, 0x21, 0xD0, 0xF6, 0x42, 0xD0, 0xD1, 0xCD, 0x5F,
-    0xB4, 0x41, 0x42, 0xD0, 0xD1, 0xD3, 0xD9, 0xBC, 0xCA, 0x41, 0x87, 0xB9, 0xC0, 0x42, 0xD0, 0xD1, 0xEB, 0x00, 0xFF,
-    0xFC, 0xC1, 0x00, 0xA1, 0xD1, 0xDE, 0xF9, 0x42, 0x81, 0x82, 0xB1, 0x24, 0xB1, 0x01, 0x42, 0xD0, 0xD1, 0xD3, 0xC1,
-    0xFF, 0xF9, 0x4B, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBC, 0xBD, 0xBE, 0xB1, 0x0D, 0xFF, 0xC0, 0xEA,
-    0xE9, 0xFF, 0xD0, 0xFF, 0xD3, 0xFF, 0xDA, 0xDC, 0xAC, 0xB9, 0xFA, 0xFF, 0xE5, 0xFF, 0xEC, 0xFF, 0xF9, 0x42, 0xB1,
-    0xBF, 0xB0, 0xEB, 0xB1, 0x78, 0x41, 0x82, 0xDB, 0xF7, 0xA2, 0x03, 0x12, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB8, 0xC4,
-    0xBB, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x49, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x88,
-    0x8D, 0xB9, 0x60, 0xFF, 0xEC, 0xD4, 0xD1, 0xB2, 0x9E, 0xC1, 0x09, 0xB4, 0x79, 0xB2, 0x9E, 0xB2, 0x9E, 0xFF, 0xFD,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xA3, 0xFF, 0xE4, 0xB0, 0x68, 0x42, 0xB2, 0xBB, 0xB0, 0xBD, 0xB1, 0x77, 0xC3, 0x03,
-    0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xB9, 0x24, 0xB0, 0x57, 0x43, 0x8C, 0x8E, 0x8F, 0xB0, 0xAA, 0xB0, 0xA7, 0xB0,
-    0x66, 0xC2, 0x04, 0xC3, 0xD1, 0x2D, 0xFF, 0xF6, 0xB0, 0x41, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xD1, 0x5B, 0xB0, 0x38,
-    0x41, 0x81, 0xFD, 0xFE, 0x21, 0xD1, 0xFC, 0x42, 0xD0, 0xD1, 0xCE, 0x8D, 0xB0, 0xD1, 0x41, 0xD0, 0xE6, 0xD4, 0x21,
-    0x81, 0xFC, 0x21, 0xD1, 0xFD, 0xA0, 0x0C, 0x73, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xBE, 0xB8, 0xD7, 0xDA, 0xE8, 0xFD, 0xC2, 0x03, 0x32,
-    0xD0, 0x2D, 0xFF, 0xF7, 0xAF, 0xF9, 0x41, 0x8E, 0xB0, 0x41, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x42, 0xD1, 0xD0,
-    0xB0, 0x07, 0xFF, 0xFD, 0x21, 0xBB, 0xF9, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB3, 0x2B, 0x41, 0xBB, 0xB1, 0xEF, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x41, 0x80, 0xB4, 0x3C, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0xC2, 0x01, 0x31, 0xD0, 0xD1,
-    0xBF, 0x1A, 0xD5, 0x70, 0x44, 0xB2, 0xB7, 0xBB, 0xBE, 0xAF, 0xE7, 0xB8, 0x95, 0xFF, 0xF7, 0xDE, 0x26, 0x42, 0x80,
-    0x8C, 0xAF, 0xDA, 0xB1, 0xC6, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x42, 0xBB, 0xBC, 0xAF, 0xF1, 0xAF, 0xF1, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xD2, 0x58, 0x41, 0xD1, 0xDA, 0xBC, 0x42, 0xB0, 0xB2, 0xFF, 0xFC, 0xB2, 0xDA, 0x42, 0x80, 0x8B,
-    0xAF, 0xB5, 0xB9, 0x9F, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x41, 0xD1, 0xD5, 0xAC, 0x41, 0xBE, 0xBF, 0x07, 0x42, 0xD0,
-    0xD1, 0xFF, 0xFC, 0xDA, 0x9D, 0x42, 0x81, 0x86, 0xB1, 0x86, 0xB1, 0x86, 0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xCA, 0x21, 0xD0, 0xFD, 0x42, 0xB6, 0xBF, 0xB1, 0x70, 0xB1, 0x70, 0x21, 0xD0, 0xF9, 0x42,
-    0xB0, 0xBE, 0xFF, 0xFD, 0xDF, 0x29, 0x21, 0xD0, 0xF9, 0x41, 0xBF, 0xC2, 0x93, 0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xAF,
-    0x5C, 0x21, 0xBB, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB5, 0x7A, 0x4D, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x51, 0xB3, 0x91, 0xFF, 0x66, 0xFF, 0x88, 0xFF, 0x94, 0xFF, 0xAD, 0xFF,
-    0xB2, 0xFF, 0xBA, 0xFF, 0xCE, 0xFF, 0xD4, 0xFF, 0xE8, 0xFF, 0xEF, 0xFF, 0xF9, 0x42, 0xB3, 0xB6, 0xB8, 0x8A, 0xB2,
-    0x51, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB4, 0x6E, 0xC2, 0x01, 0x31, 0xD0, 0xD1, 0xAF, 0xFC, 0xC2, 0xE1, 0x44, 0xBA,
-    0xBB, 0xBC, 0xBF, 0xFF, 0xF7, 0xB1, 0x08, 0xAF, 0x1C, 0xB2, 0x3A, 0x43, 0x84, 0x88, 0x8E, 0xAF, 0x32, 0xB0, 0xFB,
-    0xB0, 0xFB, 0x22, 0xD0, 0xD1, 0xE9, 0xF6, 0xA0, 0x08, 0x42, 0x42, 0xB2, 0xBA, 0xFF, 0xFD, 0xB0, 0xE9, 0x41, 0xD0,
-    0xC4, 0xED, 0x21, 0x80, 0xFC, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0xC1, 0x02, 0xB1, 0xD0, 0xC0, 0x67, 0x41, 0xD0, 0xBA,
-    0x7E, 0x21, 0xB0, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB2, 0x13, 0x42, 0xBB, 0xBD, 0xAE, 0xF9, 0xAE, 0xF0, 0x21,
-    0xD0, 0xF9, 0x49, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x88, 0x8F, 0x91, 0xFF, 0xA0, 0xFF, 0xC7, 0xFF, 0xDD, 0xFF,
-    0xE2, 0xFF, 0xEF, 0xB2, 0x93, 0xFF, 0xFD, 0xFA, 0xFB, 0xC7, 0x12, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xB0, 0x9C, 0xFF,
-    0x55, 0xFF, 0xE4, 0xAE, 0x82, 0x41, 0x8E, 0xAE, 0xD4, 0x42, 0xD0, 0xD1, 0xAF, 0xDC, 0xFF, 0xFC, 0x21, 0xBB, 0xF9,
-    0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xFD, 0xAE, 0x67, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFB, 0x52, 0xFB, 0x81, 0xFB, 0xD8, 0xFB, 0xEC, 0xFC, 0x13, 0xFD, 0x20,
-    0xFD, 0x42, 0xFD, 0x50, 0xFD, 0xF6, 0xFE, 0x07, 0xFE, 0x1D, 0xFE, 0x26, 0xFE, 0x65, 0xFF, 0xDC, 0xFF, 0xF7, 0xB2,
-    0x6D, 0x43, 0xBA, 0xBD, 0xBF, 0xAE, 0x22, 0xAE, 0x8C, 0xAE, 0x22, 0xC1, 0x02, 0xD1, 0xD0, 0xBF, 0x06, 0x21, 0xB2,
-    0xFA, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xC3, 0x09, 0x62, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xAE, 0x14,
-    0x41, 0x82, 0xAF, 0x21, 0x42, 0xD0, 0xD1, 0xBA, 0xF8, 0xFF, 0xFC, 0x21, 0xBA, 0xF9, 0x21, 0xD0, 0xFD, 0x42, 0xB0,
-    0xBB, 0xAE, 0x3F, 0xAD, 0xEC, 0xA1, 0x02, 0x52, 0xD0, 0xF9, 0x41, 0xB1, 0xAF, 0x04, 0x41, 0x80, 0xEF, 0x40, 0x22,
-    0xD0, 0xD1, 0xF8, 0xFC, 0x44, 0xB0, 0xB2, 0xBC, 0xBE, 0xFF, 0xE4, 0xFF, 0xEE, 0xAE, 0x3D, 0xFF, 0xFB, 0xC1, 0x01,
-    0x31, 0xD0, 0xB2, 0xCC, 0x43, 0xB0, 0xB5, 0xB8, 0xFF, 0xFA, 0xAD, 0xF9, 0xAD, 0xF9, 0x21, 0xD0, 0xF6, 0x41, 0xB8,
-    0xB0, 0xE3, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x87, 0xB0, 0x45, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x41, 0xD1, 0xEF, 0x7B,
-    0x41, 0x87, 0xAD, 0xD7, 0x21, 0xD1, 0xFC, 0x24, 0x80, 0x83, 0x8C, 0x8F, 0xE1, 0xF2, 0xF5, 0xFD, 0xC3, 0x03, 0x32,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xBB, 0xFF, 0xF7, 0xAD, 0x99, 0x41, 0xD0, 0xC5, 0x4A, 0x41, 0xB0, 0xB2, 0x2E, 0x21, 0xD0,
-    0xFC, 0x41, 0xB9, 0xAF, 0x9C, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x46, 0xB1, 0xB3, 0xB4, 0xB6,
-    0xBA, 0xBB, 0xFF, 0xE8, 0xF8, 0xCB, 0xFF, 0xF0, 0xFF, 0xFD, 0xAF, 0xA5, 0xAF, 0x8F, 0x42, 0xBA, 0xBB, 0xAD, 0xBE,
-    0xAD, 0x6E, 0x42, 0xD0, 0xD1, 0xAD, 0xD2, 0xC0, 0xA8, 0x21, 0x82, 0xF9, 0x22, 0xD0, 0xD1, 0xEF, 0xFD, 0x42, 0xB0,
-    0xBE, 0xAF, 0x66, 0xAF, 0x66, 0x21, 0xD0, 0xF9, 0x44, 0x81, 0x82, 0x85, 0x87, 0xFF, 0xF1, 0xE2, 0x73, 0xFF, 0xFD,
-    0xBC, 0xD2, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAF, 0x4F, 0xFF, 0xC0, 0xFF, 0xF3, 0xAD, 0x35, 0x41, 0xBD, 0xAE, 0x41,
-    0x21, 0xD0, 0xFC, 0x41, 0xBE, 0xC3, 0x17, 0xA1, 0x01, 0x31, 0xD0, 0xFC, 0x41, 0xBF, 0xAE, 0x31, 0x21, 0xD0, 0xFC,
-    0x44, 0xB2, 0xB8, 0xBB, 0xBE, 0xAD, 0x70, 0xFF, 0xED, 0xFF, 0xF4, 0xFF, 0xFD, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xF3, 0xAE, 0xB7, 0xAD, 0x04, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xC1, 0xF7, 0xAC, 0xF8, 0x42, 0xBB, 0xBC, 0xAD,
-    0x4E, 0xAD, 0x4E, 0xC2, 0x03, 0x32, 0xD0, 0x2D, 0xFF, 0xF9, 0xAC, 0xE8, 0xC3, 0x02, 0x21, 0xD0, 0xD1, 0x2D, 0xEF,
-    0x31, 0xAF, 0xB8, 0xAC, 0xDF, 0x45, 0xB1, 0xB4, 0xB7, 0xBA, 0xBC, 0xAE, 0xED, 0xB3, 0xBE, 0xAD, 0xA8, 0xB1, 0x37,
-    0xAE, 0xED, 0x42, 0x81, 0x85, 0xFE, 0x0D, 0xAE, 0x7D, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAE, 0xD6, 0xFF, 0xE9, 0xFF,
-    0xF9, 0xAC, 0xBC, 0x43, 0xB5, 0xB8, 0xBA, 0xAE, 0xC9, 0xAE, 0xC9, 0xAD, 0x84, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xAD,
-    0x7A, 0xFF, 0xF6, 0xBC, 0x3F, 0xAC, 0xA5, 0x42, 0xD0, 0x2D, 0xB0, 0x89, 0xAC, 0x98, 0xC3, 0x00, 0xA1, 0x2E, 0xD1,
-    0x2D, 0xAE, 0xAB, 0xDA, 0xB1, 0xAC, 0x91, 0x41, 0x8E, 0xAE, 0x9F, 0x43, 0xD0, 0xD1, 0x2D, 0xEB, 0x17, 0xFF, 0xFC,
-    0xAC, 0x81, 0x43, 0xBA, 0xBD, 0xBE, 0xAE, 0x91, 0xAC, 0xF1, 0xBB, 0x6D, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xC9, 0xF7,
-    0x41, 0xD0, 0xDF, 0xE7, 0x44, 0xB7, 0xBA, 0xBC, 0xBD, 0xFF, 0xF5, 0xC3, 0x16, 0xFF, 0xFC, 0xDB, 0xD2, 0x41, 0x82,
-    0xF2, 0x81, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xAC, 0x4B, 0x51,
-    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xB3, 0x74,
-    0xFE, 0x2D, 0xFE, 0xA8, 0xFF, 0x0C, 0xE4, 0xEF, 0xFF, 0x3D, 0xFF, 0x49, 0xFF, 0x59, 0xFF, 0x62, 0xB4, 0x03, 0xCE,
-    0x85, 0xFF, 0x85, 0xFF, 0x9C, 0xFF, 0xA9, 0xFF, 0xB0, 0xFF, 0xC0, 0xFF, 0xF6, 0x42, 0xD0, 0xD1, 0xFD, 0xAF, 0xFF,
-    0xCC, 0x41, 0xBF, 0xB5, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBF, 0xAC, 0x3E, 0x21,
-    0xD0, 0xFC, 0x45, 0xB1, 0xB4, 0xBA, 0xBB, 0xBF, 0xB0, 0x56, 0xF3, 0xCD, 0xB8, 0x4C, 0xFF, 0xF6, 0xFF, 0xFD, 0x41,
-    0xBA, 0xB5, 0x67, 0x21, 0xD0, 0xFC, 0x42, 0xD0, 0xD1, 0xE2, 0x71, 0xAD, 0x8E, 0x45, 0x80, 0x82, 0x83, 0x84, 0x85,
-    0xFF, 0xF6, 0xFF, 0xF9, 0xBF, 0x06, 0xB2, 0xC2, 0xAF, 0x20, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xD2, 0xFF,
-    0xF0, 0xAB, 0xC4, 0x41, 0xBE, 0xC6, 0x12, 0xA1, 0x0A, 0x53, 0xD0, 0xFC, 0x21, 0xB7, 0xFB, 0x41, 0x81, 0xAF, 0x85,
-    0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x21, 0xB5, 0xFB, 0xA0, 0x0C, 0xA2, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83,
-    0xFD, 0x21, 0xD1, 0xFD, 0x44, 0x83, 0x8B, 0x8E, 0x80, 0xB3, 0xFC, 0xAB, 0xF0, 0xAC, 0x66, 0xFF, 0xFD, 0xC3, 0x0A,
-    0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xE1, 0xFF, 0xF3, 0xAB, 0x84, 0x41, 0xB5, 0xED, 0x43, 0xC2, 0x03, 0xE2, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xAB, 0x74, 0x43, 0xB8, 0xBD, 0xBE, 0xAB, 0xCA, 0xAB, 0xCA, 0xAB, 0xCA, 0xC2, 0x01, 0xB1, 0xD0, 0x2D,
-    0xFF, 0xF6, 0xAB, 0x61, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xAB, 0xB7, 0xAB, 0xB7, 0xAB, 0x73, 0xAB, 0xB7, 0xC3, 0x0A,
-    0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xAC, 0x45, 0xAB, 0x4B, 0x42, 0xB2, 0xBB, 0xAB, 0x6D, 0xAB, 0x9B, 0x42, 0x80,
-    0x81, 0xAC, 0xF2, 0xF9, 0x07, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x44, 0xB3, 0xB7, 0xBA, 0xBC, 0xB7, 0x8D, 0xAE, 0x78,
-    0xFF, 0xFB, 0xD3, 0xDA, 0x41, 0xB1, 0xAE, 0x0A, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0,
-    0xB5, 0xAB, 0x5A, 0xAB, 0x5A, 0x42, 0x80, 0x91, 0xAD, 0x99, 0xAB, 0x53, 0xA2, 0x01, 0xB1, 0xD0, 0xD1, 0xF2, 0xF9,
-    0x21, 0x82, 0xF9, 0x42, 0xD0, 0xD1, 0xAF, 0x4D, 0xFF, 0xFD, 0x22, 0x80, 0x81, 0xDE, 0xF9, 0xC3, 0x03, 0xE2, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xC2, 0xFF, 0xFB, 0xAA, 0xEE, 0x42, 0xBC, 0xBF, 0xAB, 0x10, 0xAB, 0x10, 0x21, 0xD0, 0xF9, 0x43,
-    0xB7, 0xBE, 0xBF, 0xB2, 0x24, 0xFF, 0xFD, 0xAF, 0x3C, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xAF, 0xE7,
-    0xAA, 0xCE, 0x42, 0xBC, 0xBD, 0xAB, 0x97, 0xC5, 0x90, 0x42, 0x84, 0x85, 0xB2, 0xF7, 0xAB, 0x90, 0x22, 0xD0, 0xD1,
-    0xF2, 0xF9, 0x41, 0xBD, 0xFE, 0x49, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xA1, 0xD0, 0xD5, 0xFF, 0x21, 0x8F, 0xFA, 0xA1,
-    0x01, 0xB1, 0xD1, 0xFD, 0x41, 0xB0, 0xAB, 0x6F, 0xA1, 0x00, 0x91, 0xD0, 0xFC, 0x42, 0xBD, 0xBF, 0xFF, 0xFB, 0xB7,
-    0xC1, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF0, 0xCC, 0x46, 0xB0, 0xB2, 0xB8, 0xBB, 0xBD, 0xBE, 0xFF, 0xCF, 0xD3, 0x98,
-    0xFF, 0xD8, 0xFF, 0xE4, 0xAB, 0x58, 0xFF, 0xF9, 0x41, 0xB1, 0xAB, 0x45, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB8, 0xAA,
-    0xAE, 0xFF, 0xFD, 0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x42, 0xD0, 0xD1, 0xC0, 0x00, 0xC0, 0x04, 0x43, 0x80, 0x81, 0x83,
-    0xFF, 0xF4, 0xAA, 0x84, 0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCB, 0x7A, 0xFF, 0xC9, 0xFF, 0xF6, 0xAA, 0x4C,
-    0x43, 0xB2, 0xB4, 0xBC, 0xAC, 0x59, 0xAC, 0x59, 0xAA, 0x84, 0x41, 0x8F, 0xB2, 0xA0, 0x43, 0x2E, 0xD0, 0xD1, 0xB2,
-    0x9C, 0xFF, 0xF2, 0xFF, 0xFC, 0x44, 0xB2, 0xB5, 0xB9, 0xBE, 0xAA, 0x42, 0xAA, 0x42, 0xAA, 0x6C, 0xAD, 0x12, 0x42,
-    0x82, 0x8E, 0xAA, 0x5F, 0xAA, 0x35, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x41, 0x86, 0xAA, 0xE3, 0x42, 0x2E, 0xD1, 0xB2,
-    0x75, 0xFF, 0xFC, 0x41, 0xD1, 0xAA, 0xEB, 0x42, 0xB6, 0xBC, 0xAA, 0x5E, 0xFF, 0xFC, 0x41, 0x81, 0xB2, 0x63, 0x43,
-    0x2E, 0xD0, 0xD1, 0xB2, 0x5F, 0xFF, 0xF5, 0xFF, 0xFC, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xB9, 0xD7, 0xE0, 0xF6, 0x41,
-    0x8E, 0xB2, 0x4C, 0x21, 0xD1, 0xFC, 0x43, 0xB5, 0xB9, 0xBC, 0xB2, 0x45, 0xB2, 0x45, 0xB2, 0x45, 0x21, 0xD0, 0xF6,
-    0x46, 0x83, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0xFF, 0xF0, 0xFF, 0xFD, 0xAA, 0xA2, 0xD4, 0x07, 0xB2, 0x38, 0xCC, 0x97,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xED, 0xA9, 0xBA, 0x42, 0x81, 0x8F, 0xAB, 0xCA, 0xBC, 0x74, 0x21, 0xD1,
-    0xF9, 0x21, 0xB5, 0xFD, 0x41, 0xD1, 0xEC, 0xC3, 0x21, 0x83, 0xFC, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6,
-    0xFF, 0xFD, 0xA9, 0x9C, 0x41, 0xB1, 0xB1, 0xCC, 0x42, 0x81, 0x8F, 0xA9, 0xEB, 0xAA, 0x61, 0x22, 0xD0, 0xD1, 0xF5,
-    0xF9, 0x41, 0xB6, 0xB1, 0xBC, 0x21, 0xD0, 0xFC, 0x41, 0xD0, 0xEE, 0xDB, 0xC1, 0x02, 0x21, 0xD0, 0xD4, 0x88, 0x24,
-    0xB0, 0xB5, 0xB8, 0xBE, 0xEA, 0xF3, 0xF6, 0xFA, 0x42, 0x83, 0x8B, 0xBA, 0x77, 0xB1, 0xD1, 0xC3, 0x00, 0x91, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xF9, 0xA9, 0x5F, 0x41, 0xB3, 0xAC, 0x9F, 0x21, 0xD0, 0xFC, 0x46, 0xB1, 0xB2, 0xB4,
-    0xB7, 0xBB, 0xBC, 0xAC, 0x9E, 0xDB, 0x8E, 0xA9, 0x7A, 0xAC, 0x98, 0xFF, 0xFD, 0xB2, 0x28, 0x41, 0xB8, 0xA9, 0xBA,
-    0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xAE, 0xA5, 0x42, 0xBA, 0xBF, 0xA9, 0x5C, 0xAC, 0x7A, 0x41, 0x80, 0xE9, 0x16, 0x21,
-    0xD1, 0xFC, 0x42, 0x8C, 0x82, 0xA9, 0x15, 0xFF, 0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xF9, 0x41, 0xB0, 0xB8, 0x86, 0x21,
-    0xD0, 0xFC, 0x21, 0xBA, 0xFD, 0x42, 0xD1, 0xD0, 0xB2, 0x32, 0xFF, 0xFD, 0x45, 0x80, 0x81, 0x82, 0x87, 0x88, 0xFF,
-    0xCE, 0xFF, 0xEA, 0xFF, 0xF9, 0xAC, 0xF8, 0xCB, 0xF5, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xA7, 0xFF, 0xF0,
-    0xA8, 0xF3, 0x43, 0xB5, 0xBB, 0xBD, 0xA9, 0x46, 0xA9, 0x46, 0xA9, 0x46, 0x44, 0x85, 0x86, 0x88, 0x8E, 0xA9, 0x3C,
-    0xB1, 0x19, 0xA9, 0x3C, 0xA9, 0x3C, 0x22, 0xD0, 0xD1, 0xE9, 0xF3, 0x41, 0x81, 0xDC, 0xE5, 0x42, 0xD0, 0xD1, 0xBD,
-    0x24, 0xFF, 0xFC, 0x42, 0xB7, 0xBB, 0xA9, 0x66, 0xA9, 0x95, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB5, 0xE5, 0x45, 0xB0,
-    0xB5, 0xB8, 0xBD, 0xBE, 0xBD, 0xB5, 0xFF, 0xE2, 0xFF, 0xEB, 0xA8, 0xCD, 0xFF, 0xF9, 0xC3, 0x01, 0xB1, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF0, 0xB9, 0x59, 0xA8, 0xA2, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xD2, 0xFD, 0x12, 0xFD, 0x22, 0xFD, 0x35, 0xFD, 0x4B, 0xFD, 0xA8, 0xB8, 0x53,
-    0xAF, 0x3C, 0xFD, 0xC8, 0xFE, 0x4A, 0xFE, 0xDC, 0xFE, 0xFA, 0xFF, 0x37, 0xFF, 0xA3, 0xFF, 0xF4, 0xAC, 0xA5, 0x42,
-    0x81, 0x82, 0xA8, 0xB6, 0xA8, 0xAA, 0x42, 0xD0, 0xD1, 0xB5, 0x49, 0xFF, 0xF9, 0x42, 0xB1, 0xB4, 0xB2, 0x49, 0xC7,
-    0x47, 0x21, 0xD0, 0xF9, 0x22, 0xB0, 0xB5, 0xEF, 0xFD, 0xC3, 0x02, 0xB1, 0x2E, 0xD0, 0x2D, 0xA9, 0x1D, 0xFF, 0xFB,
-    0xA8, 0x48, 0xA0, 0x0A, 0x82, 0xC1, 0x00, 0xA1, 0xD0, 0xA8, 0xC0, 0x41, 0x80, 0xA8, 0xE8, 0x21, 0xD1, 0xFC, 0x49,
-    0xB0, 0xB1, 0xB2, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xD9, 0x2F, 0xA8, 0x8B, 0xA8, 0x7A, 0xFF, 0xF0, 0xA8, 0xB0,
-    0xA8, 0x21, 0xFF, 0xF3, 0xFF, 0xFD, 0xA8, 0x21, 0x42, 0x82, 0x87, 0xA8, 0x61, 0xA8, 0x05, 0xC3, 0x03, 0x32, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xDD, 0xFF, 0xF9, 0xA8, 0x09, 0x43, 0xB5, 0xBB, 0xBE, 0xA9, 0xB4, 0xA8, 0xD2, 0xAC, 0x61, 0x43,
-    0x2E, 0xD0, 0xD1, 0xC9, 0x21, 0xFF, 0xF6, 0xAC, 0xF2, 0xA0, 0x0A, 0xA2, 0x43, 0xB9, 0xBB, 0xBD, 0xAA, 0x00, 0xAA,
-    0x00, 0xB3, 0x8D, 0x41, 0xB5, 0xA7, 0xF7, 0x42, 0x2E, 0xD0, 0xA7, 0xF3, 0xFF, 0xFC, 0x43, 0x82, 0x85, 0x88, 0xFF,
-    0xF9, 0xA7, 0xDD, 0xA7, 0xEC, 0xA3, 0x00, 0xA1, 0x2E, 0xD0, 0xD1, 0xDE, 0xE1, 0xF6, 0x42, 0x84, 0x8A, 0xA8, 0x93,
-    0xA8, 0x93, 0x42, 0xD0, 0xD1, 0xB3, 0x78, 0xFF, 0xF9, 0x44, 0xB5, 0xB8, 0xBC, 0xBD, 0xA8, 0x0F, 0xA8, 0x0F, 0xDB,
-    0x49, 0xFF, 0xF9, 0x43, 0x87, 0x88, 0x8E, 0xA8, 0x02, 0xE2, 0x47, 0xA8, 0x02, 0xA2, 0x02, 0xB1, 0xD0, 0xD1, 0xE9,
-    0xF6, 0xC2, 0x02, 0x21, 0xD0, 0xD1, 0xAB, 0xF2, 0xAA, 0x6B, 0x43, 0xB0, 0xB5, 0xB8, 0xA7, 0x7E, 0xA8, 0x0D, 0xFF,
-    0xF7, 0x42, 0x8F, 0x91, 0xA8, 0x54, 0xA8, 0x03, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0xC1, 0x02, 0xB1, 0xD0, 0xBE, 0xAC,
-    0x49, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBC, 0xBD, 0xD3, 0x24, 0xA9, 0x87, 0xFF, 0xFA, 0xA9, 0x87, 0xA9,
-    0x87, 0xB4, 0x14, 0xA9, 0x87, 0xA9, 0x87, 0xA9, 0x87, 0x42, 0xB3, 0xB6, 0xA8, 0x26, 0xA8, 0x26, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF9, 0xA9, 0x76, 0x45, 0x80, 0x81, 0x82, 0x86, 0x8E, 0xFF, 0xF9, 0xA9, 0x5D, 0xA9, 0x5D, 0xA7, 0xA2, 0xA9,
-    0x5D, 0x43, 0x2E, 0xD0, 0xD1, 0xA9, 0x4D, 0xFF, 0xC6, 0xFF, 0xF0, 0x4B, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBE, 0xBF, 0xB2, 0xD0, 0xA7, 0xFE, 0xFF, 0x36, 0xFF, 0x62, 0xFF, 0x90, 0xA7, 0xFE, 0xFF, 0xB1, 0xA7,
-    0xFE, 0xA7, 0xFE, 0xFF, 0xF6, 0xA7, 0xFE, 0x42, 0x81, 0x8F, 0xBB, 0x31, 0xC8, 0x35, 0x21, 0xD1, 0xF9, 0x42, 0xB4,
-    0xB9, 0xA7, 0xD2, 0xA7, 0x2B, 0x21, 0xD0, 0xF9, 0x43, 0xB2, 0xB7, 0xBB, 0xA7, 0xC8, 0xA7, 0x21, 0xA7, 0xC8, 0x41,
-    0x89, 0xA7, 0xBE, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x43, 0xB0, 0xB2, 0xB4, 0xA7, 0x0E, 0xC6, 0x0E, 0xA7, 0x0E, 0x42,
-    0xD0, 0xD1, 0xFF, 0xF6, 0xAB, 0xEF, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xCF, 0xD9, 0xEA, 0xF9, 0x42, 0xD0, 0xD1, 0xBC,
-    0xAF, 0xC4, 0x87, 0x21, 0x83, 0xF9, 0x43, 0x2E, 0xD0, 0xD1, 0xA7, 0x91, 0xFF, 0xED, 0xFF, 0xFD, 0x42, 0x82, 0x8E,
-    0xA6, 0xF7, 0xA8, 0xCC, 0x21, 0xD1, 0xF9, 0xC1, 0x02, 0xB1, 0xD0, 0xBB, 0xA7, 0x44, 0x81, 0x8E, 0x8F, 0x82, 0xA7,
-    0x77, 0xAD, 0xEE, 0xA8, 0xBC, 0xA7, 0x77, 0xC2, 0x03, 0xD1, 0x2E, 0xD1, 0xA7, 0x6A, 0xFF, 0xF3, 0x41, 0xBC, 0xA8,
-    0xA6, 0x41, 0x85, 0xA8, 0xA2, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x41, 0x2E, 0xA7, 0x54, 0x21, 0xB5, 0xFC, 0x21, 0xD0,
-    0xFD, 0x42, 0xBB, 0xBD, 0xA8, 0x8F, 0xB2, 0x1C, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xFF, 0xF9, 0xFE, 0x9D, 0x4A, 0x80,
-    0x81, 0x83, 0x84, 0x86, 0x8B, 0x8C, 0x8F, 0x87, 0x91, 0xFF, 0xA9, 0xA7, 0x3A, 0xFF, 0xBA, 0xA7, 0x3A, 0xA7, 0x3A,
-    0xFF, 0xBD, 0xFF, 0xD0, 0xFF, 0xE1, 0xFF, 0xED, 0xFF, 0xF7, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xA7, 0x1B, 0xFF, 0x1D,
-    0xFF, 0xE1, 0xA6, 0x46, 0x42, 0xB0, 0xBE, 0xA6, 0xDF, 0xA6, 0x95, 0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x41, 0xB0, 0xA8,
-    0xBB, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xA9, 0x11, 0x21, 0xD0, 0xFC, 0x48, 0xB1, 0xB2, 0xB3, 0xB5, 0xB7, 0xBA, 0xBC,
-    0xBF, 0xFF, 0xED, 0xA6, 0x4D, 0xBA, 0x2C, 0xAD, 0x0A, 0xA6, 0x14, 0xA7, 0xD6, 0xFF, 0xF6, 0xFF, 0xFD, 0x42, 0xBB,
-    0xBF, 0xA6, 0x12, 0xA6, 0x12, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xAC, 0x5A, 0x44, 0x81, 0x82, 0x84, 0x85, 0xFF, 0xF9,
-    0xAC, 0x04, 0xB3, 0x5D, 0xA6, 0x26, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xCC, 0xFF, 0xF3, 0xA5, 0xEB, 0x41,
-    0xB5, 0xAE, 0x1B, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xA5, 0xDB, 0xC2, 0x00, 0x92, 0xD0, 0x2D, 0xFF, 0xF5, 0xA5, 0xD4,
-    0x41, 0xD0, 0xE6, 0x33, 0x21, 0xBD, 0xFC, 0x21, 0xD0, 0xFD, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xA6, 0x96, 0xFF, 0xFD,
-    0xAE, 0x2C, 0xA6, 0x96, 0x42, 0xD0, 0x2D, 0xFF, 0xF3, 0xA5, 0xB4, 0xC1, 0x02, 0xB1, 0xD1, 0xB2, 0xD9, 0x41, 0xBA,
-    0xAF, 0x99, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB2, 0xBA, 0xA5, 0xB5, 0xA6, 0x6F, 0x42,
-    0xD0, 0xD1, 0xFF, 0xF9, 0xA8, 0x5F, 0x45, 0xB0, 0xB5, 0xB8, 0xBB, 0xBE, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF, 0xF9, 0xA5,
-    0xD1, 0xA6, 0x61, 0x21, 0x91, 0xDF, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xA5, 0x79, 0xC2,
-    0x01, 0xB1, 0xD0, 0x2D, 0xAD, 0xF9, 0xA5, 0x6D, 0x42, 0xB4, 0xBB, 0xA5, 0x70, 0xA5, 0x70, 0x21, 0xD0, 0xF9, 0x21,
-    0xB5, 0xFD, 0xC3, 0x0A, 0x32, 0xD0, 0x2E, 0x2D, 0xFF, 0xFD, 0xB0, 0x2A, 0xA5, 0x57, 0x44, 0xB3, 0xB7, 0xBF, 0xBC,
-    0xA7, 0x05, 0xA5, 0x40, 0xD8, 0x4B, 0xE5, 0x3A, 0x41, 0xBA, 0xD8, 0x31, 0xA1, 0x01, 0xB1, 0xD0, 0xFC, 0x21, 0x81,
-    0xFB, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xA5, 0x32, 0x41, 0x8F, 0xFE, 0xA7, 0x21, 0xD1,
-    0xFC, 0x45, 0x82, 0x8E, 0x8F, 0x81, 0x91, 0xA5, 0xF4, 0xA7, 0x39, 0xA7, 0x39, 0xFF, 0xFD, 0xA7, 0x39, 0x44, 0x2E,
-    0xD0, 0xD1, 0x2D, 0xA5, 0xE4, 0xBD, 0xC8, 0xFF, 0xF0, 0xA5, 0x0F, 0x42, 0x80, 0x81, 0xA5, 0x30, 0xA5, 0x61, 0x42,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xA4, 0xFB, 0xC2, 0x03, 0xE2, 0xD1, 0x2D, 0xAD, 0xC1, 0xA4, 0xF4, 0x41, 0x82, 0xDA, 0x1C,
-    0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xAA, 0x60, 0xFF, 0xFC, 0xA4, 0xE7, 0x41, 0xBA, 0xF4, 0xB0, 0x41, 0xD1, 0xBF,
-    0xC0, 0x21, 0x81, 0xFC, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFD, 0xA4, 0xD0, 0x51, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0xFC, 0x7C, 0xFC, 0xBB,
-    0xFE, 0x7E, 0xFE, 0xD9, 0xFE, 0xE9, 0xFE, 0xF0, 0xFF, 0x10, 0xFF, 0x4B, 0xFF, 0x57, 0xFF, 0x6D, 0xFF, 0x92, 0xFF,
-    0xB5, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xF4, 0xA8, 0xD3, 0x42, 0xD0, 0xD1, 0xFB, 0xFA, 0xFF, 0xCC, 0x42,
-    0xD0, 0xD1, 0xA8, 0xE9, 0xAD, 0xB1, 0x41, 0x80, 0xA4, 0xB6, 0x21, 0xD1, 0xFC, 0xC1, 0x02, 0xB1, 0xD0, 0xA9, 0x76,
-    0x41, 0xBB, 0xB2, 0x3C, 0x21, 0xD0, 0xFC, 0x47, 0xB1, 0xB2, 0xB3, 0xB7, 0xBA, 0xBD, 0xBF, 0xFF, 0xE5, 0xFF, 0xF0,
-    0xFF, 0xF3, 0xA7, 0xBA, 0xFF, 0xFD, 0xA4, 0xCD, 0xA8, 0xD2, 0xC1, 0x02, 0xB1, 0xD1, 0xAA, 0xB3, 0x43, 0x81, 0x82,
-    0x89, 0xFF, 0xFA, 0xA6, 0x09, 0xA6, 0x6C, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDA, 0xFF, 0xF6, 0xA4, 0x48, 0x42, 0xB9,
-    0xBB, 0xA4, 0x83, 0xA4, 0x83, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB6, 0xD8, 0xA0, 0x06, 0x42, 0x43, 0xB5, 0xB7, 0xB9,
-    0xA4, 0x72, 0xFF, 0xFD, 0xAD, 0xB2, 0x43, 0x81, 0x8E, 0x91, 0xA4, 0x68, 0xA4, 0xF8, 0xA4, 0x68, 0x22, 0xD0, 0xD1,
-    0xEC, 0xF6, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xAC, 0x7C, 0xFF, 0xDD, 0xA4, 0xE9, 0xFF, 0xFB, 0x41, 0xD0, 0xC1, 0x8D,
-    0x45, 0x80, 0x83, 0x8B, 0x8F, 0x91, 0xAD, 0x88, 0xA4, 0xD8, 0xA4, 0xD8, 0xA4, 0xD8, 0xFF, 0xFC, 0x44, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xA4, 0xC8, 0xFF, 0xDF, 0xFF, 0xF0, 0xA3, 0xF3, 0x42, 0xB0, 0xBB, 0xAB, 0x32, 0xA4, 0x42, 0x41, 0x88,
-    0xAB, 0x2B, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xB5, 0xB4, 0x32, 0x21, 0xD0, 0xFC, 0x41, 0xB1, 0xAD, 0xC1, 0x21,
-    0xD0, 0xFC, 0x41, 0xB4, 0xB1, 0x2D, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA8, 0xDD, 0xA0, 0x0A, 0xC2, 0x21, 0xBB, 0xFD,
-    0x21, 0xD0, 0xFD, 0x48, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBC, 0xBE, 0xBF, 0xB6, 0xE6, 0xA3, 0xE2, 0xA8, 0xBC, 0xFF,
-    0xD9, 0xFF, 0xE2, 0xFF, 0xE9, 0xFF, 0xF0, 0xFF, 0xFD, 0x44, 0xB0, 0xB5, 0xB7, 0xBA, 0xA7, 0xF2, 0xB7, 0x94, 0xAA,
-    0xE7, 0xA3, 0xA7, 0x42, 0xD0, 0xD1, 0xFF, 0xF3, 0xEB, 0xEF, 0x43, 0xB0, 0xB8, 0xBE, 0xA3, 0x7C, 0xA5, 0x41, 0xA5,
-    0x41, 0x42, 0xD0, 0xD1, 0xFF, 0xF6, 0xB7, 0x67, 0x21, 0xBA, 0xF9, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xB4, 0x06, 0x43,
-    0x80, 0x81, 0x85, 0xFF, 0xDE, 0xFF, 0xF9, 0xA4, 0xDB, 0xC3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xAE, 0xFF, 0xF6,
-    0xA3, 0x62, 0x41, 0xBD, 0xA3, 0xD0, 0x21, 0xD0, 0xFC, 0xC1, 0x01, 0xE1, 0xD1, 0xBD, 0x0E, 0x41, 0xBC, 0xA6, 0x34,
-    0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB2, 0xB4, 0xB6, 0xAC, 0xC1, 0xA3, 0x81, 0xA4, 0x11,
-    0x41, 0x84, 0xA4, 0x07, 0x22, 0xD0, 0xD1, 0xF2, 0xFC, 0x49, 0xB0, 0xB1, 0xB4, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBB, 0x9D, 0xA7, 0x8D, 0xAC, 0x05, 0xFF, 0xD7, 0xFF, 0xDA, 0xA3, 0x7A, 0xFF, 0xEA, 0xF7, 0x34, 0xFF, 0xFB, 0x42,
-    0xD0, 0xD1, 0xB6, 0xDB, 0xF2, 0x71, 0x43, 0x81, 0x84, 0x85, 0xFF, 0xF9, 0xC7, 0x53, 0xA4, 0xBD, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xD3, 0xFF, 0xF6, 0xA2, 0xFC, 0x42, 0xB2, 0xBD, 0xAF, 0x99, 0xAF, 0x99, 0x21, 0xD0, 0xF9, 0x41, 0x82,
-    0xAF, 0x8F, 0x21, 0xD1, 0xFC, 0x43, 0xB0, 0xB5, 0xBD, 0xFF, 0xF6, 0xFF, 0xFD, 0xAA, 0x2D, 0x21, 0x91, 0xF3, 0xC3,
-    0x04, 0xC3, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xA2, 0xD4, 0x41, 0xD0, 0xBE, 0xAC, 0x21, 0xBE, 0xFC, 0xC3,
-    0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xA4, 0x86, 0xA2, 0xC1, 0xC1, 0x01, 0xE1, 0xD1, 0xEA, 0xEE, 0x21, 0x81,
-    0xFA, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x41, 0x89, 0xA2, 0xC1, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9,
-    0xFF, 0xFC, 0xA2, 0xA2, 0x42, 0xB5, 0xBB, 0xC9, 0x4D, 0xA5, 0xE2, 0x41, 0x8A, 0xA3, 0x64, 0x22, 0xD0, 0xD1, 0xF5,
-    0xFC, 0xC1, 0x01, 0x31, 0xD1, 0xC6, 0xCF, 0x41, 0xBC, 0xAC, 0x05, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA4, 0xA8, 0x41,
-    0xB3, 0xA3, 0x4A, 0x21, 0xD0, 0xFC, 0x47, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBC, 0xBD, 0xFF, 0xE3, 0xA6, 0xD2, 0xFF,
-    0xE8, 0xA5, 0xBA, 0xAB, 0xA3, 0xFF, 0xF2, 0xFF, 0xFD, 0x42, 0xB3, 0xB6, 0xA4, 0x72, 0xA4, 0x72, 0x43, 0x81, 0x83,
-    0x88, 0xA4, 0x6B, 0xA2, 0x7F, 0xA4, 0x6B, 0x22, 0xD0, 0xD1, 0xEF, 0xF6, 0x42, 0xBD, 0xBF, 0xA5, 0x8E, 0xA5, 0x8E,
-    0x41, 0x86, 0xA5, 0x87, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x42, 0xB4, 0xBA, 0xA3, 0x07, 0xA2, 0x7A, 0x21, 0xD0, 0xF9,
-    0x44, 0x80, 0x81, 0x82, 0x89, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF, 0xFD, 0xA4, 0x42, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAD,
-    0xFF, 0xF3, 0xA2, 0x1B, 0x41, 0xB0, 0xBA, 0x4D, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFC, 0xA2, 0x0D, 0x50, 0xB0,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFD, 0xBC, 0xB5, 0xCC,
-    0xFE, 0x11, 0xA9, 0xC6, 0xA9, 0x37, 0xFE, 0xA2, 0xA9, 0xC6, 0xA9, 0x37, 0xFF, 0x08, 0xFF, 0x30, 0xFF, 0x43, 0xFF,
-    0x62, 0xA9, 0x37, 0xFF, 0xE9, 0xFF, 0xF7, 0xA6, 0x13, 0x42, 0xB3, 0xB6, 0xC5, 0x70, 0xAB, 0x58, 0x21, 0xD0, 0xF9,
-    0xC1, 0x02, 0x21, 0xD0, 0xB5, 0xBE, 0x42, 0x83, 0x8C, 0xA3, 0xDD, 0xA2, 0x08, 0x42, 0xD0, 0xD1, 0xB0, 0xE6, 0xFF,
-    0xF9, 0x42, 0x88, 0x91, 0xA1, 0xFA, 0xA1, 0xFA, 0x42, 0xD0, 0xD1, 0xA6, 0xCE, 0xFF, 0xF9, 0x42, 0xB0, 0xBD, 0xA1,
-    0xEC, 0xA1, 0xEC, 0x21, 0xD0, 0xF9, 0x41, 0xBB, 0xA4, 0x2B, 0x21, 0xD0, 0xFC, 0x48, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB7, 0xBF, 0xA1, 0xDB, 0xFF, 0xDA, 0xFF, 0xE8, 0xA1, 0xDB, 0xA1, 0xDB, 0xA1, 0xDB, 0xFF, 0xF6, 0xFF, 0xFD,
-    0xC2, 0x0A, 0xE2, 0xD0, 0xD1, 0xEA, 0x16, 0xB4, 0x1E, 0x41, 0xD1, 0xD0, 0x21, 0xA0, 0x0B, 0x03, 0x46, 0x81, 0x82,
-    0x85, 0x86, 0x88, 0x8E, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0xFD, 0xA1, 0xB2, 0xA3, 0x36, 0xA1, 0xB2, 0x22, 0xD0, 0xD1,
-    0xC4, 0xED, 0x41, 0xBB, 0xAB, 0x47, 0x21, 0xD0, 0xFC, 0x41, 0x81, 0xC2, 0x7C, 0x21, 0xD1, 0xFC, 0x47, 0xB1, 0xB2,
-    0xB3, 0xBB, 0xBC, 0xBD, 0xBE, 0xA3, 0x61, 0xA1, 0x8C, 0xFF, 0xF6, 0xA1, 0x8C, 0xA1, 0x8C, 0xFF, 0xFD, 0xA1, 0xA3,
-    0x43, 0x82, 0x84, 0x89, 0xA1, 0x76, 0xA1, 0x3D, 0xA1, 0x76, 0x22, 0xD0, 0xD1, 0xE0, 0xF6, 0x41, 0xB5, 0xBA, 0x74,
-    0x41, 0x91, 0xBA, 0x70, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x45, 0xB3, 0xB8, 0xB9,
-    0xBF, 0xB5, 0xFD, 0x08, 0xD1, 0xF1, 0xA1, 0xE4, 0xF0, 0xEE, 0xFF, 0xFD, 0x41, 0xD0, 0xD4, 0x75, 0x65, 0x80, 0x81,
-    0x82, 0x86, 0x8E, 0x7F, 0xA1, 0x40, 0x7F, 0xFF, 0xFC, 0x7F, 0xA1, 0x07, 0x7F, 0xAE, 0x24, 0x7F, 0xA1, 0xD0, 0x22,
-    0xD0, 0xD1, 0xD7, 0xEB, 0x4B, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x15, 0xA1,
-    0xB6, 0xA1, 0xB6, 0xA1, 0xB6, 0xFF, 0x18, 0xFF, 0x87, 0xFF, 0xBA, 0xA1, 0xB6, 0xA1, 0xB6, 0xFF, 0xFB, 0xA1, 0xB6,
-    0x64, 0xB1, 0xB4, 0xBA, 0xBC, 0x7F, 0xA2, 0xD9, 0x7F, 0xA1, 0x1E, 0x7F, 0xA1, 0x94, 0x7F, 0xA1, 0x1E, 0x42, 0xD0,
-    0xD1, 0xFF, 0xEF, 0xA3, 0x7A, 0x66, 0xB2, 0xB4, 0xB5, 0xB6, 0xB9, 0xBA, 0x7F, 0xA0, 0xEC, 0x7F, 0xAA, 0x2C, 0x7F,
-    0xA0, 0xEC, 0x7F, 0xA0, 0xEC, 0x7F, 0xA0, 0xEC, 0x7F, 0xA0, 0xC2, 0x63, 0x82, 0x89, 0x8F, 0x7F, 0xA0, 0xD3, 0x7F,
-    0xA0, 0xD3, 0x7F, 0xA0, 0xD3, 0x63, 0x2E, 0xD0, 0xD1, 0x7F, 0xA0, 0xC6, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF3, 0x42,
-    0x85, 0x88, 0xFF, 0x04, 0xA2, 0x3D, 0x21, 0xD1, 0xF9, 0x68, 0x80, 0x83, 0x84, 0x89, 0x8A, 0x8B, 0x8F, 0x91, 0x7F,
-    0xA1, 0x3F, 0x7F, 0xFF, 0xBC, 0x7F, 0xA1, 0x3F, 0x7F, 0xA1, 0x3F, 0x7F, 0xA1, 0x3F, 0x7F, 0xA0, 0xAF, 0x7F, 0xFF,
-    0xE9, 0x7F, 0xFF, 0xFD, 0x64, 0xD0, 0xD1, 0x2E, 0x2D, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0xDF, 0x7F, 0xC7, 0x6C, 0x7F,
-    0xA0, 0x49, 0x41, 0xBF, 0xA3, 0x23, 0x21, 0xD0, 0xFC, 0x65, 0xB1, 0xB4, 0xB5, 0xBC, 0xBF, 0x7F, 0xA0, 0x90, 0x7F,
-    0xB4, 0x95, 0x7F, 0xFF, 0xFD, 0x7F, 0xB4, 0x95, 0x7F, 0xB4, 0x95, 0xE2, 0x0B, 0x33, 0xD0, 0x2D, 0x7F, 0xFF, 0xEB,
-    0x7F, 0xA0, 0x1C, 0xE2, 0x03, 0x32, 0xD0, 0x2D, 0x7F, 0xB4, 0x6E, 0x7F, 0xA0, 0x11, 0x41, 0x80, 0xB5, 0x60, 0x21,
-    0xD1, 0xFC, 0x43, 0xB3, 0xB6, 0xBF, 0xA4, 0xA4, 0xE9, 0xBD, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xA3, 0xE6, 0xA6, 0x50,
-    0x42, 0xD0, 0xD1, 0xF2, 0xA2, 0xB3, 0x84, 0x44, 0x81, 0x84, 0x88, 0x89, 0xFF, 0xF2, 0xA4, 0x4B, 0xFF, 0xF9, 0xA2,
-    0x01, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF3, 0x7F, 0x9F, 0xDA, 0xE1, 0x01, 0x91, 0x2D, 0x7F,
-    0x9F, 0xCD, 0x41, 0x81, 0xF1, 0x10, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xAA, 0x3F, 0x7F, 0xFF, 0xFC, 0x7F, 0x9F, 0xC2,
-    0x63, 0xB5, 0xB8, 0xBC, 0x7F, 0xA7, 0x01, 0x7F, 0xA7, 0x01, 0x7F, 0x9F, 0xAA, 0x63, 0x82, 0x8E, 0x91, 0x7F, 0xC0,
-    0xD6, 0x7F, 0xA0, 0x04, 0x7F, 0xA6, 0xF4, 0xE4, 0x02, 0x21, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0xC0, 0xC9, 0x7F, 0xFF,
-    0xE6, 0x7F, 0xFF, 0xF3, 0x7F, 0x9F, 0x9B, 0xE2, 0x00, 0xA1, 0xD1, 0x2D, 0x7F, 0xA5, 0xE3, 0x7F, 0x9F, 0x88, 0x43,
-    0xB3, 0xB6, 0xBF, 0xA1, 0x97, 0xA1, 0x97, 0xA1, 0x97, 0x41, 0x87, 0xB9, 0xB0, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xF2, 0x7F, 0xFF, 0xFC, 0x7F, 0x9F, 0x6F, 0x44, 0xB3, 0xB7, 0xBA, 0xBF, 0xB2, 0x94, 0xA4, 0x6A, 0xFB, 0x87, 0xFB,
-    0xAB, 0x41, 0xD0, 0xBB, 0x76, 0x41, 0xD0, 0xFB, 0xDB, 0x63, 0x80, 0x81, 0x85, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC,
-    0x7F, 0xA0, 0xBC, 0xE3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xF3, 0x7F, 0x9F, 0x40, 0x51,
-    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0xE8,
-    0xFF, 0x15, 0xFF, 0x20, 0xFF, 0x57, 0xA6, 0xF3, 0xA6, 0x64, 0xFF, 0x64, 0xA6, 0x64, 0xAA, 0xA3, 0xA6, 0xF3, 0xC1,
-    0x75, 0xFF, 0x6F, 0xFF, 0x96, 0xA6, 0xF3, 0xFF, 0xA9, 0xFF, 0xC2, 0xFF, 0xF1, 0x42, 0xD0, 0xD1, 0xFC, 0xF9, 0xFF,
-    0xCC, 0x41, 0xBB, 0xA4, 0xF0, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0xAC, 0x1E, 0x7F, 0x9E,
-    0xF2, 0x42, 0xD0, 0xD1, 0xD6, 0xE1, 0xA6, 0x4F, 0x42, 0xB5, 0xBE, 0xAF, 0xC3, 0xFF, 0xF9, 0x61, 0x8E, 0x7F, 0x9F,
-    0x1D, 0xC2, 0x01, 0x31, 0xD0, 0xD1, 0xB6, 0x8D, 0xFF, 0xFB, 0x41, 0x82, 0xA7, 0x03, 0x21, 0xD1, 0xFC, 0x22, 0x80,
-    0x8B, 0xF0, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xFB, 0x7F, 0x9E, 0xBB, 0x64, 0xB5, 0xB8,
-    0xBB, 0xBE, 0x7F, 0xA8, 0x92, 0x7F, 0x9E, 0xF3, 0x7F, 0x9E, 0xA3, 0x7F, 0x9E, 0xF3, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xEF, 0x7F, 0xCD, 0x4A, 0x7F, 0x9E, 0x9D, 0x62, 0xB0, 0xB5, 0x7F, 0x9E, 0x85, 0x7F, 0x9E, 0x85, 0xC2, 0x00,
-    0xA1, 0xD0, 0xD1, 0xFF, 0xF7, 0xB4, 0x3C, 0x63, 0xB2, 0xBB, 0xBD, 0x7F, 0x9E, 0xDD, 0x7F, 0x9E, 0xDD, 0x7F, 0xFF,
-    0xF7, 0x62, 0x8F, 0x91, 0x7F, 0x9E, 0x9F, 0x7F, 0x9E, 0x9F, 0x42, 0xD0, 0xD1, 0xA3, 0xE8, 0xFF, 0xF7, 0x21, 0x80,
-    0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0x9E, 0x5E, 0x62, 0xB0, 0xB2, 0x7F, 0xBA,
-    0xB6, 0x7F, 0x9E, 0x46, 0x61, 0xBC, 0x7F, 0x9E, 0x76, 0x21, 0xD0, 0xFB, 0x62, 0xB0, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F,
-    0x9E, 0x6E, 0x21, 0xD0, 0xF7, 0x62, 0x80, 0x83, 0x7F, 0xFF, 0xFD, 0x7F, 0x9E, 0x4F, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xDA, 0x7F, 0xFF, 0xF7, 0x7F, 0x9E, 0x2B, 0x62, 0xB4, 0xBB, 0x7F, 0x9E, 0x13, 0x7F, 0x9E, 0x13, 0x62, 0xBA,
-    0xBB, 0x7F, 0x9F, 0xCF, 0x7F, 0x9E, 0x66, 0xA1, 0x01, 0x31, 0xD0, 0xF7, 0x62, 0x81, 0x85, 0x7F, 0xFF, 0xFB, 0x7F,
-    0x9D, 0xFC, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF7, 0x7F, 0x9D, 0xFE, 0x61, 0xB6,
-    0x7F, 0x9E, 0x4E, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x9D, 0xEA, 0x61, 0xBF, 0x7F, 0x9D, 0xED, 0xA1, 0x00,
-    0x91, 0xD0, 0xFB, 0x42, 0xB2, 0xBE, 0xB3, 0xCD, 0xFF, 0xFB, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x9D, 0xD0,
-    0xC1, 0x00, 0x91, 0xD0, 0xA9, 0xCD, 0x64, 0xB0, 0xB2, 0xB8, 0xBE, 0x7F, 0x9E, 0x06, 0x7F, 0x9D, 0xEF, 0x7F, 0x9E,
-    0x06, 0x7F, 0xFF, 0xFA, 0x41, 0x83, 0xF9, 0x80, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFC, 0x7F,
-    0x9D, 0xAC, 0x62, 0xB0, 0xB5, 0x7F, 0x9D, 0xE4, 0x7F, 0x9D, 0xE4, 0x41, 0xD1, 0xE6, 0x6D, 0x64, 0x83, 0x8B, 0x8E,
-    0x91, 0x7F, 0x9D, 0xD7, 0x7F, 0xFF, 0xFC, 0x7F, 0x9D, 0xD7, 0x7F, 0x9D, 0xD7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xE2, 0x7F, 0xFF, 0xEF, 0x7F, 0x9D, 0x81, 0x62, 0xD1, 0x2D, 0x7F, 0xBE, 0x97, 0x7F, 0x9D, 0x74, 0x61, 0x8C, 0x7F,
-    0x9D, 0xB0, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xB9, 0xF1, 0x7F, 0xFF, 0xFB, 0x7F, 0x9D, 0x66, 0x65, 0xB1, 0xB2, 0xB7,
-    0xBA, 0xBF, 0x7F, 0x9D, 0x4E, 0x7F, 0x9D, 0x4E, 0x7F, 0xF7, 0x8E, 0x7F, 0x9D, 0x4E, 0x7F, 0x9D, 0x4E, 0x63, 0x81,
-    0x82, 0x84, 0x7F, 0xA0, 0xE9, 0x7F, 0x9E, 0xFE, 0x7F, 0x9D, 0x39, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xDE, 0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0x37, 0xC1, 0x00, 0xA1, 0xD1, 0xE1, 0x8D, 0x21, 0xBB, 0xFA, 0x61, 0xBE, 0x7F,
-    0x9D, 0x3A, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFD, 0x7F,
-    0x9D, 0x14, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9,
-    0xFE, 0x15, 0xFE, 0x4C, 0xFE, 0x6A, 0xFE, 0xA9, 0xFE, 0xDC, 0xFF, 0x09, 0xFF, 0x1D, 0xFF, 0x37, 0xA3, 0xAD, 0xFF,
-    0x5B, 0xFF, 0x86, 0xFF, 0x93, 0xFF, 0xA1, 0xFF, 0xD0, 0xFF, 0xF3, 0xA1, 0x16, 0x41, 0x80, 0xB4, 0x0C, 0x21, 0xD1,
-    0xFC, 0x21, 0x82, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0xB5, 0xA8, 0xDE, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xA1,
-    0xD0, 0xBF, 0xAE, 0x21, 0xB4, 0xFA, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x65, 0xB0, 0xB5, 0xB8, 0xBA, 0xBE, 0x7F, 0x9C,
-    0xF7, 0x7F, 0xFF, 0xE6, 0x7F, 0x9C, 0xF7, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xFB, 0x66, 0x82, 0x83, 0x8B, 0x8E, 0x8F,
-    0x91, 0x7F, 0xA5, 0xD2, 0x7F, 0x9C, 0xB8, 0x7F, 0x9C, 0xE2, 0x7F, 0x9C, 0xE2, 0x7F, 0x9C, 0xE2, 0x7F, 0x9C, 0xE2,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xE7, 0x7F, 0x9C, 0x84, 0x64, 0xB0, 0xB8, 0xBB, 0xBE, 0x7F,
-    0x9C, 0xA5, 0x7F, 0x9C, 0xA5, 0x7F, 0x9C, 0x83, 0x7F, 0xFE, 0x34, 0x61, 0x2E, 0x7F, 0x9C, 0x94, 0x62, 0x80, 0x83,
-    0x7F, 0x9C, 0xA6, 0x7F, 0xFF, 0xFB, 0x22, 0xD0, 0xD1, 0xE1, 0xF7, 0xA0, 0x0B, 0x62, 0x21, 0xB6, 0xFD, 0x21, 0xD0,
-    0xFD, 0x62, 0xB0, 0xB8, 0x7F, 0xFF, 0xFD, 0x7F, 0x9C, 0x92, 0xA1, 0x01, 0xB1, 0xD0, 0xF7, 0x67, 0xB0, 0xB3, 0xBA,
-    0xBB, 0xBC, 0xBD, 0xBF, 0x7F, 0xB7, 0x0A, 0x7F, 0x9C, 0x81, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xFB, 0x7F, 0x9C, 0x81,
-    0x7F, 0x9C, 0x9B, 0x7F, 0x9C, 0x31, 0x62, 0x8F, 0x91, 0x7F, 0x9C, 0x64, 0x7F, 0x9C, 0x64, 0x42, 0xD0, 0xD1, 0xA1,
-    0x36, 0xFF, 0xF7, 0x66, 0x81, 0x82, 0x84, 0x86, 0x87, 0x8C, 0x7F, 0x9C, 0x57, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0x54,
-    0x7F, 0x9C, 0xE4, 0x7F, 0x9C, 0x6E, 0x7F, 0xDE, 0x9B, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xBA, 0x7F, 0xFF, 0xE7,
-    0x7F, 0x9B, 0xF6, 0x41, 0xD1, 0xF0, 0x3D, 0x21, 0xBF, 0xFC, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x65, 0xB0, 0xB5, 0xB8,
-    0xBB, 0xBE, 0x7F, 0x9C, 0x22, 0x7F, 0xF2, 0x3A, 0x7F, 0x9C, 0x22, 0x7F, 0xB7, 0x5D, 0x7F, 0xFF, 0xFB, 0x62, 0x8E,
-    0x91, 0x7F, 0x9B, 0xE3, 0x7F, 0x9C, 0x0D, 0x42, 0xD0, 0xD1, 0xA0, 0xDF, 0xFF, 0xF7, 0x67, 0x80, 0x83, 0x8B, 0x8C,
-    0x8E, 0x8F, 0x91, 0x7F, 0x9B, 0xEC, 0x7F, 0x9B, 0xFD, 0x7F, 0x9B, 0xFD, 0x7F, 0xFF, 0xF9, 0x7F, 0x9D, 0xD2, 0x7F,
-    0x9B, 0xFD, 0x7F, 0xF2, 0x15, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xBE, 0x7F, 0xFF, 0xE3, 0x7F, 0x9B, 0x9B, 0x61,
-    0xB3, 0x7F, 0x9B, 0xDF, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0xA0, 0xC3, 0x7F, 0x9B, 0x89,
-    0x62, 0xB8, 0xBB, 0x7F, 0x9B, 0x95, 0x7F, 0xBB, 0x57, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xA1, 0xEB,
-    0x7F, 0x9B, 0x71, 0x61, 0xB4, 0x7F, 0x9B, 0x92, 0x62, 0xD0, 0xD1, 0x7F, 0xFF, 0xFB, 0x7F, 0x9F, 0xA3, 0xA0, 0x0B,
-    0x82, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xA1, 0xD0, 0xFD, 0xC1, 0x01, 0x31, 0xD1, 0xD6, 0x45, 0x23, 0xB0, 0xB2, 0xBB,
-    0xE6, 0xF5, 0xFA, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0xF1, 0x7F, 0x9B, 0x3E, 0x41, 0xB5, 0xCC,
-    0x37, 0x63, 0x80, 0x8C, 0x91, 0x7F, 0x9D, 0x47, 0x7F, 0x9B, 0x72, 0x7F, 0xCC, 0x33, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xEF, 0x7F, 0xFF, 0xF3, 0x7F, 0x9B, 0x20, 0xE1, 0x00, 0xA1, 0xD0, 0x7F, 0x9B, 0x8A, 0x64, 0xB5, 0xB8, 0xBB,
-    0xBF, 0x7F, 0x9B, 0x27, 0x7F, 0x9B, 0x27, 0x7F, 0xFF, 0xF9, 0x7F, 0x9B, 0x6B, 0x61, 0x91, 0x7F, 0x9B, 0x16, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xFB, 0x7F, 0x9A, 0xF6, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x87, 0x88, 0x8D, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0xF3, 0x7F, 0xFF,
-    0x4E, 0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF3, 0x7F, 0xA2, 0xAB,
-    0x7F, 0xBB, 0x96, 0x7F, 0xA1, 0x8F, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F,
-    0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x42, 0xD0, 0xD1, 0xFD, 0x9D, 0xFF, 0xBB, 0xC1, 0x01, 0xE1, 0xD1, 0xAD, 0xEA, 0x21,
-    0xB4, 0xFA, 0x21, 0xD0, 0xFD, 0x64, 0xB1, 0xB3, 0xB7, 0xBD, 0x7F, 0x9C, 0x4B, 0x7F, 0xAD, 0xC3, 0x7F, 0x9F, 0x99,
-    0x7F, 0xFF, 0xFD, 0x64, 0x82, 0x85, 0x88, 0x8D, 0x7F, 0x9C, 0x37, 0x7F, 0x9A, 0x75, 0x7F, 0xA1, 0xCC, 0x7F, 0x9A,
-    0xDC, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF, 0x7F, 0x9A, 0x6F, 0xA0, 0x0B, 0xA2, 0x43, 0xB2,
-    0xB4, 0xBE, 0xA0, 0x6B, 0xA0, 0x6B, 0xFF, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF6, 0x7F, 0xFA, 0x8F, 0x7F,
-    0x9A, 0x55, 0x66, 0xB0, 0xB3, 0xB6, 0xB7, 0xBD, 0xBE, 0x7F, 0xF4, 0xA5, 0x7F, 0x9E, 0xAC, 0x7F, 0x9A, 0x3D, 0x7F,
-    0x9B, 0xB7, 0x7F, 0xE4, 0x06, 0x7F, 0x9A, 0x76, 0xE3, 0x03, 0xD1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE7, 0x7F, 0xE4,
-    0xA4, 0x7F, 0x9A, 0x2F, 0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x9A, 0x7F, 0x7F, 0x9A, 0x7F, 0x7F, 0x9A, 0x7F, 0x62, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x9A, 0x13, 0x41, 0xD1, 0xF7, 0x7B, 0x42, 0xB1, 0xBD, 0xFF, 0xFC, 0xA1, 0x52, 0x62,
-    0x82, 0x83, 0x7F, 0xA5, 0xE2, 0x7F, 0x9A, 0x2D, 0x42, 0xD0, 0xD1, 0xCE, 0x6E, 0xFF, 0xF7, 0x41, 0xBF, 0xA6, 0x06,
-    0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x03, 0x91, 0xD0, 0xFD, 0x43, 0x80, 0x81, 0x82, 0xFF, 0xEA, 0xC3, 0x43,
-    0xFF, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xF6, 0x7F, 0x99, 0xD6, 0x70, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB6, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x5A, 0x7F, 0xA0, 0xFC,
-    0x7F, 0xA0, 0xFC, 0x7F, 0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x9A, 0x7F, 0xA0, 0xFC, 0x7F,
-    0xFF, 0xB6, 0x7F, 0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8, 0x7F, 0x9D,
-    0xD8, 0x7F, 0x9D, 0xD8, 0x62, 0xB1, 0xB7, 0x7F, 0x99, 0xCD, 0x7F, 0x99, 0xE4, 0x62, 0x81, 0x82, 0x7F, 0x99, 0xDB,
-    0x7F, 0x99, 0xC4, 0x22, 0xD0, 0xD1, 0xEE, 0xF7, 0x62, 0xD0, 0xD1, 0x7F, 0x9A, 0xBC, 0x7F, 0xB2, 0xBF, 0x62, 0xB6,
-    0xB7, 0x7F, 0x99, 0xC7, 0x7F, 0x99, 0xC7, 0xA1, 0x00, 0x91, 0xD0, 0xF7, 0xE1, 0x00, 0x91, 0xD0, 0x7F, 0x9A, 0xA5,
-    0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xDD, 0xE2, 0xF4, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xC7, 0xF7,
-    0x7F, 0x99, 0x4A, 0x41, 0xD1, 0x9F, 0xB7, 0x62, 0xBC, 0xBE, 0x7F, 0x99, 0x98, 0x7F, 0xFF, 0xFC, 0xE2, 0x03, 0x32,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x99, 0x30, 0x41, 0xBF, 0xAE, 0x7F, 0x62, 0x82, 0x84, 0x7F, 0xAD, 0x2E, 0x7F,
-    0x99, 0xF6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xFF, 0xF7, 0x7F, 0x99, 0x18, 0x62, 0x2E, 0x2D, 0x7F,
-    0x99, 0xE0, 0x7F, 0x99, 0x0B, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x87, 0x88, 0x8C, 0x8E, 0x8A, 0x91, 0x85, 0x86,
-    0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0xFF, 0xB8, 0x7F, 0xA1, 0x22, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEA, 0x7F, 0xA0, 0xC4,
-    0x7F, 0xA0, 0x35, 0x7F, 0xA4, 0x74, 0x7F, 0xFF, 0xF7, 0x7F, 0xE4, 0x8F, 0x7F, 0xA3, 0xD8, 0x7F, 0x9D, 0x11, 0x7F,
-    0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0xC2, 0x02,
-    0xB1, 0xD0, 0xD1, 0xFE, 0xF4, 0xFF, 0xBB, 0x65, 0xB1, 0xB4, 0xBA, 0xBD, 0xBE, 0x7F, 0x9D, 0x18, 0x7F, 0x98, 0xA9,
-    0x7F, 0xA2, 0x39, 0x7F, 0x99, 0xC4, 0x7F, 0x98, 0xC0, 0x61, 0x88, 0x7F, 0x98, 0xE4, 0x21, 0xD1, 0xFB, 0x21, 0x80,
-    0xFD, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0x98, 0x94, 0x42, 0xB5, 0xB8,
-    0xA0, 0xF0, 0xA0, 0xF0, 0x62, 0x8B, 0x91, 0x7F, 0x98, 0x99, 0x7F, 0xA0, 0xE9, 0xE3, 0x03, 0xE2, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7F, 0x98, 0x75, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xB6, 0xCB, 0x7F, 0x98,
-    0x66, 0x41, 0x8B, 0xA1, 0xE0, 0x21, 0xD1, 0xFC, 0x63, 0xB0, 0xB5, 0xB7, 0x7F, 0xD0, 0xA3, 0x7F, 0x98, 0xA5, 0x7F,
-    0xFF, 0xFD, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xBA, 0xA2, 0x7F, 0x98, 0x47, 0x63, 0x81,
-    0x82, 0x86, 0x7F, 0x98, 0x7D, 0x7F, 0x98, 0x7D, 0x7F, 0x98, 0x7D, 0x42, 0xD0, 0xD1, 0xAA, 0xBE, 0xFF, 0xF3, 0x61,
-    0xB1, 0x7F, 0x9A, 0x3E, 0x62, 0x81, 0x82, 0x7F, 0x98, 0x7E, 0x7F, 0x98, 0x64, 0x22, 0xD0, 0xD1, 0xF2, 0xF7, 0x41,
-    0x80, 0xA0, 0x4D, 0x63, 0x2E, 0xD0, 0xD1, 0x7F, 0x98, 0x28, 0x7F, 0xC7, 0xB9, 0x7F, 0xFF, 0xFC, 0x23, 0xB0, 0xB5,
-    0xBE, 0xD5, 0xEA, 0xF3, 0x42, 0xD0, 0xD1, 0xFF, 0xD5, 0xA5, 0x25, 0x62, 0x83, 0x91, 0x7F, 0x98, 0x37, 0x7F, 0xFF,
-    0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF7, 0x7F, 0x97, 0xE9, 0x41, 0x83, 0xA0, 0x18, 0x62,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x97, 0xD8, 0x41, 0x8B, 0xA4, 0x76, 0xE2, 0x03, 0x32, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xFC, 0x7F, 0x97, 0xCB, 0x62, 0xB5, 0xBE, 0x7F, 0x97, 0xB5, 0x7F, 0x9C, 0x65, 0xA1, 0x01, 0xE1, 0xD0, 0xF7, 0x42,
-    0xBA, 0xBF, 0xAD, 0x0C, 0xFF, 0xFB, 0x62, 0xBC, 0xBD, 0x7F, 0x97, 0xF0, 0x7F, 0xA1, 0x30, 0x21, 0xD0, 0xF7, 0x65,
-    0x80, 0x81, 0x84, 0x85, 0x8F, 0x7F, 0xA0, 0xAD, 0x7F, 0xFF, 0xFD, 0x7F, 0x97, 0xF0, 0x7F, 0x9C, 0x1E, 0x7F, 0x97,
-    0xF0, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF, 0xEB, 0x7F, 0x97, 0x8A, 0x70, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0x7F, 0xFE, 0xE7, 0x7F, 0x9E,
-    0xAE, 0x7F, 0xFF, 0x06, 0x7F, 0x9F, 0x3D, 0x7F, 0xBB, 0xA3, 0x7F, 0xFF, 0x15, 0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x34,
-    0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xF1, 0x7F, 0x9E, 0xC1, 0x7F,
-    0x9B, 0x8A, 0x7F, 0x9B, 0x8A, 0x62, 0xB7, 0xBD, 0x7F, 0x97, 0x7F, 0x7F, 0x99, 0x54, 0xA0, 0x0B, 0xC3, 0x21, 0x81,
-    0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x61, 0xB9, 0x7F, 0x97, 0x6B, 0x21, 0xD0, 0xFB, 0x41, 0xBF, 0xBA, 0x10, 0x42,
-    0xD0, 0xD1, 0xFF, 0xFC, 0xA4, 0x46, 0x61, 0x87, 0x7F, 0x97, 0x64, 0xA1, 0x02, 0xB1, 0xD1, 0xFB, 0x62, 0xB2, 0xBC,
-    0x7F, 0x97, 0x4E, 0x7F, 0xFF, 0xFB, 0x21, 0xD0, 0xF7, 0x24, 0xB0, 0xB5, 0xB8, 0xBE, 0xD2, 0xDC, 0xE3, 0xFD, 0x62,
-    0x8B, 0x8F, 0x7F, 0x97, 0x39, 0x7F, 0x97, 0x39, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x96, 0xEB, 0x64, 0xB3, 0xB5, 0xB9, 0xBD, 0x7F, 0xAC, 0xD4, 0x7F, 0x97, 0xB3, 0x7F, 0x97, 0xB3, 0x7F, 0x98, 0xF8,
-    0xC1, 0x00, 0x92, 0xD0, 0xB9, 0xAE, 0x41, 0x2E, 0xBD, 0xEA, 0x65, 0x80, 0x81, 0x88, 0x8E, 0x8F, 0x7F, 0xFF, 0xF6,
-    0x7F, 0x98, 0xDD, 0x7F, 0x98, 0xDD, 0x7F, 0x97, 0x98, 0x7F, 0xFF, 0xFC, 0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x98,
-    0xC8, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xEB, 0x7F, 0x96, 0xAE, 0x61, 0x8E, 0x7F, 0x96, 0xF9, 0x62, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xFB, 0x7F, 0x96, 0x98, 0x71, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8C, 0x8A, 0x91, 0x84, 0x86, 0x89,
-    0x8B, 0x8D, 0x8E, 0x8F, 0x7F, 0xFF, 0xA4, 0x7F, 0xAA, 0x57, 0x7F, 0x9D, 0xC2, 0x7F, 0xFF, 0xE1, 0x7F, 0x9E, 0x57,
-    0x7F, 0xAA, 0x57, 0x7F, 0x9E, 0x51, 0x7F, 0xFF, 0xF7, 0x7F, 0xA1, 0x65, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F,
-    0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x42, 0xD0,
-    0xD1, 0xFE, 0xCF, 0xFF, 0xBB, 0x62, 0xBC, 0xBF, 0x7F, 0x9D, 0x8F, 0x7F, 0x9A, 0xA7, 0x61, 0x85, 0x7F, 0x9D, 0x86,
-    0xE4, 0x01, 0x31, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x9D, 0x81, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0x96, 0x35,
-    0x62, 0x8B, 0x91, 0x7F, 0x96, 0xF7, 0x7F, 0x96, 0x81, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x97, 0x0F, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x96, 0x19, 0x64, 0xB7, 0xBA, 0xBE, 0xBF, 0x7F, 0x96, 0x3A, 0x7F, 0x96, 0x3A, 0x7F, 0xB4, 0x58, 0x7F, 0x9A,
-    0x8B, 0x61, 0xB0, 0x7F, 0x98, 0xC4, 0xA1, 0x01, 0x31, 0xD0, 0xFB, 0x42, 0x81, 0x82, 0xB8, 0xE3, 0xFF, 0xFB, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xF9, 0x7F, 0x95, 0xEA, 0xC1, 0x02, 0x92, 0xD0, 0xCC, 0x90, 0x63,
-    0xBA, 0xBE, 0xBF, 0x7F, 0xFF, 0xFA, 0x7F, 0x9A, 0x3B, 0x7F, 0x96, 0x28, 0x63, 0x81, 0x83, 0x84, 0x7F, 0x9A, 0x21,
-    0x7F, 0x95, 0xD6, 0x7F, 0x9B, 0xD6, 0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7F,
-    0x95, 0xBD, 0x42, 0xB1, 0xB4, 0xAB, 0xA4, 0xAB, 0x08, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0xD1, 0xA5,
-    0x7F, 0x95, 0xA7, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6,
-    0xB9, 0x7F, 0xFF, 0x65, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0x81, 0x7F, 0x9D, 0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xB0,
-    0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xDD, 0x7F, 0xA9, 0x62, 0x7F, 0x9C, 0xCD, 0x7F, 0x9D, 0x5C, 0x7F, 0x9C, 0xCD, 0x7F,
-    0xFF, 0xF3, 0x7F, 0xA1, 0x0C, 0x7F, 0x99, 0xA9, 0x7F, 0x99, 0xA9, 0xE1, 0x03, 0x91, 0x2D, 0x7F, 0x95, 0x59, 0xC1,
-    0x01, 0xB1, 0xD0, 0xCC, 0x05, 0x21, 0xBF, 0xFA, 0xE2, 0x03, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x95, 0x49,
-    0x71, 0x80, 0x81, 0x82, 0x83, 0x86, 0x88, 0x8B, 0x8E, 0x8A, 0x91, 0x84, 0x85, 0x87, 0x89, 0x8C, 0x8D, 0x8F, 0x7F,
-    0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0xFF, 0xE5, 0x7F, 0x9D, 0x00, 0x7F, 0xAA, 0x50, 0x7F, 0xFF,
-    0xF5, 0x7F, 0xC2, 0xF6, 0x7F, 0xA0, 0x14, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D,
-    0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x5F,
-    0xFF, 0xBB, 0x61, 0xD1, 0x7F, 0x94, 0xEB, 0x62, 0xD0, 0xD1, 0x7F, 0x96, 0x56, 0x7F, 0xAB, 0x33, 0x21, 0xB2, 0xF7,
-    0x62, 0xD0, 0xD1, 0x7F, 0xFF, 0xFD, 0x7F, 0x98, 0x43, 0x22, 0xB4, 0xB5, 0xE6, 0xF7, 0x62, 0xB2, 0xB5, 0x7F, 0x97,
-    0x5F, 0x7F, 0x94, 0xFF, 0x62, 0x83, 0x8F, 0x7F, 0x94, 0xF6, 0x7F, 0x94, 0xF6, 0x22, 0xD0, 0xD1, 0xEE, 0xF7, 0x21,
-    0x82, 0xFB, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xFD, 0xC8, 0x3D, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xD7, 0x7F, 0xFF, 0xF9, 0x7F, 0x94, 0xAD, 0x63, 0xB2, 0xB3, 0xBE, 0x7F, 0x98, 0x93, 0x7F, 0x99, 0x02, 0x7F,
-    0x94, 0xCC, 0x62, 0x80, 0x81, 0x7F, 0xF1, 0xE5, 0x7F, 0x98, 0x86, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xEA, 0x7F, 0xFF, 0xF7, 0x7F, 0x94, 0x88, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xB0, 0x07, 0x7F, 0x94, 0x79, 0x61,
-    0x86, 0x7F, 0x9B, 0xBA, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xDC, 0xB6, 0x7F, 0xFF, 0xFB, 0x7F, 0x94, 0x69,
-    0x62, 0xB3, 0xB6, 0x7F, 0x94, 0x75, 0x7F, 0x94, 0x75, 0xA1, 0x00, 0xA1, 0xD0, 0xF7, 0xE1, 0x02, 0x21, 0x2E, 0x7F,
-    0x94, 0xAB, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x9C, 0x81, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0x81,
-    0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x94, 0x34, 0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x95, 0x00, 0x7F, 0x95, 0x00,
-    0x7F, 0x94, 0x8A, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x1E, 0x70, 0xB0, 0xB1, 0xB2, 0xB4,
-    0xB5, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x66, 0x7F, 0x9B, 0x46, 0x7F,
-    0x9A, 0xB9, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF, 0xAA, 0x7F, 0x9B, 0x46, 0x7F, 0xFF,
-    0xDF, 0x7F, 0xFF, 0xF5, 0x7F, 0x9B, 0x46, 0x7F, 0xFE, 0xBA, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22,
-    0x7F, 0x98, 0x22, 0x63, 0xB0, 0xB5, 0xBC, 0x7F, 0x9D, 0x57, 0x7F, 0x94, 0x31, 0x7F, 0x94, 0xA7, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0xBF, 0x7F, 0x93, 0xC5, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xDC, 0x05, 0x7F,
-    0x93, 0xB8, 0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x94, 0x82, 0x7F, 0xBA, 0xC2, 0x7F, 0xA3, 0x47, 0x7F, 0x93, 0xAD,
-    0x41, 0x80, 0xF0, 0xF0, 0xE2, 0x02, 0xB1, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x93, 0x98, 0x71, 0x81, 0x82, 0x83,
-    0x85, 0x87, 0x8C, 0x91, 0x8A, 0x80, 0x84, 0x86, 0x88, 0x89, 0x8B, 0x8D, 0x8E, 0x8F, 0x7F, 0x9A, 0xC0, 0x7F, 0xFF,
-    0xC8, 0x7F, 0xFF, 0xD5, 0x7F, 0xC5, 0x6B, 0x7F, 0x9A, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF5, 0x7F, 0x9E, 0x63,
-    0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F,
-    0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x42, 0xD0, 0xD1, 0xFF, 0x35, 0xFF, 0xBB, 0x62, 0xD0, 0xD1, 0x7F,
-    0x98, 0x3C, 0x7F, 0x94, 0xFE, 0x61, 0xBA, 0x7F, 0x9C, 0x6D, 0x21, 0xD0, 0xFB, 0x64, 0xB1, 0xB3, 0xB4, 0xBD, 0x7F,
-    0x97, 0x94, 0x7F, 0xFF, 0xEF, 0x7F, 0x97, 0xD5, 0x7F, 0xFF, 0xFD, 0x63, 0x80, 0x81, 0x82, 0x7F, 0x96, 0xFE, 0x7F,
-    0xB1, 0x6B, 0x7F, 0xDA, 0xB6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x93, 0x12, 0x41,
-    0xB5, 0xA3, 0x4B, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x93, 0x01, 0x64, 0xB3, 0xBA, 0xBE, 0xBF,
-    0x7F, 0x97, 0x5A, 0x7F, 0x93, 0x24, 0x7F, 0x96, 0x42, 0x7F, 0xA7, 0x03, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEF,
-    0x7F, 0xB5, 0x40, 0x7F, 0x92, 0xE5, 0x62, 0xB1, 0xBF, 0x7F, 0x97, 0x3C, 0x7F, 0x97, 0x3C, 0x61, 0x84, 0x7F, 0x98,
-    0xDB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0x92, 0xCA, 0x41, 0xBE, 0xDD, 0xD3, 0xE2,
-    0x04, 0xC3, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x92, 0xB9, 0x62, 0xB9, 0xBD, 0x7F, 0x9C, 0x33, 0x7F, 0x93, 0x83,
-    0x21, 0xD0, 0xF7, 0x63, 0xB2, 0xBB, 0xBD, 0x7F, 0x93, 0x77, 0x7F, 0x93, 0x77, 0x7F, 0x93, 0x01, 0x63, 0x81, 0x82,
-    0x84, 0x7F, 0x92, 0xF4, 0x7F, 0x98, 0x8F, 0x7F, 0x92, 0xF4, 0x63, 0x2E, 0xD0, 0xD1, 0x7F, 0x92, 0xE7, 0x7F, 0xFF,
-    0xE6, 0x7F, 0xFF, 0xF3, 0x62, 0xB2, 0xB3, 0x7F, 0x93, 0x50, 0x7F, 0x92, 0xDA, 0x62, 0x2E, 0xD0, 0x7F, 0x92, 0xD1,
-    0x7F, 0xFF, 0xF7, 0x23, 0xB5, 0xB8, 0xBE, 0xC4, 0xE1, 0xF7, 0x63, 0xB5, 0xBA, 0xBF, 0x7F, 0x93, 0x37, 0x7F, 0x93,
-    0x37, 0x7F, 0x92, 0xC1, 0x63, 0x82, 0x87, 0x8E, 0x7F, 0x93, 0x2A, 0x7F, 0x93, 0x2A, 0x7F, 0x93, 0x2A, 0x22, 0xD0,
-    0xD1, 0xE6, 0xF3, 0x64, 0x8B, 0x8E, 0x8F, 0x91, 0x7F, 0x92, 0x88, 0x7F, 0x92, 0xA2, 0x7F, 0xFF, 0xFB, 0x7F, 0xC2,
-    0x2A, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xEF, 0x7F, 0x92, 0x32, 0xC1, 0x05, 0x02, 0x2E, 0x9F,
-    0x4E, 0x21, 0x8B, 0xFA, 0xE2, 0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x92, 0x1C, 0x41, 0xB8, 0xB3, 0x3F,
-    0x41, 0x83, 0xF8, 0xD0, 0xE3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFC, 0x7F, 0x92, 0x09,
-    0xE2, 0x02, 0x42, 0xD1, 0x2D, 0x7F, 0xD5, 0x1A, 0x7F, 0x91, 0xFA, 0x70, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBF, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBE, 0x7F, 0xFE, 0xDD, 0x7F, 0x99, 0x22, 0x7F, 0xFE, 0xEE, 0x7F,
-    0xFF, 0x0A, 0x7F, 0xFF, 0x25, 0x7F, 0xFF, 0x36, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x93, 0x81, 0x7F, 0x93, 0xDA, 0x7F, 0x91, 0xAE, 0x61, 0xB5, 0x7F, 0x98, 0x8C, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0xC9, 0xEF, 0x7F, 0x91, 0x9C, 0x62, 0xB5, 0xB8, 0x7F, 0x98, 0xDB, 0x7F,
-    0x98, 0xDB, 0x63, 0x8E, 0x8F, 0x91, 0x7F, 0x98, 0xD2, 0x7F, 0x98, 0xD2, 0x7F, 0x98, 0xD2, 0xE4, 0x02, 0x21, 0x2E,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xB2, 0xA7, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7F, 0x91, 0x79, 0x71, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x85, 0x86, 0x87, 0x8C, 0x8E, 0x8A, 0x91, 0x88, 0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0x98, 0x99, 0x7F, 0x98,
-    0x99, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xCA, 0x7F, 0x99, 0x28, 0x7F, 0x98, 0x0C, 0x7F, 0x99, 0x28, 0x7F, 0x98, 0x99,
-    0x7F, 0xFF, 0xED, 0x7F, 0xDC, 0xF3, 0x7F, 0x9C, 0x3C, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F,
-    0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x32, 0xFF, 0xBB, 0x64, 0xB1,
-    0xB3, 0xB4, 0xB8, 0x7F, 0xCD, 0x3A, 0x7F, 0x95, 0x7C, 0x7F, 0x97, 0x24, 0x7F, 0xED, 0xC9, 0x63, 0x81, 0x85, 0x88,
-    0x7F, 0x91, 0x35, 0x7F, 0x91, 0x35, 0x7F, 0x9E, 0x81, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3,
-    0x7F, 0x90, 0xFA, 0x41, 0xBF, 0xC3, 0xED, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x90, 0xE9, 0x70, 0xB2, 0xB5,
-    0xB8, 0xBC, 0xBD, 0xB0, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBA, 0xBB, 0xBE, 0xBF, 0x7F, 0xA5, 0xF2, 0x7F, 0xFF,
-    0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x98, 0xA2, 0x7F, 0x98, 0x13, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF,
-    0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F,
-    0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x71, 0x80, 0x8C, 0x8A, 0x91, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8B, 0x8D, 0x8E, 0x8F, 0x7F, 0x97, 0xD2, 0x7F, 0xF7, 0x94, 0x7F, 0x9B, 0x75, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE,
-    0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F,
-    0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0xC2, 0x02,
-    0xB1, 0xD0, 0xD1, 0xFF, 0x7A, 0xFF, 0xBB, 0x63, 0xB3, 0xB4, 0xBB, 0x7F, 0x90, 0x46, 0x7F, 0x96, 0x45, 0x7F, 0x90,
-    0x46, 0xA0, 0x02, 0x42, 0x63, 0x80, 0x81, 0x85, 0x7F, 0xFF, 0xFD, 0x7F, 0x90, 0x36, 0x7F, 0x91, 0x4A, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xF3, 0x7F, 0x90, 0x34, 0x70, 0xB5, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6,
-    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F,
-    0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94,
-    0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36,
-    0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0x9F, 0x37, 0x7F, 0x8F, 0xE6, 0x21, 0x80, 0x97, 0x62, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xFD, 0x7F, 0x8F, 0xD8, 0x71, 0x8E, 0x8F, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A,
-    0x8B, 0x8C, 0x8D, 0x7F, 0x97, 0x15, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F,
-    0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93,
-    0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0xC2, 0x00, 0x91,
-    0xD0, 0xD1, 0xFF, 0x63, 0xFF, 0xBB, 0x64, 0xB0, 0xB8, 0xBB, 0xBD, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F,
-    0x76, 0x7F, 0x8F, 0xE0, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x8F, 0x70, 0x62, 0xB5, 0xBE, 0x7F, 0x8F, 0x5C,
-    0x7F, 0x90, 0x80, 0x42, 0xD0, 0xD1, 0xFF, 0xF7, 0xCA, 0x32, 0x21, 0x80, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x95,
-    0xBF, 0x7F, 0xFF, 0xFD, 0x7F, 0x8F, 0x54, 0x64, 0xB2, 0xB4, 0xBB, 0xBD, 0x7F, 0x92, 0x87, 0x7F, 0x8F, 0x3C, 0x7F,
-    0x8F, 0xA6, 0x7F, 0xB9, 0x0D, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x8F, 0x36, 0xE2, 0x01, 0xB1, 0xD0, 0x2D,
-    0x7F, 0xD9, 0x81, 0x7F, 0x8F, 0x2D, 0xC1, 0x01, 0xB1, 0xD0, 0xAC, 0x2F, 0x63, 0xB2, 0xBB, 0xBE, 0x7F, 0x90, 0x35,
-    0x7F, 0xFF, 0xFA, 0x7F, 0x91, 0x9A, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x97, 0xDC, 0x7F, 0x8F, 0x0F,
-    0x61, 0xBB, 0x7F, 0x9B, 0x19, 0x21, 0xD0, 0xFB, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x62, 0xD0,
-    0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8E, 0xF1, 0x62, 0xD0, 0x2D, 0x7F, 0xF1, 0xC9, 0x7F, 0x8E, 0xE8, 0x70, 0xB1, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB2, 0xB9, 0xBE, 0x7F, 0x95, 0x4E, 0x7F, 0xFF,
-    0x6F, 0x7F, 0xFF, 0x8B, 0x7F, 0x96, 0x25, 0x7F, 0xB7, 0xB2, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xD0,
-    0x7F, 0xBC, 0x15, 0x7F, 0xF1, 0x6B, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x7F,
-    0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x41, 0xD1, 0xB1, 0x5D, 0x63, 0xB0, 0xB2, 0xB5, 0x7F, 0xDF, 0x1F, 0x7F, 0x8E, 0x8F,
-    0x7F, 0xFF, 0xFC, 0x42, 0x8C, 0x91, 0xA2, 0xEE, 0xFF, 0xEF, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF,
-    0xF9, 0x7F, 0x8E, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0x8E, 0xAA, 0x7F, 0x93, 0xE9, 0x66, 0xB0, 0xB5, 0xBA, 0xBD, 0xBE,
-    0xBF, 0x7F, 0x8E, 0x8B, 0x7F, 0x8E, 0x8B, 0x7F, 0xFF, 0xF7, 0x7F, 0x8E, 0xCF, 0x7F, 0x8E, 0x8B, 0x7F, 0x8E, 0x65,
-    0x64, 0x85, 0x87, 0x88, 0x91, 0x7F, 0x8E, 0xB6, 0x7F, 0x8E, 0x4C, 0x7F, 0x8E, 0xB6, 0x7F, 0x8E, 0x72, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xD6, 0x7F, 0xFF, 0xEF, 0x7F, 0x8E, 0x46, 0x62, 0x80, 0x8C, 0x7F, 0x8E, 0x2E, 0x7F, 0xBA,
-    0x58, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xCC, 0xC6, 0x7F, 0xFF, 0xF7, 0x7F, 0x8E, 0x30, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
-    0x8F, 0x3F, 0x7F, 0xB1, 0x94, 0x7F, 0x8E, 0x23, 0x41, 0xB2, 0xA9, 0x96, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F,
-    0x8E, 0x12, 0x71, 0x80, 0x81, 0x82, 0x83, 0x88, 0x8F, 0x91, 0x84, 0x85, 0x86, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
-    0x8E, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0xC3, 0x7F, 0xFF, 0xD9, 0x7F, 0x95, 0x4F, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F,
-    0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0xC2, 0x00, 0x91, 0xD0, 0xD1,
-    0xFE, 0xE5, 0xFF, 0xBB, 0x41, 0xD1, 0x9E, 0x4E, 0x21, 0xB0, 0xFC, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD,
-    0x7F, 0x8D, 0xB4, 0x62, 0xD1, 0x2D, 0x7F, 0x9A, 0x84, 0x7F, 0x8D, 0xA9, 0x62, 0xD1, 0x2D, 0x7F, 0xDB, 0x51, 0x7F,
-    0x8D, 0xA0, 0x62, 0xB7, 0xBA, 0x7F, 0x92, 0x9F, 0x7F, 0x8D, 0xC5, 0xE3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xF7, 0x7F, 0xED, 0xC8, 0x7F, 0x8D, 0x8E, 0x62, 0xD0, 0x2D, 0x7F, 0x8E, 0xCA, 0x7F, 0x8D, 0x7F, 0x62, 0xB4, 0xBA,
-    0x7F, 0x8D, 0x82, 0x7F, 0x8D, 0x82, 0x21, 0xD0, 0xF7, 0x62, 0xB8, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0xC6, 0x62,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0x61, 0x41, 0xB5, 0xAA, 0x01, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F,
-    0x8D, 0x54, 0x61, 0xBE, 0x7F, 0x8D, 0xCF, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x8E,
-    0x5C, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0x40, 0x70, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB0, 0xB3, 0xB6, 0xB9, 0xBB, 0x7F, 0xFF, 0x7F, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF,
-    0xB4, 0x7F, 0xD8, 0xC0, 0x7F, 0x93, 0xA2, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDF, 0x7F, 0xBF, 0x11, 0x7F, 0xFF, 0xF3,
-    0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x62, 0xBA, 0xBD, 0x7F,
-    0x8C, 0xE7, 0x7F, 0x8D, 0x51, 0x62, 0xD0, 0xD1, 0x7F, 0x8D, 0x9A, 0x7F, 0x99, 0xC4, 0x21, 0x82, 0xF7, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C, 0xDD, 0x41, 0xBC, 0xDF, 0xBC, 0x21, 0xD0, 0xFC, 0x64,
-    0xB0, 0xB8, 0xBC, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0xB1, 0x19, 0x7F, 0x8D, 0x28, 0x7F, 0x8F, 0x99, 0x62, 0xB0, 0xB5,
-    0x7F, 0xBD, 0xBE, 0x7F, 0x8C, 0xAD, 0x62, 0x83, 0x8B, 0x7F, 0x8C, 0xA4, 0x7F, 0x8C, 0xA4, 0x22, 0xD0, 0xD1, 0xEE,
-    0xF7, 0x21, 0x80, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C, 0x9E, 0x61, 0xB7,
-    0x7F, 0x8F, 0x1F, 0xA1, 0x01, 0xE1, 0xD0, 0xFB, 0x21, 0xBE, 0xFB, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C,
-    0x84, 0x62, 0xB0, 0xB5, 0x7F, 0x8C, 0xDA, 0x7F, 0x8C, 0xDA, 0x62, 0x83, 0x91, 0x7F, 0x8C, 0xD1, 0x7F, 0x8C, 0xD1,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x8C, 0x69, 0x41, 0xD1, 0x9D, 0xA5, 0x62, 0xB2,
-    0xB3, 0x7F, 0x8C, 0x86, 0x7F, 0xFF, 0xFC, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x8C, 0x4F, 0x61,
-    0xB7, 0x7F, 0x91, 0x4C, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8C, 0x3F, 0x71, 0x81, 0x82, 0x85,
-    0x89, 0x8E, 0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x57, 0x7F, 0xFF,
-    0x96, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xCB, 0x7F, 0xBE, 0x12, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF5, 0x7F, 0x90, 0x43,
-    0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F,
-    0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFE, 0xBC, 0xFF, 0xBB, 0xE2, 0x00,
-    0x91, 0xD1, 0x2D, 0x7F, 0x8D, 0x99, 0x7F, 0x8B, 0xE6, 0xE1, 0x01, 0xF1, 0xD1, 0x7F, 0x8E, 0xB4, 0x21, 0x81, 0xF9,
-    0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x8F, 0xC2, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B, 0xD1, 0x61, 0xB5, 0x7F, 0x95, 0x46, 0x62,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8B, 0xBF, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0x8B, 0xD4, 0x7F, 0x8B, 0xB6,
-    0xE2, 0x00, 0xA1, 0xD1, 0x2D, 0x7F, 0xAF, 0x1C, 0x7F, 0x8B, 0xAB, 0x62, 0xD0, 0x2D, 0x7F, 0xAC, 0x49, 0x7F, 0x8B,
-    0xA0, 0x41, 0xB8, 0xEC, 0x42, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x8B, 0x93, 0x70, 0xB2, 0xB3,
-    0xB4, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0x7F, 0xFF, 0xA2, 0x7F, 0x93,
-    0x4A, 0x7F, 0x96, 0x38, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xE8,
-    0x7F, 0xFF, 0xF5, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F,
-    0x8F, 0x97, 0x7F, 0x8F, 0x97, 0xC1, 0x00, 0x91, 0xD1, 0x9E, 0x1A, 0x63, 0xB5, 0xB8, 0xBE, 0x7F, 0x8B, 0x86, 0x7F,
-    0xFF, 0xFA, 0x7F, 0xA5, 0x4F, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xAA, 0x86, 0x7F, 0x8B, 0x34, 0x63,
-    0xBA, 0xBC, 0xBE, 0x7F, 0x8B, 0x78, 0x7F, 0x8B, 0x6F, 0x7F, 0x8B, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0xAD, 0xE8, 0x7F,
-    0x8C, 0xD7, 0x21, 0x82, 0xF7, 0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B,
-    0x0E, 0x41, 0xBB, 0xE4, 0xD6, 0x21, 0xD0, 0xFC, 0x62, 0xB5, 0xB8, 0x7F, 0x8B, 0x57, 0x7F, 0xFF, 0xFD, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xA6, 0x7F, 0x8A, 0xEF, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0xA9, 0x47,
-    0x7F, 0x8A, 0xE2, 0x71, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x8F, 0x91, 0x83, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
-    0x8D, 0x8E, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE8, 0x7F, 0xBC, 0xB5, 0x7F, 0xFF, 0xF5, 0x7F, 0xBC,
-    0xB5, 0x7F, 0x92, 0x1D, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6,
-    0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0xC2, 0x02, 0xB1, 0xD0,
-    0xD1, 0xFF, 0x0A, 0xFF, 0xBB, 0x61, 0xB5, 0x7F, 0x8B, 0xA2, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0xE3, 0x00, 0x91,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xC3, 0xD3, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x7E, 0x62, 0xD1, 0x2D, 0x7F, 0xED, 0x04, 0x7F,
-    0x8A, 0x6F, 0x63, 0xB3, 0xB8, 0xBE, 0x7F, 0x8A, 0x5B, 0x7F, 0xB5, 0x6B, 0x7F, 0x8A, 0xAB, 0x62, 0xD0, 0x2D, 0x7F,
-    0xFF, 0xF3, 0x7F, 0x8A, 0x59, 0x61, 0xD0, 0x7F, 0x90, 0xBB, 0x21, 0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD,
-    0xE2, 0x00, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x42, 0x61, 0xB2, 0x7F, 0x8B, 0x50, 0xE2, 0x00, 0x91,
-    0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8A, 0x32, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x8A, 0x6C, 0x7F, 0x8A, 0x6C, 0x7F,
-    0x8A, 0x86, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xA1, 0xB2, 0x7F, 0x8A, 0x1A, 0xE1, 0x07, 0xB2, 0x2D,
-    0x7F, 0x8A, 0x0D, 0x70, 0xB0, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB6, 0xB9,
-    0xBF, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0x88, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0x97, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0xAD,
-    0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xEC, 0x7F, 0xD9, 0xCE, 0x7F, 0xB7, 0x3C, 0x7F, 0xFF, 0xF9, 0x7F,
-    0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x61, 0xBC, 0x7F, 0x8C, 0x87, 0xA1, 0x00, 0x91,
-    0xD0, 0xFB, 0xC1, 0x00, 0x91, 0xD1, 0xB5, 0x48, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x89, 0xFA, 0x7F, 0xFF, 0xF5,
-    0x7F, 0xFF, 0xFA, 0x7F, 0x89, 0xFA, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0xA8, 0xF6, 0x7F, 0x89, 0xA4,
-    0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x89, 0xDC, 0x7F, 0x89, 0xDC, 0x7F, 0x89, 0xDC, 0x61, 0x8F, 0x7F, 0x89, 0xCF, 0x22,
-    0xD0, 0xD1, 0xEE, 0xFB, 0x21, 0x82, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xC6, 0xFE, 0x7F, 0xFF, 0xFD, 0x7F, 0x89,
-    0x7D, 0x62, 0xB8, 0xBE, 0x7F, 0x89, 0xB5, 0x7F, 0x89, 0xB5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xA8,
-    0xB9, 0x7F, 0x89, 0x67, 0x41, 0xB0, 0xA5, 0xBF, 0xE2, 0x00, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x89, 0x56,
-    0x71, 0x80, 0x81, 0x82, 0x85, 0x87, 0x89, 0x8F, 0x91, 0x83, 0x84, 0x86, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F,
-    0xFF, 0xA7, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF5, 0x7F, 0x8F, 0xF1, 0x7F, 0xB6, 0x81, 0x7F, 0x8F,
-    0xF1, 0x7F, 0x8F, 0xF1, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A,
-    0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x00,
-    0xFF, 0xBB, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x89, 0x2B, 0x7F, 0x89, 0x45, 0x7F, 0x89, 0x2B, 0x62, 0x8E, 0x91, 0x7F,
-    0x89, 0x38, 0x7F, 0x89, 0x38, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xEA, 0xF7, 0x21, 0x80, 0xF9, 0x62, 0xD1, 0x2D, 0x7F,
-    0xFF, 0xFD, 0x7F, 0x88, 0xDD, 0x61, 0xD0, 0x7F, 0x92, 0xEF, 0x62, 0xB8, 0xBE, 0x7F, 0xFF, 0xFB, 0x7F, 0x89, 0x14,
-    0x62, 0x83, 0x85, 0x7F, 0x89, 0x0B, 0x7F, 0x9E, 0xBC, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7,
-    0x7F, 0x88, 0xBD, 0x62, 0xBB, 0xBD, 0x7F, 0x89, 0xC9, 0x7F, 0x89, 0x0F, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F,
-    0x88, 0xA7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x96, 0x1D, 0x7F, 0x8A, 0x51, 0x7F, 0x88, 0x9E, 0x62, 0xB3, 0xBE, 0x7F,
-    0x9B, 0xC3, 0x7F, 0x88, 0xD6, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x88, 0x88, 0x62, 0xB2, 0xBB, 0x7F, 0x89,
-    0x98, 0x7F, 0x89, 0x98, 0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x91, 0x43, 0x7F, 0x88, 0x76,
-    0xE2, 0x00, 0x91, 0xD1, 0x2D, 0x7F, 0x8A, 0x2C, 0x7F, 0x88, 0x67, 0x41, 0xB1, 0xCC, 0x25, 0x63, 0xD0, 0xD1, 0x2D,
-    0x7F, 0xFF, 0xFC, 0x7F, 0x8A, 0x1D, 0x7F, 0x88, 0x58, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x88, 0x69, 0x7F, 0xA1, 0x99,
-    0x7F, 0x88, 0x4B, 0x70, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB6, 0xB9, 0xBE,
-    0xBF, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xA0, 0x7F, 0x8E, 0xE4, 0x7F, 0xFF, 0xB6,
-    0x7F, 0x8E, 0xE4, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7F, 0x8C, 0x4D, 0x7F,
-    0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x88, 0x42, 0x7F,
-    0x88, 0x42, 0x7F, 0x88, 0x42, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xEA, 0x85, 0x7F, 0x87, 0xF0, 0x62,
-    0xBA, 0xBB, 0x7F, 0x88, 0x11, 0x7F, 0x88, 0x11, 0x62, 0xB2, 0xBE, 0x7F, 0x87, 0xE6, 0x7F, 0x88, 0x1F, 0xE2, 0x01,
-    0xB1, 0xD0, 0xD1, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0xD9, 0x21, 0x82, 0xF5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE0,
-    0x7F, 0xFF, 0xFD, 0x7F, 0x87, 0xC3, 0xE1, 0x00, 0xD1, 0xD0, 0x7F, 0x8A, 0x30, 0x64, 0xB0, 0xB2, 0xB8, 0xBE, 0x7F,
-    0x87, 0xF4, 0x7F, 0x87, 0xF7, 0x7F, 0xFF, 0xF9, 0x7F, 0x87, 0xF4, 0x64, 0x83, 0x8B, 0x8C, 0x8F, 0x7F, 0x87, 0xE3,
-    0x7F, 0x87, 0xE3, 0x7F, 0xB3, 0xBD, 0x7F, 0x87, 0xE3, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF,
-    0x7F, 0x87, 0x8D, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x8B, 0x71, 0x7F, 0xB6, 0x2D, 0x7F, 0x87, 0x80, 0x61, 0xB5, 0x7F,
-    0x87, 0xCF, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x87, 0x6E, 0x71, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86, 0x88,
-    0x8E, 0x8F, 0x91, 0x84, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x75, 0x7F, 0xFF, 0xA2, 0x7F, 0xFF, 0xD8,
-    0x7F, 0x8E, 0x0B, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0xD4, 0x7F, 0xEE, 0x5A, 0x7F, 0x8E, 0x98, 0x7F,
-    0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B,
-    0x74, 0x7F, 0x8B, 0x74, 0x42, 0xD0, 0xD1, 0xFE, 0xE2, 0xFF, 0xBB, 0x42, 0xD0, 0xD1, 0xAA, 0xB2, 0xB2, 0x96, 0x21,
-    0x80, 0xF9, 0xE2, 0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x87, 0x0F, 0x62, 0xB5, 0xBE, 0x7F, 0x87, 0x49,
-    0x7F, 0x87, 0x49, 0x61, 0xB5, 0x7F, 0x90, 0x80, 0x21, 0xD0, 0xFB, 0x62, 0x80, 0x83, 0x7F, 0xFF, 0xFD, 0x7F, 0x87,
-    0x38, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x86, 0xEA, 0x61, 0x88, 0x7F, 0x8F, 0x48,
-    0x21, 0xD1, 0xFB, 0x42, 0x80, 0x83, 0xE5, 0x61, 0xFF, 0xFD, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0x86, 0xCE,
-    0x62, 0xD0, 0x2D, 0x7F, 0x9C, 0x68, 0x7F, 0x86, 0xC5, 0x62, 0xB3, 0xBC, 0x7F, 0x8A, 0x08, 0x7F, 0x87, 0x01, 0x21,
-    0xD0, 0xF7, 0x62, 0xB5, 0xBE, 0x7F, 0x86, 0xCB, 0x7F, 0xFF, 0xFD, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x86,
-    0xA7, 0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x86, 0xE3, 0x7F, 0x86, 0xE3, 0x7F, 0x90, 0x23, 0x62, 0x80, 0x83, 0x7F, 0xA2,
-    0x8B, 0x7F, 0x86, 0xD6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF7, 0x7F, 0x86, 0x88, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xE8, 0xDC, 0x7F, 0xA5, 0xCD, 0x7F, 0x86, 0x7B, 0x62, 0x83, 0x87, 0x7F, 0xA2, 0xDF, 0x7F, 0x86,
-    0xCD, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x86, 0x65, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xA2, 0xE7, 0x7F, 0x9F,
-    0xAA, 0x7F, 0x86, 0x5C, 0x62, 0x83, 0x8B, 0x7F, 0x86, 0x7D, 0x7F, 0x86, 0x6A, 0xE2, 0x00, 0xA1, 0xD0, 0xD1, 0x7F,
-    0x86, 0x64, 0x7F, 0xFF, 0xF7, 0x65, 0xB0, 0xB5, 0xBB, 0xBD, 0xBE, 0x7F, 0xF8, 0x80, 0x7F, 0x87, 0x10, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x98, 0xFF, 0x7F, 0x87, 0x10, 0x61, 0x82, 0x7F, 0x98, 0xEA, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6,
-    0x7F, 0xFF, 0xFB, 0x7F, 0x86, 0x21, 0x70, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB3,
-    0xB5, 0xB8, 0xB9, 0xBE, 0x7F, 0xFF, 0x05, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x6D,
-    0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xF3, 0x7F, 0x8A, 0x23, 0x7F,
-    0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0xE1, 0x00, 0x91, 0x2E, 0x7F,
-    0x85, 0xEE, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x86, 0x11, 0x7F, 0xFF, 0xF9, 0x7F, 0x86, 0x11, 0x7F, 0x86, 0x11,
-    0x63, 0x81, 0x83, 0x8B, 0x7F, 0xA4, 0x9E, 0x7F, 0x86, 0x00, 0x7F, 0x86, 0x00, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x85, 0xAE, 0x61, 0x2E, 0x7F, 0x86, 0xBA, 0x62, 0xB0, 0xB5, 0x7F, 0xFF, 0xFB, 0x7F,
-    0x85, 0xFB, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0xF7, 0xA4, 0xC7, 0x64, 0xB0, 0xBA, 0xBB, 0xBE, 0x7F, 0x86, 0x0E,
-    0x7F, 0xFF, 0xF7, 0x7F, 0x86, 0x5F, 0x7F, 0x85, 0xA5, 0xE2, 0x00, 0x91, 0xD0, 0xD1, 0x7F, 0xC7, 0x8A, 0x7F, 0x86,
-    0x61, 0x21, 0x82, 0xF5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xFD, 0x7F, 0x85, 0x6B, 0x64, 0xB0,
-    0xB5, 0xB8, 0xBE, 0x7F, 0x85, 0xA3, 0x7F, 0xA5, 0x22, 0x7F, 0x85, 0xA3, 0x7F, 0xA5, 0x25, 0x65, 0x80, 0x83, 0x8B,
-    0x8E, 0x8F, 0x7F, 0x85, 0x7B, 0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xEB, 0x7F, 0x85, 0x38, 0x61, 0xBF, 0x7F, 0x8A, 0x33, 0x21, 0xD0, 0xFB,
-    0x44, 0xB0, 0xB2, 0xBB, 0xBE, 0xA5, 0x68, 0xA5, 0x6F, 0xA5, 0x7C, 0xFF, 0xFD, 0x61, 0x80, 0x7F, 0x8E, 0x24, 0x63,
-    0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x7F, 0x85, 0x11, 0x71, 0x80, 0x81, 0x82, 0x85, 0x91, 0x83,
-    0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x7F, 0xFF, 0x56, 0x7F, 0xFF, 0x99, 0x7F, 0xFF,
-    0xCC, 0x7F, 0xFF, 0xF3, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13,
-    0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F,
-    0x89, 0x13, 0x7F, 0x89, 0x13, 0x42, 0xD0, 0xD1, 0xFE, 0xAB, 0xFF, 0xBB, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xD8, 0xAB, 0xE0, 0x28, 0xE5, 0xBB, 0xEA, 0x14,
-    0xEB, 0xFB, 0xEE, 0x6E, 0xEF, 0xBF, 0xF1, 0x70, 0xF3, 0x97, 0xF4, 0x5E, 0xF5, 0x2E, 0xF6, 0xF4, 0xF8, 0xC9, 0xFA,
-    0x26, 0xFB, 0xB2, 0xFD, 0x98, 0xFF, 0xF9, 0xA0, 0x0D, 0x01, 0xA0, 0x0D, 0x22, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x31, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
-    0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFF, 0xBC, 0xFF, 0xDD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0x31, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8,
-    0xD8, 0xD8, 0xD8, 0xD8, 0xC3, 0x0C, 0xE2, 0x2D, 0xD0, 0xD1, 0xFF, 0x6B, 0xFF, 0xBC, 0xFF, 0xDD, 0x64, 0x2E, 0xD0,
-    0xD1, 0x2D, 0x7F, 0x83, 0xD1, 0x7F, 0xCF, 0xC7, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0xF4,
+// Aho-Corasick automaton for the hypher patterns: 13084 states, 43 dense.
+constexpr uint8_t ru_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns ru_patterns = {
-    0x822Bu,
-    ru_trie_data,
-    sizeof(ru_trie_data),
+constexpr uint16_t ru_dense[] = {
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 4, 0, 5, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 9, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 3, 4, 0, 1, 2, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 5,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 7, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 3, 4, 0, 1, 2, 59, 60, 61,
+    62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 3, 4, 0, 1, 2, 92, 93, 94, 95, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    109, 110, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 111, 112, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 114, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 115, 116, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 117, 118, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 121, 122, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 124, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    125, 126, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 127, 128, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 129, 130, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 132, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 133, 134, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 136,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 137, 138, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 140, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    141, 142, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 143, 144, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 146, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 147, 148, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 149, 150, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 152,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 153, 154, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 156, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    157, 158, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 159, 160, 0, 1, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 161, 162, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 163, 164, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 165, 166, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 168,
+    0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 169, 170, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 172, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    173, 174,
+};
+
+constexpr uint8_t ru_label[] = {
+    0x00, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x24, 0x25, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25,
+    0x01, 0x01, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x15, 0x17, 0x18, 0x1C, 0x1E,
+    0x1F, 0x03, 0x04, 0x06, 0x1C, 0x22, 0x22, 0x04, 0x22, 0x19, 0x1C, 0x22, 0x23, 0x14, 0x17, 0x1B, 0x1C, 0x1E, 0x22,
+    0x04, 0x19, 0x0F, 0x11, 0x19, 0x1C, 0x22, 0x06, 0x14, 0x19, 0x22, 0x06, 0x15, 0x16, 0x17, 0x1B, 0x04, 0x05, 0x14,
+    0x22, 0x03, 0x14, 0x19, 0x1C, 0x22, 0x13, 0x19, 0x1E, 0x22, 0x05, 0x06, 0x19, 0x1C, 0x15, 0x18, 0x19, 0x1B, 0x1E,
+    0x20, 0x22, 0x23, 0x03, 0x04, 0x05, 0x11, 0x13, 0x22, 0x19, 0x13, 0x04, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x01, 0x24, 0x25, 0x01, 0x02, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x02, 0x01,
+    0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24,
+    0x01, 0x01, 0x24, 0x01, 0x02, 0x24, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24,
+    0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x25,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x25, 0x01, 0x01, 0x01, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x01, 0x02,
+    0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x24, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x25,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01,
+    0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x25,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x24,
+    0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25,
+    0x01, 0x01, 0x24, 0x01, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x02, 0x24,
+    0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01,
+    0x01, 0x02, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x02, 0x01, 0x24, 0x25, 0x01, 0x02, 0x25, 0x01, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01,
+    0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x24, 0x01, 0x25, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+    0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x25,
+    0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25,
+    0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x24, 0x01, 0x02,
+    0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x01, 0x02, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25,
+    0x01, 0x24, 0x01, 0x02, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x01, 0x24,
+    0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x01, 0x01, 0x02, 0x24, 0x01, 0x24, 0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x02,
+    0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x24,
+    0x25, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01,
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01,
+    0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25,
+    0x01, 0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24,
+    0x25, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01,
+    0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x25, 0x01,
+    0x01, 0x24, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x24, 0x25,
+    0x01, 0x25, 0x01, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24,
+    0x01, 0x25, 0x01, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x24, 0x01,
+    0x24, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01,
+    0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x25,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01, 0x25, 0x01, 0x24, 0x01, 0x24, 0x01,
+    0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01,
+    0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x25, 0x01, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01,
+    0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x01, 0x01, 0x24, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01,
+    0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x25, 0x01, 0x01, 0x24, 0x01, 0x24, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01,
+    0x24, 0x25, 0x01, 0x25, 0x01, 0x24, 0x25, 0x01, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24, 0x25, 0x01, 0x24,
+    0x25, 0x01, 0x01, 0x01, 0x24, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x25, 0x25,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x25, 0x25, 0x25, 0x23, 0x03, 0x09, 0x19, 0x1F, 0x03, 0x06, 0x16, 0x19, 0x1B, 0x1C, 0x22, 0x03, 0x04, 0x05,
+    0x06, 0x08, 0x0A, 0x13, 0x14, 0x18, 0x1C, 0x1F, 0x22, 0x06, 0x16, 0x1A, 0x1C, 0x1F, 0x22, 0x03, 0x06, 0x09, 0x0E,
+    0x17, 0x18, 0x1F, 0x23, 0x03, 0x04, 0x14, 0x16, 0x17, 0x18, 0x22, 0x03, 0x17, 0x08, 0x16, 0x1E, 0x1F, 0x22, 0x03,
+    0x04, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x0F, 0x11, 0x13, 0x14, 0x15, 0x19, 0x1C, 0x21, 0x22, 0x0A, 0x13, 0x14,
+    0x18, 0x22, 0x03, 0x04, 0x06, 0x0F, 0x18, 0x1E, 0x03, 0x04, 0x1F, 0x22, 0x03, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A,
+    0x1C, 0x22, 0x05, 0x06, 0x08, 0x0E, 0x11, 0x12, 0x13, 0x1E, 0x20, 0x21, 0x04, 0x05, 0x0B, 0x0F, 0x14, 0x16, 0x19,
+    0x1C, 0x22, 0x03, 0x06, 0x08, 0x0E, 0x0F, 0x11, 0x12, 0x15, 0x18, 0x1F, 0x05, 0x08, 0x0A, 0x10, 0x1F, 0x14, 0x20,
+    0x04, 0x14, 0x1F, 0x05, 0x1F, 0x1F, 0x03, 0x05, 0x15, 0x16, 0x1B, 0x15, 0x17, 0x18, 0x1B, 0x1F, 0x22, 0x04, 0x05,
+    0x0E, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x04, 0x09, 0x0C, 0x14, 0x15, 0x1A, 0x1E, 0x1F, 0x21, 0x22, 0x05, 0x08, 0x14,
+    0x19, 0x06, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x1B, 0x1F, 0x20, 0x21, 0x03, 0x04, 0x05, 0x12,
+    0x14, 0x19, 0x1C, 0x22, 0x04, 0x06, 0x0F, 0x11, 0x12, 0x13, 0x1E, 0x1F, 0x17, 0x1E, 0x04, 0x17, 0x04, 0x04, 0x05,
+    0x03, 0x05, 0x18, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x21, 0x04, 0x05, 0x08, 0x09, 0x12, 0x1C, 0x03, 0x22, 0x16, 0x17,
+    0x18, 0x19, 0x1B, 0x1D, 0x23, 0x03, 0x04, 0x05, 0x09, 0x11, 0x12, 0x13, 0x17, 0x18, 0x22, 0x0D, 0x14, 0x17, 0x1B,
+    0x21, 0x22, 0x04, 0x06, 0x07, 0x1F, 0x06, 0x14, 0x19, 0x1C, 0x11, 0x12, 0x13, 0x19, 0x13, 0x14, 0x19, 0x22, 0x06,
+    0x0E, 0x13, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x1E, 0x20, 0x23, 0x03, 0x04, 0x05, 0x08, 0x11, 0x14, 0x19, 0x1C,
+    0x22, 0x0E, 0x11, 0x12, 0x13, 0x19, 0x1E, 0x23, 0x11, 0x13, 0x22, 0x14, 0x17, 0x1B, 0x1C, 0x1E, 0x23, 0x04, 0x08,
+    0x0A, 0x22, 0x1C, 0x15, 0x17, 0x1B, 0x23, 0x05, 0x08, 0x0B, 0x19, 0x1C, 0x04, 0x05, 0x11, 0x12, 0x13, 0x18, 0x1B,
+    0x03, 0x04, 0x1B, 0x04, 0x06, 0x14, 0x1C, 0x14, 0x1C, 0x15, 0x21, 0x22, 0x15, 0x17, 0x04, 0x14, 0x19, 0x1C, 0x22,
+    0x06, 0x0E, 0x12, 0x13, 0x14, 0x19, 0x1C, 0x22, 0x12, 0x13, 0x15, 0x16, 0x1A, 0x1B, 0x1C, 0x1D, 0x1F, 0x20, 0x04,
+    0x05, 0x06, 0x0A, 0x11, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x11, 0x12, 0x14, 0x15, 0x05, 0x16, 0x04, 0x15, 0x17,
+    0x1B, 0x22, 0x04, 0x05, 0x19, 0x1C, 0x1E, 0x1F, 0x22, 0x12, 0x13, 0x15, 0x16, 0x1B, 0x1C, 0x1E, 0x20, 0x22, 0x23,
+    0x03, 0x04, 0x08, 0x14, 0x20, 0x04, 0x14, 0x22, 0x23, 0x04, 0x06, 0x07, 0x08, 0x19, 0x14, 0x19, 0x22, 0x0E, 0x12,
+    0x15, 0x16, 0x18, 0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x20, 0x23, 0x03, 0x04, 0x05, 0x08, 0x0B, 0x0C, 0x14, 0x19, 0x1C,
+    0x22, 0x06, 0x0E, 0x12, 0x13, 0x1E, 0x15, 0x17, 0x18, 0x22, 0x23, 0x04, 0x05, 0x08, 0x0A, 0x10, 0x19, 0x06, 0x0E,
+    0x19, 0x13, 0x17, 0x18, 0x20, 0x04, 0x05, 0x0C, 0x19, 0x1E, 0x05, 0x11, 0x12, 0x13, 0x18, 0x1B, 0x21, 0x05, 0x14,
+    0x03, 0x19, 0x1C, 0x20, 0x21, 0x22, 0x03, 0x05, 0x06, 0x08, 0x0F, 0x13, 0x14, 0x18, 0x1F, 0x21, 0x03, 0x16, 0x1A,
+    0x1F, 0x21, 0x22, 0x03, 0x06, 0x0E, 0x16, 0x17, 0x04, 0x08, 0x17, 0x18, 0x19, 0x03, 0x13, 0x14, 0x16, 0x18, 0x19,
+    0x1B, 0x1C, 0x22, 0x03, 0x06, 0x12, 0x13, 0x17, 0x18, 0x20, 0x22, 0x04, 0x14, 0x1B, 0x1C, 0x22, 0x03, 0x04, 0x06,
+    0x14, 0x19, 0x06, 0x0E, 0x11, 0x12, 0x13, 0x1C, 0x22, 0x06, 0x0A, 0x0E, 0x0F, 0x14, 0x18, 0x03, 0x04, 0x0B, 0x10,
+    0x15, 0x17, 0x18, 0x1A, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x23, 0x03, 0x04, 0x05, 0x0A, 0x0C, 0x14, 0x19, 0x1C, 0x1F,
+    0x21, 0x22, 0x04, 0x05, 0x13, 0x14, 0x16, 0x19, 0x1C, 0x22, 0x04, 0x06, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x15, 0x17,
+    0x1E, 0x1F, 0x20, 0x22, 0x23, 0x05, 0x0A, 0x14, 0x16, 0x19, 0x1C, 0x22, 0x03, 0x06, 0x0E, 0x0F, 0x11, 0x12, 0x15,
+    0x1B, 0x1E, 0x1C, 0x1F, 0x03, 0x14, 0x16, 0x1F, 0x22, 0x03, 0x06, 0x16, 0x1F, 0x1F, 0x17, 0x1B, 0x15, 0x1B, 0x05,
+    0x14, 0x1C, 0x1F, 0x06, 0x14, 0x19, 0x1C, 0x1F, 0x22, 0x06, 0x0F, 0x12, 0x16, 0x18, 0x1E, 0x22, 0x23, 0x04, 0x14,
+    0x19, 0x13, 0x22, 0x03, 0x14, 0x22, 0x22, 0x15, 0x05, 0x06, 0x22, 0x06, 0x04, 0x05, 0x16, 0x04, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0B, 0x11,
+    0x12, 0x14, 0x19, 0x1C, 0x1E, 0x1F, 0x22, 0x03, 0x06, 0x0F, 0x13, 0x14, 0x1F, 0x21, 0x16, 0x19, 0x22, 0x15, 0x19,
+    0x22, 0x1D, 0x21, 0x22, 0x04, 0x05, 0x06, 0x0A, 0x22, 0x14, 0x22, 0x11, 0x21, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E,
+    0x13, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x05, 0x08,
+    0x0B, 0x10, 0x11, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x11, 0x12, 0x1C, 0x15, 0x16, 0x17, 0x19, 0x1B, 0x1E, 0x20, 0x23,
+    0x03, 0x05, 0x0A, 0x13, 0x19, 0x13, 0x17, 0x1B, 0x20, 0x04, 0x0C, 0x19, 0x1C, 0x11, 0x12, 0x15, 0x16, 0x17, 0x18,
+    0x1B, 0x20, 0x21, 0x22, 0x23, 0x04, 0x05, 0x07, 0x08, 0x09, 0x03, 0x14, 0x19, 0x1B, 0x1C, 0x22, 0x03, 0x04, 0x06,
+    0x08, 0x0E, 0x13, 0x18, 0x19, 0x1F, 0x21, 0x03, 0x16, 0x19, 0x1A, 0x1C, 0x03, 0x0F, 0x16, 0x17, 0x18, 0x1B, 0x21,
+    0x22, 0x23, 0x03, 0x18, 0x16, 0x17, 0x18, 0x21, 0x22, 0x03, 0x04, 0x14, 0x16, 0x1F, 0x22, 0x03, 0x04, 0x06, 0x14,
+    0x1F, 0x22, 0x23, 0x06, 0x0F, 0x14, 0x19, 0x1C, 0x22, 0x23, 0x03, 0x0A, 0x18, 0x1A, 0x22, 0x04, 0x07, 0x0D, 0x15,
+    0x16, 0x17, 0x18, 0x1B, 0x1E, 0x1F, 0x21, 0x23, 0x03, 0x04, 0x05, 0x06, 0x08, 0x0B, 0x14, 0x1F, 0x21, 0x22, 0x14,
+    0x16, 0x1A, 0x1C, 0x22, 0x03, 0x14, 0x15, 0x18, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x04, 0x05, 0x0F, 0x14, 0x16,
+    0x20, 0x03, 0x06, 0x0F, 0x23, 0x1F, 0x03, 0x14, 0x1F, 0x22, 0x03, 0x06, 0x1F, 0x05, 0x1F, 0x21, 0x05, 0x18, 0x16,
+    0x0F, 0x22, 0x04, 0x05, 0x1F, 0x15, 0x1E, 0x20, 0x21, 0x07, 0x0B, 0x20, 0x20, 0x04, 0x15, 0x16, 0x18, 0x19, 0x1B,
+    0x1D, 0x1F, 0x20, 0x21, 0x23, 0x03, 0x04, 0x05, 0x08, 0x0B, 0x11, 0x13, 0x14, 0x1C, 0x22, 0x06, 0x14, 0x14, 0x17,
+    0x18, 0x04, 0x16, 0x22, 0x23, 0x04, 0x05, 0x04, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x1C,
+    0x22, 0x12, 0x15, 0x16, 0x18, 0x1B, 0x1F, 0x20, 0x21, 0x23, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0B, 0x19, 0x1C, 0x22,
+    0x06, 0x12, 0x14, 0x16, 0x17, 0x18, 0x1C, 0x1E, 0x20, 0x22, 0x05, 0x06, 0x14, 0x22, 0x03, 0x16, 0x19, 0x1D, 0x1F,
+    0x20, 0x23, 0x03, 0x04, 0x05, 0x0A, 0x11, 0x13, 0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x20, 0x21, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x12, 0x03, 0x19, 0x1C, 0x22, 0x06, 0x14, 0x1F, 0x22, 0x16, 0x17, 0x18, 0x1B, 0x1E, 0x20, 0x21,
+    0x22, 0x04, 0x05, 0x08, 0x22, 0x14, 0x16, 0x17, 0x19, 0x1E, 0x20, 0x22, 0x23, 0x04, 0x05, 0x06, 0x08, 0x16, 0x1F,
+    0x0F, 0x11, 0x1C, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1E, 0x23, 0x03, 0x04, 0x05, 0x0B, 0x13, 0x15, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1B, 0x1E, 0x21, 0x22, 0x23, 0x04, 0x05, 0x11, 0x13, 0x16, 0x19, 0x1A, 0x1D, 0x20, 0x08, 0x18,
+    0x19, 0x1C, 0x1E, 0x20, 0x21, 0x22, 0x04, 0x05, 0x09, 0x0A, 0x0C, 0x11, 0x12, 0x13, 0x1A, 0x04, 0x05, 0x16, 0x18,
+    0x20, 0x03, 0x08, 0x18, 0x1B, 0x1E, 0x21, 0x04, 0x08, 0x16, 0x17, 0x18, 0x1B, 0x1E, 0x1F, 0x21, 0x04, 0x05, 0x06,
+    0x07, 0x0A, 0x1C, 0x1F, 0x1F, 0x14, 0x18, 0x19, 0x1A, 0x1B, 0x04, 0x05, 0x0A, 0x17, 0x1B, 0x1E, 0x22, 0x04, 0x21,
+    0x19, 0x14, 0x19, 0x22, 0x06, 0x0E, 0x13, 0x15, 0x16, 0x18, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x21, 0x23, 0x03, 0x04,
+    0x05, 0x07, 0x1F, 0x14, 0x1C, 0x22, 0x0E, 0x1E, 0x21, 0x22, 0x05, 0x04, 0x05, 0x1C, 0x14, 0x1C, 0x19, 0x13, 0x20,
+    0x04, 0x04, 0x11, 0x03, 0x03, 0x04, 0x15, 0x16, 0x17, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x23, 0x03, 0x04, 0x05, 0x07,
+    0x08, 0x0A, 0x0B, 0x0C, 0x10, 0x12, 0x16, 0x1C, 0x1F, 0x22, 0x03, 0x14, 0x16, 0x19, 0x1A, 0x1B, 0x1F, 0x03, 0x04,
+    0x09, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x20, 0x22, 0x23, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x0B, 0x12, 0x13, 0x22, 0x15, 0x19, 0x1D, 0x1E, 0x1F, 0x21, 0x04, 0x06, 0x08, 0x09, 0x0C, 0x16, 0x1F, 0x22, 0x03,
+    0x04, 0x22, 0x15, 0x16, 0x18, 0x19, 0x1B, 0x1E, 0x1F, 0x20, 0x03, 0x04, 0x05, 0x07, 0x10, 0x19, 0x1C, 0x22, 0x16,
+    0x17, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x05, 0x06, 0x07, 0x0D, 0x16, 0x1C, 0x20, 0x03, 0x05, 0x08, 0x11, 0x22,
+    0x1F, 0x05, 0x19, 0x1C, 0x1E, 0x22, 0x04, 0x05, 0x0A, 0x11, 0x12, 0x13, 0x03, 0x16, 0x15, 0x16, 0x23, 0x14, 0x1C,
+    0x1F, 0x20, 0x22, 0x03, 0x0D, 0x0F, 0x1F, 0x21, 0x03, 0x04, 0x05, 0x08, 0x19, 0x1F, 0x03, 0x14, 0x16, 0x19, 0x1C,
+    0x1F, 0x22, 0x03, 0x06, 0x0E, 0x0F, 0x15, 0x16, 0x18, 0x1A, 0x22, 0x04, 0x05, 0x09, 0x18, 0x14, 0x16, 0x17, 0x18,
+    0x19, 0x21, 0x22, 0x06, 0x0E, 0x17, 0x19, 0x1B, 0x20, 0x22, 0x04, 0x04, 0x14, 0x16, 0x1F, 0x22, 0x04, 0x05, 0x06,
+    0x14, 0x17, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x15, 0x19, 0x21, 0x03, 0x0A, 0x0B, 0x0F, 0x13,
+    0x14, 0x18, 0x19, 0x1C, 0x22, 0x03, 0x04, 0x05, 0x1F, 0x23, 0x04, 0x05, 0x07, 0x14, 0x1F, 0x22, 0x03, 0x05, 0x14,
+    0x15, 0x16, 0x19, 0x1C, 0x22, 0x05, 0x06, 0x09, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x15, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x16, 0x17, 0x18, 0x19, 0x1C, 0x1E, 0x20, 0x03, 0x04, 0x06, 0x08,
+    0x0F, 0x13, 0x23, 0x04, 0x05, 0x14, 0x19, 0x1C, 0x22, 0x03, 0x13, 0x1C, 0x1F, 0x20, 0x22, 0x03, 0x06, 0x22, 0x14,
+    0x1F, 0x05, 0x16, 0x1F, 0x23, 0x05, 0x05, 0x16, 0x18, 0x1B, 0x03, 0x1A, 0x16, 0x18, 0x19, 0x1B, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x0B, 0x18, 0x1B, 0x1E, 0x1F, 0x23, 0x03, 0x04, 0x05, 0x0B, 0x14, 0x1A, 0x1E, 0x21, 0x04, 0x14, 0x19,
+    0x1C, 0x22, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x22, 0x0E, 0x15, 0x16, 0x18, 0x19, 0x1B, 0x1C, 0x1D, 0x1F, 0x20, 0x23,
+    0x03, 0x04, 0x05, 0x08, 0x0B, 0x10, 0x13, 0x22, 0x19, 0x1C, 0x22, 0x04, 0x06, 0x13, 0x14, 0x1C, 0x22, 0x16, 0x1C,
+    0x06, 0x15, 0x17, 0x04, 0x05, 0x05, 0x03, 0x04, 0x05, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x1B, 0x1E, 0x1F, 0x20,
+    0x21, 0x23, 0x04, 0x05, 0x08, 0x0C, 0x11, 0x12, 0x1F, 0x22, 0x14, 0x19, 0x1C, 0x22, 0x0F, 0x13, 0x16, 0x1F, 0x21,
+    0x03, 0x14, 0x16, 0x1A, 0x1C, 0x1F, 0x22, 0x09, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x20, 0x21, 0x22,
+    0x23, 0x03, 0x04, 0x05, 0x06, 0x0A, 0x0B, 0x14, 0x18, 0x16, 0x22, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1E,
+    0x20, 0x21, 0x22, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x10, 0x16, 0x1F, 0x04, 0x0F, 0x11, 0x12, 0x0A,
+    0x14, 0x19, 0x1C, 0x22, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x0B, 0x12, 0x13, 0x1F, 0x1E, 0x21, 0x23, 0x05, 0x14, 0x16, 0x20, 0x22, 0x03, 0x06, 0x0F,
+    0x12, 0x15, 0x17, 0x18, 0x1A, 0x1E, 0x1F, 0x04, 0x05, 0x08, 0x0A, 0x1F, 0x16, 0x1C, 0x1F, 0x22, 0x03, 0x16, 0x1F,
+    0x20, 0x20, 0x05, 0x15, 0x18, 0x1B, 0x1E, 0x20, 0x04, 0x08, 0x19, 0x1C, 0x1E, 0x04, 0x05, 0x11, 0x12, 0x13, 0x1F,
+    0x04, 0x16, 0x11, 0x1B, 0x1E, 0x20, 0x21, 0x04, 0x15, 0x18, 0x1E, 0x1F, 0x23, 0x03, 0x05, 0x06, 0x07, 0x08, 0x19,
+    0x03, 0x06, 0x0E, 0x11, 0x19, 0x1C, 0x21, 0x22, 0x14, 0x19, 0x1C, 0x22, 0x13, 0x17, 0x1B, 0x1E, 0x20, 0x03, 0x04,
+    0x1B, 0x22, 0x23, 0x08, 0x14, 0x16, 0x1C, 0x1F, 0x21, 0x22, 0x03, 0x04, 0x06, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E,
+    0x0F, 0x11, 0x12, 0x13, 0x19, 0x06, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x15, 0x16, 0x18, 0x1B, 0x1F, 0x20, 0x03,
+    0x04, 0x05, 0x0A, 0x0B, 0x14, 0x19, 0x1C, 0x21, 0x22, 0x0F, 0x14, 0x19, 0x14, 0x15, 0x16, 0x1C, 0x1E, 0x1F, 0x21,
+    0x22, 0x23, 0x05, 0x0A, 0x14, 0x15, 0x16, 0x19, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x03, 0x04, 0x06, 0x07,
+    0x09, 0x0A, 0x0E, 0x0F, 0x12, 0x13, 0x15, 0x16, 0x17, 0x19, 0x1B, 0x1E, 0x20, 0x23, 0x04, 0x05, 0x07, 0x08, 0x19,
+    0x19, 0x14, 0x19, 0x1C, 0x22, 0x14, 0x19, 0x1C, 0x1F, 0x22, 0x13, 0x21, 0x19, 0x17, 0x1B, 0x20, 0x23, 0x04, 0x19,
+    0x1E, 0x04, 0x05, 0x11, 0x12, 0x13, 0x03, 0x04, 0x04, 0x1B, 0x05, 0x1E, 0x04, 0x15, 0x16, 0x17, 0x1B, 0x1E, 0x21,
+    0x23, 0x04, 0x05, 0x0C, 0x14, 0x19, 0x1C, 0x22, 0x03, 0x06, 0x0E, 0x12, 0x13, 0x17, 0x18, 0x1B, 0x1E, 0x1F, 0x20,
+    0x22, 0x23, 0x03, 0x04, 0x08, 0x14, 0x15, 0x18, 0x1B, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x04, 0x07, 0x08, 0x14, 0x19,
+    0x21, 0x13, 0x22, 0x0F, 0x1C, 0x0C, 0x15, 0x16, 0x18, 0x1B, 0x1E, 0x20, 0x21, 0x03, 0x04, 0x05, 0x0C, 0x14, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1C, 0x20, 0x21, 0x22, 0x23, 0x03, 0x06, 0x07, 0x0C, 0x0D, 0x0E, 0x12, 0x13, 0x15,
+    0x18, 0x19, 0x20, 0x23, 0x20, 0x17, 0x1A, 0x23, 0x04, 0x07, 0x0B, 0x0C, 0x17, 0x04, 0x19, 0x1C, 0x20, 0x05, 0x11,
+    0x13, 0x05, 0x17, 0x1A, 0x23, 0x0A, 0x17, 0x1B, 0x1E, 0x23, 0x03, 0x04, 0x08, 0x1F, 0x04, 0x19, 0x22, 0x03, 0x0E,
+    0x19, 0x1C, 0x1F, 0x22, 0x06, 0x16, 0x1F, 0x21, 0x03, 0x14, 0x16, 0x03, 0x06, 0x18, 0x1F, 0x04, 0x08, 0x1A, 0x16,
+    0x22, 0x14, 0x16, 0x1C, 0x22, 0x06, 0x14, 0x19, 0x06, 0x0E, 0x11, 0x13, 0x0A, 0x14, 0x18, 0x0F, 0x15, 0x16, 0x1B,
+    0x1E, 0x23, 0x04, 0x05, 0x07, 0x1F, 0x03, 0x14, 0x19, 0x1C, 0x1E, 0x22, 0x05, 0x06, 0x0E, 0x11, 0x12, 0x13, 0x14,
+    0x17, 0x1E, 0x1F, 0x20, 0x21, 0x23, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0F, 0x14, 0x19, 0x1C, 0x1F, 0x22, 0x03, 0x06,
+    0x0E, 0x0F, 0x11, 0x12, 0x13, 0x17, 0x04, 0x1C, 0x1F, 0x03, 0x14, 0x16, 0x1F, 0x03, 0x19, 0x03, 0x0F, 0x13, 0x19,
+    0x1C, 0x1F, 0x23, 0x13, 0x1B, 0x15, 0x17, 0x1B, 0x21, 0x05, 0x08, 0x0B, 0x10, 0x16, 0x18, 0x22, 0x04, 0x14, 0x17,
+    0x1A, 0x1B, 0x21, 0x22, 0x05, 0x14, 0x1C, 0x22, 0x15, 0x21, 0x03, 0x04, 0x05, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x20,
+    0x22, 0x23, 0x05, 0x07, 0x15, 0x18, 0x1E, 0x21, 0x22, 0x03, 0x19, 0x1C, 0x0E, 0x13, 0x22, 0x14, 0x19, 0x1B, 0x04,
+    0x14, 0x19, 0x22, 0x06, 0x13, 0x06, 0x0E, 0x1E, 0x23, 0x03, 0x04, 0x07, 0x08, 0x12, 0x14, 0x19, 0x1C, 0x22, 0x0E,
+    0x12, 0x17, 0x19, 0x1D, 0x21, 0x03, 0x04, 0x0B, 0x11, 0x12, 0x11, 0x20, 0x23, 0x08, 0x19, 0x0E, 0x13, 0x1B, 0x1E,
+    0x22, 0x23, 0x04, 0x05, 0x1E, 0x22, 0x23, 0x04, 0x06, 0x07, 0x15, 0x18, 0x05, 0x23, 0x18, 0x19, 0x04, 0x05, 0x16,
+    0x17, 0x22, 0x03, 0x04, 0x22, 0x1E, 0x09, 0x14, 0x19, 0x1C, 0x22, 0x14, 0x19, 0x22, 0x14, 0x19, 0x20, 0x13, 0x1E,
+    0x19, 0x1C, 0x04, 0x05, 0x11, 0x12, 0x13, 0x03, 0x15, 0x17, 0x18, 0x21, 0x03, 0x04, 0x05, 0x19, 0x17, 0x1E, 0x22,
+    0x23, 0x04, 0x15, 0x23, 0x07, 0x22, 0x19, 0x1C, 0x22, 0x0E, 0x11, 0x12, 0x13, 0x0E, 0x1C, 0x06, 0x03, 0x1C, 0x04,
+    0x19, 0x04, 0x19, 0x1C, 0x11, 0x12, 0x13, 0x15, 0x17, 0x18, 0x1C, 0x04, 0x08, 0x0B, 0x23, 0x17, 0x18, 0x1F, 0x03,
+    0x04, 0x08, 0x21, 0x03, 0x1F, 0x14, 0x1C, 0x1F, 0x21, 0x1F, 0x03, 0x18, 0x16, 0x18, 0x1F, 0x21, 0x17, 0x16, 0x1F,
+    0x22, 0x04, 0x0F, 0x0A, 0x22, 0x22, 0x14, 0x16, 0x19, 0x0F, 0x13, 0x14, 0x19, 0x1E, 0x21, 0x22, 0x23, 0x08, 0x0A,
+    0x0B, 0x13, 0x16, 0x03, 0x0F, 0x1F, 0x0F, 0x16, 0x14, 0x12, 0x09, 0x1B, 0x1E, 0x04, 0x21, 0x1F, 0x1C, 0x22, 0x19,
+    0x1F, 0x05, 0x1E, 0x21, 0x05, 0x14, 0x1C, 0x20, 0x22, 0x03, 0x22, 0x14, 0x19, 0x06, 0x13, 0x16, 0x17, 0x1B, 0x03,
+    0x03, 0x1F, 0x04, 0x19, 0x14, 0x0F, 0x1B, 0x1C, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x1E, 0x20, 0x22, 0x05, 0x19, 0x1C,
+    0x03, 0x22, 0x16, 0x1F, 0x03, 0x0F, 0x17, 0x1C, 0x22, 0x18, 0x16, 0x14, 0x19, 0x1C, 0x11, 0x0A, 0x0F, 0x14, 0x19,
+    0x1C, 0x22, 0x06, 0x0E, 0x1E, 0x05, 0x1C, 0x22, 0x06, 0x0E, 0x14, 0x0F, 0x03, 0x1C, 0x22, 0x06, 0x08, 0x1F, 0x21,
+    0x16, 0x03, 0x17, 0x22, 0x16, 0x1F, 0x04, 0x0F, 0x15, 0x0F, 0x14, 0x04, 0x14, 0x1C, 0x22, 0x0F, 0x1E, 0x1F, 0x05,
+    0x14, 0x16, 0x1C, 0x22, 0x06, 0x0E, 0x0F, 0x12, 0x1F, 0x06, 0x19, 0x1F, 0x03, 0x19, 0x22, 0x03, 0x06, 0x03, 0x06,
+    0x19, 0x19, 0x22, 0x14, 0x1C, 0x22, 0x03, 0x06, 0x14, 0x19, 0x06, 0x0E, 0x06, 0x0A, 0x14, 0x18, 0x04, 0x14, 0x19,
+    0x1F, 0x21, 0x22, 0x05, 0x14, 0x19, 0x1C, 0x22, 0x04, 0x06, 0x0E, 0x14, 0x1E, 0x1F, 0x22, 0x05, 0x14, 0x19, 0x1C,
+    0x22, 0x03, 0x06, 0x0E, 0x11, 0x12, 0x14, 0x16, 0x1F, 0x22, 0x03, 0x03, 0x03, 0x1C, 0x03, 0x0F, 0x05, 0x05, 0x22,
+    0x18, 0x15, 0x1A, 0x05, 0x07, 0x1E, 0x14, 0x22, 0x15, 0x23, 0x05, 0x1C, 0x16, 0x20, 0x23, 0x03, 0x17, 0x21, 0x03,
+    0x21, 0x22, 0x23, 0x04, 0x04, 0x1A, 0x22, 0x1E, 0x0B, 0x16, 0x05, 0x0B, 0x16, 0x18, 0x1B, 0x04, 0x05, 0x04, 0x1E,
+    0x1F, 0x22, 0x03, 0x22, 0x21, 0x1E, 0x23, 0x16, 0x03, 0x06, 0x21, 0x16, 0x1A, 0x1B, 0x20, 0x22, 0x04, 0x14, 0x15,
+    0x1B, 0x04, 0x0A, 0x1B, 0x04, 0x08, 0x15, 0x23, 0x23, 0x1A, 0x22, 0x14, 0x17, 0x22, 0x21, 0x0A, 0x16, 0x03, 0x03,
+    0x04, 0x04, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x02, 0x24, 0x24, 0x25, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x02, 0x24,
+    0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x02, 0x24, 0x25, 0x02,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x02, 0x24, 0x25, 0x25, 0x02, 0x24, 0x25, 0x02, 0x24, 0x25,
+    0x25, 0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x02, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x02,
+    0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x02, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x02, 0x02, 0x25,
+    0x24, 0x02, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x25, 0x25, 0x24, 0x24, 0x02, 0x25, 0x02, 0x24, 0x02, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x02, 0x02, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x02, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x02, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25,
+    0x02, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x02, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x02, 0x25, 0x24, 0x25,
+    0x24, 0x02, 0x24, 0x24, 0x25, 0x02, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x02, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x02, 0x25, 0x02, 0x24, 0x25, 0x25,
+    0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x02, 0x02,
+    0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x02, 0x24, 0x25, 0x02, 0x24, 0x25, 0x25, 0x24, 0x24, 0x02,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x02, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25,
+    0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x02, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x02, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x02, 0x24, 0x25, 0x02, 0x24, 0x24, 0x25, 0x24, 0x02, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24,
+    0x25, 0x25, 0x24, 0x25, 0x02, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x04, 0x14, 0x11, 0x1C, 0x22,
+    0x14, 0x04, 0x05, 0x14, 0x19, 0x19, 0x04, 0x05, 0x19, 0x1C, 0x22, 0x19, 0x13, 0x1C, 0x22, 0x15, 0x22, 0x06, 0x0A,
+    0x21, 0x22, 0x1C, 0x19, 0x0B, 0x19, 0x1F, 0x13, 0x03, 0x15, 0x16, 0x1F, 0x03, 0x04, 0x1F, 0x19, 0x15, 0x21, 0x05,
+    0x1C, 0x17, 0x1E, 0x1B, 0x0B, 0x0C, 0x1E, 0x05, 0x21, 0x19, 0x13, 0x1B, 0x1C, 0x05, 0x18, 0x20, 0x07, 0x03, 0x15,
+    0x08, 0x23, 0x06, 0x1B, 0x0B, 0x05, 0x14, 0x22, 0x16, 0x0A, 0x14, 0x19, 0x04, 0x22, 0x14, 0x06, 0x18, 0x22, 0x14,
+    0x22, 0x03, 0x1C, 0x22, 0x1C, 0x16, 0x19, 0x1C, 0x22, 0x06, 0x0F, 0x13, 0x19, 0x1C, 0x1E, 0x14, 0x1C, 0x06, 0x1B,
+    0x15, 0x20, 0x0B, 0x14, 0x1C, 0x22, 0x19, 0x11, 0x12, 0x13, 0x22, 0x19, 0x03, 0x0F, 0x1C, 0x1C, 0x14, 0x16, 0x03,
+    0x03, 0x06, 0x11, 0x20, 0x05, 0x03, 0x1F, 0x21, 0x03, 0x14, 0x18, 0x1C, 0x21, 0x22, 0x03, 0x06, 0x1E, 0x23, 0x05,
+    0x1C, 0x22, 0x15, 0x18, 0x21, 0x03, 0x16, 0x17, 0x1B, 0x21, 0x19, 0x21, 0x04, 0x12, 0x18, 0x1A, 0x18, 0x19, 0x1F,
+    0x04, 0x13, 0x21, 0x04, 0x03, 0x0B, 0x18, 0x03, 0x1A, 0x0F, 0x1F, 0x0A, 0x0B, 0x06, 0x06, 0x14, 0x1E, 0x05, 0x16,
+    0x03, 0x03, 0x15, 0x16, 0x1B, 0x1F, 0x20, 0x21, 0x04, 0x05, 0x08, 0x0A, 0x12, 0x18, 0x1D, 0x1E, 0x20, 0x08, 0x18,
+    0x05, 0x18, 0x1F, 0x20, 0x04, 0x1E, 0x1E, 0x20, 0x08, 0x03, 0x1F, 0x1E, 0x05, 0x14, 0x03, 0x03, 0x03, 0x0F, 0x18,
+    0x04, 0x05, 0x03, 0x08, 0x03, 0x06, 0x19, 0x1F, 0x06, 0x13, 0x18, 0x1E, 0x05, 0x03, 0x15, 0x19, 0x1B, 0x1E, 0x03,
+    0x04, 0x05, 0x07, 0x16, 0x1F, 0x17, 0x05, 0x0A, 0x21, 0x04, 0x15, 0x16, 0x1E, 0x05, 0x0A, 0x12, 0x15, 0x1E, 0x05,
+    0x04, 0x1E, 0x0A, 0x04, 0x1F, 0x1E, 0x16, 0x03, 0x03, 0x1A, 0x04, 0x06, 0x09, 0x0F, 0x1E, 0x20, 0x21, 0x23, 0x05,
+    0x03, 0x1F, 0x05, 0x16, 0x20, 0x04, 0x08, 0x09, 0x21, 0x18, 0x1B, 0x1C, 0x1E, 0x1F, 0x04, 0x05, 0x05, 0x21, 0x14,
+    0x1C, 0x06, 0x15, 0x0B, 0x14, 0x16, 0x1F, 0x16, 0x03, 0x21, 0x1F, 0x21, 0x03, 0x18, 0x05, 0x21, 0x22, 0x15, 0x18,
+    0x03, 0x1F, 0x03, 0x03, 0x1F, 0x05, 0x16, 0x1D, 0x20, 0x04, 0x12, 0x05, 0x21, 0x07, 0x15, 0x16, 0x17, 0x19, 0x1D,
+    0x11, 0x11, 0x1A, 0x1E, 0x05, 0x16, 0x21, 0x16, 0x21, 0x23, 0x04, 0x03, 0x05, 0x19, 0x1C, 0x04, 0x13, 0x16, 0x21,
+    0x1F, 0x18, 0x1F, 0x21, 0x17, 0x1C, 0x14, 0x18, 0x1E, 0x21, 0x23, 0x18, 0x05, 0x1F, 0x19, 0x1D, 0x03, 0x17, 0x1E,
+    0x09, 0x16, 0x1E, 0x1F, 0x21, 0x04, 0x0A, 0x16, 0x1B, 0x1E, 0x21, 0x23, 0x05, 0x07, 0x23, 0x16, 0x19, 0x1F, 0x05,
+    0x03, 0x1E, 0x19, 0x03, 0x05, 0x03, 0x18, 0x1B, 0x21, 0x04, 0x05, 0x18, 0x1B, 0x03, 0x1F, 0x03, 0x03, 0x14, 0x1C,
+    0x22, 0x06, 0x22, 0x1F, 0x19, 0x18, 0x23, 0x1F, 0x14, 0x16, 0x1E, 0x03, 0x1F, 0x20, 0x18, 0x1B, 0x1F, 0x03, 0x04,
+    0x15, 0x18, 0x03, 0x04, 0x05, 0x1C, 0x05, 0x1F, 0x05, 0x03, 0x05, 0x16, 0x14, 0x16, 0x18, 0x04, 0x0B, 0x19, 0x1F,
+    0x03, 0x1F, 0x20, 0x21, 0x18, 0x21, 0x03, 0x05, 0x1C, 0x03, 0x1F, 0x03, 0x06, 0x19, 0x1C, 0x21, 0x23, 0x18, 0x1F,
+    0x03, 0x0D, 0x0F, 0x1F, 0x16, 0x1E, 0x1F, 0x06, 0x15, 0x16, 0x1B, 0x21, 0x03, 0x04, 0x08, 0x0A, 0x11, 0x15, 0x1A,
+    0x1B, 0x1F, 0x20, 0x21, 0x04, 0x1D, 0x21, 0x23, 0x08, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x1F, 0x21, 0x04, 0x05,
+    0x11, 0x15, 0x17, 0x1A, 0x20, 0x11, 0x16, 0x17, 0x15, 0x17, 0x08, 0x15, 0x1A, 0x20, 0x21, 0x21, 0x03, 0x14, 0x1F,
+    0x1E, 0x1F, 0x05, 0x03, 0x1C, 0x05, 0x20, 0x20, 0x03, 0x19, 0x03, 0x1C, 0x22, 0x18, 0x03, 0x04, 0x14, 0x19, 0x1C,
+    0x22, 0x0E, 0x11, 0x13, 0x03, 0x19, 0x1C, 0x12, 0x1F, 0x14, 0x19, 0x1C, 0x13, 0x22, 0x03, 0x04, 0x14, 0x19, 0x1C,
+    0x22, 0x13, 0x14, 0x22, 0x22, 0x19, 0x1C, 0x22, 0x23, 0x05, 0x08, 0x0C, 0x06, 0x15, 0x16, 0x17, 0x04, 0x0B, 0x21,
+    0x1C, 0x03, 0x1C, 0x05, 0x19, 0x1C, 0x16, 0x06, 0x14, 0x03, 0x06, 0x05, 0x15, 0x17, 0x20, 0x23, 0x03, 0x05, 0x0B,
+    0x12, 0x18, 0x1E, 0x23, 0x04, 0x08, 0x0A, 0x1F, 0x05, 0x15, 0x22, 0x1E, 0x05, 0x04, 0x18, 0x1E, 0x04, 0x1A, 0x04,
+    0x18, 0x03, 0x03, 0x1F, 0x03, 0x14, 0x19, 0x22, 0x1F, 0x14, 0x1C, 0x1E, 0x0E, 0x0F, 0x14, 0x1C, 0x22, 0x04, 0x19,
+    0x1F, 0x22, 0x03, 0x06, 0x22, 0x16, 0x1E, 0x20, 0x21, 0x05, 0x08, 0x1F, 0x03, 0x05, 0x04, 0x14, 0x19, 0x22, 0x06,
+    0x0E, 0x11, 0x1E, 0x19, 0x13, 0x18, 0x1E, 0x20, 0x23, 0x04, 0x08, 0x22, 0x15, 0x16, 0x1E, 0x1F, 0x07, 0x1E, 0x23,
+    0x18, 0x1E, 0x14, 0x14, 0x19, 0x22, 0x06, 0x14, 0x1C, 0x22, 0x06, 0x0E, 0x19, 0x22, 0x06, 0x14, 0x1F, 0x06, 0x19,
+    0x13, 0x19, 0x1C, 0x22, 0x13, 0x0A, 0x04, 0x12, 0x19, 0x11, 0x12, 0x13, 0x03, 0x1F, 0x15, 0x19, 0x05, 0x14, 0x22,
+    0x15, 0x23, 0x19, 0x06, 0x0A, 0x1F, 0x03, 0x16, 0x1E, 0x0A, 0x1F, 0x20, 0x23, 0x1E, 0x0A, 0x16, 0x1F, 0x1E, 0x16,
+    0x03, 0x04, 0x03, 0x06, 0x03, 0x18, 0x08, 0x18, 0x1F, 0x05, 0x21, 0x14, 0x04, 0x1B, 0x16, 0x18, 0x1A, 0x05, 0x1E,
+    0x14, 0x05, 0x1F, 0x16, 0x1F, 0x21, 0x12, 0x1B, 0x14, 0x1F, 0x21, 0x11, 0x1B, 0x1C, 0x14, 0x06, 0x0B, 0x1A, 0x16,
+    0x18, 0x05, 0x1B, 0x21, 0x23, 0x03, 0x20, 0x23, 0x0C, 0x15, 0x23, 0x03, 0x0C, 0x16, 0x19, 0x1D, 0x1E, 0x21, 0x05,
+    0x11, 0x12, 0x13, 0x19, 0x1C, 0x20, 0x1F, 0x03, 0x04, 0x17, 0x1A, 0x21, 0x03, 0x23, 0x04, 0x14, 0x1F, 0x03, 0x17,
+    0x19, 0x13, 0x21, 0x23, 0x16, 0x19, 0x1E, 0x22, 0x03, 0x13, 0x1C, 0x1E, 0x04, 0x0A, 0x21, 0x04, 0x0B, 0x04, 0x05,
+    0x19, 0x03, 0x19, 0x19, 0x22, 0x0F, 0x03, 0x15, 0x19, 0x14, 0x20, 0x20, 0x19, 0x0A, 0x13, 0x03, 0x19, 0x1C, 0x22,
+    0x06, 0x14, 0x18, 0x1E, 0x05, 0x03, 0x06, 0x19, 0x1A, 0x22, 0x19, 0x1C, 0x1C, 0x19, 0x22, 0x06, 0x0E, 0x12, 0x13,
+    0x1D, 0x22, 0x22, 0x19, 0x06, 0x1C, 0x1C, 0x21, 0x14, 0x22, 0x04, 0x14, 0x1C, 0x12, 0x22, 0x1E, 0x05, 0x20, 0x09,
+    0x22, 0x04, 0x23, 0x05, 0x21, 0x1C, 0x1F, 0x14, 0x1E, 0x23, 0x04, 0x23, 0x05, 0x06, 0x22, 0x03, 0x19, 0x22, 0x04,
+    0x19, 0x22, 0x05, 0x14, 0x06, 0x14, 0x1E, 0x23, 0x14, 0x16, 0x1E, 0x04, 0x17, 0x22, 0x05, 0x12, 0x1E, 0x04, 0x06,
+    0x04, 0x06, 0x1B, 0x21, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x14, 0x0E, 0x19, 0x06, 0x22, 0x04, 0x03, 0x16, 0x1F, 0x12,
+    0x1C, 0x16, 0x14, 0x19, 0x1C, 0x06, 0x19, 0x22, 0x0A, 0x11, 0x12, 0x11, 0x18, 0x04, 0x22, 0x1E, 0x19, 0x1C, 0x13,
+    0x1C, 0x0E, 0x14, 0x03, 0x14, 0x19, 0x22, 0x06, 0x1F, 0x03, 0x21, 0x03, 0x21, 0x22, 0x22, 0x04, 0x1F, 0x03, 0x05,
+    0x05, 0x03, 0x05, 0x1E, 0x04, 0x0B, 0x1B, 0x1F, 0x03, 0x1E, 0x05, 0x04, 0x1F, 0x21, 0x04, 0x20, 0x21, 0x22, 0x16,
+    0x1E, 0x21, 0x04, 0x12, 0x1B, 0x20, 0x04, 0x05, 0x1E, 0x20, 0x08, 0x21, 0x1A, 0x23, 0x1A, 0x03, 0x14, 0x03, 0x0F,
+    0x1C, 0x04, 0x03, 0x16, 0x06, 0x1E, 0x20, 0x23, 0x21, 0x03, 0x22, 0x1F, 0x22, 0x04, 0x0A, 0x15, 0x18, 0x1B, 0x22,
+    0x05, 0x08, 0x14, 0x15, 0x19, 0x1E, 0x22, 0x03, 0x04, 0x07, 0x08, 0x10, 0x13, 0x04, 0x18, 0x21, 0x15, 0x1C, 0x1F,
+    0x22, 0x14, 0x19, 0x22, 0x03, 0x06, 0x1E, 0x04, 0x19, 0x12, 0x1F, 0x03, 0x22, 0x1E, 0x05, 0x0F, 0x19, 0x05, 0x0C,
+    0x19, 0x1F, 0x03, 0x22, 0x03, 0x14, 0x18, 0x22, 0x03, 0x1C, 0x18, 0x05, 0x03, 0x04, 0x03, 0x1F, 0x1F, 0x03, 0x1F,
+    0x1A, 0x22, 0x22, 0x03, 0x1F, 0x21, 0x21, 0x04, 0x15, 0x1E, 0x1F, 0x23, 0x16, 0x03, 0x03, 0x20, 0x22, 0x0E, 0x1F,
+    0x03, 0x03, 0x16, 0x23, 0x04, 0x1F, 0x20, 0x23, 0x16, 0x20, 0x16, 0x1F, 0x03, 0x19, 0x1F, 0x03, 0x1C, 0x1F, 0x22,
+    0x18, 0x22, 0x03, 0x21, 0x16, 0x14, 0x1F, 0x14, 0x16, 0x17, 0x06, 0x1E, 0x23, 0x18, 0x03, 0x1F, 0x21, 0x03, 0x03,
+    0x21, 0x03, 0x18, 0x1F, 0x21, 0x0F, 0x1E, 0x05, 0x14, 0x19, 0x06, 0x13, 0x0F, 0x14, 0x1C, 0x22, 0x0E, 0x19, 0x06,
+    0x22, 0x22, 0x1F, 0x1E, 0x1B, 0x21, 0x03, 0x0F, 0x22, 0x03, 0x1F, 0x18, 0x1F, 0x05, 0x22, 0x03, 0x05, 0x12, 0x21,
+    0x1C, 0x22, 0x17, 0x1F, 0x14, 0x22, 0x1E, 0x05, 0x1C, 0x05, 0x03, 0x16, 0x18, 0x21, 0x03, 0x1B, 0x23, 0x03, 0x1F,
+    0x04, 0x19, 0x1F, 0x18, 0x0B, 0x19, 0x1A, 0x1D, 0x20, 0x03, 0x11, 0x05, 0x0B, 0x1F, 0x03, 0x1A, 0x16, 0x03, 0x04,
+    0x16, 0x06, 0x1E, 0x20, 0x21, 0x23, 0x1C, 0x03, 0x15, 0x03, 0x1C, 0x1E, 0x1F, 0x05, 0x03, 0x0F, 0x16, 0x1F, 0x05,
+    0x0B, 0x03, 0x05, 0x1C, 0x03, 0x03, 0x21, 0x18, 0x1F, 0x21, 0x04, 0x1E, 0x21, 0x1F, 0x16, 0x16, 0x03, 0x03, 0x1F,
+    0x03, 0x22, 0x04, 0x1E, 0x1B, 0x04, 0x14, 0x19, 0x1C, 0x12, 0x13, 0x23, 0x18, 0x21, 0x1F, 0x22, 0x03, 0x06, 0x18,
+    0x18, 0x16, 0x1F, 0x21, 0x22, 0x03, 0x16, 0x1F, 0x21, 0x18, 0x1F, 0x03, 0x1A, 0x22, 0x1E, 0x21, 0x23, 0x05, 0x08,
+    0x0A, 0x16, 0x1F, 0x03, 0x03, 0x03, 0x1E, 0x04, 0x21, 0x1F, 0x14, 0x04, 0x1E, 0x1F, 0x23, 0x05, 0x0F, 0x15, 0x23,
+    0x22, 0x23, 0x03, 0x1F, 0x16, 0x03, 0x03, 0x16, 0x18, 0x22, 0x03, 0x21, 0x14, 0x19, 0x0B, 0x13, 0x16, 0x06, 0x1E,
+    0x1F, 0x23, 0x0A, 0x18, 0x19, 0x22, 0x14, 0x1E, 0x19, 0x03, 0x03, 0x22, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x0E, 0x12,
+    0x03, 0x1C, 0x22, 0x19, 0x11, 0x1F, 0x20, 0x04, 0x05, 0x14, 0x14, 0x22, 0x22, 0x06, 0x1C, 0x19, 0x1E, 0x14, 0x1C,
+    0x22, 0x12, 0x21, 0x22, 0x12, 0x14, 0x20, 0x1C, 0x15, 0x23, 0x04, 0x05, 0x14, 0x19, 0x22, 0x13, 0x0A, 0x20, 0x21,
+    0x15, 0x1F, 0x19, 0x1C, 0x05, 0x22, 0x19, 0x1C, 0x06, 0x15, 0x16, 0x14, 0x19, 0x1C, 0x12, 0x1F, 0x22, 0x03, 0x22,
+    0x22, 0x15, 0x21, 0x23, 0x03, 0x17, 0x20, 0x04, 0x21, 0x22, 0x05, 0x1E, 0x21, 0x11, 0x15, 0x1F, 0x23, 0x1E, 0x1C,
+    0x20, 0x14, 0x20, 0x18, 0x1F, 0x19, 0x22, 0x13, 0x1C, 0x19, 0x19, 0x12, 0x07, 0x1F, 0x15, 0x03, 0x04, 0x20, 0x05,
+    0x1C, 0x1E, 0x03, 0x19, 0x1C, 0x22, 0x11, 0x12, 0x13, 0x16, 0x1B, 0x0B, 0x1C, 0x19, 0x22, 0x04, 0x1F, 0x17, 0x04,
+    0x04, 0x04, 0x03, 0x19, 0x1E, 0x04, 0x18, 0x1A, 0x14, 0x14, 0x16, 0x19, 0x1C, 0x22, 0x06, 0x13, 0x19, 0x22, 0x0E,
+    0x1C, 0x22, 0x1C, 0x12, 0x20, 0x14, 0x06, 0x12, 0x16, 0x20, 0x14, 0x03, 0x0A, 0x19, 0x1C, 0x14, 0x19, 0x1C, 0x1F,
+    0x13, 0x1E, 0x03, 0x08, 0x18, 0x14, 0x14, 0x19, 0x1C, 0x22, 0x06, 0x13, 0x20, 0x14, 0x0A, 0x11, 0x12, 0x1E, 0x03,
+    0x1E, 0x14, 0x22, 0x0B, 0x05, 0x21, 0x03, 0x05, 0x1C, 0x0E, 0x12, 0x19, 0x03, 0x04, 0x19, 0x1C, 0x22, 0x14, 0x14,
+    0x14, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x0F, 0x03, 0x21, 0x22, 0x1F, 0x05, 0x03, 0x21, 0x06, 0x05, 0x16, 0x1C, 0x14,
+    0x22, 0x1F, 0x0F, 0x1F, 0x19, 0x1C, 0x1E, 0x21, 0x05, 0x09, 0x0A, 0x03, 0x05, 0x04, 0x20, 0x03, 0x1E, 0x12, 0x04,
+    0x20, 0x21, 0x22, 0x04, 0x11, 0x16, 0x1E, 0x16, 0x17, 0x1D, 0x20, 0x21, 0x08, 0x05, 0x04, 0x0B, 0x21, 0x04, 0x11,
+    0x1F, 0x04, 0x16, 0x22, 0x06, 0x1A, 0x1F, 0x08, 0x16, 0x18, 0x1F, 0x21, 0x0C, 0x1E, 0x21, 0x17, 0x1A, 0x06, 0x1F,
+    0x04, 0x05, 0x16, 0x03, 0x1F, 0x20, 0x1A, 0x18, 0x16, 0x1B, 0x1D, 0x1F, 0x20, 0x22, 0x05, 0x16, 0x17, 0x18, 0x1E,
+    0x1F, 0x23, 0x09, 0x0A, 0x15, 0x18, 0x1A, 0x1B, 0x1C, 0x23, 0x07, 0x05, 0x1F, 0x21, 0x08, 0x18, 0x08, 0x21, 0x1E,
+    0x05, 0x0F, 0x14, 0x05, 0x03, 0x1F, 0x22, 0x03, 0x21, 0x16, 0x1F, 0x1A, 0x22, 0x09, 0x06, 0x1C, 0x06, 0x16, 0x1C,
+    0x1F, 0x17, 0x1E, 0x21, 0x22, 0x04, 0x1F, 0x1E, 0x1F, 0x23, 0x05, 0x14, 0x16, 0x03, 0x1C, 0x1C, 0x05, 0x14, 0x19,
+    0x22, 0x11, 0x13, 0x04, 0x16, 0x1E, 0x03, 0x05, 0x1A, 0x22, 0x05, 0x21, 0x05, 0x1B, 0x05, 0x04, 0x14, 0x04, 0x03,
+    0x1F, 0x21, 0x22, 0x16, 0x18, 0x1F, 0x18, 0x1E, 0x1F, 0x21, 0x22, 0x03, 0x06, 0x0B, 0x1F, 0x0B, 0x21, 0x22, 0x1E,
+    0x0F, 0x21, 0x23, 0x03, 0x07, 0x08, 0x09, 0x0F, 0x1E, 0x1F, 0x23, 0x04, 0x05, 0x0A, 0x16, 0x03, 0x0A, 0x05, 0x1F,
+    0x20, 0x21, 0x03, 0x21, 0x1C, 0x1F, 0x21, 0x1A, 0x03, 0x1F, 0x03, 0x16, 0x03, 0x21, 0x0A, 0x04, 0x1B, 0x04, 0x05,
+    0x15, 0x23, 0x05, 0x03, 0x1F, 0x03, 0x1F, 0x05, 0x04, 0x22, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x1F, 0x22, 0x03, 0x16,
+    0x1B, 0x1F, 0x22, 0x03, 0x0F, 0x1F, 0x20, 0x08, 0x14, 0x16, 0x03, 0x0E, 0x04, 0x22, 0x03, 0x1C, 0x22, 0x14, 0x22,
+    0x23, 0x1F, 0x04, 0x17, 0x1A, 0x06, 0x1E, 0x1F, 0x20, 0x23, 0x07, 0x0B, 0x11, 0x16, 0x1E, 0x03, 0x17, 0x14, 0x03,
+    0x1F, 0x1F, 0x21, 0x1B, 0x20, 0x22, 0x11, 0x16, 0x1E, 0x14, 0x1F, 0x15, 0x03, 0x14, 0x19, 0x1C, 0x04, 0x0A, 0x11,
+    0x0A, 0x14, 0x21, 0x14, 0x19, 0x04, 0x1E, 0x1F, 0x05, 0x0F, 0x14, 0x22, 0x21, 0x21, 0x22, 0x23, 0x16, 0x1F, 0x1E,
+    0x1C, 0x1E, 0x21, 0x22, 0x06, 0x0B, 0x22, 0x1E, 0x05, 0x1F, 0x0F, 0x16, 0x1F, 0x0F, 0x23, 0x1E, 0x1F, 0x03, 0x21,
+    0x03, 0x1B, 0x04, 0x06, 0x21, 0x21, 0x16, 0x1F, 0x03, 0x04, 0x1C, 0x19, 0x1E, 0x05, 0x20, 0x23, 0x1F, 0x20, 0x21,
+    0x07, 0x08, 0x14, 0x1C, 0x21, 0x12, 0x21, 0x23, 0x0B, 0x14, 0x1C, 0x19, 0x13, 0x16, 0x18, 0x20, 0x12, 0x16, 0x19,
+    0x1D, 0x22, 0x05, 0x11, 0x09, 0x1A, 0x20, 0x04, 0x11, 0x19, 0x1D, 0x20, 0x04, 0x05, 0x04, 0x12, 0x03, 0x15, 0x04,
+    0x12, 0x1A, 0x1E, 0x1B, 0x11, 0x03, 0x03, 0x17, 0x1C, 0x06, 0x1E, 0x23, 0x05, 0x0F, 0x1E, 0x03, 0x1F, 0x1F, 0x16,
+    0x19, 0x1F, 0x21, 0x08, 0x09, 0x0B, 0x11, 0x20, 0x04, 0x1B, 0x1F, 0x04, 0x15, 0x04, 0x05, 0x15, 0x18, 0x21, 0x22,
+    0x19, 0x03, 0x19, 0x1F, 0x22, 0x12, 0x1D, 0x1F, 0x21, 0x05, 0x08, 0x0B, 0x19, 0x1C, 0x20, 0x21, 0x0A, 0x0B, 0x11,
+    0x14, 0x19, 0x1C, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1C, 0x1E, 0x20, 0x21, 0x03, 0x04, 0x05, 0x09, 0x11,
+    0x14, 0x19, 0x1C, 0x22, 0x06, 0x05, 0x11, 0x19, 0x16, 0x04, 0x05, 0x11, 0x12, 0x20, 0x08, 0x1F, 0x21, 0x05, 0x08,
+    0x0B, 0x14, 0x22, 0x1F, 0x16, 0x03, 0x14, 0x19, 0x1F, 0x23, 0x05, 0x03, 0x21, 0x04, 0x04, 0x16, 0x1E, 0x05, 0x04,
+    0x18, 0x1F, 0x1C, 0x1F, 0x1E, 0x12, 0x0F, 0x04, 0x05, 0x1F, 0x03, 0x03, 0x21, 0x1F, 0x1F, 0x05, 0x03, 0x1D, 0x1F,
+    0x05, 0x19, 0x1B, 0x1D, 0x04, 0x11, 0x13, 0x1F, 0x21, 0x22, 0x14, 0x1F, 0x0B, 0x19, 0x15, 0x18, 0x08, 0x1F, 0x14,
+    0x19, 0x1B, 0x1E, 0x12, 0x1E, 0x05, 0x22, 0x20, 0x1F, 0x21, 0x04, 0x14, 0x23, 0x16, 0x18, 0x1A, 0x07, 0x1F, 0x05,
+    0x03, 0x03, 0x16, 0x21, 0x05, 0x05, 0x15, 0x04, 0x19, 0x1F, 0x0D, 0x1F, 0x03, 0x03, 0x20, 0x04, 0x17, 0x17, 0x1A,
+    0x04, 0x06, 0x0B, 0x21, 0x23, 0x09, 0x18, 0x1E, 0x05, 0x17, 0x1A, 0x22, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1B,
+    0x23, 0x04, 0x05, 0x08, 0x09, 0x0B, 0x11, 0x15, 0x16, 0x17, 0x1F, 0x20, 0x21, 0x22, 0x05, 0x07, 0x0C, 0x17, 0x19,
+    0x1C, 0x1D, 0x23, 0x03, 0x04, 0x05, 0x09, 0x11, 0x15, 0x18, 0x1E, 0x20, 0x05, 0x16, 0x18, 0x19, 0x1A, 0x1D, 0x1E,
+    0x05, 0x0C, 0x12, 0x08, 0x0B, 0x23, 0x03, 0x1C, 0x03, 0x1F, 0x05, 0x1F, 0x14, 0x22, 0x0F, 0x1E, 0x21, 0x22, 0x14,
+    0x1F, 0x0B, 0x1F, 0x1E, 0x1E, 0x22, 0x19, 0x1F, 0x18, 0x04, 0x14, 0x11, 0x05, 0x14, 0x19, 0x13, 0x19, 0x12, 0x13,
+    0x04, 0x14, 0x22, 0x1E, 0x1F, 0x23, 0x15, 0x08, 0x03, 0x14, 0x05, 0x11, 0x22, 0x05, 0x19, 0x18, 0x03, 0x18, 0x14,
+    0x1C, 0x1F, 0x22, 0x03, 0x06, 0x14, 0x1C, 0x19, 0x12, 0x13, 0x12, 0x03, 0x12, 0x23, 0x1C, 0x19, 0x11, 0x13, 0x03,
+    0x12, 0x18, 0x05, 0x22, 0x12, 0x15, 0x15, 0x14, 0x21, 0x22, 0x18, 0x03, 0x03, 0x03, 0x1E, 0x1E, 0x1F, 0x22, 0x1C,
+    0x0D, 0x16, 0x17, 0x05, 0x06, 0x1E, 0x22, 0x15, 0x1B, 0x04, 0x05, 0x21, 0x04, 0x1A, 0x1B, 0x21, 0x03, 0x1F, 0x1F,
+    0x18, 0x0B, 0x05, 0x0E, 0x16, 0x04, 0x05, 0x09, 0x15, 0x04, 0x05, 0x23, 0x03, 0x15, 0x04, 0x19, 0x22, 0x06, 0x20,
+    0x21, 0x1F, 0x1B, 0x21, 0x04, 0x1D, 0x23, 0x04, 0x16, 0x20, 0x14, 0x1F, 0x05, 0x1F, 0x1F, 0x14, 0x1F, 0x1F, 0x1E,
+    0x03, 0x1F, 0x03, 0x09, 0x16, 0x03, 0x05, 0x22, 0x0E, 0x1F, 0x1F, 0x04, 0x1F, 0x17, 0x1A, 0x04, 0x1F, 0x21, 0x03,
+    0x03, 0x1E, 0x05, 0x05, 0x03, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x1F, 0x1D, 0x21, 0x16, 0x1F, 0x21, 0x04, 0x05,
+    0x07, 0x16, 0x17, 0x19, 0x1E, 0x23, 0x05, 0x0A, 0x11, 0x21, 0x03, 0x16, 0x05, 0x1F, 0x1F, 0x03, 0x04, 0x1E, 0x1F,
+    0x22, 0x1C, 0x19, 0x22, 0x12, 0x13, 0x14, 0x14, 0x22, 0x1B, 0x04, 0x04, 0x08, 0x20, 0x08, 0x1C, 0x06, 0x1C, 0x11,
+    0x12, 0x12, 0x05, 0x22, 0x1E, 0x18, 0x1E, 0x22, 0x22, 0x1C, 0x12, 0x20, 0x20, 0x05, 0x14, 0x19, 0x06, 0x0E, 0x1B,
+    0x04, 0x22, 0x05, 0x22, 0x1E, 0x05, 0x04, 0x19, 0x03, 0x1F, 0x14, 0x19, 0x1E, 0x14, 0x20, 0x04, 0x14, 0x19, 0x22,
+    0x12, 0x04, 0x14, 0x19, 0x1C, 0x11, 0x13, 0x1E, 0x21, 0x1F, 0x16, 0x22, 0x03, 0x1B, 0x11, 0x12, 0x14, 0x0E, 0x19,
+    0x06, 0x0B, 0x17, 0x20, 0x22, 0x1A, 0x03, 0x05, 0x14, 0x06, 0x0E, 0x1E, 0x14, 0x19, 0x06, 0x14, 0x06, 0x0A, 0x04,
+    0x05, 0x14, 0x22, 0x23, 0x06, 0x22, 0x12, 0x22, 0x22, 0x03, 0x03, 0x1F, 0x18, 0x03, 0x16, 0x1E, 0x03, 0x03, 0x21,
+    0x14, 0x03, 0x1E, 0x05, 0x06, 0x20, 0x05, 0x21, 0x03, 0x1F, 0x09, 0x1E, 0x1F, 0x11, 0x1A, 0x19, 0x1C, 0x14, 0x1C,
+    0x22, 0x06, 0x1A, 0x1C, 0x21, 0x21, 0x04, 0x05, 0x21, 0x03, 0x16, 0x1E, 0x16, 0x1F, 0x23, 0x03, 0x05, 0x1F, 0x03,
+    0x14, 0x16, 0x1E, 0x1E, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x02, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25,
+    0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x02, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x02, 0x24, 0x24, 0x02, 0x25, 0x24, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x02, 0x24, 0x25, 0x24, 0x02, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x02, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x02, 0x25, 0x24, 0x25, 0x24,
+    0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25,
+    0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x02, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x02, 0x24, 0x25,
+    0x24, 0x02, 0x02, 0x02, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x02, 0x24, 0x24,
+    0x25, 0x25, 0x02, 0x24, 0x25, 0x02, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x02, 0x25, 0x24,
+    0x02, 0x24, 0x25, 0x02, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x25,
+    0x02, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x25, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24,
+    0x24, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x02, 0x02, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x02, 0x02, 0x02,
+    0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x02, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25,
+    0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x24,
+    0x25, 0x24, 0x24, 0x25, 0x24, 0x25, 0x24, 0x24, 0x02, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25,
+    0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x02, 0x02,
+    0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x25, 0x24, 0x25, 0x25, 0x25, 0x24, 0x24, 0x05, 0x1C,
+    0x04, 0x05, 0x18, 0x1F, 0x1B, 0x1B, 0x03, 0x0F, 0x0F, 0x1C, 0x20, 0x04, 0x05, 0x05, 0x05, 0x05, 0x09, 0x19, 0x14,
+    0x03, 0x03, 0x20, 0x04, 0x05, 0x1F, 0x05, 0x1E, 0x1F, 0x16, 0x1F, 0x03, 0x17, 0x06, 0x20, 0x21, 0x12, 0x22, 0x08,
+    0x19, 0x20, 0x18, 0x04, 0x19, 0x21, 0x08, 0x04, 0x04, 0x19, 0x1C, 0x05, 0x04, 0x1C, 0x1E, 0x0F, 0x1E, 0x14, 0x14,
+    0x04, 0x22, 0x1C, 0x22, 0x0F, 0x22, 0x0E, 0x1C, 0x1C, 0x1E, 0x04, 0x03, 0x16, 0x18, 0x21, 0x1C, 0x14, 0x19, 0x03,
+    0x12, 0x19, 0x1C, 0x0F, 0x1F, 0x03, 0x1F, 0x14, 0x21, 0x21, 0x03, 0x05, 0x0A, 0x0F, 0x04, 0x1C, 0x22, 0x19, 0x1C,
+    0x22, 0x03, 0x22, 0x21, 0x18, 0x14, 0x14, 0x20, 0x19, 0x13, 0x19, 0x13, 0x15, 0x21, 0x21, 0x22, 0x12, 0x1C, 0x12,
+    0x0E, 0x0B, 0x16, 0x21, 0x19, 0x14, 0x1F, 0x21, 0x0E, 0x1E, 0x04, 0x21, 0x1A, 0x19, 0x14, 0x0E, 0x14, 0x03, 0x21,
+    0x16, 0x21, 0x20, 0x05, 0x04, 0x19, 0x1D, 0x12, 0x21, 0x21, 0x06, 0x03, 0x16, 0x22, 0x19, 0x05, 0x18, 0x03, 0x16,
+    0x03, 0x22, 0x0E, 0x14, 0x03, 0x19, 0x1E, 0x09, 0x22, 0x22, 0x1B, 0x14, 0x1B, 0x1C, 0x03, 0x06, 0x03, 0x1E, 0x0B,
+    0x18, 0x0C, 0x05, 0x22, 0x03, 0x21, 0x04, 0x1B, 0x1F, 0x1C, 0x03, 0x22, 0x1F, 0x16, 0x04, 0x21, 0x16, 0x20, 0x1E,
+    0x1F, 0x21, 0x05, 0x05, 0x22, 0x22, 0x1F, 0x23, 0x22, 0x19, 0x1C, 0x06, 0x19, 0x13, 0x16, 0x0F, 0x22, 0x19, 0x1C,
+    0x13, 0x04, 0x16, 0x1F, 0x14, 0x22, 0x22, 0x21, 0x21, 0x20, 0x05, 0x18, 0x19, 0x1F, 0x1C, 0x1E, 0x1E, 0x22, 0x06,
+    0x0F, 0x1F, 0x1F, 0x1C, 0x16, 0x1F, 0x03, 0x05, 0x1E, 0x18, 0x20, 0x08, 0x16, 0x20, 0x1E, 0x1B, 0x04, 0x20, 0x03,
+    0x1C, 0x19, 0x19, 0x03, 0x1C, 0x0F, 0x1C, 0x04, 0x21, 0x03, 0x1F, 0x18, 0x20, 0x21, 0x17, 0x03, 0x14, 0x16, 0x19,
+    0x22, 0x03, 0x06, 0x12, 0x13, 0x14, 0x05, 0x14, 0x19, 0x22, 0x12, 0x18, 0x04, 0x06, 0x14, 0x04, 0x22, 0x1C, 0x12,
+    0x14, 0x03, 0x15, 0x21, 0x04, 0x05, 0x03, 0x1F, 0x19, 0x1C, 0x1C, 0x21, 0x05, 0x14, 0x22, 0x14, 0x1C, 0x17, 0x1A,
+    0x14, 0x12, 0x14, 0x22, 0x14, 0x19, 0x05, 0x1F, 0x20, 0x23, 0x05, 0x22, 0x03, 0x20, 0x1F, 0x1C, 0x21, 0x1E, 0x17,
+    0x1A, 0x03, 0x04, 0x16, 0x1E, 0x18, 0x16, 0x20, 0x17, 0x16, 0x21, 0x0B, 0x22, 0x19, 0x1F, 0x05, 0x22, 0x19, 0x03,
+    0x0E, 0x1C, 0x0A, 0x17, 0x1A, 0x1B, 0x1E, 0x1F, 0x15, 0x15, 0x16, 0x15, 0x14, 0x06, 0x1E, 0x16, 0x16, 0x21, 0x22,
+    0x03, 0x06, 0x03, 0x22, 0x1F, 0x21, 0x23, 0x20, 0x05, 0x1A, 0x20, 0x05, 0x14, 0x14, 0x06, 0x03, 0x1D, 0x05, 0x04,
+    0x04, 0x1D, 0x04, 0x21, 0x1F, 0x1E, 0x23, 0x1F, 0x04, 0x03, 0x22, 0x16, 0x1D, 0x20, 0x23, 0x11, 0x11, 0x1D, 0x17,
+    0x08, 0x04, 0x20, 0x1F, 0x21, 0x04, 0x14, 0x21, 0x16, 0x21, 0x1F, 0x15, 0x18, 0x1B, 0x04, 0x1A, 0x1E, 0x0A, 0x0B,
+    0x18, 0x19, 0x1E, 0x04, 0x0A, 0x17, 0x1E, 0x0B, 0x1C, 0x1E, 0x14, 0x19, 0x22, 0x06, 0x0E, 0x22, 0x21, 0x14, 0x04,
+    0x22, 0x03, 0x05, 0x04, 0x1E, 0x1E, 0x1E, 0x1E, 0x22, 0x18, 0x1E, 0x20, 0x03, 0x19, 0x22, 0x22, 0x06, 0x1C, 0x22,
+    0x0E, 0x12, 0x21, 0x17, 0x0F, 0x19, 0x13, 0x1F, 0x1F, 0x22, 0x22, 0x21, 0x06, 0x03, 0x12, 0x15, 0x03, 0x1D, 0x15,
+    0x1B, 0x08, 0x09, 0x14, 0x1F, 0x1E, 0x14, 0x18, 0x12, 0x23, 0x04, 0x1C, 0x14, 0x22, 0x17, 0x1C, 0x20, 0x14, 0x22,
+    0x05, 0x22, 0x16, 0x1C, 0x14, 0x1F, 0x19, 0x11, 0x1F, 0x06, 0x19, 0x13, 0x05, 0x03, 0x04, 0x21, 0x04, 0x09, 0x03,
+    0x1A, 0x23, 0x04, 0x03, 0x11, 0x1C, 0x06, 0x1C, 0x1E, 0x1F, 0x1E, 0x05, 0x17, 0x21, 0x1C, 0x03, 0x1D, 0x14, 0x03,
+    0x14, 0x14, 0x22, 0x23, 0x22, 0x1E, 0x15, 0x14, 0x19, 0x03, 0x13, 0x18, 0x22, 0x16, 0x14, 0x04, 0x15, 0x06, 0x19,
+    0x03, 0x14, 0x12, 0x22, 0x18, 0x1C, 0x03, 0x1F, 0x19, 0x23, 0x18, 0x07, 0x0D, 0x1E, 0x1F, 0x05, 0x21, 0x17, 0x1A,
+    0x04, 0x04, 0x12, 0x18, 0x1D, 0x16, 0x1B, 0x1F, 0x0C, 0x14, 0x16, 0x18, 0x08, 0x15, 0x0B, 0x19, 0x14, 0x1E, 0x1E,
+    0x05, 0x14, 0x03, 0x1C, 0x19, 0x22, 0x1E, 0x22, 0x14, 0x1C, 0x22, 0x06, 0x14, 0x20, 0x16, 0x05, 0x04, 0x14, 0x22,
+    0x06, 0x0F, 0x19, 0x0B, 0x13, 0x14, 0x21, 0x1F, 0x1E, 0x05, 0x06, 0x0F, 0x1F, 0x04, 0x1F, 0x05, 0x18, 0x1F, 0x22,
+    0x0F, 0x21, 0x14, 0x1C, 0x22, 0x06, 0x20, 0x03, 0x1F, 0x20, 0x1A, 0x04, 0x03, 0x21, 0x03, 0x23, 0x03, 0x1F, 0x0A,
+    0x05, 0x22, 0x0E, 0x16, 0x19, 0x06, 0x12, 0x05, 0x05, 0x03, 0x22, 0x19, 0x1F, 0x23, 0x15, 0x03, 0x14, 0x1F, 0x1E,
+    0x04, 0x21, 0x22, 0x1F, 0x23, 0x22, 0x14, 0x19, 0x1C, 0x13, 0x11, 0x19, 0x1D, 0x11, 0x16, 0x1F, 0x05, 0x04, 0x06,
+    0x1C, 0x14, 0x24, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24,
+    0x24, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x25, 0x25, 0x24, 0x24, 0x25, 0x24, 0x24, 0x24, 0x25, 0x24, 0x24, 0x1E,
+    0x1E, 0x16, 0x1D, 0x05, 0x1C, 0x22, 0x21, 0x04, 0x20, 0x14, 0x05, 0x1F, 0x1C, 0x04, 0x1F, 0x16, 0x20, 0x05, 0x21,
+    0x19, 0x22, 0x21, 0x22, 0x04, 0x04, 0x1F, 0x20, 0x11, 0x1C, 0x1F, 0x19, 0x13, 0x1F, 0x1F, 0x24, 0x24, 0x24, 0x24,
+    0x24, 0x25, 0x25, 0x25, 0x22, 0x20, 0x21, 0x1E, 0x1E, 0x05, 0x04, 0x04,
+};
+
+constexpr uint16_t ru_child_base[] = {
+    1, 121, 153, 185, 217, 251, 289, 355, 619, 883, 1147, 1411, 1675, 1939, 2203, 2467,
+    2502, 2520, 2549, 2558, 2596, 2632, 2659, 2688, 2722, 2757, 2787, 2817, 2844, 2873, 2915, 2957,
+    2985, 3009, 3037, 3070, 3105, 3147, 3169, 3192, 3214, 3251, 3274, 3303, 3341, 3373, 3403, 3435,
+    3467, 3512, 3548, 3578, 3607, 3646, 3688, 3729, 3773, 3808, 3839, 3879, 3920, 3943, 3967, 3992,
+    4019, 4044, 4064, 4087, 4110, 4136, 4165, 4185, 4204, 4222, 4240, 4259, 4293, 4313, 4341, 4364,
+    4391, 4412, 4438, 4462, 4492, 4519, 4548, 4574, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577,
+    4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577,
+    4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577,
+    4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577,
+    4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4577, 4587, 4602, 4621, 4633,
+    4641, 4680, 4709, 4747, 4773, 4788, 4806, 4838, 4845, 4861, 4890, 4926, 4943, 4961, 4973, 5001,
+    5014, 5027, 5049, 5084, 5100, 5117, 5156, 5187, 5243, 5258, 5267, 5286, 5294, 5298, 5340, 5380,
+    5400, 5411, 5455, 5477, 5527, 5543, 5547, 5553, 5562, 5584, 5604, 5639, 5651, 5682, 5703, 5732,
+    5753, 5781, 5796, 5827, 5834, 5863, 5908, 5942, 5949, 5972, 6007, 6042, 6095, 6120, 6134, 6154,
+    6189, 6199, 6223, 6260, 6293, 6338, 6349, 6372, 6401, 6427, 6464, 6509, 6525, 6549, 6578, 6616,
+    6626, 6646, 6668, 6685, 6732, 6749, 6761, 6777, 6787, 6797, 6808, 6831, 6834, 6850, 6853, 6858,
+    6870, 6878, 6893, 6903, 6916, 6923, 6931, 6931, 6931, 6937, 6939, 6952, 6965, 6980, 6986, 6993,
+    7003, 7011, 7017, 7031, 7035, 7045, 7059, 7061, 7072, 7084, 7099, 7104, 7118, 7145, 7155, 7173,
+    7194, 7221, 7241, 7250, 7262, 7273, 7283, 7298, 7311, 7324, 7331, 7338, 7348, 7364, 7386, 7395,
+    7402, 7412, 7426, 7438, 7455, 7461, 7466, 7480, 7500, 7516, 7526, 7543, 7560, 7580, 7598, 7603,
+    7617, 7633, 7646, 7655, 7662, 7680, 7693, 7707, 7717, 7728, 7734, 7738, 7749, 7761, 7773, 7784,
+    7803, 7814, 7824, 7832, 7836, 7846, 7857, 7869, 7884, 7895, 7910, 7920, 7928, 7940, 7958, 7975,
+    7990, 8003, 8020, 8029, 8047, 8062, 8074, 8076, 8086, 8101, 8115, 8132, 8139, 8149, 8162, 8171,
+    8187, 8197, 8213, 8221, 8226, 8230, 8244, 8259, 8276, 8285, 8295, 8312, 8327, 8343, 8357, 8366,
+    8383, 8405, 8420, 8438, 8453, 8474, 8483, 8504, 8520, 8529, 8551, 8570, 8586, 8592, 8595, 8613,
+    8618, 8634, 8655, 8672, 8681, 8699, 8716, 8723, 8728, 8742, 8757, 8772, 8788, 8798, 8811, 8816,
+    8828, 8836, 8840, 8847, 8854, 8862, 8870, 8880, 8892, 8897, 8911, 8919, 8927, 8939, 8941, 8952,
+    8967, 8974, 8978, 8985, 8992, 8999, 9008, 9015, 9022, 9026, 9031, 9034, 9039, 9044, 9050, 9058,
+    9070, 9076, 9087, 9099, 9110, 9123, 9141, 9162, 9180, 9199, 9226, 9243, 9274, 9292, 9322, 9341,
+    9365, 9385, 9408, 9426, 9447, 9474, 9502, 9524, 9549, 9568, 9615, 9640, 9664, 9689, 9713, 9732,
+    9760, 9787, 9812, 9831, 9851, 9870, 9888, 9910, 9934, 9952, 9976, 9993, 10011, 10032, 10053, 10074,
+    10091, 10107, 10125, 10153, 10178, 10195, 10215, 10232, 10255, 10272, 10290, 10308, 10332, 10354, 10372, 10394,
+    10421, 10443, 10466, 10490, 10512, 10534, 10553, 10573, 10597, 10621, 10644, 10663, 10682, 10704, 10729, 10758,
+    10780, 10803, 10826, 10850, 10876, 10894, 10916, 10941, 10962, 10980, 10999, 11018, 11043, 11063, 11086, 11108,
+    11148, 11170, 11187, 11209, 11230, 11251, 11305, 11326, 11343, 11361, 11384, 11400, 11421, 11442, 11458, 11475,
+    11493, 11514, 11532, 11552, 11568, 11591, 11609, 11625, 11641, 11658, 11671, 11675, 11681, 11686, 11692, 11702,
+    11714, 11717, 11717, 11722, 11727, 11731, 11735, 11738, 11740, 11743, 11744, 11746, 11747, 11748, 11751, 11752,
+    11753, 11755, 11756, 11759, 11761, 11767, 11773, 11783, 11790, 11792, 11795, 11797, 11805, 11809, 11817, 11818,
+    11825, 11828, 11833, 11843, 11852, 11860, 11864, 11866, 11870, 11872, 11873, 11873, 11873, 11875, 11876, 11880,
+    11887, 11892, 11896, 11899, 11908, 11911, 11913, 11916, 11919, 11922, 11924, 11924, 11926, 11927, 11932, 11936,
+    11937, 11942, 11945, 11946, 11951, 11957, 11958, 11959, 11960, 11963, 11965, 11968, 11974, 11975, 11981, 11988,
+    11996, 12008, 12013, 12017, 12026, 12039, 12043, 12059, 12062, 12073, 12074, 12078, 12083, 12088, 12092, 12097,
+    12102, 12109, 12113, 12120, 12122, 12125, 12131, 12134, 12136, 12138, 12147, 12156, 12160, 12165, 12170, 12172,
+    12175, 12179, 12184, 12185, 12187, 12189, 12194, 12203, 12208, 12218, 12220, 12226, 12227, 12232, 12235, 12237,
+    12242, 12250, 12255, 12256, 12257, 12259, 12262, 12266, 12267, 12270, 12270, 12271, 12274, 12279, 12282, 12283,
+    12283, 12284, 12286, 12290, 12291, 12291, 12298, 12301, 12306, 12309, 12321, 12337, 12353, 12370, 12386, 12403,
+    12420, 12439, 12456, 12471, 12487, 12502, 12518, 12536, 12552, 12566, 12588, 12604, 12623, 12641, 12656, 12677,
+    12691, 12707, 12722, 12748, 12765, 12782, 12799, 12816, 12834, 12851, 12869, 12887, 12903, 12922, 12940, 12957,
+    12975, 12991, 12998, 12998, 12998, 13000, 13000, 13000, 13001, 13001, 13002, 13002, 13004, 13005, 13005, 13005,
+    13006, 13006, 13006, 13006, 13009, 13010, 13013, 13014, 13014, 13017, 13017, 13017, 13017, 13018, 13021, 13024,
+    13025, 13027, 13027, 13027, 13028, 13029, 13029, 13029, 13029, 13031, 13031, 13031, 13033, 13043, 13059, 13069,
+    13071, 13080,
+};
+
+constexpr uint8_t ru_child_offset[] = {
+    0x00, 0x04, 0x07, 0x09, 0x19, 0x2A, 0x2A, 0x3A, 0x4B, 0x5B, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x76, 0x00, 0x02, 0x04,
+    0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A,
+    0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10,
+    0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16,
+    0x18, 0x1B, 0x1D, 0x20, 0x00, 0x02, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E, 0x21,
+    0x23, 0x00, 0x01, 0x03, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x21, 0x32, 0x00, 0x11,
+    0x21, 0x32, 0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32, 0x42,
+    0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32, 0x42, 0x53, 0x63, 0x74,
+    0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32, 0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5,
+    0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32, 0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7,
+    0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32, 0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00,
+    0x11, 0x21, 0x32, 0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x21, 0x32,
+    0x42, 0x53, 0x63, 0x74, 0x84, 0x95, 0xA5, 0xB6, 0xC6, 0xD7, 0xE7, 0xF8, 0x00, 0x11, 0x11, 0x17, 0x1A, 0x1A, 0x1C,
+    0x1C, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x22, 0x22, 0x23, 0x00, 0x00, 0x01, 0x01, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08,
+    0x0A, 0x0A, 0x0D, 0x0E, 0x0E, 0x11, 0x00, 0x00, 0x04, 0x06, 0x06, 0x08, 0x09, 0x09, 0x0D, 0x0E, 0x0E, 0x11, 0x13,
+    0x13, 0x15, 0x15, 0x00, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x13, 0x16, 0x19, 0x1A, 0x1D, 0x20, 0x23, 0x00, 0x03, 0x06,
+    0x09, 0x0C, 0x0F, 0x12, 0x14, 0x17, 0x18, 0x1B, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x00, 0x02, 0x04, 0x05, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x10, 0x11, 0x12, 0x15, 0x16, 0x17, 0x1A, 0x00, 0x01, 0x04, 0x05, 0x09, 0x0B, 0x0C, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x17, 0x1A, 0x00, 0x02, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x0E, 0x0F, 0x11, 0x14, 0x15,
+    0x18, 0x1B, 0x1C, 0x1F, 0x00, 0x03, 0x06, 0x09, 0x0A, 0x0E, 0x11, 0x13, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1D, 0x1E,
+    0x20, 0x00, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0D, 0x0F, 0x11, 0x12, 0x14, 0x17, 0x18, 0x19, 0x1C, 0x1D, 0x00, 0x03,
+    0x04, 0x07, 0x0A, 0x0B, 0x0F, 0x12, 0x13, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x12, 0x16, 0x17, 0x1A, 0x00, 0x01, 0x03, 0x04, 0x07, 0x0A, 0x0B, 0x0F,
+    0x11, 0x12, 0x15, 0x16, 0x17, 0x1A, 0x1B, 0x1C, 0x00, 0x04, 0x07, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x12, 0x15, 0x18,
+    0x1B, 0x1E, 0x21, 0x24, 0x27, 0x00, 0x01, 0x04, 0x07, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x19, 0x1C, 0x1E, 0x21, 0x24,
+    0x26, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x00,
+    0x03, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0D, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00, 0x01, 0x02, 0x04,
+    0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0E, 0x11, 0x12, 0x15, 0x17, 0x19, 0x1B, 0x00, 0x01, 0x05, 0x06, 0x08, 0x0B, 0x0D,
+    0x10, 0x13, 0x14, 0x17, 0x18, 0x1A, 0x1E, 0x1F, 0x20, 0x00, 0x01, 0x02, 0x03, 0x07, 0x0A, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x15, 0x17, 0x1A, 0x1D, 0x20, 0x00, 0x02, 0x05, 0x06, 0x08, 0x0B, 0x0E, 0x11, 0x14, 0x17, 0x19, 0x1C, 0x1F,
+    0x22, 0x24, 0x27, 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0D, 0x0F, 0x10, 0x13, 0x15, 0x16, 0x00, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x15, 0x00, 0x02, 0x05, 0x06, 0x07, 0x0A,
+    0x0B, 0x0D, 0x10, 0x11, 0x14, 0x17, 0x18, 0x1C, 0x1F, 0x22, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x12, 0x14, 0x00, 0x02, 0x03, 0x07, 0x08, 0x0A, 0x0D, 0x0E, 0x10, 0x12, 0x13, 0x15,
+    0x18, 0x19, 0x1A, 0x1C, 0x00, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x11, 0x15, 0x16, 0x1A, 0x1E, 0x21,
+    0x24, 0x00, 0x01, 0x03, 0x04, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x0F, 0x11, 0x12, 0x15, 0x18, 0x1A, 0x1D, 0x00, 0x01,
+    0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0D, 0x0F, 0x12, 0x15, 0x17, 0x18, 0x1A, 0x1B, 0x00, 0x01, 0x02, 0x05, 0x08,
+    0x0C, 0x0D, 0x0F, 0x12, 0x13, 0x16, 0x17, 0x18, 0x1A, 0x1D, 0x1E, 0x00, 0x03, 0x06, 0x08, 0x09, 0x0B, 0x0C, 0x0E,
+    0x10, 0x11, 0x13, 0x15, 0x19, 0x1A, 0x1C, 0x1E, 0x00, 0x02, 0x05, 0x08, 0x0B, 0x0E, 0x11, 0x13, 0x16, 0x19, 0x1B,
+    0x1E, 0x21, 0x24, 0x27, 0x2A, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x14, 0x17, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x20, 0x21, 0x00, 0x02, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x13, 0x17, 0x18, 0x1B, 0x00,
+    0x02, 0x06, 0x08, 0x0B, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x16, 0x17, 0x1A, 0x1C, 0x00, 0x01, 0x03, 0x07,
+    0x09, 0x0C, 0x0F, 0x12, 0x16, 0x18, 0x1A, 0x1D, 0x1E, 0x21, 0x23, 0x25, 0x00, 0x04, 0x06, 0x07, 0x0A, 0x0D, 0x11,
+    0x13, 0x16, 0x18, 0x1A, 0x1D, 0x1E, 0x20, 0x24, 0x28, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x11, 0x13, 0x16, 0x19,
+    0x1A, 0x1B, 0x1E, 0x1F, 0x23, 0x26, 0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x13, 0x16, 0x18, 0x1A, 0x1C, 0x1F, 0x21,
+    0x22, 0x25, 0x28, 0x00, 0x02, 0x04, 0x07, 0x0A, 0x0D, 0x0E, 0x12, 0x13, 0x14, 0x17, 0x18, 0x19, 0x1C, 0x1D, 0x20,
+    0x00, 0x03, 0x04, 0x07, 0x09, 0x0D, 0x0F, 0x11, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0x00, 0x04, 0x05,
+    0x07, 0x0A, 0x0D, 0x10, 0x13, 0x16, 0x19, 0x1C, 0x1F, 0x21, 0x23, 0x24, 0x25, 0x00, 0x03, 0x05, 0x08, 0x0B, 0x0E,
+    0x11, 0x14, 0x17, 0x1A, 0x1D, 0x20, 0x21, 0x24, 0x27, 0x28, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x13, 0x16, 0x00, 0x01, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0C, 0x0D, 0x0F, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x10, 0x11, 0x12, 0x14, 0x15,
+    0x16, 0x00, 0x01, 0x02, 0x05, 0x07, 0x09, 0x0C, 0x0D, 0x10, 0x11, 0x12, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x00, 0x01,
+    0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0E, 0x0F, 0x12, 0x13, 0x14, 0x17, 0x18, 0x00, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x15, 0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x12, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x12, 0x13, 0x15,
+    0x16, 0x17, 0x00, 0x01, 0x02, 0x05, 0x06, 0x08, 0x0B, 0x0D, 0x10, 0x11, 0x13, 0x14, 0x15, 0x18, 0x1B, 0x1C, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x03, 0x04, 0x05,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07,
+    0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0F, 0x10, 0x12, 0x00, 0x02, 0x05, 0x06, 0x08, 0x0A, 0x0C, 0x0D, 0x10, 0x12, 0x14, 0x16, 0x17, 0x19, 0x1C, 0x1F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03,
+    0x05, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x14, 0x15, 0x18, 0x19, 0x00, 0x03, 0x04, 0x05, 0x07, 0x08,
+    0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x16, 0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x00, 0x03, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0E, 0x0F, 0x11, 0x14, 0x16, 0x18,
+    0x19, 0x00, 0x03, 0x06, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00, 0x01,
+    0x02, 0x04, 0x07, 0x09, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x15, 0x17, 0x1A, 0x1D, 0x00, 0x01, 0x04, 0x07, 0x0A,
+    0x0B, 0x0C, 0x0F, 0x11, 0x12, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x01, 0x02, 0x03, 0x05, 0x08, 0x09, 0x0B,
+    0x0C, 0x0E, 0x10, 0x11, 0x12, 0x15, 0x18, 0x1A, 0x00, 0x01, 0x04, 0x07, 0x0A, 0x0D, 0x0E, 0x0F, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B,
+    0x0C, 0x0C, 0x0E, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x11,
+    0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x02, 0x02, 0x04, 0x06,
+    0x06, 0x0B, 0x12, 0x12, 0x17, 0x18, 0x18, 0x1D, 0x21, 0x21, 0x25, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x07, 0x08,
+    0x08, 0x08, 0x0C, 0x0E, 0x0E, 0x12, 0x17, 0x17, 0x00, 0x02, 0x02, 0x05, 0x09, 0x09, 0x0B, 0x0D, 0x0D, 0x0F, 0x10,
+    0x10, 0x18, 0x1F, 0x1F, 0x22, 0x00, 0x00, 0x05, 0x0C, 0x0C, 0x0F, 0x13, 0x13, 0x14, 0x14, 0x16, 0x17, 0x17, 0x17,
+    0x19, 0x1A, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x07, 0x0D, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x06, 0x09, 0x09, 0x09, 0x09, 0x10, 0x12, 0x12, 0x12, 0x00, 0x02, 0x08, 0x08,
+    0x08, 0x08, 0x10, 0x14, 0x14, 0x14, 0x14, 0x18, 0x1E, 0x1E, 0x20, 0x20, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x09,
+    0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x00, 0x01, 0x01, 0x08, 0x0F, 0x0F, 0x0F, 0x12, 0x13, 0x13, 0x18, 0x1B, 0x1B,
+    0x1B, 0x1C, 0x1D, 0x00, 0x03, 0x06, 0x06, 0x07, 0x08, 0x08, 0x0B, 0x0E, 0x0E, 0x17, 0x1C, 0x1C, 0x1C, 0x1C, 0x20,
+    0x00, 0x00, 0x03, 0x05, 0x05, 0x06, 0x06, 0x0C, 0x0F, 0x0F, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x11, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x07, 0x07, 0x07, 0x09, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x12, 0x00, 0x01, 0x03, 0x03, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x01, 0x01, 0x01, 0x01, 0x05, 0x09, 0x09, 0x09,
+    0x0D, 0x0F, 0x0F, 0x17, 0x1C, 0x1C, 0x1C, 0x00, 0x04, 0x08, 0x08, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x06, 0x0B, 0x0D,
+    0x0D, 0x00, 0x00, 0x08, 0x0B, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x0E, 0x11, 0x15, 0x15, 0x15, 0x15, 0x16, 0x00, 0x00,
+    0x03, 0x05, 0x05, 0x0F, 0x15, 0x15, 0x15, 0x15, 0x19, 0x1D, 0x1D, 0x1E, 0x1E, 0x1E, 0x00, 0x05, 0x05, 0x05, 0x05,
+    0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0D, 0x00, 0x00, 0x00, 0x02, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x06, 0x06, 0x0A, 0x0B, 0x0B, 0x10, 0x13, 0x13, 0x15, 0x17,
+    0x17, 0x1A, 0x1C, 0x1C, 0x23, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x09, 0x0C, 0x0C, 0x0E, 0x13, 0x13, 0x15, 0x19,
+    0x19, 0x1B, 0x00, 0x00, 0x0A, 0x0F, 0x0F, 0x15, 0x18, 0x18, 0x1D, 0x23, 0x23, 0x2B, 0x2D, 0x2D, 0x32, 0x38, 0x00,
+    0x03, 0x03, 0x05, 0x06, 0x06, 0x0A, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x08, 0x09, 0x00, 0x05, 0x08, 0x08, 0x0D, 0x0E, 0x0E,
+    0x10, 0x11, 0x11, 0x11, 0x12, 0x13, 0x13, 0x13, 0x13, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x06, 0x06, 0x07, 0x07,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x00, 0x0E, 0x17, 0x17, 0x17, 0x1D, 0x21, 0x21, 0x24, 0x24, 0x27, 0x27, 0x2A, 0x2A, 0x2A, 0x2A,
+    0x00, 0x03, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x10, 0x13, 0x13, 0x21, 0x00, 0x00, 0x00,
+    0x04, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x05, 0x07, 0x07, 0x07, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x09, 0x0E, 0x0E, 0x0F, 0x0F, 0x14, 0x1A,
+    0x1A, 0x1E, 0x1F, 0x1F, 0x23, 0x25, 0x25, 0x00, 0x01, 0x01, 0x02, 0x02, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x0D,
+    0x10, 0x10, 0x14, 0x16, 0x00, 0x05, 0x07, 0x07, 0x0A, 0x0D, 0x0D, 0x16, 0x1C, 0x1C, 0x20, 0x20, 0x25, 0x26, 0x26,
+    0x2F, 0x00, 0x00, 0x03, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x09, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x07, 0x07,
+    0x07, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x11, 0x11,
+    0x11, 0x14, 0x15, 0x15, 0x15, 0x00, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x07, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0E,
+    0x14, 0x14, 0x00, 0x02, 0x03, 0x03, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x14, 0x16, 0x16, 0x1E, 0x20, 0x20, 0x22, 0x00,
+    0x00, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x0F, 0x0F, 0x10, 0x10, 0x13, 0x14, 0x14, 0x17, 0x17, 0x17, 0x17, 0x00, 0x03, 0x03, 0x03, 0x04, 0x04, 0x0C,
+    0x10, 0x10, 0x10, 0x12, 0x12, 0x14, 0x14, 0x14, 0x15, 0x00, 0x08, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x18, 0x1C, 0x1C, 0x1C, 0x1D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x0C, 0x14,
+    0x14, 0x14, 0x14, 0x00, 0x02, 0x02, 0x02, 0x05, 0x07, 0x07, 0x0B, 0x0D, 0x0D, 0x14, 0x19, 0x19, 0x1B, 0x1B, 0x1B,
+    0x00, 0x00, 0x00, 0x05, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x00, 0x03, 0x06,
+    0x06, 0x10, 0x14, 0x14, 0x15, 0x15, 0x18, 0x19, 0x19, 0x1C, 0x1D, 0x1D, 0x1D, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x05,
+    0x05, 0x0E, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x15, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F,
+    0x25, 0x2A, 0x2A, 0x2A, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x0B, 0x10, 0x10, 0x10, 0x13, 0x13, 0x1B, 0x1F,
+    0x1F, 0x00, 0x01, 0x01, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x04, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0F, 0x0F, 0x14, 0x00, 0x00, 0x02, 0x06, 0x06,
+    0x08, 0x09, 0x09, 0x0F, 0x13, 0x13, 0x18, 0x1B, 0x1B, 0x1C, 0x1C, 0x00, 0x02, 0x02, 0x07, 0x08, 0x08, 0x09, 0x09,
+    0x0D, 0x10, 0x10, 0x15, 0x1A, 0x1A, 0x1E, 0x23, 0x00, 0x05, 0x08, 0x08, 0x0A, 0x0D, 0x0D, 0x10, 0x12, 0x12, 0x18,
+    0x1F, 0x1F, 0x27, 0x2E, 0x2E, 0x00, 0x06, 0x06, 0x07, 0x09, 0x09, 0x0D, 0x0F, 0x0F, 0x13, 0x15, 0x15, 0x16, 0x16,
+    0x18, 0x19, 0x00, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0B, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x14, 0x14, 0x14, 0x00, 0x00, 0x04, 0x08,
+    0x08, 0x08, 0x0A, 0x0B, 0x0B, 0x15, 0x1C, 0x1C, 0x1D, 0x1D, 0x1D, 0x20, 0x00, 0x00, 0x03, 0x03, 0x05, 0x06, 0x06,
+    0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x04, 0x04, 0x04, 0x10, 0x16, 0x16, 0x00, 0x00, 0x04, 0x06, 0x06, 0x09, 0x0A, 0x0A, 0x10, 0x11, 0x11, 0x11, 0x1D,
+    0x23, 0x23, 0x25, 0x00, 0x02, 0x02, 0x0D, 0x16, 0x16, 0x16, 0x18, 0x19, 0x19, 0x1C, 0x1C, 0x1D, 0x1D, 0x21, 0x21,
+    0x00, 0x0D, 0x16, 0x16, 0x17, 0x17, 0x17, 0x1A, 0x1B, 0x1B, 0x1F, 0x23, 0x23, 0x23, 0x29, 0x2D, 0x00, 0x01, 0x01,
+    0x05, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x05, 0x07, 0x07, 0x07, 0x0A,
+    0x0F, 0x0F, 0x10, 0x10, 0x10, 0x11, 0x11, 0x12, 0x13, 0x13, 0x00, 0x01, 0x01, 0x06, 0x0B, 0x0B, 0x0C, 0x10, 0x10,
+    0x11, 0x11, 0x14, 0x14, 0x18, 0x19, 0x19, 0x00, 0x02, 0x02, 0x02, 0x02, 0x05, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x0F,
+    0x0F, 0x13, 0x19, 0x19, 0x00, 0x01, 0x01, 0x05, 0x07, 0x07, 0x0D, 0x12, 0x12, 0x17, 0x18, 0x18, 0x18, 0x1A, 0x1A,
+    0x23, 0x00, 0x00, 0x00, 0x0B, 0x15, 0x15, 0x1D, 0x21, 0x21, 0x22, 0x22, 0x23, 0x23, 0x27, 0x27, 0x2C, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x06, 0x07, 0x07, 0x07, 0x09, 0x0E, 0x0E, 0x10, 0x00, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x0C, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x18, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x14, 0x17, 0x17, 0x17, 0x1A, 0x1B, 0x1B, 0x1C, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x09, 0x0D, 0x0D, 0x0E, 0x0E,
+    0x0E, 0x19, 0x21, 0x21, 0x26, 0x00, 0x01, 0x01, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x09, 0x0A, 0x00, 0x00, 0x03, 0x06, 0x06, 0x06, 0x07, 0x07, 0x0A, 0x0B, 0x0B, 0x0F, 0x12, 0x12, 0x13, 0x14, 0x00,
+    0x02, 0x04, 0x04, 0x08, 0x09, 0x09, 0x0C, 0x0D, 0x0D, 0x0F, 0x11, 0x11, 0x13, 0x15, 0x15, 0x00, 0x00, 0x02, 0x02,
+    0x02, 0x02, 0x06, 0x07, 0x07, 0x09, 0x0D, 0x0D, 0x0E, 0x0E, 0x10, 0x11, 0x00, 0x05, 0x08, 0x08, 0x09, 0x0A, 0x0A,
+    0x0F, 0x15, 0x15, 0x1C, 0x22, 0x22, 0x27, 0x2E, 0x2E, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x07, 0x08, 0x08, 0x08,
+    0x09, 0x0C, 0x0C, 0x10, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x09, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x00, 0x01, 0x01, 0x01, 0x01, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x10,
+    0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x06, 0x06, 0x08, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x04, 0x05, 0x05, 0x05, 0x05, 0x08, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x01, 0x03, 0x08, 0x08, 0x08, 0x0C, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x12, 0x17, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0D,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x08, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x06, 0x06, 0x06, 0x08, 0x09,
+    0x09, 0x09, 0x00, 0x00, 0x03, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0C, 0x0C, 0x0D, 0x00, 0x00, 0x03,
+    0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0B, 0x0D, 0x00, 0x06, 0x0A, 0x0A, 0x0B, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05,
+    0x05, 0x06, 0x06, 0x06, 0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x05, 0x07, 0x07, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x0E, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x09, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x06, 0x08, 0x08, 0x09, 0x0A, 0x0A,
+    0x0C, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x05, 0x05, 0x07, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0B, 0x0B, 0x00, 0x00, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x0B, 0x00, 0x00, 0x02, 0x03, 0x03, 0x07, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x08, 0x0A,
+    0x0A, 0x0C, 0x0E, 0x00, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x0A, 0x0B, 0x0B, 0x0F, 0x12, 0x12, 0x16, 0x17, 0x17,
+    0x00, 0x05, 0x05, 0x05, 0x05, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x00, 0x01, 0x02, 0x05, 0x06, 0x08,
+    0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0E, 0x0F, 0x11, 0x12, 0x16, 0x17, 0x18, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x09, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0B, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x07, 0x07, 0x08, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06,
+    0x08, 0x09, 0x0B, 0x0B, 0x0D, 0x0E, 0x0F, 0x0F, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x0A,
+    0x0B, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x01, 0x03,
+    0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05,
+    0x06, 0x08, 0x09, 0x09, 0x09, 0x0C, 0x0C, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x02, 0x04, 0x06, 0x07, 0x08, 0x0A, 0x0C,
+    0x0D, 0x0F, 0x11, 0x13, 0x15, 0x15, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07,
+    0x07, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07,
+    0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x04, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x01, 0x03, 0x04, 0x06, 0x06, 0x09, 0x0B,
+    0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x05, 0x07, 0x08, 0x0A, 0x0D, 0x00, 0x03,
+    0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x10, 0x10, 0x11, 0x11, 0x12, 0x13, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04,
+    0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x0A, 0x00, 0x02, 0x02, 0x02, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x02, 0x04, 0x06, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0D, 0x0D,
+    0x0E, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x00,
+    0x02, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x11, 0x11, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x05, 0x07, 0x08, 0x08, 0x09, 0x0B, 0x0C, 0x0E, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0F, 0x00, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x07, 0x08, 0x09,
+    0x09, 0x0A, 0x0B, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x09,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x05, 0x08, 0x08, 0x0B, 0x0D, 0x0E, 0x10, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x04, 0x06, 0x08, 0x08, 0x08, 0x0A, 0x0C, 0x00, 0x00, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07,
+    0x08, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A,
+    0x0B, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05,
+    0x06, 0x06, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0E, 0x10, 0x11, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x07, 0x08, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x08,
+    0x09, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09, 0x09,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x0A, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x09, 0x00, 0x02, 0x03, 0x04, 0x05, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x00, 0x02, 0x03, 0x04, 0x06, 0x06, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x07, 0x07,
+    0x08, 0x00, 0x03, 0x03, 0x03, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x0B, 0x0B, 0x0C, 0x0C, 0x00, 0x00,
+    0x01, 0x02, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x09, 0x0B, 0x0E, 0x11, 0x12, 0x00, 0x00, 0x01, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x08,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x00, 0x00, 0x00, 0x02, 0x02, 0x03, 0x05, 0x05, 0x06, 0x06, 0x06,
+    0x07, 0x07, 0x09, 0x0A, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x04, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x00,
+    0x00, 0x02, 0x03, 0x05, 0x06, 0x06, 0x07, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06,
+    0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x08,
+    0x08, 0x08, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0F,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x02, 0x04,
+    0x04, 0x05, 0x05, 0x07, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0B,
+    0x0C, 0x0C, 0x0C, 0x0D, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x08,
+    0x09, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x07, 0x07, 0x08, 0x09, 0x0B, 0x0B, 0x0C, 0x0E, 0x10, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0E, 0x00, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x04, 0x00, 0x02, 0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00,
+    0x01, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x00, 0x01, 0x03, 0x04,
+    0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x07, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x07, 0x09, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0C, 0x0E,
+    0x00, 0x02, 0x03, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x0A, 0x0A, 0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x00, 0x01, 0x03,
+    0x03, 0x04, 0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0F, 0x10, 0x12, 0x14, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D,
+    0x0D, 0x00, 0x02, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x03, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x03, 0x04, 0x05,
+    0x06, 0x08, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x12, 0x13, 0x00, 0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0D,
+    0x0F, 0x10, 0x10, 0x12, 0x14, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0F, 0x00, 0x02, 0x02, 0x04, 0x05, 0x05, 0x07, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00,
+    0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x15, 0x00, 0x01, 0x03, 0x05,
+    0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x12, 0x12, 0x12, 0x00, 0x01, 0x02, 0x02, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0F, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x10,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x02,
+    0x04, 0x04, 0x05, 0x06, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x0E, 0x00, 0x03, 0x05, 0x07, 0x0A, 0x0B,
+    0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04,
+    0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x00, 0x00, 0x02, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07,
+    0x08, 0x09, 0x09, 0x09, 0x00, 0x01, 0x01, 0x04, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0E, 0x0E, 0x11, 0x11, 0x12,
+    0x12, 0x00, 0x01, 0x02, 0x04, 0x06, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07,
+    0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x05, 0x06,
+    0x07, 0x09, 0x0A, 0x0C, 0x0E, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0E, 0x0F, 0x0F, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x06, 0x06, 0x06, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x03, 0x04,
+    0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x08, 0x0A,
+    0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x02, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07,
+    0x07, 0x08, 0x08, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04,
+    0x04, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06,
+    0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07,
+    0x08, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0B,
+    0x0B, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01,
+    0x01, 0x03, 0x05, 0x08, 0x08, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x00, 0x02, 0x03, 0x05, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x06, 0x08,
+    0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0B, 0x0B, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04,
+    0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x00, 0x00, 0x02, 0x02, 0x02, 0x04, 0x04, 0x05,
+    0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x08,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x06, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x0A, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02,
+    0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x16, 0x17, 0x1A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x00, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0F, 0x10,
+    0x11, 0x14, 0x16, 0x18, 0x1A, 0x1A, 0x1D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x07, 0x0C, 0x10, 0x11, 0x12, 0x13, 0x16, 0x17, 0x18, 0x18, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0F, 0x11, 0x11, 0x12, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x06, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x16, 0x17, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x09,
+    0x09, 0x0A, 0x0F, 0x11, 0x12, 0x13, 0x15, 0x16, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x07, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x11,
+    0x12, 0x13, 0x00, 0x01, 0x03, 0x03, 0x06, 0x07, 0x09, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x1A, 0x00,
+    0x01, 0x02, 0x04, 0x05, 0x07, 0x08, 0x0C, 0x0E, 0x13, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x07, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x12, 0x13, 0x14, 0x15, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08,
+    0x09, 0x0C, 0x0E, 0x10, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x06, 0x08, 0x0B, 0x0C, 0x0F, 0x10, 0x14, 0x19, 0x1F, 0x20,
+    0x23, 0x24, 0x2C, 0x00, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0D, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x13, 0x14, 0x17, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x11, 0x14, 0x15, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x04, 0x05, 0x05, 0x08, 0x0A, 0x0A, 0x0D, 0x0E, 0x11, 0x13,
+    0x14, 0x18, 0x1A, 0x1B, 0x00, 0x01, 0x02, 0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0F, 0x11, 0x12, 0x16, 0x17, 0x18,
+    0x19, 0x00, 0x01, 0x04, 0x05, 0x08, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x15, 0x16, 0x17, 0x18, 0x00, 0x01,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x05, 0x06,
+    0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0B, 0x0C, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x03, 0x04, 0x05, 0x05, 0x0A, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x13, 0x13,
+    0x14, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x10, 0x12, 0x13, 0x14, 0x16, 0x17, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x03, 0x04,
+    0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x17, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x00, 0x02, 0x03, 0x04, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14,
+    0x00, 0x03, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x10, 0x00, 0x03, 0x05, 0x05, 0x07, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0F, 0x11, 0x15, 0x17, 0x00, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x10, 0x12, 0x13, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x0F, 0x10, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0C, 0x0D, 0x0F, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F,
+    0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00,
+    0x01, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x12, 0x14, 0x15, 0x16, 0x17, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x14, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0B,
+    0x0D, 0x0E, 0x10, 0x12, 0x14, 0x15, 0x00, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x10, 0x13, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x00, 0x01, 0x02, 0x03, 0x06, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x14, 0x15,
+    0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x17, 0x00, 0x01, 0x02, 0x02, 0x03, 0x05,
+    0x06, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x15, 0x00, 0x01, 0x03, 0x04, 0x06, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x12, 0x13, 0x14, 0x15, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x11, 0x00, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x13, 0x00, 0x02,
+    0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x04, 0x05,
+    0x06, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x16, 0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0x08, 0x09,
+    0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0E, 0x10, 0x11, 0x12, 0x00, 0x02, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x12,
+    0x14, 0x16, 0x00, 0x02, 0x05, 0x06, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x13, 0x14, 0x18, 0x00,
+    0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x14, 0x15, 0x1B, 0x00, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x16, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0B, 0x0C, 0x0E,
+    0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x0A, 0x0B, 0x0F, 0x11, 0x12, 0x13,
+    0x14, 0x16, 0x17, 0x00, 0x02, 0x06, 0x07, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x12, 0x14, 0x15, 0x16, 0x19,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0F, 0x11, 0x13, 0x14, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x13, 0x16, 0x18, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11,
+    0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x02,
+    0x04, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x0F, 0x12, 0x13, 0x17, 0x19, 0x00, 0x01, 0x01, 0x03, 0x04,
+    0x05, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x11, 0x15, 0x16, 0x00, 0x02, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C,
+    0x0C, 0x0F, 0x10, 0x10, 0x13, 0x00, 0x04, 0x07, 0x0A, 0x0C, 0x0C, 0x15, 0x1A, 0x1A, 0x1E, 0x1F, 0x21, 0x22, 0x23,
+    0x23, 0x27, 0x00, 0x01, 0x03, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00,
+    0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04,
+    0x05, 0x08, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x11, 0x17, 0x1E, 0x21, 0x26, 0x2B,
+    0x2F, 0x30, 0x30, 0x00, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x14,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x04, 0x06, 0x08, 0x09, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x06, 0x07, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x12,
+    0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x00, 0x03, 0x03, 0x05, 0x08, 0x0B, 0x0C, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x11, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x03, 0x04, 0x05, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x00, 0x01, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x0A, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09,
+    0x09, 0x0A, 0x0A, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0x07, 0x07,
+    0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05,
+    0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04,
+    0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x08, 0x08, 0x09, 0x09, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06,
+    0x07, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x01, 0x01, 0x01, 0x02, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05,
+    0x05, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05,
+    0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x04, 0x05, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x03, 0x03, 0x05, 0x06, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x02, 0x03, 0x03, 0x04, 0x06, 0x08, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x04, 0x06, 0x06, 0x08, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x04, 0x05, 0x06,
+    0x06, 0x06, 0x08, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x06, 0x07,
+    0x07, 0x07, 0x07, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x00, 0x02, 0x04, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x05, 0x05,
+    0x05, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x00,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0E,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x08, 0x09, 0x0D, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x00, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x00, 0x02, 0x03, 0x03, 0x05,
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x00, 0x01, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B,
+    0x0C, 0x0C, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00,
+    0x03, 0x04, 0x06, 0x08, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x15, 0x17, 0x18, 0x19, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x02, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03,
+    0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x10, 0x00, 0x03, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+};
+
+constexpr uint16_t ru_fail[] = {
+    0, 0, 0, 0, 0, 1, 3, 4, 3, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 109,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+    126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173,
+    174, 1, 109, 110, 1, 111, 1, 113, 114, 1, 115, 1, 117, 1, 119, 1,
+    1, 123, 1, 125, 126, 1, 1, 1, 131, 132, 1, 133, 134, 1, 135, 136,
+    1, 137, 138, 1, 139, 140, 1, 141, 142, 1, 143, 144, 1, 145, 1, 147,
+    148, 1, 1, 151, 1, 1, 155, 156, 1, 1, 1, 1, 1, 1, 1, 170,
+    1, 1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 10,
+    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+    319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+    335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+    351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366,
+    367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382,
+    383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398,
+    399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414,
+    415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430,
+    431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+    447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462,
+    463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+    479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494,
+    495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+    511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526,
+    527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542,
+    543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558,
+    559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574,
+    575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590,
+    591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606,
+    607, 608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622,
+    623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638,
+    639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654,
+    655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670,
+    671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686,
+    687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702,
+    703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+    719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+    735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750,
+    751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766,
+    767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782,
+    783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798,
+    799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814,
+    815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830,
+    831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846,
+    847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862,
+    863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878,
+    879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894,
+    895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910,
+    911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926,
+    927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942,
+    943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974,
+    975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+    991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+    1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+    1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+    1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+    1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+    1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+    1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102,
+    1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+    1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+    1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+    1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+    1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
+    1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+    1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
+    1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230,
+    1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+    1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262,
+    1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278,
+    1279, 1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+    1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310,
+    1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+    1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342,
+    1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+    1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374,
+    1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390,
+    1391, 1392, 1393, 1394, 307, 309, 310, 314, 316, 317, 322, 323, 325, 347, 353, 386,
+    389, 419, 443, 446, 452, 486, 537, 573, 577, 578, 580, 584, 587, 674, 697, 699,
+    707, 710, 716, 721, 735, 740, 749, 754, 769, 770, 771, 775, 785, 786, 801, 815,
+    817, 834, 839, 842, 848, 866, 872, 877, 881, 885, 886, 905, 908, 934, 937, 938,
+    940, 943, 945, 947, 948, 949, 950, 951, 963, 965, 1013, 1070, 1097, 1313, 1, 109,
+    110, 1, 111, 112, 1, 113, 114, 1, 115, 116, 1, 117, 118, 1, 119, 120,
+    1, 1, 123, 124, 1, 125, 126, 1, 1, 129, 130, 1, 131, 132, 1, 133,
+    134, 1, 135, 136, 1, 137, 138, 1, 139, 140, 1, 141, 142, 1, 143, 144,
+    1, 145, 146, 1, 147, 148, 1, 149, 1, 151, 152, 1, 1, 155, 156, 1,
+    157, 1, 1, 1, 1, 1, 167, 168, 1, 170, 1, 171, 1, 1, 109, 110,
+    1, 1, 114, 1, 1, 1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 1,
+    131, 132, 1, 1, 1, 137, 138, 1, 1, 2, 141, 142, 1, 143, 1, 1,
+    147, 148, 1, 1, 1, 1, 1, 1, 1, 2, 1, 163, 164, 1, 2, 166,
+    1, 168, 1, 170, 1, 1, 173, 1, 109, 110, 1, 1, 113, 114, 1, 1,
+    117, 1, 119, 120, 1, 1, 123, 124, 1, 125, 126, 1, 1, 129, 130, 1,
+    131, 132, 1, 133, 134, 1, 135, 136, 1, 137, 138, 1, 1, 2, 141, 142,
+    1, 143, 144, 1, 145, 1, 147, 148, 1, 1, 151, 1, 1, 1, 157, 1,
+    1, 2, 1, 163, 164, 1, 2, 165, 166, 1, 1, 1, 1, 173, 174, 1,
+    109, 110, 1, 111, 1, 113, 1, 1, 117, 1, 2, 119, 1, 1, 1, 125,
+    126, 1, 1, 1, 131, 132, 1, 1, 135, 136, 1, 137, 138, 1, 1, 2,
+    141, 142, 1, 143, 144, 1, 1, 147, 148, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 109, 110, 1, 1, 113, 114, 1, 1,
+    1, 119, 120, 1, 2, 121, 122, 1, 1, 125, 126, 1, 1, 1, 131, 1,
+    1, 135, 136, 1, 137, 138, 1, 1, 2, 141, 142, 1, 143, 1, 1, 147,
+    148, 1, 1, 1, 153, 154, 1, 1, 1, 1, 2, 161, 162, 1, 163, 164,
+    1, 2, 165, 166, 1, 1, 1, 1, 1, 109, 110, 1, 111, 112, 1, 113,
+    114, 1, 115, 116, 1, 117, 118, 1, 119, 120, 1, 121, 122, 1, 123, 124,
+    1, 125, 126, 1, 1, 129, 130, 1, 131, 132, 1, 133, 134, 1, 135, 136,
+    1, 137, 138, 1, 139, 140, 1, 141, 142, 1, 143, 144, 1, 145, 146, 1,
+    147, 1, 149, 150, 1, 151, 152, 1, 153, 1, 155, 1, 157, 1, 1, 1,
+    1, 1, 1, 169, 1, 171, 1, 1, 109, 110, 1, 1, 1, 115, 116, 1,
+    117, 118, 1, 119, 120, 1, 121, 122, 1, 1, 125, 126, 1, 1, 1, 1,
+    133, 1, 135, 1, 137, 138, 1, 139, 1, 142, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 1, 1, 2, 166, 1, 1, 1, 1, 173, 174, 1,
+    109, 110, 1, 1, 113, 114, 1, 115, 1, 117, 1, 119, 1, 1, 1, 2,
+    125, 126, 1, 1, 129, 1, 131, 132, 1, 133, 1, 135, 136, 1, 137, 138,
+    1, 1, 141, 142, 1, 1, 145, 1, 2, 147, 148, 1, 1, 1, 1, 1,
+    1, 1, 2, 161, 162, 1, 163, 164, 1, 2, 165, 166, 1, 1, 1, 1,
+    1, 109, 110, 1, 112, 1, 113, 114, 1, 115, 116, 1, 117, 118, 1, 119,
+    120, 1, 121, 1, 123, 124, 1, 1, 128, 1, 129, 130, 1, 131, 132, 1,
+    133, 134, 1, 135, 136, 1, 137, 138, 1, 139, 1, 141, 142, 1, 143, 144,
+    1, 145, 146, 1, 147, 1, 149, 150, 1, 151, 152, 1, 1, 1, 157, 158,
+    1, 1, 1, 1, 1, 1, 169, 170, 1, 171, 1, 1, 1, 1, 1, 1,
+    117, 1, 1, 1, 1, 1, 1, 130, 1, 1, 1, 135, 1, 138, 1, 139,
+    1, 1, 143, 144, 1, 145, 1, 1, 1, 151, 152, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 109, 110, 1, 1, 113, 114, 1, 1, 117,
+    1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 130, 1, 131, 132, 1, 1,
+    135, 136, 1, 137, 138, 1, 1, 2, 141, 142, 1, 143, 144, 1, 145, 146,
+    1, 147, 148, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+    1, 1, 2, 109, 110, 1, 112, 1, 113, 114, 1, 115, 1, 1, 2, 119,
+    120, 1, 1, 123, 1, 125, 126, 1, 1, 129, 1, 132, 1, 1, 135, 1,
+    137, 138, 1, 1, 1, 143, 1, 1, 2, 147, 148, 1, 1, 151, 1, 1,
+    1, 1, 1, 2, 1, 2, 163, 164, 1, 2, 165, 166, 1, 1, 2, 169,
+    170, 1, 2, 171, 172, 1, 173, 174, 1, 109, 110, 1, 111, 1, 1, 115,
+    1, 1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 129, 1, 131, 1, 1,
+    135, 136, 1, 137, 138, 1, 139, 1, 141, 142, 1, 143, 144, 1, 1, 148,
+    1, 149, 1, 1, 1, 155, 1, 1, 159, 160, 1, 2, 1, 163, 164, 1,
+    2, 166, 1, 168, 1, 1, 172, 1, 1, 109, 110, 1, 1, 1, 115, 116,
+    1, 117, 118, 1, 2, 119, 120, 1, 1, 123, 1, 125, 126, 1, 1, 129,
+    130, 1, 1, 1, 135, 1, 137, 138, 1, 1, 141, 1, 143, 144, 1, 145,
+    146, 1, 148, 1, 1, 151, 1, 1, 155, 1, 158, 1, 1, 2, 1, 2,
+    1, 2, 165, 166, 1, 1, 170, 1, 171, 1, 173, 1, 109, 1, 111, 112,
+    1, 113, 114, 1, 115, 116, 1, 117, 118, 1, 119, 120, 1, 121, 1, 123,
+    124, 1, 125, 126, 1, 128, 1, 129, 130, 1, 131, 132, 1, 133, 134, 1,
+    135, 136, 1, 137, 138, 1, 139, 140, 1, 141, 142, 1, 143, 144, 1, 145,
+    146, 1, 147, 148, 1, 149, 150, 1, 151, 152, 1, 153, 1, 155, 156, 1,
+    157, 158, 1, 1, 1, 1, 1, 168, 1, 1, 171, 172, 1, 173, 1, 109,
+    110, 1, 1, 1, 1, 1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 1,
+    2, 131, 132, 1, 1, 135, 136, 1, 137, 138, 1, 139, 1, 2, 141, 142,
+    1, 143, 1, 145, 146, 1, 147, 148, 1, 1, 1, 1, 1, 1, 1, 2,
+    1, 1, 2, 166, 1, 168, 1, 1, 1, 174, 1, 2, 109, 110, 1, 111,
+    1, 113, 114, 1, 115, 116, 1, 117, 118, 1, 2, 119, 120, 1, 121, 1,
+    123, 1, 125, 126, 1, 1, 129, 130, 1, 132, 1, 134, 1, 135, 1, 2,
+    137, 138, 1, 139, 1, 1, 143, 144, 1, 145, 146, 1, 2, 147, 148, 1,
+    149, 1, 151, 152, 1, 153, 1, 155, 1, 157, 158, 1, 1, 2, 1, 2,
+    163, 164, 1, 2, 165, 166, 1, 167, 1, 2, 170, 1, 171, 172, 1, 173,
+    174, 1, 109, 110, 1, 111, 112, 1, 113, 1, 115, 1, 117, 118, 1, 119,
+    120, 1, 1, 1, 125, 126, 1, 1, 2, 129, 130, 1, 131, 132, 1, 133,
+    134, 1, 135, 136, 1, 137, 138, 1, 139, 140, 1, 2, 141, 1, 143, 144,
+    1, 2, 145, 146, 1, 147, 148, 1, 149, 1, 151, 1, 153, 1, 155, 156,
+    1, 157, 1, 1, 2, 161, 1, 163, 164, 1, 2, 165, 166, 1, 168, 1,
+    170, 1, 171, 172, 1, 173, 174, 1, 109, 110, 1, 1, 2, 113, 114, 1,
+    1, 1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 129, 130, 1, 131, 132,
+    1, 133, 134, 1, 1, 137, 138, 1, 139, 1, 2, 141, 142, 1, 143, 1,
+    145, 1, 147, 148, 1, 1, 1, 1, 1, 1, 1, 2, 1, 163, 164, 1,
+    2, 165, 166, 1, 1, 170, 1, 171, 172, 1, 173, 174, 1, 109, 110, 1,
+    111, 112, 1, 113, 114, 1, 115, 116, 1, 117, 118, 1, 119, 120, 1, 121,
+    1, 123, 1, 1, 1, 129, 130, 1, 131, 132, 1, 134, 1, 135, 136, 1,
+    137, 138, 1, 139, 140, 1, 141, 142, 1, 143, 144, 1, 145, 146, 1, 147,
+    148, 1, 149, 150, 1, 151, 152, 1, 1, 155, 156, 1, 157, 158, 1, 1,
+    1, 1, 1, 1, 1, 171, 1, 1, 109, 110, 1, 1, 1, 1, 1, 119,
+    120, 1, 1, 1, 125, 126, 1, 1, 1, 131, 1, 1, 1, 137, 138, 1,
+    1, 141, 142, 1, 1, 145, 1, 147, 148, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 2, 1, 1, 1, 1, 1, 109, 110, 1, 1, 113, 114, 1,
+    1, 1, 119, 1, 1, 1, 125, 126, 1, 1, 1, 131, 132, 1, 134, 1,
+    136, 1, 137, 138, 1, 1, 141, 142, 1, 1, 1, 2, 147, 148, 1, 1,
+    1, 1, 1, 1, 1, 2, 1, 1, 166, 1, 1, 1, 1, 1, 2, 109,
+    110, 1, 1, 113, 114, 1, 1, 1, 119, 120, 1, 1, 1, 125, 126, 1,
+    1, 1, 1, 1, 1, 137, 138, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 2, 1, 163, 1, 1, 1, 1, 1, 1, 109, 110, 1, 1,
+    1, 1, 1, 119, 120, 1, 121, 1, 1, 125, 126, 1, 1, 1, 131, 1,
+    133, 1, 1, 1, 1, 1, 1, 145, 146, 1, 147, 1, 1, 1, 1, 1,
+    1, 1, 2, 1, 1, 2, 165, 166, 1, 1, 1, 1, 174, 1, 109, 110,
+    1, 1, 113, 1, 1, 1, 119, 120, 1, 1, 1, 125, 126, 1, 1, 129,
+    1, 131, 132, 1, 134, 1, 135, 136, 1, 1, 140, 1, 1, 1, 145, 146,
+    1, 147, 148, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 165, 166,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 119, 120, 1, 1, 1, 125,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    119, 120, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 171, 1, 174, 1,
+    1, 111, 1, 1, 115, 1, 117, 118, 1, 1, 121, 1, 123, 1, 125, 1,
+    1, 129, 130, 1, 132, 1, 134, 1, 135, 1, 1, 139, 1, 141, 142, 1,
+    143, 144, 1, 145, 146, 1, 1, 1, 1, 1, 1, 157, 158, 1, 1, 1,
+    1, 1, 1, 1, 171, 1, 1, 1, 111, 1, 114, 1, 1, 118, 1, 119,
+    120, 1, 1, 123, 1, 1, 1, 129, 1, 1, 133, 1, 135, 1, 1, 139,
+    140, 1, 1, 143, 144, 1, 145, 146, 1, 1, 1, 151, 1, 1, 1, 1,
+    159, 160, 1, 1, 1, 1, 1, 1, 171, 1, 173, 1, 1, 1, 114, 1,
+    1, 118, 1, 1, 1, 1, 1, 1, 129, 130, 1, 131, 1, 133, 1, 136,
+    1, 137, 1, 139, 1, 141, 142, 1, 143, 144, 1, 145, 146, 1, 1, 1,
+    151, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 111, 112,
+    1, 1, 1, 118, 1, 1, 1, 123, 1, 125, 1, 1, 129, 1, 131, 132,
+    1, 134, 1, 136, 1, 1, 1, 141, 142, 1, 143, 144, 1, 145, 146, 1,
+    1, 1, 151, 1, 1, 1, 1, 160, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 112, 1, 113, 114, 1, 115, 1, 117, 118, 1, 1, 1, 123, 1, 1,
+    1, 129, 130, 1, 132, 1, 133, 134, 1, 135, 136, 1, 1, 1, 141, 142,
+    1, 143, 144, 1, 145, 146, 1, 1, 1, 151, 152, 1, 153, 1, 1, 157,
+    1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 112, 1, 113, 114, 1,
+    1, 118, 1, 1, 121, 1, 123, 1, 1, 1, 129, 130, 1, 131, 132, 1,
+    134, 1, 135, 136, 1, 1, 139, 140, 1, 141, 142, 1, 143, 144, 1, 145,
+    146, 1, 1, 1, 151, 152, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2563, 2569, 2571, 2586, 2589, 2604, 2607, 2651, 2661, 2729, 2738, 2796, 2833, 2841, 2852,
+    2853, 2932, 3024, 3098, 3108, 3115, 3126, 3279, 3280, 3328, 3346, 3351, 3363, 3375, 3401, 3402,
+    3413, 3414, 3431, 147, 3470, 3471, 3473, 3476, 3516, 3519, 3520, 3551, 3576, 3582, 3613, 3627,
+    3635, 3648, 3649, 3695, 3711, 3733, 3749, 3794, 3799, 3873, 3883, 3894, 3901, 4003, 4084, 4124,
+    321, 322, 328, 344, 350, 355, 358, 374, 377, 379, 380, 386, 388, 389, 390, 391,
+    393, 395, 404, 405, 409, 413, 416, 419, 424, 440, 444, 446, 449, 452, 454, 457,
+    460, 465, 474, 475, 482, 486, 487, 488, 537, 539, 540, 541, 551, 553, 573, 591,
+    638, 646, 647, 650, 652, 653, 669, 674, 677, 683, 688, 696, 697, 699, 701, 702,
+    703, 707, 710, 715, 716, 725, 734, 735, 739, 749, 751, 752, 754, 763, 772, 778,
+    784, 785, 812, 815, 817, 834, 835, 836, 837, 839, 840, 842, 848, 852, 853, 855,
+    861, 864, 865, 866, 877, 879, 880, 884, 885, 891, 895, 900, 902, 905, 908, 914,
+    916, 919, 921, 927, 928, 930, 931, 934, 937, 944, 951, 954, 956, 962, 977, 999,
+    1011, 1016, 1065, 1076, 1083, 1109, 1274, 1279, 1314, 1330, 1331, 1336, 307, 309, 310, 313,
+    317, 320, 323, 324, 399, 473, 474, 475, 476, 478, 488, 493, 496, 570, 571, 576,
+    580, 581, 583, 584, 588, 591, 669, 674, 688, 696, 697, 699, 700, 701, 769, 770,
+    771, 772, 775, 779, 780, 781, 784, 785, 786, 799, 834, 839, 842, 848, 851, 853,
+    862, 864, 865, 866, 877, 878, 936, 943, 950, 1200, 1214, 1247, 1248, 1279, 1314, 1366,
+    307, 309, 310, 312, 313, 319, 323, 324, 327, 328, 337, 380, 388, 452, 473, 474,
+    475, 476, 478, 480, 486, 487, 488, 489, 493, 501, 502, 503, 540, 541, 551, 563,
+    570, 573, 577, 583, 584, 587, 589, 590, 647, 655, 669, 674, 677, 699, 700, 701,
+    707, 734, 735, 740, 749, 754, 762, 767, 769, 770, 772, 773, 774, 776, 778, 780,
+    783, 784, 785, 786, 789, 798, 834, 839, 842, 848, 861, 864, 865, 866, 872, 877,
+    882, 897, 899, 914, 933, 936, 940, 941, 943, 948, 950, 954, 956, 1013, 1106, 1198,
+    1200, 1204, 1212, 1215, 1218, 1221, 1235, 1238, 1247, 1248, 1260, 1261, 1262, 1366, 1369, 1378,
+    1379, 313, 323, 325, 339, 380, 438, 446, 472, 484, 485, 571, 573, 587, 669, 674,
+    677, 683, 688, 696, 700, 701, 735, 740, 743, 749, 766, 767, 769, 770, 774, 775,
+    776, 777, 779, 780, 785, 786, 787, 791, 798, 834, 839, 842, 848, 853, 861, 864,
+    865, 867, 868, 885, 935, 950, 307, 309, 313, 320, 323, 324, 377, 380, 382, 383,
+    386, 403, 404, 472, 473, 478, 479, 481, 483, 485, 486, 487, 488, 492, 504, 516,
+    521, 570, 584, 585, 587, 589, 590, 591, 674, 735, 740, 749, 762, 766, 769, 770,
+    772, 774, 775, 776, 778, 779, 780, 783, 784, 785, 786, 789, 792, 793, 834, 839,
+    842, 848, 853, 861, 865, 866, 877, 934, 936, 937, 947, 948, 950, 951, 954, 956,
+    962, 1037, 1051, 1059, 1169, 1196, 1200, 1201, 1209, 1214, 1215, 1222, 1235, 1240, 1248, 1260,
+    1261, 1262, 310, 313, 319, 324, 339, 355, 377, 380, 384, 385, 386, 388, 390, 391,
+    393, 400, 404, 405, 409, 416, 418, 421, 440, 444, 449, 451, 452, 454, 457, 465,
+    473, 474, 488, 492, 507, 508, 509, 520, 536, 537, 539, 541, 542, 544, 545, 551,
+    553, 556, 568, 569, 573, 574, 582, 584, 587, 636, 643, 644, 650, 652, 653, 655,
+    669, 674, 688, 696, 699, 700, 701, 710, 716, 721, 725, 729, 730, 735, 739, 751,
+    752, 759, 764, 769, 771, 772, 774, 776, 778, 779, 780, 781, 783, 784, 785, 786,
+    791, 793, 801, 806, 809, 812, 814, 815, 818, 819, 833, 834, 836, 839, 842, 848,
+    851, 853, 861, 864, 865, 866, 867, 868, 870, 877, 878, 879, 881, 882, 885, 890,
+    900, 902, 905, 908, 914, 916, 919, 927, 928, 930, 931, 934, 940, 943, 974, 977,
+    982, 999, 1001, 1010, 1013, 1015, 1018, 1034, 1076, 1109, 1299, 1336, 307, 313, 324, 405,
+    413, 416, 424, 438, 443, 446, 449, 452, 457, 466, 469, 473, 475, 481, 485, 486,
+    488, 504, 509, 536, 584, 586, 702, 716, 749, 769, 786, 787, 815, 853, 1247, 1248,
+    1364, 1379, 306, 307, 308, 309, 310, 311, 312, 313, 314, 316, 318, 319, 320, 321,
+    322, 323, 324, 325, 327, 329, 330, 336, 337, 372, 377, 380, 382, 383, 386, 388,
+    391, 400, 404, 405, 416, 418, 440, 443, 452, 472, 476, 485, 579, 583, 584, 587,
+    588, 589, 593, 650, 669, 683, 699, 715, 735, 740, 743, 749, 754, 762, 767, 769,
+    770, 771, 772, 773, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786,
+    789, 792, 797, 798, 834, 839, 842, 848, 853, 864, 865, 908, 934, 935, 936, 938,
+    940, 943, 945, 948, 949, 951, 956, 965, 1169, 1196, 1200, 1204, 1209, 1214, 1222, 1235,
+    1238, 1260, 1261, 307, 308, 309, 310, 313, 318, 319, 320, 321, 323, 324, 326, 327,
+    328, 355, 372, 377, 379, 380, 386, 388, 389, 391, 393, 399, 404, 409, 410, 416,
+    418, 421, 440, 443, 444, 446, 454, 466, 473, 474, 475, 478, 484, 485, 486, 487,
+    508, 539, 540, 541, 550, 551, 553, 620, 636, 638, 647, 650, 652, 653, 655, 669,
+    680, 683, 684, 688, 697, 702, 707, 710, 716, 717, 718, 725, 739, 741, 749, 752,
+    755, 761, 769, 770, 771, 772, 775, 778, 779, 781, 783, 784, 785, 786, 787, 789,
+    792, 801, 812, 814, 815, 834, 836, 840, 842, 848, 850, 867, 868, 871, 877, 878,
+    879, 880, 881, 882, 884, 885, 895, 900, 902, 912, 916, 919, 928, 948, 977, 982,
+    999, 1010, 1013, 1015, 1018, 1109, 1116, 1307, 1309, 1314, 1333, 440, 664, 749, 785, 786,
+    812, 868, 877, 879, 880, 887, 891, 912, 1011, 1016, 307, 308, 310, 311, 313, 315,
+    317, 318, 319, 321, 322, 323, 324, 327, 330, 336, 338, 372, 380, 386, 391, 438,
+    471, 474, 475, 488, 572, 584, 585, 587, 588, 653, 669, 674, 677, 683, 688, 696,
+    697, 699, 700, 701, 743, 749, 766, 769, 770, 772, 775, 779, 780, 781, 783, 784,
+    785, 786, 788, 789, 792, 839, 842, 848, 853, 865, 867, 869, 870, 871, 875, 877,
+    879, 881, 885, 886, 900, 914, 916, 935, 938, 942, 944, 945, 948, 949, 950, 951,
+    956, 963, 965, 307, 309, 310, 311, 312, 313, 316, 318, 319, 323, 324, 325, 326,
+    327, 337, 355, 377, 380, 386, 391, 405, 416, 419, 473, 474, 475, 478, 481, 483,
+    484, 485, 488, 489, 492, 551, 570, 572, 573, 575, 580, 582, 584, 585, 587, 588,
+    589, 591, 638, 647, 697, 699, 743, 769, 770, 771, 772, 773, 775, 778, 783, 784,
+    785, 786, 792, 800, 868, 934, 935, 936, 937, 938, 940, 943, 946, 947, 948, 950,
+    951, 963, 965, 1001, 1202, 1203, 1206, 1209, 1218, 1234, 1235, 1238, 1240, 1242, 1243, 1244,
+    1247, 1248, 1252, 1253, 1255, 1260, 1261, 1262, 1302, 1313, 1314, 1331, 1333, 1341, 1345, 1350,
+    1366, 1369, 1372, 1375, 1379, 1383, 308, 309, 310, 313, 316, 317, 319, 323, 324, 325,
+    326, 329, 347, 350, 416, 471, 475, 476, 477, 478, 488, 489, 494, 573, 577, 580,
+    584, 587, 649, 674, 735, 740, 749, 754, 762, 767, 769, 770, 772, 774, 775, 776,
+    778, 780, 781, 783, 784, 785, 786, 788, 812, 834, 842, 848, 861, 877, 880, 881,
+    885, 950, 951, 974, 1065, 1073, 1136, 1163, 1209, 1214, 1247, 1260, 1279, 1345, 1346, 307,
+    308, 309, 312, 313, 314, 316, 318, 321, 322, 323, 324, 326, 327, 329, 330, 331,
+    335, 337, 407, 413, 416, 419, 421, 438, 440, 443, 444, 445, 449, 454, 455, 460,
+    472, 473, 474, 475, 476, 477, 478, 479, 481, 483, 485, 486, 487, 488, 489, 490,
+    491, 492, 495, 502, 503, 551, 571, 575, 579, 580, 581, 583, 587, 589, 591, 592,
+    595, 638, 647, 650, 652, 653, 749, 769, 770, 772, 773, 775, 778, 779, 780, 784,
+    785, 786, 788, 797, 839, 842, 848, 869, 870, 877, 878, 879, 880, 881, 882, 885,
+    886, 887, 893, 902, 908, 912, 916, 951, 954, 963, 1013, 1076, 1116, 1235, 1238, 1240,
+    1244, 1247, 1248, 1253, 1260, 1261, 1262, 1312, 1331, 1363, 308, 321, 339, 347, 350, 351,
+    353, 355, 365, 367, 383, 385, 388, 389, 390, 393, 410, 416, 421, 438, 440, 443,
+    446, 449, 452, 454, 457, 465, 466, 472, 473, 475, 477, 485, 488, 489, 493, 508,
+    537, 539, 540, 541, 542, 550, 551, 556, 564, 573, 575, 577, 582, 584, 587, 620,
+    636, 638, 647, 650, 653, 654, 655, 669, 672, 674, 677, 683, 688, 696, 699, 700,
+    701, 702, 703, 707, 715, 718, 725, 726, 730, 734, 735, 739, 740, 743, 749, 751,
+    752, 753, 779, 783, 785, 786, 788, 801, 812, 815, 817, 819, 834, 835, 836, 839,
+    842, 848, 852, 853, 856, 861, 864, 865, 866, 867, 868, 877, 878, 879, 880, 881,
+    882, 884, 885, 886, 888, 889, 890, 891, 902, 903, 904, 905, 908, 910, 912, 916,
+    917, 919, 921, 928, 932, 948, 950, 951, 966, 971, 974, 980, 982, 998, 1007, 1010,
+    1011, 1013, 1015, 1018, 1046, 1065, 1076, 1083, 1100, 1109, 1113, 1116, 1281, 1331, 1333, 1336,
+    1345, 1368, 308, 310, 311, 313, 323, 324, 325, 326, 327, 330, 475, 478, 481, 482,
+    486, 487, 488, 489, 495, 570, 576, 580, 583, 587, 669, 674, 677, 683, 696, 699,
+    700, 701, 735, 749, 762, 769, 770, 772, 773, 775, 776, 777, 779, 780, 783, 784,
+    785, 786, 789, 792, 797, 800, 815, 839, 842, 848, 851, 853, 866, 867, 875, 881,
+    902, 908, 919, 934, 936, 950, 951, 1248, 1279, 1379, 1380, 306, 307, 308, 309, 310,
+    312, 313, 316, 317, 318, 319, 321, 323, 324, 327, 331, 336, 337, 350, 353, 372,
+    377, 380, 386, 400, 404, 407, 416, 418, 421, 438, 440, 444, 446, 449, 452, 460,
+    473, 474, 475, 476, 477, 478, 480, 481, 483, 484, 485, 486, 487, 488, 489, 490,
+    494, 495, 504, 508, 539, 551, 570, 571, 572, 573, 574, 575, 577, 580, 582, 583,
+    584, 586, 587, 588, 589, 590, 591, 592, 594, 599, 638, 647, 653, 697, 699, 700,
+    725, 735, 740, 743, 749, 769, 770, 771, 772, 773, 775, 776, 778, 779, 780, 781,
+    782, 783, 784, 785, 786, 787, 788, 789, 792, 799, 800, 812, 877, 880, 882, 885,
+    900, 902, 912, 914, 916, 919, 928, 931, 934, 936, 937, 939, 943, 944, 950, 951,
+    954, 956, 977, 1001, 1007, 1010, 1013, 1015, 1034, 1076, 1077, 1110, 1116, 1198, 1201, 1204,
+    1207, 1209, 1214, 1218, 1235, 1238, 1240, 1247, 1248, 1260, 1261, 1262, 1274, 1313, 1331, 1359,
+    1369, 1372, 1374, 1375, 1379, 307, 310, 316, 317, 321, 322, 324, 325, 326, 327, 344,
+    355, 358, 366, 369, 377, 413, 418, 419, 438, 443, 446, 452, 470, 474, 478, 481,
+    483, 487, 488, 577, 584, 585, 591, 636, 638, 644, 647, 649, 650, 652, 653, 655,
+    669, 674, 677, 683, 688, 696, 697, 699, 700, 701, 707, 721, 735, 740, 743, 749,
+    754, 762, 769, 770, 772, 775, 779, 780, 784, 785, 786, 791, 792, 801, 806, 809,
+    814, 815, 829, 834, 839, 867, 868, 869, 875, 877, 878, 880, 881, 882, 885, 890,
+    900, 901, 902, 905, 908, 910, 911, 912, 913, 914, 915, 916, 917, 919, 920, 922,
+    923, 927, 928, 931, 932, 934, 935, 936, 938, 940, 943, 945, 948, 950, 951, 953,
+    954, 971, 1004, 1032, 1037, 1040, 1046, 1065, 1070, 1073, 1076, 1079, 1097, 1111, 1169, 1200,
+    1204, 1209, 1212, 1214, 1235, 1240, 1247, 1248, 1260, 1261, 1262, 1279, 1280, 1313, 1336, 1347,
+    1372, 1379, 307, 308, 309, 313, 316, 319, 321, 323, 324, 331, 372, 377, 380, 386,
+    388, 391, 399, 403, 404, 474, 475, 478, 481, 482, 483, 485, 486, 487, 488, 492,
+    570, 571, 574, 577, 578, 580, 581, 582, 583, 587, 590, 591, 636, 641, 649, 668,
+    683, 697, 710, 727, 769, 770, 772, 775, 778, 780, 781, 784, 785, 786, 793, 801,
+    834, 835, 836, 837, 838, 839, 842, 846, 847, 848, 849, 850, 853, 854, 859, 860,
+    861, 865, 866, 868, 871, 872, 879, 882, 912, 936, 939, 948, 950, 953, 957, 958,
+    1200, 1214, 1235, 1238, 1242, 1248, 1260, 1262, 1314, 1332, 1335, 1344, 1352, 1365, 1369, 1372,
+    1377, 1378, 1379, 1383, 317, 323, 344, 353, 355, 366, 377, 380, 383, 386, 391, 407,
+    416, 418, 421, 438, 440, 454, 457, 475, 482, 488, 492, 510, 539, 551, 636, 638,
+    644, 650, 655, 669, 674, 688, 696, 699, 701, 725, 735, 739, 763, 769, 770, 775,
+    778, 783, 785, 786, 788, 812, 817, 834, 839, 842, 844, 848, 852, 853, 861, 864,
+    865, 866, 867, 870, 877, 878, 879, 880, 882, 884, 885, 887, 889, 890, 895, 900,
+    905, 908, 911, 914, 916, 919, 927, 928, 930, 931, 932, 936, 950, 974, 977, 982,
+    999, 1001, 1010, 1015, 1070, 1081, 1093, 1097, 1103, 1106, 1109, 1113, 1130, 1336, 307, 309,
+    313, 319, 324, 327, 330, 335, 473, 475, 485, 488, 570, 573, 576, 577, 583, 584,
+    588, 669, 677, 683, 769, 781, 784, 785, 786, 834, 839, 842, 848, 853, 912, 914,
+    948, 951, 953, 307, 310, 316, 319, 320, 322, 377, 380, 399, 404, 485, 570, 575,
+    577, 587, 669, 674, 683, 688, 701, 721, 762, 778, 783, 784, 785, 788, 789, 799,
+    834, 839, 842, 848, 861, 865, 936, 938, 942, 946, 949, 950, 957, 963, 964, 1260,
+    318, 321, 327, 377, 399, 404, 478, 481, 485, 486, 488, 489, 580, 584, 585, 587,
+    589, 590, 769, 772, 786, 1212, 310, 311, 323, 324, 473, 474, 485, 487, 488, 518,
+    580, 592, 669, 674, 677, 683, 702, 707, 716, 900, 905, 912, 932, 943, 1235, 1238,
+    1247, 1248, 1260, 1261, 1262, 1378, 307, 309, 310, 319, 322, 323, 324, 377, 474, 481,
+    485, 486, 488, 571, 585, 590, 650, 674, 677, 683, 696, 699, 700, 701, 729, 743,
+    754, 817, 908, 917, 938, 950, 1235, 1238, 1260, 1261, 1262, 472, 474, 475, 479, 488,
+    492, 495, 585, 474, 475, 482, 487, 488, 492, 1342, 1378, 350, 405, 413, 416, 418,
+    449, 454, 508, 539, 541, 548, 550, 573, 638, 647, 650, 653, 697, 725, 749, 815,
+    834, 836, 839, 862, 866, 867, 872, 877, 880, 881, 882, 888, 890, 891, 899, 902,
+    916, 928, 1109, 1126, 1331, 339, 403, 460, 478, 481, 488, 550, 647, 710, 716, 740,
+    812, 819, 877, 880, 885, 900, 908, 912, 914, 916, 1013, 1131, 1136, 1150, 1163, 1331,
+    1332, 1369, 388, 454, 647, 653, 674, 702, 763, 775, 809, 839, 842, 848, 853, 861,
+    877, 879, 881, 885, 905, 908, 916, 1013, 341, 350, 355, 466, 540, 545, 551, 574,
+    638, 669, 674, 677, 699, 725, 763, 834, 839, 842, 848, 853, 861, 877, 885, 908,
+    914, 919, 927, 999, 1159, 355, 380, 386, 391, 393, 416, 418, 440, 454, 540, 551,
+    638, 647, 653, 697, 703, 730, 735, 752, 834, 842, 848, 862, 877, 878, 885, 900,
+    902, 908, 914, 919, 927, 928, 931, 1010, 1018, 1037, 1109, 355, 377, 386, 388, 391,
+    454, 457, 509, 542, 551, 636, 644, 650, 652, 655, 669, 674, 688, 696, 721, 725,
+    735, 739, 752, 801, 806, 812, 814, 815, 819, 834, 839, 842, 848, 851, 853, 861,
+    867, 877, 878, 881, 885, 900, 905, 908, 914, 916, 919, 927, 930, 931, 999, 1001,
+    1010, 1013, 1015, 4645, 421, 4667, 4692, 4700, 4733, 4744, 4803, 4817, 4904, 4908, 885, 788,
+    5031, 5041, 5042, 5054, 5063, 5066, 5204, 5300, 5308, 5311, 5441, 5458, 5460, 5468, 5497, 5681,
+    486, 5682, 5753, 5784, 5792, 5808, 957, 5840, 5850, 5854, 5873, 5875, 5878, 5885, 5886, 5920,
+    943, 5966, 5968, 5969, 386, 418, 6075, 6080, 6088, 6095, 6097, 319, 6166, 774, 6169, 6173,
+    6185, 6215, 471, 472, 6245, 6274, 593, 6298, 6307, 6311, 1363, 486, 783, 939, 6555, 6560,
+    573, 584, 550, 6681, 836, 6724, 6811, 6862, 1379, 2647, 2656, 2657, 2666, 2710, 2713, 2730,
+    2734, 2737, 155, 2769, 2784, 2788, 2828, 2829, 2837, 2841, 2852, 2857, 2858, 2864, 2878, 2898,
+    2901, 2935, 3025, 3028, 3029, 118, 3054, 3055, 3097, 3228, 3235, 3236, 3240, 3267, 3279, 3296,
+    3306, 3323, 3334, 3347, 3351, 3360, 3361, 3363, 174, 3401, 3402, 3410, 3430, 3431, 3436, 3437,
+    147, 3459, 3517, 3569, 3576, 3577, 3582, 3613, 3615, 3617, 3621, 3627, 3630, 3657, 3658, 3727,
+    3730, 3742, 3746, 3747, 3761, 3771, 3784, 3789, 3790, 3794, 3813, 3814, 3819, 3841, 3842, 3865,
+    3880, 3901, 3914, 133, 4379, 4445, 2562, 2569, 2572, 2579, 2589, 2606, 2607, 2610, 2898, 2902,
+    2910, 2911, 2938, 2939, 3117, 3123, 3126, 3127, 3137, 3267, 3279, 3280, 3305, 3326, 3327, 3328,
+    3334, 3335, 3471, 3474, 3476, 3480, 3498, 3499, 3501, 3502, 3505, 3514, 3516, 3517, 3519, 3520,
+    3547, 3612, 3613, 3627, 3628, 3634, 3635, 3648, 3649, 3661, 3689, 3695, 3696, 3863, 3877, 4288,
+    4289, 4445, 4529, 2563, 2572, 121, 2595, 2607, 2610, 2853, 2902, 2910, 2911, 2, 2935, 2938,
+    2939, 2942, 3054, 3075, 3089, 3090, 3097, 3108, 3124, 3134, 3250, 3267, 3279, 3280, 3286, 3327,
+    3334, 3335, 3414, 2, 147, 3442, 174, 3470, 3473, 3479, 3480, 3483, 3485, 3491, 3514, 3516,
+    3517, 3520, 3528, 3529, 3611, 3612, 3613, 3626, 3627, 3634, 3635, 3649, 3695, 3721, 3722, 3813,
+    3814, 3909, 3913, 4139, 112, 4268, 4299, 125, 4529, 4553, 2607, 2824, 2926, 2929, 2930, 111,
+    3092, 3098, 3134, 3135, 3266, 3267, 3268, 3280, 2, 3285, 3286, 2, 3296, 3297, 3306, 3331,
+    3335, 3401, 3412, 3413, 3414, 3420, 3430, 3431, 3466, 3473, 3485, 3487, 3490, 3501, 3516, 3519,
+    3523, 3533, 3612, 3613, 3627, 3628, 3634, 3635, 3648, 3649, 3661, 3680, 3692, 3693, 3747, 3897,
+    2568, 2569, 2607, 2610, 2713, 2714, 2729, 2730, 2892, 2893, 2896, 2910, 2911, 2913, 2917, 2923,
+    2929, 2932, 2935, 2938, 2939, 2949, 2968, 3089, 3090, 3126, 3127, 3129, 140, 3134, 3135, 3143,
+    3279, 3413, 3430, 3431, 172, 3470, 3471, 3473, 3479, 3485, 3487, 3491, 3496, 3498, 3502, 3510,
+    3511, 3514, 3516, 3519, 3520, 3528, 3536, 160, 3612, 3613, 3627, 3628, 3634, 3635, 3648, 3649,
+    3661, 3662, 3680, 3692, 3693, 3695, 3721, 3857, 3865, 3891, 3897, 3898, 3901, 3913, 168, 4224,
+    173, 116, 133, 172, 2571, 2594, 2610, 2639, 2666, 2667, 2707, 2723, 2726, 2727, 2729, 2734,
+    2735, 2746, 2766, 2769, 2788, 2789, 2792, 2828, 2837, 2846, 2849, 2852, 2853, 2858, 2863, 2864,
+    2878, 2895, 2896, 2898, 2939, 2976, 3024, 3025, 3028, 118, 124, 3041, 3054, 3055, 3059, 3065,
+    3066, 3134, 3135, 3207, 3240, 3243, 3244, 3280, 3351, 3364, 147, 3390, 165, 3410, 3471, 3476,
+    3477, 3479, 3495, 2, 3498, 3499, 2, 3504, 3505, 3510, 3511, 3513, 3516, 3517, 3519, 3520,
+    3552, 3564, 3569, 3570, 3612, 3617, 3618, 3626, 3627, 3628, 3634, 3648, 3649, 3654, 3661, 3695,
+    3701, 3721, 3722, 3724, 3725, 3736, 3737, 3746, 3747, 3758, 3759, 3789, 3790, 3795, 3814, 3820,
+    3841, 3842, 3857, 3877, 3940, 3953, 3978, 3981, 3995, 4002, 4006, 4007, 4013, 2562, 2563, 2609,
+    2824, 2825, 2833, 2841, 2842, 2917, 2938, 2979, 3132, 3523, 2566, 2572, 2574, 2575, 121, 2581,
+    2586, 2591, 2594, 2595, 2597, 2603, 2607, 2609, 2617, 2622, 169, 2, 2696, 2697, 2706, 2720,
+    2729, 2743, 2765, 2788, 2792, 2793, 2834, 2852, 2904, 2929, 2, 3124, 3126, 3138, 3140, 3235,
+    3268, 3296, 3297, 3328, 2, 3401, 3402, 3470, 3473, 3476, 3480, 2, 2, 3496, 3498, 2,
+    3501, 3505, 3507, 3508, 3510, 3511, 3513, 3514, 3516, 3519, 3520, 3536, 3612, 3613, 3627, 3628,
+    3635, 3649, 3693, 3856, 3857, 3859, 133, 3883, 3892, 3894, 3900, 3913, 4224, 173, 133, 4278,
+    2569, 2571, 2578, 2592, 2594, 2606, 2607, 2610, 153, 2696, 2746, 2788, 2792, 2800, 2801, 2833,
+    2841, 2895, 2901, 2911, 2926, 2932, 3031, 3051, 3054, 3208, 3211, 3229, 3240, 3243, 3244, 3267,
+    3268, 131, 3297, 3305, 3323, 3346, 3363, 3366, 3381, 3430, 3431, 3436, 3437, 3470, 3474, 3479,
+    3487, 3496, 3498, 3504, 3511, 3513, 3514, 3516, 3519, 3520, 3522, 3528, 3552, 3570, 3576, 3613,
+    3635, 3648, 3698, 3721, 3722, 3724, 3725, 3727, 3728, 3730, 3734, 3737, 3746, 3747, 3771, 3784,
+    3789, 3790, 3819, 3827, 3842, 132, 3977, 3978, 3995, 4002, 4006, 4007, 4145, 4146, 4445, 3520,
+    3721, 3727, 3728, 2562, 2563, 2571, 2572, 2578, 2, 2588, 2589, 2600, 2601, 2604, 2607, 2610,
+    158, 2696, 2697, 2729, 2898, 2902, 2938, 2939, 3127, 3129, 3134, 3266, 3268, 3278, 3279, 2,
+    3285, 3286, 2, 3296, 3297, 3305, 3326, 3330, 3331, 3332, 3334, 3419, 3430, 3464, 3471, 3473,
+    3480, 3499, 3501, 3505, 3511, 3513, 3514, 3516, 3519, 3526, 3528, 3627, 3628, 3634, 3635, 3648,
+    3649, 3662, 3692, 3698, 3716, 3721, 3746, 3747, 3784, 2, 3814, 3859, 3881, 3891, 3892, 3894,
+    3897, 3898, 3901, 3913, 170, 2562, 2563, 2568, 2569, 2571, 121, 2578, 2586, 2, 2591, 2594,
+    2607, 2610, 2613, 150, 2768, 2895, 2896, 2898, 2901, 2910, 2911, 2917, 2923, 2929, 2930, 2938,
+    2941, 2942, 2950, 3089, 3094, 3095, 3097, 3098, 3104, 3114, 3120, 3127, 3129, 3134, 3137, 3140,
+    3145, 3146, 3419, 3470, 3471, 3473, 3476, 3480, 3482, 3487, 3495, 3510, 3513, 3514, 3516, 3519,
+    3520, 3536, 3549, 3857, 3866, 3873, 3878, 3888, 3891, 3897, 3901, 2, 4339, 4340, 4352, 4353,
+    4443, 4445, 4467, 4468, 4494, 4495, 117, 4534, 4538, 4556, 2565, 2568, 2572, 2578, 2586, 2588,
+    2594, 2606, 2607, 2609, 2610, 2622, 2657, 2889, 2901, 2904, 2907, 2910, 2938, 2939, 2941, 156,
+    3098, 3108, 3115, 3126, 3127, 3134, 3135, 3279, 3413, 3414, 3430, 3431, 3442, 174, 3473, 3480,
+    3485, 3487, 3488, 3491, 3495, 3514, 3516, 3519, 3520, 3612, 3734, 3746, 3897, 3898, 3901, 4076,
+    4090, 4278, 4498, 2562, 2563, 2566, 2568, 121, 2581, 2582, 2585, 2591, 2600, 2603, 2609, 2610,
+    150, 2624, 2631, 2783, 2796, 2824, 2833, 2834, 2857, 2858, 2860, 2895, 2901, 2902, 2904, 2907,
+    2910, 2911, 2917, 2923, 2929, 2930, 2935, 2938, 2939, 2941, 2942, 2947, 2950, 2956, 3055, 3103,
+    3114, 3117, 3124, 3134, 3135, 3235, 3240, 3430, 3471, 3473, 3479, 3480, 3483, 3487, 3488, 3495,
+    3498, 3501, 3502, 3513, 3514, 3516, 3517, 3519, 3721, 3724, 3733, 3736, 3747, 3750, 3799, 3819,
+    3820, 3901, 4467, 2651, 2656, 2657, 2661, 2662, 2666, 2720, 2726, 2727, 2734, 2737, 2788, 2801,
+    2824, 2828, 2, 2834, 2841, 2846, 2852, 2853, 2857, 2858, 2864, 2878, 2882, 2895, 2907, 2939,
+    2941, 2976, 2977, 3024, 3028, 3029, 3031, 3033, 118, 3035, 3051, 3054, 3055, 3065, 3078, 3079,
+    3097, 3120, 3135, 3186, 3207, 3229, 3235, 3243, 3246, 3249, 3275, 3285, 3305, 3340, 3360, 3361,
+    3368, 3381, 157, 3393, 3414, 3419, 3430, 3440, 3511, 3516, 3517, 3519, 3551, 3552, 3569, 3570,
+    3576, 3577, 3582, 3587, 3613, 3615, 3627, 3628, 3635, 3649, 3658, 3661, 3662, 3698, 3701, 3721,
+    3722, 3724, 3725, 3727, 3730, 3731, 3733, 3736, 3737, 3742, 3746, 3747, 3750, 3756, 3761, 3789,
+    3790, 3794, 3795, 3799, 3803, 3819, 3820, 3822, 3826, 3827, 3842, 3850, 3851, 3897, 3900, 3929,
+    3941, 3949, 3950, 3953, 3996, 133, 4003, 4077, 4094, 4103, 4130, 4145, 139, 4395, 4494, 4532,
+    2565, 2566, 2572, 2574, 2578, 2606, 2607, 2610, 2612, 2618, 158, 2901, 2910, 2917, 2921, 2932,
+    2935, 2938, 2939, 2942, 158, 3090, 3106, 3115, 3123, 3135, 3266, 3268, 3279, 3280, 3285, 2,
+    3296, 3318, 3319, 3326, 3328, 3332, 3334, 3335, 3473, 3474, 3479, 3480, 3482, 3483, 3487, 3491,
+    3498, 3501, 3513, 3514, 3516, 3517, 3519, 3520, 3536, 167, 3549, 3576, 3627, 3628, 3634, 3635,
+    3648, 3649, 3696, 3698, 3716, 3717, 3799, 3800, 3862, 3897, 3898, 3901, 4389, 4557, 4560, 2562,
+    2563, 2565, 2568, 2571, 2572, 122, 2578, 2579, 2585, 2588, 2591, 2594, 2595, 2600, 2606, 2607,
+    2609, 2610, 2617, 159, 172, 2656, 2657, 2662, 2696, 2697, 2706, 2707, 2713, 2714, 2729, 2766,
+    2825, 2841, 2853, 2896, 2898, 2901, 2904, 2907, 2910, 2911, 128, 2917, 2918, 2923, 2926, 2927,
+    2929, 2930, 2933, 2938, 2939, 2941, 2942, 148, 156, 2956, 2, 2968, 3092, 3094, 3097, 3100,
+    3101, 3103, 3104, 3108, 3115, 3120, 3121, 3124, 3126, 3127, 3134, 3135, 3138, 3142, 3143, 3145,
+    168, 3402, 3413, 3414, 3419, 3431, 3470, 3471, 3473, 3476, 3477, 3479, 3480, 3482, 3483, 3487,
+    3488, 3491, 3495, 3496, 3498, 3501, 3504, 3507, 3510, 3511, 3513, 3514, 3516, 3517, 3519, 3520,
+    3522, 3525, 3526, 3528, 3536, 3546, 3549, 3569, 3570, 3746, 3784, 3789, 3813, 3814, 3819, 3827,
+    3842, 3848, 3856, 3862, 3865, 3871, 3878, 3897, 3898, 3901, 3909, 3913, 3990, 3995, 4002, 4262,
+    4273, 4288, 4467, 4534, 124, 4539, 133, 4546, 4557, 2562, 2572, 2585, 2589, 2600, 2603, 2609,
+    2610, 2612, 150, 2646, 2647, 2667, 2706, 2898, 2917, 2918, 2923, 2935, 2938, 2939, 3126, 3129,
+    3207, 3208, 3211, 3222, 3229, 3235, 3236, 3240, 3249, 3250, 3266, 3267, 3268, 3279, 3280, 2,
+    3286, 2, 3296, 3297, 3306, 3318, 3328, 3335, 3347, 3375, 3401, 3402, 3413, 3419, 3430, 3442,
+    3471, 3474, 3498, 3513, 3514, 3516, 3517, 3519, 3520, 3533, 3536, 3551, 3558, 3559, 3563, 3564,
+    3576, 3577, 3612, 3613, 3627, 3698, 3704, 3730, 3734, 2, 3788, 3789, 3790, 2, 3794, 3795,
+    3799, 3800, 3806, 3807, 2, 3813, 3814, 3818, 3819, 3820, 3827, 155, 3837, 3840, 3842, 3847,
+    3848, 3850, 3851, 3856, 3862, 3868, 3878, 133, 3891, 3897, 3898, 3901, 4040, 4077, 4084, 4089,
+    4090, 4124, 4224, 133, 4283, 4288, 4340, 4501, 4539, 4557, 2562, 2563, 2566, 2568, 2585, 2600,
+    2607, 2610, 2706, 2707, 2729, 2730, 2765, 2898, 2910, 2917, 2918, 2920, 2923, 2929, 2930, 2932,
+    2935, 2936, 2938, 2939, 2949, 3089, 111, 3108, 126, 3117, 3120, 3123, 3124, 3134, 3135, 3143,
+    3146, 3207, 3218, 174, 3296, 3352, 3470, 3471, 3473, 3480, 3496, 3501, 3502, 3504, 3513, 3514,
+    3516, 3517, 3519, 3552, 3612, 3623, 3627, 3628, 3634, 3635, 3648, 3649, 3661, 3662, 2, 3692,
+    3693, 3696, 3711, 3863, 3871, 3892, 3897, 3898, 3906, 3916, 3917, 4288, 115, 4534, 4538, 4539,
+    4550, 4553, 4556, 4564, 2588, 2646, 2661, 2662, 2666, 2667, 2684, 2, 2792, 2793, 2800, 2801,
+    2825, 2857, 2938, 3054, 3235, 3319, 3410, 3487, 3517, 3570, 3582, 3628, 3638, 3648, 3658, 3698,
+    3721, 3722, 3724, 3746, 3747, 3772, 3795, 3807, 3813, 3819, 3841, 3842, 3851, 132, 3977, 3978,
+    3981, 3996, 4083, 173, 4145, 2568, 2578, 2594, 2610, 2896, 2902, 2938, 3089, 3097, 3108, 3123,
+    3471, 3513, 3514, 3516, 3519, 3612, 3613, 3627, 3628, 3634, 3648, 3814, 3900, 2562, 2594, 2604,
+    3090, 3109, 3267, 3268, 3279, 3280, 2, 3296, 3297, 3334, 3335, 3510, 3514, 3516, 3528, 3612,
+    3613, 3627, 3634, 3635, 3648, 3894, 2, 2600, 2930, 2932, 2938, 2941, 3114, 3126, 3134, 3143,
+    4283, 2572, 2574, 2575, 2607, 2609, 2610, 2895, 2898, 2936, 2938, 3279, 2, 4554, 2562, 2568,
+    2569, 2572, 2594, 2604, 2607, 2610, 2706, 2898, 2932, 111, 3129, 3143, 3235, 3279, 2, 3285,
+    3286, 2, 3296, 3331, 3332, 3334, 2, 3442, 3868, 3898, 2892, 2898, 2902, 2914, 2956, 3129,
+    2901, 2949, 2857, 2858, 3028, 3051, 3228, 3235, 3431, 3613, 3628, 3684, 3696, 3721, 3722, 3789,
+    3842, 4468, 2639, 2910, 2938, 3351, 3413, 3587, 3746, 3747, 3784, 3799, 3814, 3819, 3820, 4002,
+    116, 4534, 3244, 3279, 3563, 3635, 3649, 3746, 3747, 3799, 3819, 2666, 3040, 3100, 3627, 3635,
+    3746, 3747, 3978, 2666, 2667, 2713, 3031, 3340, 3746, 3747, 3799, 3842, 2666, 2667, 2734, 2858,
+    2864, 3054, 3240, 147, 3410, 3552, 3569, 3570, 3626, 3654, 3721, 3722, 3746, 3747, 3795, 3814,
+    3978, 3981, 3995, 4002, 4007, 2800, 7281, 7309, 7314, 7315, 7365, 7431, 7436, 3747, 7534, 7543,
+    7558, 7738, 7745, 7875, 2933, 8031, 8080, 2908, 8115, 3917, 8171, 8173, 8183, 8184, 8213, 3877,
+    8229, 8230, 8232, 8319, 8327, 8341, 8342, 8344, 2594, 8414, 8417, 8433, 8463, 2889, 2893, 8488,
+    8522, 8543, 8556, 4523, 2933, 3510, 3098, 3051, 3513, 8938, 4556, 4794, 4806, 4811, 4828, 4878,
+    4880, 4914, 4915, 4918, 4926, 1070, 4962, 588, 4975, 4976, 4977, 5020, 5026, 512, 5042, 5054,
+    5073, 5074, 5087, 1210, 419, 446, 5213, 5318, 5322, 5325, 5330, 454, 5359, 5360, 5368, 5373,
+    5374, 5439, 5595, 5607, 5613, 5617, 5622, 5652, 5678, 5708, 957, 5748, 5762, 5787, 583, 5797,
+    5801, 5806, 5807, 1380, 310, 5846, 5851, 5869, 5911, 789, 5934, 5936, 940, 1254, 6082, 6154,
+    6157, 6166, 791, 834, 6183, 6215, 6222, 6223, 424, 6242, 6250, 6258, 6323, 6324, 710, 6431,
+    6456, 6466, 6467, 6468, 6473, 6477, 6482, 6484, 1103, 1238, 6534, 6540, 6542, 6545, 6551, 6580,
+    6585, 792, 6592, 6598, 6601, 6626, 6630, 1261, 6631, 452, 6676, 6724, 6742, 710, 677, 900,
+    341, 421, 4670, 556, 4701, 4741, 4744, 4752, 5125, 5126, 5133, 5145, 5147, 5150, 550, 5151,
+    5152, 5153, 5225, 5229, 5230, 677, 5486, 5490, 5493, 5497, 5499, 5528, 5652, 5656, 5659, 476,
+    5680, 5682, 502, 5720, 939, 1300, 1301, 1307, 5753, 1328, 5763, 5764, 5969, 396, 409, 5987,
+    675, 697, 713, 6038, 6039, 754, 6067, 6073, 6075, 6082, 6088, 6095, 6128, 6204, 6205, 6209,
+    6211, 6212, 6213, 6215, 6216, 6217, 329, 6220, 6242, 6246, 6247, 6248, 492, 6266, 6275, 6296,
+    6301, 6302, 6307, 6332, 6369, 6370, 1383, 6658, 647, 6967, 885, 900, 7104, 4645, 4670, 466,
+    508, 4715, 4744, 4752, 5067, 5133, 5134, 5148, 548, 5153, 5155, 838, 5225, 5230, 5237, 5359,
+    5400, 5415, 316, 322, 5420, 5421, 5422, 407, 5439, 5458, 753, 758, 5521, 5646, 5651, 5674,
+    5678, 5683, 494, 601, 1297, 5762, 1380, 5885, 943, 956, 1379, 5966, 382, 5982, 5987, 487,
+    510, 6014, 6067, 6068, 862, 6075, 6077, 6078, 6080, 6082, 6095, 6111, 1017, 6205, 6212, 6215,
+    6217, 328, 6249, 6266, 6268, 578, 6269, 581, 6274, 6275, 6308, 6371, 6407, 6409, 6415, 6580,
+    792, 6736, 6737, 1076, 572, 355, 6950, 6978, 583, 7104, 838, 4744, 319, 749, 5187, 5189,
+    5197, 350, 5425, 5441, 5519, 5525, 308, 315, 5658, 5660, 5665, 5683, 583, 590, 5703, 5704,
+    5705, 5707, 777, 798, 5729, 1335, 1339, 1380, 5840, 319, 5873, 484, 5883, 5885, 586, 588,
+    5914, 776, 5920, 800, 1364, 1375, 5972, 5999, 548, 6005, 6009, 710, 6073, 871, 6075, 6078,
+    6080, 6090, 6103, 6118, 311, 315, 322, 6241, 6247, 493, 6264, 6269, 581, 6271, 6274, 593,
+    6294, 6298, 6300, 6303, 6305, 6308, 6310, 948, 1199, 1334, 1340, 1347, 6475, 6708, 410, 421,
+    4744, 4752, 574, 4882, 4883, 4885, 588, 4906, 775, 4913, 350, 5111, 5117, 5145, 5150, 5151,
+    5153, 5159, 647, 707, 5189, 5196, 5205, 5211, 869, 5225, 883, 5251, 318, 5414, 5415, 317,
+    322, 5420, 5490, 5493, 5499, 5500, 5501, 809, 819, 5519, 5525, 5535, 984, 5674, 471, 5873,
+    5913, 5920, 1353, 344, 5966, 5969, 5972, 384, 451, 5999, 6005, 586, 6021, 6026, 6037, 6056,
+    6058, 6067, 872, 875, 6078, 6080, 6090, 911, 6095, 926, 6099, 6111, 6120, 1108, 6121, 1150,
+    6204, 6205, 6209, 6213, 322, 6215, 6217, 329, 6219, 472, 6244, 6245, 482, 6248, 6249, 6253,
+    579, 6271, 585, 6278, 6295, 6296, 6297, 774, 6298, 777, 6301, 6303, 6307, 6308, 798, 6328,
+    6329, 6331, 945, 963, 1199, 1200, 1330, 1332, 1350, 1363, 1368, 6370, 6371, 6411, 6648, 6659,
+    6693, 6708, 6709, 6714, 6724, 1073, 1281, 483, 1374, 421, 707, 1345, 4667, 4669, 4712, 4752,
+    4786, 4826, 4827, 4828, 4829, 861, 4833, 4835, 4869, 4896, 743, 766, 779, 4918, 4919, 4920,
+    4925, 4941, 4959, 4962, 4974, 4975, 4976, 4977, 4981, 4982, 4985, 5024, 509, 677, 5051, 5063,
+    5066, 5067, 5069, 5074, 5079, 935, 5080, 5084, 957, 1210, 5113, 5117, 413, 5230, 5268, 5269,
+    5300, 5315, 5321, 454, 556, 5344, 5359, 5361, 5369, 5372, 5373, 5375, 5377, 5386, 937, 5393,
+    5395, 950, 954, 5398, 5519, 5525, 5562, 5623, 5631, 5634, 5682, 574, 5791, 5813, 939, 5833,
+    1234, 5869, 5969, 5979, 5980, 5981, 5983, 5986, 6018, 6023, 6026, 679, 6029, 697, 6042, 6045,
+    6046, 6048, 806, 6056, 6057, 6058, 820, 6065, 869, 6075, 6077, 6078, 6082, 6084, 911, 6095,
+    6135, 6153, 6154, 6155, 6157, 688, 6158, 6159, 6210, 6224, 6228, 6242, 6247, 6248, 6251, 6253,
+    492, 6272, 6293, 6294, 6300, 6301, 6310, 6316, 948, 1366, 6369, 339, 6407, 641, 6412, 6415,
+    6416, 6418, 6419, 6420, 6421, 6446, 6449, 820, 6464, 6470, 6477, 6504, 6508, 6541, 6542, 6543,
+    6548, 494, 6588, 6609, 6626, 6630, 1261, 6631, 6648, 647, 571, 6778, 324, 372, 6804, 769,
+    6810, 6817, 853, 956, 4644, 4645, 4748, 316, 329, 482, 5032, 5034, 580, 593, 638, 647,
+    5225, 5275, 5514, 6102, 4652, 4655, 4670, 4675, 492, 508, 581, 654, 4707, 4711, 4715, 775,
+    4727, 838, 4730, 4744, 910, 4767, 4772, 1307, 308, 317, 4853, 4858, 4866, 4890, 779, 781,
+    963, 4958, 4976, 4982, 754, 495, 5057, 5136, 5189, 753, 5494, 5497, 5498, 5530, 945, 5614,
+    331, 5703, 5710, 5711, 1321, 5840, 311, 315, 5845, 319, 5850, 336, 5857, 338, 344, 5965,
+    384, 5979, 5987, 6020, 6024, 675, 6036, 6047, 6051, 6052, 6055, 6056, 6058, 837, 6063, 6072,
+    6078, 6080, 6088, 6091, 6093, 914, 6095, 6100, 1106, 6210, 6215, 329, 6249, 6253, 6280, 6307,
+    1347, 6646, 6648, 6650, 707, 716, 730, 6694, 835, 6720, 1065, 483, 1374, 707, 6957, 734,
+    421, 443, 4667, 4684, 721, 4711, 4712, 4740, 4744, 4752, 4753, 1037, 4851, 4941, 4975, 4976,
+    4984, 5002, 5004, 5005, 5006, 5008, 866, 480, 5042, 5116, 443, 5153, 743, 5204, 5333, 5352,
+    5371, 5573, 5579, 5580, 5602, 5623, 5631, 5634, 5658, 328, 683, 5712, 5726, 5745, 484, 5807,
+    5816, 5828, 5916, 783, 5920, 5934, 5935, 5936, 5968, 5974, 5983, 6006, 6020, 6025, 6046, 6059,
+    6060, 6067, 6073, 6075, 6080, 900, 6088, 6093, 6096, 936, 6113, 6135, 6160, 778, 6215, 325,
+    6274, 6276, 6298, 319, 6407, 641, 6409, 6412, 6415, 6416, 6421, 6426, 6427, 6431, 6441, 817,
+    6466, 6470, 6483, 1238, 6531, 6540, 6541, 6542, 6545, 6597, 6601, 956, 6630, 1261, 699, 6788,
+    323, 6804, 6809, 6817, 6818, 866, 6904, 6906, 900, 6095, 6407, 641, 716, 6427, 4644, 4645,
+    451, 4670, 550, 4684, 4697, 686, 4722, 4724, 4733, 4744, 4752, 1116, 316, 4854, 330, 775,
+    5125, 5133, 5225, 5230, 5500, 5506, 5521, 5660, 5679, 5680, 5681, 5687, 5690, 583, 5694, 601,
+    5708, 780, 5712, 5713, 5723, 5757, 5759, 5763, 576, 783, 1335, 5969, 372, 5987, 697, 710,
+    6048, 6058, 6062, 6067, 6075, 6077, 6080, 913, 6108, 6113, 482, 6250, 6253, 6256, 6263, 6266,
+    6268, 6272, 6275, 6278, 768, 6293, 6297, 6300, 6304, 6306, 6307, 6310, 6311, 797, 6314, 6334,
+    1333, 319, 571, 6409, 6410, 6412, 6464, 6467, 6473, 6475, 6477, 6534, 6588, 6650, 700, 6693,
+    6694, 6699, 6708, 6714, 6727, 6740, 1314, 1321, 4643, 4644, 4645, 4663, 421, 438, 508, 4684,
+    4692, 4706, 4712, 4744, 4752, 950, 982, 317, 383, 5117, 5125, 5129, 5132, 5151, 5152, 647,
+    715, 5195, 5198, 5223, 5225, 5226, 5229, 5233, 5237, 5253, 5416, 5430, 5435, 5439, 5441, 5455,
+    5465, 5481, 5500, 5506, 5520, 5523, 5528, 945, 1001, 5537, 5539, 5895, 5966, 5969, 380, 5972,
+    386, 409, 419, 5987, 484, 6001, 6016, 6018, 6055, 6062, 837, 6067, 6075, 6080, 6090, 6095,
+    6121, 1375, 6648, 6661, 550, 652, 772, 6693, 6711, 6727, 6994, 6996, 7003, 7004, 7005, 7006,
+    895, 900, 7062, 7063, 399, 839, 853, 452, 7108, 647, 7137, 4649, 418, 4670, 466, 4684,
+    4692, 680, 4712, 878, 4744, 4751, 4752, 4772, 4812, 5108, 446, 5132, 5137, 482, 504, 5151,
+    5225, 5230, 5235, 1083, 5441, 5457, 5459, 5460, 5468, 5494, 5498, 5499, 5519, 5524, 476, 482,
+    5875, 5890, 5914, 774, 777, 5918, 5919, 798, 5943, 1386, 5972, 5987, 510, 6001, 553, 6014,
+    6017, 6067, 6075, 6077, 6078, 6080, 6092, 6095, 6204, 6440, 6468, 6708, 6709, 6714, 6724, 6727,
+    308, 317, 588, 594, 718, 7086, 347, 4645, 4652, 418, 508, 581, 583, 587, 4689, 4707,
+    4722, 4727, 4748, 4752, 982, 4773, 4775, 584, 4996, 316, 5029, 5036, 5070, 5071, 5072, 5076,
+    5077, 882, 376, 5115, 5130, 5132, 5133, 5134, 475, 5141, 5146, 548, 550, 5151, 5152, 638,
+    647, 715, 5189, 5193, 5197, 840, 5215, 5225, 880, 5229, 5230, 888, 5231, 5233, 911, 5237,
+    5248, 5253, 1108, 5374, 5452, 5466, 5471, 5487, 5518, 5519, 5523, 5525, 5526, 5607, 5614, 5623,
+    783, 5969, 5972, 5982, 5987, 487, 6001, 6003, 6006, 553, 649, 6023, 6035, 6039, 6041, 6062,
+    6067, 6075, 6076, 6080, 6086, 6090, 641, 6412, 6416, 778, 6446, 6475, 949, 584, 6592, 6597,
+    6598, 6601, 6604, 6608, 6609, 6724, 7062, 4803, 4807, 4811, 4819, 4820, 4823, 4824, 4826, 4890,
+    683, 4900, 4901, 4920, 4926, 4927, 4974, 4976, 4977, 5008, 319, 5024, 502, 5041, 582, 677,
+    5054, 5063, 5065, 5066, 5070, 5071, 5073, 5077, 5087, 5096, 1210, 1231, 383, 5142, 512, 5230,
+    5236, 5268, 5269, 5272, 5299, 5300, 5321, 5322, 5323, 403, 5332, 5336, 454, 5339, 5355, 5359,
+    5370, 5372, 5373, 5390, 5404, 5405, 5440, 5480, 5525, 5554, 5570, 5601, 5607, 5611, 5614, 5631,
+    908, 5643, 5671, 5691, 5720, 5779, 5797, 5798, 5801, 5818, 1070, 1103, 1261, 5888, 5898, 5911,
+    5942, 818, 6077, 6082, 6092, 316, 322, 6155, 6156, 6157, 6159, 6160, 6161, 6166, 6169, 6179,
+    6184, 905, 914, 6215, 6221, 6241, 6253, 6274, 6307, 6324, 938, 6332, 6334, 6374, 312, 339,
+    6407, 6408, 641, 6409, 6412, 6415, 668, 6417, 6419, 6421, 710, 716, 6430, 766, 6439, 6445,
+    820, 832, 6455, 879, 6464, 6475, 956, 6500, 1106, 6540, 6541, 6542, 383, 6548, 6552, 6557,
+    6559, 6562, 6572, 6592, 6597, 6598, 6601, 6604, 6610, 6614, 933, 956, 6630, 1261, 6639, 6641,
+    6708, 6719, 6723, 6756, 6768, 6773, 6774, 6776, 6779, 696, 700, 707, 6811, 6856, 6867, 6868,
+    914, 372, 669, 801, 7029, 7081, 512, 4650, 383, 400, 4670, 484, 4684, 878, 4744, 4752,
+    946, 1018, 1116, 5128, 446, 5145, 5151, 647, 697, 5205, 5213, 5214, 5225, 880, 5230, 889,
+    5231, 5237, 1116, 5420, 516, 5468, 745, 898, 5660, 5679, 5680, 5681, 5682, 501, 5687, 5690,
+    5704, 5705, 5734, 5735, 1210, 5736, 5754, 1346, 1353, 5763, 5764, 1392, 5972, 5975, 5982, 5986,
+    5988, 5994, 482, 492, 6001, 6003, 548, 6005, 595, 679, 6036, 837, 840, 6067, 6076, 6081,
+    6082, 6088, 6095, 6121, 1275, 6129, 6167, 6240, 6245, 6246, 482, 6248, 6250, 6254, 6264, 6265,
+    6266, 6269, 581, 585, 6279, 593, 6293, 6296, 774, 6298, 6299, 6305, 6310, 1380, 6376, 583,
+    6406, 6562, 6571, 6657, 6708, 6714, 6727, 834, 7140, 7145, 4644, 353, 4645, 385, 407, 4662,
+    4666, 4669, 4672, 523, 545, 556, 4688, 644, 4690, 672, 712, 4707, 4713, 4715, 4722, 4740,
+    878, 882, 4744, 4747, 4748, 4752, 1007, 1139, 1347, 4806, 4807, 683, 4811, 4813, 4823, 308,
+    316, 322, 4855, 477, 485, 4871, 4883, 588, 775, 1380, 5018, 5041, 5065, 5117, 5125, 5126,
+    5132, 5136, 475, 482, 5141, 547, 548, 550, 5151, 5152, 5153, 627, 647, 660, 715, 5176,
+    745, 763, 5195, 5196, 5197, 788, 789, 790, 829, 5225, 5226, 5229, 884, 5230, 5231, 5233,
+    5237, 956, 1083, 5257, 318, 319, 5425, 385, 413, 5439, 5440, 5444, 5446, 482, 5455, 5457,
+    5468, 715, 5483, 5487, 5494, 5500, 5501, 5516, 5523, 5525, 5530, 5534, 5535, 5537, 1281, 5849,
+    5882, 5885, 5898, 5920, 5966, 5969, 5972, 419, 5980, 5982, 445, 5985, 5986, 5987, 5990, 482,
+    483, 492, 6000, 6001, 553, 6008, 6014, 6019, 652, 6026, 716, 6042, 6046, 6051, 6056, 818,
+    837, 840, 6067, 6075, 6076, 6077, 6080, 887, 6087, 897, 6088, 6093, 6095, 936, 6104, 6108,
+    6111, 6121, 1111, 6127, 1374, 6157, 6159, 6466, 6534, 6540, 383, 6580, 6587, 6592, 6597, 6598,
+    6620, 956, 6630, 6636, 339, 6657, 6659, 509, 653, 6708, 6709, 6714, 6727, 6736, 1013, 1078,
+    583, 6804, 6810, 440, 6953, 6967, 7062, 547, 550, 7108, 556, 660, 716, 745, 7140, 4644,
+    466, 4688, 4690, 4700, 816, 844, 911, 4752, 946, 982, 4793, 4794, 4831, 484, 5126, 638,
+    647, 5165, 5166, 5175, 5213, 5225, 5230, 780, 5498, 5506, 5569, 5570, 326, 5575, 5579, 5580,
+    583, 5602, 5613, 5614, 5620, 834, 5622, 5640, 5650, 308, 5653, 5658, 5665, 5674, 476, 480,
+    5681, 5683, 501, 592, 774, 780, 5712, 5729, 5732, 5734, 5735, 5753, 1380, 5786, 502, 949,
+    5839, 5849, 5857, 5877, 5897, 5915, 5945, 5969, 5974, 6024, 6064, 6067, 6075, 6080, 6082, 895,
+    6093, 6095, 6118, 6121, 6130, 476, 6143, 484, 492, 493, 6148, 501, 582, 6153, 6169, 6172,
+    6176, 6204, 6215, 6216, 472, 6242, 319, 386, 6429, 6440, 6541, 383, 6543, 6547, 480, 6553,
+    484, 489, 6559, 495, 575, 6564, 6567, 6568, 593, 594, 600, 669, 674, 677, 700, 701,
+    6580, 6581, 771, 6582, 773, 776, 6584, 6585, 6586, 6587, 6588, 6589, 790, 798, 6592, 6597,
+    6598, 6601, 6604, 951, 963, 1070, 1199, 1247, 6629, 6630, 1261, 1341, 1350, 1373, 1375, 1380,
+    6643, 1386, 339, 6647, 6656, 473, 652, 702, 806, 6709, 6712, 6714, 6724, 484, 6856, 6862,
+    572, 6864, 588, 1379, 6932, 6933, 710, 812, 6967, 898, 7093, 653, 7140, 4644, 4645, 4652,
+    418, 4690, 4722, 4744, 4752, 4867, 482, 4871, 4907, 775, 777, 4914, 4917, 800, 1373, 5126,
+    5151, 5161, 647, 660, 5169, 703, 5189, 789, 5205, 5211, 5213, 841, 844, 5220, 5225, 5230,
+    5252, 5416, 350, 5460, 587, 5471, 5481, 737, 5484, 5485, 5488, 5519, 5525, 5535, 5539, 5563,
+    5570, 489, 1380, 5703, 5793, 344, 5966, 5970, 5972, 5987, 652, 714, 719, 738, 837, 840,
+    851, 6067, 858, 6078, 6080, 6085, 6090, 6093, 6135, 6206, 6208, 6238, 471, 472, 6240, 6241,
+    6242, 6243, 6245, 6251, 6253, 6254, 492, 493, 6257, 501, 6263, 6264, 6265, 581, 6270, 6271,
+    6272, 6275, 6277, 595, 6295, 6297, 6299, 777, 6305, 6306, 6307, 6308, 790, 798, 6328, 6330,
+    6332, 945, 6335, 6366, 1333, 1334, 1335, 1338, 1339, 1347, 1354, 1360, 1383, 1386, 486, 6658,
+    512, 6694, 6709, 6714, 6734, 1098, 1112, 1126, 6967, 418, 7108, 7109, 647, 660, 7125, 844,
+    7137, 7153, 4695, 482, 4817, 4823, 4826, 4833, 1215, 4982, 4983, 4987, 5002, 5008, 866, 5018,
+    5070, 5073, 5225, 5226, 5372, 5607, 5736, 5869, 6000, 6082, 6159, 6185, 6254, 641, 6296, 6324,
+    6374, 6407, 6409, 6410, 6412, 6413, 6415, 6416, 6418, 6467, 6483, 6484, 6521, 6557, 700, 783,
+    6598, 6626, 6630, 6631, 6641, 700, 6788, 324, 386, 700, 472, 1363, 669, 418, 4684, 4712,
+    4752, 5117, 5133, 5225, 316, 5439, 5461, 743, 5970, 6062, 837, 6066, 6067, 6075, 914, 6204,
+    6209, 6215, 6216, 6249, 6253, 576, 6268, 6303, 6587, 6722, 4644, 4712, 858, 5421, 564, 308,
+    5660, 5661, 328, 472, 5682, 5683, 5710, 5711, 1363, 5764, 806, 6057, 6067, 6077, 6078, 6111,
+    6209, 6213, 6215, 6246, 585, 6274, 6294, 6302, 6695, 4722, 5199, 5205, 5226, 5232, 5466, 5496,
+    5518, 5535, 812, 4670, 4672, 473, 4678, 4744, 4751, 4755, 383, 5125, 5216, 5226, 5675, 477,
+    7133, 4644, 418, 421, 4670, 745, 4733, 4744, 4752, 484, 5125, 5205, 350, 5506, 5535, 5611,
+    480, 5680, 5687, 581, 583, 5694, 5695, 590, 5704, 5705, 1334, 1339, 1344, 1347, 1352, 1359,
+    5763, 949, 473, 6714, 350, 5125, 5133, 5160, 1108, 5506, 5132, 1007, 5071, 5073, 5076, 5077,
+    5321, 5352, 5597, 5610, 5920, 6215, 492, 1242, 1383, 6409, 6415, 6542, 6630, 1261, 403, 4787,
+    5151, 5225, 574, 5791, 5882, 914, 6468, 6483, 318, 6567, 6589, 6592, 6597, 6604, 6608, 775,
+    422, 7108, 5634, 5681, 6151, 6275, 6307, 6467, 6475, 6566, 6592, 4827, 580, 438, 6248, 6274,
+    6464, 6467, 6473, 6483, 323, 4826, 4827, 4828, 4833, 4835, 580, 5333, 5779, 6466, 6473, 6475,
+    6563, 6630, 1261, 4826, 861, 4919, 5074, 957, 5361, 5369, 5623, 939, 5869, 6135, 6154, 688,
+    6158, 6316, 6407, 641, 6415, 6464, 6477, 494, 6588, 324, 372, 6804, 6810, 853, 5004, 5750,
+    9196, 9204, 6475, 9279, 9371, 5999, 6475, 638, 316, 9557, 9844, 9852, 6042, 817, 10212, 7054,
+    523, 780, 1116, 10387, 10390, 5226, 889, 10449, 647, 10473, 774, 4827, 4828, 10592, 6447, 10630,
+    10631, 6618, 743, 10727, 10730, 6307, 10802, 5108, 5111, 5146, 5518, 10915, 10932, 10934, 7099, 5209,
+    6056, 5441, 5352, 6062, 5225, 7137, 7347, 3137, 7485, 7545, 7557, 7758, 7762, 3471, 3474, 3499,
+    7798, 7950, 7971, 3917, 3124, 8121, 8125, 2572, 8155, 8168, 3529, 8221, 8400, 8409, 3534, 8428,
+    8463, 2661, 8472, 8485, 8496, 8573, 3716, 8684, 8686, 8688, 8689, 8693, 8698, 3841, 8705, 4134,
+    4135, 8774, 8779, 3613, 8795, 7648, 7703, 3286, 7866, 8011, 8031, 8080, 8089, 8232, 8248, 3323,
+    8319, 8330, 8454, 8465, 3137, 8524, 8539, 2, 8556, 8582, 7315, 7703, 7820, 7846, 7897, 8228,
+    8327, 8331, 8625, 2666, 8014, 8016, 8051, 3138, 8319, 8327, 8509, 2779, 7315, 7416, 7438, 3613,
+    2588, 7871, 7880, 7893, 7901, 3957, 8171, 2646, 8228, 8232, 8283, 8302, 8303, 8306, 3583, 8315,
+    3711, 3716, 8324, 8325, 8341, 8342, 4146, 2566, 8454, 8459, 8493, 2924, 8499, 8500, 8537, 3485,
+    8581, 8598, 4544, 8851, 7291, 7379, 7383, 7387, 3419, 172, 7446, 7448, 3628, 7477, 3285, 7555,
+    7568, 7571, 3660, 3856, 3859, 7595, 2713, 7704, 7730, 7738, 3897, 3898, 7819, 7901, 7990, 8031,
+    2939, 8232, 2800, 2833, 8302, 8304, 3704, 8331, 8342, 8375, 3134, 8397, 8400, 8404, 2586, 8485,
+    2902, 8493, 8500, 8520, 8534, 8536, 8547, 117, 2, 8624, 8629, 2, 8636, 3285, 8642, 8668,
+    8672, 3784, 8718, 8721, 3228, 2609, 2696, 8903, 8907, 7535, 7248, 2735, 7285, 7286, 3977, 2589,
+    7875, 8341, 8342, 4077, 7270, 7289, 7314, 7324, 7508, 3695, 7545, 7546, 7614, 7764, 7781, 8014,
+    3296, 8062, 2926, 2927, 8207, 3510, 3746, 8294, 8319, 8375, 8463, 8522, 2594, 2, 8624, 8625,
+    8629, 2, 8635, 8661, 8703, 8791, 8794, 8904, 7244, 2849, 7302, 7310, 7897, 8016, 2, 8232,
+    3323, 3351, 8358, 8499, 2594, 3784, 2824, 2, 7291, 7314, 7315, 7615, 7672, 7697, 7701, 7837,
+    2714, 2729, 2796, 3208, 3228, 8301, 3569, 9000, 9001, 9050, 7291, 7322, 2841, 7628, 2969, 7704,
+    3799, 7837, 7852, 3510, 3742, 8274, 8319, 2651, 7305, 7576, 7580, 7613, 2857, 7665, 7675, 7692,
+    7855, 7867, 7868, 7891, 7901, 3770, 3267, 8319, 8321, 8629, 3126, 8788, 3613, 8792, 8794, 8796,
+    7354, 7366, 3611, 7377, 7429, 7453, 7476, 7480, 7483, 7526, 2965, 3286, 7557, 7567, 7568, 7570,
+    7572, 7576, 7578, 7582, 7589, 7602, 4278, 2979, 7730, 2562, 7758, 7763, 2853, 7799, 7901, 7920,
+    3510, 8020, 8042, 8120, 8121, 8122, 3466, 8125, 2, 8193, 8223, 8224, 8331, 3278, 8396, 3286,
+    8403, 8404, 8405, 8406, 8409, 8414, 8424, 8499, 8522, 8556, 8582, 2, 8625, 8626, 2, 8629,
+    8630, 2, 8633, 8637, 8642, 3319, 3364, 8653, 3464, 3501, 3552, 8696, 8716, 4139, 3100, 8769,
+    8788, 3613, 8790, 8791, 8794, 8795, 8796, 3695, 8801, 8881, 3551, 7314, 7315, 7324, 2841, 3228,
+    7689, 7690, 7704, 7830, 2, 2924, 2926, 8031, 4546, 8089, 8241, 8246, 8250, 8260, 8263, 8286,
+    8287, 8330, 8363, 4146, 8493, 8496, 3118, 155, 156, 8534, 8539, 8543, 8561, 3100, 8849, 9053,
+    2727, 7258, 148, 3040, 3065, 3222, 7293, 7295, 7314, 7318, 2609, 3487, 7621, 7627, 7628, 7637,
+    3051, 3360, 3363, 7697, 3742, 7703, 3914, 7835, 7900, 4395, 8193, 8213, 8228, 8229, 2795, 8239,
+    8245, 132, 8247, 3025, 8271, 8278, 3286, 3364, 3401, 3431, 8296, 8303, 8319, 8320, 8341, 3928,
+    8683, 8734, 2586, 8782, 8788, 3913, 8832, 2979, 8851, 8852, 3051, 9052, 3322, 7344, 7385, 7688,
+    7703, 7704, 2594, 3123, 7960, 3504, 7972, 7981, 3502, 3634, 8331, 8340, 8393, 8485, 2594, 8659,
+    8739, 8740, 2, 2, 2941, 8762, 8763, 8764, 3150, 3285, 3286, 3476, 8782, 8783, 3613, 8790,
+    8792, 8793, 8794, 8795, 8796, 8797, 2, 2, 2, 4559, 2926, 8938, 4556, 3352, 8989, 2,
+    9053, 7248, 7273, 3279, 7684, 7688, 7697, 7698, 7847, 7855, 7900, 8118, 2647, 8450, 2892, 2893,
+    2895, 8483, 8488, 2932, 8499, 8500, 8502, 158, 8510, 8519, 8537, 8542, 3490, 8552, 8556, 158,
+    2986, 9050, 9051, 7576, 8502, 8539, 8629, 2, 8635, 3511, 7291, 3419, 8314, 3813, 8305, 3129,
+    3502, 3785, 2895, 2896, 7314, 7315, 3655, 3655, 3424, 7324, 8046, 8213, 2591, 8788, 8524, 8761,
+    2824, 8522, 3115, 2, 2, 3784, 2609, 2696, 8903, 8907, 11726, 11769, 2667, 7359, 7379, 7380,
+    7381, 7382, 3420, 12096, 8327, 8302, 9252, 908, 5712, 5713, 9539, 9556, 9868, 9873, 5969, 400,
+    697, 6064, 10104, 10128, 1116, 753, 5886, 1380, 4672, 4705, 10380, 6114, 10460, 780, 10717, 6119,
+    10746, 10802, 778, 317, 5128, 5193, 10956, 573, 6545, 6554, 11111, 601, 782, 954, 6626, 1374,
+    475, 6898, 11237, 6036, 6217, 11290, 9713, 6467, 6468, 5695, 10004, 545, 10212, 10272, 10282, 10478,
+    10500, 5744, 10596, 6468, 4684, 4756, 914, 927, 5984, 875, 10931, 10968, 6475, 6466, 6932, 9982,
+    6430, 4806, 6446, 10613, 337, 4827, 10193, 4746, 10236, 5530, 6410, 10607, 10871, 4969, 6475, 9354,
+    9355, 9380, 6215, 4696, 4697, 10010, 6092, 6419, 6475, 6783, 10387, 4791, 4806, 10478, 10547, 10567,
+    10572, 6183, 6188, 6328, 484, 583, 6431, 10605, 10629, 6609, 6906, 396, 4681, 550, 740, 702,
+    713, 10846, 5179, 10857, 10860, 418, 510, 10967, 702, 729, 6464, 9175, 6249, 6294, 6371, 582,
+    1347, 9391, 6243, 6246, 502, 5659, 583, 787, 9568, 6088, 6647, 6650, 9635, 574, 6475, 5028,
+    9844, 881, 894, 9946, 6475, 10167, 10212, 889, 4829, 5004, 5029, 6154, 10574, 380, 10613, 10631,
+    10671, 5518, 495, 5706, 1321, 654, 10832, 5133, 10846, 10860, 10884, 10900, 380, 10920, 452, 5568,
+    5608, 5660, 583, 5704, 11045, 6142, 11087, 6535, 489, 1380, 5597, 4751, 317, 11430, 11435, 9523,
+    4920, 853, 9167, 9168, 308, 4700, 10014, 10628, 10629, 10632, 6856, 9149, 317, 6464, 9204, 9220,
+    6249, 6371, 780, 9542, 4906, 4983, 317, 10193, 5709, 10252, 749, 754, 763, 6018, 6056, 6468,
+    5912, 6410, 10671, 10802, 5518, 4712, 11018, 11021, 5608, 11035, 11068, 1336, 11268, 6302, 11431, 9118,
+    5050, 9188, 9197, 6430, 4746, 4828, 5744, 583, 10652, 10858, 4712, 318, 6535, 5015, 9175, 6464,
+    9201, 9202, 9204, 6475, 9205, 6483, 9207, 9661, 6049, 9788, 9797, 9970, 601, 4906, 4996, 325,
+    5594, 6134, 6157, 11542, 11543, 11602, 9175, 9215, 583, 5065, 5262, 6475, 6566, 9969, 5622, 809,
+    6459, 10536, 10592, 4803, 9191, 6225, 6206, 6208, 6262, 9659, 5070, 5073, 9733, 6063, 6308, 317,
+    9992, 10005, 10006, 10039, 6475, 5658, 6410, 6418, 11026, 5495, 11257, 11258, 322, 6215, 11275, 6300,
+    11295, 5674, 5679, 6024, 9294, 9298, 957, 6412, 4907, 1340, 5695, 5968, 806, 9568, 828, 9571,
+    923, 6206, 6208, 9586, 6210, 6211, 9593, 6293, 6294, 9625, 702, 721, 5277, 5028, 341, 484,
+    4977, 5064, 6067, 6475, 6412, 6056, 319, 10225, 5881, 5886, 10323, 1374, 1380, 10422, 10462, 10466,
+    10613, 480, 5695, 5753, 10711, 1371, 10717, 10727, 10739, 10857, 10888, 10932, 10968, 5572, 5581, 5608,
+    777, 5612, 11027, 798, 5649, 11039, 5705, 5736, 5813, 582, 1340, 6036, 6134, 11134, 11165, 572,
+    451, 5568, 6204, 6207, 6209, 6215, 6244, 6247, 6256, 11272, 6296, 11285, 6300, 11290, 791, 6329,
+    6369, 11309, 6064, 316, 6464, 9202, 9204, 9205, 6481, 9220, 583, 5594, 9775, 9777, 6475, 9960,
+    719, 745, 10212, 745, 10282, 10491, 5056, 5060, 5062, 949, 10519, 10523, 10551, 5799, 6468, 6905,
+    6906, 6908, 10846, 5188, 5476, 1070, 1097, 10900, 10907, 6006, 6107, 451, 11366, 6475, 766, 9135,
+    949, 5340, 5388, 577, 9177, 889, 6464, 6470, 9210, 4747, 6003, 4980, 9679, 5065, 9695, 5352,
+    5798, 771, 6409, 879, 9800, 6473, 1083, 4977, 10048, 7029, 10422, 10450, 10472, 10473, 4994, 5005,
+    5048, 701, 10499, 5312, 10533, 5613, 5694, 592, 5812, 5842, 5847, 5920, 6058, 10570, 10595, 10597,
+    10629, 316, 11099, 4689, 654, 11246, 6213, 1073, 322, 480, 6464, 6475, 5352, 11605, 6473, 1245,
+    9247, 9315, 472, 9800, 6467, 6475, 6484, 4712, 5486, 5755, 6042, 818, 10142, 721, 6267, 10613,
+    10626, 10695, 10832, 4712, 11066, 4869, 779, 5234, 11222, 11224, 11226, 5489, 1108, 581, 5695, 418,
+    11246, 11247, 11248, 6215, 6220, 11264, 6246, 11275, 6268, 11277, 11283, 768, 6294, 6296, 6311, 11294,
+    957, 7142, 5181, 5225, 7137, 588, 6407, 6475, 4920, 9154, 5681, 9768, 6250, 9788, 6409, 9790,
+    9791, 9983, 9992, 10048, 5525, 4794, 4659, 353, 358, 367, 5112, 396, 5122, 5145, 10839, 5205,
+    10857, 10861, 5238, 1126, 10873, 10883, 5979, 5997, 574, 10926, 6079, 1126, 583, 11602, 6409, 6412,
+    11604, 6212, 10864, 10907, 5612, 5655, 818, 9175, 5899, 10585, 783, 6175, 5506, 6038, 6538, 5116,
+    399, 9201, 9202, 9205, 6483, 6319, 6319, 5908, 9220, 905, 10450, 717, 6204, 10890, 11221, 317,
+    5518, 5469, 6535, 4751, 317, 11430, 11435, 12368, 4827, 4828, 4835, 1326, 6243, 9305, 501, 6264,
+    581, 9310, 5900, 12765, 6447, 6154, 12254, 8213, 8642, 12167, 8395, 12037, 12132, 7284, 3124, 7570,
+    8761, 8473, 11904, 8014, 8463, 8230, 8629, 11968, 11980, 8499, 7560, 3894, 8688, 12129, 4084, 4124,
+    7567, 11968, 7355, 12059, 12063, 8256, 2942, 7379, 7387, 10931, 10449, 5704, 12841, 5661, 545, 6460,
+    9166, 5487, 6077, 11221, 10818, 5611, 10193, 4743, 10474, 5608, 12624, 6216, 880, 5983, 6699, 11111,
+    12800, 6862, 1379, 9567, 12624, 501, 11136, 12721, 5234, 932, 482, 1373, 2609, 12233, 7284, 8938,
+    4556, 12209, 7709, 3851, 4751, 12914, 9166, 5225, 7137, 11281, 6558, 6642,
+};
+
+constexpr uint16_t ru_levels[] = {
+    0, 2, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+    81, 0, 0, 114, 0, 0, 81, 0, 0, 81, 0, 0, 0, 0, 81, 0,
+    81, 0, 81, 81, 161, 161, 161, 81, 81, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 193, 0, 0, 193, 0, 193, 0, 0, 193, 0, 193, 0, 193, 0, 193,
+    193, 0, 193, 0, 0, 193, 193, 193, 0, 0, 193, 0, 0, 193, 0, 0,
+    193, 0, 0, 193, 0, 0, 193, 0, 0, 193, 0, 0, 193, 0, 193, 0,
+    0, 193, 193, 0, 193, 193, 0, 0, 193, 193, 193, 193, 193, 193, 193, 0,
+    193, 193, 226, 273, 0, 0, 273, 273, 0, 0, 273, 0, 273, 0, 0, 0,
+    306, 0, 0, 0, 0, 273, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0,
+    0, 273, 273, 353, 306, 273, 385, 306, 353, 417, 450, 498, 0, 546, 273, 0,
+    546, 353, 0, 0, 595, 273, 498, 417, 306, 417, 306, 417, 417, 0, 353, 353,
+    0, 658, 353, 353, 353, 306, 0, 706, 273, 0, 0, 755, 0, 0, 306, 273,
+    417, 306, 0, 706, 0, 595, 450, 0, 385, 0, 417, 306, 417, 417, 385, 353,
+    0, 819, 498, 353, 0, 881, 546, 0, 417, 0, 0, 546, 306, 881, 0, 306,
+    0, 546, 0, 0, 417, 0, 915, 546, 0, 417, 0, 0, 306, 546, 0, 0,
+    0, 0, 546, 0, 0, 0, 353, 306, 385, 706, 595, 353, 0, 595, 353, 0,
+    306, 273, 915, 306, 353, 417, 0, 595, 306, 353, 417, 273, 0, 306, 915, 417,
+    417, 353, 0, 0, 498, 353, 353, 273, 417, 0, 0, 0, 273, 0, 0, 273,
+    0, 0, 0, 0, 0, 417, 0, 0, 0, 0, 450, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 385, 0, 273, 273, 0, 595, 306, 385, 306, 0, 0, 595,
+    0, 0, 306, 306, 881, 306, 0, 706, 0, 306, 0, 0, 417, 0, 417, 306,
+    0, 0, 417, 0, 0, 0, 0, 0, 0, 978, 450, 0, 417, 0, 353, 706,
+    1026, 353, 0, 306, 273, 706, 273, 0, 0, 0, 306, 417, 353, 0, 0, 417,
+    273, 417, 0, 0, 353, 0, 0, 498, 353, 353, 273, 306, 0, 0, 0, 273,
+    0, 0, 273, 0, 273, 273, 0, 0, 0, 417, 273, 0, 273, 450, 0, 0,
+    0, 273, 0, 0, 0, 0, 0, 0, 0, 273, 273, 0, 0, 0, 0, 385,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1073, 0, 0, 306, 0, 417,
+    306, 353, 0, 306, 0, 0, 595, 0, 417, 306, 881, 417, 0, 417, 306, 881,
+    417, 595, 417, 306, 417, 0, 0, 0, 353, 0, 881, 0, 353, 0, 417, 0,
+    0, 915, 0, 0, 0, 353, 0, 306, 306, 417, 306, 353, 417, 0, 595, 273,
+    0, 915, 595, 417, 273, 0, 0, 0, 0, 0, 0, 881, 353, 0, 0, 1106,
+    915, 706, 306, 0, 417, 595, 0, 0, 595, 306, 417, 306, 0, 417, 0, 306,
+    306, 0, 417, 306, 417, 0, 706, 417, 0, 0, 0, 417, 881, 0, 0, 353,
+    595, 306, 417, 306, 353, 0, 595, 353, 0, 306, 273, 0, 306, 353, 1026, 0,
+    306, 306, 353, 706, 273, 417, 306, 417, 417, 0, 353, 0, 881, 498, 353, 353,
+    595, 0, 273, 385, 0, 273, 0, 0, 1153, 417, 273, 0, 0, 0, 450, 0,
+    0, 0, 273, 450, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 417, 273,
+    273, 0, 0, 595, 0, 306, 1073, 0, 0, 0, 0, 226, 0, 0, 306, 0,
+    706, 0, 595, 306, 0, 706, 385, 417, 226, 417, 417, 0, 0, 0, 0, 1186,
+    0, 1073, 0, 306, 0, 417, 306, 0, 0, 417, 0, 0, 306, 595, 417, 306,
+    0, 417, 306, 1106, 306, 0, 417, 417, 417, 306, 417, 417, 417, 0, 0, 0,
+    881, 0, 0, 353, 1234, 498, 385, 1234, 498, 498, 273, 498, 0, 0, 0, 881,
+    273, 353, 385, 353, 306, 0, 353, 0, 450, 0, 385, 385, 0, 1234, 353, 0,
+    0, 498, 353, 498, 0, 595, 0, 417, 306, 498, 417, 306, 0, 0, 595, 306,
+    385, 306, 0, 706, 0, 1283, 306, 0, 417, 306, 1345, 306, 706, 417, 417, 0,
+    417, 417, 881, 0, 498, 273, 0, 0, 0, 0, 273, 0, 0, 273, 0, 0,
+    0, 0, 0, 273, 0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 417, 0, 273, 273, 0, 306, 306, 417, 306, 0, 0, 0, 1377, 0,
+    306, 0, 417, 306, 0, 0, 0, 546, 306, 0, 417, 0, 0, 306, 706, 0,
+    0, 0, 0, 0, 1186, 0, 0, 353, 306, 498, 417, 1026, 353, 0, 450, 353,
+    0, 450, 0, 0, 306, 353, 385, 0, 595, 306, 0, 0, 450, 0, 595, 417,
+    0, 0, 0, 0, 0, 0, 0, 0, 1073, 306, 0, 417, 306, 0, 0, 306,
+    1073, 0, 595, 306, 417, 306, 0, 706, 306, 306, 306, 1409, 0, 0, 417, 0,
+    915, 0, 0, 1409, 0, 0, 1073, 0, 0, 353, 306, 273, 0, 306, 353, 881,
+    0, 353, 0, 306, 0, 353, 306, 1409, 0, 0, 306, 0, 353, 0, 881, 0,
+    306, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 306, 881, 0, 0, 0,
+    0, 0, 0, 0, 595, 0, 417, 306, 0, 1442, 306, 306, 0, 0, 417, 273,
+    417, 306, 0, 0, 0, 0, 417, 0, 1186, 0, 0, 0, 0, 915, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 417, 306, 0, 0, 306, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 385, 0, 0, 0, 0,
+    0, 0, 385, 0, 0, 385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    385, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385,
+    0, 0, 0, 881, 0, 0, 1186, 0, 0, 0, 0, 0, 881, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 881, 881, 881, 0,
+    0, 273, 417, 0, 0, 0, 0, 0, 0, 0, 0, 881, 881, 0, 881, 0,
+    1073, 0, 0, 881, 385, 881, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0,
+    273, 273, 273, 0, 0, 273, 0, 0, 273, 0, 273, 0, 417, 0, 1490, 0,
+    0, 0, 0, 0, 0, 273, 0, 273, 0, 0, 0, 0, 0, 0, 0, 273,
+    273, 0, 0, 0, 0, 0, 273, 0, 0, 273, 0, 273, 273, 0, 0, 0,
+    0, 0, 0, 0, 273, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    306, 0, 0, 417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1538,
+    1538, 1538, 1538, 1538, 0, 0, 0, 1585, 0, 0, 0, 0, 1585, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1585, 0, 1585, 1617, 0, 1585, 0,
+    0, 0, 0, 0, 0, 1649, 0, 0, 0, 0, 0, 1681, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1585, 0, 1585, 0, 0, 0, 1585, 1585, 1585,
+    0, 1585, 0, 1617, 1585, 0, 1585, 0, 1585, 1585, 0, 0, 0, 1713, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 1746, 0, 0,
+    1746, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746,
+    0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1793, 0, 0, 1746, 0, 1746, 1746,
+    0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1825, 1746, 0, 0, 1746, 1793, 0,
+    1746, 0, 1746, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746,
+    0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1793, 0, 0,
+    1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 1746, 1746, 0, 1746,
+    1746, 1825, 1746, 0, 0, 1746, 1793, 0, 0, 1746, 1746, 1746, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 1746, 0, 1746, 1746, 0, 1746, 1857, 0, 1746, 1746, 1746, 0,
+    0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1793,
+    0, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1825, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746,
+    1746, 0, 0, 1746, 1793, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 1746,
+    1746, 0, 0, 1746, 0, 0, 1746, 1746, 1793, 0, 0, 1746, 0, 1746, 1746, 0,
+    0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1825, 0, 0, 1746, 0, 0,
+    1746, 1793, 0, 0, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 1746, 1746,
+    1746, 1746, 1746, 0, 1746, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746,
+    0, 1746, 0, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1746, 1746, 1825, 1746, 1746, 1793, 0, 1746, 1746, 1746, 1746, 0, 0, 1746,
+    0, 0, 1746, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 1746, 1746, 1857,
+    0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 1746, 0, 0, 1746, 1746, 0, 1746, 1857, 0, 0, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1825, 0, 0, 1746, 0, 0, 1746, 1889, 0, 0, 1746, 1746, 1746, 1746,
+    1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746, 0, 0,
+    1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 1746, 1746, 1746, 0, 1746, 0, 1746, 0,
+    1746, 1746, 0, 0, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 0,
+    1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746,
+    0, 0, 1746, 0, 0, 1746, 1746, 1793, 0, 0, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1825, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1921, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 1746, 1746, 1921, 0,
+    0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 1746, 1746, 0, 1746,
+    0, 0, 1746, 1746, 1746, 0, 1746, 1746, 1921, 0, 0, 1746, 1746, 0, 1746, 1746,
+    1746, 1746, 1746, 1825, 1746, 1921, 0, 0, 1746, 1953, 0, 0, 1746, 1746, 1921, 0,
+    0, 1746, 1857, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 1746, 0,
+    1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 1746, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 0,
+    1746, 0, 1746, 1746, 1746, 0, 1746, 1746, 0, 0, 1746, 1825, 1746, 0, 0, 1746,
+    1793, 0, 1746, 0, 1746, 1746, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0,
+    1746, 0, 0, 1746, 1825, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 0,
+    0, 1746, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 1746, 1746, 0, 1746, 1746, 0, 1746, 0, 1746, 1746, 1825, 1746, 1857,
+    1746, 1793, 0, 0, 1746, 1746, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 1746, 1746, 1746, 1746, 0, 1746, 1746, 0, 0, 1746, 0, 1746, 0,
+    0, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746,
+    1793, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 1793, 0, 0,
+    1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1825,
+    1746, 1746, 1793, 0, 1746, 0, 1746, 1746, 1746, 0, 1746, 1921, 0, 0, 1746, 0,
+    1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1921, 0, 0, 1746, 0, 1746,
+    0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 1921,
+    0, 0, 1746, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 1921, 0, 0, 1746,
+    0, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 0, 1746, 1746, 1825, 1746, 1921,
+    0, 0, 1746, 1793, 0, 0, 1746, 0, 1746, 1921, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1953, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1793, 0, 1746, 0, 0,
+    1746, 1793, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 0, 0,
+    1746, 0, 1746, 1746, 1825, 0, 1746, 0, 0, 1746, 1793, 0, 0, 1746, 0, 1746,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1793, 0, 0, 1746,
+    1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0,
+    1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 1746, 1889, 0, 0, 1746, 0, 1746,
+    0, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1825, 1746, 0, 0, 1746,
+    1953, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    1746, 0, 1746, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 1746,
+    1746, 1746, 1746, 1746, 1746, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 0,
+    0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 1746, 1746, 1746, 0, 0, 1746,
+    1746, 0, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1825, 1746, 1746, 1793, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 1746,
+    1746, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 0, 1746,
+    0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 1921, 0, 0, 1746, 1746,
+    1746, 1746, 1746, 1746, 1746, 1825, 1746, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1857, 0,
+    0, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746,
+    1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1746, 1825, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746,
+    1746, 1746, 1746, 0, 0, 1746, 0, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1825, 1746, 1746, 1793, 0, 0, 1746, 1746, 1746, 1746, 0, 1746, 0, 0,
+    1746, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0,
+    1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 1746, 1746, 0, 0,
+    1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1825, 1746, 1746, 1953, 0, 0,
+    1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 0,
+    1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1825, 1746, 1746, 1793, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 1746, 0, 1746,
+    1746, 0, 1746, 1746, 0, 1746, 0, 0, 1746, 1746, 0, 1746, 0, 1746, 0, 1746,
+    1746, 0, 0, 1746, 0, 1746, 0, 1746, 0, 1746, 1746, 0, 1746, 0, 0, 1746,
+    0, 0, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746,
+    1746, 1746, 1746, 1746, 0, 1746, 1746, 1746, 0, 1746, 0, 1746, 1746, 0, 1746, 0,
+    0, 1746, 1746, 0, 1746, 1746, 1746, 0, 1746, 1746, 0, 1746, 0, 1746, 1746, 0,
+    0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746, 0, 1746, 1746, 1746, 1746,
+    0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 1746, 0, 1746, 1746, 1746, 0, 1746,
+    1746, 0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 0, 1746, 0,
+    1746, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0,
+    1746, 1746, 1746, 0, 1746, 1746, 1746, 0, 1746, 0, 1746, 1746, 0, 1746, 0, 0,
+    1746, 0, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746,
+    1746, 1746, 0, 1746, 1746, 1746, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 0, 1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 1746, 1746, 0, 1746, 1746,
+    1746, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746, 0, 0,
+    1746, 0, 0, 1746, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 1746, 0,
+    1746, 1746, 1746, 1746, 1746, 1746, 1793, 1746, 1746, 1746, 1746, 0, 1746, 0, 0, 1746,
+    1746, 0, 1746, 1746, 0, 1746, 0, 1746, 1746, 1746, 0, 0, 1746, 0, 0, 1746,
+    0, 1746, 0, 0, 1746, 1746, 0, 0, 1746, 0, 0, 1746, 0, 0, 1746, 0,
+    0, 1746, 1746, 1746, 0, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746,
+    1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1985, 1985, 1985, 0, 0, 0, 2017, 2049, 2081, 0, 2081, 2081, 0, 0, 2113, 2081,
+    2113, 0, 2081, 2145, 2113, 0, 0, 2145, 2017, 2145, 0, 0, 2113, 0, 0, 0,
+    1985, 0, 0, 0, 1985, 2113, 0, 1985, 0, 2177, 2177, 0, 0, 2049, 2210, 2113,
+    2049, 2257, 1985, 0, 0, 2049, 2081, 2081, 2017, 0, 2081, 2081, 0, 2081, 2081, 2145,
+    2289, 0, 0, 0, 2145, 2113, 0, 0, 0, 0, 2049, 0, 0, 2081, 1985, 1985,
+    1985, 1985, 0, 2145, 0, 2081, 0, 0, 0, 2081, 0, 2081, 2081, 0, 2081, 2049,
+    2081, 2081, 2081, 2081, 2322, 0, 0, 0, 0, 0, 0, 2081, 0, 0, 2081, 2081,
+    0, 2081, 1985, 2081, 0, 2081, 2081, 2113, 1985, 0, 0, 1985, 1985, 2369, 2402, 1985,
+    0, 2449, 2145, 2113, 2049, 2113, 0, 2113, 0, 1985, 1985, 1985, 0, 0, 0, 2049,
+    0, 1985, 0, 0, 2177, 2481, 0, 0, 2481, 2514, 0, 2481, 2145, 2481, 1985, 2145,
+    2481, 0, 0, 2481, 0, 2049, 0, 0, 0, 2145, 2562, 0, 2145, 0, 0, 0,
+    0, 0, 2610, 0, 0, 0, 0, 0, 2481, 0, 0, 0, 0, 0, 2145, 2081,
+    2145, 2658, 2081, 0, 2017, 2705, 0, 0, 2049, 2210, 1985, 2145, 2145, 2049, 0, 0,
+    0, 2481, 0, 0, 2049, 0, 0, 0, 2369, 2481, 2481, 2081, 2081, 0, 2257, 2481,
+    0, 2257, 2257, 0, 2210, 0, 2257, 0, 2257, 2257, 2257, 2257, 2177, 2177, 0, 2177,
+    0, 0, 2257, 0, 2049, 0, 2737, 1985, 1985, 0, 2113, 0, 2145, 2145, 2145, 0,
+    2257, 2257, 2770, 0, 2369, 0, 2017, 0, 2610, 2177, 2257, 0, 0, 0, 2257, 2818,
+    2177, 0, 0, 0, 2257, 2257, 0, 0, 0, 2866, 2866, 2257, 2081, 0, 2914, 0,
+    2962, 2962, 2914, 0, 2257, 2449, 3010, 2145, 2322, 2449, 2610, 0, 0, 2257, 0, 0,
+    2818, 0, 2177, 2818, 2177, 0, 2257, 0, 2145, 2145, 2257, 2257, 2257, 0, 2257, 0,
+    2257, 2049, 0, 1985, 2177, 2081, 0, 3058, 2210, 0, 0, 0, 0, 0, 0, 2081,
+    0, 0, 0, 2866, 0, 2081, 0, 0, 0, 0, 2017, 0, 2610, 0, 0, 2049,
+    0, 2481, 2113, 0, 0, 0, 0, 0, 2481, 0, 0, 0, 0, 0, 0, 2145,
+    0, 3105, 3105, 0, 2049, 2049, 2210, 0, 2049, 1985, 0, 0, 2081, 2257, 2017, 2081,
+    0, 2145, 2081, 0, 0, 2481, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3138,
+    2145, 0, 0, 2177, 0, 2737, 0, 2049, 0, 2017, 0, 3187, 2770, 0, 0, 0,
+    2610, 0, 2049, 0, 0, 0, 0, 2177, 0, 2049, 0, 0, 0, 0, 0, 2081,
+    2081, 0, 0, 2081, 2081, 2081, 2177, 0, 2449, 2866, 1985, 0, 0, 0, 2049, 0,
+    0, 3058, 2145, 2145, 0, 0, 2145, 2145, 0, 3251, 2145, 2145, 2257, 2145, 2145, 2257,
+    2257, 2257, 1985, 1985, 0, 0, 0, 0, 2081, 2081, 0, 0, 2081, 0, 2113, 2081,
+    2081, 2081, 2081, 0, 1985, 0, 0, 3314, 0, 1985, 0, 0, 0, 0, 0, 0,
+    0, 0, 2610, 1985, 2113, 0, 2145, 2402, 2145, 0, 0, 0, 2017, 0, 0, 0,
+    0, 0, 2017, 2017, 2210, 1985, 1985, 1985, 0, 2081, 1985, 2081, 2866, 2866, 0, 2081,
+    2081, 2081, 2081, 2081, 2081, 2017, 2081, 0, 0, 0, 2113, 0, 0, 2017, 0, 2866,
+    2177, 2818, 2081, 3362, 0, 2081, 3362, 2113, 0, 0, 2113, 0, 2177, 0, 2177, 0,
+    3362, 3362, 0, 2145, 0, 2113, 3105, 2145, 3410, 3105, 2145, 2081, 2113, 2081, 2081, 2081,
+    0, 2081, 2081, 2081, 2081, 2081, 3458, 0, 2081, 2081, 2145, 3506, 2017, 2145, 2081, 0,
+    2081, 0, 0, 2081, 2081, 2049, 2081, 2081, 0, 2081, 2081, 2145, 2177, 0, 0, 1985,
+    0, 0, 0, 0, 0, 0, 0, 2145, 2081, 2113, 1985, 1985, 0, 2049, 0, 2145,
+    2113, 2962, 2113, 0, 0, 2113, 3554, 2737, 2369, 3601, 2962, 2481, 2818, 0, 2610, 2818,
+    2610, 2145, 2113, 2113, 2049, 0, 2017, 3058, 2369, 2866, 3636, 2737, 2369, 2113, 2145, 2145,
+    2481, 2610, 2177, 2177, 0, 2289, 0, 0, 0, 2818, 0, 0, 0, 2962, 0, 2177,
+    0, 2177, 2177, 2177, 2177, 0, 2818, 0, 2177, 0, 2081, 2081, 3458, 0, 2081, 2081,
+    2257, 2081, 2081, 2017, 0, 0, 3362, 0, 0, 2210, 0, 0, 0, 0, 0, 2481,
+    0, 0, 2481, 2369, 0, 0, 0, 2017, 0, 2145, 3058, 2145, 2145, 3058, 2145, 0,
+    2257, 0, 0, 2257, 2610, 2257, 0, 0, 3714, 2818, 2257, 2257, 0, 0, 2177, 0,
+    2257, 2177, 2257, 2257, 2081, 0, 0, 2081, 2081, 2113, 2081, 2081, 0, 2049, 3314, 2481,
+    3763, 2322, 0, 2145, 0, 0, 0, 2481, 0, 0, 3251, 1985, 0, 3251, 2145, 2257,
+    2257, 2257, 2481, 2113, 2113, 2177, 0, 0, 0, 0, 2177, 2113, 0, 0, 2113, 2402,
+    0, 2402, 0, 2866, 3138, 2081, 2866, 3362, 3458, 2081, 0, 2145, 2866, 1985, 2017, 2145,
+    2113, 0, 2081, 0, 3362, 0, 2049, 2081, 0, 1985, 1985, 0, 0, 2610, 0, 1985,
+    3458, 2610, 0, 3010, 0, 2081, 2049, 2177, 3458, 0, 0, 2017, 0, 0, 2017, 0,
+    0, 0, 2177, 0, 2113, 2145, 0, 2017, 0, 0, 2402, 2113, 2177, 2257, 0, 2177,
+    2257, 2257, 2081, 0, 2113, 2081, 2081, 0, 0, 2081, 0, 2081, 0, 0, 0, 0,
+    2081, 0, 0, 2449, 0, 0, 2113, 2113, 0, 0, 2257, 0, 2113, 2113, 2049, 0,
+    0, 0, 0, 0, 3105, 2081, 0, 0, 0, 2113, 2402, 0, 0, 2449, 2049, 2113,
+    0, 0, 3458, 0, 2081, 0, 2113, 2705, 1985, 1985, 1985, 3138, 2113, 2369, 2402, 0,
+    1985, 2113, 0, 0, 2113, 3138, 2113, 2113, 2113, 3826, 0, 2257, 2113, 2257, 0, 2257,
+    0, 2257, 2257, 0, 0, 2962, 2257, 2257, 0, 2257, 2257, 0, 2081, 0, 2081, 2177,
+    2145, 0, 0, 0, 2257, 2049, 0, 0, 2257, 2449, 0, 0, 0, 0, 0, 2017,
+    2145, 2257, 0, 0, 0, 0, 0, 0, 2257, 2257, 2257, 0, 0, 0, 0, 0,
+    2257, 0, 0, 0, 2257, 0, 0, 0, 0, 0, 0, 3138, 2449, 3138, 0, 0,
+    2449, 2017, 0, 2017, 0, 0, 1985, 0, 2481, 2257, 0, 2481, 0, 2257, 0, 2257,
+    0, 0, 2481, 0, 0, 0, 2257, 0, 0, 2113, 0, 0, 0, 0, 2369, 0,
+    3010, 2257, 2081, 2081, 2081, 2081, 2081, 0, 2113, 2369, 0, 0, 0, 0, 0, 0,
+    2257, 0, 0, 0, 2257, 2081, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1985, 2402, 2113, 2369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2449, 0, 2049, 2449, 0, 2257, 0, 0, 2257, 0, 0, 2049,
+    0, 2257, 2257, 3138, 2257, 2257, 2257, 2257, 0, 2145, 2481, 2481, 2145, 2145, 2145, 2481,
+    0, 2145, 2145, 2145, 0, 2481, 2481, 2481, 2257, 0, 0, 0, 2145, 2481, 0, 2481,
+    0, 0, 0, 2257, 0, 2257, 0, 2481, 0, 0, 0, 0, 0, 0, 0, 1985,
+    2177, 2481, 2017, 1985, 2962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2481, 0, 2770, 0, 0, 0, 2770, 0, 2610, 0, 2481, 0, 0, 0,
+    0, 2818, 2481, 2481, 0, 0, 0, 2481, 1985, 0, 2145, 2866, 2081, 1985, 1985, 0,
+    0, 0, 0, 2737, 0, 0, 2962, 2962, 2369, 1985, 2145, 2369, 2049, 2049, 0, 0,
+    0, 0, 0, 2610, 0, 0, 0, 0, 0, 2610, 0, 0, 2610, 2145, 0, 2145,
+    0, 2481, 2402, 0, 2705, 0, 1985, 0, 2402, 0, 1985, 3458, 2113, 0, 0, 2113,
+    2610, 0, 2177, 2481, 2449, 0, 0, 2177, 0, 0, 3875, 2818, 0, 0, 0, 2481,
+    0, 0, 0, 2177, 2449, 0, 2818, 0, 2481, 0, 0, 0, 0, 2737, 2049, 2481,
+    2481, 1985, 1985, 0, 0, 2049, 0, 2177, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2818, 2177, 2866, 2866, 2081, 3138, 2113, 0, 2113, 3138, 2113, 0, 0, 0,
+    0, 3138, 3938, 2402, 0, 2113, 0, 0, 2049, 2481, 2369, 2113, 1985, 2257, 2257, 2145,
+    2257, 2145, 2145, 2145, 2257, 2257, 2257, 3987, 0, 2610, 2017, 2369, 2145, 0, 0, 2257,
+    0, 2049, 2257, 2145, 0, 0, 0, 0, 1985, 2113, 3058, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2081, 2049, 0, 1985, 0, 2049, 2610, 0, 1985, 0,
+    0, 0, 0, 0, 0, 0, 2081, 0, 0, 2210, 2737, 1985, 1985, 1985, 0, 2177,
+    0, 1985, 3314, 0, 0, 2257, 0, 2017, 0, 2081, 0, 2017, 2081, 2081, 2081, 2017,
+    2081, 2017, 0, 2145, 0, 0, 1985, 0, 2113, 2145, 2017, 2177, 0, 0, 0, 2081,
+    2177, 0, 2113, 0, 0, 0, 2113, 0, 0, 0, 0, 0, 2081, 0, 3362, 2081,
+    2081, 2081, 0, 0, 2145, 2081, 2081, 2081, 2081, 0, 1985, 0, 3362, 0, 0, 0,
+    0, 0, 2081, 0, 2145, 0, 3362, 0, 2177, 2257, 2257, 0, 2017, 0, 2113, 0,
+    0, 0, 2257, 0, 0, 2177, 0, 0, 0, 2017, 0, 0, 0, 2017, 2145, 0,
+    0, 0, 2081, 2081, 2113, 0, 1985, 2081, 0, 0, 0, 1985, 0, 1985, 1985, 1985,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2449, 0, 0, 0, 1985, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2017, 4050, 2017, 2610, 0, 0, 0, 0, 0, 2481, 0, 0, 4099, 0,
+    4162, 0, 2610, 0, 0, 0, 0, 0, 2369, 0, 2145, 2113, 0, 0, 0, 2017,
+    3138, 0, 2017, 2481, 0, 0, 0, 2145, 0, 0, 0, 2177, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2257, 2257, 0, 0, 0,
+    0, 2081, 2081, 2081, 0, 2113, 2402, 2113, 1985, 0, 2402, 1985, 0, 2113, 0, 2113,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2818, 0, 0, 0,
+    0, 0, 0, 3458, 3362, 2081, 2449, 2177, 0, 0, 0, 0, 0, 0, 0, 2113,
+    0, 2818, 2610, 0, 2257, 0, 0, 2257, 2257, 0, 2113, 2402, 2049, 2113, 2369, 2017,
+    2113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2257, 0, 0, 0, 0, 0, 0, 1985, 2113, 1985, 0,
+    0, 2402, 2113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2257, 0, 0,
+    0, 0, 1985, 2113, 0, 2049, 0, 2049, 2113, 2113, 2113, 3458, 1985, 2257, 0, 2145,
+    0, 2257, 0, 2210, 2257, 2257, 2145, 2145, 2145, 2257, 2257, 2257, 2049, 2257, 0, 2257,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2610, 0,
+    0, 3058, 2113, 2145, 0, 2113, 2113, 2113, 2113, 2113, 2017, 2113, 2113, 0, 2610, 0,
+    0, 0, 0, 2481, 0, 0, 2049, 0, 0, 0, 1985, 2145, 0, 1985, 2049, 0,
+    0, 0, 0, 0, 0, 0, 2145, 0, 3058, 0, 0, 0, 0, 0, 0, 2145,
+    0, 3058, 0, 2113, 2049, 2610, 0, 2818, 0, 0, 0, 0, 0, 0, 0, 0,
+    2017, 0, 2145, 0, 0, 0, 2113, 0, 4210, 3458, 1985, 2113, 0, 1985, 2177, 1985,
+    0, 2145, 0, 2113, 2257, 2145, 0, 2145, 2145, 0, 2145, 0, 2145, 0, 2145, 2145,
+    0, 2257, 3105, 0, 2113, 1985, 2049, 0, 0, 1985, 0, 0, 0, 0, 0, 3826,
+    2049, 2658, 2658, 2145, 0, 3058, 2145, 2257, 0, 0, 2081, 2145, 0, 2017, 0, 2210,
+    1985, 0, 0, 1985, 2257, 2145, 0, 2145, 2257, 2257, 2257, 2049, 2113, 2049, 2145, 0,
+    0, 0, 0, 0, 2257, 2610, 0, 2113, 0, 2257, 0, 2257, 2562, 0, 2145, 0,
+    2866, 2145, 2145, 2145, 0, 0, 2049, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2818, 0, 2177, 2177, 0, 0, 0, 0, 0, 0, 0, 0, 2481, 0,
+    0, 2113, 0, 2017, 0, 0, 2049, 2610, 0, 0, 0, 0, 0, 0, 2257, 0,
+    0, 2145, 2145, 2145, 2145, 0, 0, 2145, 2145, 0, 2145, 2145, 0, 2145, 2145, 2145,
+    2081, 0, 0, 2113, 3138, 0, 3138, 3138, 2113, 0, 0, 0, 0, 0, 0, 2257,
+    2210, 0, 2481, 2481, 1985, 3601, 2369, 2481, 2049, 2257, 2257, 2257, 3314, 0, 0, 0,
+    0, 0, 0, 0, 0, 2113, 0, 0, 2049, 0, 0, 2081, 1985, 2081, 2081, 2113,
+    2113, 2113, 0, 0, 1985, 0, 2017, 1985, 1985, 2049, 1985, 2113, 3362, 2081, 2081, 2049,
+    2081, 2081, 4258, 2081, 2081, 2081, 0, 2081, 2081, 2113, 2017, 0, 2081, 1985, 1985, 0,
+    1985, 1985, 1985, 2210, 1985, 2113, 0, 2081, 2081, 2081, 0, 2081, 0, 2017, 2081, 2081,
+    2081, 2081, 0, 2081, 0, 1985, 2081, 2113, 1985, 2449, 0, 2081, 2145, 2113, 2113, 2081,
+    0, 2081, 0, 2081, 0, 2081, 2081, 0, 2257, 2081, 0, 2177, 1985, 2017, 2049, 2113,
+    0, 2113, 2049, 2049, 0, 2257, 2081, 0, 2017, 2017, 2113, 2113, 2017, 1985, 2210, 0,
+    0, 0, 0, 1985, 2481, 2369, 0, 0, 4306, 0, 0, 0, 1985, 0, 0, 2049,
+    2481, 2113, 2113, 2113, 0, 2481, 0, 0, 2481, 0, 0, 2081, 2081, 2081, 2113, 0,
+    4355, 0, 2145, 0, 1985, 2866, 0, 2737, 0, 3058, 3058, 2017, 3058, 2737, 0, 2177,
+    0, 2610, 0, 0, 0, 2081, 0, 2658, 2962, 4355, 2177, 0, 0, 2177, 0, 2177,
+    0, 0, 0, 0, 2081, 2081, 3362, 2145, 2145, 2257, 3362, 2257, 2257, 2145, 0, 2369,
+    2481, 0, 2481, 2113, 2145, 2113, 2049, 2049, 0, 0, 0, 2049, 2210, 0, 2177, 0,
+    2737, 0, 3362, 4355, 2866, 1985, 0, 0, 0, 0, 0, 0, 2049, 0, 0, 2177,
+    2481, 2481, 2658, 2113, 2145, 2658, 2145, 2145, 2113, 2866, 2113, 2145, 2113, 2481, 2257, 2257,
+    2145, 2145, 2257, 2257, 2257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2049,
+    2610, 0, 2610, 0, 0, 0, 0, 0, 0, 0, 2081, 2113, 0, 0, 2962, 3601,
+    0, 2017, 2081, 2145, 0, 0, 2481, 2481, 2481, 2481, 2481, 0, 0, 0, 2177, 2049,
+    2049, 2177, 0, 1985, 1985, 1985, 4418, 1985, 0, 2449, 4418, 2113, 2017, 2017, 1985, 2113,
+    2113, 0, 3458, 0, 1985, 2113, 2113, 2369, 2402, 1985, 0, 2049, 2113, 2113, 0, 2017,
+    0, 1985, 0, 0, 0, 2017, 2017, 0, 2113, 2017, 1985, 2113, 1985, 2113, 2017, 0,
+    1985, 0, 2402, 2017, 0, 0, 2113, 2113, 0, 2049, 0, 2113, 2113, 0, 2369, 0,
+    2402, 0, 1985, 2113, 0, 0, 0, 2113, 0, 0, 2177, 2113, 2113, 2113, 2113, 2049,
+    0, 0, 2049, 2049, 2049, 2369, 0, 2017, 2017, 1985, 0, 2081, 2081, 0, 2081, 2081,
+    2177, 2449, 2113, 0, 2113, 0, 0, 2737, 2113, 2113, 0, 2081, 1985, 0, 2081, 0,
+    2402, 2081, 2081, 2113, 2081, 2113, 2113, 2081, 2081, 2081, 2081, 2081, 2081, 2402, 0, 2081,
+    2081, 2081, 2081, 0, 2113, 2113, 0, 2081, 2081, 3362, 2402, 2113, 2049, 2049, 0, 2081,
+    2402, 2402, 2049, 2113, 0, 2113, 2017, 2177, 2081, 2081, 2081, 2081, 2049, 2049, 1985, 2081,
+    2449, 2017, 2081, 2081, 2081, 0, 2081, 2049, 2081, 2369, 2113, 0, 2081, 2081, 0, 2081,
+    0, 0, 2145, 2017, 0, 2081, 2081, 2866, 2866, 2081, 2081, 2081, 2081, 2081, 0, 2113,
+    2017, 0, 2177, 0, 2145, 2113, 3105, 2145, 3105, 2081, 2081, 2081, 2081, 0, 2081, 2081,
+    3458, 2081, 2145, 2017, 2081, 2081, 0, 2081, 2081, 2049, 2081, 2081, 2081, 2081, 0, 0,
+    0, 0, 0, 4465, 0, 4497, 4465, 0, 0, 0, 4529, 0, 0, 0, 0, 4529,
+    4497, 0, 4465, 0, 4561, 4594, 4641, 0, 0, 4561, 4465, 4497, 4561, 4465, 0, 4529,
+    0, 0, 0, 0, 0, 4674, 0, 4465, 4561, 4594, 0, 0, 4722, 0, 4561, 0,
+    0, 0, 0, 0, 4769, 4561, 0, 4529, 4465, 0, 0, 0, 4594, 4594, 0, 0,
+    0, 0, 0, 0, 0, 0, 4529, 0, 0, 4529, 0, 0, 0, 4529, 4802, 4641,
+    4529, 4529, 0, 4529, 4529, 4529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4850, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4850, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4897, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4961, 0, 0, 4961, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4961, 0, 0, 0, 4961, 0, 0, 4961, 0, 0, 0, 0,
+    0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4993, 0, 0, 4993, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4850, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5025, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4961, 0, 0, 0, 0, 0, 0, 4897, 4897, 0, 0, 4897,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4897, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4850, 0, 4850, 0, 4850,
+    0, 0, 4850, 0, 0, 0, 4850, 4961, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5058, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4897, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4897, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5105, 0, 0, 0, 0, 4961,
+    0, 0, 0, 4961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4929, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4850, 0, 0, 0, 0, 4850,
+    0, 4850, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4897, 5105, 0, 0, 5138, 0, 0,
+    0, 0, 0, 0, 4897, 0, 0, 4961, 0, 0, 0, 0, 0, 4961, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4993, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4993, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4929, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5185, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5217, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5217, 0,
+    0, 5217, 0, 0, 0, 0, 5250, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4929, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5297, 5329, 5361, 5393,
+    5425, 5457, 5489, 5361, 5329, 5522, 5570, 0, 5489, 5329, 0, 5489, 5489, 5329, 0, 0,
+    5361, 5618, 5665, 5489, 5329, 5329, 5329, 5698, 0, 5361, 0, 5361, 5361, 0, 0, 0,
+    5746, 5393, 0, 5570, 0, 5665, 5793, 5297, 5793, 5457, 5425, 5489, 5793, 5793, 0, 0,
+    0, 5570, 5825, 5793, 0, 0, 5489, 0, 5859, 0, 5329, 5457, 5618, 5489, 5921, 5297,
+    0, 0, 0, 5329, 0, 0, 0, 0, 5953, 0, 0, 5329, 0, 5746, 5393, 5393,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5985, 5953, 5393, 5361, 5361, 5793, 0,
+    0, 5425, 0, 5361, 0, 5985, 5297, 5297, 5985, 5393, 5489, 5457, 5393, 5825, 5329, 5361,
+    5329, 5746, 5329, 5393, 5921, 5665, 5361, 5361, 5329, 5329, 5746, 5570, 6018, 5393, 5665, 5570,
+    5457, 0, 5746, 5665, 5746, 0, 0, 5329, 5329, 5329, 5329, 5329, 5953, 6066, 5489, 6066,
+    5297, 0, 6066, 5489, 6066, 5489, 5489, 5489, 0, 5489, 5297, 0, 0, 5393, 5329, 0,
+    6114, 0, 6162, 5329, 5393, 5921, 5361, 5329, 5361, 0, 5329, 5425, 5425, 5297, 5489, 0,
+    6066, 6210, 5489, 5953, 0, 5985, 6066, 6258, 6066, 5985, 5985, 5489, 5489, 5489, 0, 0,
+    5985, 0, 0, 0, 5985, 5489, 5489, 5746, 5457, 5457, 5921, 5361, 5746, 5329, 5746, 5825,
+    6162, 5825, 5361, 5361, 5489, 5457, 5393, 6305, 6305, 5425, 6305, 5793, 5746, 0, 5665, 5457,
+    0, 5329, 5329, 5329, 6339, 5457, 5393, 5329, 5329, 0, 5953, 5953, 0, 6402, 6258, 5489,
+    5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 6402, 6402, 5489, 0, 5393, 5361, 5361, 5329,
+    5329, 6450, 5361, 5793, 5793, 5457, 5361, 5361, 0, 0, 5425, 5361, 6162, 5489, 6210, 5985,
+    6210, 5793, 6210, 5953, 6066, 5985, 5985, 5985, 5985, 5985, 6498, 6210, 0, 6546, 6546, 5570,
+    5665, 5746, 5665, 5361, 6402, 0, 5393, 6162, 5953, 5457, 5793, 6594, 5297, 5921, 5329, 5329,
+    5361, 5329, 5393, 5329, 5361, 5825, 5489, 5985, 0, 0, 5793, 5489, 5489, 6402, 0, 5793,
+    5793, 5793, 5793, 5793, 5793, 5489, 5793, 5489, 5489, 5489, 5489, 5297, 5297, 5297, 5489, 0,
+    5489, 5489, 5489, 5489, 5489, 5297, 5329, 6162, 5329, 5425, 5825, 5825, 5746, 5329, 0, 5361,
+    0, 5793, 5665, 5361, 5985, 5985, 5985, 5985, 5985, 5985, 0, 5985, 5985, 5985, 5985, 5985,
+    5985, 5489, 5985, 5985, 5985, 5985, 5985, 5425, 5985, 5985, 5985, 5985, 6641, 5746, 0, 5329,
+    0, 5457, 6210, 5793, 0, 6210, 6210, 5793, 5985, 0, 6114, 6114, 6305, 6339, 5329, 5570,
+    5329, 5825, 5361, 6305, 5329, 5665, 5393, 0, 6674, 5425, 5329, 5361, 5489, 5329, 5425, 0,
+    5329, 5329, 5329, 0, 5329, 5457, 0, 5329, 5393, 0, 0, 5393, 0, 5489, 5825, 0,
+    6498, 5825, 6402, 0, 5329, 0, 5425, 6162, 5393, 6162, 5425, 5425, 5793, 0, 5746, 5393,
+    0, 0, 0, 0, 0, 5425, 5793, 5793, 0, 5793, 5393, 6305, 6674, 6162, 0, 5329,
+    5985, 0, 0, 0, 5985, 6723, 5985, 5985, 5489, 5489, 6258, 5793, 5489, 5489, 6258, 0,
+    5489, 5793, 5489, 5489, 0, 5985, 5985, 6066, 6258, 5985, 5985, 5985, 5985, 5985, 5985, 5985,
+    5953, 5953, 5985, 5985, 5793, 6066, 5489, 6066, 5489, 5489, 6258, 5489, 6258, 5393, 5665, 5329,
+    5457, 5457, 5985, 5361, 6786, 5329, 5457, 5425, 5425, 5746, 5793, 5393, 6833, 5393, 0, 5457,
+    5425, 5985, 0, 5361, 5985, 5361, 6866, 0, 5793, 5522, 0, 0, 5793, 0, 6210, 5361,
+    6210, 5329, 5793, 5570, 0, 5489, 5489, 5489, 5489, 5329, 5329, 5361, 5985, 0, 0, 0,
+    0, 5489, 5618, 5985, 6914, 0, 5489, 5489, 6258, 5489, 0, 5746, 5329, 5329, 0, 5393,
+    0, 6833, 6962, 5457, 6833, 5297, 5361, 6114, 5985, 5361, 6114, 5361, 5361, 5329, 6114, 6114,
+    5361, 5361, 6114, 0, 5457, 0, 5425, 5329, 5361, 0, 0, 6498, 5665, 5457, 5793, 5793,
+    5489, 5746, 0, 6866, 0, 5393, 5329, 5329, 5393, 5985, 5393, 5985, 5985, 5985, 5489, 5489,
+    5393, 5985, 5985, 0, 0, 5329, 7009, 6866, 0, 5361, 5985, 5985, 0, 5393, 5985, 0,
+    5825, 0, 5297, 0, 0, 5361, 5297, 0, 0, 5361, 5361, 0, 5570, 0, 5665, 0,
+    7042, 0, 5425, 0, 0, 5793, 6498, 5393, 5859, 0, 5570, 5329, 0, 5489, 0, 0,
+    0, 0, 0, 5985, 5985, 0, 0, 5489, 0, 5489, 5297, 0, 0, 5361, 5361, 5985,
+    5361, 5793, 5457, 5329, 5985, 5297, 5297, 5985, 5665, 0, 6498, 5361, 5425, 0, 0, 5361,
+    0, 5361, 5361, 6114, 5329, 5329, 5457, 5489, 5489, 6402, 0, 5489, 6546, 6546, 6114, 5361,
+    5393, 5793, 5793, 5457, 0, 5985, 5985, 5425, 5425, 6162, 5425, 5985, 0, 5393, 5825, 5425,
+    5425, 6162, 5425, 5825, 5393, 0, 5425, 5425, 5489, 0, 5489, 5793, 5489, 5985, 5793, 6066,
+    6210, 5489, 5489, 5329, 5489, 5489, 6833, 5329, 5329, 5985, 5329, 0, 5361, 6162, 5665, 6498,
+    5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5489, 5793, 5489, 5489, 5329,
+    6162, 5329, 5361, 5985, 5361, 5361, 5793, 5793, 6674, 5329, 5329, 5489, 5489, 5985, 7091, 7091,
+    5985, 5361, 5329, 5489, 5985, 5489, 0, 5489, 5329, 5489, 5425, 5489, 5489, 5985, 5489, 7154,
+    5489, 7203, 6674, 5793, 6305, 6962, 5329, 5329, 5985, 6962, 0, 5425, 5425, 5793, 5793, 5793,
+    5489, 5489, 5489, 0, 5329, 5297, 5825, 6114, 0, 0, 5297, 5329, 5793, 5329, 5489, 5489,
+    6833, 0, 5361, 5361, 5361, 5618, 0, 5489, 0, 0, 5393, 5329, 5297, 5921, 0, 0,
+    5425, 5570, 5329, 5489, 5489, 5361, 5361, 5746, 0, 5859, 0, 0, 5859, 5825, 0, 5825,
+    5393, 5329, 0, 0, 5457, 5953, 0, 5953, 5329, 5329, 5329, 5393, 5985, 5985, 0, 5985,
+    5297, 5361, 5329, 0, 6114, 5985, 5746, 5985, 5985, 5825, 5329, 5825, 5329, 6498, 0, 5618,
+    0, 6833, 5570, 0, 0, 5393, 5393, 0, 0, 0, 5361, 5393, 5393, 5393, 0, 6866,
+    7266, 5489, 0, 5985, 5425, 5393, 5618, 5361, 5361, 0, 0, 5618, 5297, 5297, 5329, 5665,
+    5618, 7314, 5665, 5361, 5361, 5361, 5329, 5489, 5393, 5329, 5297, 5329, 7009, 6866, 5329, 0,
+    0, 5746, 5665, 5361, 5953, 5953, 5746, 0, 0, 5361, 6114, 5746, 5489, 5489, 5489, 5489,
+    5329, 5457, 5746, 7362, 5921, 5329, 0, 0, 5793, 5297, 5985, 6258, 5489, 5489, 6258, 5297,
+    5489, 5297, 6258, 5665, 5953, 5793, 5793, 5297, 6402, 5489, 6402, 0, 6305, 5361, 0, 0,
+    6305, 5425, 6674, 5361, 5361, 5665, 5361, 5953, 5329, 0, 5985, 5457, 0, 5985, 5953, 5985,
+    5489, 7154, 5489, 5985, 5985, 5985, 5489, 5985, 5985, 5985, 5985, 5985, 5985, 5985, 5489, 5457,
+    5985, 0, 5489, 5985, 5361, 5985, 0, 5393, 5985, 5361, 5985, 5425, 5457, 5361, 5953, 5457,
+    5746, 5393, 5457, 5361, 5393, 5953, 5953, 6305, 5793, 5329, 5746, 5793, 5329, 0, 6162, 5361,
+    5425, 0, 0, 0, 6114, 5329, 5329, 6066, 5361, 0, 5746, 5361, 5393, 7411, 5361, 5457,
+    5793, 0, 6114, 5329, 5329, 6114, 0, 5361, 6114, 5361, 5425, 6305, 6305, 5425, 0, 5665,
+    5329, 5793, 5457, 5329, 5665, 6210, 5329, 5665, 6674, 5361, 5361, 5425, 5329, 6114, 0, 5329,
+    0, 6674, 0, 5361, 5793, 5361, 0, 5329, 0, 5329, 6210, 5361, 5457, 6114, 5793, 5425,
+    5329, 5793, 5361, 7474, 5361, 5361, 5425, 0, 7522, 5393, 5793, 0, 5953, 5953, 5953, 5953,
+    5953, 5361, 5361, 6305, 6305, 5361, 5361, 5393, 7411, 5457, 5329, 5329, 5329, 5329, 5329, 5361,
+    5746, 6210, 0, 5665, 7474, 0, 5746, 5329, 5297, 5825, 0, 0, 5329, 5329, 0, 5361,
+    5746, 0, 0, 5457, 0, 5361, 5793, 5361, 5329, 5329, 0, 5329, 6114, 0, 5489, 5489,
+    5457, 6402, 7569, 5489, 7569, 7569, 5489, 7569, 5489, 6402, 5393, 5361, 5329, 5361, 5361, 0,
+    6674, 5361, 0, 5361, 5361, 6114, 6305, 5746, 5985, 5618, 6402, 6114, 7474, 5361, 5457, 5393,
+    5489, 5489, 5489, 5489, 5329, 5361, 0, 5425, 6114, 5425, 5393, 5329, 5329, 6339, 7569, 6162,
+    5425, 0, 5361, 6114, 6962, 6162, 5457, 5425, 5457, 5489, 5665, 5425, 0, 5329, 0, 5489,
+    5329, 5329, 6114, 5793, 6114, 5425, 0, 5393, 5425, 6162, 5361, 6114, 5361, 5361, 5361, 6114,
+    5361, 6162, 0, 5329, 0, 6114, 0, 5425, 6162, 6114, 5825, 6114, 6114, 6114, 6162, 6114,
+    5329, 5361, 5393, 5457, 5329, 5329, 5825, 0, 0, 5361, 5665, 0, 0, 5825, 6498, 5618,
+    6498, 5361, 5329, 5361, 5361, 5329, 5361, 5329, 6162, 5361, 5393, 0, 6305, 5665, 6305, 5329,
+    5361, 0, 0, 6114, 5329, 5793, 5329, 0, 5297, 5618, 5522, 5425, 5425, 0, 5329, 5329,
+    0, 0, 5329, 5329, 5618, 5457, 5361, 5793, 0, 5985, 0, 6498, 5425, 5793, 0, 5297,
+    5522, 5393, 0, 5618, 5329, 0, 0, 0, 0, 5297, 5793, 0, 0, 7602, 6258, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5859, 0, 5489, 5489, 5618, 0, 5329, 5329,
+    5489, 0, 5297, 5522, 0, 5793, 6962, 0, 5329, 6962, 0, 0, 5985, 5457, 5393, 5618,
+    5793, 5489, 0, 5361, 5489, 5297, 5425, 5393, 0, 0, 6258, 5297, 5457, 6258, 0, 5361,
+    5793, 5793, 0, 0, 6498, 5329, 0, 0, 0, 5361, 0, 5329, 5297, 6498, 0, 5457,
+    0, 5393, 5665, 0, 5489, 5297, 5297, 0, 5489, 5329, 0, 5489, 0, 0, 0, 0,
+    5329, 5522, 5329, 7154, 6674, 6258, 0, 0, 0, 5329, 5985, 5985, 5985, 5297, 6498, 6866,
+    0, 0, 5489, 5361, 0, 0, 5489, 0, 0, 0, 5393, 0, 0, 0, 0, 0,
+    6962, 5329, 5329, 6674, 5329, 0, 5489, 0, 0, 5393, 5361, 5361, 5361, 5361, 6258, 5297,
+    6258, 0, 0, 0, 0, 5361, 0, 0, 0, 5393, 5425, 6114, 5297, 5297, 6258, 5297,
+    5425, 5393, 5393, 5793, 5793, 5793, 0, 5793, 5489, 5361, 5489, 5329, 5793, 5457, 5361, 5297,
+    5618, 5393, 5329, 0, 5361, 5329, 5329, 6833, 5665, 5329, 5329, 5329, 5361, 5457, 0, 0,
+    5329, 5361, 5329, 5329, 0, 5393, 5393, 0, 5329, 7009, 0, 0, 5746, 5329, 0, 5329,
+    5329, 5329, 5329, 0, 6674, 5746, 6305, 6305, 5457, 0, 5793, 7650, 0, 5985, 5793, 6402,
+    5793, 5793, 5793, 5793, 5985, 5985, 5985, 5489, 5489, 5793, 0, 5985, 5393, 6162, 0, 0,
+    0, 5425, 5425, 5425, 0, 0, 6114, 5361, 5425, 6305, 0, 5985, 5425, 5361, 6305, 5393,
+    0, 5425, 5425, 0, 5665, 5425, 5457, 6305, 5457, 5825, 5457, 0, 0, 6305, 5665, 5825,
+    6498, 5665, 5665, 5825, 5489, 0, 0, 0, 6498, 5570, 6305, 5665, 0, 6305, 6402, 5297,
+    6402, 0, 6402, 5665, 0, 5361, 5393, 5361, 0, 5329, 5329, 5953, 5746, 0, 5329, 5329,
+    5425, 0, 5329, 0, 0, 0, 5425, 0, 6674, 5953, 5953, 5953, 0, 0, 5746, 6498,
+    5953, 5665, 5457, 0, 5457, 6114, 5793, 5953, 5793, 5329, 5489, 5329, 5329, 5489, 5665, 6066,
+    5297, 5297, 0, 5297, 5489, 5953, 5297, 5489, 0, 5953, 5457, 5425, 5825, 5361, 0, 5425,
+    0, 5425, 5425, 5425, 6162, 5953, 6114, 0, 7698, 5361, 5425, 5953, 6114, 5953, 0, 6305,
+    5953, 5953, 5361, 5361, 6114, 6114, 5361, 6114, 5953, 0, 5361, 6114, 0, 0, 5361, 5361,
+    6114, 0, 5361, 5393, 5297, 5297, 5393, 6162, 5793, 0, 6162, 5793, 6114, 5425, 5665, 5425,
+    5425, 6162, 6162, 5953, 5425, 5425, 5361, 5393, 5793, 0, 6162, 5329, 5393, 5361, 0, 7745,
+    5665, 5570, 0, 0, 0, 6114, 5329, 0, 0, 5361, 6162, 5361, 0, 5361, 5953, 5425,
+    5425, 5425, 0, 6114, 5361, 0, 7154, 0, 5953, 0, 0, 0, 0, 0, 0, 5393,
+    6210, 6114, 5361, 5361, 5953, 5361, 6114, 5425, 5953, 5953, 7778, 5953, 0, 5825, 0, 5329,
+    5361, 5425, 5393, 5953, 5425, 5329, 5489, 5825, 0, 5393, 5329, 5618, 0, 5361, 5361, 5361,
+    5921, 0, 5297, 5361, 5953, 5665, 0, 0, 5793, 5457, 5665, 0, 5393, 5953, 5953, 5953,
+    5618, 6962, 5618, 5329, 5329, 5746, 5361, 5953, 0, 7698, 5425, 5953, 6305, 5953, 0, 5329,
+    5329, 5329, 5329, 0, 5985, 6210, 6210, 5361, 5329, 5746, 7827, 6498, 0, 6258, 5425, 5361,
+    5457, 5746, 7745, 5921, 0, 5329, 5329, 5361, 5361, 5329, 5793, 0, 6066, 5793, 5329, 5489,
+    0, 5489, 5985, 0, 5793, 5985, 0, 5793, 5793, 5953, 5953, 5985, 6258, 5297, 5297, 5985,
+    5825, 5985, 5297, 5793, 5489, 0, 6258, 6258, 6258, 6258, 6258, 5985, 5985, 5953, 7889, 5297,
+    6066, 5489, 5793, 6066, 6258, 5570, 5793, 6114, 5425, 6114, 0, 5361, 5361, 6114, 0, 5329,
+    0, 5425, 5361, 5425, 5489, 5489, 5489, 5489, 5489, 6066, 5489, 5489, 5489, 0, 5570, 5793,
+    5489, 5489, 5425, 5985, 6450, 0, 0, 5393, 5522, 0, 0, 5793, 0, 5329, 5953, 5953,
+    0, 0, 5665, 5297, 5489, 5489, 0, 0, 5489, 0, 5489, 5329, 5522, 5793, 5793, 5522,
+    7266, 5953, 5953, 5953, 5953, 6402, 5953, 5953, 5953, 0, 5953, 5953, 5489, 5953, 0, 0,
+    0, 0, 0, 5985, 5953, 0, 5489, 5793, 5793, 6305, 5953, 5953, 5953, 5953, 0, 0,
+    5665, 5297, 5570, 5457, 5393, 5329, 5361, 5921, 5825, 5665, 5665, 5361, 5457, 0, 5489, 0,
+    5297, 5793, 5489, 0, 5665, 5665, 0, 5746, 0, 0, 5393, 7745, 5329, 5329, 5425, 0,
+    5329, 0, 5329, 5361, 5361, 5985, 5985, 5985, 5985, 7922, 6210, 5985, 5793, 5985, 5985, 5329,
+    5361, 6305, 5457, 6305, 0, 6450, 6674, 5361, 7970, 0, 0, 6305, 5665, 6305, 0, 5825,
+    5329, 5425, 5329, 0, 5921, 0, 5985, 6210, 5985, 5793, 5793, 6114, 0, 6162, 5361, 6402,
+    6402, 6402, 6402, 5425, 5425, 0, 6114, 5793, 5329, 6162, 5425, 6210, 5793, 5793, 5953, 5953,
+    5953, 5361, 5953, 6114, 6114, 6114, 5793, 5393, 5457, 0, 6210, 5825, 5985, 0, 0, 5985,
+    5985, 5985, 0, 0, 8018, 0, 8067, 5985, 0, 5985, 5953, 5985, 0, 5985, 5985, 0,
+    5457, 5985, 5665, 5985, 0, 0, 0, 5793, 0, 5985, 0, 5665, 6546, 5793, 5953, 5489,
+    5793, 5489, 5489, 5985, 6210, 5985, 5985, 5985, 5297, 5985, 5985, 5985, 8067, 0, 5825, 5329,
+    0, 7203, 5361, 5361, 5329, 5953, 5953, 5953, 5746, 5329, 5361, 6305, 5457, 6305, 7970, 5665,
+    0, 5329, 5489, 5297, 5457, 5825, 5953, 5393, 6066, 5329, 5329, 5329, 5361, 5361, 5361, 5457,
+    0, 5361, 5746, 5425, 5665, 5457, 5985, 5746, 5489, 5921, 5361, 5297, 0, 6833, 5489, 5425,
+    5489, 5361, 5361, 5665, 0, 5985, 0, 0, 5393, 5985, 5985, 5985, 5297, 5297, 5329, 0,
+    5361, 5985, 5297, 5985, 5297, 5329, 5361, 5425, 8130, 5393, 5489, 5489, 5361, 5329, 5361, 5425,
+    5361, 5457, 5457, 5746, 6450, 5329, 5329, 0, 5793, 5329, 6210, 0, 5361, 5457, 0, 5985,
+    5457, 5457, 5985, 5489, 5425, 5489, 5489, 5489, 5489, 5393, 5329, 5425, 5985, 5921, 6210, 5985,
+    5985, 5985, 5985, 5953, 5489, 5985, 5489, 6066, 5953, 5489, 5329, 0, 5361, 5985, 6210, 5457,
+    5985, 5953, 8179, 5985, 0, 5489, 5985, 5953, 5393, 5329, 5361, 5457, 5425, 0, 5665, 5329,
+    5329, 5457, 5665, 5329, 5329, 0, 5329, 0, 6305, 6305, 5361, 5329, 5425, 5361, 5297, 5297,
+    5425, 5329, 5329, 5746, 5329, 0, 6498, 5361, 0, 5297, 5329, 5393, 5329, 5329, 5457, 6402,
+    6210, 5793, 5793, 5793, 5489, 5489, 0, 5489, 5793, 5489, 5793, 5793, 5489, 5793, 5793, 5793,
+    5793, 5489, 5329, 5921, 6114, 5329, 5457, 5921, 5393, 5746, 5393, 5329, 5329, 5618, 5489, 5329,
+    5329, 5329, 6866, 5457, 0, 7154, 5425, 5489, 5425, 5361, 5361, 5361, 5297, 5297, 5329, 5825,
+    5361, 5746, 5665, 5665, 5425, 5522, 5489, 5489, 0, 5665, 5489, 0, 5329, 5329, 5329, 5921,
+    5297, 5361, 5329, 5457, 5665, 0, 5570, 5393, 5746, 0, 5361, 5618, 5425, 0, 6641, 0,
+    5985, 5985, 5985, 5985, 5457, 5361, 5393, 5361, 5393, 5393, 0, 5329, 6674, 5665, 5985, 5457,
+    5457, 5297, 5297, 5985, 5361, 6210, 5985, 6258, 6114, 5985, 5329, 5793, 5746, 5825, 5297, 5361,
+    5297, 5393, 0, 5489, 0, 0, 5297, 5793, 5457, 5425, 0, 0, 0, 5361, 8241, 8273,
+    8307, 8241, 8369, 0, 8402, 8450, 8497, 8241, 8529, 0, 8497, 8450, 8561, 8402, 8369, 8593,
+    8307, 8241, 8626, 8673, 8241, 8241, 8706, 8369, 8369, 0, 8754, 0, 0, 8529, 8673, 8241,
+    8241, 8241, 0, 8497, 0, 8801, 8402, 8497, 8529, 8402, 8529, 8402, 8402, 0, 8529, 8801,
+    0, 8369, 8529, 8402, 8834, 8834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8881, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 8946, 0, 0, 8994, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9041, 0, 0,
+    0, 9041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9073, 0,
+    0, 0, 0, 0, 0, 0, 0, 9105, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8913, 0, 0, 0, 9041, 9041, 9041, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9170, 0, 0, 0, 0, 8913, 0, 0,
+    9041, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8946, 0, 0, 8913, 0,
+    0, 8946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9105, 9073, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9217, 9105, 9073, 0, 0, 0, 0, 0, 0, 9217,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9249, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8946, 8994, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9281, 9313, 9313, 9345, 9377, 9410, 9457, 9457, 9490, 9313,
+    9313, 9537, 9457, 9569, 9601, 9313, 9345, 9345, 9377, 9635, 9345, 9698, 9345, 9345, 9745, 9778,
+    9825, 9377, 9345, 9345, 9857, 9857, 9345, 9889, 9857, 9457, 9345, 9345, 9825, 9825, 9537, 9457,
+    9345, 9345, 9825, 9313, 9825, 0, 9921, 9281, 9281, 9954, 0, 10001, 10034, 10082, 10034, 9825,
+    9825, 9825, 9457, 9457, 9857, 9313, 9313, 9313, 10130, 10130, 10178, 10225, 9345, 10258, 10305, 9377,
+    9698, 10338, 9281, 9345, 10001, 9377, 9537, 9569, 10001, 9921, 9825, 9825, 10386, 9345, 9601, 9569,
+    9569, 9889, 10433, 9345, 9345, 9281, 9825, 0, 9490, 9457, 10225, 10467, 10530, 9698, 9569, 9569,
+    9569, 9345, 9345, 9345, 10578, 10578, 10530, 9377, 9377, 10530, 9345, 9889, 9569, 10130, 9537, 9889,
+    9889, 10305, 9889, 9377, 9313, 10626, 10626, 0, 9889, 9889, 9345, 10178, 9825, 9825, 9825, 9345,
+    9345, 9601, 9825, 9825, 9825, 9313, 10578, 10673, 9825, 9313, 9825, 9313, 9825, 9313, 9601, 10705,
+    9377, 9377, 9377, 9825, 9857, 9825, 9281, 9857, 9377, 9345, 10305, 0, 0, 10578, 9601, 9377,
+    9857, 9921, 9825, 10738, 9825, 9825, 9281, 9857, 9778, 0, 10305, 9825, 9569, 9569, 9281, 9825,
+    9313, 9825, 9345, 9345, 9345, 9345, 9457, 9345, 9345, 9345, 9377, 9825, 9457, 9457, 9825, 10785,
+    9490, 9345, 9457, 9457, 10467, 10001, 9345, 9377, 9377, 9377, 9345, 9345, 9345, 9825, 9825, 9857,
+    9825, 9825, 9857, 9857, 9313, 9345, 9345, 0, 9954, 9857, 9313, 9313, 9569, 10626, 9778, 9889,
+    10001, 9457, 9857, 9377, 9377, 10818, 9457, 9457, 9457, 9313, 9377, 9825, 9345, 9457, 10865, 9345,
+    9457, 9345, 9281, 9698, 10082, 9698, 9889, 9569, 10898, 9377, 10433, 9537, 9537, 9490, 10178, 9825,
+    9601, 9825, 9825, 10258, 9825, 9825, 9825, 9857, 9825, 10945, 9825, 9345, 9569, 10225, 9601, 10979,
+    9281, 10225, 11042, 9889, 9889, 10945, 10178, 9345, 0, 0, 9490, 10258, 0, 9345, 9857, 9825,
+    10386, 9601, 9857, 9601, 9825, 9698, 9825, 9825, 9345, 9457, 9345, 9825, 9345, 10338, 9490, 9490,
+    9490, 9569, 10530, 0, 9921, 0, 9825, 9345, 9313, 11090, 11139, 9857, 9313, 10433, 9313, 9313,
+    9857, 9345, 9345, 11090, 9537, 9537, 10738, 9457, 9825, 10130, 9345, 0, 9635, 9281, 9635, 9313,
+    9410, 9537, 9825, 9825, 9825, 9537, 9457, 9537, 9825, 9457, 9313, 9313, 10001, 11202, 10626, 9345,
+    9345, 9345, 9857, 11251, 0, 9778, 9345, 9889, 10738, 10738, 10001, 10738, 10738, 0, 0, 9345,
+    9601, 9410, 9345, 9313, 10001, 9410, 9745, 9921, 10626, 9377, 9825, 10626, 9825, 9457, 9857, 9313,
+    9825, 9825, 10578, 9825, 9825, 9457, 9457, 9457, 9457, 10578, 9345, 10386, 9345, 10001, 9345, 10578,
+    9745, 10001, 9825, 9825, 9825, 9921, 9825, 9825, 9825, 9825, 9825, 9825, 9825, 9825, 9825, 9825,
+    9825, 9825, 9313, 10898, 9857, 9825, 9857, 9857, 9490, 9825, 9490, 9490, 0, 9601, 10258, 10865,
+    9537, 9313, 9601, 9313, 9601, 9857, 0, 10979, 9954, 0, 9825, 9825, 9457, 9457, 0, 9345,
+    9345, 9345, 0, 9857, 10433, 0, 0, 9857, 9921, 9537, 10433, 9745, 9857, 10258, 9889, 11314,
+    9345, 9345, 9345, 9889, 9345, 9377, 9889, 9778, 9345, 10001, 11090, 9377, 10979, 9345, 9745, 9825,
+    9457, 10898, 9857, 10626, 9457, 9457, 10305, 9345, 9457, 10433, 0, 9281, 0, 9345, 9889, 9889,
+    9377, 9377, 9490, 9889, 10225, 9889, 9889, 9889, 9889, 9889, 9889, 9889, 9601, 9345, 9345, 9345,
+    9377, 9490, 10001, 9313, 9410, 9825, 9345, 9635, 9345, 9889, 9825, 9601, 9825, 9457, 9457, 10530,
+    10673, 11362, 9921, 9457, 9457, 9601, 9457, 9313, 10225, 9457, 9569, 9313, 9569, 10001, 9345, 0,
+    0, 9569, 9281, 10433, 9313, 9825, 9345, 10001, 9569, 9569, 9569, 9569, 9313, 9345, 9345, 10626,
+    9569, 9569, 9569, 10433, 10785, 9569, 9825, 9569, 9825, 9569, 9569, 9825, 11410, 9825, 9825, 9345,
+    9825, 10001, 9313, 10178, 10178, 9345, 9857, 9601, 9825, 9281, 9601, 9345, 9921, 9345, 9490, 9490,
+    9345, 9825, 9921, 9457, 10865, 9345, 9537, 9889, 9889, 9537, 9537, 9537, 9537, 9537, 9537, 9601,
+    9601, 9537, 9537, 9313, 10178, 10785, 9537, 0, 9537, 9281, 9537, 9313, 9345, 9345, 9490, 9490,
+    9345, 9825, 10626, 9377, 9825, 11458, 9778, 9601, 9345, 9281, 10305, 9345, 9377, 9377, 9569, 9345,
+    9345, 9601, 9825, 9825, 9825, 10865, 10865, 9377, 9825, 9313, 10305, 9410, 9313, 9745, 9601, 9313,
+    9377, 10225, 9345, 9825, 9457, 9457, 9825, 11505, 0, 11538, 0, 11505, 11505, 11505, 11505, 11505,
+    11505, 11505, 11586, 11633, 11666, 11505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11713, 11713, 11746, 11793, 0, 11826, 11874,
+    11923, 11985, 12019, 0, 12081, 11746, 0, 12113, 11923, 12145, 11874, 11985, 12178, 11985, 12019, 11985,
+    11713, 0, 0, 12225, 12259, 12081, 0, 12322, 0, 0, 12369, 12369, 0, 0, 0, 0,
+    0, 0, 0, 0, 12402, 12450, 12499, 12562, 12562, 12609, 12641, 12641,
+};
+
+constexpr uint8_t ru_level_data[] = {
+    0x01, 0x08, 0x11, 0x02, 0x1C, 0x02, 0x01, 0x02, 0x02, 0x15, 0x02, 0x15, 0x04, 0x30, 0x04, 0x04, 0x17, 0x04, 0x15,
+    0x04, 0x02, 0x15, 0x04, 0x01, 0x04, 0x2A, 0x04, 0x02, 0x04, 0x15, 0x16, 0x04, 0x01, 0x16, 0x04, 0x02, 0x17, 0x04,
+    0x02, 0x15, 0x16, 0x04, 0x03, 0x16, 0x04, 0x02, 0x2A, 0x04, 0x01, 0x16, 0x16, 0x04, 0x01, 0x16, 0x15, 0x04, 0x16,
+    0x04, 0x02, 0x17, 0x16, 0x04, 0x01, 0x29, 0x04, 0x17, 0x16, 0x04, 0x29, 0x04, 0x04, 0x15, 0x04, 0x17, 0x04, 0x16,
+    0x15, 0x04, 0x01, 0x2A, 0x04, 0x04, 0x15, 0x16, 0x04, 0x04, 0x04, 0x18, 0x04, 0x03, 0x04, 0x16, 0x16, 0x04, 0x15,
+    0x15, 0x05, 0x26, 0x1C, 0x05, 0x34, 0x05, 0x35, 0x05, 0x3A, 0x05, 0x36, 0x05, 0x33, 0x05, 0x08, 0x1C, 0x05, 0x02,
+    0x05, 0x08, 0x05, 0x03, 0x05, 0x06, 0x05, 0x01, 0x05, 0x04, 0x06, 0x2A, 0x06, 0x17, 0x06, 0x29, 0x06, 0x15, 0x06,
+    0x16, 0x06, 0x02, 0x06, 0x3E, 0x06, 0x2A, 0x15, 0x06, 0x01, 0x06, 0x40, 0x06, 0x02, 0x29, 0x06, 0x3D, 0x06, 0x16,
+    0x15, 0x06, 0x2B, 0x06, 0x03, 0x06, 0x03, 0x2A, 0x06, 0x02, 0x16, 0x06, 0x29, 0x16, 0x06, 0x01, 0x16, 0x06, 0x2C,
+    0x06, 0x3F, 0x06, 0x04, 0x17, 0x06, 0x2B, 0x16, 0x06, 0x02, 0x15, 0x06, 0x03, 0x3F, 0x06, 0x03, 0x16, 0x06, 0x01,
+    0x29, 0x06, 0x02, 0x17, 0x06, 0x18, 0x06, 0x16, 0x17, 0x06, 0x04, 0x17, 0x29, 0x06, 0x02, 0x2A, 0x15, 0x06, 0x02,
+    0x2A, 0x06, 0x15, 0x16, 0x06, 0x18, 0x17, 0x06, 0x17, 0x16, 0x06, 0x15, 0x18, 0x06, 0x04, 0x16, 0x06, 0x04, 0x06,
+    0x02, 0x15, 0x16, 0x15, 0x06, 0x01, 0x3E, 0x06, 0x02, 0x15, 0x2B, 0x06, 0x2A, 0x17, 0x06, 0x03, 0x29, 0x16, 0x06,
+    0x16, 0x2B, 0x06, 0x02, 0x17, 0x16, 0x06, 0x17, 0x29, 0x06, 0x03, 0x2B, 0x16, 0x06, 0x29, 0x18, 0x06, 0x04, 0x19,
+    0x06, 0x15, 0x29, 0x06, 0x29, 0x17, 0x06, 0x02, 0x15, 0x16, 0x06, 0x16, 0x16, 0x07, 0x33, 0x07, 0x48, 0x07, 0x34,
+    0x07, 0x35, 0x07, 0x35, 0x16, 0x07, 0x49, 0x07, 0x34, 0x15, 0x07, 0x33, 0x16, 0x07, 0x47, 0x07, 0x34, 0x17, 0x07,
+    0x02, 0x17, 0x07, 0x01, 0x07, 0x17, 0x07, 0x02, 0x07, 0x15, 0x07, 0x03, 0x07, 0x03, 0x16, 0x07, 0x04, 0x07, 0x01,
+    0x18, 0x07, 0x06, 0x07, 0x16, 0x07, 0x04, 0x17, 0x08, 0x17, 0x08, 0x2A, 0x08, 0x29, 0x08, 0x2B, 0x08, 0x3E, 0x08,
+    0x3D, 0x08, 0x16, 0x08, 0x17, 0x16, 0x08, 0x3D, 0x16, 0x08, 0x16, 0x15, 0x08, 0x3F, 0x08, 0x40, 0x17, 0x08, 0x2A,
+    0x15, 0x08, 0x02, 0x08, 0x52, 0x08, 0x16, 0x15, 0x16, 0x08, 0x51, 0x08, 0x01, 0x08, 0x15, 0x08, 0x41, 0x18, 0x08,
+    0x01, 0x16, 0x08, 0x29, 0x16, 0x08, 0x2B, 0x16, 0x08, 0x02, 0x15, 0x08, 0x02, 0x17, 0x08, 0x03, 0x08, 0x2A, 0x15,
+    0x16, 0x08, 0x03, 0x16, 0x08, 0x3E, 0x15, 0x08, 0x3F, 0x16, 0x08, 0x04, 0x17, 0x08, 0x29, 0x2A, 0x08, 0x40, 0x08,
+    0x2A, 0x17, 0x08, 0x15, 0x2A, 0x17, 0x08, 0x02, 0x3D, 0x08, 0x53, 0x08, 0x16, 0x17, 0x08, 0x16, 0x2A, 0x08, 0x15,
+    0x16, 0x08, 0x2C, 0x08, 0x3D, 0x18, 0x08, 0x01, 0x16, 0x17, 0x08, 0x3E, 0x17, 0x08, 0x02, 0x15, 0x16, 0x08, 0x16,
+    0x29, 0x08, 0x2A, 0x2A, 0x08, 0x2A, 0x29, 0x08, 0x29, 0x16, 0x17, 0x08, 0x29, 0x18, 0x08, 0x2B, 0x18, 0x08, 0x04,
+    0x08, 0x02, 0x3F, 0x08, 0x15, 0x2A, 0x08, 0x01, 0x29, 0x08, 0x54, 0x08, 0x01, 0x3E, 0x08, 0x02, 0x3F, 0x16, 0x08,
+    0x18, 0x08, 0x15, 0x29, 0x08, 0x2C, 0x15, 0x08, 0x03, 0x3E, 0x08, 0x03, 0x16, 0x2A, 0x08, 0x17, 0x18, 0x08, 0x15,
+    0x29, 0x16, 0x09, 0x33, 0x09, 0x49, 0x09, 0x34, 0x15, 0x16, 0x09, 0x47, 0x09, 0x34, 0x17, 0x09, 0x35, 0x16, 0x09,
+    0x48, 0x09, 0x34, 0x09, 0x36, 0x09, 0x5B, 0x09, 0x34, 0x29, 0x09, 0x35, 0x09, 0x33, 0x16, 0x09, 0x49, 0x16, 0x09,
+    0x5C, 0x09, 0x34, 0x15, 0x09, 0x15, 0x09, 0x16, 0x09, 0x16, 0x15, 0x09, 0x18, 0x15, 0x09, 0x2B, 0x09, 0x17, 0x09,
+    0x01, 0x09, 0x2C, 0x09, 0x16, 0x17, 0x09, 0x02, 0x09, 0x29, 0x0A, 0x3F, 0x0A, 0x16, 0x0A, 0x2A, 0x0A, 0x3E, 0x0A,
+    0x16, 0x15, 0x0A, 0x2B, 0x0A, 0x2A, 0x15, 0x0A, 0x15, 0x0A, 0x02, 0x0A, 0x51, 0x0A, 0x16, 0x15, 0x16, 0x0A, 0x29,
+    0x16, 0x0A, 0x40, 0x0A, 0x3F, 0x16, 0x0A, 0x29, 0x0A, 0x3D, 0x0A, 0x01, 0x0A, 0x52, 0x0A, 0x53, 0x16, 0x0A, 0x17,
+    0x0A, 0x16, 0x3D, 0x0A, 0x02, 0x17, 0x0A, 0x01, 0x16, 0x0A, 0x3E, 0x15, 0x0A, 0x03, 0x0A, 0x2A, 0x29, 0x0A, 0x53,
+    0x0A, 0x2A, 0x17, 0x0A, 0x40, 0x17, 0x0A, 0x66, 0x0A, 0x02, 0x15, 0x16, 0x0A, 0x02, 0x15, 0x0A, 0x15, 0x16, 0x0A,
+    0x3E, 0x17, 0x0A, 0x67, 0x0A, 0x18, 0x0A, 0x17, 0x16, 0x0A, 0x04, 0x0A, 0x52, 0x15, 0x0A, 0x65, 0x0A, 0x52, 0x17,
+    0x0A, 0x2C, 0x0A, 0x2A, 0x15, 0x16, 0x0A, 0x2B, 0x16, 0x0A, 0x3D, 0x16, 0x0A, 0x16, 0x29, 0x16, 0x0A, 0x18, 0x17,
+    0x0A, 0x15, 0x16, 0x15, 0x0A, 0x51, 0x16, 0x0A, 0x02, 0x65, 0x0A, 0x18, 0x15, 0x0A, 0x54, 0x17, 0x0B, 0x34, 0x0B,
+    0x33, 0x16, 0x0B, 0x34, 0x15, 0x0B, 0x48, 0x0B, 0x34, 0x17, 0x0C, 0x52, 0x0C, 0x29, 0x16, 0x0C, 0x02, 0x0C, 0x16,
+    0x17, 0x0C, 0x3F, 0x16, 0x0C, 0x16, 0x15, 0x16, 0x0C, 0x2A, 0x0C, 0x2A, 0x15, 0x16, 0x0C, 0x3E, 0x0C, 0x16, 0x0C,
+    0x40, 0x0C, 0x51, 0x16, 0x0C, 0x54, 0x0C, 0x3F, 0x16, 0x17, 0x0C, 0x2B, 0x16, 0x0D, 0x48, 0x0E, 0x16, 0x17, 0x0E,
+    0x52, 0x15, 0x0E, 0x2C, 0x15, 0x16, 0x0E, 0x66, 0x15, 0x0E, 0x2A, 0x0E, 0x3E,
+};
+
+constexpr HyphenationAutomaton ru_automaton = {
+    ru_symbols,
+    38u,
+    43u,
+    ru_dense,
+    13084u,
+    ru_label,
+    4u,
+    ru_child_base,
+    ru_child_offset,
+    ru_fail,
+    ru_levels,
+    ru_level_data,
 };
@@ -3,1136 +3,2672 @@
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t uk_trie_data[] = {
-    0x02, 0x15, 0x17, 0x02, 0x21, 0x02, 0x29, 0x03, 0x18, 0x16, 0x03, 0x1A, 0x06, 0x30, 0x38, 0x38, 0x10, 0x38, 0x1A,
-    0x06, 0x1A, 0x06, 0x1A, 0x1A, 0x36, 0x21, 0x36, 0x17, 0x5E, 0x37, 0x18, 0x17, 0x4B, 0x18, 0x72, 0x17, 0x49, 0x2C,
-    0x17, 0x40, 0x54, 0x53, 0x68, 0x17, 0x40, 0x17, 0x2C, 0x40, 0x17, 0x54, 0x21, 0x54, 0x17, 0x40, 0x17, 0x2C, 0x17,
-    0x7C, 0x17, 0x2C, 0x17, 0x2C, 0x17, 0x5E, 0x17, 0x5E, 0x21, 0x5D, 0x5F, 0x18, 0x4A, 0x17, 0x2D, 0x18, 0x3F, 0x35,
-    0x2C, 0x21, 0x55, 0x18, 0x2E, 0x19, 0x18, 0x2C, 0x19, 0x18, 0x2B, 0x22, 0x3F, 0x22, 0x17, 0x22, 0x2B, 0x18, 0x53,
-    0x22, 0x67, 0x22, 0x2C, 0x17, 0x18, 0x03, 0x18, 0x18, 0x03, 0x18, 0x17, 0x69, 0x90, 0x40, 0x2B, 0x41, 0x18, 0x54,
-    0x19, 0x04, 0x17, 0x53, 0x18, 0x43, 0x2D, 0x18, 0x18, 0x03, 0x22, 0x2A, 0x2B, 0x2C, 0x18, 0x19, 0x2C, 0x19, 0x2D,
-    0x04, 0x1B, 0x40, 0x19, 0x18, 0x18, 0x2B, 0x18, 0x7D, 0x18, 0x7B, 0x18, 0x2A, 0x15, 0x3F, 0x18, 0x18, 0x17, 0x18,
-    0x2C, 0x1B, 0x18, 0x2C, 0x54, 0x40, 0x18, 0x69, 0x18, 0x41, 0x18, 0x18, 0x2C, 0x18, 0x17, 0x40, 0x3F, 0x2C, 0x23,
-    0x40, 0x18, 0x17, 0x54, 0x18, 0x17, 0x67, 0x18, 0x40, 0x17, 0x18, 0x2D, 0x18, 0x19, 0x43, 0x18, 0x2C, 0x2C, 0x17,
-    0x54, 0x2B, 0x68, 0x18, 0x17, 0x2C, 0x18, 0x18, 0x17, 0x4A, 0x17, 0x18, 0x2C, 0x18, 0x17, 0x18, 0x35, 0x18, 0x49,
-    0x18, 0x5D, 0x18, 0x08, 0x11, 0x1C, 0x26, 0x26, 0x1C, 0x08, 0x1C, 0x26, 0x12, 0x1C, 0x1C, 0x08, 0x12, 0x1C, 0x12,
-    0xA0, 0x02, 0x91, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB4, 0xFD, 0xA0, 0x0D, 0xE2, 0xA2, 0x00, 0x61, 0xD0, 0x2D, 0xFA, 0xFD, 0x21, 0xBB, 0xDE, 0x21,
-    0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xD2, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x84, 0xEB, 0xFD, 0xA2, 0x00, 0x61, 0xD1, 0x2D, 0xFB, 0xD3,
-    0x21, 0xBA, 0xB4, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x41, 0xB8, 0xFF, 0xB1, 0x22, 0xD1, 0xD0, 0xF9, 0xFC, 0x41,
-    0xB7, 0xFF, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22,
-    0xBF, 0xB1, 0xE8, 0xFD, 0x42, 0xB0, 0xBE, 0xFF, 0x8A, 0xFF, 0xBB, 0x21, 0xD0, 0xF9, 0x41, 0xB4, 0xFF, 0x80, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x85, 0x89, 0xF0, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D,
-    0xFF, 0xDF, 0xFF, 0xFB, 0xFF, 0x86, 0xA0, 0x02, 0x92, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0xC2, 0x00,
-    0xD1, 0xD1, 0x2D, 0xFF, 0xFD, 0xFF, 0x5C, 0xA0, 0x00, 0xB2, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0xB1, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x96, 0xF4, 0xFD, 0xA0, 0x02, 0xC1, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x97, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFF, 0x18,
-    0x21, 0xBD, 0xC1, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0x81, 0xB2, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFD, 0xFE, 0xF6, 0x41, 0xB0, 0xFF, 0x9F,
-    0x21, 0xD0, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xFF, 0x86,
-    0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB5, 0xB8, 0xEA,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFE, 0xC1, 0x41, 0x80, 0xFF, 0x6D, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xFE, 0xB0, 0x41, 0xBB, 0xFF, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x83, 0xFD, 0x22, 0xD0, 0xD1, 0xC7, 0xFD, 0x42, 0x80, 0x81, 0xFF, 0xAC, 0xFF, 0x47, 0x21, 0xD1, 0xF9, 0x41,
-    0xBF, 0xFF, 0x3D, 0x21, 0xD0, 0xFC, 0x41, 0xB7, 0xFF, 0x30, 0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xB8, 0xF6, 0xFD, 0x21,
-    0xD0, 0xFB, 0x23, 0x82, 0x83, 0x86, 0xDB, 0xE7, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xFE, 0x6D, 0x41, 0x96, 0xFF,
-    0x13, 0x21, 0xD1, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0xA0, 0x06, 0xF1, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xFD,
-    0xFE, 0x32, 0x41, 0x80, 0xFE, 0xD5, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFE, 0x12, 0x41, 0x96, 0xFF, 0x8C, 0x21, 0xD1, 0xFC,
-    0xA0, 0x09, 0x72, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBB, 0xB2, 0xF4, 0xFD, 0x41, 0xBC, 0xFE, 0xA3, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xFD, 0x21, 0xB0, 0xFB,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFD, 0xDE, 0x41, 0x80, 0xFE, 0xEF, 0x21, 0xD1, 0xFC, 0x41, 0x86, 0xFE, 0x7D, 0x21,
-    0xD1, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBE, 0xFF, 0x18, 0x21,
-    0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x23, 0xB0, 0xB5, 0xBE, 0xD7,
-    0xEA, 0xFD, 0x41, 0x87, 0xFE, 0x50, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFD, 0x93, 0x41, 0xBA, 0xFE, 0x5F, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFD, 0x79, 0x41, 0x2D, 0xFD, 0x72, 0x50, 0xB0,
-    0xB5, 0xBE, 0xB9, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB1, 0xB6, 0xB8, 0xFD, 0x71, 0xFD, 0x9B,
-    0xFD, 0xE8, 0xFE, 0x12, 0xFE, 0x56, 0xFE, 0x78, 0xFE, 0xAD, 0xFE, 0xBE, 0xFF, 0x01, 0xFF, 0x3C, 0xFF, 0x5C, 0xFF,
-    0x90, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF, 0xFC, 0xA0, 0x06, 0x72, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D,
-    0xFF, 0xFD, 0xFD, 0x25, 0x41, 0xBE, 0xFD, 0xF2, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xB0, 0xDB, 0x22, 0xD1,
-    0xD0, 0xFA, 0xFD, 0x41, 0xBE, 0xFD, 0x76, 0x21, 0xD0, 0xFC, 0x22, 0xB4, 0xB3, 0xF4, 0xFD, 0x41, 0xBB, 0xFD, 0x84,
-    0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xDF, 0xFF, 0xFD, 0xFC, 0xE2, 0xC1, 0x00,
-    0x61, 0x2D, 0xFC, 0xD6, 0x41, 0xBD, 0xFD, 0x7D, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBC, 0xFD, 0xCF, 0x21, 0xD0, 0xFC, 0x22, 0xB3,
-    0xBE, 0xF6, 0xFD, 0x41, 0x88, 0xFD, 0x31, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x84, 0xFD,
-    0x21, 0xD1, 0xFD, 0x41, 0xB4, 0xFD, 0x1E, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFD, 0x05, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0xB5, 0xFC, 0xE6, 0x21, 0xD0, 0xFC, 0x21, 0x84, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0x81, 0xFC, 0xD3, 0x21, 0xD1, 0xFC, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xFC, 0xC6,
-    0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0xA1, 0x02, 0x92, 0xD1, 0xB4, 0x21, 0x81, 0xFB, 0x21, 0xD1,
-    0xFD, 0x22, 0xB4, 0xB9, 0xF2, 0xFD, 0x21, 0xD0, 0xFB, 0x22, 0xB0, 0xB5, 0xDD, 0xFD, 0x41, 0xBD, 0xFC, 0xA1, 0x21,
-    0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0xA0, 0x06, 0x63, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xEB, 0x21, 0xD0, 0xFD, 0x21,
-    0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xE5, 0x21, 0xD0, 0xFD, 0x23, 0xB1, 0xB4, 0xB7, 0xEB, 0xF7, 0xFD, 0x21,
-    0xD0, 0xF9, 0x41, 0x96, 0xFF, 0x47, 0x21, 0xD1, 0xFC, 0x47, 0xB0, 0xB2, 0xB4, 0xBA, 0xBC, 0xBE, 0xBF, 0xFF, 0x39,
-    0xFF, 0x52, 0xFF, 0x71, 0xFF, 0x84, 0xFF, 0xC3, 0xFF, 0xF6, 0xFF, 0xFD, 0x41, 0xB8, 0xFF, 0xA7, 0x21, 0xD0, 0xFC,
-    0x21, 0xB0, 0xC3, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41,
-    0xBA, 0xFF, 0x2A, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xFC, 0x1E, 0x21, 0xD0, 0xFC,
-    0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x80, 0xFC, 0x11, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x25, 0x80, 0x83, 0x84, 0x85, 0x86, 0xB8,
-    0xCA, 0xD7, 0xE4, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0x93, 0xFF, 0xF5, 0x21, 0x82, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFE,
-    0xAD, 0xFF, 0xFD, 0xFB, 0x5D, 0x41, 0x86, 0xFC, 0xF1, 0x21, 0xD1, 0xFC, 0x41, 0xBA, 0xFB, 0xFF, 0x21, 0xD0, 0xFC,
-    0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xBF, 0xF0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFB, 0x3A, 0x41,
-    0xB5, 0xFB, 0xE6, 0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x29, 0x41, 0xBB, 0xFC,
-    0xC0, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xFB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xFB, 0x14, 0x50,
-    0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x85, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFD, 0xE8, 0xFE,
-    0x2B, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFF, 0xB0, 0xFF, 0xD3, 0xFF, 0xE4, 0xFF, 0xF9, 0xFD, 0x9B,
-    0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0x41, 0x91, 0xFD, 0x6A, 0xC4, 0x00, 0x42, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCB, 0xFF, 0xFC, 0xFD, 0x66, 0x41, 0x96, 0xFA, 0xB1, 0x21, 0xD1, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBA, 0xB2, 0xB4, 0xFA, 0xCF, 0xFF, 0xFD, 0xFA,
-    0xB0, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xF6, 0xFA, 0xAC, 0x41, 0xB5, 0xFA, 0xBC, 0x21, 0xD0, 0xFC, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x84, 0x81, 0xFA, 0xBB, 0xFF, 0xFD, 0x21, 0x81, 0xCA, 0x21, 0xD1, 0xFD, 0x21, 0x96,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0xC3, 0x00, 0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xEA, 0xFF, 0xFD, 0xFA, 0x80,
-    0x21, 0xB2, 0xAF, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xFA, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD,
-    0x44, 0x81, 0x85, 0x86, 0x89, 0xFF, 0xF0, 0xFA, 0xC6, 0xFF, 0xFD, 0xFA, 0xD3, 0x41, 0xB2, 0xFA, 0x3C, 0x21, 0xD0,
-    0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x43, 0xB0, 0xB8, 0xBB, 0xFA, 0x48, 0xFA, 0x29, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x41, 0x80, 0xFA, 0x16, 0x21, 0xD1,
-    0xFC, 0x42, 0x83, 0x80, 0xFF, 0xFD, 0xFA, 0x77, 0x21, 0xD1, 0xF9, 0x41, 0x88, 0xFA, 0x05, 0x21, 0xD1, 0xFC, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE,
-    0xDA, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xFC, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8,
-    0xFD, 0x21, 0xD0, 0xFD, 0x25, 0xBF, 0xB1, 0xB3, 0xB7, 0xBA, 0xBA, 0xCB, 0xE4, 0xEA, 0xFD, 0xC3, 0x00, 0x61, 0xD1,
-    0xD0, 0x2D, 0xFF, 0x7F, 0xFF, 0xF5, 0xF9, 0xE0, 0xC1, 0x00, 0xD1, 0x2D, 0xF9, 0xD4, 0x41, 0xB3, 0xFA, 0x7B, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBD, 0xFF, 0xFD, 0xFB, 0xD5, 0x21, 0xD0, 0xF9, 0x21,
-    0xBE, 0xFD, 0xA0, 0x09, 0x52, 0x22, 0xBA, 0xBF, 0xFD, 0xFD, 0x22, 0x82, 0x86, 0xF8, 0xF8, 0x22, 0xD0, 0xD1, 0xF6,
-    0xFB, 0x21, 0x81, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xFD, 0xF9, 0x9F, 0x41, 0xB0, 0xFA, 0x8A, 0x21,
-    0xD0, 0xFC, 0x41, 0x82, 0xFB, 0x6A, 0x21, 0xD1, 0xFC, 0x41, 0xD0, 0xFA, 0x7F, 0x23, 0xB3, 0xBA, 0xBC, 0xF2, 0xF9,
-    0xFC, 0x21, 0xD0, 0xF9, 0x21, 0xB5, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF9, 0x76, 0x41, 0xBE, 0xFE, 0x20, 0x41,
-    0xB3, 0xFB, 0x47, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xFC, 0x27, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD,
-    0x22, 0x96, 0x80, 0xF0, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE3, 0xFF, 0xFB, 0xF9, 0x52, 0xA0, 0x09, 0x32, 0x21,
-    0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xB3, 0xF4, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x22, 0xD0,
-    0xD1, 0xF4, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xB3, 0xFB,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB2, 0xFB, 0x04, 0x21, 0xD0, 0xFC, 0x22, 0xB5, 0xB0,
-    0xF6, 0xFD, 0xA0, 0x0B, 0xD2, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD,
-    0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7, 0xFF, 0xFD, 0xF8, 0xD2, 0x41, 0xB7, 0xFB, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB8, 0xBA, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xF8, 0xB6, 0x21, 0xBE, 0xB1,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF8, 0xAC, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xB2, 0xB4, 0xB1,
-    0xB3, 0xB6, 0xB7, 0xB8, 0xBF, 0xFD, 0xF9, 0xFE, 0x25, 0xFE, 0xC5, 0xFE, 0xD1, 0xFF, 0x06, 0xFF, 0x2F, 0xFF, 0x53,
-    0xFF, 0xD3, 0xFF, 0xEF, 0xFF, 0xF9, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0x42,
-    0x80, 0x82, 0xFB, 0x37, 0xF8, 0x5C, 0x21, 0xD1, 0xF9, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x5B, 0x41, 0x82, 0xFE, 0x28, 0x21,
-    0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x41, 0xB3, 0xF8, 0x30, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42,
-    0xB1, 0xB3, 0xFF, 0xFD, 0xFB, 0x35, 0xC3, 0x00, 0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xE9, 0xFF, 0xF9, 0xF8, 0x34, 0x41,
-    0xB4, 0xF8, 0xD5, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x42,
-    0xB0, 0xB5, 0xFF, 0xFD, 0xF8, 0xC8, 0x21, 0xD0, 0xF9, 0x21, 0x82, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x08,
-    0x41, 0xBF, 0xF8, 0xAE, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x41, 0xBE, 0xF8, 0xBF, 0x21, 0xD0, 0xFC, 0x21, 0x96,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xF7, 0xED, 0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x81,
-    0x82, 0x80, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x88, 0xFF, 0xAF, 0xFB, 0x0D, 0xFB, 0x0D, 0xFB, 0x0D,
-    0xFB, 0x0D, 0xFF, 0xDB, 0xFF, 0xF6, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA,
-    0x71, 0xFA, 0x71, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x0D, 0xFF, 0xCF, 0xFC, 0xD6, 0xFA, 0x40, 0x41,
-    0xB2, 0xFC, 0xEA, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xFC, 0xF7, 0x9F, 0x41, 0x81, 0xFC, 0xFD, 0xC3, 0x00, 0x61,
-    0xD0, 0xD1, 0x2D, 0xFD, 0x0F, 0xFF, 0xFC, 0xF7, 0x92, 0x41, 0xBA, 0xFD, 0x98, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xF7, 0x82, 0x41, 0xB8, 0xF7, 0x61, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x41, 0x8F, 0xF7, 0x57, 0x21, 0xD1,
-    0xFC, 0x21, 0xBD, 0xFD, 0xC3, 0x00, 0xD1, 0xD1, 0xD0, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xF7, 0x65, 0x42, 0xD0, 0x2D,
-    0xF8, 0x3E, 0xF7, 0x59, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB3, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBF, 0xFF, 0xB3, 0xFF, 0xC0, 0xFF, 0xD0, 0xFF, 0xED, 0xFF, 0xF9, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9,
-    0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0x50, 0x96, 0x83, 0x8E,
-    0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xF9, 0xFC, 0xFA, 0x4B, 0xFA, 0x4B,
-    0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9,
-    0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xFC,
-    0x14, 0xF9, 0x7E, 0x41, 0xBC, 0xF6, 0xC9, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD,
-    0x41, 0x86, 0xFC, 0x0C, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x42, 0xD1, 0xD0, 0xF6, 0xDD, 0xFF, 0xFD, 0x41, 0x96,
-    0xFD, 0xFC, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0xA1, 0x02, 0x91, 0xD0, 0xFD, 0x21, 0xB0, 0xFB, 0x21, 0xD0, 0xFD,
-    0x44, 0xBA, 0xB2, 0xB4, 0xBD, 0xFF, 0xE4, 0xFB, 0xF2, 0xF6, 0xA5, 0xFF, 0xFD, 0xC3, 0x00, 0x61, 0xD1, 0xD0, 0x2D,
-    0xFF, 0xCA, 0xFF, 0xF3, 0xF6, 0x9E, 0x41, 0xBE, 0xF6, 0x7A, 0x21, 0xD0, 0xFC, 0x42, 0xBA, 0xBC, 0xFF, 0xFD, 0xFC,
-    0x05, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFB, 0xEE, 0xF6, 0x84, 0xA0, 0x02, 0x81, 0xA0, 0x04, 0xE1,
-    0x21, 0xBC, 0xFD, 0x42, 0xBE, 0xB0, 0xFF, 0xFA, 0xF6, 0xB9, 0x21, 0xD0, 0xF9, 0x42, 0x80, 0x96, 0xFF, 0xFD, 0xFE,
-    0x21, 0xA3, 0x02, 0x91, 0x27, 0xD0, 0xD1, 0xE6, 0xEC, 0xF9, 0x41, 0xB0, 0xFB, 0xEB, 0x21, 0xD0, 0xFC, 0x21, 0x82,
-    0xFD, 0xC2, 0x02, 0x91, 0xD0, 0xD1, 0xFC, 0x5A, 0xFF, 0xFD, 0x41, 0xBE, 0xF6, 0x79, 0x21, 0xD0, 0xFC, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB6, 0xF6, 0x1D, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB8,
-    0xB5, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x44, 0xB1, 0xBF, 0xBA, 0xB4, 0xFF, 0xC2, 0xFB, 0xEF, 0xFF, 0xD5, 0xFF, 0xFD,
-    0x42, 0x89, 0x81, 0xF5, 0xFB, 0xF6, 0x2C, 0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x81, 0x86,
-    0x87, 0xFB, 0x92, 0xFB, 0x9F, 0xFF, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xF6, 0xF5, 0xF9,
-    0xA0, 0x03, 0x02, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xFD, 0xFD,
-    0x26, 0xF5, 0xE1, 0x42, 0xB4, 0xBA, 0xF9, 0x0B, 0xF6, 0x8A, 0x21, 0xD0, 0xF9, 0x21, 0x94, 0xFD, 0xA1, 0x04, 0xF1,
-    0xD1, 0xFD, 0xA0, 0x05, 0xC2, 0x21, 0x94, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x27, 0xFD, 0x41, 0xBD, 0xF7, 0xB5, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0xA1, 0x00, 0xB2, 0xD1, 0xFD, 0x41, 0x8F, 0xF6,
-    0x7A, 0x21, 0xD1, 0xFC, 0x43, 0xB4, 0xBD, 0xBC, 0xF7, 0x99, 0xFF, 0xFD, 0xF6, 0x73, 0x41, 0x82, 0xF7, 0x8F, 0x22,
-    0xD0, 0xD1, 0xF2, 0xFC, 0x23, 0xB2, 0xB4, 0xB9, 0xCE, 0xE1, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xF7, 0xB3, 0xA0,
-    0x04, 0xC2, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0x96, 0x83, 0xE4, 0xFD, 0xA0, 0x05, 0xA2, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x27, 0xFD, 0x41,
-    0xB6, 0xF6, 0x03, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41,
-    0xB0, 0xF5, 0xF0, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xF8, 0x6A, 0x21, 0xD0, 0xFC,
-    0x21, 0x80, 0xFD, 0x41, 0xBC, 0xF6, 0x02, 0x21, 0xD0, 0xFC, 0x21, 0xB9, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0xA0,
-    0x09, 0xF2, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0x96, 0xF9, 0x14, 0x21, 0xD1, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0xB4, 0xB0, 0xEA, 0xFD, 0x21, 0xD0, 0xFB, 0x46, 0xB2, 0xBC, 0xB5, 0xB8, 0xBE, 0xBB, 0xFF, 0x94, 0xFF,
-    0x94, 0xFF, 0xA7, 0xFF, 0xB4, 0xFF, 0xCB, 0xFF, 0xFD, 0x44, 0x27, 0xD1, 0xD0, 0x2D, 0xFF, 0x10, 0xFF, 0x73, 0xFF,
-    0xED, 0xF4, 0xDA, 0xA0, 0x04, 0xF1, 0x41, 0x8C, 0xF5, 0x77, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB0, 0xFD, 0x41, 0x8F, 0xFA, 0xF0, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xF9, 0xFF, 0xFC, 0xF4,
-    0xB6, 0x41, 0xBE, 0xF5, 0x56, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB1, 0xB0, 0xFF, 0xFD,
-    0xFB, 0x9E, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF4, 0x95, 0x41, 0xB5, 0xF6, 0x9C, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
-    0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xF4, 0x84, 0x42, 0xB5, 0xBB, 0xF6, 0xAA, 0xF5, 0x95, 0x41, 0xB8, 0xF6, 0x84, 0x21,
-    0xD0, 0xFC, 0x41, 0xB5, 0xF5, 0x1C, 0x21, 0xD0, 0xFC, 0x43, 0x81, 0x88, 0x89, 0xF5, 0x1B, 0xFF, 0xFD, 0xFF, 0xFD,
-    0x21, 0xD1, 0xF6, 0x22, 0x82, 0x83, 0xE9, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xFB, 0xF4, 0x56, 0x42,
-    0xBE, 0xB0, 0xF5, 0x2E, 0xF5, 0x2E, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF4, 0x45, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB2,
-    0xB1, 0xB4, 0xB7, 0xBA, 0xBF, 0xBD, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xFD, 0xA0, 0xFD, 0xBA, 0xFE, 0x45, 0xFA, 0x6A,
-    0xFE, 0x5D, 0xFF, 0x64, 0xFF, 0x88, 0xFF, 0xA9, 0xFF, 0xBA, 0xFF, 0xE8, 0xFF, 0xF9, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6,
-    0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0x41, 0xBE, 0xF4, 0x1A, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0xC3, 0x00, 0x61, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xFB, 0xA5, 0xF4, 0x03, 0x42, 0x82, 0x83, 0xF9, 0xCD, 0xF9, 0x8D, 0xA1, 0x02, 0x91, 0xD1,
-    0xF9, 0x21, 0x81, 0xFB, 0x41, 0xD0, 0xF6, 0xD6, 0x43, 0xBA, 0xB4, 0xB3, 0xFD, 0x0D, 0xFF, 0xFC, 0xF6, 0xDE, 0xC3,
-    0x00, 0x61, 0xD1, 0xD0, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xF3, 0xDA, 0x41, 0xB0, 0xF6, 0x02, 0x21, 0xD0, 0xFC, 0x21,
-    0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xFB, 0x97, 0x21, 0xD0, 0xFC, 0x22,
-    0xB4, 0xB5, 0xF6, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xF3, 0xAF, 0x41, 0xB1, 0xF4, 0x55, 0x21, 0xD0, 0xFC, 0x21,
-    0xBE, 0xFD, 0x41, 0xB6, 0xF6, 0xD2, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF,
-    0xFD, 0xF3, 0x94, 0x41, 0xBB, 0xFE, 0xE5, 0x42, 0x80, 0x87, 0xFE, 0x54, 0xF4, 0x33, 0x22, 0xD0, 0xD1, 0xF5, 0xF9,
-    0x21, 0xBE, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x77, 0x42, 0x81, 0x89, 0xF6, 0xA4, 0xF4, 0x1D, 0x21, 0xD1,
-    0xF9, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x63, 0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80,
-    0x81, 0x85, 0x87, 0x82, 0x84, 0x86, 0x88, 0x89, 0x8C, 0xFF, 0x59, 0xFF, 0x82, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86,
-    0xF6, 0x86, 0xFF, 0xAD, 0xFF, 0xC8, 0xFF, 0xE5, 0xFF, 0xF9, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5,
-    0xEA, 0xF5, 0xEA, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xF8, 0x4F, 0xF5, 0xB9, 0xC1,
-    0x00, 0x42, 0x2D, 0xF3, 0x1C, 0xA0, 0x01, 0x01, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF3, 0x13, 0x41, 0x81, 0xF3, 0xE2,
-    0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x43,
-    0x2E, 0xD0, 0x2D, 0xFF, 0xE0, 0xFF, 0xFD, 0xF2, 0xF6, 0xA0, 0x01, 0x72, 0x21, 0x2E, 0xFD, 0x21, 0x8C, 0xFD, 0xA0,
-    0x00, 0xB1, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB6, 0xB7, 0xF7, 0xF7, 0x21, 0xBA, 0xF2, 0x21, 0xD0, 0xFD,
-    0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x41, 0x82, 0xFC, 0xDA, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0xA1, 0x00, 0xB1, 0xD0, 0xFD, 0x21, 0xBA, 0xFB,
-    0x21, 0x96, 0xC6, 0x21, 0xD1, 0xFD, 0x21, 0x86, 0xFD, 0x22, 0xD0, 0xD1, 0xF4, 0xFD, 0x23, 0xB0, 0xB8, 0xBE, 0xBE,
-    0xCF, 0xFB, 0x44, 0x2E, 0xD1, 0xD0, 0x2D, 0xFF, 0x7E, 0xFF, 0xAE, 0xFF, 0xF9, 0xF2, 0x94, 0xA0, 0x02, 0xE2, 0x21,
-    0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x96, 0xF3, 0x4E, 0x21, 0xD1, 0xFC, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x81, 0xF4, 0x61, 0x21, 0xD1, 0xFC, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB2, 0xB4, 0xEA, 0xFD, 0x21, 0xD0, 0xFB,
-    0x21, 0x81, 0xD6, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x23,
-    0xB2, 0xB0, 0xB5, 0xBD, 0xEB, 0xFD, 0xA0, 0x05, 0x73, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
-    0xD0, 0xFD, 0xA0, 0x07, 0x32, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4,
-    0xBC, 0xEE, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xBB, 0xF2, 0xE1, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xF2, 0xDA, 0x21, 0xD0,
-    0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB3, 0xBF, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x22, 0x96, 0x83, 0xE1,
-    0xFD, 0x22, 0xD0, 0xD1, 0xB2, 0xFB, 0x41, 0xBB, 0xF2, 0xAD, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x04, 0xC1, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB7, 0xB9, 0xBA, 0xD3, 0xEE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xF9, 0xF1, 0xB6, 0xA0, 0x07, 0x01, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x41, 0xB7, 0xF3, 0x8D, 0x21,
-    0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xDB, 0xFD, 0xA0, 0x03, 0xD1, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C,
-    0xFD, 0xA0, 0x03, 0x72, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x22, 0xD1, 0xD0, 0xD3, 0xFD, 0x21, 0x80, 0xEF, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x43, 0xBA, 0xBB, 0xB3, 0xFF, 0xA8, 0xFF, 0xEF, 0xFF, 0xFD, 0x41, 0xB5, 0xF5, 0x86, 0x21, 0xD0,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xF4, 0xC4, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB5, 0xB0, 0xEA, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x81, 0xFD, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xCB, 0xFF, 0xFD, 0xF0, 0xE2, 0x41, 0xB0, 0xF4, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x42, 0xD0, 0xD1, 0xF3, 0xCA, 0xF4, 0x49, 0x21, 0xBE, 0xF9, 0x21, 0xD0, 0xFD,
-    0x41, 0xBF, 0xF1, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xF4, 0x39, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB4, 0xF6, 0xFD,
-    0x21, 0xD0, 0xFB, 0x21, 0xBC, 0xEE, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x81, 0xF4, 0x1E,
-    0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xB8, 0xD8, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF4,
-    0xFD, 0x24, 0xB3, 0xB7, 0xBA, 0xBF, 0xC3, 0xD9, 0xE5, 0xFB, 0x21, 0xD0, 0xF7, 0xA0, 0x07, 0x52, 0x21, 0xBF, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0xA0, 0x0A, 0x83, 0x21, 0x85, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0C, 0xE4, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xDC, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x23, 0xBC, 0xBE, 0xBF, 0xDC, 0xF1, 0xFD, 0x21, 0xB4, 0xC9, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xCC, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x96, 0xF1,
-    0xFD, 0x22, 0xD0, 0xD1, 0xDC, 0xFB, 0x21, 0x82, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xA1, 0xFF, 0xFD, 0x42, 0x94, 0x80,
-    0xFF, 0x88, 0xFF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x2E, 0xFF, 0xF9, 0xEF, 0xF9, 0x50, 0xBA, 0xBF, 0xB1, 0xB2,
-    0xB7, 0xB9, 0xBB, 0xBD, 0xB5, 0xB0, 0xBE, 0xB3, 0xB4, 0xB6, 0xB8, 0xBC, 0xFC, 0xD3, 0xFC, 0xD3, 0xFC, 0xD3, 0xFC,
-    0xDC, 0xFC, 0xDC, 0xFC, 0xF9, 0xFD, 0x5B, 0xFC, 0xDC, 0xFE, 0x39, 0xFF, 0x0D, 0xFF, 0xF6, 0xF2, 0x7D, 0xF2, 0x7D,
-    0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xA0, 0x01, 0x93, 0x21, 0x2E, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0x80, 0xFA, 0x43,
-    0x2E, 0xD0, 0xD1, 0xFC, 0xC6, 0xFF, 0xFA, 0xFF, 0xFD, 0x21, 0xBA, 0xED, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x8C, 0xF0,
-    0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xFC, 0x87, 0xFF, 0xFB, 0xEF, 0x9D, 0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFC,
-    0xAB, 0xEF, 0x91, 0xC1, 0x02, 0xC1, 0xD0, 0xFE, 0x51, 0x21, 0xB4, 0xFA, 0xA1, 0x00, 0xB1, 0xD0, 0xFD, 0x21, 0xBD,
-    0xFB, 0x41, 0xB8, 0xFC, 0x94, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xF3, 0xFD, 0x41, 0x82, 0xFC,
-    0x85, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB7, 0xFC, 0x89, 0x41, 0xBD, 0xFC, 0x74, 0x21,
-    0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x23, 0xB0, 0xB5,
-    0xB8, 0xD5, 0xE4, 0xFB, 0x41, 0xB4, 0xFC, 0x58, 0x21, 0xD0, 0xFC, 0xA0, 0x07, 0x12, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x83, 0x96, 0xD6, 0xFD, 0x44, 0x2E,
-    0xD0, 0xD1, 0x2D, 0xFB, 0xF2, 0xFF, 0xC6, 0xFF, 0xFB, 0xEF, 0x08, 0xA0, 0x02, 0xE1, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBE, 0xB1, 0xEF, 0x6C, 0xFF,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xEE, 0xDF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x80, 0x96,
-    0x94, 0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x3B, 0xFB, 0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0x47, 0xFB, 0xBC, 0xFB,
-    0xBC, 0xFB, 0xBC, 0xFF, 0xD0, 0xFF, 0xF9, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66,
-    0xA0, 0x05, 0xB1, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x94, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xEE, 0x95, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0x9F, 0xFF, 0xB6, 0xFF, 0xF9, 0xF3, 0xB2,
-    0xA0, 0x06, 0x93, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xB8, 0xFF,
-    0xFD, 0xEF, 0x9D, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFB, 0x55, 0xFF, 0xF9, 0xEE, 0x6B, 0x42, 0x80, 0x8C, 0xFB,
-    0x76, 0xFB, 0x76, 0x42, 0xB7, 0xBE, 0xEF, 0x05, 0xEF, 0xB3, 0x21, 0xD0, 0xF9, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD,
-    0x42, 0xB0, 0xBE, 0xEF, 0xA3, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD1, 0xD0, 0x2D, 0xFB, 0x2B, 0xFF, 0xE2, 0xFF,
-    0xF9, 0xEE, 0x41, 0x41, 0xB0, 0xF1, 0x66, 0x21, 0xD0, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD,
-    0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFB, 0x0C, 0xFF, 0xFD, 0xEE, 0x22, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xFB,
-    0x00, 0xFB, 0x30, 0xEE, 0x16, 0x41, 0xB4, 0xFF, 0x89, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBB, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xFA, 0xE4, 0xFF, 0xFD, 0xED, 0xFA, 0x42, 0x81, 0x88, 0xF1, 0x22,
-    0xEE, 0xA1, 0x42, 0xD0, 0xD1, 0xF5, 0xBF, 0xFF, 0xF9, 0x42, 0xB0, 0xBE, 0xFF, 0xF9, 0xEF, 0x0B, 0xC4, 0x00, 0x42,
-    0x2E, 0xD1, 0xD0, 0x2D, 0xFA, 0xC3, 0xFA, 0xF3, 0xFF, 0xF9, 0xED, 0xD9, 0xA0, 0x05, 0xE2, 0x21, 0x8F, 0xFD, 0x21,
-    0xD1, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0x27, 0x2D, 0xFA, 0xAB, 0xFF, 0xFD, 0xED, 0xC1, 0xC2, 0x00, 0x42, 0x2E, 0x2D,
-    0xFA, 0x9F, 0xED, 0xB5, 0x41, 0xB2, 0xFF, 0x2B, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2,
-    0xF0, 0xD3, 0x21, 0xD0, 0xFC, 0x41, 0x8F, 0xF5, 0x74, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x23,
-    0xBB, 0xB5, 0xBE, 0xE9, 0xF0, 0xFD, 0x41, 0xBD, 0xFF, 0x03, 0x21, 0xD0, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xFA, 0x58, 0xFF,
-    0xE3, 0xFF, 0xFD, 0xED, 0x6E, 0x41, 0xB4, 0xF0, 0x99, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xC3, 0x00, 0x42, 0x2E,
-    0xD0, 0x2D, 0xFA, 0x3F, 0xFF, 0xFD, 0xED, 0x55, 0xA0, 0x06, 0x02, 0x21, 0x87, 0xFD, 0x41, 0xB8, 0xEE, 0x0B, 0x21,
-    0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x41, 0xB2, 0xED, 0xFC, 0x41, 0xBD, 0xED, 0xF8, 0x21,
-    0xD0, 0xFC, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x43, 0x97, 0x83, 0x8F, 0xED, 0xE9, 0xFF, 0xE8, 0xFF,
-    0xFB, 0x42, 0xB4, 0xBC, 0xFF, 0xCE, 0xED, 0xDF, 0x21, 0x82, 0xC7, 0x22, 0xD0, 0xD1, 0xF6, 0xFD, 0xA0, 0x07, 0x92,
-    0x21, 0xB4, 0xFD, 0x21, 0x82, 0xFA, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0x21, 0xB9, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB9, 0xBD, 0xE1, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xC8, 0xFF, 0xFB, 0xEC, 0xE9,
-    0xA0, 0x07, 0x72, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x0B, 0xF3, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBD, 0xBB, 0xD0,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xEC, 0x92, 0x41, 0xBD, 0xF6, 0x9E, 0x21, 0xD0, 0xFC, 0x21, 0x85, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0x82, 0xD5, 0x21, 0xD1, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB,
-    0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xEE, 0xFF, 0xFD, 0xEC, 0x6C, 0xA0, 0x05, 0x72, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBA, 0xFD, 0x41, 0x94, 0xEC, 0x3E, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x22, 0xD0, 0xD1, 0xE1, 0xFD, 0x41,
-    0x87, 0xEC, 0x1D, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB2, 0xBD, 0xEF, 0x22, 0xFF, 0xFD,
-    0x21, 0xD0, 0xF9, 0x22, 0x81, 0x94, 0xE4, 0xFD, 0xA0, 0x05, 0x22, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0x80, 0xE8, 0x21, 0xD1, 0xFD,
-    0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x22, 0xD1, 0xD0, 0xE8,
-    0xFD, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xFA, 0x8F, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xF1, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBC, 0xB0, 0xEB, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB4, 0xBB, 0xC4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0x85, 0xFF,
-    0xFB, 0xEB, 0xA3, 0x50, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xB2, 0xB8, 0xB0, 0xB5,
-    0xBE, 0xFD, 0x2E, 0xF8, 0x7D, 0xFD, 0x58, 0xFD, 0x77, 0xFD, 0x83, 0xFD, 0x9F, 0xFD, 0xC0, 0xFD, 0xD8, 0xFD, 0xE4,
-    0xFE, 0x2B, 0xFD, 0xE4, 0xFE, 0x44, 0xFE, 0xB0, 0xFF, 0x07, 0xFF, 0x2D, 0xFF, 0xF6, 0x41, 0xBB, 0xFD, 0xC6, 0x21,
-    0xD0, 0xFC, 0x41, 0xB9, 0xEC, 0x0E, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xB6, 0xF0,
-    0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xBB, 0xEC, 0x7D, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE,
-    0xB0, 0xF0, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xF8, 0x24, 0xFF, 0xFB, 0xEB, 0x3A, 0x41, 0x8C, 0xFB, 0x73,
-    0x42, 0xD0, 0xD1, 0xFB, 0x72, 0xFF, 0xFC, 0x42, 0x2E, 0xD0, 0xF8, 0x37, 0xFB, 0x7B, 0x43, 0x82, 0x8C, 0x8E, 0xFF,
-    0xF2, 0xFF, 0xF9, 0xF2, 0xF8, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xF7, 0xFC, 0xFF, 0xF6, 0xEB, 0x12, 0x42, 0x82,
-    0x87, 0xFC, 0x85, 0xFC, 0x85, 0x21, 0xD1, 0xF9, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x80, 0x96, 0xFF, 0xFD,
-    0xEC, 0x51, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xF7, 0xD9, 0xFF, 0xF9, 0xEA, 0xEF, 0x41, 0x87, 0xEB, 0xB9, 0x21,
-    0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x41, 0x8F, 0xF5, 0x14, 0x21, 0xD1, 0xFC, 0x21, 0x27, 0xFD, 0xA0, 0x07, 0xB1, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x07, 0xC3, 0x42, 0xBD, 0xBE, 0xF5, 0x41,
-    0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x42, 0xB6, 0xB7, 0xF8, 0x91, 0xF8, 0x91, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xBC, 0xB1, 0xF5, 0x21, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x24,
-    0xB2, 0xB7, 0xB5, 0xBE, 0xC1, 0xD0, 0xDD, 0xFD, 0x22, 0xD1, 0xD0, 0xAE, 0xF7, 0x21, 0xB4, 0xFB, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xEA, 0x82, 0x41, 0xB4, 0xF6, 0x93, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xEA, 0x77, 0x50, 0x80, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x96, 0x83, 0x94, 0x97, 0x8C, 0x8E, 0x8F, 0xFF, 0x36, 0xFF, 0x5E, 0xFF, 0x81,
-    0xF7, 0x54, 0xFC, 0xBB, 0xFA, 0xDF, 0xFC, 0xBB, 0xFC, 0xBB, 0xFC, 0xBB, 0xFF, 0xEE, 0xFF, 0xF9, 0xEC, 0xFE, 0xEC,
-    0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xA0, 0x07, 0xF2, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD,
-    0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD, 0xEA, 0x33, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0x91, 0xFF, 0xBA, 0xFF,
-    0xF7, 0xEF, 0x4E, 0x41, 0xB7, 0xF7, 0x3A, 0x41, 0x88, 0xF7, 0x36, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xB4, 0xBD,
-    0xF7, 0x2D, 0xF7, 0x2D, 0x21, 0xD0, 0xF9, 0x43, 0x8C, 0x83, 0x8F, 0xF7, 0x1D, 0xFF, 0xF1, 0xFF, 0xFD, 0x42, 0xB1,
-    0xBD, 0xF7, 0x19, 0xF7, 0x19, 0x21, 0xD0, 0xF9, 0x41, 0xB1, 0xF7, 0x0F, 0x21, 0xD0, 0xFC, 0x43, 0xB0, 0xB8, 0xBE,
-    0xFA, 0xB4, 0xFF, 0xF6, 0xFF, 0xFD, 0x44, 0x2E, 0xD1, 0xD0, 0x2D, 0xF6, 0xCB, 0xFF, 0xDB, 0xFF, 0xF6, 0xE9, 0xE1,
-    0x41, 0xBB, 0xF6, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0xD0, 0xB0, 0x43, 0xB0, 0xB8, 0xBE, 0xFA, 0x77, 0xFF, 0xFA, 0xFF,
-    0xFD, 0x41, 0x87, 0xF6, 0xEE, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF6, 0xA0, 0xFF,
-    0xEC, 0xFF, 0xFD, 0xE9, 0xB6, 0xA0, 0x08, 0x12, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x41, 0xD1, 0xEC,
-    0x76, 0x41, 0xD0, 0xF8, 0x15, 0x43, 0xBE, 0xBB, 0xBD, 0xE9, 0x6B, 0xFF, 0xF8, 0xFF, 0xFC, 0x43, 0xD1, 0xD0, 0x2D,
-    0xFF, 0xEB, 0xFF, 0xF6, 0xE9, 0x79, 0xA0, 0x08, 0x33, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0xA0, 0x0B, 0x73, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3,
-    0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x83, 0xE8, 0xFD, 0x21, 0xD1, 0xFB, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xB9, 0xF8, 0xA8, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22,
-    0x81, 0x84, 0xEA, 0xFD, 0x41, 0xB5, 0xEC, 0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF,
-    0xF1, 0xFF, 0xFD, 0xE9, 0x1B, 0x50, 0xBA, 0xBF, 0xB3, 0xB2, 0xB4, 0xBB, 0xBC, 0xBD, 0xB5, 0xBE, 0xB0, 0xB1, 0xB6,
-    0xB7, 0xB8, 0xB9, 0xF5, 0xF5, 0xF5, 0xF5, 0xFB, 0x5C, 0xF5, 0xFE, 0xF5, 0xFE, 0xFF, 0x30, 0xF5, 0xFE, 0xFF, 0x5B,
-    0xFF, 0x98, 0xFF, 0xF6, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0x41, 0xD0, 0xF9,
-    0x28, 0x42, 0x82, 0x8C, 0xFF, 0xFC, 0xF5, 0xF3, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xF5, 0xBF, 0xFF, 0xF9, 0xE8,
-    0xD5, 0x45, 0xB2, 0xB4, 0xB9, 0xBC, 0xBD, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0x41, 0xB7,
-    0xFB, 0xB1, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB1, 0xD0, 0xFD, 0x45, 0x82, 0x84, 0x88, 0x8E, 0x94, 0xF9,
-    0x25, 0xFF, 0xFB, 0xF5, 0xB5, 0xF5, 0xB5, 0xF5, 0xB5, 0x22, 0xD0, 0xD1, 0xBF, 0xF0, 0x41, 0x8C, 0xF5, 0xA0, 0x21,
-    0xD1, 0xFC, 0x42, 0x81, 0x86, 0xF5, 0x99, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x41, 0xB0, 0xF9, 0x3B, 0x21, 0xD0, 0xFC,
-    0x44, 0xB1, 0xB6, 0xB7, 0xBC, 0xF5, 0x88, 0xF5, 0x88, 0xF5, 0x88, 0xFF, 0xFD, 0x41, 0xB9, 0xF5, 0xA1, 0x21, 0xD0,
-    0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1,
-    0xDD, 0xFD, 0x23, 0xB0, 0xB5, 0xBE, 0xBB, 0xCE, 0xFB, 0x43, 0xB2, 0xBD, 0xBF, 0xF8, 0xEF, 0xF8, 0xD8, 0xF5, 0x59,
-    0x21, 0xD0, 0xF6, 0x41, 0xB2, 0xF5, 0x4C, 0x42, 0x82, 0x88, 0xF5, 0x48, 0xF5, 0x48, 0x22, 0xD0, 0xD1, 0xF5, 0xF9,
-    0x22, 0x83, 0x96, 0xED, 0xFB, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xF5, 0x04, 0xFF, 0xD7, 0xFF, 0xFB, 0xE8, 0x1A, 0xA0,
-    0x08, 0x63, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0xA1, 0x00,
-    0xB2, 0xD0, 0xFD, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x0B, 0x52, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xF1, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB0, 0xB5,
-    0xE5, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4,
-    0xBF, 0xC2, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xE7, 0xAA, 0x50, 0x81, 0x82, 0x84, 0x86, 0x87, 0x88, 0x80, 0x96,
-    0x94, 0x97, 0x83, 0x85, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0xCE, 0xF9, 0xEE, 0xF4, 0x87, 0xF4, 0x87, 0xF4, 0x87, 0xF4,
-    0x87, 0xFF, 0x89, 0xFF, 0xF9, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31,
-    0xEA, 0x31, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0x61, 0xFF, 0xCF, 0xEC, 0x96, 0xEA, 0x00, 0x41, 0x8F, 0xF4, 0x82,
-    0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xE7, 0x61, 0x41, 0x8C, 0xE8, 0x2E, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0xC3,
-    0x00, 0xC1, 0x2E, 0xD0, 0x2D, 0xF4, 0x26, 0xFF, 0xFD, 0xE7, 0x3C, 0xA0, 0x08, 0x92, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0xC4, 0x00, 0xC1, 0x2E, 0xD1, 0xD0, 0x2D, 0xF4, 0x0E, 0xF4, 0x3E, 0xFF, 0xFD, 0xE7, 0x24,
-    0xA0, 0x08, 0xE3, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x43,
-    0x2E, 0xD1, 0x2D, 0xF3, 0xED, 0xFF, 0xFD, 0xE7, 0x03, 0x41, 0x80, 0xF1, 0x7D, 0x21, 0xD1, 0xFC, 0x42, 0x94, 0x8E,
-    0xF1, 0x90, 0xF1, 0x90, 0x21, 0xD1, 0xF9, 0x21, 0x27, 0xFD, 0x41, 0xBB, 0xF9, 0x9C, 0x21, 0xD0, 0xFC, 0x21, 0xBE,
-    0xFD, 0x21, 0x96, 0xFA, 0x22, 0xD0, 0xD1, 0xFA, 0xFD, 0x21, 0xB2, 0xFB, 0x21, 0xD0, 0xFD, 0xA0, 0x09, 0x93, 0x21,
-    0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x45, 0xBE, 0xB2, 0xB7, 0xBA, 0xB9, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xF4, 0xFD, 0x97,
-    0xFF, 0xFD, 0x43, 0xB4, 0xBC, 0xB6, 0xE7, 0x7C, 0xE7, 0x7C, 0xE7, 0x7C, 0x41, 0x82, 0xE7, 0x72, 0x21, 0xD1, 0xFC,
-    0x42, 0x85, 0x81, 0xE7, 0x6B, 0xFF, 0xFD, 0x22, 0xD0, 0xD1, 0xE8, 0xF9, 0xA0, 0x09, 0x12, 0x21, 0xB7, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x42, 0xBA, 0xBC, 0xE7, 0x32, 0xE7, 0x32, 0x21, 0xD0, 0xF9, 0x23, 0x97, 0x80, 0x83, 0xC4, 0xF3, 0xFD, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0x95, 0xFF, 0xF9, 0xE6, 0x59, 0x42, 0xD0, 0x2D, 0xE9, 0x7F, 0xE6, 0x4F, 0x43, 0xB2, 0xBB, 0xBD,
-    0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0x42, 0x82, 0x94, 0xE6, 0xEB, 0xE6, 0xEB, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0x21,
-    0xB0, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xE6, 0x2F, 0x41, 0xB3, 0xF3, 0x45, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xF5,
-    0xAC, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x43, 0x8E, 0x94, 0x85, 0xF3, 0x25, 0xF3, 0x25, 0xFF, 0xFD, 0x21, 0xD1, 0xF6, 0x22, 0xB8, 0xBE,
-    0xD7, 0xFD, 0x41, 0xB9, 0xF3, 0x13, 0x42, 0x80, 0x87, 0xF3, 0x0F, 0xF3, 0x4C, 0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x21,
-    0x96, 0xFB, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE8, 0xFF, 0xFD, 0xE5, 0xE3, 0xA0, 0x08, 0xB3, 0x21, 0xBC, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xB4, 0xF4, 0x22, 0xD1, 0xD0, 0xFA, 0xFD,
-    0xA0, 0x08, 0xB2, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8E, 0xFD, 0x41,
-    0xB7, 0xEF, 0xC0, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x21, 0xB4, 0xDF, 0x21, 0xD0,
-    0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xD3, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB2, 0xC7, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xDF, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFF, 0xA9, 0x21, 0xD1, 0xFC, 0x21,
-    0x84, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x47, 0xB0, 0xB1, 0xB2, 0xB4, 0xB7, 0xBA, 0xBD,
-    0xFF, 0x91, 0xFF, 0xB2, 0xFF, 0xC0, 0xFF, 0xCC, 0xFF, 0xE4, 0xFF, 0xEA, 0xFF, 0xFD, 0x41, 0x81, 0xFF, 0x80, 0x21,
-    0xD1, 0xFC, 0x21, 0x94, 0xFD, 0x41, 0xB2, 0xEF, 0x48, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB7, 0xFD, 0x22, 0xD1, 0xD0, 0xE7, 0xFD, 0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD,
-    0x41, 0x80, 0xFF, 0x55, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x41, 0x83, 0xFF, 0x51, 0x21, 0xD1, 0xFC, 0x21, 0xBB,
-    0xFD, 0x22, 0xD1, 0xD0, 0xF3, 0xFD, 0x22, 0x80, 0x81, 0xE4, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xA1, 0xFF, 0xFB, 0x21,
-    0xB6, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0xBA, 0xE5, 0xB1, 0x21, 0xD0, 0xFC, 0x22, 0x80, 0x8F, 0xF6, 0xFD, 0x41, 0x82,
-    0xF2, 0x56, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xC7, 0xFF,
-    0xFD, 0xE4, 0xA9, 0xA0, 0x00, 0x40, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80,
-    0xE8, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xE7, 0x77, 0x21, 0xD0, 0xFC, 0x41,
-    0x84, 0xE4, 0xF0, 0x21, 0xD1, 0xFC, 0x42, 0xBC, 0xBD, 0xFF, 0xFD, 0xE7, 0xE8, 0x21, 0xD0, 0xF9, 0x22, 0xB2, 0xBE,
-    0xEC, 0xFD, 0x42, 0x82, 0x86, 0xE4, 0xDA, 0xE4, 0xDA, 0x42, 0xD0, 0xD1, 0xE7, 0xB5, 0xFF, 0xF9, 0x42, 0xB5, 0xB8,
-    0xFF, 0xF9, 0xE8, 0xB2, 0x21, 0xD0, 0xF9, 0x41, 0x96, 0xE4, 0xC2, 0x21, 0xD1, 0xFC, 0x41, 0x83, 0xE4, 0xBB, 0x21,
-    0xD1, 0xFC, 0x22, 0x81, 0x82, 0xF6, 0xFD, 0x21, 0xD1, 0xFB, 0x22, 0x80, 0x83, 0xE7, 0xFD, 0x22, 0xD0, 0xD1, 0xC8,
-    0xFB, 0x41, 0xBA, 0xE4, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB8, 0xE7, 0x94, 0x21,
-    0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x87, 0xE4, 0x88, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x82, 0xE7,
-    0xB2, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0x41, 0xB9, 0xE4, 0x77, 0xA1, 0x02, 0x92, 0xD0, 0xFC, 0x21, 0xB5, 0xFB, 0x21,
-    0xD0, 0xFD, 0x41, 0xB8, 0xE4, 0x68, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB0, 0xB5, 0xBB,
-    0xBE, 0xD0, 0xE1, 0xF0, 0xFD, 0x41, 0xBE, 0xF3, 0x15, 0x21, 0xD0, 0xFC, 0x42, 0x80, 0x83, 0xFF, 0xFD, 0xE7, 0x4A,
-    0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x45, 0xB1, 0xB3, 0xBA, 0xBB, 0xBF, 0xFF, 0x38, 0xFF, 0x45, 0xFF, 0x98, 0xFF, 0xA7,
-    0xFF, 0xFB, 0x41, 0xB8, 0xE6, 0xAF, 0x41, 0xB1, 0xE4, 0x2B, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xBE, 0xFF, 0xFD, 0xFF,
-    0x38, 0x21, 0xD0, 0xF9, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xE8, 0xFD, 0x41, 0x86, 0xE4, 0x12, 0x21, 0xD1, 0xFC,
-    0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22,
-    0x82, 0x84, 0xE2, 0xFD, 0x22, 0xD0, 0xD1, 0xB5, 0xFB, 0x21, 0x81, 0xFB, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE3, 0x66,
-    0x50, 0xBA, 0xBF, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xBD, 0xBE, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xB3, 0xB9, 0xF0, 0x43,
-    0xF0, 0x43, 0xFB, 0xFE, 0xFC, 0x23, 0xFC, 0x3B, 0xF0, 0x4C, 0xF0, 0x4C, 0xFC, 0x5C, 0xFD, 0x06, 0xFD, 0x10, 0xFD,
-    0x30, 0xFD, 0x7C, 0xFE, 0xB6, 0xFF, 0xF9, 0xE5, 0xED, 0xE5, 0xED, 0x42, 0x82, 0x8C, 0xFA, 0x4E, 0xF3, 0x89, 0xC2,
-    0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xE3, 0x27, 0xA0, 0x00, 0x92, 0x21, 0xBA, 0xFD, 0xC1, 0x00, 0x92, 0xD1, 0xF7,
-    0xEA, 0x23, 0x81, 0x82, 0x86, 0xFA, 0xF4, 0xF4, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF0, 0xFF, 0xF9, 0xEF, 0xF5,
-    0xE3, 0x0B, 0x41, 0xBC, 0xF0, 0x1B, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xBE, 0xF0, 0x1A, 0xFF, 0xFD, 0x42, 0xB6, 0xBA,
-    0xF0, 0x0D, 0xF0, 0x0D, 0x21, 0xD0, 0xF9, 0x41, 0xBF, 0xF0, 0x03, 0x21, 0xD0, 0xFC, 0x41, 0xB0, 0xEF, 0xFC, 0x21,
-    0xD0, 0xFC, 0x42, 0xB1, 0xBC, 0xEF, 0xF5, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x23, 0x83, 0x8F, 0x96, 0xE5, 0xEC, 0xFD,
-    0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEF, 0xB1, 0xFF, 0xD0, 0xFF, 0xF9, 0xE2, 0xC7, 0xA0, 0x03, 0x23, 0x21, 0xB4, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x94, 0xFD, 0x42,
-    0xB4, 0xBC, 0xF5, 0x59, 0xE3, 0x70, 0x42, 0xD1, 0xD0, 0xF5, 0x8B, 0xFF, 0xF9, 0x41, 0xB5, 0xE8, 0x2A, 0x21, 0xD0,
-    0xFC, 0x21, 0xB3, 0xFD, 0xA1, 0x02, 0x91, 0xD0, 0xFD, 0x41, 0xBB, 0xEA, 0x47, 0x21, 0xD0, 0xFC, 0x23, 0xB9, 0xBE,
-    0xB0, 0xE3, 0xF4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xD2, 0xFF, 0xF9, 0xE2, 0x77, 0x41, 0xBC, 0xE5, 0x30, 0x21,
-    0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE2, 0x5D, 0x50,
-    0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xFF, 0x2F, 0xF4,
-    0xA1, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xFF, 0x4B, 0xFF, 0x8F, 0xFF, 0xDF,
-    0xFF, 0xF9, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xC6, 0xFF, 0xCF,
-    0xE7, 0x49, 0xE4, 0xB3, 0x41, 0xD1, 0xFC, 0x4E, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBE, 0xFD, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xE2, 0x05, 0x41, 0xD0, 0xF9, 0xCD, 0x21, 0xB0,
-    0xFC, 0x43, 0x2E, 0xD0, 0x2D, 0xEE, 0xDF, 0xFF, 0xFD, 0xE1, 0xF5, 0x42, 0xD1, 0x2D, 0xEF, 0x05, 0xE1, 0xEB, 0x41,
-    0x82, 0xF9, 0x65, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE1, 0xDA, 0x41, 0x87, 0xF4,
-    0xCB, 0x21, 0xD1, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xE1, 0xBD, 0x50, 0xBA, 0xBF, 0xB6, 0xB1, 0xB2, 0xB4, 0xBC, 0xBE, 0xB0, 0xB3, 0xB5,
-    0xB7, 0xB8, 0xB9, 0xBB, 0xBD, 0xFF, 0xB1, 0xEE, 0x9A, 0xEE, 0x9A, 0xEE, 0xA3, 0xFF, 0xC1, 0xFF, 0xCB, 0xFF, 0xDC,
-    0xFF, 0xF9, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0x50,
-    0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x80, 0x94, 0x96, 0x97, 0x83, 0x89, 0x8C, 0x8E, 0x8F, 0xF1, 0xF4, 0xEE,
-    0x69, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xFF, 0xAB, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13,
-    0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF,
-    0xE6, 0x78, 0xE3, 0xE2, 0x41, 0xB7, 0xF2, 0xC6, 0xA1, 0x05, 0xE2, 0xD0, 0xFC, 0x21, 0x8F, 0xFB, 0x21, 0xD1, 0xFD,
-    0x42, 0xB6, 0xBD, 0xEE, 0x55, 0xEE, 0x55, 0x21, 0xD0, 0xF9, 0x42, 0xB4, 0xBB, 0xEE, 0x4B, 0xEE, 0x4B, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xF1, 0xC6, 0x43, 0x81, 0x87, 0x89, 0xF8, 0xA1, 0xEE, 0x3D, 0xEE, 0x3D, 0x21, 0xD1, 0xF6, 0x41,
-    0xD1, 0xF6, 0xFA, 0x21, 0x83, 0xFC, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x24, 0xB0, 0xB5, 0xB8,
-    0xBE, 0xD2, 0xDC, 0xED, 0xFD, 0x41, 0x87, 0xEE, 0x17, 0x42, 0xD0, 0xD1, 0xEE, 0x21, 0xFF, 0xFC, 0x42, 0x83, 0x96,
-    0xFF, 0xF9, 0xF1, 0x8B, 0x45, 0x2E, 0x27, 0xD0, 0xD1, 0x2D, 0xED, 0xD2, 0xFF, 0xAD, 0xFF, 0xE5, 0xFF, 0xF9, 0xE0,
-    0xE8, 0x41, 0xBE, 0xE8, 0xB4, 0x43, 0x2E, 0xD0, 0x2D, 0xED, 0xBE, 0xFF, 0xFC, 0xE0, 0xD4, 0x41, 0xB2, 0xEB, 0x78,
-    0x41, 0xBE, 0xE1, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF2, 0xFD, 0x44, 0xB2, 0xBD, 0xB0,
-    0xBE, 0xED, 0xCE, 0xED, 0xCE, 0xE1, 0x6A, 0xFF, 0xFB, 0x41, 0x81, 0xE3, 0xDE, 0x41, 0xBD, 0xEB, 0x06, 0x22, 0xD1,
-    0xD0, 0xF8, 0xFC, 0x21, 0xB9, 0xFB, 0x21, 0xD0, 0xFD, 0x42, 0x8C, 0x96, 0xED, 0xAE, 0xFF, 0xFD, 0x44, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xED, 0x7A, 0xFF, 0xD9, 0xFF, 0xF9, 0xE0, 0x90, 0x42, 0xD0, 0xD1, 0xF1, 0x2C, 0xF6, 0x6A, 0x21, 0x96,
-    0xF9, 0x44, 0x2E, 0x27, 0xD1, 0x2D, 0xED, 0x63, 0xF2, 0xB5, 0xFF, 0xFD, 0xE0, 0x79, 0x42, 0x8C, 0x96, 0xED, 0x83,
-    0xFD, 0x72, 0x41, 0xB4, 0xE2, 0x61, 0xC2, 0x00, 0xB1, 0xD0, 0xD1, 0xFF, 0xFC, 0xEA, 0xCE, 0x45, 0xB2, 0xB9, 0xBA,
-    0xBB, 0xBD, 0xED, 0x75, 0xFF, 0xF7, 0xED, 0x75, 0xED, 0x75, 0xED, 0x75, 0x41, 0xBE, 0xF1, 0x11, 0x21, 0xD0, 0xFC,
-    0x45, 0x82, 0x85, 0x87, 0x8E, 0x94, 0xED, 0x5E, 0xFF, 0xFD, 0xED, 0x5E, 0xED, 0x5E, 0xED, 0x5E, 0x22, 0xD0, 0xD1,
-    0xD9, 0xF0, 0x42, 0xB0, 0xB8, 0xFF, 0xFB, 0xED, 0x4F, 0x44, 0x2E, 0xD1, 0xD0, 0x2D, 0xED, 0x0F, 0xFF, 0xB9, 0xFF,
-    0xF9, 0xE0, 0x25, 0x43, 0x94, 0x8F, 0x8E, 0xEA, 0xB6, 0xEA, 0xB6, 0xEA, 0xB6, 0x21, 0xD1, 0xF6, 0x42, 0xD0, 0x27,
-    0xFD, 0x60, 0xFF, 0xFD, 0x41, 0xB0, 0xEF, 0x6F, 0x21, 0xD0, 0xFC, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x82,
-    0xE2, 0xBA, 0x21, 0xD1, 0xFC, 0x41, 0x8F, 0xE0, 0xB8, 0x21, 0xD1, 0xFC, 0x42, 0xBD, 0xBC, 0xFF, 0xFD, 0xE0, 0xB1,
-    0x21, 0xD0, 0xF9, 0x41, 0xD0, 0xE9, 0x26, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x47, 0xB2, 0xBE, 0xBC, 0xBF, 0xBA,
-    0xB9, 0xBD, 0xFF, 0xCA, 0xF8, 0xE0, 0xEA, 0x7C, 0xFF, 0xDB, 0xFF, 0xE2, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x88, 0xF2,
-    0x76, 0x21, 0xD1, 0xFC, 0x41, 0xBE, 0xF2, 0x6F, 0x21, 0xD0, 0xFC, 0x42, 0xBB, 0xB2, 0xFF, 0xFD, 0xE0, 0x79, 0x21,
-    0xD0, 0xF9, 0x45, 0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xE0, 0x6F, 0xE0, 0x6F, 0xE0, 0x6F, 0xE0, 0x6F, 0xE0, 0x6F, 0x41,
-    0x85, 0xE0, 0x5F, 0x22, 0xD0, 0xD1, 0xEC, 0xFC, 0x41, 0xD1, 0xF2, 0x48, 0x24, 0x8E, 0x8F, 0x97, 0x83, 0xCF, 0xE0,
-    0xF7, 0xFC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAC, 0xFF, 0xF7, 0xDF, 0x81, 0x41, 0xB9, 0xF0, 0xF6, 0x42, 0x8E, 0x94,
-    0xF0, 0xF2, 0xF0, 0xF2, 0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x21, 0xBE, 0xFB, 0x21, 0xD0, 0xFD, 0x42, 0xD0, 0xD1, 0xE0,
-    0x88, 0xE0, 0x11, 0x22, 0x80, 0x83, 0xF6, 0xF9, 0x41, 0xBD, 0xE0, 0x53, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0xB3, 0xBB, 0xEA, 0x09, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x43, 0xD1, 0xD0, 0x2D,
-    0xFF, 0xE1, 0xFF, 0xFD, 0xDF, 0x3B, 0x41, 0xBE, 0xFC, 0x37, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x2D, 0x41, 0xD1,
-    0xE7, 0xB4, 0x21, 0xB8, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xDF, 0x01, 0x43, 0xB0, 0xB5, 0xB8, 0xDE, 0xE2, 0xDE, 0xE2, 0xDE, 0xE2, 0x42, 0x83, 0x96, 0xDE, 0xD8,
-    0xDE, 0xD8, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0xA0, 0x05, 0x41, 0x22, 0xBA, 0xBE, 0xF8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFB, 0xDE, 0xDC, 0x50, 0xBA, 0xBF, 0xB7, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC, 0xBD, 0xB0, 0xB1, 0xB9, 0xB5, 0xBE, 0xB6,
-    0xB8, 0xF1, 0x20, 0xEB, 0xB9, 0xEB, 0xB9, 0xFD, 0xED, 0xFE, 0x01, 0xFE, 0x45, 0xEB, 0xC2, 0xFE, 0x5C, 0xFE, 0xB0,
-    0xFF, 0x54, 0xFF, 0x9A, 0xFF, 0xA8, 0xFF, 0xD4, 0xFF, 0xF9, 0xE1, 0x63, 0xE1, 0x63, 0x41, 0xB5, 0xE6, 0xA7, 0xC2,
-    0x00, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDE, 0xA0, 0xC1, 0x00, 0x92, 0x2E, 0xEB, 0xAB, 0x42, 0xBA, 0xB1, 0xFF, 0xFA,
-    0xEB, 0xA8, 0x42, 0x81, 0x82, 0xFB, 0x6C, 0xFB, 0x6C, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF2, 0xFF, 0xF9, 0xEB,
-    0x6D, 0xDE, 0x83, 0x41, 0x83, 0xFB, 0x7C, 0x21, 0xD1, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD,
-    0x43, 0xB2, 0xBB, 0xBD, 0xEB, 0x83, 0xEB, 0x83, 0xEB, 0x83, 0x21, 0xD0, 0xF6, 0x42, 0x8E, 0x96, 0xFC, 0x5D, 0xFF,
-    0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEB, 0x3C, 0xFF, 0xE9, 0xFF, 0xF9, 0xDE, 0x52, 0x41, 0x27, 0xFE, 0x37, 0x42,
-    0xB2, 0xBC, 0xFF, 0xFC, 0xE8, 0xE8, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xDE, 0x3A, 0x41, 0xBE, 0xF2, 0x02, 0x21, 0xD0,
-    0xFC, 0x21, 0x80, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0xAE, 0xDE, 0x29, 0x50, 0x81, 0x82, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xEE, 0x8E, 0xEB, 0x03, 0xEB, 0x03, 0xEB,
-    0x03, 0xEB, 0x03, 0xFF, 0x7F, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x9C, 0xFF, 0xCD, 0xFF, 0xE5, 0xFF, 0xF6, 0xE0, 0xAD,
-    0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0x41, 0xBE, 0xF3, 0xAF, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0xA0, 0x01, 0xC1,
-    0x21, 0xB2, 0xFD, 0x22, 0xD1, 0xD0, 0xF7, 0xFD, 0x41, 0xBD, 0xEF, 0x32, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0x8F, 0x94, 0xEE, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFB, 0xDD, 0xC7, 0x44, 0xD0, 0xD1, 0x27, 0xD2,
-    0xFE, 0xEB, 0xFF, 0xA1, 0xFF, 0xF9, 0xE2, 0xE4, 0x41, 0xB0, 0xEC, 0x67, 0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x21,
-    0xD0, 0xFD, 0xA0, 0x03, 0xD2, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x22, 0xBF, 0xB8, 0xD6, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xBE, 0xB0, 0xDE, 0x4D, 0xFF, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xEA, 0x4E, 0xFF, 0xF9,
-    0xDD, 0x64, 0x43, 0x2E, 0xD1, 0x2D, 0xEA, 0x44, 0xEA, 0x74, 0xDD, 0x5A, 0x41, 0x87, 0xDE, 0x18, 0x21, 0xD1, 0xFC,
-    0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB4, 0xEE, 0x42, 0x21, 0xD0, 0xFC,
-    0x21, 0x97, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x83, 0x80, 0xEA, 0xFD, 0x41, 0xB5,
-    0xDD, 0xED, 0x21, 0xD0, 0xFC, 0x41, 0x80, 0xF5, 0x34, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x83, 0xEA, 0xFD, 0x41, 0xB3, 0xED, 0xD2, 0x21, 0xD0, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xEB, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0xA0,
-    0x0C, 0x43, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x86, 0xCA, 0xFD, 0x21, 0xD1,
-    0xFB, 0x41, 0xB3, 0xDD, 0x86, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBD, 0xBC, 0xD2, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0x56, 0xFF, 0xFB,
-    0xDC, 0x80, 0x41, 0xBD, 0xEB, 0x24, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x85, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0xBB, 0xEA, 0x85, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0C, 0x22, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBB, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB7, 0xBD, 0xBF, 0xBD, 0xCA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xF9, 0xDC, 0x0A, 0x41, 0x80, 0xDC, 0xCB, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x97, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xDB, 0xE1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xBA, 0xB2, 0xBB, 0xBE, 0xB0, 0xB8, 0xB5, 0xB6,
-    0xB9, 0xBC, 0xBD, 0xBF, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xEE, 0x25, 0xFE, 0x76, 0xFE, 0x80, 0xFF,
-    0x5A, 0xFF, 0xD0, 0xFF, 0xF9, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xA0, 0x00,
-    0x42, 0x21, 0xBF, 0xFD, 0xC1, 0x00, 0x42, 0x2E, 0xE8, 0xB7, 0x21, 0xBA, 0xF4, 0x42, 0xD0, 0x2E, 0xFF, 0xFD, 0xE8,
-    0xAE, 0x22, 0x82, 0x8C, 0xF0, 0xF9, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xE8, 0xFF, 0xFB, 0xE8, 0x78, 0xDB, 0x8E,
-    0x41, 0xBD, 0xF3, 0x33, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xE8, 0x61, 0xFF, 0xFD, 0xDB,
-    0x77, 0x41, 0x80, 0xE8, 0x84, 0x43, 0x2E, 0xD1, 0x2D, 0xE8, 0x53, 0xFF, 0xFC, 0xDB, 0x69, 0x50, 0x81, 0x80, 0x82,
-    0x85, 0x88, 0x94, 0x96, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xD1, 0xFF, 0xE8, 0xFF, 0xF6,
-    0xE8, 0x4C, 0xE8, 0x4C, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD,
-    0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x54, 0xFF, 0xCF, 0xE0, 0x52, 0xDD,
-    0xBC, 0x41, 0x81, 0xE8, 0x38, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE8, 0x07, 0xFF, 0xFC, 0xDB, 0x1D, 0x44, 0x8F,
-    0x94, 0x8E, 0x8C, 0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x28, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xF3,
-    0xE7, 0xEE, 0xDB, 0x04, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xBB, 0xB0, 0xB5, 0xB8,
-    0xB9, 0xBE, 0xED, 0x43, 0xE7, 0xDC, 0xED, 0x43, 0xED, 0x43, 0xE7, 0xDC, 0xE7, 0xDC, 0xED, 0x43, 0xFF, 0xDB, 0xED,
-    0x43, 0xED, 0x43, 0xFF, 0xF4, 0xDD, 0x86, 0xDD, 0x86, 0xDD, 0x86, 0xDD, 0x86, 0xDD, 0x86, 0x41, 0x91, 0xE7, 0xAB,
-    0x41, 0xB2, 0xE7, 0xDA, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDA, 0xBF, 0x41, 0x81, 0xEA, 0xFB, 0xC2, 0x00,
-    0x92, 0x2E, 0xD1, 0xE7, 0xC6, 0xFF, 0xFC, 0x4B, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB9,
-    0xFC, 0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFF, 0xF7, 0xF7, 0x8B, 0xFC, 0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFC,
-    0x12, 0xF7, 0x8B, 0x42, 0x2E, 0xD0, 0xEA, 0xC9, 0xEA, 0xDF, 0x42, 0x82, 0x8C, 0xF1, 0xA0, 0xFF, 0xF9, 0xC2, 0x00,
-    0x92, 0x2E, 0xD1, 0xE7, 0x8D, 0xFF, 0xF9, 0xC2, 0x00, 0x92, 0x2E, 0xD1, 0xE7, 0x84, 0xEA, 0xBB, 0x49, 0x80, 0x81,
-    0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0xF7, 0x49, 0xFF, 0xEE, 0xFF, 0xF7, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0,
-    0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xA2, 0xFF, 0xE4, 0xE7, 0x35, 0xDA, 0x4B,
-    0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x8C, 0x94, 0x96, 0x97, 0x83, 0x88, 0x89, 0x8E, 0x8F, 0xE7, 0x22,
-    0xEC, 0x89, 0xEC, 0x89, 0xE7, 0x22, 0xFF, 0x7F, 0xE7, 0x22, 0xE7, 0x22, 0xFF, 0xF3, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC,
-    0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x15, 0xFF,
-    0x46, 0xFF, 0xCF, 0xDC, 0x9B, 0x41, 0xD1, 0xEE, 0xD2, 0x21, 0xBB, 0xFC, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D,
-    0xE6, 0xE3, 0xFF, 0xFD, 0xFE, 0x8C, 0xD9, 0xF9, 0x41, 0xB5, 0xEB, 0x69, 0x42, 0x83, 0x96, 0xEB, 0x65, 0xEB, 0x65,
-    0x22, 0xD0, 0xD1, 0xF5, 0xF9, 0x21, 0xBD, 0xFB, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xE6, 0xC1, 0xFF, 0xFD, 0xD9,
-    0xD7, 0x41, 0xBE, 0xE4, 0x79, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xE6, 0xB1, 0xFF, 0xFC, 0xD9, 0xC7, 0x41, 0xB9,
-    0xED, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xBA,
-    0xBD, 0xFF, 0xFD, 0xF7, 0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xD9, 0xA1, 0x41, 0x82, 0xF0, 0x79, 0x42, 0xD1, 0x2D,
-    0xFF, 0xFC, 0xD9, 0x96, 0x41, 0xBD, 0xF9, 0xB7, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xD9, 0x8B, 0x50, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBD, 0xBF, 0xBC, 0xBE, 0xB5, 0xB0, 0xB8, 0xB9, 0xFF, 0x8B, 0xE6, 0x68, 0xEB, 0xCF,
-    0xE6, 0x68, 0xEB, 0xCF, 0xE6, 0x68, 0xFF, 0xAD, 0xEB, 0x6E, 0xFF, 0xBD, 0xEB, 0xCF, 0xEB, 0xCF, 0xFF, 0xE3, 0xFF,
-    0xEE, 0xFF, 0xF9, 0xDC, 0x12, 0xDC, 0x12, 0x41, 0x82, 0xE4, 0x8D, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD, 0xC3, 0x00,
-    0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x33, 0xFF, 0xFD, 0xD9, 0x49, 0x42, 0x82, 0x8C, 0xF0, 0x5D, 0xEE, 0x1A, 0xC3, 0x00,
-    0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x20, 0xFF, 0xF9, 0xD9, 0x36, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xDC, 0x61, 0xD9, 0x2A,
-    0x41, 0xBE, 0xE6, 0xF0, 0x21, 0xD0, 0xFC, 0x41, 0x80, 0xE6, 0xE9, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0xBA, 0xBD, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB1, 0xD9, 0xD5,
-    0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x41,
-    0x96, 0xDA, 0xE5, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42,
-    0xB2, 0xBD, 0xFF, 0xFD, 0xE7, 0x5B, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xDD, 0xFD, 0x43, 0xBD,
-    0xBE, 0xB6, 0xFF, 0xC2, 0xD8, 0xAC, 0xFF, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xD8, 0xBA, 0x50, 0x80, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x96, 0x94, 0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x6A, 0xFF, 0x7D, 0xEA, 0xFE,
-    0xEA, 0xFE, 0xEA, 0xFE, 0xE5, 0x97, 0xE5, 0x97, 0xEA, 0xFE, 0xFF, 0x89, 0xFF, 0xF9, 0xDB, 0x41, 0xDB, 0x41, 0xDB,
-    0x41, 0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0x41, 0x88, 0xEE, 0x43, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x41, 0x82,
-    0xEE, 0x39, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x21, 0x8F, 0xFB, 0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD, 0xD8, 0x6C,
-    0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xDF, 0xFF, 0xB0, 0xFF, 0xF7, 0xDD, 0x87, 0x42, 0x2E, 0xD1, 0xE5, 0x6A, 0xED,
-    0x28, 0x21, 0xBB, 0xF9, 0x42, 0x80, 0x81, 0xE5, 0x63, 0xE5, 0x63, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE5,
-    0x2F, 0xFF, 0xF6, 0xFF, 0xF9, 0xD8, 0x45, 0x43, 0xB6, 0xB7, 0xBF, 0xE5, 0x4D, 0xE5, 0x4D, 0xE5, 0x4D, 0xC4, 0x00,
-    0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE5, 0x16, 0xFF, 0xF6, 0xFC, 0xBF, 0xD8, 0x2C, 0x42, 0x81, 0x82, 0xE5, 0x34, 0xE5,
-    0x34, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE5, 0x00, 0xFF, 0xF9, 0xD8, 0x16, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D,
-    0xF0, 0xA5, 0xE4, 0xF4, 0xD8, 0x0A, 0xA0, 0x03, 0x52, 0xA1, 0x03, 0x72, 0x27, 0xFD, 0x21, 0xB4, 0xFB, 0x21, 0xD0,
-    0xFD, 0x41, 0xBC, 0xEA, 0xA7, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x82, 0xF0, 0xFD,
-    0x21, 0xD1, 0xFB, 0xA0, 0x06, 0x22, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x27, 0xFD, 0x21, 0xB2, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xEA, 0x7A, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0x97, 0x83, 0xE8, 0xBB, 0xF5, 0xE7, 0x21, 0xD1, 0xF9, 0x22, 0xB1, 0xBE, 0xF3, 0xFD, 0x21, 0xD0,
-    0xFB, 0x41, 0xB6, 0xEA, 0x5B, 0x21, 0xD0, 0xFC, 0x42, 0xB8, 0xB0, 0xF8, 0x0F, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x21,
-    0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB0, 0xE5, 0xAC, 0x21, 0xD0, 0xFC, 0x41, 0xB5, 0xDD, 0x5C, 0x21, 0xD0, 0xFC,
-    0x21, 0xB1, 0xFD, 0x42, 0xD1, 0xD0, 0xD7, 0x92, 0xFF, 0xFD, 0x21, 0x96, 0xF9, 0x41, 0xB4, 0xDD, 0x59, 0x21, 0xD0,
-    0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xDF, 0x21, 0x22, 0xD1, 0xD0, 0xE9, 0xF9,
-    0x41, 0x8C, 0xD7, 0x72, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x41, 0xB0, 0xD7, 0x34, 0x21, 0xD0, 0xFC, 0x41, 0x83, 0xDC, 0xD5, 0x21, 0xD1, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x22, 0xBB, 0xBE, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0x86, 0xD7, 0x12, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x45, 0xBF, 0xBB, 0xBC, 0xBA, 0xBD, 0xFF, 0x94, 0xFF, 0xBF, 0xFF, 0xD4, 0xFF, 0xF0, 0xFF, 0xFD,
-    0x41, 0x96, 0xD7, 0x26, 0x21, 0xD1, 0xFC, 0x21, 0x84, 0xFD, 0x22, 0xD0, 0xD1, 0xE6, 0xFD, 0x41, 0xB1, 0xE9, 0xBF,
-    0x21, 0xD0, 0xFC, 0x46, 0xB2, 0xBF, 0xB4, 0xB7, 0xBE, 0xB0, 0xFF, 0x19, 0xFF, 0x31, 0xFF, 0x50, 0xFF, 0x67, 0xFF,
-    0xF4, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xF1, 0xFB, 0xE9, 0x9E, 0x41, 0x81, 0xF0, 0x37, 0x21, 0xD1, 0xFC, 0x41, 0xBE,
-    0xF1, 0xF1, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x80, 0xE9, 0xA3, 0xFF, 0xFD, 0x42, 0xD1, 0xD0, 0xFF, 0xF9, 0xF1, 0xDF,
-    0x44, 0x83, 0x97, 0x8F, 0x8E, 0xFF, 0xDD, 0xFF, 0xE8, 0xFF, 0xF9, 0xE9, 0x95, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD,
-    0xFF, 0xF3, 0xD6, 0xB4, 0xA0, 0x05, 0x02, 0x41, 0xBE, 0xEB, 0xC8, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x42, 0x80, 0x82, 0xD7, 0x70, 0xD7, 0x70, 0x21, 0xD1, 0xF9, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x83, 0x96, 0xE1, 0xFD, 0xA0, 0x09, 0xC3, 0x21,
-    0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xFD, 0x97, 0x21, 0xD0, 0xFC, 0x43, 0xB7, 0xB1, 0xB0, 0xFF, 0xF6, 0xFE,
-    0xB0, 0xFF, 0xFD, 0x23, 0x27, 0xD1, 0xD0, 0xB5, 0xE1, 0xF6, 0x42, 0x8F, 0x8E, 0xE0, 0xF6, 0xE0, 0xF6, 0x21, 0xD1,
-    0xF9, 0x41, 0xB4, 0xE9, 0x05, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xB0, 0xB5, 0xE8, 0xF8,
-    0xFE, 0x82, 0x41, 0x8C, 0xE8, 0xF1, 0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x22,
-    0xD0, 0xD1, 0xE9, 0xFD, 0x22, 0x80, 0x87, 0xE1, 0xFB, 0x22, 0x27, 0xD1, 0xCF, 0xFB, 0x41, 0xB3, 0xDA, 0x0F, 0x21,
-    0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x80, 0xF2, 0x2A, 0x21,
-    0xD1, 0xFC, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xD9, 0xB2, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x41,
-    0x81, 0xE0, 0x3C, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x42, 0x80, 0x82, 0xD7, 0xE4, 0xD6, 0xBE, 0x21, 0xD1, 0xF9, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x24, 0x83,
-    0x81, 0x8F, 0x96, 0xC1, 0xCE, 0xDF, 0xFD, 0x41, 0x82, 0xD6, 0x99, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0xA1, 0x02,
-    0x92, 0xD0, 0xFD, 0x41, 0xD1, 0xE0, 0x21, 0x21, 0xBA, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0x84, 0xFD, 0xA1, 0x02, 0x92, 0xD1, 0xFD, 0x41, 0xB6, 0xD6, 0x22, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0xA1,
-    0x09, 0xC3, 0xD0, 0xFD, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x41, 0xB0, 0xE3, 0xF7, 0x21, 0xD0,
-    0xFC, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xF3, 0xFD, 0x41, 0xB4, 0xFE, 0xFC, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xFE,
-    0xF5, 0x21, 0xD0, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0x8F, 0xF1, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x22,
-    0xD0, 0xD1, 0xF2, 0xFD, 0x41, 0xBA, 0xFE, 0xDB, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x23, 0xB1,
-    0xB3, 0xBF, 0xCD, 0xEE, 0xFD, 0x41, 0xB9, 0xFE, 0xC7, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
-    0xBD, 0xDF, 0x7E, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x22,
-    0x85, 0x81, 0xEA, 0xFD, 0x22, 0xD0, 0xD1, 0xD4, 0xFB, 0x41, 0x81, 0xD8, 0x1C, 0xA1, 0x02, 0xB1, 0xD1, 0xFC, 0x21,
-    0xB0, 0xFB, 0x21, 0xD0, 0xFD, 0x45, 0xB0, 0xB5, 0xBE, 0xBC, 0xBD, 0xFF, 0x4E, 0xFF, 0x66, 0xFF, 0xEC, 0xFF, 0xFD,
-    0xF5, 0x1B, 0x42, 0xD1, 0xD0, 0xFF, 0x2B, 0xFF, 0xF0, 0x41, 0xB7, 0xE7, 0xA7, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB2, 0xE7, 0x94, 0x21, 0xD0, 0xFC, 0x41, 0xB8, 0xDF,
-    0x60, 0x21, 0xD0, 0xFC, 0x41, 0xBC, 0xE5, 0xD4, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBB,
-    0xBE, 0xF0, 0xFD, 0x41, 0x80, 0xEC, 0xE5, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x22,
-    0xD0, 0xD1, 0xD9, 0xFD, 0x48, 0xB4, 0xB2, 0xBC, 0xB9, 0xBE, 0xB1, 0xB7, 0xBF, 0xFE, 0x37, 0xFE, 0x76, 0xDF, 0x3D,
-    0xFF, 0x9F, 0xF8, 0x97, 0xFF, 0xB6, 0xFF, 0xBD, 0xFF, 0xFB, 0x42, 0x81, 0x88, 0xD5, 0x45, 0xD5, 0x45, 0x21, 0xD1,
-    0xF9, 0x45, 0xB2, 0xB6, 0xB7, 0xBB, 0xBC, 0xFF, 0xFD, 0xD5, 0x3B, 0xD5, 0x3B, 0xD5, 0x3B, 0xD5, 0x3B, 0x42, 0x81,
-    0x85, 0xD5, 0x2B, 0xD5, 0x2B, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x41, 0xD0, 0xE7, 0x23, 0x43, 0x97, 0x83, 0x8F, 0xFF,
-    0xF7, 0xF4, 0xC5, 0xFF, 0xFC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xF6, 0xD4, 0x49, 0x41, 0x82, 0xD8, 0x33,
-    0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBC, 0xBA, 0xDE,
-    0xD3, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xD4, 0x25, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB,
-    0xBC, 0xBF, 0xBD, 0xB5, 0xB0, 0xBE, 0xB8, 0xB9, 0xE1, 0x02, 0xE6, 0x69, 0xFB, 0xD9, 0xFB, 0xF2, 0xE6, 0x69, 0xE6,
-    0x69, 0xFC, 0x08, 0xE1, 0x02, 0xE6, 0x69, 0xE1, 0x02, 0xFC, 0x14, 0xFD, 0x6A, 0xFF, 0xD5, 0xFF, 0xF9, 0xD6, 0xAC,
-    0xD6, 0xAC, 0x41, 0xBA, 0xE1, 0x04, 0x41, 0xB9, 0xE4, 0x2E, 0x42, 0x2E, 0xD0, 0xE4, 0x27, 0xFF, 0xFC, 0x21, 0xBA,
-    0xF9, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x8C, 0xE4, 0x26, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE0,
-    0xBB, 0xFF, 0xE4, 0xFF, 0xF9, 0xD3, 0xD1, 0x41, 0x96, 0xFE, 0xD6, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBA, 0xB0, 0xE0, 0xC0, 0xFF,
-    0xFD, 0x41, 0x82, 0xEA, 0xC2, 0x21, 0xD1, 0xFC, 0x43, 0x80, 0x81, 0x8C, 0xE0, 0xB2, 0xFF, 0xFD, 0xE0, 0xB2, 0xC4,
-    0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE0, 0x7B, 0xFF, 0xE8, 0xFF, 0xF6, 0xD3, 0x91, 0x47, 0xB1, 0xB3, 0xB7, 0xBA,
-    0xBB, 0xBC, 0xB9, 0xF4, 0xEB, 0xF4, 0xEB, 0xF0, 0x64, 0xF4, 0xEB, 0xF0, 0x64, 0xF0, 0x64, 0xF0, 0x64, 0x46, 0x81,
-    0x82, 0x85, 0x86, 0x87, 0x88, 0xF0, 0x54, 0xF0, 0x4E, 0xF0, 0x4E, 0xF0, 0x4E, 0xF0, 0x4E, 0xF0, 0x4E, 0x44, 0xD0,
-    0xD1, 0x2E, 0x2D, 0xFF, 0xD7, 0xFF, 0xED, 0xE0, 0x43, 0xD3, 0x59, 0x41, 0x82, 0xE6, 0xEA, 0x21, 0xD1, 0xFC, 0x21,
-    0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x82, 0x8F, 0xFF, 0xFD, 0xEE, 0x54, 0x42,
-    0xD1, 0x2D, 0xFF, 0xF9, 0xD3, 0x32, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x96, 0x94,
-    0x97, 0x83, 0x8E, 0x8F, 0xE5, 0x76, 0xFF, 0x5A, 0xFF, 0x9A, 0xE5, 0x76, 0xE5, 0x76, 0xE5, 0x15, 0xE5, 0x76, 0xE5,
-    0x76, 0xE0, 0x0F, 0xFF, 0xD2, 0xFF, 0xF9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xC1, 0x00,
-    0x72, 0x2D, 0xD2, 0xFA, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xD6, 0xFF, 0xC9, 0xFF, 0xFA, 0xD8, 0x18, 0x41, 0x80,
-    0xE5, 0x9E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB5, 0xB0, 0xFB, 0x1B, 0xE5, 0x91, 0x42,
-    0xD0, 0xD1, 0xFF, 0xF9, 0xFC, 0xA6, 0x22, 0x82, 0x87, 0xEF, 0xF9, 0x42, 0x27, 0xD1, 0xF2, 0xB9, 0xFF, 0xFB, 0x41,
-    0x87, 0xE3, 0xC5, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xDD, 0x31, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB1, 0xF6, 0xFD, 0x21, 0xD0,
-    0xFB, 0x41, 0x83, 0xE5, 0x4F, 0x21, 0xD1, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0xA0, 0x08, 0x42, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBB, 0xB5,
-    0xEE, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xB1, 0xE5, 0x25, 0x21, 0xD0, 0xFC, 0x42, 0xBE, 0xB0, 0xFF, 0xFD, 0xFD, 0x7B,
-    0x21, 0xD0, 0xF9, 0x21, 0x80, 0xFD, 0x41, 0xB2, 0xF2, 0xA6, 0x22, 0xD1, 0xD0, 0xF9, 0xFC, 0x41, 0x8C, 0xDC, 0xD5,
-    0x21, 0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0xBD, 0xE1, 0xC3, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x86, 0xFF, 0xFD, 0xE0, 0xEB, 0x41, 0x96, 0xE9, 0x63,
-    0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0x42, 0xBE, 0xB0, 0xD2, 0xD5, 0xFF, 0xFD, 0x22, 0xD1, 0xD0, 0xD9, 0xF9, 0x21, 0x96, 0xFB, 0x21, 0xD1,
-    0xFD, 0x48, 0xBE, 0xB2, 0xBC, 0xB7, 0xB1, 0xB4, 0xB6, 0xBB, 0xEA, 0xF8, 0xFF, 0x26, 0xDC, 0x94, 0xFF, 0x52, 0xFF,
-    0x7C, 0xFF, 0x97, 0xFF, 0xB2, 0xFF, 0xFD, 0x42, 0xB5, 0xB8, 0xD2, 0x9C, 0xD2, 0x9C, 0x41, 0x83, 0xD2, 0x95, 0x22,
-    0xD0, 0xD1, 0xF5, 0xFC, 0x21, 0xBD, 0xFB, 0x21, 0xD0, 0xFD, 0xC1, 0x02, 0xB1, 0xD0, 0xE4, 0x8E, 0x21, 0x81, 0xFA,
-    0x42, 0xD0, 0xD1, 0xE4, 0x81, 0xFF, 0xFD, 0x41, 0xB4, 0xD2, 0x76, 0x21, 0xD0, 0xFC, 0x42, 0xB4, 0xB7, 0xD2, 0x6F,
-    0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x41, 0xBD, 0xE8, 0x2E, 0x21, 0xD0, 0xFC, 0x42, 0x8F, 0x96, 0xFF, 0xFD, 0xE1, 0x33,
-    0x21, 0xD1, 0xF9, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xE8, 0x11,
-    0xA1, 0x03, 0x02, 0xD1, 0xFC, 0x21, 0x86, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x81,
-    0xDB, 0x7E, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x80,
-    0xE4, 0x50, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
-    0xFD, 0x21, 0xD1, 0xFD, 0x24, 0x80, 0x81, 0x84, 0x96, 0xBC, 0xD1, 0xE4, 0xFD, 0x41, 0x83, 0xE7, 0xC7, 0xA1, 0x03,
-    0x02, 0xD1, 0xFC, 0x41, 0xB0, 0xE0, 0xCA, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x22, 0xBC, 0xBD, 0xE8, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xBF, 0xDB, 0x25, 0x21, 0xD0, 0xFC, 0x22,
-    0xBE, 0xB0, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0x80, 0xE0, 0xA0, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB7, 0xE0, 0x8D, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x08, 0x32, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x86, 0xDA, 0xC3, 0x21,
-    0xD1, 0xFC, 0x22, 0xB8, 0xBE, 0xF6, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0, 0xDD,
-    0xD8, 0x21, 0xD0, 0xFC, 0x41, 0x96, 0xE3, 0x8C, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x46, 0xBA, 0xB4, 0xBC, 0xBF, 0xBD, 0xB0, 0xFF, 0x75,
-    0xFF, 0x88, 0xFF, 0xB3, 0xFF, 0xDD, 0xFF, 0xE4, 0xFF, 0xFD, 0x42, 0xD1, 0xD0, 0xFF, 0x29, 0xFF, 0xED, 0x21, 0x82,
-    0xF9, 0x21, 0xD1, 0xFD, 0x41, 0xB5, 0xDD, 0x98, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xDA, 0x67, 0x21, 0xD0, 0xFC, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x84, 0xF0, 0xFD, 0x42, 0xD0, 0xD1, 0xE3, 0xB7, 0xFF, 0xFB, 0x21, 0x82,
-    0xF9, 0x21, 0xD1, 0xFD, 0x41, 0x82, 0xDF, 0xD2, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x47, 0x83, 0x87, 0x8F, 0x97, 0x81, 0x80, 0x88, 0xF2, 0xD0, 0xFE, 0x4F, 0xFE, 0x5B, 0xFE, 0x70,
-    0xFF, 0xB2, 0xFF, 0xD8, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFE, 0x0D, 0xFF, 0xEA, 0xCF, 0xFA, 0x41, 0xB2, 0xE3,
-    0xD7, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x8F, 0xE0,
-    0xE2, 0x21, 0xD1, 0xFC, 0x43, 0xB4, 0xBD, 0xBC, 0xE2, 0xCE, 0xFF, 0xFD, 0xE0, 0xDB, 0x42, 0xD0, 0xD1, 0xFF, 0xF6,
-    0xE2, 0xCA, 0x41, 0xB9, 0xE0, 0xCA, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21,
-    0xD0, 0xFD, 0xA0, 0x0A, 0x32, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB0,
-    0xE7, 0xB9, 0x21, 0xD0, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB1, 0xBF, 0xF0, 0xFD, 0x41, 0xBD, 0xE7,
-    0xA7, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xDF, 0xFD, 0x42, 0xBE, 0xB0, 0xFF, 0xFB, 0xFA, 0xC3, 0x21,
-    0xB2, 0xB7, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBE,
-    0xF2, 0x3D, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0x81,
-    0x83, 0x96, 0xE9, 0x27, 0xFF, 0xEA, 0xFF, 0xFD, 0x22, 0xD0, 0xD1, 0xCA, 0xF6, 0x41, 0xBC, 0xE2, 0x2D, 0x21, 0xD0,
-    0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x47, 0xBE, 0xBC, 0xBF, 0xB9, 0xB3,
-    0xB4, 0xB2, 0xE3, 0x24, 0xF7, 0x50, 0xFF, 0x42, 0xFF, 0x56, 0xFF, 0x6D, 0xFF, 0xE8, 0xFF, 0xFD, 0x44, 0xB4, 0xB6,
-    0xB7, 0xBB, 0xE0, 0x11, 0xE0, 0x11, 0xE0, 0x11, 0xE0, 0x11, 0x42, 0x81, 0x85, 0xE0, 0x04, 0xE0, 0x04, 0x22, 0xD0,
-    0xD1, 0xEC, 0xF9, 0x42, 0x97, 0x83, 0xFF, 0xFB, 0xED, 0x24, 0x22, 0xD0, 0xD1, 0xCA, 0xF9, 0x21, 0xB5, 0xFB, 0x21,
-    0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x41, 0xB8, 0xD0, 0xDA, 0x21, 0xD0, 0xFC, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xCE, 0xC8, 0x41,
-    0x8C, 0xD2, 0xB2, 0x21, 0xD1, 0xFC, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB5, 0xF8, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBE, 0xB5, 0xEA, 0xFD, 0x21, 0xD0, 0xFB, 0x42, 0xBB, 0xBD, 0xE5, 0x69, 0xFF,
-    0xFD, 0x21, 0xB5, 0xEE, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xCE,
-    0x7A, 0x50, 0xB1, 0xB4, 0xB7, 0xBF, 0xBB, 0xBE, 0xB5, 0xB0, 0xB2, 0xB3, 0xB6, 0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xDB,
-    0x54, 0xE0, 0xBB, 0xDB, 0x54, 0xDB, 0x54, 0xDB, 0x5D, 0xFE, 0x76, 0xFF, 0xA8, 0xFF, 0xF6, 0xD0, 0xFE, 0xD0, 0xFE,
-    0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0x41, 0xBE, 0xE0, 0x97, 0x21, 0xD0, 0xFC,
-    0x42, 0xB2, 0xBD, 0xCE, 0xE5, 0xCE, 0xE5, 0x21, 0xD0, 0xF9, 0x43, 0xBF, 0xBA, 0xBE, 0xF2, 0x85, 0xFF, 0xF3, 0xFF,
-    0xFD, 0xC1, 0x00, 0x42, 0xD0, 0xDE, 0x6C, 0x43, 0x82, 0x8C, 0x83, 0xFF, 0xFA, 0xF2, 0x84, 0xCF, 0x49, 0x44, 0xD0,
-    0xD1, 0x2E, 0x2D, 0xFF, 0xE6, 0xFF, 0xF6, 0xDA, 0xFE, 0xCE, 0x14, 0xA0, 0x03, 0x94, 0x21, 0xB4, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xFC, 0x8A, 0x41, 0xD0,
-    0xED, 0x89, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x81, 0xDB, 0xD2, 0x21, 0xD1, 0xFC, 0x44, 0x84, 0x97, 0x81, 0x8F,
-    0xFF, 0xD6, 0xCE, 0xA1, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0A, 0xB2, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBC, 0xCF, 0xA5, 0x21, 0xD0, 0xFC, 0x21, 0xB5,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB9, 0xD7, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB, 0xFA, 0x41, 0x21, 0xD0, 0xFC, 0x45, 0xB5,
-    0xB1, 0xBC, 0xBF, 0xB9, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xF6, 0xFF, 0xFD, 0xD8, 0x54, 0xC2, 0x00, 0xB2, 0xD1, 0xD0,
-    0xFF, 0xA1, 0xFF, 0xF0, 0xA0, 0x0A, 0x12, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0xA1, 0x00, 0xB2,
-    0xD0, 0xFD, 0x42, 0x97, 0x83, 0xCE, 0x28, 0xF6, 0xB5, 0x41, 0x80, 0xCE, 0x21, 0x21, 0xD1, 0xFC, 0x42, 0xB4, 0xBC,
-    0xCF, 0x40, 0xCE, 0x1A, 0x42, 0xD1, 0xD0, 0xD7, 0xAA, 0xFF, 0xF9, 0x41, 0xBF, 0xCD, 0xFE, 0x21, 0xD0, 0xFC, 0x21,
-    0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x45, 0xB2, 0xBC, 0xBE, 0xB9, 0xBD, 0xE2, 0x51,
-    0xE2, 0x51, 0xFF, 0xDC, 0xFF, 0xE6, 0xFF, 0xFD, 0xA2, 0x00, 0xB2, 0xD1, 0xD0, 0xC1, 0xF0, 0x43, 0xBE, 0xB5, 0xB8,
-    0xFF, 0xA0, 0xFF, 0xB5, 0xFF, 0xF9, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xD9, 0xEC, 0xFF, 0xF6, 0xCE, 0x9C, 0xCD, 0x02,
-    0xA0, 0x05, 0x43, 0x21, 0x80, 0xFD, 0x41, 0xB8, 0xDA, 0xD3, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x22, 0xD1, 0xD0,
-    0xF3, 0xFD, 0x42, 0xBE, 0xB2, 0xFF, 0xFB, 0xE2, 0x0E, 0x41, 0xBD, 0xFD, 0x00, 0x21, 0xD0, 0xFC, 0x42, 0xBC, 0xB9,
-    0xF5, 0x00, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x42, 0x96, 0x83, 0xFF, 0xFD, 0xCE, 0xCA, 0x22, 0xD0, 0xD1, 0xE1, 0xF9,
-    0xA0, 0x0A, 0x53, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0xA1, 0x02, 0xC1, 0xD1, 0xFD, 0x21, 0x81,
-    0xFB, 0x41, 0x96, 0xD7, 0x2C, 0x21, 0xD1, 0xFC, 0x41, 0xBB, 0xCE, 0x9D, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0xBD, 0xB2, 0xF0, 0xFD, 0x22, 0xD1, 0xD0, 0xE4, 0xFB, 0x41, 0xBD, 0xFA, 0x3D, 0x21, 0xD0, 0xFC,
-    0x41, 0xD0, 0xF6, 0xC7, 0x23, 0xBE, 0xB5, 0xB0, 0xF0, 0xF9, 0xFC, 0x41, 0x80, 0xCE, 0x74, 0x21, 0xD1, 0xFC, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE,
-    0xFE, 0x71, 0x21, 0xD0, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x83, 0xF0, 0xFD, 0x22, 0xD0, 0xD1,
-    0xCE, 0xFB, 0x41, 0xBC, 0xCD, 0x10, 0x21, 0xD0, 0xFC, 0x43, 0xB4, 0xB2, 0xB9, 0xFF, 0x80, 0xFF, 0xF4, 0xFF, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCC, 0x37, 0x50, 0x81, 0x80, 0x82, 0x84, 0x86, 0x96, 0x94, 0x97, 0x83, 0x85, 0x87,
-    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0x1C, 0xFF, 0x2E, 0xF0, 0xC7, 0xD9, 0x1D, 0xD9, 0x1D, 0xFF, 0xF9, 0xCE, 0xBE,
-    0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0x44,
-    0xD0, 0xD1, 0xD2, 0x27, 0xFD, 0x8F, 0xFF, 0xCF, 0xD1, 0x23, 0xCE, 0x8D, 0x41, 0xBB, 0xD9, 0x09, 0xC3, 0x00, 0x42,
-    0x2E, 0xD0, 0x2D, 0xD8, 0xD8, 0xFF, 0xFC, 0xCB, 0xEE, 0x42, 0x2E, 0xD1, 0xCC, 0x8F, 0xF2, 0x8F, 0x43, 0x81, 0x83,
-    0x96, 0xD8, 0xF2, 0xFF, 0xF9, 0xF2, 0x8C, 0x41, 0xBD, 0xCF, 0x05, 0x21, 0xD0, 0xFC, 0x41, 0x89, 0xCC, 0x77, 0x21,
-    0xD1, 0xFC, 0x41, 0x80, 0xCE, 0xF7, 0x21, 0xD1, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21,
-    0xD0, 0xFD, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xCC, 0x5D, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E,
-    0xD1, 0xD0, 0x2D, 0xD8, 0x8D, 0xFF, 0xC8, 0xFF, 0xF3, 0xCB, 0xA3, 0x41, 0x81, 0xD1, 0x23, 0xC2, 0x00, 0xE2, 0xD1,
-    0x2D, 0xFF, 0xFC, 0xCB, 0x90, 0x41, 0xB5, 0xEB, 0x94, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0x81, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xCB, 0x77, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBF, 0xB9, 0xBE, 0xB5, 0xB0, 0xB8, 0xDD, 0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xD8, 0x54, 0xDD, 0xBB,
-    0xFF, 0x82, 0xDD, 0x5A, 0xFF, 0xCD, 0xF0, 0x53, 0xDD, 0xBB, 0xD8, 0x54, 0xFF, 0xE0, 0xFF, 0xF9, 0xCD, 0xFE, 0xCD,
-    0xFE, 0x42, 0x82, 0x8C, 0xDB, 0x8D, 0xE0, 0x1C, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xD8, 0x22, 0xFF, 0xF9, 0xCB,
-    0x38, 0x42, 0xBB, 0xBE, 0xDC, 0xAB, 0xCC, 0x57, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xD8, 0x0F, 0xFF, 0xF9, 0xCB,
-    0x25, 0x41, 0xB3, 0xCD, 0xDC, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xCB, 0x09, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x83, 0x94, 0x96, 0x97,
-    0x8C, 0x8E, 0x8F, 0xDD, 0x4D, 0xFF, 0xCA, 0xEF, 0xE5, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xFF, 0xDD,
-    0xD7, 0xE6, 0xFF, 0xF9, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0x44, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFF, 0x61, 0xFF, 0xCF, 0xCF, 0xF5, 0xCD, 0x5F, 0x50, 0xB0, 0xB5, 0xB8, 0xBE, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xCF, 0xEC, 0xD3, 0x12, 0xD3, 0xD4, 0xD7, 0x99, 0xDC, 0x36, 0xE0,
-    0x9A, 0xE3, 0x52, 0xE8, 0x9F, 0xE9, 0x70, 0xED, 0x04, 0xEF, 0x96, 0xF0, 0xB7, 0xF2, 0x61, 0xF7, 0xD0, 0xFE, 0xC5,
-    0xFF, 0xF3, 0x41, 0x82, 0xCA, 0xA6, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFC, 0xCA, 0x8F, 0xC1, 0x00, 0xC1, 0xD0,
-    0xE8, 0xC0, 0x41, 0xD1, 0xD4, 0x32, 0x22, 0xBD, 0xBA, 0xF6, 0xFC, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xFB, 0xCA,
-    0x77, 0xC2, 0x00, 0xD1, 0xD1, 0x2D, 0xD2, 0xFC, 0xCA, 0x6E, 0xA0, 0x06, 0x42, 0x21, 0x8E, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0x27, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0xD0, 0xFF, 0xFD, 0xEA, 0xFB,
-    0x21, 0xB5, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0xBD, 0xD7, 0xBC, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBC, 0xFB, 0x21, 0xD0,
-    0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xCB, 0x2E, 0x21, 0xD1,
-    0xFC, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x23, 0x82, 0x84, 0x96, 0xC3, 0xF0, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xF9,
-    0xCA, 0x02, 0x41, 0xBE, 0xD1, 0xFE, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xEB, 0x41, 0x81, 0xD0, 0x5A, 0x21, 0xD1, 0xFC, 0x21, 0x8E, 0xFD, 0x41, 0xBB, 0xE3,
-    0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD,
-    0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xC9, 0xC4, 0x41, 0x96, 0xCB, 0x96, 0x21, 0xD1, 0xFC, 0x21, 0xB2,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xAA, 0x50, 0xB0, 0xB5, 0xB8, 0xBE,
-    0xB9, 0xBD, 0xB7, 0xBB, 0xBC, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xBA, 0xBF, 0xC9, 0xA6, 0xFF, 0x14, 0xCC, 0xCD, 0xFF,
-    0x2C, 0xFF, 0x35, 0xFF, 0xA1, 0xFF, 0xB8, 0xFF, 0xDF, 0xFF, 0xF9, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31,
-    0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0x41, 0x83, 0xCA, 0x9D, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xC9, 0x68, 0x42, 0xD1, 0x2D, 0xCC, 0x39, 0xC9, 0x61, 0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x81, 0x96,
-    0x80, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84,
-    0xFF, 0xF2, 0xFF, 0xF9, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB,
-    0xE8, 0xCB, 0xE8, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x86, 0xFF, 0xCF, 0xCE, 0x4D, 0xCB, 0xB7, 0x42,
-    0xB3, 0xB6, 0xC9, 0xC7, 0xC9, 0xC7, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x43, 0x27, 0xD0, 0x2D, 0xDB, 0x49, 0xFF,
-    0xFD, 0xC9, 0x0D, 0x41, 0x96, 0xCA, 0x5E, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xDB, 0x3B, 0xC9, 0xB5, 0xFF, 0xFC, 0xC8,
-    0xFF, 0x41, 0xB0, 0xDB, 0x4A, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x41, 0xB5, 0xD0, 0xC4, 0x21, 0xD0, 0xFC, 0x21,
-    0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xED, 0xFF, 0xFD, 0xC8, 0xD8, 0x41,
-    0xB0, 0xC9, 0xF9, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC8, 0xCA, 0x41, 0xD0, 0xE7, 0xEB, 0x21, 0xB3, 0xFC, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xC8, 0xBC, 0x41, 0xBF, 0xCA, 0x10, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x42,
-    0xBB, 0xBE, 0xD0, 0x8A, 0xFF, 0xFD, 0x41, 0xBF, 0xCB, 0xD5, 0x21, 0xD0, 0xFC, 0xA0, 0x09, 0x73, 0x21, 0xBA, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB1, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x83, 0x96, 0xDC, 0xFD, 0x42, 0xB2, 0xB3, 0xF2, 0xC0, 0xFC,
-    0x00, 0x21, 0xD0, 0xF9, 0x41, 0xBA, 0xD6, 0x09, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB5, 0xF6, 0xFD, 0xA2, 0x06, 0xA2,
-    0xD1, 0xD0, 0xE5, 0xFB, 0x21, 0x80, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAC, 0xFF, 0xFD, 0xC8, 0x54, 0x41, 0xBB,
-    0xCB, 0x84, 0x21, 0xD0, 0xFC, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8E, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD,
-    0xC8, 0x3A, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB2, 0xBC, 0xBF, 0xB3, 0xB7, 0xBA, 0xBB, 0xB1, 0xB4, 0xB6, 0xB8, 0xBD,
-    0xCB, 0x5D, 0xCB, 0x5D, 0xCB, 0x5D, 0xCE, 0x5F, 0xFF, 0x26, 0xFF, 0x34, 0xFF, 0x5B, 0xFF, 0x69, 0xFF, 0x77, 0xFF,
-    0xDF, 0xFF, 0xF9, 0xD0, 0xDA, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0x41, 0xB2, 0xE1, 0x1A, 0xC2, 0x00,
-    0x61, 0xD0, 0x2D, 0xFF, 0xFC, 0xC7, 0xFE, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xCD, 0xA1, 0xC7, 0xF5, 0x41, 0x81, 0xC8,
-    0x9F, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xB0, 0xB1,
-    0xBE, 0xDC, 0x97, 0xD9, 0xAB, 0xFF, 0xFD, 0xC1, 0x00, 0xB2, 0xD0, 0xE7, 0x09, 0x21, 0xB4, 0xFA, 0x21, 0xD0, 0xFD,
-    0x21, 0x8F, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xC7, 0xC0, 0x41, 0x88, 0xC8, 0x63, 0x21, 0xD1,
-    0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x41, 0xBD, 0xE6, 0xE4, 0x21, 0xD0, 0xFC, 0x22, 0xB0,
-    0xBF, 0xFD, 0xF3, 0x21, 0xD0, 0xFB, 0x41, 0xB8, 0xC8, 0x44, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x83, 0xE4, 0xFD, 0x43, 0xD0,
-    0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xFB, 0xC7, 0x79, 0x41, 0xB2, 0xC9, 0x51, 0x41, 0xB1, 0xCA, 0x9F, 0x21, 0xD0, 0xFC,
-    0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xC7, 0x5B,
-    0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x53,
-    0xCA, 0x7B, 0xCA, 0x7B, 0xFF, 0x5C, 0xCA, 0x7B, 0xCA, 0x7B, 0xFF, 0x91, 0xFF, 0xD8, 0xFF, 0xF6, 0xC9, 0xDF, 0xC9,
-    0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFE,
-    0xED, 0xFF, 0xCF, 0xCC, 0x44, 0xC9, 0xAE, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xCA, 0x3B, 0xCA, 0x3B, 0xCA, 0x3B, 0xCD, 0x3D, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F,
-    0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0x50,
-    0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xCA, 0x0A, 0xCA,
-    0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E,
-    0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E,
-    0xFF, 0xCF, 0xCB, 0xD3, 0xC9, 0x3D, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xCC, 0x1D, 0xC6, 0xA0, 0x41, 0xB5, 0xFA, 0xD8,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC6, 0x93, 0x41, 0xBA, 0xC7, 0x39, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xC6, 0x82, 0x41, 0x96, 0xC7, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x77, 0x50, 0xB0, 0xB5,
-    0xBE, 0xB9, 0xB4, 0xB7, 0xBA, 0xB1, 0xB2, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xBD, 0xBF, 0xCE, 0xD1, 0xFF, 0xD0, 0xC9,
-    0x9A, 0xCC, 0x9C, 0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE,
-    0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0x41, 0x83, 0xC7, 0x3D, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x3B,
-    0x41, 0xD0, 0xFD, 0x66, 0x21, 0x80, 0xFC, 0x21, 0xD1, 0xFD, 0x42, 0xBA, 0xBE, 0xFF, 0xFD, 0xC7, 0x0C, 0x42, 0xD0,
-    0x2D, 0xFF, 0xF9, 0xC6, 0x23, 0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x96, 0x82, 0x84, 0x85, 0x86, 0x87,
-    0x88, 0x89, 0x8C, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xFF, 0xE1, 0xFF, 0xF9, 0xFC, 0xBB,
-    0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC4, 0x00, 0x42,
-    0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xCB, 0x0F, 0xC8, 0x79, 0x41, 0xB5, 0xDA, 0x7F, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xC5, 0xD8, 0x50, 0x83, 0x8E, 0x94, 0x97, 0x80, 0x96, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8C, 0x8F, 0xC8, 0xFB, 0xC8, 0xFB, 0xC8, 0xFB, 0xC8, 0xFB, 0xFF, 0xF9, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8,
-    0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xA0, 0x06, 0xC3, 0x42,
-    0xBD, 0xB8, 0xFF, 0xFD, 0xC8, 0xD1, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC5, 0x96, 0x41, 0xBF, 0xDF, 0xD0, 0x21, 0xD0,
-    0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBA, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xE9, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0x96, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEB, 0xFF, 0xFD, 0xC5, 0x5F, 0x41, 0xBE, 0xC9, 0xC1, 0x21,
-    0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1,
-    0x2D, 0xFF, 0xFD, 0xC5, 0x3F, 0x41, 0x80, 0xDC, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xC5, 0x2E, 0x50, 0xB9, 0xB4, 0xBF, 0xB2, 0xB3, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBE, 0xCB, 0x53, 0xFF, 0x91, 0xFF, 0xC8, 0xFF, 0xE8, 0xFF, 0xF9, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5,
-    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC4, 0x00, 0x42, 0xD1, 0xD0,
-    0xD2, 0x27, 0xFF, 0x25, 0xFF, 0xCF, 0xCA, 0x1A, 0xC7, 0x84, 0x41, 0xB4, 0xCF, 0x95, 0x42, 0xD0, 0x2D, 0xFF, 0xFC,
-    0xC4, 0xE3, 0x42, 0xD0, 0x2D, 0xCC, 0xB4, 0xC4, 0xDC, 0x50, 0xB5, 0xBE, 0xB9, 0xB6, 0xB7, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xC7, 0xFF, 0xC7, 0xFF, 0xCB, 0x01, 0xFF, 0xF2, 0xFF, 0xF9, 0xC7, 0x63,
-    0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7,
-    0x63, 0x42, 0xD1, 0x2D, 0xC5, 0x54, 0xC4, 0xA4, 0x41, 0xB0, 0xE5, 0x3C, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x99,
-    0x50, 0x8E, 0x81, 0x85, 0x94, 0x96, 0x97, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8F, 0xC7, 0xBC,
-    0xFF, 0xEE, 0xFF, 0xF9, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7,
-    0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF,
-    0x8C, 0xFF, 0xCF, 0xC9, 0x85, 0xC6, 0xEF, 0x42, 0xD0, 0xD1, 0xC5, 0x79, 0xFC, 0xC2, 0x21, 0xB0, 0xF9, 0xC4, 0x00,
-    0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x32, 0xFF, 0xFD, 0xEA, 0xFC, 0xC4, 0x48, 0x42, 0xB2, 0xB6, 0xD1, 0x50, 0xD1,
-    0x50, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x1C, 0xFF, 0xF9, 0xD1, 0x4C, 0xC4, 0x32, 0x41, 0xBD, 0xD1,
-    0x3A, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x09, 0xFF, 0xFC, 0xD1, 0x39, 0xC4, 0x1F, 0x41, 0xB7, 0xD4,
-    0x55, 0x42, 0x2E, 0xD0, 0xD1, 0x20, 0xFF, 0xFC, 0x21, 0x8C, 0xF9, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xD0, 0xEC,
-    0xFF, 0xFD, 0xC4, 0x02, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xD0, 0xE0, 0xC4, 0xDB, 0xC3, 0xF6, 0x41, 0x82, 0xD4,
-    0x2F, 0x42, 0x2E, 0xD1, 0xD0, 0xFA, 0xFF, 0xFC, 0x42, 0x81, 0x8C, 0xFF, 0xF9, 0xD0, 0xF6, 0xC3, 0x00, 0x42, 0x2E,
-    0xD1, 0x2D, 0xD0, 0xC2, 0xFF, 0xF9, 0xC3, 0xD8, 0x41, 0xBC, 0xCE, 0x50, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21,
-    0xD0, 0xFD, 0x41, 0xB2, 0xEA, 0xA2, 0x41, 0xBB, 0xD7, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x22, 0xD0, 0xD1,
-    0xF2, 0xFD, 0x41, 0xBD, 0xE9, 0xFB, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21,
-    0xD1, 0xFD, 0xA0, 0x07, 0x31, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD,
-    0xF1, 0x22, 0xD0, 0xD1, 0xFD, 0xF1, 0x41, 0x80, 0xD7, 0x20, 0x21, 0xD1, 0xFC, 0x23, 0xB0, 0xB8, 0xB5, 0xEE, 0xF4,
-    0xFD, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xF3, 0x41, 0x80, 0xFE, 0x1D, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x41, 0xB2, 0xC3,
-    0xEB, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x0B, 0xA3, 0x21, 0xBC, 0xFD, 0x41, 0x85, 0xCD,
-    0xD6, 0xC3, 0x02, 0xC1, 0x2E, 0xD0, 0xD1, 0xCD, 0xD2, 0xFF, 0xF9, 0xFF, 0xFC, 0xC1, 0x04, 0xC2, 0x2E, 0xF6, 0x4D,
-    0x41, 0x88, 0xC4, 0x12, 0xA1, 0x02, 0xC1, 0xD1, 0xFC, 0x45, 0xB0, 0xB8, 0xBE, 0xB5, 0xBD, 0xFF, 0xE5, 0xFF, 0xF1,
-    0xCD, 0xB7, 0xFF, 0xFB, 0xC4, 0x09, 0x44, 0x83, 0x8F, 0x8E, 0x96, 0xCD, 0xA7, 0xCD, 0xA7, 0xCD, 0xA7, 0xCD, 0xA7,
-    0x22, 0xD0, 0xD1, 0xE3, 0xF3, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x47, 0xB9, 0xB4, 0xBC, 0xB2, 0xB3, 0xBB, 0xBE,
-    0xFF, 0x49, 0xFF, 0x5A, 0xFF, 0x6F, 0xFF, 0x97, 0xFF, 0xA1, 0xFF, 0xB0, 0xFF, 0xFD, 0x41, 0x87, 0xD0, 0xDF, 0x42,
-    0xBC, 0xB3, 0xCD, 0x75, 0xF6, 0x96, 0x22, 0xD1, 0xD0, 0xF5, 0xF9, 0x41, 0xBC, 0xD0, 0xCF, 0x21, 0xD0, 0xFC, 0x41,
-    0xBF, 0xD6, 0x7C, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0x83, 0x96, 0x87, 0xE7, 0xF0, 0xFD,
-    0xA0, 0x0A, 0xD2, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0x01, 0x21,
-    0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x81, 0x80, 0xFD, 0xF7, 0x21, 0xD1, 0xFB, 0x22, 0x94, 0x8F, 0xEC, 0xFD, 0x21,
-    0xD1, 0xFB, 0x43, 0xD0, 0xD1, 0x27, 0xFF, 0x97, 0xFF, 0xD1, 0xFF, 0xFD, 0x21, 0xB7, 0xF6, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFD, 0xC2, 0x95, 0x41, 0xBE, 0xC4, 0x8A, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD,
-    0x21, 0xD0, 0xFD, 0x42, 0xB4, 0xB9, 0xD8, 0xF0, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC2, 0x74, 0x41, 0xB0,
-    0xEE, 0xC1, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC2, 0x69, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBF, 0xB9, 0xBE, 0xB0, 0xB5, 0xB8, 0xD4, 0xAD, 0xFE, 0x1A, 0xD4, 0xAD, 0xFE, 0x30, 0xD4, 0xAD, 0xFE, 0x43,
-    0xEA, 0x4C, 0xFE, 0x60, 0xFE, 0x6C, 0xFE, 0x8A, 0xD4, 0xAD, 0xCF, 0x46, 0xFF, 0xCD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC4,
-    0xF0, 0x43, 0x2E, 0xD0, 0xD1, 0xCF, 0x45, 0xD2, 0x79, 0xD7, 0x03, 0x43, 0x80, 0x82, 0x8C, 0xCF, 0x3E, 0xFF, 0xF6,
-    0xD7, 0x04, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xCF, 0x07, 0xFF, 0xF6, 0xC2, 0x1D, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
-    0xD1, 0x2D, 0xCE, 0xFB, 0xE7, 0x4E, 0xD3, 0xB2, 0xC2, 0x11, 0x41, 0x81, 0xE8, 0x02, 0xC3, 0x00, 0x42, 0x2E, 0xD1,
-    0x2D, 0xCE, 0xE8, 0xFF, 0xFC, 0xC1, 0xFE, 0x41, 0x86, 0xDE, 0xD4, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xDE, 0xD3, 0xFF,
-    0xFC, 0xCE, 0xD8, 0xC1, 0xEE, 0x41, 0x81, 0xD5, 0xCE, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA,
-    0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC1, 0xBF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80,
-    0x83, 0x94, 0x96, 0x97, 0x8E, 0x8F, 0xFF, 0x9B, 0xFF, 0xA7, 0xD4, 0x03, 0xD4, 0x03, 0xD3, 0xA2, 0xD4, 0x03, 0xD4,
-    0x03, 0xFF, 0xBA, 0xFF, 0xCA, 0xD4, 0x03, 0xFF, 0xF9, 0xC4, 0x46, 0xC4, 0x46, 0xC4, 0x46, 0xC4, 0x46, 0xC4, 0x46,
-    0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x25, 0xE6, 0xC0, 0xFF, 0xCF, 0xEE, 0x8D, 0x41, 0xBF, 0xCE, 0x91, 0x41, 0xBF,
-    0xD1, 0xBB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0xC3, 0x00, 0x42, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFD, 0xC1,
-    0x6C, 0x41, 0x80, 0xCB, 0x73, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xD4, 0xCC, 0x21,
-    0xD0, 0xFC, 0x44, 0xB2, 0xBA, 0xBC, 0xBF, 0xF3, 0x51, 0xFF, 0xF6, 0xFF, 0xFD, 0xE5, 0x4D, 0x42, 0xD0, 0xD1, 0xFF,
-    0xF3, 0xEF, 0xD4, 0x42, 0x86, 0x80, 0xFF, 0xF9, 0xC3, 0x46, 0x42, 0xD1, 0xD0, 0xFF, 0xF9, 0xC5, 0xE5, 0x42, 0xD0,
-    0xD1, 0xD3, 0x7E, 0xD6, 0x24, 0x21, 0xB0, 0xF9, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xC8, 0xF9, 0x21, 0xD1, 0xFC, 0x42,
-    0xB2, 0xB6, 0xFF, 0xFD, 0xC2, 0x47, 0x41, 0xB5, 0xC2, 0xEB, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD,
-    0x41, 0xB8, 0xD5, 0x25, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xCF, 0xA9, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
-    0xFD, 0x41, 0xBC, 0xCF, 0x9C, 0x21, 0xD0, 0xFC, 0x41, 0xB1, 0xCF, 0x95, 0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x21,
-    0xD1, 0xFD, 0x22, 0xBE, 0xBB, 0xF0, 0xFD, 0x21, 0xD0, 0xFB, 0x41, 0xB9, 0xCF, 0x80, 0x21, 0xD0, 0xFC, 0x21, 0xB0,
-    0xFD, 0x21, 0xD0, 0xFD, 0x24, 0xB2, 0xB7, 0xBA, 0xBC, 0xC7, 0xD4, 0xF0, 0xFD, 0xA0, 0x0B, 0x23, 0x21, 0xB5, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xE5, 0xFD, 0x21, 0x82,
-    0xFB, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x80, 0xFF, 0x9A, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xFF, 0x82, 0xFF, 0xF9, 0x47,
-    0xBA, 0xBF, 0xB5, 0xBB, 0xB0, 0xB8, 0xBE, 0xE4, 0xE8, 0xE4, 0xE8, 0xFF, 0x60, 0xFF, 0x71, 0xC8, 0x6D, 0xC3, 0xC5,
-    0xFF, 0xF9, 0x41, 0xB4, 0xE2, 0xD5, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21,
-    0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x42, 0x82, 0x88, 0xCB, 0x9F, 0xC1, 0x12, 0xA2, 0x00, 0xB2, 0xD0, 0xD1, 0xF6, 0xF9,
-    0x41, 0x82, 0xD1, 0xD6, 0x21, 0xD1, 0xFC, 0x42, 0x82, 0x8F, 0xD2, 0xD0, 0xFF, 0xFD, 0x21, 0xD1, 0xF9, 0xC1, 0x06,
-    0x93, 0xD0, 0xCA, 0xF0, 0x21, 0xBE, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xB0, 0xB8,
-    0xBE, 0xD2, 0x8C, 0xFF, 0xEB, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x46, 0x81, 0x82, 0x85, 0x87, 0x96, 0x80, 0xE4, 0x7E,
-    0xE4, 0x7E, 0xE4, 0x7E, 0xE4, 0x7E, 0xFF, 0xC9, 0xFF, 0xFD, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0x83, 0xFF, 0xED,
-    0xCC, 0xFE, 0xC0, 0x14, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xD2, 0x01, 0xD1, 0x86, 0xFF, 0xB4, 0xD1, 0x86, 0x21, 0xD0,
-    0xF3, 0x42, 0xBA, 0xBF, 0xC0, 0xA4, 0xC0, 0xA4, 0x41, 0xBE, 0xC2, 0x51, 0xA1, 0x00, 0xB2, 0xD0, 0xFC, 0x42, 0x80,
-    0x87, 0xFF, 0xFB, 0xC0, 0x94, 0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x43, 0xBB, 0xB8, 0xBE, 0xFF, 0xE1, 0xC7, 0xB7, 0xFF,
-    0xFB, 0x41, 0xBF, 0xFF, 0x7E, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xBF, 0xCA, 0xFE,
-    0xC1, 0x1F, 0x21, 0xD0, 0xF9, 0x22, 0x80, 0x96, 0xF3, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xCC, 0x9F, 0xFF, 0xDA,
-    0xFF, 0xFB, 0xBF, 0xB5, 0xA0, 0x0A, 0xF3, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD,
-    0x41, 0x83, 0xDD, 0xCA, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBD, 0xBC, 0xF0, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFB, 0xBF, 0x87, 0x41, 0xB4, 0xCE, 0x16, 0x21, 0xD0, 0xFC, 0x21, 0x97, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x86, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x97, 0x80, 0xED, 0xBD, 0xFF, 0xFD,
-    0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xBF, 0x60, 0x41, 0x82, 0xD2, 0x2D, 0x21, 0xD1, 0xFC, 0x42, 0x80, 0x86, 0xFF, 0xFD,
-    0xD5, 0xC7, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xBF, 0x4B, 0x41, 0x81, 0xC0, 0x0C, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD,
-    0x21, 0xD0, 0xFD, 0x41, 0x96, 0xED, 0x8D, 0x21, 0xD1, 0xFC, 0x22, 0x87, 0x80, 0xF6, 0xFD, 0x21, 0xB8, 0xEB, 0x21,
-    0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x22, 0xD1,
-    0xD0, 0xE6, 0xFD, 0x21, 0x94, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x08,
-    0x50, 0xB1, 0xB3, 0xB4, 0xBF, 0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB5, 0xBE, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xCB, 0xE5,
-    0xCB, 0xE5, 0xFD, 0x95, 0xFE, 0xED, 0xFF, 0x4C, 0xE1, 0xA7, 0xCB, 0xEE, 0xCB, 0xEE, 0xFF, 0x7A, 0xFF, 0xA1, 0xFF,
-    0xB6, 0xFF, 0xF9, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0x41, 0x83, 0xC6, 0x8C, 0x21, 0xD1, 0xFC, 0x42,
-    0xBA, 0xB2, 0xDB, 0xAB, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2E, 0xFF, 0xF9, 0xE0, 0x38, 0xCB, 0xD6, 0x44, 0xB1, 0xB4,
-    0xBA, 0xBC, 0xE0, 0x21, 0xDB, 0x9A, 0xFF, 0xF6, 0xCB, 0xCF, 0x43, 0xD0, 0x2E, 0x2D, 0xFF, 0xF3, 0xCB, 0x95, 0xBE,
-    0xAB, 0x41, 0xD0, 0xE3, 0x04, 0x21, 0x8C, 0xFC, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xFD, 0xCB, 0x84, 0xBE,
-    0x9A, 0x41, 0x80, 0xD0, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42, 0x2E, 0xD0, 0xCB, 0x98, 0xFF, 0xFD, 0x41,
-    0xD1, 0xF5, 0x7A, 0x47, 0xB1, 0xB2, 0xB4, 0xB7, 0xB9, 0xBB, 0xBD, 0xFF, 0xFC, 0xBF, 0x26, 0xBF, 0x26, 0xBF, 0x26,
-    0xC1, 0xAD, 0xBF, 0x26, 0xBF, 0x26, 0xC1, 0x00, 0xB2, 0xD0, 0xC9, 0x20, 0xA0, 0x05, 0x21, 0x21, 0x80, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0xA1, 0x00, 0xB2, 0xD1, 0xFD, 0x44, 0x80, 0x82,
-    0x87, 0x94, 0xFF, 0xE3, 0xFF, 0xFB, 0xBE, 0xF3, 0xBE, 0xF3, 0x22, 0xD0, 0xD1, 0xC0, 0xF3, 0x41, 0x96, 0xC4, 0x6A,
-    0x42, 0xD0, 0xD1, 0xC8, 0xE1, 0xFF, 0xFC, 0x21, 0x80, 0xF9, 0x42, 0xD0, 0xD1, 0xC6, 0x25, 0xFF, 0xFD, 0x41, 0x83,
-    0xBE, 0xCC, 0x21, 0xD1, 0xFC, 0x42, 0x81, 0x82, 0xBF, 0x73, 0xFF, 0xFD, 0x42, 0xD0, 0xD1, 0xF4, 0xF7, 0xFF, 0xF9,
-    0x42, 0xB2, 0xB9, 0xCA, 0x66, 0xBE, 0xB7, 0x41, 0x96, 0xC1, 0x37, 0x42, 0xD0, 0xD1, 0xC8, 0xC9, 0xFF, 0xFC, 0x42,
-    0xD0, 0xD1, 0xC9, 0x4F, 0xFF, 0xD9, 0x44, 0x80, 0x81, 0x8E, 0x8F, 0xFF, 0xF2, 0xFF, 0xF9, 0xBE, 0x9E, 0xC1, 0x25,
-    0x22, 0xD0, 0xD1, 0xDA, 0xF3, 0x49, 0xBA, 0xBF, 0xB2, 0xB9, 0xBC, 0xB0, 0xB5, 0xB8, 0xBE, 0xE2, 0x36, 0xE2, 0x36,
-    0xFF, 0x5B, 0xCA, 0xF6, 0xCA, 0xF6, 0xFF, 0xA6, 0xFF, 0xB9, 0xFF, 0xCE, 0xFF, 0xFB, 0x41, 0x8C, 0xE2, 0x1A, 0xA1,
-    0x00, 0x42, 0xD1, 0xFC, 0x42, 0x82, 0x86, 0xCF, 0x39, 0xCF, 0x39, 0x21, 0xD1, 0xF9, 0x21, 0xBA, 0xFD, 0x21, 0xD0,
-    0xFD, 0x42, 0xB9, 0xBB, 0xCF, 0x29, 0xCF, 0x29, 0x41, 0x87, 0xCF, 0x22, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x43, 0x8C,
-    0x83, 0x96, 0xCD, 0xDF, 0xFF, 0xED, 0xFF, 0xFB, 0x41, 0xB6, 0xCF, 0x8A, 0x41, 0x85, 0xCF, 0x0B, 0x22, 0xD0, 0xD1,
-    0xF8, 0xFC, 0x42, 0xB1, 0xB6, 0xCF, 0x02, 0xCF, 0x02, 0x21, 0xD0, 0xF9, 0x43, 0xB9, 0xBA, 0xBC, 0xCE, 0xF8, 0xCE,
-    0xF8, 0xCE, 0xF8, 0x46, 0x84, 0x87, 0x8E, 0x8F, 0x94, 0x97, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE, 0xEE, 0xCE,
-    0xEE, 0xCE, 0xEE, 0x22, 0xD0, 0xD1, 0xE3, 0xED, 0x23, 0xB0, 0xB8, 0xBE, 0xCF, 0xDB, 0xFB, 0x43, 0x2E, 0xD1, 0xD0,
-    0xCA, 0x64, 0xFF, 0xB6, 0xFF, 0xF9, 0x43, 0xB1, 0xB9, 0xBB, 0xBD, 0xF3, 0xBD, 0xF3, 0xC8, 0x80, 0x42, 0xD0, 0xD1,
-    0xFF, 0xF6, 0xBF, 0x14, 0x49, 0x81, 0x82, 0x84, 0x86, 0x80, 0x8C, 0x83, 0x8F, 0x96, 0xFF, 0x76, 0xE1, 0x8C, 0xE1,
-    0x8C, 0xE1, 0x8C, 0xFF, 0xE5, 0xCA, 0x4C, 0xC5, 0x38, 0xC3, 0x6B, 0xFF, 0xF9, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF,
-    0x3A, 0xFF, 0xE4, 0xCA, 0x03, 0xBD, 0x19, 0x41, 0x82, 0xE1, 0x63, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xBD, 0x08, 0x41,
-    0xB7, 0xD5, 0x17, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB5, 0xD5, 0x0A, 0x21, 0xD0, 0xFC, 0x21, 0x84, 0xFD, 0x21, 0xD1, 0xFD, 0x43,
-    0xBE, 0xB0, 0xB5, 0xFF, 0xF0, 0xE8, 0x2E, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBC, 0xBF, 0xC7, 0x69, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBC, 0xBB,
-    0x42, 0xD0, 0x2D, 0xFB, 0xA5, 0xBC, 0xB4, 0x42, 0xB8, 0xBE, 0xBE, 0x08, 0xBD, 0xD8, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xF9, 0xFB, 0x89, 0xBC, 0xA6, 0x50, 0x8C, 0x81, 0x82, 0x88, 0x86, 0x83, 0x84, 0x85, 0x94, 0x96, 0x97, 0x80, 0x87,
-    0x89, 0x8E, 0x8F, 0xFD, 0xF1, 0xFE, 0x02, 0xFF, 0x83, 0xFF, 0x94, 0xDA, 0xB1, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF6,
-    0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0x44, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCF, 0xC1, 0x8F, 0xBE, 0xF9, 0x41, 0x82, 0xC9, 0x75, 0xC2, 0x00, 0x42, 0xD1, 0x2D,
-    0xFF, 0xFC, 0xBC, 0x5A, 0x43, 0x2E, 0xD1, 0x2D, 0xC9, 0x3B, 0xFF, 0xF3, 0xBC, 0x51, 0xA0, 0x03, 0xF4, 0x21, 0xB4,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x85, 0xFD,
-    0x41, 0xBB, 0xE5, 0x26, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB4, 0xBB, 0xFF, 0xFD, 0xC3,
-    0xE4, 0x41, 0x84, 0xBC, 0x03, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0,
-    0xD1, 0xE9, 0xFD, 0x21, 0xBE, 0xFB, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xD1, 0xFF, 0xFD, 0xBC, 0x03, 0x41, 0xB5, 0xCE,
-    0x79, 0x21, 0xD0, 0xFC, 0x42, 0xBD, 0xB0, 0xFF, 0xFD, 0xBF, 0x26, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBB, 0xEB, 0x41,
-    0xB5, 0xC5, 0xFD, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBB, 0xC8, 0x50, 0xB1, 0xB3, 0xB4,
-    0xB6, 0xB7, 0xB2, 0xBB, 0xBC, 0xB5, 0xBA, 0xBE, 0xB0, 0xB8, 0xB9, 0xBD, 0xBF, 0xC8, 0xA5, 0xC8, 0xA5, 0xC8, 0xA5,
-    0xC8, 0xA5, 0xFF, 0x67, 0xFF, 0x70, 0xDE, 0x67, 0xE0, 0x58, 0xFF, 0xBE, 0xFF, 0xD6, 0xFF, 0xF9, 0xBE, 0x4F, 0xBE,
-    0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0x41, 0xB0, 0xFD, 0x06, 0x41, 0x96, 0xCD, 0x0B, 0x21, 0xD1, 0xFC, 0x21,
-    0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD, 0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x42, 0xB1, 0xBC, 0xD8, 0x59, 0xFF,
-    0xFB, 0x44, 0xD0, 0x2E, 0xD1, 0x2D, 0xFF, 0xF9, 0xC8, 0x5A, 0xF9, 0x6E, 0xBB, 0x70, 0x42, 0xBA, 0xBF, 0xDF, 0xBA,
-    0xDF, 0xBA, 0xC1, 0x00, 0x42, 0x2E, 0xCB, 0x9E, 0x21, 0xBA, 0xFA, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x8C, 0xED, 0x2C,
-    0xFF, 0xFD, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xE6, 0xFF, 0xF9, 0xC8, 0x33, 0xBB, 0x49, 0x42, 0xD0, 0x2D, 0xDF,
-    0x9F, 0xBB, 0x3C, 0x42, 0x8F, 0x8E, 0xC8, 0x52, 0xC8, 0x52, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xF9, 0xC8,
-    0x18, 0xBB, 0x2E, 0x41, 0x81, 0xC9, 0xD0, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD,
-    0x43, 0x2E, 0xD0, 0x2D, 0xC7, 0xFC, 0xFF, 0xFD, 0xBB, 0x12, 0x41, 0xB5, 0xCE, 0x81, 0x21, 0xD0, 0xFC, 0x21, 0xBC,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBA,
-    0xF2, 0x50, 0x8C, 0x81, 0x88, 0x82, 0x80, 0x86, 0x87, 0x83, 0x94, 0x96, 0x97, 0x84, 0x85, 0x89, 0x8E, 0x8F, 0xFF,
-    0x7B, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xBD, 0xFF, 0xD9, 0xC7, 0xD8, 0xC7, 0xD8, 0xFF, 0xF9, 0xBD, 0x79, 0xBD, 0x79,
-    0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xF9,
-    0xFF, 0xCF, 0xBF, 0xDE, 0xBD, 0x48, 0xA0, 0x0C, 0x74, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0xB9, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D,
-    0xFF, 0xFD, 0xBA, 0x7D, 0x50, 0xB1, 0xB3, 0xB7, 0xBC, 0xBE, 0xB0, 0xB2, 0xB4, 0xB5, 0xB6, 0xB8, 0xB9, 0xBA, 0xBB,
-    0xBD, 0xBF, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x63, 0xFF, 0xF9, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
-    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0x42, 0x82, 0x8C, 0xEC,
-    0x21, 0xFB, 0xA4, 0x43, 0xD0, 0xD1, 0x2D, 0xDE, 0x98, 0xFF, 0xF9, 0xBA, 0x3E, 0x41, 0xB7, 0xD0, 0xA9, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFC, 0xBA, 0x30, 0x50, 0x81, 0x88, 0x84, 0x80, 0x82, 0x8C, 0x96, 0x94, 0x97, 0x83, 0x85, 0x86, 0x87,
-    0x89, 0x8E, 0x8F, 0xFF, 0xEB, 0xFD, 0x21, 0xCC, 0x74, 0xC7, 0x16, 0xDC, 0xCF, 0xC7, 0x16, 0xFF, 0xF9, 0xBC, 0xB7,
-    0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0x44, 0xD0, 0xD1,
-    0xD2, 0x27, 0xFF, 0x82, 0xFF, 0xCF, 0xBF, 0x1C, 0xBC, 0x86, 0x41, 0xB7, 0xD0, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB8,
-    0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x94, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xC6, 0xB3, 0xFF, 0xFD, 0xB9, 0xC9, 0x41, 0x80, 0xD0,
-    0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xC2, 0x35, 0xFF, 0xFC, 0xB9, 0xBB, 0x50, 0xB3, 0xB4, 0xB2, 0xBC, 0xBD, 0xBE, 0xB0,
-    0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xC6, 0x95, 0xC6, 0x95, 0xFF, 0xE8, 0xC6, 0x9E, 0xC6, 0x9E,
-    0xFF, 0xF6, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC,
-    0x3F, 0xBC, 0x3F, 0x42, 0x82, 0x8C, 0xDD, 0xD7, 0xFA, 0xDF, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xB9, 0x79, 0x43, 0x2E,
-    0xD0, 0x2D, 0xC6, 0x5C, 0xC4, 0xC9, 0xB9, 0x72, 0x41, 0xBC, 0xCF, 0xDD, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xB9, 0x64,
-    0x50, 0x81, 0x85, 0x80, 0x82, 0x88, 0x96, 0x94, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xE4,
-    0xC6, 0x41, 0xC6, 0x4A, 0xFF, 0xEB, 0xC6, 0x4A, 0xFF, 0xF9, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB,
-    0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF,
-    0xCF, 0xBE, 0x50, 0xBB, 0xBA, 0x41, 0xB3, 0xF9, 0x77, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21,
-    0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB8,
-    0xF1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xB5, 0xB0, 0xB2, 0xB6, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC5,
-    0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xFF, 0xF9, 0xDF, 0x5F, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78,
-    0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0x42, 0xD0, 0x2D, 0xDD, 0xF6, 0xB8, 0xB9,
-    0x43, 0x2E, 0xD0, 0x2D, 0xC5, 0x9C, 0xE4, 0xC5, 0xB8, 0xB2, 0x41, 0xBE, 0xC2, 0x33, 0x21, 0xD0, 0xFC, 0x21, 0x80,
-    0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB8, 0x98, 0x50, 0x81, 0x88, 0x86, 0x82,
-    0x8C, 0x83, 0x94, 0x96, 0x97, 0x80, 0x84, 0x85, 0x87, 0x89, 0x8E, 0x8F, 0xFB, 0x89, 0xFD, 0x55, 0xC5, 0x75, 0xFF,
-    0xD8, 0xFF, 0xDF, 0xFF, 0xF9, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F,
-    0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x76, 0xFF, 0xCF, 0xBD, 0x84, 0xBA, 0xEE,
-    0x41, 0xB2, 0xD0, 0x69, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB8, 0x2B, 0x50, 0xB1, 0xB4, 0xB6, 0xBC, 0xBD, 0xBE, 0xB0, 0xB2, 0xB3,
-    0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xCA, 0x6F, 0xC5, 0x08, 0xC5, 0x08, 0xC5, 0x11, 0xC5, 0x11, 0xFF, 0xF9,
-    0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA,
-    0xB2, 0x50, 0x87, 0x82, 0x94, 0x96, 0x97, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xC4,
-    0xD7, 0xC4, 0xE0, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81,
-    0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E,
-    0xFF, 0xCF, 0xBC, 0xE6, 0xBA, 0x50, 0x43, 0x2E, 0xD0, 0x2D, 0xC4, 0x9F, 0xEB, 0xC3, 0xB7, 0xB5, 0x42, 0xB4, 0xBB,
-    0xB8, 0x58, 0xB8, 0x58, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xFD, 0x42, 0xB4, 0xBB, 0xB8, 0xF9, 0xB8, 0x4B, 0x42, 0xD0,
-    0xD1, 0xFF, 0xF9, 0xB9, 0x6F, 0x21, 0x96, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xB7, 0x8D, 0x41,
-    0x96, 0xC6, 0x55, 0x21, 0xD1, 0xFC, 0x21, 0xBF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB7, 0x79, 0x50, 0xB1, 0xB3,
-    0xB2, 0xBB, 0xBC, 0xBD, 0xBA, 0xB0, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBE, 0xBF, 0xC4, 0x56, 0xC4, 0x56, 0xC4,
-    0x5F, 0xD5, 0x87, 0xC4, 0x5F, 0xFF, 0xBD, 0xFF, 0xE5, 0xFF, 0xF9, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00,
-    0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0x42, 0xB1, 0xBB, 0xB7, 0xEE, 0xCE, 0xF3, 0x21, 0xD0, 0xF9, 0x43,
-    0xBA, 0xB2, 0xB0, 0xDB, 0x8E, 0xC4, 0x4E, 0xFF, 0xFD, 0x41, 0xD1, 0xF9, 0x6A, 0x42, 0x81, 0x83, 0xFF, 0xFC, 0xB9,
-    0x8A, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xEB, 0xFF, 0xF9, 0xC4, 0x0C, 0xB7, 0x22, 0x50, 0x82, 0x88, 0x81, 0x94,
-    0x96, 0x97, 0x80, 0x83, 0x84, 0x85, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF3, 0xC3, 0xF9, 0xD5, 0x2A, 0xB9,
-    0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3,
-    0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x72, 0xFF, 0xCF, 0xBC, 0x08, 0xB9, 0x72,
-    0x50, 0x89, 0x81, 0x94, 0x96, 0x97, 0x80, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8C, 0x8E, 0x8F, 0xC3, 0xBB,
-    0xD4, 0xEC, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9,
-    0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
-    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34,
-    0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9,
-    0x34, 0xB9, 0x34, 0x44, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xBB, 0x99, 0xB9, 0x03, 0xC1, 0x00, 0xF1,
-    0x2D, 0xB6, 0x68, 0x50, 0xBE, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBF, 0xFF, 0xFA, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0,
-    0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0x50, 0x94, 0x96, 0x97, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8,
-    0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF,
-    0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xC4, 0x01, 0x01, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x9E, 0xBB, 0x24, 0xFF, 0xCF,
-    0xB8, 0x8E, 0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C,
-    0xEC, 0xC8, 0xEE, 0xD1, 0xEF, 0x42, 0xF0, 0x06, 0xF0, 0xFB, 0xF1, 0x90, 0xF4, 0x6A, 0xF9, 0x86, 0xFB, 0x37, 0xFB,
-    0xF9, 0xFC, 0xC5, 0xFD, 0x91, 0xFE, 0x2F, 0xFF, 0x0D, 0xFF, 0x7C, 0xFF, 0xF1, 0x41, 0xBD, 0xC6, 0x5C, 0x21, 0xD0,
-    0xFC, 0x21, 0x83, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB5, 0xB6, 0x50, 0x80, 0x94, 0x96, 0x97, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF9, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D,
-    0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8,
-    0x3D, 0xB8, 0x3D, 0x44, 0xD2, 0xD1, 0xD0, 0x27, 0xDA, 0xB7, 0xFF, 0xCF, 0xFE, 0xD8, 0xB8, 0x0C, 0x21, 0x91, 0xF3,
-    0x46, 0xB2, 0xB7, 0xB4, 0xB6, 0xBB, 0xBC, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7,
-    0x42, 0x81, 0x85, 0xC6, 0xB4, 0xC6, 0xB4, 0xA0, 0x0E, 0x42, 0x23, 0xD0, 0xD1, 0x2D, 0xE3, 0xF6, 0xFD, 0x21, 0x2D,
-    0xF6, 0x30, 0x97, 0x94, 0x96, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xF6,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x30, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x41, 0x91, 0xFF, 0xBB, 0xC4, 0x01, 0x01, 0xD1, 0xD0,
-    0xD2, 0x27, 0xFF, 0xBA, 0xFF, 0xDB, 0xFF, 0xFC, 0xFF, 0xB7, 0xA0, 0x01, 0x11, 0xA0, 0x01, 0x21, 0xA0, 0x01, 0xC2,
-    0xA0, 0x02, 0x83, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0x83, 0x80, 0xF2,
-    0x1F, 0xFF, 0xFD, 0xA0, 0x02, 0x13, 0x21, 0xB4, 0xFD, 0xA0, 0x02, 0x42, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xEB, 0xFD, 0xA0, 0x02, 0x62, 0x21, 0xB4, 0xFD,
-    0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x02, 0x11, 0x21, 0x2E, 0xFD, 0x23, 0xBE, 0xB2, 0xB5,
-    0xE6, 0xF7, 0xFD, 0xA3, 0x01, 0xE2, 0x27, 0xD1, 0xD0, 0xAE, 0xC0, 0xF9, 0x21, 0xB7, 0xF7, 0x21, 0xD0, 0xFD, 0xA0,
-    0x04, 0xA2, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xF1, 0x21, 0xD0,
-    0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82, 0xDF, 0x21, 0xD1, 0xFD,
-    0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x23, 0xB0, 0xBA, 0xBE, 0xD9, 0xEB, 0xFD,
-    0x21, 0x80, 0xD8, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0x80, 0xBD, 0x21, 0xD1, 0xFD, 0x21, 0x83, 0xFD, 0x22,
-    0xD0, 0xD1, 0xF4, 0xFD, 0xA0, 0x0C, 0xB3, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x82, 0x96, 0xE0, 0xFD, 0x22, 0xD0,
-    0xD1, 0xC2, 0xFB, 0x21, 0x86, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xB4, 0xB5, 0xBB,
-    0xFF, 0x1A, 0xFF, 0x7B, 0xFF, 0xFD, 0x41, 0x80, 0xFF, 0x10, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFF, 0x09, 0xFF, 0xF2,
-    0xFF, 0xFC, 0xFF, 0x09, 0xA0, 0x01, 0x32, 0xA1, 0x01, 0x21, 0x27, 0xFD, 0x21, 0x27, 0xF8, 0xA0, 0x01, 0x52, 0x21,
-    0xB4, 0xFD, 0xA1, 0x01, 0x21, 0xD0, 0xFD, 0x21, 0x85, 0xF5, 0xA2, 0x01, 0x21, 0x27, 0xD1, 0xE7, 0xFD, 0xA0, 0x0D,
-    0x22, 0x21, 0x87, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xF7, 0x21, 0xD1, 0xFD, 0x22, 0xB2, 0xBC, 0xF7, 0xFD, 0x21,
-    0xD0, 0xFB, 0x4B, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBF, 0xB8, 0xFF, 0xCC, 0xFF, 0xD1, 0xFE,
-    0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFF, 0xDA, 0xFE, 0xC8, 0xFE, 0xC8, 0xFF, 0xCC, 0xFF, 0xE2, 0xFF, 0xFD, 0x21, 0x82,
-    0xB2, 0xA1, 0x01, 0x21, 0xD1, 0xFD, 0x21, 0xBA, 0xAA, 0x21, 0xD0, 0xFD, 0xA0, 0x02, 0x12, 0x21, 0xB2, 0xFD, 0x21,
-    0xD0, 0xFD, 0x22, 0xBC, 0xB7, 0xF7, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xEF, 0x21, 0xD1, 0xFD, 0x23, 0xBE, 0xB0,
-    0xB5, 0xF7, 0xE9, 0xFD, 0x21, 0xBD, 0xE2, 0x21, 0xD0, 0xFD, 0xA0, 0x0D, 0x62, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
-    0x21, 0xBC, 0xFD, 0xA1, 0x02, 0x12, 0xD0, 0xFD, 0x22, 0x83, 0x96, 0xEC, 0xFB, 0xA0, 0x02, 0xD1, 0xA3, 0x01, 0xE2,
-    0xD0, 0xD1, 0x27, 0xDA, 0xF8, 0xFD, 0x21, 0xB4, 0xF7, 0x21, 0xD0, 0xFD, 0x44, 0x81, 0x82, 0x88, 0x96, 0xFF, 0xA9,
-    0xFE, 0x4C, 0xFF, 0xB1, 0xFF, 0xFD, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFE, 0x3C, 0xFF, 0x77, 0xFF, 0xF3, 0xFE, 0x3C,
-    0xA0, 0x04, 0xA1, 0xA0, 0x02, 0x41, 0x21, 0x8C, 0xFD, 0xA1, 0x04, 0xA1, 0xD1, 0xFD, 0x22, 0xB2, 0xBB, 0xF2, 0xFB,
-    0x21, 0xD0, 0xFB, 0x21, 0x97, 0xFD, 0x41, 0xB2, 0xFF, 0x40, 0x22, 0xD1, 0xD0, 0xF9, 0xFC, 0x44, 0xB6, 0xB7, 0xBB,
-    0xBE, 0xFE, 0x10, 0xFE, 0x10, 0xFE, 0x10, 0xFF, 0xFB, 0x41, 0x81, 0xFE, 0x03, 0x44, 0x27, 0xD0, 0xD1, 0x2D, 0xFD,
-    0xFC, 0xFF, 0xEF, 0xFF, 0xFC, 0xFD, 0xFC, 0x41, 0xB7, 0xFE, 0xFE, 0xA1, 0x01, 0x21, 0xD0, 0xFC, 0x21, 0xBA, 0xB7,
-    0x22, 0x86, 0x87, 0xB4, 0xB4, 0x22, 0xD0, 0xD1, 0xF8, 0xFB, 0x21, 0x97, 0xFB, 0xA0, 0x0D, 0x42, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x42, 0xD1, 0xD0, 0xFE, 0xF1, 0xFF, 0xFD, 0x42, 0xB2, 0xBC, 0xFF, 0xF9, 0xFE,
-    0xF3, 0x22, 0xD1, 0xD0, 0xE3, 0xF9, 0x47, 0xB1, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC, 0xB0, 0xFD, 0xBA, 0xFE, 0xC3, 0xFD,
-    0xBA, 0xFF, 0xCC, 0xFD, 0xBA, 0xFE, 0xC3, 0xFF, 0xFB, 0xC2, 0x01, 0x21, 0xD0, 0xD1, 0xFF, 0x06, 0xFE, 0xFE, 0xC1,
-    0x01, 0x21, 0xD0, 0xFE, 0xFD, 0x41, 0xBC, 0xFE, 0xC2, 0x21, 0xD0, 0xFC, 0x44, 0x81, 0x87, 0x88, 0x96, 0xFF, 0xEA,
-    0xFD, 0x8E, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x91, 0xFD, 0x81, 0x45, 0x27, 0xD0, 0xD1, 0xD2, 0x2D, 0xFD, 0x7A, 0xFF,
-    0xC3, 0xFF, 0xEF, 0xFF, 0xFC, 0xFD, 0x7A, 0xA0, 0x01, 0xE2, 0x21, 0xB6, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0x81, 0x84,
-    0x96, 0xFD, 0x64, 0xFD, 0x64, 0xFF, 0xFD, 0x43, 0x27, 0xD1, 0x2D, 0xFD, 0x57, 0xFF, 0xF6, 0xFD, 0x57, 0xA0, 0x04,
-    0x32, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x43, 0xBF, 0xB2, 0xBC, 0xFF, 0xFD,
-    0xFE, 0x68, 0xFE, 0x6E, 0x41, 0xB4, 0xFF, 0x05, 0x21, 0xD0, 0xFC, 0x21, 0x97, 0xFD, 0x22, 0xD0, 0xD1, 0xEC, 0xFD,
-    0x42, 0xB1, 0xB0, 0xFD, 0x28, 0xFF, 0xFB, 0x43, 0x27, 0xD0, 0x2D, 0xFD, 0x1E, 0xFF, 0xF9, 0xFD, 0x1E, 0x41, 0x87,
-    0xFF, 0x3E, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xBC, 0xFF, 0xFD, 0xFF, 0x3D, 0x21, 0xD0, 0xF9, 0x21, 0xB8, 0xFD, 0xA1,
-    0x01, 0x21, 0xD0, 0xFD, 0x43, 0xBE, 0xB5, 0xB8, 0xFE, 0x66, 0xFE, 0x66, 0xFE, 0x66, 0x42, 0x96, 0x83, 0xFE, 0x5C,
-    0xFE, 0x5C, 0xC3, 0x01, 0xE2, 0xD0, 0xD1, 0x27, 0xFF, 0xEF, 0xFF, 0xF9, 0xFE, 0x8F, 0x42, 0xB4, 0xB2, 0xFF, 0xF4,
-    0xFF, 0x74, 0x21, 0xD0, 0xF9, 0x44, 0x80, 0x81, 0x85, 0x96, 0xFF, 0xD4, 0xFC, 0xD7, 0xFC, 0xD7, 0xFF, 0xFD, 0x41,
-    0x87, 0xFF, 0x7A, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xB1, 0xFF, 0x6D, 0x21, 0xD0, 0xFC,
-    0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x82, 0xFF, 0x60, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD,
-    0x41, 0xB0, 0xFF, 0x53, 0x21, 0xD0, 0xFC, 0x41, 0xBA, 0xFF, 0x4C, 0x21, 0xD0, 0xFC, 0x22, 0xBB, 0xBE, 0xF6, 0xFD,
-    0x21, 0xD0, 0xFB, 0x47, 0xB1, 0xB2, 0xB3, 0xB4, 0xBC, 0xBE, 0xBF, 0xFF, 0xCD, 0xFF, 0xDA, 0xFF, 0x3D, 0xFF, 0x3D,
-    0xFF, 0x3D, 0xFF, 0xE7, 0xFF, 0xFD, 0x41, 0xBE, 0xFF, 0x2D, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD, 0x41, 0x96, 0xFF,
-    0x1D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF3, 0xFD, 0x41, 0x80, 0xFF, 0x0E, 0x21, 0xD1, 0xFC,
-    0x45, 0x80, 0x81, 0x83, 0x84, 0x87, 0xFF, 0x07, 0xFF, 0x0D, 0xFF, 0xF4, 0xFF, 0xFD, 0xFF, 0x07, 0xA0, 0x04, 0x52,
-    0x23, 0xD0, 0xD1, 0x27, 0xB7, 0xED, 0xFD, 0x42, 0xB4, 0xBC, 0xFF, 0xF9, 0xFD, 0xCF, 0xA1, 0x04, 0x71, 0xD0, 0xF9,
-    0x21, 0xB5, 0xFB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x41, 0x2E, 0xD3, 0x33, 0x21, 0xBC, 0xFC, 0x21, 0xD0, 0xFD,
-    0x21, 0xBE, 0xFD, 0x22, 0xD1, 0xD0, 0xF0, 0xFD, 0xA0, 0x04, 0x82, 0x22, 0x96, 0x8F, 0xFD, 0xFD, 0x21, 0xB8, 0xF8,
-    0xA2, 0x04, 0x32, 0xD1, 0xD0, 0xF8, 0xFD, 0x21, 0xB4, 0xF9, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x43, 0xBD, 0xB2, 0xBC, 0xFF, 0xFD, 0xFD, 0x1F, 0xFD, 0x25, 0x41, 0x97, 0xFD, 0xBC, 0x22, 0xD0, 0xD1, 0xF2, 0xFC,
-    0x22, 0xB5, 0xBE, 0xCA, 0xFB, 0x44, 0x27, 0xD1, 0xD0, 0x2D, 0xFB, 0xDD, 0xFF, 0x09, 0xFF, 0xFB, 0xFB, 0xDD, 0x41,
-    0x88, 0xFB, 0xD3, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFB, 0xCC, 0x42, 0xBB, 0xBF, 0xFB, 0xC8, 0xFB, 0xC8, 0x43, 0x81,
-    0x85, 0x88, 0xFB, 0xC1, 0xFB, 0xC1, 0xFB, 0xC1, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xFB, 0xB4, 0x41,
-    0x81, 0xFC, 0xB9, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x42, 0x81, 0x8C, 0xFB, 0xA3, 0xFB, 0xA3, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF6, 0xFF, 0xF9, 0xFB, 0x99, 0x41, 0x96, 0xD2, 0x9D, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBC, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x7F, 0x41, 0x2D, 0xFB, 0x78, 0x50, 0xB1, 0xB2, 0xB4,
-    0xB7, 0xBC, 0xBD, 0xBF, 0xB9, 0xBA, 0xBB, 0xBE, 0xB0, 0xB3, 0xB5, 0xB6, 0xB8, 0xFC, 0x6B, 0xFD, 0x38, 0xFD, 0x78,
-    0xFD, 0xFA, 0xFE, 0x1D, 0xFE, 0x56, 0xFF, 0x97, 0xFF, 0xA8, 0xFF, 0xC0, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFB, 0x46, 0x41, 0x96, 0xFC, 0xAA, 0x43, 0xB5, 0xB0, 0xBC,
-    0xFC, 0xA6, 0xFC, 0xA6, 0xFD, 0x6B, 0xC3, 0x01, 0xE2, 0xD1, 0xD0, 0x27, 0xFF, 0xF2, 0xFF, 0xF6, 0xFB, 0x37, 0x21,
-    0xB7, 0xF4, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x44, 0x27, 0xD1, 0xD0, 0x2D, 0xFB, 0x1C, 0xFF, 0xD9, 0xFF, 0xFD,
-    0xFB, 0x1C, 0x41, 0xBA, 0xFB, 0x12, 0x43, 0x80, 0x85, 0x8C, 0xFB, 0x0E, 0xFB, 0x0E, 0xFB, 0x0E, 0x44, 0x27, 0xD0,
-    0xD1, 0x2D, 0xFB, 0x01, 0xFF, 0xF2, 0xFF, 0xF6, 0xFB, 0x01, 0x41, 0xBB, 0xFA, 0xF7, 0x43, 0x27, 0xD0, 0x2D, 0xFA,
-    0xF0, 0xFF, 0xFC, 0xFA, 0xF0, 0x43, 0xBA, 0xBB, 0xBF, 0xFA, 0xE9, 0xFA, 0xE9, 0xFA, 0xE9, 0x44, 0x27, 0xD0, 0xD1,
-    0x2D, 0xFA, 0xDC, 0xFF, 0xF6, 0xFF, 0x99, 0xFA, 0xDC, 0x41, 0xBB, 0xFB, 0xDE, 0xA1, 0x01, 0x21, 0xD0, 0xFC, 0x41,
-    0xB2, 0xFB, 0x2D, 0x21, 0xD0, 0xFC, 0x42, 0x85, 0x96, 0xFB, 0xCE, 0xFF, 0xFD, 0xC3, 0x01, 0x21, 0x27, 0xD0, 0xD1,
-    0xFB, 0xBC, 0xFF, 0xE9, 0xFF, 0xF9, 0x43, 0xBA, 0xBB, 0xBF, 0xFF, 0xE1, 0xFA, 0xAF, 0xFF, 0xF4, 0x42, 0x82, 0x85,
-    0xFA, 0xA5, 0xFF, 0xD7, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF, 0xF9, 0xFA, 0x9B, 0x42, 0xD0, 0x2D, 0xFF, 0x9D,
-    0xFA, 0x91, 0x41, 0x8C, 0xFA, 0x8D, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFA, 0x86, 0x41, 0x85, 0xFA, 0x82, 0xC1, 0x04,
-    0x32, 0x27, 0xFE, 0x37, 0x21, 0xB7, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
-    0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE1, 0xFF, 0xFD, 0xFA, 0x60, 0x42, 0xB8, 0xB5,
-    0xD1, 0x64, 0xD1, 0x64, 0x42, 0x96, 0x83, 0xD1, 0x5D, 0xD1, 0x5D, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x21, 0x80, 0xFB,
-    0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFA, 0x3A, 0x50, 0x80, 0x82, 0x84, 0x88, 0x81,
-    0x85, 0x86, 0x87, 0x83, 0x94, 0x96, 0x97, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0x17, 0xFF, 0x32, 0xFF, 0x43, 0xFF, 0x57,
-    0xFF, 0x98, 0xFF, 0xA2, 0xFF, 0xAD, 0xFF, 0xD3, 0xFF, 0xF9, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE,
-    0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0x41, 0x91, 0xFE, 0x8A, 0xA0, 0x0D, 0xB1, 0x21, 0x2D, 0xFD, 0x44, 0xD0, 0xD1, 0xD2,
-    0x27, 0xFE, 0x84, 0xFF, 0xC5, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0, 0x0D, 0xA1, 0xA0, 0x0D, 0xC2, 0x30, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
-    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x02, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0xB8, 0xFF,
-    0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
-    0x21, 0x91, 0xD2, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
-    0x8F, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xA0, 0x0E,
-    0x22, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30,
-    0x94, 0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9,
-    0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x62, 0x44, 0xD0, 0xD2,
-    0xD1, 0x27, 0xFF, 0xB8, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0xC5, 0x0D, 0x82, 0x2D, 0xD0, 0xD2, 0xD1, 0x27, 0xFF,
-    0x08, 0xFF, 0x63, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0xF3, 0x46, 0xD0, 0xD1, 0xD2, 0x27, 0x2E, 0x2D, 0xE3, 0x0F, 0xF7,
-    0xE2, 0xF8, 0x62, 0xF8, 0xD2, 0xFE, 0xE9, 0xFF, 0xEE,
+// Aho-Corasick automaton for the hypher patterns: 10404 states, 53 dense.
+constexpr uint8_t uk_symbols[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x10, 0x00, 0x11, 0x00, 0x00, 0x12, 0x00, 0x13, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+    0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-constexpr SerializedHyphenationPatterns uk_patterns = {
-    0x5329u,
-    uk_trie_data,
-    sizeof(uk_trie_data),
+constexpr uint16_t uk_dense[] = {
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 5, 6, 0, 7, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 10,
+    0, 11, 12, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 14, 15, 0, 16, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 18, 19,
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 35, 4, 5, 6, 0, 1, 2, 3, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 0, 49, 50, 51, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6,
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 5, 6, 0, 7, 53, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 10,
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 4, 5, 6, 0, 1, 2, 3, 70, 71, 72, 73,
+    74, 75, 76, 77, 78, 79, 80, 81, 82, 0, 83, 84, 85, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6,
+    0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 5, 6, 0, 87, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 89, 90,
+    0, 11, 12, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 13, 14, 15, 0, 1, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 92, 93,
+    94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 4, 5, 6,
+    0, 1, 2, 3, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 0, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 5, 6, 0, 1, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6,
+    0, 7, 124, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 9, 10, 0, 1, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 4, 5, 6,
+    0, 1, 2, 3, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 0, 154, 155, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 5, 6, 0, 1, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 6,
+    0, 158, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 159, 160, 161, 0, 162, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 163, 164, 165,
+    0, 166, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 167, 168, 169, 0, 170, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 172, 173,
+    0, 174, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 175, 176, 177, 0, 178, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 180, 181,
+    0, 182, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 183, 184, 185, 0, 186, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 188, 189,
+    0, 190, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 191, 192, 193, 0, 194, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 196, 197,
+    0, 198, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 199, 200, 201, 0, 202, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 204, 205,
+    0, 206, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 207, 208, 209, 0, 210, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 212, 213,
+    0, 214, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 215, 216, 217, 0, 218, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 220, 221,
+    0, 222, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 223, 224, 225, 0, 226, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 228, 229,
+    0, 230, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 231, 232, 233, 0, 234, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 236, 237,
+    0, 238, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 239, 240, 241, 0, 242, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 243, 244, 245,
+    0, 246, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 247, 248, 249, 0, 250, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 252, 253,
+    0, 254, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 255, 256, 257, 0, 258, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259, 260, 261,
+    0, 262, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 263, 264, 265, 0, 266, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 267, 268, 269,
+    0, 270, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 271, 272, 273, 0, 274, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 275, 276, 277,
+    0, 278, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 279, 280, 281, 0, 282, 2, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 283, 284, 285,
+    0, 286, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 287, 288, 289,
+};
+
+constexpr uint8_t uk_label[] = {
+    0x00, 0x01, 0x02, 0x03, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x02, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26,
+    0x27, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x01, 0x25, 0x26, 0x27, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01,
+    0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27,
+    0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26,
+    0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25,
+    0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01,
+    0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27,
+    0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26,
+    0x27, 0x01, 0x25, 0x26, 0x27, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25,
+    0x26, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x01, 0x25, 0x26,
+    0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25,
+    0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01,
+    0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27,
+    0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26,
+    0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25,
+    0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01,
+    0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x01, 0x25, 0x26, 0x27, 0x02, 0x01, 0x02, 0x25,
+    0x26, 0x01, 0x02, 0x25, 0x26, 0x02, 0x01, 0x02, 0x25, 0x26, 0x02, 0x02, 0x01, 0x02, 0x25, 0x26, 0x27, 0x02, 0x02,
+    0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x01, 0x02, 0x26, 0x01, 0x02, 0x25, 0x02, 0x25, 0x01, 0x02, 0x25, 0x26,
+    0x01, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x01, 0x02, 0x25, 0x26, 0x02, 0x25, 0x01, 0x02, 0x25, 0x02, 0x25, 0x02,
+    0x26, 0x02, 0x25, 0x26, 0x01, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x26, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x26, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x26, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x26, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14,
+    0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11,
+    0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12,
+    0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x02, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x17, 0x19, 0x1B, 0x1C, 0x20, 0x21, 0x05, 0x09, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12,
+    0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+    0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14,
+    0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A,
+    0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12,
+    0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x11, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x11, 0x19, 0x1A, 0x20,
+    0x04, 0x16, 0x17, 0x18, 0x19, 0x1B, 0x1C, 0x1D, 0x1F, 0x20, 0x21, 0x24, 0x05, 0x06, 0x0C, 0x13, 0x1B, 0x1C, 0x20,
+    0x23, 0x05, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x05, 0x0B, 0x0C, 0x13, 0x11, 0x0C, 0x20, 0x24, 0x05, 0x09,
+    0x0C, 0x1F, 0x05, 0x0E, 0x05, 0x08, 0x13, 0x15, 0x16, 0x21, 0x1A, 0x23, 0x04, 0x05, 0x09, 0x13, 0x23, 0x06, 0x1F,
+    0x20, 0x24, 0x06, 0x09, 0x1F, 0x04, 0x09, 0x0E, 0x21, 0x20, 0x20, 0x0E, 0x1A, 0x09, 0x1F, 0x20, 0x24, 0x06, 0x02,
+    0x25, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x02, 0x26, 0x02, 0x02, 0x25, 0x02, 0x02, 0x26,
+    0x02, 0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02,
+    0x25, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26,
+    0x02, 0x02, 0x12, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x25, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x03, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03,
+    0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x10,
+    0x02, 0x25, 0x02, 0x03, 0x25, 0x02, 0x03, 0x25, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x03, 0x25,
+    0x02, 0x03, 0x26, 0x02, 0x25, 0x26, 0x02, 0x03, 0x02, 0x03, 0x25, 0x02, 0x03, 0x25, 0x26, 0x01, 0x02, 0x03, 0x02,
+    0x03, 0x02, 0x25, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x25, 0x02, 0x03, 0x26, 0x02, 0x03, 0x26, 0x02, 0x25,
+    0x02, 0x02, 0x03, 0x02, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x25,
+    0x26, 0x02, 0x03, 0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02,
+    0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x02,
+    0x25, 0x02, 0x25, 0x26, 0x02, 0x02, 0x26, 0x02, 0x25, 0x26, 0x02, 0x03, 0x25, 0x02, 0x03, 0x25, 0x26, 0x02, 0x26,
+    0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x26,
+    0x02, 0x03, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x25,
+    0x26, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x25, 0x26, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x26, 0x02, 0x25,
+    0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x03, 0x25, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x26, 0x02,
+    0x02, 0x25, 0x02, 0x02, 0x26, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x10, 0x12, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x01, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x25,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x01, 0x02, 0x03, 0x26,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x26, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02,
+    0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x02,
+    0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x26, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x25,
+    0x02, 0x03, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x26,
+    0x02, 0x03, 0x26, 0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x25, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x03, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02,
+    0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x25, 0x02, 0x03, 0x25, 0x26, 0x02,
+    0x03, 0x26, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03,
+    0x26, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x25, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02,
+    0x03, 0x02, 0x02, 0x26, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x25, 0x02, 0x03, 0x26, 0x02, 0x03, 0x02, 0x03,
+    0x25, 0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03, 0x26, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02,
+    0x02, 0x02, 0x03, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03,
+    0x26, 0x02, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x25, 0x02, 0x02, 0x03, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x25,
+    0x26, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x25, 0x26, 0x02,
+    0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x25, 0x26, 0x01, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x01, 0x02,
+    0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x25, 0x02, 0x25, 0x26,
+    0x02, 0x25, 0x26, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02,
+    0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x25, 0x26,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x02, 0x03, 0x25, 0x26,
+    0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02, 0x03, 0x26, 0x02, 0x03, 0x26, 0x02, 0x03, 0x25,
+    0x02, 0x03, 0x26, 0x02, 0x25, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x02,
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x02, 0x02, 0x25, 0x26, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02, 0x03, 0x02, 0x03, 0x02, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02,
+    0x03, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x25, 0x26, 0x02, 0x26, 0x02, 0x02, 0x26, 0x02,
+    0x02, 0x03, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x26, 0x02, 0x02, 0x02, 0x25, 0x26,
+    0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x25, 0x02, 0x03, 0x26, 0x02, 0x03, 0x26, 0x02, 0x02, 0x26, 0x02, 0x02, 0x03,
+    0x25, 0x02, 0x03, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02, 0x26, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x25, 0x02,
+    0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x01, 0x02, 0x25, 0x02, 0x25, 0x02,
+    0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x26, 0x02, 0x26, 0x01, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x25,
+    0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x25, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x25, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x02, 0x26, 0x02, 0x02, 0x03, 0x02, 0x25, 0x26, 0x02, 0x03, 0x26, 0x02, 0x02, 0x03, 0x02, 0x02,
+    0x02, 0x02, 0x26, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x25, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x25, 0x26, 0x02, 0x02, 0x03, 0x02,
+    0x26, 0x02, 0x03, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02,
+    0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x03, 0x25, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x02, 0x03, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x26,
+    0x02, 0x26, 0x02, 0x03, 0x02, 0x03, 0x25, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x03, 0x25, 0x26, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02,
+    0x02, 0x02, 0x02, 0x25, 0x02, 0x25, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x26, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x26, 0x02, 0x25, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x25, 0x26, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x25, 0x02, 0x02, 0x26, 0x02, 0x02, 0x25, 0x26,
+    0x02, 0x25, 0x02, 0x26, 0x02, 0x25, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x25, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x25, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x25, 0x26, 0x01, 0x01, 0x25, 0x25, 0x01, 0x01, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x01,
+    0x25, 0x01, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x01, 0x25, 0x26, 0x25, 0x26, 0x26, 0x19, 0x1D, 0x23, 0x06, 0x13, 0x1A, 0x04, 0x1A, 0x1D, 0x06, 0x08, 0x15, 0x05,
+    0x06, 0x07, 0x0A, 0x1A, 0x0E, 0x15, 0x15, 0x16, 0x24, 0x09, 0x0D, 0x15, 0x1A, 0x23, 0x06, 0x18, 0x23, 0x06, 0x23,
+    0x24, 0x20, 0x18, 0x19, 0x06, 0x15, 0x23, 0x05, 0x26, 0x18, 0x1F, 0x20, 0x05, 0x1C, 0x1E, 0x1F, 0x23, 0x15, 0x1D,
+    0x23, 0x0E, 0x18, 0x04, 0x12, 0x15, 0x1A, 0x1D, 0x07, 0x13, 0x06, 0x0E, 0x0E, 0x16, 0x23, 0x25, 0x20, 0x22, 0x1D,
+    0x20, 0x1A, 0x15, 0x23, 0x04, 0x0E, 0x20, 0x04, 0x1D, 0x0E, 0x1E, 0x22, 0x07, 0x10, 0x14, 0x20, 0x15, 0x23, 0x0E,
+    0x26, 0x19, 0x20, 0x05, 0x12, 0x1A, 0x20, 0x23, 0x04, 0x15, 0x23, 0x06, 0x0E, 0x0F, 0x04, 0x13, 0x19, 0x0E, 0x19,
+    0x20, 0x22, 0x23, 0x06, 0x15, 0x1D, 0x23, 0x07, 0x0E, 0x10, 0x15, 0x1D, 0x23, 0x07, 0x21, 0x05, 0x08, 0x15, 0x1A,
+    0x23, 0x07, 0x13, 0x06, 0x0E, 0x19, 0x24, 0x22, 0x15, 0x1D, 0x23, 0x13, 0x10, 0x1F, 0x04, 0x10, 0x1A, 0x1A, 0x0E,
+    0x05, 0x13, 0x17, 0x1C, 0x1E, 0x1F, 0x23, 0x04, 0x07, 0x14, 0x15, 0x23, 0x07, 0x10, 0x13, 0x06, 0x0E, 0x05, 0x1F,
+    0x05, 0x06, 0x0A, 0x15, 0x1E, 0x23, 0x12, 0x17, 0x19, 0x1F, 0x1D, 0x1F, 0x23, 0x21, 0x05, 0x08, 0x23, 0x05, 0x1A,
+    0x23, 0x04, 0x13, 0x15, 0x1A, 0x0E, 0x16, 0x18, 0x1C, 0x1F, 0x24, 0x05, 0x09, 0x0A, 0x0D, 0x06, 0x15, 0x13, 0x16,
+    0x18, 0x05, 0x05, 0x15, 0x0E, 0x23, 0x13, 0x22, 0x13, 0x0E, 0x25, 0x26, 0x25, 0x17, 0x1E, 0x1F, 0x21, 0x22, 0x23,
+    0x24, 0x07, 0x0F, 0x10, 0x14, 0x15, 0x04, 0x07, 0x26, 0x15, 0x1A, 0x1D, 0x23, 0x07, 0x13, 0x23, 0x15, 0x17, 0x22,
+    0x23, 0x0E, 0x13, 0x1F, 0x23, 0x26, 0x13, 0x15, 0x1D, 0x0E, 0x13, 0x1F, 0x23, 0x23, 0x0F, 0x13, 0x0E, 0x19, 0x04,
+    0x1A, 0x16, 0x1F, 0x05, 0x06, 0x17, 0x21, 0x17, 0x23, 0x21, 0x05, 0x22, 0x06, 0x1F, 0x05, 0x05, 0x20, 0x0E, 0x15,
+    0x1A, 0x1D, 0x23, 0x05, 0x07, 0x13, 0x05, 0x05, 0x06, 0x0E, 0x05, 0x16, 0x20, 0x23, 0x1C, 0x22, 0x24, 0x15, 0x23,
+    0x14, 0x0E, 0x21, 0x22, 0x04, 0x07, 0x15, 0x24, 0x06, 0x0E, 0x04, 0x0E, 0x0F, 0x10, 0x12, 0x05, 0x17, 0x16, 0x17,
+    0x18, 0x19, 0x1B, 0x1C, 0x1E, 0x1F, 0x21, 0x22, 0x24, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x25,
+    0x26, 0x22, 0x20, 0x04, 0x06, 0x22, 0x0E, 0x23, 0x1F, 0x22, 0x13, 0x06, 0x0E, 0x1A, 0x1B, 0x22, 0x23, 0x16, 0x17,
+    0x19, 0x1C, 0x1E, 0x21, 0x23, 0x24, 0x07, 0x10, 0x14, 0x20, 0x04, 0x05, 0x1B, 0x1C, 0x24, 0x04, 0x15, 0x17, 0x19,
+    0x1C, 0x23, 0x24, 0x07, 0x0F, 0x10, 0x14, 0x05, 0x06, 0x10, 0x1F, 0x21, 0x1F, 0x06, 0x0E, 0x15, 0x1F, 0x04, 0x05,
+    0x0E, 0x0E, 0x16, 0x18, 0x1C, 0x1E, 0x1F, 0x20, 0x21, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0C, 0x06, 0x10, 0x17, 0x19,
+    0x1F, 0x22, 0x06, 0x26, 0x17, 0x1A, 0x1D, 0x20, 0x21, 0x23, 0x07, 0x13, 0x1D, 0x1F, 0x13, 0x15, 0x10, 0x1F, 0x21,
+    0x05, 0x08, 0x15, 0x16, 0x04, 0x15, 0x23, 0x16, 0x19, 0x1F, 0x24, 0x05, 0x0A, 0x0B, 0x1A, 0x20, 0x06, 0x07, 0x19,
+    0x1A, 0x23, 0x10, 0x18, 0x19, 0x1F, 0x05, 0x23, 0x1D, 0x1C, 0x05, 0x20, 0x22, 0x04, 0x19, 0x04, 0x16, 0x17, 0x19,
+    0x1B, 0x1C, 0x20, 0x21, 0x23, 0x04, 0x05, 0x07, 0x0B, 0x0C, 0x10, 0x14, 0x1A, 0x1D, 0x23, 0x13, 0x1F, 0x23, 0x24,
+    0x06, 0x07, 0x0E, 0x04, 0x17, 0x19, 0x1E, 0x19, 0x1E, 0x15, 0x13, 0x17, 0x1B, 0x0E, 0x15, 0x22, 0x0E, 0x05, 0x06,
+    0x0E, 0x23, 0x05, 0x0E, 0x1C, 0x04, 0x06, 0x0E, 0x17, 0x04, 0x0E, 0x1F, 0x0E, 0x05, 0x1F, 0x0A, 0x21, 0x22, 0x23,
+    0x24, 0x04, 0x04, 0x14, 0x1D, 0x20, 0x23, 0x04, 0x13, 0x0E, 0x04, 0x0A, 0x15, 0x1A, 0x1D, 0x1F, 0x20, 0x23, 0x24,
+    0x04, 0x05, 0x06, 0x09, 0x0B, 0x13, 0x0E, 0x15, 0x17, 0x1A, 0x1D, 0x1E, 0x1F, 0x21, 0x23, 0x24, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x0A, 0x0E, 0x10, 0x13, 0x21, 0x24, 0x1A, 0x1D, 0x23, 0x13, 0x0E, 0x06, 0x16, 0x19, 0x1F, 0x21, 0x06,
+    0x23, 0x09, 0x06, 0x15, 0x22, 0x0E, 0x04, 0x04, 0x15, 0x1F, 0x24, 0x06, 0x0E, 0x0F, 0x10, 0x04, 0x1F, 0x16, 0x21,
+    0x05, 0x23, 0x26, 0x15, 0x15, 0x18, 0x20, 0x23, 0x04, 0x0F, 0x26, 0x1D, 0x13, 0x1A, 0x04, 0x15, 0x16, 0x23, 0x10,
+    0x24, 0x06, 0x07, 0x17, 0x04, 0x17, 0x17, 0x04, 0x24, 0x06, 0x0E, 0x0E, 0x06, 0x1C, 0x23, 0x1F, 0x04, 0x06, 0x0E,
+    0x23, 0x21, 0x22, 0x22, 0x06, 0x17, 0x1F, 0x1F, 0x1F, 0x04, 0x24, 0x23, 0x13, 0x0E, 0x20, 0x0E, 0x15, 0x17, 0x1F,
+    0x05, 0x07, 0x0E, 0x17, 0x1A, 0x21, 0x1D, 0x13, 0x07, 0x1F, 0x23, 0x05, 0x04, 0x1A, 0x1D, 0x22, 0x1D, 0x13, 0x1A,
+    0x19, 0x06, 0x23, 0x06, 0x1A, 0x0F, 0x23, 0x06, 0x08, 0x13, 0x1F, 0x22, 0x22, 0x05, 0x19, 0x19, 0x06, 0x15, 0x07,
+    0x1C, 0x13, 0x19, 0x17, 0x21, 0x09, 0x06, 0x1F, 0x19, 0x17, 0x14, 0x17, 0x21, 0x14, 0x1C, 0x1F, 0x06, 0x1F, 0x21,
+    0x05, 0x1B, 0x17, 0x21, 0x24, 0x14, 0x04, 0x23, 0x04, 0x17, 0x21, 0x22, 0x14, 0x1D, 0x17, 0x19, 0x1C, 0x20, 0x20,
+    0x09, 0x13, 0x20, 0x04, 0x04, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x06, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x03, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25,
+    0x26, 0x25, 0x25, 0x03, 0x25, 0x26, 0x25, 0x03, 0x25, 0x1C, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x03, 0x03,
+    0x26, 0x26, 0x25, 0x03, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x03, 0x10, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x03, 0x25, 0x25, 0x26, 0x25, 0x25, 0x03, 0x25,
+    0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x03, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x03, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25,
+    0x25, 0x25, 0x25, 0x03, 0x25, 0x26, 0x25, 0x01, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26,
+    0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x03, 0x25, 0x26, 0x25, 0x26, 0x03, 0x17, 0x05, 0x19, 0x01,
+    0x25, 0x25, 0x26, 0x01, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x10, 0x25, 0x25,
+    0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x03, 0x03, 0x25, 0x26, 0x03, 0x25, 0x25, 0x25, 0x10, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x03, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x03, 0x25, 0x25, 0x25, 0x03, 0x03, 0x01, 0x01, 0x25,
+    0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x03, 0x03, 0x25, 0x26, 0x25, 0x03, 0x03, 0x26, 0x26, 0x03, 0x25,
+    0x03, 0x25, 0x26, 0x03, 0x25, 0x03, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x03, 0x26, 0x26, 0x25, 0x26,
+    0x25, 0x03, 0x03, 0x25, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x26, 0x03, 0x26, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1F, 0x06, 0x25, 0x26, 0x03, 0x25, 0x25, 0x26, 0x03, 0x25,
+    0x26, 0x25, 0x26, 0x25, 0x03, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x01, 0x26, 0x01, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x01, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x03, 0x26, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x03, 0x03, 0x25, 0x01, 0x03, 0x03, 0x25, 0x26, 0x25,
+    0x25, 0x03, 0x03, 0x26, 0x03, 0x03, 0x03, 0x03, 0x03, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x12,
+    0x01, 0x26, 0x26, 0x25, 0x01, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x26, 0x26, 0x01, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x01, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x01, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25,
+    0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x03, 0x25, 0x03, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x26, 0x03, 0x03, 0x03, 0x25, 0x03, 0x03, 0x03, 0x03, 0x03, 0x25, 0x26, 0x03, 0x26, 0x03, 0x01, 0x25, 0x26, 0x03,
+    0x03, 0x25, 0x26, 0x03, 0x25, 0x03, 0x03, 0x03, 0x25, 0x03, 0x26, 0x25, 0x25, 0x26, 0x03, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x03, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x03, 0x25, 0x25, 0x26, 0x25, 0x26, 0x03, 0x03, 0x25, 0x26, 0x03, 0x25, 0x26, 0x26, 0x25, 0x03, 0x25,
+    0x25, 0x26, 0x01, 0x25, 0x26, 0x25, 0x25, 0x25, 0x03, 0x03, 0x03, 0x25, 0x26, 0x03, 0x03, 0x25, 0x26, 0x25, 0x03,
+    0x25, 0x25, 0x03, 0x03, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x10, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x10, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x01, 0x26,
+    0x25, 0x25, 0x03, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x03, 0x26, 0x03, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x03, 0x03, 0x03, 0x25, 0x03, 0x26, 0x26, 0x03, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26,
+    0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x01, 0x25, 0x26, 0x26, 0x26, 0x26, 0x01, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x01, 0x25, 0x26, 0x01, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x04, 0x10, 0x14, 0x23, 0x15, 0x22, 0x1A, 0x1F, 0x06, 0x1D, 0x1A, 0x04, 0x16, 0x1D, 0x07, 0x04,
+    0x05, 0x1A, 0x1D, 0x04, 0x16, 0x06, 0x17, 0x20, 0x06, 0x04, 0x1D, 0x13, 0x15, 0x23, 0x15, 0x04, 0x20, 0x05, 0x1A,
+    0x07, 0x21, 0x15, 0x17, 0x19, 0x1F, 0x21, 0x23, 0x24, 0x04, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x1A, 0x1A, 0x23, 0x15,
+    0x13, 0x1A, 0x20, 0x14, 0x06, 0x26, 0x1A, 0x15, 0x06, 0x1A, 0x0E, 0x15, 0x1A, 0x15, 0x17, 0x1A, 0x07, 0x13, 0x05,
+    0x23, 0x04, 0x1B, 0x1B, 0x1C, 0x05, 0x1F, 0x0A, 0x19, 0x1D, 0x06, 0x18, 0x1C, 0x1F, 0x24, 0x22, 0x06, 0x05, 0x1C,
+    0x06, 0x19, 0x19, 0x17, 0x04, 0x1F, 0x20, 0x0E, 0x06, 0x17, 0x15, 0x19, 0x20, 0x17, 0x0E, 0x09, 0x17, 0x19, 0x21,
+    0x06, 0x15, 0x19, 0x0B, 0x17, 0x05, 0x15, 0x19, 0x05, 0x0C, 0x17, 0x23, 0x0E, 0x1F, 0x06, 0x17, 0x22, 0x17, 0x1D,
+    0x04, 0x15, 0x1C, 0x19, 0x1B, 0x17, 0x0E, 0x1F, 0x19, 0x07, 0x20, 0x15, 0x17, 0x1A, 0x1C, 0x23, 0x07, 0x13, 0x15,
+    0x0E, 0x19, 0x16, 0x22, 0x16, 0x1C, 0x0C, 0x19, 0x22, 0x22, 0x20, 0x1C, 0x0B, 0x1A, 0x24, 0x21, 0x17, 0x19, 0x1E,
+    0x21, 0x22, 0x06, 0x08, 0x0C, 0x0F, 0x12, 0x05, 0x0A, 0x16, 0x1B, 0x1C, 0x21, 0x05, 0x17, 0x22, 0x24, 0x17, 0x06,
+    0x0C, 0x17, 0x04, 0x1A, 0x17, 0x20, 0x22, 0x06, 0x12, 0x18, 0x09, 0x0F, 0x12, 0x1E, 0x04, 0x0B, 0x04, 0x1B, 0x1F,
+    0x22, 0x21, 0x16, 0x18, 0x1F, 0x20, 0x24, 0x06, 0x08, 0x24, 0x26, 0x17, 0x21, 0x21, 0x04, 0x23, 0x1F, 0x21, 0x19,
+    0x1B, 0x21, 0x05, 0x09, 0x1B, 0x21, 0x1B, 0x1F, 0x24, 0x16, 0x21, 0x17, 0x1F, 0x13, 0x0E, 0x20, 0x19, 0x21, 0x06,
+    0x18, 0x17, 0x15, 0x04, 0x06, 0x17, 0x15, 0x17, 0x13, 0x06, 0x1A, 0x20, 0x22, 0x1F, 0x24, 0x06, 0x0A, 0x18, 0x1F,
+    0x21, 0x0A, 0x13, 0x18, 0x17, 0x04, 0x23, 0x04, 0x07, 0x23, 0x23, 0x1D, 0x15, 0x1D, 0x20, 0x17, 0x15, 0x23, 0x13,
+    0x15, 0x15, 0x1A, 0x24, 0x23, 0x23, 0x23, 0x06, 0x06, 0x17, 0x21, 0x06, 0x15, 0x06, 0x25, 0x25, 0x26, 0x17, 0x21,
+    0x22, 0x06, 0x26, 0x15, 0x04, 0x0B, 0x0B, 0x0C, 0x17, 0x20, 0x19, 0x1B, 0x1C, 0x20, 0x21, 0x09, 0x18, 0x20, 0x23,
+    0x17, 0x06, 0x25, 0x1B, 0x22, 0x19, 0x20, 0x05, 0x05, 0x0B, 0x0D, 0x04, 0x1F, 0x0B, 0x06, 0x19, 0x06, 0x17, 0x04,
+    0x1E, 0x23, 0x21, 0x22, 0x0C, 0x17, 0x1E, 0x1F, 0x20, 0x22, 0x06, 0x09, 0x0B, 0x0F, 0x12, 0x1B, 0x21, 0x15, 0x1A,
+    0x1D, 0x07, 0x13, 0x1C, 0x17, 0x17, 0x20, 0x22, 0x15, 0x23, 0x24, 0x26, 0x26, 0x15, 0x14, 0x13, 0x06, 0x10, 0x1D,
+    0x1D, 0x06, 0x06, 0x22, 0x0D, 0x17, 0x06, 0x06, 0x17, 0x17, 0x04, 0x1F, 0x23, 0x17, 0x15, 0x15, 0x1A, 0x04, 0x14,
+    0x17, 0x07, 0x06, 0x0A, 0x23, 0x04, 0x22, 0x1F, 0x05, 0x06, 0x0E, 0x04, 0x26, 0x15, 0x0E, 0x1A, 0x1A, 0x07, 0x13,
+    0x1B, 0x04, 0x15, 0x06, 0x17, 0x1F, 0x22, 0x15, 0x07, 0x1A, 0x20, 0x26, 0x04, 0x0B, 0x15, 0x16, 0x1C, 0x07, 0x13,
+    0x17, 0x15, 0x1A, 0x21, 0x22, 0x23, 0x05, 0x07, 0x10, 0x13, 0x26, 0x04, 0x20, 0x23, 0x13, 0x0B, 0x17, 0x17, 0x1B,
+    0x1C, 0x20, 0x21, 0x05, 0x09, 0x0E, 0x16, 0x06, 0x13, 0x16, 0x23, 0x17, 0x1F, 0x20, 0x21, 0x22, 0x24, 0x08, 0x23,
+    0x1F, 0x0B, 0x22, 0x1F, 0x04, 0x05, 0x05, 0x15, 0x26, 0x17, 0x04, 0x1F, 0x22, 0x06, 0x0E, 0x04, 0x1F, 0x15, 0x04,
+    0x15, 0x06, 0x15, 0x23, 0x25, 0x26, 0x04, 0x04, 0x15, 0x19, 0x26, 0x1E, 0x04, 0x21, 0x17, 0x19, 0x1E, 0x0A, 0x17,
+    0x15, 0x19, 0x20, 0x18, 0x23, 0x13, 0x06, 0x1A, 0x17, 0x04, 0x1A, 0x14, 0x14, 0x21, 0x04, 0x13, 0x1A, 0x1D, 0x1D,
+    0x06, 0x15, 0x1D, 0x20, 0x17, 0x13, 0x1D, 0x04, 0x15, 0x1D, 0x05, 0x0C, 0x0D, 0x1D, 0x22, 0x16, 0x1B, 0x23, 0x15,
+    0x23, 0x06, 0x07, 0x20, 0x04, 0x0B, 0x05, 0x0D, 0x23, 0x06, 0x1A, 0x1A, 0x23, 0x1A, 0x07, 0x1A, 0x1A, 0x20, 0x26,
+    0x06, 0x0B, 0x17, 0x04, 0x22, 0x15, 0x16, 0x13, 0x26, 0x04, 0x06, 0x06, 0x04, 0x22, 0x06, 0x17, 0x05, 0x19, 0x1C,
+    0x1E, 0x17, 0x1E, 0x21, 0x22, 0x23, 0x07, 0x14, 0x16, 0x1A, 0x1E, 0x21, 0x24, 0x05, 0x08, 0x10, 0x14, 0x23, 0x17,
+    0x22, 0x17, 0x17, 0x1F, 0x15, 0x1A, 0x23, 0x07, 0x13, 0x17, 0x23, 0x07, 0x13, 0x21, 0x13, 0x17, 0x17, 0x06, 0x06,
+    0x22, 0x1C, 0x14, 0x06, 0x26, 0x17, 0x18, 0x19, 0x1E, 0x20, 0x21, 0x23, 0x07, 0x0B, 0x13, 0x17, 0x0E, 0x1F, 0x23,
+    0x0E, 0x23, 0x1F, 0x12, 0x24, 0x0A, 0x19, 0x19, 0x15, 0x1A, 0x1D, 0x23, 0x1F, 0x24, 0x04, 0x0B, 0x1D, 0x20, 0x24,
+    0x06, 0x13, 0x19, 0x1F, 0x04, 0x0A, 0x22, 0x15, 0x17, 0x1B, 0x04, 0x05, 0x15, 0x1D, 0x23, 0x17, 0x06, 0x0C, 0x1F,
+    0x16, 0x17, 0x19, 0x1C, 0x1E, 0x20, 0x22, 0x04, 0x06, 0x0B, 0x12, 0x23, 0x24, 0x04, 0x18, 0x1B, 0x05, 0x06, 0x17,
+    0x1E, 0x04, 0x05, 0x0F, 0x10, 0x15, 0x1D, 0x23, 0x07, 0x0E, 0x13, 0x0E, 0x24, 0x18, 0x16, 0x1E, 0x20, 0x04, 0x26,
+    0x1A, 0x04, 0x20, 0x17, 0x19, 0x17, 0x1F, 0x05, 0x06, 0x19, 0x20, 0x05, 0x17, 0x22, 0x1A, 0x18, 0x22, 0x17, 0x1F,
+    0x1F, 0x15, 0x10, 0x0E, 0x14, 0x18, 0x1B, 0x17, 0x23, 0x15, 0x21, 0x15, 0x1A, 0x07, 0x13, 0x16, 0x06, 0x20, 0x04,
+    0x15, 0x1C, 0x15, 0x0B, 0x19, 0x13, 0x15, 0x24, 0x17, 0x23, 0x23, 0x26, 0x05, 0x17, 0x1F, 0x13, 0x12, 0x1D, 0x21,
+    0x1F, 0x13, 0x15, 0x06, 0x04, 0x22, 0x13, 0x19, 0x20, 0x19, 0x20, 0x04, 0x16, 0x20, 0x0E, 0x0B, 0x15, 0x04, 0x13,
+    0x1F, 0x05, 0x05, 0x04, 0x14, 0x06, 0x15, 0x04, 0x22, 0x05, 0x05, 0x1E, 0x04, 0x1D, 0x06, 0x1D, 0x06, 0x05, 0x17,
+    0x1A, 0x23, 0x0A, 0x06, 0x15, 0x07, 0x06, 0x1B, 0x17, 0x06, 0x22, 0x17, 0x1A, 0x23, 0x04, 0x07, 0x0A, 0x0B, 0x04,
+    0x15, 0x1A, 0x23, 0x07, 0x13, 0x0B, 0x17, 0x20, 0x21, 0x0B, 0x04, 0x1F, 0x0A, 0x0B, 0x04, 0x0B, 0x04, 0x13, 0x19,
+    0x13, 0x21, 0x1A, 0x0B, 0x04, 0x15, 0x17, 0x21, 0x1A, 0x1D, 0x23, 0x07, 0x13, 0x15, 0x1A, 0x21, 0x13, 0x17, 0x1A,
+    0x1D, 0x07, 0x13, 0x1A, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x0E, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x03, 0x03, 0x03, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x03, 0x03, 0x03, 0x26, 0x26,
+    0x01, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26,
+    0x03, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26,
+    0x26, 0x0F, 0x12, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x03, 0x03, 0x25, 0x03, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25,
+    0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26,
+    0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25,
+    0x26, 0x23, 0x22, 0x0F, 0x10, 0x12, 0x26, 0x26, 0x10, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x1C, 0x26, 0x26,
+    0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x26, 0x0F, 0x10, 0x12, 0x10, 0x26, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x03, 0x03, 0x03, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x03, 0x25, 0x03, 0x25, 0x03, 0x0C, 0x25, 0x03, 0x25, 0x25, 0x25, 0x26, 0x03,
+    0x03, 0x25, 0x26, 0x25, 0x25, 0x0F, 0x10, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x10, 0x25, 0x26, 0x25, 0x26, 0x03, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x10, 0x03, 0x03, 0x03, 0x25, 0x25, 0x25,
+    0x03, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x19, 0x1F, 0x10, 0x25, 0x25, 0x25, 0x25, 0x10, 0x25, 0x25, 0x25, 0x01,
+    0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x0F, 0x10, 0x12,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x10, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x01, 0x25, 0x26, 0x01, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26,
+    0x25, 0x03, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x01, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x03,
+    0x25, 0x03, 0x10, 0x12, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x03, 0x03,
+    0x03, 0x26, 0x03, 0x26, 0x26, 0x25, 0x26, 0x03, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25,
+    0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x03, 0x25, 0x26, 0x26,
+    0x10, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x03, 0x03, 0x25, 0x26, 0x25, 0x03, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x0F,
+    0x12, 0x26, 0x03, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x26, 0x03, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x03, 0x25, 0x25,
+    0x26, 0x26, 0x26, 0x25, 0x1A, 0x1F, 0x19, 0x04, 0x06, 0x05, 0x17, 0x1D, 0x20, 0x1F, 0x06, 0x1A, 0x17, 0x15, 0x15,
+    0x06, 0x24, 0x1C, 0x18, 0x13, 0x23, 0x0B, 0x13, 0x23, 0x15, 0x05, 0x1F, 0x06, 0x19, 0x15, 0x10, 0x06, 0x0B, 0x21,
+    0x15, 0x08, 0x1C, 0x1A, 0x15, 0x15, 0x1A, 0x13, 0x16, 0x19, 0x1C, 0x13, 0x1D, 0x05, 0x15, 0x13, 0x1A, 0x13, 0x1F,
+    0x06, 0x19, 0x04, 0x23, 0x1F, 0x13, 0x19, 0x23, 0x04, 0x22, 0x1A, 0x06, 0x22, 0x22, 0x22, 0x17, 0x19, 0x13, 0x21,
+    0x18, 0x24, 0x19, 0x21, 0x16, 0x22, 0x22, 0x1F, 0x24, 0x13, 0x15, 0x05, 0x21, 0x23, 0x24, 0x04, 0x13, 0x23, 0x15,
+    0x19, 0x23, 0x23, 0x04, 0x19, 0x1D, 0x06, 0x1F, 0x15, 0x1B, 0x13, 0x19, 0x04, 0x18, 0x1A, 0x1C, 0x23, 0x06, 0x22,
+    0x15, 0x1E, 0x1D, 0x22, 0x19, 0x22, 0x06, 0x1C, 0x05, 0x06, 0x23, 0x15, 0x23, 0x15, 0x22, 0x17, 0x10, 0x17, 0x20,
+    0x20, 0x15, 0x06, 0x0B, 0x04, 0x26, 0x22, 0x23, 0x22, 0x16, 0x21, 0x0B, 0x23, 0x22, 0x21, 0x1F, 0x23, 0x04, 0x07,
+    0x1A, 0x1D, 0x23, 0x0E, 0x15, 0x21, 0x15, 0x06, 0x23, 0x04, 0x15, 0x13, 0x1A, 0x15, 0x16, 0x17, 0x19, 0x1C, 0x1F,
+    0x22, 0x04, 0x05, 0x06, 0x15, 0x15, 0x17, 0x23, 0x04, 0x07, 0x23, 0x15, 0x1A, 0x20, 0x23, 0x04, 0x07, 0x1D, 0x04,
+    0x07, 0x04, 0x23, 0x13, 0x1A, 0x18, 0x06, 0x15, 0x21, 0x23, 0x15, 0x1A, 0x13, 0x04, 0x1A, 0x0B, 0x1C, 0x0B, 0x05,
+    0x1A, 0x1F, 0x23, 0x23, 0x15, 0x06, 0x1A, 0x13, 0x1E, 0x04, 0x0B, 0x18, 0x1F, 0x15, 0x04, 0x20, 0x04, 0x05, 0x20,
+    0x05, 0x15, 0x13, 0x06, 0x22, 0x19, 0x1F, 0x06, 0x18, 0x19, 0x04, 0x23, 0x15, 0x0E, 0x17, 0x0E, 0x13, 0x10, 0x20,
+    0x15, 0x23, 0x15, 0x15, 0x1E, 0x0F, 0x12, 0x06, 0x0E, 0x07, 0x1B, 0x23, 0x22, 0x05, 0x22, 0x19, 0x06, 0x23, 0x07,
+    0x04, 0x0B, 0x04, 0x19, 0x05, 0x1A, 0x05, 0x23, 0x1A, 0x22, 0x13, 0x0E, 0x0E, 0x13, 0x18, 0x09, 0x20, 0x20, 0x06,
+    0x19, 0x1A, 0x22, 0x04, 0x1A, 0x14, 0x23, 0x21, 0x17, 0x1F, 0x20, 0x23, 0x1D, 0x17, 0x0E, 0x17, 0x22, 0x05, 0x1F,
+    0x22, 0x1D, 0x10, 0x15, 0x1A, 0x13, 0x17, 0x15, 0x17, 0x04, 0x05, 0x1F, 0x08, 0x15, 0x10, 0x16, 0x18, 0x24, 0x05,
+    0x09, 0x24, 0x16, 0x1F, 0x05, 0x05, 0x1D, 0x07, 0x17, 0x05, 0x0C, 0x1D, 0x23, 0x19, 0x15, 0x07, 0x14, 0x15, 0x1D,
+    0x20, 0x23, 0x15, 0x23, 0x13, 0x15, 0x15, 0x15, 0x13, 0x17, 0x23, 0x22, 0x06, 0x07, 0x1E, 0x15, 0x17, 0x15, 0x04,
+    0x1A, 0x0A, 0x20, 0x21, 0x25, 0x26, 0x1A, 0x15, 0x19, 0x1A, 0x21, 0x23, 0x23, 0x26, 0x04, 0x19, 0x21, 0x22, 0x06,
+    0x0B, 0x1C, 0x0E, 0x05, 0x1A, 0x1F, 0x0B, 0x23, 0x21, 0x19, 0x19, 0x15, 0x23, 0x18, 0x04, 0x22, 0x05, 0x15, 0x20,
+    0x05, 0x15, 0x13, 0x22, 0x05, 0x0D, 0x15, 0x06, 0x21, 0x06, 0x1A, 0x1A, 0x22, 0x19, 0x22, 0x19, 0x04, 0x21, 0x04,
+    0x22, 0x23, 0x23, 0x22, 0x20, 0x23, 0x23, 0x05, 0x06, 0x05, 0x0B, 0x17, 0x18, 0x19, 0x1E, 0x21, 0x23, 0x24, 0x07,
+    0x14, 0x04, 0x1D, 0x23, 0x15, 0x1A, 0x13, 0x23, 0x15, 0x23, 0x13, 0x07, 0x15, 0x15, 0x23, 0x06, 0x0A, 0x22, 0x04,
+    0x08, 0x15, 0x19, 0x1F, 0x21, 0x22, 0x24, 0x04, 0x05, 0x08, 0x13, 0x23, 0x1A, 0x1D, 0x07, 0x21, 0x22, 0x19, 0x05,
+    0x26, 0x19, 0x21, 0x06, 0x26, 0x0A, 0x04, 0x04, 0x20, 0x1F, 0x21, 0x21, 0x20, 0x06, 0x17, 0x05, 0x05, 0x17, 0x1F,
+    0x22, 0x17, 0x22, 0x05, 0x18, 0x05, 0x26, 0x19, 0x04, 0x0B, 0x1E, 0x21, 0x23, 0x22, 0x1D, 0x0E, 0x15, 0x19, 0x26,
+    0x25, 0x15, 0x1A, 0x1D, 0x23, 0x04, 0x17, 0x13, 0x23, 0x1D, 0x13, 0x04, 0x18, 0x21, 0x0B, 0x1A, 0x21, 0x05, 0x07,
+    0x06, 0x1F, 0x04, 0x0B, 0x1A, 0x19, 0x06, 0x23, 0x24, 0x0E, 0x20, 0x22, 0x23, 0x06, 0x21, 0x17, 0x1F, 0x21, 0x24,
+    0x05, 0x17, 0x06, 0x0B, 0x13, 0x1D, 0x06, 0x06, 0x17, 0x06, 0x10, 0x21, 0x17, 0x0E, 0x13, 0x22, 0x15, 0x07, 0x04,
+    0x1A, 0x13, 0x20, 0x07, 0x16, 0x23, 0x13, 0x23, 0x07, 0x22, 0x1B, 0x09, 0x16, 0x1B, 0x1E, 0x1F, 0x21, 0x08, 0x0B,
+    0x0F, 0x10, 0x12, 0x14, 0x1F, 0x1E, 0x20, 0x0B, 0x0E, 0x04, 0x07, 0x23, 0x23, 0x23, 0x13, 0x22, 0x24, 0x05, 0x21,
+    0x04, 0x22, 0x19, 0x19, 0x19, 0x24, 0x17, 0x18, 0x1F, 0x24, 0x22, 0x20, 0x1A, 0x17, 0x20, 0x22, 0x1D, 0x23, 0x0C,
+    0x22, 0x13, 0x15, 0x04, 0x16, 0x06, 0x23, 0x18, 0x05, 0x1A, 0x23, 0x20, 0x04, 0x23, 0x23, 0x06, 0x20, 0x21, 0x04,
+    0x22, 0x05, 0x15, 0x19, 0x23, 0x06, 0x21, 0x1F, 0x1F, 0x1A, 0x20, 0x23, 0x1D, 0x06, 0x13, 0x22, 0x04, 0x04, 0x13,
+    0x15, 0x17, 0x17, 0x23, 0x06, 0x13, 0x19, 0x05, 0x23, 0x15, 0x1F, 0x23, 0x06, 0x13, 0x04, 0x1C, 0x21, 0x22, 0x21,
+    0x0E, 0x04, 0x17, 0x19, 0x21, 0x19, 0x0B, 0x04, 0x04, 0x1C, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26,
+    0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x10, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x26, 0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26,
+    0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x03, 0x03, 0x26, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x01, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x01, 0x25, 0x26, 0x03, 0x25, 0x03, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x22, 0x06, 0x25, 0x25, 0x26, 0x25, 0x25, 0x12, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x01, 0x26,
+    0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25, 0x10, 0x10, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x10, 0x25, 0x25, 0x01, 0x25, 0x25, 0x04, 0x05,
+    0x19, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26,
+    0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25,
+    0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25,
+    0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x01, 0x25, 0x26,
+    0x26, 0x25, 0x26, 0x01, 0x05, 0x1D, 0x15, 0x17, 0x06, 0x04, 0x20, 0x06, 0x06, 0x13, 0x23, 0x04, 0x1C, 0x21, 0x1C,
+    0x06, 0x0A, 0x23, 0x1A, 0x06, 0x13, 0x17, 0x05, 0x08, 0x1E, 0x19, 0x1E, 0x22, 0x05, 0x1D, 0x16, 0x19, 0x22, 0x06,
+    0x1F, 0x21, 0x22, 0x06, 0x23, 0x04, 0x21, 0x15, 0x04, 0x21, 0x1A, 0x06, 0x1A, 0x15, 0x04, 0x19, 0x13, 0x20, 0x1D,
+    0x1A, 0x1A, 0x23, 0x05, 0x23, 0x22, 0x24, 0x1A, 0x24, 0x04, 0x15, 0x22, 0x20, 0x06, 0x24, 0x15, 0x21, 0x05, 0x1D,
+    0x21, 0x22, 0x24, 0x23, 0x21, 0x15, 0x22, 0x20, 0x21, 0x22, 0x19, 0x06, 0x16, 0x06, 0x15, 0x21, 0x22, 0x19, 0x0B,
+    0x19, 0x22, 0x1D, 0x1D, 0x1E, 0x15, 0x04, 0x15, 0x15, 0x23, 0x18, 0x1E, 0x16, 0x19, 0x1A, 0x22, 0x21, 0x15, 0x1A,
+    0x06, 0x06, 0x19, 0x06, 0x1A, 0x0F, 0x1D, 0x07, 0x15, 0x23, 0x15, 0x1A, 0x20, 0x06, 0x20, 0x20, 0x04, 0x15, 0x21,
+    0x22, 0x1A, 0x1D, 0x05, 0x06, 0x1F, 0x04, 0x04, 0x06, 0x1A, 0x1C, 0x23, 0x06, 0x20, 0x1D, 0x23, 0x22, 0x20, 0x20,
+    0x1E, 0x23, 0x18, 0x22, 0x19, 0x13, 0x05, 0x13, 0x06, 0x06, 0x18, 0x21, 0x22, 0x04, 0x22, 0x23, 0x1D, 0x1C, 0x23,
+    0x20, 0x0B, 0x15, 0x04, 0x06, 0x06, 0x0B, 0x19, 0x13, 0x05, 0x22, 0x0C, 0x17, 0x10, 0x22, 0x23, 0x19, 0x21, 0x13,
+    0x13, 0x06, 0x20, 0x04, 0x06, 0x04, 0x05, 0x0E, 0x1D, 0x24, 0x22, 0x1A, 0x15, 0x04, 0x07, 0x04, 0x19, 0x0B, 0x1A,
+    0x13, 0x1E, 0x0B, 0x15, 0x15, 0x23, 0x23, 0x1A, 0x1C, 0x19, 0x22, 0x06, 0x15, 0x22, 0x23, 0x06, 0x06, 0x1A, 0x05,
+    0x1A, 0x04, 0x1D, 0x23, 0x04, 0x07, 0x06, 0x15, 0x04, 0x23, 0x13, 0x22, 0x06, 0x17, 0x21, 0x15, 0x21, 0x22, 0x0B,
+    0x1B, 0x0B, 0x15, 0x21, 0x22, 0x18, 0x16, 0x06, 0x20, 0x0A, 0x20, 0x06, 0x26, 0x1F, 0x06, 0x20, 0x06, 0x13, 0x05,
+    0x13, 0x13, 0x1B, 0x21, 0x04, 0x22, 0x17, 0x15, 0x10, 0x13, 0x06, 0x06, 0x1C, 0x1B, 0x23, 0x20, 0x22, 0x0B, 0x06,
+    0x06, 0x15, 0x22, 0x04, 0x06, 0x06, 0x1A, 0x06, 0x1D, 0x06, 0x22, 0x15, 0x23, 0x05, 0x07, 0x13, 0x19, 0x21, 0x22,
+    0x06, 0x26, 0x04, 0x20, 0x0B, 0x19, 0x1B, 0x1C, 0x20, 0x05, 0x09, 0x1A, 0x1C, 0x04, 0x22, 0x06, 0x1C, 0x16, 0x06,
+    0x04, 0x17, 0x22, 0x1A, 0x21, 0x1A, 0x1A, 0x17, 0x1A, 0x15, 0x23, 0x1A, 0x15, 0x04, 0x15, 0x23, 0x13, 0x05, 0x0B,
+    0x1A, 0x1D, 0x23, 0x1A, 0x06, 0x15, 0x15, 0x1D, 0x13, 0x22, 0x06, 0x0E, 0x15, 0x13, 0x06, 0x23, 0x06, 0x1D, 0x22,
+    0x26, 0x23, 0x20, 0x25, 0x25, 0x22, 0x04, 0x22, 0x06, 0x04, 0x23, 0x23, 0x20, 0x21, 0x17, 0x22, 0x15, 0x1A, 0x1D,
+    0x22, 0x23, 0x07, 0x0F, 0x10, 0x13, 0x23, 0x1A, 0x24, 0x1A, 0x06, 0x0B, 0x23, 0x13, 0x15, 0x14, 0x0B, 0x06, 0x13,
+    0x07, 0x23, 0x04, 0x19, 0x17, 0x17, 0x1C, 0x1F, 0x21, 0x05, 0x1A, 0x22, 0x06, 0x23, 0x13, 0x20, 0x24, 0x1B, 0x18,
+    0x22, 0x22, 0x19, 0x06, 0x0A, 0x15, 0x1A, 0x23, 0x18, 0x20, 0x18, 0x08, 0x19, 0x04, 0x1A, 0x13, 0x20, 0x06, 0x04,
+    0x05, 0x22, 0x16, 0x1A, 0x19, 0x1D, 0x05, 0x17, 0x23, 0x0C, 0x06, 0x22, 0x21, 0x04, 0x20, 0x1E, 0x13, 0x1A, 0x16,
+    0x21, 0x1A, 0x13, 0x13, 0x17, 0x04, 0x23, 0x1A, 0x23, 0x23, 0x05, 0x24, 0x20, 0x04, 0x04, 0x05, 0x17, 0x21, 0x15,
+    0x22, 0x0B, 0x04, 0x19, 0x23, 0x1C, 0x22, 0x04, 0x24, 0x23, 0x07, 0x05, 0x17, 0x04, 0x16, 0x17, 0x18, 0x19, 0x21,
+    0x23, 0x24, 0x04, 0x05, 0x07, 0x08, 0x0B, 0x04, 0x1D, 0x10, 0x13, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26,
+    0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25,
+    0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x26, 0x26, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x10, 0x26, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x10,
+    0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x10, 0x26,
+    0x22, 0x22, 0x26, 0x25, 0x25, 0x03, 0x25, 0x26, 0x26, 0x03, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x01, 0x25, 0x26,
+    0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x06, 0x06, 0x18, 0x22,
+    0x20, 0x22, 0x0C, 0x23, 0x15, 0x1A, 0x05, 0x13, 0x05, 0x06, 0x22, 0x04, 0x15, 0x06, 0x06, 0x20, 0x1A, 0x20, 0x13,
+    0x1A, 0x23, 0x04, 0x04, 0x04, 0x1A, 0x05, 0x22, 0x1E, 0x22, 0x20, 0x05, 0x09, 0x1A, 0x23, 0x19, 0x1B, 0x06, 0x24,
+    0x06, 0x24, 0x1A, 0x23, 0x1A, 0x0A, 0x1A, 0x13, 0x23, 0x21, 0x1A, 0x22, 0x17, 0x17, 0x15, 0x20, 0x22, 0x1C, 0x23,
+    0x05, 0x04, 0x1E, 0x1A, 0x1F, 0x21, 0x23, 0x21, 0x21, 0x23, 0x1C, 0x19, 0x19, 0x21, 0x21, 0x21, 0x08, 0x1C, 0x12,
+    0x07, 0x04, 0x0E, 0x15, 0x21, 0x20, 0x08, 0x06, 0x19, 0x06, 0x0A, 0x21, 0x13, 0x07, 0x1D, 0x05, 0x0B, 0x1E, 0x1D,
+    0x24, 0x16, 0x08, 0x1F, 0x05, 0x17, 0x06, 0x06, 0x1C, 0x05, 0x0C, 0x07, 0x19, 0x23, 0x1C, 0x06, 0x05, 0x21, 0x22,
+    0x06, 0x21, 0x04, 0x20, 0x1A, 0x22, 0x04, 0x1A, 0x19, 0x06, 0x1E, 0x1C, 0x04, 0x20, 0x16, 0x04, 0x0E, 0x04, 0x0B,
+    0x23, 0x1F, 0x20, 0x04, 0x15, 0x19, 0x20, 0x10, 0x1F, 0x15, 0x1E, 0x1D, 0x18, 0x05, 0x23, 0x17, 0x05, 0x07, 0x19,
+    0x1A, 0x0E, 0x13, 0x1C, 0x13, 0x1B, 0x22, 0x1F, 0x07, 0x0A, 0x1A, 0x0A, 0x1A, 0x23, 0x13, 0x17, 0x16, 0x24, 0x05,
+    0x21, 0x21, 0x05, 0x10, 0x1D, 0x07, 0x0E, 0x0E, 0x23, 0x15, 0x1F, 0x1A, 0x06, 0x20, 0x15, 0x1F, 0x24, 0x21, 0x22,
+    0x22, 0x06, 0x1D, 0x23, 0x19, 0x0A, 0x1F, 0x06, 0x1E, 0x24, 0x0B, 0x21, 0x22, 0x1E, 0x06, 0x04, 0x19, 0x20, 0x04,
+    0x19, 0x23, 0x22, 0x10, 0x13, 0x06, 0x21, 0x22, 0x21, 0x09, 0x0C, 0x19, 0x22, 0x22, 0x1D, 0x04, 0x19, 0x05, 0x19,
+    0x19, 0x04, 0x22, 0x1D, 0x15, 0x20, 0x23, 0x15, 0x21, 0x04, 0x1B, 0x19, 0x04, 0x17, 0x08, 0x16, 0x13, 0x1A, 0x22,
+    0x15, 0x22, 0x17, 0x06, 0x17, 0x1D, 0x1A, 0x1D, 0x05, 0x1C, 0x22, 0x04, 0x1A, 0x1E, 0x21, 0x1E, 0x24, 0x24, 0x26,
+    0x15, 0x06, 0x16, 0x15, 0x1D, 0x1D, 0x04, 0x04, 0x24, 0x15, 0x1D, 0x05, 0x20, 0x23, 0x17, 0x21, 0x05, 0x04, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25,
+    0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25,
+    0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+    0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26,
+    0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x25, 0x25,
+    0x26, 0x26, 0x0F, 0x25, 0x25, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x19, 0x22, 0x15, 0x06,
+    0x04, 0x22, 0x04, 0x1E, 0x13, 0x23, 0x1E, 0x15, 0x13, 0x05, 0x13, 0x06, 0x04, 0x1E, 0x04, 0x1E, 0x1E, 0x04, 0x1F,
+    0x24, 0x06, 0x12, 0x1B, 0x1C, 0x13, 0x19, 0x06, 0x15, 0x05, 0x06, 0x06, 0x13, 0x21, 0x1A, 0x21, 0x1B, 0x23, 0x06,
+    0x1A, 0x05, 0x1B, 0x22, 0x06, 0x0A, 0x06, 0x1F, 0x16, 0x20, 0x17, 0x21, 0x1D, 0x15, 0x1A, 0x21, 0x15, 0x04, 0x1A,
+    0x18, 0x15, 0x21, 0x05, 0x13, 0x13, 0x13, 0x04, 0x06, 0x06, 0x1A, 0x1C, 0x19, 0x22, 0x04, 0x06, 0x15, 0x22, 0x0C,
+    0x04, 0x06, 0x1C, 0x22, 0x17, 0x06, 0x0E, 0x06, 0x21, 0x1E, 0x15, 0x13, 0x20, 0x06, 0x23, 0x06, 0x17, 0x0B, 0x20,
+    0x23, 0x1E, 0x04, 0x04, 0x07, 0x06, 0x23, 0x17, 0x0A, 0x10, 0x13, 0x13, 0x05, 0x23, 0x05, 0x15, 0x04, 0x1C, 0x1D,
+    0x05, 0x1D, 0x04, 0x20, 0x07, 0x21, 0x1E, 0x1A, 0x15, 0x1A, 0x04, 0x06, 0x19, 0x22, 0x1E, 0x1C, 0x06, 0x1A, 0x1D,
+    0x1E, 0x05, 0x05, 0x18, 0x18, 0x06, 0x18, 0x1D, 0x0B, 0x16, 0x06, 0x15, 0x1F, 0x23, 0x13, 0x26, 0x26, 0x25, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x25,
+    0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26,
+    0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25,
+    0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x06, 0x05, 0x1C, 0x05, 0x05, 0x06, 0x05, 0x05, 0x1A, 0x04, 0x1C, 0x1C, 0x06,
+    0x05, 0x1E, 0x17, 0x04, 0x05, 0x15, 0x1A, 0x06, 0x22, 0x1E, 0x1A, 0x06, 0x04, 0x04, 0x1A, 0x06, 0x1C, 0x1B, 0x22,
+    0x04, 0x04, 0x19, 0x15, 0x15, 0x17, 0x23, 0x13, 0x22, 0x05, 0x13, 0x04, 0x24, 0x15, 0x22, 0x04, 0x06, 0x19, 0x1E,
+    0x1F, 0x05, 0x16, 0x04, 0x1F, 0x15, 0x1F, 0x05, 0x04, 0x17, 0x05, 0x06, 0x06, 0x1A, 0x06, 0x17, 0x26, 0x26, 0x26,
+    0x26, 0x26, 0x26, 0x26, 0x26, 0x25, 0x25, 0x26, 0x25, 0x26, 0x25, 0x25, 0x25, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26,
+    0x25, 0x25, 0x26, 0x26, 0x26, 0x25, 0x26, 0x25, 0x26, 0x25, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x13, 0x05, 0x17,
+    0x1C, 0x04, 0x1D, 0x05, 0x1E, 0x18, 0x1E, 0x13, 0x13, 0x22, 0x04, 0x1C, 0x06, 0x15, 0x15, 0x06, 0x13, 0x06, 0x1C,
+    0x06, 0x18, 0x06, 0x22, 0x26, 0x25, 0x26, 0x26, 0x26, 0x26, 0x25, 0x26, 0x06, 0x1A, 0x13, 0x06, 0x05, 0x05, 0x22,
+    0x07, 0x25, 0x25, 0x26, 0x26, 0x25, 0x1B, 0x18, 0x06, 0x06, 0x1C,
+};
+
+constexpr uint16_t uk_child_base[] = {
+    1, 124, 206, 270, 300, 316, 378, 442, 499, 543, 584, 722, 859, 996, 1132, 1268,
+    1404, 1540, 1676, 1693, 1693, 1701, 1701, 1783, 1915, 2047, 2179, 2311, 2443, 2575, 2707, 2794,
+    2826, 2841, 2858, 2868, 2885, 2918, 2937, 2968, 2988, 3035, 3059, 3089, 3112, 3144, 3171, 3196,
+    3223, 3243, 3264, 3294, 3326, 3348, 3369, 3387, 3423, 3446, 3472, 3495, 3519, 3542, 3568, 3598,
+    3627, 3662, 3694, 3723, 3745, 3773, 3796, 3837, 3864, 3897, 3923, 3950, 3980, 4006, 4031, 4047,
+    4073, 4091, 4116, 4134, 4153, 4172, 4192, 4209, 4235, 4250, 4267, 4282, 4298, 4314, 4329, 4345,
+    4365, 4383, 4402, 4421, 4439, 4462, 4478, 4498, 4513, 4530, 4543, 4543, 4543, 4543, 4543, 4543,
+    4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543,
+    4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543,
+    4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543,
+    4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4543, 4548,
+    4559, 4566, 4578, 4585, 4594, 4604, 4621, 4625, 4633, 4641, 4649, 4657, 4670, 4677, 4691, 4692,
+    4697, 4710, 4717, 4724, 4732, 4746, 4753, 4763, 4772, 4790, 4791, 4795, 4798, 4816, 4830, 4839,
+    4846, 4853, 4858, 4859, 4860, 4870, 4875, 4878, 4883, 4890, 4894, 4894, 4899, 4900, 4925, 4928,
+    4934, 4935, 4952, 4968, 4976, 4980, 5009, 5020, 5037, 5044, 5050, 5066, 5077, 5082, 5090, 5097,
+    5104, 5108, 5115, 5121, 5157, 5167, 5171, 5176, 5184, 5189, 5196, 5209, 5212, 5213, 5218, 5220,
+    5221, 5226, 5228, 5229, 5234, 5234, 5235, 5236, 5239, 5246, 5246, 5247, 5247, 5247, 5247, 5247,
+    5248, 5252, 5255, 5260, 5263, 5264, 5270, 5276, 5278, 5280, 5281, 5282, 5283, 5296, 5315, 5332,
+    5351, 5369, 5391, 5410, 5429, 5448, 5465, 5483, 5501, 5516, 5533, 5549, 5565, 5584, 5603, 5621,
+    5634, 5653, 5668, 5680, 5699, 5720, 5739, 5759, 5767, 5784, 5803, 5820, 5839, 5857, 5876, 5899,
+    5914, 5927, 5945, 5962, 5975, 5991, 6005, 6017, 6032, 6047, 6061, 6080, 6090, 6105, 6123, 6151,
+    6167, 6190, 6203, 6217, 6233, 6251, 6272, 6303, 6324, 6347, 6368, 6389, 6402, 6425, 6442, 6468,
+    6482, 6491, 6505, 6507, 6514, 6529, 6560, 6576, 6587, 6598, 6617, 6636, 6656, 6677, 6706, 6726,
+    6738, 6749, 6770, 6801, 6823, 6836, 6850, 6868, 6882, 6895, 6911, 6927, 6949, 6967, 6986, 7002,
+    7018, 7034, 7050, 7065, 7078, 7087, 7104, 7114, 7118, 7125, 7129, 7149, 7152, 7164, 7176, 7191,
+    7204, 7213, 7220, 7228, 7230, 7241, 7255, 7271, 7282, 7300, 7308, 7323, 7337, 7353, 7366, 7381,
+    7395, 7414, 7431, 7448, 7461, 7478, 7495, 7504, 7519, 7526, 7542, 7548, 7560, 7574, 7589, 7598,
+    7609, 7622, 7634, 7638, 7641, 7657, 7673, 7692, 7707, 7726, 7743, 7760, 7773, 7793, 7815, 7835,
+    7848, 7864, 7880, 7890, 7906, 7918, 7931, 7941, 7957, 7975, 7994, 8005, 8022, 8039, 8056, 8078,
+    8101, 8122, 8138, 8155, 8169, 8184, 8205, 8222, 8244, 8258, 8271, 8287, 8303, 8322, 8334, 8344,
+    8355, 8369, 8380, 8393, 8407, 8416, 8426, 8434, 8449, 8466, 8477, 8488, 8494, 8501, 8509, 8517,
+    8531, 8544, 8561, 8573, 8588, 8599, 8604, 8611, 8615, 8633, 8646, 8657, 8667, 8679, 8693, 8707,
+    8713, 8724, 8729, 8734, 8744, 8755, 8766, 8781, 8793, 8805, 8821, 8838, 8854, 8870, 8886, 8902,
+    8919, 8939, 8956, 8973, 8989, 9006, 9021, 9038, 9053, 9065, 9080, 9102, 9122, 9139, 9153, 9167,
+    9190, 9209, 9228, 9244, 9260, 9276, 9302, 9306, 9318, 9329, 9340, 9350, 9358, 9370, 9387, 9401,
+    9406, 9414, 9418, 9431, 9440, 9453, 9459, 9465, 9469, 9481, 9485, 9500, 9512, 9522, 9530, 9540,
+    9549, 9555, 9563, 9573, 9579, 9590, 9601, 9617, 9633, 9649, 9665, 9682, 9698, 9714, 9730, 9746,
+    9761, 9777, 9795, 9809, 9822, 9839, 9855, 9871, 9881, 9890, 9896, 9906, 9918, 9924, 9928, 9936,
+    9946, 9954, 9964, 9975, 9987, 9991, 9995, 10005, 10014, 10023, 10037, 10053, 10070, 10086, 10103, 10120,
+    10136, 10153, 10168, 10181, 10187, 10194, 10200, 10210, 10213, 10221, 10230, 10238, 10246, 10259, 10275, 10291,
+    10307, 10320, 10328, 10335, 10342, 10352, 10368, 10378, 10385, 10392, 10404,
+};
+
+constexpr uint8_t uk_child_offset[] = {
+    0x00, 0x06, 0x0A, 0x0F, 0x13, 0x23, 0x33, 0x34, 0x35, 0x45, 0x55, 0x56, 0x5A, 0x5A, 0x6A, 0x7A, 0x00, 0x01, 0x11,
+    0x21, 0x22, 0x26, 0x2A, 0x2E, 0x32, 0x36, 0x3A, 0x3E, 0x42, 0x46, 0x4A, 0x4E, 0x00, 0x04, 0x08, 0x0C, 0x10, 0x14,
+    0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C, 0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x14, 0x15, 0x16,
+    0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x09, 0x19, 0x29, 0x2A, 0x2E, 0x32, 0x36,
+    0x3A, 0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C, 0x00, 0x04,
+    0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x30, 0x31, 0x35, 0x00, 0x01, 0x05, 0x06, 0x07,
+    0x0C, 0x0D, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1D, 0x21, 0x25, 0x28, 0x00, 0x02, 0x05, 0x07, 0x09, 0x0C, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x10, 0x11, 0x13, 0x23, 0x33, 0x34, 0x36, 0x46, 0x56, 0x57,
+    0x58, 0x68, 0x78, 0x79, 0x7A, 0x00, 0x10, 0x11, 0x12, 0x22, 0x32, 0x33, 0x34, 0x44, 0x54, 0x55, 0x57, 0x67, 0x77,
+    0x78, 0x79, 0x00, 0x10, 0x11, 0x12, 0x22, 0x32, 0x33, 0x34, 0x44, 0x54, 0x55, 0x56, 0x66, 0x76, 0x77, 0x79, 0x00,
+    0x10, 0x11, 0x12, 0x22, 0x32, 0x33, 0x34, 0x44, 0x54, 0x55, 0x56, 0x66, 0x76, 0x77, 0x78, 0x00, 0x10, 0x11, 0x12,
+    0x22, 0x32, 0x33, 0x34, 0x44, 0x54, 0x55, 0x56, 0x66, 0x76, 0x77, 0x78, 0x00, 0x10, 0x11, 0x12, 0x22, 0x32, 0x33,
+    0x34, 0x44, 0x54, 0x55, 0x56, 0x66, 0x76, 0x77, 0x78, 0x00, 0x10, 0x11, 0x12, 0x22, 0x32, 0x33, 0x34, 0x44, 0x54,
+    0x55, 0x56, 0x66, 0x76, 0x77, 0x78, 0x00, 0x10, 0x11, 0x12, 0x22, 0x32, 0x33, 0x34, 0x44, 0x54, 0x55, 0x56, 0x66,
+    0x76, 0x77, 0x78, 0x00, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x20, 0x21, 0x21, 0x31, 0x41, 0x42, 0x42, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53,
+    0x63, 0x73, 0x74, 0x74, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53, 0x63, 0x73, 0x74,
+    0x74, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53, 0x63, 0x73, 0x74, 0x74, 0x00, 0x10,
+    0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53, 0x63, 0x73, 0x74, 0x74, 0x00, 0x10, 0x11, 0x11, 0x21,
+    0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53, 0x63, 0x73, 0x74, 0x74, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32,
+    0x42, 0x52, 0x53, 0x53, 0x63, 0x73, 0x74, 0x74, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53,
+    0x53, 0x63, 0x73, 0x74, 0x74, 0x00, 0x10, 0x11, 0x11, 0x21, 0x31, 0x32, 0x32, 0x42, 0x52, 0x53, 0x53, 0x53, 0x53,
+    0x56, 0x57, 0x00, 0x00, 0x0B, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1B, 0x1F, 0x20, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x06, 0x06, 0x07, 0x09, 0x09, 0x09, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x02,
+    0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x0B, 0x0D, 0x0D, 0x0D, 0x0E, 0x11, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x04, 0x07, 0x0A, 0x0C, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x05, 0x08, 0x0A, 0x0C, 0x0F, 0x12, 0x15, 0x17, 0x19, 0x1C,
+    0x1D, 0x1F, 0x20, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0E, 0x0F, 0x11, 0x12,
+    0x00, 0x02, 0x03, 0x05, 0x06, 0x09, 0x0A, 0x0E, 0x0F, 0x11, 0x14, 0x15, 0x19, 0x1C, 0x1D, 0x1E, 0x00, 0x01, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x11, 0x00, 0x03, 0x04, 0x08, 0x0B, 0x0E,
+    0x11, 0x14, 0x16, 0x19, 0x1D, 0x20, 0x22, 0x25, 0x29, 0x2C, 0x00, 0x03, 0x05, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x16, 0x17, 0x18, 0x00, 0x01, 0x02, 0x04, 0x06, 0x08, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x14, 0x16, 0x1A, 0x1D, 0x00, 0x04, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x16, 0x00, 0x01, 0x01, 0x03, 0x05, 0x08, 0x09, 0x0B, 0x0E, 0x11, 0x15, 0x17, 0x18, 0x19, 0x1B, 0x1D, 0x00, 0x03,
+    0x04, 0x08, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x18, 0x19, 0x1A, 0x00, 0x03, 0x04, 0x05, 0x05,
+    0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x13, 0x14, 0x17, 0x00, 0x03, 0x06, 0x09, 0x0A, 0x0B, 0x0D, 0x10,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x09, 0x0C, 0x0D,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0C, 0x0F, 0x14, 0x17, 0x1B, 0x1D, 0x00,
+    0x01, 0x02, 0x04, 0x06, 0x08, 0x0C, 0x10, 0x12, 0x13, 0x17, 0x19, 0x1A, 0x1D, 0x1E, 0x1F, 0x00, 0x02, 0x03, 0x04,
+    0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x0F, 0x11, 0x12, 0x13, 0x15, 0x00, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x10, 0x00, 0x02, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0E, 0x11, 0x15, 0x18, 0x1A,
+    0x1C, 0x1E, 0x21, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x15,
+    0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0E, 0x11, 0x12, 0x13, 0x16, 0x17, 0x00, 0x04, 0x07,
+    0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00, 0x00, 0x01, 0x03, 0x04, 0x06,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x12, 0x15, 0x17, 0x00, 0x02, 0x03, 0x05, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x13, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x02, 0x03, 0x05, 0x09, 0x0A, 0x0C, 0x0D, 0x0F, 0x11,
+    0x12, 0x13, 0x14, 0x17, 0x00, 0x02, 0x05, 0x07, 0x09, 0x0C, 0x0F, 0x11, 0x12, 0x14, 0x16, 0x17, 0x18, 0x1A, 0x1C,
+    0x1D, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x09, 0x0A, 0x0C, 0x10, 0x14, 0x17, 0x19, 0x1B, 0x1C, 0x00, 0x03,
+    0x04, 0x06, 0x09, 0x0B, 0x0C, 0x0E, 0x12, 0x16, 0x17, 0x19, 0x1B, 0x1E, 0x20, 0x22, 0x00, 0x04, 0x05, 0x06, 0x07,
+    0x09, 0x0A, 0x0B, 0x0B, 0x0E, 0x12, 0x15, 0x16, 0x1A, 0x1D, 0x1E, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x0B,
+    0x0E, 0x10, 0x13, 0x14, 0x17, 0x18, 0x1A, 0x1B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0A, 0x0B, 0x0B,
+    0x0E, 0x0F, 0x10, 0x11, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x11, 0x15, 0x18,
+    0x19, 0x1B, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0D, 0x0F, 0x11, 0x15, 0x00,
+    0x04, 0x06, 0x08, 0x0C, 0x0D, 0x0E, 0x11, 0x14, 0x17, 0x1A, 0x1C, 0x1E, 0x20, 0x23, 0x27, 0x00, 0x02, 0x04, 0x07,
+    0x09, 0x0B, 0x0E, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x18, 0x1A, 0x00, 0x02, 0x03, 0x06, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x10, 0x13, 0x15, 0x17, 0x19, 0x1D, 0x1E, 0x00, 0x04, 0x06, 0x08, 0x0B, 0x0D, 0x0E, 0x10, 0x11, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x00, 0x01, 0x02, 0x05, 0x06, 0x07, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x11, 0x14,
+    0x17, 0x18, 0x1A, 0x00, 0x03, 0x07, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x12, 0x14, 0x15, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x00, 0x01, 0x01, 0x02, 0x04, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x13, 0x15, 0x19, 0x00, 0x01, 0x04,
+    0x07, 0x0A, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x00, 0x02, 0x03, 0x04, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x02, 0x03, 0x05, 0x06, 0x08, 0x0B, 0x0E, 0x0F,
+    0x11, 0x12, 0x13, 0x14, 0x16, 0x17, 0x19, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0C, 0x0E, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+    0x18, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08,
+    0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0B, 0x0D, 0x0E, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x09, 0x0B, 0x0D, 0x10, 0x11, 0x12, 0x13,
+    0x15, 0x19, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06,
+    0x06, 0x07, 0x08, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0F, 0x10, 0x00, 0x01, 0x03, 0x04, 0x07, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x02,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07,
+    0x07, 0x09, 0x09, 0x0B, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x00,
+    0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x07, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x07, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x00, 0x01, 0x01, 0x03, 0x05, 0x05, 0x08, 0x09, 0x09, 0x0B, 0x0C,
+    0x0C, 0x0E, 0x0E, 0x0F, 0x0F, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x00, 0x01, 0x01, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x08, 0x08, 0x08, 0x00, 0x03, 0x05, 0x05,
+    0x05, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06,
+    0x07, 0x07, 0x07, 0x08, 0x08, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x04, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x00, 0x02, 0x02, 0x02, 0x05, 0x06, 0x06, 0x06, 0x08, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x03,
+    0x03, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x09, 0x09, 0x09, 0x09, 0x0B, 0x00, 0x00,
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x04, 0x04, 0x04, 0x04, 0x07, 0x07, 0x07, 0x09, 0x09, 0x09, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x09, 0x00, 0x02, 0x03, 0x03, 0x08, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D,
+    0x0E, 0x0F, 0x0F, 0x11, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x0A, 0x0E, 0x0E, 0x0F, 0x11, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x06,
+    0x07, 0x07, 0x07, 0x0B, 0x0D, 0x0D, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x03, 0x03, 0x03, 0x05, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x01, 0x03,
+    0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+    0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x0B, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x17, 0x18, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x0B, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0F, 0x11, 0x11, 0x00, 0x03, 0x04, 0x04, 0x0A, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x06, 0x06, 0x06,
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x07, 0x0D,
+    0x0D, 0x0D, 0x0D, 0x0D, 0x0F, 0x0F, 0x0F, 0x0F, 0x13, 0x14, 0x15, 0x15, 0x1B, 0x00, 0x00, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x07, 0x09, 0x09, 0x09, 0x0B, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x07,
+    0x0A, 0x0A, 0x0C, 0x0E, 0x0E, 0x10, 0x10, 0x00, 0x01, 0x01, 0x01, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x10, 0x10, 0x10, 0x00, 0x03,
+    0x04, 0x04, 0x04, 0x07, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x04, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x04, 0x06, 0x06, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x02, 0x02, 0x02, 0x09, 0x0F, 0x0F,
+    0x0F, 0x0F, 0x10, 0x10, 0x10, 0x19, 0x22, 0x22, 0x24, 0x00, 0x01, 0x01, 0x03, 0x04, 0x04, 0x05, 0x05, 0x05, 0x06,
+    0x06, 0x06, 0x06, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x06, 0x07, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x05, 0x06, 0x06, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x05, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04,
+    0x05, 0x05, 0x00, 0x00, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x00, 0x02, 0x03,
+    0x04, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x10, 0x12, 0x13, 0x14, 0x00, 0x01, 0x03, 0x04, 0x06, 0x07, 0x08, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x0E, 0x10, 0x10, 0x11, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08,
+    0x09, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x02, 0x03, 0x04, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0E, 0x0F, 0x00, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x0A, 0x0B, 0x0B, 0x0C,
+    0x0E, 0x11, 0x12, 0x14, 0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x00, 0x02, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x11, 0x12, 0x13, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F,
+    0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0E, 0x10, 0x10, 0x11, 0x00,
+    0x00, 0x01, 0x02, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x06, 0x07, 0x09, 0x0A, 0x0D, 0x0E, 0x11, 0x13, 0x14, 0x15, 0x16, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x08, 0x0A,
+    0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x01, 0x03, 0x05, 0x07, 0x09, 0x0A, 0x0A, 0x0B, 0x0D, 0x0D, 0x10, 0x11,
+    0x11, 0x12, 0x12, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0F, 0x10,
+    0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0D, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06,
+    0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x00, 0x02,
+    0x03, 0x06, 0x07, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x01, 0x02, 0x02, 0x05, 0x08, 0x08,
+    0x08, 0x08, 0x09, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x17, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x02, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x05, 0x06, 0x07, 0x08, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B,
+    0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x00, 0x05, 0x07, 0x0B, 0x0C, 0x0F, 0x10, 0x12, 0x13, 0x13, 0x14, 0x15, 0x18, 0x1A, 0x1B, 0x1E, 0x00, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x02, 0x05, 0x07, 0x08, 0x09,
+    0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x15, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0C, 0x0E, 0x10, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x0F,
+    0x10, 0x11, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x0A, 0x0B,
+    0x0C, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x00, 0x02,
+    0x04, 0x05, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0E, 0x0F, 0x10, 0x10, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x09, 0x0E, 0x0F, 0x0F, 0x10, 0x13, 0x15, 0x16, 0x17, 0x1A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05,
+    0x06, 0x06, 0x07, 0x08, 0x08, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x06, 0x00, 0x01, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x02, 0x02, 0x05, 0x07, 0x08, 0x0D,
+    0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x1D, 0x1F, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x04,
+    0x06, 0x07, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0B, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0B, 0x0D, 0x0E, 0x0F, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x00, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A,
+    0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C,
+    0x11, 0x13, 0x18, 0x1C, 0x00, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x08, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x08, 0x0A, 0x0C, 0x0D, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x04, 0x06, 0x09, 0x0A, 0x0C,
+    0x0D, 0x14, 0x18, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x00, 0x00, 0x00, 0x02, 0x06, 0x06, 0x09, 0x0C, 0x0D, 0x0E, 0x0E,
+    0x0F, 0x12, 0x13, 0x14, 0x15, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x05, 0x07, 0x07, 0x07, 0x09, 0x0A, 0x0B,
+    0x0B, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0B, 0x0C, 0x0D, 0x00,
+    0x01, 0x03, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x03, 0x05, 0x07,
+    0x08, 0x08, 0x08, 0x08, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x00, 0x00, 0x03, 0x05, 0x06, 0x07, 0x08, 0x08, 0x0B, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0D, 0x10, 0x12, 0x00, 0x03, 0x04,
+    0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x00, 0x01,
+    0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0E, 0x0F, 0x10, 0x12, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0E,
+    0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x03, 0x04,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A,
+    0x0A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x00, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x00,
+    0x01, 0x02, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x03,
+    0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C,
+    0x0F, 0x10, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x07, 0x09, 0x0B, 0x0C, 0x0E, 0x0F, 0x0F, 0x10, 0x10,
+    0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0C, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0D, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x08, 0x00, 0x01, 0x03, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x06, 0x00, 0x01,
+    0x02, 0x02, 0x04, 0x06, 0x06, 0x07, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x08, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x03, 0x04, 0x04, 0x06, 0x06,
+    0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x09, 0x0B,
+    0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x03, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x11, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x02,
+    0x03, 0x04, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x11, 0x13, 0x14, 0x15, 0x00, 0x02, 0x04, 0x05, 0x09, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x0F, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x02, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x07, 0x07, 0x09, 0x00, 0x02, 0x03, 0x03, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x03,
+    0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x12, 0x14, 0x15, 0x16, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0E, 0x0E, 0x0F, 0x11, 0x00, 0x04, 0x05, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B,
+    0x0B, 0x0C, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D,
+    0x0D, 0x0D, 0x00, 0x00, 0x01, 0x02, 0x03, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00,
+    0x01, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x03, 0x09, 0x0A, 0x0A, 0x0C, 0x0D,
+    0x0E, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0C, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0C, 0x0E, 0x0F, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x03, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05,
+    0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05,
+    0x05, 0x06, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06,
+    0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x0A, 0x0C, 0x0D, 0x0E, 0x00,
+    0x01, 0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05,
+    0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05,
+    0x06, 0x07, 0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x07,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x01,
+    0x02, 0x02, 0x03, 0x04, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x06, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x00, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x04, 0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A,
+    0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x00,
+    0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0B, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02,
+    0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x02, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0A, 0x0B,
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06,
+    0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x07, 0x08,
+    0x09, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0B, 0x0C, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x05, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0E, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0F, 0x12, 0x15, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0C, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0F, 0x10, 0x11, 0x12, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x11,
+    0x16, 0x17, 0x18, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x0B, 0x00, 0x00, 0x00,
+    0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A,
+    0x0B, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01,
+    0x02, 0x03, 0x05, 0x06, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0E, 0x00, 0x01, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04,
+    0x05, 0x05, 0x06, 0x07, 0x07, 0x07, 0x08, 0x08, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B,
+    0x0C, 0x0D, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x08, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x00, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A,
+    0x0B, 0x0B, 0x0C, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x05, 0x06,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x01, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07,
+    0x08, 0x09, 0x0A, 0x0A, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x00, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06,
+    0x06, 0x07, 0x08, 0x08, 0x09, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0D,
+    0x0E, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x09, 0x09, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03,
+    0x04, 0x05, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05,
+    0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x06, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05,
+    0x06, 0x07, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x04, 0x04, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x04, 0x04,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x00, 0x01, 0x02, 0x03, 0x03, 0x04, 0x05, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x05, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x05,
+    0x06, 0x06, 0x07, 0x08, 0x09, 0x09, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06,
+    0x07, 0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x06, 0x07, 0x08, 0x09, 0x00, 0x00,
+    0x01, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x00, 0x01, 0x01, 0x01, 0x02,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04,
+    0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x0A, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x03, 0x04, 0x04, 0x04, 0x05, 0x05, 0x06, 0x07, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x05, 0x06, 0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x05, 0x06,
+    0x07, 0x08, 0x09, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x03, 0x03, 0x04, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x01, 0x02, 0x02, 0x03, 0x04, 0x04, 0x05, 0x06,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+constexpr uint16_t uk_fail[] = {
+    0, 0, 0, 0, 0, 0, 0, 1, 4, 5, 6, 1, 2, 4, 5, 6,
+    1, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 7, 8, 9, 10, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4, 5, 6, 1, 4,
+    5, 6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 283, 284, 2, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231,
+    232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 2, 162, 2, 163, 164, 166,
+    2, 167, 168, 2, 174, 2, 175, 176, 2, 2, 186, 2, 187, 188, 189, 2,
+    2, 196, 2, 199, 200, 2, 203, 204, 206, 2, 208, 210, 2, 211, 2, 215,
+    218, 2, 219, 220, 222, 2, 223, 224, 2, 227, 228, 230, 2, 231, 232, 2,
+    235, 238, 2, 239, 2, 243, 2, 248, 2, 251, 252, 254, 2, 255, 256, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 9, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 9, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 2, 9, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+    51, 52, 2, 9, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21,
+    22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+    38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 2, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 1628, 1630, 1632,
+    1633, 1637, 1638, 1643, 1647, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578,
+    579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594,
+    595, 596, 597, 598, 599, 600, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+    613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628,
+    629, 630, 631, 632, 633, 634, 635, 638, 639, 640, 641, 642, 643, 644, 645, 646,
+    647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662,
+    663, 664, 665, 666, 667, 668, 669, 670, 672, 673, 674, 675, 676, 677, 678, 679,
+    680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695,
+    696, 697, 698, 699, 700, 701, 702, 703, 704, 706, 707, 708, 709, 710, 711, 712,
+    713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728,
+    729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 740, 741, 742, 743, 744, 745,
+    746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761,
+    762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 774, 775, 776, 777, 778,
+    779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794,
+    795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 809, 810, 811, 812,
+    813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828,
+    829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 843, 844, 845,
+    846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+    862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 877, 878,
+    879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894,
+    895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 911,
+    912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943,
+    945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
+    961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976,
+    977, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994,
+    995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010,
+    1011, 1012, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+    1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
+    1044, 1045, 1046, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+    1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+    1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+    1110, 1111, 1112, 1113, 1114, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+    1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+    1143, 1144, 1145, 1146, 1147, 1148, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
+    1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+    1176, 1177, 1178, 1179, 1180, 1181, 1182, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+    1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+    1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
+    1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241,
+    1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
+    1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
+    1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1286, 1287, 1288, 1289, 1290, 1291,
+    1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+    1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1320, 1321, 1322, 1323, 1324,
+    1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+    1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1354, 1355, 1356, 1357,
+    1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+    1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1388, 1389, 1390,
+    1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406,
+    1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1456,
+    1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+    1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+    1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505,
+    1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521,
+    1522, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538,
+    1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
+    1555, 1556, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+    1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+    1588, 1589, 1590, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+    1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620,
+    1621, 1622, 1623, 1624, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+    1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653,
+    1654, 1655, 1656, 1657, 1658, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
+    1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
+    1687, 1688, 1689, 1690, 1691, 1692, 607, 608, 614, 619, 639, 640, 641, 642, 644, 645,
+    646, 648, 649, 650, 653, 655, 656, 662, 668, 712, 713, 717, 720, 723, 809, 810,
+    811, 812, 813, 820, 821, 826, 832, 833, 839, 841, 901, 922, 926, 928, 932, 935,
+    955, 962, 971, 997, 1000, 1010, 1014, 1015, 1060, 1087, 1096, 1098, 1099, 1103, 1112, 1130,
+    1134, 1160, 1161, 1165, 1168, 1171, 1194, 1200, 1205, 1210, 1230, 1263, 1297, 1346, 1359, 1375,
+    1398, 1399, 1403, 1406, 2, 159, 2, 163, 2, 167, 168, 2, 171, 172, 2, 175,
+    2, 180, 2, 2, 187, 2, 2, 196, 2, 200, 2, 203, 204, 2, 207, 2,
+    211, 2, 215, 216, 2, 219, 220, 2, 223, 224, 2, 227, 2, 231, 2, 235,
+    236, 2, 2, 243, 2, 2, 2, 2, 2, 2, 2, 2, 2, 280, 2, 2,
+    83, 2, 159, 160, 2, 2, 3, 2, 2, 2, 179, 2, 2, 3, 2, 2,
+    3, 195, 2, 2, 3, 203, 204, 2, 2, 3, 2, 215, 216, 2, 2, 3,
+    223, 224, 2, 3, 228, 2, 2, 2, 2, 2, 248, 2, 2, 2, 2, 2,
+    2, 2, 2, 279, 2, 2, 82, 2, 159, 2, 3, 163, 2, 3, 167, 2,
+    2, 3, 175, 176, 2, 179, 180, 2, 3, 183, 2, 3, 188, 2, 191, 192,
+    2, 3, 2, 3, 199, 2, 3, 203, 204, 206, 2, 3, 2, 3, 2, 215,
+    216, 2, 3, 219, 220, 2, 3, 223, 2, 3, 228, 2, 3, 232, 2, 235,
+    2, 2, 3, 2, 248, 2, 3, 2, 3, 2, 3, 2, 2, 2, 2, 2,
+    279, 2, 2, 2, 2, 2, 3, 2, 3, 2, 3, 2, 179, 180, 2, 2,
+    2, 2, 2, 2, 3, 203, 204, 2, 3, 2, 3, 211, 212, 2, 215, 216,
+    2, 2, 3, 223, 224, 2, 3, 228, 2, 3, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 279, 2, 2, 2, 159, 2, 163, 2, 167, 168,
+    2, 2, 176, 2, 179, 180, 2, 3, 183, 2, 3, 187, 188, 2, 192, 2,
+    2, 2, 3, 2, 3, 2, 3, 212, 2, 215, 216, 2, 2, 3, 223, 224,
+    2, 228, 2, 3, 2, 236, 2, 2, 2, 2, 2, 2, 2, 3, 263, 264,
+    2, 2, 2, 2, 279, 280, 2, 2, 2, 159, 2, 2, 167, 2, 2, 175,
+    2, 179, 180, 2, 2, 2, 2, 2, 199, 200, 2, 203, 2, 207, 208, 2,
+    211, 212, 2, 215, 216, 2, 2, 2, 228, 2, 231, 232, 2, 235, 236, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 280, 2, 2, 2, 2, 3,
+    2, 3, 167, 2, 2, 176, 2, 2, 2, 2, 2, 2, 199, 2, 2, 208,
+    2, 2, 215, 2, 2, 224, 2, 228, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 82, 83, 2, 159, 160, 2, 163, 164, 166,
+    2, 3, 167, 168, 2, 3, 171, 2, 3, 175, 176, 2, 179, 2, 2, 2,
+    2, 195, 2, 3, 2, 3, 206, 2, 3, 208, 2, 3, 211, 212, 2, 215,
+    2, 2, 3, 223, 224, 2, 228, 2, 2, 235, 236, 2, 2, 2, 2, 251,
+    2, 2, 2, 3, 263, 264, 2, 2, 2, 2, 279, 2, 2, 2, 159, 2,
+    2, 2, 171, 2, 2, 179, 180, 2, 2, 2, 2, 195, 196, 2, 2, 2,
+    2, 2, 215, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 280, 2, 2, 2, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    180, 2, 2, 3, 2, 2, 2, 3, 199, 2, 3, 204, 2, 3, 207, 208,
+    2, 3, 212, 2, 216, 2, 3, 2, 3, 2, 3, 228, 2, 3, 232, 2,
+    235, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 255, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 159, 2, 2, 3, 167, 2, 2, 2, 2, 2, 2,
+    192, 2, 2, 3, 2, 3, 204, 2, 2, 2, 215, 216, 2, 2, 3, 223,
+    2, 3, 227, 228, 2, 3, 232, 2, 2, 2, 3, 2, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 3, 2, 3, 2,
+    2, 2, 2, 2, 2, 3, 2, 3, 204, 2, 3, 208, 2, 3, 2, 2,
+    3, 2, 2, 3, 2, 3, 2, 2, 2, 243, 2, 2, 2, 2, 2, 3,
+    263, 264, 2, 2, 2, 2, 2, 2, 82, 2, 159, 2, 3, 163, 164, 2,
+    2, 3, 2, 2, 180, 2, 3, 2, 2, 2, 2, 3, 199, 2, 3, 204,
+    2, 3, 2, 3, 211, 2, 215, 2, 3, 2, 3, 224, 2, 3, 228, 2,
+    3, 2, 2, 3, 2, 3, 2, 2, 2, 3, 2, 259, 2, 2, 2, 2,
+    2, 279, 2, 2, 2, 159, 160, 2, 2, 3, 2, 3, 171, 172, 2, 3,
+    175, 176, 2, 179, 180, 2, 3, 2, 3, 2, 2, 2, 3, 200, 2, 2,
+    3, 2, 3, 212, 2, 215, 2, 2, 3, 2, 3, 227, 228, 2, 3, 231,
+    232, 2, 2, 3, 2, 3, 2, 3, 248, 2, 3, 2, 3, 2, 2, 3,
+    263, 264, 2, 2, 2, 2, 280, 2, 2, 2, 159, 160, 162, 2, 163, 164,
+    2, 167, 168, 2, 174, 2, 175, 176, 2, 179, 180, 2, 2, 187, 2, 2,
+    2, 200, 2, 2, 2, 211, 2, 215, 216, 2, 219, 220, 2, 223, 2, 227,
+    228, 2, 2, 235, 236, 2, 2, 243, 2, 2, 251, 2, 2, 2, 2, 2,
+    2, 2, 279, 280, 2, 2, 2, 159, 160, 2, 2, 2, 2, 3, 2, 179,
+    180, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 215, 216, 2, 2, 3,
+    223, 224, 2, 3, 227, 228, 2, 3, 232, 2, 2, 3, 2, 2, 3, 2,
+    2, 2, 2, 2, 2, 2, 2, 279, 2, 2, 2, 159, 2, 3, 2, 3,
+    167, 168, 2, 3, 2, 3, 175, 176, 2, 179, 2, 3, 2, 3, 187, 188,
+    2, 2, 2, 3, 200, 2, 3, 204, 2, 3, 207, 2, 3, 212, 2, 215,
+    2, 3, 2, 3, 2, 3, 228, 2, 3, 231, 232, 2, 235, 2, 3, 2,
+    3, 2, 3, 248, 2, 3, 2, 3, 2, 3, 260, 2, 3, 263, 264, 2,
+    2, 2, 2, 2, 2, 2, 159, 2, 2, 167, 2, 2, 175, 176, 2, 180,
+    2, 2, 2, 2, 2, 3, 199, 200, 2, 3, 204, 2, 3, 2, 3, 2,
+    216, 2, 3, 219, 220, 2, 2, 3, 228, 2, 3, 231, 232, 2, 235, 2,
+    239, 2, 243, 244, 2, 248, 2, 2, 256, 2, 2, 3, 263, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 3, 168, 2, 2, 2, 179, 180, 2, 2, 188,
+    2, 2, 2, 199, 2, 3, 204, 2, 3, 208, 2, 2, 216, 2, 2, 3,
+    223, 2, 3, 227, 228, 2, 3, 232, 2, 236, 2, 2, 2, 3, 2, 3,
+    2, 255, 2, 2, 3, 263, 264, 2, 2, 2, 2, 2, 2, 2, 2, 163,
+    166, 2, 167, 2, 171, 2, 2, 2, 2, 187, 2, 2, 2, 199, 200, 2,
+    204, 206, 2, 207, 208, 2, 2, 2, 219, 220, 2, 223, 224, 2, 227, 228,
+    2, 231, 232, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 271, 2, 2,
+    279, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 2, 2, 216, 2, 2, 3, 2, 227, 228, 2, 3, 232, 2, 2, 3,
+    2, 2, 2, 2, 256, 2, 2, 3, 2, 2, 2, 2, 279, 2, 2, 2,
+    2, 2, 3, 167, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+    3, 2, 215, 216, 2, 2, 3, 2, 228, 2, 3, 231, 2, 2, 2, 2,
+    2, 2, 3, 2, 2, 2, 2, 2, 2, 279, 2, 2, 2, 159, 2, 2,
+    2, 2, 2, 179, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    228, 2, 231, 2, 235, 2, 2, 2, 2, 2, 255, 2, 2, 3, 263, 2,
+    2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 3, 2, 3, 2, 216, 2, 2, 2, 2, 3, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 159, 2, 2, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 199, 200, 2, 204, 2, 3, 2, 3,
+    211, 2, 2, 2, 2, 228, 2, 3, 231, 232, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 228, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 159, 2, 2,
+    2, 2, 175, 2, 179, 2, 2, 187, 2, 2, 2, 200, 2, 2, 2, 2,
+    2, 2, 224, 2, 227, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 280, 2, 2, 2, 2, 2, 168, 2, 171, 2, 175, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 219, 220, 2, 223, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 159, 2, 2,
+    2, 2, 2, 180, 2, 2, 187, 2, 2, 196, 2, 2, 203, 204, 2, 207,
+    2, 212, 2, 215, 2, 2, 2, 227, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 280, 2, 2, 2, 2, 2, 2, 2, 2, 2, 183,
+    2, 187, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 228, 2, 2, 2,
+    2, 243, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 224, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2938,
+    2950, 162, 166, 187, 3006, 3017, 218, 3028, 3034, 255, 3056, 3145, 3146, 3274, 3275, 3279,
+    3289, 3302, 227, 3318, 255, 3338, 200, 3601, 3605, 3606, 208, 3743, 3744, 3755, 3756, 3760,
+    3783, 3823, 3878, 218, 3891, 3892, 3906, 4004, 180, 572, 611, 652, 656, 668, 677, 688,
+    711, 714, 758, 760, 809, 894, 929, 930, 933, 950, 971, 980, 1014, 1049, 1063, 1069,
+    1073, 1082, 1087, 1096, 1100, 1119, 1130, 1134, 1164, 1165, 1195, 1221, 1222, 1236, 1286, 1300,
+    1609, 276, 571, 578, 579, 585, 747, 749, 750, 891, 945, 953, 959, 971, 1051, 1064,
+    1077, 1116, 1121, 1124, 1135, 1146, 1168, 1176, 1346, 1593, 1606, 271, 579, 581, 611, 614,
+    643, 706, 720, 722, 732, 751, 756, 782, 835, 852, 856, 862, 871, 874, 922, 945,
+    959, 971, 979, 1052, 1059, 1065, 1077, 1087, 1093, 1096, 1098, 1116, 1130, 1168, 1176, 1177,
+    1200, 1214, 1222, 1346, 1596, 751, 753, 754, 758, 945, 953, 959, 964, 971, 973, 1014,
+    1022, 1028, 1033, 1060, 1065, 1068, 1116, 1121, 1130, 1135, 1146, 1168, 1176, 1596, 1607, 581,
+    603, 646, 652, 668, 734, 750, 756, 768, 779, 814, 835, 860, 1044, 1050, 1055, 1057,
+    1058, 1062, 1064, 1067, 1079, 1116, 1130, 1135, 1144, 1146, 1168, 1176, 1235, 1466, 1473, 1474,
+    1478, 1592, 1601, 1606, 1621, 570, 572, 578, 646, 648, 720, 752, 757, 760, 925, 928,
+    950, 994, 996, 1010, 1014, 1019, 1040, 1049, 1051, 1055, 1058, 1063, 1065, 1069, 1070, 1073,
+    1168, 1184, 1214, 1219, 1221, 1235, 1609, 638, 732, 925, 1010, 1061, 1146, 1176, 271, 272,
+    275, 570, 577, 578, 580, 581, 582, 583, 587, 595, 596, 599, 603, 619, 622, 637,
+    638, 643, 646, 652, 657, 668, 686, 706, 708, 719, 720, 732, 736, 750, 891, 979,
+    1010, 1014, 1022, 1040, 1044, 1058, 1062, 1130, 1143, 1146, 1176, 1222, 1234, 1359, 1457, 1466,
+    1473, 1474, 1594, 1604, 570, 686, 752, 757, 890, 895, 1058, 1609, 757, 922, 971, 980,
+    985, 988, 994, 997, 999, 1010, 1031, 1065, 1168, 1176, 1201, 1219, 1399, 1402, 575, 581,
+    583, 638, 652, 874, 971, 1060, 1061, 1064, 1067, 1116, 1165, 1168, 1176, 1200, 971, 972,
+    973, 974, 997, 1288, 1457, 1458, 1459, 1460, 1462, 1463, 1465, 1466, 1468, 1469, 1471, 1472,
+    1473, 1474, 1476, 1477, 1478, 1479, 1480, 1481, 271, 272, 581, 614, 619, 758, 924, 971,
+    1028, 1058, 1061, 1146, 1168, 1176, 1427, 1598, 1605, 1606, 569, 570, 572, 575, 577, 580,
+    582, 583, 587, 596, 599, 683, 688, 689, 712, 713, 721, 722, 740, 742, 744, 747,
+    754, 755, 759, 767, 768, 771, 928, 929, 1042, 1058, 1060, 1160, 1168, 1176, 1184, 1194,
+    1200, 1201, 1210, 1346, 1457, 1459, 1463, 1465, 1466, 1467, 1468, 1473, 1474, 1477, 1478, 1479,
+    1480, 1610, 1620, 570, 572, 578, 581, 586, 602, 605, 608, 611, 614, 615, 617, 622,
+    633, 646, 648, 668, 706, 734, 750, 752, 757, 760, 809, 810, 927, 1014, 1028, 1049,
+    1052, 1058, 1063, 1065, 1070, 1071, 1087, 1093, 1100, 1101, 1120, 1121, 1164, 1178, 1221, 1222,
+    1228, 1235, 1300, 1362, 1599, 1609, 579, 581, 584, 744, 756, 1049, 1050, 1052, 1054, 1055,
+    1059, 1060, 1062, 1064, 1065, 1067, 1071, 1072, 1076, 1079, 1121, 1124, 1130, 1146, 1160, 1164,
+    1165, 1168, 1169, 1176, 1200, 1594, 1596, 1601, 572, 577, 638, 668, 708, 712, 732, 740,
+    822, 835, 928, 929, 971, 994, 1031, 1040, 1055, 1166, 1168, 1176, 1186, 1200, 1210, 1228,
+    1346, 1439, 1466, 1478, 580, 581, 652, 721, 722, 756, 771, 919, 922, 925, 927, 941,
+    971, 1064, 1070, 1082, 1087, 1090, 1092, 1093, 1096, 1097, 1098, 1099, 1100, 1103, 1105, 1112,
+    1176, 1184, 1186, 1189, 1192, 1193, 1194, 1196, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1206,
+    1210, 1212, 1214, 1230, 1233, 1257, 1294, 1300, 1316, 1346, 1406, 1457, 1460, 1466, 1468, 656,
+    754, 761, 827, 911, 924, 971, 996, 1064, 1116, 1160, 1165, 1168, 1176, 1211, 1212, 1234,
+    1398, 1457, 1468, 1473, 617, 637, 638, 672, 812, 922, 925, 927, 972, 979, 988, 1010,
+    1087, 1098, 1116, 1117, 1130, 1144, 1165, 1168, 1169, 1186, 1200, 1526, 1594, 1064, 1165, 1168,
+    1176, 1210, 1406, 1599, 652, 1058, 1064, 1168, 1176, 1198, 1604, 581, 753, 1168, 1186, 1228,
+    1398, 1466, 1064, 583, 925, 941, 971, 1025, 1176, 1184, 1186, 1194, 1201, 1203, 1176, 570,
+    711, 752, 817, 941, 1135, 1160, 1164, 1609, 654, 677, 714, 719, 1090, 1112, 1121, 572,
+    758, 823, 895, 950, 972, 994, 1032, 1034, 1044, 1058, 1061, 1163, 1609, 778, 813, 1168,
+    1286, 1135, 4630, 975, 813, 845, 855, 1103, 4685, 1398, 4692, 4733, 4740, 4801, 4804, 4811,
+    713, 1160, 1168, 1398, 4851, 928, 4935, 4939, 4943, 4945, 4948, 996, 754, 5050, 5052, 5057,
+    1061, 5065, 5067, 5077, 5078, 5096, 5116, 5127, 5133, 5135, 1297, 996, 756, 176, 192, 3024,
+    231, 3056, 3068, 3091, 3124, 3134, 3210, 239, 3275, 227, 231, 3478, 236, 247, 180, 3536,
+    160, 3605, 3606, 3679, 3706, 3707, 3719, 259, 3736, 3743, 3756, 231, 172, 3823, 3833, 3834,
+    3888, 3891, 203, 3988, 175, 176, 4017, 159, 4099, 228, 1576, 2876, 199, 2889, 2891, 2892,
+    2907, 187, 188, 196, 3192, 3412, 159, 191, 192, 215, 216, 3535, 171, 3709, 224, 275,
+    3787, 160, 180, 191, 192, 3836, 279, 3898, 3899, 3900, 3916, 4157, 163, 1531, 2892, 212,
+    191, 2949, 2997, 3114, 3145, 3149, 3165, 204, 224, 191, 3331, 3355, 3356, 211, 235, 236,
+    271, 272, 203, 159, 160, 215, 3535, 3544, 3686, 204, 3711, 3712, 275, 3743, 203, 3756,
+    3760, 3787, 3823, 3899, 3900, 3915, 3916, 267, 224, 279, 175, 4157, 175, 176, 204, 3200,
+    3211, 159, 191, 215, 235, 236, 3535, 271, 3605, 191, 3637, 236, 207, 3711, 239, 3787,
+    160, 180, 3823, 216, 3836, 279, 280, 3899, 3915, 176, 219, 2930, 2931, 3006, 3024, 3056,
+    280, 3193, 223, 271, 179, 3292, 3331, 227, 228, 279, 166, 3693, 195, 199, 3704, 3709,
+    3715, 283, 284, 3787, 3823, 3836, 271, 279, 3899, 3916, 4015, 228, 4429, 195, 4441, 4451,
+    275, 2873, 176, 2889, 3006, 3012, 3145, 3198, 3208, 239, 3466, 3474, 3475, 179, 216, 3579,
+    3601, 3605, 3620, 3664, 3679, 171, 3693, 199, 3706, 3711, 3719, 248, 259, 3899, 159, 279,
+    3983, 3988, 4015, 228, 2984, 3165, 3466, 280, 3701, 280, 3915, 1526, 1541, 1562, 166, 2873,
+    195, 2889, 206, 2896, 2899, 2902, 2912, 268, 271, 283, 284, 2930, 2960, 235, 236, 2982,
+    2984, 2997, 2998, 3007, 3024, 3039, 236, 280, 3086, 160, 3, 3142, 3145, 3146, 3165, 3172,
+    3192, 215, 3544, 3601, 280, 3605, 3606, 191, 3663, 279, 199, 3697, 3823, 267, 279, 3915,
+    175, 4011, 179, 3, 3, 166, 206, 2873, 3087, 3198, 3208, 3410, 231, 199, 228, 3208,
+    3461, 3535, 179, 192, 3574, 3581, 3, 236, 280, 3642, 3711, 3898, 3899, 3900, 3915, 3916,
+    3954, 3983, 215, 2884, 2896, 2901, 160, 3024, 283, 3535, 208, 212, 3709, 3716, 3787, 3898,
+    3915, 3916, 3951, 3535, 3581, 4082, 3, 3, 3, 3, 176, 3, 3, 3, 3, 3,
+    3, 228, 3, 232, 3, 3, 3, 3, 3, 3, 1534, 1542, 2896, 2950, 2959, 3210,
+    211, 212, 3535, 3637, 3697, 3701, 280, 3899, 3915, 3916, 179, 183, 184, 211, 2871, 166,
+    2874, 174, 2879, 176, 2884, 195, 2887, 206, 2899, 2901, 2902, 2912, 271, 283, 284, 3076,
+    3078, 3090, 3094, 3127, 3130, 3, 3149, 3177, 168, 3183, 187, 3203, 3204, 219, 3213, 3214,
+    267, 271, 272, 284, 3473, 3477, 199, 206, 3877, 3898, 3899, 3900, 3916, 159, 3, 3951,
+    3956, 3972, 4157, 3, 3, 3, 228, 232, 271, 2873, 176, 199, 2889, 2896, 2909, 2928,
+    166, 180, 192, 2949, 206, 2955, 2956, 235, 2979, 280, 3006, 3012, 3056, 3114, 271, 3192,
+    3198, 3208, 239, 3274, 3278, 3471, 3606, 216, 3676, 3678, 3679, 3686, 199, 3697, 3706, 3711,
+    248, 3722, 3744, 203, 231, 236, 3798, 3801, 215, 271, 3988, 175, 3997, 4015, 4098, 4099,
+    192, 4438, 228, 2891, 2896, 2904, 176, 223, 3678, 166, 3682, 3686, 3687, 183, 3693, 204,
+    206, 3704, 224, 3712, 3716, 3722, 256, 271, 272, 283, 3801, 191, 192, 3823, 216, 3878,
+    215, 3899, 3902, 3915, 3916, 3951, 167, 168, 175, 176, 195, 176, 195, 2984, 160, 280,
+    3, 3127, 3165, 3177, 3307, 3331, 3473, 3477, 3535, 3536, 216, 3642, 3644, 3663, 186, 3693,
+    188, 3, 3898, 3899, 3900, 3915, 3916, 3926, 3951, 3972, 3997, 4157, 4266, 2894, 2896, 3024,
+    3, 3150, 224, 283, 191, 203, 3466, 3467, 3471, 279, 3535, 224, 248, 3735, 3743, 3744,
+    191, 203, 3755, 3756, 3760, 3783, 280, 3916, 159, 160, 3926, 167, 3931, 3932, 191, 192,
+    3, 3944, 215, 3948, 3951, 3952, 224, 3956, 235, 3972, 271, 279, 280, 4001, 4008, 180,
+    191, 4098, 4121, 4157, 3, 3, 199, 200, 3, 3036, 3203, 3204, 243, 3, 3445, 211,
+    3535, 3578, 3709, 3787, 3899, 3916, 4011, 207, 208, 228, 2956, 2982, 2984, 159, 3286, 203,
+    3466, 3471, 224, 267, 3544, 192, 3601, 3744, 3760, 3787, 163, 216, 271, 3892, 3899, 3902,
+    167, 3952, 166, 224, 3899, 3916, 3972, 188, 3024, 199, 3709, 3916, 208, 2896, 3201, 3926,
+    3998, 3, 3709, 2902, 3466, 279, 280, 3535, 3, 3915, 159, 3926, 3956, 3961, 3915, 2873,
+    3125, 3198, 191, 280, 236, 3879, 3888, 228, 3031, 3069, 191, 192, 280, 3801, 176, 3210,
+    216, 231, 180, 268, 3574, 3647, 239, 3670, 3697, 3701, 212, 228, 175, 159, 160, 3836,
+    186, 5377, 5378, 280, 168, 208, 174, 5452, 5453, 3682, 5505, 5567, 2874, 208, 5577, 5578,
+    208, 5712, 208, 5722, 5725, 3579, 3203, 5831, 5834, 208, 3701, 5851, 174, 5864, 5865, 5886,
+    5887, 5888, 5925, 223, 3579, 223, 722, 871, 1079, 1198, 1592, 4694, 4711, 4725, 861, 1192,
+    1257, 584, 1151, 1192, 1203, 1234, 1235, 1325, 1328, 756, 4900, 586, 4939, 579, 586, 619,
+    1090, 1112, 1286, 5042, 1422, 5048, 751, 5060, 1189, 691, 1060, 1184, 5100, 1188, 1194, 1196,
+    1198, 1199, 5101, 1203, 1204, 1205, 1206, 5122, 5124, 950, 686, 706, 736, 1189, 579, 1079,
+    1168, 232, 4590, 911, 4598, 4601, 4602, 1150, 1155, 809, 811, 814, 828, 839, 894, 4766,
+    1064, 574, 849, 850, 860, 1058, 1070, 676, 1124, 1134, 1561, 1565, 1568, 1573, 581, 586,
+    757, 850, 861, 1222, 1596, 5138, 5146, 5165, 614, 4602, 1032, 845, 4634, 744, 579, 4733,
+    971, 1137, 845, 881, 889, 4857, 1014, 1222, 1241, 1526, 1541, 945, 572, 585, 592, 1050,
+    720, 971, 1160, 1168, 1560, 1571, 742, 953, 5059, 1116, 575, 1052, 1054, 5138, 5152, 5165,
+    1494, 1135, 1603, 706, 708, 711, 713, 720, 725, 975, 4772, 1210, 572, 844, 856, 1049,
+    1225, 1242, 1528, 1537, 581, 854, 1055, 1241, 985, 1165, 1264, 570, 5080, 5081, 580, 581,
+    586, 588, 592, 595, 597, 757, 762, 1049, 1054, 5096, 1060, 1065, 1220, 1231, 1233, 1594,
+    1610, 1616, 5138, 722, 1087, 570, 4628, 581, 586, 597, 846, 1069, 1075, 4678, 1601, 1608,
+    1615, 927, 1122, 1534, 753, 752, 1151, 1153, 1160, 1161, 1165, 1168, 1170, 1607, 637, 811,
+    889, 923, 1064, 1130, 5040, 1230, 1630, 1632, 1638, 1643, 1647, 574, 1060, 1224, 5103, 1539,
+    1593, 1604, 5138, 5165, 1180, 1176, 579, 881, 889, 5266, 1051, 1560, 638, 722, 4598, 845,
+    911, 4733, 4771, 4784, 1257, 1059, 4886, 1160, 4890, 4891, 1172, 743, 750, 752, 1070, 4931,
+    1595, 4939, 756, 1470, 619, 5007, 686, 823, 919, 1082, 1090, 5031, 1152, 1286, 5042, 1350,
+    1422, 5137, 5139, 583, 1606, 5188, 686, 5207, 1168, 570, 4885, 1610, 5021, 1610, 4372, 4396,
+    637, 640, 889, 890, 4598, 979, 4604, 1064, 1105, 1241, 1514, 1526, 1535, 1630, 1632, 1633,
+    1637, 1638, 1647, 4626, 4628, 1130, 1220, 1236, 4651, 574, 4653, 744, 4661, 757, 860, 866,
+    868, 1064, 1228, 1241, 1610, 1052, 586, 4733, 4738, 4754, 4766, 1060, 4936, 1616, 4939, 4942,
+    578, 579, 581, 586, 589, 591, 595, 597, 849, 1604, 911, 916, 919, 930, 941, 5096,
+    1492, 1594, 1603, 1605, 706, 5204, 755, 637, 979, 638, 1079, 4771, 4784, 1042, 1192, 919,
+    1168, 4784, 753, 868, 1050, 1236, 1610, 1152, 5138, 5146, 5165, 5188, 1050, 4596, 4604, 4610,
+    584, 1079, 1628, 999, 1032, 1036, 1130, 1234, 581, 5165, 723, 1168, 1176, 1200, 4363, 4604,
+    4637, 1189, 1019, 1033, 1044, 1054, 5020, 5021, 1610, 5138, 5165, 753, 774, 793, 1019, 614,
+    637, 654, 661, 706, 707, 713, 725, 736, 811, 877, 882, 889, 890, 891, 4597, 896,
+    905, 907, 979, 1064, 1093, 4611, 1112, 1241, 1526, 1628, 1632, 1633, 1637, 1638, 1643, 1647,
+    4701, 569, 656, 668, 707, 4762, 811, 4778, 1059, 1060, 1061, 4779, 1068, 1096, 1228, 1241,
+    1503, 1534, 1540, 1541, 1643, 911, 979, 5138, 5146, 5165, 581, 5179, 1176, 1200, 1534, 638,
+    722, 911, 4598, 4604, 1198, 275, 637, 756, 859, 4634, 949, 979, 1057, 4639, 1230, 1594,
+    1596, 1601, 1614, 845, 911, 4692, 579, 1527, 4766, 4771, 4784, 1257, 4801, 4813, 1121, 4948,
+    1079, 5005, 619, 5008, 711, 714, 919, 929, 1082, 1090, 5031, 1152, 1350, 5043, 5050, 945,
+    1192, 1235, 1242, 1243, 714, 753, 1049, 1530, 686, 706, 5194, 5207, 5208, 1059, 5222, 1071,
+    860, 868, 5265, 1168, 4601, 1019, 1028, 1121, 725, 1121, 5002, 5004, 637, 656, 661, 708,
+    722, 787, 5018, 5019, 975, 979, 1064, 1134, 1168, 1234, 1367, 1406, 1526, 1541, 1630, 1633,
+    749, 845, 852, 855, 856, 857, 862, 874, 1049, 1053, 1057, 1060, 1063, 1065, 1068, 1076,
+    1079, 5117, 1050, 1061, 5138, 1220, 5165, 638, 643, 652, 657, 668, 708, 720, 725, 736,
+    889, 736, 879, 570, 586, 1610, 581, 4905, 1079, 4972, 808, 811, 812, 813, 818, 820,
+    821, 823, 828, 832, 839, 5138, 5152, 5165, 5194, 5246, 994, 1024, 4678, 1131, 1138, 1630,
+    847, 945, 950, 953, 959, 1058, 1063, 4887, 1071, 1124, 1603, 1607, 1134, 1350, 572, 750,
+    5050, 762, 856, 945, 5052, 5054, 5059, 5060, 1116, 5067, 5068, 5077, 1610, 1616, 5165, 569,
+    570, 572, 575, 577, 579, 581, 584, 586, 591, 597, 652, 755, 756, 846, 849, 860,
+    861, 1050, 1057, 5175, 1065, 1075, 1076, 5176, 1124, 1130, 1135, 1142, 1146, 5180, 1233, 1527,
+    1593, 1601, 1603, 1608, 5197, 5200, 756, 854, 1050, 1596, 913, 921, 928, 929, 1052, 1059,
+    4780, 1288, 4879, 1019, 1119, 581, 5138, 5165, 1126, 980, 1008, 1176, 1079, 571, 574, 570,
+    4822, 945, 4885, 4889, 1121, 1135, 1146, 1491, 861, 1603, 5050, 1116, 575, 603, 1071, 1528,
+    5135, 5137, 5145, 1220, 652, 1130, 637, 1133, 5138, 5165, 839, 4678, 919, 1128, 5165, 1010,
+    4604, 1032, 5195, 1129, 1112, 1052, 1059, 1596, 1603, 1608, 569, 579, 5180, 1241, 638, 4726,
+    4771, 853, 1609, 1235, 5118, 1079, 1168, 4683, 756, 856, 860, 1609, 749, 722, 1192, 1066,
+    1192, 758, 1507, 1050, 1189, 1266, 1614, 929, 5021, 1033, 1168, 712, 570, 586, 1231, 6170,
+    6171, 823, 825, 6172, 1614, 661, 996, 706, 6245, 6247, 6248, 736, 661, 1628, 1637, 650,
+    661, 996, 1636, 1648, 1649, 996, 6530, 996, 6550, 1630, 4931, 1060, 6665, 6670, 996, 5021,
+    6689, 6691, 711, 714, 6717, 6718, 6719, 5018, 814, 6736, 6740, 6779, 1121, 1124, 1135, 4931,
+    1121, 3150, 271, 283, 3948, 3201, 5473, 3192, 231, 191, 179, 2905, 163, 191, 235, 4011,
+    4015, 4131, 191, 223, 164, 2909, 5712, 2892, 2909, 2960, 192, 3783, 5823, 159, 5829, 204,
+    5843, 3932, 235, 207, 160, 167, 175, 3939, 207, 3945, 215, 220, 3952, 3961, 239, 244,
+    247, 5916, 5918, 180, 3086, 160, 3172, 3931, 2892, 283, 3899, 1210, 3069, 3445, 5338, 5342,
+    5343, 3862, 179, 3274, 3283, 3292, 3321, 3338, 227, 5530, 3709, 227, 199, 248, 175, 192,
+    3833, 3834, 4394, 187, 199, 4408, 4409, 2896, 2909, 3208, 187, 231, 175, 5930, 5940, 5957,
+    2950, 5343, 3648, 5382, 3183, 3681, 3537, 243, 167, 3605, 175, 4372, 159, 2907, 256, 3145,
+    3146, 3537, 3878, 3899, 167, 211, 3180, 191, 5842, 3787, 2884, 3686, 183, 5930, 5945, 5957,
+    236, 160, 166, 3124, 3131, 3145, 3157, 279, 5537, 3973, 251, 179, 3892, 207, 2909, 239,
+    248, 207, 3711, 3986, 212, 5930, 3150, 3744, 3719, 252, 3471, 183, 184, 3201, 163, 171,
+    3878, 3879, 203, 3891, 3892, 3899, 3900, 240, 220, 81, 83, 3282, 3283, 207, 3823, 4492,
+    4447, 5930, 5957, 279, 3915, 2891, 3406, 171, 4392, 160, 3150, 168, 3445, 3682, 280, 5549,
+    179, 203, 3701, 171, 3193, 3197, 248, 279, 172, 5712, 223, 215, 2960, 236, 3086, 216,
+    3456, 3735, 192, 5811, 168, 5823, 279, 159, 5928, 5933, 2955, 3086, 3900, 3899, 207, 232,
+    3605, 232, 5254, 5259, 81, 2982, 83, 168, 3410, 3544, 5345, 251, 203, 5371, 5374, 3823,
+    216, 5405, 3208, 228, 224, 3681, 5503, 5517, 5518, 5530, 5717, 5718, 2915, 5888, 160, 5995,
+    81, 2982, 83, 3544, 160, 283, 280, 5549, 3456, 3899, 5549, 3200, 3682, 4018, 232, 168,
+    5930, 5940, 5957, 2955, 5336, 5345, 5353, 2905, 283, 167, 235, 3648, 247, 216, 4011, 2896,
+    3, 3899, 3915, 3916, 3951, 935, 5345, 5387, 3931, 5797, 3605, 232, 5930, 5957, 159, 236,
+    3619, 2949, 81, 2982, 224, 251, 252, 3114, 3116, 3131, 3157, 3173, 159, 3392, 3406, 3410,
+    215, 3412, 5337, 3424, 271, 272, 280, 3544, 203, 5354, 3783, 168, 5462, 2871, 231, 3056,
+    3116, 3146, 3282, 5543, 203, 204, 207, 3701, 5544, 240, 3755, 223, 4372, 4492, 160, 3544,
+    5930, 5940, 5957, 5958, 2896, 5972, 3915, 3952, 160, 3150, 160, 5345, 215, 1562, 1568, 2982,
+    223, 223, 5382, 175, 3544, 195, 5389, 4003, 166, 176, 195, 4441, 168, 3445, 2892, 280,
+    5549, 179, 2874, 5580, 3801, 5725, 283, 2960, 5784, 3125, 191, 3456, 231, 3735, 192, 5811,
+    168, 279, 5824, 5831, 160, 191, 4015, 255, 259, 191, 3200, 183, 3086, 160, 5984, 3900,
+    5999, 203, 6010, 227, 3311, 3899, 179, 3620, 216, 180, 3157, 3801, 180, 5777, 5779, 81,
+    2982, 83, 231, 251, 252, 3118, 3150, 212, 3275, 3277, 279, 280, 3544, 3833, 3834, 3899,
+    3900, 4011, 211, 212, 4232, 4372, 4481, 196, 166, 3355, 3356, 206, 212, 216, 236, 3678,
+    3689, 195, 207, 3706, 3712, 239, 240, 272, 5910, 5930, 2984, 2997, 3023, 3024, 3039, 280,
+    166, 3145, 3146, 3157, 3172, 3172, 167, 2909, 232, 2896, 5675, 283, 5753, 3271, 3272, 3282,
+    3286, 172, 3289, 3290, 3297, 203, 3305, 216, 3321, 3322, 3327, 3338, 5930, 5945, 5957, 3467,
+    6030, 216, 3629, 5436, 276, 3825, 247, 159, 192, 5660, 191, 4445, 219, 3833, 279, 3193,
+    5831, 247, 248, 159, 160, 5834, 5837, 5842, 5843, 3787, 5852, 5853, 5862, 232, 164, 195,
+    2904, 232, 3024, 223, 224, 227, 232, 3681, 5970, 224, 3711, 3712, 271, 5971, 160, 191,
+    3823, 216, 3836, 3852, 279, 280, 4445, 5988, 5991, 168, 3686, 203, 5545, 168, 3619, 171,
+    212, 5930, 5957, 199, 160, 271, 3915, 283, 5592, 159, 207, 5662, 3801, 3836, 279, 163,
+    5831, 3787, 2884, 2930, 3722, 4354, 5926, 5928, 220, 3986, 3024, 3823, 81, 83, 3830, 5930,
+    3338, 5436, 3456, 3818, 3601, 5345, 3648, 5985, 211, 280, 175, 2891, 160, 5490, 280, 5912,
+    283, 3899, 160, 223, 227, 4455, 3150, 191, 231, 3210, 228, 3682, 3931, 3932, 4051, 248,
+    231, 3605, 235, 3899, 212, 7044, 3, 3311, 216, 3315, 247, 248, 3125, 7109, 235, 3172,
+    204, 208, 7306, 3, 7403, 3605, 168, 208, 7478, 3801, 1121, 1534, 1630, 5175, 1032, 6277,
+    913, 1192, 854, 750, 4615, 608, 845, 1218, 5202, 5207, 755, 850, 1119, 633, 1198, 6530,
+    975, 1198, 4641, 860, 1602, 1066, 572, 1116, 973, 6680, 763, 1230, 980, 588, 645, 711,
+    5171, 980, 985, 1010, 1049, 1052, 1055, 1112, 1124, 1235, 1252, 1316, 1325, 6765, 6767, 758,
+    1052, 584, 4755, 750, 975, 1630, 5144, 756, 4879, 1189, 758, 4909, 5109, 753, 4801, 572,
+    4821, 752, 1221, 1233, 1596, 4851, 1151, 6358, 1129, 1160, 926, 1350, 706, 860, 1196, 1198,
+    1199, 5101, 1214, 686, 809, 813, 925, 1096, 1098, 1018, 1192, 4784, 819, 1184, 712, 975,
+    4903, 4976, 571, 711, 645, 652, 4913, 1299, 638, 4942, 714, 1163, 572, 1163, 1406, 4734,
+    1065, 4913, 5117, 5137, 652, 1014, 651, 845, 1144, 570, 820, 717, 774, 1236, 1241, 584,
+    637, 753, 754, 822, 1049, 1060, 1241, 1606, 581, 5186, 1364, 754, 5130, 1101, 985, 1192,
+    1266, 1346, 980, 1162, 5190, 1032, 4742, 5050, 1286, 1384, 1121, 774, 775, 776, 778, 781,
+    784, 787, 790, 791, 1032, 603, 672, 913, 5117, 5118, 930, 959, 5123, 5124, 5127, 5128,
+    5130, 1101, 5140, 5146, 1271, 1098, 4819, 4821, 985, 1051, 5279, 980, 1604, 959, 4863, 677,
+    668, 584, 1121, 661, 4878, 661, 1609, 6386, 750, 959, 5022, 672, 929, 985, 1350, 1601,
+    688, 6530, 1119, 1058, 4641, 1234, 1059, 1064, 860, 5046, 860, 6639, 668, 1066, 1605, 572,
+    578, 758, 4638, 1052, 5146, 5144, 980, 1210, 4939, 1210, 668, 1042, 6125, 1354, 959, 672,
+    945, 1057, 1075, 1077, 4784, 1176, 1135, 644, 6323, 890, 894, 6358, 881, 895, 4623, 6738,
+    584, 6862, 584, 1630, 1609, 6386, 860, 5144, 6386, 1027, 5011, 1210, 1210, 668, 4638, 589,
+    6125, 6134, 4615, 1630, 643, 1231, 4976, 1325, 1079, 5204, 1026, 5138, 5165, 6125, 5168, 1124,
+    4939, 1210, 570, 581, 1235, 750, 753, 4635, 1144, 1354, 1359, 1384, 570, 4720, 811, 1234,
+    1609, 578, 760, 4863, 1042, 1049, 1051, 1063, 4871, 1069, 1165, 4875, 1534, 1541, 1609, 953,
+    5061, 5077, 655, 662, 4586, 1198, 4692, 4720, 4739, 4740, 4816, 4818, 922, 925, 945, 959,
+    975, 980, 5021, 6377, 1282, 5052, 1130, 1163, 5279, 587, 920, 4604, 6838, 5176, 584, 1121,
+    590, 6125, 1060, 4396, 200, 1121, 1116, 572, 711, 889, 1130, 994, 637, 722, 881, 889,
+    890, 5266, 661, 4878, 4602, 1609, 6386, 750, 661, 6421, 752, 1630, 1630, 4641, 1130, 1595,
+    4726, 856, 860, 1184, 5046, 860, 6639, 668, 1605, 6656, 6657, 1116, 586, 855, 5207, 1393,
+    1427, 856, 1018, 787, 1052, 584, 6850, 5146, 1231, 959, 1130, 1163, 1059, 5144, 754, 757,
+    1066, 757, 1241, 742, 743, 744, 749, 752, 754, 755, 759, 771, 6599, 4635, 1198, 1354,
+    1359, 1384, 4722, 4741, 4742, 1044, 4808, 4812, 1592, 1606, 1610, 1614, 1197, 5101, 1204, 5137,
+    1188, 5142, 5143, 1197, 5145, 5146, 5147, 5150, 5154, 5204, 1019, 1022, 1033, 1196, 1163, 5278,
+    894, 637, 881, 889, 4857, 979, 1036, 1064, 1234, 5004, 5014, 889, 992, 5031, 1168, 1254,
+    1269, 1541, 1050, 578, 753, 1050, 1061, 4677, 1221, 1609, 637, 1052, 4738, 1241, 4754, 1604,
+    4755, 651, 1192, 1210, 4604, 1630, 4799, 4800, 4816, 4817, 4818, 4822, 688, 4824, 4828, 4830,
+    953, 4832, 1064, 1221, 1230, 1241, 4845, 4851, 1065, 1067, 4967, 1568, 1574, 1581, 1325, 572,
+    861, 6502, 858, 971, 1093, 1197, 1606, 929, 1128, 1322, 1330, 1332, 1335, 1337, 570, 586,
+    591, 5011, 782, 6679, 6680, 570, 861, 871, 6699, 640, 1210, 633, 890, 1116, 1203, 1064,
+    1121, 1146, 1161, 1203, 639, 1130, 1146, 5036, 1169, 1537, 574, 589, 844, 849, 1057, 1058,
+    1060, 1068, 1071, 1075, 1076, 1077, 1079, 5103, 1601, 1603, 1615, 971, 6858, 657, 720, 959,
+    5036, 668, 753, 687, 1031, 923, 584, 1537, 1630, 6437, 572, 995, 570, 571, 750, 1233,
+    1605, 614, 6665, 570, 820, 581, 5043, 720, 6781, 6789, 1112, 5190, 1064, 1049, 5098, 1606,
+    1561, 860, 985, 4937, 6125, 4976, 1130, 1028, 1610, 717, 957, 584, 1129, 1609, 4889, 1630,
+    5144, 586, 1128, 1160, 1160, 1121, 854, 1198, 1192, 1168, 5011, 753, 756, 5213, 1350, 1184,
+    4939, 1220, 5144, 1032, 7712, 1052, 1065, 4839, 1320, 1330, 1334, 1338, 1350, 4726, 4734, 7781,
+    1231, 1604, 971, 996, 7969, 8069, 8071, 4940, 661, 996, 996, 747, 180, 5970, 3449, 191,
+    3193, 180, 159, 160, 220, 172, 2979, 3948, 279, 215, 5392, 160, 272, 7423, 4003, 160,
+    240, 187, 3125, 160, 3546, 179, 3601, 3679, 3686, 3693, 3783, 191, 4015, 159, 4121, 4131,
+    7503, 3192, 5939, 223, 5652, 3932, 3210, 211, 212, 3200, 5567, 176, 3056, 3198, 3988, 4008,
+    175, 4447, 163, 3821, 219, 3114, 227, 207, 215, 220, 3952, 279, 3086, 3087, 3274, 3289,
+    3466, 3756, 3760, 3616, 159, 3128, 279, 175, 3952, 3124, 3023, 231, 2984, 5717, 5718, 5499,
+    3712, 231, 5928, 3023, 3606, 271, 2873, 203, 203, 159, 2982, 3308, 3679, 2896, 5975, 5924,
+    235, 179, 215, 3546, 207, 5980, 5508, 5831, 160, 180, 159, 160, 163, 164, 3234, 3237,
+    187, 3244, 211, 223, 227, 3255, 3647, 2930, 160, 3449, 5910, 5912, 236, 215, 3736, 5919,
+    5921, 5922, 5924, 236, 5934, 5941, 235, 3023, 3056, 179, 171, 215, 3068, 3056, 2905, 180,
+    228, 7193, 3193, 215, 3637, 159, 3478, 179, 171, 199, 5392, 203, 227, 7380, 199, 5939,
+    160, 5712, 3056, 6999, 160, 159, 236, 7150, 3410, 227, 7170, 4098, 7480, 2905, 228, 7193,
+    227, 5939, 7193, 280, 244, 7007, 5358, 2997, 211, 3952, 224, 180, 283, 5995, 207, 5930,
+    5957, 6999, 191, 5712, 2873, 2896, 4014, 3192, 3200, 5383, 271, 179, 280, 2873, 5483, 4011,
+    228, 2889, 239, 160, 3678, 3679, 171, 172, 3707, 3712, 3719, 3892, 5649, 4363, 4372, 228,
+    191, 3715, 5862, 215, 174, 5483, 3716, 5584, 5587, 203, 3466, 159, 215, 279, 280, 3546,
+    5798, 7185, 280, 5833, 3823, 2912, 3, 5345, 7553, 160, 2905, 180, 248, 6999, 5259, 929,
+    3801, 2879, 3125, 3823, 3574, 83, 3150, 3410, 228, 7193, 3193, 5392, 5490, 211, 227, 159,
+    7380, 228, 160, 211, 3823, 5939, 3208, 231, 3208, 251, 168, 171, 3183, 176, 195, 196,
+    206, 3204, 219, 3214, 283, 284, 7344, 5383, 3948, 179, 280, 5507, 5508, 3670, 5574, 5579,
+    4429, 231, 247, 3952, 239, 5928, 175, 3939, 207, 211, 220, 5941, 3955, 240, 5948, 5995,
+    207, 2982, 3544, 247, 4011, 5779, 3193, 207, 5811, 3899, 168, 4372, 2889, 3201, 3681, 212,
+    5435, 3988, 228, 2982, 3686, 5517, 206, 211, 5345, 1540, 5564, 5565, 5584, 5586, 3006, 5587,
+    3087, 3091, 3118, 5599, 5601, 191, 5603, 3709, 224, 3988, 251, 5618, 4447, 3712, 3716, 199,
+    224, 251, 180, 7261, 220, 168, 200, 207, 220, 5788, 191, 7421, 7422, 7423, 231, 272,
+    7442, 168, 2979, 235, 3801, 279, 3823, 279, 183, 3998, 7568, 3039, 3145, 215, 3888, 3056,
+    220, 207, 212, 219, 2874, 2877, 3193, 4008, 211, 2949, 7403, 203, 5824, 3145, 2896, 280,
+    160, 3678, 5891, 172, 227, 179, 6999, 3952, 3637, 231, 207, 2905, 228, 5662, 5939, 2909,
+    3818, 3878, 3878, 180, 215, 191, 3900, 280, 3201, 223, 3709, 279, 159, 5712, 5939, 8380,
+    3711, 5612, 4125, 200, 215, 4146, 232, 280, 5499, 208, 174, 8620, 8621, 3198, 5714, 5715,
+    186, 757, 1124, 4881, 845, 929, 756, 579, 586, 1100, 702, 4650, 5175, 1599, 1060, 575,
+    586, 1546, 5144, 985, 586, 1282, 811, 757, 588, 577, 744, 749, 4936, 620, 714, 5019,
+    5078, 856, 5207, 578, 5226, 5228, 8183, 4766, 6803, 1128, 6494, 756, 1196, 1019, 1032, 4773,
+    638, 722, 4692, 4771, 683, 1090, 711, 985, 617, 5094, 1096, 4719, 1165, 985, 1063, 1098,
+    5176, 1605, 1059, 1066, 4807, 4823, 4885, 5060, 5067, 718, 581, 789, 1606, 718, 5176, 753,
+    4676, 1196, 4653, 881, 895, 5019, 1168, 1184, 1196, 6789, 4675, 591, 1528, 651, 953, 953,
+    577, 4833, 619, 4604, 6841, 6778, 1221, 749, 1049, 572, 985, 4653, 6332, 1116, 6665, 586,
+    758, 572, 586, 608, 630, 646, 725, 809, 4793, 1014, 1121, 1161, 1168, 1195, 4628, 584,
+    4881, 4885, 4886, 1121, 6761, 1235, 1236, 1058, 5048, 6768, 758, 950, 5055, 6778, 1236, 854,
+    6808, 6809, 1231, 4676, 1603, 749, 686, 1051, 4694, 4692, 1146, 757, 1180, 7873, 929, 1051,
+    4970, 581, 4893, 753, 686, 919, 575, 959, 1161, 591, 911, 6803, 1066, 586, 6530, 4692,
+    7664, 585, 581, 1242, 1050, 1042, 1163, 7850, 1052, 8164, 1146, 1180, 7873, 1161, 6803, 7873,
+    1608, 1303, 971, 1192, 6145, 753, 1019, 5176, 1132, 1135, 756, 1630, 6862, 985, 7664, 852,
+    6530, 638, 4604, 1164, 4766, 4773, 6179, 1528, 753, 1610, 638, 6295, 5204, 1168, 4598, 1257,
+    585, 5002, 619, 680, 686, 688, 5033, 1168, 1286, 5130, 6491, 5251, 1163, 1168, 845, 1230,
+    6711, 1060, 6295, 1241, 6425, 6431, 945, 4885, 581, 1051, 1593, 1610, 579, 590, 7865, 1610,
+    6668, 1058, 4621, 6125, 586, 1146, 757, 1350, 7664, 746, 718, 4726, 1061, 1050, 4741, 1042,
+    1180, 7873, 929, 575, 6306, 1028, 1161, 581, 591, 1168, 586, 1014, 1061, 6803, 1066, 4784,
+    1189, 4784, 1362, 656, 685, 706, 4762, 723, 725, 736, 881, 889, 890, 895, 979, 1064,
+    1093, 1241, 1630, 1632, 1633, 1637, 1643, 1647, 8005, 6179, 5175, 753, 1610, 575, 1049, 4993,
+    1234, 570, 581, 1189, 1332, 1121, 1257, 6784, 711, 5171, 925, 985, 1014, 1098, 6807, 1164,
+    1282, 1609, 6862, 985, 1328, 5204, 950, 929, 980, 6639, 5140, 668, 1163, 4598, 4774, 638,
+    1044, 6227, 686, 1168, 714, 890, 979, 1028, 6125, 6398, 6399, 6426, 4662, 4666, 861, 1064,
+    4712, 4722, 1603, 6443, 845, 6444, 1116, 5035, 1124, 1129, 1130, 1135, 1143, 1144, 1146, 686,
+    1359, 6470, 985, 1168, 1241, 925, 1146, 1354, 771, 1071, 1100, 668, 930, 994, 1098, 6613,
+    845, 5100, 1191, 1194, 1196, 1201, 5139, 1197, 1542, 994, 668, 1603, 1233, 746, 1595, 1061,
+    1605, 778, 929, 933, 1116, 8258, 1130, 1221, 1059, 1051, 1068, 4692, 1098, 985, 1044, 1093,
+    4588, 4591, 4767, 1095, 1015, 950, 8069, 953, 6656, 4733, 1028, 1616, 586, 616, 5143, 688,
+    1161, 749, 7664, 1121, 1049, 1196, 985, 1146, 1180, 570, 6803, 1198, 985, 5117, 5117, 757,
+    1063, 854, 5146, 1608, 1031, 1118, 1128, 1592, 581, 6530, 6803, 8850, 5036, 6463, 5227, 927,
+    1063, 1198, 1203, 1609, 6319, 996, 707, 708, 709, 710, 718, 9094, 721, 722, 9095, 9096,
+    726, 729, 4770, 4593, 734, 6535, 192, 5654, 223, 4451, 5938, 179, 280, 3282, 227, 239,
+    2887, 176, 196, 2964, 191, 5796, 5998, 2889, 6014, 5530, 3818, 7253, 224, 207, 3619, 3648,
+    5538, 160, 3150, 280, 191, 3124, 179, 2955, 3756, 3556, 3706, 3760, 5971, 211, 5593, 207,
+    5843, 5851, 207, 219, 207, 160, 207, 5796, 3899, 159, 207, 2896, 191, 191, 2960, 5345,
+    3546, 7515, 3988, 196, 3679, 179, 207, 3787, 7403, 2909, 3210, 2879, 2909, 2938, 267, 3006,
+    235, 3274, 5558, 3606, 3801, 180, 3882, 3900, 3942, 5374, 2904, 2984, 5658, 5659, 3801, 180,
+    7498, 4015, 4018, 5829, 224, 3211, 179, 5838, 7515, 7535, 7537, 211, 196, 3086, 212, 3201,
+    3086, 3456, 216, 252, 3445, 2909, 8344, 228, 212, 8484, 223, 4104, 3536, 192, 219, 3200,
+    3619, 160, 223, 3836, 224, 179, 8344, 160, 5345, 215, 5538, 232, 160, 5995, 3899, 179,
+    2907, 5777, 2960, 191, 3086, 3092, 235, 3899, 159, 5924, 7251, 6035, 3899, 7450, 160, 5658,
+    2896, 163, 2892, 7408, 6999, 8344, 208, 5490, 5507, 3637, 252, 3606, 5549, 3932, 5549, 231,
+    3084, 3114, 5526, 3146, 227, 235, 3173, 3410, 3544, 203, 188, 232, 5767, 4011, 2896, 3931,
+    207, 180, 179, 2873, 3124, 5966, 3466, 179, 3606, 3760, 7533, 3888, 4076, 228, 179, 191,
+    5995, 179, 231, 3546, 7380, 5935, 3056, 2984, 3900, 3086, 3899, 191, 3410, 3544, 6999, 1163,
+    7203, 5407, 5474, 5709, 3, 3787, 160, 180, 3, 3086, 179, 179, 3899, 3467, 279, 160,
+    283, 3056, 236, 3574, 167, 187, 3939, 207, 3955, 5933, 3574, 3056, 4009, 3787, 7404, 3823,
+    204, 3760, 179, 163, 179, 191, 228, 3637, 2909, 207, 3091, 196, 8344, 3801, 3679, 207,
+    179, 215, 179, 5910, 5910, 166, 3818, 160, 5816, 6013, 3471, 3706, 3948, 3961, 4455, 3116,
+    3118, 9475, 219, 9476, 9477, 3157, 240, 861, 586, 1119, 5274, 1059, 753, 1616, 4819, 1150,
+    1257, 4597, 736, 894, 4646, 856, 6621, 6865, 4598, 6881, 6357, 985, 7920, 1146, 985, 4960,
+    4976, 6370, 584, 1121, 1609, 856, 749, 753, 1059, 5060, 761, 5030, 5068, 5080, 1020, 6438,
+    995, 6680, 858, 985, 1096, 985, 590, 985, 633, 5144, 580, 985, 1027, 845, 845, 4641,
+    6125, 4922, 5096, 686, 894, 619, 749, 985, 578, 8071, 1198, 1196, 718, 1198, 4630, 1494,
+    847, 1230, 4804, 6394, 588, 747, 769, 964, 5146, 5173, 945, 1128, 4652, 1000, 6500, 744,
+    758, 762, 855, 1180, 1203, 1124, 1133, 1207, 749, 817, 6700, 8220, 8225, 1024, 894, 1050,
+    1032, 1032, 1055, 860, 1072, 1373, 572, 1198, 8813, 1168, 1031, 8960, 1129, 5223, 4908, 859,
+    1093, 4773, 753, 584, 1121, 1222, 1134, 749, 8813, 584, 6125, 1049, 6370, 1210, 584, 6862,
+    5144, 750, 1161, 6599, 4641, 847, 1059, 1144, 1228, 5137, 577, 6777, 7918, 6898, 5144, 570,
+    585, 6499, 1018, 608, 4602, 7664, 8813, 1010, 6306, 581, 4969, 1373, 590, 6386, 762, 6386,
+    1198, 1044, 570, 1049, 1063, 1065, 1162, 1230, 1609, 1042, 953, 828, 1210, 1210, 5204, 4604,
+    750, 985, 758, 751, 638, 4725, 4880, 4885, 4886, 753, 586, 5067, 5068, 5080, 5122, 1602,
+    1168, 749, 858, 6862, 752, 1197, 577, 8044, 859, 4692, 4652, 5146, 1052, 5144, 856, 1042,
+    7664, 6202, 6282, 1027, 580, 589, 764, 1052, 753, 753, 5140, 4887, 1596, 585, 1630, 4692,
+    1234, 4930, 646, 809, 922, 925, 980, 1162, 6796, 1054, 4692, 5201, 570, 760, 1049, 975,
+    5066, 753, 603, 753, 845, 1168, 1050, 1192, 985, 1124, 894, 8813, 753, 619, 985, 749,
+    1060, 749, 6758, 6758, 637, 980, 586, 6646, 6880, 1124, 1090, 5175, 5183, 1165, 4720, 4721,
+    9765, 1093, 1096, 1152, 9767, 4748, 1268, 3023, 3862, 3172, 3419, 5401, 7575, 7590, 179, 6999,
+    279, 179, 3952, 2905, 180, 228, 5843, 5810, 179, 3756, 179, 179, 280, 5938, 2894, 3556,
+    3635, 5392, 6999, 3086, 3419, 2960, 196, 3556, 2889, 3198, 215, 207, 215, 175, 2894, 240,
+    187, 276, 235, 159, 192, 3629, 3419, 3681, 3693, 227, 235, 215, 207, 3899, 207, 223,
+    203, 5538, 3200, 2904, 175, 3833, 196, 2905, 6999, 2905, 5939, 3193, 7344, 5392, 271, 5928,
+    5939, 2873, 7258, 3617, 180, 3537, 8344, 3601, 235, 7193, 248, 7193, 215, 279, 2873, 3679,
+    3706, 3712, 4003, 228, 191, 5995, 5345, 3192, 179, 160, 5489, 5658, 5659, 3200, 5851, 5854,
+    5867, 5916, 200, 3899, 196, 223, 5939, 8344, 211, 5935, 5660, 3007, 3274, 3462, 3466, 3546,
+    207, 2873, 239, 3679, 280, 5850, 2930, 179, 191, 3419, 3200, 2960, 179, 196, 196, 81,
+    3546, 191, 192, 5970, 3891, 5484, 5485, 9969, 203, 3755, 9970, 5514, 4675, 5109, 4753, 4872,
+    6198, 8265, 8277, 749, 7664, 1606, 749, 5176, 1146, 757, 1180, 6680, 6638, 749, 5059, 749,
+    749, 1608, 1058, 995, 4925, 1043, 574, 575, 7664, 1052, 4872, 4641, 894, 4925, 4598, 4771,
+    1060, 985, 1060, 712, 994, 1270, 814, 1575, 1224, 581, 861, 933, 4872, 5010, 5019, 1161,
+    1220, 1060, 988, 5137, 985, 1128, 945, 6370, 4773, 4613, 706, 1196, 894, 1146, 7664, 1146,
+    6803, 1066, 929, 8005, 575, 1528, 6789, 6803, 1066, 638, 7925, 730, 756, 4913, 8813, 4936,
+    1220, 7873, 1346, 7873, 1060, 1601, 638, 5008, 5031, 1168, 994, 1168, 845, 6862, 6125, 4766,
+    749, 584, 6305, 6499, 6500, 1028, 6689, 1070, 734, 6721, 6765, 928, 5144, 894, 1116, 6803,
+    8813, 1022, 6799, 1124, 859, 579, 964, 4885, 577, 985, 638, 1257, 619, 1610, 744, 581,
+    749, 850, 4872, 4773, 4643, 749, 894, 894, 571, 846, 861, 6836, 5125, 591, 844, 10121,
+    945, 1058, 10122, 6340, 212, 196, 8344, 196, 196, 5842, 196, 196, 219, 3211, 8344, 5392,
+    3419, 280, 179, 3574, 180, 212, 5787, 3277, 192, 5928, 179, 3818, 160, 5538, 160, 207,
+    3419, 8344, 8592, 2896, 160, 160, 5784, 5811, 3899, 3574, 3899, 6999, 5530, 196, 2905, 7259,
+    3637, 167, 271, 5939, 3419, 3787, 191, 7525, 192, 235, 160, 179, 2960, 2896, 196, 5538,
+    5395, 196, 3419, 3419, 2876, 192, 10217, 1032, 894, 8813, 894, 894, 6679, 894, 894, 1087,
+    1200, 8813, 575, 4872, 1609, 749, 1050, 756, 1031, 6612, 608, 861, 6789, 749, 985, 586,
+    6370, 584, 985, 4872, 8813, 9065, 1027, 584, 584, 6608, 6639, 5137, 1050, 5144, 7664, 6358,
+    894, 1146, 7926, 1063, 638, 1537, 6803, 4872, 5080, 852, 1160, 860, 1219, 584, 750, 4641,
+    1024, 894, 6370, 845, 894, 4872, 4872, 4590, 861, 10284, 3419, 3419, 3419, 3419, 3419, 3744,
+    228, 196, 223, 7357, 180, 231, 196, 179, 7178, 179, 2905, 2905, 5928, 5939, 8344, 3419,
+    8521, 3706, 160, 2905, 3193, 5392, 3419, 7178, 3419, 5330, 4872, 4872, 4872, 4872, 4872, 5050,
+    1180, 894, 1118, 8019, 756, 1192, 894, 749, 7858, 749, 1146, 1146, 6789, 6803, 8813, 4872,
+    8999, 1082, 586, 1146, 929, 575, 4872, 7858, 4872, 6107, 3419, 223, 224, 3419, 196, 196,
+    2896, 3736, 4872, 1121, 1146, 4872, 894, 894, 1027, 587, 3801, 279, 3419, 3419, 2911, 746,
+    1595, 4872, 4872, 1225,
+};
+
+constexpr uint16_t uk_levels[] = {
+    0, 1, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0,
+    0, 0, 0, 0, 114, 0, 0, 0, 0, 114, 0, 0, 114, 0, 0, 0,
+    0, 0, 114, 0, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 161, 114,
+    114, 114, 114, 114, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 289, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 322, 0,
+    0, 0, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 322, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370,
+    370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370,
+    370, 370, 0, 0, 370, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+    418, 418, 418, 418, 418, 418, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 466, 0,
+    0, 0, 466, 0, 0, 0, 466, 0, 0, 0, 513, 513, 513, 0, 0, 513,
+    513, 0, 0, 513, 513, 513, 0, 0, 513, 513, 513, 513, 0, 0, 0, 513,
+    513, 0, 513, 0, 0, 513, 0, 0, 513, 513, 0, 513, 513, 0, 513, 0,
+    513, 513, 0, 0, 513, 513, 0, 0, 513, 0, 0, 513, 513, 0, 0, 513,
+    0, 513, 513, 0, 513, 0, 513, 0, 513, 0, 0, 513, 513, 0, 0, 513,
+    513, 513, 513, 513, 513, 513, 513, 546, 593, 0, 0, 0, 0, 593, 0, 0,
+    0, 625, 0, 0, 0, 0, 593, 0, 0, 0, 0, 593, 0, 0, 0, 0,
+    0, 0, 0, 593, 593, 593, 593, 593, 0, 546, 0, 0, 658, 0, 0, 0,
+    0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 658, 0, 658, 658, 0, 658,
+    658, 658, 658, 658, 658, 0, 0, 0, 0, 0, 0, 0, 546, 0, 0, 658,
+    658, 658, 658, 0, 658, 658, 0, 658, 658, 658, 658, 658, 0, 658, 658, 658,
+    658, 0, 658, 658, 658, 658, 658, 658, 0, 0, 0, 0, 0, 0, 0, 546,
+    0, 0, 0, 658, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 658,
+    0, 658, 658, 0, 658, 0, 658, 658, 658, 0, 0, 0, 0, 0, 0, 0,
+    0, 546, 0, 0, 0, 0, 658, 0, 705, 705, 0, 0, 658, 0, 0, 0,
+    0, 658, 0, 658, 658, 0, 658, 658, 658, 658, 658, 658, 0, 0, 0, 0,
+    0, 0, 0, 546, 593, 0, 0, 0, 0, 593, 0, 0, 0, 625, 0, 0,
+    0, 0, 593, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0, 593,
+    593, 593, 593, 593, 0, 546, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0,
+    658, 0, 0, 0, 0, 658, 0, 658, 658, 0, 658, 658, 658, 658, 658, 0,
+    0, 0, 0, 0, 0, 0, 0, 546, 0, 0, 0, 0, 0, 0, 0, 0,
+    658, 0, 0, 658, 0, 0, 0, 0, 658, 0, 658, 658, 0, 658, 658, 658,
+    658, 658, 658, 0, 0, 0, 0, 0, 0, 0, 546, 593, 0, 0, 0, 0,
+    593, 0, 0, 0, 625, 0, 0, 0, 0, 593, 0, 0, 0, 0, 593, 0,
+    0, 0, 0, 0, 0, 0, 593, 593, 593, 593, 593, 0, 546, 0, 658, 658,
+    658, 658, 0, 658, 658, 0, 658, 658, 658, 658, 658, 738, 658, 658, 658, 658,
+    0, 658, 658, 658, 658, 658, 658, 0, 0, 0, 0, 0, 0, 0, 546, 0,
+    658, 0, 658, 658, 0, 0, 658, 0, 0, 658, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    546, 0, 658, 658, 658, 658, 0, 658, 658, 0, 0, 658, 658, 658, 658, 0,
+    658, 658, 658, 658, 0, 658, 658, 658, 658, 0, 0, 0, 0, 0, 0, 0,
+    0, 658, 546, 0, 0, 658, 658, 658, 658, 0, 658, 658, 0, 0, 658, 658,
+    658, 658, 0, 658, 658, 658, 658, 0, 658, 658, 658, 658, 658, 658, 0, 0,
+    0, 0, 0, 0, 0, 546, 0, 658, 658, 658, 658, 0, 658, 658, 0, 0,
+    658, 658, 658, 658, 0, 658, 658, 658, 658, 0, 658, 658, 658, 658, 658, 658,
+    0, 0, 0, 0, 0, 0, 0, 546, 593, 0, 0, 0, 0, 593, 0, 0,
+    0, 625, 0, 0, 0, 0, 593, 0, 0, 0, 0, 593, 0, 0, 0, 0,
+    0, 0, 0, 593, 593, 593, 593, 593, 0, 546, 0, 658, 0, 0, 658, 0,
+    0, 658, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 0, 658, 658, 658,
+    658, 0, 658, 658, 0, 658, 658, 658, 658, 658, 0, 658, 658, 658, 658, 0,
+    658, 658, 658, 658, 658, 658, 0, 0, 0, 0, 0, 0, 658, 546, 0, 658,
+    0, 658, 658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546,
+    0, 658, 0, 658, 658, 0, 658, 658, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 546, 593, 0, 0, 0, 0, 593, 0, 0, 0, 625, 0, 0, 0, 0,
+    593, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0, 593, 593, 593,
+    593, 593, 0, 546, 0, 658, 0, 658, 0, 0, 0, 658, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 546, 0, 0, 0, 658, 658, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 546, 0, 658, 0, 658, 658, 0, 0, 658,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 0, 658, 0, 0, 658, 0,
+    658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 546, 0, 658, 0, 658,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 658, 0, 0, 0, 0, 0, 0, 0, 0, 546, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 0, 0, 0, 546,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 785, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 546, 593, 0, 0, 0, 0, 593, 0, 0, 0, 625, 0, 0, 0, 0,
+    593, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0, 593, 593, 593,
+    593, 593, 0, 546, 593, 0, 0, 0, 0, 593, 0, 0, 0, 625, 0, 0,
+    0, 0, 593, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0, 593,
+    593, 593, 0, 593, 0, 546, 0, 0, 0, 0, 0, 0, 0, 0, 0, 625,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0,
+    0, 593, 0, 593, 0, 593, 0, 546, 593, 0, 0, 0, 0, 593, 0, 0,
+    593, 625, 0, 0, 0, 0, 593, 0, 0, 0, 0, 593, 0, 0, 0, 0,
+    0, 0, 0, 593, 593, 593, 0, 593, 0, 546, 0, 0, 0, 0, 0, 593,
+    0, 0, 0, 625, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 593, 0, 0, 0, 0, 0, 546, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 817, 817, 817,
+    817, 817, 817, 817, 817, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850,
+    850, 850, 850, 850, 850, 850, 897, 0, 0, 897, 897, 0, 897, 897, 897, 897,
+    0, 897, 897, 897, 897, 897, 897, 0, 0, 897, 897, 897, 0, 897, 0, 897,
+    0, 897, 897, 897, 0, 897, 897, 897, 0, 897, 897, 897, 897, 897, 897, 897,
+    0, 897, 897, 897, 897, 0, 0, 897, 0, 0, 0, 897, 897, 897, 0, 0,
+    897, 897, 897, 897, 897, 897, 897, 897, 897, 897, 0, 897, 897, 897, 0, 897,
+    897, 897, 897, 897, 930, 0, 930, 0, 930, 0, 0, 930, 0, 0, 930, 0,
+    930, 0, 930, 930, 0, 930, 930, 0, 930, 0, 930, 0, 0, 930, 0, 930,
+    0, 930, 0, 0, 930, 0, 0, 930, 0, 0, 930, 0, 930, 0, 930, 0,
+    0, 930, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930,
+    0, 930, 0, 0, 930, 930, 977, 930, 930, 930, 0, 930, 930, 977, 930, 930,
+    977, 0, 930, 930, 977, 0, 0, 930, 930, 977, 930, 0, 0, 930, 930, 977,
+    0, 0, 930, 977, 0, 930, 930, 930, 930, 930, 0, 930, 930, 930, 930, 930,
+    930, 930, 930, 0, 930, 930, 0, 930, 0, 930, 977, 0, 930, 977, 0, 930,
+    930, 977, 0, 0, 930, 0, 0, 930, 977, 0, 930, 977, 0, 930, 0, 0,
+    930, 977, 930, 977, 0, 930, 977, 0, 0, 0, 930, 977, 930, 977, 930, 0,
+    0, 930, 977, 0, 0, 930, 977, 0, 930, 977, 0, 930, 977, 0, 930, 0,
+    930, 930, 977, 930, 0, 930, 977, 930, 977, 930, 977, 930, 930, 930, 930, 930,
+    0, 930, 930, 930, 930, 930, 977, 930, 977, 930, 977, 930, 0, 0, 930, 930,
+    930, 930, 930, 930, 977, 0, 0, 930, 977, 930, 977, 0, 0, 930, 0, 0,
+    930, 930, 977, 0, 0, 930, 977, 0, 930, 977, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 0, 930, 930, 930, 0, 930, 0, 930, 0, 0,
+    930, 930, 0, 930, 0, 0, 930, 977, 0, 930, 977, 0, 0, 930, 0, 930,
+    930, 930, 977, 930, 977, 930, 977, 0, 930, 0, 0, 930, 930, 977, 0, 0,
+    930, 0, 930, 977, 930, 0, 930, 930, 930, 930, 930, 930, 930, 977, 0, 0,
+    930, 930, 930, 930, 0, 0, 930, 930, 930, 0, 930, 930, 0, 930, 930, 0,
+    930, 0, 0, 930, 930, 930, 930, 930, 0, 0, 930, 0, 930, 0, 0, 930,
+    0, 0, 930, 0, 0, 930, 930, 930, 0, 930, 0, 0, 930, 0, 0, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930, 930, 930, 977,
+    930, 977, 0, 930, 930, 0, 930, 930, 930, 930, 930, 930, 0, 930, 930, 0,
+    930, 930, 0, 930, 930, 0, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 0, 0, 930, 0, 0, 930, 0, 0, 0,
+    930, 977, 0, 0, 930, 977, 0, 930, 977, 0, 0, 930, 0, 930, 930, 930,
+    930, 0, 930, 977, 930, 977, 0, 930, 977, 0, 930, 977, 0, 0, 930, 0,
+    930, 930, 977, 0, 0, 930, 0, 930, 930, 0, 0, 930, 930, 930, 930, 0,
+    930, 930, 930, 977, 0, 0, 930, 930, 930, 930, 0, 930, 930, 930, 0, 930,
+    930, 930, 0, 930, 930, 0, 0, 930, 930, 930, 930, 0, 0, 930, 930, 930,
+    930, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 0, 930, 930, 930, 930, 977, 930, 977, 930, 977, 930, 977, 930,
+    0, 930, 930, 977, 930, 930, 930, 977, 0, 930, 977, 0, 930, 977, 0, 0,
+    930, 977, 0, 930, 0, 930, 977, 930, 977, 930, 977, 0, 930, 977, 0, 930,
+    0, 930, 977, 930, 977, 930, 977, 930, 977, 930, 977, 0, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 0, 930, 930, 977, 0, 930, 930, 930, 930, 930, 930,
+    0, 930, 930, 977, 930, 977, 0, 930, 930, 930, 0, 0, 930, 930, 977, 0,
+    930, 977, 0, 0, 930, 977, 0, 930, 930, 930, 977, 930, 930, 930, 977, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 977, 930, 930, 977, 930, 977, 930,
+    930, 930, 930, 930, 930, 977, 930, 977, 0, 930, 977, 0, 930, 977, 930, 930,
+    977, 930, 930, 977, 930, 977, 930, 930, 930, 0, 930, 930, 930, 930, 930, 977,
+    0, 0, 930, 930, 930, 930, 930, 930, 0, 930, 0, 930, 977, 0, 0, 930,
+    930, 977, 930, 930, 0, 930, 977, 930, 930, 930, 930, 977, 0, 930, 977, 0,
+    930, 977, 930, 977, 0, 930, 0, 930, 977, 930, 977, 0, 930, 977, 0, 930,
+    977, 930, 930, 977, 930, 977, 930, 930, 930, 977, 930, 0, 930, 930, 930, 930,
+    930, 0, 930, 930, 930, 0, 0, 930, 930, 977, 930, 977, 0, 0, 930, 977,
+    0, 0, 930, 0, 0, 930, 977, 930, 977, 930, 930, 930, 977, 0, 930, 930,
+    977, 930, 977, 0, 930, 0, 930, 930, 977, 930, 977, 0, 0, 930, 977, 0,
+    0, 930, 930, 977, 930, 977, 930, 977, 0, 930, 977, 930, 977, 930, 930, 977,
+    0, 0, 930, 930, 930, 930, 0, 930, 930, 930, 0, 0, 1009, 930, 0, 0,
+    930, 0, 0, 930, 1009, 930, 0, 0, 930, 0, 0, 930, 930, 0, 930, 930,
+    930, 0, 930, 930, 930, 0, 930, 0, 0, 930, 0, 0, 930, 0, 930, 0,
+    0, 930, 930, 0, 0, 930, 930, 0, 930, 930, 0, 930, 930, 930, 930, 930,
+    930, 930, 0, 0, 930, 930, 930, 0, 0, 930, 930, 930, 930, 977, 930, 0,
+    0, 930, 930, 930, 930, 930, 930, 977, 930, 930, 930, 0, 0, 930, 930, 977,
+    0, 0, 930, 977, 0, 0, 930, 977, 0, 930, 930, 977, 930, 930, 977, 930,
+    930, 930, 930, 930, 930, 930, 930, 0, 930, 930, 930, 0, 930, 977, 930, 977,
+    0, 0, 930, 977, 930, 977, 0, 0, 930, 0, 930, 977, 930, 977, 0, 0,
+    930, 930, 930, 977, 0, 930, 977, 0, 930, 977, 0, 930, 977, 0, 930, 0,
+    930, 977, 930, 977, 930, 977, 0, 930, 977, 0, 0, 930, 0, 930, 977, 930,
+    977, 930, 977, 0, 930, 977, 930, 977, 930, 977, 0, 930, 977, 0, 0, 930,
+    930, 930, 930, 930, 930, 930, 0, 930, 930, 0, 930, 930, 0, 0, 930, 0,
+    930, 930, 930, 930, 930, 977, 0, 0, 930, 977, 0, 930, 977, 930, 977, 930,
+    0, 930, 977, 0, 0, 930, 930, 977, 0, 930, 977, 0, 0, 930, 0, 930,
+    0, 930, 0, 0, 930, 0, 930, 930, 0, 930, 930, 977, 0, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 977, 0, 930, 930, 930, 0, 0, 930, 930, 0,
+    930, 930, 930, 0, 930, 977, 0, 930, 977, 0, 930, 930, 0, 930, 930, 977,
+    0, 930, 977, 0, 0, 930, 977, 0, 930, 0, 930, 930, 930, 977, 930, 977,
+    930, 0, 930, 930, 977, 0, 0, 930, 930, 930, 930, 930, 930, 930, 930, 0,
+    0, 930, 0, 930, 0, 930, 930, 930, 930, 0, 930, 930, 930, 0, 0, 930,
+    0, 0, 930, 0, 0, 930, 930, 930, 0, 0, 930, 0, 0, 930, 0, 0,
+    930, 0, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930,
+    0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    977, 930, 930, 0, 930, 930, 977, 930, 0, 0, 930, 977, 0, 930, 930, 977,
+    930, 930, 930, 930, 0, 930, 930, 977, 930, 930, 930, 930, 0, 930, 930, 930,
+    930, 930, 977, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 977, 930,
+    977, 930, 0, 0, 930, 930, 977, 930, 0, 930, 977, 0, 930, 930, 930, 930,
+    930, 930, 977, 930, 930, 930, 930, 930, 930, 0, 930, 930, 930, 0, 930, 930,
+    930, 930, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    0, 930, 0, 930, 0, 930, 930, 930, 930, 930, 0, 930, 930, 977, 0, 930,
+    930, 930, 930, 930, 930, 930, 930, 977, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 977, 930, 977, 930, 0, 930, 930, 930, 930, 977, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930, 977,
+    930, 930, 930, 930, 930, 930, 930, 930, 0, 0, 930, 0, 930, 977, 930, 977,
+    0, 930, 930, 930, 930, 0, 930, 977, 0, 0, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930,
+    930, 930, 0, 930, 0, 930, 930, 0, 930, 930, 930, 0, 930, 930, 930, 930,
+    930, 930, 0, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 0, 930, 930, 930, 930, 930, 0, 930, 0, 930, 0, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 0, 0, 930, 0, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930,
+    930, 930, 930, 0, 930, 930, 0, 930, 930, 0, 930, 930, 0, 0, 930, 0,
+    930, 0, 930, 0, 930, 930, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0,
+    930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930, 930, 930,
+    930, 0, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0, 930,
+    930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 0,
+    0, 1042, 1042, 0, 0, 1042, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 1042,
+    0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1090, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1137, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1169, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1202,
+    0, 0, 0, 0, 1249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1282, 1282, 1282,
+    1282, 0, 0, 1169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1329, 0, 0, 0, 0, 0, 0, 0, 0, 1282,
+    1282, 1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1202,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1363, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 1426, 0, 0, 0, 1249,
+    1249, 1249, 0, 0, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282,
+    1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1169, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1249, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282, 1282,
+    1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1169,
+    0, 1169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1202, 1202, 1202, 1202, 0, 0,
+    1426, 1426, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1282, 1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1426, 0, 0, 1426, 0, 1426, 1426, 1426, 1426, 1202,
+    0, 0, 0, 0, 0, 0, 1426, 0, 0, 1426, 0, 1426, 1426, 0, 1426, 1426,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 1282, 1282, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 1426, 1426, 0, 1249, 1249, 0,
+    1426, 1282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1474, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1169, 0, 0, 1426, 1426,
+    0, 0, 1426, 0, 0, 0, 0, 1426, 0, 1202, 0, 0, 0, 1426, 0, 0,
+    1426, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1426, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1585, 0, 0, 0, 1202, 1202,
+    0, 0, 1618, 0, 1666, 0, 0, 1666, 1666, 1666, 1618, 0, 0, 0, 0, 0,
+    1666, 1666, 1666, 1666, 0, 1666, 1618, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1713, 0, 1618, 1618, 1618, 1666, 1666, 1666, 0, 1666, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 1746, 0, 1794, 0, 0,
+    0, 0, 0, 0, 0, 1746, 1746, 0, 0, 0, 1746, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1746, 1842, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 1746, 1889, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1842,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 1746, 0, 0, 1746, 0,
+    0, 0, 1842, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 1746,
+    0, 0, 0, 1746, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1746, 1746, 0, 0, 0, 1746, 1922, 0, 0, 1746, 0, 1746, 0, 0, 1746, 0,
+    1746, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 1746,
+    1746, 0, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 0, 1746, 1746, 1746, 1746, 1746,
+    1746, 0, 1746, 0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 1794, 0, 0, 1746, 0,
+    0, 0, 1746, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 0,
+    0, 1970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 0, 0, 1746, 1746,
+    0, 1746, 1746, 1746, 1746, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2017, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1746, 0, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1746, 1746, 1746, 0, 1746, 1746, 1746, 1746, 1746, 0, 0, 1746, 0, 1746, 0, 0,
+    0, 1746, 1746, 0, 0, 1746, 0, 1746, 1746, 1746, 0, 1746, 0, 0, 0, 0,
+    1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0,
+    1746, 1746, 0, 0, 1746, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1746, 1746, 1746, 0, 0, 1746, 1746, 0, 0, 0, 1746, 0, 0,
+    1746, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1842, 0, 0, 0, 0,
+    0, 0, 0, 0, 1842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1746, 0, 0, 0, 0, 0, 0, 0, 0, 1746,
+    0, 1746, 0, 0, 0, 0, 0, 1746, 1746, 1746, 0, 1746, 0, 0, 1746, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2050, 0, 0, 0, 0, 0, 2097, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2097, 0, 0, 2050,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2129, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2193, 2193, 2193, 0, 2193, 0, 0, 0, 0, 0, 0, 0, 0, 2193, 0,
+    0, 0, 0, 2193, 0, 0, 0, 0, 0, 0, 0, 2226, 0, 0, 2226, 0,
+    0, 0, 0, 2274, 2129, 2274, 0, 0, 2274, 2129, 0, 0, 2226, 0, 0, 2226,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2226, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2193, 2193, 2193, 2193,
+    2193, 2193, 2193, 2193, 2193, 2193, 2193, 0, 0, 0, 0, 2193, 2193, 2193, 2193, 2193,
+    0, 2193, 2193, 2193, 2193, 2193, 0, 2193, 2193, 2193, 0, 0, 0, 0, 2193, 2193,
+    2193, 2193, 0, 0, 0, 2226, 2226, 2226, 2226, 2226, 2193, 0, 2193, 2193, 2193, 2193,
+    0, 0, 0, 2129, 0, 2322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2371, 0, 2434, 0, 2129, 2129, 2129, 2129, 2129, 0, 2129, 2193, 2193, 2193, 2193, 2193,
+    2193, 0, 0, 0, 0, 0, 0, 2274, 0, 2274, 0, 0, 0, 0, 2161, 0,
+    0, 0, 0, 0, 0, 0, 0, 2482, 2482, 2482, 2482, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2161, 0, 0,
+    0, 0, 0, 2226, 2129, 0, 0, 0, 0, 2193, 0, 0, 0, 0, 0, 0,
+    0, 0, 2129, 0, 2530, 0, 0, 2434, 0, 2274, 2274, 2129, 0, 2129, 2129, 2129,
+    2129, 2129, 2129, 0, 0, 0, 2226, 2226, 0, 2193, 2193, 2193, 2193, 0, 0, 2193,
+    2193, 0, 2193, 2193, 2193, 2226, 2226, 0, 0, 0, 0, 2193, 2193, 2193, 2193, 2193,
+    2193, 2193, 2193, 2193, 0, 2193, 2193, 2193, 2193, 2193, 2161, 2161, 2161, 2161, 2161, 0,
+    2193, 2193, 2193, 2193, 0, 0, 2226, 0, 0, 0, 0, 0, 0, 2161, 2161, 0,
+    0, 0, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 2226, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2578, 0, 0, 0, 0, 0, 0,
+    0, 0, 2627, 2627, 2627, 2226, 0, 0, 0, 0, 0, 2226, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2274, 2690, 2690, 0, 0, 0, 0, 0,
+    0, 0, 0, 2129, 0, 0, 0, 2274, 2129, 0, 2129, 2129, 2129, 2129, 2129, 2129,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2129, 2274,
+    2129, 2129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2129, 0,
+    0, 0, 2161, 2161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2226, 0, 2226, 0, 0, 2738, 0, 2226, 2161, 0, 0, 0, 0, 0, 0, 0,
+    0, 2785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 2226,
+    0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2434, 0, 0, 0, 0, 0, 2129, 2129, 2129, 0,
+    0, 0, 0, 0, 0, 0, 0, 2817, 0, 0, 0, 0, 0, 0, 0, 0,
+    2817, 0, 2226, 2226, 0, 2226, 2578, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2129, 0, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2129,
+    2226, 0, 2627, 0, 2627, 2226, 2226, 2226, 2226, 0, 0, 0, 0, 0, 2226, 0,
+    0, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2226, 2578, 0,
+    2226, 2226, 2226, 0, 2226, 2226, 2226, 2226, 2226, 2226, 0, 2226, 0, 2226, 2226, 0,
+    0, 0, 2226, 0, 0, 2226, 0, 0, 0, 0, 0, 0, 0, 2578, 2226, 2226,
+    2226, 2226, 0, 2226, 0, 0, 2226, 2226, 2226, 2226, 0, 2850, 2850, 2850, 0, 0,
+    0, 0, 2226, 0, 0, 0, 0, 2578, 0, 0, 0, 0, 0, 2226, 2226, 2226,
+    0, 0, 0, 0, 0, 0, 0, 0, 2226, 2226, 0, 0, 0, 0, 0, 2226,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2578, 0, 0, 0, 0, 2578, 0,
+    0, 0, 0, 0, 0, 2226, 2226, 0, 2226, 2226, 2226, 0, 2578, 2226, 0, 0,
+    0, 2226, 2226, 2226, 0, 0, 0, 0, 0, 2226, 0, 0, 2226, 0, 0, 0,
+    2161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2226, 2226, 2226, 0, 0,
+    0, 0, 0, 2897, 0, 2930, 2930, 2978, 0, 0, 0, 2978, 2930, 3025, 3025, 0,
+    2930, 2930, 3025, 3025, 3025, 2930, 2930, 2930, 0, 3025, 3057, 0, 3089, 2930, 2930, 0,
+    0, 0, 2978, 2978, 2978, 2978, 2978, 2978, 2978, 0, 2978, 3122, 3057, 3057, 3057, 3057,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3169, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3203, 3203, 3203,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3203, 3203, 3203,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3266, 3266, 0, 0, 0, 0, 0,
+    0, 3203, 3203, 0, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3314, 3169, 3266, 3266, 3266, 0, 0, 3266, 0, 0, 0, 0, 0, 0,
+    0, 3363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3266, 3266, 3266, 3266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3203, 3203, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3203, 0, 3203, 0, 3203, 3314, 0, 3203, 0, 0, 0, 0, 3203, 3203, 0, 0,
+    0, 0, 3266, 3266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3266, 0, 0, 0, 0, 3203, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3266,
+    3203, 3203, 3203, 0, 0, 0, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 3266,
+    0, 0, 0, 0, 3266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3266,
+    3266, 3266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3266, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3203, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3203, 0, 3203, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3203, 3203, 3203, 0,
+    3203, 0, 0, 0, 0, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3203, 0, 0, 0, 3266, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3203, 3203, 0, 0, 0, 3203, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3266, 3266, 0, 3203,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3425, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3457, 0, 0, 0, 0, 0, 0, 0, 3489, 3489, 0, 3522, 3522,
+    0, 0, 3569, 0, 3522, 0, 3522, 0, 0, 3522, 0, 3522, 0, 0, 0, 3602,
+    0, 0, 0, 3569, 3569, 3569, 3569, 0, 0, 0, 3522, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3522, 0, 3522,
+    3569, 3650, 3489, 0, 3522, 3489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3697, 0, 3729, 0, 3729, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3489, 3729, 3729, 3729, 0, 0, 0,
+    0, 0, 3763, 0, 3522, 0, 0, 3826, 0, 0, 3873, 3873, 3763, 3522, 3522, 0,
+    0, 0, 3906, 0, 0, 0, 3522, 3763, 0, 0, 0, 0, 0, 3763, 3763, 3650,
+    0, 3954, 4003, 0, 0, 3954, 3489, 3489, 0, 0, 3729, 3489, 0, 0, 0, 3729,
+    0, 3729, 0, 0, 0, 3729, 3522, 0, 0, 3729, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4067, 0, 0, 0, 0, 3873, 3729, 3650, 0, 3873, 0,
+    0, 0, 0, 3602, 3650, 3602, 0, 0, 0, 0, 0, 0, 0, 0, 3522, 3650,
+    3522, 3602, 3522, 0, 0, 3569, 0, 3569, 0, 3569, 3569, 0, 3569, 3569, 3569, 3569,
+    0, 3522, 3569, 3569, 3569, 0, 0, 3729, 0, 3729, 0, 3873, 0, 0, 4130, 3522,
+    0, 3763, 3763, 3763, 3729, 3729, 0, 3522, 0, 0, 0, 0, 3602, 3602, 0, 0,
+    3650, 3569, 0, 3489, 0, 0, 0, 0, 0, 3522, 0, 3522, 3522, 3569, 3650, 0,
+    3697, 0, 0, 3489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3489, 0,
+    0, 3522, 0, 0, 0, 0, 0, 0, 0, 4130, 0, 0, 0, 0, 4179, 0,
+    0, 0, 0, 3873, 3873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3873, 3873, 3873, 0, 4242, 0, 0, 4289, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3873, 3873, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3569, 0, 0, 0, 3522, 0, 0, 3489, 0, 0, 0, 0, 3602, 3489,
+    0, 3602, 3602, 3650, 3522, 0, 0, 0, 3602, 3522, 3522, 3489, 3489, 0, 4321, 3569,
+    0, 0, 0, 0, 3569, 3569, 0, 3569, 3569, 0, 3569, 0, 3522, 3522, 3522, 3522,
+    3522, 0, 3522, 3522, 3569, 3650, 3569, 3569, 3569, 3522, 0, 3522, 3569, 0, 3489, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4130,
+    0, 0, 4130, 0, 0, 0, 0, 0, 0, 3489, 0, 0, 3826, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3873, 3873, 3873, 0, 3873, 3873,
+    4354, 0, 3602, 3489, 3602, 0, 0, 3489, 0, 0, 0, 3489, 0, 0, 0, 0,
+    3826, 0, 3763, 0, 0, 0, 0, 3489, 0, 0, 0, 0, 4403, 3602, 0, 0,
+    3489, 0, 3522, 3522, 0, 3489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3954, 0, 0, 0, 0, 0, 4467, 0, 0, 0, 0, 3763,
+    3763, 0, 0, 3522, 3522, 3873, 3489, 3522, 3522, 0, 0, 0, 0, 3826, 3763, 3763,
+    3763, 0, 0, 0, 0, 3763, 0, 0, 0, 0, 3522, 0, 3522, 3522, 0, 3763,
+    0, 0, 3522, 3522, 3522, 0, 0, 3522, 3522, 3522, 0, 3763, 3763, 3763, 3763, 3763,
+    3763, 3763, 3763, 3763, 3763, 3763, 3763, 0, 3763, 3763, 3763, 3522, 0, 0, 0, 0,
+    0, 0, 3763, 0, 4242, 0, 3763, 0, 3489, 3522, 3522, 0, 0, 0, 0, 0,
+    0, 0, 0, 3763, 0, 3522, 0, 0, 3522, 0, 0, 0, 3522, 0, 0, 3489,
+    0, 0, 0, 3489, 0, 0, 4321, 0, 0, 3522, 0, 0, 3522, 0, 0, 3489,
+    0, 0, 0, 3522, 0, 0, 3569, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3522, 0, 3729, 0, 4531, 0, 0, 0, 0, 0, 0, 0, 4594, 0, 4594,
+    4594, 0, 4641, 4674, 4722, 0, 0, 4722, 4674, 4674, 4674, 4722, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4770, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4819,
+    4819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4882, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4819, 0, 4819, 0, 0, 0, 0, 0, 4930, 4930,
+    0, 0, 0, 0, 0, 4770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4770, 4770, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4770, 0, 0, 0, 0, 0, 4977, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5010, 0, 0, 0, 0, 0,
+    5010, 5057, 0, 0, 5090, 5057, 0, 5090, 5090, 5090, 5090, 0, 5090, 5090, 5090, 5057,
+    5090, 5090, 0, 0, 5090, 0, 0, 0, 0, 0, 0, 0, 5138, 0, 0, 0,
+    5138, 5138, 0, 0, 5138, 0, 5090, 0, 5186, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5234, 0, 5281, 0, 0, 0, 0, 5281, 0, 5138, 5314, 0, 0, 0,
+    0, 0, 5138, 5138, 5138, 0, 0, 0, 0, 0, 5361, 0, 5393, 0, 0, 5090,
+    5090, 0, 5090, 5426, 5426, 0, 0, 0, 0, 0, 5057, 5057, 5090, 5475, 0, 0,
+    5090, 5537, 0, 0, 0, 0, 0, 0, 0, 5361, 0, 5361, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5138, 0, 0, 0, 5138, 0, 0, 5138, 5138,
+    0, 0, 0, 5570, 5570, 0, 0, 5057, 5057, 5619, 5057, 5057, 5057, 5057, 5057, 5090,
+    5090, 0, 5090, 0, 0, 0, 5057, 0, 5186, 0, 0, 5186, 5057, 0, 5426, 5619,
+    0, 0, 0, 5361, 5090, 5281, 5090, 0, 5361, 5361, 5057, 5057, 5057, 5186, 5186, 5186,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5393, 5681, 0, 0, 5714,
+    5426, 0, 0, 0, 5763, 0, 5570, 5570, 5570, 0, 0, 5570, 0, 0, 5281, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5826, 0, 5874, 5393,
+    0, 5570, 5570, 5426, 5570, 5570, 0, 0, 0, 5057, 0, 5057, 0, 5057, 5681, 5057,
+    0, 5681, 5923, 0, 5714, 5057, 5057, 5057, 0, 5090, 0, 0, 5090, 5874, 0, 5281,
+    5057, 5057, 5057, 5057, 5057, 0, 5186, 5057, 0, 5057, 5090, 0, 5090, 5186, 5057, 0,
+    0, 0, 5826, 0, 0, 0, 0, 0, 0, 0, 5426, 5393, 0, 5426, 0, 5986,
+    0, 5426, 5393, 5393, 5393, 5393, 5393, 5393, 6034, 0, 5570, 5570, 0, 5570, 5570, 0,
+    0, 5874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 5681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5281, 5281, 5874, 0,
+    5874, 0, 0, 0, 0, 0, 0, 5826, 0, 0, 0, 0, 5714, 6081, 6081, 5714,
+    0, 5763, 5714, 5874, 5138, 0, 5281, 5281, 5874, 5281, 5874, 5874, 5874, 5874, 5874, 0,
+    0, 5714, 0, 0, 5426, 0, 0, 0, 0, 5090, 5475, 0, 0, 0, 5681, 5090,
+    5090, 0, 0, 0, 0, 0, 0, 5475, 5475, 5475, 0, 5090, 0, 5090, 5090, 5090,
+    5090, 5475, 5475, 5475, 0, 0, 0, 5057, 0, 5057, 5057, 6116, 0, 0, 5475, 5090,
+    5826, 5826, 5826, 5090, 0, 0, 5090, 0, 0, 5090, 0, 5090, 0, 5090, 0, 0,
+    5186, 0, 0, 0, 0, 0, 0, 5057, 5057, 5090, 5186, 0, 0, 0, 0, 5057,
+    5090, 6195, 5090, 5090, 5090, 0, 5090, 0, 5057, 5426, 5186, 6258, 0, 6307, 0, 0,
+    0, 0, 0, 0, 6370, 6418, 0, 0, 6466, 6466, 6466, 0, 0, 6466, 0, 0,
+    0, 6466, 6418, 6514, 6514, 6514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6562, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6562, 0, 6609,
+    6642, 0, 0, 0, 6690, 0, 0, 0, 6739, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 6802, 6802, 6850, 6897, 6802, 6802, 6850, 0, 0,
+    6850, 6850, 0, 6850, 0, 6931, 6931, 0, 6850, 0, 6850, 0, 0, 0, 0, 6993,
+    0, 6850, 0, 0, 0, 7025, 7059, 7122, 7169, 0, 7203, 0, 7203, 7203, 7268, 6850,
+    6850, 6850, 6850, 0, 0, 0, 7346, 0, 0, 0, 0, 0, 0, 6802, 7395, 0,
+    0, 7458, 7507, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7571, 0, 7634, 0,
+    7682, 7682, 0, 7682, 0, 0, 0, 0, 7682, 7025, 0, 6850, 6850, 6850, 6850, 6850,
+    6850, 6850, 6850, 6850, 6850, 0, 6850, 6850, 6850, 6850, 6850, 6850, 6850, 0, 0, 0,
+    6802, 6802, 0, 0, 7729, 0, 6802, 0, 7762, 6850, 6802, 0, 6802, 0, 0, 0,
+    0, 0, 0, 0, 7169, 0, 0, 0, 7762, 0, 0, 7025, 7059, 7810, 0, 7025,
+    0, 0, 6850, 7859, 0, 7859, 7859, 0, 7859, 0, 7859, 6850, 6931, 6850, 0, 0,
+    7729, 0, 0, 0, 0, 0, 7762, 0, 7922, 7970, 7729, 0, 6802, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 8018, 0, 0, 8065, 0, 7810, 7810, 8098, 0, 0,
+    0, 0, 7634, 7634, 0, 0, 7634, 7634, 0, 0, 7634, 0, 0, 0, 7634, 0,
+    0, 0, 7169, 7025, 7970, 8146, 7634, 8194, 0, 8244, 7970, 8323, 7970, 0, 7122, 8065,
+    0, 8385, 6850, 0, 8419, 8098, 7025, 7970, 7122, 7122, 0, 0, 7169, 7169, 6993, 8244,
+    7634, 7634, 0, 0, 0, 0, 0, 0, 6802, 6802, 8482, 8529, 0, 0, 0, 0,
+    0, 7634, 0, 6802, 6802, 6802, 6802, 6802, 0, 0, 0, 7762, 0, 0, 0, 0,
+    6850, 0, 7682, 7682, 0, 0, 6802, 8562, 8610, 0, 0, 0, 8610, 0, 0, 0,
+    0, 0, 0, 8658, 0, 0, 8658, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8706,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8754, 0, 8754, 8754,
+    8803, 8803, 8754, 0, 0, 8865, 0, 8754, 8897, 8930, 8897, 8978, 9028, 0, 0, 0,
+    0, 9106, 9106, 0, 0, 9153, 9186, 9186, 0, 9235, 8754, 0, 0, 9299, 9362, 0,
+    9410, 0, 9459, 9522, 0, 9522, 0, 9522, 9522, 0, 8754, 8754, 8754, 0, 0, 9570,
+    9153, 9459, 0, 0, 0, 0, 0, 9617, 0, 9650, 0, 0, 0, 8930, 0, 8930,
+    8897, 8897, 8930, 0, 8930, 9699, 0, 8930, 8897, 0, 9153, 9153, 9153, 9153, 9762, 8803,
+    9153, 8930, 8803, 8930, 9810, 9857, 0, 0, 0, 0, 0, 0, 9106, 9857, 0, 0,
+    0, 0, 9891, 9955, 0, 0, 0, 8978, 0, 9891, 9955, 8978, 0, 0, 0, 8930,
+    9762, 0, 0, 0, 10018, 10018, 0, 10018, 10018, 10067, 0, 0, 0, 9153, 8978, 0,
+    0, 9235, 8754, 0, 0, 0, 0, 0, 0, 10130, 10130, 10130, 0, 10178, 10178, 10178,
+    10178, 10178, 0, 10178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10226, 0, 10274, 0, 0, 10322, 0, 0, 0,
+    10370, 10274, 10418, 10466, 0, 0, 10514, 0, 0, 0, 0, 0, 10370, 0, 0, 10370,
+    0, 10562, 0, 10466, 10274, 10226, 10274, 0, 0, 10610, 10562, 0, 10610, 0, 0, 10658,
+    0, 10418, 0, 0, 0, 10707, 10418, 10771, 10274, 10834, 10882, 10929, 10370, 0, 0, 0,
+    10963, 0, 0, 10562, 0, 10466, 10466, 0, 11027, 11090, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11138, 11138, 11138, 11187, 11187, 11138,
+    11250, 0, 11298, 11346, 0, 11393, 0, 0, 11425, 0, 11250, 11250, 0, 11250, 11458, 11138,
+    11507, 0, 11570, 11250, 11250, 11250, 11620, 11699, 11138, 11762, 0, 0, 0, 0, 0, 0,
+    0, 0, 11810, 0, 0, 11858, 0, 0, 11906, 0, 0, 0, 0, 0, 0, 11954,
+    11954, 12002, 12051, 12115,
+};
+
+constexpr uint8_t uk_level_data[] = {
+    0x01, 0x06, 0x01, 0x08, 0x11, 0x02, 0x1C, 0x02, 0x02, 0x15, 0x02, 0x06, 0x03, 0x08, 0x12, 0x03, 0x1C, 0x12, 0x03,
+    0x26, 0x03, 0x02, 0x21, 0x04, 0x08, 0x12, 0x04, 0x1C, 0x1C, 0x04, 0x26, 0x12, 0x04, 0x30, 0x04, 0x08, 0x1C, 0x04,
+    0x17, 0x04, 0x16, 0x04, 0x02, 0x15, 0x04, 0x18, 0x04, 0x03, 0x1A, 0x04, 0x1A, 0x05, 0x22, 0x05, 0x26, 0x1C, 0x05,
+    0x38, 0x05, 0x08, 0x1C, 0x05, 0x06, 0x05, 0x35, 0x06, 0x38, 0x10, 0x06, 0x2C, 0x17, 0x06, 0x40, 0x06, 0x2C, 0x06,
+    0x03, 0x18, 0x06, 0x03, 0x06, 0x02, 0x29, 0x06, 0x2E, 0x06, 0x03, 0x18, 0x18, 0x06, 0x02, 0x15, 0x06, 0x18, 0x18,
+    0x06, 0x03, 0x18, 0x17, 0x06, 0x18, 0x07, 0x36, 0x17, 0x07, 0x38, 0x1A, 0x07, 0x4A, 0x07, 0x06, 0x1A, 0x07, 0x03,
+    0x22, 0x07, 0x17, 0x22, 0x07, 0x36, 0x07, 0x03, 0x18, 0x07, 0x2C, 0x21, 0x07, 0x49, 0x08, 0x36, 0x21, 0x08, 0x53,
+    0x08, 0x40, 0x08, 0x2C, 0x08, 0x03, 0x08, 0x03, 0x18, 0x08, 0x2B, 0x18, 0x08, 0x04, 0x1B, 0x08, 0x18, 0x17, 0x18,
+    0x08, 0x2D, 0x18, 0x08, 0x2A, 0x15, 0x08, 0x17, 0x18, 0x08, 0x02, 0x15, 0x08, 0x03, 0x18, 0x18, 0x08, 0x2C, 0x17,
+    0x08, 0x40, 0x17, 0x08, 0x3F, 0x08, 0x54, 0x08, 0x02, 0x29, 0x09, 0x5E, 0x09, 0x35, 0x18, 0x09, 0x37, 0x18, 0x09,
+    0x4A, 0x09, 0x36, 0x09, 0x5D, 0x09, 0x4A, 0x17, 0x09, 0x22, 0x09, 0x06, 0x1A, 0x1A, 0x09, 0x2B, 0x22, 0x09, 0x03,
+    0x22, 0x09, 0x03, 0x18, 0x18, 0x0A, 0x37, 0x0A, 0x36, 0x0A, 0x54, 0x0A, 0x03, 0x18, 0x0A, 0x2C, 0x0A, 0x3F, 0x18,
+    0x0A, 0x17, 0x18, 0x0A, 0x2D, 0x0A, 0x03, 0x0A, 0x03, 0x18, 0x18, 0x0A, 0x40, 0x17, 0x0A, 0x40, 0x0A, 0x2C, 0x19,
+    0x0A, 0x2D, 0x18, 0x0A, 0x2D, 0x18, 0x18, 0x0A, 0x18, 0x2B, 0x18, 0x0A, 0x2B, 0x18, 0x0A, 0x2C, 0x1B, 0x18, 0x0A,
+    0x54, 0x17, 0x0A, 0x68, 0x0A, 0x3F, 0x0A, 0x40, 0x18, 0x0A, 0x2E, 0x19, 0x18, 0x0A, 0x40, 0x18, 0x17, 0x0B, 0x37,
+    0x18, 0x17, 0x0B, 0x37, 0x18, 0x0B, 0x4B, 0x0B, 0x49, 0x18, 0x0B, 0x5E, 0x17, 0x0B, 0x3F, 0x22, 0x0B, 0x06, 0x1A,
+    0x1A, 0x0B, 0x54, 0x21, 0x0B, 0x03, 0x18, 0x0B, 0x5E, 0x0C, 0x5E, 0x21, 0x0C, 0x2C, 0x0C, 0x03, 0x18, 0x0C, 0x2C,
+    0x17, 0x0C, 0x17, 0x18, 0x0C, 0x68, 0x17, 0x0C, 0x54, 0x0C, 0x54, 0x19, 0x0C, 0x03, 0x0C, 0x68, 0x0C, 0x53, 0x18,
+    0x0C, 0x03, 0x18, 0x18, 0x0C, 0x43, 0x0C, 0x2B, 0x18, 0x0C, 0x2C, 0x40, 0x17, 0x0C, 0x40, 0x0C, 0x2C, 0x19, 0x0C,
+    0x2C, 0x19, 0x18, 0x0C, 0x3F, 0x18, 0x0C, 0x2D, 0x18, 0x0C, 0x2C, 0x17, 0x18, 0x0C, 0x55, 0x18, 0x0C, 0x18, 0x19,
+    0x0C, 0x41, 0x0C, 0x2C, 0x17, 0x2C, 0x17, 0x0C, 0x18, 0x17, 0x18, 0x0D, 0x72, 0x17, 0x0D, 0x49, 0x2C, 0x17, 0x0D,
+    0x37, 0x18, 0x0D, 0x5D, 0x18, 0x0D, 0x5E, 0x17, 0x0D, 0x5F, 0x18, 0x0D, 0x53, 0x22, 0x0D, 0x5E, 0x0D, 0x2C, 0x23,
+    0x0D, 0x2D, 0x18, 0x0D, 0x2E, 0x19, 0x18, 0x0E, 0x03, 0x18, 0x0E, 0x2C, 0x17, 0x0E, 0x69, 0x0E, 0x2C, 0x17, 0x18,
+    0x0E, 0x7C, 0x0E, 0x54, 0x0E, 0x2C, 0x19, 0x18, 0x0E, 0x41, 0x18, 0x0E, 0x40, 0x0E, 0x2C, 0x18, 0x17, 0x0E, 0x2C,
+    0x18, 0x17, 0x18, 0x0E, 0x04, 0x17, 0x0E, 0x03, 0x18, 0x18, 0x0E, 0x2A, 0x2B, 0x0E, 0x2C, 0x18, 0x19, 0x0E, 0x40,
+    0x19, 0x18, 0x0E, 0x40, 0x17, 0x0E, 0x40, 0x19, 0x0E, 0x2C, 0x0E, 0x17, 0x18, 0x0E, 0x2B, 0x18, 0x0E, 0x2C, 0x1B,
+    0x18, 0x0E, 0x2C, 0x54, 0x0E, 0x3F, 0x18, 0x0E, 0x54, 0x19, 0x0E, 0x68, 0x0E, 0x2D, 0x18, 0x0E, 0x40, 0x3F, 0x0E,
+    0x2C, 0x19, 0x0E, 0x40, 0x17, 0x2C, 0x17, 0x0E, 0x41, 0x18, 0x18, 0x0E, 0x41, 0x0E, 0x2D, 0x18, 0x19, 0x0E, 0x7C,
+    0x17, 0x0E, 0x55, 0x0F, 0x4B, 0x18, 0x0F, 0x4A, 0x17, 0x0F, 0x5E, 0x17, 0x0F, 0x67, 0x22, 0x10, 0x2C, 0x17, 0x10,
+    0x2C, 0x17, 0x18, 0x10, 0x90, 0x10, 0x54, 0x10, 0x3F, 0x18, 0x10, 0x40, 0x17, 0x10, 0x2C, 0x18, 0x17, 0x18, 0x10,
+    0x55, 0x18, 0x10, 0x2C, 0x10, 0x41, 0x18, 0x10, 0x40, 0x17, 0x18, 0x10, 0x2C, 0x19, 0x2D, 0x10, 0x67, 0x18, 0x10,
+    0x54, 0x19, 0x10, 0x40, 0x19, 0x18, 0x10, 0x40, 0x19, 0x10, 0x43, 0x18, 0x10, 0x40, 0x10, 0x40, 0x2B, 0x10, 0x2C,
+    0x1B, 0x18, 0x10, 0x2B, 0x18, 0x10, 0x53, 0x18, 0x10, 0x68, 0x10, 0x2C, 0x18, 0x17, 0x10, 0x2C, 0x18, 0x19, 0x10,
+    0x54, 0x17, 0x10, 0x54, 0x18, 0x17, 0x11, 0x4A, 0x17, 0x11, 0x5E, 0x17, 0x12, 0x2C, 0x17, 0x12, 0x3F, 0x18, 0x12,
+    0x40, 0x2B, 0x12, 0x54, 0x17, 0x12, 0x53, 0x18, 0x12, 0x40, 0x17, 0x12, 0x40, 0x19, 0x12, 0x67, 0x18, 0x12, 0x69,
+    0x18, 0x12, 0x54, 0x19, 0x12, 0x2C, 0x18, 0x19, 0x12, 0x2C, 0x18, 0x17, 0x12, 0x2C, 0x19, 0x12, 0x55, 0x18, 0x12,
+    0x40, 0x12, 0x3F, 0x18, 0x18, 0x13, 0x4A, 0x17, 0x18, 0x13, 0x5E, 0x17, 0x14, 0x54, 0x17, 0x14, 0x2C, 0x2C, 0x17,
+    0x14, 0x67, 0x18, 0x14, 0x40, 0x17, 0x14, 0x7D, 0x18, 0x14, 0x2C, 0x14, 0x54, 0x14, 0x53, 0x18, 0x14, 0x2C, 0x18,
+    0x17, 0x14, 0x2C, 0x18, 0x14, 0x2C, 0x18, 0x18, 0x17, 0x14, 0x40, 0x18, 0x17, 0x14, 0x68, 0x17, 0x16, 0x68, 0x17,
+    0x16, 0x54, 0x2B, 0x16, 0x67, 0x18, 0x18, 0x7B, 0x18, 0x18, 0x7C, 0x17, 0x18, 0x68, 0x18, 0x17, 0x18, 0x2C, 0x18,
+    0x17,
+};
+
+constexpr HyphenationAutomaton uk_automaton = {
+    uk_symbols,
+    40u,
+    53u,
+    uk_dense,
+    10404u,
+    uk_label,
+    4u,
+    uk_child_base,
+    uk_child_offset,
+    uk_fail,
+    uk_levels,
+    uk_level_data,
 };
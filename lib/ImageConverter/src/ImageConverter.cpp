@@ -7,6 +7,7 @@
 #define TAG "IMG_CONV"
 #include <PngToBmpConverter.h>
 #include <SDCardManager.h>
+#include <ScaledBmpWriter.h>
 
 namespace {
 
@@ -27,6 +28,13 @@ class JpegImageConverter : public ImageConverter {
                                                                  config.shouldAbort);
   }
 
+  bool convertMulti(FsFile& input, const BmpOutputSpec* outputs, int count,
+                    const ImageConvertConfig& config) override {
+    return JpegToBmpConverter::jpegFileToBmpStreams(input, outputs, count, config.shouldAbort);
+  }
+
+  bool supportsMultiOutput() const override { return true; }
+
   const char* formatName() const override { return "JPEG"; }
 };
 
@@ -37,13 +45,21 @@ class PngImageConverter : public ImageConverter {
     if (config.quickMode) {
       return PngToBmpConverter::pngFileToBmpStreamQuick(input, output, config.maxWidth, config.maxHeight);
     }
-    // Note: PNG converter always produces 2-bit output. Unlike JPEG, PNG does not support
-    // 1-bit dithering (oneBit flag is ignored). PNG thumbnails will be slightly larger but
-    // render at the same speed since the display hardware handles both formats equally.
-    return PngToBmpConverter::pngFileToBmpStreamWithSize(input, output, config.maxWidth, config.maxHeight,
-                                                         config.shouldAbort);
+    BmpOutputSpec spec;
+    spec.out = &output;
+    spec.maxWidth = config.maxWidth;
+    spec.maxHeight = config.maxHeight;
+    spec.oneBit = config.oneBit;
+    return PngToBmpConverter::pngFileToBmpStreams(input, &spec, 1, config.shouldAbort);
+  }
+
+  bool convertMulti(FsFile& input, const BmpOutputSpec* outputs, int count,
+                    const ImageConvertConfig& config) override {
+    return PngToBmpConverter::pngFileToBmpStreams(input, outputs, count, config.shouldAbort);
   }
 
+  bool supportsMultiOutput() const override { return true; }
+
   const char* formatName() const override { return "PNG"; }
 };
 
@@ -119,4 +135,64 @@ bool ImageConverterFactory::convertToBmp(const std::string& inputPath, const std
   return success;
 }
 
+bool ImageConverterFactory::canConvertMulti(const std::string& filePath) {
+  const ImageConverter* converter = getConverter(filePath);
+  return converter && converter->supportsMultiOutput();
+}
+
+bool ImageConverterFactory::convertToBmps(const std::string& inputPath, const ImageConvertOutput* outputs,
+                                          const int count, const ImageConvertConfig& config) {
+  ImageConverter* converter = getConverter(inputPath);
+  if (!converter || !converter->supportsMultiOutput()) {
+    LOG_ERR(config.logTag, "No single-pass converter for: %s", inputPath.c_str());
+    return false;
+  }
+  if (count < 1 || count > MAX_BMP_OUTPUTS) {
+    LOG_ERR(config.logTag, "Invalid output count: %d", count);
+    return false;
+  }
+
+  FsFile inputFile;
+  if (!SdMan.openFileForRead(config.logTag, inputPath, inputFile)) {
+    LOG_ERR(config.logTag, "Failed to open input file: %s", inputPath.c_str());
+    return false;
+  }
+
+  FsFile outputFiles[MAX_BMP_OUTPUTS];
+  BmpOutputSpec specs[MAX_BMP_OUTPUTS];
+  bool success = true;
+  for (int i = 0; i < count; i++) {
+    if (!SdMan.openFileForWrite(config.logTag, outputs[i].path, outputFiles[i])) {
+      LOG_ERR(config.logTag, "Failed to create output file: %s", outputs[i].path.c_str());
+      success = false;
+      break;
+    }
+    specs[i].out = &outputFiles[i];
+    specs[i].maxWidth = outputs[i].maxWidth;
+    specs[i].maxHeight = outputs[i].maxHeight;
+    specs[i].oneBit = outputs[i].oneBit;
+    specs[i].quickMode = config.quickMode;
+  }
+
+  if (success) {
+    success = converter->convertMulti(inputFile, specs, count, config);
+  }
+
+  inputFile.close();
+  for (int i = 0; i < count; i++) {
+    if (outputFiles[i]) outputFiles[i].close();
+  }
+
+  if (success) {
+    LOG_INF(config.logTag, "Converted %s to %d BMP(s) in one pass", converter->formatName(), count);
+  } else {
+    LOG_ERR(config.logTag, "Failed to convert %s to BMP", converter->formatName());
+    for (int i = 0; i < count; i++) {
+      SdMan.remove(outputs[i].path.c_str());
+    }
+  }
+
+  return success;
+}
+
 bool ImageConverterFactory::isSupported(const std::string& filePath) { return FsHelpers::isImageFile(filePath); }
@@ -5,6 +5,7 @@
 
 class FsFile;
 class Print;
+struct BmpOutputSpec;
 
 struct ImageConvertConfig {
   int maxWidth = 450;
@@ -15,10 +16,28 @@ struct ImageConvertConfig {
   std::function<bool()> shouldAbort = nullptr;
 };
 
+// One BMP file produced by ImageConverterFactory::convertToBmps
+struct ImageConvertOutput {
+  std::string path;
+  int maxWidth = 450;
+  int maxHeight = 750;
+  bool oneBit = false;
+};
+
 class ImageConverter {
  public:
   virtual ~ImageConverter() = default;
   virtual bool convert(FsFile& input, Print& output, const ImageConvertConfig& config) = 0;
+  // Decode the input once and write every output in the same pass.
+  // Returns false if the format cannot produce multiple outputs from one decode.
+  virtual bool convertMulti(FsFile& input, const BmpOutputSpec* outputs, int count, const ImageConvertConfig& config) {
+    (void)input;
+    (void)outputs;
+    (void)count;
+    (void)config;
+    return false;
+  }
+  virtual bool supportsMultiOutput() const { return false; }
   virtual const char* formatName() const = 0;
 };
 
@@ -31,6 +50,16 @@ class ImageConverterFactory {
   static bool convertToBmp(const std::string& inputPath, const std::string& outputPath,
                            const ImageConvertConfig& config = {});
 
+  // Decode once, write several BMPs (e.g. cover + thumbnail). Only config.logTag,
+  // config.quickMode and config.shouldAbort are used; sizes and depth come from outputs.
+  // On failure all outputs are removed. Returns false for formats without multi-output
+  // support (see canConvertMulti), in which case nothing is written.
+  static bool convertToBmps(const std::string& inputPath, const ImageConvertOutput* outputs, int count,
+                            const ImageConvertConfig& config = {});
+
+  // True if convertToBmps can serve this file with a single decode
+  static bool canConvertMulti(const std::string& filePath);
+
   // Check if format is supported
   static bool isSupported(const std::string& filePath);
 };
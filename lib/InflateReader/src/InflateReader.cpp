@@ -4,7 +4,7 @@
 #include <type_traits>
 
 namespace {
-constexpr size_t INFLATE_DICT_SIZE = 32768;
+constexpr size_t INFLATE_DICT_SIZE = InflateReader::WINDOW_SIZE;
 }
 
 // Guarantee the cast pattern in the header comment is valid.
@@ -81,3 +81,33 @@ InflateStatus InflateReader::readAtMost(uint8_t* dest, size_t maxLen, size_t* pr
   if (res < 0) return InflateStatus::Error;
   return InflateStatus::Ok;
 }
+
+bool InflateReader::makeCheckpoint(const uint32_t inputDelivered, const uint32_t outOffset,
+                                   InflateCheckpoint* cp) const {
+  if (!ringBuffer || !atBlockBoundary() || outOffset < INFLATE_DICT_SIZE) return false;
+
+  // Input not consumed yet: the rest of the source buffer, plus whole bytes the bit buffer read ahead
+  const size_t buffered = decomp.source_limit > decomp.source ? decomp.source_limit - decomp.source : 0;
+  const size_t unread = buffered + decomp.bitcount / 8;
+  if (unread > inputDelivered) return false;
+
+  cp->outOffset = outOffset;
+  cp->inOffset = inputDelivered - static_cast<uint32_t>(unread);
+  cp->bitCount = static_cast<uint8_t>(decomp.bitcount % 8);
+  cp->bits = static_cast<uint8_t>(decomp.tag & ((1u << cp->bitCount) - 1));
+  return true;
+}
+
+void InflateReader::resumeAt(const InflateCheckpoint& cp) {
+  decomp.source = nullptr;
+  decomp.source_limit = nullptr;
+  decomp.eof = false;
+  decomp.truncated = false;
+  decomp.tag = cp.bits;
+  decomp.bitcount = cp.bitCount;
+  decomp.btype = -1;
+  decomp.bfinal = 0;
+  decomp.curlen = 0;
+  // The window is stored oldest byte first, so the ring is full and wraps at 0
+  decomp.dict_idx = 0;
+}
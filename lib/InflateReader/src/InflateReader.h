@@ -11,6 +11,16 @@ enum class InflateStatus {
   Error,  // Decompression failed.
 };
 
+// Restart point at a deflate block boundary (zran-style). Together with the 32KB of output that
+// preceded it (the ring buffer, see window()), it lets a fresh reader resume decoding there
+// instead of inflating the stream from the start.
+struct InflateCheckpoint {
+  uint32_t outOffset;  // Bytes of output produced before this point
+  uint32_t inOffset;   // Whole bytes of input consumed before this point
+  uint8_t bitCount;    // Bits of the last consumed byte not decoded yet (0-7)
+  uint8_t bits;        // Their values, next bit lowest
+};
+
 // Streaming deflate decompressor wrapping uzlib.
 //
 // Two modes:
@@ -79,6 +89,28 @@ class InflateReader {
   // and Error on failure.
   InflateStatus readAtMost(uint8_t* dest, size_t maxLen, size_t* produced);
 
+  // --- Checkpoints (streaming mode) ---
+
+  // When enabled, readAtMost() also returns Ok (with a partly filled buffer) each time a deflate
+  // block ends, so the caller can take a checkpoint there.
+  void setStopAtBlockBoundary(bool stop) { decomp.stop_at_block = stop; }
+  bool atBlockBoundary() const { return decomp.btype == -1 && decomp.curlen == 0; }
+
+  // Describe the current position. inputDelivered is the number of input bytes handed to uzlib
+  // so far (via setSource() or the read callback); outOffset the output produced so far.
+  // Only valid at a block boundary with at least a full window of output behind it.
+  bool makeCheckpoint(uint32_t inputDelivered, uint32_t outOffset, InflateCheckpoint* cp) const;
+
+  // Ring buffer holding the last 32KB of output. Its oldest byte is at windowSplit(), so saving
+  // [windowSplit(), WINDOW_SIZE) followed by [0, windowSplit()) gives the window in order.
+  static constexpr size_t WINDOW_SIZE = 32768;
+  uint8_t* window() { return ringBuffer; }
+  size_t windowSplit() const { return decomp.dict_idx; }
+
+  // Continue decoding at cp. The ring buffer must hold the saved window (oldest byte first) and
+  // the input source must be positioned at cp.inOffset.
+  void resumeAt(const InflateCheckpoint& cp);
+
   // Returns a pointer to the underlying TINF_DATA.
   uzlib_uncomp* raw() { return &decomp; }
 
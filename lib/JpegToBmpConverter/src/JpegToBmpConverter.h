@@ -5,6 +5,7 @@
 class FsFile;
 class Print;
 class ZipFile;
+struct BmpOutputSpec;
 
 class JpegToBmpConverter {
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
@@ -12,6 +13,8 @@ class JpegToBmpConverter {
   static bool jpegFileToBmpStreamInternal(class FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
                                           bool oneBit, bool quickMode = false,
                                           const std::function<bool()>& shouldAbort = nullptr);
+  static bool jpegFileToBmpStreamsInternal(FsFile& jpegFile, const BmpOutputSpec* outputs, int count,
+                                           const std::function<bool()>& shouldAbort);
 
  public:
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut);
@@ -24,4 +27,7 @@ class JpegToBmpConverter {
   static bool jpegFileTo1BitBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
   // Quick preview mode: simple threshold instead of dithering (faster but lower quality)
   static bool jpegFileToBmpStreamQuick(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Decode once and write up to MAX_BMP_OUTPUTS BMPs (e.g. cover + thumbnail) in the same pass
+  static bool jpegFileToBmpStreams(FsFile& jpegFile, const BmpOutputSpec* outputs, int count,
+                                   const std::function<bool()>& shouldAbort = nullptr);
 };
@@ -16,7 +16,7 @@
 Markdown::Markdown(std::string filepath, const std::string& cacheDir)
     : filepath(std::move(filepath)), fileSize(0), loaded(false) {
   // Create cache key based on filepath (same as Epub/Xtc/Txt)
-  cachePath = cacheDir + "/md_" + std::to_string(std::hash<std::string>{}(this->filepath));
+  cachePath = cacheDir + "/md_" + std::to_string(FsHelpers::pathHash(this->filepath));
 
   // Extract title from filename
   size_t lastSlash = this->filepath.find_last_of('/');
@@ -130,8 +130,9 @@ bool Markdown::generateCoverBmp(bool use1BitDithering) const {
   // Setup cache directory
   setupCacheDir();
 
-  // Convert to BMP using shared helper
-  const bool success = CoverHelpers::convertImageToBmp(coverImagePath, coverPath, "MD ", use1BitDithering);
+  // Convert to BMP using shared helper (thumbnail comes out of the same decode)
+  const bool success =
+      CoverHelpers::convertImageToCoverAndThumb(coverImagePath, coverPath, getThumbBmpPath(), "MD ", use1BitDithering);
   if (!success) {
     // Create failure marker
     FsFile marker;
@@ -14,9 +14,12 @@
 #include <ParsedText.h>
 #include <SDCardManager.h>
 #include <Utf8.h>
+#include <WordTokenizer.h>
 #include <blocks/TextBlock.h>
 #include <esp_heap_caps.h>
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "md_parser.h"
@@ -138,16 +141,37 @@ bool MarkdownParser::addLineToPage(ParseContext& ctx, std::shared_ptr<TextBlock>
   return true;
 }
 
-bool MarkdownParser::readLine(FsFile& file) {
-  int i = 0;
+bool MarkdownParser::readLine(LineReader& in) {
+  size_t i = 0;
   bool readAnyChar = false;
   while (i < LINE_BUFFER_SIZE - 1) {
-    int c = file.read();
-    if (c < 0) break;
+    if (in.pos == in.length) {
+      const int bytesRead = in.file.read(in.buffer, sizeof(in.buffer));
+      if (bytesRead <= 0) break;
+      in.length = static_cast<size_t>(bytesRead);
+      in.pos = 0;
+    }
     readAnyChar = true;
-    if (c == '\n') break;
-    if (c == '\r') continue;
-    lineBuffer_[i++] = static_cast<char>(c);
+
+    const char* start = in.buffer + in.pos;
+    const size_t available = std::min(in.length - in.pos, LINE_BUFFER_SIZE - 1 - i);
+    const char* newline = static_cast<const char*>(memchr(start, '\n', available));
+    const size_t take = newline ? static_cast<size_t>(newline - start) : available;
+
+    // Copy up to the newline, dropping CRs
+    char* out = lineBuffer_ + i;
+    memcpy(out, start, take);
+    if (memchr(out, '\r', take)) {
+      out = std::remove(out, out + take, '\r');
+    } else {
+      out += take;
+    }
+    i = static_cast<size_t>(out - lineBuffer_);
+
+    const size_t used = take + (newline ? 1 : 0);
+    in.pos += used;
+    in.consumed += used;
+    if (newline) break;
   }
   lineBuffer_[i] = '\0';
   return readAnyChar;
@@ -163,20 +187,39 @@ bool MarkdownParser::tokenCallback(const md_token_t* token, void* userData) {
 
   switch (token->type) {
     case MD_TEXT: {
-      // Process text character by character to split into words
-      for (uint16_t i = 0; i < token->length; i++) {
-        char c = token->text[i];
-        if (isWhitespaceChar(c)) {
+      // A word touching either end of the text may join the text of the next or previous token,
+      // so it goes through the word buffer; whole ASCII words in between go straight to the block
+      if (token->length > 0 && isWhitespaceChar(token->text[0])) {
+        self->flushWordBuffer(ctx);
+      }
+      WordTokenizer words(token->text, token->length, MAX_WORD_SIZE);
+      WordTokenizer::Token word;
+      while (words.next(word)) {
+        if (word.kind == WordTokenizer::Kind::NEWLINE) {
           self->flushWordBuffer(ctx);
-        } else {
-          if (ctx.wordBufferIndex >= MAX_WORD_SIZE) {
-            ctx.wordBuffer[ctx.wordBufferIndex] = '\0';
-            if (ctx.textBlock) {
-              ctx.textBlock->addWord(ctx.wordBuffer, static_cast<EpdFontFamily::Style>(self->getCurrentFontStyle(ctx)));
-            }
-            ctx.wordBufferIndex = 0;
+          continue;
+        }
+        if (ctx.wordBufferIndex == 0 && word.ascii && !word.cut) {
+          if (ctx.textBlock) {
+            ctx.textBlock->addWord(std::string(word.text, word.length),
+                                   static_cast<EpdFontFamily::Style>(self->getCurrentFontStyle(ctx)));
           }
-          ctx.wordBuffer[ctx.wordBufferIndex++] = c;
+          continue;
+        }
+        const char* text = word.text;
+        size_t length = word.length;
+        while (ctx.wordBufferIndex + length > MAX_WORD_SIZE) {
+          const size_t room = MAX_WORD_SIZE - ctx.wordBufferIndex;
+          memcpy(ctx.wordBuffer + ctx.wordBufferIndex, text, room);
+          ctx.wordBufferIndex = MAX_WORD_SIZE;
+          self->flushWordBuffer(ctx);
+          text += room;
+          length -= room;
+        }
+        memcpy(ctx.wordBuffer + ctx.wordBufferIndex, text, length);
+        ctx.wordBufferIndex += static_cast<int>(length);
+        if (!word.cut) {
+          self->flushWordBuffer(ctx);
         }
       }
       break;
@@ -341,12 +384,14 @@ bool MarkdownParser::parsePages(const std::function<void(std::unique_ptr<Page>)>
   }
 
   file.seekSet(currentOffset_);
+  LineReader in(file);
 
   if (currentOffset_ == 0 && !isRtl_) {
-    if (readLine(file)) {
+    if (readLine(in)) {
       isRtl_ = ScriptDetector::containsArabic(lineBuffer_);
     }
     file.seekSet(currentOffset_);
+    in.length = in.pos = in.consumed = 0;
   }
 
   LOG_INF(TAG, "Parsing from offset %zu, file size %zu", currentOffset_, fileSize_);
@@ -385,10 +430,10 @@ bool MarkdownParser::parsePages(const std::function<void(std::unique_ptr<Page>)>
       break;
     }
 
-    if (!readLine(file)) {
+    if (!readLine(in)) {
       break;
     }
-    bytesProcessed = file.position() - currentOffset_;
+    bytesProcessed = in.consumed;
 
     int lineLen = strlen(lineBuffer_);
 
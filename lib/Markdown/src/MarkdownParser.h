@@ -26,11 +26,12 @@ class TextBlock;
 
 constexpr int MAX_WORD_SIZE = 200;
 constexpr int LINE_BUFFER_SIZE = 512;
+constexpr int READ_BUFFER_SIZE = 2048;
 
 /**
  * Content parser for Markdown files using md_parser tokenization.
  * Parses markdown syntax (headers, bold, italic, lists, etc.) into styled text.
- * Minimal memory usage - reads line by line from SD card.
+ * Minimal memory usage - reads the SD card in chunks and parses them line by line.
  */
 class MarkdownParser : public ContentParser {
  public:
@@ -56,6 +57,17 @@ class MarkdownParser : public ContentParser {
   // Line buffer for reading from file
   char lineBuffer_[LINE_BUFFER_SIZE];
 
+  // Chunked reads from the file, handed out a line at a time by readLine()
+  struct LineReader {
+    FsFile& file;
+    char buffer[READ_BUFFER_SIZE];
+    size_t length = 0;
+    size_t pos = 0;
+    size_t consumed = 0;  // Bytes of the file returned as lines, newlines included
+
+    explicit LineReader(FsFile& file) : file(file) {}
+  };
+
   // Parsing context passed through md_parser callback
   struct ParseContext {
     MarkdownParser* self;
@@ -80,7 +92,7 @@ class MarkdownParser : public ContentParser {
   static bool tokenCallback(const md_token_t* token, void* userData);
 
   // Helpers
-  bool readLine(FsFile& file);
+  bool readLine(LineReader& in);
   void flushWordBuffer(ParseContext& ctx);
   void flushTextBlock(ParseContext& ctx);
   bool addLineToPage(ParseContext& ctx, std::shared_ptr<TextBlock> line);
@@ -54,6 +54,20 @@ class ContentParser {
    */
   virtual void reset() = 0;
 
+  /**
+   * Where to persist resume checkpoints while parsing (one file, overwritten).
+   * Parsers that can't checkpoint ignore it.
+   */
+  virtual void setCheckpointPath(const std::string& /*path*/) {}
+
+  /**
+   * Continue the next parsePages() from the persisted checkpoint instead of the start.
+   * Call after reset(). Pages before the checkpoint are not emitted again.
+   * @param pagesDone Pages already cached; later checkpoints are ignored
+   * @return Pages before the checkpoint, or 0 to parse from the start
+   */
+  virtual uint16_t resumeFromCheckpoint(uint16_t /*pagesDone*/) { return 0; }
+
   /**
    * Get anchor-to-page mapping (element id → page index).
    * Only meaningful for EPUB parsers; returns empty for other formats.
@@ -2,16 +2,24 @@
 
 #include <Epub/parsers/ChapterHtmlSlimParser.h>
 #include <GfxRenderer.h>
-#include <Html5Normalizer.h>
 #include <Hyphenation.h>
 #include <Logging.h>
 #include <Page.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
 
 #define TAG "EPUB_CHAP"
 
 #include <utility>
 
+namespace {
+// Checkpoint file: magic (4), version (1), spine index (4), pages before it (2), chapter offset (4),
+// then the ChapterHtmlSlimParser state. The magic is written last, so a file cut short is never used.
+constexpr uint32_t CHECKPOINT_MAGIC = 0x4B435045;  // "EPCK"
+constexpr uint8_t CHECKPOINT_VERSION = 1;
+constexpr uint32_t CHECKPOINT_HEADER_SIZE = 4 + 1 + 4 + 2 + 4;
+}  // namespace
+
 EpubChapterParser::EpubChapterParser(std::shared_ptr<Epub> epub, int spineIndex, GfxRenderer& renderer,
                                      const RenderConfig& config, const std::string& imageCachePath)
     : epub_(std::move(epub)),
@@ -30,10 +38,6 @@ void EpubChapterParser::cleanupTempFiles() {
     SdMan.remove(tmpHtmlPath_.c_str());
     tmpHtmlPath_.clear();
   }
-  if (!normalizedPath_.empty()) {
-    SdMan.remove(normalizedPath_.c_str());
-    normalizedPath_.clear();
-  }
 }
 
 void EpubChapterParser::reset() {
@@ -41,9 +45,83 @@ void EpubChapterParser::reset() {
   cleanupTempFiles();
   initialized_ = false;
   hasMore_ = true;
-  parseHtmlPath_.clear();
   chapterBasePath_.clear();
   anchorMap_.clear();
+  pagesEmitted_ = 0;
+  resumePages_ = 0;
+}
+
+void EpubChapterParser::saveCheckpoint(const uint32_t offset) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("EPUB", checkpointPath_, file)) {
+    return;
+  }
+  serialization::writePod(file, static_cast<uint32_t>(0));
+  serialization::writePod(file, CHECKPOINT_VERSION);
+  serialization::writePod(file, static_cast<int32_t>(spineIndex_));
+  serialization::writePod(file, pagesEmitted_);
+  serialization::writePod(file, offset);
+  const bool ok = liveParser_->writeCheckpoint(file);
+  if (ok) {
+    file.seek(0);
+    serialization::writePod(file, CHECKPOINT_MAGIC);
+  }
+  file.close();
+
+  if (!ok) {
+    SdMan.remove(checkpointPath_.c_str());
+    return;
+  }
+  LOG_DBG(TAG, "Checkpoint after %u pages at offset %u", pagesEmitted_, offset);
+}
+
+void EpubChapterParser::dropCheckpoint() {
+  if (!checkpointPath_.empty() && SdMan.exists(checkpointPath_.c_str())) {
+    SdMan.remove(checkpointPath_.c_str());
+  }
+}
+
+bool EpubChapterParser::restoreCheckpoint() {
+  FsFile file;
+  if (!SdMan.openFileForRead("EPUB", checkpointPath_, file)) {
+    return false;
+  }
+  file.seek(CHECKPOINT_HEADER_SIZE);
+  const bool ok = liveParser_->restoreCheckpoint(file);
+  file.close();
+  return ok;
+}
+
+uint16_t EpubChapterParser::resumeFromCheckpoint(const uint16_t pagesDone) {
+  resumePages_ = 0;
+  if (checkpointPath_.empty() || initialized_) {
+    return 0;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForRead("EPUB", checkpointPath_, file)) {
+    return 0;
+  }
+  uint32_t magic = 0;
+  uint8_t version = 0;
+  int32_t spineIndex = -1;
+  uint16_t pages = 0;
+  uint32_t offset = 0;
+  const bool ok = serialization::readPodChecked(file, magic) && serialization::readPodChecked(file, version) &&
+                  serialization::readPodChecked(file, spineIndex) && serialization::readPodChecked(file, pages) &&
+                  serialization::readPodChecked(file, offset);
+  file.close();
+
+  // A checkpoint past the cached pages was written by a batch that never reached the cache
+  if (!ok || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION || spineIndex != spineIndex_ || pages == 0 ||
+      pages > pagesDone) {
+    return 0;
+  }
+
+  LOG_INF(TAG, "Resuming after %u pages at offset %u", pages, offset);
+  resumePages_ = pages;
+  resumeOffset_ = offset;
+  return pages;
 }
 
 const std::vector<std::pair<std::string, uint16_t>>& EpubChapterParser::getAnchorMap() const {
@@ -75,17 +153,28 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
       cleanupTempFiles();
       initialized_ = false;
       renderer_.clearWidthCache();
+      if (!hasMore_) dropCheckpoint();
     }
 
     return success || pagesCreated_ > 0;
   }
 
-  // INIT PATH: first call — extract HTML, normalize, create parser
+  // INIT PATH: first call — extract HTML, create parser
   // Set up hyphenation language from EPUB metadata
   Hyphenation::setLanguage(epub_->getLanguage());
 
+  // Resuming from a checkpoint only needs the chapter from its offset on. A parse from the start
+  // writes its own checkpoints, so an older one is dropped.
+  const uint16_t resumedPages = resumePages_;
+  const bool resuming = resumedPages > 0;
+  resumePages_ = 0;
+  if (!resuming) {
+    dropCheckpoint();
+  }
+
   const auto localPath = epub_->getSpineItem(spineIndex_).href;
   tmpHtmlPath_ = epub_->getCachePath() + "/.tmp_" + std::to_string(spineIndex_) + ".html";
+  const std::string inflateCheckpointPath = epub_->getCachePath() + "/inflate_" + std::to_string(spineIndex_) + ".bin";
 
   // Derive chapter base path for resolving relative image paths
   {
@@ -115,7 +204,9 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
     }
     // Reuse frame buffer (48KB) as ZIP decompression dict (32KB) — safe because
     // the background task owns the renderer and display isn't active during parsing
-    success = epub_->readItemContentsToStream(localPath, tmpHtml, 1024, renderer_.getFrameBuffer());
+    // Large chapters keep inflate checkpoints in the book cache for later partial reads
+    success = epub_->readItemContentsToStream(localPath, tmpHtml, 1024, renderer_.getFrameBuffer(),
+                                              inflateCheckpointPath.c_str(), resuming ? resumeOffset_ : 0);
     tmpHtml.close();
 
     if (!success && SdMan.exists(tmpHtmlPath_.c_str())) {
@@ -128,13 +219,6 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
     return false;
   }
 
-  // Normalize HTML5 void elements for Expat parser
-  normalizedPath_ = epub_->getCachePath() + "/.norm_" + std::to_string(spineIndex_) + ".html";
-  parseHtmlPath_ = tmpHtmlPath_;
-  if (html5::normalizeVoidElements(tmpHtmlPath_, normalizedPath_)) {
-    parseHtmlPath_ = normalizedPath_;
-  }
-
   // Create read callback for extracting images from EPUB
   auto readItemFn = [this](const std::string& href, Print& out, size_t chunkSize) -> bool {
     return epub_->readItemContentsToStream(href, out, chunkSize);
@@ -152,6 +236,7 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
 
     onPageComplete_(std::move(page));
     pagesCreated_++;
+    pagesEmitted_++;
 
     if (maxPages_ > 0 && pagesCreated_ >= maxPages_) {
       hitMaxPages_ = true;
@@ -160,11 +245,30 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
     return true;
   };
 
-  liveParser_.reset(new ChapterHtmlSlimParser(parseHtmlPath_, renderer_, config_, wrappedCallback, nullptr,
+  liveParser_.reset(new ChapterHtmlSlimParser(tmpHtmlPath_, renderer_, config_, wrappedCallback, nullptr,
                                               chapterBasePath_, imageCachePath_, readItemFn, epub_->getCssParser(),
                                               shouldAbort));
+  if (!checkpointPath_.empty()) {
+    liveParser_->setCheckpointFn([this](const uint32_t offset) { saveCheckpoint(offset); },
+                                 resuming ? resumeOffset_ : 0);
+  }
 
-  success = liveParser_->parseAndBuildPages();
+  if (resuming) {
+    if (!restoreCheckpoint()) {
+      // Leave the chapter partial; the next extend parses it from the start
+      LOG_ERR(TAG, "Failed to restore checkpoint");
+      dropCheckpoint();
+      liveParser_.reset();
+      cleanupTempFiles();
+      hasMore_ = true;
+      return false;
+    }
+    pagesEmitted_ = resumedPages;
+    success = liveParser_->resumeParsing();
+  } else {
+    pagesEmitted_ = 0;
+    success = liveParser_->parseAndBuildPages();
+  }
   initialized_ = true;
 
   hasMore_ = liveParser_->isSuspended() || liveParser_->wasAborted() || (!success && pagesCreated_ > 0);
@@ -176,6 +280,7 @@ bool EpubChapterParser::parsePages(const std::function<void(std::unique_ptr<Page
     cleanupTempFiles();
     initialized_ = false;
     renderer_.clearWidthCache();
+    if (!hasMore_) dropCheckpoint();
   }
 
   return success || pagesCreated_ > 0;
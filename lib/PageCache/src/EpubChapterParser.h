@@ -30,8 +30,6 @@ class EpubChapterParser : public ContentParser {
   // Persistent parser state for incremental parsing (hot extend)
   std::unique_ptr<ChapterHtmlSlimParser> liveParser_;
   std::string tmpHtmlPath_;
-  std::string normalizedPath_;
-  std::string parseHtmlPath_;
   std::string chapterBasePath_;
   bool initialized_ = false;
 
@@ -46,7 +44,16 @@ class EpubChapterParser : public ContentParser {
   // Captured anchor map from parser (persisted after liveParser_ is destroyed)
   std::vector<std::pair<std::string, uint16_t>> anchorMap_;
 
+  // Resume checkpoints (see ContentParser::setCheckpointPath)
+  std::string checkpointPath_;
+  uint16_t pagesEmitted_ = 0;   // Pages emitted since the start of the chapter
+  uint16_t resumePages_ = 0;    // Set by resumeFromCheckpoint(): pages before the checkpoint
+  uint32_t resumeOffset_ = 0;   // ...and the chapter offset to continue from
+
   void cleanupTempFiles();
+  void saveCheckpoint(uint32_t offset);
+  bool restoreCheckpoint();
+  void dropCheckpoint();
 
  public:
   EpubChapterParser(std::shared_ptr<Epub> epub, int spineIndex, GfxRenderer& renderer, const RenderConfig& config,
@@ -58,5 +65,7 @@ class EpubChapterParser : public ContentParser {
   bool hasMoreContent() const override { return hasMore_; }
   bool canResume() const override { return initialized_ && liveParser_ != nullptr; }
   void reset() override;
+  void setCheckpointPath(const std::string& path) override { checkpointPath_ = path; }
+  uint16_t resumeFromCheckpoint(uint16_t pagesDone) override;
   const std::vector<std::pair<std::string, uint16_t>>& getAnchorMap() const override;
 };
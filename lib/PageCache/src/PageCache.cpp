@@ -11,7 +11,7 @@
 #include "ContentParser.h"
 
 namespace {
-constexpr uint8_t CACHE_FILE_VERSION = 17;  // v17: fix external font width fallback for Latin chars
+constexpr uint8_t CACHE_FILE_VERSION = 20;  // v20: FB2 inline images
 
 // Header layout:
 // - version (1 byte)
@@ -32,6 +32,8 @@ constexpr uint32_t HEADER_SIZE = 1 + 4 + 4 + 1 + 1 + 1 + 1 + 1 + 2 + 2 + 2 + 1 +
 
 PageCache::PageCache(std::string cachePath) : cachePath_(std::move(cachePath)) {}
 
+PageCache::~PageCache() = default;
+
 bool PageCache::writeHeader(bool isPartial) {
   file_.seek(0);
   serialization::writePod(file_, CACHE_FILE_VERSION);
@@ -179,8 +181,10 @@ bool PageCache::load(const RenderConfig& config) {
 }
 
 bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16_t maxPages, uint16_t skipPages,
-                       const AbortCallback& shouldAbort) {
+                       const AbortCallback& shouldAbort, const uint16_t resumedPages) {
   const unsigned long startMs = millis();
+  prefetched_.reset();
+  parser.setCheckpointPath(checkpointPath());
 
   std::vector<uint32_t> lut;
 
@@ -219,7 +223,7 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
     return false;
   }
 
-  uint16_t parsedPages = 0;
+  uint16_t parsedPages = resumedPages;
   bool hitMaxPages = false;
   bool aborted = false;
 
@@ -249,7 +253,7 @@ bool PageCache::create(ContentParser& parser, const RenderConfig& config, uint16
           hitMaxPages = true;
         }
       },
-      maxPages, shouldAbort);
+      maxPages > 0 ? maxPages - resumedPages : 0, shouldAbort);
 
   // Check if we were aborted
   if (shouldAbort && shouldAbort()) {
@@ -338,12 +342,15 @@ bool PageCache::extend(ContentParser& parser, uint16_t additionalPages, const Ab
     return true;
   }
 
-  // COLD PATH: Fresh parser (after exit/reboot) — re-parse from start, skip cached pages.
+  // COLD PATH: Fresh parser (after exit/reboot) — re-parse from the last checkpoint, or the
+  // start without one, skipping cached pages.
   const uint16_t targetPages = pageCount_ + chunk;
   LOG_INF(TAG, "Cold extend from %d to %d pages", currentPages, targetPages);
 
   parser.reset();
-  bool result = create(parser, config_, targetPages, currentPages, shouldAbort);
+  parser.setCheckpointPath(checkpointPath());
+  const uint16_t resumedPages = parser.resumeFromCheckpoint(currentPages);
+  bool result = create(parser, config_, targetPages, currentPages, shouldAbort, resumedPages);
 
   // No forward progress AND parser has no more content → content is truly finished.
   // Without the hasMoreContent() check, an aborted extend (timeout/memory pressure)
@@ -357,6 +364,10 @@ bool PageCache::extend(ContentParser& parser, uint16_t additionalPages, const Ab
 }
 
 std::unique_ptr<Page> PageCache::loadPage(uint16_t pageNum) {
+  if (prefetched_ && prefetchedNum_ == pageNum) {
+    return std::move(prefetched_);
+  }
+
   if (pageNum >= pageCount_) {
     LOG_ERR(TAG, "Page %d out of range (max %d)", pageNum, pageCount_);
     return nullptr;
@@ -406,7 +417,20 @@ std::unique_ptr<Page> PageCache::loadPage(uint16_t pageNum) {
   return nullptr;
 }
 
+void PageCache::prefetchPage(const uint16_t pageNum) {
+  if (pageNum >= pageCount_ || (prefetched_ && prefetchedNum_ == pageNum)) {
+    return;
+  }
+  prefetched_.reset();
+  prefetched_ = loadPage(pageNum);
+  prefetchedNum_ = pageNum;
+}
+
 bool PageCache::clear() const {
+  const std::string resumePath = checkpointPath();
+  if (SdMan.exists(resumePath.c_str())) {
+    SdMan.remove(resumePath.c_str());
+  }
   if (!SdMan.exists(cachePath_.c_str())) {
     return true;
   }
@@ -32,14 +32,17 @@ class PageCache {
   bool isPartial_ = false;
   RenderConfig config_;
   uint32_t lutOffset_ = 0;  // Cached LUT offset for extend operations
+  std::unique_ptr<Page> prefetched_;
+  uint16_t prefetchedNum_ = 0;
 
   bool writeHeader(bool isPartial);
   bool writeLut(const std::vector<uint32_t>& lut);
   bool loadLut(std::vector<uint32_t>& lut);  // Load existing LUT for extend
+  std::string checkpointPath() const { return cachePath_ + ".resume"; }
 
  public:
   explicit PageCache(std::string cachePath);
-  ~PageCache() = default;
+  ~PageCache();
 
   /**
    * Try to load existing cache from disk.
@@ -61,14 +64,16 @@ class PageCache {
    * @param maxPages Maximum pages to cache (0 = unlimited)
    * @param skipPages Skip serializing first N pages (for extend)
    * @param shouldAbort Optional callback to check for cancellation
+   * @param resumedPages Pages the parser won't emit because it resumes from a checkpoint (<= skipPages)
    * @return true on success
    */
   bool create(ContentParser& parser, const RenderConfig& config, uint16_t maxPages = DEFAULT_CACHE_CHUNK,
-              uint16_t skipPages = 0, const AbortCallback& shouldAbort = nullptr);
+              uint16_t skipPages = 0, const AbortCallback& shouldAbort = nullptr, uint16_t resumedPages = 0);
 
   /**
    * Extend cache with more pages.
-   * Re-parses content but skips already-cached pages, then appends new pages.
+   * Re-parses content (from the parser's last checkpoint if it has one) but skips
+   * already-cached pages, then appends new pages.
    * @param parser Content parser (will be reset)
    * @param additionalPages Number of additional pages to cache
    * @param shouldAbort Optional callback to check for cancellation
@@ -85,7 +90,14 @@ class PageCache {
   std::unique_ptr<Page> loadPage(uint16_t pageNum);
 
   /**
-   * Clear cache from disk.
+   * Load a page ahead of time (e.g. while the display refreshes).
+   * The next loadPage() for that page hands it over without reading the SD card.
+   * @param pageNum Page number (0-indexed)
+   */
+  void prefetchPage(uint16_t pageNum);
+
+  /**
+   * Clear cache (and the parser checkpoint next to it) from disk.
    * @return true on success
    */
   bool clear() const;
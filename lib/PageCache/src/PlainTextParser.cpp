@@ -6,24 +6,38 @@
 #include <ParsedText.h>
 #include <SDCardManager.h>
 #include <Utf8.h>
+#include <WordTokenizer.h>
 
 #define TAG "TXT_PARSE"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 namespace {
 constexpr size_t READ_CHUNK_SIZE = 4096;
-
-bool isWhitespace(char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
+constexpr size_t MAX_WORD_LENGTH = 101;  // Longer runs without a space are broken up into pieces this long
 }  // namespace
 
-PlainTextParser::PlainTextParser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config)
-    : filepath_(std::move(filepath)), renderer_(renderer), config_(config) {}
+PlainTextParser::PlainTextParser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config,
+                                 const size_t startOffset, const size_t endOffset)
+    : filepath_(std::move(filepath)),
+      renderer_(renderer),
+      config_(config),
+      startOffset_(startOffset),
+      endOffset_(endOffset),
+      currentOffset_(startOffset) {}
+
+PlainTextParser::~PlainTextParser() = default;
 
 void PlainTextParser::reset() {
-  currentOffset_ = 0;
+  currentOffset_ = startOffset_;
   hasMore_ = true;
   isRtl_ = false;
+  page_.reset();
+  pageY_ = 0;
+  pendingLines_.clear();
+  pendingSpacing_ = false;
 }
 
 bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages,
@@ -35,112 +49,143 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
   }
 
   fileSize_ = file.size();
-  if (currentOffset_ > 0) {
-    file.seek(currentOffset_);
-  }
+  const size_t endOffset = (endOffset_ > 0) ? std::min(endOffset_, fileSize_) : fileSize_;
 
   const int lineHeight = static_cast<int>(renderer_.getLineHeight(config_.fontId) * config_.lineCompression);
   const int maxLinesPerPage = config_.viewportHeight / lineHeight;
 
-  uint8_t buffer[READ_CHUNK_SIZE + 1];
+  // A word cut by the end of one chunk is moved to the front and the next chunk read after it
+  uint8_t buffer[MAX_WORD_LENGTH + READ_CHUNK_SIZE + 1];
+  char* const text = reinterpret_cast<char*>(buffer);
+  size_t carried = 0;
+  char word[MAX_WORD_LENGTH + 1];
   std::unique_ptr<ParsedText> currentBlock;
-  std::unique_ptr<Page> currentPage;
-  int16_t currentPageY = 0;
   uint16_t pagesCreated = 0;
-  std::string partialWord;
   uint16_t abortCheckCounter = 0;
 
   auto startNewPage = [&]() {
-    currentPage.reset(new Page());
-    currentPageY = 0;
+    page_.reset(new Page());
+    pageY_ = 0;
   };
 
+  // Lines past maxPages are held for the next call, so the batch size never changes where pages break
   auto addLineToPage = [&](std::shared_ptr<TextBlock> line) {
-    if (!currentPage) {
+    if (!page_) {
       startNewPage();
     }
 
-    if (currentPageY + lineHeight > config_.viewportHeight) {
-      onPageComplete(std::move(currentPage));
-      pagesCreated++;
-      startNewPage();
+    if (!pendingLines_.empty()) {
+      pendingLines_.push_back(std::move(line));
+      return;
+    }
 
+    if (pageY_ + lineHeight > config_.viewportHeight) {
       if (maxPages > 0 && pagesCreated >= maxPages) {
-        return false;
+        pendingLines_.push_back(std::move(line));
+        return;
       }
+      onPageComplete(std::move(page_));
+      pagesCreated++;
+      startNewPage();
     }
 
-    currentPage->elements.push_back(std::make_shared<PageLine>(line, 0, currentPageY));
-    currentPageY += lineHeight;
-    return true;
+    page_->elements.push_back(std::make_shared<PageLine>(line, 0, pageY_));
+    pageY_ += lineHeight;
+  };
+
+  auto addParagraphSpacing = [&]() {
+    switch (config_.spacingLevel) {
+      case 1:
+        pageY_ += lineHeight / 4;
+        break;
+      case 3:
+        pageY_ += lineHeight;
+        break;
+    }
   };
 
+  // Lays out the whole paragraph: the resume offset is the next paragraph, so stopping partway
+  // through would drop the rest of this one
   auto flushBlock = [&]() -> bool {
     if (!currentBlock || currentBlock->isEmpty()) return true;
 
-    bool continueProcessing = true;
     currentBlock->layoutAndExtractLines(renderer_, config_.fontId, config_.viewportWidth,
-                                        [&](const std::shared_ptr<TextBlock>& line) {
-                                          if (!continueProcessing) return;
-                                          if (!addLineToPage(line)) {
-                                            continueProcessing = false;
-                                          }
-                                        });
+                                        [&](const std::shared_ptr<TextBlock>& line) { addLineToPage(line); });
 
     currentBlock.reset();
-    return continueProcessing;
+    return maxPages == 0 || pagesCreated < maxPages;
+  };
+
+  auto addWord = [&](const WordTokenizer::Token& token) {
+    if (token.ascii) {
+      currentBlock->addWord(std::string(token.text, token.length), EpdFontFamily::REGULAR);
+      return;
+    }
+    memcpy(word, token.text, token.length);
+    currentBlock->addWord(std::string(word, utf8NormalizeNfc(word, token.length)), EpdFontFamily::REGULAR);
   };
 
-  if (currentOffset_ == 0) {
+  // Direction comes from the start of the file, wherever the range starts
+  if (currentOffset_ == startOffset_) {
     size_t peekBytes = file.read(buffer, READ_CHUNK_SIZE);
     if (peekBytes > 0) {
       buffer[peekBytes] = '\0';
       isRtl_ = ScriptDetector::containsArabic(reinterpret_cast<const char*>(buffer));
     }
-    file.seekSet(0);
+  }
+  file.seekSet(currentOffset_);
+
+  // Pick up the page and the lines the previous batch stopped on
+  if (!page_) {
+    startNewPage();
+  }
+  if (!pendingLines_.empty()) {
+    std::vector<std::shared_ptr<TextBlock>> lines;
+    lines.swap(pendingLines_);
+    for (auto& line : lines) {
+      addLineToPage(std::move(line));
+    }
+    if (!pendingLines_.empty()) {
+      file.close();
+      return true;
+    }
+  }
+  if (pendingSpacing_) {
+    addParagraphSpacing();
+    pendingSpacing_ = false;
   }
 
-  startNewPage();
   currentBlock.reset(new ParsedText(static_cast<TextBlock::BLOCK_STYLE>(config_.paragraphAlignment),
                                     config_.indentLevel, config_.hyphenation, true, isRtl_));
 
-  while (file.available() > 0) {
+  while (file.position() < endOffset) {
     // Check for abort every few iterations
     if (shouldAbort && (++abortCheckCounter % 10 == 0) && shouldAbort()) {
       LOG_INF(TAG, "Aborted by external request");
-      currentOffset_ = file.position();
+      currentOffset_ = file.position() - carried;
       hasMore_ = true;
       file.close();
       return false;
     }
 
-    size_t bytesRead = file.read(buffer, READ_CHUNK_SIZE);
+    const size_t bytesRead = file.read(buffer + carried, std::min(READ_CHUNK_SIZE, endOffset - file.position()));
     if (bytesRead == 0) break;
 
-    buffer[bytesRead] = '\0';
-
-    for (size_t i = 0; i < bytesRead; i++) {
-      char c = static_cast<char>(buffer[i]);
+    const size_t length = carried + bytesRead;
+    const bool lastChunk = file.position() >= endOffset;
+    carried = 0;
 
+    WordTokenizer words(text, length, MAX_WORD_LENGTH);
+    WordTokenizer::Token token;
+    while (words.next(token)) {
       // Handle newlines as paragraph breaks
-      if (c == '\n') {
-        // Flush partial word
-        if (!partialWord.empty()) {
-          partialWord.resize(utf8NormalizeNfc(&partialWord[0], partialWord.size()));
-          currentBlock->addWord(partialWord, EpdFontFamily::REGULAR);
-          partialWord.clear();
-        }
-
+      if (token.kind == WordTokenizer::Kind::NEWLINE) {
         // Flush current block (paragraph)
         if (!flushBlock()) {
-          currentOffset_ = file.position() - (bytesRead - i - 1);
+          currentOffset_ = file.position() - (length - words.consumed(text));
           hasMore_ = true;
+          pendingSpacing_ = true;
           file.close();
-
-          // Complete final page if it has content
-          if (currentPage && !currentPage->elements.empty()) {
-            onPageComplete(std::move(currentPage));
-          }
           return true;
         }
 
@@ -148,61 +193,36 @@ bool PlainTextParser::parsePages(const std::function<void(std::unique_ptr<Page>)
         currentBlock.reset(new ParsedText(static_cast<TextBlock::BLOCK_STYLE>(config_.paragraphAlignment),
                                           config_.indentLevel, config_.hyphenation, true, isRtl_));
 
-        // Add paragraph spacing
-        switch (config_.spacingLevel) {
-          case 1:
-            currentPageY += lineHeight / 4;
-            break;
-          case 3:
-            currentPageY += lineHeight;
-            break;
-        }
+        addParagraphSpacing();
         continue;
       }
 
-      if (isWhitespace(c)) {
-        if (!partialWord.empty()) {
-          partialWord.resize(utf8NormalizeNfc(&partialWord[0], partialWord.size()));
-          currentBlock->addWord(partialWord, EpdFontFamily::REGULAR);
-          partialWord.clear();
-        }
-        continue;
-      }
-
-      partialWord += c;
-
-      // Prevent extremely long words from accumulating
-      if (partialWord.length() > 100) {
-        partialWord.resize(utf8NormalizeNfc(&partialWord[0], partialWord.size()));
-        currentBlock->addWord(partialWord, EpdFontFamily::REGULAR);
-        partialWord.clear();
+      if (token.cut && !lastChunk) {
+        memmove(buffer, token.text, token.length);
+        carried = token.length;
+        break;
       }
-    }
-
-    // Check if we hit max pages
-    if (maxPages > 0 && pagesCreated >= maxPages) {
-      currentOffset_ = file.position();
-      hasMore_ = (currentOffset_ < fileSize_);
-      file.close();
-      return true;
+      addWord(token);
     }
   }
 
-  // Flush remaining content
-  if (!partialWord.empty()) {
-    partialWord.resize(utf8NormalizeNfc(&partialWord[0], partialWord.size()));
-    currentBlock->addWord(partialWord, EpdFontFamily::REGULAR);
-  }
   flushBlock();
+  file.close();
+
+  // The last paragraph ran past maxPages: its lines go out with the next call
+  if (!pendingLines_.empty()) {
+    currentOffset_ = endOffset;
+    hasMore_ = true;
+    return true;
+  }
 
   // Complete final page
-  if (currentPage && !currentPage->elements.empty()) {
-    onPageComplete(std::move(currentPage));
+  if (page_ && !page_->elements.empty()) {
+    onPageComplete(std::move(page_));
     pagesCreated++;
   }
 
-  file.close();
-  currentOffset_ = fileSize_;
+  currentOffset_ = endOffset;
   hasMore_ = false;
 
   LOG_INF(TAG, "Parsed %d pages from %s", pagesCreated, filepath_.c_str());
@@ -4,32 +4,46 @@
 #include <ScriptDetector.h>
 #include <SdFat.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "ContentParser.h"
 
 class GfxRenderer;
+class Page;
+class TextBlock;
 
 /**
  * Content parser for plain text files (TXT, Markdown).
  * Reads text, wraps into lines, and creates Page objects.
+ * Can be limited to a byte range of the file (one TXT section, see Txt::sectionStart()).
  */
 class PlainTextParser : public ContentParser {
   std::string filepath_;
   GfxRenderer& renderer_;
   RenderConfig config_;
   size_t fileSize_ = 0;
+  size_t startOffset_ = 0;
+  size_t endOffset_ = 0;  // 0 = end of file
   size_t currentOffset_ = 0;
   bool hasMore_ = true;
   bool isRtl_ = false;
 
+  // Carried between batches: the page being filled and the lines that did not fit under maxPages
+  std::unique_ptr<Page> page_;
+  int16_t pageY_ = 0;
+  std::vector<std::shared_ptr<TextBlock>> pendingLines_;
+  bool pendingSpacing_ = false;
+
  public:
-  PlainTextParser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config);
-  ~PlainTextParser() override = default;
+  PlainTextParser(std::string filepath, GfxRenderer& renderer, const RenderConfig& config, size_t startOffset = 0,
+                  size_t endOffset = 0);
+  ~PlainTextParser() override;
 
   bool parsePages(const std::function<void(std::unique_ptr<Page>)>& onPageComplete, uint16_t maxPages = 0,
                   const AbortCallback& shouldAbort = nullptr) override;
   bool hasMoreContent() const override { return hasMore_; }
-  bool canResume() const override { return currentOffset_ > 0 && hasMore_; }
+  bool canResume() const override { return currentOffset_ > startOffset_ && hasMore_; }
   void reset() override;
 };
@@ -9,93 +9,24 @@
 #include <cstring>
 
 #include "BitmapHelpers.h"
+#include "ScaledBmpWriter.h"
 
 namespace {
 constexpr int MAX_IMAGE_WIDTH = 2048;
 constexpr int MAX_IMAGE_HEIGHT = 3072;
 
-inline void write16(Print& out, const uint16_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-}
-
-inline void write32(Print& out, const uint32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-inline void write32Signed(Print& out, const int32_t value) {
-  out.write(value & 0xFF);
-  out.write((value >> 8) & 0xFF);
-  out.write((value >> 16) & 0xFF);
-  out.write((value >> 24) & 0xFF);
-}
-
-void writeBmpHeader2bit(Print& bmpOut, const int width, const int height) {
-  const int bytesPerRow = (width * 2 + 31) / 32 * 4;
-  const int imageSize = bytesPerRow * height;
-  const uint32_t fileSize = 70 + imageSize;
-
-  bmpOut.write('B');
-  bmpOut.write('M');
-  write32(bmpOut, fileSize);
-  write32(bmpOut, 0);
-  write32(bmpOut, 70);
-
-  write32(bmpOut, 40);
-  write32Signed(bmpOut, width);
-  write32Signed(bmpOut, -height);
-  write16(bmpOut, 1);
-  write16(bmpOut, 2);
-  write32(bmpOut, 0);
-  write32(bmpOut, imageSize);
-  write32(bmpOut, 2835);
-  write32(bmpOut, 2835);
-  write32(bmpOut, 4);
-  write32(bmpOut, 4);
-
-  uint8_t palette[16] = {
-      0x00, 0x00, 0x00, 0x00,  // Black
-      0x55, 0x55, 0x55, 0x00,  // Dark gray
-      0xAA, 0xAA, 0xAA, 0x00,  // Light gray
-      0xFF, 0xFF, 0xFF, 0x00   // White
-  };
-  for (const uint8_t i : palette) {
-    bmpOut.write(i);
-  }
-}
-
 struct PngContext {
-  FsFile* pngFile;
-  Print* bmpOut;
+  const BmpOutputSpec* outputs;
+  int outputCount;
   int srcWidth;
   int srcHeight;
-  int outWidth;
-  int outHeight;
-  int targetMaxWidth;
-  int targetMaxHeight;
-  uint32_t scaleX_fp;
-  uint32_t scaleY_fp;
-  bool needsScaling;
   bool headerWritten;
-  bool quickMode;   // Fast preview: simple threshold instead of dithering
   bool initFailed;  // Set when allocation fails in pngInitCallback
   bool aborted;
-  int currentSrcY;
-  int currentOutY;
-  uint32_t nextOutY_srcStart;
   const std::function<bool()>* shouldAbort;
 
-  // Row buffers
   uint8_t* srcRowBuffer;  // Source row grayscale
-  uint8_t* outRowBuffer;  // Output BMP row
-  uint32_t* rowAccum;     // Accumulator for scaling
-  uint16_t* rowCount;     // Count for scaling
-  AtkinsonDitherer* ditherer;
-
-  int bytesPerRow;
+  ScaledBmpWriter writers[MAX_BMP_OUTPUTS];
 };
 
 void pngDrawCallback(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
@@ -120,73 +51,10 @@ void pngDrawCallback(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_
     ctx->srcRowBuffer[x] = blendedGray;
   }
 
-  // Check if row complete (x is last pixel of row)
+  // Row complete (x is last pixel of row): hand it to every output
   if (x == static_cast<uint32_t>(ctx->srcWidth - 1)) {
-    // Process complete row
-    if (!ctx->needsScaling) {
-      // Direct output
-      memset(ctx->outRowBuffer, 0, ctx->bytesPerRow);
-      for (int outX = 0; outX < ctx->outWidth; outX++) {
-        const uint8_t gray = adjustPixel(ctx->srcRowBuffer[outX]);
-        uint8_t twoBit;
-        if (ctx->quickMode) {
-          // Simple threshold quantization (faster)
-          twoBit = quantizeSimple(gray);
-        } else {
-          twoBit = ctx->ditherer ? ctx->ditherer->processPixel(gray, outX) : quantize(gray, outX, y);
-        }
-        const int byteIndex = (outX * 2) / 8;
-        const int bitOffset = 6 - ((outX * 2) % 8);
-        ctx->outRowBuffer[byteIndex] |= (twoBit << bitOffset);
-      }
-      if (ctx->ditherer && !ctx->quickMode) ctx->ditherer->nextRow();
-      ctx->bmpOut->write(ctx->outRowBuffer, ctx->bytesPerRow);
-    } else {
-      // Scaling: accumulate source pixels
-      for (int outX = 0; outX < ctx->outWidth; outX++) {
-        const int srcXStart = (static_cast<uint32_t>(outX) * ctx->scaleX_fp) >> 16;
-        const int srcXEnd = (static_cast<uint32_t>(outX + 1) * ctx->scaleX_fp) >> 16;
-
-        int sum = 0;
-        int count = 0;
-        for (int srcX = srcXStart; srcX < srcXEnd && srcX < ctx->srcWidth; srcX++) {
-          sum += ctx->srcRowBuffer[srcX];
-          count++;
-        }
-        if (count == 0 && srcXStart < ctx->srcWidth) {
-          sum = ctx->srcRowBuffer[srcXStart];
-          count = 1;
-        }
-        ctx->rowAccum[outX] += sum;
-        ctx->rowCount[outX] += count;
-      }
-
-      ctx->currentSrcY++;
-      const uint32_t srcY_fp = static_cast<uint32_t>(ctx->currentSrcY) << 16;
-
-      if (srcY_fp >= ctx->nextOutY_srcStart && ctx->currentOutY < ctx->outHeight) {
-        memset(ctx->outRowBuffer, 0, ctx->bytesPerRow);
-        for (int outX = 0; outX < ctx->outWidth; outX++) {
-          const uint8_t gray = adjustPixel((ctx->rowCount[outX] > 0) ? (ctx->rowAccum[outX] / ctx->rowCount[outX]) : 0);
-          uint8_t twoBit;
-          if (ctx->quickMode) {
-            // Simple threshold quantization (faster)
-            twoBit = quantizeSimple(gray);
-          } else {
-            twoBit = ctx->ditherer ? ctx->ditherer->processPixel(gray, outX) : quantize(gray, outX, ctx->currentOutY);
-          }
-          const int byteIndex = (outX * 2) / 8;
-          const int bitOffset = 6 - ((outX * 2) % 8);
-          ctx->outRowBuffer[byteIndex] |= (twoBit << bitOffset);
-        }
-        if (ctx->ditherer && !ctx->quickMode) ctx->ditherer->nextRow();
-        ctx->bmpOut->write(ctx->outRowBuffer, ctx->bytesPerRow);
-        ctx->currentOutY++;
-
-        memset(ctx->rowAccum, 0, ctx->outWidth * sizeof(uint32_t));
-        memset(ctx->rowCount, 0, ctx->outWidth * sizeof(uint16_t));
-        ctx->nextOutY_srcStart = static_cast<uint32_t>(ctx->currentOutY + 1) * ctx->scaleY_fp;
-      }
+    for (int i = 0; i < ctx->outputCount; i++) {
+      ctx->writers[i].pushRow(ctx->srcRowBuffer);
     }
   }
 }
@@ -205,93 +73,36 @@ void pngInitCallback(pngle_t* pngle, uint32_t w, uint32_t h) {
     return;
   }
 
-  // Calculate output dimensions
-  ctx->outWidth = w;
-  ctx->outHeight = h;
-  ctx->scaleX_fp = 65536;
-  ctx->scaleY_fp = 65536;
-  ctx->needsScaling = false;
-
-  if (ctx->targetMaxWidth > 0 && ctx->targetMaxHeight > 0 &&
-      (static_cast<int>(w) > ctx->targetMaxWidth || static_cast<int>(h) > ctx->targetMaxHeight)) {
-    const float scaleToFitWidth = static_cast<float>(ctx->targetMaxWidth) / w;
-    const float scaleToFitHeight = static_cast<float>(ctx->targetMaxHeight) / h;
-    const float scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
-
-    ctx->outWidth = static_cast<int>(w * scale);
-    ctx->outHeight = static_cast<int>(h * scale);
-    if (ctx->outWidth < 1) ctx->outWidth = 1;
-    if (ctx->outHeight < 1) ctx->outHeight = 1;
-
-    ctx->scaleX_fp = (static_cast<uint32_t>(w) << 16) / ctx->outWidth;
-    ctx->scaleY_fp = (static_cast<uint32_t>(h) << 16) / ctx->outHeight;
-    ctx->needsScaling = true;
-
-    LOG_INF(TAG, "Scaling %dx%d -> %dx%d", w, h, ctx->outWidth, ctx->outHeight);
-  }
-
-  // Allocate buffers
   ctx->srcRowBuffer = static_cast<uint8_t*>(malloc(w));
-  ctx->bytesPerRow = (ctx->outWidth * 2 + 31) / 32 * 4;
-  ctx->outRowBuffer = static_cast<uint8_t*>(malloc(ctx->bytesPerRow));
-
-  if (!ctx->srcRowBuffer || !ctx->outRowBuffer) {
-    LOG_ERR(TAG, "Failed to allocate row buffers");
-    free(ctx->srcRowBuffer);  // safe if nullptr
-    free(ctx->outRowBuffer);  // safe if nullptr
-    ctx->srcRowBuffer = nullptr;
-    ctx->outRowBuffer = nullptr;
+  if (!ctx->srcRowBuffer) {
+    LOG_ERR(TAG, "Failed to allocate row buffer");
     ctx->initFailed = true;
     return;
   }
 
-  if (ctx->needsScaling) {
-    ctx->rowAccum = new (std::nothrow) uint32_t[ctx->outWidth]();
-    ctx->rowCount = new (std::nothrow) uint16_t[ctx->outWidth]();
-    if (!ctx->rowAccum || !ctx->rowCount) {
-      LOG_ERR(TAG, "Failed to allocate scaling buffers");
+  // Each writer allocates its own scaling/dither state and writes its BMP header
+  for (int i = 0; i < ctx->outputCount; i++) {
+    if (!ctx->writers[i].begin(ctx->outputs[i], w, h)) {
+      LOG_ERR(TAG, "Failed to set up BMP output %d", i);
       free(ctx->srcRowBuffer);
-      free(ctx->outRowBuffer);
-      delete[] ctx->rowAccum;  // safe if nullptr
-      delete[] ctx->rowCount;  // safe if nullptr
       ctx->srcRowBuffer = nullptr;
-      ctx->outRowBuffer = nullptr;
-      ctx->rowAccum = nullptr;
-      ctx->rowCount = nullptr;
       ctx->initFailed = true;
       return;
     }
-    ctx->nextOutY_srcStart = ctx->scaleY_fp;
   }
-
-  // Skip ditherer allocation in quickMode for faster preview
-  if (!ctx->quickMode) {
-    ctx->ditherer = new (std::nothrow) AtkinsonDitherer(ctx->outWidth);
-    if (!ctx->ditherer) {
-      LOG_ERR(TAG, "Failed to allocate ditherer");
-      free(ctx->srcRowBuffer);
-      free(ctx->outRowBuffer);
-      delete[] ctx->rowAccum;
-      delete[] ctx->rowCount;
-      ctx->srcRowBuffer = nullptr;
-      ctx->outRowBuffer = nullptr;
-      ctx->rowAccum = nullptr;
-      ctx->rowCount = nullptr;
-      ctx->initFailed = true;
-      return;
-    }
-  }
-  ctx->currentSrcY = 0;
-  ctx->currentOutY = 0;
-
-  // Write BMP header
-  writeBmpHeader2bit(*ctx->bmpOut, ctx->outWidth, ctx->outHeight);
   ctx->headerWritten = true;
 }
 
-bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight, bool quickMode,
-                                const std::function<bool()>& shouldAbort = nullptr) {
-  LOG_INF(TAG, "Converting PNG to BMP (target: %dx%d)%s", targetMaxWidth, targetMaxHeight, quickMode ? " [QUICK]" : "");
+bool pngFileToBmpStreamsInternal(FsFile& pngFile, const BmpOutputSpec* outputs, const int count,
+                                 const std::function<bool()>& shouldAbort = nullptr) {
+  if (count < 1 || count > MAX_BMP_OUTPUTS) {
+    LOG_ERR(TAG, "Invalid output count: %d", count);
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    LOG_INF(TAG, "Converting PNG to %s BMP (target: %dx%d)%s", outputs[i].oneBit ? "1-bit" : "2-bit",
+            outputs[i].maxWidth, outputs[i].maxHeight, outputs[i].quickMode ? " [QUICK]" : "");
+  }
 
   pngle_t* pngle = pngle_new();
   if (!pngle) {
@@ -300,12 +111,9 @@ bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetMaxWid
   }
 
   PngContext ctx = {};
-  ctx.pngFile = &pngFile;
-  ctx.bmpOut = &bmpOut;
-  ctx.targetMaxWidth = targetMaxWidth;
-  ctx.targetMaxHeight = targetMaxHeight;
+  ctx.outputs = outputs;
+  ctx.outputCount = count;
   ctx.headerWritten = false;
-  ctx.quickMode = quickMode;
   ctx.aborted = false;
   ctx.shouldAbort = &shouldAbort;
 
@@ -332,23 +140,29 @@ bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetMaxWid
     }
   }
 
-  // Cleanup
+  // Cleanup (writers release their buffers on destruction)
   if (ctx.srcRowBuffer) free(ctx.srcRowBuffer);
-  if (ctx.outRowBuffer) free(ctx.outRowBuffer);
-  if (ctx.rowAccum) delete[] ctx.rowAccum;
-  if (ctx.rowCount) delete[] ctx.rowCount;
-  if (ctx.ditherer) delete ctx.ditherer;
 
   pngle_destroy(pngle);
 
   if (success && ctx.headerWritten) {
-    LOG_INF(TAG, "Successfully converted PNG to BMP (%dx%d)", ctx.outWidth, ctx.outHeight);
+    LOG_INF(TAG, "Successfully converted PNG to BMP (%dx%d)", ctx.writers[0].outWidth(), ctx.writers[0].outHeight());
     return true;
   }
 
   return false;
 }
 
+bool pngFileToBmpStreamInternal(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight, bool quickMode,
+                                const std::function<bool()>& shouldAbort = nullptr) {
+  BmpOutputSpec spec;
+  spec.out = &bmpOut;
+  spec.maxWidth = targetMaxWidth;
+  spec.maxHeight = targetMaxHeight;
+  spec.quickMode = quickMode;
+  return pngFileToBmpStreamsInternal(pngFile, &spec, 1, shouldAbort);
+}
+
 }  // namespace
 
 bool PngToBmpConverter::pngFileToBmpStreamWithSize(FsFile& pngFile, Print& bmpOut, int targetMaxWidth,
@@ -360,3 +174,8 @@ bool PngToBmpConverter::pngFileToBmpStreamQuick(FsFile& pngFile, Print& bmpOut,
                                                 int targetMaxHeight) {
   return pngFileToBmpStreamInternal(pngFile, bmpOut, targetMaxWidth, targetMaxHeight, true);
 }
+
+bool PngToBmpConverter::pngFileToBmpStreams(FsFile& pngFile, const BmpOutputSpec* outputs, int count,
+                                            const std::function<bool()>& shouldAbort) {
+  return pngFileToBmpStreamsInternal(pngFile, outputs, count, shouldAbort);
+}
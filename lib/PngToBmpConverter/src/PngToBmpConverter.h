@@ -4,6 +4,7 @@
 
 class FsFile;
 class Print;
+struct BmpOutputSpec;
 
 class PngToBmpConverter {
  public:
@@ -11,4 +12,7 @@ class PngToBmpConverter {
                                          const std::function<bool()>& shouldAbort = nullptr);
   // Quick preview mode: simple threshold instead of dithering (faster but lower quality)
   static bool pngFileToBmpStreamQuick(FsFile& pngFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Decode once and write up to MAX_BMP_OUTPUTS BMPs (e.g. cover + thumbnail) in the same pass
+  static bool pngFileToBmpStreams(FsFile& pngFile, const BmpOutputSpec* outputs, int count,
+                                  const std::function<bool()>& shouldAbort = nullptr);
 };
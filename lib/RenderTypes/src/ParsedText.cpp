@@ -286,7 +286,7 @@ bool ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
     if (shouldAbort && shouldAbort()) {
       return false;
     }
-    extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
+    extractLine(renderer, fontId, i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
   }
   return true;
 }
@@ -453,8 +453,9 @@ std::vector<size_t> ParsedText::computeLineBreaksGreedy(const GfxRenderer& rende
   return breaks;
 }
 
-void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
+void ParsedText::extractLine(const GfxRenderer& renderer, const int fontId, const size_t breakIndex,
+                             const int pageWidth, const int spaceWidth, const std::vector<uint16_t>& wordWidths,
+                             const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
@@ -544,7 +545,15 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   words.erase(words.begin(), wordIt);
   wordStyles.erase(wordStyles.begin(), styleIt);
 
-  processLine(std::make_shared<TextBlock>(std::move(lineData), effectiveStyle));
+  // Classify and shape each word once here; both are cached with the page, so drawing doesn't
+  // rescan or reshape
+  std::vector<TextBlock::ShapedGlyph> shaped;
+  for (auto& wd : lineData) {
+    wd.flags = renderer.getTextFlags(fontId, wd.word.c_str(), wd.style);
+    wd.shapedCount = TextBlock::shapeWord(wd.word, wd.flags, shaped);
+  }
+
+  processLine(std::make_shared<TextBlock>(std::move(lineData), effectiveStyle, std::move(shaped)));
 }
 
 bool ParsedText::preSplitOversizedWords(const GfxRenderer& renderer, const int fontId, const int pageWidth,
@@ -581,15 +590,16 @@ bool ParsedText::preSplitOversizedWords(const GfxRenderer& renderer, const int f
         // No soft hyphens - use dictionary-based hyphenation
         // Compute all break points on the full word once (Liang patterns
         // need full-word context for correct results).
-        auto breaks = Hyphenation::breakOffsets(word, true);
+        const Hyphenation::BreakInfo* breaks;
+        const size_t breakCount = Hyphenation::breakOffsets(word, true, breaks);
 
-        if (breaks.empty()) {
+        if (breakCount == 0) {
           newWords.push_back(word);
           newStyles.push_back(wordStyle);
         } else {
           size_t prevOffset = 0;
 
-          for (size_t bi = 0; bi <= breaks.size(); ++bi) {
+          for (size_t bi = 0; bi <= breakCount; ++bi) {
             const std::string remaining = word.substr(prevOffset);
             const int remainingWidth = renderer.getTextWidth(fontId, remaining.c_str(), wordStyle);
 
@@ -602,7 +612,7 @@ bool ParsedText::preSplitOversizedWords(const GfxRenderer& renderer, const int f
             // Find the rightmost break where prefix + hyphen fits
             int bestIdx = -1;
             std::string bestPrefix;
-            for (int i = static_cast<int>(breaks.size()) - 1; i >= 0; --i) {
+            for (int i = static_cast<int>(breakCount) - 1; i >= 0; --i) {
               if (breaks[i].byteOffset <= prevOffset) continue;
               std::string prefix = word.substr(prevOffset, breaks[i].byteOffset - prevOffset);
               if (breaks[i].requiresInsertedHyphen) {
@@ -707,11 +717,12 @@ bool ParsedText::trySplitWordForLineEnd(const GfxRenderer& renderer, const int f
   const std::string& word = *wordIt;
   const EpdFontFamily::Style fontStyle = *styleIt;
 
-  auto breaks = Hyphenation::breakOffsets(word, false);
-  if (breaks.empty()) return false;
+  const Hyphenation::BreakInfo* breaks;
+  const size_t breakCount = Hyphenation::breakOffsets(word, false, breaks);
+  if (breakCount == 0) return false;
 
   // Find rightmost break where prefix+hyphen fits in remainingWidth
-  for (int i = static_cast<int>(breaks.size()) - 1; i >= 0; --i) {
+  for (int i = static_cast<int>(breakCount) - 1; i >= 0; --i) {
     std::string prefix = word.substr(0, breaks[i].byteOffset);
     // Measure with visible hyphen for accurate layout
     const std::string displayPrefix = breaks[i].requiresInsertedHyphen ? prefix + "-" : prefix;
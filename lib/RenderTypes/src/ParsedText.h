@@ -36,8 +36,8 @@ class ParsedText {
                               std::list<std::string>::iterator wordIt,
                               std::list<EpdFontFamily::Style>::iterator styleIt, size_t wordIndex,
                               std::vector<uint16_t>& wordWidths);
-  void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<size_t>& lineBreakIndices,
+  void extractLine(const GfxRenderer& renderer, int fontId, size_t breakIndex, int pageWidth, int spaceWidth,
+                   const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
   std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
   bool preSplitOversizedWords(const GfxRenderer& renderer, int fontId, int pageWidth,
@@ -33,4 +33,20 @@ struct RenderConfig {
            viewportWidth == o.viewportWidth && viewportHeight == o.viewportHeight;
   }
   bool operator!=(const RenderConfig& o) const { return !(*this == o); }
+
+  // FNV-1a over the fields, for records that hold for one layout only (e.g. Txt::setLayout)
+  uint32_t hash() const {
+    uint32_t h = 2166136261u;
+    const auto mix = [&h](const uint32_t value) {
+      for (int i = 0; i < 4; i++) {
+        h = (h ^ ((value >> (i * 8)) & 0xFF)) * 16777619u;
+      }
+    };
+    mix(static_cast<uint32_t>(fontId));
+    mix(static_cast<uint32_t>(std::lround(lineCompression * 1000)));
+    mix(indentLevel | (spacingLevel << 8) | (paragraphAlignment << 16));
+    mix((hyphenation ? 1 : 0) | (showImages ? 2 : 0));
+    mix(viewportWidth | (static_cast<uint32_t>(viewportHeight) << 16));
+    return h;
+  }
 };
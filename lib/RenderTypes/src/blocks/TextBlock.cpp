@@ -1,15 +1,53 @@
 #include "TextBlock.h"
 
+#include <ArabicShaper.h>
 #include <GfxRenderer.h>
 #include <Logging.h>
+#include <ScriptDetector.h>
 #include <Serialization.h>
+#include <ThaiClusterBuilder.h>
 
 #define TAG "TEXT_BLOCK"
 
+namespace {
+// Shaped glyphs are serialized as the codepoint, with the zero-advance bit on top, and the offsets
+constexpr uint32_t ZERO_ADVANCE_BIT = 0x80000000u;
+}  // namespace
+
+uint16_t TextBlock::shapeWord(const std::string& word, const uint8_t textFlags, std::vector<ShapedGlyph>& out) {
+  if (!(textFlags & GfxRenderer::TEXT_PRINTABLE)) {
+    return 0;
+  }
+
+  const size_t start = out.size();
+  if (textFlags & ScriptDetector::HAS_ARABIC) {
+    for (const uint32_t cp : ArabicShaper::shapeText(word.c_str())) {
+      out.push_back({cp, 0, 0, false});
+    }
+  } else if (textFlags & ScriptDetector::HAS_THAI) {
+    for (const auto& cluster : ThaiShaper::ThaiClusterBuilder::buildClusters(word.c_str())) {
+      out.insert(out.end(), cluster.glyphs.begin(), cluster.glyphs.end());
+    }
+  }
+
+  // Too long to record: leave it to drawText()
+  if (out.size() - start > UINT16_MAX) {
+    out.resize(start);
+  }
+  return static_cast<uint16_t>(out.size() - start);
+}
+
 void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y,
                        const bool black) const {
+  size_t glyph = 0;
   for (const auto& wd : wordData) {
-    renderer.drawText(fontId, wd.xPos + x, y, wd.word.c_str(), black, wd.style);
+    if (wd.shapedCount > 0) {
+      renderer.drawShapedText(fontId, wd.xPos + x, y, &shapedGlyphs[glyph], wd.shapedCount, wd.flags, black,
+                              wd.style);
+      glyph += wd.shapedCount;
+    } else {
+      renderer.drawText(fontId, wd.xPos + x, y, wd.word.c_str(), black, wd.style, wd.flags);
+    }
   }
 }
 
@@ -17,10 +55,22 @@ bool TextBlock::serialize(FsFile& file) const {
   // Word count
   serialization::writePod(file, static_cast<uint16_t>(wordData.size()));
 
-  // Write words, then xpos, then styles (maintains backward-compatible format)
+  // Write words, then xpos, then styles, then text flags
   for (const auto& wd : wordData) serialization::writeString(file, wd.word);
   for (const auto& wd : wordData) serialization::writePod(file, wd.xPos);
   for (const auto& wd : wordData) serialization::writePod(file, wd.style);
+  for (const auto& wd : wordData) serialization::writePod(file, wd.flags);
+
+  // Shaped glyphs; the per-word counts are only written when there are any
+  serialization::writePod(file, static_cast<uint16_t>(shapedGlyphs.size()));
+  if (!shapedGlyphs.empty()) {
+    for (const auto& wd : wordData) serialization::writePod(file, wd.shapedCount);
+    for (const auto& g : shapedGlyphs) {
+      serialization::writePod(file, g.codepoint | (g.zeroAdvance ? ZERO_ADVANCE_BIT : 0));
+      serialization::writePod(file, g.xOffset);
+      serialization::writePod(file, g.yOffset);
+    }
+  }
 
   // Block style
   serialization::writePod(file, style);
@@ -43,38 +93,63 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
     return nullptr;
   }
 
-  // Read into temporary arrays (backward-compatible format: words, then xpos, then styles)
-  std::vector<std::string> words(wc);
-  std::vector<uint16_t> xpos(wc);
-  std::vector<EpdFontFamily::Style> styles(wc);
+  // Read each column straight into the WordData vector (words, then xpos, then styles, then text flags)
+  std::vector<WordData> data(wc);
 
-  for (auto& w : words) {
-    if (!serialization::readString(file, w)) {
+  for (auto& wd : data) {
+    if (!serialization::readString(file, wd.word)) {
       return nullptr;
     }
   }
-  for (auto& x : xpos) {
-    if (!serialization::readPodChecked(file, x)) {
+  for (auto& wd : data) {
+    if (!serialization::readPodChecked(file, wd.xPos)) {
       return nullptr;
     }
   }
-  for (auto& s : styles) {
-    if (!serialization::readPodChecked(file, s)) {
+  for (auto& wd : data) {
+    if (!serialization::readPodChecked(file, wd.style)) {
+      return nullptr;
+    }
+  }
+  for (auto& wd : data) {
+    if (!serialization::readPodChecked(file, wd.flags)) {
       return nullptr;
     }
   }
 
-  // Block style
-  if (!serialization::readPodChecked(file, style)) {
+  // Shaped glyphs
+  uint16_t glyphCount;
+  if (!serialization::readPodChecked(file, glyphCount)) {
     return nullptr;
   }
+  std::vector<ShapedGlyph> shaped(glyphCount);
+  if (glyphCount > 0) {
+    uint32_t wordGlyphs = 0;
+    for (auto& wd : data) {
+      if (!serialization::readPodChecked(file, wd.shapedCount)) {
+        return nullptr;
+      }
+      wordGlyphs += wd.shapedCount;
+    }
+    if (wordGlyphs != glyphCount) {
+      LOG_ERR(TAG, "Deserialization failed: %u shaped glyphs, words have %u", glyphCount, wordGlyphs);
+      return nullptr;
+    }
+    for (auto& g : shaped) {
+      uint32_t cp;
+      if (!serialization::readPodChecked(file, cp) || !serialization::readPodChecked(file, g.xOffset) ||
+          !serialization::readPodChecked(file, g.yOffset)) {
+        return nullptr;
+      }
+      g.codepoint = cp & ~ZERO_ADVANCE_BIT;
+      g.zeroAdvance = (cp & ZERO_ADVANCE_BIT) != 0;
+    }
+  }
 
-  // Combine into WordData vector
-  std::vector<WordData> data;
-  data.reserve(wc);
-  for (uint16_t i = 0; i < wc; ++i) {
-    data.push_back({std::move(words[i]), xpos[i], styles[i]});
+  // Block style
+  if (!serialization::readPodChecked(file, style)) {
+    return nullptr;
   }
 
-  return std::unique_ptr<TextBlock>(new TextBlock(std::move(data), style));
+  return std::unique_ptr<TextBlock>(new TextBlock(std::move(data), style, std::move(shaped)));
 }
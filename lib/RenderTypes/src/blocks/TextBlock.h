@@ -1,6 +1,7 @@
 #pragma once
 #include <EpdFontFamily.h>
 #include <SdFat.h>
+#include <ThaiCluster.h>
 
 #include <memory>
 #include <string>
@@ -18,18 +19,25 @@ class TextBlock final : public Block {
     RIGHT_ALIGN = 3,
   };
 
+  // A glyph of a shaped Arabic or Thai word: visual order, with the mark offsets for Thai
+  using ShapedGlyph = ThaiShaper::PositionedGlyph;
+
   struct WordData {
     std::string word;
     uint16_t xPos;
     EpdFontFamily::Style style;
+    uint8_t flags = 0;         // GfxRenderer::getTextFlags(), 0 if not computed
+    uint16_t shapedCount = 0;  // This word's glyphs in the block's shaped glyphs, 0 if not shaped
   };
 
  private:
   std::vector<WordData> wordData;
+  std::vector<ShapedGlyph> shapedGlyphs;  // Glyphs of the shaped words, in word order
   BLOCK_STYLE style;
 
  public:
-  explicit TextBlock(std::vector<WordData> data, const BLOCK_STYLE style) : wordData(std::move(data)), style(style) {}
+  explicit TextBlock(std::vector<WordData> data, const BLOCK_STYLE style, std::vector<ShapedGlyph> shaped = {})
+      : wordData(std::move(data)), shapedGlyphs(std::move(shaped)), style(style) {}
   ~TextBlock() override = default;
   void setStyle(const BLOCK_STYLE style) { this->style = style; }
   BLOCK_STYLE getStyle() const { return style; }
@@ -39,6 +47,10 @@ class TextBlock final : public Block {
   void render(const GfxRenderer& renderer, int fontId, int x, int y, bool black = true) const;
   BlockType getType() override { return TEXT_BLOCK; }
   const std::vector<WordData>& getWords() const { return wordData; }
+  const std::vector<ShapedGlyph>& getShapedGlyphs() const { return shapedGlyphs; }
+  // Shapes a word that GfxRenderer::drawText() would draw as Arabic or Thai (going by its text
+  // flags), appending the glyphs to out. Returns the number of glyphs, 0 for other words.
+  static uint16_t shapeWord(const std::string& word, uint8_t textFlags, std::vector<ShapedGlyph>& out);
   bool serialize(FsFile& file) const;
   static std::unique_ptr<TextBlock> deserialize(FsFile& file);
 };
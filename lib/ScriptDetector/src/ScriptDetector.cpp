@@ -66,6 +66,29 @@ bool containsCjk(const char* text) {
   return false;
 }
 
+uint8_t scanScripts(const char* text) {
+  if (text == nullptr) return 0;
+
+  const unsigned char* ptr = reinterpret_cast<const unsigned char*>(text);
+  uint8_t flags = 0;
+
+  while (*ptr) {
+    if (*ptr < 0x80) {
+      ptr++;
+      continue;
+    }
+    const uint32_t cp = utf8NextCodepoint(&ptr);
+    if (isThaiCodepoint(cp)) {
+      flags |= HAS_THAI;
+    } else if (isArabicCodepoint(cp)) {
+      flags |= HAS_ARABIC;
+    } else if (isCjkCodepoint(cp)) {
+      flags |= HAS_CJK;
+    }
+  }
+  return flags;
+}
+
 Script classify(const char* word) {
   if (word == nullptr || *word == '\0') {
     return Script::OTHER;
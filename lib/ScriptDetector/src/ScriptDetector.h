@@ -75,4 +75,19 @@ bool containsArabic(const char* text);
  */
 bool containsCjk(const char* text);
 
+// Scripts found by scanScripts()
+enum ScriptFlags : uint8_t {
+  HAS_ARABIC = 0x01,
+  HAS_THAI = 0x02,
+  HAS_CJK = 0x04,
+};
+
+/**
+ * Find every script that needs its own rendering path in one pass over the text.
+ * ASCII bytes are skipped without decoding.
+ *
+ * @return ScriptFlags bits, 0 for text with none of them
+ */
+uint8_t scanScripts(const char* text);
+
 }  // namespace ScriptDetector
@@ -10,13 +10,22 @@
 #include <FsHelpers.h>
 #include <Logging.h>
 #include <SDCardManager.h>
+#include <Serialization.h>
+
+#include <algorithm>
 
 #define TAG "TXT"
 
+namespace {
+constexpr uint8_t INDEX_FILE_VERSION = 1;
+// Estimate for sections that haven't been counted while no section has
+constexpr uint32_t BYTES_PER_PAGE = 2048;
+}  // namespace
+
 Txt::Txt(std::string filepath, const std::string& cacheDir)
-    : filepath(std::move(filepath)), fileSize(0), loaded(false) {
+    : filepath(std::move(filepath)), fileSize(0), loaded(false), layoutKey(0), indexDirty(false) {
   // Create cache key based on filepath (same as Epub/Xtc)
-  cachePath = cacheDir + "/txt_" + std::to_string(std::hash<std::string>{}(this->filepath));
+  cachePath = cacheDir + "/txt_" + std::to_string(FsHelpers::pathHash(this->filepath));
 
   // Extract title from filename
   size_t lastSlash = this->filepath.find_last_of('/');
@@ -52,6 +61,10 @@ bool Txt::load() {
   fileSize = file.size();
   file.close();
 
+  sectionStarts.assign(sectionCount(), 0);
+  sectionPageCounts.assign(sectionCount(), 0);
+  loadIndex();
+
   loaded = true;
   LOG_INF(TAG, "Loaded TXT: %s (%zu bytes)", filepath.c_str(), fileSize);
   return true;
@@ -126,8 +139,9 @@ bool Txt::generateCoverBmp(bool use1BitDithering) const {
   // Setup cache directory
   setupCacheDir();
 
-  // Convert to BMP using shared helper
-  const bool success = CoverHelpers::convertImageToBmp(coverImagePath, coverPath, "TXT", use1BitDithering);
+  // Convert to BMP using shared helper (thumbnail comes out of the same decode)
+  const bool success =
+      CoverHelpers::convertImageToCoverAndThumb(coverImagePath, coverPath, getThumbBmpPath(), "TXT", use1BitDithering);
   if (!success) {
     // Create failure marker
     FsFile marker;
@@ -192,3 +206,199 @@ size_t Txt::readContent(uint8_t* buffer, size_t offset, size_t length) const {
 
   return bytesRead;
 }
+
+uint16_t Txt::sectionCount() const {
+  // Every checkpoint must leave text behind it
+  if (fileSize <= CHECKPOINT_SEARCH) {
+    return 1;
+  }
+  return static_cast<uint16_t>(std::min<size_t>((fileSize - CHECKPOINT_SEARCH - 1) / SECTION_SIZE + 1, UINT16_MAX));
+}
+
+uint32_t Txt::findCheckpoint(const uint16_t section) const {
+  const uint32_t from = section * SECTION_SIZE;
+  const uint32_t limit = from + CHECKPOINT_SEARCH;
+
+  FsFile file;
+  if (!SdMan.openFileForRead("TXT", filepath, file)) {
+    return from;
+  }
+  file.seek(from);
+
+  // After the first newline; failing that after the first space, or at the first UTF-8 lead byte
+  uint8_t buffer[256];
+  uint32_t pos = from;
+  uint32_t afterSpace = 0;
+  uint32_t leadByte = 0;
+  while (pos < limit) {
+    const size_t bytesRead = file.read(buffer, std::min<size_t>(sizeof(buffer), limit - pos));
+    if (bytesRead == 0) break;
+    for (size_t i = 0; i < bytesRead; i++, pos++) {
+      const uint8_t c = buffer[i];
+      if (c == '\n') {
+        file.close();
+        return pos + 1;
+      }
+      if (afterSpace == 0 && (c == ' ' || c == '\t')) afterSpace = pos + 1;
+      if (leadByte == 0 && (c & 0xC0) != 0x80) leadByte = pos;
+    }
+  }
+  file.close();
+
+  if (afterSpace > 0) return afterSpace;
+  return leadByte > 0 ? leadByte : from;
+}
+
+uint32_t Txt::sectionStart(const uint16_t section) {
+  if (section == 0) return 0;
+  if (section >= sectionStarts.size()) return fileSize;
+
+  if (sectionStarts[section] == 0) {
+    sectionStarts[section] = findCheckpoint(section);
+    indexDirty = true;
+  }
+  return sectionStarts[section];
+}
+
+uint32_t Txt::sectionEnd(const uint16_t section) {
+  return section + 1 < sectionCount() ? sectionStart(section + 1) : fileSize;
+}
+
+uint16_t Txt::sectionForOffset(const uint32_t offset) {
+  uint16_t section = static_cast<uint16_t>(std::min<uint32_t>(offset / SECTION_SIZE, sectionCount() - 1));
+  if (section > 0 && offset < sectionStart(section)) {
+    section--;
+  }
+  return section;
+}
+
+uint16_t Txt::sectionForPercent(const int percent) {
+  const uint64_t offset = static_cast<uint64_t>(fileSize) * std::max(0, std::min(percent, 100)) / 100;
+  return sectionForOffset(static_cast<uint32_t>(offset));
+}
+
+std::string Txt::getSectionCachePath(const int fontId, const uint16_t section) const {
+  return cachePath + "/pages_" + std::to_string(fontId) + "_" + std::to_string(section) + ".bin";
+}
+
+void Txt::setLayout(const uint32_t key) {
+  if (key == layoutKey) return;
+  std::fill(sectionPageCounts.begin(), sectionPageCounts.end(), 0);
+  layoutKey = key;
+  indexDirty = true;
+}
+
+void Txt::setSectionPages(const uint16_t section, const uint16_t pages) {
+  if (section < sectionPageCounts.size() && sectionPageCounts[section] != pages) {
+    sectionPageCounts[section] = pages;
+    indexDirty = true;
+  }
+}
+
+uint16_t Txt::getSectionPages(const uint16_t section) const {
+  return section < sectionPageCounts.size() ? sectionPageCounts[section] : 0;
+}
+
+uint32_t Txt::pagesBefore(const uint16_t section) const {
+  const size_t count = std::min<size_t>(sectionPageCounts.size(), sectionCount());
+
+  // Sections not looked up yet are taken to start on their SECTION_SIZE boundary
+  const auto sectionBytes = [&](const size_t s) -> uint64_t {
+    const uint64_t start = (s == 0) ? 0 : (sectionStarts[s] > 0 ? sectionStarts[s] : s * SECTION_SIZE);
+    const uint64_t end = (s + 1 >= count) ? fileSize
+                                          : (sectionStarts[s + 1] > 0 ? sectionStarts[s + 1] : (s + 1) * SECTION_SIZE);
+    return end > start ? end - start : 0;
+  };
+
+  // Bytes per page as far as the counted sections tell
+  uint64_t countedBytes = 0;
+  uint64_t countedPages = 0;
+  for (size_t s = 0; s < count; s++) {
+    if (sectionPageCounts[s] > 0) {
+      countedBytes += sectionBytes(s);
+      countedPages += sectionPageCounts[s];
+    }
+  }
+  if (countedPages == 0) {
+    countedBytes = BYTES_PER_PAGE;
+    countedPages = 1;
+  }
+
+  uint32_t pages = 0;
+  for (size_t s = 0; s < count && s < section; s++) {
+    if (sectionPageCounts[s] > 0) {
+      pages += sectionPageCounts[s];
+    } else {
+      const uint64_t estimate = (sectionBytes(s) * countedPages + countedBytes / 2) / countedBytes;
+      pages += static_cast<uint32_t>(std::max<uint64_t>(1, estimate));
+    }
+  }
+  return pages;
+}
+
+void Txt::loadIndex() {
+  FsFile file;
+  if (!SdMan.openFileForRead("TXT", cachePath + "/index.bin", file)) {
+    return;
+  }
+
+  uint8_t version;
+  uint32_t indexedSize;
+  uint32_t sectionSize;
+  uint16_t count;
+  uint32_t key;
+  if (!serialization::readPodChecked(file, version) || version != INDEX_FILE_VERSION ||
+      !serialization::readPodChecked(file, indexedSize) || indexedSize != fileSize ||
+      !serialization::readPodChecked(file, sectionSize) || sectionSize != SECTION_SIZE ||
+      !serialization::readPodChecked(file, count) || count != sectionStarts.size() ||
+      !serialization::readPodChecked(file, key)) {
+    LOG_DBG(TAG, "Index out of date, rebuilding");
+    file.close();
+    return;
+  }
+
+  std::vector<uint32_t> starts(count);
+  std::vector<uint16_t> pages(count);
+  for (auto& start : starts) {
+    if (!serialization::readPodChecked(file, start)) {
+      file.close();
+      return;
+    }
+  }
+  for (auto& p : pages) {
+    if (!serialization::readPodChecked(file, p)) {
+      file.close();
+      return;
+    }
+  }
+  file.close();
+
+  sectionStarts = std::move(starts);
+  sectionPageCounts = std::move(pages);
+  layoutKey = key;
+  LOG_DBG(TAG, "Loaded index: %u sections", count);
+}
+
+bool Txt::saveIndex() {
+  if (!indexDirty) {
+    return true;
+  }
+
+  FsFile file;
+  if (!SdMan.openFileForWrite("TXT", cachePath + "/index.bin", file)) {
+    LOG_ERR(TAG, "Failed to write index");
+    return false;
+  }
+
+  serialization::writePod(file, INDEX_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint32_t>(fileSize));
+  serialization::writePod(file, static_cast<uint32_t>(SECTION_SIZE));
+  serialization::writePod(file, static_cast<uint16_t>(sectionStarts.size()));
+  serialization::writePod(file, layoutKey);
+  for (const uint32_t start : sectionStarts) serialization::writePod(file, start);
+  for (const uint16_t pages : sectionPageCounts) serialization::writePod(file, pages);
+  file.close();
+
+  indexDirty = false;
+  return true;
+}
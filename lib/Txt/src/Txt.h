@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 /**
  * TXT File Handler
@@ -22,7 +24,25 @@ class Txt {
   size_t fileSize;
   bool loaded;
 
+  // Checkpoint index (index.bin): where each section starts (0 = not looked up yet) and how
+  // many pages it lays out to in the layout identified by layoutKey (0 = not counted yet)
+  std::vector<uint32_t> sectionStarts;
+  std::vector<uint16_t> sectionPageCounts;
+  uint32_t layoutKey;
+  bool indexDirty;
+
+  uint32_t findCheckpoint(uint16_t section) const;
+  void loadIndex();
+
  public:
+  /**
+   * The reader lays a TXT file out in sections of about SECTION_SIZE bytes. Each one starts at a
+   * checkpoint: the first paragraph (or failing that, word) found in the CHECKPOINT_SEARCH bytes
+   * after a multiple of SECTION_SIZE. Any position opens after paginating one section at most.
+   */
+  static constexpr uint32_t SECTION_SIZE = 64 * 1024;
+  static constexpr uint32_t CHECKPOINT_SEARCH = 4096;
+
   explicit Txt(std::string filepath, const std::string& cacheDir);
   ~Txt() = default;
 
@@ -75,4 +95,32 @@ class Txt {
 
   // Check if file is loaded
   bool isLoaded() const { return loaded; }
+
+  // Sections (see SECTION_SIZE)
+  uint16_t sectionCount() const;
+  // Byte offset a section starts at; looked up in the file (one small read) on first use
+  uint32_t sectionStart(uint16_t section);
+  uint32_t sectionEnd(uint16_t section);
+  // Section holding a byte offset, or the given percentage of the file
+  uint16_t sectionForOffset(uint32_t offset);
+  uint16_t sectionForPercent(int percent);
+  // Page cache file of one section
+  std::string getSectionCachePath(int fontId, uint16_t section) const;
+
+  /**
+   * Page counts per section, for approximate page numbers across the whole file.
+   * Counts only hold for one layout: setLayout() with a different key forgets them.
+   */
+  void setLayout(uint32_t key);
+  void setSectionPages(uint16_t section, uint16_t pages);
+  uint16_t getSectionPages(uint16_t section) const;
+  // Pages before a section and in the whole file: counted where known, estimated elsewhere
+  uint32_t pagesBefore(uint16_t section) const;
+  uint32_t approxPageCount() const { return pagesBefore(sectionCount()); }
+
+  /**
+   * Write the checkpoint index to the cache directory if it changed
+   * @return true on success (or nothing to write)
+   */
+  bool saveIndex();
 };
@@ -71,52 +71,47 @@ int encodeUtf8(char* buf, uint32_t cp) {
   return 4;
 }
 
-// Binary search the NFC composition table for (base, combining) → result.
+// Look up (base, combining) → result in the perfect hash.
 // Returns the composed codepoint, or 0 if not found.
 uint32_t lookupComposition(uint32_t base, uint32_t combining) {
   if (base > 0xFFFF || combining > 0xFFFF) return 0;
 
-  auto b = static_cast<uint16_t>(base);
-  auto c = static_cast<uint16_t>(combining);
-
-  int lo = 0;
-  int hi = static_cast<int>(NFC_TABLE_SIZE) - 1;
-  while (lo <= hi) {
-    int mid = (lo + hi) / 2;
-    const auto& entry = NFC_TABLE[mid];
-    if (entry.base < b || (entry.base == b && entry.combining < c)) {
-      lo = mid + 1;
-    } else if (entry.base > b || (entry.base == b && entry.combining > c)) {
-      hi = mid - 1;
-    } else {
-      return entry.result;
-    }
-  }
-  return 0;
+  const uint32_t key = (base << 16) | combining;
+  const uint8_t displacement = NFC_HASH_DISPLACEMENT[nfcHashMix(key) & (NFC_HASH_BUCKETS - 1)];
+  const uint32_t slot = nfcHashMix(key ^ (displacement * 0x9E3779B9u)) >> (32 - NFC_HASH_SLOT_BITS);
+  const auto& entry = NFC_HASH_TABLE[slot];
+  return (entry.base == base && entry.combining == combining) ? entry.result : 0;
 }
 
-// Check if a codepoint is a combining mark (general category M).
-// We only need to handle the combining marks that appear in our table.
-bool isCombiningMark(uint32_t cp) {
-  return (cp >= 0x0300 && cp <= 0x036F) ||  // Combining Diacritical Marks
-         (cp >= 0x0483 && cp <= 0x0489) ||  // Cyrillic combining marks
-         (cp >= 0x1DC0 && cp <= 0x1DFF) ||  // Combining Diacritical Marks Supplement
-         (cp >= 0x20D0 && cp <= 0x20FF);    // Combining Diacritical Marks for Symbols
+// Quick check: can this codepoint be the second half of a composition (NFC_QC=Maybe)?
+// Text without one is already NFC as far as the table goes.
+bool mayCompose(uint32_t cp) {
+  if (cp >= NFC_QC_LIMIT) return false;
+  const uint32_t* block = NFC_QC_BLOCKS[NFC_QC_INDEX[cp >> 8]];
+  return (block[(cp & 0xFF) >> 5] >> (cp & 31)) & 1;
 }
 
-}  // namespace
-
-size_t utf8NormalizeNfc(char* buf, size_t len) {
-  // Fast path: if all bytes are ASCII, no normalization needed
-  bool allAscii = true;
-  for (size_t i = 0; i < len; i++) {
-    if (static_cast<unsigned char>(buf[i]) >= 0x80) {
-      allAscii = false;
-      break;
+// Where composition has to start: the codepoint before the first one that may compose, or
+// before malformed UTF-8 (which the full pass replaces). len if nothing can change.
+// ASCII is skipped without decoding.
+size_t compositionStart(const char* buf, size_t len) {
+  size_t pos = 0;
+  size_t prev = 0;
+  while (pos < len) {
+    const size_t start = pos;
+    if (static_cast<unsigned char>(buf[pos]) < 0x80) {
+      pos++;
+    } else {
+      const uint32_t cp = decodeUtf8(buf, len, pos);
+      if (cp == 0xFFFD || mayCompose(cp)) return prev;
     }
+    prev = start;
   }
-  if (allAscii) return len;
+  return len;
+}
 
+// Decode, compose and re-encode in place; see utf8NormalizeNfc()
+size_t composeNfc(char* buf, size_t len) {
   // Decode to codepoints (max codepoints = len, since each UTF-8 char >= 1 byte)
   // Use stack buffer for small strings, heap for large ones
   constexpr size_t STACK_SIZE = 256;
@@ -135,7 +130,7 @@ size_t utf8NormalizeNfc(char* buf, size_t len) {
   // Walk through codepoints: try to compose each combining mark with preceding base
   size_t outCount = 0;
   for (size_t i = 0; i < cpCount; i++) {
-    if (outCount > 0 && isCombiningMark(cps[i])) {
+    if (outCount > 0 && mayCompose(cps[i])) {
       uint32_t composed = lookupComposition(cps[outCount - 1], cps[i]);
       if (composed != 0) {
         cps[outCount - 1] = composed;
@@ -155,3 +150,13 @@ size_t utf8NormalizeNfc(char* buf, size_t len) {
   if (cps != stackBuf) delete[] cps;
   return writePos;
 }
+
+}  // namespace
+
+size_t utf8NormalizeNfc(char* buf, size_t len) {
+  // Fast path: nothing in the text can compose (ASCII, and most text in any script). Otherwise
+  // the text before the first base that might take a mark stays as it is.
+  const size_t start = compositionStart(buf, len);
+  if (start == len) return len;
+  return start + composeNfc(buf + start, len - start);
+}
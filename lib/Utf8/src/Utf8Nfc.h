@@ -5,9 +5,10 @@
 /**
  * Normalize a UTF-8 string to NFC (Canonical Composition).
  * Composes NFD-decomposed sequences (e.g., Vietnamese A+circumflex+acute → Ấ).
- * ASCII-only strings pass through with no allocation.
+ * Text with no codepoint that can be the second half of a composition (a bitmap quick check,
+ * see Utf8NfcTable.h) is returned as is without decoding it: ASCII, and most text in any script.
  *
  * Operates in-place on a char buffer. The result is always <= the input length.
- * Returns the new length (excluding null terminator). The buffer is null-terminated.
+ * Returns the new length (excluding null terminator). A buffer that was rewritten is null-terminated.
  */
 size_t utf8NormalizeNfc(char* buf, size_t len);
@@ -1,9 +1,10 @@
 #pragma once
 
 // Auto-generated by scripts/generate-nfc-table.py
-// Canonical NFC composition table for Latin, Greek, Cyrillic ranges.
-// 782 entries, ~4692 bytes in flash.
+// NFC quick check and canonical composition tables for Latin, Greek, Cyrillic ranges.
+// 782 compositions in 1024 hash slots, ~6720 bytes in flash.
 
+#include <cstddef>
 #include <cstdint>
 
 #ifdef ESP_PLATFORM
@@ -20,881 +21,1183 @@ struct NfcComposition {
   uint16_t result;
 };
 
+// Quick check: codepoints that can be the second half of a composition below. Bit cp & 0xFF of
+// block NFC_QC_INDEX[cp >> 8]; block 0 is all clear. Nothing outside the BMP composes.
+constexpr uint32_t NFC_QC_LIMIT = 0x10000;
+
+static const uint8_t NFC_QC_INDEX[256] PROGMEM = {
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint32_t NFC_QC_BLOCKS[2][8] PROGMEM = {
+    {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},
+    {0x081A9FDF, 0x000361F8, 0x00000024, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},
+};
+
+// Composition: perfect hash over (base << 16 | combining). The bucket is the low bits of
+// nfcHashMix(key); the slot is the high bits of nfcHashMix(key ^ displacement * 0x9E3779B9).
+// Empty slots are {0, 0, 0}.
 constexpr size_t NFC_TABLE_SIZE = 782;
+constexpr uint32_t NFC_HASH_SLOT_BITS = 10;
+constexpr uint32_t NFC_HASH_BUCKETS = 256;
 
-static const NfcComposition NFC_TABLE[] PROGMEM = {
-    {0x0041, 0x0300, 0x00C0},  // A + COMBINING GRAVE ACCENT = À (LATIN CAPITAL LETTER A WITH GRAVE)
-    {0x0041, 0x0301, 0x00C1},  // A + COMBINING ACUTE ACCENT = Á (LATIN CAPITAL LETTER A WITH ACUTE)
-    {0x0041, 0x0302, 0x00C2},  // A + COMBINING CIRCUMFLEX ACCENT = Â (LATIN CAPITAL LETTER A WITH CIRCUMFLEX)
-    {0x0041, 0x0303, 0x00C3},  // A + COMBINING TILDE = Ã (LATIN CAPITAL LETTER A WITH TILDE)
-    {0x0041, 0x0304, 0x0100},  // A + COMBINING MACRON = Ā (LATIN CAPITAL LETTER A WITH MACRON)
-    {0x0041, 0x0306, 0x0102},  // A + COMBINING BREVE = Ă (LATIN CAPITAL LETTER A WITH BREVE)
-    {0x0041, 0x0307, 0x0226},  // A + COMBINING DOT ABOVE = Ȧ (LATIN CAPITAL LETTER A WITH DOT ABOVE)
-    {0x0041, 0x0308, 0x00C4},  // A + COMBINING DIAERESIS = Ä (LATIN CAPITAL LETTER A WITH DIAERESIS)
-    {0x0041, 0x0309, 0x1EA2},  // A + COMBINING HOOK ABOVE = Ả (LATIN CAPITAL LETTER A WITH HOOK ABOVE)
-    {0x0041, 0x030A, 0x00C5},  // A + COMBINING RING ABOVE = Å (LATIN CAPITAL LETTER A WITH RING ABOVE)
-    {0x0041, 0x030C, 0x01CD},  // A + COMBINING CARON = Ǎ (LATIN CAPITAL LETTER A WITH CARON)
-    {0x0041, 0x030F, 0x0200},  // A + COMBINING DOUBLE GRAVE ACCENT = Ȁ (LATIN CAPITAL LETTER A WITH DOUBLE GRAVE)
-    {0x0041, 0x0311, 0x0202},  // A + COMBINING INVERTED BREVE = Ȃ (LATIN CAPITAL LETTER A WITH INVERTED BREVE)
-    {0x0041, 0x0323, 0x1EA0},  // A + COMBINING DOT BELOW = Ạ (LATIN CAPITAL LETTER A WITH DOT BELOW)
-    {0x0041, 0x0325, 0x1E00},  // A + COMBINING RING BELOW = Ḁ (LATIN CAPITAL LETTER A WITH RING BELOW)
-    {0x0041, 0x0328, 0x0104},  // A + COMBINING OGONEK = Ą (LATIN CAPITAL LETTER A WITH OGONEK)
-    {0x0042, 0x0307, 0x1E02},  // B + COMBINING DOT ABOVE = Ḃ (LATIN CAPITAL LETTER B WITH DOT ABOVE)
-    {0x0042, 0x0323, 0x1E04},  // B + COMBINING DOT BELOW = Ḅ (LATIN CAPITAL LETTER B WITH DOT BELOW)
+inline uint32_t nfcHashMix(uint32_t k) {
+  k *= 0x9E3779B1u;
+  k ^= k >> 15;
+  k *= 0x85EBCA77u;
+  k ^= k >> 13;
+  return k;
+}
+
+static const uint8_t NFC_HASH_DISPLACEMENT[256] PROGMEM = {
+    5, 3, 2, 2, 0, 5, 0, 0, 4, 0, 7, 0, 1, 0, 18, 8,
+    0, 13, 3, 12, 3, 1, 9, 2, 2, 1, 4, 0, 23, 1, 2, 0,
+    1, 0, 1, 11, 3, 0, 0, 14, 0, 3, 1, 0, 0, 18, 3, 1,
+    4, 4, 1, 1, 7, 5, 1, 0, 5, 7, 3, 12, 9, 0, 0, 2,
+    2, 0, 0, 13, 3, 21, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1,
+    4, 2, 0, 4, 1, 0, 1, 3, 2, 3, 0, 5, 2, 0, 10, 13,
+    2, 2, 4, 7, 8, 9, 4, 0, 0, 20, 3, 1, 1, 2, 2, 0,
+    2, 0, 1, 3, 23, 1, 33, 12, 5, 4, 6, 11, 4, 0, 1, 3,
+    9, 13, 0, 13, 2, 27, 3, 4, 1, 1, 1, 1, 17, 3, 0, 6,
+    3, 3, 0, 11, 1, 0, 10, 4, 1, 0, 3, 8, 0, 4, 2, 0,
+    4, 3, 16, 0, 3, 0, 2, 10, 5, 9, 1, 3, 0, 1, 0, 6,
+    8, 6, 4, 6, 3, 18, 5, 0, 4, 0, 12, 8, 0, 2, 3, 2,
+    7, 9, 6, 0, 14, 0, 5, 3, 2, 0, 4, 14, 21, 6, 3, 0,
+    1, 0, 1, 3, 2, 1, 1, 15, 27, 14, 9, 6, 28, 9, 1, 0,
+    0, 6, 19, 4, 10, 15, 0, 0, 5, 15, 8, 0, 2, 22, 4, 2,
+    1, 7, 20, 1, 22, 0, 1, 30, 1, 1, 0, 1, 32, 0, 4, 29,
+};
+
+static const NfcComposition NFC_HASH_TABLE[1024] PROGMEM = {
+    {0x0061, 0x0309, 0x1EA3},  // a + COMBINING HOOK ABOVE = ả (LATIN SMALL LETTER A WITH HOOK ABOVE)
+    {0x0061, 0x030A, 0x00E5},  // a + COMBINING RING ABOVE = å (LATIN SMALL LETTER A WITH RING ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0226, 0x0304, 0x01E0},  // Ȧ + COMBINING MACRON = Ǡ (LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON)
+    {0x0052, 0x0327, 0x0156},  // R + COMBINING CEDILLA = Ŗ (LATIN CAPITAL LETTER R WITH CEDILLA)
+    {0x0074, 0x030C, 0x0165},  // t + COMBINING CARON = ť (LATIN SMALL LETTER T WITH CARON)
+    {0x1F67, 0x0345, 0x1FA7},  // ὧ + COMBINING GREEK YPOGEGRAMMENI = ᾧ (GREEK SMALL LETTER OMEGA WITH DASIA AND
+                               // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x01A1, 0x0300, 0x1EDD},  // ơ + COMBINING GRAVE ACCENT = ờ (LATIN SMALL LETTER O WITH HORN AND GRAVE)
+    {0x0103, 0x0309, 0x1EB3},  // ă + COMBINING HOOK ABOVE = ẳ (LATIN SMALL LETTER A WITH BREVE AND HOOK ABOVE)
+    {0x03B7, 0x0313, 0x1F20},  // η + COMBINING COMMA ABOVE = ἠ (GREEK SMALL LETTER ETA WITH PSILI)
+    {0x01AF, 0x0300, 0x1EEA},  // Ư + COMBINING GRAVE ACCENT = Ừ (LATIN CAPITAL LETTER U WITH HORN AND GRAVE)
+    {0x1F26, 0x0345, 0x1F96},  // ἦ + COMBINING GREEK YPOGEGRAMMENI = ᾖ (GREEK SMALL LETTER ETA WITH PSILI AND
+                               // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x0055, 0x030B, 0x0170},  // U + COMBINING DOUBLE ACUTE ACCENT = Ű (LATIN CAPITAL LETTER U WITH DOUBLE ACUTE)
+    {0x03C5, 0x0342, 0x1FE6},  // υ + COMBINING GREEK PERISPOMENI = ῦ (GREEK SMALL LETTER UPSILON WITH PERISPOMENI)
+    {0x03B1, 0x0345, 0x1FB3},  // α + COMBINING GREEK YPOGEGRAMMENI = ᾳ (GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI)
+    {0x0055, 0x0308, 0x00DC},  // U + COMBINING DIAERESIS = Ü (LATIN CAPITAL LETTER U WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F30, 0x0300, 0x1F32},  // ἰ + COMBINING GRAVE ACCENT = ἲ (GREEK SMALL LETTER IOTA WITH PSILI AND VARIA)
+    {0x0161, 0x0307, 0x1E67},  // š + COMBINING DOT ABOVE = ṧ (LATIN SMALL LETTER S WITH CARON AND DOT ABOVE)
+    {0x01EA, 0x0304, 0x01EC},  // Ǫ + COMBINING MACRON = Ǭ (LATIN CAPITAL LETTER O WITH OGONEK AND MACRON)
+    {0x03CE, 0x0345,
+     0x1FF4},  // ώ + COMBINING GREEK YPOGEGRAMMENI = ῴ (GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI)
+    {0x0416, 0x0308, 0x04DC},  // Ж + COMBINING DIAERESIS = Ӝ (CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS)
+    {0x0045, 0x0327, 0x0228},  // E + COMBINING CEDILLA = Ȩ (LATIN CAPITAL LETTER E WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0079, 0x0304, 0x0233},  // y + COMBINING MACRON = ȳ (LATIN SMALL LETTER Y WITH MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0061, 0x030F, 0x0201},  // a + COMBINING DOUBLE GRAVE ACCENT = ȁ (LATIN SMALL LETTER A WITH DOUBLE GRAVE)
+    {0x01A1, 0x0323, 0x1EE3},  // ơ + COMBINING DOT BELOW = ợ (LATIN SMALL LETTER O WITH HORN AND DOT BELOW)
+    {0x006E, 0x0301, 0x0144},  // n + COMBINING ACUTE ACCENT = ń (LATIN SMALL LETTER N WITH ACUTE)
+    {0x0067, 0x0307, 0x0121},  // g + COMBINING DOT ABOVE = ġ (LATIN SMALL LETTER G WITH DOT ABOVE)
+    {0x006E, 0x0327, 0x0146},  // n + COMBINING CEDILLA = ņ (LATIN SMALL LETTER N WITH CEDILLA)
+    {0x007A, 0x030C, 0x017E},  // z + COMBINING CARON = ž (LATIN SMALL LETTER Z WITH CARON)
+    {0x1F01, 0x0345,
+     0x1F81},  // ἁ + COMBINING GREEK YPOGEGRAMMENI = ᾁ (GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1FBF, 0x0301, 0x1FCE},  // ᾿ + COMBINING ACUTE ACCENT = ῎ (GREEK PSILI AND OXIA)
+    {0x1F68, 0x0345,
+     0x1FA8},  // Ὠ + COMBINING GREEK YPOGEGRAMMENI = ᾨ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI)
+    {0x1F40, 0x0300, 0x1F42},  // ὀ + COMBINING GRAVE ACCENT = ὂ (GREEK SMALL LETTER OMICRON WITH PSILI AND VARIA)
+    {0x0057, 0x0300, 0x1E80},  // W + COMBINING GRAVE ACCENT = Ẁ (LATIN CAPITAL LETTER W WITH GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0438, 0x0306, 0x0439},  // и + COMBINING BREVE = й (CYRILLIC SMALL LETTER SHORT I)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F51, 0x0300, 0x1F53},  // ὑ + COMBINING GRAVE ACCENT = ὓ (GREEK SMALL LETTER UPSILON WITH DASIA AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0056, 0x0323, 0x1E7E},  // V + COMBINING DOT BELOW = Ṿ (LATIN CAPITAL LETTER V WITH DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0059, 0x0303, 0x1EF8},  // Y + COMBINING TILDE = Ỹ (LATIN CAPITAL LETTER Y WITH TILDE)
+    {0x006C, 0x0327, 0x013C},  // l + COMBINING CEDILLA = ļ (LATIN SMALL LETTER L WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
     {0x0042, 0x0331, 0x1E06},  // B + COMBINING MACRON BELOW = Ḇ (LATIN CAPITAL LETTER B WITH LINE BELOW)
-    {0x0043, 0x0301, 0x0106},  // C + COMBINING ACUTE ACCENT = Ć (LATIN CAPITAL LETTER C WITH ACUTE)
-    {0x0043, 0x0302, 0x0108},  // C + COMBINING CIRCUMFLEX ACCENT = Ĉ (LATIN CAPITAL LETTER C WITH CIRCUMFLEX)
-    {0x0043, 0x0307, 0x010A},  // C + COMBINING DOT ABOVE = Ċ (LATIN CAPITAL LETTER C WITH DOT ABOVE)
-    {0x0043, 0x030C, 0x010C},  // C + COMBINING CARON = Č (LATIN CAPITAL LETTER C WITH CARON)
-    {0x0043, 0x0327, 0x00C7},  // C + COMBINING CEDILLA = Ç (LATIN CAPITAL LETTER C WITH CEDILLA)
-    {0x0044, 0x0307, 0x1E0A},  // D + COMBINING DOT ABOVE = Ḋ (LATIN CAPITAL LETTER D WITH DOT ABOVE)
-    {0x0044, 0x030C, 0x010E},  // D + COMBINING CARON = Ď (LATIN CAPITAL LETTER D WITH CARON)
-    {0x0044, 0x0323, 0x1E0C},  // D + COMBINING DOT BELOW = Ḍ (LATIN CAPITAL LETTER D WITH DOT BELOW)
-    {0x0044, 0x0327, 0x1E10},  // D + COMBINING CEDILLA = Ḑ (LATIN CAPITAL LETTER D WITH CEDILLA)
-    {0x0044, 0x032D,
-     0x1E12},  // D + COMBINING CIRCUMFLEX ACCENT BELOW = Ḓ (LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW)
-    {0x0044, 0x0331, 0x1E0E},  // D + COMBINING MACRON BELOW = Ḏ (LATIN CAPITAL LETTER D WITH LINE BELOW)
-    {0x0045, 0x0300, 0x00C8},  // E + COMBINING GRAVE ACCENT = È (LATIN CAPITAL LETTER E WITH GRAVE)
-    {0x0045, 0x0301, 0x00C9},  // E + COMBINING ACUTE ACCENT = É (LATIN CAPITAL LETTER E WITH ACUTE)
-    {0x0045, 0x0302, 0x00CA},  // E + COMBINING CIRCUMFLEX ACCENT = Ê (LATIN CAPITAL LETTER E WITH CIRCUMFLEX)
-    {0x0045, 0x0303, 0x1EBC},  // E + COMBINING TILDE = Ẽ (LATIN CAPITAL LETTER E WITH TILDE)
-    {0x0045, 0x0304, 0x0112},  // E + COMBINING MACRON = Ē (LATIN CAPITAL LETTER E WITH MACRON)
-    {0x0045, 0x0306, 0x0114},  // E + COMBINING BREVE = Ĕ (LATIN CAPITAL LETTER E WITH BREVE)
-    {0x0045, 0x0307, 0x0116},  // E + COMBINING DOT ABOVE = Ė (LATIN CAPITAL LETTER E WITH DOT ABOVE)
-    {0x0045, 0x0308, 0x00CB},  // E + COMBINING DIAERESIS = Ë (LATIN CAPITAL LETTER E WITH DIAERESIS)
-    {0x0045, 0x0309, 0x1EBA},  // E + COMBINING HOOK ABOVE = Ẻ (LATIN CAPITAL LETTER E WITH HOOK ABOVE)
+    {0x0042, 0x0323, 0x1E04},  // B + COMBINING DOT BELOW = Ḅ (LATIN CAPITAL LETTER B WITH DOT BELOW)
+    {0x0055, 0x0311, 0x0216},  // U + COMBINING INVERTED BREVE = Ȗ (LATIN CAPITAL LETTER U WITH INVERTED BREVE)
+    {0x0055, 0x0301, 0x00DA},  // U + COMBINING ACUTE ACCENT = Ú (LATIN CAPITAL LETTER U WITH ACUTE)
+    {0x0067, 0x0304, 0x1E21},  // g + COMBINING MACRON = ḡ (LATIN SMALL LETTER G WITH MACRON)
+    {0x03B5, 0x0313, 0x1F10},  // ε + COMBINING COMMA ABOVE = ἐ (GREEK SMALL LETTER EPSILON WITH PSILI)
+    {0x1F05, 0x0345,
+     0x1F85},  // ἅ + COMBINING GREEK YPOGEGRAMMENI = ᾅ (GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
+    {0x0102, 0x0309, 0x1EB2},  // Ă + COMBINING HOOK ABOVE = Ẳ (LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE)
+    {0x0054, 0x0331, 0x1E6E},  // T + COMBINING MACRON BELOW = Ṯ (LATIN CAPITAL LETTER T WITH LINE BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0072, 0x0331, 0x1E5F},  // r + COMBINING MACRON BELOW = ṟ (LATIN SMALL LETTER R WITH LINE BELOW)
+    {0x1FBF, 0x0300, 0x1FCD},  // ᾿ + COMBINING GRAVE ACCENT = ῍ (GREEK PSILI AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0433, 0x0301, 0x0453},  // г + COMBINING ACUTE ACCENT = ѓ (CYRILLIC SMALL LETTER GJE)
+    {0x0391, 0x0301, 0x0386},  // Α + COMBINING ACUTE ACCENT = Ά (GREEK CAPITAL LETTER ALPHA WITH TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x03AC, 0x0345,
+     0x1FB4},  // ά + COMBINING GREEK YPOGEGRAMMENI = ᾴ (GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI)
+    {0x0069, 0x030F, 0x0209},  // i + COMBINING DOUBLE GRAVE ACCENT = ȉ (LATIN SMALL LETTER I WITH DOUBLE GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F66, 0x0345, 0x1FA6},  // ὦ + COMBINING GREEK YPOGEGRAMMENI = ᾦ (GREEK SMALL LETTER OMEGA WITH PSILI AND
+                               // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x0048, 0x0323, 0x1E24},  // H + COMBINING DOT BELOW = Ḥ (LATIN CAPITAL LETTER H WITH DOT BELOW)
+    {0x0076, 0x0303, 0x1E7D},  // v + COMBINING TILDE = ṽ (LATIN SMALL LETTER V WITH TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1FFE, 0x0301, 0x1FDE},  // ῾ + COMBINING ACUTE ACCENT = ῞ (GREEK DASIA AND OXIA)
     {0x0045, 0x030C, 0x011A},  // E + COMBINING CARON = Ě (LATIN CAPITAL LETTER E WITH CARON)
-    {0x0045, 0x030F, 0x0204},  // E + COMBINING DOUBLE GRAVE ACCENT = Ȅ (LATIN CAPITAL LETTER E WITH DOUBLE GRAVE)
-    {0x0045, 0x0311, 0x0206},  // E + COMBINING INVERTED BREVE = Ȇ (LATIN CAPITAL LETTER E WITH INVERTED BREVE)
-    {0x0045, 0x0323, 0x1EB8},  // E + COMBINING DOT BELOW = Ẹ (LATIN CAPITAL LETTER E WITH DOT BELOW)
-    {0x0045, 0x0327, 0x0228},  // E + COMBINING CEDILLA = Ȩ (LATIN CAPITAL LETTER E WITH CEDILLA)
-    {0x0045, 0x0328, 0x0118},  // E + COMBINING OGONEK = Ę (LATIN CAPITAL LETTER E WITH OGONEK)
-    {0x0045, 0x032D,
-     0x1E18},  // E + COMBINING CIRCUMFLEX ACCENT BELOW = Ḙ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW)
+    {0x01EB, 0x0304, 0x01ED},  // ǫ + COMBINING MACRON = ǭ (LATIN SMALL LETTER O WITH OGONEK AND MACRON)
+    {0x0059, 0x0302, 0x0176},  // Y + COMBINING CIRCUMFLEX ACCENT = Ŷ (LATIN CAPITAL LETTER Y WITH CIRCUMFLEX)
+    {0x0430, 0x0308, 0x04D3},  // а + COMBINING DIAERESIS = ӓ (CYRILLIC SMALL LETTER A WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0052, 0x0323, 0x1E5A},  // R + COMBINING DOT BELOW = Ṛ (LATIN CAPITAL LETTER R WITH DOT BELOW)
+    {0x00D6, 0x0304, 0x022A},  // Ö + COMBINING MACRON = Ȫ (LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON)
+    {0x1F38, 0x0300, 0x1F3A},  // Ἰ + COMBINING GRAVE ACCENT = Ἲ (GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA)
+    {0x0041, 0x0323, 0x1EA0},  // A + COMBINING DOT BELOW = Ạ (LATIN CAPITAL LETTER A WITH DOT BELOW)
+    {0x00C5, 0x0301, 0x01FA},  // Å + COMBINING ACUTE ACCENT = Ǻ (LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE)
+    {0x03B7, 0x0342, 0x1FC6},  // η + COMBINING GREEK PERISPOMENI = ῆ (GREEK SMALL LETTER ETA WITH PERISPOMENI)
+    {0x1F65, 0x0345,
+     0x1FA5},  // ὥ + COMBINING GREEK YPOGEGRAMMENI = ᾥ (GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0072, 0x0307, 0x1E59},  // r + COMBINING DOT ABOVE = ṙ (LATIN SMALL LETTER R WITH DOT ABOVE)
+    {0x0073, 0x0307, 0x1E61},  // s + COMBINING DOT ABOVE = ṡ (LATIN SMALL LETTER S WITH DOT ABOVE)
+    {0x03A9, 0x0345, 0x1FFC},  // Ω + COMBINING GREEK YPOGEGRAMMENI = ῼ (GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI)
+    {0x0054, 0x030C, 0x0164},  // T + COMBINING CARON = Ť (LATIN CAPITAL LETTER T WITH CARON)
+    {0x0054, 0x0326, 0x021A},  // T + COMBINING COMMA BELOW = Ț (LATIN CAPITAL LETTER T WITH COMMA BELOW)
+    {0x1F31, 0x0300, 0x1F33},  // ἱ + COMBINING GRAVE ACCENT = ἳ (GREEK SMALL LETTER IOTA WITH DASIA AND VARIA)
     {0x0045, 0x0330, 0x1E1A},  // E + COMBINING TILDE BELOW = Ḛ (LATIN CAPITAL LETTER E WITH TILDE BELOW)
+    {0x0049, 0x0307, 0x0130},  // I + COMBINING DOT ABOVE = İ (LATIN CAPITAL LETTER I WITH DOT ABOVE)
+    {0x1EA1, 0x0302,
+     0x1EAD},  // ạ + COMBINING CIRCUMFLEX ACCENT = ậ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND DOT BELOW)
+    {0x006E, 0x032D, 0x1E4B},  // n + COMBINING CIRCUMFLEX ACCENT BELOW = ṋ (LATIN SMALL LETTER N WITH CIRCUMFLEX BELOW)
+    {0x1F2F, 0x0345, 0x1F9F},  // Ἧ + COMBINING GREEK YPOGEGRAMMENI = ᾟ (GREEK CAPITAL LETTER ETA WITH DASIA AND
+                               // PERISPOMENI AND PROSGEGRAMMENI)
+    {0x1F59, 0x0301, 0x1F5D},  // Ὑ + COMBINING ACUTE ACCENT = Ὕ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA)
+    {0x0399, 0x0304, 0x1FD9},  // Ι + COMBINING MACRON = Ῑ (GREEK CAPITAL LETTER IOTA WITH MACRON)
+    {0x03BF, 0x0313, 0x1F40},  // ο + COMBINING COMMA ABOVE = ὀ (GREEK SMALL LETTER OMICRON WITH PSILI)
+    {0x0049, 0x0304, 0x012A},  // I + COMBINING MACRON = Ī (LATIN CAPITAL LETTER I WITH MACRON)
     {0x0046, 0x0307, 0x1E1E},  // F + COMBINING DOT ABOVE = Ḟ (LATIN CAPITAL LETTER F WITH DOT ABOVE)
-    {0x0047, 0x0301, 0x01F4},  // G + COMBINING ACUTE ACCENT = Ǵ (LATIN CAPITAL LETTER G WITH ACUTE)
-    {0x0047, 0x0302, 0x011C},  // G + COMBINING CIRCUMFLEX ACCENT = Ĝ (LATIN CAPITAL LETTER G WITH CIRCUMFLEX)
-    {0x0047, 0x0304, 0x1E20},  // G + COMBINING MACRON = Ḡ (LATIN CAPITAL LETTER G WITH MACRON)
-    {0x0047, 0x0306, 0x011E},  // G + COMBINING BREVE = Ğ (LATIN CAPITAL LETTER G WITH BREVE)
-    {0x0047, 0x0307, 0x0120},  // G + COMBINING DOT ABOVE = Ġ (LATIN CAPITAL LETTER G WITH DOT ABOVE)
+    {0x0064, 0x0331, 0x1E0F},  // d + COMBINING MACRON BELOW = ḏ (LATIN SMALL LETTER D WITH LINE BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F00, 0x0301, 0x1F04},  // ἀ + COMBINING ACUTE ACCENT = ἄ (GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1EA0, 0x0306, 0x1EB6},  // Ạ + COMBINING BREVE = Ặ (LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW)
+    {0x01B0, 0x0303, 0x1EEF},  // ư + COMBINING TILDE = ữ (LATIN SMALL LETTER U WITH HORN AND TILDE)
     {0x0047, 0x030C, 0x01E6},  // G + COMBINING CARON = Ǧ (LATIN CAPITAL LETTER G WITH CARON)
-    {0x0047, 0x0327, 0x0122},  // G + COMBINING CEDILLA = Ģ (LATIN CAPITAL LETTER G WITH CEDILLA)
-    {0x0048, 0x0302, 0x0124},  // H + COMBINING CIRCUMFLEX ACCENT = Ĥ (LATIN CAPITAL LETTER H WITH CIRCUMFLEX)
-    {0x0048, 0x0307, 0x1E22},  // H + COMBINING DOT ABOVE = Ḣ (LATIN CAPITAL LETTER H WITH DOT ABOVE)
-    {0x0048, 0x0308, 0x1E26},  // H + COMBINING DIAERESIS = Ḧ (LATIN CAPITAL LETTER H WITH DIAERESIS)
-    {0x0048, 0x030C, 0x021E},  // H + COMBINING CARON = Ȟ (LATIN CAPITAL LETTER H WITH CARON)
-    {0x0048, 0x0323, 0x1E24},  // H + COMBINING DOT BELOW = Ḥ (LATIN CAPITAL LETTER H WITH DOT BELOW)
-    {0x0048, 0x0327, 0x1E28},  // H + COMBINING CEDILLA = Ḩ (LATIN CAPITAL LETTER H WITH CEDILLA)
-    {0x0048, 0x032E, 0x1E2A},  // H + COMBINING BREVE BELOW = Ḫ (LATIN CAPITAL LETTER H WITH BREVE BELOW)
-    {0x0049, 0x0300, 0x00CC},  // I + COMBINING GRAVE ACCENT = Ì (LATIN CAPITAL LETTER I WITH GRAVE)
-    {0x0049, 0x0301, 0x00CD},  // I + COMBINING ACUTE ACCENT = Í (LATIN CAPITAL LETTER I WITH ACUTE)
-    {0x0049, 0x0302, 0x00CE},  // I + COMBINING CIRCUMFLEX ACCENT = Î (LATIN CAPITAL LETTER I WITH CIRCUMFLEX)
-    {0x0049, 0x0303, 0x0128},  // I + COMBINING TILDE = Ĩ (LATIN CAPITAL LETTER I WITH TILDE)
-    {0x0049, 0x0304, 0x012A},  // I + COMBINING MACRON = Ī (LATIN CAPITAL LETTER I WITH MACRON)
-    {0x0049, 0x0306, 0x012C},  // I + COMBINING BREVE = Ĭ (LATIN CAPITAL LETTER I WITH BREVE)
-    {0x0049, 0x0307, 0x0130},  // I + COMBINING DOT ABOVE = İ (LATIN CAPITAL LETTER I WITH DOT ABOVE)
-    {0x0049, 0x0308, 0x00CF},  // I + COMBINING DIAERESIS = Ï (LATIN CAPITAL LETTER I WITH DIAERESIS)
-    {0x0049, 0x0309, 0x1EC8},  // I + COMBINING HOOK ABOVE = Ỉ (LATIN CAPITAL LETTER I WITH HOOK ABOVE)
-    {0x0049, 0x030C, 0x01CF},  // I + COMBINING CARON = Ǐ (LATIN CAPITAL LETTER I WITH CARON)
-    {0x0049, 0x030F, 0x0208},  // I + COMBINING DOUBLE GRAVE ACCENT = Ȉ (LATIN CAPITAL LETTER I WITH DOUBLE GRAVE)
-    {0x0049, 0x0311, 0x020A},  // I + COMBINING INVERTED BREVE = Ȋ (LATIN CAPITAL LETTER I WITH INVERTED BREVE)
-    {0x0049, 0x0323, 0x1ECA},  // I + COMBINING DOT BELOW = Ị (LATIN CAPITAL LETTER I WITH DOT BELOW)
-    {0x0049, 0x0328, 0x012E},  // I + COMBINING OGONEK = Į (LATIN CAPITAL LETTER I WITH OGONEK)
-    {0x0049, 0x0330, 0x1E2C},  // I + COMBINING TILDE BELOW = Ḭ (LATIN CAPITAL LETTER I WITH TILDE BELOW)
-    {0x004A, 0x0302, 0x0134},  // J + COMBINING CIRCUMFLEX ACCENT = Ĵ (LATIN CAPITAL LETTER J WITH CIRCUMFLEX)
-    {0x004B, 0x0301, 0x1E30},  // K + COMBINING ACUTE ACCENT = Ḱ (LATIN CAPITAL LETTER K WITH ACUTE)
-    {0x004B, 0x030C, 0x01E8},  // K + COMBINING CARON = Ǩ (LATIN CAPITAL LETTER K WITH CARON)
-    {0x004B, 0x0323, 0x1E32},  // K + COMBINING DOT BELOW = Ḳ (LATIN CAPITAL LETTER K WITH DOT BELOW)
-    {0x004B, 0x0327, 0x0136},  // K + COMBINING CEDILLA = Ķ (LATIN CAPITAL LETTER K WITH CEDILLA)
-    {0x004B, 0x0331, 0x1E34},  // K + COMBINING MACRON BELOW = Ḵ (LATIN CAPITAL LETTER K WITH LINE BELOW)
-    {0x004C, 0x0301, 0x0139},  // L + COMBINING ACUTE ACCENT = Ĺ (LATIN CAPITAL LETTER L WITH ACUTE)
-    {0x004C, 0x030C, 0x013D},  // L + COMBINING CARON = Ľ (LATIN CAPITAL LETTER L WITH CARON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0418, 0x0304, 0x04E2},  // И + COMBINING MACRON = Ӣ (CYRILLIC CAPITAL LETTER I WITH MACRON)
+    {0x0061, 0x0308, 0x00E4},  // a + COMBINING DIAERESIS = ä (LATIN SMALL LETTER A WITH DIAERESIS)
+    {0x01A1, 0x0303, 0x1EE1},  // ơ + COMBINING TILDE = ỡ (LATIN SMALL LETTER O WITH HORN AND TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x042B, 0x0308, 0x04F8},  // Ы + COMBINING DIAERESIS = Ӹ (CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x006E, 0x0323, 0x1E47},  // n + COMBINING DOT BELOW = ṇ (LATIN SMALL LETTER N WITH DOT BELOW)
+    {0x00E2, 0x0300, 0x1EA7},  // â + COMBINING GRAVE ACCENT = ầ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND GRAVE)
+    {0x0063, 0x0302, 0x0109},  // c + COMBINING CIRCUMFLEX ACCENT = ĉ (LATIN SMALL LETTER C WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0064, 0x032D, 0x1E13},  // d + COMBINING CIRCUMFLEX ACCENT BELOW = ḓ (LATIN SMALL LETTER D WITH CIRCUMFLEX BELOW)
+    {0x0000, 0x0000, 0x0000},
     {0x004C, 0x0323, 0x1E36},  // L + COMBINING DOT BELOW = Ḷ (LATIN CAPITAL LETTER L WITH DOT BELOW)
+    {0x0399, 0x0308, 0x03AA},  // Ι + COMBINING DIAERESIS = Ϊ (GREEK CAPITAL LETTER IOTA WITH DIALYTIKA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F68, 0x0301, 0x1F6C},  // Ὠ + COMBINING ACUTE ACCENT = Ὤ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA)
+    {0x006F, 0x031B, 0x01A1},  // o + COMBINING HORN = ơ (LATIN SMALL LETTER O WITH HORN)
+    {0x0000, 0x0000, 0x0000},
+    {0x01B0, 0x0300, 0x1EEB},  // ư + COMBINING GRAVE ACCENT = ừ (LATIN SMALL LETTER U WITH HORN AND GRAVE)
+    {0x006E, 0x030C, 0x0148},  // n + COMBINING CARON = ň (LATIN SMALL LETTER N WITH CARON)
+    {0x1F48, 0x0300, 0x1F4A},  // Ὀ + COMBINING GRAVE ACCENT = Ὂ (GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA)
+    {0x0068, 0x032E, 0x1E2B},  // h + COMBINING BREVE BELOW = ḫ (LATIN SMALL LETTER H WITH BREVE BELOW)
+    {0x0041, 0x0306, 0x0102},  // A + COMBINING BREVE = Ă (LATIN CAPITAL LETTER A WITH BREVE)
     {0x004C, 0x0327, 0x013B},  // L + COMBINING CEDILLA = Ļ (LATIN CAPITAL LETTER L WITH CEDILLA)
-    {0x004C, 0x032D,
-     0x1E3C},  // L + COMBINING CIRCUMFLEX ACCENT BELOW = Ḽ (LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW)
-    {0x004C, 0x0331, 0x1E3A},  // L + COMBINING MACRON BELOW = Ḻ (LATIN CAPITAL LETTER L WITH LINE BELOW)
-    {0x004D, 0x0301, 0x1E3E},  // M + COMBINING ACUTE ACCENT = Ḿ (LATIN CAPITAL LETTER M WITH ACUTE)
-    {0x004D, 0x0307, 0x1E40},  // M + COMBINING DOT ABOVE = Ṁ (LATIN CAPITAL LETTER M WITH DOT ABOVE)
-    {0x004D, 0x0323, 0x1E42},  // M + COMBINING DOT BELOW = Ṃ (LATIN CAPITAL LETTER M WITH DOT BELOW)
-    {0x004E, 0x0300, 0x01F8},  // N + COMBINING GRAVE ACCENT = Ǹ (LATIN CAPITAL LETTER N WITH GRAVE)
-    {0x004E, 0x0301, 0x0143},  // N + COMBINING ACUTE ACCENT = Ń (LATIN CAPITAL LETTER N WITH ACUTE)
-    {0x004E, 0x0303, 0x00D1},  // N + COMBINING TILDE = Ñ (LATIN CAPITAL LETTER N WITH TILDE)
-    {0x004E, 0x0307, 0x1E44},  // N + COMBINING DOT ABOVE = Ṅ (LATIN CAPITAL LETTER N WITH DOT ABOVE)
-    {0x004E, 0x030C, 0x0147},  // N + COMBINING CARON = Ň (LATIN CAPITAL LETTER N WITH CARON)
-    {0x004E, 0x0323, 0x1E46},  // N + COMBINING DOT BELOW = Ṇ (LATIN CAPITAL LETTER N WITH DOT BELOW)
-    {0x004E, 0x0327, 0x0145},  // N + COMBINING CEDILLA = Ņ (LATIN CAPITAL LETTER N WITH CEDILLA)
+    {0x0077, 0x030A, 0x1E98},  // w + COMBINING RING ABOVE = ẘ (LATIN SMALL LETTER W WITH RING ABOVE)
+    {0x0079, 0x0301, 0x00FD},  // y + COMBINING ACUTE ACCENT = ý (LATIN SMALL LETTER Y WITH ACUTE)
+    {0x0043, 0x0301, 0x0106},  // C + COMBINING ACUTE ACCENT = Ć (LATIN CAPITAL LETTER C WITH ACUTE)
+    {0x1F2A, 0x0345, 0x1F9A},  // Ἢ + COMBINING GREEK YPOGEGRAMMENI = ᾚ (GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x00D5, 0x0304, 0x022C},  // Õ + COMBINING MACRON = Ȭ (LATIN CAPITAL LETTER O WITH TILDE AND MACRON)
+    {0x1F00, 0x0342,
+     0x1F06},  // ἀ + COMBINING GREEK PERISPOMENI = ἆ (GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x03C5, 0x0313, 0x1F50},  // υ + COMBINING COMMA ABOVE = ὐ (GREEK SMALL LETTER UPSILON WITH PSILI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0053, 0x0323, 0x1E62},  // S + COMBINING DOT BELOW = Ṣ (LATIN CAPITAL LETTER S WITH DOT BELOW)
+    {0x1F08, 0x0342,
+     0x1F0E},  // Ἀ + COMBINING GREEK PERISPOMENI = Ἆ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0061, 0x0302, 0x00E2},  // a + COMBINING CIRCUMFLEX ACCENT = â (LATIN SMALL LETTER A WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0323, 0x1EB8},  // E + COMBINING DOT BELOW = Ẹ (LATIN CAPITAL LETTER E WITH DOT BELOW)
+    {0x03B9, 0x0314, 0x1F31},  // ι + COMBINING REVERSED COMMA ABOVE = ἱ (GREEK SMALL LETTER IOTA WITH DASIA)
+    {0x0391, 0x0314, 0x1F09},  // Α + COMBINING REVERSED COMMA ABOVE = Ἁ (GREEK CAPITAL LETTER ALPHA WITH DASIA)
+    {0x0049, 0x030C, 0x01CF},  // I + COMBINING CARON = Ǐ (LATIN CAPITAL LETTER I WITH CARON)
+    {0x1F6F, 0x0345, 0x1FAF},  // Ὧ + COMBINING GREEK YPOGEGRAMMENI = ᾯ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND
+                               // PERISPOMENI AND PROSGEGRAMMENI)
+    {0x01B0, 0x0309, 0x1EED},  // ư + COMBINING HOOK ABOVE = ử (LATIN SMALL LETTER U WITH HORN AND HOOK ABOVE)
+    {0x00F4, 0x0300, 0x1ED3},  // ô + COMBINING GRAVE ACCENT = ồ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND GRAVE)
+    {0x0053, 0x030C, 0x0160},  // S + COMBINING CARON = Š (LATIN CAPITAL LETTER S WITH CARON)
+    {0x0059, 0x0307, 0x1E8E},  // Y + COMBINING DOT ABOVE = Ẏ (LATIN CAPITAL LETTER Y WITH DOT ABOVE)
+    {0x1F2C, 0x0345, 0x1F9C},  // Ἤ + COMBINING GREEK YPOGEGRAMMENI = ᾜ (GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA
+                               // AND PROSGEGRAMMENI)
+    {0x1F60, 0x0345,
+     0x1FA0},  // ὠ + COMBINING GREEK YPOGEGRAMMENI = ᾠ (GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI)
+    {0x00DC, 0x030C, 0x01D9},  // Ü + COMBINING CARON = Ǚ (LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON)
+    {0x0000, 0x0000, 0x0000},
+    {0x00D4, 0x0309, 0x1ED4},  // Ô + COMBINING HOOK ABOVE = Ổ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x0072, 0x030F, 0x0211},  // r + COMBINING DOUBLE GRAVE ACCENT = ȑ (LATIN SMALL LETTER R WITH DOUBLE GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F19, 0x0301, 0x1F1D},  // Ἑ + COMBINING ACUTE ACCENT = Ἕ (GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA)
+    {0x1F60, 0x0300, 0x1F62},  // ὠ + COMBINING GRAVE ACCENT = ὢ (GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA)
+    {0x0041, 0x0304, 0x0100},  // A + COMBINING MACRON = Ā (LATIN CAPITAL LETTER A WITH MACRON)
+    {0x1F25, 0x0345,
+     0x1F95},  // ἥ + COMBINING GREEK YPOGEGRAMMENI = ᾕ (GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
+    {0x004B, 0x0327, 0x0136},  // K + COMBINING CEDILLA = Ķ (LATIN CAPITAL LETTER K WITH CEDILLA)
+    {0x1F39, 0x0342,
+     0x1F3F},  // Ἱ + COMBINING GREEK PERISPOMENI = Ἷ (GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI)
+    {0x0399, 0x0306, 0x1FD8},  // Ι + COMBINING BREVE = Ῐ (GREEK CAPITAL LETTER IOTA WITH VRACHY)
+    {0x0049, 0x0302, 0x00CE},  // I + COMBINING CIRCUMFLEX ACCENT = Î (LATIN CAPITAL LETTER I WITH CIRCUMFLEX)
     {0x004E, 0x032D,
      0x1E4A},  // N + COMBINING CIRCUMFLEX ACCENT BELOW = Ṋ (LATIN CAPITAL LETTER N WITH CIRCUMFLEX BELOW)
-    {0x004E, 0x0331, 0x1E48},  // N + COMBINING MACRON BELOW = Ṉ (LATIN CAPITAL LETTER N WITH LINE BELOW)
-    {0x004F, 0x0300, 0x00D2},  // O + COMBINING GRAVE ACCENT = Ò (LATIN CAPITAL LETTER O WITH GRAVE)
-    {0x004F, 0x0301, 0x00D3},  // O + COMBINING ACUTE ACCENT = Ó (LATIN CAPITAL LETTER O WITH ACUTE)
-    {0x004F, 0x0302, 0x00D4},  // O + COMBINING CIRCUMFLEX ACCENT = Ô (LATIN CAPITAL LETTER O WITH CIRCUMFLEX)
-    {0x004F, 0x0303, 0x00D5},  // O + COMBINING TILDE = Õ (LATIN CAPITAL LETTER O WITH TILDE)
-    {0x004F, 0x0304, 0x014C},  // O + COMBINING MACRON = Ō (LATIN CAPITAL LETTER O WITH MACRON)
-    {0x004F, 0x0306, 0x014E},  // O + COMBINING BREVE = Ŏ (LATIN CAPITAL LETTER O WITH BREVE)
-    {0x004F, 0x0307, 0x022E},  // O + COMBINING DOT ABOVE = Ȯ (LATIN CAPITAL LETTER O WITH DOT ABOVE)
-    {0x004F, 0x0308, 0x00D6},  // O + COMBINING DIAERESIS = Ö (LATIN CAPITAL LETTER O WITH DIAERESIS)
-    {0x004F, 0x0309, 0x1ECE},  // O + COMBINING HOOK ABOVE = Ỏ (LATIN CAPITAL LETTER O WITH HOOK ABOVE)
-    {0x004F, 0x030B, 0x0150},  // O + COMBINING DOUBLE ACUTE ACCENT = Ő (LATIN CAPITAL LETTER O WITH DOUBLE ACUTE)
-    {0x004F, 0x030C, 0x01D1},  // O + COMBINING CARON = Ǒ (LATIN CAPITAL LETTER O WITH CARON)
-    {0x004F, 0x030F, 0x020C},  // O + COMBINING DOUBLE GRAVE ACCENT = Ȍ (LATIN CAPITAL LETTER O WITH DOUBLE GRAVE)
-    {0x004F, 0x0311, 0x020E},  // O + COMBINING INVERTED BREVE = Ȏ (LATIN CAPITAL LETTER O WITH INVERTED BREVE)
-    {0x004F, 0x031B, 0x01A0},  // O + COMBINING HORN = Ơ (LATIN CAPITAL LETTER O WITH HORN)
-    {0x004F, 0x0323, 0x1ECC},  // O + COMBINING DOT BELOW = Ọ (LATIN CAPITAL LETTER O WITH DOT BELOW)
-    {0x004F, 0x0328, 0x01EA},  // O + COMBINING OGONEK = Ǫ (LATIN CAPITAL LETTER O WITH OGONEK)
+    {0x0102, 0x0300, 0x1EB0},  // Ă + COMBINING GRAVE ACCENT = Ằ (LATIN CAPITAL LETTER A WITH BREVE AND GRAVE)
     {0x0050, 0x0301, 0x1E54},  // P + COMBINING ACUTE ACCENT = Ṕ (LATIN CAPITAL LETTER P WITH ACUTE)
-    {0x0050, 0x0307, 0x1E56},  // P + COMBINING DOT ABOVE = Ṗ (LATIN CAPITAL LETTER P WITH DOT ABOVE)
-    {0x0052, 0x0301, 0x0154},  // R + COMBINING ACUTE ACCENT = Ŕ (LATIN CAPITAL LETTER R WITH ACUTE)
-    {0x0052, 0x0307, 0x1E58},  // R + COMBINING DOT ABOVE = Ṙ (LATIN CAPITAL LETTER R WITH DOT ABOVE)
-    {0x0052, 0x030C, 0x0158},  // R + COMBINING CARON = Ř (LATIN CAPITAL LETTER R WITH CARON)
-    {0x0052, 0x030F, 0x0210},  // R + COMBINING DOUBLE GRAVE ACCENT = Ȑ (LATIN CAPITAL LETTER R WITH DOUBLE GRAVE)
-    {0x0052, 0x0311, 0x0212},  // R + COMBINING INVERTED BREVE = Ȓ (LATIN CAPITAL LETTER R WITH INVERTED BREVE)
-    {0x0052, 0x0323, 0x1E5A},  // R + COMBINING DOT BELOW = Ṛ (LATIN CAPITAL LETTER R WITH DOT BELOW)
-    {0x0052, 0x0327, 0x0156},  // R + COMBINING CEDILLA = Ŗ (LATIN CAPITAL LETTER R WITH CEDILLA)
-    {0x0052, 0x0331, 0x1E5E},  // R + COMBINING MACRON BELOW = Ṟ (LATIN CAPITAL LETTER R WITH LINE BELOW)
-    {0x0053, 0x0301, 0x015A},  // S + COMBINING ACUTE ACCENT = Ś (LATIN CAPITAL LETTER S WITH ACUTE)
-    {0x0053, 0x0302, 0x015C},  // S + COMBINING CIRCUMFLEX ACCENT = Ŝ (LATIN CAPITAL LETTER S WITH CIRCUMFLEX)
-    {0x0053, 0x0307, 0x1E60},  // S + COMBINING DOT ABOVE = Ṡ (LATIN CAPITAL LETTER S WITH DOT ABOVE)
-    {0x0053, 0x030C, 0x0160},  // S + COMBINING CARON = Š (LATIN CAPITAL LETTER S WITH CARON)
-    {0x0053, 0x0323, 0x1E62},  // S + COMBINING DOT BELOW = Ṣ (LATIN CAPITAL LETTER S WITH DOT BELOW)
-    {0x0053, 0x0326, 0x0218},  // S + COMBINING COMMA BELOW = Ș (LATIN CAPITAL LETTER S WITH COMMA BELOW)
-    {0x0053, 0x0327, 0x015E},  // S + COMBINING CEDILLA = Ş (LATIN CAPITAL LETTER S WITH CEDILLA)
-    {0x0054, 0x0307, 0x1E6A},  // T + COMBINING DOT ABOVE = Ṫ (LATIN CAPITAL LETTER T WITH DOT ABOVE)
-    {0x0054, 0x030C, 0x0164},  // T + COMBINING CARON = Ť (LATIN CAPITAL LETTER T WITH CARON)
-    {0x0054, 0x0323, 0x1E6C},  // T + COMBINING DOT BELOW = Ṭ (LATIN CAPITAL LETTER T WITH DOT BELOW)
-    {0x0054, 0x0326, 0x021A},  // T + COMBINING COMMA BELOW = Ț (LATIN CAPITAL LETTER T WITH COMMA BELOW)
-    {0x0054, 0x0327, 0x0162},  // T + COMBINING CEDILLA = Ţ (LATIN CAPITAL LETTER T WITH CEDILLA)
-    {0x0054, 0x032D,
-     0x1E70},  // T + COMBINING CIRCUMFLEX ACCENT BELOW = Ṱ (LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW)
-    {0x0054, 0x0331, 0x1E6E},  // T + COMBINING MACRON BELOW = Ṯ (LATIN CAPITAL LETTER T WITH LINE BELOW)
-    {0x0055, 0x0300, 0x00D9},  // U + COMBINING GRAVE ACCENT = Ù (LATIN CAPITAL LETTER U WITH GRAVE)
-    {0x0055, 0x0301, 0x00DA},  // U + COMBINING ACUTE ACCENT = Ú (LATIN CAPITAL LETTER U WITH ACUTE)
-    {0x0055, 0x0302, 0x00DB},  // U + COMBINING CIRCUMFLEX ACCENT = Û (LATIN CAPITAL LETTER U WITH CIRCUMFLEX)
-    {0x0055, 0x0303, 0x0168},  // U + COMBINING TILDE = Ũ (LATIN CAPITAL LETTER U WITH TILDE)
-    {0x0055, 0x0304, 0x016A},  // U + COMBINING MACRON = Ū (LATIN CAPITAL LETTER U WITH MACRON)
-    {0x0055, 0x0306, 0x016C},  // U + COMBINING BREVE = Ŭ (LATIN CAPITAL LETTER U WITH BREVE)
-    {0x0055, 0x0308, 0x00DC},  // U + COMBINING DIAERESIS = Ü (LATIN CAPITAL LETTER U WITH DIAERESIS)
-    {0x0055, 0x0309, 0x1EE6},  // U + COMBINING HOOK ABOVE = Ủ (LATIN CAPITAL LETTER U WITH HOOK ABOVE)
-    {0x0055, 0x030A, 0x016E},  // U + COMBINING RING ABOVE = Ů (LATIN CAPITAL LETTER U WITH RING ABOVE)
-    {0x0055, 0x030B, 0x0170},  // U + COMBINING DOUBLE ACUTE ACCENT = Ű (LATIN CAPITAL LETTER U WITH DOUBLE ACUTE)
-    {0x0055, 0x030C, 0x01D3},  // U + COMBINING CARON = Ǔ (LATIN CAPITAL LETTER U WITH CARON)
-    {0x0055, 0x030F, 0x0214},  // U + COMBINING DOUBLE GRAVE ACCENT = Ȕ (LATIN CAPITAL LETTER U WITH DOUBLE GRAVE)
-    {0x0055, 0x0311, 0x0216},  // U + COMBINING INVERTED BREVE = Ȗ (LATIN CAPITAL LETTER U WITH INVERTED BREVE)
+    {0x1F69, 0x0300, 0x1F6B},  // Ὡ + COMBINING GRAVE ACCENT = Ὣ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA)
+    {0x0045, 0x030F, 0x0204},  // E + COMBINING DOUBLE GRAVE ACCENT = Ȅ (LATIN CAPITAL LETTER E WITH DOUBLE GRAVE)
+    {0x1F21, 0x0300, 0x1F23},  // ἡ + COMBINING GRAVE ACCENT = ἣ (GREEK SMALL LETTER ETA WITH DASIA AND VARIA)
     {0x0055, 0x031B, 0x01AF},  // U + COMBINING HORN = Ư (LATIN CAPITAL LETTER U WITH HORN)
-    {0x0055, 0x0323, 0x1EE4},  // U + COMBINING DOT BELOW = Ụ (LATIN CAPITAL LETTER U WITH DOT BELOW)
-    {0x0055, 0x0324, 0x1E72},  // U + COMBINING DIAERESIS BELOW = Ṳ (LATIN CAPITAL LETTER U WITH DIAERESIS BELOW)
-    {0x0055, 0x0328, 0x0172},  // U + COMBINING OGONEK = Ų (LATIN CAPITAL LETTER U WITH OGONEK)
-    {0x0055, 0x032D,
-     0x1E76},  // U + COMBINING CIRCUMFLEX ACCENT BELOW = Ṷ (LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW)
-    {0x0055, 0x0330, 0x1E74},  // U + COMBINING TILDE BELOW = Ṵ (LATIN CAPITAL LETTER U WITH TILDE BELOW)
-    {0x0056, 0x0303, 0x1E7C},  // V + COMBINING TILDE = Ṽ (LATIN CAPITAL LETTER V WITH TILDE)
-    {0x0056, 0x0323, 0x1E7E},  // V + COMBINING DOT BELOW = Ṿ (LATIN CAPITAL LETTER V WITH DOT BELOW)
-    {0x0057, 0x0300, 0x1E80},  // W + COMBINING GRAVE ACCENT = Ẁ (LATIN CAPITAL LETTER W WITH GRAVE)
-    {0x0057, 0x0301, 0x1E82},  // W + COMBINING ACUTE ACCENT = Ẃ (LATIN CAPITAL LETTER W WITH ACUTE)
-    {0x0057, 0x0302, 0x0174},  // W + COMBINING CIRCUMFLEX ACCENT = Ŵ (LATIN CAPITAL LETTER W WITH CIRCUMFLEX)
-    {0x0057, 0x0307, 0x1E86},  // W + COMBINING DOT ABOVE = Ẇ (LATIN CAPITAL LETTER W WITH DOT ABOVE)
-    {0x0057, 0x0308, 0x1E84},  // W + COMBINING DIAERESIS = Ẅ (LATIN CAPITAL LETTER W WITH DIAERESIS)
-    {0x0057, 0x0323, 0x1E88},  // W + COMBINING DOT BELOW = Ẉ (LATIN CAPITAL LETTER W WITH DOT BELOW)
-    {0x0058, 0x0307, 0x1E8A},  // X + COMBINING DOT ABOVE = Ẋ (LATIN CAPITAL LETTER X WITH DOT ABOVE)
-    {0x0058, 0x0308, 0x1E8C},  // X + COMBINING DIAERESIS = Ẍ (LATIN CAPITAL LETTER X WITH DIAERESIS)
-    {0x0059, 0x0300, 0x1EF2},  // Y + COMBINING GRAVE ACCENT = Ỳ (LATIN CAPITAL LETTER Y WITH GRAVE)
-    {0x0059, 0x0301, 0x00DD},  // Y + COMBINING ACUTE ACCENT = Ý (LATIN CAPITAL LETTER Y WITH ACUTE)
-    {0x0059, 0x0302, 0x0176},  // Y + COMBINING CIRCUMFLEX ACCENT = Ŷ (LATIN CAPITAL LETTER Y WITH CIRCUMFLEX)
-    {0x0059, 0x0303, 0x1EF8},  // Y + COMBINING TILDE = Ỹ (LATIN CAPITAL LETTER Y WITH TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0309, 0x1EBA},  // E + COMBINING HOOK ABOVE = Ẻ (LATIN CAPITAL LETTER E WITH HOOK ABOVE)
     {0x0059, 0x0304, 0x0232},  // Y + COMBINING MACRON = Ȳ (LATIN CAPITAL LETTER Y WITH MACRON)
-    {0x0059, 0x0307, 0x1E8E},  // Y + COMBINING DOT ABOVE = Ẏ (LATIN CAPITAL LETTER Y WITH DOT ABOVE)
-    {0x0059, 0x0308, 0x0178},  // Y + COMBINING DIAERESIS = Ÿ (LATIN CAPITAL LETTER Y WITH DIAERESIS)
-    {0x0059, 0x0309, 0x1EF6},  // Y + COMBINING HOOK ABOVE = Ỷ (LATIN CAPITAL LETTER Y WITH HOOK ABOVE)
-    {0x0059, 0x0323, 0x1EF4},  // Y + COMBINING DOT BELOW = Ỵ (LATIN CAPITAL LETTER Y WITH DOT BELOW)
-    {0x005A, 0x0301, 0x0179},  // Z + COMBINING ACUTE ACCENT = Ź (LATIN CAPITAL LETTER Z WITH ACUTE)
-    {0x005A, 0x0302, 0x1E90},  // Z + COMBINING CIRCUMFLEX ACCENT = Ẑ (LATIN CAPITAL LETTER Z WITH CIRCUMFLEX)
-    {0x005A, 0x0307, 0x017B},  // Z + COMBINING DOT ABOVE = Ż (LATIN CAPITAL LETTER Z WITH DOT ABOVE)
-    {0x005A, 0x030C, 0x017D},  // Z + COMBINING CARON = Ž (LATIN CAPITAL LETTER Z WITH CARON)
+    {0x0410, 0x0306, 0x04D0},  // А + COMBINING BREVE = Ӑ (CYRILLIC CAPITAL LETTER A WITH BREVE)
+    {0x0068, 0x0323, 0x1E25},  // h + COMBINING DOT BELOW = ḥ (LATIN SMALL LETTER H WITH DOT BELOW)
+    {0x0065, 0x032D, 0x1E19},  // e + COMBINING CIRCUMFLEX ACCENT BELOW = ḙ (LATIN SMALL LETTER E WITH CIRCUMFLEX BELOW)
+    {0x0043, 0x0327, 0x00C7},  // C + COMBINING CEDILLA = Ç (LATIN CAPITAL LETTER C WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0418, 0x0300, 0x040D},  // И + COMBINING GRAVE ACCENT = Ѝ (CYRILLIC CAPITAL LETTER I WITH GRAVE)
     {0x005A, 0x0323, 0x1E92},  // Z + COMBINING DOT BELOW = Ẓ (LATIN CAPITAL LETTER Z WITH DOT BELOW)
-    {0x005A, 0x0331, 0x1E94},  // Z + COMBINING MACRON BELOW = Ẕ (LATIN CAPITAL LETTER Z WITH LINE BELOW)
-    {0x0061, 0x0300, 0x00E0},  // a + COMBINING GRAVE ACCENT = à (LATIN SMALL LETTER A WITH GRAVE)
-    {0x0061, 0x0301, 0x00E1},  // a + COMBINING ACUTE ACCENT = á (LATIN SMALL LETTER A WITH ACUTE)
-    {0x0061, 0x0302, 0x00E2},  // a + COMBINING CIRCUMFLEX ACCENT = â (LATIN SMALL LETTER A WITH CIRCUMFLEX)
-    {0x0061, 0x0303, 0x00E3},  // a + COMBINING TILDE = ã (LATIN SMALL LETTER A WITH TILDE)
     {0x0061, 0x0304, 0x0101},  // a + COMBINING MACRON = ā (LATIN SMALL LETTER A WITH MACRON)
-    {0x0061, 0x0306, 0x0103},  // a + COMBINING BREVE = ă (LATIN SMALL LETTER A WITH BREVE)
-    {0x0061, 0x0307, 0x0227},  // a + COMBINING DOT ABOVE = ȧ (LATIN SMALL LETTER A WITH DOT ABOVE)
-    {0x0061, 0x0308, 0x00E4},  // a + COMBINING DIAERESIS = ä (LATIN SMALL LETTER A WITH DIAERESIS)
-    {0x0061, 0x0309, 0x1EA3},  // a + COMBINING HOOK ABOVE = ả (LATIN SMALL LETTER A WITH HOOK ABOVE)
-    {0x0061, 0x030A, 0x00E5},  // a + COMBINING RING ABOVE = å (LATIN SMALL LETTER A WITH RING ABOVE)
-    {0x0061, 0x030C, 0x01CE},  // a + COMBINING CARON = ǎ (LATIN SMALL LETTER A WITH CARON)
-    {0x0061, 0x030F, 0x0201},  // a + COMBINING DOUBLE GRAVE ACCENT = ȁ (LATIN SMALL LETTER A WITH DOUBLE GRAVE)
-    {0x0061, 0x0311, 0x0203},  // a + COMBINING INVERTED BREVE = ȃ (LATIN SMALL LETTER A WITH INVERTED BREVE)
-    {0x0061, 0x0323, 0x1EA1},  // a + COMBINING DOT BELOW = ạ (LATIN SMALL LETTER A WITH DOT BELOW)
+    {0x1F0C, 0x0345, 0x1F8C},  // Ἄ + COMBINING GREEK YPOGEGRAMMENI = ᾌ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA
+                               // AND PROSGEGRAMMENI)
+    {0x03A5, 0x0314, 0x1F59},  // Υ + COMBINING REVERSED COMMA ABOVE = Ὑ (GREEK CAPITAL LETTER UPSILON WITH DASIA)
+    {0x1F0A, 0x0345, 0x1F8A},  // Ἂ + COMBINING GREEK YPOGEGRAMMENI = ᾊ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x0041, 0x0307, 0x0226},  // A + COMBINING DOT ABOVE = Ȧ (LATIN CAPITAL LETTER A WITH DOT ABOVE)
+    {0x0055, 0x0302, 0x00DB},  // U + COMBINING CIRCUMFLEX ACCENT = Û (LATIN CAPITAL LETTER U WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0067, 0x030C, 0x01E7},  // g + COMBINING CARON = ǧ (LATIN SMALL LETTER G WITH CARON)
+    {0x1F61, 0x0300, 0x1F63},  // ὡ + COMBINING GRAVE ACCENT = ὣ (GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA)
+    {0x004C, 0x032D,
+     0x1E3C},  // L + COMBINING CIRCUMFLEX ACCENT BELOW = Ḽ (LATIN CAPITAL LETTER L WITH CIRCUMFLEX BELOW)
+    {0x004E, 0x0303, 0x00D1},  // N + COMBINING TILDE = Ñ (LATIN CAPITAL LETTER N WITH TILDE)
+    {0x0055, 0x0328, 0x0172},  // U + COMBINING OGONEK = Ų (LATIN CAPITAL LETTER U WITH OGONEK)
+    {0x004E, 0x0327, 0x0145},  // N + COMBINING CEDILLA = Ņ (LATIN CAPITAL LETTER N WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0058, 0x0307, 0x1E8A},  // X + COMBINING DOT ABOVE = Ẋ (LATIN CAPITAL LETTER X WITH DOT ABOVE)
+    {0x004E, 0x030C, 0x0147},  // N + COMBINING CARON = Ň (LATIN CAPITAL LETTER N WITH CARON)
+    {0x006C, 0x0301, 0x013A},  // l + COMBINING ACUTE ACCENT = ĺ (LATIN SMALL LETTER L WITH ACUTE)
+    {0x1F49, 0x0301, 0x1F4D},  // Ὁ + COMBINING ACUTE ACCENT = Ὅ (GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0061, 0x0303, 0x00E3},  // a + COMBINING TILDE = ã (LATIN SMALL LETTER A WITH TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0059, 0x0308, 0x0178},  // Y + COMBINING DIAERESIS = Ÿ (LATIN CAPITAL LETTER Y WITH DIAERESIS)
+    {0x00D8, 0x0301, 0x01FE},  // Ø + COMBINING ACUTE ACCENT = Ǿ (LATIN CAPITAL LETTER O WITH STROKE AND ACUTE)
+    {0x0438, 0x0308, 0x04E5},  // и + COMBINING DIAERESIS = ӥ (CYRILLIC SMALL LETTER I WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F29, 0x0300, 0x1F2B},  // Ἡ + COMBINING GRAVE ACCENT = Ἣ (GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F10, 0x0301, 0x1F14},  // ἐ + COMBINING ACUTE ACCENT = ἔ (GREEK SMALL LETTER EPSILON WITH PSILI AND OXIA)
     {0x0061, 0x0325, 0x1E01},  // a + COMBINING RING BELOW = ḁ (LATIN SMALL LETTER A WITH RING BELOW)
-    {0x0061, 0x0328, 0x0105},  // a + COMBINING OGONEK = ą (LATIN SMALL LETTER A WITH OGONEK)
-    {0x0062, 0x0307, 0x1E03},  // b + COMBINING DOT ABOVE = ḃ (LATIN SMALL LETTER B WITH DOT ABOVE)
-    {0x0062, 0x0323, 0x1E05},  // b + COMBINING DOT BELOW = ḅ (LATIN SMALL LETTER B WITH DOT BELOW)
-    {0x0062, 0x0331, 0x1E07},  // b + COMBINING MACRON BELOW = ḇ (LATIN SMALL LETTER B WITH LINE BELOW)
-    {0x0063, 0x0301, 0x0107},  // c + COMBINING ACUTE ACCENT = ć (LATIN SMALL LETTER C WITH ACUTE)
-    {0x0063, 0x0302, 0x0109},  // c + COMBINING CIRCUMFLEX ACCENT = ĉ (LATIN SMALL LETTER C WITH CIRCUMFLEX)
-    {0x0063, 0x0307, 0x010B},  // c + COMBINING DOT ABOVE = ċ (LATIN SMALL LETTER C WITH DOT ABOVE)
-    {0x0063, 0x030C, 0x010D},  // c + COMBINING CARON = č (LATIN SMALL LETTER C WITH CARON)
-    {0x0063, 0x0327, 0x00E7},  // c + COMBINING CEDILLA = ç (LATIN SMALL LETTER C WITH CEDILLA)
-    {0x0064, 0x0307, 0x1E0B},  // d + COMBINING DOT ABOVE = ḋ (LATIN SMALL LETTER D WITH DOT ABOVE)
-    {0x0064, 0x030C, 0x010F},  // d + COMBINING CARON = ď (LATIN SMALL LETTER D WITH CARON)
-    {0x0064, 0x0323, 0x1E0D},  // d + COMBINING DOT BELOW = ḍ (LATIN SMALL LETTER D WITH DOT BELOW)
-    {0x0064, 0x0327, 0x1E11},  // d + COMBINING CEDILLA = ḑ (LATIN SMALL LETTER D WITH CEDILLA)
-    {0x0064, 0x032D, 0x1E13},  // d + COMBINING CIRCUMFLEX ACCENT BELOW = ḓ (LATIN SMALL LETTER D WITH CIRCUMFLEX BELOW)
-    {0x0064, 0x0331, 0x1E0F},  // d + COMBINING MACRON BELOW = ḏ (LATIN SMALL LETTER D WITH LINE BELOW)
-    {0x0065, 0x0300, 0x00E8},  // e + COMBINING GRAVE ACCENT = è (LATIN SMALL LETTER E WITH GRAVE)
-    {0x0065, 0x0301, 0x00E9},  // e + COMBINING ACUTE ACCENT = é (LATIN SMALL LETTER E WITH ACUTE)
-    {0x0065, 0x0302, 0x00EA},  // e + COMBINING CIRCUMFLEX ACCENT = ê (LATIN SMALL LETTER E WITH CIRCUMFLEX)
-    {0x0065, 0x0303, 0x1EBD},  // e + COMBINING TILDE = ẽ (LATIN SMALL LETTER E WITH TILDE)
-    {0x0065, 0x0304, 0x0113},  // e + COMBINING MACRON = ē (LATIN SMALL LETTER E WITH MACRON)
-    {0x0065, 0x0306, 0x0115},  // e + COMBINING BREVE = ĕ (LATIN SMALL LETTER E WITH BREVE)
-    {0x0065, 0x0307, 0x0117},  // e + COMBINING DOT ABOVE = ė (LATIN SMALL LETTER E WITH DOT ABOVE)
+    {0x0075, 0x0308, 0x00FC},  // u + COMBINING DIAERESIS = ü (LATIN SMALL LETTER U WITH DIAERESIS)
+    {0x0059, 0x0301, 0x00DD},  // Y + COMBINING ACUTE ACCENT = Ý (LATIN CAPITAL LETTER Y WITH ACUTE)
     {0x0065, 0x0308, 0x00EB},  // e + COMBINING DIAERESIS = ë (LATIN SMALL LETTER E WITH DIAERESIS)
-    {0x0065, 0x0309, 0x1EBB},  // e + COMBINING HOOK ABOVE = ẻ (LATIN SMALL LETTER E WITH HOOK ABOVE)
-    {0x0065, 0x030C, 0x011B},  // e + COMBINING CARON = ě (LATIN SMALL LETTER E WITH CARON)
-    {0x0065, 0x030F, 0x0205},  // e + COMBINING DOUBLE GRAVE ACCENT = ȅ (LATIN SMALL LETTER E WITH DOUBLE GRAVE)
-    {0x0065, 0x0311, 0x0207},  // e + COMBINING INVERTED BREVE = ȇ (LATIN SMALL LETTER E WITH INVERTED BREVE)
-    {0x0065, 0x0323, 0x1EB9},  // e + COMBINING DOT BELOW = ẹ (LATIN SMALL LETTER E WITH DOT BELOW)
-    {0x0065, 0x0327, 0x0229},  // e + COMBINING CEDILLA = ȩ (LATIN SMALL LETTER E WITH CEDILLA)
-    {0x0065, 0x0328, 0x0119},  // e + COMBINING OGONEK = ę (LATIN SMALL LETTER E WITH OGONEK)
-    {0x0065, 0x032D, 0x1E19},  // e + COMBINING CIRCUMFLEX ACCENT BELOW = ḙ (LATIN SMALL LETTER E WITH CIRCUMFLEX BELOW)
-    {0x0065, 0x0330, 0x1E1B},  // e + COMBINING TILDE BELOW = ḛ (LATIN SMALL LETTER E WITH TILDE BELOW)
-    {0x0066, 0x0307, 0x1E1F},  // f + COMBINING DOT ABOVE = ḟ (LATIN SMALL LETTER F WITH DOT ABOVE)
-    {0x0067, 0x0301, 0x01F5},  // g + COMBINING ACUTE ACCENT = ǵ (LATIN SMALL LETTER G WITH ACUTE)
-    {0x0067, 0x0302, 0x011D},  // g + COMBINING CIRCUMFLEX ACCENT = ĝ (LATIN SMALL LETTER G WITH CIRCUMFLEX)
-    {0x0067, 0x0304, 0x1E21},  // g + COMBINING MACRON = ḡ (LATIN SMALL LETTER G WITH MACRON)
-    {0x0067, 0x0306, 0x011F},  // g + COMBINING BREVE = ğ (LATIN SMALL LETTER G WITH BREVE)
-    {0x0067, 0x0307, 0x0121},  // g + COMBINING DOT ABOVE = ġ (LATIN SMALL LETTER G WITH DOT ABOVE)
-    {0x0067, 0x030C, 0x01E7},  // g + COMBINING CARON = ǧ (LATIN SMALL LETTER G WITH CARON)
-    {0x0067, 0x0327, 0x0123},  // g + COMBINING CEDILLA = ģ (LATIN SMALL LETTER G WITH CEDILLA)
+    {0x0074, 0x0307, 0x1E6B},  // t + COMBINING DOT ABOVE = ṫ (LATIN SMALL LETTER T WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x006F, 0x0309, 0x1ECF},  // o + COMBINING HOOK ABOVE = ỏ (LATIN SMALL LETTER O WITH HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
     {0x0068, 0x0302, 0x0125},  // h + COMBINING CIRCUMFLEX ACCENT = ĥ (LATIN SMALL LETTER H WITH CIRCUMFLEX)
-    {0x0068, 0x0307, 0x1E23},  // h + COMBINING DOT ABOVE = ḣ (LATIN SMALL LETTER H WITH DOT ABOVE)
-    {0x0068, 0x0308, 0x1E27},  // h + COMBINING DIAERESIS = ḧ (LATIN SMALL LETTER H WITH DIAERESIS)
-    {0x0068, 0x030C, 0x021F},  // h + COMBINING CARON = ȟ (LATIN SMALL LETTER H WITH CARON)
-    {0x0068, 0x0323, 0x1E25},  // h + COMBINING DOT BELOW = ḥ (LATIN SMALL LETTER H WITH DOT BELOW)
-    {0x0068, 0x0327, 0x1E29},  // h + COMBINING CEDILLA = ḩ (LATIN SMALL LETTER H WITH CEDILLA)
-    {0x0068, 0x032E, 0x1E2B},  // h + COMBINING BREVE BELOW = ḫ (LATIN SMALL LETTER H WITH BREVE BELOW)
-    {0x0068, 0x0331, 0x1E96},  // h + COMBINING MACRON BELOW = ẖ (LATIN SMALL LETTER H WITH LINE BELOW)
-    {0x0069, 0x0300, 0x00EC},  // i + COMBINING GRAVE ACCENT = ì (LATIN SMALL LETTER I WITH GRAVE)
-    {0x0069, 0x0301, 0x00ED},  // i + COMBINING ACUTE ACCENT = í (LATIN SMALL LETTER I WITH ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0075, 0x0300, 0x00F9},  // u + COMBINING GRAVE ACCENT = ù (LATIN SMALL LETTER U WITH GRAVE)
     {0x0069, 0x0302, 0x00EE},  // i + COMBINING CIRCUMFLEX ACCENT = î (LATIN SMALL LETTER I WITH CIRCUMFLEX)
-    {0x0069, 0x0303, 0x0129},  // i + COMBINING TILDE = ĩ (LATIN SMALL LETTER I WITH TILDE)
-    {0x0069, 0x0304, 0x012B},  // i + COMBINING MACRON = ī (LATIN SMALL LETTER I WITH MACRON)
-    {0x0069, 0x0306, 0x012D},  // i + COMBINING BREVE = ĭ (LATIN SMALL LETTER I WITH BREVE)
-    {0x0069, 0x0308, 0x00EF},  // i + COMBINING DIAERESIS = ï (LATIN SMALL LETTER I WITH DIAERESIS)
-    {0x0069, 0x0309, 0x1EC9},  // i + COMBINING HOOK ABOVE = ỉ (LATIN SMALL LETTER I WITH HOOK ABOVE)
-    {0x0069, 0x030C, 0x01D0},  // i + COMBINING CARON = ǐ (LATIN SMALL LETTER I WITH CARON)
-    {0x0069, 0x030F, 0x0209},  // i + COMBINING DOUBLE GRAVE ACCENT = ȉ (LATIN SMALL LETTER I WITH DOUBLE GRAVE)
-    {0x0069, 0x0311, 0x020B},  // i + COMBINING INVERTED BREVE = ȋ (LATIN SMALL LETTER I WITH INVERTED BREVE)
-    {0x0069, 0x0323, 0x1ECB},  // i + COMBINING DOT BELOW = ị (LATIN SMALL LETTER I WITH DOT BELOW)
-    {0x0069, 0x0328, 0x012F},  // i + COMBINING OGONEK = į (LATIN SMALL LETTER I WITH OGONEK)
     {0x0069, 0x0330, 0x1E2D},  // i + COMBINING TILDE BELOW = ḭ (LATIN SMALL LETTER I WITH TILDE BELOW)
-    {0x006A, 0x0302, 0x0135},  // j + COMBINING CIRCUMFLEX ACCENT = ĵ (LATIN SMALL LETTER J WITH CIRCUMFLEX)
-    {0x006A, 0x030C, 0x01F0},  // j + COMBINING CARON = ǰ (LATIN SMALL LETTER J WITH CARON)
-    {0x006B, 0x0301, 0x1E31},  // k + COMBINING ACUTE ACCENT = ḱ (LATIN SMALL LETTER K WITH ACUTE)
-    {0x006B, 0x030C, 0x01E9},  // k + COMBINING CARON = ǩ (LATIN SMALL LETTER K WITH CARON)
-    {0x006B, 0x0323, 0x1E33},  // k + COMBINING DOT BELOW = ḳ (LATIN SMALL LETTER K WITH DOT BELOW)
-    {0x006B, 0x0327, 0x0137},  // k + COMBINING CEDILLA = ķ (LATIN SMALL LETTER K WITH CEDILLA)
-    {0x006B, 0x0331, 0x1E35},  // k + COMBINING MACRON BELOW = ḵ (LATIN SMALL LETTER K WITH LINE BELOW)
-    {0x006C, 0x0301, 0x013A},  // l + COMBINING ACUTE ACCENT = ĺ (LATIN SMALL LETTER L WITH ACUTE)
-    {0x006C, 0x030C, 0x013E},  // l + COMBINING CARON = ľ (LATIN SMALL LETTER L WITH CARON)
-    {0x006C, 0x0323, 0x1E37},  // l + COMBINING DOT BELOW = ḷ (LATIN SMALL LETTER L WITH DOT BELOW)
-    {0x006C, 0x0327, 0x013C},  // l + COMBINING CEDILLA = ļ (LATIN SMALL LETTER L WITH CEDILLA)
-    {0x006C, 0x032D, 0x1E3D},  // l + COMBINING CIRCUMFLEX ACCENT BELOW = ḽ (LATIN SMALL LETTER L WITH CIRCUMFLEX BELOW)
-    {0x006C, 0x0331, 0x1E3B},  // l + COMBINING MACRON BELOW = ḻ (LATIN SMALL LETTER L WITH LINE BELOW)
-    {0x006D, 0x0301, 0x1E3F},  // m + COMBINING ACUTE ACCENT = ḿ (LATIN SMALL LETTER M WITH ACUTE)
-    {0x006D, 0x0307, 0x1E41},  // m + COMBINING DOT ABOVE = ṁ (LATIN SMALL LETTER M WITH DOT ABOVE)
-    {0x006D, 0x0323, 0x1E43},  // m + COMBINING DOT BELOW = ṃ (LATIN SMALL LETTER M WITH DOT BELOW)
-    {0x006E, 0x0300, 0x01F9},  // n + COMBINING GRAVE ACCENT = ǹ (LATIN SMALL LETTER N WITH GRAVE)
-    {0x006E, 0x0301, 0x0144},  // n + COMBINING ACUTE ACCENT = ń (LATIN SMALL LETTER N WITH ACUTE)
-    {0x006E, 0x0303, 0x00F1},  // n + COMBINING TILDE = ñ (LATIN SMALL LETTER N WITH TILDE)
-    {0x006E, 0x0307, 0x1E45},  // n + COMBINING DOT ABOVE = ṅ (LATIN SMALL LETTER N WITH DOT ABOVE)
-    {0x006E, 0x030C, 0x0148},  // n + COMBINING CARON = ň (LATIN SMALL LETTER N WITH CARON)
-    {0x006E, 0x0323, 0x1E47},  // n + COMBINING DOT BELOW = ṇ (LATIN SMALL LETTER N WITH DOT BELOW)
-    {0x006E, 0x0327, 0x0146},  // n + COMBINING CEDILLA = ņ (LATIN SMALL LETTER N WITH CEDILLA)
-    {0x006E, 0x032D, 0x1E4B},  // n + COMBINING CIRCUMFLEX ACCENT BELOW = ṋ (LATIN SMALL LETTER N WITH CIRCUMFLEX BELOW)
-    {0x006E, 0x0331, 0x1E49},  // n + COMBINING MACRON BELOW = ṉ (LATIN SMALL LETTER N WITH LINE BELOW)
-    {0x006F, 0x0300, 0x00F2},  // o + COMBINING GRAVE ACCENT = ò (LATIN SMALL LETTER O WITH GRAVE)
-    {0x006F, 0x0301, 0x00F3},  // o + COMBINING ACUTE ACCENT = ó (LATIN SMALL LETTER O WITH ACUTE)
-    {0x006F, 0x0302, 0x00F4},  // o + COMBINING CIRCUMFLEX ACCENT = ô (LATIN SMALL LETTER O WITH CIRCUMFLEX)
-    {0x006F, 0x0303, 0x00F5},  // o + COMBINING TILDE = õ (LATIN SMALL LETTER O WITH TILDE)
-    {0x006F, 0x0304, 0x014D},  // o + COMBINING MACRON = ō (LATIN SMALL LETTER O WITH MACRON)
-    {0x006F, 0x0306, 0x014F},  // o + COMBINING BREVE = ŏ (LATIN SMALL LETTER O WITH BREVE)
-    {0x006F, 0x0307, 0x022F},  // o + COMBINING DOT ABOVE = ȯ (LATIN SMALL LETTER O WITH DOT ABOVE)
+    {0x0067, 0x0306, 0x011F},  // g + COMBINING BREVE = ğ (LATIN SMALL LETTER G WITH BREVE)
+    {0x0049, 0x0328, 0x012E},  // I + COMBINING OGONEK = Į (LATIN CAPITAL LETTER I WITH OGONEK)
+    {0x0055, 0x0309, 0x1EE6},  // U + COMBINING HOOK ABOVE = Ủ (LATIN CAPITAL LETTER U WITH HOOK ABOVE)
+    {0x0103, 0x0300, 0x1EB1},  // ă + COMBINING GRAVE ACCENT = ằ (LATIN SMALL LETTER A WITH BREVE AND GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0054, 0x0307, 0x1E6A},  // T + COMBINING DOT ABOVE = Ṫ (LATIN CAPITAL LETTER T WITH DOT ABOVE)
+    {0x00C2, 0x0309, 0x1EA8},  // Â + COMBINING HOOK ABOVE = Ẩ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x00D5, 0x0301, 0x1E4C},  // Õ + COMBINING ACUTE ACCENT = Ṍ (LATIN CAPITAL LETTER O WITH TILDE AND ACUTE)
+    {0x0075, 0x0309, 0x1EE7},  // u + COMBINING HOOK ABOVE = ủ (LATIN SMALL LETTER U WITH HOOK ABOVE)
+    {0x0053, 0x0301, 0x015A},  // S + COMBINING ACUTE ACCENT = Ś (LATIN CAPITAL LETTER S WITH ACUTE)
+    {0x00EA, 0x0303, 0x1EC5},  // ê + COMBINING TILDE = ễ (LATIN SMALL LETTER E WITH CIRCUMFLEX AND TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x03B1, 0x0301, 0x03AC},  // α + COMBINING ACUTE ACCENT = ά (GREEK SMALL LETTER ALPHA WITH TONOS)
+    {0x03B5, 0x0314, 0x1F11},  // ε + COMBINING REVERSED COMMA ABOVE = ἑ (GREEK SMALL LETTER EPSILON WITH DASIA)
+    {0x03A9, 0x0300, 0x1FFA},  // Ω + COMBINING GRAVE ACCENT = Ὼ (GREEK CAPITAL LETTER OMEGA WITH VARIA)
+    {0x0415, 0x0300, 0x0400},  // Е + COMBINING GRAVE ACCENT = Ѐ (CYRILLIC CAPITAL LETTER IE WITH GRAVE)
+    {0x0397, 0x0313, 0x1F28},  // Η + COMBINING COMMA ABOVE = Ἠ (GREEK CAPITAL LETTER ETA WITH PSILI)
+    {0x03B1, 0x0313, 0x1F00},  // α + COMBINING COMMA ABOVE = ἀ (GREEK SMALL LETTER ALPHA WITH PSILI)
+    {0x0074, 0x032D, 0x1E71},  // t + COMBINING CIRCUMFLEX ACCENT BELOW = ṱ (LATIN SMALL LETTER T WITH CIRCUMFLEX BELOW)
+    {0x0064, 0x0323, 0x1E0D},  // d + COMBINING DOT BELOW = ḍ (LATIN SMALL LETTER D WITH DOT BELOW)
+    {0x0395, 0x0313, 0x1F18},  // Ε + COMBINING COMMA ABOVE = Ἐ (GREEK CAPITAL LETTER EPSILON WITH PSILI)
     {0x006F, 0x0308, 0x00F6},  // o + COMBINING DIAERESIS = ö (LATIN SMALL LETTER O WITH DIAERESIS)
-    {0x006F, 0x0309, 0x1ECF},  // o + COMBINING HOOK ABOVE = ỏ (LATIN SMALL LETTER O WITH HOOK ABOVE)
-    {0x006F, 0x030B, 0x0151},  // o + COMBINING DOUBLE ACUTE ACCENT = ő (LATIN SMALL LETTER O WITH DOUBLE ACUTE)
-    {0x006F, 0x030C, 0x01D2},  // o + COMBINING CARON = ǒ (LATIN SMALL LETTER O WITH CARON)
-    {0x006F, 0x030F, 0x020D},  // o + COMBINING DOUBLE GRAVE ACCENT = ȍ (LATIN SMALL LETTER O WITH DOUBLE GRAVE)
-    {0x006F, 0x0311, 0x020F},  // o + COMBINING INVERTED BREVE = ȏ (LATIN SMALL LETTER O WITH INVERTED BREVE)
-    {0x006F, 0x031B, 0x01A1},  // o + COMBINING HORN = ơ (LATIN SMALL LETTER O WITH HORN)
-    {0x006F, 0x0323, 0x1ECD},  // o + COMBINING DOT BELOW = ọ (LATIN SMALL LETTER O WITH DOT BELOW)
-    {0x006F, 0x0328, 0x01EB},  // o + COMBINING OGONEK = ǫ (LATIN SMALL LETTER O WITH OGONEK)
-    {0x0070, 0x0301, 0x1E55},  // p + COMBINING ACUTE ACCENT = ṕ (LATIN SMALL LETTER P WITH ACUTE)
-    {0x0070, 0x0307, 0x1E57},  // p + COMBINING DOT ABOVE = ṗ (LATIN SMALL LETTER P WITH DOT ABOVE)
-    {0x0072, 0x0301, 0x0155},  // r + COMBINING ACUTE ACCENT = ŕ (LATIN SMALL LETTER R WITH ACUTE)
-    {0x0072, 0x0307, 0x1E59},  // r + COMBINING DOT ABOVE = ṙ (LATIN SMALL LETTER R WITH DOT ABOVE)
-    {0x0072, 0x030C, 0x0159},  // r + COMBINING CARON = ř (LATIN SMALL LETTER R WITH CARON)
-    {0x0072, 0x030F, 0x0211},  // r + COMBINING DOUBLE GRAVE ACCENT = ȑ (LATIN SMALL LETTER R WITH DOUBLE GRAVE)
-    {0x0072, 0x0311, 0x0213},  // r + COMBINING INVERTED BREVE = ȓ (LATIN SMALL LETTER R WITH INVERTED BREVE)
-    {0x0072, 0x0323, 0x1E5B},  // r + COMBINING DOT BELOW = ṛ (LATIN SMALL LETTER R WITH DOT BELOW)
-    {0x0072, 0x0327, 0x0157},  // r + COMBINING CEDILLA = ŗ (LATIN SMALL LETTER R WITH CEDILLA)
-    {0x0072, 0x0331, 0x1E5F},  // r + COMBINING MACRON BELOW = ṟ (LATIN SMALL LETTER R WITH LINE BELOW)
-    {0x0073, 0x0301, 0x015B},  // s + COMBINING ACUTE ACCENT = ś (LATIN SMALL LETTER S WITH ACUTE)
-    {0x0073, 0x0302, 0x015D},  // s + COMBINING CIRCUMFLEX ACCENT = ŝ (LATIN SMALL LETTER S WITH CIRCUMFLEX)
-    {0x0073, 0x0307, 0x1E61},  // s + COMBINING DOT ABOVE = ṡ (LATIN SMALL LETTER S WITH DOT ABOVE)
-    {0x0073, 0x030C, 0x0161},  // s + COMBINING CARON = š (LATIN SMALL LETTER S WITH CARON)
-    {0x0073, 0x0323, 0x1E63},  // s + COMBINING DOT BELOW = ṣ (LATIN SMALL LETTER S WITH DOT BELOW)
-    {0x0073, 0x0326, 0x0219},  // s + COMBINING COMMA BELOW = ș (LATIN SMALL LETTER S WITH COMMA BELOW)
+    {0x03C5, 0x0314, 0x1F51},  // υ + COMBINING REVERSED COMMA ABOVE = ὑ (GREEK SMALL LETTER UPSILON WITH DASIA)
+    {0x0112, 0x0301, 0x1E16},  // Ē + COMBINING ACUTE ACCENT = Ḗ (LATIN CAPITAL LETTER E WITH MACRON AND ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F6A, 0x0345, 0x1FAA},  // Ὢ + COMBINING GREEK YPOGEGRAMMENI = ᾪ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x1ECC, 0x0302,
+     0x1ED8},  // Ọ + COMBINING CIRCUMFLEX ACCENT = Ộ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW)
+    {0x0079, 0x0309, 0x1EF7},  // y + COMBINING HOOK ABOVE = ỷ (LATIN SMALL LETTER Y WITH HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x00F5, 0x0308, 0x1E4F},  // õ + COMBINING DIAERESIS = ṏ (LATIN SMALL LETTER O WITH TILDE AND DIAERESIS)
+    {0x1F60, 0x0342,
+     0x1F66},  // ὠ + COMBINING GREEK PERISPOMENI = ὦ (GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI)
+    {0x00EA, 0x0309, 0x1EC3},  // ê + COMBINING HOOK ABOVE = ể (LATIN SMALL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x004B, 0x030C, 0x01E8},  // K + COMBINING CARON = Ǩ (LATIN CAPITAL LETTER K WITH CARON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F50, 0x0301, 0x1F54},  // ὐ + COMBINING ACUTE ACCENT = ὔ (GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA)
+    {0x00CA, 0x0309, 0x1EC2},  // Ê + COMBINING HOOK ABOVE = Ể (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x005A, 0x030C, 0x017D},  // Z + COMBINING CARON = Ž (LATIN CAPITAL LETTER Z WITH CARON)
+    {0x0041, 0x030C, 0x01CD},  // A + COMBINING CARON = Ǎ (LATIN CAPITAL LETTER A WITH CARON)
+    {0x00FC, 0x0301, 0x01D8},  // ü + COMBINING ACUTE ACCENT = ǘ (LATIN SMALL LETTER U WITH DIAERESIS AND ACUTE)
+    {0x041E, 0x0308, 0x04E6},  // О + COMBINING DIAERESIS = Ӧ (CYRILLIC CAPITAL LETTER O WITH DIAERESIS)
+    {0x03BF, 0x0314, 0x1F41},  // ο + COMBINING REVERSED COMMA ABOVE = ὁ (GREEK SMALL LETTER OMICRON WITH DASIA)
+    {0x03A9, 0x0313, 0x1F68},  // Ω + COMBINING COMMA ABOVE = Ὠ (GREEK CAPITAL LETTER OMEGA WITH PSILI)
+    {0x007A, 0x0331, 0x1E95},  // z + COMBINING MACRON BELOW = ẕ (LATIN SMALL LETTER Z WITH LINE BELOW)
+    {0x0067, 0x0301, 0x01F5},  // g + COMBINING ACUTE ACCENT = ǵ (LATIN SMALL LETTER G WITH ACUTE)
+    {0x0443, 0x0304, 0x04EF},  // у + COMBINING MACRON = ӯ (CYRILLIC SMALL LETTER U WITH MACRON)
+    {0x1F51, 0x0342,
+     0x1F57},  // ὑ + COMBINING GREEK PERISPOMENI = ὗ (GREEK SMALL LETTER UPSILON WITH DASIA AND PERISPOMENI)
+    {0x00EF, 0x0301, 0x1E2F},  // ï + COMBINING ACUTE ACCENT = ḯ (LATIN SMALL LETTER I WITH DIAERESIS AND ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0072, 0x030C, 0x0159},  // r + COMBINING CARON = ř (LATIN SMALL LETTER R WITH CARON)
+    {0x0055, 0x0330, 0x1E74},  // U + COMBINING TILDE BELOW = Ṵ (LATIN CAPITAL LETTER U WITH TILDE BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F18, 0x0300, 0x1F1A},  // Ἐ + COMBINING GRAVE ACCENT = Ἒ (GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F28, 0x0300, 0x1F2A},  // Ἠ + COMBINING GRAVE ACCENT = Ἢ (GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA)
+    {0x0049, 0x0303, 0x0128},  // I + COMBINING TILDE = Ĩ (LATIN CAPITAL LETTER I WITH TILDE)
+    {0x1F01, 0x0342,
+     0x1F07},  // ἁ + COMBINING GREEK PERISPOMENI = ἇ (GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI)
     {0x0073, 0x0327, 0x015F},  // s + COMBINING CEDILLA = ş (LATIN SMALL LETTER S WITH CEDILLA)
-    {0x0074, 0x0307, 0x1E6B},  // t + COMBINING DOT ABOVE = ṫ (LATIN SMALL LETTER T WITH DOT ABOVE)
-    {0x0074, 0x0308, 0x1E97},  // t + COMBINING DIAERESIS = ẗ (LATIN SMALL LETTER T WITH DIAERESIS)
-    {0x0074, 0x030C, 0x0165},  // t + COMBINING CARON = ť (LATIN SMALL LETTER T WITH CARON)
-    {0x0074, 0x0323, 0x1E6D},  // t + COMBINING DOT BELOW = ṭ (LATIN SMALL LETTER T WITH DOT BELOW)
-    {0x0074, 0x0326, 0x021B},  // t + COMBINING COMMA BELOW = ț (LATIN SMALL LETTER T WITH COMMA BELOW)
-    {0x0074, 0x0327, 0x0163},  // t + COMBINING CEDILLA = ţ (LATIN SMALL LETTER T WITH CEDILLA)
-    {0x0074, 0x032D, 0x1E71},  // t + COMBINING CIRCUMFLEX ACCENT BELOW = ṱ (LATIN SMALL LETTER T WITH CIRCUMFLEX BELOW)
-    {0x0074, 0x0331, 0x1E6F},  // t + COMBINING MACRON BELOW = ṯ (LATIN SMALL LETTER T WITH LINE BELOW)
-    {0x0075, 0x0300, 0x00F9},  // u + COMBINING GRAVE ACCENT = ù (LATIN SMALL LETTER U WITH GRAVE)
-    {0x0075, 0x0301, 0x00FA},  // u + COMBINING ACUTE ACCENT = ú (LATIN SMALL LETTER U WITH ACUTE)
-    {0x0075, 0x0302, 0x00FB},  // u + COMBINING CIRCUMFLEX ACCENT = û (LATIN SMALL LETTER U WITH CIRCUMFLEX)
-    {0x0075, 0x0303, 0x0169},  // u + COMBINING TILDE = ũ (LATIN SMALL LETTER U WITH TILDE)
-    {0x0075, 0x0304, 0x016B},  // u + COMBINING MACRON = ū (LATIN SMALL LETTER U WITH MACRON)
-    {0x0075, 0x0306, 0x016D},  // u + COMBINING BREVE = ŭ (LATIN SMALL LETTER U WITH BREVE)
-    {0x0075, 0x0308, 0x00FC},  // u + COMBINING DIAERESIS = ü (LATIN SMALL LETTER U WITH DIAERESIS)
-    {0x0075, 0x0309, 0x1EE7},  // u + COMBINING HOOK ABOVE = ủ (LATIN SMALL LETTER U WITH HOOK ABOVE)
-    {0x0075, 0x030A, 0x016F},  // u + COMBINING RING ABOVE = ů (LATIN SMALL LETTER U WITH RING ABOVE)
-    {0x0075, 0x030B, 0x0171},  // u + COMBINING DOUBLE ACUTE ACCENT = ű (LATIN SMALL LETTER U WITH DOUBLE ACUTE)
-    {0x0075, 0x030C, 0x01D4},  // u + COMBINING CARON = ǔ (LATIN SMALL LETTER U WITH CARON)
-    {0x0075, 0x030F, 0x0215},  // u + COMBINING DOUBLE GRAVE ACCENT = ȕ (LATIN SMALL LETTER U WITH DOUBLE GRAVE)
-    {0x0075, 0x0311, 0x0217},  // u + COMBINING INVERTED BREVE = ȗ (LATIN SMALL LETTER U WITH INVERTED BREVE)
-    {0x0075, 0x031B, 0x01B0},  // u + COMBINING HORN = ư (LATIN SMALL LETTER U WITH HORN)
-    {0x0075, 0x0323, 0x1EE5},  // u + COMBINING DOT BELOW = ụ (LATIN SMALL LETTER U WITH DOT BELOW)
-    {0x0075, 0x0324, 0x1E73},  // u + COMBINING DIAERESIS BELOW = ṳ (LATIN SMALL LETTER U WITH DIAERESIS BELOW)
-    {0x0075, 0x0328, 0x0173},  // u + COMBINING OGONEK = ų (LATIN SMALL LETTER U WITH OGONEK)
-    {0x0075, 0x032D, 0x1E77},  // u + COMBINING CIRCUMFLEX ACCENT BELOW = ṷ (LATIN SMALL LETTER U WITH CIRCUMFLEX BELOW)
-    {0x0075, 0x0330, 0x1E75},  // u + COMBINING TILDE BELOW = ṵ (LATIN SMALL LETTER U WITH TILDE BELOW)
-    {0x0076, 0x0303, 0x1E7D},  // v + COMBINING TILDE = ṽ (LATIN SMALL LETTER V WITH TILDE)
-    {0x0076, 0x0323, 0x1E7F},  // v + COMBINING DOT BELOW = ṿ (LATIN SMALL LETTER V WITH DOT BELOW)
-    {0x0077, 0x0300, 0x1E81},  // w + COMBINING GRAVE ACCENT = ẁ (LATIN SMALL LETTER W WITH GRAVE)
-    {0x0077, 0x0301, 0x1E83},  // w + COMBINING ACUTE ACCENT = ẃ (LATIN SMALL LETTER W WITH ACUTE)
-    {0x0077, 0x0302, 0x0175},  // w + COMBINING CIRCUMFLEX ACCENT = ŵ (LATIN SMALL LETTER W WITH CIRCUMFLEX)
-    {0x0077, 0x0307, 0x1E87},  // w + COMBINING DOT ABOVE = ẇ (LATIN SMALL LETTER W WITH DOT ABOVE)
+    {0x03A9, 0x0301, 0x038F},  // Ω + COMBINING ACUTE ACCENT = Ώ (GREEK CAPITAL LETTER OMEGA WITH TONOS)
+    {0x0113, 0x0300, 0x1E15},  // ē + COMBINING GRAVE ACCENT = ḕ (LATIN SMALL LETTER E WITH MACRON AND GRAVE)
     {0x0077, 0x0308, 0x1E85},  // w + COMBINING DIAERESIS = ẅ (LATIN SMALL LETTER W WITH DIAERESIS)
-    {0x0077, 0x030A, 0x1E98},  // w + COMBINING RING ABOVE = ẘ (LATIN SMALL LETTER W WITH RING ABOVE)
-    {0x0077, 0x0323, 0x1E89},  // w + COMBINING DOT BELOW = ẉ (LATIN SMALL LETTER W WITH DOT BELOW)
-    {0x0078, 0x0307, 0x1E8B},  // x + COMBINING DOT ABOVE = ẋ (LATIN SMALL LETTER X WITH DOT ABOVE)
-    {0x0078, 0x0308, 0x1E8D},  // x + COMBINING DIAERESIS = ẍ (LATIN SMALL LETTER X WITH DIAERESIS)
+    {0x0423, 0x0306, 0x040E},  // У + COMBINING BREVE = Ў (CYRILLIC CAPITAL LETTER SHORT U)
+    {0x04D9, 0x0308, 0x04DB},  // ә + COMBINING DIAERESIS = ӛ (CYRILLIC SMALL LETTER SCHWA WITH DIAERESIS)
+    {0x03B9, 0x0304, 0x1FD1},  // ι + COMBINING MACRON = ῑ (GREEK SMALL LETTER IOTA WITH MACRON)
+    {0x004D, 0x0307, 0x1E40},  // M + COMBINING DOT ABOVE = Ṁ (LATIN CAPITAL LETTER M WITH DOT ABOVE)
+    {0x006F, 0x030B, 0x0151},  // o + COMBINING DOUBLE ACUTE ACCENT = ő (LATIN SMALL LETTER O WITH DOUBLE ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0075, 0x0324, 0x1E73},  // u + COMBINING DIAERESIS BELOW = ṳ (LATIN SMALL LETTER U WITH DIAERESIS BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x1E62, 0x0307, 0x1E68},  // Ṣ + COMBINING DOT ABOVE = Ṩ (LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE)
+    {0x1F21, 0x0345,
+     0x1F91},  // ἡ + COMBINING GREEK YPOGEGRAMMENI = ᾑ (GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0053, 0x0326, 0x0218},  // S + COMBINING COMMA BELOW = Ș (LATIN CAPITAL LETTER S WITH COMMA BELOW)
+    {0x044D, 0x0308, 0x04ED},  // э + COMBINING DIAERESIS = ӭ (CYRILLIC SMALL LETTER E WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0061, 0x030C, 0x01CE},  // a + COMBINING CARON = ǎ (LATIN SMALL LETTER A WITH CARON)
+    {0x0069, 0x0306, 0x012D},  // i + COMBINING BREVE = ĭ (LATIN SMALL LETTER I WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0328, 0x0118},  // E + COMBINING OGONEK = Ę (LATIN CAPITAL LETTER E WITH OGONEK)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0301, 0x00C9},  // E + COMBINING ACUTE ACCENT = É (LATIN CAPITAL LETTER E WITH ACUTE)
+    {0x1F02, 0x0345, 0x1F82},  // ἂ + COMBINING GREEK YPOGEGRAMMENI = ᾂ (GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA
+                               // AND YPOGEGRAMMENI)
+    {0x0055, 0x030A, 0x016E},  // U + COMBINING RING ABOVE = Ů (LATIN CAPITAL LETTER U WITH RING ABOVE)
+    {0x0063, 0x0307, 0x010B},  // c + COMBINING DOT ABOVE = ċ (LATIN SMALL LETTER C WITH DOT ABOVE)
+    {0x1FB6, 0x0345,
+     0x1FB7},  // ᾶ + COMBINING GREEK YPOGEGRAMMENI = ᾷ (GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI)
+    {0x005A, 0x0301, 0x0179},  // Z + COMBINING ACUTE ACCENT = Ź (LATIN CAPITAL LETTER Z WITH ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F20, 0x0301, 0x1F24},  // ἠ + COMBINING ACUTE ACCENT = ἤ (GREEK SMALL LETTER ETA WITH PSILI AND OXIA)
+    {0x0055, 0x0304, 0x016A},  // U + COMBINING MACRON = Ū (LATIN CAPITAL LETTER U WITH MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1EA1, 0x0306, 0x1EB7},  // ạ + COMBINING BREVE = ặ (LATIN SMALL LETTER A WITH BREVE AND DOT BELOW)
+    {0x0049, 0x0308, 0x00CF},  // I + COMBINING DIAERESIS = Ï (LATIN CAPITAL LETTER I WITH DIAERESIS)
     {0x0079, 0x0300, 0x1EF3},  // y + COMBINING GRAVE ACCENT = ỳ (LATIN SMALL LETTER Y WITH GRAVE)
-    {0x0079, 0x0301, 0x00FD},  // y + COMBINING ACUTE ACCENT = ý (LATIN SMALL LETTER Y WITH ACUTE)
-    {0x0079, 0x0302, 0x0177},  // y + COMBINING CIRCUMFLEX ACCENT = ŷ (LATIN SMALL LETTER Y WITH CIRCUMFLEX)
-    {0x0079, 0x0303, 0x1EF9},  // y + COMBINING TILDE = ỹ (LATIN SMALL LETTER Y WITH TILDE)
-    {0x0079, 0x0304, 0x0233},  // y + COMBINING MACRON = ȳ (LATIN SMALL LETTER Y WITH MACRON)
-    {0x0079, 0x0307, 0x1E8F},  // y + COMBINING DOT ABOVE = ẏ (LATIN SMALL LETTER Y WITH DOT ABOVE)
-    {0x0079, 0x0308, 0x00FF},  // y + COMBINING DIAERESIS = ÿ (LATIN SMALL LETTER Y WITH DIAERESIS)
-    {0x0079, 0x0309, 0x1EF7},  // y + COMBINING HOOK ABOVE = ỷ (LATIN SMALL LETTER Y WITH HOOK ABOVE)
-    {0x0079, 0x030A, 0x1E99},  // y + COMBINING RING ABOVE = ẙ (LATIN SMALL LETTER Y WITH RING ABOVE)
-    {0x0079, 0x0323, 0x1EF5},  // y + COMBINING DOT BELOW = ỵ (LATIN SMALL LETTER Y WITH DOT BELOW)
-    {0x007A, 0x0301, 0x017A},  // z + COMBINING ACUTE ACCENT = ź (LATIN SMALL LETTER Z WITH ACUTE)
-    {0x007A, 0x0302, 0x1E91},  // z + COMBINING CIRCUMFLEX ACCENT = ẑ (LATIN SMALL LETTER Z WITH CIRCUMFLEX)
-    {0x007A, 0x0307, 0x017C},  // z + COMBINING DOT ABOVE = ż (LATIN SMALL LETTER Z WITH DOT ABOVE)
-    {0x007A, 0x030C, 0x017E},  // z + COMBINING CARON = ž (LATIN SMALL LETTER Z WITH CARON)
-    {0x007A, 0x0323, 0x1E93},  // z + COMBINING DOT BELOW = ẓ (LATIN SMALL LETTER Z WITH DOT BELOW)
-    {0x007A, 0x0331, 0x1E95},  // z + COMBINING MACRON BELOW = ẕ (LATIN SMALL LETTER Z WITH LINE BELOW)
-    {0x00A8, 0x0300, 0x1FED},  // ¨ + COMBINING GRAVE ACCENT = ῭ (GREEK DIALYTIKA AND VARIA)
-    {0x00A8, 0x0301, 0x0385},  // ¨ + COMBINING ACUTE ACCENT = ΅ (GREEK DIALYTIKA TONOS)
-    {0x00A8, 0x0342, 0x1FC1},  // ¨ + COMBINING GREEK PERISPOMENI = ῁ (GREEK DIALYTIKA AND PERISPOMENI)
-    {0x00C2, 0x0300, 0x1EA6},  // Â + COMBINING GRAVE ACCENT = Ầ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE)
-    {0x00C2, 0x0301, 0x1EA4},  // Â + COMBINING ACUTE ACCENT = Ấ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE)
-    {0x00C2, 0x0303, 0x1EAA},  // Â + COMBINING TILDE = Ẫ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE)
-    {0x00C2, 0x0309, 0x1EA8},  // Â + COMBINING HOOK ABOVE = Ẩ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00C4, 0x0304, 0x01DE},  // Ä + COMBINING MACRON = Ǟ (LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON)
-    {0x00C5, 0x0301, 0x01FA},  // Å + COMBINING ACUTE ACCENT = Ǻ (LATIN CAPITAL LETTER A WITH RING ABOVE AND ACUTE)
-    {0x00C6, 0x0301, 0x01FC},  // Æ + COMBINING ACUTE ACCENT = Ǽ (LATIN CAPITAL LETTER AE WITH ACUTE)
-    {0x00C6, 0x0304, 0x01E2},  // Æ + COMBINING MACRON = Ǣ (LATIN CAPITAL LETTER AE WITH MACRON)
-    {0x00C7, 0x0301, 0x1E08},  // Ç + COMBINING ACUTE ACCENT = Ḉ (LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE)
-    {0x00CA, 0x0300, 0x1EC0},  // Ê + COMBINING GRAVE ACCENT = Ề (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE)
+    {0x0054, 0x0327, 0x0162},  // T + COMBINING CEDILLA = Ţ (LATIN CAPITAL LETTER T WITH CEDILLA)
     {0x00CA, 0x0301, 0x1EBE},  // Ê + COMBINING ACUTE ACCENT = Ế (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND ACUTE)
-    {0x00CA, 0x0303, 0x1EC4},  // Ê + COMBINING TILDE = Ễ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE)
-    {0x00CA, 0x0309, 0x1EC2},  // Ê + COMBINING HOOK ABOVE = Ể (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00CF, 0x0301, 0x1E2E},  // Ï + COMBINING ACUTE ACCENT = Ḯ (LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE)
-    {0x00D4, 0x0300, 0x1ED2},  // Ô + COMBINING GRAVE ACCENT = Ồ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE)
-    {0x00D4, 0x0301, 0x1ED0},  // Ô + COMBINING ACUTE ACCENT = Ố (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE)
-    {0x00D4, 0x0303, 0x1ED6},  // Ô + COMBINING TILDE = Ỗ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE)
-    {0x00D4, 0x0309, 0x1ED4},  // Ô + COMBINING HOOK ABOVE = Ổ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00D5, 0x0301, 0x1E4C},  // Õ + COMBINING ACUTE ACCENT = Ṍ (LATIN CAPITAL LETTER O WITH TILDE AND ACUTE)
-    {0x00D5, 0x0304, 0x022C},  // Õ + COMBINING MACRON = Ȭ (LATIN CAPITAL LETTER O WITH TILDE AND MACRON)
-    {0x00D5, 0x0308, 0x1E4E},  // Õ + COMBINING DIAERESIS = Ṏ (LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS)
-    {0x00D6, 0x0304, 0x022A},  // Ö + COMBINING MACRON = Ȫ (LATIN CAPITAL LETTER O WITH DIAERESIS AND MACRON)
-    {0x00D8, 0x0301, 0x01FE},  // Ø + COMBINING ACUTE ACCENT = Ǿ (LATIN CAPITAL LETTER O WITH STROKE AND ACUTE)
-    {0x00DC, 0x0300, 0x01DB},  // Ü + COMBINING GRAVE ACCENT = Ǜ (LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE)
-    {0x00DC, 0x0301, 0x01D7},  // Ü + COMBINING ACUTE ACCENT = Ǘ (LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE)
-    {0x00DC, 0x0304, 0x01D5},  // Ü + COMBINING MACRON = Ǖ (LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON)
-    {0x00DC, 0x030C, 0x01D9},  // Ü + COMBINING CARON = Ǚ (LATIN CAPITAL LETTER U WITH DIAERESIS AND CARON)
-    {0x00E2, 0x0300, 0x1EA7},  // â + COMBINING GRAVE ACCENT = ầ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND GRAVE)
-    {0x00E2, 0x0301, 0x1EA5},  // â + COMBINING ACUTE ACCENT = ấ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x006D, 0x0307, 0x1E41},  // m + COMBINING DOT ABOVE = ṁ (LATIN SMALL LETTER M WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x004F, 0x031B, 0x01A0},  // O + COMBINING HORN = Ơ (LATIN CAPITAL LETTER O WITH HORN)
+    {0x1F01, 0x0300, 0x1F03},  // ἁ + COMBINING GRAVE ACCENT = ἃ (GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA)
+    {0x0072, 0x0323, 0x1E5B},  // r + COMBINING DOT BELOW = ṛ (LATIN SMALL LETTER R WITH DOT BELOW)
+    {0x006F, 0x0304, 0x014D},  // o + COMBINING MACRON = ō (LATIN SMALL LETTER O WITH MACRON)
+    {0x1F6C, 0x0345, 0x1FAC},  // Ὤ + COMBINING GREEK YPOGEGRAMMENI = ᾬ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA
+                               // AND PROSGEGRAMMENI)
+    {0x1F09, 0x0301, 0x1F0D},  // Ἁ + COMBINING ACUTE ACCENT = Ἅ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA)
+    {0x0427, 0x0308, 0x04F4},  // Ч + COMBINING DIAERESIS = Ӵ (CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS)
+    {0x0397, 0x0314, 0x1F29},  // Η + COMBINING REVERSED COMMA ABOVE = Ἡ (GREEK CAPITAL LETTER ETA WITH DASIA)
     {0x00E2, 0x0303, 0x1EAB},  // â + COMBINING TILDE = ẫ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND TILDE)
-    {0x00E2, 0x0309, 0x1EA9},  // â + COMBINING HOOK ABOVE = ẩ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00E4, 0x0304, 0x01DF},  // ä + COMBINING MACRON = ǟ (LATIN SMALL LETTER A WITH DIAERESIS AND MACRON)
-    {0x00E5, 0x0301, 0x01FB},  // å + COMBINING ACUTE ACCENT = ǻ (LATIN SMALL LETTER A WITH RING ABOVE AND ACUTE)
-    {0x00E6, 0x0301, 0x01FD},  // æ + COMBINING ACUTE ACCENT = ǽ (LATIN SMALL LETTER AE WITH ACUTE)
-    {0x00E6, 0x0304, 0x01E3},  // æ + COMBINING MACRON = ǣ (LATIN SMALL LETTER AE WITH MACRON)
-    {0x00E7, 0x0301, 0x1E09},  // ç + COMBINING ACUTE ACCENT = ḉ (LATIN SMALL LETTER C WITH CEDILLA AND ACUTE)
-    {0x00EA, 0x0300, 0x1EC1},  // ê + COMBINING GRAVE ACCENT = ề (LATIN SMALL LETTER E WITH CIRCUMFLEX AND GRAVE)
-    {0x00EA, 0x0301, 0x1EBF},  // ê + COMBINING ACUTE ACCENT = ế (LATIN SMALL LETTER E WITH CIRCUMFLEX AND ACUTE)
-    {0x00EA, 0x0303, 0x1EC5},  // ê + COMBINING TILDE = ễ (LATIN SMALL LETTER E WITH CIRCUMFLEX AND TILDE)
-    {0x00EA, 0x0309, 0x1EC3},  // ê + COMBINING HOOK ABOVE = ể (LATIN SMALL LETTER E WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00EF, 0x0301, 0x1E2F},  // ï + COMBINING ACUTE ACCENT = ḯ (LATIN SMALL LETTER I WITH DIAERESIS AND ACUTE)
-    {0x00F4, 0x0300, 0x1ED3},  // ô + COMBINING GRAVE ACCENT = ồ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND GRAVE)
-    {0x00F4, 0x0301, 0x1ED1},  // ô + COMBINING ACUTE ACCENT = ố (LATIN SMALL LETTER O WITH CIRCUMFLEX AND ACUTE)
-    {0x00F4, 0x0303, 0x1ED7},  // ô + COMBINING TILDE = ỗ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND TILDE)
-    {0x00F4, 0x0309, 0x1ED5},  // ô + COMBINING HOOK ABOVE = ổ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE)
-    {0x00F5, 0x0301, 0x1E4D},  // õ + COMBINING ACUTE ACCENT = ṍ (LATIN SMALL LETTER O WITH TILDE AND ACUTE)
-    {0x00F5, 0x0304, 0x022D},  // õ + COMBINING MACRON = ȭ (LATIN SMALL LETTER O WITH TILDE AND MACRON)
-    {0x00F5, 0x0308, 0x1E4F},  // õ + COMBINING DIAERESIS = ṏ (LATIN SMALL LETTER O WITH TILDE AND DIAERESIS)
-    {0x00F6, 0x0304, 0x022B},  // ö + COMBINING MACRON = ȫ (LATIN SMALL LETTER O WITH DIAERESIS AND MACRON)
-    {0x00F8, 0x0301, 0x01FF},  // ø + COMBINING ACUTE ACCENT = ǿ (LATIN SMALL LETTER O WITH STROKE AND ACUTE)
-    {0x00FC, 0x0300, 0x01DC},  // ü + COMBINING GRAVE ACCENT = ǜ (LATIN SMALL LETTER U WITH DIAERESIS AND GRAVE)
-    {0x00FC, 0x0301, 0x01D8},  // ü + COMBINING ACUTE ACCENT = ǘ (LATIN SMALL LETTER U WITH DIAERESIS AND ACUTE)
-    {0x00FC, 0x0304, 0x01D6},  // ü + COMBINING MACRON = ǖ (LATIN SMALL LETTER U WITH DIAERESIS AND MACRON)
-    {0x00FC, 0x030C, 0x01DA},  // ü + COMBINING CARON = ǚ (LATIN SMALL LETTER U WITH DIAERESIS AND CARON)
-    {0x0102, 0x0300, 0x1EB0},  // Ă + COMBINING GRAVE ACCENT = Ằ (LATIN CAPITAL LETTER A WITH BREVE AND GRAVE)
-    {0x0102, 0x0301, 0x1EAE},  // Ă + COMBINING ACUTE ACCENT = Ắ (LATIN CAPITAL LETTER A WITH BREVE AND ACUTE)
-    {0x0102, 0x0303, 0x1EB4},  // Ă + COMBINING TILDE = Ẵ (LATIN CAPITAL LETTER A WITH BREVE AND TILDE)
-    {0x0102, 0x0309, 0x1EB2},  // Ă + COMBINING HOOK ABOVE = Ẳ (LATIN CAPITAL LETTER A WITH BREVE AND HOOK ABOVE)
-    {0x0103, 0x0300, 0x1EB1},  // ă + COMBINING GRAVE ACCENT = ằ (LATIN SMALL LETTER A WITH BREVE AND GRAVE)
-    {0x0103, 0x0301, 0x1EAF},  // ă + COMBINING ACUTE ACCENT = ắ (LATIN SMALL LETTER A WITH BREVE AND ACUTE)
-    {0x0103, 0x0303, 0x1EB5},  // ă + COMBINING TILDE = ẵ (LATIN SMALL LETTER A WITH BREVE AND TILDE)
-    {0x0103, 0x0309, 0x1EB3},  // ă + COMBINING HOOK ABOVE = ẳ (LATIN SMALL LETTER A WITH BREVE AND HOOK ABOVE)
+    {0x0049, 0x0311, 0x020A},  // I + COMBINING INVERTED BREVE = Ȋ (LATIN CAPITAL LETTER I WITH INVERTED BREVE)
+    {0x015A, 0x0307, 0x1E64},  // Ś + COMBINING DOT ABOVE = Ṥ (LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE)
+    {0x007A, 0x0302, 0x1E91},  // z + COMBINING CIRCUMFLEX ACCENT = ẑ (LATIN SMALL LETTER Z WITH CIRCUMFLEX)
+    {0x0049, 0x030F, 0x0208},  // I + COMBINING DOUBLE GRAVE ACCENT = Ȉ (LATIN CAPITAL LETTER I WITH DOUBLE GRAVE)
+    {0x0073, 0x0301, 0x015B},  // s + COMBINING ACUTE ACCENT = ś (LATIN SMALL LETTER S WITH ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0079, 0x0303, 0x1EF9},  // y + COMBINING TILDE = ỹ (LATIN SMALL LETTER Y WITH TILDE)
+    {0x0399, 0x0313, 0x1F38},  // Ι + COMBINING COMMA ABOVE = Ἰ (GREEK CAPITAL LETTER IOTA WITH PSILI)
+    {0x03C5, 0x0308, 0x03CB},  // υ + COMBINING DIAERESIS = ϋ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA)
     {0x0112, 0x0300, 0x1E14},  // Ē + COMBINING GRAVE ACCENT = Ḕ (LATIN CAPITAL LETTER E WITH MACRON AND GRAVE)
-    {0x0112, 0x0301, 0x1E16},  // Ē + COMBINING ACUTE ACCENT = Ḗ (LATIN CAPITAL LETTER E WITH MACRON AND ACUTE)
-    {0x0113, 0x0300, 0x1E15},  // ē + COMBINING GRAVE ACCENT = ḕ (LATIN SMALL LETTER E WITH MACRON AND GRAVE)
-    {0x0113, 0x0301, 0x1E17},  // ē + COMBINING ACUTE ACCENT = ḗ (LATIN SMALL LETTER E WITH MACRON AND ACUTE)
+    {0x03CA, 0x0301, 0x0390},  // ϊ + COMBINING ACUTE ACCENT = ΐ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS)
+    {0x00C2, 0x0300, 0x1EA6},  // Â + COMBINING GRAVE ACCENT = Ầ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x005A, 0x0307, 0x017B},  // Z + COMBINING DOT ABOVE = Ż (LATIN CAPITAL LETTER Z WITH DOT ABOVE)
+    {0x0068, 0x0331, 0x1E96},  // h + COMBINING MACRON BELOW = ẖ (LATIN SMALL LETTER H WITH LINE BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0447, 0x0308, 0x04F5},  // ч + COMBINING DIAERESIS = ӵ (CYRILLIC SMALL LETTER CHE WITH DIAERESIS)
+    {0x1F40, 0x0301, 0x1F44},  // ὀ + COMBINING ACUTE ACCENT = ὄ (GREEK SMALL LETTER OMICRON WITH PSILI AND OXIA)
     {0x014C, 0x0300, 0x1E50},  // Ō + COMBINING GRAVE ACCENT = Ṑ (LATIN CAPITAL LETTER O WITH MACRON AND GRAVE)
-    {0x014C, 0x0301, 0x1E52},  // Ō + COMBINING ACUTE ACCENT = Ṓ (LATIN CAPITAL LETTER O WITH MACRON AND ACUTE)
-    {0x014D, 0x0300, 0x1E51},  // ō + COMBINING GRAVE ACCENT = ṑ (LATIN SMALL LETTER O WITH MACRON AND GRAVE)
-    {0x014D, 0x0301, 0x1E53},  // ō + COMBINING ACUTE ACCENT = ṓ (LATIN SMALL LETTER O WITH MACRON AND ACUTE)
-    {0x015A, 0x0307, 0x1E64},  // Ś + COMBINING DOT ABOVE = Ṥ (LATIN CAPITAL LETTER S WITH ACUTE AND DOT ABOVE)
-    {0x015B, 0x0307, 0x1E65},  // ś + COMBINING DOT ABOVE = ṥ (LATIN SMALL LETTER S WITH ACUTE AND DOT ABOVE)
-    {0x0160, 0x0307, 0x1E66},  // Š + COMBINING DOT ABOVE = Ṧ (LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE)
-    {0x0161, 0x0307, 0x1E67},  // š + COMBINING DOT ABOVE = ṧ (LATIN SMALL LETTER S WITH CARON AND DOT ABOVE)
-    {0x0168, 0x0301, 0x1E78},  // Ũ + COMBINING ACUTE ACCENT = Ṹ (LATIN CAPITAL LETTER U WITH TILDE AND ACUTE)
-    {0x0169, 0x0301, 0x1E79},  // ũ + COMBINING ACUTE ACCENT = ṹ (LATIN SMALL LETTER U WITH TILDE AND ACUTE)
-    {0x016A, 0x0308, 0x1E7A},  // Ū + COMBINING DIAERESIS = Ṻ (LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS)
-    {0x016B, 0x0308, 0x1E7B},  // ū + COMBINING DIAERESIS = ṻ (LATIN SMALL LETTER U WITH MACRON AND DIAERESIS)
-    {0x017F, 0x0307, 0x1E9B},  // ſ + COMBINING DOT ABOVE = ẛ (LATIN SMALL LETTER LONG S WITH DOT ABOVE)
-    {0x01A0, 0x0300, 0x1EDC},  // Ơ + COMBINING GRAVE ACCENT = Ờ (LATIN CAPITAL LETTER O WITH HORN AND GRAVE)
-    {0x01A0, 0x0301, 0x1EDA},  // Ơ + COMBINING ACUTE ACCENT = Ớ (LATIN CAPITAL LETTER O WITH HORN AND ACUTE)
-    {0x01A0, 0x0303, 0x1EE0},  // Ơ + COMBINING TILDE = Ỡ (LATIN CAPITAL LETTER O WITH HORN AND TILDE)
-    {0x01A0, 0x0309, 0x1EDE},  // Ơ + COMBINING HOOK ABOVE = Ở (LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE)
-    {0x01A0, 0x0323, 0x1EE2},  // Ơ + COMBINING DOT BELOW = Ợ (LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW)
-    {0x01A1, 0x0300, 0x1EDD},  // ơ + COMBINING GRAVE ACCENT = ờ (LATIN SMALL LETTER O WITH HORN AND GRAVE)
-    {0x01A1, 0x0301, 0x1EDB},  // ơ + COMBINING ACUTE ACCENT = ớ (LATIN SMALL LETTER O WITH HORN AND ACUTE)
-    {0x01A1, 0x0303, 0x1EE1},  // ơ + COMBINING TILDE = ỡ (LATIN SMALL LETTER O WITH HORN AND TILDE)
-    {0x01A1, 0x0309, 0x1EDF},  // ơ + COMBINING HOOK ABOVE = ở (LATIN SMALL LETTER O WITH HORN AND HOOK ABOVE)
-    {0x01A1, 0x0323, 0x1EE3},  // ơ + COMBINING DOT BELOW = ợ (LATIN SMALL LETTER O WITH HORN AND DOT BELOW)
-    {0x01AF, 0x0300, 0x1EEA},  // Ư + COMBINING GRAVE ACCENT = Ừ (LATIN CAPITAL LETTER U WITH HORN AND GRAVE)
-    {0x01AF, 0x0301, 0x1EE8},  // Ư + COMBINING ACUTE ACCENT = Ứ (LATIN CAPITAL LETTER U WITH HORN AND ACUTE)
+    {0x0074, 0x0327, 0x0163},  // t + COMBINING CEDILLA = ţ (LATIN SMALL LETTER T WITH CEDILLA)
+    {0x0048, 0x0327, 0x1E28},  // H + COMBINING CEDILLA = Ḩ (LATIN CAPITAL LETTER H WITH CEDILLA)
+    {0x0052, 0x030C, 0x0158},  // R + COMBINING CARON = Ř (LATIN CAPITAL LETTER R WITH CARON)
+    {0x0041, 0x0301, 0x00C1},  // A + COMBINING ACUTE ACCENT = Á (LATIN CAPITAL LETTER A WITH ACUTE)
     {0x01AF, 0x0303, 0x1EEE},  // Ư + COMBINING TILDE = Ữ (LATIN CAPITAL LETTER U WITH HORN AND TILDE)
-    {0x01AF, 0x0309, 0x1EEC},  // Ư + COMBINING HOOK ABOVE = Ử (LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0052, 0x030F, 0x0210},  // R + COMBINING DOUBLE GRAVE ACCENT = Ȑ (LATIN CAPITAL LETTER R WITH DOUBLE GRAVE)
+    {0x0055, 0x030C, 0x01D3},  // U + COMBINING CARON = Ǔ (LATIN CAPITAL LETTER U WITH CARON)
+    {0x015B, 0x0307, 0x1E65},  // ś + COMBINING DOT ABOVE = ṥ (LATIN SMALL LETTER S WITH ACUTE AND DOT ABOVE)
     {0x01AF, 0x0323, 0x1EF0},  // Ư + COMBINING DOT BELOW = Ự (LATIN CAPITAL LETTER U WITH HORN AND DOT BELOW)
-    {0x01B0, 0x0300, 0x1EEB},  // ư + COMBINING GRAVE ACCENT = ừ (LATIN SMALL LETTER U WITH HORN AND GRAVE)
-    {0x01B0, 0x0301, 0x1EE9},  // ư + COMBINING ACUTE ACCENT = ứ (LATIN SMALL LETTER U WITH HORN AND ACUTE)
-    {0x01B0, 0x0303, 0x1EEF},  // ư + COMBINING TILDE = ữ (LATIN SMALL LETTER U WITH HORN AND TILDE)
-    {0x01B0, 0x0309, 0x1EED},  // ư + COMBINING HOOK ABOVE = ử (LATIN SMALL LETTER U WITH HORN AND HOOK ABOVE)
-    {0x01B0, 0x0323, 0x1EF1},  // ư + COMBINING DOT BELOW = ự (LATIN SMALL LETTER U WITH HORN AND DOT BELOW)
-    {0x01B7, 0x030C, 0x01EE},  // Ʒ + COMBINING CARON = Ǯ (LATIN CAPITAL LETTER EZH WITH CARON)
-    {0x01EA, 0x0304, 0x01EC},  // Ǫ + COMBINING MACRON = Ǭ (LATIN CAPITAL LETTER O WITH OGONEK AND MACRON)
-    {0x01EB, 0x0304, 0x01ED},  // ǫ + COMBINING MACRON = ǭ (LATIN SMALL LETTER O WITH OGONEK AND MACRON)
-    {0x0226, 0x0304, 0x01E0},  // Ȧ + COMBINING MACRON = Ǡ (LATIN CAPITAL LETTER A WITH DOT ABOVE AND MACRON)
-    {0x0227, 0x0304, 0x01E1},  // ȧ + COMBINING MACRON = ǡ (LATIN SMALL LETTER A WITH DOT ABOVE AND MACRON)
-    {0x0228, 0x0306, 0x1E1C},  // Ȩ + COMBINING BREVE = Ḝ (LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE)
-    {0x0229, 0x0306, 0x1E1D},  // ȩ + COMBINING BREVE = ḝ (LATIN SMALL LETTER E WITH CEDILLA AND BREVE)
-    {0x022E, 0x0304, 0x0230},  // Ȯ + COMBINING MACRON = Ȱ (LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON)
-    {0x022F, 0x0304, 0x0231},  // ȯ + COMBINING MACRON = ȱ (LATIN SMALL LETTER O WITH DOT ABOVE AND MACRON)
-    {0x0292, 0x030C, 0x01EF},  // ʒ + COMBINING CARON = ǯ (LATIN SMALL LETTER EZH WITH CARON)
-    {0x0308, 0x0301, 0x0344},  // ̈ + COMBINING ACUTE ACCENT = ̈́ (COMBINING GREEK DIALYTIKA TONOS)
-    {0x0391, 0x0300, 0x1FBA},  // Α + COMBINING GRAVE ACCENT = Ὰ (GREEK CAPITAL LETTER ALPHA WITH VARIA)
-    {0x0391, 0x0301, 0x0386},  // Α + COMBINING ACUTE ACCENT = Ά (GREEK CAPITAL LETTER ALPHA WITH TONOS)
-    {0x0391, 0x0304, 0x1FB9},  // Α + COMBINING MACRON = Ᾱ (GREEK CAPITAL LETTER ALPHA WITH MACRON)
+    {0x042D, 0x0308, 0x04EC},  // Э + COMBINING DIAERESIS = Ӭ (CYRILLIC CAPITAL LETTER E WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x004F, 0x0328, 0x01EA},  // O + COMBINING OGONEK = Ǫ (LATIN CAPITAL LETTER O WITH OGONEK)
+    {0x0075, 0x0303, 0x0169},  // u + COMBINING TILDE = ũ (LATIN SMALL LETTER U WITH TILDE)
+    {0x03BF, 0x0300, 0x1F78},  // ο + COMBINING GRAVE ACCENT = ὸ (GREEK SMALL LETTER OMICRON WITH VARIA)
+    {0x1E63, 0x0307, 0x1E69},  // ṣ + COMBINING DOT ABOVE = ṩ (LATIN SMALL LETTER S WITH DOT BELOW AND DOT ABOVE)
+    {0x0079, 0x0307, 0x1E8F},  // y + COMBINING DOT ABOVE = ẏ (LATIN SMALL LETTER Y WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F59, 0x0342,
+     0x1F5F},  // Ὑ + COMBINING GREEK PERISPOMENI = Ὗ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI)
+    {0x0075, 0x0323, 0x1EE5},  // u + COMBINING DOT BELOW = ụ (LATIN SMALL LETTER U WITH DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F61, 0x0342,
+     0x1F67},  // ὡ + COMBINING GREEK PERISPOMENI = ὧ (GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F23, 0x0345,
+     0x1F93},  // ἣ + COMBINING GREEK YPOGEGRAMMENI = ᾓ (GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI)
     {0x0391, 0x0306, 0x1FB8},  // Α + COMBINING BREVE = Ᾰ (GREEK CAPITAL LETTER ALPHA WITH VRACHY)
-    {0x0391, 0x0313, 0x1F08},  // Α + COMBINING COMMA ABOVE = Ἀ (GREEK CAPITAL LETTER ALPHA WITH PSILI)
-    {0x0391, 0x0314, 0x1F09},  // Α + COMBINING REVERSED COMMA ABOVE = Ἁ (GREEK CAPITAL LETTER ALPHA WITH DASIA)
-    {0x0391, 0x0345, 0x1FBC},  // Α + COMBINING GREEK YPOGEGRAMMENI = ᾼ (GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI)
-    {0x0395, 0x0300, 0x1FC8},  // Ε + COMBINING GRAVE ACCENT = Ὲ (GREEK CAPITAL LETTER EPSILON WITH VARIA)
-    {0x0395, 0x0301, 0x0388},  // Ε + COMBINING ACUTE ACCENT = Έ (GREEK CAPITAL LETTER EPSILON WITH TONOS)
-    {0x0395, 0x0313, 0x1F18},  // Ε + COMBINING COMMA ABOVE = Ἐ (GREEK CAPITAL LETTER EPSILON WITH PSILI)
-    {0x0395, 0x0314, 0x1F19},  // Ε + COMBINING REVERSED COMMA ABOVE = Ἑ (GREEK CAPITAL LETTER EPSILON WITH DASIA)
-    {0x0397, 0x0300, 0x1FCA},  // Η + COMBINING GRAVE ACCENT = Ὴ (GREEK CAPITAL LETTER ETA WITH VARIA)
-    {0x0397, 0x0301, 0x0389},  // Η + COMBINING ACUTE ACCENT = Ή (GREEK CAPITAL LETTER ETA WITH TONOS)
-    {0x0397, 0x0313, 0x1F28},  // Η + COMBINING COMMA ABOVE = Ἠ (GREEK CAPITAL LETTER ETA WITH PSILI)
-    {0x0397, 0x0314, 0x1F29},  // Η + COMBINING REVERSED COMMA ABOVE = Ἡ (GREEK CAPITAL LETTER ETA WITH DASIA)
-    {0x0397, 0x0345, 0x1FCC},  // Η + COMBINING GREEK YPOGEGRAMMENI = ῌ (GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI)
-    {0x0399, 0x0300, 0x1FDA},  // Ι + COMBINING GRAVE ACCENT = Ὶ (GREEK CAPITAL LETTER IOTA WITH VARIA)
-    {0x0399, 0x0301, 0x038A},  // Ι + COMBINING ACUTE ACCENT = Ί (GREEK CAPITAL LETTER IOTA WITH TONOS)
-    {0x0399, 0x0304, 0x1FD9},  // Ι + COMBINING MACRON = Ῑ (GREEK CAPITAL LETTER IOTA WITH MACRON)
-    {0x0399, 0x0306, 0x1FD8},  // Ι + COMBINING BREVE = Ῐ (GREEK CAPITAL LETTER IOTA WITH VRACHY)
-    {0x0399, 0x0308, 0x03AA},  // Ι + COMBINING DIAERESIS = Ϊ (GREEK CAPITAL LETTER IOTA WITH DIALYTIKA)
-    {0x0399, 0x0313, 0x1F38},  // Ι + COMBINING COMMA ABOVE = Ἰ (GREEK CAPITAL LETTER IOTA WITH PSILI)
-    {0x0399, 0x0314, 0x1F39},  // Ι + COMBINING REVERSED COMMA ABOVE = Ἱ (GREEK CAPITAL LETTER IOTA WITH DASIA)
-    {0x039F, 0x0300, 0x1FF8},  // Ο + COMBINING GRAVE ACCENT = Ὸ (GREEK CAPITAL LETTER OMICRON WITH VARIA)
-    {0x039F, 0x0301, 0x038C},  // Ο + COMBINING ACUTE ACCENT = Ό (GREEK CAPITAL LETTER OMICRON WITH TONOS)
-    {0x039F, 0x0313, 0x1F48},  // Ο + COMBINING COMMA ABOVE = Ὀ (GREEK CAPITAL LETTER OMICRON WITH PSILI)
-    {0x039F, 0x0314, 0x1F49},  // Ο + COMBINING REVERSED COMMA ABOVE = Ὁ (GREEK CAPITAL LETTER OMICRON WITH DASIA)
-    {0x03A1, 0x0314, 0x1FEC},  // Ρ + COMBINING REVERSED COMMA ABOVE = Ῥ (GREEK CAPITAL LETTER RHO WITH DASIA)
-    {0x03A5, 0x0300, 0x1FEA},  // Υ + COMBINING GRAVE ACCENT = Ὺ (GREEK CAPITAL LETTER UPSILON WITH VARIA)
-    {0x03A5, 0x0301, 0x038E},  // Υ + COMBINING ACUTE ACCENT = Ύ (GREEK CAPITAL LETTER UPSILON WITH TONOS)
-    {0x03A5, 0x0304, 0x1FE9},  // Υ + COMBINING MACRON = Ῡ (GREEK CAPITAL LETTER UPSILON WITH MACRON)
-    {0x03A5, 0x0306, 0x1FE8},  // Υ + COMBINING BREVE = Ῠ (GREEK CAPITAL LETTER UPSILON WITH VRACHY)
-    {0x03A5, 0x0308, 0x03AB},  // Υ + COMBINING DIAERESIS = Ϋ (GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA)
-    {0x03A5, 0x0314, 0x1F59},  // Υ + COMBINING REVERSED COMMA ABOVE = Ὑ (GREEK CAPITAL LETTER UPSILON WITH DASIA)
-    {0x03A9, 0x0300, 0x1FFA},  // Ω + COMBINING GRAVE ACCENT = Ὼ (GREEK CAPITAL LETTER OMEGA WITH VARIA)
-    {0x03A9, 0x0301, 0x038F},  // Ω + COMBINING ACUTE ACCENT = Ώ (GREEK CAPITAL LETTER OMEGA WITH TONOS)
-    {0x03A9, 0x0313, 0x1F68},  // Ω + COMBINING COMMA ABOVE = Ὠ (GREEK CAPITAL LETTER OMEGA WITH PSILI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F0B, 0x0345, 0x1F8B},  // Ἃ + COMBINING GREEK YPOGEGRAMMENI = ᾋ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x03D2, 0x0301, 0x03D3},  // ϒ + COMBINING ACUTE ACCENT = ϓ (GREEK UPSILON WITH ACUTE AND HOOK SYMBOL)
+    {0x006F, 0x030C, 0x01D2},  // o + COMBINING CARON = ǒ (LATIN SMALL LETTER O WITH CARON)
+    {0x0000, 0x0000, 0x0000},
     {0x03A9, 0x0314, 0x1F69},  // Ω + COMBINING REVERSED COMMA ABOVE = Ὡ (GREEK CAPITAL LETTER OMEGA WITH DASIA)
-    {0x03A9, 0x0345, 0x1FFC},  // Ω + COMBINING GREEK YPOGEGRAMMENI = ῼ (GREEK CAPITAL LETTER OMEGA WITH PROSGEGRAMMENI)
-    {0x03AC, 0x0345,
-     0x1FB4},  // ά + COMBINING GREEK YPOGEGRAMMENI = ᾴ (GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI)
-    {0x03AE, 0x0345,
-     0x1FC4},  // ή + COMBINING GREEK YPOGEGRAMMENI = ῄ (GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI)
-    {0x03B1, 0x0300, 0x1F70},  // α + COMBINING GRAVE ACCENT = ὰ (GREEK SMALL LETTER ALPHA WITH VARIA)
-    {0x03B1, 0x0301, 0x03AC},  // α + COMBINING ACUTE ACCENT = ά (GREEK SMALL LETTER ALPHA WITH TONOS)
-    {0x03B1, 0x0304, 0x1FB1},  // α + COMBINING MACRON = ᾱ (GREEK SMALL LETTER ALPHA WITH MACRON)
-    {0x03B1, 0x0306, 0x1FB0},  // α + COMBINING BREVE = ᾰ (GREEK SMALL LETTER ALPHA WITH VRACHY)
-    {0x03B1, 0x0313, 0x1F00},  // α + COMBINING COMMA ABOVE = ἀ (GREEK SMALL LETTER ALPHA WITH PSILI)
-    {0x03B1, 0x0314, 0x1F01},  // α + COMBINING REVERSED COMMA ABOVE = ἁ (GREEK SMALL LETTER ALPHA WITH DASIA)
-    {0x03B1, 0x0342, 0x1FB6},  // α + COMBINING GREEK PERISPOMENI = ᾶ (GREEK SMALL LETTER ALPHA WITH PERISPOMENI)
-    {0x03B1, 0x0345, 0x1FB3},  // α + COMBINING GREEK YPOGEGRAMMENI = ᾳ (GREEK SMALL LETTER ALPHA WITH YPOGEGRAMMENI)
-    {0x03B5, 0x0300, 0x1F72},  // ε + COMBINING GRAVE ACCENT = ὲ (GREEK SMALL LETTER EPSILON WITH VARIA)
-    {0x03B5, 0x0301, 0x03AD},  // ε + COMBINING ACUTE ACCENT = έ (GREEK SMALL LETTER EPSILON WITH TONOS)
-    {0x03B5, 0x0313, 0x1F10},  // ε + COMBINING COMMA ABOVE = ἐ (GREEK SMALL LETTER EPSILON WITH PSILI)
-    {0x03B5, 0x0314, 0x1F11},  // ε + COMBINING REVERSED COMMA ABOVE = ἑ (GREEK SMALL LETTER EPSILON WITH DASIA)
-    {0x03B7, 0x0300, 0x1F74},  // η + COMBINING GRAVE ACCENT = ὴ (GREEK SMALL LETTER ETA WITH VARIA)
-    {0x03B7, 0x0301, 0x03AE},  // η + COMBINING ACUTE ACCENT = ή (GREEK SMALL LETTER ETA WITH TONOS)
-    {0x03B7, 0x0313, 0x1F20},  // η + COMBINING COMMA ABOVE = ἠ (GREEK SMALL LETTER ETA WITH PSILI)
-    {0x03B7, 0x0314, 0x1F21},  // η + COMBINING REVERSED COMMA ABOVE = ἡ (GREEK SMALL LETTER ETA WITH DASIA)
-    {0x03B7, 0x0342, 0x1FC6},  // η + COMBINING GREEK PERISPOMENI = ῆ (GREEK SMALL LETTER ETA WITH PERISPOMENI)
-    {0x03B7, 0x0345, 0x1FC3},  // η + COMBINING GREEK YPOGEGRAMMENI = ῃ (GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI)
-    {0x03B9, 0x0300, 0x1F76},  // ι + COMBINING GRAVE ACCENT = ὶ (GREEK SMALL LETTER IOTA WITH VARIA)
-    {0x03B9, 0x0301, 0x03AF},  // ι + COMBINING ACUTE ACCENT = ί (GREEK SMALL LETTER IOTA WITH TONOS)
-    {0x03B9, 0x0304, 0x1FD1},  // ι + COMBINING MACRON = ῑ (GREEK SMALL LETTER IOTA WITH MACRON)
-    {0x03B9, 0x0306, 0x1FD0},  // ι + COMBINING BREVE = ῐ (GREEK SMALL LETTER IOTA WITH VRACHY)
-    {0x03B9, 0x0308, 0x03CA},  // ι + COMBINING DIAERESIS = ϊ (GREEK SMALL LETTER IOTA WITH DIALYTIKA)
-    {0x03B9, 0x0313, 0x1F30},  // ι + COMBINING COMMA ABOVE = ἰ (GREEK SMALL LETTER IOTA WITH PSILI)
-    {0x03B9, 0x0314, 0x1F31},  // ι + COMBINING REVERSED COMMA ABOVE = ἱ (GREEK SMALL LETTER IOTA WITH DASIA)
-    {0x03B9, 0x0342, 0x1FD6},  // ι + COMBINING GREEK PERISPOMENI = ῖ (GREEK SMALL LETTER IOTA WITH PERISPOMENI)
-    {0x03BF, 0x0300, 0x1F78},  // ο + COMBINING GRAVE ACCENT = ὸ (GREEK SMALL LETTER OMICRON WITH VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x022F, 0x0304, 0x0231},  // ȯ + COMBINING MACRON = ȱ (LATIN SMALL LETTER O WITH DOT ABOVE AND MACRON)
+    {0x0048, 0x0307, 0x1E22},  // H + COMBINING DOT ABOVE = Ḣ (LATIN CAPITAL LETTER H WITH DOT ABOVE)
+    {0x0062, 0x0331, 0x1E07},  // b + COMBINING MACRON BELOW = ḇ (LATIN SMALL LETTER B WITH LINE BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0069, 0x0311, 0x020B},  // i + COMBINING INVERTED BREVE = ȋ (LATIN SMALL LETTER I WITH INVERTED BREVE)
+    {0x0057, 0x0301, 0x1E82},  // W + COMBINING ACUTE ACCENT = Ẃ (LATIN CAPITAL LETTER W WITH ACUTE)
+    {0x0057, 0x0302, 0x0174},  // W + COMBINING CIRCUMFLEX ACCENT = Ŵ (LATIN CAPITAL LETTER W WITH CIRCUMFLEX)
+    {0x006C, 0x032D, 0x1E3D},  // l + COMBINING CIRCUMFLEX ACCENT BELOW = ḽ (LATIN SMALL LETTER L WITH CIRCUMFLEX BELOW)
+    {0x0074, 0x0326, 0x021B},  // t + COMBINING COMMA BELOW = ț (LATIN SMALL LETTER T WITH COMMA BELOW)
+    {0x006F, 0x0311, 0x020F},  // o + COMBINING INVERTED BREVE = ȏ (LATIN SMALL LETTER O WITH INVERTED BREVE)
+    {0x006C, 0x0323, 0x1E37},  // l + COMBINING DOT BELOW = ḷ (LATIN SMALL LETTER L WITH DOT BELOW)
+    {0x0049, 0x0306, 0x012C},  // I + COMBINING BREVE = Ĭ (LATIN CAPITAL LETTER I WITH BREVE)
+    {0x1EB8, 0x0302,
+     0x1EC6},  // Ẹ + COMBINING CIRCUMFLEX ACCENT = Ệ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1FBF, 0x0342, 0x1FCF},  // ᾿ + COMBINING GREEK PERISPOMENI = ῏ (GREEK PSILI AND PERISPOMENI)
+    {0x041A, 0x0301, 0x040C},  // К + COMBINING ACUTE ACCENT = Ќ (CYRILLIC CAPITAL LETTER KJE)
+    {0x006F, 0x030F, 0x020D},  // o + COMBINING DOUBLE GRAVE ACCENT = ȍ (LATIN SMALL LETTER O WITH DOUBLE GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x006F, 0x0328, 0x01EB},  // o + COMBINING OGONEK = ǫ (LATIN SMALL LETTER O WITH OGONEK)
+    {0x0061, 0x0307, 0x0227},  // a + COMBINING DOT ABOVE = ȧ (LATIN SMALL LETTER A WITH DOT ABOVE)
+    {0x004B, 0x0331, 0x1E34},  // K + COMBINING MACRON BELOW = Ḵ (LATIN CAPITAL LETTER K WITH LINE BELOW)
+    {0x1F62, 0x0345, 0x1FA2},  // ὢ + COMBINING GREEK YPOGEGRAMMENI = ᾢ (GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA
+                               // AND YPOGEGRAMMENI)
+    {0x0061, 0x0300, 0x00E0},  // a + COMBINING GRAVE ACCENT = à (LATIN SMALL LETTER A WITH GRAVE)
+    {0x1F0E, 0x0345, 0x1F8E},  // Ἆ + COMBINING GREEK YPOGEGRAMMENI = ᾎ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND
+                               // PERISPOMENI AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0055, 0x0324, 0x1E72},  // U + COMBINING DIAERESIS BELOW = Ṳ (LATIN CAPITAL LETTER U WITH DIAERESIS BELOW)
+    {0x00A8, 0x0300, 0x1FED},  // ¨ + COMBINING GRAVE ACCENT = ῭ (GREEK DIALYTIKA AND VARIA)
+    {0x0044, 0x030C, 0x010E},  // D + COMBINING CARON = Ď (LATIN CAPITAL LETTER D WITH CARON)
+    {0x00A8, 0x0301, 0x0385},  // ¨ + COMBINING ACUTE ACCENT = ΅ (GREEK DIALYTIKA TONOS)
+    {0x0067, 0x0327, 0x0123},  // g + COMBINING CEDILLA = ģ (LATIN SMALL LETTER G WITH CEDILLA)
+    {0x0050, 0x0307, 0x1E56},  // P + COMBINING DOT ABOVE = Ṗ (LATIN CAPITAL LETTER P WITH DOT ABOVE)
+    {0x00A8, 0x0342, 0x1FC1},  // ¨ + COMBINING GREEK PERISPOMENI = ῁ (GREEK DIALYTIKA AND PERISPOMENI)
+    {0x0399, 0x0314, 0x1F39},  // Ι + COMBINING REVERSED COMMA ABOVE = Ἱ (GREEK CAPITAL LETTER IOTA WITH DASIA)
+    {0x006D, 0x0323, 0x1E43},  // m + COMBINING DOT BELOW = ṃ (LATIN SMALL LETTER M WITH DOT BELOW)
+    {0x0052, 0x0331, 0x1E5E},  // R + COMBINING MACRON BELOW = Ṟ (LATIN CAPITAL LETTER R WITH LINE BELOW)
+    {0x0069, 0x0309, 0x1EC9},  // i + COMBINING HOOK ABOVE = ỉ (LATIN SMALL LETTER I WITH HOOK ABOVE)
+    {0x03D2, 0x0308, 0x03D4},  // ϒ + COMBINING DIAERESIS = ϔ (GREEK UPSILON WITH DIAERESIS AND HOOK SYMBOL)
+    {0x0056, 0x0303, 0x1E7C},  // V + COMBINING TILDE = Ṽ (LATIN CAPITAL LETTER V WITH TILDE)
+    {0x0456, 0x0308, 0x0457},  // і + COMBINING DIAERESIS = ї (CYRILLIC SMALL LETTER YI)
+    {0x0045, 0x0311, 0x0206},  // E + COMBINING INVERTED BREVE = Ȇ (LATIN CAPITAL LETTER E WITH INVERTED BREVE)
+    {0x1F31, 0x0342,
+     0x1F37},  // ἱ + COMBINING GREEK PERISPOMENI = ἷ (GREEK SMALL LETTER IOTA WITH DASIA AND PERISPOMENI)
     {0x03BF, 0x0301, 0x03CC},  // ο + COMBINING ACUTE ACCENT = ό (GREEK SMALL LETTER OMICRON WITH TONOS)
-    {0x03BF, 0x0313, 0x1F40},  // ο + COMBINING COMMA ABOVE = ὀ (GREEK SMALL LETTER OMICRON WITH PSILI)
-    {0x03BF, 0x0314, 0x1F41},  // ο + COMBINING REVERSED COMMA ABOVE = ὁ (GREEK SMALL LETTER OMICRON WITH DASIA)
-    {0x03C1, 0x0313, 0x1FE4},  // ρ + COMBINING COMMA ABOVE = ῤ (GREEK SMALL LETTER RHO WITH PSILI)
-    {0x03C1, 0x0314, 0x1FE5},  // ρ + COMBINING REVERSED COMMA ABOVE = ῥ (GREEK SMALL LETTER RHO WITH DASIA)
-    {0x03C5, 0x0300, 0x1F7A},  // υ + COMBINING GRAVE ACCENT = ὺ (GREEK SMALL LETTER UPSILON WITH VARIA)
-    {0x03C5, 0x0301, 0x03CD},  // υ + COMBINING ACUTE ACCENT = ύ (GREEK SMALL LETTER UPSILON WITH TONOS)
-    {0x03C5, 0x0304, 0x1FE1},  // υ + COMBINING MACRON = ῡ (GREEK SMALL LETTER UPSILON WITH MACRON)
-    {0x03C5, 0x0306, 0x1FE0},  // υ + COMBINING BREVE = ῠ (GREEK SMALL LETTER UPSILON WITH VRACHY)
-    {0x03C5, 0x0308, 0x03CB},  // υ + COMBINING DIAERESIS = ϋ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA)
-    {0x03C5, 0x0313, 0x1F50},  // υ + COMBINING COMMA ABOVE = ὐ (GREEK SMALL LETTER UPSILON WITH PSILI)
-    {0x03C5, 0x0314, 0x1F51},  // υ + COMBINING REVERSED COMMA ABOVE = ὑ (GREEK SMALL LETTER UPSILON WITH DASIA)
-    {0x03C5, 0x0342, 0x1FE6},  // υ + COMBINING GREEK PERISPOMENI = ῦ (GREEK SMALL LETTER UPSILON WITH PERISPOMENI)
-    {0x03C9, 0x0300, 0x1F7C},  // ω + COMBINING GRAVE ACCENT = ὼ (GREEK SMALL LETTER OMEGA WITH VARIA)
-    {0x03C9, 0x0301, 0x03CE},  // ω + COMBINING ACUTE ACCENT = ώ (GREEK SMALL LETTER OMEGA WITH TONOS)
-    {0x03C9, 0x0313, 0x1F60},  // ω + COMBINING COMMA ABOVE = ὠ (GREEK SMALL LETTER OMEGA WITH PSILI)
-    {0x03C9, 0x0314, 0x1F61},  // ω + COMBINING REVERSED COMMA ABOVE = ὡ (GREEK SMALL LETTER OMEGA WITH DASIA)
+    {0x1F68, 0x0342,
+     0x1F6E},  // Ὠ + COMBINING GREEK PERISPOMENI = Ὦ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI)
+    {0x01AF, 0x0309, 0x1EEC},  // Ư + COMBINING HOOK ABOVE = Ử (LATIN CAPITAL LETTER U WITH HORN AND HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0443, 0x0308, 0x04F1},  // у + COMBINING DIAERESIS = ӱ (CYRILLIC SMALL LETTER U WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x00CA, 0x0303, 0x1EC4},  // Ê + COMBINING TILDE = Ễ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0055, 0x0306, 0x016C},  // U + COMBINING BREVE = Ŭ (LATIN CAPITAL LETTER U WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0160, 0x0307, 0x1E66},  // Š + COMBINING DOT ABOVE = Ṧ (LATIN CAPITAL LETTER S WITH CARON AND DOT ABOVE)
+    {0x004E, 0x0323, 0x1E46},  // N + COMBINING DOT BELOW = Ṇ (LATIN CAPITAL LETTER N WITH DOT BELOW)
+    {0x0415, 0x0308, 0x0401},  // Е + COMBINING DIAERESIS = Ё (CYRILLIC CAPITAL LETTER IO)
+    {0x0076, 0x0323, 0x1E7F},  // v + COMBINING DOT BELOW = ṿ (LATIN SMALL LETTER V WITH DOT BELOW)
     {0x03C9, 0x0342, 0x1FF6},  // ω + COMBINING GREEK PERISPOMENI = ῶ (GREEK SMALL LETTER OMEGA WITH PERISPOMENI)
-    {0x03C9, 0x0345, 0x1FF3},  // ω + COMBINING GREEK YPOGEGRAMMENI = ῳ (GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI)
-    {0x03CA, 0x0300, 0x1FD2},  // ϊ + COMBINING GRAVE ACCENT = ῒ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA)
-    {0x03CA, 0x0301, 0x0390},  // ϊ + COMBINING ACUTE ACCENT = ΐ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS)
-    {0x03CA, 0x0342,
-     0x1FD7},  // ϊ + COMBINING GREEK PERISPOMENI = ῗ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI)
-    {0x03CB, 0x0300, 0x1FE2},  // ϋ + COMBINING GRAVE ACCENT = ῢ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA)
-    {0x03CB, 0x0301, 0x03B0},  // ϋ + COMBINING ACUTE ACCENT = ΰ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS)
-    {0x03CB, 0x0342,
-     0x1FE7},  // ϋ + COMBINING GREEK PERISPOMENI = ῧ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI)
-    {0x03CE, 0x0345,
-     0x1FF4},  // ώ + COMBINING GREEK YPOGEGRAMMENI = ῴ (GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI)
-    {0x03D2, 0x0301, 0x03D3},  // ϒ + COMBINING ACUTE ACCENT = ϓ (GREEK UPSILON WITH ACUTE AND HOOK SYMBOL)
-    {0x03D2, 0x0308, 0x03D4},  // ϒ + COMBINING DIAERESIS = ϔ (GREEK UPSILON WITH DIAERESIS AND HOOK SYMBOL)
-    {0x0406, 0x0308, 0x0407},  // І + COMBINING DIAERESIS = Ї (CYRILLIC CAPITAL LETTER YI)
-    {0x0410, 0x0306, 0x04D0},  // А + COMBINING BREVE = Ӑ (CYRILLIC CAPITAL LETTER A WITH BREVE)
-    {0x0410, 0x0308, 0x04D2},  // А + COMBINING DIAERESIS = Ӓ (CYRILLIC CAPITAL LETTER A WITH DIAERESIS)
-    {0x0413, 0x0301, 0x0403},  // Г + COMBINING ACUTE ACCENT = Ѓ (CYRILLIC CAPITAL LETTER GJE)
-    {0x0415, 0x0300, 0x0400},  // Е + COMBINING GRAVE ACCENT = Ѐ (CYRILLIC CAPITAL LETTER IE WITH GRAVE)
+    {0x0228, 0x0306, 0x1E1C},  // Ȩ + COMBINING BREVE = Ḝ (LATIN CAPITAL LETTER E WITH CEDILLA AND BREVE)
+    {0x0067, 0x0302, 0x011D},  // g + COMBINING CIRCUMFLEX ACCENT = ĝ (LATIN SMALL LETTER G WITH CIRCUMFLEX)
+    {0x004F, 0x0323, 0x1ECC},  // O + COMBINING DOT BELOW = Ọ (LATIN CAPITAL LETTER O WITH DOT BELOW)
+    {0x0047, 0x0304, 0x1E20},  // G + COMBINING MACRON = Ḡ (LATIN CAPITAL LETTER G WITH MACRON)
+    {0x004C, 0x0331, 0x1E3A},  // L + COMBINING MACRON BELOW = Ḻ (LATIN CAPITAL LETTER L WITH LINE BELOW)
     {0x0415, 0x0306, 0x04D6},  // Е + COMBINING BREVE = Ӗ (CYRILLIC CAPITAL LETTER IE WITH BREVE)
-    {0x0415, 0x0308, 0x0401},  // Е + COMBINING DIAERESIS = Ё (CYRILLIC CAPITAL LETTER IO)
-    {0x0416, 0x0306, 0x04C1},  // Ж + COMBINING BREVE = Ӂ (CYRILLIC CAPITAL LETTER ZHE WITH BREVE)
-    {0x0416, 0x0308, 0x04DC},  // Ж + COMBINING DIAERESIS = Ӝ (CYRILLIC CAPITAL LETTER ZHE WITH DIAERESIS)
-    {0x0417, 0x0308, 0x04DE},  // З + COMBINING DIAERESIS = Ӟ (CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS)
-    {0x0418, 0x0300, 0x040D},  // И + COMBINING GRAVE ACCENT = Ѝ (CYRILLIC CAPITAL LETTER I WITH GRAVE)
-    {0x0418, 0x0304, 0x04E2},  // И + COMBINING MACRON = Ӣ (CYRILLIC CAPITAL LETTER I WITH MACRON)
-    {0x0418, 0x0306, 0x0419},  // И + COMBINING BREVE = Й (CYRILLIC CAPITAL LETTER SHORT I)
-    {0x0418, 0x0308, 0x04E4},  // И + COMBINING DIAERESIS = Ӥ (CYRILLIC CAPITAL LETTER I WITH DIAERESIS)
-    {0x041A, 0x0301, 0x040C},  // К + COMBINING ACUTE ACCENT = Ќ (CYRILLIC CAPITAL LETTER KJE)
-    {0x041E, 0x0308, 0x04E6},  // О + COMBINING DIAERESIS = Ӧ (CYRILLIC CAPITAL LETTER O WITH DIAERESIS)
-    {0x0423, 0x0304, 0x04EE},  // У + COMBINING MACRON = Ӯ (CYRILLIC CAPITAL LETTER U WITH MACRON)
-    {0x0423, 0x0306, 0x040E},  // У + COMBINING BREVE = Ў (CYRILLIC CAPITAL LETTER SHORT U)
-    {0x0423, 0x0308, 0x04F0},  // У + COMBINING DIAERESIS = Ӱ (CYRILLIC CAPITAL LETTER U WITH DIAERESIS)
-    {0x0423, 0x030B, 0x04F2},  // У + COMBINING DOUBLE ACUTE ACCENT = Ӳ (CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE)
-    {0x0427, 0x0308, 0x04F4},  // Ч + COMBINING DIAERESIS = Ӵ (CYRILLIC CAPITAL LETTER CHE WITH DIAERESIS)
-    {0x042B, 0x0308, 0x04F8},  // Ы + COMBINING DIAERESIS = Ӹ (CYRILLIC CAPITAL LETTER YERU WITH DIAERESIS)
-    {0x042D, 0x0308, 0x04EC},  // Э + COMBINING DIAERESIS = Ӭ (CYRILLIC CAPITAL LETTER E WITH DIAERESIS)
-    {0x0430, 0x0306, 0x04D1},  // а + COMBINING BREVE = ӑ (CYRILLIC SMALL LETTER A WITH BREVE)
-    {0x0430, 0x0308, 0x04D3},  // а + COMBINING DIAERESIS = ӓ (CYRILLIC SMALL LETTER A WITH DIAERESIS)
-    {0x0433, 0x0301, 0x0453},  // г + COMBINING ACUTE ACCENT = ѓ (CYRILLIC SMALL LETTER GJE)
-    {0x0435, 0x0300, 0x0450},  // е + COMBINING GRAVE ACCENT = ѐ (CYRILLIC SMALL LETTER IE WITH GRAVE)
-    {0x0435, 0x0306, 0x04D7},  // е + COMBINING BREVE = ӗ (CYRILLIC SMALL LETTER IE WITH BREVE)
-    {0x0435, 0x0308, 0x0451},  // е + COMBINING DIAERESIS = ё (CYRILLIC SMALL LETTER IO)
-    {0x0436, 0x0306, 0x04C2},  // ж + COMBINING BREVE = ӂ (CYRILLIC SMALL LETTER ZHE WITH BREVE)
-    {0x0436, 0x0308, 0x04DD},  // ж + COMBINING DIAERESIS = ӝ (CYRILLIC SMALL LETTER ZHE WITH DIAERESIS)
-    {0x0437, 0x0308, 0x04DF},  // з + COMBINING DIAERESIS = ӟ (CYRILLIC SMALL LETTER ZE WITH DIAERESIS)
-    {0x0438, 0x0300, 0x045D},  // и + COMBINING GRAVE ACCENT = ѝ (CYRILLIC SMALL LETTER I WITH GRAVE)
-    {0x0438, 0x0304, 0x04E3},  // и + COMBINING MACRON = ӣ (CYRILLIC SMALL LETTER I WITH MACRON)
-    {0x0438, 0x0306, 0x0439},  // и + COMBINING BREVE = й (CYRILLIC SMALL LETTER SHORT I)
-    {0x0438, 0x0308, 0x04E5},  // и + COMBINING DIAERESIS = ӥ (CYRILLIC SMALL LETTER I WITH DIAERESIS)
-    {0x043A, 0x0301, 0x045C},  // к + COMBINING ACUTE ACCENT = ќ (CYRILLIC SMALL LETTER KJE)
-    {0x043E, 0x0308, 0x04E7},  // о + COMBINING DIAERESIS = ӧ (CYRILLIC SMALL LETTER O WITH DIAERESIS)
-    {0x0443, 0x0304, 0x04EF},  // у + COMBINING MACRON = ӯ (CYRILLIC SMALL LETTER U WITH MACRON)
-    {0x0443, 0x0306, 0x045E},  // у + COMBINING BREVE = ў (CYRILLIC SMALL LETTER SHORT U)
-    {0x0443, 0x0308, 0x04F1},  // у + COMBINING DIAERESIS = ӱ (CYRILLIC SMALL LETTER U WITH DIAERESIS)
-    {0x0443, 0x030B, 0x04F3},  // у + COMBINING DOUBLE ACUTE ACCENT = ӳ (CYRILLIC SMALL LETTER U WITH DOUBLE ACUTE)
-    {0x0447, 0x0308, 0x04F5},  // ч + COMBINING DIAERESIS = ӵ (CYRILLIC SMALL LETTER CHE WITH DIAERESIS)
-    {0x044B, 0x0308, 0x04F9},  // ы + COMBINING DIAERESIS = ӹ (CYRILLIC SMALL LETTER YERU WITH DIAERESIS)
-    {0x044D, 0x0308, 0x04ED},  // э + COMBINING DIAERESIS = ӭ (CYRILLIC SMALL LETTER E WITH DIAERESIS)
-    {0x0456, 0x0308, 0x0457},  // і + COMBINING DIAERESIS = ї (CYRILLIC SMALL LETTER YI)
-    {0x0474, 0x030F,
-     0x0476},  // Ѵ + COMBINING DOUBLE GRAVE ACCENT = Ѷ (CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT)
-    {0x0475, 0x030F,
-     0x0477},  // ѵ + COMBINING DOUBLE GRAVE ACCENT = ѷ (CYRILLIC SMALL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT)
-    {0x04D8, 0x0308, 0x04DA},  // Ә + COMBINING DIAERESIS = Ӛ (CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS)
-    {0x04D9, 0x0308, 0x04DB},  // ә + COMBINING DIAERESIS = ӛ (CYRILLIC SMALL LETTER SCHWA WITH DIAERESIS)
-    {0x04E8, 0x0308, 0x04EA},  // Ө + COMBINING DIAERESIS = Ӫ (CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS)
-    {0x04E9, 0x0308, 0x04EB},  // ө + COMBINING DIAERESIS = ӫ (CYRILLIC SMALL LETTER BARRED O WITH DIAERESIS)
+    {0x014D, 0x0300, 0x1E51},  // ō + COMBINING GRAVE ACCENT = ṑ (LATIN SMALL LETTER O WITH MACRON AND GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x004F, 0x0307, 0x022E},  // O + COMBINING DOT ABOVE = Ȯ (LATIN CAPITAL LETTER O WITH DOT ABOVE)
+    {0x0065, 0x0327, 0x0229},  // e + COMBINING CEDILLA = ȩ (LATIN SMALL LETTER E WITH CEDILLA)
     {0x1E36, 0x0304, 0x1E38},  // Ḷ + COMBINING MACRON = Ḹ (LATIN CAPITAL LETTER L WITH DOT BELOW AND MACRON)
-    {0x1E37, 0x0304, 0x1E39},  // ḷ + COMBINING MACRON = ḹ (LATIN SMALL LETTER L WITH DOT BELOW AND MACRON)
-    {0x1E5A, 0x0304, 0x1E5C},  // Ṛ + COMBINING MACRON = Ṝ (LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON)
-    {0x1E5B, 0x0304, 0x1E5D},  // ṛ + COMBINING MACRON = ṝ (LATIN SMALL LETTER R WITH DOT BELOW AND MACRON)
-    {0x1E62, 0x0307, 0x1E68},  // Ṣ + COMBINING DOT ABOVE = Ṩ (LATIN CAPITAL LETTER S WITH DOT BELOW AND DOT ABOVE)
-    {0x1E63, 0x0307, 0x1E69},  // ṣ + COMBINING DOT ABOVE = ṩ (LATIN SMALL LETTER S WITH DOT BELOW AND DOT ABOVE)
-    {0x1EA0, 0x0302,
-     0x1EAC},  // Ạ + COMBINING CIRCUMFLEX ACCENT = Ậ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW)
-    {0x1EA0, 0x0306, 0x1EB6},  // Ạ + COMBINING BREVE = Ặ (LATIN CAPITAL LETTER A WITH BREVE AND DOT BELOW)
-    {0x1EA1, 0x0302,
-     0x1EAD},  // ạ + COMBINING CIRCUMFLEX ACCENT = ậ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND DOT BELOW)
-    {0x1EA1, 0x0306, 0x1EB7},  // ạ + COMBINING BREVE = ặ (LATIN SMALL LETTER A WITH BREVE AND DOT BELOW)
-    {0x1EB8, 0x0302,
-     0x1EC6},  // Ẹ + COMBINING CIRCUMFLEX ACCENT = Ệ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND DOT BELOW)
-    {0x1EB9, 0x0302,
-     0x1EC7},  // ẹ + COMBINING CIRCUMFLEX ACCENT = ệ (LATIN SMALL LETTER E WITH CIRCUMFLEX AND DOT BELOW)
-    {0x1ECC, 0x0302,
-     0x1ED8},  // Ọ + COMBINING CIRCUMFLEX ACCENT = Ộ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND DOT BELOW)
-    {0x1ECD, 0x0302,
-     0x1ED9},  // ọ + COMBINING CIRCUMFLEX ACCENT = ộ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND DOT BELOW)
+    {0x00F4, 0x0301, 0x1ED1},  // ô + COMBINING ACUTE ACCENT = ố (LATIN SMALL LETTER O WITH CIRCUMFLEX AND ACUTE)
+    {0x0078, 0x0308, 0x1E8D},  // x + COMBINING DIAERESIS = ẍ (LATIN SMALL LETTER X WITH DIAERESIS)
+    {0x00F4, 0x0303, 0x1ED7},  // ô + COMBINING TILDE = ỗ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0041, 0x0303, 0x00C3},  // A + COMBINING TILDE = Ã (LATIN CAPITAL LETTER A WITH TILDE)
+    {0x03C1, 0x0313, 0x1FE4},  // ρ + COMBINING COMMA ABOVE = ῤ (GREEK SMALL LETTER RHO WITH PSILI)
+    {0x1F21, 0x0301, 0x1F25},  // ἡ + COMBINING ACUTE ACCENT = ἥ (GREEK SMALL LETTER ETA WITH DASIA AND OXIA)
+    {0x1F2B, 0x0345, 0x1F9B},  // Ἣ + COMBINING GREEK YPOGEGRAMMENI = ᾛ (GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x03C9, 0x0301, 0x03CE},  // ω + COMBINING ACUTE ACCENT = ώ (GREEK SMALL LETTER OMEGA WITH TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0300, 0x00C8},  // E + COMBINING GRAVE ACCENT = È (LATIN CAPITAL LETTER E WITH GRAVE)
+    {0x01AF, 0x0301, 0x1EE8},  // Ư + COMBINING ACUTE ACCENT = Ứ (LATIN CAPITAL LETTER U WITH HORN AND ACUTE)
+    {0x0399, 0x0301, 0x038A},  // Ι + COMBINING ACUTE ACCENT = Ί (GREEK CAPITAL LETTER IOTA WITH TONOS)
     {0x1F00, 0x0300, 0x1F02},  // ἀ + COMBINING GRAVE ACCENT = ἂ (GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA)
-    {0x1F00, 0x0301, 0x1F04},  // ἀ + COMBINING ACUTE ACCENT = ἄ (GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA)
-    {0x1F00, 0x0342,
-     0x1F06},  // ἀ + COMBINING GREEK PERISPOMENI = ἆ (GREEK SMALL LETTER ALPHA WITH PSILI AND PERISPOMENI)
-    {0x1F00, 0x0345,
-     0x1F80},  // ἀ + COMBINING GREEK YPOGEGRAMMENI = ᾀ (GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI)
-    {0x1F01, 0x0300, 0x1F03},  // ἁ + COMBINING GRAVE ACCENT = ἃ (GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA)
-    {0x1F01, 0x0301, 0x1F05},  // ἁ + COMBINING ACUTE ACCENT = ἅ (GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA)
-    {0x1F01, 0x0342,
-     0x1F07},  // ἁ + COMBINING GREEK PERISPOMENI = ἇ (GREEK SMALL LETTER ALPHA WITH DASIA AND PERISPOMENI)
-    {0x1F01, 0x0345,
-     0x1F81},  // ἁ + COMBINING GREEK YPOGEGRAMMENI = ᾁ (GREEK SMALL LETTER ALPHA WITH DASIA AND YPOGEGRAMMENI)
-    {0x1F02, 0x0345, 0x1F82},  // ἂ + COMBINING GREEK YPOGEGRAMMENI = ᾂ (GREEK SMALL LETTER ALPHA WITH PSILI AND VARIA
-                               // AND YPOGEGRAMMENI)
-    {0x1F03, 0x0345, 0x1F83},  // ἃ + COMBINING GREEK YPOGEGRAMMENI = ᾃ (GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA
-                               // AND YPOGEGRAMMENI)
-    {0x1F04, 0x0345,
-     0x1F84},  // ἄ + COMBINING GREEK YPOGEGRAMMENI = ᾄ (GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
-    {0x1F05, 0x0345,
-     0x1F85},  // ἅ + COMBINING GREEK YPOGEGRAMMENI = ᾅ (GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
-    {0x1F06, 0x0345, 0x1F86},  // ἆ + COMBINING GREEK YPOGEGRAMMENI = ᾆ (GREEK SMALL LETTER ALPHA WITH PSILI AND
-                               // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x00CA, 0x0300, 0x1EC0},  // Ê + COMBINING GRAVE ACCENT = Ề (LATIN CAPITAL LETTER E WITH CIRCUMFLEX AND GRAVE)
+    {0x1F61, 0x0345,
+     0x1FA1},  // ὡ + COMBINING GREEK YPOGEGRAMMENI = ᾡ (GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x03CA, 0x0300, 0x1FD2},  // ϊ + COMBINING GRAVE ACCENT = ῒ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA)
+    {0x1F69, 0x0345,
+     0x1FA9},  // Ὡ + COMBINING GREEK YPOGEGRAMMENI = ᾩ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x00F5, 0x0304, 0x022D},  // õ + COMBINING MACRON = ȭ (LATIN SMALL LETTER O WITH TILDE AND MACRON)
+    {0x03B9, 0x0300, 0x1F76},  // ι + COMBINING GRAVE ACCENT = ὶ (GREEK SMALL LETTER IOTA WITH VARIA)
+    {0x0075, 0x030F, 0x0215},  // u + COMBINING DOUBLE GRAVE ACCENT = ȕ (LATIN SMALL LETTER U WITH DOUBLE GRAVE)
+    {0x1E5B, 0x0304, 0x1E5D},  // ṛ + COMBINING MACRON = ṝ (LATIN SMALL LETTER R WITH DOT BELOW AND MACRON)
+    {0x0052, 0x0311, 0x0212},  // R + COMBINING INVERTED BREVE = Ȓ (LATIN CAPITAL LETTER R WITH INVERTED BREVE)
+    {0x0052, 0x0307, 0x1E58},  // R + COMBINING DOT ABOVE = Ṙ (LATIN CAPITAL LETTER R WITH DOT ABOVE)
+    {0x004F, 0x0300, 0x00D2},  // O + COMBINING GRAVE ACCENT = Ò (LATIN CAPITAL LETTER O WITH GRAVE)
     {0x1F07, 0x0345, 0x1F87},  // ἇ + COMBINING GREEK YPOGEGRAMMENI = ᾇ (GREEK SMALL LETTER ALPHA WITH DASIA AND
                                // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x03C9, 0x0345, 0x1FF3},  // ω + COMBINING GREEK YPOGEGRAMMENI = ῳ (GREEK SMALL LETTER OMEGA WITH YPOGEGRAMMENI)
+    {0x1F20, 0x0300, 0x1F22},  // ἠ + COMBINING GRAVE ACCENT = ἢ (GREEK SMALL LETTER ETA WITH PSILI AND VARIA)
+    {0x0435, 0x0306, 0x04D7},  // е + COMBINING BREVE = ӗ (CYRILLIC SMALL LETTER IE WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F10, 0x0300, 0x1F12},  // ἐ + COMBINING GRAVE ACCENT = ἒ (GREEK SMALL LETTER EPSILON WITH PSILI AND VARIA)
+    {0x01A0, 0x0301, 0x1EDA},  // Ơ + COMBINING ACUTE ACCENT = Ớ (LATIN CAPITAL LETTER O WITH HORN AND ACUTE)
+    {0x006F, 0x0306, 0x014F},  // o + COMBINING BREVE = ŏ (LATIN SMALL LETTER O WITH BREVE)
+    {0x03B9, 0x0306, 0x1FD0},  // ι + COMBINING BREVE = ῐ (GREEK SMALL LETTER IOTA WITH VRACHY)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x004E, 0x0307, 0x1E44},  // N + COMBINING DOT ABOVE = Ṅ (LATIN CAPITAL LETTER N WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x004D, 0x0301, 0x1E3E},  // M + COMBINING ACUTE ACCENT = Ḿ (LATIN CAPITAL LETTER M WITH ACUTE)
+    {0x0044, 0x0323, 0x1E0C},  // D + COMBINING DOT BELOW = Ḍ (LATIN CAPITAL LETTER D WITH DOT BELOW)
+    {0x004C, 0x030C, 0x013D},  // L + COMBINING CARON = Ľ (LATIN CAPITAL LETTER L WITH CARON)
+    {0x03C5, 0x0300, 0x1F7A},  // υ + COMBINING GRAVE ACCENT = ὺ (GREEK SMALL LETTER UPSILON WITH VARIA)
+    {0x1F20, 0x0342,
+     0x1F26},  // ἠ + COMBINING GREEK PERISPOMENI = ἦ (GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI)
+    {0x00C6, 0x0304, 0x01E2},  // Æ + COMBINING MACRON = Ǣ (LATIN CAPITAL LETTER AE WITH MACRON)
+    {0x0418, 0x0306, 0x0419},  // И + COMBINING BREVE = Й (CYRILLIC CAPITAL LETTER SHORT I)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F0F, 0x0345, 0x1F8F},  // Ἇ + COMBINING GREEK YPOGEGRAMMENI = ᾏ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND
+                               // PERISPOMENI AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0406, 0x0308, 0x0407},  // І + COMBINING DIAERESIS = Ї (CYRILLIC CAPITAL LETTER YI)
+    {0x006F, 0x0323, 0x1ECD},  // o + COMBINING DOT BELOW = ọ (LATIN SMALL LETTER O WITH DOT BELOW)
+    {0x00C4, 0x0304, 0x01DE},  // Ä + COMBINING MACRON = Ǟ (LATIN CAPITAL LETTER A WITH DIAERESIS AND MACRON)
+    {0x0443, 0x030B, 0x04F3},  // у + COMBINING DOUBLE ACUTE ACCENT = ӳ (CYRILLIC SMALL LETTER U WITH DOUBLE ACUTE)
+    {0x007A, 0x0323, 0x1E93},  // z + COMBINING DOT BELOW = ẓ (LATIN SMALL LETTER Z WITH DOT BELOW)
+    {0x1F29, 0x0301, 0x1F2D},  // Ἡ + COMBINING ACUTE ACCENT = Ἥ (GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA)
+    {0x0065, 0x0311, 0x0207},  // e + COMBINING INVERTED BREVE = ȇ (LATIN SMALL LETTER E WITH INVERTED BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x03A1, 0x0314, 0x1FEC},  // Ρ + COMBINING REVERSED COMMA ABOVE = Ῥ (GREEK CAPITAL LETTER RHO WITH DASIA)
+    {0x0043, 0x030C, 0x010C},  // C + COMBINING CARON = Č (LATIN CAPITAL LETTER C WITH CARON)
+    {0x0077, 0x0300, 0x1E81},  // w + COMBINING GRAVE ACCENT = ẁ (LATIN SMALL LETTER W WITH GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0065, 0x030F, 0x0205},  // e + COMBINING DOUBLE GRAVE ACCENT = ȅ (LATIN SMALL LETTER E WITH DOUBLE GRAVE)
+    {0x0423, 0x030B, 0x04F2},  // У + COMBINING DOUBLE ACUTE ACCENT = Ӳ (CYRILLIC CAPITAL LETTER U WITH DOUBLE ACUTE)
+    {0x00DC, 0x0301, 0x01D7},  // Ü + COMBINING ACUTE ACCENT = Ǘ (LATIN CAPITAL LETTER U WITH DIAERESIS AND ACUTE)
+    {0x0063, 0x0301, 0x0107},  // c + COMBINING ACUTE ACCENT = ć (LATIN SMALL LETTER C WITH ACUTE)
     {0x1F08, 0x0300, 0x1F0A},  // Ἀ + COMBINING GRAVE ACCENT = Ἂ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA)
-    {0x1F08, 0x0301, 0x1F0C},  // Ἀ + COMBINING ACUTE ACCENT = Ἄ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA)
-    {0x1F08, 0x0342,
-     0x1F0E},  // Ἀ + COMBINING GREEK PERISPOMENI = Ἆ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND PERISPOMENI)
-    {0x1F08, 0x0345,
-     0x1F88},  // Ἀ + COMBINING GREEK YPOGEGRAMMENI = ᾈ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI)
-    {0x1F09, 0x0300, 0x1F0B},  // Ἁ + COMBINING GRAVE ACCENT = Ἃ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA)
-    {0x1F09, 0x0301, 0x1F0D},  // Ἁ + COMBINING ACUTE ACCENT = Ἅ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA)
-    {0x1F09, 0x0342,
-     0x1F0F},  // Ἁ + COMBINING GREEK PERISPOMENI = Ἇ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI)
-    {0x1F09, 0x0345,
-     0x1F89},  // Ἁ + COMBINING GREEK YPOGEGRAMMENI = ᾉ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI)
-    {0x1F0A, 0x0345, 0x1F8A},  // Ἂ + COMBINING GREEK YPOGEGRAMMENI = ᾊ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F0B, 0x0345, 0x1F8B},  // Ἃ + COMBINING GREEK YPOGEGRAMMENI = ᾋ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F0C, 0x0345, 0x1F8C},  // Ἄ + COMBINING GREEK YPOGEGRAMMENI = ᾌ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA
-                               // AND PROSGEGRAMMENI)
+    {0x1F63, 0x0345, 0x1FA3},  // ὣ + COMBINING GREEK YPOGEGRAMMENI = ᾣ (GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA
+                               // AND YPOGEGRAMMENI)
+    {0x1F39, 0x0300, 0x1F3B},  // Ἱ + COMBINING GRAVE ACCENT = Ἳ (GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA)
+    {0x01B7, 0x030C, 0x01EE},  // Ʒ + COMBINING CARON = Ǯ (LATIN CAPITAL LETTER EZH WITH CARON)
+    {0x006B, 0x030C, 0x01E9},  // k + COMBINING CARON = ǩ (LATIN SMALL LETTER K WITH CARON)
+    {0x1F21, 0x0342,
+     0x1F27},  // ἡ + COMBINING GREEK PERISPOMENI = ἧ (GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI)
+    {0x03B5, 0x0301, 0x03AD},  // ε + COMBINING ACUTE ACCENT = έ (GREEK SMALL LETTER EPSILON WITH TONOS)
+    {0x00D4, 0x0300, 0x1ED2},  // Ô + COMBINING GRAVE ACCENT = Ồ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND GRAVE)
+    {0x04E8, 0x0308, 0x04EA},  // Ө + COMBINING DIAERESIS = Ӫ (CYRILLIC CAPITAL LETTER BARRED O WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x00E6, 0x0301, 0x01FD},  // æ + COMBINING ACUTE ACCENT = ǽ (LATIN SMALL LETTER AE WITH ACUTE)
+    {0x01A1, 0x0301, 0x1EDB},  // ơ + COMBINING ACUTE ACCENT = ớ (LATIN SMALL LETTER O WITH HORN AND ACUTE)
+    {0x03CB, 0x0301, 0x03B0},  // ϋ + COMBINING ACUTE ACCENT = ΰ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x00EA, 0x0300, 0x1EC1},  // ê + COMBINING GRAVE ACCENT = ề (LATIN SMALL LETTER E WITH CIRCUMFLEX AND GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0043, 0x0307, 0x010A},  // C + COMBINING DOT ABOVE = Ċ (LATIN CAPITAL LETTER C WITH DOT ABOVE)
+    {0x1F04, 0x0345,
+     0x1F84},  // ἄ + COMBINING GREEK YPOGEGRAMMENI = ᾄ (GREEK SMALL LETTER ALPHA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
+    {0x1F29, 0x0345,
+     0x1F99},  // Ἡ + COMBINING GREEK YPOGEGRAMMENI = ᾙ (GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x039F, 0x0314, 0x1F49},  // Ο + COMBINING REVERSED COMMA ABOVE = Ὁ (GREEK CAPITAL LETTER OMICRON WITH DASIA)
+    {0x004C, 0x0301, 0x0139},  // L + COMBINING ACUTE ACCENT = Ĺ (LATIN CAPITAL LETTER L WITH ACUTE)
+    {0x006F, 0x0307, 0x022F},  // o + COMBINING DOT ABOVE = ȯ (LATIN SMALL LETTER O WITH DOT ABOVE)
+    {0x0073, 0x030C, 0x0161},  // s + COMBINING CARON = š (LATIN SMALL LETTER S WITH CARON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0077, 0x0323, 0x1E89},  // w + COMBINING DOT BELOW = ẉ (LATIN SMALL LETTER W WITH DOT BELOW)
+    {0x00E7, 0x0301, 0x1E09},  // ç + COMBINING ACUTE ACCENT = ḉ (LATIN SMALL LETTER C WITH CEDILLA AND ACUTE)
+    {0x00F5, 0x0301, 0x1E4D},  // õ + COMBINING ACUTE ACCENT = ṍ (LATIN SMALL LETTER O WITH TILDE AND ACUTE)
+    {0x1F61, 0x0301, 0x1F65},  // ὡ + COMBINING ACUTE ACCENT = ὥ (GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA)
+    {0x1F30, 0x0342,
+     0x1F36},  // ἰ + COMBINING GREEK PERISPOMENI = ἶ (GREEK SMALL LETTER IOTA WITH PSILI AND PERISPOMENI)
     {0x1F0D, 0x0345, 0x1F8D},  // Ἅ + COMBINING GREEK YPOGEGRAMMENI = ᾍ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND OXIA
                                // AND PROSGEGRAMMENI)
-    {0x1F0E, 0x0345, 0x1F8E},  // Ἆ + COMBINING GREEK YPOGEGRAMMENI = ᾎ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND
-                               // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F0F, 0x0345, 0x1F8F},  // Ἇ + COMBINING GREEK YPOGEGRAMMENI = ᾏ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND
-                               // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F10, 0x0300, 0x1F12},  // ἐ + COMBINING GRAVE ACCENT = ἒ (GREEK SMALL LETTER EPSILON WITH PSILI AND VARIA)
-    {0x1F10, 0x0301, 0x1F14},  // ἐ + COMBINING ACUTE ACCENT = ἔ (GREEK SMALL LETTER EPSILON WITH PSILI AND OXIA)
+    {0x0430, 0x0306, 0x04D1},  // а + COMBINING BREVE = ӑ (CYRILLIC SMALL LETTER A WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x006E, 0x0331, 0x1E49},  // n + COMBINING MACRON BELOW = ṉ (LATIN SMALL LETTER N WITH LINE BELOW)
+    {0x004F, 0x0301, 0x00D3},  // O + COMBINING ACUTE ACCENT = Ó (LATIN CAPITAL LETTER O WITH ACUTE)
+    {0x0058, 0x0308, 0x1E8C},  // X + COMBINING DIAERESIS = Ẍ (LATIN CAPITAL LETTER X WITH DIAERESIS)
+    {0x0397, 0x0301, 0x0389},  // Η + COMBINING ACUTE ACCENT = Ή (GREEK CAPITAL LETTER ETA WITH TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0395, 0x0301, 0x0388},  // Ε + COMBINING ACUTE ACCENT = Έ (GREEK CAPITAL LETTER EPSILON WITH TONOS)
+    {0x039F, 0x0301, 0x038C},  // Ο + COMBINING ACUTE ACCENT = Ό (GREEK CAPITAL LETTER OMICRON WITH TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F28, 0x0345,
+     0x1F98},  // Ἠ + COMBINING GREEK YPOGEGRAMMENI = ᾘ (GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI)
+    {0x0059, 0x0300, 0x1EF2},  // Y + COMBINING GRAVE ACCENT = Ỳ (LATIN CAPITAL LETTER Y WITH GRAVE)
+    {0x01A0, 0x0309, 0x1EDE},  // Ơ + COMBINING HOOK ABOVE = Ở (LATIN CAPITAL LETTER O WITH HORN AND HOOK ABOVE)
+    {0x0068, 0x0327, 0x1E29},  // h + COMBINING CEDILLA = ḩ (LATIN SMALL LETTER H WITH CEDILLA)
+    {0x0074, 0x0323, 0x1E6D},  // t + COMBINING DOT BELOW = ṭ (LATIN SMALL LETTER T WITH DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0068, 0x0308, 0x1E27},  // h + COMBINING DIAERESIS = ḧ (LATIN SMALL LETTER H WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x014C, 0x0301, 0x1E52},  // Ō + COMBINING ACUTE ACCENT = Ṓ (LATIN CAPITAL LETTER O WITH MACRON AND ACUTE)
+    {0x03A5, 0x0306, 0x1FE8},  // Υ + COMBINING BREVE = Ῠ (GREEK CAPITAL LETTER UPSILON WITH VRACHY)
+    {0x0057, 0x0307, 0x1E86},  // W + COMBINING DOT ABOVE = Ẇ (LATIN CAPITAL LETTER W WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0079, 0x0302, 0x0177},  // y + COMBINING CIRCUMFLEX ACCENT = ŷ (LATIN SMALL LETTER Y WITH CIRCUMFLEX)
+    {0x03B7, 0x0345, 0x1FC3},  // η + COMBINING GREEK YPOGEGRAMMENI = ῃ (GREEK SMALL LETTER ETA WITH YPOGEGRAMMENI)
+    {0x03B7, 0x0314, 0x1F21},  // η + COMBINING REVERSED COMMA ABOVE = ἡ (GREEK SMALL LETTER ETA WITH DASIA)
+    {0x004F, 0x0302, 0x00D4},  // O + COMBINING CIRCUMFLEX ACCENT = Ô (LATIN CAPITAL LETTER O WITH CIRCUMFLEX)
+    {0x1F09, 0x0300, 0x1F0B},  // Ἁ + COMBINING GRAVE ACCENT = Ἃ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0077, 0x0307, 0x1E87},  // w + COMBINING DOT ABOVE = ẇ (LATIN SMALL LETTER W WITH DOT ABOVE)
+    {0x0065, 0x0306, 0x0115},  // e + COMBINING BREVE = ĕ (LATIN SMALL LETTER E WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x004F, 0x0309, 0x1ECE},  // O + COMBINING HOOK ABOVE = Ỏ (LATIN CAPITAL LETTER O WITH HOOK ABOVE)
+    {0x00FC, 0x0300, 0x01DC},  // ü + COMBINING GRAVE ACCENT = ǜ (LATIN SMALL LETTER U WITH DIAERESIS AND GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0055, 0x032D,
+     0x1E76},  // U + COMBINING CIRCUMFLEX ACCENT BELOW = Ṷ (LATIN CAPITAL LETTER U WITH CIRCUMFLEX BELOW)
+    {0x0438, 0x0304, 0x04E3},  // и + COMBINING MACRON = ӣ (CYRILLIC SMALL LETTER I WITH MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0438, 0x0300, 0x045D},  // и + COMBINING GRAVE ACCENT = ѝ (CYRILLIC SMALL LETTER I WITH GRAVE)
+    {0x0075, 0x0301, 0x00FA},  // u + COMBINING ACUTE ACCENT = ú (LATIN SMALL LETTER U WITH ACUTE)
+    {0x1F00, 0x0345,
+     0x1F80},  // ἀ + COMBINING GREEK YPOGEGRAMMENI = ᾀ (GREEK SMALL LETTER ALPHA WITH PSILI AND YPOGEGRAMMENI)
+    {0x1F64, 0x0345,
+     0x1FA4},  // ὤ + COMBINING GREEK YPOGEGRAMMENI = ᾤ (GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
+    {0x01A1, 0x0309, 0x1EDF},  // ơ + COMBINING HOOK ABOVE = ở (LATIN SMALL LETTER O WITH HORN AND HOOK ABOVE)
+    {0x0047, 0x0307, 0x0120},  // G + COMBINING DOT ABOVE = Ġ (LATIN CAPITAL LETTER G WITH DOT ABOVE)
+    {0x1E5A, 0x0304, 0x1E5C},  // Ṛ + COMBINING MACRON = Ṝ (LATIN CAPITAL LETTER R WITH DOT BELOW AND MACRON)
+    {0x03B9, 0x0301, 0x03AF},  // ι + COMBINING ACUTE ACCENT = ί (GREEK SMALL LETTER IOTA WITH TONOS)
+    {0x006B, 0x0301, 0x1E31},  // k + COMBINING ACUTE ACCENT = ḱ (LATIN SMALL LETTER K WITH ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1FFE, 0x0342, 0x1FDF},  // ῾ + COMBINING GREEK PERISPOMENI = ῟ (GREEK DASIA AND PERISPOMENI)
+    {0x0041, 0x0311, 0x0202},  // A + COMBINING INVERTED BREVE = Ȃ (LATIN CAPITAL LETTER A WITH INVERTED BREVE)
     {0x1F11, 0x0300, 0x1F13},  // ἑ + COMBINING GRAVE ACCENT = ἓ (GREEK SMALL LETTER EPSILON WITH DASIA AND VARIA)
+    {0x0073, 0x0323, 0x1E63},  // s + COMBINING DOT BELOW = ṣ (LATIN SMALL LETTER S WITH DOT BELOW)
+    {0x0423, 0x0304, 0x04EE},  // У + COMBINING MACRON = Ӯ (CYRILLIC CAPITAL LETTER U WITH MACRON)
+    {0x0041, 0x030A, 0x00C5},  // A + COMBINING RING ABOVE = Å (LATIN CAPITAL LETTER A WITH RING ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1EB9, 0x0302,
+     0x1EC7},  // ẹ + COMBINING CIRCUMFLEX ACCENT = ệ (LATIN SMALL LETTER E WITH CIRCUMFLEX AND DOT BELOW)
+    {0x0070, 0x0307, 0x1E57},  // p + COMBINING DOT ABOVE = ṗ (LATIN SMALL LETTER P WITH DOT ABOVE)
+    {0x004B, 0x0323, 0x1E32},  // K + COMBINING DOT BELOW = Ḳ (LATIN CAPITAL LETTER K WITH DOT BELOW)
+    {0x01B0, 0x0301, 0x1EE9},  // ư + COMBINING ACUTE ACCENT = ứ (LATIN SMALL LETTER U WITH HORN AND ACUTE)
+    {0x004E, 0x0300, 0x01F8},  // N + COMBINING GRAVE ACCENT = Ǹ (LATIN CAPITAL LETTER N WITH GRAVE)
+    {0x0048, 0x030C, 0x021E},  // H + COMBINING CARON = Ȟ (LATIN CAPITAL LETTER H WITH CARON)
+    {0x0069, 0x0323, 0x1ECB},  // i + COMBINING DOT BELOW = ị (LATIN SMALL LETTER I WITH DOT BELOW)
+    {0x044B, 0x0308, 0x04F9},  // ы + COMBINING DIAERESIS = ӹ (CYRILLIC SMALL LETTER YERU WITH DIAERESIS)
+    {0x0435, 0x0308, 0x0451},  // е + COMBINING DIAERESIS = ё (CYRILLIC SMALL LETTER IO)
+    {0x03B9, 0x0313, 0x1F30},  // ι + COMBINING COMMA ABOVE = ἰ (GREEK SMALL LETTER IOTA WITH PSILI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0437, 0x0308, 0x04DF},  // з + COMBINING DIAERESIS = ӟ (CYRILLIC SMALL LETTER ZE WITH DIAERESIS)
+    {0x0041, 0x0308, 0x00C4},  // A + COMBINING DIAERESIS = Ä (LATIN CAPITAL LETTER A WITH DIAERESIS)
+    {0x0074, 0x0331, 0x1E6F},  // t + COMBINING MACRON BELOW = ṯ (LATIN SMALL LETTER T WITH LINE BELOW)
+    {0x0391, 0x0300, 0x1FBA},  // Α + COMBINING GRAVE ACCENT = Ὰ (GREEK CAPITAL LETTER ALPHA WITH VARIA)
+    {0x1F48, 0x0301, 0x1F4C},  // Ὀ + COMBINING ACUTE ACCENT = Ὄ (GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA)
+    {0x004F, 0x030C, 0x01D1},  // O + COMBINING CARON = Ǒ (LATIN CAPITAL LETTER O WITH CARON)
+    {0x0000, 0x0000, 0x0000},
+    {0x006D, 0x0301, 0x1E3F},  // m + COMBINING ACUTE ACCENT = ḿ (LATIN SMALL LETTER M WITH ACUTE)
+    {0x04E9, 0x0308, 0x04EB},  // ө + COMBINING DIAERESIS = ӫ (CYRILLIC SMALL LETTER BARRED O WITH DIAERESIS)
+    {0x1F59, 0x0300, 0x1F5B},  // Ὑ + COMBINING GRAVE ACCENT = Ὓ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA)
+    {0x0048, 0x032E, 0x1E2A},  // H + COMBINING BREVE BELOW = Ḫ (LATIN CAPITAL LETTER H WITH BREVE BELOW)
+    {0x039F, 0x0300, 0x1FF8},  // Ο + COMBINING GRAVE ACCENT = Ὸ (GREEK CAPITAL LETTER OMICRON WITH VARIA)
+    {0x0103, 0x0301, 0x1EAF},  // ă + COMBINING ACUTE ACCENT = ắ (LATIN SMALL LETTER A WITH BREVE AND ACUTE)
+    {0x0075, 0x030A, 0x016F},  // u + COMBINING RING ABOVE = ů (LATIN SMALL LETTER U WITH RING ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0049, 0x0300, 0x00CC},  // I + COMBINING GRAVE ACCENT = Ì (LATIN CAPITAL LETTER I WITH GRAVE)
+    {0x004F, 0x0303, 0x00D5},  // O + COMBINING TILDE = Õ (LATIN CAPITAL LETTER O WITH TILDE)
+    {0x0065, 0x0300, 0x00E8},  // e + COMBINING GRAVE ACCENT = è (LATIN SMALL LETTER E WITH GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x006B, 0x0323, 0x1E33},  // k + COMBINING DOT BELOW = ḳ (LATIN SMALL LETTER K WITH DOT BELOW)
+    {0x0073, 0x0302, 0x015D},  // s + COMBINING CIRCUMFLEX ACCENT = ŝ (LATIN SMALL LETTER S WITH CIRCUMFLEX)
+    {0x0069, 0x0300, 0x00EC},  // i + COMBINING GRAVE ACCENT = ì (LATIN SMALL LETTER I WITH GRAVE)
+    {0x0436, 0x0306, 0x04C2},  // ж + COMBINING BREVE = ӂ (CYRILLIC SMALL LETTER ZHE WITH BREVE)
+    {0x03C5, 0x0306, 0x1FE0},  // υ + COMBINING BREVE = ῠ (GREEK SMALL LETTER UPSILON WITH VRACHY)
+    {0x0229, 0x0306, 0x1E1D},  // ȩ + COMBINING BREVE = ḝ (LATIN SMALL LETTER E WITH CEDILLA AND BREVE)
+    {0x0072, 0x0301, 0x0155},  // r + COMBINING ACUTE ACCENT = ŕ (LATIN SMALL LETTER R WITH ACUTE)
+    {0x0103, 0x0303, 0x1EB5},  // ă + COMBINING TILDE = ẵ (LATIN SMALL LETTER A WITH BREVE AND TILDE)
+    {0x0079, 0x0308, 0x00FF},  // y + COMBINING DIAERESIS = ÿ (LATIN SMALL LETTER Y WITH DIAERESIS)
+    {0x004F, 0x030B, 0x0150},  // O + COMBINING DOUBLE ACUTE ACCENT = Ő (LATIN CAPITAL LETTER O WITH DOUBLE ACUTE)
+    {0x00DC, 0x0300, 0x01DB},  // Ü + COMBINING GRAVE ACCENT = Ǜ (LATIN CAPITAL LETTER U WITH DIAERESIS AND GRAVE)
+    {0x0061, 0x0311, 0x0203},  // a + COMBINING INVERTED BREVE = ȃ (LATIN SMALL LETTER A WITH INVERTED BREVE)
+    {0x004F, 0x030F, 0x020C},  // O + COMBINING DOUBLE GRAVE ACCENT = Ȍ (LATIN CAPITAL LETTER O WITH DOUBLE GRAVE)
+    {0x006F, 0x0301, 0x00F3},  // o + COMBINING ACUTE ACCENT = ó (LATIN SMALL LETTER O WITH ACUTE)
+    {0x0065, 0x0323, 0x1EB9},  // e + COMBINING DOT BELOW = ẹ (LATIN SMALL LETTER E WITH DOT BELOW)
+    {0x0292, 0x030C, 0x01EF},  // ʒ + COMBINING CARON = ǯ (LATIN SMALL LETTER EZH WITH CARON)
+    {0x00F4, 0x0309, 0x1ED5},  // ô + COMBINING HOOK ABOVE = ổ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x00D4, 0x0301, 0x1ED0},  // Ô + COMBINING ACUTE ACCENT = Ố (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F6B, 0x0345, 0x1FAB},  // Ὣ + COMBINING GREEK YPOGEGRAMMENI = ᾫ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA
+                               // AND PROSGEGRAMMENI)
+    {0x006B, 0x0327, 0x0137},  // k + COMBINING CEDILLA = ķ (LATIN SMALL LETTER K WITH CEDILLA)
     {0x1F11, 0x0301, 0x1F15},  // ἑ + COMBINING ACUTE ACCENT = ἕ (GREEK SMALL LETTER EPSILON WITH DASIA AND OXIA)
-    {0x1F18, 0x0300, 0x1F1A},  // Ἐ + COMBINING GRAVE ACCENT = Ἒ (GREEK CAPITAL LETTER EPSILON WITH PSILI AND VARIA)
-    {0x1F18, 0x0301, 0x1F1C},  // Ἐ + COMBINING ACUTE ACCENT = Ἔ (GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA)
-    {0x1F19, 0x0300, 0x1F1B},  // Ἑ + COMBINING GRAVE ACCENT = Ἓ (GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA)
-    {0x1F19, 0x0301, 0x1F1D},  // Ἑ + COMBINING ACUTE ACCENT = Ἕ (GREEK CAPITAL LETTER EPSILON WITH DASIA AND OXIA)
-    {0x1F20, 0x0300, 0x1F22},  // ἠ + COMBINING GRAVE ACCENT = ἢ (GREEK SMALL LETTER ETA WITH PSILI AND VARIA)
-    {0x1F20, 0x0301, 0x1F24},  // ἠ + COMBINING ACUTE ACCENT = ἤ (GREEK SMALL LETTER ETA WITH PSILI AND OXIA)
-    {0x1F20, 0x0342,
-     0x1F26},  // ἠ + COMBINING GREEK PERISPOMENI = ἦ (GREEK SMALL LETTER ETA WITH PSILI AND PERISPOMENI)
-    {0x1F20, 0x0345,
-     0x1F90},  // ἠ + COMBINING GREEK YPOGEGRAMMENI = ᾐ (GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI)
-    {0x1F21, 0x0300, 0x1F23},  // ἡ + COMBINING GRAVE ACCENT = ἣ (GREEK SMALL LETTER ETA WITH DASIA AND VARIA)
-    {0x1F21, 0x0301, 0x1F25},  // ἡ + COMBINING ACUTE ACCENT = ἥ (GREEK SMALL LETTER ETA WITH DASIA AND OXIA)
-    {0x1F21, 0x0342,
-     0x1F27},  // ἡ + COMBINING GREEK PERISPOMENI = ἧ (GREEK SMALL LETTER ETA WITH DASIA AND PERISPOMENI)
-    {0x1F21, 0x0345,
-     0x1F91},  // ἡ + COMBINING GREEK YPOGEGRAMMENI = ᾑ (GREEK SMALL LETTER ETA WITH DASIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0041, 0x0300, 0x00C0},  // A + COMBINING GRAVE ACCENT = À (LATIN CAPITAL LETTER A WITH GRAVE)
+    {0x01A0, 0x0300, 0x1EDC},  // Ơ + COMBINING GRAVE ACCENT = Ờ (LATIN CAPITAL LETTER O WITH HORN AND GRAVE)
+    {0x00D5, 0x0308, 0x1E4E},  // Õ + COMBINING DIAERESIS = Ṏ (LATIN CAPITAL LETTER O WITH TILDE AND DIAERESIS)
+    {0x0044, 0x0307, 0x1E0A},  // D + COMBINING DOT ABOVE = Ḋ (LATIN CAPITAL LETTER D WITH DOT ABOVE)
+    {0x0399, 0x0300, 0x1FDA},  // Ι + COMBINING GRAVE ACCENT = Ὶ (GREEK CAPITAL LETTER IOTA WITH VARIA)
+    {0x0041, 0x0302, 0x00C2},  // A + COMBINING CIRCUMFLEX ACCENT = Â (LATIN CAPITAL LETTER A WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0413, 0x0301, 0x0403},  // Г + COMBINING ACUTE ACCENT = Ѓ (CYRILLIC CAPITAL LETTER GJE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0061, 0x0328, 0x0105},  // a + COMBINING OGONEK = ą (LATIN SMALL LETTER A WITH OGONEK)
+    {0x0077, 0x0301, 0x1E83},  // w + COMBINING ACUTE ACCENT = ẃ (LATIN SMALL LETTER W WITH ACUTE)
+    {0x022E, 0x0304, 0x0230},  // Ȯ + COMBINING MACRON = Ȱ (LATIN CAPITAL LETTER O WITH DOT ABOVE AND MACRON)
+    {0x0047, 0x0327, 0x0122},  // G + COMBINING CEDILLA = Ģ (LATIN CAPITAL LETTER G WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x03C9, 0x0300, 0x1F7C},  // ω + COMBINING GRAVE ACCENT = ὼ (GREEK SMALL LETTER OMEGA WITH VARIA)
+    {0x0102, 0x0303, 0x1EB4},  // Ă + COMBINING TILDE = Ẵ (LATIN CAPITAL LETTER A WITH BREVE AND TILDE)
+    {0x03B1, 0x0306, 0x1FB0},  // α + COMBINING BREVE = ᾰ (GREEK SMALL LETTER ALPHA WITH VRACHY)
+    {0x1F09, 0x0342,
+     0x1F0F},  // Ἁ + COMBINING GREEK PERISPOMENI = Ἇ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND PERISPOMENI)
+    {0x1F39, 0x0301, 0x1F3D},  // Ἱ + COMBINING ACUTE ACCENT = Ἵ (GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F7C, 0x0345,
+     0x1FF2},  // ὼ + COMBINING GREEK YPOGEGRAMMENI = ῲ (GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1FC6, 0x0345,
+     0x1FC7},  // ῆ + COMBINING GREEK YPOGEGRAMMENI = ῇ (GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI)
+    {0x0072, 0x0327, 0x0157},  // r + COMBINING CEDILLA = ŗ (LATIN SMALL LETTER R WITH CEDILLA)
+    {0x004F, 0x0306, 0x014E},  // O + COMBINING BREVE = Ŏ (LATIN CAPITAL LETTER O WITH BREVE)
+    {0x0055, 0x0300, 0x00D9},  // U + COMBINING GRAVE ACCENT = Ù (LATIN CAPITAL LETTER U WITH GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0077, 0x0302, 0x0175},  // w + COMBINING CIRCUMFLEX ACCENT = ŵ (LATIN SMALL LETTER W WITH CIRCUMFLEX)
+    {0x00F8, 0x0301, 0x01FF},  // ø + COMBINING ACUTE ACCENT = ǿ (LATIN SMALL LETTER O WITH STROKE AND ACUTE)
+    {0x004B, 0x0301, 0x1E30},  // K + COMBINING ACUTE ACCENT = Ḱ (LATIN CAPITAL LETTER K WITH ACUTE)
+    {0x0416, 0x0306, 0x04C1},  // Ж + COMBINING BREVE = Ӂ (CYRILLIC CAPITAL LETTER ZHE WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x006F, 0x0303, 0x00F5},  // o + COMBINING TILDE = õ (LATIN SMALL LETTER O WITH TILDE)
+    {0x006E, 0x0307, 0x1E45},  // n + COMBINING DOT ABOVE = ṅ (LATIN SMALL LETTER N WITH DOT ABOVE)
+    {0x00E6, 0x0304, 0x01E3},  // æ + COMBINING MACRON = ǣ (LATIN SMALL LETTER AE WITH MACRON)
+    {0x004A, 0x0302, 0x0134},  // J + COMBINING CIRCUMFLEX ACCENT = Ĵ (LATIN CAPITAL LETTER J WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0069, 0x0301, 0x00ED},  // i + COMBINING ACUTE ACCENT = í (LATIN SMALL LETTER I WITH ACUTE)
+    {0x0045, 0x0303, 0x1EBC},  // E + COMBINING TILDE = Ẽ (LATIN CAPITAL LETTER E WITH TILDE)
+    {0x0073, 0x0326, 0x0219},  // s + COMBINING COMMA BELOW = ș (LATIN SMALL LETTER S WITH COMMA BELOW)
+    {0x0049, 0x0330, 0x1E2C},  // I + COMBINING TILDE BELOW = Ḭ (LATIN CAPITAL LETTER I WITH TILDE BELOW)
+    {0x0308, 0x0301, 0x0344},  // ̈ + COMBINING ACUTE ACCENT = ̈́ (COMBINING GREEK DIALYTIKA TONOS)
+    {0x00EA, 0x0301, 0x1EBF},  // ê + COMBINING ACUTE ACCENT = ế (LATIN SMALL LETTER E WITH CIRCUMFLEX AND ACUTE)
+    {0x00E5, 0x0301, 0x01FB},  // å + COMBINING ACUTE ACCENT = ǻ (LATIN SMALL LETTER A WITH RING ABOVE AND ACUTE)
+    {0x006F, 0x0300, 0x00F2},  // o + COMBINING GRAVE ACCENT = ò (LATIN SMALL LETTER O WITH GRAVE)
+    {0x0065, 0x0301, 0x00E9},  // e + COMBINING ACUTE ACCENT = é (LATIN SMALL LETTER E WITH ACUTE)
+    {0x0061, 0x0301, 0x00E1},  // a + COMBINING ACUTE ACCENT = á (LATIN SMALL LETTER A WITH ACUTE)
+    {0x0075, 0x0306, 0x016D},  // u + COMBINING BREVE = ŭ (LATIN SMALL LETTER U WITH BREVE)
+    {0x1F30, 0x0301, 0x1F34},  // ἰ + COMBINING ACUTE ACCENT = ἴ (GREEK SMALL LETTER IOTA WITH PSILI AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0068, 0x030C, 0x021F},  // h + COMBINING CARON = ȟ (LATIN SMALL LETTER H WITH CARON)
+    {0x0048, 0x0302, 0x0124},  // H + COMBINING CIRCUMFLEX ACCENT = Ĥ (LATIN CAPITAL LETTER H WITH CIRCUMFLEX)
     {0x1F22, 0x0345,
      0x1F92},  // ἢ + COMBINING GREEK YPOGEGRAMMENI = ᾒ (GREEK SMALL LETTER ETA WITH PSILI AND VARIA AND YPOGEGRAMMENI)
-    {0x1F23, 0x0345,
-     0x1F93},  // ἣ + COMBINING GREEK YPOGEGRAMMENI = ᾓ (GREEK SMALL LETTER ETA WITH DASIA AND VARIA AND YPOGEGRAMMENI)
-    {0x1F24, 0x0345,
-     0x1F94},  // ἤ + COMBINING GREEK YPOGEGRAMMENI = ᾔ (GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
-    {0x1F25, 0x0345,
-     0x1F95},  // ἥ + COMBINING GREEK YPOGEGRAMMENI = ᾕ (GREEK SMALL LETTER ETA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
-    {0x1F26, 0x0345, 0x1F96},  // ἦ + COMBINING GREEK YPOGEGRAMMENI = ᾖ (GREEK SMALL LETTER ETA WITH PSILI AND
-                               // PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1F27, 0x0345, 0x1F97},  // ἧ + COMBINING GREEK YPOGEGRAMMENI = ᾗ (GREEK SMALL LETTER ETA WITH DASIA AND
-                               // PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1F28, 0x0300, 0x1F2A},  // Ἠ + COMBINING GRAVE ACCENT = Ἢ (GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA)
-    {0x1F28, 0x0301, 0x1F2C},  // Ἠ + COMBINING ACUTE ACCENT = Ἤ (GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA)
-    {0x1F28, 0x0342,
-     0x1F2E},  // Ἠ + COMBINING GREEK PERISPOMENI = Ἦ (GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI)
-    {0x1F28, 0x0345,
-     0x1F98},  // Ἠ + COMBINING GREEK YPOGEGRAMMENI = ᾘ (GREEK CAPITAL LETTER ETA WITH PSILI AND PROSGEGRAMMENI)
-    {0x1F29, 0x0300, 0x1F2B},  // Ἡ + COMBINING GRAVE ACCENT = Ἣ (GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA)
-    {0x1F29, 0x0301, 0x1F2D},  // Ἡ + COMBINING ACUTE ACCENT = Ἥ (GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x004F, 0x0308, 0x00D6},  // O + COMBINING DIAERESIS = Ö (LATIN CAPITAL LETTER O WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x005A, 0x0302, 0x1E90},  // Z + COMBINING CIRCUMFLEX ACCENT = Ẑ (LATIN CAPITAL LETTER Z WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0054, 0x032D,
+     0x1E70},  // T + COMBINING CIRCUMFLEX ACCENT BELOW = Ṱ (LATIN CAPITAL LETTER T WITH CIRCUMFLEX BELOW)
+    {0x0079, 0x030A, 0x1E99},  // y + COMBINING RING ABOVE = ẙ (LATIN SMALL LETTER Y WITH RING ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0044, 0x032D,
+     0x1E12},  // D + COMBINING CIRCUMFLEX ACCENT BELOW = Ḓ (LATIN CAPITAL LETTER D WITH CIRCUMFLEX BELOW)
+    {0x0075, 0x0311, 0x0217},  // u + COMBINING INVERTED BREVE = ȗ (LATIN SMALL LETTER U WITH INVERTED BREVE)
+    {0x043A, 0x0301, 0x045C},  // к + COMBINING ACUTE ACCENT = ќ (CYRILLIC SMALL LETTER KJE)
+    {0x0065, 0x030C, 0x011B},  // e + COMBINING CARON = ě (LATIN SMALL LETTER E WITH CARON)
+    {0x0049, 0x0301, 0x00CD},  // I + COMBINING ACUTE ACCENT = Í (LATIN CAPITAL LETTER I WITH ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x006A, 0x0302, 0x0135},  // j + COMBINING CIRCUMFLEX ACCENT = ĵ (LATIN SMALL LETTER J WITH CIRCUMFLEX)
+    {0x1F50, 0x0342,
+     0x1F56},  // ὐ + COMBINING GREEK PERISPOMENI = ὖ (GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI)
+    {0x0075, 0x0304, 0x016B},  // u + COMBINING MACRON = ū (LATIN SMALL LETTER U WITH MACRON)
+    {0x0474, 0x030F,
+     0x0476},  // Ѵ + COMBINING DOUBLE GRAVE ACCENT = Ѷ (CYRILLIC CAPITAL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x00CF, 0x0301, 0x1E2E},  // Ï + COMBINING ACUTE ACCENT = Ḯ (LATIN CAPITAL LETTER I WITH DIAERESIS AND ACUTE)
+    {0x0061, 0x0306, 0x0103},  // a + COMBINING BREVE = ă (LATIN SMALL LETTER A WITH BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0041, 0x030F, 0x0200},  // A + COMBINING DOUBLE GRAVE ACCENT = Ȁ (LATIN CAPITAL LETTER A WITH DOUBLE GRAVE)
+    {0x0102, 0x0301, 0x1EAE},  // Ă + COMBINING ACUTE ACCENT = Ắ (LATIN CAPITAL LETTER A WITH BREVE AND ACUTE)
+    {0x0075, 0x0330, 0x1E75},  // u + COMBINING TILDE BELOW = ṵ (LATIN SMALL LETTER U WITH TILDE BELOW)
     {0x1F29, 0x0342,
      0x1F2F},  // Ἡ + COMBINING GREEK PERISPOMENI = Ἧ (GREEK CAPITAL LETTER ETA WITH DASIA AND PERISPOMENI)
-    {0x1F29, 0x0345,
-     0x1F99},  // Ἡ + COMBINING GREEK YPOGEGRAMMENI = ᾙ (GREEK CAPITAL LETTER ETA WITH DASIA AND PROSGEGRAMMENI)
-    {0x1F2A, 0x0345, 0x1F9A},  // Ἢ + COMBINING GREEK YPOGEGRAMMENI = ᾚ (GREEK CAPITAL LETTER ETA WITH PSILI AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F2B, 0x0345, 0x1F9B},  // Ἣ + COMBINING GREEK YPOGEGRAMMENI = ᾛ (GREEK CAPITAL LETTER ETA WITH DASIA AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F2C, 0x0345, 0x1F9C},  // Ἤ + COMBINING GREEK YPOGEGRAMMENI = ᾜ (GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA
-                               // AND PROSGEGRAMMENI)
+    {0x03A5, 0x0304, 0x1FE9},  // Υ + COMBINING MACRON = Ῡ (GREEK CAPITAL LETTER UPSILON WITH MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x0075, 0x030B, 0x0171},  // u + COMBINING DOUBLE ACUTE ACCENT = ű (LATIN SMALL LETTER U WITH DOUBLE ACUTE)
+    {0x0054, 0x0323, 0x1E6C},  // T + COMBINING DOT BELOW = Ṭ (LATIN CAPITAL LETTER T WITH DOT BELOW)
+    {0x006C, 0x030C, 0x013E},  // l + COMBINING CARON = ľ (LATIN SMALL LETTER L WITH CARON)
+    {0x03C5, 0x0301, 0x03CD},  // υ + COMBINING ACUTE ACCENT = ύ (GREEK SMALL LETTER UPSILON WITH TONOS)
+    {0x0423, 0x0308, 0x04F0},  // У + COMBINING DIAERESIS = Ӱ (CYRILLIC CAPITAL LETTER U WITH DIAERESIS)
+    {0x0049, 0x0323, 0x1ECA},  // I + COMBINING DOT BELOW = Ị (LATIN CAPITAL LETTER I WITH DOT BELOW)
+    {0x0063, 0x0327, 0x00E7},  // c + COMBINING CEDILLA = ç (LATIN SMALL LETTER C WITH CEDILLA)
+    {0x004F, 0x0311, 0x020E},  // O + COMBINING INVERTED BREVE = Ȏ (LATIN CAPITAL LETTER O WITH INVERTED BREVE)
+    {0x03B7, 0x0300, 0x1F74},  // η + COMBINING GRAVE ACCENT = ὴ (GREEK SMALL LETTER ETA WITH VARIA)
+    {0x0070, 0x0301, 0x1E55},  // p + COMBINING ACUTE ACCENT = ṕ (LATIN SMALL LETTER P WITH ACUTE)
+    {0x0041, 0x0309, 0x1EA2},  // A + COMBINING HOOK ABOVE = Ả (LATIN CAPITAL LETTER A WITH HOOK ABOVE)
+    {0x0062, 0x0323, 0x1E05},  // b + COMBINING DOT BELOW = ḅ (LATIN SMALL LETTER B WITH DOT BELOW)
+    {0x0168, 0x0301, 0x1E78},  // Ũ + COMBINING ACUTE ACCENT = Ṹ (LATIN CAPITAL LETTER U WITH TILDE AND ACUTE)
+    {0x0045, 0x0307, 0x0116},  // E + COMBINING DOT ABOVE = Ė (LATIN CAPITAL LETTER E WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0391, 0x0313, 0x1F08},  // Α + COMBINING COMMA ABOVE = Ἀ (GREEK CAPITAL LETTER ALPHA WITH PSILI)
+    {0x005A, 0x0331, 0x1E94},  // Z + COMBINING MACRON BELOW = Ẕ (LATIN CAPITAL LETTER Z WITH LINE BELOW)
+    {0x0227, 0x0304, 0x01E1},  // ȧ + COMBINING MACRON = ǡ (LATIN SMALL LETTER A WITH DOT ABOVE AND MACRON)
+    {0x0053, 0x0327, 0x015E},  // S + COMBINING CEDILLA = Ş (LATIN CAPITAL LETTER S WITH CEDILLA)
+    {0x1F41, 0x0300, 0x1F43},  // ὁ + COMBINING GRAVE ACCENT = ὃ (GREEK SMALL LETTER OMICRON WITH DASIA AND VARIA)
+    {0x0047, 0x0302, 0x011C},  // G + COMBINING CIRCUMFLEX ACCENT = Ĝ (LATIN CAPITAL LETTER G WITH CIRCUMFLEX)
+    {0x03C9, 0x0314, 0x1F61},  // ω + COMBINING REVERSED COMMA ABOVE = ὡ (GREEK SMALL LETTER OMEGA WITH DASIA)
+    {0x03B7, 0x0301, 0x03AE},  // η + COMBINING ACUTE ACCENT = ή (GREEK SMALL LETTER ETA WITH TONOS)
+    {0x03CB, 0x0300, 0x1FE2},  // ϋ + COMBINING GRAVE ACCENT = ῢ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0053, 0x0307, 0x1E60},  // S + COMBINING DOT ABOVE = Ṡ (LATIN CAPITAL LETTER S WITH DOT ABOVE)
+    {0x0064, 0x0327, 0x1E11},  // d + COMBINING CEDILLA = ḑ (LATIN SMALL LETTER D WITH CEDILLA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0057, 0x0323, 0x1E88},  // W + COMBINING DOT BELOW = Ẉ (LATIN CAPITAL LETTER W WITH DOT BELOW)
+    {0x0044, 0x0331, 0x1E0E},  // D + COMBINING MACRON BELOW = Ḏ (LATIN CAPITAL LETTER D WITH LINE BELOW)
+    {0x0065, 0x0304, 0x0113},  // e + COMBINING MACRON = ē (LATIN SMALL LETTER E WITH MACRON)
+    {0x03B1, 0x0304, 0x1FB1},  // α + COMBINING MACRON = ᾱ (GREEK SMALL LETTER ALPHA WITH MACRON)
+    {0x0436, 0x0308, 0x04DD},  // ж + COMBINING DIAERESIS = ӝ (CYRILLIC SMALL LETTER ZHE WITH DIAERESIS)
+    {0x0068, 0x0307, 0x1E23},  // h + COMBINING DOT ABOVE = ḣ (LATIN SMALL LETTER H WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F06, 0x0345, 0x1F86},  // ἆ + COMBINING GREEK YPOGEGRAMMENI = ᾆ (GREEK SMALL LETTER ALPHA WITH PSILI AND
+                               // PERISPOMENI AND YPOGEGRAMMENI)
+    {0x0055, 0x0303, 0x0168},  // U + COMBINING TILDE = Ũ (LATIN CAPITAL LETTER U WITH TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F70, 0x0345,
+     0x1FB2},  // ὰ + COMBINING GREEK YPOGEGRAMMENI = ᾲ (GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x03CA, 0x0342,
+     0x1FD7},  // ϊ + COMBINING GREEK PERISPOMENI = ῗ (GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0044, 0x0327, 0x1E10},  // D + COMBINING CEDILLA = Ḑ (LATIN CAPITAL LETTER D WITH CEDILLA)
+    {0x0074, 0x0308, 0x1E97},  // t + COMBINING DIAERESIS = ẗ (LATIN SMALL LETTER T WITH DIAERESIS)
+    {0x0443, 0x0306, 0x045E},  // у + COMBINING BREVE = ў (CYRILLIC SMALL LETTER SHORT U)
+    {0x01A0, 0x0323, 0x1EE2},  // Ơ + COMBINING DOT BELOW = Ợ (LATIN CAPITAL LETTER O WITH HORN AND DOT BELOW)
+    {0x0041, 0x0325, 0x1E00},  // A + COMBINING RING BELOW = Ḁ (LATIN CAPITAL LETTER A WITH RING BELOW)
+    {0x0065, 0x0309, 0x1EBB},  // e + COMBINING HOOK ABOVE = ẻ (LATIN SMALL LETTER E WITH HOOK ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x03B9, 0x0308, 0x03CA},  // ι + COMBINING DIAERESIS = ϊ (GREEK SMALL LETTER IOTA WITH DIALYTIKA)
+    {0x0063, 0x030C, 0x010D},  // c + COMBINING CARON = č (LATIN SMALL LETTER C WITH CARON)
+    {0x006B, 0x0331, 0x1E35},  // k + COMBINING MACRON BELOW = ḵ (LATIN SMALL LETTER K WITH LINE BELOW)
+    {0x0047, 0x0301, 0x01F4},  // G + COMBINING ACUTE ACCENT = Ǵ (LATIN CAPITAL LETTER G WITH ACUTE)
+    {0x0075, 0x031B, 0x01B0},  // u + COMBINING HORN = ư (LATIN SMALL LETTER U WITH HORN)
+    {0x0000, 0x0000, 0x0000},
+    {0x0066, 0x0307, 0x1E1F},  // f + COMBINING DOT ABOVE = ḟ (LATIN SMALL LETTER F WITH DOT ABOVE)
+    {0x00C2, 0x0301, 0x1EA4},  // Â + COMBINING ACUTE ACCENT = Ấ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND ACUTE)
+    {0x004F, 0x0304, 0x014C},  // O + COMBINING MACRON = Ō (LATIN CAPITAL LETTER O WITH MACRON)
+    {0x0041, 0x0328, 0x0104},  // A + COMBINING OGONEK = Ą (LATIN CAPITAL LETTER A WITH OGONEK)
+    {0x0000, 0x0000, 0x0000},
+    {0x0045, 0x0302, 0x00CA},  // E + COMBINING CIRCUMFLEX ACCENT = Ê (LATIN CAPITAL LETTER E WITH CIRCUMFLEX)
+    {0x00E2, 0x0301, 0x1EA5},  // â + COMBINING ACUTE ACCENT = ấ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND ACUTE)
     {0x1F2D, 0x0345, 0x1F9D},  // Ἥ + COMBINING GREEK YPOGEGRAMMENI = ᾝ (GREEK CAPITAL LETTER ETA WITH DASIA AND OXIA
                                // AND PROSGEGRAMMENI)
+    {0x0052, 0x0301, 0x0154},  // R + COMBINING ACUTE ACCENT = Ŕ (LATIN CAPITAL LETTER R WITH ACUTE)
+    {0x1EA0, 0x0302,
+     0x1EAC},  // Ạ + COMBINING CIRCUMFLEX ACCENT = Ậ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND DOT BELOW)
+    {0x0045, 0x0304, 0x0112},  // E + COMBINING MACRON = Ē (LATIN CAPITAL LETTER E WITH MACRON)
+    {0x016A, 0x0308, 0x1E7A},  // Ū + COMBINING DIAERESIS = Ṻ (LATIN CAPITAL LETTER U WITH MACRON AND DIAERESIS)
+    {0x1F31, 0x0301, 0x1F35},  // ἱ + COMBINING ACUTE ACCENT = ἵ (GREEK SMALL LETTER IOTA WITH DASIA AND OXIA)
+    {0x0045, 0x0306, 0x0114},  // E + COMBINING BREVE = Ĕ (LATIN CAPITAL LETTER E WITH BREVE)
+    {0x03C1, 0x0314, 0x1FE5},  // ρ + COMBINING REVERSED COMMA ABOVE = ῥ (GREEK SMALL LETTER RHO WITH DASIA)
+    {0x0065, 0x0302, 0x00EA},  // e + COMBINING CIRCUMFLEX ACCENT = ê (LATIN SMALL LETTER E WITH CIRCUMFLEX)
+    {0x0059, 0x0323, 0x1EF4},  // Y + COMBINING DOT BELOW = Ỵ (LATIN CAPITAL LETTER Y WITH DOT BELOW)
+    {0x00C6, 0x0301, 0x01FC},  // Æ + COMBINING ACUTE ACCENT = Ǽ (LATIN CAPITAL LETTER AE WITH ACUTE)
+    {0x006E, 0x0303, 0x00F1},  // n + COMBINING TILDE = ñ (LATIN SMALL LETTER N WITH TILDE)
+    {0x1F20, 0x0345,
+     0x1F90},  // ἠ + COMBINING GREEK YPOGEGRAMMENI = ᾐ (GREEK SMALL LETTER ETA WITH PSILI AND YPOGEGRAMMENI)
+    {0x03AE, 0x0345,
+     0x1FC4},  // ή + COMBINING GREEK YPOGEGRAMMENI = ῄ (GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI)
+    {0x03A5, 0x0308, 0x03AB},  // Υ + COMBINING DIAERESIS = Ϋ (GREEK CAPITAL LETTER UPSILON WITH DIALYTIKA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0059, 0x0309, 0x1EF6},  // Y + COMBINING HOOK ABOVE = Ỷ (LATIN CAPITAL LETTER Y WITH HOOK ABOVE)
     {0x1F2E, 0x0345, 0x1F9E},  // Ἦ + COMBINING GREEK YPOGEGRAMMENI = ᾞ (GREEK CAPITAL LETTER ETA WITH PSILI AND
                                // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F2F, 0x0345, 0x1F9F},  // Ἧ + COMBINING GREEK YPOGEGRAMMENI = ᾟ (GREEK CAPITAL LETTER ETA WITH DASIA AND
-                               // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F30, 0x0300, 0x1F32},  // ἰ + COMBINING GRAVE ACCENT = ἲ (GREEK SMALL LETTER IOTA WITH PSILI AND VARIA)
-    {0x1F30, 0x0301, 0x1F34},  // ἰ + COMBINING ACUTE ACCENT = ἴ (GREEK SMALL LETTER IOTA WITH PSILI AND OXIA)
-    {0x1F30, 0x0342,
-     0x1F36},  // ἰ + COMBINING GREEK PERISPOMENI = ἶ (GREEK SMALL LETTER IOTA WITH PSILI AND PERISPOMENI)
-    {0x1F31, 0x0300, 0x1F33},  // ἱ + COMBINING GRAVE ACCENT = ἳ (GREEK SMALL LETTER IOTA WITH DASIA AND VARIA)
-    {0x1F31, 0x0301, 0x1F35},  // ἱ + COMBINING ACUTE ACCENT = ἵ (GREEK SMALL LETTER IOTA WITH DASIA AND OXIA)
-    {0x1F31, 0x0342,
-     0x1F37},  // ἱ + COMBINING GREEK PERISPOMENI = ἷ (GREEK SMALL LETTER IOTA WITH DASIA AND PERISPOMENI)
-    {0x1F38, 0x0300, 0x1F3A},  // Ἰ + COMBINING GRAVE ACCENT = Ἲ (GREEK CAPITAL LETTER IOTA WITH PSILI AND VARIA)
+    {0x1F6D, 0x0345, 0x1FAD},  // Ὥ + COMBINING GREEK YPOGEGRAMMENI = ᾭ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA
+                               // AND PROSGEGRAMMENI)
+    {0x0064, 0x030C, 0x010F},  // d + COMBINING CARON = ď (LATIN SMALL LETTER D WITH CARON)
+    {0x1F28, 0x0301, 0x1F2C},  // Ἠ + COMBINING ACUTE ACCENT = Ἤ (GREEK CAPITAL LETTER ETA WITH PSILI AND OXIA)
+    {0x0045, 0x032D,
+     0x1E18},  // E + COMBINING CIRCUMFLEX ACCENT BELOW = Ḙ (LATIN CAPITAL LETTER E WITH CIRCUMFLEX BELOW)
+    {0x007A, 0x0301, 0x017A},  // z + COMBINING ACUTE ACCENT = ź (LATIN SMALL LETTER Z WITH ACUTE)
+    {0x03B1, 0x0300, 0x1F70},  // α + COMBINING GRAVE ACCENT = ὰ (GREEK SMALL LETTER ALPHA WITH VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F03, 0x0345, 0x1F83},  // ἃ + COMBINING GREEK YPOGEGRAMMENI = ᾃ (GREEK SMALL LETTER ALPHA WITH DASIA AND VARIA
+                               // AND YPOGEGRAMMENI)
+    {0x0048, 0x0308, 0x1E26},  // H + COMBINING DIAERESIS = Ḧ (LATIN CAPITAL LETTER H WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0169, 0x0301, 0x1E79},  // ũ + COMBINING ACUTE ACCENT = ṹ (LATIN SMALL LETTER U WITH TILDE AND ACUTE)
+    {0x00C2, 0x0303, 0x1EAA},  // Â + COMBINING TILDE = Ẫ (LATIN CAPITAL LETTER A WITH CIRCUMFLEX AND TILDE)
+    {0x03B9, 0x0342, 0x1FD6},  // ι + COMBINING GREEK PERISPOMENI = ῖ (GREEK SMALL LETTER IOTA WITH PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1ECD, 0x0302,
+     0x1ED9},  // ọ + COMBINING CIRCUMFLEX ACCENT = ộ (LATIN SMALL LETTER O WITH CIRCUMFLEX AND DOT BELOW)
+    {0x1F18, 0x0301, 0x1F1C},  // Ἐ + COMBINING ACUTE ACCENT = Ἔ (GREEK CAPITAL LETTER EPSILON WITH PSILI AND OXIA)
+    {0x03B1, 0x0314, 0x1F01},  // α + COMBINING REVERSED COMMA ABOVE = ἁ (GREEK SMALL LETTER ALPHA WITH DASIA)
+    {0x006E, 0x0300, 0x01F9},  // n + COMBINING GRAVE ACCENT = ǹ (LATIN SMALL LETTER N WITH GRAVE)
+    {0x03B1, 0x0342, 0x1FB6},  // α + COMBINING GREEK PERISPOMENI = ᾶ (GREEK SMALL LETTER ALPHA WITH PERISPOMENI)
+    {0x1F69, 0x0342,
+     0x1F6F},  // Ὡ + COMBINING GREEK PERISPOMENI = Ὧ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI)
+    {0x0079, 0x0323, 0x1EF5},  // y + COMBINING DOT BELOW = ỵ (LATIN SMALL LETTER Y WITH DOT BELOW)
+    {0x004D, 0x0323, 0x1E42},  // M + COMBINING DOT BELOW = Ṃ (LATIN CAPITAL LETTER M WITH DOT BELOW)
+    {0x1F49, 0x0300, 0x1F4B},  // Ὁ + COMBINING GRAVE ACCENT = Ὃ (GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0075, 0x030C, 0x01D4},  // u + COMBINING CARON = ǔ (LATIN SMALL LETTER U WITH CARON)
+    {0x006C, 0x0331, 0x1E3B},  // l + COMBINING MACRON BELOW = ḻ (LATIN SMALL LETTER L WITH LINE BELOW)
+    {0x00DC, 0x0304, 0x01D5},  // Ü + COMBINING MACRON = Ǖ (LATIN CAPITAL LETTER U WITH DIAERESIS AND MACRON)
+    {0x0065, 0x0307, 0x0117},  // e + COMBINING DOT ABOVE = ė (LATIN SMALL LETTER E WITH DOT ABOVE)
+    {0x0069, 0x0308, 0x00EF},  // i + COMBINING DIAERESIS = ï (LATIN SMALL LETTER I WITH DIAERESIS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0042, 0x0307, 0x1E02},  // B + COMBINING DOT ABOVE = Ḃ (LATIN CAPITAL LETTER B WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0069, 0x0304, 0x012B},  // i + COMBINING MACRON = ī (LATIN SMALL LETTER I WITH MACRON)
+    {0x1FF6, 0x0345,
+     0x1FF7},  // ῶ + COMBINING GREEK YPOGEGRAMMENI = ῷ (GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI)
+    {0x0047, 0x0306, 0x011E},  // G + COMBINING BREVE = Ğ (LATIN CAPITAL LETTER G WITH BREVE)
+    {0x00FC, 0x030C, 0x01DA},  // ü + COMBINING CARON = ǚ (LATIN SMALL LETTER U WITH DIAERESIS AND CARON)
+    {0x0055, 0x0323, 0x1EE4},  // U + COMBINING DOT BELOW = Ụ (LATIN CAPITAL LETTER U WITH DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x0475, 0x030F,
+     0x0477},  // ѵ + COMBINING DOUBLE GRAVE ACCENT = ѷ (CYRILLIC SMALL LETTER IZHITSA WITH DOUBLE GRAVE ACCENT)
+    {0x0064, 0x0307, 0x1E0B},  // d + COMBINING DOT ABOVE = ḋ (LATIN SMALL LETTER D WITH DOT ABOVE)
+    {0x006A, 0x030C, 0x01F0},  // j + COMBINING CARON = ǰ (LATIN SMALL LETTER J WITH CARON)
+    {0x1E37, 0x0304, 0x1E39},  // ḷ + COMBINING MACRON = ḹ (LATIN SMALL LETTER L WITH DOT BELOW AND MACRON)
+    {0x04D8, 0x0308, 0x04DA},  // Ә + COMBINING DIAERESIS = Ӛ (CYRILLIC CAPITAL LETTER SCHWA WITH DIAERESIS)
+    {0x0395, 0x0314, 0x1F19},  // Ε + COMBINING REVERSED COMMA ABOVE = Ἑ (GREEK CAPITAL LETTER EPSILON WITH DASIA)
+    {0x0065, 0x0330, 0x1E1B},  // e + COMBINING TILDE BELOW = ḛ (LATIN SMALL LETTER E WITH TILDE BELOW)
+    {0x0391, 0x0304, 0x1FB9},  // Α + COMBINING MACRON = Ᾱ (GREEK CAPITAL LETTER ALPHA WITH MACRON)
     {0x1F38, 0x0301, 0x1F3C},  // Ἰ + COMBINING ACUTE ACCENT = Ἴ (GREEK CAPITAL LETTER IOTA WITH PSILI AND OXIA)
     {0x1F38, 0x0342,
      0x1F3E},  // Ἰ + COMBINING GREEK PERISPOMENI = Ἶ (GREEK CAPITAL LETTER IOTA WITH PSILI AND PERISPOMENI)
-    {0x1F39, 0x0300, 0x1F3B},  // Ἱ + COMBINING GRAVE ACCENT = Ἳ (GREEK CAPITAL LETTER IOTA WITH DASIA AND VARIA)
-    {0x1F39, 0x0301, 0x1F3D},  // Ἱ + COMBINING ACUTE ACCENT = Ἵ (GREEK CAPITAL LETTER IOTA WITH DASIA AND OXIA)
-    {0x1F39, 0x0342,
-     0x1F3F},  // Ἱ + COMBINING GREEK PERISPOMENI = Ἷ (GREEK CAPITAL LETTER IOTA WITH DASIA AND PERISPOMENI)
-    {0x1F40, 0x0300, 0x1F42},  // ὀ + COMBINING GRAVE ACCENT = ὂ (GREEK SMALL LETTER OMICRON WITH PSILI AND VARIA)
-    {0x1F40, 0x0301, 0x1F44},  // ὀ + COMBINING ACUTE ACCENT = ὄ (GREEK SMALL LETTER OMICRON WITH PSILI AND OXIA)
-    {0x1F41, 0x0300, 0x1F43},  // ὁ + COMBINING GRAVE ACCENT = ὃ (GREEK SMALL LETTER OMICRON WITH DASIA AND VARIA)
+    {0x1F74, 0x0345,
+     0x1FC2},  // ὴ + COMBINING GREEK YPOGEGRAMMENI = ῂ (GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI)
+    {0x0055, 0x030F, 0x0214},  // U + COMBINING DOUBLE GRAVE ACCENT = Ȕ (LATIN CAPITAL LETTER U WITH DOUBLE GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x00FC, 0x0304, 0x01D6},  // ü + COMBINING MACRON = ǖ (LATIN SMALL LETTER U WITH DIAERESIS AND MACRON)
+    {0x017F, 0x0307, 0x1E9B},  // ſ + COMBINING DOT ABOVE = ẛ (LATIN SMALL LETTER LONG S WITH DOT ABOVE)
+    {0x0045, 0x0308, 0x00CB},  // E + COMBINING DIAERESIS = Ë (LATIN CAPITAL LETTER E WITH DIAERESIS)
+    {0x0049, 0x0309, 0x1EC8},  // I + COMBINING HOOK ABOVE = Ỉ (LATIN CAPITAL LETTER I WITH HOOK ABOVE)
     {0x1F41, 0x0301, 0x1F45},  // ὁ + COMBINING ACUTE ACCENT = ὅ (GREEK SMALL LETTER OMICRON WITH DASIA AND OXIA)
-    {0x1F48, 0x0300, 0x1F4A},  // Ὀ + COMBINING GRAVE ACCENT = Ὂ (GREEK CAPITAL LETTER OMICRON WITH PSILI AND VARIA)
-    {0x1F48, 0x0301, 0x1F4C},  // Ὀ + COMBINING ACUTE ACCENT = Ὄ (GREEK CAPITAL LETTER OMICRON WITH PSILI AND OXIA)
-    {0x1F49, 0x0300, 0x1F4B},  // Ὁ + COMBINING GRAVE ACCENT = Ὃ (GREEK CAPITAL LETTER OMICRON WITH DASIA AND VARIA)
-    {0x1F49, 0x0301, 0x1F4D},  // Ὁ + COMBINING ACUTE ACCENT = Ὅ (GREEK CAPITAL LETTER OMICRON WITH DASIA AND OXIA)
-    {0x1F50, 0x0300, 0x1F52},  // ὐ + COMBINING GRAVE ACCENT = ὒ (GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA)
-    {0x1F50, 0x0301, 0x1F54},  // ὐ + COMBINING ACUTE ACCENT = ὔ (GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA)
-    {0x1F50, 0x0342,
-     0x1F56},  // ὐ + COMBINING GREEK PERISPOMENI = ὖ (GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI)
-    {0x1F51, 0x0300, 0x1F53},  // ὑ + COMBINING GRAVE ACCENT = ὓ (GREEK SMALL LETTER UPSILON WITH DASIA AND VARIA)
-    {0x1F51, 0x0301, 0x1F55},  // ὑ + COMBINING ACUTE ACCENT = ὕ (GREEK SMALL LETTER UPSILON WITH DASIA AND OXIA)
-    {0x1F51, 0x0342,
-     0x1F57},  // ὑ + COMBINING GREEK PERISPOMENI = ὗ (GREEK SMALL LETTER UPSILON WITH DASIA AND PERISPOMENI)
-    {0x1F59, 0x0300, 0x1F5B},  // Ὑ + COMBINING GRAVE ACCENT = Ὓ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND VARIA)
-    {0x1F59, 0x0301, 0x1F5D},  // Ὑ + COMBINING ACUTE ACCENT = Ὕ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND OXIA)
-    {0x1F59, 0x0342,
-     0x1F5F},  // Ὑ + COMBINING GREEK PERISPOMENI = Ὗ (GREEK CAPITAL LETTER UPSILON WITH DASIA AND PERISPOMENI)
-    {0x1F60, 0x0300, 0x1F62},  // ὠ + COMBINING GRAVE ACCENT = ὢ (GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F08, 0x0301, 0x1F0C},  // Ἀ + COMBINING ACUTE ACCENT = Ἄ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND OXIA)
+    {0x0065, 0x0328, 0x0119},  // e + COMBINING OGONEK = ę (LATIN SMALL LETTER E WITH OGONEK)
+    {0x00C7, 0x0301, 0x1E08},  // Ç + COMBINING ACUTE ACCENT = Ḉ (LATIN CAPITAL LETTER C WITH CEDILLA AND ACUTE)
+    {0x0000, 0x0000, 0x0000},
+    {0x014D, 0x0301, 0x1E53},  // ō + COMBINING ACUTE ACCENT = ṓ (LATIN SMALL LETTER O WITH MACRON AND ACUTE)
+    {0x01A0, 0x0303, 0x1EE0},  // Ơ + COMBINING TILDE = Ỡ (LATIN CAPITAL LETTER O WITH HORN AND TILDE)
+    {0x0000, 0x0000, 0x0000},
+    {0x0062, 0x0307, 0x1E03},  // b + COMBINING DOT ABOVE = ḃ (LATIN SMALL LETTER B WITH DOT ABOVE)
+    {0x1FFE, 0x0300, 0x1FDD},  // ῾ + COMBINING GRAVE ACCENT = ῝ (GREEK DASIA AND VARIA)
+    {0x0395, 0x0300, 0x1FC8},  // Ε + COMBINING GRAVE ACCENT = Ὲ (GREEK CAPITAL LETTER EPSILON WITH VARIA)
+    {0x1F69, 0x0301, 0x1F6D},  // Ὡ + COMBINING ACUTE ACCENT = Ὥ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0417, 0x0308, 0x04DE},  // З + COMBINING DIAERESIS = Ӟ (CYRILLIC CAPITAL LETTER ZE WITH DIAERESIS)
+    {0x1F68, 0x0300, 0x1F6A},  // Ὠ + COMBINING GRAVE ACCENT = Ὢ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA)
+    {0x1F28, 0x0342,
+     0x1F2E},  // Ἠ + COMBINING GREEK PERISPOMENI = Ἦ (GREEK CAPITAL LETTER ETA WITH PSILI AND PERISPOMENI)
+    {0x0075, 0x0328, 0x0173},  // u + COMBINING OGONEK = ų (LATIN SMALL LETTER U WITH OGONEK)
     {0x1F60, 0x0301, 0x1F64},  // ὠ + COMBINING ACUTE ACCENT = ὤ (GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA)
-    {0x1F60, 0x0342,
-     0x1F66},  // ὠ + COMBINING GREEK PERISPOMENI = ὦ (GREEK SMALL LETTER OMEGA WITH PSILI AND PERISPOMENI)
-    {0x1F60, 0x0345,
-     0x1FA0},  // ὠ + COMBINING GREEK YPOGEGRAMMENI = ᾠ (GREEK SMALL LETTER OMEGA WITH PSILI AND YPOGEGRAMMENI)
-    {0x1F61, 0x0300, 0x1F63},  // ὡ + COMBINING GRAVE ACCENT = ὣ (GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA)
-    {0x1F61, 0x0301, 0x1F65},  // ὡ + COMBINING ACUTE ACCENT = ὥ (GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA)
-    {0x1F61, 0x0342,
-     0x1F67},  // ὡ + COMBINING GREEK PERISPOMENI = ὧ (GREEK SMALL LETTER OMEGA WITH DASIA AND PERISPOMENI)
-    {0x1F61, 0x0345,
-     0x1FA1},  // ὡ + COMBINING GREEK YPOGEGRAMMENI = ᾡ (GREEK SMALL LETTER OMEGA WITH DASIA AND YPOGEGRAMMENI)
-    {0x1F62, 0x0345, 0x1FA2},  // ὢ + COMBINING GREEK YPOGEGRAMMENI = ᾢ (GREEK SMALL LETTER OMEGA WITH PSILI AND VARIA
-                               // AND YPOGEGRAMMENI)
-    {0x1F63, 0x0345, 0x1FA3},  // ὣ + COMBINING GREEK YPOGEGRAMMENI = ᾣ (GREEK SMALL LETTER OMEGA WITH DASIA AND VARIA
-                               // AND YPOGEGRAMMENI)
-    {0x1F64, 0x0345,
-     0x1FA4},  // ὤ + COMBINING GREEK YPOGEGRAMMENI = ᾤ (GREEK SMALL LETTER OMEGA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
-    {0x1F65, 0x0345,
-     0x1FA5},  // ὥ + COMBINING GREEK YPOGEGRAMMENI = ᾥ (GREEK SMALL LETTER OMEGA WITH DASIA AND OXIA AND YPOGEGRAMMENI)
-    {0x1F66, 0x0345, 0x1FA6},  // ὦ + COMBINING GREEK YPOGEGRAMMENI = ᾦ (GREEK SMALL LETTER OMEGA WITH PSILI AND
-                               // PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1F67, 0x0345, 0x1FA7},  // ὧ + COMBINING GREEK YPOGEGRAMMENI = ᾧ (GREEK SMALL LETTER OMEGA WITH DASIA AND
+    {0x0418, 0x0308, 0x04E4},  // И + COMBINING DIAERESIS = Ӥ (CYRILLIC CAPITAL LETTER I WITH DIAERESIS)
+    {0x0075, 0x0302, 0x00FB},  // u + COMBINING CIRCUMFLEX ACCENT = û (LATIN SMALL LETTER U WITH CIRCUMFLEX)
+    {0x1F51, 0x0301, 0x1F55},  // ὑ + COMBINING ACUTE ACCENT = ὕ (GREEK SMALL LETTER UPSILON WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x1F27, 0x0345, 0x1F97},  // ἧ + COMBINING GREEK YPOGEGRAMMENI = ᾗ (GREEK SMALL LETTER ETA WITH DASIA AND
                                // PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1F68, 0x0300, 0x1F6A},  // Ὠ + COMBINING GRAVE ACCENT = Ὢ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA)
-    {0x1F68, 0x0301, 0x1F6C},  // Ὠ + COMBINING ACUTE ACCENT = Ὤ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA)
-    {0x1F68, 0x0342,
-     0x1F6E},  // Ὠ + COMBINING GREEK PERISPOMENI = Ὦ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND PERISPOMENI)
-    {0x1F68, 0x0345,
-     0x1FA8},  // Ὠ + COMBINING GREEK YPOGEGRAMMENI = ᾨ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND PROSGEGRAMMENI)
-    {0x1F69, 0x0300, 0x1F6B},  // Ὡ + COMBINING GRAVE ACCENT = Ὣ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA)
-    {0x1F69, 0x0301, 0x1F6D},  // Ὡ + COMBINING ACUTE ACCENT = Ὥ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA)
-    {0x1F69, 0x0342,
-     0x1F6F},  // Ὡ + COMBINING GREEK PERISPOMENI = Ὧ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND PERISPOMENI)
-    {0x1F69, 0x0345,
-     0x1FA9},  // Ὡ + COMBINING GREEK YPOGEGRAMMENI = ᾩ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND PROSGEGRAMMENI)
-    {0x1F6A, 0x0345, 0x1FAA},  // Ὢ + COMBINING GREEK YPOGEGRAMMENI = ᾪ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F6B, 0x0345, 0x1FAB},  // Ὣ + COMBINING GREEK YPOGEGRAMMENI = ᾫ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND VARIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F6C, 0x0345, 0x1FAC},  // Ὤ + COMBINING GREEK YPOGEGRAMMENI = ᾬ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND OXIA
-                               // AND PROSGEGRAMMENI)
-    {0x1F6D, 0x0345, 0x1FAD},  // Ὥ + COMBINING GREEK YPOGEGRAMMENI = ᾭ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND OXIA
-                               // AND PROSGEGRAMMENI)
+    {0x0391, 0x0345, 0x1FBC},  // Α + COMBINING GREEK YPOGEGRAMMENI = ᾼ (GREEK CAPITAL LETTER ALPHA WITH PROSGEGRAMMENI)
+    {0x0053, 0x0302, 0x015C},  // S + COMBINING CIRCUMFLEX ACCENT = Ŝ (LATIN CAPITAL LETTER S WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0397, 0x0345, 0x1FCC},  // Η + COMBINING GREEK YPOGEGRAMMENI = ῌ (GREEK CAPITAL LETTER ETA WITH PROSGEGRAMMENI)
+    {0x03C9, 0x0313, 0x1F60},  // ω + COMBINING COMMA ABOVE = ὠ (GREEK SMALL LETTER OMEGA WITH PSILI)
+    {0x0000, 0x0000, 0x0000},
+    {0x016B, 0x0308, 0x1E7B},  // ū + COMBINING DIAERESIS = ṻ (LATIN SMALL LETTER U WITH MACRON AND DIAERESIS)
+    {0x0075, 0x032D, 0x1E77},  // u + COMBINING CIRCUMFLEX ACCENT BELOW = ṷ (LATIN SMALL LETTER U WITH CIRCUMFLEX BELOW)
+    {0x0057, 0x0308, 0x1E84},  // W + COMBINING DIAERESIS = Ẅ (LATIN CAPITAL LETTER W WITH DIAERESIS)
+    {0x1F01, 0x0301, 0x1F05},  // ἁ + COMBINING ACUTE ACCENT = ἅ (GREEK SMALL LETTER ALPHA WITH DASIA AND OXIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x043E, 0x0308, 0x04E7},  // о + COMBINING DIAERESIS = ӧ (CYRILLIC SMALL LETTER O WITH DIAERESIS)
+    {0x00E2, 0x0309, 0x1EA9},  // â + COMBINING HOOK ABOVE = ẩ (LATIN SMALL LETTER A WITH CIRCUMFLEX AND HOOK ABOVE)
+    {0x1F19, 0x0300, 0x1F1B},  // Ἑ + COMBINING GRAVE ACCENT = Ἓ (GREEK CAPITAL LETTER EPSILON WITH DASIA AND VARIA)
+    {0x0397, 0x0300, 0x1FCA},  // Η + COMBINING GRAVE ACCENT = Ὴ (GREEK CAPITAL LETTER ETA WITH VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0069, 0x030C, 0x01D0},  // i + COMBINING CARON = ǐ (LATIN SMALL LETTER I WITH CARON)
+    {0x0410, 0x0308, 0x04D2},  // А + COMBINING DIAERESIS = Ӓ (CYRILLIC CAPITAL LETTER A WITH DIAERESIS)
+    {0x03C5, 0x0304, 0x1FE1},  // υ + COMBINING MACRON = ῡ (GREEK SMALL LETTER UPSILON WITH MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x01B0, 0x0323, 0x1EF1},  // ư + COMBINING DOT BELOW = ự (LATIN SMALL LETTER U WITH HORN AND DOT BELOW)
+    {0x0072, 0x0311, 0x0213},  // r + COMBINING INVERTED BREVE = ȓ (LATIN SMALL LETTER R WITH INVERTED BREVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x00F6, 0x0304, 0x022B},  // ö + COMBINING MACRON = ȫ (LATIN SMALL LETTER O WITH DIAERESIS AND MACRON)
+    {0x0000, 0x0000, 0x0000},
+    {0x039F, 0x0313, 0x1F48},  // Ο + COMBINING COMMA ABOVE = Ὀ (GREEK CAPITAL LETTER OMICRON WITH PSILI)
+    {0x0000, 0x0000, 0x0000},
+    {0x0113, 0x0301, 0x1E17},  // ē + COMBINING ACUTE ACCENT = ḗ (LATIN SMALL LETTER E WITH MACRON AND ACUTE)
+    {0x004E, 0x0301, 0x0143},  // N + COMBINING ACUTE ACCENT = Ń (LATIN CAPITAL LETTER N WITH ACUTE)
+    {0x007A, 0x0307, 0x017C},  // z + COMBINING DOT ABOVE = ż (LATIN SMALL LETTER Z WITH DOT ABOVE)
+    {0x03A5, 0x0301, 0x038E},  // Υ + COMBINING ACUTE ACCENT = Ύ (GREEK CAPITAL LETTER UPSILON WITH TONOS)
+    {0x0000, 0x0000, 0x0000},
+    {0x0000, 0x0000, 0x0000},
+    {0x0069, 0x0303, 0x0129},  // i + COMBINING TILDE = ĩ (LATIN SMALL LETTER I WITH TILDE)
+    {0x0061, 0x0323, 0x1EA1},  // a + COMBINING DOT BELOW = ạ (LATIN SMALL LETTER A WITH DOT BELOW)
+    {0x0000, 0x0000, 0x0000},
+    {0x004E, 0x0331, 0x1E48},  // N + COMBINING MACRON BELOW = Ṉ (LATIN CAPITAL LETTER N WITH LINE BELOW)
+    {0x0069, 0x0328, 0x012F},  // i + COMBINING OGONEK = į (LATIN SMALL LETTER I WITH OGONEK)
+    {0x00E4, 0x0304, 0x01DF},  // ä + COMBINING MACRON = ǟ (LATIN SMALL LETTER A WITH DIAERESIS AND MACRON)
+    {0x0043, 0x0302, 0x0108},  // C + COMBINING CIRCUMFLEX ACCENT = Ĉ (LATIN CAPITAL LETTER C WITH CIRCUMFLEX)
+    {0x0000, 0x0000, 0x0000},
+    {0x0435, 0x0300, 0x0450},  // е + COMBINING GRAVE ACCENT = ѐ (CYRILLIC SMALL LETTER IE WITH GRAVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x006F, 0x0302, 0x00F4},  // o + COMBINING CIRCUMFLEX ACCENT = ô (LATIN SMALL LETTER O WITH CIRCUMFLEX)
+    {0x1F08, 0x0345,
+     0x1F88},  // Ἀ + COMBINING GREEK YPOGEGRAMMENI = ᾈ (GREEK CAPITAL LETTER ALPHA WITH PSILI AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x00D4, 0x0303, 0x1ED6},  // Ô + COMBINING TILDE = Ỗ (LATIN CAPITAL LETTER O WITH CIRCUMFLEX AND TILDE)
+    {0x03A5, 0x0300, 0x1FEA},  // Υ + COMBINING GRAVE ACCENT = Ὺ (GREEK CAPITAL LETTER UPSILON WITH VARIA)
+    {0x0078, 0x0307, 0x1E8B},  // x + COMBINING DOT ABOVE = ẋ (LATIN SMALL LETTER X WITH DOT ABOVE)
+    {0x0000, 0x0000, 0x0000},
+    {0x03B5, 0x0300, 0x1F72},  // ε + COMBINING GRAVE ACCENT = ὲ (GREEK SMALL LETTER EPSILON WITH VARIA)
+    {0x1F24, 0x0345,
+     0x1F94},  // ἤ + COMBINING GREEK YPOGEGRAMMENI = ᾔ (GREEK SMALL LETTER ETA WITH PSILI AND OXIA AND YPOGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x03CB, 0x0342,
+     0x1FE7},  // ϋ + COMBINING GREEK PERISPOMENI = ῧ (GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
     {0x1F6E, 0x0345, 0x1FAE},  // Ὦ + COMBINING GREEK YPOGEGRAMMENI = ᾮ (GREEK CAPITAL LETTER OMEGA WITH PSILI AND
                                // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F6F, 0x0345, 0x1FAF},  // Ὧ + COMBINING GREEK YPOGEGRAMMENI = ᾯ (GREEK CAPITAL LETTER OMEGA WITH DASIA AND
-                               // PERISPOMENI AND PROSGEGRAMMENI)
-    {0x1F70, 0x0345,
-     0x1FB2},  // ὰ + COMBINING GREEK YPOGEGRAMMENI = ᾲ (GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI)
-    {0x1F74, 0x0345,
-     0x1FC2},  // ὴ + COMBINING GREEK YPOGEGRAMMENI = ῂ (GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI)
-    {0x1F7C, 0x0345,
-     0x1FF2},  // ὼ + COMBINING GREEK YPOGEGRAMMENI = ῲ (GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI)
-    {0x1FB6, 0x0345,
-     0x1FB7},  // ᾶ + COMBINING GREEK YPOGEGRAMMENI = ᾷ (GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1FBF, 0x0300, 0x1FCD},  // ᾿ + COMBINING GRAVE ACCENT = ῍ (GREEK PSILI AND VARIA)
-    {0x1FBF, 0x0301, 0x1FCE},  // ᾿ + COMBINING ACUTE ACCENT = ῎ (GREEK PSILI AND OXIA)
-    {0x1FBF, 0x0342, 0x1FCF},  // ᾿ + COMBINING GREEK PERISPOMENI = ῏ (GREEK PSILI AND PERISPOMENI)
-    {0x1FC6, 0x0345,
-     0x1FC7},  // ῆ + COMBINING GREEK YPOGEGRAMMENI = ῇ (GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1FF6, 0x0345,
-     0x1FF7},  // ῶ + COMBINING GREEK YPOGEGRAMMENI = ῷ (GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI)
-    {0x1FFE, 0x0300, 0x1FDD},  // ῾ + COMBINING GRAVE ACCENT = ῝ (GREEK DASIA AND VARIA)
-    {0x1FFE, 0x0301, 0x1FDE},  // ῾ + COMBINING ACUTE ACCENT = ῞ (GREEK DASIA AND OXIA)
-    {0x1FFE, 0x0342, 0x1FDF},  // ῾ + COMBINING GREEK PERISPOMENI = ῟ (GREEK DASIA AND PERISPOMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F09, 0x0345,
+     0x1F89},  // Ἁ + COMBINING GREEK YPOGEGRAMMENI = ᾉ (GREEK CAPITAL LETTER ALPHA WITH DASIA AND PROSGEGRAMMENI)
+    {0x0000, 0x0000, 0x0000},
+    {0x1F50, 0x0300, 0x1F52},  // ὐ + COMBINING GRAVE ACCENT = ὒ (GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA)
+    {0x0000, 0x0000, 0x0000},
+    {0x0065, 0x0303, 0x1EBD},  // e + COMBINING TILDE = ẽ (LATIN SMALL LETTER E WITH TILDE)
 };
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Splits a buffer of UTF-8 text into words without copying or allocating.
+ * Words are separated by space, tab, CR and LF; LF is also reported as a token of its own, for
+ * parsers that treat it as a paragraph break. Each word comes back as a slice of the buffer with
+ * a flag saying whether it is all ASCII, so callers can skip NFC normalization for it.
+ *
+ * The scan runs a machine word at a time: a word of text with no byte below 0x21 has no
+ * delimiter in it and is skipped in one step.
+ */
+class WordTokenizer {
+ public:
+  enum class Kind : uint8_t { WORD, NEWLINE };
+
+  struct Token {
+    Kind kind;
+    const char* text;  // Into the buffer; not null-terminated
+    size_t length;
+    bool ascii;  // No byte >= 0x80
+    bool cut;    // Ends at the end of the buffer, so may go on in the next one
+  };
+
+  /**
+   * @param maxWordLength Longer runs are split into pieces of at most this many bytes, at a
+   *                      UTF-8 character boundary where there is one
+   */
+  WordTokenizer(const char* data, const size_t length, const size_t maxWordLength)
+      : pos_(data), end_(data + length), maxWordLength_(maxWordLength) {}
+
+  /**
+   * Next word or newline.
+   * @return false when the buffer is used up
+   */
+  bool next(Token& out) {
+    while (pos_ < end_) {
+      const char c = *pos_;
+      if (c == '\n') {
+        out = {Kind::NEWLINE, pos_, 1, true, false};
+        pos_++;
+        return true;
+      }
+      if (!isSpace(c)) break;
+      pos_++;
+    }
+    if (pos_ == end_) return false;
+
+    const char* start = pos_;
+    const char* limit = (static_cast<size_t>(end_ - start) > maxWordLength_) ? start + maxWordLength_ : end_;
+    Chunk bits = 0;
+    while (static_cast<size_t>(limit - pos_) >= sizeof(Chunk)) {
+      Chunk v;
+      memcpy(&v, pos_, sizeof(v));
+      if (hasByteBelow(v, 0x21)) break;
+      bits |= v;
+      pos_ += sizeof(Chunk);
+    }
+    while (pos_ < limit && !isSpace(*pos_)) {
+      bits |= static_cast<uint8_t>(*pos_);
+      pos_++;
+    }
+
+    // Split an over-long word before a continuation byte rather than inside a character
+    if (pos_ == limit && limit < end_ && !isSpace(*pos_)) {
+      const char* back = pos_;
+      while (back > start + 1 && (static_cast<uint8_t>(*back) & 0xC0) == 0x80) back--;
+      if ((static_cast<uint8_t>(*back) & 0xC0) != 0x80) pos_ = back;
+    }
+
+    out = {Kind::WORD, start, static_cast<size_t>(pos_ - start), (bits & HIGH_BITS) == 0, pos_ == end_};
+    return true;
+  }
+
+  /** Bytes of the buffer consumed so far. */
+  size_t consumed(const char* data) const { return static_cast<size_t>(pos_ - data); }
+
+  static bool isSpace(const char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+
+ private:
+  // One register's worth of text: 4 bytes on the device, 8 on 64-bit hosts
+  using Chunk = uintptr_t;
+  static constexpr Chunk ONES = ~Chunk{0} / 0xFF;
+  static constexpr Chunk HIGH_BITS = ONES * 0x80;
+
+  // Whether any byte of v is below n (n <= 0x80). Exact as a yes/no, though not for which byte.
+  static bool hasByteBelow(const Chunk v, const uint8_t n) { return ((v - ONES * n) & ~v & HIGH_BITS) != 0; }
+
+  const char* pos_;
+  const char* end_;
+  size_t maxWordLength_;
+};
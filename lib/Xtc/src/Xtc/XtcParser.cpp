@@ -13,17 +13,40 @@
 #define TAG "XTC_PARSE"
 #include <SDCardManager.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace xtc {
 
+namespace {
+// Page offsets are cached at 4 bytes per page; books beyond this look entries up on demand
+constexpr uint32_t MAX_CACHED_PAGES = 16384;
+// Page table entries read per SD transfer while caching
+constexpr size_t PAGE_TABLE_BATCH = 32;
+constexpr uint32_t NO_READ_AHEAD = UINT32_MAX;
+
+size_t bitmapSizeFor(const uint8_t bitDepth, const uint16_t width, const uint16_t height) {
+  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
+  // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
+  if (bitDepth == 2) {
+    return ((static_cast<size_t>(width) * height + 7) / 8) * 2;
+  }
+  return ((width + 7) / 8) * static_cast<size_t>(height);
+}
+}  // namespace
+
 XtcParser::XtcParser()
     : m_isOpen(false),
       m_defaultWidth(DISPLAY_WIDTH),
       m_defaultHeight(DISPLAY_HEIGHT),
       m_bitDepth(1),
       m_hasChapters(false),
-      m_lastError(XtcError::OK) {
+      m_lastError(XtcError::OK),
+      m_readAheadBuf(nullptr),
+      m_readAheadCapacity(0),
+      m_readAheadSize(0),
+      m_readAheadBitmap(0),
+      m_readAheadPage(NO_READ_AHEAD) {
   memset(&m_header, 0, sizeof(m_header));
 }
 
@@ -79,7 +102,9 @@ void XtcParser::close() {
     m_file.close();
     m_isOpen = false;
   }
-  m_pageTable.clear();
+  m_pageOffsets.clear();
+  m_pageOffsets.shrink_to_fit();
+  m_readAheadPage = NO_READ_AHEAD;
   m_chapters.clear();
   m_title.clear();
   m_author.clear();
@@ -128,7 +153,9 @@ XtcError XtcParser::readHeader() {
 XtcError XtcParser::readTitle() {
   // Title is usually at offset 0x38 (56) for 88-byte headers
   // Read title as null-terminated UTF-8 string
-  if (m_header.titleOffset == 0) {
+  // With the chapter flag (byte 0x0B) set, 0x30 holds the 64-bit chapter offset instead
+  const bool hasChaptersFlag = (m_header.flags >> 24) == 1;
+  if (m_header.titleOffset == 0 || hasChaptersFlag) {
     m_header.titleOffset = 0x38;  // Default offset
   }
 
@@ -187,28 +214,38 @@ XtcError XtcParser::readPageTable() {
     return XtcError::READ_ERROR;
   }
 
-  m_pageTable.resize(m_header.pageCount);
-
-  // Read page table entries
-  for (uint16_t i = 0; i < m_header.pageCount; i++) {
-    PageTableEntry entry;
-    size_t bytesRead = m_file.read(reinterpret_cast<uint8_t*>(&entry), sizeof(PageTableEntry));
-    if (bytesRead != sizeof(PageTableEntry)) {
-      LOG_ERR(TAG, "Failed to read page table entry %u", i);
+  // Only the data offset is needed per page: sizes and dimensions follow from the page header
+  const bool cacheOffsets = m_header.pageCount <= MAX_CACHED_PAGES;
+  if (cacheOffsets) {
+    m_pageOffsets.resize(m_header.pageCount);
+  } else {
+    LOG_INF(TAG, "Large page table (%u pages), looking up entries on demand", m_header.pageCount);
+  }
+
+  // Read entries in batches to keep SD transfers few and large
+  PageTableEntry entries[PAGE_TABLE_BATCH];
+  const uint16_t readCount = cacheOffsets ? m_header.pageCount : 1;
+  for (uint16_t i = 0; i < readCount;) {
+    const size_t batch = std::min<size_t>(PAGE_TABLE_BATCH, readCount - i);
+    const size_t batchBytes = batch * sizeof(PageTableEntry);
+    size_t bytesRead = m_file.read(reinterpret_cast<uint8_t*>(entries), batchBytes);
+    if (bytesRead != batchBytes) {
+      LOG_ERR(TAG, "Failed to read page table entries %u-%u", i, static_cast<unsigned>(i + batch - 1));
       return XtcError::READ_ERROR;
     }
 
-    m_pageTable[i].offset = static_cast<uint32_t>(entry.dataOffset);
-    m_pageTable[i].size = entry.dataSize;
-    m_pageTable[i].width = entry.width;
-    m_pageTable[i].height = entry.height;
-    m_pageTable[i].bitDepth = m_bitDepth;
-
     // Update default dimensions from first page
     if (i == 0) {
-      m_defaultWidth = entry.width;
-      m_defaultHeight = entry.height;
+      m_defaultWidth = entries[0].width;
+      m_defaultHeight = entries[0].height;
     }
+
+    if (cacheOffsets) {
+      for (size_t j = 0; j < batch; j++) {
+        m_pageOffsets[i + j] = static_cast<uint32_t>(entries[j].dataOffset);
+      }
+    }
+    i += batch;
   }
 
   LOG_INF(TAG, "Read %u page table entries", m_header.pageCount);
@@ -321,61 +358,87 @@ XtcError XtcParser::readChapters() {
   return XtcError::OK;
 }
 
-bool XtcParser::getPageInfo(uint32_t pageIndex, PageInfo& info) const {
-  if (pageIndex >= m_pageTable.size()) {
+bool XtcParser::getPageOffset(const uint32_t pageIndex, uint32_t& offset) {
+  if (pageIndex >= m_header.pageCount) {
     return false;
   }
-  info = m_pageTable[pageIndex];
+  if (!m_pageOffsets.empty()) {
+    offset = m_pageOffsets[pageIndex];
+    return true;
+  }
+
+  PageTableEntry entry;
+  if (!m_file.seek(m_header.pageTableOffset + static_cast<uint64_t>(pageIndex) * sizeof(PageTableEntry)) ||
+      m_file.read(reinterpret_cast<uint8_t*>(&entry), sizeof(entry)) != sizeof(entry)) {
+    LOG_ERR(TAG, "Failed to read page table entry %u", pageIndex);
+    return false;
+  }
+  offset = static_cast<uint32_t>(entry.dataOffset);
   return true;
 }
 
-size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
-  if (!m_isOpen) {
-    m_lastError = XtcError::FILE_NOT_FOUND;
-    return 0;
+bool XtcParser::getPageInfo(uint32_t pageIndex, PageInfo& info) {
+  if (!getPageOffset(pageIndex, info.offset)) {
+    return false;
   }
+  info.size = static_cast<uint32_t>(sizeof(XtgPageHeader) + bitmapSizeFor(m_bitDepth, m_defaultWidth, m_defaultHeight));
+  info.width = m_defaultWidth;
+  info.height = m_defaultHeight;
+  info.bitDepth = m_bitDepth;
+  info.padding = 0;
+  return true;
+}
 
-  if (pageIndex >= m_header.pageCount) {
-    m_lastError = XtcError::PAGE_OUT_OF_RANGE;
-    return 0;
+XtcError XtcParser::readPageHeader(const uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize) {
+  uint32_t offset = 0;
+  if (!getPageOffset(pageIndex, offset)) {
+    return XtcError::READ_ERROR;
   }
 
-  const PageInfo& page = m_pageTable[pageIndex];
-
   // Seek to page data
-  if (!m_file.seek(page.offset)) {
-    LOG_ERR(TAG, "Failed to seek to page %u at offset %lu", pageIndex, page.offset);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+  if (!m_file.seek(offset)) {
+    LOG_ERR(TAG, "Failed to seek to page %u at offset %lu", pageIndex, offset);
+    return XtcError::READ_ERROR;
   }
 
   // Read page header (XTG for 1-bit, XTH for 2-bit - same structure)
-  XtgPageHeader pageHeader;
   size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
   if (headerRead != sizeof(XtgPageHeader)) {
     LOG_ERR(TAG, "Failed to read page header for page %u", pageIndex);
-    m_lastError = XtcError::READ_ERROR;
-    return 0;
+    return XtcError::READ_ERROR;
   }
+  return checkPageHeader(pageIndex, pageHeader, bitmapSize);
+}
 
+XtcError XtcParser::checkPageHeader(const uint32_t pageIndex, const XtgPageHeader& pageHeader, size_t& bitmapSize) {
   // Verify page magic (XTG for 1-bit, XTH for 2-bit)
   const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
   if (pageHeader.magic != expectedMagic) {
     LOG_ERR(TAG, "Invalid page magic for page %u: 0x%08X (expected 0x%08X)", pageIndex, pageHeader.magic,
             expectedMagic);
-    m_lastError = XtcError::INVALID_MAGIC;
+    return XtcError::INVALID_MAGIC;
+  }
+
+  bitmapSize = bitmapSizeFor(m_bitDepth, pageHeader.width, pageHeader.height);
+  return XtcError::OK;
+}
+
+size_t XtcParser::loadPage(uint32_t pageIndex, uint8_t* buffer, size_t bufferSize) {
+  if (!m_isOpen) {
+    m_lastError = XtcError::FILE_NOT_FOUND;
     return 0;
   }
 
-  // Calculate bitmap size based on bit depth
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, column-major, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
-  if (m_bitDepth == 2) {
-    // XTH: two bit planes, each containing (width * height) bits rounded up to bytes
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+  if (pageIndex >= m_header.pageCount) {
+    m_lastError = XtcError::PAGE_OUT_OF_RANGE;
+    return 0;
+  }
+
+  XtgPageHeader pageHeader;
+  size_t bitmapSize = 0;
+  m_lastError = readPageHeader(pageIndex, pageHeader, bitmapSize);
+  if (m_lastError != XtcError::OK) {
+    return 0;
   }
 
   // Check buffer size
@@ -408,35 +471,53 @@ XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
     return XtcError::PAGE_OUT_OF_RANGE;
   }
 
-  const PageInfo& page = m_pageTable[pageIndex];
+  size_t bitmapSize = 0;
+  size_t totalRead = 0;
 
-  // Seek to page data
-  if (!m_file.seek(page.offset)) {
-    return XtcError::READ_ERROR;
+  // Serve the read-ahead bytes from RAM, then continue from the file where they end
+  const bool buffered = m_readAheadPage == pageIndex && m_readAheadBuf != nullptr;
+  if (buffered) {
+    bitmapSize = m_readAheadBitmap;
+    while (totalRead < m_readAheadSize) {
+      const size_t n = std::min(chunkSize, m_readAheadSize - totalRead);
+      callback(m_readAheadBuf + totalRead, n, totalRead);
+      totalRead += n;
+    }
+    if (totalRead >= bitmapSize) {
+      return XtcError::OK;
+    }
   }
 
-  // Read and skip page header (XTG for 1-bit, XTH for 2-bit)
-  XtgPageHeader pageHeader;
-  size_t headerRead = m_file.read(reinterpret_cast<uint8_t*>(&pageHeader), sizeof(XtgPageHeader));
-  const uint32_t expectedMagic = (m_bitDepth == 2) ? XTH_MAGIC : XTG_MAGIC;
-  if (headerRead != sizeof(XtgPageHeader) || pageHeader.magic != expectedMagic) {
+  uint32_t offset = 0;
+  if (!getPageOffset(pageIndex, offset) ||
+      !m_file.seek(offset + (buffered ? sizeof(XtgPageHeader) + totalRead : 0))) {
     return XtcError::READ_ERROR;
   }
 
-  // Calculate bitmap size based on bit depth
-  // XTG (1-bit): Row-major, ((width+7)/8) * height bytes
-  // XTH (2-bit): Two bit planes, ((width * height + 7) / 8) * 2 bytes
-  size_t bitmapSize;
-  if (m_bitDepth == 2) {
-    bitmapSize = ((static_cast<size_t>(pageHeader.width) * pageHeader.height + 7) / 8) * 2;
-  } else {
-    bitmapSize = ((pageHeader.width + 7) / 8) * pageHeader.height;
+  // Header and bitmap are contiguous, so an unbuffered page takes its header along with the first
+  // chunk: one seek, then one read per chunk straight through both planes of an XTCH page
+  std::vector<uint8_t> chunk(sizeof(XtgPageHeader) + chunkSize);
+  if (!buffered) {
+    // Sized for the table's page dimensions, so a small page doesn't read into the next one
+    const size_t expected = bitmapSizeFor(m_bitDepth, m_defaultWidth, m_defaultHeight);
+    const int headRead = m_file.read(chunk.data(), sizeof(XtgPageHeader) + std::min(chunkSize, expected));
+    if (headRead < static_cast<int>(sizeof(XtgPageHeader))) {
+      LOG_ERR(TAG, "Failed to read page header for page %u", pageIndex);
+      return XtcError::READ_ERROR;
+    }
+    XtgPageHeader pageHeader;
+    memcpy(&pageHeader, chunk.data(), sizeof(pageHeader));
+    const XtcError err = checkPageHeader(pageIndex, pageHeader, bitmapSize);
+    if (err != XtcError::OK) {
+      return err;
+    }
+    const size_t n = std::min(static_cast<size_t>(headRead) - sizeof(XtgPageHeader), bitmapSize);
+    if (n > 0) {
+      callback(chunk.data() + sizeof(XtgPageHeader), n, 0);
+      totalRead = n;
+    }
   }
 
-  // Read in chunks
-  std::vector<uint8_t> chunk(chunkSize);
-  size_t totalRead = 0;
-
   while (totalRead < bitmapSize) {
     size_t toRead = std::min(chunkSize, bitmapSize - totalRead);
     size_t bytesRead = m_file.read(chunk.data(), toRead);
@@ -452,6 +533,41 @@ XtcError XtcParser::loadPageStreaming(uint32_t pageIndex,
   return XtcError::OK;
 }
 
+void XtcParser::setReadAheadBuffer(uint8_t* buffer, const size_t capacity) {
+  m_readAheadBuf = buffer;
+  m_readAheadCapacity = buffer ? capacity : 0;
+  m_readAheadPage = NO_READ_AHEAD;
+}
+
+bool XtcParser::readAhead(const uint32_t pageIndex) {
+  if (!m_isOpen || m_readAheadBuf == nullptr || pageIndex >= m_header.pageCount) {
+    return false;
+  }
+  if (m_readAheadPage == pageIndex) {
+    return true;
+  }
+
+  // Invalidate first so a failed read never leaves stale bytes attached to a page
+  m_readAheadPage = NO_READ_AHEAD;
+
+  XtgPageHeader pageHeader;
+  size_t bitmapSize = 0;
+  if (readPageHeader(pageIndex, pageHeader, bitmapSize) != XtcError::OK) {
+    return false;
+  }
+
+  const size_t toRead = std::min(m_readAheadCapacity, bitmapSize);
+  if (m_file.read(m_readAheadBuf, toRead) != static_cast<int>(toRead)) {
+    LOG_ERR(TAG, "Read-ahead failed for page %u", pageIndex);
+    return false;
+  }
+
+  m_readAheadSize = toRead;
+  m_readAheadBitmap = bitmapSize;
+  m_readAheadPage = pageIndex;
+  return true;
+}
+
 bool XtcParser::isValidXtcFile(const char* filepath) {
   FsFile file;
   if (!SdMan.openFileForRead("XTC", filepath, file)) {
@@ -42,7 +42,8 @@ class XtcParser {
   uint8_t getBitDepth() const { return m_bitDepth; }  // 1 = XTC/XTG, 2 = XTCH/XTH
 
   // Page information
-  bool getPageInfo(uint32_t pageIndex, PageInfo& info) const;
+  // Size and dimensions come from the page table defaults (pages of one book share them)
+  bool getPageInfo(uint32_t pageIndex, PageInfo& info);
 
   /**
    * Load page bitmap (raw 1-bit data, skipping XTG header)
@@ -67,6 +68,23 @@ class XtcParser {
                              std::function<void(const uint8_t* data, size_t size, size_t offset)> callback,
                              size_t chunkSize = 1024);
 
+  /**
+   * Read-ahead buffer for the next page turn
+   * The buffer stays owned by the caller and must outlive its use here
+   * (pass nullptr to detach it).
+   */
+  void setReadAheadBuffer(uint8_t* buffer, size_t capacity);
+
+  /**
+   * Read the start of a page's bitmap into the read-ahead buffer
+   * loadPageStreaming() serves those bytes from RAM and only reads the rest from the file.
+   * May run on a background task, as long as nothing else touches the parser meanwhile.
+   *
+   * @param pageIndex Page index
+   * @return true if the page is now (or already was) buffered
+   */
+  bool readAhead(uint32_t pageIndex);
+
   // Get title/author from metadata
   std::string getTitle() const { return m_title; }
   std::string getAuthor() const { return m_author; }
@@ -84,7 +102,7 @@ class XtcParser {
   FsFile m_file;
   bool m_isOpen;
   XtcHeader m_header;
-  std::vector<PageInfo> m_pageTable;
+  std::vector<uint32_t> m_pageOffsets;  // Page data offsets, empty if the table is too large to cache
   std::vector<ChapterInfo> m_chapters;
   std::string m_title;
   std::string m_author;
@@ -94,12 +112,22 @@ class XtcParser {
   bool m_hasChapters;
   XtcError m_lastError;
 
+  // Read-ahead state (see readAhead())
+  uint8_t* m_readAheadBuf;
+  size_t m_readAheadCapacity;
+  size_t m_readAheadSize;      // Bitmap bytes buffered
+  size_t m_readAheadBitmap;    // Full bitmap size of the buffered page
+  uint32_t m_readAheadPage;    // Buffered page, UINT32_MAX if none
+
   // Internal helper functions
   XtcError readHeader();
   XtcError readPageTable();
   XtcError readTitle();
   XtcError readAuthor();
   XtcError readChapters();
+  bool getPageOffset(uint32_t pageIndex, uint32_t& offset);
+  XtcError readPageHeader(uint32_t pageIndex, XtgPageHeader& pageHeader, size_t& bitmapSize);
+  XtcError checkPageHeader(uint32_t pageIndex, const XtgPageHeader& pageHeader, size_t& bitmapSize);
 };
 
 }  // namespace xtc
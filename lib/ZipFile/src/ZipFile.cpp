@@ -24,6 +24,19 @@ namespace {
 constexpr uint16_t ZIP_METHOD_STORED = 0;
 constexpr uint16_t ZIP_METHOD_DEFLATED = 8;
 
+// Inflate checkpoint file: header, then count windows of 32KB, then count InflateCheckpoint entries
+constexpr uint32_t CHECKPOINT_MAGIC = 0x5A43504B;  // "KPCZ"
+constexpr uint8_t CHECKPOINT_VERSION = 1;
+
+struct CheckpointHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t reserved[3];
+  uint32_t compressedSize;
+  uint32_t uncompressedSize;
+  uint32_t count;
+};
+
 int zipReadCallback(uzlib_uncomp* uncomp) {
   auto* ctx = reinterpret_cast<ZipInflateCtx*>(uncomp);
   if (ctx->fileRemaining == 0) return -1;
@@ -563,7 +576,82 @@ uint8_t* ZipFile::readFileToMemory(const char* filename, size_t* size, const boo
   return data;
 }
 
-bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize, uint8_t* dictBuffer) {
+namespace {
+// Returns false if path holds no checkpoints for this entry. Otherwise *cp is the last checkpoint
+// at or before fromOffset with its window loaded, or all zero (start of the entry) if there is none.
+bool loadCheckpoint(const char* path, const ZipFile::FileStatSlim& fileStat, const uint32_t fromOffset,
+                    uint8_t* window, InflateCheckpoint* cp) {
+  *cp = {};
+  FsFile f;
+  if (!SdMan.openFileForRead("ZIP", path, f)) {
+    return false;
+  }
+
+  CheckpointHeader header = {};
+  if (f.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header) ||
+      header.magic != CHECKPOINT_MAGIC || header.version != CHECKPOINT_VERSION ||
+      header.compressedSize != fileStat.compressedSize || header.uncompressedSize != fileStat.uncompressedSize ||
+      f.size() != sizeof(header) + header.count * (InflateReader::WINDOW_SIZE + sizeof(InflateCheckpoint))) {
+    f.close();
+    return false;
+  }
+
+  f.seek(sizeof(header) + header.count * InflateReader::WINDOW_SIZE);
+  int best = -1;
+  for (uint32_t i = 0; i < header.count; i++) {
+    InflateCheckpoint entry;
+    if (f.read(reinterpret_cast<uint8_t*>(&entry), sizeof(entry)) != sizeof(entry)) {
+      f.close();
+      return false;
+    }
+    if (entry.outOffset > fromOffset) break;
+    *cp = entry;
+    best = static_cast<int>(i);
+  }
+
+  bool ok = true;
+  if (best >= 0) {
+    f.seek(sizeof(header) + best * InflateReader::WINDOW_SIZE);
+    ok = f.read(window, InflateReader::WINDOW_SIZE) == InflateReader::WINDOW_SIZE;
+    if (!ok) *cp = {};
+  }
+  f.close();
+  return ok;
+}
+
+bool beginCheckpoints(const char* path, const ZipFile::FileStatSlim& fileStat, FsFile& f) {
+  if (SdMan.exists(path)) {
+    SdMan.remove(path);
+  }
+  if (!SdMan.openFileForWrite("ZIP", path, f)) {
+    return false;
+  }
+  // Count stays 0 until the entry inflated completely
+  const CheckpointHeader header = {CHECKPOINT_MAGIC, CHECKPOINT_VERSION, {}, fileStat.compressedSize,
+                                   fileStat.uncompressedSize, 0};
+  f.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+  return true;
+}
+
+void finishCheckpoints(const char* path, FsFile& f, const std::vector<InflateCheckpoint>& checkpoints,
+                       const bool success) {
+  if (!success) {
+    f.close();
+    SdMan.remove(path);
+    return;
+  }
+
+  f.write(reinterpret_cast<const uint8_t*>(checkpoints.data()), checkpoints.size() * sizeof(InflateCheckpoint));
+  const auto count = static_cast<uint32_t>(checkpoints.size());
+  f.seek(offsetof(CheckpointHeader, count));
+  f.write(reinterpret_cast<const uint8_t*>(&count), sizeof(count));
+  f.close();
+  LOG_DBG(TAG, "Recorded %u inflate checkpoints", static_cast<unsigned>(count));
+}
+}  // namespace
+
+bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t chunkSize, uint8_t* dictBuffer,
+                               const char* checkpointPath, const uint32_t fromOffset) {
   const bool wasOpen = isOpen();
   if (!wasOpen && !open()) {
     return false;
@@ -576,17 +664,17 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
   }
 
   const long fileOffset = getDataOffset(fileStat);
-  if (fileOffset < 0) {
+  if (fileOffset < 0 || fromOffset > fileStat.uncompressedSize) {
     if (!wasOpen) close();
     return false;
   }
 
-  file.seek(fileOffset);
   const auto deflatedDataSize = fileStat.compressedSize;
   const auto inflatedDataSize = fileStat.uncompressedSize;
 
   if (fileStat.method == ZIP_METHOD_STORED) {
     // no deflation, just read content
+    file.seek(fileOffset + fromOffset);
     const auto buffer = static_cast<uint8_t*>(malloc(chunkSize));
     if (!buffer) {
       LOG_ERR(TAG, "Failed to allocate memory for buffer");
@@ -596,7 +684,7 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
       return false;
     }
 
-    size_t remaining = inflatedDataSize;
+    size_t remaining = inflatedDataSize - fromOffset;
     while (remaining > 0) {
       const size_t dataRead = file.read(buffer, remaining < chunkSize ? remaining : chunkSize);
       if (dataRead == 0) {
@@ -640,7 +728,6 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
 
     ZipInflateCtx ctx;
     ctx.file = &file;
-    ctx.fileRemaining = deflatedDataSize;
     ctx.readBuf = fileReadBuffer;
     ctx.readBufSize = chunkSize;
 
@@ -656,13 +743,39 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
     }
     ctx.reader.setReadCallback(zipReadCallback);
 
+    // Start at the nearest checkpoint before fromOffset if there are any, otherwise inflate from
+    // the start and record checkpoints on the way (large entries only)
+    InflateCheckpoint start = {};
+    FsFile checkpointFile;
+    std::vector<InflateCheckpoint> recorded;
+    bool recording = false;
+    if (checkpointPath) {
+      if (loadCheckpoint(checkpointPath, fileStat, fromOffset, ctx.reader.window(), &start)) {
+        if (start.outOffset > 0) {
+          ctx.reader.resumeAt(start);
+          LOG_DBG(TAG, "Resuming inflate at %u for offset %u", static_cast<unsigned>(start.outOffset),
+                  static_cast<unsigned>(fromOffset));
+        }
+      } else if (inflatedDataSize >= CHECKPOINT_MIN_SIZE) {
+        recording = beginCheckpoints(checkpointPath, fileStat, checkpointFile);
+        ctx.reader.setStopAtBlockBoundary(recording);
+      }
+    }
+
+    file.seek(fileOffset + start.inOffset);
+    ctx.fileRemaining = deflatedDataSize - start.inOffset;
+
     bool success = false;
-    size_t totalProduced = 0;
+    size_t totalProduced = start.outOffset;
+    size_t nextCheckpoint = CHECKPOINT_SPACING;
 
     while (true) {
       size_t produced;
       const InflateStatus status = ctx.reader.readAtMost(outputBuffer, chunkSize, &produced);
 
+      // Bytes before fromOffset only rebuild the window
+      const size_t skip =
+          fromOffset > totalProduced ? std::min(produced, static_cast<size_t>(fromOffset) - totalProduced) : 0;
       totalProduced += produced;
       if (totalProduced > static_cast<size_t>(inflatedDataSize)) {
         LOG_ERR(TAG, "Decompressed size exceeds expected (%zu > %zu)", totalProduced,
@@ -670,8 +783,8 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
         break;
       }
 
-      if (produced > 0) {
-        if (out.write(outputBuffer, produced) != produced) {
+      if (produced > skip) {
+        if (out.write(outputBuffer + skip, produced - skip) != produced - skip) {
           LOG_ERR(TAG, "Failed to write all output bytes to stream");
           break;
         }
@@ -692,6 +805,21 @@ bool ZipFile::readFileToStream(const char* filename, Print& out, const size_t ch
         LOG_ERR(TAG, "Decompression failed");
         break;
       }
+
+      InflateCheckpoint cp;
+      if (recording && totalProduced >= nextCheckpoint &&
+          ctx.reader.makeCheckpoint(deflatedDataSize - ctx.fileRemaining, totalProduced, &cp)) {
+        const uint8_t* window = ctx.reader.window();
+        const size_t split = ctx.reader.windowSplit();
+        checkpointFile.write(window + split, InflateReader::WINDOW_SIZE - split);
+        checkpointFile.write(window, split);
+        recorded.push_back(cp);
+        nextCheckpoint = totalProduced + CHECKPOINT_SPACING;
+      }
+    }
+
+    if (recording) {
+      finishCheckpoints(checkpointPath, checkpointFile, recorded, success);
     }
 
     if (!wasOpen) {
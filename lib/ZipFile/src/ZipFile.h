@@ -1,4 +1,5 @@
 #pragma once
+#include <InflateReader.h>
 #include <SdFat.h>
 
 #include <string>
@@ -74,5 +75,12 @@ class ZipFile {
   // Due to the memory required to run each of these, it is recommended to not preopen the zip file for multiple
   // These functions will open and close the zip as needed
   uint8_t* readFileToMemory(const char* filename, size_t* size = nullptr, bool trailingNullByte = false);
-  bool readFileToStream(const char* filename, Print& out, size_t chunkSize, uint8_t* dictBuffer = nullptr);
+  // Streams the entry from uncompressed offset fromOffset to the end.
+  // With checkpointPath, deflated entries keep inflate checkpoints (zran-style) there: the first
+  // read of an entry of at least CHECKPOINT_MIN_SIZE records one every CHECKPOINT_SPACING bytes
+  // of output, later reads start at the nearest one before fromOffset instead of the beginning.
+  bool readFileToStream(const char* filename, Print& out, size_t chunkSize, uint8_t* dictBuffer = nullptr,
+                        const char* checkpointPath = nullptr, uint32_t fromOffset = 0);
+  static constexpr uint32_t CHECKPOINT_MIN_SIZE = 256 * 1024;
+  static constexpr uint32_t CHECKPOINT_SPACING = 128 * 1024;
 };
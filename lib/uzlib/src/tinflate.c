@@ -33,6 +33,7 @@
  */
 
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "tinf.h"
@@ -102,6 +103,33 @@ static void tinf_build_bits_base(unsigned char* bits, unsigned short* base, int
 }
 #endif
 
+/* build the lookup table for codes of up to UZLIB_CONF_FAST_BITS bits */
+static void tinf_build_fast_table(TINF_TREE* t) {
+  unsigned int len, i, b, code = 0, idx = 0;
+
+  memset(t->fast, 0, sizeof(t->fast));
+
+  /* trans[] lists symbols in canonical code order */
+  for (len = 1; len <= UZLIB_CONF_FAST_BITS; ++len) {
+    for (i = 0; i < t->table[len]; ++i, ++code, ++idx) {
+      unsigned int rev = 0;
+
+      /* over-subscribed tree: leave the rest to the slow path */
+      if (code >> len) return;
+
+      /* codes are sent most significant bit first, the bit buffer holds
+         the next bit lowest */
+      for (b = 0; b < len; ++b) rev |= ((code >> b) & 1) << (len - 1 - b);
+
+      /* every index whose low len bits are this code */
+      for (; rev < (1u << UZLIB_CONF_FAST_BITS); rev += 1u << len) {
+        t->fast[rev] = (len << 9) | t->trans[idx];
+      }
+    }
+    code <<= 1;
+  }
+}
+
 /* build the fixed huffman trees */
 static void tinf_build_fixed_trees(TINF_TREE* lt, TINF_TREE* dt) {
   int i;
@@ -124,6 +152,9 @@ static void tinf_build_fixed_trees(TINF_TREE* lt, TINF_TREE* dt) {
   dt->table[5] = 32;
 
   for (i = 0; i < 32; ++i) dt->trans[i] = i;
+
+  tinf_build_fast_table(lt);
+  tinf_build_fast_table(dt);
 }
 
 /* given an array of code lengths, build a tree */
@@ -160,6 +191,8 @@ static void tinf_build_tree(TINF_TREE* t, const unsigned char* lengths, unsigned
   for (i = 0; i < num; ++i) {
     if (lengths[i]) t->trans[offs[lengths[i]]++] = i;
   }
+
+  tinf_build_fast_table(t);
 }
 
 /* ---------------------- *
@@ -191,11 +224,71 @@ unsigned char uzlib_get_byte(TINF_DATA* d) {
   return 0;
 }
 
+/* ---------------------- *
+ * -- bit buffer input -- *
+ * ---------------------- */
+
+#define TINF_BITBUF_BITS (8 * sizeof(uzlib_bitbuf_t))
+
+/* top up the bit buffer to more than TINF_BITBUF_BITS - 8 bits, or as
+   many as the input has left */
+static void tinf_refill(TINF_DATA* d) {
+  while (d->bitcount <= TINF_BITBUF_BITS - 8) {
+    unsigned char c;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (d->source_limit - d->source >= (ptrdiff_t)sizeof(uzlib_bitbuf_t)) {
+      /* load a whole word and count the bytes that fit. Bits above
+         bitcount are then the following input bytes, which a later refill
+         ORs in again at the same position, so they need no masking. */
+      unsigned int n = (TINF_BITBUF_BITS - d->bitcount) >> 3;
+      uzlib_bitbuf_t word;
+      memcpy(&word, d->source, sizeof(word));
+      d->tag |= word << d->bitcount;
+      d->source += n;
+      d->bitcount += 8 * n;
+      return;
+    }
+#endif
+
+    if (d->source >= d->source_limit && (!d->readSource || d->eof)) {
+      d->eof = true;
+      return;
+    }
+    c = uzlib_get_byte(d);
+    if (d->eof) return;
+    d->tag |= (uzlib_bitbuf_t)c << d->bitcount;
+    d->bitcount += 8;
+  }
+}
+
+/* drop the bits up to the next byte boundary */
+static void tinf_align_byte(TINF_DATA* d) {
+  d->tag >>= d->bitcount & 7;
+  d->bitcount &= ~7u;
+  /* forget bytes preloaded past bitcount: they are read directly next */
+  if (d->bitcount == 0) d->tag = 0;
+}
+
+/* get the next byte at a byte boundary, draining the bit buffer first */
+static unsigned char tinf_get_aligned_byte(TINF_DATA* d) {
+  unsigned char c;
+
+  tinf_align_byte(d);
+  if (d->bitcount == 0) return uzlib_get_byte(d);
+
+  c = (unsigned char)d->tag;
+  d->tag >>= 8;
+  d->bitcount -= 8;
+  if (d->bitcount == 0) d->tag = 0;
+  return c;
+}
+
 uint32_t tinf_get_le_uint32(TINF_DATA* d) {
   uint32_t val = 0;
   int i;
   for (i = 4; i--;) {
-    val = val >> 8 | ((uint32_t)uzlib_get_byte(d)) << 24;
+    val = val >> 8 | ((uint32_t)tinf_get_aligned_byte(d)) << 24;
   }
   return val;
 }
@@ -204,48 +297,50 @@ uint32_t tinf_get_be_uint32(TINF_DATA* d) {
   uint32_t val = 0;
   int i;
   for (i = 4; i--;) {
-    val = val << 8 | uzlib_get_byte(d);
+    val = val << 8 | tinf_get_aligned_byte(d);
   }
   return val;
 }
 
-/* get one bit from source stream */
-static int tinf_getbit(TINF_DATA* d) {
-  unsigned int bit;
-
-  /* check if tag is empty */
-  if (!d->bitcount--) {
-    /* load next tag */
-    d->tag = uzlib_get_byte(d);
-    d->bitcount = 7;
-  }
-
-  /* shift bit out of tag */
-  bit = d->tag & 0x01;
-  d->tag >>= 1;
-
-  return bit;
-}
-
 /* read a num bit value from a stream and add base */
 static unsigned int tinf_read_bits(TINF_DATA* d, int num, int base) {
-  unsigned int val = 0;
+  unsigned int val;
 
-  /* read num bits */
-  if (num) {
-    unsigned int limit = 1 << (num);
-    unsigned int mask;
+  if (!num) return base;
 
-    for (mask = 1; mask < limit; mask *= 2)
-      if (tinf_getbit(d)) val += mask;
+  if (d->bitcount < (unsigned int)num) {
+    tinf_refill(d);
+    if (d->bitcount < (unsigned int)num) {
+      /* past the end of input: read zeros, like uzlib_get_byte() */
+      d->truncated = true;
+      d->bitcount = num;
+    }
   }
 
+  val = (unsigned int)d->tag & ((1u << num) - 1);
+  d->tag >>= num;
+  d->bitcount -= num;
+
   return val + base;
 }
 
+/* get one bit from source stream */
+static int tinf_getbit(TINF_DATA* d) { return tinf_read_bits(d, 1, 0); }
+
 /* given a data stream and a tree, decode a symbol */
 static int tinf_decode_symbol(TINF_DATA* d, TINF_TREE* t) {
   int sum = 0, cur = 0, len = 0;
+  unsigned int entry;
+
+  if (d->bitcount < 15) tinf_refill(d);
+
+  /* short codes: one lookup */
+  entry = t->fast[d->tag & ((1u << UZLIB_CONF_FAST_BITS) - 1)];
+  if (entry && (entry >> 9) <= d->bitcount) {
+    d->tag >>= entry >> 9;
+    d->bitcount -= entry >> 9;
+    return entry & 0x1ff;
+  }
 
   /* get more bits while code value is above sum */
   do {
@@ -354,6 +449,8 @@ static int tinf_decode_trees(TINF_DATA* d, TINF_TREE* lt, TINF_TREE* dt) {
   }
 #endif
 
+  if (d->truncated) return TINF_DATA_ERROR;
+
   /* build dynamic trees */
   tinf_build_tree(lt, lengths, hlit);
   tinf_build_tree(dt, lengths + hlit, hdist);
@@ -365,50 +462,148 @@ static int tinf_decode_trees(TINF_DATA* d, TINF_TREE* lt, TINF_TREE* dt) {
  * -- block inflate functions -- *
  * ----------------------------- */
 
-/* given a stream and two trees, inflate next chunk of output (a byte or more) */
+/* append n bytes of output to the dictionary ring */
+static void tinf_ring_write(TINF_DATA* d, const unsigned char* src, unsigned int n) {
+  unsigned int first;
+
+  /* only the last dict_size bytes survive */
+  if (n > d->dict_size) {
+    d->dict_idx = (d->dict_idx + n - d->dict_size) % d->dict_size;
+    src += n - d->dict_size;
+    n = d->dict_size;
+  }
+
+  first = d->dict_size - d->dict_idx;
+
+  if (first > n) first = n;
+  memcpy(d->dict_ring + d->dict_idx, src, first);
+  memcpy(d->dict_ring, src + first, n - first);
+
+  d->dict_idx += n;
+  if (d->dict_idx >= d->dict_size) d->dict_idx -= d->dict_size;
+}
+
+/* copy n bytes from dist bytes back, where the source may overlap the
+   bytes being written (dist < n repeats the pattern) */
+static void tinf_copy_forward(unsigned char* dst, unsigned int n, unsigned int dist) {
+  const unsigned char* src = dst - dist;
+
+  if (dist >= sizeof(uzlib_bitbuf_t)) {
+    /* a word at a time: each word read lies wholly before the one written */
+    while (n >= sizeof(uzlib_bitbuf_t)) {
+      memcpy(dst, src, sizeof(uzlib_bitbuf_t));
+      dst += sizeof(uzlib_bitbuf_t);
+      src += sizeof(uzlib_bitbuf_t);
+      n -= sizeof(uzlib_bitbuf_t);
+    }
+  }
+  while (n--) *dst++ = *src++;
+}
+
+/* copy as much of the current match as fits in the output buffer */
+static void tinf_copy_match(TINF_DATA* d) {
+  unsigned int n = d->curlen, room = d->dest_limit - d->dest;
+
+  if (n > room) n = room;
+  d->curlen -= n;
+
+  if (!d->dict_ring) {
+    tinf_copy_forward(d->dest, n, -d->lzOff);
+    d->dest += n;
+    return;
+  }
+
+  {
+    /* distance stays the same while both ring positions advance */
+    int dist = (int)d->dict_idx - d->lzOff;
+    if (dist <= 0) dist += d->dict_size;
+
+    while (n) {
+      unsigned int piece = n, head;
+
+      /* read the ring without wrapping, then repeat from the output */
+      if (piece > d->dict_size - d->lzOff) piece = d->dict_size - d->lzOff;
+      head = piece < (unsigned int)dist ? piece : (unsigned int)dist;
+      memcpy(d->dest, d->dict_ring + d->lzOff, head);
+      tinf_copy_forward(d->dest + head, piece - head, dist);
+      tinf_ring_write(d, d->dest, piece);
+
+      d->dest += piece;
+      d->lzOff += piece;
+      if ((unsigned int)d->lzOff == d->dict_size) d->lzOff = 0;
+      n -= piece;
+    }
+  }
+}
+
+/* given a stream and two trees, inflate output until the block ends or the
+   output buffer is full */
 static int tinf_inflate_block_data(TINF_DATA* d, TINF_TREE* lt, TINF_TREE* dt) {
-  if (d->curlen == 0) {
+  /* literals go straight to dest; they are added to the ring in one go
+     before anything reads it */
+  unsigned char* literals = d->dest;
+  int res = TINF_OK;
+
+  for (;;) {
     unsigned int offs;
-    int dist;
-    int sym = tinf_decode_symbol(d, lt);
-    // printf("huff sym: %02x\n", sym);
+    int sym, dist;
 
-    if (d->eof) {
-      return TINF_DATA_ERROR;
+    /* finish a match cut short by the end of the output buffer */
+    if (d->curlen) {
+      tinf_copy_match(d);
+      literals = d->dest;
+      if (d->curlen) break;
+    }
+    if (d->dest >= d->dest_limit) break;
+
+    sym = tinf_decode_symbol(d, lt);
+    if (d->truncated) {
+      res = TINF_DATA_ERROR;
+      break;
     }
 
     /* literal byte */
     if (sym < 256) {
-      TINF_PUT(d, sym);
-      return TINF_OK;
+      *d->dest++ = sym;
+      continue;
     }
 
     /* end of block */
     if (sym == 256) {
-      return TINF_DONE;
+      res = TINF_DONE;
+      break;
     }
 
     /* substring from sliding dictionary */
     sym -= 257;
     if (sym >= 29) {
-      return TINF_DATA_ERROR;
+      res = TINF_DATA_ERROR;
+      break;
     }
 
     /* possibly get more bits from length code */
     d->curlen = tinf_read_bits(d, length_bits[sym], length_base[sym]);
 
     dist = tinf_decode_symbol(d, dt);
-    if (dist >= 30) {
-      return TINF_DATA_ERROR;
+    if (dist < 0 || dist >= 30) {
+      res = TINF_DATA_ERROR;
+      break;
     }
 
     /* possibly get more bits from distance code */
     offs = tinf_read_bits(d, dist_bits[dist], dist_base[dist]);
+    if (d->truncated) {
+      res = TINF_DATA_ERROR;
+      break;
+    }
 
     /* calculate and validate actual LZ offset to use */
     if (d->dict_ring) {
+      if (d->dest > literals) tinf_ring_write(d, literals, d->dest - literals);
+      literals = d->dest;
       if (offs > d->dict_size) {
-        return TINF_DICT_ERROR;
+        res = TINF_DICT_ERROR;
+        break;
       }
       /* Note: unlike full-dest-in-memory case below, we don't
          try to catch offset which points to not yet filled
@@ -427,66 +622,73 @@ static int tinf_inflate_block_data(TINF_DATA* d, TINF_TREE* lt, TINF_TREE* dt) {
     } else {
       /* catch trying to point before the start of dest buffer */
       if (offs > (unsigned)(d->dest - d->destStart)) {
-        return TINF_DATA_ERROR;
+        res = TINF_DATA_ERROR;
+        break;
       }
       d->lzOff = -offs;
     }
   }
 
-  /* copy next byte from dict substring */
-  if (d->dict_ring) {
-    TINF_PUT(d, d->dict_ring[d->lzOff]);
-    if ((unsigned)++d->lzOff == d->dict_size) {
-      d->lzOff = 0;
-    }
-  } else {
-#if UZLIB_CONF_USE_MEMCPY
-    /* copy as much as possible, in one memcpy() call */
-    unsigned int to_copy = d->curlen, dest_len = d->dest_limit - d->dest;
-    if (to_copy > dest_len) {
-      to_copy = dest_len;
-    }
-    memcpy(d->dest, d->dest + d->lzOff, to_copy);
-    d->dest += to_copy;
-    d->curlen -= to_copy;
-    return TINF_OK;
-#else
-    d->dest[0] = d->dest[d->lzOff];
-    d->dest++;
-#endif
-  }
-  d->curlen--;
-  return TINF_OK;
+  if (d->dict_ring && d->dest > literals) tinf_ring_write(d, literals, d->dest - literals);
+  return res;
 }
 
-/* inflate next byte from uncompressed block of data */
+/* inflate output from an uncompressed block until it ends or the output
+   buffer is full */
 static int tinf_inflate_uncompressed_block(TINF_DATA* d) {
   if (d->curlen == 0) {
     unsigned int length, invlength;
 
-    /* get length */
-    length = uzlib_get_byte(d);
-    length += 256 * uzlib_get_byte(d);
+    /* get length (the block starts at a byte boundary) */
+    length = tinf_get_aligned_byte(d);
+    length += 256 * tinf_get_aligned_byte(d);
     /* get one's complement of length */
-    invlength = uzlib_get_byte(d);
-    invlength += 256 * uzlib_get_byte(d);
+    invlength = tinf_get_aligned_byte(d);
+    invlength += 256 * tinf_get_aligned_byte(d);
     /* check length */
     if (length != (~invlength & 0x0000ffff)) return TINF_DATA_ERROR;
 
     /* increment length to properly return TINF_DONE below, without
        producing data at the same time */
     d->curlen = length + 1;
+  }
 
-    /* make sure we start next block on a byte boundary */
-    d->bitcount = 0;
+  while (d->curlen > 1 && d->dest < d->dest_limit) {
+    unsigned int n = d->curlen - 1, room = d->dest_limit - d->dest;
+    unsigned char c;
+
+    if (d->bitcount == 0 && d->source < d->source_limit) {
+      /* copy straight from the input buffer */
+      unsigned int avail = d->source_limit - d->source;
+      if (n > room) n = room;
+      if (n > avail) n = avail;
+
+      memcpy(d->dest, d->source, n);
+      if (d->dict_ring) tinf_ring_write(d, d->dest, n);
+      d->source += n;
+      d->dest += n;
+      d->curlen -= n;
+      continue;
+    }
+
+    /* bytes already in the bit buffer, or the next input buffer. Read-ahead
+       sets eof while buffered bytes remain, so only a byte that had to come
+       from the input can be missing. */
+    tinf_align_byte(d);
+    if (d->bitcount == 0) {
+      c = uzlib_get_byte(d);
+      if (d->eof) return TINF_DATA_ERROR;
+    } else {
+      c = tinf_get_aligned_byte(d);
+    }
+    TINF_PUT(d, c);
+    d->curlen--;
   }
 
-  if (--d->curlen == 0) {
+  if (d->curlen == 1) {
+    d->curlen = 0;
     return TINF_DONE;
   }
-
-  unsigned char c = uzlib_get_byte(d);
-  TINF_PUT(d, c);
   return TINF_OK;
 }
 
@@ -510,6 +712,8 @@ void uzlib_init(void) {
 /* initialize decompression structure */
 void uzlib_uncompress_init(TINF_DATA* d, void* dict, unsigned int dictLen) {
   d->eof = 0;
+  d->truncated = false;
+  d->tag = 0;
   d->bitcount = 0;
   d->bfinal = 0;
   d->btype = -1;
@@ -517,6 +721,7 @@ void uzlib_uncompress_init(TINF_DATA* d, void* dict, unsigned int dictLen) {
   d->dict_ring = dict;
   d->dict_idx = 0;
   d->curlen = 0;
+  d->stop_at_block = false;
 }
 
 /* inflate next output bytes from compressed stream */
@@ -533,6 +738,9 @@ int uzlib_uncompress(TINF_DATA* d) {
       d->bfinal = tinf_getbit(d);
       /* read block type (2 bits) */
       d->btype = tinf_read_bits(d, 2, 0);
+      if (d->truncated) {
+        return TINF_DATA_ERROR;
+      }
 
 #if UZLIB_CONF_DEBUG_LOG >= 1
       printf("Started new block: type=%d final=%d\n", d->btype, d->bfinal);
@@ -567,6 +775,12 @@ int uzlib_uncompress(TINF_DATA* d) {
     }
 
     if (res == TINF_DONE && !d->bfinal) {
+      /* the caller wants to see block boundaries: stop before the
+         next block header */
+      if (d->stop_at_block) {
+        d->btype = -1;
+        return TINF_OK;
+      }
       /* the block has ended (without producing more data), but we
          can't return without data, so start procesing next block */
       goto next_blk;
@@ -78,8 +78,18 @@ extern "C" {
 typedef struct {
   unsigned short table[16];  /* table of code length counts */
   unsigned short trans[288]; /* code -> symbol translation table */
+  /* next UZLIB_CONF_FAST_BITS input bits -> (code length << 9) | symbol,
+     0 if the code is longer */
+  unsigned short fast[1 << UZLIB_CONF_FAST_BITS];
 } TINF_TREE;
 
+/* Bit buffer: one machine word, refilled a whole byte at a time */
+#if UINTPTR_MAX > 0xffffffffu
+typedef uint64_t uzlib_bitbuf_t;
+#else
+typedef uint32_t uzlib_bitbuf_t;
+#endif
+
 struct uzlib_uncomp {
   /* Pointer to the next byte in the input buffer */
   const unsigned char* source;
@@ -92,7 +102,9 @@ struct uzlib_uncomp {
      source_limit fields, thus allowing for buffered operation. */
   int (*source_read_cb)(struct uzlib_uncomp* uncomp);
 
-  unsigned int tag;
+  /* Input bits not decoded yet, next bit lowest. Whole bytes may be
+     buffered ahead of the decoder (bitcount can exceed 7). */
+  uzlib_bitbuf_t tag;
   unsigned int bitcount;
 
   /* Destination (output) buffer start */
@@ -106,9 +118,14 @@ struct uzlib_uncomp {
   unsigned int checksum;
   char checksum_type;
   bool eof;
+  /* Set when decoding needed more bits than the input had */
+  bool truncated;
 
   int btype;
   int bfinal;
+  /* If set, uzlib_uncompress() returns TINF_OK as soon as a non-final block
+     ends (btype == -1), so the caller can record a restart point there */
+  bool stop_at_block;
   unsigned int curlen;
   int lzOff;
   unsigned char* dict_ring;
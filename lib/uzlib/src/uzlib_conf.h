@@ -19,14 +19,11 @@
 #define UZLIB_CONF_PARANOID_CHECKS 0
 #endif
 
-#ifndef UZLIB_CONF_USE_MEMCPY
-/* Use memcpy() for copying data out of LZ window or uncompressed blocks,
-   instead of doing this byte by byte. For well-compressed data, this
-   may noticeably increase decompression speed. But for less compressed,
-   it can actually deteriorate it (due to the fact that many memcpy()
-   implementations are optimized for large blocks of data, and have
-   too much overhead for short strings of just a few bytes). */
-#define UZLIB_CONF_USE_MEMCPY 0
+#ifndef UZLIB_CONF_FAST_BITS
+/* Huffman codes of up to this many bits are decoded with a single table
+   lookup (2 << UZLIB_CONF_FAST_BITS bytes per tree). Longer codes walk the
+   canonical code bit by bit, as uzlib always did. */
+#define UZLIB_CONF_FAST_BITS 8
 #endif
 
 #endif /* UZLIB_CONF_H_INCLUDED */
@@ -0,0 +1,298 @@
+#!/usr/bin/env python3
+"""
+Generate the benchmark corpus in test/bench/corpus.
+
+Writes the same pseudo-English text (fixed seed, so the output never changes) as an EPUB with
+a CSS file, a TOC and one inline JPEG, an FB2 with the JPEG as a base64 <binary> shown as the
+cover and inline, a plain text file and a Markdown file. The words
+come from a fixed vocabulary with a realistic spread of lengths, so hyphenation and line
+breaking see the kind of input a novel gives them. A chapter each of pseudo-German and
+pseudo-Russian text (chapter-de.txt, chapter-ru.txt) is made the same way, for the languages
+with the largest hyphenation tries.
+
+Usage: python3 scripts/generate-bench-corpus.py
+"""
+import base64
+import zipfile
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+OUT_DIR = ROOT / "test" / "bench" / "corpus"
+IMAGE = ROOT / "docs" / "images" / "book-cover.jpg"
+
+CHAPTERS = 4
+PARAGRAPHS_PER_CHAPTER = 40
+
+VOCABULARY = """
+a about above across after again against all almost alone along already also although always
+among an and another any anything around as at away back be because become been before began
+behind being below beneath beside between beyond both but by came can cannot carried certain
+change children city close cold come could country course day did different do does done door
+down during each early earth either end enough even evening ever every eyes face far father feet
+felt few find first five followed for found four friend from full gave general girl give given
+go going gone good great ground had half hand happened hard has have he head hear heard heart
+held help her here herself high him himself his home hope horse hour house how however i if
+important in indeed into is it its itself just keep kind knew know land large last later least
+left less let life light like little long look made make man many may me mean men might mind
+more morning most mother much must my myself name near never new next night no nor not nothing
+now of off often old on once one only open or order other our out over own part people perhaps
+place point present quite rather reached read ready really received remember rest returned
+right river road room round said same saw say second see seemed seen set several shall she
+should show side since small so some something soon still stood story strange street such sun
+sure table take taken tell than that the their them themselves then there these they thing
+think this those though thought three through time to together told too took toward town tree
+true turned two under until up upon us used very voice walked wall want was watched water way
+we well went were what when where whether which while white who whole why will window with
+within without woman words work world would year yes yet you young your
+accompanied accomplishment acknowledgement administration advantageous affectionately
+afternoon agricultural announcement apprehension architecture astonishment atmosphere
+automatically beautifully bewilderment candlelight characteristic circumstances
+classification communication companionship comprehension concentration consciousness
+consequently consideration constitution contemplation conversation correspondence
+determination disappointment distinguished encouragement entertainment environment
+establishment everlasting exaggeration examination expectation experience explanation
+extraordinary faithfulness fundamentally generations gentlemanly government gratification
+handkerchief headquarters humiliation hypothetical identification illumination imagination
+immediately impossibility independence indescribable indifference individuality
+inexperienced infinitely inheritance insignificant interruption investigation
+irresistible justification knowledgeable magnificent manufacturer melancholy
+misunderstanding mountainside neighbourhood nevertheless notwithstanding occasionally
+opportunity overwhelming particularly philosophical photograph possibility predominantly
+preoccupation procrastination professional pronunciation psychological qualification
+questionable recollection recommendation relationship remembrance representative
+responsibility satisfaction sentimental significance simultaneously straightforward
+superintendent surroundings sympathetically temperament thoughtfulness transformation
+uncomfortable understanding unexpectedly unfortunately uninterrupted unquestionably
+whereabouts wonderfully café naïve façade résumé déjà fiancée
+""".split()
+
+
+# First 200 words: the short, common ones
+VOCABULARY_DE = """
+der die das und in zu den nicht von sie ist des sich mit dem dass er es ein ich auf so eine auch
+als an nach wie im für man aber aus durch wenn nur war noch werden bei hat wir was wird sein
+einen welche sind oder zur um haben einer mir über ihm diese einem ihr uns da zum kann doch vor
+dieser mich ihn du hatte seine mehr am denn nun unter sehr selbst schon hier bis habe ihre dann
+ihnen seiner alle wieder meine zeit gegen vom ganz einzelnen wo muss ohne eines können sei ja
+wurde jetzt immer seinen wohl dieses ihren würde diesen sondern weil welcher nichts diesem alles
+waren will herr viel mein also soll worden lassen dies machen ihrer weiter leben recht etwas
+keine seinem ob dir allen großen jahre weise müssen welches wäre erst einmal mann hätte zwei
+dich allein herren während paar anders menschen gut kam gab tag abend haus hand kopf tür frau
+vater mutter kind weg welt stadt nacht augen wort jahr stunde blick wasser land licht
+ging sah sagte stand lag saß nahm fand hielt ließ rief dachte fragte wusste glaubte spät
+früh kalt still dunkel leise plötzlich
+Abendgesellschaft Angelegenheiten Aufmerksamkeit Ausnahmezustand Beobachtungen
+Bewunderung Bürgermeister Dampfschifffahrt Donaudampfschifffahrtsgesellschaft
+Entschuldigung Erinnerungen Familienangehörigen Feuerwehrhauptmann Freundschaft
+Gemütlichkeit Gerechtigkeit Geschwindigkeitsbegrenzung Gesellschaft Gewissensbisse
+Handschuhschneeballwerfer Hauptbahnhof Haustürschlüssel Herzlichkeit
+Hochzeitsgesellschaft Kinderbetreuung Krankenversicherung Kreuzworträtsel
+Lebensversicherung Mannschaftsführer Merkwürdigkeiten Nachbarschaft Nachmittagskaffee
+Rechtsschutzversicherungsgesellschaften Regierungserklärung Reisegepäckaufbewahrung
+Schifffahrtsgesellschaft Schlafzimmerfenster Schwierigkeiten Selbstverständlichkeit
+Sehenswürdigkeiten Sonnenuntergang Staatsangehörigkeit Straßenbahnhaltestelle
+Unabhängigkeitserklärung Unterhaltung Verantwortung Verantwortungsbewusstsein
+Vergangenheitsbewältigung Verwandlung Wahrscheinlichkeit Weihnachtsgeschenke
+Wissenschaftler Zusammenarbeit Zusammenhang Zwischenfall außerordentlich
+aufeinanderfolgend bedauerlicherweise beziehungsweise eigentümlicherweise
+erstaunlicherweise gewissermaßen liebenswürdig merkwürdigerweise nachdenklich
+selbstverständlich ungewöhnlich unglücklicherweise unmittelbar unwiderstehlich
+verhältnismäßig vollständig wahrscheinlich widerstandsfähig zurückgekehrt
+""".split()
+
+VOCABULARY_RU = """
+и в не на я быть он с что а по это она этот к но они мы как из у который то за свой весь год
+от так о для ты же все тот мочь вы человек такой его сказать только или еще бы себя один
+как уже до время если сам когда другой вот говорить наш мой знать стать при чтобы дело
+жизнь кто первый очень два день ее новый рука даже во со раз где там под можно ну какой
+после их работа без самый потом надо хотеть ли слово идти большой должен место иметь
+ничто то сейчас тут лицо каждый друг нет теперь ни глаз тоже тогда видеть вопрос через
+да здесь дом да сторона какой-то думать сделать страна жить чем мир об последний случай
+голова более делать что-то смотреть ребенок просто конечно сила русский конец перед
+несколько вид система всегда основной ночь город земля вода отец мать дверь окно стол
+шел сидел стоял лежал взял нашел держал сказал думал знал спросил ответил молчал вечер
+утро друг брат сестра сын дочь жена муж небо снег лес поле река дорога письмо книга
+хлеб свет голос сердце душа память тишина улица солнце ветер дождь поезд лето зима осень
+весна сад мост
+Благодарность Впечатление Высокопревосходительство Государственный Достопримечательность
+Исследование Катастрофический Квалифицированный Неприкосновенность Ненавистничество
+Обстоятельство Ответственность Переосвидетельствование Предварительный Представительство
+Преимущественно Приблизительно Противоположность Рассудительность Самостоятельность
+Соответствующий Сосредоточенность Существование Трудоспособность Удовлетворительный
+Человеконенавистничество Электрификация безотлагательно безукоризненно великодушный
+воспоминание гостеприимство действительно доброжелательный единомышленник
+достоинство заинтересованность здравоохранение известность интеллигентный
+любознательность многочисленный мужественный наблюдательность недоразумение
+неопределенность неудовлетворительный необыкновенный неожиданно обязательство
+одновременно оправдательный осторожность отвратительный переписываться
+подозрительный покровительство посредственность превосходительство преподаватель
+промышленность разочарование размышление расположение распоряжение рассуждение
+собеседник сочувствие справедливость старательно строительство торжественный
+удивительно управляющий характеристика художественный чрезвычайно
+""".split()
+
+
+class Rng:
+    """Small LCG, so the corpus doesn't depend on the Python version's random module."""
+
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self, n):
+        self.state = (self.state * 6364136223846793005 + 1442695040888963407) % (1 << 64)
+        return (self.state >> 33) % n
+
+
+def sentence(rng, vocabulary=VOCABULARY):
+    words = [vocabulary[rng.next(len(vocabulary))] for _ in range(6 + rng.next(18))]
+    # Short words dominate real text; long ones are picked less often
+    words = [w if len(w) < 10 or rng.next(3) == 0 else vocabulary[rng.next(200)] for w in words]
+    if rng.next(4) == 0:
+        cut = 2 + rng.next(len(words) - 3)
+        words[cut] += ","
+    text = " ".join(words)
+    return text[0].upper() + text[1:] + (".", ".", ".", "?", "!")[rng.next(5)]
+
+
+def paragraph(rng, vocabulary=VOCABULARY):
+    return " ".join(sentence(rng, vocabulary) for _ in range(2 + rng.next(6)))
+
+
+def build_book():
+    rng = Rng(20240611)
+    return [
+        (f"Chapter {c + 1}", [paragraph(rng) for _ in range(PARAGRAPHS_PER_CHAPTER)])
+        for c in range(CHAPTERS)
+    ]
+
+
+def build_chapter(seed, title, vocabulary):
+    rng = Rng(seed)
+    return [(title, [paragraph(rng, vocabulary) for _ in range(PARAGRAPHS_PER_CHAPTER)])]
+
+
+def write_epub(path, book):
+    css = "p { text-indent: 1.5em; margin: 0; text-align: justify; }\nh1 { text-align: center; }\n" \
+          ".first { text-indent: 0; }\nem { font-style: italic; }\n"
+    manifest = ['<item id="css" href="style.css" media-type="text/css"/>',
+                '<item id="ncx" href="toc.ncx" media-type="application/x-dtbncx+xml"/>',
+                '<item id="img" href="images/cover.jpg" media-type="image/jpeg"/>']
+    spine = []
+    nav = []
+    chapters = {}
+    for i, (title, paragraphs) in enumerate(book, 1):
+        body = [f"<h1>{title}</h1>"]
+        for j, text in enumerate(paragraphs):
+            if j == 0:
+                body.append(f'<p class="first">{text}</p>')
+            elif j % 7 == 3:
+                half = len(text) // 2
+                cut = text.index(" ", half)
+                body.append(f"<p>{text[:cut]} <em>{text[cut + 1:]}</em></p>")
+            else:
+                body.append(f"<p>{text}</p>")
+            if i == 1 and j == 5:
+                body.append('<div><img src="images/cover.jpg" alt="Cover"/></div>')
+        chapters[f"OEBPS/c{i}.xhtml"] = (
+            '<?xml version="1.0" encoding="utf-8"?>\n'
+            '<html xmlns="http://www.w3.org/1999/xhtml"><head>'
+            f'<title>{title}</title><link rel="stylesheet" type="text/css" href="style.css"/></head>\n'
+            "<body>\n" + "\n".join(body) + "\n</body></html>\n")
+        manifest.append(f'<item id="c{i}" href="c{i}.xhtml" media-type="application/xhtml+xml"/>')
+        spine.append(f'<itemref idref="c{i}"/>')
+        nav.append(f'<navPoint id="n{i}" playOrder="{i}"><navLabel><text>{title}</text></navLabel>'
+                   f'<content src="c{i}.xhtml"/></navPoint>')
+
+    opf = ('<?xml version="1.0" encoding="utf-8"?>\n'
+           '<package xmlns="http://www.idpf.org/2007/opf" version="2.0" unique-identifier="id">\n'
+           '<metadata xmlns:dc="http://purl.org/dc/elements/1.1/"><dc:title>Benchmark Corpus</dc:title>'
+           '<dc:creator>Papyrix</dc:creator><dc:language>en</dc:language>'
+           '<dc:identifier id="id">papyrix-bench-corpus</dc:identifier></metadata>\n'
+           "<manifest>" + "".join(manifest) + "</manifest>\n"
+           '<spine toc="ncx">' + "".join(spine) + "</spine>\n</package>\n")
+    ncx = ('<?xml version="1.0" encoding="utf-8"?>\n'
+           '<ncx xmlns="http://www.daisy.org/z3986/2005/ncx/" version="2005-1"><head/>'
+           "<docTitle><text>Benchmark Corpus</text></docTitle><navMap>" + "".join(nav) + "</navMap></ncx>\n")
+    container = ('<?xml version="1.0"?>\n'
+                 '<container version="1.0" xmlns="urn:oasis:names:tc:opendocument:xmlns:container">'
+                 '<rootfiles><rootfile full-path="OEBPS/content.opf" media-type="application/oebps-package+xml"/>'
+                 "</rootfiles></container>\n")
+
+    with zipfile.ZipFile(path, "w") as z:
+        def add(name, data, compress=zipfile.ZIP_DEFLATED):
+            info = zipfile.ZipInfo(name, date_time=(2024, 1, 1, 0, 0, 0))
+            info.compress_type = compress
+            z.writestr(info, data)
+
+        add("mimetype", "application/epub+zip", zipfile.ZIP_STORED)
+        add("META-INF/container.xml", container)
+        add("OEBPS/content.opf", opf)
+        add("OEBPS/toc.ncx", ncx)
+        add("OEBPS/style.css", css)
+        for name, data in chapters.items():
+            add(name, data)
+        add("OEBPS/images/cover.jpg", IMAGE.read_bytes(), zipfile.ZIP_STORED)
+
+
+def write_fb2(path, book):
+    sections = []
+    for i, (title, paragraphs) in enumerate(book):
+        body = [f"<p>{text}</p>" for text in paragraphs]
+        if i == 1:
+            # The same illustration as the EPUB, between paragraphs of the second chapter
+            body.insert(6, '<image l:href="#cover.jpg"/>')
+        body = "".join(body)
+        sections.append(f"<section><title><p>{title}</p></title>{body}</section>")
+    # Binaries come after the body and are usually most of the file, as in real FB2 books
+    data = base64.b64encode(IMAGE.read_bytes()).decode("ascii")
+    lines = "\n".join(data[i:i + 76] for i in range(0, len(data), 76))
+    path.write_text(
+        '<?xml version="1.0" encoding="utf-8"?>\n'
+        '<FictionBook xmlns="http://www.gribuser.ru/xml/fictionbook/2.0" xmlns:l="http://www.w3.org/1999/xlink">\n'
+        "<description><title-info><author><first-name>Papyrix</first-name><last-name>Bench</last-name></author>"
+        "<book-title>Benchmark Corpus</book-title><coverpage><image l:href=\"#cover.jpg\"/></coverpage>"
+        "<lang>en</lang></title-info></description>\n"
+        "<body>\n" + "\n".join(sections) + "\n</body>\n"
+        f'<binary id="cover.jpg" content-type="image/jpeg">\n{lines}\n</binary>\n</FictionBook>\n', encoding="utf-8")
+
+
+def write_txt(path, book):
+    parts = []
+    for title, paragraphs in book:
+        parts.append(title.upper())
+        parts.extend(paragraphs)
+    path.write_text("\n\n".join(parts) + "\n", encoding="utf-8")
+
+
+def write_md(path, book):
+    parts = ["# Benchmark Corpus"]
+    for title, paragraphs in book:
+        parts.append(f"## {title}")
+        for j, text in enumerate(paragraphs):
+            if j % 9 == 4:
+                words = text.split(" ")
+                words[1] = f"**{words[1]}**"
+                words[3] = f"*{words[3]}*"
+                text = " ".join(words)
+            if j % 13 == 6:
+                parts.append("\n".join(f"- {s.strip()}" for s in text.split(".") if s.strip()))
+            else:
+                parts.append(text)
+    path.write_text("\n\n".join(parts) + "\n", encoding="utf-8")
+
+
+def main():
+    OUT_DIR.mkdir(parents=True, exist_ok=True)
+    book = build_book()
+    write_epub(OUT_DIR / "book.epub", book)
+    write_fb2(OUT_DIR / "book.fb2", book)
+    write_txt(OUT_DIR / "book.txt", book)
+    write_md(OUT_DIR / "book.md", book)
+    write_txt(OUT_DIR / "chapter-de.txt", build_chapter(20240612, "Kapitel 1", VOCABULARY_DE))
+    write_txt(OUT_DIR / "chapter-ru.txt", build_chapter(20240613, "Глава 1", VOCABULARY_RU))
+    for f in sorted(OUT_DIR.iterdir()):
+        print(f"{f.relative_to(ROOT)}: {f.stat().st_size} bytes")
+
+
+if __name__ == "__main__":
+    main()
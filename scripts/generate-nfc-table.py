@@ -1,13 +1,18 @@
 #!/usr/bin/env python3
 """Generate NFC composition table for UTF-8 normalization.
 
-Outputs lib/Utf8/Utf8NfcTable.h — a PROGMEM sorted array of {base, combining, result}
-tuples covering compositions for codepoints our fonts actually have (Latin, Greek,
-Cyrillic ranges up to U+04FF, plus common combining marks).
+Outputs lib/Utf8/src/Utf8NfcTable.h with two PROGMEM tables covering compositions for
+codepoints our fonts actually have (Latin, Greek, Cyrillic ranges up to U+04FF, plus
+common combining marks):
+
+- A quick check bitmap of the codepoints that can be the second half of a composition
+  (NFC_QC=Maybe, restricted to this table). Text without any of them is already NFC.
+- The {base, combining, result} tuples in a hash-and-displace perfect hash, so a pair is
+  looked up with two hashes and one compare.
 
 Usage:
-    python3 scripts/generate-nfc-table.py > lib/Utf8/Utf8NfcTable.h
-    # or:  uv run scripts/generate-nfc-table.py > lib/Utf8/Utf8NfcTable.h
+    python3 scripts/generate-nfc-table.py > lib/Utf8/src/Utf8NfcTable.h
+    # or:  uv run scripts/generate-nfc-table.py > lib/Utf8/src/Utf8NfcTable.h
 """
 
 import unicodedata
@@ -70,15 +75,99 @@ def get_canonical_compositions():
     return compositions
 
 
+# Perfect hash parameters. The key is (base << 16 | combining); a key's bucket comes from the
+# low bits of its hash and its slot from the high bits of the hash reseeded with the bucket's
+# displacement. Must match nfcHashMix() and the lookup in Utf8Nfc.cpp.
+HASH_SLOT_BITS = 10
+HASH_BUCKETS = 256
+MASK32 = 0xFFFFFFFF
+
+
+def hash_mix(k):
+    k = (k * 0x9E3779B1) & MASK32
+    k ^= k >> 15
+    k = (k * 0x85EBCA77) & MASK32
+    k ^= k >> 13
+    return k
+
+
+def hash_slot(key, displacement):
+    return hash_mix(key ^ ((displacement * 0x9E3779B9) & MASK32)) >> (32 - HASH_SLOT_BITS)
+
+
+def build_perfect_hash(compositions):
+    """Place every composition in its own slot. Returns (displacements, slots)."""
+    buckets = [[] for _ in range(HASH_BUCKETS)]
+    for entry in compositions:
+        key = (entry[0] << 16) | entry[1]
+        buckets[hash_mix(key) & (HASH_BUCKETS - 1)].append(entry)
+
+    slots = [None] * (1 << HASH_SLOT_BITS)
+    displacements = [0] * HASH_BUCKETS
+    # Fullest buckets first, while there is the most room
+    for bucket in sorted(range(HASH_BUCKETS), key=lambda b: -len(buckets[b])):
+        entries = buckets[bucket]
+        if not entries:
+            continue
+        for d in range(256):
+            placed = [hash_slot((e[0] << 16) | e[1], d) for e in entries]
+            if len(set(placed)) == len(placed) and all(slots[s] is None for s in placed):
+                for s, e in zip(placed, entries):
+                    slots[s] = e
+                displacements[bucket] = d
+                break
+        else:
+            sys.exit(f"No displacement fits bucket {bucket}; raise HASH_SLOT_BITS")
+    return displacements, slots
+
+
+def build_quick_check(compositions):
+    """Two-level bitmap over the BMP. Returns (index, blocks); block 0 is all clear."""
+    marks = sorted({combining for _, combining, _ in compositions})
+    blocks = [[0] * 8]
+    index = [0] * 256
+    for hi in sorted({m >> 8 for m in marks}):
+        words = [0] * 8
+        for m in marks:
+            if m >> 8 == hi:
+                words[(m & 0xFF) >> 5] |= 1 << (m & 31)
+        index[hi] = len(blocks)
+        blocks.append(words)
+    return index, blocks
+
+
+def fit_line(line, head, tail, limit=120):
+    """Wrap a table entry the way clang-format does at the column limit: break inside the
+    braces if that makes it fit, otherwise reflow the trailing comment."""
+    if len(line) <= limit:
+        return line
+    if len(tail) <= limit:
+        return f"{head}\n{tail}"
+    code, comment = line.split("  // ", 1)
+    indent = " " * (len(code) + 2)
+    out, current = [], f"{code}  //"
+    for word in comment.split():
+        if len(current) + 1 + len(word) > limit:
+            out.append(current)
+            current = f"{indent}//"
+        current += f" {word}"
+    out.append(current)
+    return "\n".join(out)
+
+
 def main():
     compositions = get_canonical_compositions()
+    displacements, slots = build_perfect_hash(compositions)
+    qc_index, qc_blocks = build_quick_check(compositions)
+    flash = len(slots) * 6 + len(displacements) + len(qc_index) + len(qc_blocks) * 32
 
     print("#pragma once")
     print()
     print("// Auto-generated by scripts/generate-nfc-table.py")
-    print("// Canonical NFC composition table for Latin, Greek, Cyrillic ranges.")
-    print(f"// {len(compositions)} entries, ~{len(compositions) * 6} bytes in flash.")
+    print("// NFC quick check and canonical composition tables for Latin, Greek, Cyrillic ranges.")
+    print(f"// {len(compositions)} compositions in {len(slots)} hash slots, ~{flash} bytes in flash.")
     print()
+    print("#include <cstddef>")
     print("#include <cstdint>")
     print()
     print("#ifdef ESP_PLATFORM")
@@ -95,21 +184,55 @@ def main():
     print("  uint16_t result;")
     print("};")
     print()
+    print("// Quick check: codepoints that can be the second half of a composition below. Bit cp & 0xFF of")
+    print("// block NFC_QC_INDEX[cp >> 8]; block 0 is all clear. Nothing outside the BMP composes.")
+    print("constexpr uint32_t NFC_QC_LIMIT = 0x10000;")
+    print()
+    print("static const uint8_t NFC_QC_INDEX[256] PROGMEM = {")
+    for row in range(0, 256, 16):
+        print("    " + " ".join(f"{v}," for v in qc_index[row:row + 16]))
+    print("};")
+    print()
+    print(f"static const uint32_t NFC_QC_BLOCKS[{len(qc_blocks)}][8] PROGMEM = {{")
+    for words in qc_blocks:
+        print("    {" + ", ".join(f"0x{w:08X}" for w in words) + "},")
+    print("};")
+    print()
+    print("// Composition: perfect hash over (base << 16 | combining). The bucket is the low bits of")
+    print("// nfcHashMix(key); the slot is the high bits of nfcHashMix(key ^ displacement * 0x9E3779B9).")
+    print("// Empty slots are {0, 0, 0}.")
     print(f"constexpr size_t NFC_TABLE_SIZE = {len(compositions)};")
+    print(f"constexpr uint32_t NFC_HASH_SLOT_BITS = {HASH_SLOT_BITS};")
+    print(f"constexpr uint32_t NFC_HASH_BUCKETS = {HASH_BUCKETS};")
     print()
-    print("static const NfcComposition NFC_TABLE[] PROGMEM = {")
-
-    for base, combining, result in compositions:
-        base_char = chr(base)
+    print("inline uint32_t nfcHashMix(uint32_t k) {")
+    print("  k *= 0x9E3779B1u;")
+    print("  k ^= k >> 15;")
+    print("  k *= 0x85EBCA77u;")
+    print("  k ^= k >> 13;")
+    print("  return k;")
+    print("}")
+    print()
+    print(f"static const uint8_t NFC_HASH_DISPLACEMENT[{HASH_BUCKETS}] PROGMEM = {{")
+    for row in range(0, HASH_BUCKETS, 16):
+        print("    " + " ".join(f"{v}," for v in displacements[row:row + 16]))
+    print("};")
+    print()
+    print(f"static const NfcComposition NFC_HASH_TABLE[{len(slots)}] PROGMEM = {{")
+    for slot in slots:
+        if slot is None:
+            print("    {0x0000, 0x0000, 0x0000},")
+            continue
+        base, combining, result = slot
         combining_name = unicodedata.name(chr(combining), "?")
-        result_char = chr(result)
         result_name = unicodedata.name(chr(result), "?")
-        print(f"    {{0x{base:04X}, 0x{combining:04X}, 0x{result:04X}}},  "
-              f"// {base_char} + {combining_name} = {result_char} ({result_name})")
-
+        comment = f"// {chr(base)} + {combining_name} = {chr(result)} ({result_name})"
+        line = f"    {{0x{base:04X}, 0x{combining:04X}, 0x{result:04X}}},  {comment}"
+        print(fit_line(line, f"    {{0x{base:04X}, 0x{combining:04X},", f"     0x{result:04X}}},  {comment}"))
     print("};")
 
-    print(f"\n// Total: {len(compositions)} compositions", file=sys.stderr)
+    print(f"\n// Total: {len(compositions)} compositions, {len(qc_blocks) - 1} quick check blocks",
+          file=sys.stderr)
 
 
 if __name__ == "__main__":
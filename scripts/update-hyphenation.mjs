@@ -1,17 +1,25 @@
 #!/usr/bin/env node
 // Downloads binary tries from typst/hypher and generates C headers.
-// Usage: node scripts/update-hyphenation.mjs [lang...]
+// Each header holds an Aho-Corasick automaton built from the trie, which is what the device matches
+// words against (see lib/Hyphenation/src/HyphenationAutomaton.h). The trie itself is not kept.
+// Usage: node scripts/update-hyphenation.mjs [--from <dir>] [lang...]
 //   node scripts/update-hyphenation.mjs ru en
+//   node scripts/update-hyphenation.mjs --from ../hypher/tries    (read <lang>.bin there, no download)
 
-import { writeFileSync, mkdirSync } from "fs";
+import { mkdirSync, readFileSync, writeFileSync } from "fs";
 import { dirname, resolve } from "path";
 import { fileURLToPath } from "url";
 
 const __dirname = dirname(fileURLToPath(import.meta.url));
 const PROJECT_ROOT = resolve(__dirname, "..");
-const OUTPUT_DIR = resolve(PROJECT_ROOT, "lib/Hyphenation/generated");
+const OUTPUT_DIR = resolve(PROJECT_ROOT, "lib/Hyphenation/src/generated");
 const DEFAULT_LANGUAGES = ["de", "en", "es", "fr", "it", "ru", "uk"];
 const BYTES_PER_LINE = 19;
+const WORDS_PER_LINE = 16;
+// States up to the BFS depth that keeps at most this many of them get a full transition row
+const DENSE_STATE_BUDGET = 128;
+// Largest block of states whose first children are stored as 8-bit offsets from a shared base
+const MAX_CHILD_BLOCK_SHIFT = 8;
 const BASE_URL =
   "https://github.com/typst/hypher/raw/refs/heads/main/tries/";
 
@@ -30,6 +38,183 @@ function formatBytes(buf) {
   return lines.join("\n");
 }
 
+function formatWords(values) {
+  const lines = [];
+  for (let i = 0; i < values.length; i += WORDS_PER_LINE) {
+    lines.push(`    ${Array.from(values.slice(i, i + WORDS_PER_LINE)).join(", ")},`);
+  }
+  if (lines.length === 0) {
+    lines.push("    0,");
+  }
+  return lines.join("\n");
+}
+
+// One node of the serialized trie; mirrors decodeState() in the old device matcher
+function decodeNode(data, addr) {
+  let pos = addr;
+  const header = data[pos++];
+  const hasLevels = (header >> 7) !== 0;
+  const stride = ((header >> 5) & 0x03) || 1;
+  let childCount = header & 0x1f;
+  if (childCount === 31) {
+    childCount = data[pos++];
+  }
+
+  let levelRef = 0;
+  if (hasLevels) {
+    const offsetHi = data[pos++];
+    const offsetLoLen = data[pos++];
+    const offset = (offsetHi << 4) | (offsetLoLen >> 4);
+    const length = offsetLoLen & 0x0f;
+    if (offset < 4) {
+      throw new Error(`Bad levels at node ${addr}`);
+    }
+    // An empty level list sets nothing, the same as none
+    levelRef = length === 0 ? 0 : ((offset - 4) << 4) | length;
+  }
+
+  const children = [];
+  const targets = pos + childCount;
+  for (let i = 0; i < childCount; i++) {
+    const at = targets + i * stride;
+    let delta;
+    if (stride === 1) {
+      delta = (data[at] << 24) >> 24;
+    } else if (stride === 2) {
+      delta = ((data[at] << 24) | (data[at + 1] << 16)) >> 16;
+    } else {
+      delta = ((data[at] << 16) | (data[at + 1] << 8) | data[at + 2]) - (1 << 23);
+    }
+    children.push({ letter: data[pos + i], addr: addr + delta });
+  }
+  children.sort((a, b) => a.letter - b.letter);
+  return { levelRef, children };
+}
+
+// Expands the trie (a DAG: shared suffixes are stored once) into a tree numbered breadth-first, so
+// the children of every state are consecutive, and adds failure links.
+function buildAutomaton(data, rootAddr) {
+  const letters = new Set();
+  const label = [0];
+  const depth = [0];
+  const levelRef = [0];
+  const parent = [0];
+  const firstChild = [];
+  const nodeAddr = [rootAddr];
+  const childLists = [];
+
+  for (let state = 0; state < nodeAddr.length; state++) {
+    const node = decodeNode(data, nodeAddr[state]);
+    if (state > 0) levelRef[state] = node.levelRef;
+    firstChild.push(nodeAddr.length);
+    childLists.push(node.children);
+    for (const child of node.children) {
+      letters.add(child.letter);
+      label.push(child.letter);
+      depth.push(depth[state] + 1);
+      levelRef.push(0);
+      parent.push(state);
+      nodeAddr.push(child.addr);
+    }
+  }
+  const stateCount = nodeAddr.length;
+  firstChild.push(stateCount);
+  if (stateCount > 0xffff) {
+    throw new Error(`${stateCount} states do not fit 16-bit state numbers`);
+  }
+
+  // Symbols: 1.. for the bytes patterns use, in byte order; 0 for every other byte
+  const symbols = new Uint8Array(256);
+  [...letters].sort((a, b) => a - b).forEach((letter, i) => (symbols[letter] = i + 1));
+  const symbolCount = letters.size + 1;
+  for (let state = 1; state < stateCount; state++) {
+    label[state] = symbols[label[state]];
+  }
+
+  const childFor = (state, symbol) => {
+    for (let child = firstChild[state]; child < firstChild[state + 1]; child++) {
+      if (label[child] === symbol) return child;
+    }
+    return -1;
+  };
+  const step = (state, symbol) => {
+    for (;;) {
+      const child = childFor(state, symbol);
+      if (child >= 0) return child;
+      if (state === 0) return 0;
+      state = fail[state];
+    }
+  };
+
+  // BFS order means a state's failure target (which is shallower) is always resolved first
+  const fail = new Uint16Array(stateCount);
+  for (let state = 1; state < stateCount; state++) {
+    const from = parent[state];
+    fail[state] = from === 0 ? 0 : step(fail[from], label[state]);
+  }
+
+  let denseStates = 1;
+  while (denseStates < stateCount) {
+    let next = denseStates;
+    while (next < stateCount && depth[next] === depth[denseStates]) next++;
+    if (next > DENSE_STATE_BUDGET) break;
+    denseStates = next;
+  }
+  const dense = new Uint16Array(denseStates * symbolCount);
+  for (let state = 0; state < denseStates; state++) {
+    for (let symbol = 1; symbol < symbolCount; symbol++) {
+      dense[state * symbolCount + symbol] = step(state, symbol);
+    }
+  }
+
+  // Each pattern's record is its length in bytes, then its levels as in the trie. Records are shared
+  // by all states that end a pattern of the same length with the same levels.
+  const levelData = [];
+  const records = new Map();
+  const levels = new Uint16Array(stateCount);
+  for (let state = 1; state < stateCount; state++) {
+    const ref = levelRef[state];
+    if (ref === 0) continue;
+    const record = [depth[state], ...data.subarray(ref >> 4, (ref >> 4) + (ref & 0x0f))];
+    const key = record.join(",");
+    if (!records.has(key)) {
+      records.set(key, levelData.length);
+      levelData.push(...record);
+    }
+    levels[state] = (records.get(key) << 4) | (ref & 0x0f);
+  }
+  if (levelData.length > 0xfff) {
+    throw new Error(`${levelData.length} bytes of levels do not fit 12-bit offsets`);
+  }
+
+  // firstChild only grows, so blocks of states share a 16-bit base and keep an 8-bit offset from it
+  let childBlockShift = MAX_CHILD_BLOCK_SHIFT;
+  const fitsBlocks = (shift) =>
+    firstChild.every((child, state) => child - firstChild[(state >> shift) << shift] <= 0xff);
+  while (childBlockShift > 0 && !fitsBlocks(childBlockShift)) childBlockShift--;
+  if (!fitsBlocks(childBlockShift)) {
+    throw new Error("A state has more than 255 children");
+  }
+  const childBase = new Uint16Array((stateCount >> childBlockShift) + 1);
+  for (let block = 0; block < childBase.length; block++) childBase[block] = firstChild[block << childBlockShift];
+  const childOffset = Uint8Array.from(firstChild, (child, state) => child - childBase[state >> childBlockShift]);
+
+  return {
+    symbols,
+    symbolCount,
+    denseStates,
+    dense,
+    stateCount,
+    label: Uint8Array.from(label),
+    childBlockShift,
+    childBase,
+    childOffset,
+    fail,
+    levels,
+    levelData: Uint8Array.from(levelData),
+  };
+}
+
 function writeHeader(outputPath, blob, symbol) {
   if (blob.length < 4) {
     throw new Error(`Blob too small: ${blob.length} bytes`);
@@ -44,34 +229,68 @@ function writeHeader(outputPath, blob, symbol) {
     );
   }
 
-  const data = blob.subarray(4);
-  const bytesLiteral = formatBytes(data);
-  const rootAddrNew = rootAddr - 4;
-  const dataSymbol = `${symbol}_trie_data`;
-  const patternsSymbol = `${symbol}_patterns`;
-  const rootHex = `0x${rootAddrNew.toString(16).toUpperCase().padStart(2, "0")}`;
+  const automaton = buildAutomaton(blob.subarray(4), rootAddr - 4);
 
   const content = `#pragma once
 
 #include <cstddef>
 #include <cstdint>
 
-#include "../SerializedHyphenationTrie.h"
+#include "../HyphenationAutomaton.h"
 
 // Auto-generated by update-hyphenation.mjs. Do not edit manually.
-alignas(4) constexpr uint8_t ${dataSymbol}[] = {
-${bytesLiteral}
+// Aho-Corasick automaton for the hypher patterns: ${automaton.stateCount} states, ${automaton.denseStates} dense.
+constexpr uint8_t ${symbol}_symbols[] = {
+${formatBytes(automaton.symbols)}
+};
+
+constexpr uint16_t ${symbol}_dense[] = {
+${formatWords(automaton.dense)}
 };
 
-constexpr SerializedHyphenationPatterns ${patternsSymbol} = {
-    ${rootHex}u,
-    ${dataSymbol},
-    sizeof(${dataSymbol}),
+constexpr uint8_t ${symbol}_label[] = {
+${formatBytes(automaton.label)}
+};
+
+constexpr uint16_t ${symbol}_child_base[] = {
+${formatWords(automaton.childBase)}
+};
+
+constexpr uint8_t ${symbol}_child_offset[] = {
+${formatBytes(automaton.childOffset)}
+};
+
+constexpr uint16_t ${symbol}_fail[] = {
+${formatWords(automaton.fail)}
+};
+
+constexpr uint16_t ${symbol}_levels[] = {
+${formatWords(automaton.levels)}
+};
+
+constexpr uint8_t ${symbol}_level_data[] = {
+${formatBytes(automaton.levelData)}
+};
+
+constexpr HyphenationAutomaton ${symbol}_automaton = {
+    ${symbol}_symbols,
+    ${automaton.symbolCount}u,
+    ${automaton.denseStates}u,
+    ${symbol}_dense,
+    ${automaton.stateCount}u,
+    ${symbol}_label,
+    ${automaton.childBlockShift}u,
+    ${symbol}_child_base,
+    ${symbol}_child_offset,
+    ${symbol}_fail,
+    ${symbol}_levels,
+    ${symbol}_level_data,
 };
 `;
 
   mkdirSync(dirname(outputPath), { recursive: true });
   writeFileSync(outputPath, content);
+  return automaton;
 }
 
 async function downloadTrie(lang) {
@@ -85,24 +304,30 @@ async function downloadTrie(lang) {
 
 async function main() {
   const args = process.argv.slice(2);
-  const languages = args.length > 0 ? args : DEFAULT_LANGUAGES;
+  const fromIndex = args.indexOf("--from");
+  const fromDir = fromIndex >= 0 ? args[fromIndex + 1] : null;
+  if (fromIndex >= 0 && !fromDir) {
+    throw new Error("--from needs a directory");
+  }
+  const langArgs = args.filter((_, i) => fromIndex < 0 || (i !== fromIndex && i !== fromIndex + 1));
+  const languages = langArgs.length > 0 ? langArgs : DEFAULT_LANGUAGES;
 
   mkdirSync(OUTPUT_DIR, { recursive: true });
 
   for (const lang of languages) {
     process.stdout.write(`Processing language: ${lang}\n`);
 
-    const blob = await downloadTrie(lang);
+    const outputPath = resolve(OUTPUT_DIR, `hyph-${lang}.trie.h`);
+    const symbol = lang.replace(/-/g, "_");
+    const blob = fromDir ? new Uint8Array(readFileSync(resolve(fromDir, `${lang}.bin`))) : await downloadTrie(lang);
     if (blob.length === 0) {
       throw new Error(`Empty trie for language: ${lang}`);
     }
 
-    const outputPath = resolve(OUTPUT_DIR, `hyph-${lang}.trie.h`);
-    const symbol = lang.replace(/-/g, "_");
-    writeHeader(outputPath, blob, symbol);
+    const automaton = writeHeader(outputPath, blob, symbol);
 
     process.stdout.write(
-      `  Generated ${outputPath} (${blob.length} bytes payload)\n`
+      `  Generated ${outputPath} (${blob.length} bytes payload, ${automaton.stateCount} states)\n`
     );
   }
 
@@ -63,6 +63,7 @@
 #define PAPYRIX_SETTINGS_FILE PAPYRIX_DIR "/settings.bin"
 #define PAPYRIX_STATE_FILE PAPYRIX_DIR "/state.bin"
 #define PAPYRIX_WIFI_FILE PAPYRIX_DIR "/wifi.bin"
+#define PAPYRIX_LISTING_DIR PAPYRIX_CACHE_DIR "/dirs"  // File browser listings
 
 // Thumbnail dimensions for home screen
 #define THUMB_WIDTH 320
@@ -7,12 +7,39 @@
 #include <cstdio>
 #include <cstring>
 
+#include "../content/ContentHandle.h"
 #include "../core/Core.h"
 
 #define TAG "BOOKMARK"
 
 namespace papyrix {
 
+namespace {
+
+// Reopens TXT bookmarks whose section moved (file edited) in the section now holding their offset.
+// Bookmarks saved before TXT was split into sections hold a page of the whole file, about 2KB of
+// text each, as old progress.bin files do.
+void relocateTxtBookmarks(Core& core, Bookmark* bookmarks, const int count, const bool sectioned) {
+  auto* provider = core.content.asTxt();
+  if (!provider || !provider->getTxt()) return;
+  Txt* txt = provider->getTxt();
+
+  for (int i = 0; i < count; i++) {
+    Bookmark& b = bookmarks[i];
+    const uint32_t offset = sectioned ? b.flatPage : static_cast<uint32_t>(static_cast<uint16_t>(b.sectionPage)) * 2048;
+    if (sectioned && b.spineIndex >= 0 && b.spineIndex < txt->sectionCount() &&
+        txt->sectionStart(b.spineIndex) == offset) {
+      continue;
+    }
+    b.spineIndex = static_cast<int16_t>(txt->sectionForOffset(offset));
+    b.sectionPage = 0;
+    b.flatPage = txt->sectionStart(b.spineIndex);
+    LOG_DBG(TAG, "Moved TXT bookmark %d to section %d", i, b.spineIndex);
+  }
+}
+
+}  // namespace
+
 bool BookmarkManager::save(Core& core, const char* cacheDir, ContentType type, const Bookmark* bookmarks, int count) {
   if (!cacheDir || cacheDir[0] == '\0') return false;
   if (count < 0 || count > MAX_BOOKMARKS) return false;
@@ -27,8 +54,8 @@ bool BookmarkManager::save(Core& core, const char* cacheDir, ContentType type, c
     return false;
   }
 
-  uint8_t cnt = static_cast<uint8_t>(count);
-  file.write(&cnt, 1);
+  const uint8_t header[2] = {static_cast<uint8_t>(VERSION_FLAG | FILE_VERSION), static_cast<uint8_t>(count)};
+  file.write(header, sizeof(header));
   if (count > 0) {
     file.write(reinterpret_cast<const uint8_t*>(bookmarks), static_cast<size_t>(count) * sizeof(Bookmark));
   }
@@ -48,6 +75,8 @@ bool BookmarkManager::save(Core& core, const char* cacheDir, ContentType type, c
     int len = 0;
     if (type == ContentType::Epub) {
       len = snprintf(line, sizeof(line), "Ch %d, Page %d: %s\n", b.spineIndex + 1, b.sectionPage + 1, b.label);
+    } else if (type == ContentType::Txt) {
+      len = snprintf(line, sizeof(line), "Section %d, Page %d: %s\n", b.spineIndex + 1, b.sectionPage + 1, b.label);
     } else if (type == ContentType::Xtc) {
       len = snprintf(line, sizeof(line), "Page %u: %s\n", static_cast<unsigned>(b.flatPage + 1), b.label);
     } else {
@@ -62,7 +91,7 @@ bool BookmarkManager::save(Core& core, const char* cacheDir, ContentType type, c
   return true;
 }
 
-int BookmarkManager::load(Core& core, const char* cacheDir, Bookmark* bookmarks, int maxCount) {
+int BookmarkManager::load(Core& core, const char* cacheDir, ContentType type, Bookmark* bookmarks, int maxCount) {
   if (!cacheDir || cacheDir[0] == '\0') return 0;
 
   char path[280];
@@ -88,13 +117,29 @@ int BookmarkManager::load(Core& core, const char* cacheDir, Bookmark* bookmarks,
     return 0;
   }
 
+  // Versioned files have the count next; older ones start with it
+  const bool versioned = (cnt & VERSION_FLAG) != 0;
+  if (versioned) {
+    if ((cnt & ~VERSION_FLAG) != FILE_VERSION) {
+      LOG_ERR(TAG, "Unknown bookmarks file version %u", static_cast<unsigned>(cnt & ~VERSION_FLAG));
+      file.close();
+      return 0;
+    }
+    if (file.read(&cnt, 1) != 1) {
+      LOG_ERR(TAG, "Failed to read bookmark count");
+      file.close();
+      return 0;
+    }
+  }
+
   int toLoad = cnt;
   if (toLoad > maxCount) toLoad = maxCount;
   if (toLoad > MAX_BOOKMARKS) toLoad = MAX_BOOKMARKS;
 
   if (toLoad > 0) {
     size_t expected = static_cast<size_t>(toLoad) * sizeof(Bookmark);
-    if (file.size() - 1 < static_cast<int64_t>(expected)) {
+    const size_t headerSize = versioned ? 2 : 1;
+    if (file.size() - headerSize < static_cast<int64_t>(expected)) {
       LOG_ERR(TAG, "Corrupted bookmarks file (truncated)");
       file.close();
       return 0;
@@ -108,6 +153,11 @@ int BookmarkManager::load(Core& core, const char* cacheDir, Bookmark* bookmarks,
   }
 
   file.close();
+
+  if (type == ContentType::Txt) {
+    relocateTxtBookmarks(core, bookmarks, toLoad, versioned);
+  }
+
   LOG_DBG(TAG, "Loaded %d bookmarks", toLoad);
   return toLoad;
 }
@@ -115,7 +165,7 @@ int BookmarkManager::load(Core& core, const char* cacheDir, Bookmark* bookmarks,
 int BookmarkManager::findAt(const Bookmark* bookmarks, int count, ContentType type, int spineIndex, int sectionPage,
                             uint32_t flatPage) {
   for (int i = 0; i < count; i++) {
-    if (type == ContentType::Epub) {
+    if (type == ContentType::Epub || type == ContentType::Txt) {
       if (bookmarks[i].spineIndex == spineIndex && bookmarks[i].sectionPage == sectionPage) {
         return i;
       }
@@ -11,16 +11,20 @@ struct Core;
 struct Bookmark {
   int16_t spineIndex;
   int16_t sectionPage;
-  uint32_t flatPage;
+  uint32_t flatPage;  // XTC page; for TXT, the start offset of the section
   char label[64];
 };
 
 class BookmarkManager {
  public:
   static constexpr int MAX_BOOKMARKS = 20;
+  // bookmarks.bin starts with VERSION_FLAG | FILE_VERSION. Older files start with the count, and
+  // their TXT bookmarks hold a page of the whole file; they are moved to sections on load.
+  static constexpr uint8_t VERSION_FLAG = 0x80;
+  static constexpr uint8_t FILE_VERSION = 1;
 
   static bool save(Core& core, const char* cacheDir, ContentType type, const Bookmark* bookmarks, int count);
-  static int load(Core& core, const char* cacheDir, Bookmark* bookmarks, int maxCount);
+  static int load(Core& core, const char* cacheDir, ContentType type, Bookmark* bookmarks, int maxCount);
   static int findAt(const Bookmark* bookmarks, int count, ContentType type, int spineIndex, int sectionPage,
                     uint32_t flatPage);
 };
@@ -46,8 +46,26 @@ bool ProgressManager::save(Core& core, const char* cacheDir, ContentType type, c
     data[3] = (progress.flatPage >> 24) & 0xFF;
     file.write(data, 4);
     LOG_DBG(TAG, "Saved XTC: page %u", progress.flatPage);
+  } else if (type == ContentType::Txt) {
+    // TXT: section page and section (see Txt::sectionCount), then where the section starts (8 bytes)
+    data[0] = progress.sectionPage & 0xFF;
+    data[1] = (progress.sectionPage >> 8) & 0xFF;
+    data[2] = progress.spineIndex & 0xFF;
+    data[3] = (progress.spineIndex >> 8) & 0xFF;
+    file.write(data, 4);
+    uint32_t sectionStart = 0;
+    auto* provider = core.content.asTxt();
+    if (provider && provider->getTxt()) {
+      sectionStart = provider->getTxt()->sectionStart(progress.spineIndex);
+    }
+    data[0] = sectionStart & 0xFF;
+    data[1] = (sectionStart >> 8) & 0xFF;
+    data[2] = (sectionStart >> 16) & 0xFF;
+    data[3] = (sectionStart >> 24) & 0xFF;
+    file.write(data, 4);
+    LOG_DBG(TAG, "Saved TXT: section=%d page=%d", progress.spineIndex, progress.sectionPage);
   } else {
-    // TXT/Markdown: save section page (4 bytes)
+    // Markdown/FB2: save section page (4 bytes)
     data[0] = progress.sectionPage & 0xFF;
     data[1] = (progress.sectionPage >> 8) & 0xFF;
     data[2] = 0;
@@ -99,8 +117,30 @@ ProgressManager::Progress ProgressManager::load(Core& core, const char* cacheDir
   } else if (type == ContentType::Xtc) {
     progress.flatPage = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
     LOG_DBG(TAG, "Loaded XTC: page %u", progress.flatPage);
+  } else if (type == ContentType::Txt) {
+    progress.sectionPage = data[0] | (data[1] << 8);
+    progress.spineIndex = data[2] | (data[3] << 8);
+    auto* provider = core.content.asTxt();
+    if (provider && provider->getTxt()) {
+      Txt* txt = provider->getTxt();
+      uint32_t sectionStart;
+      if (file.read(data, 4) == 4) {
+        sectionStart = data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+      } else {
+        // Saved before TXT was split into sections: a page of the whole file, about 2KB of text each
+        sectionStart = static_cast<uint32_t>(progress.sectionPage) * 2048;
+        progress.spineIndex = -1;
+      }
+      // Sections moved (file edited, or saved before sections): reopen the one holding that offset
+      if (progress.spineIndex < 0 || progress.spineIndex >= txt->sectionCount() ||
+          txt->sectionStart(progress.spineIndex) != sectionStart) {
+        progress.spineIndex = txt->sectionForOffset(sectionStart);
+        progress.sectionPage = 0;
+      }
+    }
+    LOG_DBG(TAG, "Loaded TXT: section=%d page=%d", progress.spineIndex, progress.sectionPage);
   } else {
-    // TXT/Markdown
+    // Markdown/FB2
     progress.sectionPage = data[0] | (data[1] << 8);
     LOG_DBG(TAG, "Loaded text: page %d", progress.sectionPage);
   }
@@ -131,8 +171,21 @@ ProgressManager::Progress ProgressManager::validate(Core& core, ContentType type
     if (validated.flatPage >= total) {
       validated.flatPage = total > 0 ? total - 1 : 0;
     }
+  } else if (type == ContentType::Txt) {
+    // Validate section
+    auto* provider = core.content.asTxt();
+    if (provider && provider->getTxt()) {
+      const int sectionCount = provider->getTxt()->sectionCount();
+      if (validated.spineIndex < 0) {
+        validated.spineIndex = 0;
+      }
+      if (validated.spineIndex >= sectionCount) {
+        validated.spineIndex = sectionCount - 1;
+        validated.sectionPage = 0;
+      }
+    }
   }
-  // TXT/Markdown: page validation happens during cache creation
+  // Page validation within a section happens during cache creation
 
   return validated;
 }
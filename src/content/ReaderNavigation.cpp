@@ -35,6 +35,20 @@ ReaderNavigation::NavResult ReaderNavigation::next(ContentType type, const Posit
       result.needsCacheReset = true;
       result.needsRender = true;
     }
+  } else if (type == ContentType::Txt) {
+    if (pageCount > 0 && current.sectionPage < pageCount - 1) {
+      result.position.sectionPage = current.sectionPage + 1;
+      result.needsRender = true;
+    } else if (cache && cache->isPartial()) {
+      result.position.sectionPage = current.sectionPage + 1;
+      result.needsRender = true;
+    } else if (current.spineIndex + 1 < static_cast<int>(totalPages)) {
+      // Section complete (or laid out to no pages) - move to the next one
+      result.position.spineIndex = current.spineIndex + 1;
+      result.position.sectionPage = 0;
+      result.needsCacheReset = true;
+      result.needsRender = true;
+    }
   } else {
     if (pageCount > 0 && current.sectionPage < pageCount - 1) {
       result.position.sectionPage = current.sectionPage + 1;
@@ -59,7 +73,7 @@ ReaderNavigation::NavResult ReaderNavigation::prev(ContentType type, const Posit
       result.position.flatPage = current.flatPage - 1;
       result.needsRender = true;
     }
-  } else if (type == ContentType::Epub) {
+  } else if (type == ContentType::Epub || type == ContentType::Txt) {
     if (current.sectionPage > 0) {
       result.position.sectionPage = current.sectionPage - 1;
       result.needsRender = true;
@@ -28,14 +28,15 @@ class ReaderNavigation {
 
   // Navigate forward one page
   // For EPUB: advances within section or to next chapter
-  // For XTC: increments flat page number
-  // For TXT/Markdown: advances section page
+  // For XTC: increments flat page number (totalPages = page count)
+  // For TXT: advances within section or to the next one (totalPages = section count, see Txt::sectionCount)
+  // For Markdown: advances section page
   static NavResult next(ContentType type, const Position& current, const PageCache* cache, uint32_t totalPages);
 
   // Navigate backward one page
-  // For EPUB: goes back within section or to previous chapter
+  // For EPUB/TXT: goes back within section or to previous chapter/section
   // For XTC: decrements flat page number
-  // For TXT/Markdown: decrements section page
+  // For Markdown: decrements section page
   static NavResult prev(ContentType type, const Position& current, const PageCache* cache);
 
   // Check if cache needs extension for the given page
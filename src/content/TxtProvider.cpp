@@ -49,11 +49,8 @@ void TxtProvider::close() {
 uint32_t TxtProvider::pageCount() const {
   if (!txt) return 0;
 
-  // Estimate pages based on file size
-  // Each page shows approximately 2KB of text
-  constexpr size_t BYTES_PER_PAGE = 2048;
-  size_t fileSize = txt->getFileSize();
-  return (fileSize + BYTES_PER_PAGE - 1) / BYTES_PER_PAGE;
+  // Counted per section as they get laid out, estimated from file size elsewhere
+  return txt->approxPageCount();
 }
 
 }  // namespace papyrix
@@ -1,6 +1,7 @@
 #include "XtcProvider.h"
 
 #include <CoverHelpers.h>
+#include <FsHelpers.h>
 #include <HardwareSerial.h>
 #include <SDCardManager.h>
 #include <XtcCoverHelper.h>
@@ -45,8 +46,8 @@ Result<void> XtcProvider::open(const char* path, const char* cacheDir) {
   // Create cache path for progress saving
   if (cacheDir && cacheDir[0] != '\0') {
     std::string pathStr(path);
-    size_t hash = std::hash<std::string>{}(pathStr);
-    snprintf(meta.cachePath, sizeof(meta.cachePath), "%s/xtc_%zu", cacheDir, hash);
+    const uint32_t hash = FsHelpers::pathHash(pathStr);
+    snprintf(meta.cachePath, sizeof(meta.cachePath), "%s/xtc_%lu", cacheDir, static_cast<unsigned long>(hash));
     SdMan.mkdir(meta.cachePath);
   } else {
     meta.cachePath[0] = '\0';
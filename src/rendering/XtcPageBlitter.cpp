@@ -0,0 +1,143 @@
+#include "XtcPageBlitter.h"
+
+#include <EInkDisplay.h>
+
+namespace papyrix {
+
+namespace {
+
+inline uint8_t reverseBits(uint8_t b) {
+  b = static_cast<uint8_t>((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+  b = static_cast<uint8_t>((b & 0xCC) >> 2 | (b & 0x33) << 2);
+  b = static_cast<uint8_t>((b & 0xAA) >> 1 | (b & 0x55) << 1);
+  return b;
+}
+
+inline void applyByte(uint8_t& fb, const uint8_t ink, const uint8_t mask, const XtcPageBlitter::Op op) {
+  switch (op) {
+    case XtcPageBlitter::Op::Black:
+      fb &= static_cast<uint8_t>(~(ink & mask));
+      break;
+    case XtcPageBlitter::Op::Mark:
+      fb |= ink & mask;
+      break;
+    case XtcPageBlitter::Op::Toggle:
+      fb ^= ink & mask;
+      break;
+    case XtcPageBlitter::Op::MarkIfClear:
+      fb = static_cast<uint8_t>((fb & ~mask) | (~fb & ink & mask));
+      break;
+  }
+}
+
+}  // namespace
+
+XtcPageBlitter::XtcPageBlitter(uint8_t* frameBuffer, const Transform& transform, const int screenWidth,
+                               const int screenHeight, const uint16_t pageWidth, const uint16_t pageHeight)
+    : frameBuffer_(frameBuffer),
+      t_(transform),
+      screenWidth_(screenWidth),
+      screenHeight_(screenHeight),
+      pageWidth_(pageWidth),
+      pageHeight_(pageHeight),
+      // Center pages smaller than the screen; larger pages are anchored top-left and clipped
+      offsetX_(screenWidth > pageWidth ? (screenWidth - pageWidth) / 2 : 0),
+      offsetY_(screenHeight > pageHeight ? (screenHeight - pageHeight) / 2 : 0),
+      planeSize_((static_cast<size_t>(pageWidth) * pageHeight + 7) / 8),
+      colBytes_((pageHeight + 7) / 8) {}
+
+void XtcPageBlitter::blitRowMajorChunk(const uint8_t* data, const size_t size, const size_t offset, const Op op) {
+  const size_t rowBytes = (pageWidth_ + 7) / 8;
+  int y = static_cast<int>(offset / rowBytes);
+  size_t byteInRow = offset % rowBytes;
+
+  for (size_t i = 0; i < size; i++) {
+    if (y >= pageHeight_) return;
+    // XTG: 0 = black, so ink is the inverted source byte
+    const uint8_t ink = static_cast<uint8_t>(~data[i]);
+    const int x = static_cast<int>(byteInRow * 8);
+    const int count = (pageWidth_ - x) < 8 ? (pageWidth_ - x) : 8;
+    // All-white bytes leave the buffer untouched for every op but MarkIfClear
+    if (ink != 0 || op == Op::MarkIfClear) {
+      applyRun(x, y, 1, 0, ink, count, op);
+    }
+
+    if (++byteInRow == rowBytes) {
+      byteInRow = 0;
+      y++;
+    }
+  }
+}
+
+void XtcPageBlitter::blitColumnMajorChunk(const uint8_t* data, const size_t size, const size_t offset,
+                                          const Op plane1Op, const Op plane2Op) {
+  bool secondPlane = offset >= planeSize_;
+  size_t planeOffset = secondPlane ? offset - planeSize_ : offset;
+  size_t col = planeOffset / colBytes_;
+  size_t byteInCol = planeOffset % colBytes_;
+
+  for (size_t i = 0; i < size; i++) {
+    if (!secondPlane && planeOffset == planeSize_) {
+      secondPlane = true;
+      planeOffset = 0;
+      col = 0;
+      byteInCol = 0;
+    }
+
+    const Op op = secondPlane ? plane2Op : plane1Op;
+    const uint8_t ink = data[i];
+    if (col < pageWidth_ && (ink != 0 || op == Op::MarkIfClear)) {
+      // Columns are stored right to left
+      const int x = pageWidth_ - 1 - static_cast<int>(col);
+      const int y = static_cast<int>(byteInCol * 8);
+      const int count = (pageHeight_ - y) < 8 ? (pageHeight_ - y) : 8;
+      applyRun(x, y, 0, 1, ink, count, op);
+    }
+
+    planeOffset++;
+    if (++byteInCol == colBytes_) {
+      byteInCol = 0;
+      col++;
+    }
+  }
+}
+
+void XtcPageBlitter::applyRun(const int x, const int y, const int dx, const int dy, const uint8_t ink, const int count,
+                              const Op op) {
+  const int lx = x + offsetX_;
+  const int ly = y + offsetY_;
+  const int physX = lx * t_.xToPhysX + ly * t_.yToPhysX + t_.physXBase;
+  const int physY = lx * t_.xToPhysY + ly * t_.yToPhysY + t_.physYBase;
+  const int stepX = dx * t_.xToPhysX + dy * t_.yToPhysX;
+  const int stepY = dx * t_.xToPhysY + dy * t_.yToPhysY;
+
+  const int lastX = lx + (count - 1) * dx;
+  const int lastY = ly + (count - 1) * dy;
+  const bool visible = lx >= 0 && ly >= 0 && lastX < screenWidth_ && lastY < screenHeight_;
+
+  // Whole run maps onto one frame buffer byte: single byte op
+  if (visible && count == 8 && stepY == 0) {
+    if (stepX == 1 && (physX & 7) == 0) {
+      applyByte(frameBuffer_[physY * EInkDisplay::DISPLAY_WIDTH_BYTES + physX / 8], ink, 0xFF, op);
+      return;
+    }
+    if (stepX == -1 && ((physX - 7) & 7) == 0) {
+      applyByte(frameBuffer_[physY * EInkDisplay::DISPLAY_WIDTH_BYTES + (physX - 7) / 8], reverseBits(ink), 0xFF, op);
+      return;
+    }
+  }
+
+  for (int i = 0; i < count; i++) {
+    const int sx = lx + i * dx;
+    const int sy = ly + i * dy;
+    if (sx < 0 || sy < 0 || sx >= screenWidth_ || sy >= screenHeight_) continue;
+    applyBit(physX + i * stepX, physY + i * stepY, (ink >> (7 - i)) & 1, op);
+  }
+}
+
+void XtcPageBlitter::applyBit(const int physX, const int physY, const bool ink, const Op op) {
+  const uint8_t mask = static_cast<uint8_t>(0x80 >> (physX & 7));
+  applyByte(frameBuffer_[physY * EInkDisplay::DISPLAY_WIDTH_BYTES + physX / 8], ink ? mask : 0, mask, op);
+}
+
+}  // namespace papyrix
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace papyrix {
+
+// XtcPageBlitter - Writes XTC/XTCH page bitmap chunks straight into the 1-bit frame buffer
+//
+// Page pixel (x, y) lands at logical screen position (x + offsetX, y + offsetY), which is
+// mapped to the panel with an affine transform (one per GfxRenderer orientation). Runs of
+// 8 pixels that map onto one aligned frame buffer byte are written with a single byte op,
+// everything else bit by bit. Pixels that fall outside the screen are clipped.
+class XtcPageBlitter {
+ public:
+  // How the "ink" bits of a source byte combine with the frame buffer bits they land on
+  enum class Op : uint8_t {
+    Black,       // Clear bit (BW buffer: 0 = black)
+    Mark,        // Set bit (grayscale buffers start cleared to 0x00)
+    Toggle,      // Flip bit
+    MarkIfClear  // Bit becomes (!bit && ink) for every covered pixel
+  };
+
+  // Logical screen (x, y) -> panel (x * xToPhysX + y * yToPhysX + physXBase,
+  //                                 x * xToPhysY + y * yToPhysY + physYBase)
+  struct Transform {
+    int xToPhysX;
+    int yToPhysX;
+    int physXBase;
+    int xToPhysY;
+    int yToPhysY;
+    int physYBase;
+  };
+
+  XtcPageBlitter(uint8_t* frameBuffer, const Transform& transform, int screenWidth, int screenHeight,
+                 uint16_t pageWidth, uint16_t pageHeight);
+
+  // XTG (1-bit): row-major, MSB = leftmost pixel, 0 = black.
+  // offset is the byte offset of data within the page bitmap.
+  void blitRowMajorChunk(const uint8_t* data, size_t size, size_t offset, Op op);
+
+  // XTH (2-bit): two bit planes stored back to back, column-major, columns right to left,
+  // MSB = topmost pixel. offset is the byte offset within both planes.
+  void blitColumnMajorChunk(const uint8_t* data, size_t size, size_t offset, Op plane1Op, Op plane2Op);
+
+  int offsetX() const { return offsetX_; }
+  int offsetY() const { return offsetY_; }
+
+ private:
+  // Apply a run of count (1-8) page pixels starting at page (x, y) stepping (dx, dy).
+  // ink holds the run MSB first.
+  void applyRun(int x, int y, int dx, int dy, uint8_t ink, int count, Op op);
+  void applyBit(int physX, int physY, bool ink, Op op);
+
+  uint8_t* frameBuffer_;
+  Transform t_;
+  int screenWidth_;
+  int screenHeight_;
+  uint16_t pageWidth_;
+  uint16_t pageHeight_;
+  int offsetX_;
+  int offsetY_;
+  size_t planeSize_;
+  size_t colBytes_;
+};
+
+}  // namespace papyrix
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <BackgroundTask.h>
+
 #include <cstdint>
 #include <functional>
 
+#include "XtcPageBlitter.h"
+
 class GfxRenderer;
 
 namespace xtc {
@@ -13,27 +17,47 @@ namespace papyrix {
 
 // XtcPageRenderer - Renders XTC/XTCH binary page data to GfxRenderer
 // Supports 1-bit (B&W) and 2-bit (4-level grayscale) formats
+// Page data is streamed from SD straight into the frame buffer, so no page-sized buffer is needed.
+// While the panel refreshes, a background task reads the start of the next page into a small
+// read-ahead buffer so the following page turn begins without waiting on the SD card.
 class XtcPageRenderer {
  public:
   // Result of render operation
   enum class RenderResult { Success, EndOfBook, InvalidDimensions, AllocationFailed, PageLoadFailed };
 
   explicit XtcPageRenderer(GfxRenderer& renderer);
+  ~XtcPageRenderer();
+
+  XtcPageRenderer(const XtcPageRenderer&) = delete;
+  XtcPageRenderer& operator=(const XtcPageRenderer&) = delete;
 
   // Render a page from the parser
   // refreshCallback is called when display refresh is needed (for pagesUntilFullRefresh logic)
   RenderResult render(xtc::XtcParser& parser, uint32_t pageNum, std::function<void()> refreshCallback);
 
+  // Stop read-ahead and free its buffer (call before the parser is closed)
+  void releaseReadAhead();
+
  private:
   GfxRenderer& renderer_;
+  BackgroundTask readAheadTask_;
+  uint8_t* readAheadBuf_ = nullptr;
+  xtc::XtcParser* readAheadParser_ = nullptr;
+  uint32_t lastPage_ = 0;
+
+  // Refresh the panel while the page after pageNum (in reading direction) is read ahead.
+  // Returns once both are done, so the parser is free to use again.
+  void refreshWithReadAhead(xtc::XtcParser& parser, uint32_t pageNum, const std::function<void()>& refreshCallback);
 
-  // Render 1-bit B&W page (standard XTC)
-  void render1Bit(const uint8_t* buffer, uint16_t width, uint16_t height);
+  // Stream one pass of a page into the frame buffer
+  // 1-bit pages use plane1Op only; 2-bit pages apply plane1Op/plane2Op to the two bit planes
+  bool streamPass(xtc::XtcParser& parser, uint32_t pageNum, XtcPageBlitter& blitter, XtcPageBlitter::Op plane1Op,
+                  XtcPageBlitter::Op plane2Op);
 
   // Render 2-bit grayscale page (XTCH format)
-  // Uses 4-pass rendering for e-ink grayscale display
-  // Takes two separate plane buffers to handle heap fragmentation
-  void render2BitGrayscale(const uint8_t* plane1, const uint8_t* plane2, uint16_t width, uint16_t height);
+  // Uses 4-pass rendering for e-ink grayscale display, re-reading the page for each pass
+  RenderResult render2BitGrayscale(xtc::XtcParser& parser, uint32_t pageNum, XtcPageBlitter& blitter,
+                                   const std::function<void()>& refreshCallback);
 };
 
 }  // namespace papyrix
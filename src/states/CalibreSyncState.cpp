@@ -121,6 +121,9 @@ void CalibreSyncState::exit(Core& core) {
 
   cleanup();
   core.network.shutdown();
+
+  // Received books don't always change a directory's FAT date, so the file browser lists directories again
+  core.storage.rmdir(PAPYRIX_LISTING_DIR);
 }
 
 StateTransition CalibreSyncState::update(Core& core) {
@@ -10,9 +10,10 @@
 #include <esp_system.h>
 
 #include <algorithm>
-#include <cctype>
+#include <cstdint>
 #include <cstring>
 
+#include "../config.h"
 #include "../core/BootMode.h"
 #include "../core/Core.h"
 #include "../ui/Elements.h"
@@ -20,9 +21,26 @@
 #include "ThemeManager.h"
 
 #define TAG "FILELIST"
+#define LISTING_DIR PAPYRIX_LISTING_DIR
 
 namespace papyrix {
 
+namespace {
+// Directory entries read, or listing entries written, per update while the list is shown
+constexpr size_t kRefreshBatch = 32;
+
+DirListing::Key directoryKey(FsFile& dir) {
+  DirListing::Key key;
+  uint16_t date = 0;
+  uint16_t time = 0;
+  if (dir.getModifyDateTime(&date, &time)) {
+    key.modified = (static_cast<uint32_t>(date) << 16) | time;
+  }
+  key.size = static_cast<uint32_t>(dir.fileSize());
+  return key;
+}
+}  // namespace
+
 FileListState::FileListState(GfxRenderer& renderer)
     : renderer_(renderer),
       selectedIndex_(0),
@@ -69,21 +87,19 @@ void FileListState::enter(Core& core) {
 
   loadFiles(core);
 
-  if (preservePosition && !files_.empty()) {
+  if (preservePosition && !listing_.empty()) {
     selectedIndex_ = core.settings.fileListSelectedIndex;
 
     // Clamp to valid range
-    if (selectedIndex_ >= files_.size()) {
-      selectedIndex_ = files_.size() - 1;
+    if (selectedIndex_ >= listing_.size()) {
+      selectedIndex_ = listing_.size() - 1;
     }
 
     // Verify filename matches, search if not
-    if (strcasecmp(files_[selectedIndex_].name.c_str(), core.settings.fileListSelectedName) != 0) {
-      for (size_t i = 0; i < files_.size(); i++) {
-        if (strcasecmp(files_[i].name.c_str(), core.settings.fileListSelectedName) == 0) {
-          selectedIndex_ = i;
-          break;
-        }
+    if (strcasecmp(entryName(selectedIndex_), core.settings.fileListSelectedName) != 0) {
+      const int found = listing_.find(core.settings.fileListSelectedName);
+      if (found >= 0) {
+        selectedIndex_ = static_cast<size_t>(found);
       }
     }
   } else {
@@ -91,87 +107,154 @@ void FileListState::enter(Core& core) {
   }
 }
 
-void FileListState::exit(Core& core) { LOG_INF(TAG, "Exiting"); }
+void FileListState::exit(Core& core) {
+  LOG_INF(TAG, "Exiting");
+  cancelRefresh();
+  listing_.close();
+}
 
-void FileListState::loadFiles(Core& core) {
-  files_.clear();
-  files_.reserve(512);  // Pre-allocate for large libraries
+void FileListState::loadFiles(Core& core, const bool rescan) {
+  cancelRefresh();
 
-  FsFile dir;
-  auto result = core.storage.openDir(currentDir_, dir);
+  auto result = core.storage.openDir(currentDir_, refreshDir_);
   if (!result.ok()) {
     LOG_ERR(TAG, "Failed to open dir: %s", currentDir_);
+    listing_.close();
+    return;
+  }
+  refreshKey_ = directoryKey(refreshDir_);
+
+  // Listed since boot and unchanged: FAT doesn't always update a directory's time when its entries
+  // change, so a listing is trusted only once it has been checked against the directory. Books the
+  // device writes itself (web upload, Calibre) drop the listings when those states exit.
+  const std::string path = listingPath();
+  const uint32_t dirHash = FsHelpers::pathHash(currentDir_);
+  const bool cached = !rescan && listing_.open(path);
+  if (cached && listing_.key() == refreshKey_ &&
+      std::find(listedDirs_.begin(), listedDirs_.end(), dirHash) != listedDirs_.end()) {
+    refreshDir_.close();
+    LOG_INF(TAG, "Loaded %u entries", static_cast<unsigned>(listing_.size()));
+    return;
+  }
+
+  core.storage.mkdir(LISTING_DIR);
+  refresh_.begin(path + ".tmp", LISTING_DIR "/runs.tmp");
+  if (cached) {
+    // Show the cached listing while update() lists the directory again
+    LOG_INF(TAG, "Loaded %u cached entries, refreshing", static_cast<unsigned>(listing_.size()));
     return;
   }
 
-  char name[256];
-  FsFile entry;
+  // Nothing to show until the directory has been listed
+  while (refreshStep(SIZE_MAX)) {
+  }
+  LOG_INF(TAG, "Listed %u entries", static_cast<unsigned>(listing_.size()));
+}
 
-  // Collect all entries (no hard limit during collection)
-  while ((entry = dir.openNextFile())) {
-    entry.getName(name, sizeof(name));
+bool FileListState::refreshStep(const size_t maxEntries) {
+  if (!refresh_.isActive()) {
+    return false;
+  }
 
-    if (isHidden(name)) {
-      entry.close();
-      continue;
-    }
+  if (refreshDir_) {
+    char name[256];
+    for (size_t i = 0; i < maxEntries; i++) {
+      FsFile entry = refreshDir_.openNextFile();
+      if (!entry) {
+        refreshDir_.close();
+        if (!refresh_.finish(refreshKey_)) {
+          LOG_ERR(TAG, "Failed to write listing of %s", currentDir_);
+          cancelRefresh();
+          return false;
+        }
+        return true;
+      }
 
-    bool isDir = entry.isDirectory();
-    entry.close();
+      entry.getName(name, sizeof(name));
+      if (isHidden(name)) {
+        entry.close();
+        continue;
+      }
+      const bool isDir = entry.isDirectory();
+      entry.close();
 
-    if (isDir || isSupportedFile(name)) {
-      files_.push_back({std::string(name), isDir});
+      if ((isDir || isSupportedFile(name)) && !refresh_.add(name, isDir)) {
+        LOG_ERR(TAG, "Failed to sort listing of %s", currentDir_);
+        cancelRefresh();
+        return false;
+      }
     }
+    return true;
   }
-  dir.close();
 
-  // Safety check - prevent OOM on extreme cases
-  constexpr size_t MAX_ENTRIES = 1000;
-  if (files_.size() > MAX_ENTRIES) {
-    LOG_INF(TAG, "Warning: truncated to %zu entries", MAX_ENTRIES);
-    files_.resize(MAX_ENTRIES);
-    files_.shrink_to_fit();
+  if (!refresh_.write(maxEntries)) {
+    LOG_ERR(TAG, "Failed to write listing of %s", currentDir_);
+    cancelRefresh();
+    return false;
+  }
+  if (!refresh_.done()) {
+    return true;
   }
+  applyRefresh();
+  return false;
+}
 
-  // Sort: directories first, then natural sort (case-insensitive)
-  std::sort(files_.begin(), files_.end(), [](const FileEntry& a, const FileEntry& b) {
-    if (a.isDir && !b.isDir) return true;
-    if (!a.isDir && b.isDir) return false;
+void FileListState::applyRefresh() {
+  const bool changed =
+      !listing_.isOpen() || listing_.hash() != refresh_.hash() || listing_.size() != refresh_.size();
+  refresh_.cancel();
 
-    const char* s1 = a.name.c_str();
-    const char* s2 = b.name.c_str();
+  // Keep the same entry selected when entries come or go
+  char selectedName[256] = "";
+  if (changed && selectedIndex_ < listing_.size()) {
+    strncpy(selectedName, entryName(selectedIndex_), sizeof(selectedName) - 1);
+  }
 
-    while (*s1 && *s2) {
-      const auto uc = [](char c) { return static_cast<unsigned char>(c); };
-      if (std::isdigit(uc(*s1)) && std::isdigit(uc(*s2))) {
-        // Skip leading zeros
-        while (*s1 == '0') s1++;
-        while (*s2 == '0') s2++;
+  // The new listing replaces the old even when the entries are the same, to store the new key
+  const std::string path = listingPath();
+  const std::string tempPath = path + ".tmp";
+  listing_.close();
+  SdMan.remove(path.c_str());
+  if (!SdMan.rename(tempPath.c_str(), path.c_str()) || !listing_.open(path)) {
+    LOG_ERR(TAG, "Failed to replace listing %s", path.c_str());
+  }
 
-        // Compare by digit length first
-        int len1 = 0, len2 = 0;
-        while (std::isdigit(uc(s1[len1]))) len1++;
-        while (std::isdigit(uc(s2[len2]))) len2++;
-        if (len1 != len2) return len1 < len2;
+  const uint32_t dirHash = FsHelpers::pathHash(currentDir_);
+  if (std::find(listedDirs_.begin(), listedDirs_.end(), dirHash) == listedDirs_.end()) {
+    listedDirs_.push_back(dirHash);
+  }
 
-        // Same length: compare digit by digit
-        for (int i = 0; i < len1; i++) {
-          if (s1[i] != s2[i]) return s1[i] < s2[i];
-        }
-        s1 += len1;
-        s2 += len2;
-      } else {
-        char c1 = std::tolower(uc(*s1));
-        char c2 = std::tolower(uc(*s2));
-        if (c1 != c2) return c1 < c2;
-        s1++;
-        s2++;
-      }
-    }
-    return *s1 == '\0' && *s2 != '\0';
-  });
+  if (!changed) {
+    return;
+  }
+  const int found = selectedName[0] != '\0' ? listing_.find(selectedName) : -1;
+  if (found >= 0) {
+    selectedIndex_ = static_cast<size_t>(found);
+  } else if (selectedIndex_ >= listing_.size()) {
+    selectedIndex_ = listing_.empty() ? 0 : listing_.size() - 1;
+  }
+  needsRender_ = true;
+  LOG_INF(TAG, "Listing changed: %u entries", static_cast<unsigned>(listing_.size()));
+}
+
+void FileListState::cancelRefresh() {
+  if (refreshDir_) {
+    refreshDir_.close();
+  }
+  refresh_.cancel();
+}
 
-  LOG_INF(TAG, "Loaded %zu entries", files_.size());
+std::string FileListState::listingPath() const {
+  return std::string(LISTING_DIR "/") + std::to_string(FsHelpers::pathHash(currentDir_)) + ".bin";
+}
+
+const char* FileListState::entryName(const size_t index) {
+  if (!listing_.isLoaded(index)) {
+    // Read the page the entry is on
+    const size_t pageItems = getPageItems();
+    listing_.load(index / pageItems * pageItems, pageItems);
+  }
+  return listing_.name(index);
 }
 
 bool FileListState::isHidden(const char* name) const {
@@ -225,13 +308,14 @@ StateTransition FileListState::update(Core& core) {
             case Button::Center:
               if (confirmView_.isYesSelected()) {
                 // Execute delete inline (like SettingsState pattern)
-                const FileEntry& entry = files_[selectedIndex_];
-                char pathBuf[512];  // currentDir_(256) + '/' + name(128)
+                const char* name = entryName(selectedIndex_);
+                const bool isDir = listing_.isDir(selectedIndex_);
+                char pathBuf[512];  // currentDir_(256) + '/' + name(255)
                 size_t dirLen = strlen(currentDir_);
                 if (currentDir_[dirLen - 1] == '/') {
-                  snprintf(pathBuf, sizeof(pathBuf), "%s%s", currentDir_, entry.name.c_str());
+                  snprintf(pathBuf, sizeof(pathBuf), "%s%s", currentDir_, name);
                 } else {
-                  snprintf(pathBuf, sizeof(pathBuf), "%s/%s", currentDir_, entry.name.c_str());
+                  snprintf(pathBuf, sizeof(pathBuf), "%s/%s", currentDir_, name);
                 }
 
                 // Check if trying to delete the currently active book
@@ -242,15 +326,15 @@ StateTransition FileListState::update(Core& core) {
                 } else {
                   ui::centeredMessage(renderer_, THEME, THEME.uiFontId, "Deleting...");
 
-                  Result<void> result = entry.isDir ? core.storage.rmdir(pathBuf) : core.storage.remove(pathBuf);
+                  Result<void> result = isDir ? core.storage.rmdir(pathBuf) : core.storage.remove(pathBuf);
 
                   const char* msg = result.ok() ? "Deleted" : "Delete failed";
                   ui::centeredMessage(renderer_, THEME, THEME.uiFontId, msg);
                   vTaskDelay(1000 / portTICK_PERIOD_MS);
 
-                  loadFiles(core);
-                  if (selectedIndex_ >= files_.size()) {
-                    selectedIndex_ = files_.empty() ? 0 : files_.size() - 1;
+                  loadFiles(core, true);
+                  if (selectedIndex_ >= listing_.size()) {
+                    selectedIndex_ = listing_.empty() ? 0 : listing_.size() - 1;
                   }
                 }
               }
@@ -296,6 +380,11 @@ StateTransition FileListState::update(Core& core) {
     }
   }
 
+  // List the directory again a batch at a time, while the cached listing is shown
+  if (currentScreen_ == Screen::Browse && !hasSelection_ && !goHome_) {
+    refreshStep(kRefreshBatch);
+  }
+
   // If a file was selected, transition to reader
   if (hasSelection_) {
     hasSelection_ = false;
@@ -339,7 +428,7 @@ void FileListState::render(Core& core) {
   renderer_.drawCenteredText(theme.readerFontId, 10, title, theme.primaryTextBlack, BOLD);
 
   // Empty state
-  if (files_.empty()) {
+  if (listing_.empty()) {
     renderer_.drawText(theme.uiFontId, 20, 60, "No books found", theme.primaryTextBlack);
     renderer_.displayBuffer();
     needsRender_ = false;
@@ -352,12 +441,12 @@ void FileListState::render(Core& core) {
   const int itemHeight = theme.itemHeight + theme.itemSpacing;
   const int pageItems = getPageItems();
   const int pageStart = getPageStartIndex();
-  const int pageEnd = std::min(pageStart + pageItems, static_cast<int>(files_.size()));
+  const int pageEnd = std::min(pageStart + pageItems, static_cast<int>(listing_.size()));
 
   for (int i = pageStart; i < pageEnd; i++) {
     const int y = listStartY + (i - pageStart) * itemHeight;
-    ui::fileEntry(renderer_, theme, y, files_[i].name.c_str(), files_[i].isDir,
-                  static_cast<size_t>(i) == selectedIndex_);
+    const char* name = entryName(i);
+    ui::fileEntry(renderer_, theme, y, name, listing_.isDir(i), static_cast<size_t>(i) == selectedIndex_);
   }
 
   // Button hints - "Home" if at root, "Back" if in subfolder
@@ -375,20 +464,20 @@ void FileListState::render(Core& core) {
 }
 
 void FileListState::navigateUp(Core& core) {
-  if (files_.empty()) return;
+  if (listing_.empty()) return;
 
   if (selectedIndex_ > 0) {
     selectedIndex_--;
   } else {
-    selectedIndex_ = files_.size() - 1;  // Wrap to last item
+    selectedIndex_ = listing_.size() - 1;  // Wrap to last item
   }
   needsRender_ = true;
 }
 
 void FileListState::navigateDown(Core& core) {
-  if (files_.empty()) return;
+  if (listing_.empty()) return;
 
-  if (selectedIndex_ + 1 < files_.size()) {
+  if (selectedIndex_ + 1 < listing_.size()) {
     selectedIndex_++;
   } else {
     selectedIndex_ = 0;  // Wrap to first item
@@ -397,21 +486,22 @@ void FileListState::navigateDown(Core& core) {
 }
 
 void FileListState::openSelected(Core& core) {
-  if (files_.empty()) {
+  if (listing_.empty()) {
     return;
   }
 
-  const FileEntry& entry = files_[selectedIndex_];
+  const char* name = entryName(selectedIndex_);
+  const bool isDir = listing_.isDir(selectedIndex_);
 
   // Build full path
   size_t dirLen = strlen(currentDir_);
   if (currentDir_[dirLen - 1] == '/') {
-    snprintf(selectedPath_, sizeof(selectedPath_), "%s%s", currentDir_, entry.name.c_str());
+    snprintf(selectedPath_, sizeof(selectedPath_), "%s%s", currentDir_, name);
   } else {
-    snprintf(selectedPath_, sizeof(selectedPath_), "%s/%s", currentDir_, entry.name.c_str());
+    snprintf(selectedPath_, sizeof(selectedPath_), "%s/%s", currentDir_, name);
   }
 
-  if (entry.isDir) {
+  if (isDir) {
     // Enter directory
     strncpy(currentDir_, selectedPath_, sizeof(currentDir_) - 1);
     currentDir_[sizeof(currentDir_) - 1] = '\0';
@@ -428,7 +518,7 @@ void FileListState::openSelected(Core& core) {
     // Save position for return
     strncpy(core.settings.fileListDir, currentDir_, sizeof(core.settings.fileListDir) - 1);
     core.settings.fileListDir[sizeof(core.settings.fileListDir) - 1] = '\0';
-    strncpy(core.settings.fileListSelectedName, entry.name.c_str(), sizeof(core.settings.fileListSelectedName) - 1);
+    strncpy(core.settings.fileListSelectedName, name, sizeof(core.settings.fileListSelectedName) - 1);
     core.settings.fileListSelectedName[sizeof(core.settings.fileListSelectedName) - 1] = '\0';
     core.settings.fileListSelectedIndex = selectedIndex_;
 
@@ -463,19 +553,19 @@ void FileListState::goBack(Core& core) {
 }
 
 void FileListState::promptDelete(Core& core) {
-  if (files_.empty()) return;
+  if (listing_.empty()) return;
 
-  const FileEntry& entry = files_[selectedIndex_];
-  const char* typeStr = entry.isDir ? "folder" : "file";
+  const char* name = entryName(selectedIndex_);
+  const char* typeStr = listing_.isDir(selectedIndex_) ? "folder" : "file";
 
   char line1[48];
   snprintf(line1, sizeof(line1), "Delete this %s?", typeStr);
 
   char line2[48];
-  if (entry.name.length() > 40) {
-    snprintf(line2, sizeof(line2), "%.37s...", entry.name.c_str());
+  if (strlen(name) > 40) {
+    snprintf(line2, sizeof(line2), "%.37s...", name);
   } else {
-    strncpy(line2, entry.name.c_str(), sizeof(line2) - 1);
+    strncpy(line2, name, sizeof(line2) - 1);
     line2[sizeof(line2) - 1] = '\0';
   }
 
@@ -494,9 +584,9 @@ int FileListState::getPageItems() const {
 }
 
 int FileListState::getTotalPages() const {
-  if (files_.empty()) return 1;
+  if (listing_.empty()) return 1;
   const int pageItems = getPageItems();
-  return (static_cast<int>(files_.size()) + pageItems - 1) / pageItems;
+  return (static_cast<int>(listing_.size()) + pageItems - 1) / pageItems;
 }
 
 int FileListState::getCurrentPage() const {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <DirListing.h>
+
 #include <cstdint>
 #include <cstring>
 #include <string>
@@ -13,7 +15,8 @@ class GfxRenderer;
 namespace papyrix {
 
 // FileListState - browse and select files
-// Uses dynamic vector for unlimited file support with pagination
+// Directories are listed from a sorted cache on the SD card, read a page at a time, and listed
+// again a batch of entries per update while the cached listing is shown
 class FileListState : public State {
   enum class Screen : uint8_t {
     Browse,
@@ -41,12 +44,14 @@ class FileListState : public State {
   char currentDir_[256];
   char selectedPath_[256];
 
-  // File entries - dynamic vector for unlimited files
-  struct FileEntry {
-    std::string name;
-    bool isDir;
-  };
-  std::vector<FileEntry> files_;
+  // Entries of currentDir_: only the page shown is in memory
+  DirListing listing_;
+
+  // Listing the directory again into a new cache file
+  DirListingBuilder refresh_;
+  FsFile refreshDir_;  // Open while entries are being read
+  DirListing::Key refreshKey_;
+  std::vector<uint32_t> listedDirs_;  // Path hashes of directories listed since boot
 
   size_t selectedIndex_;
   bool needsRender_;
@@ -56,7 +61,12 @@ class FileListState : public State {
   Screen currentScreen_;
   ui::ConfirmDialogView confirmView_;
 
-  void loadFiles(Core& core);
+  void loadFiles(Core& core, bool rescan = false);
+  bool refreshStep(size_t maxEntries);
+  void applyRefresh();
+  void cancelRefresh();
+  std::string listingPath() const;
+  const char* entryName(size_t index);
   void promptDelete(Core& core);
   void navigateUp(Core& core);
   void navigateDown(Core& core);
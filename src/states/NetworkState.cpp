@@ -550,11 +550,13 @@ void NetworkState::startWebServer(Core& core) {
   needsRender_ = true;
 }
 
-void NetworkState::stopWebServer(Core& /* core */) {
+void NetworkState::stopWebServer(Core& core) {
   if (server_) {
     LOG_INF(TAG, "Stopping web server");
     server_->stop();
     server_.reset();
+    // Uploads don't always change a directory's FAT date, so the file browser lists directories again
+    core.storage.rmdir(PAPYRIX_LISTING_DIR);
   }
 
   serverView_.setStopped();
@@ -16,6 +16,7 @@
 #include <Serialization.h>
 #include <esp_system.h>
 
+#include <algorithm>
 #include <cstring>
 
 #include "../Battery.h"
@@ -49,6 +50,29 @@ inline std::string epubSectionCachePath(const std::string& epubCachePath, int sp
 inline std::string contentCachePath(const char* cacheDir, int fontId) {
   return std::string(cacheDir) + "/pages_" + std::to_string(fontId) + ".bin";
 }
+
+// Structure of the open FB2 from its meta cache, so the parser can skip binaries and resume at sections
+Fb2Index fb2Index(const Core& core) {
+  const auto* provider = core.content.asFb2();
+  return (provider && provider->getFb2()) ? provider->getFb2()->getIndex() : Fb2Index();
+}
+
+// Where the parser lays out the open FB2's inline images, or empty when images are off
+std::string fb2ImageCachePath(const Core& core) {
+  const auto* provider = core.content.asFb2();
+  return (core.settings.showImages && provider && provider->getFb2()) ? provider->getFb2()->getImageCachePath() : "";
+}
+
+// FB2 images are only decoded from the book the first time a page shows them
+void cacheFb2Images(const Core& core, const Page& page) {
+  const auto* provider = core.content.asFb2();
+  if (!provider || !provider->getFb2()) return;
+  for (const auto& element : page.elements) {
+    if (element->getTag() != TAG_PageImage) continue;
+    const auto& image = static_cast<const PageImage&>(*element).getImageBlock();
+    provider->getFb2()->cacheImage(image.getCachedBmpPath(), image.getWidth(), image.getHeight());
+  }
+}
 }  // namespace
 
 void ReaderState::saveAnchorMap(const ContentParser& parser, const std::string& cachePath) {
@@ -358,7 +382,8 @@ void ReaderState::enter(Core& core) {
   currentSectionPage_ = progress.sectionPage;
   currentPage_ = progress.flatPage;
 
-  bookmarkCount_ = BookmarkManager::load(core, core.content.cacheDir(), bookmarks_, BookmarkManager::MAX_BOOKMARKS);
+  bookmarkCount_ =
+      BookmarkManager::load(core, core.content.cacheDir(), type, bookmarks_, BookmarkManager::MAX_BOOKMARKS);
 
   // If at start of book and showImages enabled, begin at cover
   // Skip for XTC — uses flat page indexing, no cover page concept in reader
@@ -393,6 +418,9 @@ void ReaderState::exit(Core& core) {
     ProgressManager::save(core, core.content.cacheDir(), core.content.metadata().type, progress);
     saveBookmarks(core);
 
+    // Read-ahead holds a buffer inside the XTC parser, detach it before the content closes
+    xtcRenderer_.releaseReadAhead();
+
     // Safe to reset - task is stopped, we own pageCache_/parser_
     parser_.reset();
     parserSpineIndex_ = -1;
@@ -536,7 +564,12 @@ void ReaderState::navigateNext(Core& core) {
   pos.spineIndex = currentSpineIndex_;
   pos.sectionPage = currentSectionPage_;
   pos.flatPage = currentPage_;
-  auto result = ReaderNavigation::next(type, pos, pageCache_.get(), core.content.pageCount());
+  uint32_t total = core.content.pageCount();
+  if (type == ContentType::Txt) {
+    auto* provider = core.content.asTxt();
+    total = (provider && provider->getTxt()) ? provider->getTxt()->sectionCount() : 1;
+  }
+  auto result = ReaderNavigation::next(type, pos, pageCache_.get(), total);
   applyNavResult(result, core);
 }
 
@@ -756,6 +789,10 @@ void ReaderState::renderCachedPage(Core& core) {
     return;
   }
 
+  if (type == ContentType::Fb2 && page->hasImages()) {
+    cacheFb2Images(core, *page);
+  }
+
   const int fontId = core.settings.getReaderFontId(theme);
 
   renderPageContents(core, *page, vp.marginTop, vp.marginRight, vp.marginBottom, vp.marginLeft);
@@ -785,11 +822,25 @@ void ReaderState::renderCachedPage(Core& core) {
     }
     // Double FAST_REFRESH handles ghosting; don't count toward full refresh cadence
   } else {
-    displayWithRefresh(core);
+    // Read the next page from the cache while the panel refreshes
+    displayWithRefresh(core, false);
+    if (currentSectionPage_ + 1 < static_cast<int>(pageCount)) {
+      pageCache_->prefetchPage(currentSectionPage_ + 1);
+    }
   }
 
   // Grayscale text rendering (anti-aliasing)
-  if (aaEnabled) {
+  // Both gray planes are drawn in one pass per band straight into the panel RAM; the frame
+  // buffer keeps the BW page, so no BW re-render is needed afterwards
+  const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
+  if (aaEnabled && renderer_.renderGrayscaleBands([&] {
+        page->render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack);
+        renderStatusBar(core, vp.marginRight, vp.marginBottom, vp.marginLeft);
+      })) {
+    renderer_.displayGrayBuffer(turnOffScreen);
+    renderer_.cleanupGrayscaleWithFrameBuffer();
+  } else if (aaEnabled) {
+    // Out of memory for the band buffers: separate full-frame passes
     renderer_.clearScreen(0x00);
     renderer_.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     page->render(renderer_, fontId, vp.marginLeft, vp.marginTop, theme.primaryTextBlack);
@@ -802,7 +853,6 @@ void ReaderState::renderCachedPage(Core& core) {
     renderStatusBar(core, vp.marginRight, vp.marginBottom, vp.marginLeft);
     renderer_.copyGrayscaleMsbBuffers();
 
-    const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
     renderer_.displayGrayBuffer(turnOffScreen);
     renderer_.setRenderMode(GfxRenderer::BW);
 
@@ -813,6 +863,9 @@ void ReaderState::renderCachedPage(Core& core) {
     renderer_.cleanupGrayscaleWithFrameBuffer();
   }
 
+  // Background caching may borrow the frame buffer, so the refresh must be done before it resumes
+  renderer_.waitForRefresh();
+
   LOG_DBG(TAG, "Rendered page %d/%d", currentSectionPage_ + 1, pageCount);
 }
 
@@ -868,7 +921,14 @@ void ReaderState::loadCacheFromDisk(Core& core) {
       return;
     }
     cachePath = epubSectionCachePath(provider->getEpub()->getCachePath(), currentSpineIndex_);
-  } else if (type == ContentType::Markdown || type == ContentType::Txt || type == ContentType::Fb2) {
+  } else if (type == ContentType::Txt) {
+    auto* provider = core.content.asTxt();
+    if (!provider || !provider->getTxt()) {
+      LOG_ERR(TAG, "loadCacheFromDisk: no txt provider");
+      return;
+    }
+    cachePath = provider->getTxt()->getSectionCachePath(config.fontId, currentSpineIndex_);
+  } else if (type == ContentType::Markdown || type == ContentType::Fb2) {
     cachePath = contentCachePath(core.content.cacheDir(), config.fontId);
   } else {
     LOG_ERR(TAG, "loadCacheFromDisk: unsupported content type %d", static_cast<int>(type));
@@ -913,18 +973,60 @@ void ReaderState::createOrExtendCache(Core& core) {
   } else if (type == ContentType::Fb2) {
     cachePath = contentCachePath(core.content.cacheDir(), config.fontId);
     if (!parser_) {
-      parser_.reset(new Fb2Parser(contentPath_, renderer_, config));
+      parser_.reset(new Fb2Parser(contentPath_, renderer_, config, fb2Index(core), fb2ImageCachePath(core)));
       parserSpineIndex_ = 0;
     }
   } else {
-    cachePath = contentCachePath(core.content.cacheDir(), config.fontId);
-    if (!parser_) {
-      parser_.reset(new PlainTextParser(contentPath_, renderer_, config));
-      parserSpineIndex_ = 0;
+    auto* provider = core.content.asTxt();
+    if (!provider || !provider->getTxt()) return;
+    Txt* txt = provider->getTxt();
+    cachePath = txt->getSectionCachePath(config.fontId, currentSpineIndex_);
+    if (!parser_ || parserSpineIndex_ != currentSpineIndex_) {
+      parser_.reset(new PlainTextParser(contentPath_, renderer_, config, txt->sectionStart(currentSpineIndex_),
+                                        txt->sectionEnd(currentSpineIndex_)));
+      parserSpineIndex_ = currentSpineIndex_;
     }
   }
 
   createOrExtendCacheImpl(*parser_, cachePath, config);
+  if (type == ContentType::Txt) {
+    recordTxtSectionPages(core, config);
+  }
+}
+
+void ReaderState::recordTxtSectionPages(Core& core, const RenderConfig& config) {
+  auto* provider = core.content.asTxt();
+  if (!provider || !provider->getTxt() || !pageCache_) return;
+
+  Txt* txt = provider->getTxt();
+  txt->setLayout(config.hash());
+  if (!pageCache_->isPartial()) {
+    txt->setSectionPages(currentSpineIndex_, pageCache_->pageCount());
+  }
+  txt->saveIndex();
+}
+
+void ReaderState::countTxtSections(Core& core, const RenderConfig& config) {
+  auto* provider = core.content.asTxt();
+  if (!provider || !provider->getTxt()) return;
+
+  // Lay out the sections nobody has opened yet, without caching their pages, so the page numbers
+  // of the whole file get closer to what paginating it from the start would give
+  Txt* txt = provider->getTxt();
+  txt->setLayout(config.hash());
+  const auto shouldAbort = cacheTask_.getAbortCallback();
+  for (uint16_t section = 0; section < txt->sectionCount() && !cacheTask_.shouldStop(); section++) {
+    // The open section gets its count when its cache is complete
+    if (section == currentSpineIndex_ || txt->getSectionPages(section) > 0) continue;
+
+    PlainTextParser parser(contentPath_, renderer_, config, txt->sectionStart(section), txt->sectionEnd(section));
+    uint16_t pages = 0;
+    const bool done = parser.parsePages([&pages](std::unique_ptr<Page>) { pages++; }, 0, shouldAbort);
+    if (!done || cacheTask_.shouldStop()) break;
+
+    txt->setSectionPages(section, pages);
+    txt->saveIndex();
+  }
 }
 
 void ReaderState::renderPageContents(Core& core, Page& page, int marginTop, int marginRight, int marginBottom,
@@ -985,6 +1087,13 @@ void ReaderState::renderStatusBar(Core& core, int marginRight, int marginBottom,
     } else {
       return;
     }
+  } else if (type == ContentType::Txt) {
+    // Approximate across the file until every section has been laid out
+    auto* provider = core.content.asTxt();
+    if (!provider || !provider->getTxt()) return;
+    const Txt* txt = provider->getTxt();
+    data.currentPage = static_cast<int>(txt->pagesBefore(currentSpineIndex_)) + currentSectionPage_ + 1;
+    data.totalPages = std::max(static_cast<int>(txt->approxPageCount()), data.currentPage);
   } else {
     data.currentPage = currentSectionPage_ + 1;
     data.totalPages = core.content.pageCount();
@@ -1021,15 +1130,18 @@ void ReaderState::renderXtcPage(Core& core) {
   }
 }
 
-void ReaderState::displayWithRefresh(Core& core) {
+void ReaderState::displayWithRefresh(Core& core, const bool wait) {
   const bool turnOffScreen = core.settings.sunlightFadingFix != 0;
   if (pagesUntilFullRefresh_ <= 1) {
-    renderer_.displayBuffer(EInkDisplay::HALF_REFRESH, turnOffScreen);
+    renderer_.displayBufferAsync(EInkDisplay::HALF_REFRESH, turnOffScreen);
     pagesUntilFullRefresh_ = core.settings.getPagesPerRefreshValue();
   } else {
-    renderer_.displayBuffer(EInkDisplay::FAST_REFRESH, turnOffScreen);
+    renderer_.displayBufferAsync(EInkDisplay::FAST_REFRESH, turnOffScreen);
     pagesUntilFullRefresh_--;
   }
+  if (wait) {
+    renderer_.waitForRefresh();
+  }
 }
 
 ReaderState::Viewport ReaderState::getReaderViewport(bool showStatusBar) const {
@@ -1147,19 +1259,29 @@ void ReaderState::startBackgroundCaching(Core& core) {
           } else if (type == ContentType::Fb2 && !cacheTask_.shouldStop()) {
             cachePath = contentCachePath(coreRef.content.cacheDir(), config.fontId);
             if (!parser_) {
-              parser_.reset(new Fb2Parser(contentPath_, renderer_, config));
+              parser_.reset(
+                  new Fb2Parser(contentPath_, renderer_, config, fb2Index(coreRef), fb2ImageCachePath(coreRef)));
               parserSpineIndex_ = 0;
             }
           } else if (type == ContentType::Txt && !cacheTask_.shouldStop()) {
-            cachePath = contentCachePath(coreRef.content.cacheDir(), config.fontId);
-            if (!parser_) {
-              parser_.reset(new PlainTextParser(contentPath_, renderer_, config));
-              parserSpineIndex_ = 0;
+            auto* provider = coreRef.content.asTxt();
+            if (provider && provider->getTxt()) {
+              Txt* txt = provider->getTxt();
+              cachePath = txt->getSectionCachePath(config.fontId, spineIndex);
+              if (!parser_ || parserSpineIndex_ != spineIndex) {
+                parser_.reset(new PlainTextParser(contentPath_, renderer_, config, txt->sectionStart(spineIndex),
+                                                  txt->sectionEnd(spineIndex)));
+                parserSpineIndex_ = spineIndex;
+              }
             }
           }
 
           if (parser_ && !cachePath.empty() && !cacheTask_.shouldStop()) {
             backgroundCacheImpl(*parser_, cachePath, config);
+            if (type == ContentType::Txt && !cacheTask_.shouldStop()) {
+              recordTxtSectionPages(coreRef, config);
+              countTxtSections(coreRef, config);
+            }
           }
         }
 
@@ -1724,6 +1846,11 @@ void ReaderState::addBookmark(Core& core) {
   bm.spineIndex = static_cast<int16_t>(lastRenderedSpineIndex_);
   bm.sectionPage = static_cast<int16_t>(lastRenderedSectionPage_);
   bm.flatPage = currentPage_;
+  auto* txtProvider = core.content.asTxt();
+  if (type == ContentType::Txt && txtProvider && txtProvider->getTxt()) {
+    // Keeps the bookmark if the file is edited and its sections move (BookmarkManager::load)
+    bm.flatPage = txtProvider->getTxt()->sectionStart(lastRenderedSpineIndex_);
+  }
 
   if (cachedChapterTitle_[0] != '\0') {
     strncpy(bm.label, cachedChapterTitle_, sizeof(bm.label) - 1);
@@ -1731,6 +1858,9 @@ void ReaderState::addBookmark(Core& core) {
   } else {
     if (type == ContentType::Xtc) {
       snprintf(bm.label, sizeof(bm.label), "Page %u", static_cast<unsigned>(currentPage_ + 1));
+    } else if (type == ContentType::Txt && txtProvider && txtProvider->getTxt()) {
+      const uint32_t page = txtProvider->getTxt()->pagesBefore(lastRenderedSpineIndex_) + lastRenderedSectionPage_ + 1;
+      snprintf(bm.label, sizeof(bm.label), "Page %u", static_cast<unsigned>(page));
     } else {
       snprintf(bm.label, sizeof(bm.label), "Page %d", lastRenderedSectionPage_ + 1);
     }
@@ -1739,7 +1869,7 @@ void ReaderState::addBookmark(Core& core) {
   int insertPos = bookmarkCount_;
   for (int i = 0; i < bookmarkCount_; i++) {
     bool insertHere = false;
-    if (type == ContentType::Epub) {
+    if (type == ContentType::Epub || type == ContentType::Txt) {
       if (bm.spineIndex < bookmarks_[i].spineIndex ||
           (bm.spineIndex == bookmarks_[i].spineIndex && bm.sectionPage < bookmarks_[i].sectionPage)) {
         insertHere = true;
@@ -1796,7 +1926,7 @@ void ReaderState::jumpToBookmark(Core& core, int index) {
   const Bookmark& bm = bookmarks_[index];
   ContentType type = core.content.metadata().type;
 
-  if (type == ContentType::Epub) {
+  if (type == ContentType::Epub || type == ContentType::Txt) {
     if (bm.spineIndex != currentSpineIndex_) {
       currentSpineIndex_ = bm.spineIndex;
       parser_.reset();
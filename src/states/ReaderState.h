@@ -112,9 +112,13 @@ class ReaderState : public State {
 
   void createOrExtendCacheImpl(ContentParser& parser, const std::string& cachePath, const RenderConfig& config);
   void backgroundCacheImpl(ContentParser& parser, const std::string& cachePath, const RenderConfig& config);
+  // TXT sections (see Txt::SECTION_SIZE): page counts for the page numbers across the file
+  void recordTxtSectionPages(Core& core, const RenderConfig& config);
+  void countTxtSections(Core& core, const RenderConfig& config);
 
   // Display helpers
-  void displayWithRefresh(Core& core);
+  // wait = false returns while the panel is still refreshing (see GfxRenderer::displayBufferAsync)
+  void displayWithRefresh(Core& core, bool wait = true);
 
   // Viewport calculation
   struct Viewport {
@@ -0,0 +1,276 @@
+#include "bench.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef BENCH_WRAP_MALLOC
+#include <malloc.h>
+#endif
+
+namespace {
+
+uint64_t allocCount = 0;
+uint64_t allocBytes = 0;
+uint64_t liveBytes = 0;
+uint64_t peakBytes = 0;
+
+inline void countAlloc(const size_t size) {
+  allocCount++;
+  allocBytes += size;
+}
+
+// Held bytes are only known where every block goes through the wrappers below. Blocks allocated
+// inside shared libraries but freed here are clamped away rather than counted.
+#ifdef BENCH_WRAP_MALLOC
+inline void* trackAlloc(void* p) {
+  if (p) {
+    liveBytes += malloc_usable_size(p);
+    if (liveBytes > peakBytes) peakBytes = liveBytes;
+  }
+  return p;
+}
+
+inline void trackFree(void* p) {
+  if (p) {
+    const uint64_t size = malloc_usable_size(p);
+    liveBytes -= size < liveBytes ? size : liveBytes;
+  }
+}
+#else
+inline void* trackAlloc(void* p) { return p; }
+inline void trackFree(void*) {}
+#endif
+
+}  // namespace
+
+// The linker redirects malloc & co. to these wrappers (-Wl,--wrap) so allocations made by the
+// C code (uzlib, picojpeg) and the malloc-based buffers in the parsers are counted too
+#ifdef BENCH_WRAP_MALLOC
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+void* __wrap_malloc(const size_t size) {
+  countAlloc(size);
+  return trackAlloc(__real_malloc(size));
+}
+
+void* __wrap_calloc(const size_t count, const size_t size) {
+  countAlloc(count * size);
+  return trackAlloc(__real_calloc(count, size));
+}
+
+void* __wrap_realloc(void* ptr, const size_t size) {
+  countAlloc(size);
+  trackFree(ptr);
+  return trackAlloc(__real_realloc(ptr, size));
+}
+
+void __wrap_free(void* ptr) {
+  trackFree(ptr);
+  __real_free(ptr);
+}
+}
+#define BENCH_MALLOC __real_malloc
+#define BENCH_FREE __real_free
+#else
+#define BENCH_MALLOC std::malloc
+#define BENCH_FREE std::free
+#endif
+
+void* operator new(const size_t size) {
+  countAlloc(size);
+  void* p = trackAlloc(BENCH_MALLOC(size ? size : 1));
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](const size_t size) { return operator new(size); }
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+  countAlloc(size);
+  return trackAlloc(BENCH_MALLOC(size ? size : 1));
+}
+
+void* operator new[](const size_t size, const std::nothrow_t& tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void* p) noexcept {
+  trackFree(p);
+  BENCH_FREE(p);
+}
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, size_t) noexcept { operator delete(p); }
+
+namespace bench {
+
+namespace {
+constexpr int ROUNDS = 5;
+}
+
+AllocStats allocStats() { return {allocCount, allocBytes, liveBytes, peakBytes}; }
+
+void resetPeak() { peakBytes = liveBytes; }
+
+bool Runner::run(const std::string& name, const std::function<size_t()>& fn) {
+  if (!filter_.empty() && name.find(filter_) == std::string::npos) return true;
+
+  // Warm-up: first-use caches (fonts, hyphenation patterns, file system) are not what is measured
+  if (fn() == 0) {
+    fprintf(stderr, "%-24s FAILED\n", name.c_str());
+    return false;
+  }
+
+  // The time is that of the fastest of several rounds: noise from the rest of the machine only
+  // ever makes a round slower. Allocations are the same every time and are averaged.
+  using Clock = std::chrono::steady_clock;
+  const auto roundTime = std::chrono::duration<double>(minSeconds_ / ROUNDS);
+  resetPeak();
+  const AllocStats before = allocStats();
+  uint64_t ops = 0;
+  uint64_t inputBytes = 0;
+  double bestNsPerOp = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    const auto start = Clock::now();
+    uint64_t roundOps = 0;
+    Clock::duration elapsed{};
+    do {
+      inputBytes += fn();
+      roundOps++;
+      elapsed = Clock::now() - start;
+    } while (elapsed < roundTime);
+    const double nsPerOp = std::chrono::duration<double, std::nano>(elapsed).count() / roundOps;
+    if (round == 0 || nsPerOp < bestNsPerOp) bestNsPerOp = nsPerOp;
+    ops += roundOps;
+  }
+  const AllocStats after = allocStats();
+
+  Result r;
+  r.name = name;
+  r.ops = ops;
+  r.nsPerOp = bestNsPerOp;
+  r.allocsPerOp = static_cast<double>(after.allocs - before.allocs) / ops;
+  r.bytesPerOp = static_cast<double>(after.bytes - before.bytes) / ops;
+  r.peakBytes = static_cast<double>(after.peak - before.live);
+  r.inputBytesPerOp = static_cast<double>(inputBytes) / ops;
+  results_.push_back(r);
+
+  const double mbPerSec = r.inputBytesPerOp / r.nsPerOp * 1e9 / (1024 * 1024);
+  fprintf(stderr, "%-24s %8" PRIu64 " ops %14.0f ns/op %12.0f B/op %10.1f allocs/op %10.0f peak B %8.2f MB/s\n",
+          name.c_str(), r.ops, r.nsPerOp, r.bytesPerOp, r.allocsPerOp, r.peakBytes, mbPerSec);
+  return true;
+}
+
+// One benchmark per line, so readJson() needs no JSON parser
+bool writeJson(const std::string& path, const std::vector<Result>& results) {
+  FILE* f = fopen(path.c_str(), "w");
+  if (!f) {
+    perror(path.c_str());
+    return false;
+  }
+  fprintf(f, "{\n  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result& r = results[i];
+    fprintf(f,
+            "    {\"name\": \"%s\", \"ops\": %" PRIu64
+            ", \"ns_per_op\": %.0f, \"bytes_per_op\": %.0f, \"allocs_per_op\": %.1f, \"peak_bytes\": %.0f, "
+            "\"input_bytes_per_op\": %.0f}%s\n",
+            r.name.c_str(), r.ops, r.nsPerOp, r.bytesPerOp, r.allocsPerOp, r.peakBytes, r.inputBytesPerOp,
+            i + 1 < results.size() ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+  return fclose(f) == 0;
+}
+
+namespace {
+
+bool readNumber(const char* line, const char* key, double& out) {
+  const char* p = strstr(line, key);
+  if (!p) return false;
+  p += strlen(key);
+  while (*p == '"' || *p == ':' || *p == ' ') p++;
+  char* end = nullptr;
+  out = strtod(p, &end);
+  return end != p;
+}
+
+}  // namespace
+
+bool readJson(const std::string& path, std::vector<Result>& results) {
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return false;
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    const char* name = strstr(line, "\"name\": \"");
+    if (!name) continue;
+    name += strlen("\"name\": \"");
+    const char* nameEnd = strchr(name, '"');
+    if (!nameEnd) continue;
+
+    Result r;
+    r.name.assign(name, nameEnd);
+    double ops = 0;
+    if (!readNumber(line, "\"ops\"", ops) || !readNumber(line, "\"ns_per_op\"", r.nsPerOp) ||
+        !readNumber(line, "\"bytes_per_op\"", r.bytesPerOp) || !readNumber(line, "\"allocs_per_op\"", r.allocsPerOp)) {
+      fprintf(stderr, "%s: bad entry for %s\n", path.c_str(), r.name.c_str());
+      continue;
+    }
+    readNumber(line, "\"peak_bytes\"", r.peakBytes);
+    readNumber(line, "\"input_bytes_per_op\"", r.inputBytesPerOp);
+    r.ops = static_cast<uint64_t>(ops);
+    results.push_back(r);
+  }
+  fclose(f);
+  return true;
+}
+
+namespace {
+
+const Result* find(const std::vector<Result>& results, const std::string& name) {
+  for (const auto& r : results) {
+    if (r.name == name) return &r;
+  }
+  return nullptr;
+}
+
+double change(const double base, const double now) { return base > 0 ? (now - base) / base * 100 : 0; }
+
+// Allocation counts are exact, so a difference below one allocation (or 64 bytes) is rounding
+bool exceeds(const double base, const double now, const double threshold, const double minDelta) {
+  return now > base * (1 + threshold) && now - base >= minDelta;
+}
+
+}  // namespace
+
+int compare(const std::vector<Result>& baseline, const std::vector<Result>& current, const Thresholds& thresholds) {
+  int regressions = 0;
+  fprintf(stderr, "\n%-24s %10s %10s %10s %10s\n", "vs baseline", "time", "bytes", "allocs", "peak");
+  for (const auto& r : current) {
+    const Result* base = find(baseline, r.name);
+    if (!base) {
+      fprintf(stderr, "%-24s %10s\n", r.name.c_str(), "new");
+      continue;
+    }
+    const bool slow = exceeds(base->nsPerOp, r.nsPerOp, thresholds.time, 0);
+    const bool bytes = exceeds(base->bytesPerOp, r.bytesPerOp, thresholds.alloc, 64);
+    const bool allocs = exceeds(base->allocsPerOp, r.allocsPerOp, thresholds.alloc, 1);
+    const bool peak = base->peakBytes > 0 && exceeds(base->peakBytes, r.peakBytes, thresholds.alloc, 64);
+    fprintf(stderr, "%-24s %+9.1f%%%s %+9.1f%%%s %+9.1f%%%s %+9.1f%%%s\n", r.name.c_str(),
+            change(base->nsPerOp, r.nsPerOp), slow ? "!" : " ", change(base->bytesPerOp, r.bytesPerOp),
+            bytes ? "!" : " ", change(base->allocsPerOp, r.allocsPerOp), allocs ? "!" : " ",
+            change(base->peakBytes, r.peakBytes), peak ? "!" : " ");
+    if (slow || bytes || allocs || peak) regressions++;
+  }
+  for (const auto& base : baseline) {
+    if (!find(current, base.name)) fprintf(stderr, "%-24s %10s\n", base.name.c_str(), "not run");
+  }
+  return regressions;
+}
+
+}  // namespace bench
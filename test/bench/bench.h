@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal benchmark harness for the host build of the reader pipeline.
+//
+// Each benchmark is a function that does one operation and returns the number of input bytes it
+// processed. The runner repeats it until a minimum time has passed and reports the time, heap
+// bytes and heap allocations per operation, and the most heap held at once while it ran. Results
+// are written as JSON and can be compared with a stored baseline.
+namespace bench {
+
+struct Result {
+  std::string name;
+  uint64_t ops = 0;
+  double nsPerOp = 0;      // Fastest round
+  double bytesPerOp = 0;   // Heap bytes allocated per operation
+  double allocsPerOp = 0;  // Heap allocations per operation
+  double peakBytes = 0;    // Most heap bytes held at once, above what was held before (Linux only)
+  double inputBytesPerOp = 0;
+};
+
+struct Thresholds {
+  double time = 0.30;   // Allowed slowdown, as a fraction of the baseline
+  double alloc = 0.10;  // Allowed growth of allocations, allocated bytes and peak bytes
+};
+
+// Heap activity since the process started. Counts operator new and, on Linux, malloc/calloc/realloc.
+// On Linux the bytes held (live) and their high-water mark (peak) are tracked too.
+struct AllocStats {
+  uint64_t allocs;
+  uint64_t bytes;
+  uint64_t live;
+  uint64_t peak;
+};
+AllocStats allocStats();
+
+// Starts a new high-water mark at the bytes held now
+void resetPeak();
+
+class Runner {
+ public:
+  Runner(double minSeconds, std::string filter) : minSeconds_(minSeconds), filter_(std::move(filter)) {}
+
+  // Runs fn once untimed, then repeatedly for at least minSeconds, split into rounds; the time
+  // reported is the fastest round's. Skipped if the name doesn't contain the filter. Returns false
+  // if fn reported failure by returning 0.
+  bool run(const std::string& name, const std::function<size_t()>& fn);
+
+  const std::vector<Result>& results() const { return results_; }
+
+ private:
+  double minSeconds_;
+  std::string filter_;
+  std::vector<Result> results_;
+};
+
+bool writeJson(const std::string& path, const std::vector<Result>& results);
+bool readJson(const std::string& path, std::vector<Result>& results);
+
+// Prints a comparison table and returns the number of regressions. Benchmarks that are new or
+// missing from the baseline are listed but don't count.
+int compare(const std::vector<Result>& baseline, const std::vector<Result>& current, const Thresholds& thresholds);
+
+}  // namespace bench
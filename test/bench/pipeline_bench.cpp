@@ -0,0 +1,652 @@
+// Reader pipeline benchmarks
+//
+// Times each stage a book goes through on its way to the screen, using the host build of the
+// same code the device runs: ZIP inflate, HTML/FB2/TXT/Markdown parsing (which includes
+// layout), hyphenation, ParsedText line breaking, page cache serialization, drawing a page into
+// the frame buffer and JPEG decoding. Every stage works on the checked-in corpus in
+// test/bench/corpus (see scripts/generate-bench-corpus.py).
+//
+// Results go to stderr and, with --json, to a file. With --baseline they are compared against
+// a stored run and the exit code is non-zero if a stage got slower or allocates more than the
+// thresholds allow. Timings only mean something relative to a baseline from the same machine.
+
+#include <ftw.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// First: ChapterHtmlSlimParser.h defines a MAX_WORD_SIZE macro that clashes with these parsers' constants
+#include <Fb2Image.h>
+#include <Fb2Index.h>
+#include <Fb2Parser.h>
+#include <MarkdownParser.h>
+
+#include <EInkDisplay.h>
+#include <Epub.h>
+#include <Epub/parsers/ChapterHtmlSlimParser.h>
+#include <GfxRenderer.h>
+#include <Html5Tokenizer.h>
+#include <Hyphenation.h>
+#include <JpegToBmpConverter.h>
+#include <LanguageRegistry.h>
+#include <LittleFS.h>
+#include <Page.h>
+#include <PageCache.h>
+#include <ParsedText.h>
+#include <PlainTextParser.h>
+#include <SDCardManager.h>
+#include <WordTokenizer.h>
+#include <expat.h>
+
+#include "bench.h"
+#include "device_settings.h"
+
+// LittleFS global
+MockLittleFS LittleFS;
+
+namespace {
+
+// Print that only counts, so the output side costs nothing
+class CountingPrint : public Print {
+ public:
+  size_t count = 0;
+  size_t write(uint8_t) override {
+    count++;
+    return 1;
+  }
+  size_t write(const uint8_t*, const size_t size) override {
+    count += size;
+    return size;
+  }
+};
+
+struct Options {
+  std::string corpus;
+  std::string json;
+  std::string baseline;
+  std::string filter;
+  double minSeconds = 1.0;
+  bool updateBaseline = false;
+  bench::Thresholds thresholds;
+};
+
+// Everything the stages share; built once, untimed
+struct Fixture {
+  std::string corpus;
+  std::string scratch;
+  GfxRenderer* gfx = nullptr;
+  RenderConfig config;
+  int fontId = 0;
+
+  std::shared_ptr<Epub> epub;
+  std::vector<std::string> spineHrefs;
+  std::vector<std::string> chapterFiles;  // Extracted spine items
+  std::vector<std::string> chapterBasePaths;
+  std::vector<std::string> chapterHtml;  // The spine items' contents, for the HTML tokenizers
+  std::string jpegFile;
+  Fb2Index fb2Index;  // As Fb2::load() leaves it in meta.bin
+  std::vector<std::string> words;
+  std::vector<std::string> wordsDe;  // A chapter each of German and Russian, for hyphenation
+  std::vector<std::string> wordsRu;
+  std::vector<std::vector<std::string>> paragraphs;
+  std::vector<std::unique_ptr<Page>> pages;
+  std::string pageFile;
+  std::vector<std::shared_ptr<TextBlock>> shapedLines;  // A page of Arabic and Thai text
+  std::string largeTxt;  // The TXT and Markdown corpus repeated to about 1 MB, for the tokenizer
+  std::string largeMd;
+};
+
+size_t fileSize(const std::string& path) {
+  struct stat st = {};
+  return stat(path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+bool readText(const std::string& path, std::string& out) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+bool scanFb2(const std::string& path, Fb2Index& index) {
+  FsFile file;
+  if (!SdMan.openFileForRead("BENCH", path, file)) return false;
+  const bool ok = index.scan(file);
+  file.close();
+  return ok;
+}
+
+bool extract(const Epub& epub, const std::string& href, const std::string& path) {
+  FsFile file;
+  if (!SdMan.openFileForWrite("BENCH", path, file)) return false;
+  const bool ok = epub.readItemContentsToStream(href, file, 1024);
+  file.close();
+  return ok;
+}
+
+// Words and paragraphs of the plain text corpus, for hyphenation and line breaking
+void splitText(const std::string& text, Fixture& fx) {
+  std::vector<std::string> paragraph;
+  std::string word;
+  int newlines = 0;
+  for (const char c : text) {
+    if (c == ' ' || c == '\n') {
+      if (!word.empty()) paragraph.push_back(std::move(word));
+      word.clear();
+      newlines = c == '\n' ? newlines + 1 : 0;
+      if (newlines == 2 && !paragraph.empty()) fx.paragraphs.push_back(std::move(paragraph));
+      if (newlines == 2) paragraph.clear();
+    } else {
+      word += c;
+      newlines = 0;
+    }
+  }
+  if (!word.empty()) paragraph.push_back(word);
+  if (!paragraph.empty()) fx.paragraphs.push_back(paragraph);
+
+  for (const auto& p : fx.paragraphs) {
+    for (std::string w : p) {
+      while (!w.empty() && strchr(".,;:!?", w.back())) w.pop_back();
+      if (!w.empty()) fx.words.push_back(w);
+    }
+  }
+}
+
+// Words as the parsers hand them to layout, punctuation and all
+bool readWords(const std::string& path, std::vector<std::string>& out) {
+  std::string text;
+  if (!readText(path, text)) return false;
+  WordTokenizer tokenizer(text.data(), text.size(), 200);
+  WordTokenizer::Token token;
+  while (tokenizer.next(token)) {
+    if (token.kind == WordTokenizer::Kind::WORD) out.emplace_back(token.text, token.length);
+  }
+  return !out.empty();
+}
+
+size_t parseChapter(Fixture& fx, const size_t i, std::vector<std::unique_ptr<Page>>* keep) {
+  size_t pages = 0;
+  ChapterHtmlSlimParser parser(
+      fx.chapterFiles[i], *fx.gfx, fx.config,
+      [&](std::unique_ptr<Page> page) {
+        pages++;
+        if (keep) keep->push_back(std::move(page));
+        return true;
+      },
+      nullptr, fx.chapterBasePaths[i], "", nullptr, fx.epub->getCssParser());
+  return parser.parseAndBuildPages() ? pages : 0;
+}
+
+bool setUp(Fixture& fx) {
+  char scratch[] = "/tmp/pipeline-bench-XXXXXX";
+  if (!mkdtemp(scratch)) {
+    perror("mkdtemp");
+    return false;
+  }
+  fx.scratch = scratch;
+
+  fx.epub = std::make_shared<Epub>(fx.corpus + "/book.epub", fx.scratch);
+  if (!fx.epub->load()) {
+    fprintf(stderr, "Cannot load %s/book.epub\n", fx.corpus.c_str());
+    return false;
+  }
+  fx.epub->setupCacheDir();
+  for (int i = 0; i < fx.epub->getSpineItemsCount(); i++) {
+    const std::string href = fx.epub->getSpineItem(i).href;
+    const std::string path = fx.scratch + "/chapter" + std::to_string(i) + ".html";
+    if (!extract(*fx.epub, href, path)) {
+      fprintf(stderr, "Cannot extract %s\n", href.c_str());
+      return false;
+    }
+    const size_t slash = href.rfind('/');
+    fx.spineHrefs.push_back(href);
+    fx.chapterFiles.push_back(path);
+    fx.chapterBasePaths.push_back(slash == std::string::npos ? "" : href.substr(0, slash + 1));
+    fx.chapterHtml.emplace_back();
+    if (!readText(path, fx.chapterHtml.back())) {
+      fprintf(stderr, "Cannot read %s\n", path.c_str());
+      return false;
+    }
+  }
+  fx.jpegFile = fx.scratch + "/cover.jpg";
+  if (!extract(*fx.epub, "OEBPS/images/cover.jpg", fx.jpegFile)) {
+    fprintf(stderr, "Cannot extract the corpus image\n");
+    return false;
+  }
+
+  if (!scanFb2(fx.corpus + "/book.fb2", fx.fb2Index)) {
+    fprintf(stderr, "Cannot index %s/book.fb2\n", fx.corpus.c_str());
+    return false;
+  }
+
+  std::string text;
+  if (!readText(fx.corpus + "/book.txt", text)) {
+    fprintf(stderr, "Cannot read %s/book.txt\n", fx.corpus.c_str());
+    return false;
+  }
+  splitText(text, fx);
+  std::string md;
+  if (!readText(fx.corpus + "/book.md", md)) {
+    fprintf(stderr, "Cannot read %s/book.md\n", fx.corpus.c_str());
+    return false;
+  }
+  if (!readWords(fx.corpus + "/chapter-de.txt", fx.wordsDe) || !readWords(fx.corpus + "/chapter-ru.txt", fx.wordsRu)) {
+    fprintf(stderr, "Cannot read the German and Russian chapters in %s\n", fx.corpus.c_str());
+    return false;
+  }
+  while (fx.largeTxt.size() < 1024 * 1024) fx.largeTxt += text;
+  while (fx.largeMd.size() < 1024 * 1024) fx.largeMd += md;
+  Hyphenation::setLanguage("en");
+
+  for (size_t i = 0; i < fx.chapterFiles.size(); i++) parseChapter(fx, i, &fx.pages);
+  fx.pageFile = fx.scratch + "/pages.bin";
+
+  // The corpus is English; words that go through the Arabic and Thai shapers are made up here
+  static const char* const SHAPED_WORDS[] = {
+      "\xD8\xA7\xD9\x84\xD8\xB3\xD9\x84\xD8\xA7\xD9\x85",              // السلام
+      "\xE0\xB8\xAA\xE0\xB8\xA7\xE0\xB8\xB1\xE0\xB8\xAA\xE0\xB8\x94\xE0\xB8\xB5",  // สวัสดี
+      "\xD8\xB9\xD9\x84\xD9\x8A\xD9\x83\xD9\x85",                          // عليكم
+      "\xE0\xB8\xA0\xE0\xB8\xB2\xE0\xB8\xA9\xE0\xB8\xB2\xE0\xB9\x84\xE0\xB8\x97\xE0\xB8\xA2",  // ภาษาไทย
+      "\xD9\x83\xD8\xAA\xD8\xA7\xD8\xA8",                                  // كتاب
+      "\xE0\xB8\x99\xE0\xB9\x89\xE0\xB8\xB3",                              // น้ำ
+  };
+  ParsedText shaped(TextBlock::LEFT_ALIGN, 0, false);
+  for (int i = 0; i < 200; i++) shaped.addWord(SHAPED_WORDS[i % 6], EpdFontFamily::REGULAR);
+  shaped.layoutAndExtractLines(*fx.gfx, fx.fontId, fx.config.viewportWidth,
+                               [&fx](std::shared_ptr<TextBlock> line) { fx.shapedLines.push_back(std::move(line)); });
+  const size_t linesPerPage = fx.config.viewportHeight / fx.gfx->getLineHeight(fx.fontId);
+  if (fx.shapedLines.size() > linesPerPage) fx.shapedLines.resize(linesPerPage);
+
+  return !fx.pages.empty() && !fx.shapedLines.empty();
+}
+
+// Split text held in memory into words, in chunks the size PlainTextParser reads
+size_t tokenize(const std::string& text) {
+  constexpr size_t CHUNK = 4096;
+  size_t words = 0;
+  for (size_t offset = 0; offset < text.size(); offset += CHUNK) {
+    WordTokenizer tokenizer(text.data() + offset, std::min(CHUNK, text.size() - offset), 100);
+    WordTokenizer::Token token;
+    while (tokenizer.next(token)) words += token.kind == WordTokenizer::Kind::WORD;
+  }
+  return words > 0 ? text.size() : 0;
+}
+
+// Counts the HTML tokenizers' events and does nothing else, so only the tokenizing is timed
+struct EventCounter {
+  size_t events = 0;
+  static void onStart(void* userData, const char*, const char**) { static_cast<EventCounter*>(userData)->events++; }
+  static void onEnd(void* userData, const char*) { static_cast<EventCounter*>(userData)->events++; }
+  static void onText(void* userData, const char*, int) { static_cast<EventCounter*>(userData)->events++; }
+};
+
+// Tokenize every chapter in the 1 KB reads ChapterHtmlSlimParser makes
+size_t tokenizeHtml(const std::vector<std::string>& chapters) {
+  constexpr size_t CHUNK = 1024;
+  EventCounter counter;
+  html5::Tokenizer tokenizer({&counter, EventCounter::onStart, EventCounter::onEnd, EventCounter::onText,
+                              lookupHtmlEntity});
+  size_t bytes = 0;
+  for (const auto& html : chapters) {
+    tokenizer.reset();
+    for (size_t offset = 0; offset < html.size(); offset += CHUNK) {
+      tokenizer.feed(html.data() + offset, std::min(CHUNK, html.size() - offset));
+    }
+    tokenizer.finish();
+    bytes += html.size();
+  }
+  return counter.events > 0 ? bytes : 0;
+}
+
+// The same with Expat, set up as ChapterHtmlSlimParser had it before the HTML tokenizer, to compare
+size_t tokenizeHtmlExpat(const std::vector<std::string>& chapters) {
+  constexpr size_t CHUNK = 1024;
+  EventCounter counter;
+  size_t bytes = 0;
+  for (const auto& html : chapters) {
+    XML_Parser parser = XML_ParserCreate(nullptr);
+    XML_UseForeignDTD(parser, XML_TRUE);
+    XML_SetUserData(parser, &counter);
+    XML_SetElementHandler(parser, EventCounter::onStart, EventCounter::onEnd);
+    XML_SetCharacterDataHandler(parser, EventCounter::onText);
+    XML_SetDefaultHandlerExpand(parser, [](void* userData, const char* s, const int len) {
+      if (len >= 3 && s[0] == '&' && s[len - 1] == ';' && lookupHtmlEntity(s + 1, len - 2)) {
+        EventCounter::onText(userData, s, len);
+      }
+    });
+    bool ok = true;
+    for (size_t offset = 0; ok && offset < html.size(); offset += CHUNK) {
+      const size_t len = std::min(CHUNK, html.size() - offset);
+      ok = XML_Parse(parser, html.data() + offset, static_cast<int>(len), offset + len == html.size()) ==
+           XML_STATUS_OK;
+    }
+    XML_ParserFree(parser);
+    if (!ok) return 0;
+    bytes += html.size();
+  }
+  return counter.events > 0 ? bytes : 0;
+}
+
+int removeEntry(const char* path, const struct stat*, int, struct FTW*) { return remove(path); }
+
+// Hyphenate every word of a chapter. The language is set first, as the EPUB parser does per chapter,
+// which also empties the memo of earlier results.
+size_t hyphenateChapter(const char* language, const std::vector<std::string>& words, const bool includeFallback) {
+  Hyphenation::setLanguage(language);
+  Hyphenation::BreakInfo breaks[Hyphenation::kMaxBreaks];
+  size_t bytes = 0;
+  size_t found = 0;
+  for (const auto& word : words) {
+    found += Hyphenation::breakOffsets(word, includeFallback, breaks, Hyphenation::kMaxBreaks);
+    bytes += word.size();
+  }
+  return found > 0 ? bytes : 0;
+}
+
+// Run only the pattern matcher over every word of a chapter: no memo, no fallback breaks
+size_t matchPatterns(const char* language, const std::vector<std::string>& words) {
+  const LanguageHyphenator* hyphenator = getLanguageHyphenatorForPrimaryTag(language);
+  CodepointInfo cps[Hyphenation::kMaxBreaks];
+  size_t indexes[Hyphenation::kMaxBreaks];
+  size_t bytes = 0;
+  size_t found = 0;
+  for (const auto& word : words) {
+    const size_t count = collectCodepoints(word, cps, Hyphenation::kMaxBreaks);
+    if (count <= Hyphenation::kMaxBreaks) found += hyphenator->breakIndexes(cps, count, indexes, count);
+    bytes += word.size();
+  }
+  return found > 0 ? bytes : 0;
+}
+
+// Parse a whole file in one go, the way xtc-convert does
+template <typename Parser, typename... Extra>
+size_t parseFile(Fixture& fx, const std::string& path, const Extra&... extra) {
+  Parser parser(path, *fx.gfx, fx.config, extra...);
+  size_t pages = 0;
+  const auto add = [&pages](std::unique_ptr<Page>) { pages++; };
+  while (true) {
+    const size_t before = pages;
+    if (!parser.parsePages(add, 0)) return 0;
+    if (!parser.hasMoreContent() || pages == before) break;
+  }
+  return pages > 0 ? fileSize(path) : 0;
+}
+
+// Caches a book's pages in DEFAULT_CACHE_CHUNK batches, each a cold extend as when the reader
+// reopens a partly cached book
+template <typename Parser, typename... Extra>
+size_t cacheFile(Fixture& fx, const std::string& path, const Extra&... extra) {
+  const std::string cachePath = fx.scratch + "/cache.bin";
+  SdMan.remove(cachePath.c_str());
+  Parser parser(path, *fx.gfx, fx.config, extra...);
+  PageCache cache(cachePath);
+  if (!cache.create(parser, fx.config, PageCache::DEFAULT_CACHE_CHUNK)) return 0;
+  while (cache.isPartial()) {
+    const uint16_t before = cache.pageCount();
+    if (!cache.extend(parser, PageCache::DEFAULT_CACHE_CHUNK) || cache.pageCount() == before) return 0;
+  }
+  return fileSize(path);
+}
+
+// Returns false if a stage failed
+bool runAll(bench::Runner& runner, Fixture& fx) {
+  bool ok = true;
+  ok &= runner.run("zip_inflate/epub", [&] {
+    CountingPrint out;
+    for (const auto& href : fx.spineHrefs) {
+      if (!fx.epub->readItemContentsToStream(href, out, 1024)) return size_t{0};
+    }
+    return out.count;
+  });
+
+  ok &= runner.run("parse/epub", [&] {
+    size_t bytes = 0;
+    for (size_t i = 0; i < fx.chapterFiles.size(); i++) {
+      if (parseChapter(fx, i, nullptr) == 0) return size_t{0};
+      bytes += fileSize(fx.chapterFiles[i]);
+    }
+    return bytes;
+  });
+  ok &= runner.run("index/fb2", [&] {
+    Fb2Index index;
+    return scanFb2(fx.corpus + "/book.fb2", index) ? fileSize(fx.corpus + "/book.fb2") : 0;
+  });
+  // The inline illustration is laid out from its header; its pixels are only decoded when shown
+  const std::string fb2Images = fx.scratch + "/images";
+  ok &= runner.run("parse/fb2",
+                   [&] { return parseFile<Fb2Parser>(fx, fx.corpus + "/book.fb2", fx.fb2Index, fb2Images); });
+  ok &= runner.run("cache/fb2",
+                   [&] { return cacheFile<Fb2Parser>(fx, fx.corpus + "/book.fb2", fx.fb2Index, fb2Images); });
+  ok &= runner.run("parse/txt", [&] { return parseFile<PlainTextParser>(fx, fx.corpus + "/book.txt"); });
+  ok &= runner.run("parse/md", [&] { return parseFile<MarkdownParser>(fx, fx.corpus + "/book.md"); });
+  ok &= runner.run("tokenize/txt", [&] { return tokenize(fx.largeTxt); });
+  ok &= runner.run("tokenize/md", [&] { return tokenize(fx.largeMd); });
+  ok &= runner.run("tokenize/html", [&] { return tokenizeHtml(fx.chapterHtml); });
+  ok &= runner.run("tokenize/html_expat", [&] { return tokenizeHtmlExpat(fx.chapterHtml); });
+
+  ok &= runner.run("hyphenation", [&] { return hyphenateChapter("en", fx.words, true); });
+  ok &= runner.run("hyphenation/de", [&] { return hyphenateChapter("de", fx.wordsDe, false); });
+  ok &= runner.run("hyphenation/ru", [&] { return hyphenateChapter("ru", fx.wordsRu, false); });
+  Hyphenation::setLanguage("en");  // The rest of the corpus is English
+  ok &= runner.run("hyphenation/patterns", [&] {
+    return matchPatterns("en", fx.words) + matchPatterns("de", fx.wordsDe) + matchPatterns("ru", fx.wordsRu);
+  });
+
+  ok &= runner.run("layout/parsedtext", [&] {
+    size_t bytes = 0;
+    size_t lines = 0;
+    for (const auto& paragraph : fx.paragraphs) {
+      ParsedText text(static_cast<TextBlock::BLOCK_STYLE>(fx.config.paragraphAlignment), fx.config.indentLevel,
+                      fx.config.hyphenation);
+      for (const auto& word : paragraph) {
+        text.addWord(word, EpdFontFamily::REGULAR);
+        bytes += word.size() + 1;
+      }
+      text.layoutAndExtractLines(*fx.gfx, fx.fontId, fx.config.viewportWidth,
+                                 [&lines](std::shared_ptr<TextBlock>) { lines++; });
+    }
+    return lines > 0 ? bytes : 0;
+  });
+
+  ok &= runner.run("page/serialize", [&] {
+    FsFile file;
+    if (!SdMan.openFileForWrite("BENCH", fx.pageFile, file)) return size_t{0};
+    for (const auto& page : fx.pages) {
+      if (!page->serialize(file)) return size_t{0};
+    }
+    const size_t bytes = file.position();
+    file.close();
+    return bytes;
+  });
+
+  ok &= runner.run("page/deserialize", [&] {
+    FsFile file;
+    if (!SdMan.openFileForRead("BENCH", fx.pageFile, file)) return size_t{0};
+    for (size_t i = 0; i < fx.pages.size(); i++) {
+      if (!Page::deserialize(file)) return size_t{0};
+    }
+    const size_t bytes = file.position();
+    file.close();
+    return bytes;
+  });
+
+  // Bytes are frame buffer bytes drawn
+  ok &= runner.run("page/render", [&] {
+    for (const auto& page : fx.pages) {
+      fx.gfx->clearScreen();
+      page->render(*fx.gfx, fx.fontId, DeviceSettings::MARGIN_LEFT, DeviceSettings::MARGIN_TOP);
+    }
+    return fx.pages.size() * EInkDisplay::BUFFER_SIZE;
+  });
+
+  // One full text page in the BW and both grayscale passes of an anti-aliased page turn
+  ok &= runner.run("page/render_aa", [&] {
+    const auto& page = fx.pages[fx.pages.size() / 2];
+    for (const auto mode : {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB}) {
+      fx.gfx->setRenderMode(mode);
+      fx.gfx->clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+      page->render(*fx.gfx, fx.fontId, DeviceSettings::MARGIN_LEFT, DeviceSettings::MARGIN_TOP);
+    }
+    fx.gfx->setRenderMode(GfxRenderer::BW);
+    return 3 * EInkDisplay::BUFFER_SIZE;
+  });
+
+  // The same for a page of Arabic and Thai words, drawn from their shaped glyphs
+  ok &= runner.run("page/render_aa_shaped", [&] {
+    const int lineHeight = fx.gfx->getLineHeight(fx.fontId);
+    for (const auto mode : {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB}) {
+      fx.gfx->setRenderMode(mode);
+      fx.gfx->clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+      for (size_t i = 0; i < fx.shapedLines.size(); i++) {
+        fx.shapedLines[i]->render(*fx.gfx, fx.fontId, DeviceSettings::MARGIN_LEFT,
+                                  DeviceSettings::MARGIN_TOP + static_cast<int>(i) * lineHeight);
+      }
+    }
+    fx.gfx->setRenderMode(GfxRenderer::BW);
+    return 3 * EInkDisplay::BUFFER_SIZE;
+  });
+
+  // The size the reader converts inline images to (viewport width, screen height)
+  ok &= runner.run("image/jpeg_to_bmp", [&] {
+    FsFile file;
+    if (!SdMan.openFileForRead("BENCH", fx.jpegFile, file)) return size_t{0};
+    CountingPrint out;
+    const bool converted =
+        JpegToBmpConverter::jpegFileToBmpStreamWithSize(file, out, DeviceSettings::VIEWPORT_WIDTH, 800);
+    file.close();
+    return converted ? fileSize(fx.jpegFile) : 0;
+  });
+
+  // What the first render of a page with an FB2 illustration adds: the base64 decoded from the book
+  // into a temp file a chunk at a time, then converted (Fb2::cacheImage)
+  ok &= runner.run("image/fb2_to_bmp", [&] {
+    const int binary = fx.fb2Index.findBinary(Fb2Index::idHash("cover.jpg", 9));
+    const std::string tempPath = fx.scratch + "/fb2-image.jpg";
+    FsFile book;
+    FsFile temp;
+    if (binary < 0 || !SdMan.openFileForRead("BENCH", fx.corpus + "/book.fb2", book)) return size_t{0};
+    bool converted = SdMan.openFileForWrite("BENCH", tempPath, temp) &&
+                     Fb2Image::extract(book, fx.fb2Index.binaries[binary], temp);
+    temp.close();
+    book.close();
+    converted = converted && SdMan.openFileForRead("BENCH", tempPath, temp);
+    if (converted) {
+      CountingPrint out;
+      converted = JpegToBmpConverter::jpegFileToBmpStreamWithSize(temp, out, DeviceSettings::VIEWPORT_WIDTH, 800);
+      temp.close();
+    }
+    const Fb2Index::Range& range = fx.fb2Index.binaries[binary];
+    return converted ? static_cast<size_t>(range.end - range.start) : 0;
+  });
+  return ok;
+}
+
+void usage() {
+  fprintf(stderr, "Usage: pipeline-bench --corpus DIR [options]\n");
+  fprintf(stderr, "  --json FILE              Write the results as JSON\n");
+  fprintf(stderr, "  --baseline FILE          Compare with a stored run; exit 1 on regressions\n");
+  fprintf(stderr, "  --update-baseline        Write the results to the --baseline file instead\n");
+  fprintf(stderr, "  --filter TEXT            Only run benchmarks whose name contains TEXT\n");
+  fprintf(stderr, "  --min-time SECONDS       Minimum time per benchmark (default: 1)\n");
+  fprintf(stderr, "  --time-threshold PCT     Allowed slowdown (default: 30)\n");
+  fprintf(stderr, "  --alloc-threshold PCT    Allowed growth of allocations and bytes (default: 10)\n");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options opt;
+  bool badOption = false;
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (strcmp(arg, "--update-baseline") == 0) {
+      opt.updateBaseline = true;
+      continue;
+    }
+    if (!value) {
+      badOption = true;
+      break;
+    }
+    if (strcmp(arg, "--corpus") == 0) {
+      opt.corpus = value;
+    } else if (strcmp(arg, "--json") == 0) {
+      opt.json = value;
+    } else if (strcmp(arg, "--baseline") == 0) {
+      opt.baseline = value;
+    } else if (strcmp(arg, "--filter") == 0) {
+      opt.filter = value;
+    } else if (strcmp(arg, "--min-time") == 0) {
+      opt.minSeconds = atof(value);
+    } else if (strcmp(arg, "--time-threshold") == 0) {
+      opt.thresholds.time = atof(value) / 100;
+    } else if (strcmp(arg, "--alloc-threshold") == 0) {
+      opt.thresholds.alloc = atof(value) / 100;
+    } else {
+      badOption = true;
+      break;
+    }
+    i++;
+  }
+  // A filtered run would drop the other stages from the baseline
+  if (badOption || opt.corpus.empty() || (opt.updateBaseline && (opt.baseline.empty() || !opt.filter.empty()))) {
+    usage();
+    return 2;
+  }
+
+  // Parser logging goes to stdout
+  freopen("/dev/null", "w", stdout);
+
+  DeviceSettings settings;
+  settings.showImages = false;
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  settings.registerFont(gfx);
+
+  Fixture fx;
+  fx.corpus = opt.corpus;
+  fx.gfx = &gfx;
+  fx.config = settings.renderConfig();
+  fx.fontId = settings.fontId();
+
+  const bool ready = setUp(fx);
+  bench::Runner runner(opt.minSeconds, opt.filter);
+  const bool ok = ready && runAll(runner, fx);
+  fx.epub.reset();
+  nftw(fx.scratch.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+  if (!ok) return 1;
+
+  const auto& results = runner.results();
+  if (!opt.json.empty() && !bench::writeJson(opt.json, results)) return 1;
+  if (opt.updateBaseline) {
+    if (!bench::writeJson(opt.baseline, results)) return 1;
+    fprintf(stderr, "Updated %s\n", opt.baseline.c_str());
+    return 0;
+  }
+  if (opt.baseline.empty()) return 0;
+
+  std::vector<bench::Result> baseline;
+  if (!bench::readJson(opt.baseline, baseline)) {
+    fprintf(stderr, "No baseline at %s (record one with --update-baseline)\n", opt.baseline.c_str());
+    return 0;
+  }
+  const int regressions = bench::compare(baseline, results, opt.thresholds);
+  if (regressions > 0) {
+    fprintf(stderr, "%d benchmarks regressed (time > +%.0f%%, allocations or peak heap > +%.0f%%)\n", regressions,
+            opt.thresholds.time * 100, opt.thresholds.alloc * 100);
+    return 1;
+  }
+  fprintf(stderr, "No regressions\n");
+  return 0;
+}
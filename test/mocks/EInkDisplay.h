@@ -13,19 +13,60 @@ class EInkDisplay {
   static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
   static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
 
+  struct Window {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+  };
+
   EInkDisplay(int8_t, int8_t, int8_t, int8_t, int8_t, int8_t) { memset(frameBuffer_, 0xFF, BUFFER_SIZE); }
 
   uint8_t* getFrameBuffer() const { return const_cast<uint8_t*>(frameBuffer_); }
   void clearScreen(uint8_t color = 0xFF) { memset(frameBuffer_, color, BUFFER_SIZE); }
   void displayBuffer(RefreshMode, bool) {}
   void displayWindow(int, int, int, int, bool) {}
+  bool displayWindows(const Window*, uint8_t, bool) { return false; }
   void drawImage(const uint8_t*, int, int, int, int) {}
   void grayscaleRevert() {}
   void copyGrayscaleLsbBuffers(uint8_t*) {}
   void copyGrayscaleMsbBuffers(uint8_t*) {}
+  void writeGrayscaleBand(uint16_t, uint16_t, const uint8_t*, const uint8_t*) {}
   void displayGrayBuffer(bool) {}
   void cleanupGrayscaleBuffers(uint8_t*) {}
 
+  // Asynchronous refresh: the simulated panel stays busy until the test calls panelIdle()
+  using RefreshHandle = uint32_t;
+  static constexpr uint8_t MAX_WINDOWS = 8;
+  RefreshHandle displayBufferAsync(RefreshMode = FAST_REFRESH, bool = false) {
+    waitForRefresh();
+    busy_ = true;
+    pending_ = true;
+    return ++lastRefresh_;
+  }
+  RefreshHandle displayWindowsAsync(const Window*, uint8_t, bool) { return 0; }
+  bool isRefreshComplete(RefreshHandle handle) {
+    if (!pending_ || handle != lastRefresh_) return true;
+    if (busy_) return false;
+    pending_ = false;
+    return true;
+  }
+  void waitForRefresh() {
+    if (pending_) waits_++;
+    busy_ = false;
+    pending_ = false;
+  }
+
+  // Test hooks
+  void panelIdle() { busy_ = false; }
+  bool refreshPending() const { return pending_; }
+  uint32_t refreshCount() const { return lastRefresh_; }
+  uint32_t blockingWaits() const { return waits_; }
+
  private:
   uint8_t frameBuffer_[BUFFER_SIZE];
+  RefreshHandle lastRefresh_ = 0;
+  bool busy_ = false;
+  bool pending_ = false;
+  uint32_t waits_ = 0;
 };
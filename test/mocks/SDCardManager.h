@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "SdFat.h"
 
@@ -18,6 +19,15 @@ class SDCardManager {
 
   bool exists(const char* path) { return files_.find(path) != files_.end(); }
 
+  bool remove(const char* path) {
+    removedFiles_.push_back(path);
+    writtenFiles_.erase(path);
+    return files_.erase(path) > 0;
+  }
+
+  // Paths passed to remove(), in order
+  const std::vector<std::string>& removedFiles() const { return removedFiles_; }
+
   // Failure injection: first N open() calls for a path return an invalid FsFile
   void setOpenFailCount(int count) { openFailCount_ = count; }
 
@@ -78,11 +88,15 @@ class SDCardManager {
     return instance;
   }
 
-  void clearWrittenFiles() { writtenFiles_.clear(); }
+  void clearWrittenFiles() {
+    writtenFiles_.clear();
+    removedFiles_.clear();
+  }
 
  private:
   std::map<std::string, std::string> files_;
   std::map<std::string, std::shared_ptr<std::string>> writtenFiles_;
+  std::vector<std::string> removedFiles_;
   int openFailCount_ = 0;
   int openFileForReadFailCount_ = 0;
 };
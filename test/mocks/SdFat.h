@@ -64,6 +64,8 @@ class FsFile {
     return true;
   }
 
+  bool seekSet(size_t pos) { return seek(pos); }
+
   int read() {
     if (!isOpen_ || pos_ >= buffer_.size()) return -1;
     return static_cast<unsigned char>(buffer_[pos_++]);
@@ -71,6 +73,7 @@ class FsFile {
 
   int read(uint8_t* buf, size_t len) {
     if (!isOpen_) return -1;
+    bulkReads++;
     size_t toRead = std::min(len, buffer_.size() - pos_);
     if (toRead == 0) return 0;
     memcpy(buf, buffer_.data() + pos_, toRead);
@@ -100,6 +103,9 @@ class FsFile {
 
   bool available() const { return isOpen_ && pos_ < buffer_.size(); }
 
+  // Buffer reads across all files, for tests that count SD transfers
+  static inline size_t bulkReads = 0;
+
  private:
   std::string buffer_;
   std::shared_ptr<std::string> sharedBuffer_;
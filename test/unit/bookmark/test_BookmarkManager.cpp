@@ -15,7 +15,7 @@ int BookmarkManager::findAt(const Bookmark* bookmarks, int count,
                             ContentType type, int spineIndex, int sectionPage,
                             uint32_t flatPage) {
   for (int i = 0; i < count; i++) {
-    if (type == ContentType::Epub) {
+    if (type == ContentType::Epub || type == ContentType::Txt) {
       if (bookmarks[i].spineIndex == spineIndex &&
           bookmarks[i].sectionPage == sectionPage) {
         return i;
@@ -81,6 +81,8 @@ static void test_findAt_txt() {
   assert(BookmarkManager::findAt(bookmarks, 2, ContentType::Txt, 0, 3, 0) == 0);
   assert(BookmarkManager::findAt(bookmarks, 2, ContentType::Txt, 0, 15, 0) == 1);
   assert(BookmarkManager::findAt(bookmarks, 2, ContentType::Txt, 0, 4, 0) == -1);
+  // TXT pages count from the start of their section
+  assert(BookmarkManager::findAt(bookmarks, 2, ContentType::Txt, 1, 3, 0) == -1);
 
   // Same logic for Markdown and FB2
   assert(BookmarkManager::findAt(bookmarks, 2, ContentType::Markdown, 0, 3, 0) == 0);
@@ -0,0 +1,228 @@
+// ChapterTranscoder unit tests
+// Latin-1 and UTF-16 chapters run through the transcoder and the HTML tokenizer must give the same
+// UTF-8 events as Expat, which converted them itself before the tokenizer replaced it.
+
+#include "test_utils.h"
+
+#include <Html5Tokenizer.h>
+#include <expat.h>
+#include <htmlEntities.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "parsers/ChapterTranscoder.h"
+
+// Records events as one string; adjacent text is merged since chunk boundaries may split it
+struct Recorder {
+  std::string events;
+  int depth = 0;
+
+  static void onStart(void* userData, const char* name, const char** atts) {
+    auto* self = static_cast<Recorder*>(userData);
+    self->events += "<" + std::string(name);
+    for (int i = 0; atts[i]; i += 2) self->events += " " + std::string(atts[i]) + "=" + atts[i + 1];
+    self->events += ">";
+    self->depth++;
+  }
+
+  static void onEnd(void* userData, const char* name) {
+    auto* self = static_cast<Recorder*>(userData);
+    self->events += "</" + std::string(name) + ">";
+    self->depth--;
+  }
+
+  static void onText(void* userData, const char* s, int len) {
+    auto* self = static_cast<Recorder*>(userData);
+    if (self->depth > 0) self->events.append(s, len);
+  }
+};
+
+static std::string expatEvents(const std::string& doc) {
+  Recorder rec;
+  XML_Parser parser = XML_ParserCreate(nullptr);
+  XML_SetUserData(parser, &rec);
+  XML_SetElementHandler(parser, Recorder::onStart, Recorder::onEnd);
+  XML_SetCharacterDataHandler(parser, Recorder::onText);
+  const bool ok = XML_Parse(parser, doc.data(), static_cast<int>(doc.size()), XML_TRUE) == XML_STATUS_OK;
+  XML_ParserFree(parser);
+  return ok ? rec.events : "(expat error)";
+}
+
+// The parser's read loop: detect on the head, then convert chunks of at most chunkSize in a
+// buffer of the parser's size and tokenize them
+static std::string transcodedEvents(const std::string& doc, size_t chunkSize) {
+  static constexpr size_t CAPACITY = 1024;
+  char buf[CAPACITY];
+  Recorder rec;
+  html5::Tokenizer tokenizer({&rec, Recorder::onStart, Recorder::onEnd, Recorder::onText, lookupHtmlEntity});
+  ChapterTranscoder transcoder;
+  size_t pos = transcoder.detect(doc.data(), std::min(doc.size(), CAPACITY));
+  if (!transcoder.passThrough()) chunkSize = std::min(chunkSize, ChapterTranscoder::maxInput(CAPACITY));
+  while (pos < doc.size()) {
+    const size_t len = std::min(chunkSize, doc.size() - pos);
+    memcpy(buf, doc.data() + pos, len);
+    pos += len;
+    tokenizer.feed(buf, transcoder.convert(buf, len, CAPACITY));
+  }
+  tokenizer.finish();
+  return rec.events;
+}
+
+static std::string toUtf16(const std::string& utf8, const bool littleEndian) {
+  std::string out;
+  auto put = [&](const uint16_t unit) {
+    out += static_cast<char>(littleEndian ? unit & 0xFF : unit >> 8);
+    out += static_cast<char>(littleEndian ? unit >> 8 : unit & 0xFF);
+  };
+  put(0xFEFF);
+  for (size_t i = 0; i < utf8.size();) {
+    const auto c = static_cast<uint8_t>(utf8[i]);
+    const int n = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+    uint32_t cp = n == 1 ? c : c & (0x3F >> (n - 1));
+    for (int k = 1; k < n; k++) cp = cp << 6 | (static_cast<uint8_t>(utf8[i + k]) & 0x3F);
+    i += n;
+    if (cp >= 0x10000) {
+      put(static_cast<uint16_t>(0xD800 + ((cp - 0x10000) >> 10)));
+      put(static_cast<uint16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+    } else {
+      put(static_cast<uint16_t>(cp));
+    }
+  }
+  return out;
+}
+
+// Latin-1 bytes: e-acute, a-grave, i-diaeresis, c-cedilla, guillemets, degree, no-break space
+static const char* LATIN1_BODY =
+    "<h2 id=\"c1\">Chapitre premier</h2>\n"
+    "<p class=\"first\">D\xE9j\xE0 l'\xE9t\xE9, une na\xEFve fa\xE7" "ade, \xAB" "bonjour\xBB, n\xB0" "5&#160;!</p>\n"
+    "<p title=\"caf\xE9\">Caf\xE9 cr\xE8me \xE0 2\xA0" "F &amp; <em>th\xE9</em></p>\n";
+
+static std::string latin1Chapter(int repeats) {
+  std::string doc =
+      "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>T</title></head>\n<body>\n";
+  for (int i = 0; i < repeats; i++) doc += LATIN1_BODY;
+  return doc + "</body>\n</html>\n";
+}
+
+// UTF-8 source for the UTF-16 chapters, with a character outside the BMP for a surrogate pair
+static const char* UTF16_BODY =
+    "<h2 id=\"c1\">\xD0\x93\xD0\xBB\xD0\xB0\xD0\xB2\xD0\xB0 1</h2>\n"
+    "<p>Caf\xC3\xA9 \xE2\x80\x94 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 &amp; <b>bold</b></p>\n";
+
+static std::string utf16Source(int repeats) {
+  std::string doc =
+      "<?xml version=\"1.0\" encoding=\"UTF-16\"?>\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>T</title></head>\n<body>\n";
+  for (int i = 0; i < repeats; i++) doc += UTF16_BODY;
+  return doc + "</body>\n</html>\n";
+}
+
+static ChapterTranscoder::Encoding detected(const std::string& head, size_t* bomLen = nullptr) {
+  ChapterTranscoder transcoder;
+  const size_t bom = transcoder.detect(head.data(), head.size());
+  if (bomLen) *bomLen = bom;
+  return transcoder.encoding();
+}
+
+int main() {
+  TestUtils::TestRunner runner("ChapterTranscoder");
+  using Encoding = ChapterTranscoder::Encoding;
+
+  // Test 1: Encoding detection from the byte order mark or the XML declaration
+  {
+    size_t bom = 0;
+    runner.expectTrue(detected("\xEF\xBB\xBF<?xml version=\"1.0\"?>", &bom) == Encoding::Utf8 && bom == 3,
+                      "detect: UTF-8 BOM is skipped");
+    runner.expectTrue(detected(std::string("\xFF\xFE<\0", 4), &bom) == Encoding::Utf16Le && bom == 2,
+                      "detect: UTF-16LE BOM");
+    runner.expectTrue(detected(std::string("\xFE\xFF\0<", 4), &bom) == Encoding::Utf16Be && bom == 2,
+                      "detect: UTF-16BE BOM");
+    runner.expectTrue(detected(std::string("<\0?\0x\0", 6), &bom) == Encoding::Utf16Le && bom == 0,
+                      "detect: UTF-16LE without BOM");
+    runner.expectTrue(detected(std::string("\0<\0?\0x", 6)) == Encoding::Utf16Be, "detect: UTF-16BE without BOM");
+    runner.expectTrue(detected("<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><html/>", &bom) ==
+                              Encoding::Latin1 &&
+                          bom == 0,
+                      "detect: ISO-8859-1 declaration");
+    runner.expectTrue(detected("<?xml version='1.0' encoding = 'latin1' ?>") == Encoding::Latin1,
+                      "detect: single quotes and spaces around '='");
+    runner.expectTrue(detected("<?xml version=\"1.0\" encoding=\"windows-1252\"?>") == Encoding::Latin1,
+                      "detect: windows-1252 declaration");
+    runner.expectTrue(detected("<?xml version=\"1.0\" encoding=\"utf-8\"?>") == Encoding::Utf8,
+                      "detect: UTF-8 declaration");
+    runner.expectTrue(detected("<?xml version=\"1.0\" encoding=\"ISO-8859-15\"?>") == Encoding::Utf8,
+                      "detect: other encodings are not taken for Latin-1");
+    runner.expectTrue(detected("<?xml version=\"1.0\"?><p>encoding=\"latin1\"</p>") == Encoding::Utf8,
+                      "detect: only the declaration counts");
+    runner.expectTrue(detected("<html><p>D\xE9j\xE0</p></html>") == Encoding::Utf8, "detect: no declaration");
+    runner.expectTrue(detected("<?xml version=\"1.0\" encoding=\"latin1") == Encoding::Utf8,
+                      "detect: unterminated value");
+    runner.expectTrue(detected("") == Encoding::Utf8, "detect: empty chapter");
+  }
+
+  // Test 2: A Latin-1 chapter gives the same UTF-8 events as Expat, however it is chunked
+  {
+    const std::string doc = latin1Chapter(20);
+    const std::string expected = expatEvents(doc);
+    runner.expectTrue(expected != "(expat error)", "latin1: expat accepts the chapter");
+    runner.expectTrue(expected.find("D\xC3\xA9j\xC3\xA0 l'\xC3\xA9t\xC3\xA9") != std::string::npos,
+                      "latin1: expat delivers UTF-8");
+    bool allMatch = true;
+    for (size_t chunkSize : {1, 2, 3, 7, 64, 339, 1024}) {
+      allMatch &= runner.expectEq(expected, transcodedEvents(doc, chunkSize),
+                                  "latin1: events match expat, chunk " + std::to_string(chunkSize));
+    }
+    runner.expectTrue(allMatch, "latin1: all chunk sizes match");
+  }
+
+  // Test 3: The C1 range is read as windows-1252 (Expat gave control codes there)
+  {
+    const std::string doc =
+        "<?xml version=\"1.0\" encoding=\"iso-8859-1\"?><html><body><p>\x93quoted\x94 \x96 \x80"
+        "5 \x85</p></body></html>";
+    runner.expectEq(std::string("<html><body><p>\xE2\x80\x9Cquoted\xE2\x80\x9D \xE2\x80\x93 \xE2\x82\xAC"
+                                "5 \xE2\x80\xA6</p></body></html>"),
+                    transcodedEvents(doc, 1024), "windows-1252: quotes, dash, euro and ellipsis");
+  }
+
+  // Test 4: UTF-16 chapters in both byte orders, with code units and surrogate pairs split
+  // across chunks
+  {
+    for (const bool littleEndian : {true, false}) {
+      const std::string name = littleEndian ? "utf16le" : "utf16be";
+      const std::string doc = toUtf16(utf16Source(20), littleEndian);
+      const std::string expected = expatEvents(doc);
+      runner.expectTrue(expected != "(expat error)", name + ": expat accepts the chapter");
+      runner.expectTrue(expected.find("\xF0\x9F\x98\x80") != std::string::npos, name + ": expat joins the pair");
+      for (size_t chunkSize : {1, 3, 5, 64, 339}) {
+        runner.expectEq(expected, transcodedEvents(doc, chunkSize),
+                        name + ": events match expat, chunk " + std::to_string(chunkSize));
+      }
+    }
+  }
+
+  // Test 5: Unpaired surrogates become U+FFFD
+  {
+    const std::string doc =
+        std::string("\xFF\xFE", 2) + std::string("<\0p\0>\0", 6) + std::string("\x00\xD8", 2) +
+        std::string("a\0", 2) + std::string("\x00\xDC", 2) + std::string("<\0/\0p\0>\0", 8);
+    runner.expectEq(std::string("<p>\xEF\xBF\xBD" "a\xEF\xBF\xBD</p>"), transcodedEvents(doc, 1),
+                    "utf16: lone high and low surrogates");
+  }
+
+  // Test 6: UTF-8 chapters pass through untouched
+  {
+    ChapterTranscoder transcoder;
+    const char* doc = "<?xml version=\"1.0\"?><p>Caf\xC3\xA9</p>";
+    transcoder.detect(doc, strlen(doc));
+    char buf[64];
+    strcpy(buf, doc);
+    runner.expectEq(strlen(doc), transcoder.convert(buf, strlen(doc), sizeof(buf)), "utf8: length unchanged");
+    runner.expectEq(std::string(doc), std::string(buf, strlen(doc)), "utf8: bytes unchanged");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
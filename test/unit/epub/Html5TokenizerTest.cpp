@@ -0,0 +1,322 @@
+// Html5Tokenizer unit tests
+// Checks that the streaming tokenizer reports the same events as Expat (as configured by the old
+// ChapterHtmlSlimParser) on well-formed chapters, tolerates HTML5 markup Expat rejects, and that
+// chunking and suspend/resume never change the result. Throughput is measured by pipeline-bench
+// (tokenize/html), not here.
+
+#include "test_utils.h"
+
+#include <Html5Tokenizer.h>
+#include <expat.h>
+#include <htmlEntities.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Records events as strings; adjacent text is merged since chunk boundaries may split it.
+// Text outside the root element is dropped (Expat doesn't report it).
+struct Recorder {
+  std::vector<std::string> events;
+  int depth = 0;
+  int maxDepth = 0;
+  html5::Tokenizer* tokenizer = nullptr;
+  bool stopOnStart = false;
+  bool stopOnText = false;
+
+  static void onStart(void* userData, const char* name, const char** atts) {
+    auto* self = static_cast<Recorder*>(userData);
+    std::string event = "<" + std::string(name);
+    for (int i = 0; atts[i]; i += 2) {
+      event += " " + std::string(atts[i]) + "=" + atts[i + 1];
+    }
+    self->events.push_back(event + ">");
+    self->depth++;
+    if (self->depth > self->maxDepth) self->maxDepth = self->depth;
+    if (self->stopOnStart && self->tokenizer) self->tokenizer->stop();
+  }
+
+  static void onEnd(void* userData, const char* name) {
+    auto* self = static_cast<Recorder*>(userData);
+    self->events.push_back("</" + std::string(name) + ">");
+    self->depth--;
+  }
+
+  static void onText(void* userData, const char* s, int len) {
+    auto* self = static_cast<Recorder*>(userData);
+    if (self->depth == 0) return;
+    if (!self->events.empty() && self->events.back()[0] == '"') {
+      self->events.back().insert(self->events.back().size() - 1, s, len);
+    } else {
+      self->events.push_back("\"" + std::string(s, len) + "\"");
+    }
+    if (self->stopOnText && self->tokenizer) self->tokenizer->stop();
+  }
+
+  // Expat default handler, as the old ChapterHtmlSlimParser resolved undeclared entities
+  static void onDefault(void* userData, const char* s, int len) {
+    if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
+      const char* utf8 = lookupHtmlEntity(s + 1, len - 2);
+      if (utf8) onText(userData, utf8, static_cast<int>(strlen(utf8)));
+    }
+  }
+
+  std::string joined() const {
+    std::string out;
+    for (const auto& e : events) out += e;
+    return out;
+  }
+};
+
+static html5::Tokenizer::Handlers handlersFor(Recorder& rec) {
+  return {&rec, Recorder::onStart, Recorder::onEnd, Recorder::onText, lookupHtmlEntity};
+}
+
+static std::string tokenize(const std::string& html, size_t chunkSize = 0) {
+  Recorder rec;
+  html5::Tokenizer tokenizer(handlersFor(rec));
+  if (chunkSize == 0) chunkSize = html.size();
+  for (size_t pos = 0; pos < html.size(); pos += chunkSize) {
+    tokenizer.feed(html.data() + pos, std::min(chunkSize, html.size() - pos));
+  }
+  tokenizer.finish();
+  return rec.joined();
+}
+
+static bool expatParse(const std::string& html, Recorder& rec) {
+  XML_Parser parser = XML_ParserCreate(nullptr);
+  XML_UseForeignDTD(parser, XML_TRUE);
+  XML_SetUserData(parser, &rec);
+  XML_SetElementHandler(parser, Recorder::onStart, Recorder::onEnd);
+  XML_SetCharacterDataHandler(parser, Recorder::onText);
+  XML_SetDefaultHandlerExpand(parser, Recorder::onDefault);
+  const bool ok = XML_Parse(parser, html.data(), static_cast<int>(html.size()), XML_TRUE) == XML_STATUS_OK;
+  XML_ParserFree(parser);
+  return ok;
+}
+
+static std::string expatEvents(const std::string& html) {
+  Recorder rec;
+  return expatParse(html, rec) ? rec.joined() : "(expat error)";
+}
+
+// Well-formed XHTML chapter body in the shape EPUBs use
+static const char* CHAPTER_BODY =
+    "<h2 class=\"chapter\" id=\"c1\">Chapter&#160;One</h2>\n"
+    "<p class=\"first\">It was a &ldquo;bright&rdquo; cold day in April &mdash; and the clocks were "
+    "striking <em>thirteen</em>.<br/>Winston&nbsp;Smith, his chin nuzzled into his breast &amp; eyes "
+    "half-closed, slipped quickly through the glass doors of <span style='font-weight:bold'>Victory "
+    "Mansions</span>.</p>\n"
+    "<!-- page break -->\n"
+    "<div class=\"img\"><img src=\"../images/fig1.jpg\" alt=\"Figure &amp; caption\"/></div>\n"
+    "<p>Caf&#xE9; <a href=\"#n1\" id=\"r1\"><sup>1</sup></a> &lt;tag&gt; &#x1F600; &apos;q&apos; "
+    "&quot;dq&quot;</p>\n"
+    "<blockquote><p><i>Nested <b>bold <strong>strong</strong></b> text</i></p></blockquote>\n"
+    "<p><![CDATA[raw <b>not a tag</b> ]] text]]></p>\n"
+    "<ul><li>one</li><li>two <br /> lines</li></ul>\n"
+    "<table><tr><td>cell</td><td>cell &#8212; two</td></tr></table>\n"
+    "<p dir=\"rtl\" xml:lang=\"ar\">\xD9\x85\xD8\xB1\xD8\xAD\xD8\xA8\xD8\xA7</p>\n";
+
+static std::string xhtmlChapter(int repeats) {
+  std::string html =
+      "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<!DOCTYPE html>\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>T</title>"
+      "<link rel=\"stylesheet\" href=\"style.css\"/></head>\n<body>\n";
+  for (int i = 0; i < repeats; i++) html += CHAPTER_BODY;
+  html += "</body>\n</html>\n";
+  return html;
+}
+
+int main() {
+  TestUtils::TestRunner runner("Html5Tokenizer");
+
+  // Test 1: Same events as Expat on well-formed XHTML
+  {
+    const std::string html = xhtmlChapter(2);
+    const std::string expected = expatEvents(html);
+    runner.expectTrue(expected != "(expat error)", "xhtml: expat accepts the corpus");
+    runner.expectEq(expected, tokenize(html), "xhtml: events match expat");
+  }
+
+  // Test 2: Any chunking gives the same events
+  {
+    const std::string html = xhtmlChapter(1);
+    const std::string whole = tokenize(html);
+    runner.expectEq(whole, tokenize(html, 1), "chunks: byte by byte");
+    runner.expectEq(whole, tokenize(html, 7), "chunks: 7 bytes");
+    runner.expectEq(whole, tokenize(html, 1024), "chunks: 1024 bytes");
+  }
+
+  // Test 3: HTML5 markup Expat rejects
+  {
+    const std::string html =
+        "<P CLASS=Intro>One<br>two<img src=a.png alt>three<hr noshade></p>"
+        "<p>para<p>next</div></span><ul><li>a<li>b</ul>"
+        "<p>fish & chips &copy; &bogus; &#xZZ; &amp</p>";
+    runner.expectTrue(expatEvents(html) == "(expat error)", "html5: expat rejects it");
+    runner.expectEq(std::string("<p class=Intro>\"One\"<br></br>\"two\"<img src=a.png alt=></img>\"three\""
+                                "<hr noshade=></hr></p><p>\"para\"</p><p>\"next\"<ul><li>\"a\"</li>"
+                                "<li>\"b\"</li></ul></p><p>\"fish & chips \xC2\xA9 &bogus; &#xZZ; &amp\"</p>"),
+                    tokenize(html), "html5: tolerated and normalized");
+  }
+
+  // Test 4: Attribute values and references
+  {
+    runner.expectEq(std::string("<a title=a & b \xE2\x80\x94 &x; c href=#n1 data-x=it's></a>"),
+                    tokenize("<a title=\"a &amp; b &mdash; &x; c\" href='#n1' data-x=\"it's\"></a>"),
+                    "attrs: decoded, quotes and unknown references kept");
+    runner.expectEq(std::string("<p>\"\xEF\xBF\xBD\xEF\xBF\xBD<\"</p>"), tokenize("<p>&#0;&#xD800;&#60;</p>"),
+                    "refs: invalid code points become U+FFFD");
+  }
+
+  // Test 5: Comments, doctype, processing instructions and script/style content are dropped
+  {
+    runner.expectEq(std::string("<p>\"ab\"</p><script></script><style></style><p>\"c\"</p>"),
+                    tokenize("<!doctype html><?pi x?><p>a<!-- <b>x</b> -->b</p>"
+                             "<script>if (a < b && c) { x = '</p>'; }</script>"
+                             "<style>p > b { }</style  ><p>c</p>"),
+                    "skip: non-content dropped");
+  }
+
+  // Test 6: finish() closes what is still open and is idempotent
+  {
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    const std::string html = "<html><body><div><p>unterminated &amp";
+    tokenizer.feed(html.data(), html.size());
+    tokenizer.finish();
+    runner.expectEq(std::string("<html><body><div><p>\"unterminated &amp\"</p></div></body></html>"), rec.joined(),
+                    "finish: open elements closed");
+    tokenizer.finish();
+    runner.expectEq(static_cast<size_t>(9), rec.events.size(), "finish: second call emits nothing");
+    runner.expectEq(0, tokenizer.depth(), "finish: stack empty");
+  }
+
+  // Test 7: Suspend from callbacks and resume with the unconsumed rest
+  {
+    const std::string html = xhtmlChapter(1);
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    rec.tokenizer = &tokenizer;
+    rec.stopOnStart = true;
+    rec.stopOnText = true;
+
+    int suspends = 0;
+    bool progressed = true;
+    constexpr size_t chunkSize = 100;
+    for (size_t pos = 0; pos < html.size(); pos += chunkSize) {
+      const size_t len = std::min(chunkSize, html.size() - pos);
+      size_t consumed = 0;
+      while (consumed < len) {
+        const size_t n = tokenizer.feed(html.data() + pos + consumed, len - consumed);
+        if (tokenizer.suspended()) suspends++;
+        if (n == 0 && !tokenizer.suspended()) progressed = false;
+        consumed += n;
+        if (!tokenizer.suspended() && consumed < len) progressed = false;
+      }
+    }
+    do {
+      tokenizer.finish();
+    } while (tokenizer.suspended());
+
+    runner.expectTrue(suspends > 50, "suspend: callbacks stopped the tokenizer");
+    runner.expectTrue(progressed, "suspend: feed only returns early when stopped");
+    runner.expectEq(tokenize(html), rec.joined(), "suspend: resumed events identical");
+  }
+
+  // Test 8: Stop during a queued close and during finish()
+  {
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    rec.tokenizer = &tokenizer;
+    rec.stopOnStart = true;
+    // <li> closes the open <li> and opens a new one: the stop lands between the queued events
+    const std::string html = "<ul><li>a<li>b";
+    size_t pos = 0;
+    int feeds = 0;
+    while (pos < html.size() && feeds < 100) {
+      pos += tokenizer.feed(html.data() + pos, html.size() - pos);
+      feeds++;
+    }
+    int finishes = 0;
+    do {
+      tokenizer.finish();
+      finishes++;
+    } while (tokenizer.suspended() && finishes < 100);
+    runner.expectEq(std::string("<ul><li>\"a\"</li><li>\"b\"</li></ul>"), rec.joined(), "queued: order kept");
+    runner.expectTrue(feeds > 1, "queued: suspended mid-chunk");
+  }
+
+  // Test 9: Limits - nesting depth, attribute count and lengths stay bounded
+  {
+    std::string deep;
+    for (int i = 0; i < 300; i++) deep += "<span>";
+    deep += "x";
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    tokenizer.feed(deep.data(), deep.size());
+    runner.expectEq(html5::Tokenizer::MAX_DEPTH, tokenizer.depth(), "limits: stack depth capped");
+    tokenizer.finish();
+    runner.expectEq(0, rec.depth, "limits: starts and ends balance");
+    runner.expectEq(html5::Tokenizer::MAX_DEPTH + 1, rec.maxDepth, "limits: deeper elements reported empty");
+
+    std::string manyAttrs = "<p";
+    for (int i = 0; i < 40; i++) manyAttrs += " a" + std::to_string(i) + "=v";
+    manyAttrs += " title=\"" + std::string(4000, 'z') + "\">t</p>";
+    Recorder attrs;
+    html5::Tokenizer attrTokenizer(handlersFor(attrs));
+    attrTokenizer.feed(manyAttrs.data(), manyAttrs.size());
+    attrTokenizer.finish();
+    size_t count = 0;
+    for (const char c : attrs.events[0]) count += c == '=';
+    runner.expectEq(static_cast<size_t>(html5::Tokenizer::MAX_ATTRS), count, "limits: attributes capped");
+    runner.expectEq(std::string("\"t\""), attrs.events[1], "limits: text after oversized tag intact");
+
+    const std::string longName = "<" + std::string(100, 'q') + ">x</" + std::string(100, 'q') + ">";
+    runner.expectEq("<" + std::string(31, 'q') + ">\"x\"</" + std::string(31, 'q') + ">", tokenize(longName),
+                    "limits: long names truncated consistently");
+  }
+
+  // Test 10: reset() starts a new document
+  {
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    tokenizer.feed("<div><p>a &am", 13);
+    tokenizer.reset();
+    rec.events.clear();
+    rec.depth = 0;
+    tokenizer.feed("<p>b</p>", 8);
+    tokenizer.finish();
+    runner.expectEq(std::string("<p>\"b\"</p>"), rec.joined(), "reset: no state carried over");
+  }
+
+  // Test 11: A fresh tokenizer given the open elements continues from an idle position
+  {
+    const std::string html = xhtmlChapter(2);
+    Recorder rec;
+    html5::Tokenizer tokenizer(handlersFor(rec));
+    rec.tokenizer = &tokenizer;
+    rec.stopOnStart = true;
+
+    size_t pos = 0;
+    while (pos < html.size()) {
+      pos += tokenizer.feed(html.data() + pos, html.size() - pos);
+      if (pos > html.size() / 2 && tokenizer.idle() && rec.events.back() == "<p>") break;
+    }
+    runner.expectTrue(pos < html.size(), "restart: stopped at an idle start tag");
+
+    Recorder restarted;
+    restarted.events = rec.events;
+    restarted.depth = rec.depth;
+    html5::Tokenizer fresh(handlersFor(restarted));
+    for (int i = 0; i < tokenizer.depth(); i++) fresh.pushOpenElement(tokenizer.openElement(i));
+    runner.expectEq(tokenizer.depth(), fresh.depth(), "restart: open elements copied");
+
+    fresh.feed(html.data() + pos, html.size() - pos);
+    fresh.finish();
+    runner.expectEq(tokenize(html), restarted.joined(), "restart: same events as an uninterrupted run");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
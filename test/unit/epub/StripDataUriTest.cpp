@@ -193,6 +193,7 @@ int main() {
     // Should save partial match and output just '<img '
     runner.expectEqual(std::string("<img "), std::string(buf1),
                        "Partial data URI (chunk 1): partial match saved");
+    runner.expectEq(static_cast<size_t>(8), stripper.pendingLength(), "Partial data URI (chunk 1): held back");
 
     // Second chunk continues with 'a:image/png;base64,ABC" alt="test">'
     // Buffer needs extra capacity for prepended partial match (up to 9 bytes)
@@ -203,6 +204,7 @@ int main() {
     // Should prepend partial match and process complete data URI
     runner.expectEqual(std::string("src=\"#\" alt=\"test\">"), std::string(buf2),
                        "Partial data URI (chunk 2): complete pattern processed");
+    runner.expectEq(static_cast<size_t>(0), stripper.pendingLength(), "Partial data URI (chunk 2): nothing held");
   }
 
   // ============================================
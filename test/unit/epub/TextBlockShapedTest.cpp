@@ -0,0 +1,150 @@
+// TextBlock serialization tests for Arabic and Thai words shaped at layout
+//
+// The shaped glyphs are written after the word flags, with per-word glyph counts only when a line
+// has shaped words. A block read back must draw the same glyphs it was written with.
+
+#include "test_utils.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <GfxRenderer.h>
+#include <ScriptDetector.h>
+
+#include "SdFat.h"
+#include "blocks/TextBlock.h"
+
+// Link stub: no bitmaps are drawn here
+BmpReaderError Bitmap::readRow(uint8_t*, uint8_t*, int) const { return BmpReaderError::Ok; }
+
+namespace {
+
+constexpr uint8_t kLatin = GfxRenderer::TEXT_FLAGS_SET | GfxRenderer::TEXT_PRINTABLE;
+constexpr uint8_t kArabic = kLatin | ScriptDetector::HAS_ARABIC;
+constexpr uint8_t kThai = kLatin | ScriptDetector::HAS_THAI;
+
+const char* const kSalam = "\xD8\xA7\xD9\x84\xD8\xB3\xD9\x84\xD8\xA7\xD9\x85";  // السلام
+const char* const kLa = "\xD9\x84\xD8\xA7";                                       // لا (ligature)
+const char* const kWater = "\xE0\xB8\x99\xE0\xB9\x89\xE0\xB8\xB3";               // น้ำ
+// สวัสดี
+const char* const kSawasdee = "\xE0\xB8\xAA\xE0\xB8\xA7\xE0\xB8\xB1\xE0\xB8\xAA\xE0\xB8\x94\xE0\xB8\xB5";
+
+// A line of words, shaping those drawText() would draw as Arabic or Thai, as ParsedText does
+std::unique_ptr<TextBlock> makeLine(const std::vector<std::pair<std::string, uint8_t>>& words) {
+  std::vector<TextBlock::WordData> data;
+  std::vector<TextBlock::ShapedGlyph> shaped;
+  uint16_t x = 0;
+  for (const auto& word : words) {
+    const uint16_t count = TextBlock::shapeWord(word.first, word.second, shaped);
+    data.push_back({word.first, x, EpdFontFamily::REGULAR, word.second, count});
+    x += 40;
+  }
+  return std::unique_ptr<TextBlock>(new TextBlock(std::move(data), TextBlock::JUSTIFIED, std::move(shaped)));
+}
+
+std::string serialize(const TextBlock& block) {
+  auto buffer = std::make_shared<std::string>();
+  FsFile file;
+  file.setSharedBuffer(buffer);
+  block.serialize(file);
+  file.close();
+  return *buffer;
+}
+
+std::unique_ptr<TextBlock> deserialize(const std::string& data) {
+  FsFile file;
+  file.setBuffer(data);
+  return TextBlock::deserialize(file);
+}
+
+bool sameGlyphs(const std::vector<TextBlock::ShapedGlyph>& a, const std::vector<TextBlock::ShapedGlyph>& b) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (a[i].codepoint != b[i].codepoint || a[i].xOffset != b[i].xOffset || a[i].yOffset != b[i].yOffset ||
+        a[i].zeroAdvance != b[i].zeroAdvance) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool sameWords(const TextBlock& a, const TextBlock& b) {
+  const auto& wa = a.getWords();
+  const auto& wb = b.getWords();
+  if (wa.size() != wb.size()) return false;
+  for (size_t i = 0; i < wa.size(); i++) {
+    if (wa[i].word != wb[i].word || wa[i].xPos != wb[i].xPos || wa[i].style != wb[i].style ||
+        wa[i].flags != wb[i].flags || wa[i].shapedCount != wb[i].shapedCount) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("TextBlockShaped");
+
+  // Test 1: Only Arabic and Thai words are shaped
+  {
+    std::vector<TextBlock::ShapedGlyph> out;
+    runner.expectEq(static_cast<uint16_t>(0), TextBlock::shapeWord("hello", kLatin, out), "shapeWord: Latin");
+    runner.expectEq(static_cast<uint16_t>(0), TextBlock::shapeWord(kSalam, GfxRenderer::TEXT_FLAGS_SET, out),
+                    "shapeWord: nothing printable");
+    runner.expectTrue(out.empty(), "shapeWord: no glyphs for unshaped words");
+    runner.expectEq(static_cast<uint16_t>(1), TextBlock::shapeWord(kLa, kArabic, out), "shapeWord: lam-alef ligature");
+    runner.expectTrue(TextBlock::shapeWord(kWater, kThai, out) > 0, "shapeWord: Thai");
+    bool marks = false;
+    for (const auto& g : out) marks |= g.zeroAdvance && g.yOffset != 0;
+    runner.expectTrue(marks, "shapeWord: Thai marks are positioned, without advance");
+  }
+
+  // Test 2: A mixed line round-trips with its glyphs
+  {
+    const auto line = makeLine({{"Hello", kLatin}, {kSalam, kArabic}, {kWater, kThai}, {"world", kLatin},
+                                {kSawasdee, kThai}, {kLa, kArabic}});
+    runner.expectTrue(line->getShapedGlyphs().size() > 10, "mixed: words shaped");
+
+    const auto read = deserialize(serialize(*line));
+    runner.expectTrue(read != nullptr, "mixed: deserializes");
+    if (read) {
+      runner.expectTrue(sameWords(*line, *read), "mixed: words, positions, flags and glyph counts");
+      runner.expectTrue(sameGlyphs(line->getShapedGlyphs(), read->getShapedGlyphs()), "mixed: glyphs");
+      runner.expectEq(static_cast<int>(TextBlock::JUSTIFIED), static_cast<int>(read->getStyle()), "mixed: style");
+      runner.expectEq(serialize(*line), serialize(*read), "mixed: writes the same bytes again");
+    }
+  }
+
+  // Test 3: Per-word glyph counts are only written for lines with shaped words
+  {
+    const auto plain = makeLine({{"one", kLatin}, {"two", kLatin}, {"three", kLatin}});
+    const auto read = deserialize(serialize(*plain));
+    runner.expectTrue(read != nullptr && read->getShapedGlyphs().empty(), "plain: no glyphs");
+    runner.expectTrue(read && sameWords(*plain, *read), "plain: words");
+
+    // The same words, with the last one shaped: its glyphs plus a count per word
+    const auto shaped = makeLine({{"one", kLatin}, {"two", kLatin}, {kWater, kThai}});
+    const auto unshaped = makeLine({{"one", kLatin}, {"two", kLatin}, {kWater, kLatin}});
+    const size_t glyphBytes = shaped->getShapedGlyphs().size() * 6 + 3 * sizeof(uint16_t);
+    runner.expectEq(serialize(*unshaped).size() + glyphBytes, serialize(*shaped).size(),
+                    "plain: counts only written if shaped");
+  }
+
+  // Test 4: Damaged glyph data is rejected
+  {
+    const auto line = makeLine({{kSalam, kArabic}, {kSawasdee, kThai}});
+    const std::string data = serialize(*line);
+    runner.expectTrue(deserialize(data.substr(0, data.size() - 2)) == nullptr, "damaged: cut short");
+
+    // The glyph count sits after the two words' strings, positions, styles and flags
+    const size_t countPos = data.size() - 1 - line->getShapedGlyphs().size() * 6 - 2 * sizeof(uint16_t) - 2;
+    std::string wrongCount = data;
+    wrongCount[countPos]++;
+    runner.expectTrue(deserialize(wrongCount) == nullptr, "damaged: glyph count differs from the words'");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+// Fb2Image unit tests
+//
+// Tests decoding the base64 of <binary> elements in chunks split anywhere, reading image sizes
+// from JPEG and PNG headers, and pulling an image out of a book through its index.
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Fb2Image.h"
+#include "Fb2Index.h"
+#include "SdFat.h"
+
+namespace {
+
+std::string base64(const std::string& data, const size_t lineLength = 76) {
+  static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  size_t column = 0;
+  for (size_t i = 0; i < data.size(); i += 3) {
+    uint32_t bits = static_cast<uint8_t>(data[i]) << 16;
+    if (i + 1 < data.size()) bits |= static_cast<uint8_t>(data[i + 1]) << 8;
+    if (i + 2 < data.size()) bits |= static_cast<uint8_t>(data[i + 2]);
+    out += kAlphabet[(bits >> 18) & 0x3F];
+    out += kAlphabet[(bits >> 12) & 0x3F];
+    out += i + 1 < data.size() ? kAlphabet[(bits >> 6) & 0x3F] : '=';
+    out += i + 2 < data.size() ? kAlphabet[bits & 0x3F] : '=';
+    column += 4;
+    if (lineLength > 0 && column >= lineLength) {
+      out += "\n";
+      column = 0;
+    }
+  }
+  return out;
+}
+
+// Decodes a whole element, fed in chunks of the given size (0 for all at once)
+std::string decode(const std::string& element, const size_t chunk = 0, bool* finished = nullptr) {
+  Fb2BinaryDecoder decoder;
+  std::string out;
+  const size_t step = chunk == 0 ? element.size() : chunk;
+  for (size_t pos = 0; pos < element.size(); pos += step) {
+    const size_t length = std::min(step, element.size() - pos);
+    std::vector<uint8_t> buffer(Fb2BinaryDecoder::outputSize(length));
+    const size_t written =
+        decoder.feed(reinterpret_cast<const uint8_t*>(element.data()) + pos, length, buffer.data());
+    out.append(reinterpret_cast<const char*>(buffer.data()), written);
+  }
+  if (finished) *finished = decoder.finished();
+  return out;
+}
+
+ImageHeaderProbe probeOf(const std::string& data, const size_t chunk = 0) {
+  ImageHeaderProbe probe;
+  const size_t step = chunk == 0 ? std::max<size_t>(data.size(), 1) : chunk;
+  for (size_t pos = 0; pos < data.size() && !probe.finished(); pos += step) {
+    probe.feed(reinterpret_cast<const uint8_t*>(data.data()) + pos, std::min(step, data.size() - pos));
+  }
+  return probe;
+}
+
+std::string segment(const uint8_t marker, const std::string& payload) {
+  const size_t length = payload.size() + 2;
+  return std::string{'\xFF', static_cast<char>(marker), static_cast<char>(length >> 8), static_cast<char>(length)} +
+         payload;
+}
+
+// A JPEG header: JFIF, a large EXIF segment full of 0xFF bytes, tables, then the frame header
+std::string jpegHeader(const uint16_t width, const uint16_t height, const uint8_t sof = 0xC0) {
+  std::string exif = "Exif";
+  exif += std::string(3000, '\xFF');
+  exif += std::string{'\xFF', '\xC0', 0, 17, 8, 0, 1, 0, 1};  // A thumbnail's frame header, inside the segment
+  std::string data = "\xFF\xD8";
+  data += segment(0xE0, std::string("JFIF\0\x01\x01\0\0\x01\0\x01\0\0", 14));
+  data += segment(0xE1, exif);
+  data += segment(0xDB, std::string(65, '\x01'));
+  data += segment(0xC4, std::string(20, '\x02'));
+  data += "\xFF\xFF";  // Fill bytes before a marker
+  data += segment(sof, std::string{8, static_cast<char>(height >> 8), static_cast<char>(height & 0xFF),
+                                   static_cast<char>(width >> 8), static_cast<char>(width & 0xFF), 3});
+  data += segment(0xDA, std::string(10, '\x03'));
+  data += "scan data\xFF\xD9";
+  return data;
+}
+
+std::string pngHeader(const uint32_t width, const uint32_t height) {
+  std::string data("\x89PNG\r\n\x1A\n\0\0\0\x0DIHDR", 16);
+  for (const uint32_t value : {width, height}) {
+    for (int shift = 24; shift >= 0; shift -= 8) data += static_cast<char>((value >> shift) & 0xFF);
+  }
+  data += std::string("\x08\x02\0\0\0", 5);
+  return data;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Fb2Image");
+
+  // Test 1: Base64 with every kind of padding, whitespace and line breaks
+  {
+    bool finished = false;
+    runner.expectEq(std::string("f"), decode("<binary>Zg==</binary>", 0, &finished), "base64: two padding bytes");
+    runner.expectTrue(finished, "base64: finished at the end tag");
+    runner.expectEq(std::string("fo"), decode("<binary>Zm8=</binary>"), "base64: one padding byte");
+    runner.expectEq(std::string("foo"), decode("<binary>Zm9v</binary>"), "base64: no padding");
+    runner.expectEq(std::string("fo"), decode("<binary>Zm8</binary>"), "base64: missing padding");
+    runner.expectEq(std::string("foobar"), decode("<binary>\n  Zm9v\r\n\tYmFy \n</binary>"),
+                    "base64: whitespace skipped");
+    decode("<binary>Zm9v", 0, &finished);
+    runner.expectFalse(finished, "base64: not finished without an end tag");
+  }
+
+  // Test 2: The start tag, attribute values with '>' in them, and namespace prefixes
+  {
+    const std::string element = "<fb:binary content-type=\"image/jpeg\" id='a>b'>Zm9vYmFy</fb:binary>";
+    runner.expectEq(std::string("foobar"), decode(element), "tag: attributes skipped");
+    runner.expectEq(std::string(""), decode("<binary id=\"x\"></binary>"), "tag: empty binary");
+  }
+
+  // Test 3: Chunks split anywhere give the same bytes
+  {
+    std::string data;
+    for (int i = 0; i < 1000; i++) data += static_cast<char>((i * 37) & 0xFF);
+    const std::string element = "<binary id=\"img\" content-type=\"image/png\">\n" + base64(data) + "</binary>";
+    bool same = true;
+    for (const size_t chunk : {1, 2, 3, 4, 5, 7, 64, 128, 4096}) {
+      same &= decode(element, chunk) == data;
+    }
+    runner.expectTrue(same, "chunks: same bytes for every chunk size");
+    runner.expectEq(data.substr(0, 998), decode("<binary>" + base64(data.substr(0, 998), 0) + "</binary>", 3),
+                    "chunks: padded tail");
+  }
+
+  // Test 4: JPEG frame headers, past large segments and in chunks
+  {
+    const ImageHeaderProbe probe = probeOf(jpegHeader(640, 480));
+    runner.expectTrue(probe.valid(), "jpeg: valid");
+    runner.expectTrue(probe.format() == ImageHeaderProbe::Format::JPEG, "jpeg: format");
+    runner.expectEq(static_cast<uint32_t>(640), probe.width(), "jpeg: width");
+    runner.expectEq(static_cast<uint32_t>(480), probe.height(), "jpeg: height");
+
+    bool same = true;
+    for (const size_t chunk : {1, 2, 3, 96, 1000}) {
+      const ImageHeaderProbe chunked = probeOf(jpegHeader(1200, 1600), chunk);
+      same &= chunked.valid() && chunked.width() == 1200 && chunked.height() == 1600;
+    }
+    runner.expectTrue(same, "jpeg: same size for every chunk size");
+
+    const ImageHeaderProbe progressive = probeOf(jpegHeader(300, 200, 0xC2));
+    runner.expectTrue(progressive.valid() && progressive.width() == 300, "jpeg: progressive frame header");
+  }
+
+  // Test 5: PNG header
+  {
+    const ImageHeaderProbe probe = probeOf(pngHeader(1024, 70000), 5);
+    runner.expectTrue(probe.valid(), "png: valid");
+    runner.expectTrue(probe.format() == ImageHeaderProbe::Format::PNG, "png: format");
+    runner.expectEq(static_cast<uint32_t>(1024), probe.width(), "png: width");
+    runner.expectEq(static_cast<uint32_t>(70000), probe.height(), "png: height");
+  }
+
+  // Test 6: Data that has no size to give
+  {
+    runner.expectFalse(probeOf("GIF89a\x10\0\x10\0").valid(), "invalid: GIF");
+    runner.expectTrue(probeOf("GIF89a").finished(), "invalid: GIF is finished");
+    const std::string scanFirst = "\xFF\xD8" + segment(0xDA, "xx") + segment(0xC0, std::string(6, '\x01'));
+    runner.expectFalse(probeOf(scanFirst).valid(), "invalid: scan before the frame header");
+    std::string zeroSize = pngHeader(0, 10);
+    runner.expectFalse(probeOf(zeroSize).valid(), "invalid: zero width");
+    const std::string cut = jpegHeader(10, 10).substr(0, 200);
+    runner.expectFalse(probeOf(cut).finished(), "invalid: cut short is not finished");
+  }
+
+  // Test 7: Reading a book's image through its index
+  {
+    const std::string image = jpegHeader(800, 600);
+    const std::string book =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<FictionBook xmlns:l=\"http://www.w3.org/1999/xlink\"><body><section>"
+        "<image l:href=\"#pic.jpg\"/><p>Text</p></section></body>\n"
+        "<binary content-type=\"image/png\" id=\"other.png\">" +
+        base64(pngHeader(1, 1)) + "</binary>\n<binary id=\"pic.jpg\" content-type=\"image/jpeg\">\n" +
+        base64(image) + "</binary>\n</FictionBook>\n";
+    Fb2Index index;
+    index.feed(reinterpret_cast<const uint8_t*>(book.data()), book.size());
+    const int binary = index.findBinary(Fb2Index::idHash("pic.jpg", 7));
+    runner.expectEq(1, binary, "book: image found by id");
+
+    FsFile file;
+    file.setBuffer(book);
+    ImageHeaderProbe probe;
+    runner.expectTrue(Fb2Image::probe(file, index.binaries[binary], probe), "book: probe");
+    runner.expectTrue(probe.width() == 800 && probe.height() == 600, "book: probed size");
+
+    FsFile out;
+    out.setBuffer("");
+    runner.expectTrue(Fb2Image::extract(file, index.binaries[binary], out), "book: extract");
+    runner.expectTrue(out.getBuffer() == image, "book: extracted bytes");
+
+    // A range that stops before the end tag was not a whole binary
+    FsFile cutOut;
+    cutOut.setBuffer("");
+    const Fb2Index::Range cut = {index.binaries[binary].start, index.binaries[binary].start + 200};
+    runner.expectFalse(Fb2Image::extract(file, cut, cutOut), "book: unfinished binary fails");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,218 @@
+// Fb2Index unit tests
+//
+// Tests the byte-level structure scan: element offsets, nesting, markup that only looks like
+// tags (comments, CDATA, attribute values), chunks split anywhere, and the spans Fb2Parser feeds.
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Fb2Index.h"
+#include "SdFat.h"
+
+namespace {
+
+const std::string kBook =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<FictionBook xmlns=\"http://www.gribuser.ru/xml/fictionbook/2.0\" xmlns:l=\"http://www.w3.org/1999/xlink\">\n"
+    "<description><title-info><book-title>Book</book-title>"
+    "<coverpage><image l:href=\"#cover\"/></coverpage></title-info></description>\n"
+    "<body>\n"
+    "<section><title><p>One</p></title><p>Text</p></section>\n"
+    "<section><title><p>Two</p></title>\n"
+    "  <section><p>Nested</p></section>\n"
+    "  <p>More</p>\n"
+    "</section>\n"
+    "<section><p>Three</p></section>\n"
+    "</body>\n"
+    "<body name=\"notes\"><section><p>Note</p></section></body>\n"
+    "<binary id=\"cover\" content-type=\"image/jpeg\">/9j/4AAQSkZJRgABAQ+/=</binary>\n"
+    "</FictionBook>\n";
+
+Fb2Index indexOf(const std::string& text, const size_t chunk = 0) {
+  Fb2Index index;
+  const auto* data = reinterpret_cast<const uint8_t*>(text.data());
+  if (chunk == 0) {
+    index.feed(data, text.size());
+    return index;
+  }
+  for (size_t pos = 0; pos < text.size(); pos += chunk) {
+    index.feed(data + pos, std::min(chunk, text.size() - pos));
+  }
+  return index;
+}
+
+uint32_t offsetOf(const std::string& text, const std::string& needle, const size_t from = 0) {
+  return static_cast<uint32_t>(text.find(needle, from));
+}
+
+uint32_t endOf(const std::string& text, const std::string& needle, const size_t from = 0) {
+  return static_cast<uint32_t>(text.find(needle, from) + needle.size());
+}
+
+bool sameIndex(const Fb2Index& a, const Fb2Index& b) {
+  if (a.bodies.size() != b.bodies.size() || a.binaries.size() != b.binaries.size() ||
+      a.sections.size() != b.sections.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.bodies.size(); i++) {
+    if (a.bodies[i].start != b.bodies[i].start || a.bodies[i].end != b.bodies[i].end) return false;
+  }
+  for (size_t i = 0; i < a.binaries.size(); i++) {
+    if (a.binaries[i].start != b.binaries[i].start || a.binaries[i].end != b.binaries[i].end) return false;
+  }
+  if (a.binaryIds != b.binaryIds) return false;
+  for (size_t i = 0; i < a.sections.size(); i++) {
+    if (a.sections[i].offset != b.sections[i].offset || a.sections[i].level != b.sections[i].level) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Fb2Index");
+
+  // Test 1: Structure of a whole book
+  {
+    const Fb2Index index = indexOf(kBook);
+    runner.expectTrue(index.valid(), "book: valid");
+    runner.expectEq(static_cast<size_t>(2), index.bodies.size(), "book: two bodies");
+    runner.expectEq(offsetOf(kBook, "<body>"), index.bodies[0].start, "book: main body start");
+    runner.expectEq(endOf(kBook, "</body>"), index.bodies[0].end, "book: main body end");
+    runner.expectEq(endOf(kBook, "</body>"), index.contentEnd(), "book: content ends with the main body");
+    runner.expectEq(static_cast<size_t>(1), index.binaries.size(), "book: one binary");
+    runner.expectEq(offsetOf(kBook, "<binary"), index.binaries[0].start, "book: binary start");
+    runner.expectEq(endOf(kBook, "</binary>"), index.binaries[0].end, "book: binary end");
+
+    // The notes body's section is not a section of the book
+    runner.expectEq(static_cast<size_t>(4), index.sections.size(), "book: main body sections only");
+    runner.expectEq(offsetOf(kBook, "<section>"), index.sections[0].offset, "book: first section offset");
+    runner.expectEq(offsetOf(kBook, "<section><p>Nested"), index.sections[2].offset, "book: nested section offset");
+    runner.expectEq(static_cast<uint8_t>(0), index.sections[1].level, "book: second section is top-level");
+    runner.expectEq(static_cast<uint8_t>(1), index.sections[2].level, "book: nested section level");
+    runner.expectEq(static_cast<uint8_t>(0), index.sections[3].level, "book: third section back at top-level");
+  }
+
+  // Test 2: Chunks split tags, attribute values and end tags anywhere
+  {
+    const Fb2Index whole = indexOf(kBook);
+    bool same = true;
+    for (const size_t chunk : {1, 2, 3, 5, 7, 16, 64}) {
+      same &= sameIndex(whole, indexOf(kBook, chunk));
+    }
+    runner.expectTrue(same, "chunks: same index for every chunk size");
+  }
+
+  // Test 3: Markup that only looks like tags
+  {
+    const std::string text =
+        "<FictionBook><body>"
+        "<!-- <section> in a comment -- still a comment -->"
+        "<section><p><![CDATA[ <section> ]] > ]]></p>"
+        "<p a=\"<section>\" b='/>'>x</p>"
+        "<?pi <section> ?></section>"
+        "<!DOCTYPE x>"
+        "<section/>"
+        "</body></FictionBook>";
+    const Fb2Index index = indexOf(text);
+    runner.expectTrue(index.valid(), "lookalikes: valid");
+    runner.expectEq(static_cast<size_t>(2), index.sections.size(), "lookalikes: only the real sections");
+    runner.expectEq(offsetOf(text, "<section><p>"), index.sections[0].offset, "lookalikes: first section");
+    runner.expectEq(offsetOf(text, "<section/>"), index.sections[1].offset, "lookalikes: self-closing section");
+    runner.expectEq(static_cast<uint8_t>(0), index.sections[1].level, "lookalikes: self-closing section level");
+  }
+
+  // Test 4: Namespace prefixes and names that only start like ours
+  {
+    const std::string text =
+        "<fb:FictionBook><fb:body><fb:section><sections/><sectionx>"
+        "</sectionx><bodyx/></fb:section ></fb:body></fb:FictionBook>";
+    const Fb2Index index = indexOf(text);
+    runner.expectTrue(index.valid(), "prefixes: valid");
+    runner.expectEq(static_cast<size_t>(1), index.bodies.size(), "prefixes: one body");
+    runner.expectEq(endOf(text, "</fb:body>"), index.contentEnd(), "prefixes: body end");
+    runner.expectEq(static_cast<size_t>(1), index.sections.size(), "prefixes: one section");
+  }
+
+  // Test 5: Spans jump over binaries inside the content
+  {
+    const std::string text =
+        "<FictionBook><body><section><p>A</p></section>"
+        "<binary id=\"x\">AAAA</binary><section><p>B</p></section>"
+        "</body><binary id=\"y\">BBBB</binary></FictionBook>";
+    const Fb2Index index = indexOf(text);
+    const uint32_t binary = offsetOf(text, "<binary");
+    const uint32_t afterBinary = endOf(text, "</binary>");
+    runner.expectEq(binary, index.spanEnd(0), "spans: first span stops at the binary");
+    runner.expectEq(afterBinary, index.nextStart(binary), "spans: next span starts after it");
+    runner.expectEq(index.contentEnd(), index.spanEnd(afterBinary), "spans: last span stops at the content end");
+    runner.expectEq(afterBinary + 1, index.nextStart(afterBinary + 1), "spans: no jump without a binary");
+  }
+
+  // Test 6: Unfinished files have no index
+  {
+    const std::string text = "<FictionBook><body><section><p>Cut short";
+    const Fb2Index index = indexOf(text);
+    runner.expectFalse(index.valid(), "unfinished: not valid");
+    runner.expectEq(UINT32_MAX, index.contentEnd(), "unfinished: content is the whole file");
+    runner.expectEq(UINT32_MAX, index.spanEnd(0), "unfinished: one span");
+
+    const Fb2Index openBinary = indexOf("<FictionBook><body></body><binary>AAAA");
+    runner.expectFalse(openBinary.valid(), "unfinished: open binary is not valid");
+  }
+
+  // Test 7: Scanning a file
+  {
+    FsFile file;
+    file.setBuffer(kBook);
+    Fb2Index index;
+    runner.expectTrue(index.scan(file), "scan: valid");
+    runner.expectTrue(sameIndex(index, indexOf(kBook)), "scan: same index as feeding the text");
+
+    // A second scan starts over
+    file.setBuffer(kBook);
+    runner.expectTrue(index.scan(file) && sameIndex(index, indexOf(kBook)), "scan: rescan starts over");
+  }
+
+  // Test 8: Binary ids, for finding the binary an image refers to
+  {
+    const std::string text =
+        "<FictionBook><body><section><p>A</p></section></body>"
+        "<binary content-type=\"image/jpeg\" id=\"a.jpg\">AAAA</binary>"
+        "<fb:binary id = 'b>.png' xid=\"c\">BBBB</fb:binary>"
+        "<binary xid=\"c\" idx=\"c\" l:id=\"c\">CCCC</binary>"
+        "</FictionBook>";
+    const Fb2Index index = indexOf(text);
+    runner.expectEq(static_cast<size_t>(3), index.binaryIds.size(), "ids: one per binary");
+    runner.expectEq(0, index.findBinary(Fb2Index::idHash("a.jpg", 5)), "ids: first binary");
+    runner.expectEq(1, index.findBinary(Fb2Index::idHash("b>.png", 6)), "ids: quoted '>' and spaces around '='");
+    runner.expectEq(static_cast<uint32_t>(0), index.binaryIds[2], "ids: other attributes are not ids");
+    runner.expectEq(-1, index.findBinary(Fb2Index::idHash("c", 1)), "ids: unknown id");
+    runner.expectEq(-1, index.findBinary(0), "ids: binaries without an id are never found");
+
+    bool same = true;
+    for (const size_t chunk : {1, 2, 3, 5}) {
+      same &= sameIndex(index, indexOf(text, chunk));
+    }
+    runner.expectTrue(same, "ids: same ids for every chunk size");
+  }
+
+  // Test 9: Write and read back
+  {
+    const Fb2Index index = indexOf(kBook);
+    FsFile file;
+    file.setBuffer("");
+    runner.expectTrue(index.write(file), "serialize: write");
+    file.seek(0);
+    Fb2Index read;
+    runner.expectTrue(read.read(file), "serialize: read");
+    runner.expectTrue(sameIndex(index, read), "serialize: same index");
+    runner.expectTrue(read.valid(), "serialize: still valid");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
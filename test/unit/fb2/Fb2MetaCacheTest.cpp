@@ -18,8 +18,10 @@
 // Include serialization library
 #include "Serialization.h"
 
+#include "Fb2Index.h"
+
 namespace {
-constexpr uint8_t kMetaCacheVersion = 2;
+constexpr uint8_t kMetaCacheVersion = 4;
 }
 
 struct TocItem {
@@ -30,7 +32,7 @@ struct TocItem {
 // Write meta cache in the same format as Fb2::saveMetaCache()
 static void writeMetaCache(FsFile& file, const std::string& title, const std::string& author,
                            const std::string& coverPath, uint32_t fileSize, uint16_t sectionCount,
-                           const std::vector<TocItem>& tocItems) {
+                           const std::vector<TocItem>& tocItems, const Fb2Index& index = Fb2Index()) {
   serialization::writePod(file, kMetaCacheVersion);
   serialization::writeString(file, title);
   serialization::writeString(file, author);
@@ -46,6 +48,8 @@ static void writeMetaCache(FsFile& file, const std::string& title, const std::st
     const int16_t idx = static_cast<int16_t>(item.sectionIndex);
     serialization::writePod(file, idx);
   }
+
+  index.write(file);
 }
 
 // Read meta cache in the same format as Fb2::loadMetaCache()
@@ -56,6 +60,7 @@ struct MetaCacheData {
   uint32_t fileSize = 0;
   uint16_t sectionCount = 0;
   std::vector<TocItem> tocItems;
+  Fb2Index index;
 };
 
 static bool readMetaCache(FsFile& file, MetaCacheData& data) {
@@ -97,7 +102,7 @@ static bool readMetaCache(FsFile& file, MetaCacheData& data) {
     data.tocItems.push_back(std::move(item));
   }
 
-  return true;
+  return data.index.read(file);
 }
 
 int main() {
@@ -287,5 +292,51 @@ int main() {
     runner.expectEq(static_cast<uint32_t>(0xFFFFFFFE), data.fileSize, "large_filesize: max-1 value preserved");
   }
 
+  // Test 11: Structure index roundtrip
+  {
+    Fb2Index index;
+    index.bodies = {{120, 9000}, {9100, 9500}};
+    index.binaries = {{9500, 40000}};
+    index.binaryIds = {Fb2Index::idHash("cover.jpg", 9)};
+    index.sections = {{130, 0}, {2000, 1}, {5000, 0}};
+
+    FsFile file;
+    file.setBuffer("");
+    writeMetaCache(file, "Indexed", "Author", "", 40000, 3, {{"One", 0}}, index);
+
+    file.seek(0);
+    MetaCacheData data;
+    bool ok = readMetaCache(file, data);
+    runner.expectTrue(ok, "index: reads successfully");
+    runner.expectTrue(data.index.valid(), "index: valid after reading");
+    runner.expectEq(static_cast<uint32_t>(9000), data.index.contentEnd(), "index: content ends with the main body");
+    runner.expectEq(static_cast<size_t>(2), data.index.bodies.size(), "index: bodies");
+    runner.expectEq(static_cast<uint32_t>(40000), data.index.binaries[0].end, "index: binary end");
+    runner.expectEq(0, data.index.findBinary(Fb2Index::idHash("cover.jpg", 9)), "index: binary id");
+    runner.expectEq(static_cast<size_t>(3), data.index.sections.size(), "index: sections");
+    runner.expectEq(static_cast<uint32_t>(2000), data.index.sections[1].offset, "index: section offset");
+    runner.expectEq(static_cast<uint8_t>(1), data.index.sections[1].level, "index: section level");
+  }
+
+  // Test 12: Truncated in the index
+  {
+    Fb2Index index;
+    index.bodies = {{120, 9000}};
+    index.sections = {{130, 0}, {2000, 0}};
+
+    FsFile file;
+    file.setBuffer("");
+    writeMetaCache(file, "Indexed", "Author", "", 9000, 2, {}, index);
+
+    std::string bytes = file.getBuffer();
+    bytes.resize(bytes.size() - 3);
+    FsFile truncated;
+    truncated.setBuffer(bytes);
+    MetaCacheData data;
+    bool ok = readMetaCache(truncated, data);
+    runner.expectFalse(ok, "truncated_index: rejected");
+    runner.expectTrue(data.index.sections.empty(), "truncated_index: nothing kept");
+  }
+
   return runner.allPassed() ? 0 : 1;
 }
@@ -0,0 +1,262 @@
+// Fb2Parser checkpoint tests
+//
+// A book cached a batch at a time, each batch by a fresh parser resuming from the last checkpoint
+// (as PageCache::extend() does after the reader was closed), must come out page for page the same
+// as the book parsed in one go, whatever the batch size.
+
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <Page.h>
+#include <builtinFonts/reader_2b.h>
+#include <builtinFonts/reader_bold_2b.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Fb2Index.h"
+#include "Fb2Parser.h"
+#include "SDCardManager.h"
+#include "SdFat.h"
+
+// Link stubs: no bitmaps are drawn here
+Bitmap::~Bitmap() = default;
+BmpReaderError Bitmap::parseHeaders() { return BmpReaderError::Ok; }
+BmpReaderError Bitmap::readRow(uint8_t*, uint8_t*, int) const { return BmpReaderError::Ok; }
+const char* Bitmap::errorToString(BmpReaderError) { return ""; }
+
+namespace {
+
+constexpr int kFontId = 1;
+const char* const kBookPath = "/books/book.fb2";
+const char* const kCheckpointPath = "/cache/fb2.ckpt";
+const char* const kImagePath = "/cache/images";
+
+// Paragraphs of made-up words, different for every seed
+std::string paragraphs(const int count, uint32_t seed) {
+  static const char* const kWords[] = {"the",     "reader",  "turned",     "another", "page",   "of",
+                                       "a",       "book",    "about",      "rivers",  "and",    "distant",
+                                       "islands", "where",   "lighthouse", "keepers", "waited", "quietly"};
+  std::string out;
+  for (int p = 0; p < count; p++) {
+    out += "<p>";
+    const int words = 12 + static_cast<int>(seed % 40);
+    for (int w = 0; w < words; w++) {
+      seed = seed * 1664525u + 1013904223u;
+      if (w > 0) out += ' ';
+      if (seed % 11 == 0) out += "<emphasis>";
+      out += kWords[(seed >> 8) % (sizeof(kWords) / sizeof(kWords[0]))];
+      if (seed % 11 == 0) out += "</emphasis>";
+    }
+    out += "</p>\n";
+  }
+  return out;
+}
+
+std::string pngHeader(const uint32_t width, const uint32_t height) {
+  std::string data("\x89PNG\r\n\x1A\n\0\0\0\x0DIHDR", 16);
+  for (const uint32_t value : {width, height}) {
+    for (int shift = 24; shift >= 0; shift -= 8) data += static_cast<char>((value >> shift) & 0xFF);
+  }
+  data += std::string("\x08\x02\0\0\0", 5);
+  return data;
+}
+
+std::string base64(const std::string& data) {
+  static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (size_t i = 0; i < data.size(); i += 3) {
+    uint32_t bits = static_cast<uint8_t>(data[i]) << 16;
+    if (i + 1 < data.size()) bits |= static_cast<uint8_t>(data[i + 1]) << 8;
+    if (i + 2 < data.size()) bits |= static_cast<uint8_t>(data[i + 2]);
+    out += kAlphabet[(bits >> 18) & 0x3F];
+    out += kAlphabet[(bits >> 12) & 0x3F];
+    out += i + 1 < data.size() ? kAlphabet[(bits >> 6) & 0x3F] : '=';
+    out += i + 2 < data.size() ? kAlphabet[bits & 0x3F] : '=';
+  }
+  return out;
+}
+
+// Nested and self-closing sections at the top level and below, a <binary> in the main body that
+// the index skips, an inline image, and a notes body and binaries after it
+std::string makeBook() {
+  return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+         "<FictionBook xmlns=\"http://www.gribuser.ru/xml/fictionbook/2.0\" "
+         "xmlns:l=\"http://www.w3.org/1999/xlink\">\n"
+         "<description><title-info><book-title>Resume</book-title>"
+         "<coverpage><image l:href=\"#cover\"/></coverpage></title-info></description>\n"
+         "<body>\n"
+         "<section><title><p>One</p></title>\n" +
+         paragraphs(6, 1) + "<image l:href=\"#map\"/>\n" + paragraphs(3, 2) +
+         "</section>\n"
+         "<section><title><p>Two</p></title>\n" +
+         paragraphs(3, 3) + "<section><title><p>Two, nested</p></title>\n" + paragraphs(4, 4) +
+         "<section/>\n" + paragraphs(2, 5) + "</section>\n" + paragraphs(3, 6) +
+         "</section>\n"
+         "<section/>\n"
+         "<binary id=\"stray\" content-type=\"image/png\">" +
+         base64(pngHeader(64, 64)) +
+         "</binary>\n"
+         "<section><title><p>Three</p></title>\n" +
+         paragraphs(2, 7) + "<section><section><title><p>Deep</p></title>\n" + paragraphs(5, 8) +
+         "</section></section>\n" + paragraphs(4, 9) +
+         "</section>\n"
+         "<section><p>Short</p></section>\n"
+         "<section><title><p>Four</p></title>\n" +
+         paragraphs(8, 10) +
+         "</section>\n"
+         "</body>\n"
+         "<body name=\"notes\"><section><p>A note that is never laid out</p></section></body>\n"
+         "<binary id=\"map\" content-type=\"image/png\">" +
+         base64(pngHeader(120, 90)) +
+         "</binary>\n"
+         "<binary id=\"cover\" content-type=\"image/png\">" +
+         base64(pngHeader(600, 800)) +
+         "</binary>\n"
+         "</FictionBook>\n";
+}
+
+std::string serialize(const Page& page) {
+  auto buffer = std::make_shared<std::string>();
+  FsFile file;
+  file.setSharedBuffer(buffer);
+  page.serialize(file);
+  file.close();
+  return *buffer;
+}
+
+// The mock keeps written files apart from readable ones: make the checkpoint one batch wrote
+// readable by the next, as it would be on the card
+void persistCheckpoint() {
+  const std::string data = SdMan.getWrittenData(kCheckpointPath);
+  if (!data.empty()) SdMan.registerFile(kCheckpointPath, data);
+}
+
+struct Result {
+  std::vector<std::string> pages;
+  std::vector<std::pair<std::string, uint16_t>> anchors;
+  int resumes = 0;           // Batches that started from a checkpoint
+  bool reparsedSame = true;  // Pages parsed again after a resume matched the cached ones
+  bool complete = false;
+};
+
+Result parseWhole(GfxRenderer& gfx, const RenderConfig& config, const Fb2Index& index) {
+  Result result;
+  Fb2Parser parser(kBookPath, gfx, config, index, kImagePath);
+  parser.setCheckpointPath(kCheckpointPath);
+  result.complete = parser.parsePages([&](std::unique_ptr<Page> page) { result.pages.push_back(serialize(*page)); });
+  result.complete &= !parser.hasMoreContent();
+  result.anchors = parser.getAnchorMap();
+  return result;
+}
+
+// Caches batch pages at a time, with a new parser for every batch, as PageCache::create() does
+Result parseInBatches(GfxRenderer& gfx, const RenderConfig& config, const Fb2Index& index, const uint16_t batch) {
+  Result result;
+  SdMan.remove(kCheckpointPath);
+  for (int guard = 0; guard < 500; guard++) {
+    Fb2Parser parser(kBookPath, gfx, config, index, kImagePath);
+    parser.setCheckpointPath(kCheckpointPath);
+    const auto cached = static_cast<uint16_t>(result.pages.size());
+    const uint16_t resumed = parser.resumeFromCheckpoint(cached);
+    if (resumed > 0) result.resumes++;
+
+    uint16_t parsed = resumed;
+    const uint16_t target = cached + batch;
+    const bool ok = parser.parsePages(
+        [&](std::unique_ptr<Page> page) {
+          if (parsed >= target) return;
+          parsed++;
+          if (parsed <= cached) {
+            result.reparsedSame &= serialize(*page) == result.pages[parsed - 1];
+            return;
+          }
+          result.pages.push_back(serialize(*page));
+        },
+        target - resumed);
+    persistCheckpoint();
+    if (!ok) return result;
+    if (!parser.hasMoreContent()) {
+      result.complete = true;
+      result.anchors = parser.getAnchorMap();
+      return result;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("Fb2ParserResume");
+
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  EpdFont regular(&reader_2b);
+  EpdFont bold(&reader_bold_2b);
+  gfx.insertFont(kFontId, EpdFontFamily(&regular, &bold, &regular, &bold));
+
+  const std::string book = makeBook();
+  SdMan.clearFiles();
+  SdMan.registerFile(kBookPath, book);
+
+  Fb2Index index;
+  index.feed(reinterpret_cast<const uint8_t*>(book.data()), book.size());
+  runner.expectTrue(index.valid(), "fixture: indexed");
+  runner.expectEq(static_cast<size_t>(10), index.sections.size(), "fixture: every main body section indexed");
+  runner.expectEq(static_cast<size_t>(3), index.binaries.size(), "fixture: binaries indexed");
+
+  // A small page, so that every section spans pages
+  const RenderConfig config(kFontId, 1.0f, 1, 1, 0, true, true, 240, 200);
+
+  // Test 1: The book in one go
+  const Result whole = parseWhole(gfx, config, index);
+  runner.expectTrue(whole.complete, "whole: parsed to the end");
+  runner.expectTrue(whole.pages.size() > 20, "whole: many pages", std::to_string(whole.pages.size()) + " pages");
+  runner.expectEq(static_cast<size_t>(10), whole.anchors.size(), "whole: an anchor for every section");
+
+  // Test 2: The same book a batch at a time, resuming from checkpoints
+  for (const uint16_t batch : {1, 2, 3, 5, 8, 13}) {
+    const std::string name = "batch " + std::to_string(batch) + ": ";
+    const Result batched = parseInBatches(gfx, config, index, batch);
+    runner.expectTrue(batched.complete, name + "parsed to the end");
+    runner.expectTrue(batched.resumes > 0, name + "resumed from checkpoints",
+                      std::to_string(batched.resumes) + " resumes");
+    runner.expectEq(whole.pages.size(), batched.pages.size(), name + "page count");
+    bool samePages = whole.pages.size() == batched.pages.size();
+    for (size_t i = 0; samePages && i < whole.pages.size(); i++) samePages = whole.pages[i] == batched.pages[i];
+    runner.expectTrue(samePages, name + "pages identical to the whole parse");
+    runner.expectTrue(batched.reparsedSame, name + "pages parsed again match the cached ones");
+    runner.expectTrue(batched.anchors == whole.anchors, name + "anchors identical to the whole parse");
+    runner.expectFalse(SdMan.exists(kCheckpointPath), name + "checkpoint dropped at the end");
+  }
+
+  // Test 3: A checkpoint past the cached pages is ignored, so nothing is skipped
+  {
+    SdMan.remove(kCheckpointPath);
+    Fb2Parser first(kBookPath, gfx, config, index, kImagePath);
+    first.setCheckpointPath(kCheckpointPath);
+    first.parsePages([](std::unique_ptr<Page>) {}, static_cast<uint16_t>(whole.pages.size() / 2));
+    persistCheckpoint();
+
+    Fb2Parser second(kBookPath, gfx, config, index, kImagePath);
+    second.setCheckpointPath(kCheckpointPath);
+    runner.expectEq(static_cast<uint16_t>(0), second.resumeFromCheckpoint(1), "stale: checkpoint past the cache");
+    const uint16_t resumed = second.resumeFromCheckpoint(static_cast<uint16_t>(whole.pages.size()));
+    runner.expectTrue(resumed > 0, "stale: used once the cache reaches it");
+
+    // Written where a top-level section starts, not where the batch happened to stop
+    bool atSection = false;
+    for (const auto& anchor : whole.anchors) atSection |= anchor.second == resumed;
+    runner.expectTrue(atSection, "stale: checkpoint at a section start", std::to_string(resumed) + " pages");
+    runner.expectTrue(resumed <= whole.pages.size() / 2, "stale: checkpoint within the pages delivered");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
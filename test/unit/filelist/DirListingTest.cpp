@@ -0,0 +1,219 @@
+// DirListing unit tests
+//
+// Tests sorting a directory's entries into a cached listing, in one run or merged from runs in a
+// scratch file, a few entries at a time, and reading the listing back a page at a time.
+
+#include "test_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DirListing.h"
+#include "SDCardManager.h"
+
+namespace {
+
+using Entries = std::vector<std::pair<std::string, bool>>;
+
+const char* kOutPath = "/.papyrix/cache/dirs/listing.tmp";
+const char* kScratchPath = "/.papyrix/cache/dirs/runs.tmp";
+const char* kListingPath = "/.papyrix/cache/dirs/listing.bin";
+
+// Builds a listing, writing stepSize entries at a time, and returns the file written
+std::string build(const Entries& entries, const size_t runBytes, const size_t stepSize,
+                  const DirListing::Key& key = {0x5A211234, 4096}, bool* usedScratch = nullptr) {
+  SdMan.clearWrittenFiles();
+  DirListingBuilder builder(runBytes);
+  builder.begin(kOutPath, kScratchPath);
+  for (const auto& entry : entries) {
+    builder.add(entry.first.c_str(), entry.second);
+  }
+  builder.finish(key);
+  while (!builder.done()) {
+    if (!builder.write(stepSize)) break;
+  }
+  const std::string data = SdMan.getWrittenData(kOutPath);
+  builder.cancel();
+  if (usedScratch) {
+    const auto& removed = SdMan.removedFiles();
+    *usedScratch = std::find(removed.begin(), removed.end(), kScratchPath) != removed.end();
+  }
+  return data;
+}
+
+bool openListing(DirListing& listing, const std::string& data) {
+  SdMan.clearFiles();
+  SdMan.registerFile(kListingPath, data);
+  return listing.open(kListingPath);
+}
+
+// Reads every entry back a page at a time
+Entries readAll(DirListing& listing, const uint32_t pageSize) {
+  Entries entries;
+  for (uint32_t first = 0; first < listing.size(); first += pageSize) {
+    if (!listing.load(first, pageSize)) break;
+    for (uint32_t i = first; i < std::min(first + pageSize, listing.size()); i++) {
+      entries.emplace_back(listing.name(i), listing.isDir(i));
+    }
+  }
+  return entries;
+}
+
+Entries sorted(Entries entries) {
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    return DirListing::less(a.first.c_str(), a.second, b.first.c_str(), b.second);
+  });
+  return entries;
+}
+
+// A large library in directory order: books, a few folders, numbered volumes
+Entries library(const int count) {
+  Entries entries;
+  for (int i = 0; i < count; i++) {
+    const int n = (i * 7919) % count;
+    if (n % 50 == 0) {
+      entries.emplace_back("Author " + std::to_string(n), true);
+    } else {
+      entries.emplace_back("Series " + std::to_string(n % 13) + " - Volume " + std::to_string(n) + ".epub", false);
+    }
+  }
+  return entries;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("DirListing");
+
+  // Test 1: Directories first, then natural order
+  {
+    runner.expectTrue(DirListing::less("zebra", true, "apple.epub", false), "order: directory before file");
+    runner.expectFalse(DirListing::less("apple.epub", false, "zebra", true), "order: file after directory");
+    runner.expectTrue(DirListing::less("Book 2.epub", false, "book 10.epub", false), "order: natural within files");
+    runner.expectTrue(DirListing::less("Vol 9", true, "Vol 10", true), "order: natural within directories");
+  }
+
+  // Test 2: A small directory, sorted in memory
+  {
+    const Entries entries = {{"b.epub", false}, {"Docs", true}, {"a10.txt", false}, {"a2.txt", false},
+                             {"Archive", true}};
+    bool usedScratch = true;
+    const std::string data = build(entries, DirListingBuilder::DEFAULT_RUN_BYTES, 100, {7, 9}, &usedScratch);
+    runner.expectFalse(usedScratch, "small: no scratch file");
+
+    DirListing listing;
+    runner.expectTrue(openListing(listing, data), "small: opens");
+    runner.expectEq(static_cast<uint32_t>(5), listing.size(), "small: size");
+    runner.expectTrue(listing.key() == DirListing::Key{7, 9}, "small: key kept");
+    runner.expectTrue(readAll(listing, 2) == sorted(entries), "small: sorted, read in pages of 2");
+    runner.expectTrue(listing.load(0, 5), "small: load all");
+    runner.expectEq(std::string("Archive"), std::string(listing.name(0)), "small: first entry");
+    runner.expectTrue(listing.isDir(1), "small: second is a directory");
+    runner.expectEq(std::string("a2.txt"), std::string(listing.name(2)), "small: natural order");
+    runner.expectFalse(listing.isDir(4), "small: last is a file");
+  }
+
+  // Test 3: A large directory merged from runs gives the same file, whatever the step size
+  {
+    const Entries entries = library(1500);
+    const std::string inMemory = build(entries, 1 << 20, 100000);
+    bool usedScratch = false;
+    const std::string merged = build(entries, 512, 7, {0x5A211234, 4096}, &usedScratch);
+    runner.expectTrue(usedScratch, "large: runs written to scratch and removed");
+    runner.expectTrue(!merged.empty() && merged == inMemory, "large: merged file matches one sorted in memory");
+    runner.expectTrue(build(entries, 512, 1) == inMemory, "large: one entry at a time");
+
+    DirListing listing;
+    runner.expectTrue(openListing(listing, merged), "large: opens");
+    runner.expectEq(static_cast<uint32_t>(1500), listing.size(), "large: no entries lost");
+    runner.expectTrue(readAll(listing, 13) == sorted(entries), "large: sorted, read in pages of 13");
+  }
+
+  // Test 4: Only the loaded window can be read
+  {
+    DirListing listing;
+    openListing(listing, build(library(100), 256, 10));
+    runner.expectTrue(listing.load(90, 20), "window: last page, cut short");
+    runner.expectTrue(listing.isLoaded(99), "window: last entry loaded");
+    runner.expectFalse(listing.isLoaded(89), "window: entry before not loaded");
+    runner.expectEq(std::string(""), std::string(listing.name(10)), "window: unloaded entry has no name");
+    runner.expectTrue(listing.load(100, 20), "window: past the end is empty");
+    runner.expectFalse(listing.isLoaded(100), "window: nothing loaded past the end");
+  }
+
+  // Test 5: Finding an entry by name
+  {
+    DirListing listing;
+    const Entries entries = library(400);
+    openListing(listing, build(entries, 300, 50));
+    const Entries order = sorted(entries);
+    runner.expectEq(0, listing.find(order[0].first.c_str()), "find: first");
+    runner.expectEq(399, listing.find(order[399].first.c_str()), "find: last");
+    std::string upper = order[123].first;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    runner.expectEq(123, listing.find(upper.c_str()), "find: case-insensitive");
+    runner.expectEq(-1, listing.find("missing.epub"), "find: missing");
+    runner.expectEq(-1, listing.find(""), "find: empty name");
+  }
+
+  // Test 6: Empty directory
+  {
+    DirListing listing;
+    runner.expectTrue(openListing(listing, build({}, 256, 10)), "empty: opens");
+    runner.expectTrue(listing.empty(), "empty: no entries");
+    runner.expectTrue(listing.load(0, 10), "empty: load");
+    runner.expectEq(-1, listing.find("a"), "empty: find");
+  }
+
+  // Test 7: Listings that are incomplete, cut short or from another version are not opened
+  {
+    SdMan.clearWrittenFiles();
+    DirListingBuilder builder(256);
+    builder.begin(kOutPath, kScratchPath);
+    for (const auto& entry : library(50)) builder.add(entry.first.c_str(), entry.second);
+    builder.finish({});
+    builder.write(10);
+    builder.cancel();
+    DirListing listing;
+    runner.expectFalse(openListing(listing, SdMan.getWrittenData(kOutPath)), "invalid: incomplete");
+
+    std::string data = build(library(50), 256, 10);
+    runner.expectFalse(openListing(listing, data.substr(0, data.size() - 1)), "invalid: cut short");
+    data[0] = static_cast<char>(DirListing::VERSION + 1);
+    runner.expectFalse(openListing(listing, data), "invalid: other version");
+    SdMan.clearFiles();
+    runner.expectFalse(listing.open(kListingPath), "invalid: missing");
+  }
+
+  // Test 8: The hash tells listings apart by their entries, not by their key
+  {
+    DirListing a, b;
+    openListing(a, build(library(200), 256, 10, {1, 1}));
+    const uint32_t hashA = a.hash();
+    openListing(b, build(library(200), 4096, 10, {2, 2}));
+    runner.expectEq(hashA, b.hash(), "hash: same entries, same hash");
+    Entries renamed = library(200);
+    renamed[17].first += "x";
+    openListing(b, build(renamed, 256, 10));
+    runner.expectNe(hashA, b.hash(), "hash: renamed entry");
+    Entries retyped = library(200);
+    retyped[17].second = !retyped[17].second;
+    openListing(b, build(retyped, 256, 10));
+    runner.expectNe(hashA, b.hash(), "hash: file became a directory");
+  }
+
+  // Test 9: Over-long names are cut, empty ones skipped
+  {
+    const std::string longName(300, 'n');
+    DirListing listing;
+    openListing(listing, build({{longName, false}, {"", false}}, 256, 10));
+    runner.expectEq(static_cast<uint32_t>(1), listing.size(), "names: empty skipped");
+    listing.load(0, 1);
+    runner.expectEq(DirListing::MAX_NAME_LENGTH, std::string(listing.name(0)).size(), "names: cut to max length");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
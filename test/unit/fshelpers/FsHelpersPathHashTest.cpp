@@ -0,0 +1,75 @@
+// Tests for FsHelpers::pathHash(): cache names must match the 32-bit std::hash the device uses.
+
+#include "test_utils.h"
+
+#include <FsHelpers.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// MurmurHash2 as published (Austin Appleby), which libstdc++ uses for 32-bit std::hash with
+// seed 0xc70f6907. Written against the reference rather than pathHash() to catch slips in either.
+static uint32_t murmurHash2(const void* key, int len, uint32_t seed) {
+  const uint32_t m = 0x5bd1e995;
+  const int r = 24;
+  uint32_t h = seed ^ len;
+  const unsigned char* data = static_cast<const unsigned char*>(key);
+  while (len >= 4) {
+    uint32_t k = data[0];
+    k |= data[1] << 8;
+    k |= data[2] << 16;
+    k |= static_cast<uint32_t>(data[3]) << 24;
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+    h *= m;
+    h ^= k;
+    data += 4;
+    len -= 4;
+  }
+  switch (len) {
+    case 3:
+      h ^= data[2] << 16;
+      [[fallthrough]];
+    case 2:
+      h ^= data[1] << 8;
+      [[fallthrough]];
+    case 1:
+      h ^= data[0];
+      h *= m;
+  }
+  h ^= h >> 13;
+  h *= m;
+  h ^= h >> 15;
+  return h;
+}
+
+int main() {
+  TestUtils::TestRunner runner("FsHelpersPathHash");
+
+  const std::string paths[] = {"",
+                               "/",
+                               "/a",
+                               "/ab",
+                               "/abc",
+                               "/books/novel.epub",
+                               "/Books/Война и мир.fb2",
+                               "/library/series/very long directory name/book title - volume 12.txt"};
+  for (const auto& path : paths) {
+    runner.expectEq(murmurHash2(path.data(), static_cast<int>(path.size()), 0xc70f6907u), FsHelpers::pathHash(path),
+                    "pathHash matches MurmurHash2: \"" + path + "\"");
+  }
+
+  runner.expectEq(FsHelpers::pathHash("/books/novel.epub"), FsHelpers::pathHash("/books/novel.epub"),
+                  "pathHash: deterministic");
+  runner.expectTrue(FsHelpers::pathHash("/books/novel1.epub") != FsHelpers::pathHash("/books/novel2.epub"),
+                    "pathHash: different paths differ");
+
+#if SIZE_MAX == UINT32_MAX
+  runner.expectEq(static_cast<uint32_t>(std::hash<std::string>{}("/books/novel.epub")),
+                  FsHelpers::pathHash("/books/novel.epub"), "pathHash: same as std::hash on 32-bit");
+#endif
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "DirtyTracker.h"
+
+using Window = EInkDisplay::Window;
+
+static void setPixel(std::vector<uint8_t>& fb, int x, int y) {
+  fb[y * EInkDisplay::DISPLAY_WIDTH_BYTES + x / 8] &= static_cast<uint8_t>(~(0x80 >> (x % 8)));
+}
+
+// Every changed pixel must fall inside one of the regions
+static bool covers(const std::vector<uint8_t>& before, const std::vector<uint8_t>& after, const Window* regions,
+                   int count) {
+  for (int y = 0; y < EInkDisplay::DISPLAY_HEIGHT; y++) {
+    for (int xb = 0; xb < EInkDisplay::DISPLAY_WIDTH_BYTES; xb++) {
+      const size_t i = y * EInkDisplay::DISPLAY_WIDTH_BYTES + xb;
+      if (before[i] == after[i]) continue;
+      bool inside = false;
+      for (int r = 0; r < count; r++) {
+        const Window& w = regions[r];
+        if (xb * 8 >= w.x && xb * 8 < w.x + w.w && y >= w.y && y < w.y + w.h) inside = true;
+      }
+      if (!inside) return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  TestUtils::TestRunner runner("DirtyTracker");
+  std::vector<uint8_t> fb(EInkDisplay::BUFFER_SIZE, 0xFF);
+  DirtyTracker tracker;
+  Window regions[DirtyTracker::MAX_REGIONS];
+
+  // Test 1: Nothing is valid before the first full update
+  runner.expectFalse(tracker.valid(), "initial: invalid until first commit");
+  tracker.snapshot(fb.data());
+  tracker.commit();
+  runner.expectTrue(tracker.valid(), "initial: valid after commit");
+
+  // Test 2: Unchanged buffer (even after clear + identical redraw) has no dirty regions
+  {
+    tracker.snapshot(fb.data());
+    runner.expectEq(0, tracker.dirtyRegions(regions), "unchanged: no regions");
+  }
+
+  // Test 3: A single pixel dirties exactly one byte-aligned tile
+  {
+    const auto before = fb;
+    setPixel(fb, 85, 20);
+    tracker.snapshot(fb.data());
+    const int n = tracker.dirtyRegions(regions);
+    runner.expectEq(1, n, "pixel: one region");
+    runner.expectEq(static_cast<uint16_t>(80), regions[0].x, "pixel: x aligned to tile");
+    runner.expectEq(static_cast<uint16_t>(16), regions[0].y, "pixel: y aligned to tile");
+    runner.expectEq(static_cast<uint16_t>(80), regions[0].w, "pixel: tile width");
+    runner.expectEq(static_cast<uint16_t>(16), regions[0].h, "pixel: tile height");
+    runner.expectTrue(covers(before, fb, regions, n), "pixel: change covered");
+    runner.expectEq(static_cast<uint32_t>(10 * 16), DirtyTracker::regionBytes(regions, n), "pixel: region bytes");
+    tracker.commit();
+  }
+
+  // Test 4: A portrait menu cursor move (a physical column band) is one narrow full-height region
+  {
+    const auto before = fb;
+    for (int y = 0; y < EInkDisplay::DISPLAY_HEIGHT; y++) {
+      for (int x = 300; x < 340; x++) setPixel(fb, x, y);
+    }
+    tracker.snapshot(fb.data());
+    const int n = tracker.dirtyRegions(regions);
+    runner.expectEq(1, n, "cursor: one region");
+    runner.expectTrue(covers(before, fb, regions, n), "cursor: change covered");
+    runner.expectTrue(DirtyTracker::regionBytes(regions, n) <= EInkDisplay::BUFFER_SIZE / 5,
+                      "cursor: region is a small part of the panel");
+    tracker.commit();
+  }
+
+  // Test 5: Separate changes give separate bands, capped at MAX_REGIONS and still covering everything
+  {
+    const auto before = fb;
+    const int ys[] = {5, 60, 130, 200, 290, 400, 470};
+    for (const int y : ys) setPixel(fb, 700, y);
+    setPixel(fb, 10, 400);
+    tracker.snapshot(fb.data());
+    const int n = tracker.dirtyRegions(regions);
+    runner.expectEq(DirtyTracker::MAX_REGIONS, n, "bands: capped at max regions");
+    runner.expectTrue(covers(before, fb, regions, n), "bands: all changes covered");
+    bool aligned = true;
+    for (int i = 0; i < n; i++) {
+      if (regions[i].x % 8 || regions[i].w % 8 || regions[i].x + regions[i].w > EInkDisplay::DISPLAY_WIDTH ||
+          regions[i].y + regions[i].h > EInkDisplay::DISPLAY_HEIGHT) {
+        aligned = false;
+      }
+    }
+    runner.expectTrue(aligned, "bands: regions byte-aligned and on panel");
+  }
+
+  // Test 6: Without commit the snapshot is compared against the last committed frame
+  {
+    tracker.snapshot(fb.data());
+    runner.expectTrue(tracker.dirtyRegions(regions) > 0, "pending: uncommitted changes still dirty");
+    tracker.commit();
+    tracker.snapshot(fb.data());
+    runner.expectEq(0, tracker.dirtyRegions(regions), "pending: clean after commit");
+  }
+
+  // Test 7: Full-screen change covers the whole panel; invalidate() forces a full update
+  {
+    for (auto& b : fb) b = static_cast<uint8_t>(~b);
+    tracker.snapshot(fb.data());
+    const int n = tracker.dirtyRegions(regions);
+    runner.expectEq(EInkDisplay::BUFFER_SIZE, DirtyTracker::regionBytes(regions, n), "full: whole panel dirty");
+    tracker.invalidate();
+    runner.expectFalse(tracker.valid(), "invalidate: not valid");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "BitmapHelpers.h"
+
+// BitmapHelpers.cpp pulls in SD card I/O, so the pixel helpers the ditherers need are
+// inlined here (mirrors lib/GfxRenderer/src/BitmapHelpers.cpp)
+int adjustPixel(int gray) {
+  int adjusted = ((gray - 128) * 135) / 100 + 128;
+  if (adjusted < 0) adjusted = 0;
+  if (adjusted > 255) adjusted = 255;
+  return adjusted;
+}
+
+const uint8_t* adjustPixelLut() {
+  static uint8_t lut[256];
+  for (int i = 0; i < 256; i++) lut[i] = static_cast<uint8_t>(adjustPixel(i));
+  return lut;
+}
+
+// Per-pixel Atkinson with int16_t error rows, as the ditherers worked before the row kernels.
+// levels/values describe the quantizer: 1-bit {128} -> {0, 255}, 2-bit {30, 50, 140} -> {15, 30, 80, 210}
+class ReferenceAtkinson {
+ public:
+  ReferenceAtkinson(int width, bool oneBit) : width(width), oneBit(oneBit), rows(3, std::vector<int16_t>(width + 4)) {}
+
+  uint8_t processPixel(int gray, int x) {
+    int adjusted = gray + rows[0][x + 2];
+    if (adjusted < 0) adjusted = 0;
+    if (adjusted > 255) adjusted = 255;
+
+    uint8_t quantized;
+    int quantizedValue;
+    if (oneBit) {
+      quantized = adjusted < 128 ? 0 : 1;
+      quantizedValue = quantized ? 255 : 0;
+    } else {
+      static const int values[4] = {15, 30, 80, 210};
+      quantized = adjusted < 30 ? 0 : adjusted < 50 ? 1 : adjusted < 140 ? 2 : 3;
+      quantizedValue = values[quantized];
+    }
+
+    const int error = (adjusted - quantizedValue) >> 3;
+    rows[0][x + 3] += error;
+    rows[0][x + 4] += error;
+    rows[1][x + 1] += error;
+    rows[1][x + 2] += error;
+    rows[1][x + 3] += error;
+    rows[2][x + 2] += error;
+    return quantized;
+  }
+
+  void nextRow() {
+    rows[0].swap(rows[1]);
+    rows[1].swap(rows[2]);
+    std::fill(rows[2].begin(), rows[2].end(), 0);
+  }
+
+ private:
+  int width;
+  bool oneBit;
+  std::vector<std::vector<int16_t>> rows;
+};
+
+static std::vector<uint8_t> makeImage(int w, int h, uint32_t seed) {
+  std::vector<uint8_t> px(static_cast<size_t>(w) * h);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      seed = seed * 1103515245u + 12345u;
+      // Smooth gradient plus noise exercises every quantization level and large error runs
+      px[static_cast<size_t>(y) * w + x] = static_cast<uint8_t>(((x + y) * 255 / (w + h) + (seed >> 27)) & 0xFF);
+    }
+  }
+  return px;
+}
+
+// Pack reference output the same way the kernels do (MSB first)
+static std::vector<uint8_t> referenceRows(const std::vector<uint8_t>& img, int w, int h, bool oneBit,
+                                          const uint8_t* lut) {
+  const int bpp = oneBit ? 1 : 2;
+  const int rowBytes = (w * bpp + 7) / 8;
+  std::vector<uint8_t> out(static_cast<size_t>(rowBytes) * h, 0);
+  ReferenceAtkinson ref(w, oneBit);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      const int gray = img[static_cast<size_t>(y) * w + x];
+      const uint8_t q = ref.processPixel(lut ? lut[gray] : gray, x);
+      const int bit = x * bpp;
+      out[static_cast<size_t>(y) * rowBytes + bit / 8] |= q << (8 - bpp - bit % 8);
+    }
+    ref.nextRow();
+  }
+  return out;
+}
+
+template <typename Ditherer>
+static std::vector<uint8_t> kernelRows(const std::vector<uint8_t>& img, int w, int h, int bpp, const uint8_t* lut) {
+  const int rowBytes = (w * bpp + 7) / 8;
+  std::vector<uint8_t> out(static_cast<size_t>(rowBytes) * h, 0);
+  Ditherer ditherer(w);
+  for (int y = 0; y < h; y++) {
+    ditherer.processRow(&img[static_cast<size_t>(y) * w], &out[static_cast<size_t>(y) * rowBytes], lut);
+  }
+  return out;
+}
+
+template <typename Fn>
+static double pixelsPerMs(int pixels, int iterations, Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) fn();
+  const auto end = std::chrono::steady_clock::now();
+  const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  return ms > 0 ? static_cast<double>(pixels) * iterations / ms : 0;
+}
+
+int main() {
+  TestUtils::TestRunner runner("DitherKernel");
+  const uint8_t* lut = adjustPixelLut();
+
+  // Test 1: 1-bit row kernel matches per-pixel Atkinson (odd widths cover the partial last byte)
+  {
+    const int widths[] = {1, 7, 8, 9, 264, 333};
+    for (const int w : widths) {
+      const auto img = makeImage(w, 37, 1u + w);
+      const bool same = kernelRows<Atkinson1BitDitherer>(img, w, 37, 1, lut) == referenceRows(img, w, 37, true, lut);
+      char name[64];
+      snprintf(name, sizeof(name), "1bit: kernel matches reference (width %d)", w);
+      runner.expectTrue(same, name);
+    }
+  }
+
+  // Test 2: 1-bit raw mode (no adjustment) used for thumbnails of already-dithered covers
+  {
+    const auto img = makeImage(127, 50, 99);
+    runner.expectTrue(kernelRows<Atkinson1BitDitherer>(img, 127, 50, 1, nullptr) ==
+                          referenceRows(img, 127, 50, true, nullptr),
+                      "1bit raw: kernel matches reference");
+  }
+
+  // Test 3: 2-bit row kernel matches per-pixel Atkinson
+  {
+    const int widths[] = {1, 3, 4, 5, 450, 481};
+    for (const int w : widths) {
+      const auto img = makeImage(w, 41, 7u * w);
+      const bool same = kernelRows<AtkinsonDitherer>(img, w, 41, 2, lut) == referenceRows(img, w, 41, false, lut);
+      char name[64];
+      snprintf(name, sizeof(name), "2bit: kernel matches reference (width %d)", w);
+      runner.expectTrue(same, name);
+    }
+  }
+
+  // Test 4: processPixel with int8_t error rows still matches the int16_t reference
+  {
+    const int w = 200, h = 60;
+    const auto img = makeImage(w, h, 4242);
+    AtkinsonDitherer narrow(w);
+    ReferenceAtkinson ref(w, false);
+    bool same = true;
+    for (int y = 0; y < h; y++) {
+      for (int x = 0; x < w; x++) {
+        const int gray = lut[img[static_cast<size_t>(y) * w + x]];
+        if (narrow.processPixel(gray, x) != ref.processPixel(gray, x)) same = false;
+      }
+      narrow.nextRow();
+      ref.nextRow();
+    }
+    runner.expectTrue(same, "2bit: int8_t error rows match int16_t reference");
+  }
+
+  // Test 5: Extreme input (alternating black/white) keeps errors within int8_t
+  {
+    const int w = 64, h = 64;
+    std::vector<uint8_t> img(w * h);
+    for (int i = 0; i < w * h; i++) img[i] = ((i / w + i) & 1) ? 255 : 0;
+    runner.expectTrue(kernelRows<Atkinson1BitDitherer>(img, w, h, 1, nullptr) ==
+                          referenceRows(img, w, h, true, nullptr),
+                      "1bit: checkerboard matches reference");
+    runner.expectTrue(kernelRows<AtkinsonDitherer>(img, w, h, 2, nullptr) == referenceRows(img, w, h, false, nullptr),
+                      "2bit: checkerboard matches reference");
+  }
+
+  // Benchmark: full-screen cover (480x800) through per-pixel and row kernels
+  {
+    const int w = 480, h = 800, iterations = 5;
+    const auto img = makeImage(w, h, 2024);
+    std::vector<uint8_t> out(static_cast<size_t>(w) * h / 4 + h);
+
+    const double perPixel1 = pixelsPerMs(w * h, iterations, [&] {
+      Atkinson1BitDitherer d(w);
+      for (int y = 0; y < h; y++) {
+        uint8_t* row = &out[static_cast<size_t>(y) * ((w + 7) / 8)];
+        for (int x = 0; x < w; x++) row[x / 8] |= d.processPixel(img[static_cast<size_t>(y) * w + x], x) << (7 - x % 8);
+        d.nextRow();
+      }
+    });
+    const double kernel1 = pixelsPerMs(w * h, iterations, [&] {
+      Atkinson1BitDitherer d(w);
+      for (int y = 0; y < h; y++) d.processRow(&img[static_cast<size_t>(y) * w], &out[y * ((w + 7) / 8)], lut);
+    });
+    const double perPixel2 = pixelsPerMs(w * h, iterations, [&] {
+      AtkinsonDitherer d(w);
+      for (int y = 0; y < h; y++) {
+        uint8_t* row = &out[static_cast<size_t>(y) * (w / 4)];
+        for (int x = 0; x < w; x++) {
+          row[x / 4] |= d.processPixel(adjustPixel(img[static_cast<size_t>(y) * w + x]), x) << (6 - (x % 4) * 2);
+        }
+        d.nextRow();
+      }
+    });
+    const double kernel2 = pixelsPerMs(w * h, iterations, [&] {
+      AtkinsonDitherer d(w);
+      for (int y = 0; y < h; y++) d.processRow(&img[static_cast<size_t>(y) * w], &out[y * (w / 4)], lut);
+    });
+
+    printf("  1-bit Atkinson: per-pixel %.0f px/ms, row kernel %.0f px/ms\n", perPixel1, kernel1);
+    printf("  2-bit Atkinson: per-pixel %.0f px/ms, row kernel %.0f px/ms\n", perPixel2, kernel2);
+    runner.expectTrue(kernel1 > 0 && kernel2 > 0, "benchmark: kernels ran");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
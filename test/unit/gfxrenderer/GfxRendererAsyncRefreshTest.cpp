@@ -0,0 +1,149 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Minimal GfxRenderer mirroring the refresh handling of lib/GfxRenderer/src/GfxRenderer.cpp:
+// displayBuffer() = displayBufferAsync() + wait, clearScreen() waits before touching the buffer
+class GfxRenderer {
+ public:
+  explicit GfxRenderer(EInkDisplay& display) : einkDisplay(display) {}
+
+  void displayBuffer(EInkDisplay::RefreshMode mode = EInkDisplay::FAST_REFRESH, bool turnOffScreen = false) const {
+    displayBufferAsync(mode, turnOffScreen);
+    einkDisplay.waitForRefresh();
+  }
+  EInkDisplay::RefreshHandle displayBufferAsync(EInkDisplay::RefreshMode mode = EInkDisplay::FAST_REFRESH,
+                                                bool turnOffScreen = false) const {
+    return einkDisplay.displayBufferAsync(mode, turnOffScreen);
+  }
+  void waitForRefresh() const { einkDisplay.waitForRefresh(); }
+  void clearScreen(uint8_t color = 0xFF) const {
+    einkDisplay.waitForRefresh();
+    einkDisplay.clearScreen(color);
+  }
+
+ private:
+  EInkDisplay& einkDisplay;
+};
+
+// Mirrors the prefetch slot of PageCache: prefetchPage() loads ahead, loadPage() hands it over once
+class PrefetchingCache {
+ public:
+  std::unique_ptr<int> loadPage(uint16_t pageNum) {
+    if (prefetched_ && prefetchedNum_ == pageNum) {
+      return std::move(prefetched_);
+    }
+    if (pageNum >= pageCount) return nullptr;
+    reads++;
+    return std::unique_ptr<int>(new int(pageNum * 10 + generation));
+  }
+  void prefetchPage(uint16_t pageNum) {
+    if (pageNum >= pageCount || (prefetched_ && prefetchedNum_ == pageNum)) return;
+    prefetched_.reset();
+    prefetched_ = loadPage(pageNum);
+    prefetchedNum_ = pageNum;
+  }
+  void create() {
+    prefetched_.reset();
+    generation++;
+  }
+
+  uint16_t pageCount = 5;
+  int reads = 0;
+  int generation = 0;
+
+ private:
+  std::unique_ptr<int> prefetched_;
+  uint16_t prefetchedNum_ = 0;
+};
+
+int main() {
+  TestUtils::TestRunner runner("GfxRendererAsyncRefresh");
+
+  // Test 1: Async refresh returns a handle while the panel is busy
+  {
+    EInkDisplay display(0, 0, 0, 0, 0, 0);
+    GfxRenderer gfx(display);
+    const auto handle = gfx.displayBufferAsync();
+    runner.expectTrue(handle != 0, "async: handle is valid");
+    runner.expectTrue(display.refreshPending(), "async: refresh still pending");
+    runner.expectFalse(display.isRefreshComplete(handle), "async: incomplete while busy");
+    display.panelIdle();
+    runner.expectTrue(display.isRefreshComplete(handle), "async: complete once idle");
+    runner.expectFalse(display.refreshPending(), "async: completion clears pending state");
+    runner.expectEq(0u, display.blockingWaits(), "async: never blocked");
+  }
+
+  // Test 2: Drawing the next frame waits for the pending refresh first
+  {
+    EInkDisplay display(0, 0, 0, 0, 0, 0);
+    GfxRenderer gfx(display);
+    gfx.displayBufferAsync();
+    gfx.clearScreen(0x00);
+    runner.expectFalse(display.refreshPending(), "clear: refresh finished before clearing");
+    runner.expectEq(1u, display.blockingWaits(), "clear: waited once");
+    runner.expectEq(static_cast<uint8_t>(0x00), display.getFrameBuffer()[0], "clear: buffer cleared");
+
+    // Nothing pending: clearing again does not wait
+    gfx.clearScreen();
+    runner.expectEq(1u, display.blockingWaits(), "clear: idle panel needs no wait");
+  }
+
+  // Test 3: Back-to-back refreshes serialize, older handles report complete
+  {
+    EInkDisplay display(0, 0, 0, 0, 0, 0);
+    GfxRenderer gfx(display);
+    const auto first = gfx.displayBufferAsync();
+    const auto second = gfx.displayBufferAsync(EInkDisplay::HALF_REFRESH);
+    runner.expectTrue(second != first, "serialize: distinct handles");
+    runner.expectEq(1u, display.blockingWaits(), "serialize: second refresh waited for the first");
+    runner.expectTrue(display.isRefreshComplete(first), "serialize: first handle complete");
+    runner.expectFalse(display.isRefreshComplete(second), "serialize: second still running");
+    runner.expectTrue(display.isRefreshComplete(0), "serialize: null handle is complete");
+
+    gfx.displayBuffer();
+    runner.expectFalse(display.refreshPending(), "serialize: blocking displayBuffer leaves nothing pending");
+    runner.expectEq(3u, display.refreshCount(), "serialize: three refreshes started");
+  }
+
+  // Test 4: ReaderState flow - the next page is read while the panel refreshes
+  {
+    EInkDisplay display(0, 0, 0, 0, 0, 0);
+    GfxRenderer gfx(display);
+    PrefetchingCache cache;
+
+    auto page = cache.loadPage(0);
+    gfx.displayBufferAsync();
+    cache.prefetchPage(1);
+    runner.expectTrue(display.refreshPending(), "flow: prefetch overlapped the refresh");
+    gfx.waitForRefresh();
+    runner.expectEq(2, cache.reads, "flow: two reads so far");
+
+    page = cache.loadPage(1);
+    runner.expectTrue(page && *page == 10, "flow: prefetched page handed over");
+    runner.expectEq(2, cache.reads, "flow: no extra read for the prefetched page");
+    page = cache.loadPage(1);
+    runner.expectEq(3, cache.reads, "flow: prefetched page is handed over only once");
+
+    cache.prefetchPage(2);
+    cache.prefetchPage(2);
+    runner.expectEq(4, cache.reads, "flow: repeated prefetch reads once");
+    page = cache.loadPage(3);
+    runner.expectTrue(page && *page == 30, "flow: other page loads from storage");
+
+    cache.prefetchPage(4);
+    cache.create();
+    page = cache.loadPage(4);
+    runner.expectTrue(page && *page == 41, "flow: rebuilt cache drops stale prefetch");
+
+    const int readsBefore = cache.reads;
+    cache.prefetchPage(5);
+    runner.expectEq(readsBefore, cache.reads, "flow: prefetch past the end is ignored");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,263 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Minimal GfxRenderer mirroring the grayscale paths of lib/GfxRenderer/src/GfxRenderer.cpp:
+// drawPixel(), drawGrayPixel(), inGrayBand() and the 2-bit glyph branches of renderChar()
+class GfxRenderer {
+ public:
+  enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB, GRAYSCALE_BANDS };
+  enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
+
+  explicit GfxRenderer(uint8_t* frameBuffer) : frameBuffer(frameBuffer) {}
+
+  void setOrientation(Orientation o) { orientation = o; }
+  void setRenderMode(RenderMode mode) { renderMode = mode; }
+  void setBand(uint8_t* lsb, uint8_t* msb, int top, int rows) {
+    grayBandLsb_ = lsb;
+    grayBandMsb_ = msb;
+    grayBandTop_ = top;
+    grayBandRows_ = rows;
+  }
+
+  int getScreenWidth() const { return (orientation == Portrait || orientation == PortraitInverted) ? 480 : 800; }
+  int getScreenHeight() const { return (orientation == Portrait || orientation == PortraitInverted) ? 800 : 480; }
+
+  void drawPixel(int x, int y, bool state = true) const {
+    int rotatedX, rotatedY;
+    rotate(x, y, &rotatedX, &rotatedY);
+    if (rotatedX < 0 || rotatedX >= EInkDisplay::DISPLAY_WIDTH || rotatedY < 0 ||
+        rotatedY >= EInkDisplay::DISPLAY_HEIGHT) {
+      return;
+    }
+    const uint16_t byteIndex = rotatedY * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+    const uint8_t bitPosition = 7 - (rotatedX % 8);
+
+    if (renderMode == GRAYSCALE_BANDS) {
+      if (rotatedY < grayBandTop_ || rotatedY >= grayBandTop_ + grayBandRows_) return;
+      const uint16_t bandIndex = (rotatedY - grayBandTop_) * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+      if (state) {
+        grayBandLsb_[bandIndex] &= ~(1 << bitPosition);
+        grayBandMsb_[bandIndex] &= ~(1 << bitPosition);
+      } else {
+        grayBandLsb_[bandIndex] |= 1 << bitPosition;
+        grayBandMsb_[bandIndex] |= 1 << bitPosition;
+      }
+      return;
+    }
+
+    if (state) {
+      frameBuffer[byteIndex] &= ~(1 << bitPosition);
+    } else {
+      frameBuffer[byteIndex] |= 1 << bitPosition;
+    }
+  }
+
+  void drawGrayPixel(int x, int y, uint8_t val) const {
+    int rotatedX, rotatedY;
+    rotate(x, y, &rotatedX, &rotatedY);
+    if (rotatedX < 0 || rotatedX >= EInkDisplay::DISPLAY_WIDTH || rotatedY < grayBandTop_ ||
+        rotatedY >= grayBandTop_ + grayBandRows_) {
+      return;
+    }
+    const uint16_t bandIndex = (rotatedY - grayBandTop_) * EInkDisplay::DISPLAY_WIDTH_BYTES + (rotatedX / 8);
+    const uint8_t bit = 1 << (7 - (rotatedX % 8));
+    grayBandMsb_[bandIndex] |= bit;
+    if (val == 1) {
+      grayBandLsb_[bandIndex] |= bit;
+    }
+  }
+
+  bool inGrayBand(int x, int y, int width, int height) const {
+    if (renderMode != GRAYSCALE_BANDS) return true;
+    int x0, y0, x1, y1;
+    rotate(x, y, &x0, &y0);
+    rotate(x + width - 1, y + height - 1, &x1, &y1);
+    const int top = std::min(y0, y1);
+    const int bottom = std::max(y0, y1);
+    return bottom >= grayBandTop_ && top < grayBandTop_ + grayBandRows_;
+  }
+
+  // 2-bit glyph stamp, as renderChar() draws it (vals: 0 black .. 3 white)
+  void drawGlyph(const std::vector<uint8_t>& vals, int gx, int gy, int w, int h) const {
+    if (!inGrayBand(gx, gy, w, h)) return;
+    for (int py = 0; py < h; py++) {
+      const int screenY = gy + py;
+      if (screenY < 0 || screenY >= getScreenHeight()) continue;
+      for (int px = 0; px < w; px++) {
+        const int screenX = gx + px;
+        if (screenX < 0 || screenX >= getScreenWidth()) continue;
+        const uint8_t bmpVal = vals[py * w + px];
+        if (renderMode == BW && bmpVal < 3) {
+          drawPixel(screenX, screenY, true);
+        } else if (renderMode == GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_LSB && bmpVal == 1) {
+          drawPixel(screenX, screenY, false);
+        } else if (renderMode == GRAYSCALE_BANDS && (bmpVal == 1 || bmpVal == 2)) {
+          drawGrayPixel(screenX, screenY, bmpVal);
+        }
+      }
+    }
+  }
+
+ private:
+  void rotate(int x, int y, int* rx, int* ry) const {
+    switch (orientation) {
+      case Portrait:
+        *rx = y;
+        *ry = EInkDisplay::DISPLAY_HEIGHT - 1 - x;
+        break;
+      case LandscapeClockwise:
+        *rx = EInkDisplay::DISPLAY_WIDTH - 1 - x;
+        *ry = EInkDisplay::DISPLAY_HEIGHT - 1 - y;
+        break;
+      case PortraitInverted:
+        *rx = EInkDisplay::DISPLAY_WIDTH - 1 - y;
+        *ry = x;
+        break;
+      case LandscapeCounterClockwise:
+        *rx = x;
+        *ry = y;
+        break;
+    }
+  }
+
+  uint8_t* frameBuffer;
+  Orientation orientation = Portrait;
+  RenderMode renderMode = BW;
+  uint8_t* grayBandLsb_ = nullptr;
+  uint8_t* grayBandMsb_ = nullptr;
+  int grayBandTop_ = 0;
+  int grayBandRows_ = 0;
+};
+
+struct Glyph {
+  int x, y, w, h;
+  std::vector<uint8_t> vals;
+};
+
+// A "page": anti-aliased glyphs (some partly off screen) plus 1-bit rules drawn with both states
+static std::vector<Glyph> makePage(int screenW, int screenH, uint32_t seed) {
+  std::vector<Glyph> glyphs;
+  for (int i = 0; i < 300; i++) {
+    seed = seed * 1103515245u + 12345u;
+    Glyph g{static_cast<int>(seed % (screenW + 20)) - 10, static_cast<int>((seed >> 10) % (screenH + 20)) - 10,
+            4 + static_cast<int>((seed >> 20) % 20), 6 + static_cast<int>((seed >> 25) % 24), {}};
+    g.vals.resize(g.w * g.h);
+    for (auto& v : g.vals) {
+      seed = seed * 1103515245u + 12345u;
+      v = (seed >> 28) & 3;
+    }
+    glyphs.push_back(std::move(g));
+  }
+  return glyphs;
+}
+
+static void drawPage(const GfxRenderer& gfx, const std::vector<Glyph>& page) {
+  for (const auto& g : page) gfx.drawGlyph(g.vals, g.x, g.y, g.w, g.h);
+  // Status bar style 1-bit drawing: black rule and a white-on-black marker
+  for (int x = 0; x < 200; x++) gfx.drawPixel(x + 20, gfx.getScreenHeight() - 20, true);
+  for (int x = 0; x < 40; x++) gfx.drawPixel(x + 30, gfx.getScreenHeight() - 30, false);
+}
+
+// Reference: the separate LSB and MSB passes into a cleared full frame each
+static void referencePlanes(GfxRenderer::Orientation o, const std::vector<Glyph>& page, std::vector<uint8_t>& lsb,
+                            std::vector<uint8_t>& msb) {
+  lsb.assign(EInkDisplay::BUFFER_SIZE, 0x00);
+  msb.assign(EInkDisplay::BUFFER_SIZE, 0x00);
+  GfxRenderer lsbGfx(lsb.data());
+  lsbGfx.setOrientation(o);
+  lsbGfx.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  drawPage(lsbGfx, page);
+  GfxRenderer msbGfx(msb.data());
+  msbGfx.setOrientation(o);
+  msbGfx.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  drawPage(msbGfx, page);
+}
+
+// Band rendering as renderGrayscaleBands() does it, with the bands stitched back together
+static bool bandPlanes(GfxRenderer::Orientation o, const std::vector<Glyph>& page, int bandRows,
+                       std::vector<uint8_t>& frame, std::vector<uint8_t>& lsb, std::vector<uint8_t>& msb) {
+  lsb.assign(EInkDisplay::BUFFER_SIZE, 0xAA);
+  msb.assign(EInkDisplay::BUFFER_SIZE, 0xAA);
+  std::vector<uint8_t> planes(2 * bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES);
+  GfxRenderer gfx(frame.data());
+  gfx.setOrientation(o);
+  gfx.setRenderMode(GfxRenderer::GRAYSCALE_BANDS);
+  for (int top = 0; top < EInkDisplay::DISPLAY_HEIGHT; top += bandRows) {
+    const int rows = std::min(bandRows, EInkDisplay::DISPLAY_HEIGHT - top);
+    std::fill(planes.begin(), planes.end(), 0);
+    gfx.setBand(planes.data(), planes.data() + bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES, top, rows);
+    drawPage(gfx, page);
+    const size_t offset = static_cast<size_t>(top) * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    const size_t size = static_cast<size_t>(rows) * EInkDisplay::DISPLAY_WIDTH_BYTES;
+    memcpy(&lsb[offset], planes.data(), size);
+    memcpy(&msb[offset], planes.data() + bandRows * EInkDisplay::DISPLAY_WIDTH_BYTES, size);
+  }
+  return true;
+}
+
+int main() {
+  TestUtils::TestRunner runner("GfxRendererGrayscaleBand");
+  const GfxRenderer::Orientation orientations[] = {GfxRenderer::Portrait, GfxRenderer::LandscapeClockwise,
+                                                   GfxRenderer::PortraitInverted,
+                                                   GfxRenderer::LandscapeCounterClockwise};
+  const char* names[] = {"portrait", "landscape_cw", "portrait_inverted", "landscape_ccw"};
+
+  // Test 1: Banded planes equal the separate LSB/MSB passes for every orientation and band height
+  // (120 = max band, 60/8 = fallbacks after allocation failure, 7 leaves a short last band)
+  const int bandHeights[] = {120, 60, 8, 7};
+  for (int i = 0; i < 4; i++) {
+    std::vector<uint8_t> frame(EInkDisplay::BUFFER_SIZE, 0xFF);
+    GfxRenderer probe(frame.data());
+    probe.setOrientation(orientations[i]);
+    const auto page = makePage(probe.getScreenWidth(), probe.getScreenHeight(), 77u + i);
+
+    std::vector<uint8_t> refLsb, refMsb;
+    referencePlanes(orientations[i], page, refLsb, refMsb);
+    for (const int rows : bandHeights) {
+      std::vector<uint8_t> lsb, msb;
+      bandPlanes(orientations[i], page, rows, frame, lsb, msb);
+      const std::string name = std::string(names[i]) + "_band" + std::to_string(rows);
+      runner.expectTrue(lsb == refLsb, name + ": LSB plane matches");
+      runner.expectTrue(msb == refMsb, name + ": MSB plane matches");
+    }
+  }
+
+  // Test 2: Band rendering leaves the BW frame buffer untouched
+  {
+    std::vector<uint8_t> frame(EInkDisplay::BUFFER_SIZE);
+    for (size_t i = 0; i < frame.size(); i++) frame[i] = static_cast<uint8_t>(i * 31);
+    const auto original = frame;
+    const auto page = makePage(480, 800, 5);
+    std::vector<uint8_t> lsb, msb;
+    bandPlanes(GfxRenderer::Portrait, page, 120, frame, lsb, msb);
+    runner.expectTrue(frame == original, "frame buffer untouched by band rendering");
+  }
+
+  // Test 3: inGrayBand culls glyphs by their physical row span
+  {
+    std::vector<uint8_t> frame(EInkDisplay::BUFFER_SIZE, 0xFF);
+    GfxRenderer gfx(frame.data());
+    gfx.setRenderMode(GfxRenderer::GRAYSCALE_BANDS);
+    gfx.setBand(nullptr, nullptr, 120, 120);  // physical rows 120..239
+    gfx.setOrientation(GfxRenderer::Portrait);  // physical row = 479 - logical x
+    runner.expectTrue(gfx.inGrayBand(300, 50, 10, 10), "portrait: x 300..309 -> rows 170..179 inside");
+    runner.expectFalse(gfx.inGrayBand(400, 50, 10, 10), "portrait: x 400..409 -> rows 70..79 outside");
+    runner.expectTrue(gfx.inGrayBand(355, 0, 10, 800), "portrait: straddles band top edge");
+    gfx.setOrientation(GfxRenderer::LandscapeCounterClockwise);  // physical row = logical y
+    runner.expectTrue(gfx.inGrayBand(0, 235, 5, 10), "landscape: straddles band bottom edge");
+    runner.expectFalse(gfx.inGrayBand(0, 240, 5, 10), "landscape: first row after band");
+    gfx.setRenderMode(GfxRenderer::BW);
+    runner.expectTrue(gfx.inGrayBand(0, 240, 5, 10), "BW mode never culls");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+// GfxRenderer::drawShapedText() tests
+//
+// Words shaped at layout are drawn from their cached glyphs instead of going through the shapers
+// again. Drawing them must give the frame buffer drawText() gives, in every render mode.
+
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+#include <EpdFont.h>
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <builtinFonts/reader_2b.h>
+#include <builtinFonts/reader_bold_2b.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "blocks/TextBlock.h"
+
+// Link stub: no bitmaps are drawn here
+BmpReaderError Bitmap::readRow(uint8_t*, uint8_t*, int) const { return BmpReaderError::Ok; }
+
+namespace {
+
+constexpr int kFontId = 1;
+
+struct Word {
+  const char* text;
+  const char* name;
+};
+
+const Word kWords[] = {
+    {"\xD8\xA7\xD9\x84\xD8\xB3\xD9\x84\xD8\xA7\xD9\x85", "Arabic salam"},  // السلام
+    {"\xD8\xB9\xD9\x84\xD9\x8A\xD9\x83\xD9\x85", "Arabic alaykum"},        // عليكم
+    {"\xD9\x84\xD8\xA7", "Arabic lam-alef"},                                // لا: one ligature glyph
+    {"\xE0\xB8\xAA\xE0\xB8\xA7\xE0\xB8\xB1\xE0\xB8\xAA\xE0\xB8\x94\xE0\xB8\xB5",
+     "Thai sawasdee"},                                                      // สวัสดี
+    {"\xE0\xB8\x99\xE0\xB9\x89\xE0\xB8\xB3", "Thai nam"},                  // น้ำ: tone mark over sara am
+    {"\xE0\xB8\x9B\xE0\xB8\xB9\xE0\xB9\x88", "Thai pu"},                   // ปู่: tall consonant, below vowel
+    {"\xE0\xB9\x80\xE0\xB8\x81\xE0\xB8\xB5\xE0\xB9\x88\xE0\xB8\xA2\xE0\xB8\xA7",
+     "Thai kiao"},                                                          // เกี่ยว: leading vowel
+};
+
+const GfxRenderer::RenderMode kModes[] = {GfxRenderer::BW, GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB};
+const char* const kModeNames[] = {"BW", "LSB", "MSB"};
+
+std::vector<uint8_t> frame(const GfxRenderer& gfx) {
+  const uint8_t* buffer = gfx.getFrameBuffer();
+  return std::vector<uint8_t>(buffer, buffer + EInkDisplay::BUFFER_SIZE);
+}
+
+// Draws the word both ways at x (not byte-aligned, so glyphs straddle buffer bytes) and compares.
+// Gray planes are cleared to 0x00 before drawing, as the reader does.
+bool drawsTheSame(GfxRenderer& gfx, const GfxRenderer::RenderMode mode, const char* text, const int x,
+                  const EpdFontFamily::Style style, bool* inked) {
+  const uint8_t clear = mode == GfxRenderer::BW ? 0xFF : 0x00;
+  gfx.setRenderMode(mode);
+  const uint8_t flags = gfx.getTextFlags(kFontId, text, style);
+  std::vector<TextBlock::ShapedGlyph> glyphs;
+  const uint16_t count = TextBlock::shapeWord(text, flags, glyphs);
+  if (count == 0) return false;
+
+  gfx.clearScreen(clear);
+  gfx.drawText(kFontId, x, 40, text, true, style, flags);
+  const std::vector<uint8_t> expected = frame(gfx);
+
+  gfx.clearScreen(clear);
+  gfx.drawShapedText(kFontId, x, 40, glyphs.data(), count, flags, true, style);
+  const std::vector<uint8_t> actual = frame(gfx);
+
+  gfx.clearScreen(clear);
+  *inked = expected != frame(gfx);
+  return expected == actual;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("GfxRendererShapedText");
+
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  EpdFont regular(&reader_2b);
+  EpdFont bold(&reader_bold_2b);
+  gfx.insertFont(kFontId, EpdFontFamily(&regular, &bold, &regular, &bold));
+
+  // Test 1: Arabic and Thai words draw the same from their shaped glyphs in every mode
+  for (size_t m = 0; m < sizeof(kModes) / sizeof(kModes[0]); m++) {
+    for (const auto& word : kWords) {
+      bool inked = false;
+      const bool same = drawsTheSame(gfx, kModes[m], word.text, 13, EpdFontFamily::REGULAR, &inked);
+      const std::string name = std::string(kModeNames[m]) + ": " + word.name;
+      runner.expectTrue(inked, name + " draws something");
+      runner.expectTrue(same, name + " matches drawText()");
+    }
+  }
+
+  // Test 2: Bold words, at other positions
+  for (const int x : {0, 7, 250}) {
+    for (const auto& word : kWords) {
+      bool inked = false;
+      runner.expectTrue(drawsTheSame(gfx, GfxRenderer::BW, word.text, x, EpdFontFamily::BOLD, &inked) && inked,
+                        std::string("bold at x=") + std::to_string(x) + ": " + word.name);
+    }
+  }
+
+  // Test 3: Latin words are left to drawText()
+  {
+    std::vector<TextBlock::ShapedGlyph> glyphs;
+    const uint8_t flags = gfx.getTextFlags(kFontId, "Hello");
+    runner.expectEq(static_cast<uint16_t>(0), TextBlock::shapeWord("Hello", flags, glyphs), "Latin: not shaped");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
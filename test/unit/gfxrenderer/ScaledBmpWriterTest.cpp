@@ -0,0 +1,200 @@
+#include "test_utils.h"
+
+#include <Arduino.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BitmapHelpers.h"
+#include "ScaledBmpWriter.h"
+
+// BitmapHelpers.cpp pulls in SD card I/O (bmpTo1BitBmpScaled), so the pixel helpers
+// ScaledBmpWriter needs are inlined here (mirrors lib/GfxRenderer/src/BitmapHelpers.cpp)
+int adjustPixel(int gray) {
+  int adjusted = ((gray - 128) * 135) / 100 + 128;
+  if (adjusted < 0) adjusted = 0;
+  if (adjusted > 255) adjusted = 255;
+  return adjusted;
+}
+
+uint8_t quantizeSimple(int gray) {
+  if (gray < 45) return 0;
+  if (gray < 70) return 1;
+  if (gray < 140) return 2;
+  return 3;
+}
+
+const uint8_t* adjustPixelLut() {
+  static uint8_t lut[256];
+  for (int i = 0; i < 256; i++) lut[i] = static_cast<uint8_t>(adjustPixel(i));
+  return lut;
+}
+
+const uint8_t* quantizeSimpleAdjustedLut() {
+  static uint8_t lut[256];
+  for (int i = 0; i < 256; i++) lut[i] = quantizeSimple(adjustPixel(i));
+  return lut;
+}
+
+uint8_t quantize(int gray, int x, int y) {
+  (void)x;
+  (void)y;
+  return quantizeSimple(gray);
+}
+
+uint8_t quantize1bit(int gray, int x, int y) {
+  (void)x;
+  (void)y;
+  return gray < 128 ? 0 : 1;
+}
+
+// Print sink that captures everything written to it
+class CapturePrint : public Print {
+ public:
+  size_t write(uint8_t c) override {
+    data.push_back(static_cast<char>(c));
+    return 1;
+  }
+  size_t write(const uint8_t* buf, size_t size) override {
+    data.append(reinterpret_cast<const char*>(buf), size);
+    return size;
+  }
+  std::string data;
+};
+
+static uint32_t readLE32(const std::string& s, size_t off) {
+  return static_cast<uint8_t>(s[off]) | (static_cast<uint8_t>(s[off + 1]) << 8) |
+         (static_cast<uint8_t>(s[off + 2]) << 16) | (static_cast<uint32_t>(static_cast<uint8_t>(s[off + 3])) << 24);
+}
+
+static uint16_t readLE16(const std::string& s, size_t off) {
+  return static_cast<uint8_t>(s[off]) | (static_cast<uint8_t>(s[off + 1]) << 8);
+}
+
+// Deterministic gradient + noise source image
+static std::vector<uint8_t> makeSource(int w, int h) {
+  std::vector<uint8_t> px(static_cast<size_t>(w) * h);
+  uint32_t seed = 12345;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      seed = seed * 1103515245u + 12345u;
+      px[static_cast<size_t>(y) * w + x] = static_cast<uint8_t>((x * 255 / w + (seed >> 28)) & 0xFF);
+    }
+  }
+  return px;
+}
+
+static std::string convertSingle(const BmpOutputSpec& specIn, const std::vector<uint8_t>& src, int w, int h) {
+  CapturePrint out;
+  BmpOutputSpec spec = specIn;
+  spec.out = &out;
+  ScaledBmpWriter writer;
+  if (!writer.begin(spec, w, h)) return "";
+  for (int y = 0; y < h; y++) writer.pushRow(&src[static_cast<size_t>(y) * w]);
+  return out.data;
+}
+
+int main() {
+  TestUtils::TestRunner runner("ScaledBmpWriter");
+
+  // Test 1: 1:1 2-bit output has correct header and size
+  {
+    const auto src = makeSource(40, 10);
+    BmpOutputSpec spec;
+    spec.maxWidth = 450;
+    spec.maxHeight = 750;
+    const std::string bmp = convertSingle(spec, src, 40, 10);
+    runner.expectTrue(bmp.size() > 70 && bmp[0] == 'B' && bmp[1] == 'M', "2bit: BMP signature");
+    runner.expectEq(static_cast<uint32_t>(40), readLE32(bmp, 18), "2bit: width unchanged");
+    runner.expectEq(static_cast<int32_t>(-10), static_cast<int32_t>(readLE32(bmp, 22)), "2bit: top-down height");
+    runner.expectEq(static_cast<uint16_t>(2), readLE16(bmp, 28), "2bit: bpp");
+    runner.expectEq(static_cast<uint32_t>(70), readLE32(bmp, 10), "2bit: pixel data offset");
+    // (40*2+31)/32*4 = 12 bytes per row
+    runner.expectEq(static_cast<size_t>(70 + 12 * 10), bmp.size(), "2bit: file size matches rows");
+    runner.expectEq(static_cast<uint32_t>(bmp.size()), readLE32(bmp, 2), "2bit: header file size");
+  }
+
+  // Test 2: Downscaling writes exactly outHeight rows
+  {
+    const int w = 900, h = 1500;
+    const auto src = makeSource(w, h);
+    CapturePrint out;
+    BmpOutputSpec spec;
+    spec.out = &out;
+    spec.maxWidth = 320;
+    spec.maxHeight = 440;
+    spec.oneBit = true;
+    ScaledBmpWriter writer;
+    runner.expectTrue(writer.begin(spec, w, h), "scale: begin succeeds");
+    for (int y = 0; y < h; y++) writer.pushRow(&src[static_cast<size_t>(y) * w]);
+    runner.expectEq(264, writer.outWidth(), "scale: contain-mode width");
+    // 440/1500 * 1500 truncates to 439 in float, same as the converters always did
+    runner.expectEq(439, writer.outHeight(), "scale: contain-mode height");
+    runner.expectEq(writer.outHeight(), writer.rowsWritten(), "scale: every output row written");
+    const size_t rowBytes = (264 + 31) / 32 * 4;
+    runner.expectEq(static_cast<size_t>(62 + rowBytes * 439), out.data.size(), "scale: 1-bit file size");
+    runner.expectEq(static_cast<uint16_t>(1), readLE16(out.data, 28), "scale: 1-bit bpp");
+  }
+
+  // Test 3: Feeding two writers from one pass matches two independent conversions
+  {
+    const int w = 600, h = 1000;
+    const auto src = makeSource(w, h);
+    BmpOutputSpec coverSpec;
+    coverSpec.maxWidth = 450;
+    coverSpec.maxHeight = 750;
+    coverSpec.oneBit = true;
+    BmpOutputSpec thumbSpec;
+    thumbSpec.maxWidth = 320;
+    thumbSpec.maxHeight = 440;
+    thumbSpec.oneBit = true;
+
+    const std::string coverAlone = convertSingle(coverSpec, src, w, h);
+    const std::string thumbAlone = convertSingle(thumbSpec, src, w, h);
+
+    CapturePrint coverOut;
+    CapturePrint thumbOut;
+    coverSpec.out = &coverOut;
+    thumbSpec.out = &thumbOut;
+    ScaledBmpWriter writers[2];
+    runner.expectTrue(writers[0].begin(coverSpec, w, h) && writers[1].begin(thumbSpec, w, h), "multi: begin");
+    for (int y = 0; y < h; y++) {
+      writers[0].pushRow(&src[static_cast<size_t>(y) * w]);
+      writers[1].pushRow(&src[static_cast<size_t>(y) * w]);
+    }
+    runner.expectTrue(coverOut.data == coverAlone, "multi: cover identical to single-output conversion");
+    runner.expectTrue(thumbOut.data == thumbAlone, "multi: thumb identical to single-output conversion");
+    runner.expectTrue(coverOut.data != thumbOut.data, "multi: outputs differ in size");
+  }
+
+  // Test 4: Quick mode 2-bit produces pure threshold output (white stays white)
+  {
+    const int w = 16, h = 2;
+    std::vector<uint8_t> src(w * h, 255);
+    BmpOutputSpec spec;
+    spec.quickMode = true;
+    const std::string bmp = convertSingle(spec, src, w, h);
+    runner.expectEq(static_cast<size_t>(70 + 4 * 2), bmp.size(), "quick: file size");
+    bool allWhite = true;
+    for (size_t i = 70; i < bmp.size(); i++) {
+      if (static_cast<uint8_t>(bmp[i]) != 0xFF) allWhite = false;
+    }
+    runner.expectTrue(allWhite, "quick: white source maps to level 3");
+  }
+
+  // Test 5: Extra rows beyond the output height are ignored
+  {
+    const int w = 8, h = 4;
+    std::vector<uint8_t> src(w * (h + 2), 0);
+    CapturePrint out;
+    BmpOutputSpec spec;
+    spec.out = &out;
+    ScaledBmpWriter writer;
+    writer.begin(spec, w, h);
+    for (int y = 0; y < h + 2; y++) writer.pushRow(&src[static_cast<size_t>(y) * w]);
+    runner.expectEq(h, writer.rowsWritten(), "overflow: rows capped at height");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -393,6 +393,75 @@ int main() {
     runner.expectTrue(hasPatternBreak, "de: has pattern-based breaks within Satellitensystem");
   }
 
+  // ============================================
+  // Fixed-buffer API and memo
+  // ============================================
+
+  {
+    Hyphenation::setLanguage("de");
+    const std::string word = "Dampfschifffahrtsgesellschaft";  // Short enough to be memoized
+    const auto expected = Hyphenation::breakOffsets(word, false);
+    Hyphenation::BreakInfo breaks[Hyphenation::kMaxBreaks];
+    bool allMatch = true;
+    // The second and third calls are answered from the memo
+    for (int call = 0; call < 3; ++call) {
+      const size_t count = Hyphenation::breakOffsets(word, false, breaks, Hyphenation::kMaxBreaks);
+      allMatch &= count == expected.size();
+      for (size_t i = 0; allMatch && i < count; ++i) {
+        allMatch &= breaks[i].byteOffset == expected[i].byteOffset &&
+                    breaks[i].requiresInsertedHyphen == expected[i].requiresInsertedHyphen;
+      }
+    }
+    runner.expectTrue(expected.size() > 2 && allMatch, "fixed buffer: same breaks as the vector API, every call");
+
+    const size_t count = Hyphenation::breakOffsets(word, false, breaks, 2);
+    runner.expectEq(static_cast<size_t>(2), count, "fixed buffer: stops at capacity");
+    runner.expectEq(expected[1].byteOffset, breaks[1].byteOffset, "fixed buffer: keeps the leftmost breaks");
+
+    // The hyphenator's own buffer, for a word too long to be memoized
+    const std::string longWord = "Donaudampfschifffahrtsgesellschaftskapit\xC3\xA4nswitwe";
+    const auto longExpected = Hyphenation::breakOffsets(longWord, true);
+    const Hyphenation::BreakInfo* own = nullptr;
+    bool ownMatch = Hyphenation::breakOffsets(longWord, true, own) == longExpected.size() && own != nullptr;
+    for (size_t i = 0; ownMatch && i < longExpected.size(); ++i) {
+      ownMatch &= own[i].byteOffset == longExpected[i].byteOffset &&
+                  own[i].requiresInsertedHyphen == longExpected[i].requiresInsertedHyphen;
+    }
+    runner.expectTrue(longExpected.size() > 2 && ownMatch, "own buffer: same breaks as the vector API");
+  }
+
+  {
+    // Words of the same length whose hashes collide get their own breaks, not each other's
+    Hyphenation::setLanguage("en");
+    const auto first = Hyphenation::breakOffsets("piendinghoma", false);
+    const auto second = Hyphenation::breakOffsets("reextyprotal", false);
+    Hyphenation::setLanguage("en");
+    const auto secondAlone = Hyphenation::breakOffsets("reextyprotal", false);
+    bool same = second.size() == secondAlone.size();
+    bool differ = first.size() != second.size();
+    for (size_t i = 0; same && i < second.size(); ++i) {
+      same &= second[i].byteOffset == secondAlone[i].byteOffset;
+      differ |= i < first.size() && first[i].byteOffset != second[i].byteOffset;
+    }
+    runner.expectTrue(differ && same, "memo: hash collision answered with the word's own breaks");
+  }
+
+  {
+    // The memo is per language: the same word is hyphenated again after a switch
+    Hyphenation::setLanguage("en");
+    const auto english = Hyphenation::breakOffsets("international", false);
+    Hyphenation::setLanguage("");
+    runner.expectTrue(!english.empty() && Hyphenation::breakOffsets("international", false).empty(),
+                      "memo: cleared when the language changes");
+  }
+
+  {
+    // Fallback and dictionary results for the same word are kept apart
+    Hyphenation::setLanguage("en");
+    runner.expectTrue(Hyphenation::breakOffsets("zzzzzzzzz", false).empty(), "memo: no dictionary breaks");
+    runner.expectTrue(!Hyphenation::breakOffsets("zzzzzzzzz", true).empty(), "memo: fallback breaks still found");
+  }
+
   // Reset to English for consistent state
   Hyphenation::setLanguage("en");
 
@@ -0,0 +1,228 @@
+// Checks the Aho-Corasick matcher against breaks recorded from the serialized trie walk it replaced,
+// for every language: real words, where the hyphenated forms below are that walk's output, and 3000
+// random words over each alphabet, compared by a digest of the walk's breaks.
+
+#include "test_utils.h"
+
+#include <HyphenationAutomaton.h>
+#include <HyphenationCommon.h>
+#include <LiangHyphenation.h>
+#include <Utf8.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "generated/hyph-de.trie.h"
+#include "generated/hyph-en.trie.h"
+#include "generated/hyph-es.trie.h"
+#include "generated/hyph-fr.trie.h"
+#include "generated/hyph-it.trie.h"
+#include "generated/hyph-ru.trie.h"
+#include "generated/hyph-uk.trie.h"
+
+namespace {
+
+struct LanguageCase {
+  const char* name;
+  const HyphenationAutomaton& automaton;
+  LiangWordConfig config;
+  const char* alphabet;            // Letters of the random words
+  uint32_t randomDigest;           // FNV-1a of the trie walk's break count and indexes, word by word
+  size_t randomBreaks;             // Breaks the trie walk found in the random words
+  std::vector<const char*> words;  // As the trie walk hyphenated them
+};
+
+// clang-format off
+const LanguageCase kLanguages[] = {
+    {"de",
+     de_automaton, LiangWordConfig(isLatinLetter, toLowerLatin),
+     "abcdefghijklmnopqrstuvwxyzäöüßABDEGHKLMNOSTUVWZÄÖÜ",
+     0x0F353C1E,
+     8045,
+     {
+      "Dampf-schiff-fahrts-ge-sell-schaft", "Sil-ben-tren-nung", "Do-nau-dampf-schiff",
+      "Rechts-schutz-ver-si-che-rungs-ge-sell-schaf-ten", "Bun-des-ver-fas-sungs-ge-richt",
+      "Le-bens-ver-si-che-rung", "Ge-schwin-dig-keits-be-gren-zung", "Stra-ßen-bahn-hal-te-stel-le",
+      "Grö-ßen-ord-nung", "Über-set-zung", "Fuß-ball-welt-meis-ter-schaft", "Kin-der-gar-ten", "Wis-sen-schaft-ler",
+      "Ver-ant-wor-tung", "Freund-schaft", "Ent-schul-di-gung", "Ar-beits-platz", "Schiff-fahrt", "Bi-blio-thek",
+      "mög-li-cher-wei-se", "Häu-ser", "Zu-sam-men-ar-beit", "Eich-hörn-chen", "Don-ners-tag"
+     }},
+    {"en",
+     en_automaton, LiangWordConfig(isLatinLetter, toLowerLatin, 3, 3),
+     "abcdefghijklmnopqrstuvwxyzABCDEHILMNOPRSTW",
+     0x3F25533B,
+     5897,
+     {
+      "hyphen-ation", "Hyphen-ation", "com-puter", "algo-rithm", "dic-tio-nary", "extra-or-di-nary",
+      "char-ac-ter-is-ti-cally", "incom-pre-hen-si-bil-i-ties", "light-house", "keep-ers", "qui-etly",
+      "inter-na-tional", "respon-si-bil-ity", "mis-un-der-stand-ing", "pho-to-graphic", "trans-for-ma-tion",
+      "unbe-liev-able", "estab-lish-ment", "antidis-es-tab-lish-men-tar-i-an-ism",
+      "super-cal-ifrag-ilis-tic-ex-pi-ali-do-cious", "envi-ron-men-tal", "pro-gram-ming", "com-mu-ni-ca-tion",
+      "elec-troen-cephalog-ra-phy", "Mis-sis-sippi", "rhythm"
+     }},
+    {"es",
+     es_automaton, LiangWordConfig(isLatinLetter, toLowerLatin),
+     "abcdefghijklmnopqrstuvwxyzáéíñóúüCDEMNPU",
+     0xC300127C,
+     7502,
+     {
+      "des-afor-tu-na-da-men-te", "in-ter-na-cio-na-li-za-ción", "ex-tra-or-di-na-rio", "bi-blio-te-ca",
+      "res-pon-sa-bi-li-dad", "compu-tado-ra", "elec-tro-do-més-ti-co", "oto-rri-no-la-rin-gó-lo-go",
+      "mur-cié-la-go", "co-ra-zón", "pin-güino", "fe-rro-ca-rril", "cons-ti-tu-cio-nal", "Uni-ver-si-dad",
+      "de-sa-rro-llo", "can-ción", "es-pa-ño-les", "llo-rar"
+     }},
+    {"fr",
+     fr_automaton, LiangWordConfig(isLatinLetter, toLowerLatin),
+     "abcdefghijklmnopqrstuvwxyzàâçéèêëîïôùûüCEGMPR",
+     0x5AA5747E,
+     6944,
+     {
+      "an-ti-cons-ti-tu-tion-nel-le-ment", "bi-blio-thèque", "ex-tra-or-di-naire", "dé-ve-lop-pe-ment",
+      "res-pon-sa-bi-li-té", "or-di-na-teur", "gou-ver-ne-ment", "ma-thé-ma-tiques", "élec-tri-ci-té", "Châ-teau",
+      "phar-ma-ceu-tique", "in-ter-na-tio-na-li-sa-tion", "phé-no-mène", "pré-oc-cu-pa-tion", "ac-cueillir",
+      "Mont-réal", "cœur"
+     }},
+    {"it",
+     it_automaton, LiangWordConfig(isLatinLetter, toLowerLatin),
+     "abcdefghijklmnopqrstuvwxyzàèéìòùCMRS",
+     0x64572AFB,
+     13236,
+     {
+      "pre-ci-pi-te-vo-lis-si-me-vol-men-te", "bi-blio-te-ca", "straor-di-na-rio", "re-spon-sa-bi-li-tà",
+      "in-ter-na-zio-na-liz-za-zio-ne", "cal-co-la-to-re", "svi-lup-po", "uni-ver-si-tà", "gnoc-chi",
+      "chiac-chie-ra-re", "fa-mi-glia", "Re-pub-bli-ca", "ae-ro-por-to", "mi-glia-ia", "scien-zia-to", "per-ché",
+      "Sar-de-gna"
+     }},
+    {"ru",
+     ru_automaton, LiangWordConfig(isCyrillicLetter, toLowerCyrillic),
+     "абвгдеёжзийклмнопрстуфхцчшщъыьэюяАБВЁМПСЧ",
+     0x3589429D,
+     12119,
+     {
+      "до-сто-при-ме-ча-тель-ность", "пе-ре-осви-де-тель-ство-ва-ние", "ги-пер-бо-ли-зи-ро-ван-ный", "биб-лио-те-ка",
+      "элек-тро-стан-ция", "Москва", "от-вет-ствен-ность", "пре-вы-со-ком-но-го-рас-смот-ри-тель-ству-ю-щий",
+      "че-ло-ве-ко-не-на-вист-ни-че-ство", "ин-тер-на-ци-о-на-ли-за-ция", "про-грам-ми-ро-ва-ние", "объ-яв-ле-ние",
+      "подъ-езд", "го-су-дар-ствен-ный", "сча-стье", "Ёл-ка", "Санкт", "вы-чис-ли-тель-ный"
+     }},
+    {"uk",
+     uk_automaton, LiangWordConfig(isCyrillicLetter, toLowerCyrillic),
+     "абвгґдеєжзиіїйклмнопрстуфхцчшщьюяКУЄІ",
+     0x631AB25B,
+     10641,
+     {
+      "бі-бліо-те-ка", "від-по-від-аль-ність", "еле-ктро-стан-ція", "ін-тер-на-ціо-на-лі-за-ція",
+      "про-гра-му-ва-н-ня", "Ки-їв", "не-за-ле-жність", "уні-вер-си-тет", "гро-мад-ськість", "їжа-чок",
+      "єв-ро-пей-ський", "пе-ре-про-шую", "ща-стя", "Укра-ї-на", "спів-ро-бі-тни-цтво", "ґа-нок"
+     }},
+};
+// clang-format on
+
+struct Random {
+  uint32_t state;
+  uint32_t next(const uint32_t bound) {
+    state = state * 1664525u + 1013904223u;
+    return (state >> 8) % bound;
+  }
+};
+
+std::vector<CodepointInfo> toCodepoints(const std::string& text) {
+  std::vector<CodepointInfo> cps;
+  auto* p = reinterpret_cast<const unsigned char*>(text.c_str());
+  while (*p) {
+    const size_t offset = static_cast<size_t>(p - reinterpret_cast<const unsigned char*>(text.c_str()));
+    cps.push_back({utf8NextCodepoint(&p), offset});
+  }
+  return cps;
+}
+
+size_t breakIndexes(const LanguageCase& language, const std::vector<CodepointInfo>& cps, size_t* out) {
+  return liangBreakIndexes(cps.data(), cps.size(), language.automaton, language.config, out,
+                           LiangWordConfig::kMaxLetters);
+}
+
+// The word with a hyphen at every break the matcher finds
+std::string hyphenate(const LanguageCase& language, const std::string& word) {
+  const std::vector<CodepointInfo> cps = toCodepoints(word);
+  size_t breaks[LiangWordConfig::kMaxLetters];
+  const size_t count = breakIndexes(language, cps, breaks);
+  std::string out;
+  size_t next = 0;
+  for (size_t i = 0; i < cps.size(); ++i) {
+    if (next < count && breaks[next] == i) {
+      out += '-';
+      ++next;
+    }
+    const size_t end = i + 1 < cps.size() ? cps[i + 1].byteOffset : word.size();
+    out.append(word, cps[i].byteOffset, end - cps[i].byteOffset);
+  }
+  return out;
+}
+
+// Random words over the language's alphabet; the last 50 may be longer than the matcher takes
+uint32_t randomWordsDigest(const LanguageCase& language, size_t& totalBreaks) {
+  const std::vector<CodepointInfo> alphabet = toCodepoints(language.alphabet);
+  Random random{0x5EED};
+  uint32_t hash = 2166136261u;
+  size_t breaks[LiangWordConfig::kMaxLetters];
+  totalBreaks = 0;
+  for (size_t i = 0; i < 3000; ++i) {
+    std::vector<CodepointInfo> word;
+    const size_t length = 1 + random.next(i < 2950 ? 24 : 110);
+    for (size_t j = 0; j < length; ++j) {
+      word.push_back({alphabet[random.next(static_cast<uint32_t>(alphabet.size()))].value, 0});
+    }
+    const size_t count = breakIndexes(language, word, breaks);
+    totalBreaks += count;
+    hash = (hash ^ static_cast<uint8_t>(count)) * 16777619u;
+    for (size_t k = 0; k < count; ++k) hash = (hash ^ static_cast<uint8_t>(breaks[k])) * 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("LiangAutomaton");
+
+  for (const auto& language : kLanguages) {
+    const std::string name = language.name;
+
+    // Test 1: Real words break where the trie walk broke them
+    for (const char* expected : language.words) {
+      std::string word;
+      for (const char* c = expected; *c; ++c) {
+        if (*c != '-') word += *c;
+      }
+      runner.expectEq(std::string(expected), hyphenate(language, word), name + ": " + word);
+    }
+
+    // Test 2: Random words, by digest
+    size_t totalBreaks = 0;
+    const uint32_t digest = randomWordsDigest(language, totalBreaks);
+    runner.expectEq(language.randomBreaks, totalBreaks, name + ": breaks in 3000 random words");
+    runner.expectTrue(digest == language.randomDigest, name + ": random words break where the trie walk broke them");
+  }
+
+  {
+    // Test 3: Automaton invariants the matcher relies on
+    bool consistent = true;
+    for (const auto& language : kLanguages) {
+      const HyphenationAutomaton& a = language.automaton;
+      consistent &= a.firstChild(0) == 1 && a.firstChild(a.stateCount) == a.stateCount;
+      consistent &= a.denseStates >= 1 && a.denseStates <= a.stateCount && a.levels[0] == 0;
+      std::vector<uint8_t> depth(a.stateCount, 0);
+      for (size_t s = 0; s < a.stateCount; ++s) {
+        consistent &= a.firstChild(s) <= a.firstChild(s + 1);
+        for (size_t child = a.firstChild(s); child < a.firstChild(s + 1); ++child) depth[child] = depth[s] + 1;
+      }
+      for (size_t s = 1; s < a.stateCount; ++s) {
+        consistent &= a.fail[s] < s && depth[a.fail[s]] < depth[s];
+        consistent &= a.levels[s] == 0 || a.levelData[a.levels[s] >> 4] == depth[s];
+      }
+    }
+    runner.expectTrue(consistent, "Failure links point to shallower states, and pattern lengths are right");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
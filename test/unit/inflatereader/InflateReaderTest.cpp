@@ -1,9 +1,13 @@
 #include "test_utils.h"
 
 #include <InflateReader.h>
+#include <zlib.h>
 
+#include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <string>
+#include <vector>
 
 // clang-format off
 // Raw deflate (no zlib header) of "Hello, World!" (13 bytes)
@@ -59,6 +63,93 @@ static int chunkedReadCb(uzlib_uncomp* uncomp) {
   return ctx->buf[0];
 }
 
+// Pseudo-text that compresses like a book chapter, so zlib emits many blocks
+static std::string makeChapterText(size_t size) {
+  static const char* const kWords[] = {"the ",    "reader ", "page ",  "<p>",    "</p>\n", "chapter ",
+                                       "light ",  "ink ",    "quiet ", "river ", "stone ",  "&mdash; ",
+                                       "window ", "said ",   "was ",   "and ",   "of ",     "a "};
+  std::string text;
+  text.reserve(size + 16);
+  uint32_t seed = 12345;
+  while (text.size() < size) {
+    seed = seed * 1103515245u + 12345u;
+    text += kWords[(seed >> 16) % (sizeof(kWords) / sizeof(kWords[0]))];
+  }
+  text.resize(size);
+  return text;
+}
+
+// Raw deflate (as stored in ZIP entries) via host zlib. memLevel 1 keeps blocks small.
+static std::vector<uint8_t> rawDeflate(const std::string& text, int level = Z_BEST_COMPRESSION, int memLevel = 1,
+                                       int strategy = Z_DEFAULT_STRATEGY) {
+  z_stream zs = {};
+  deflateInit2(&zs, level, Z_DEFLATED, -15, memLevel, strategy);
+  std::vector<uint8_t> out(deflateBound(&zs, text.size()));
+  zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+  zs.avail_in = text.size();
+  zs.next_out = out.data();
+  zs.avail_out = out.size();
+  deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return out;
+}
+
+// Callback input that counts delivered bytes, like ZipFile's read callback
+struct CountingCtx {
+  InflateReader reader;  // must be first member
+  const uint8_t* src;
+  size_t remaining;
+  uint32_t delivered = 0;
+  uint8_t buf[512];
+};
+
+static int countingReadCb(uzlib_uncomp* uncomp) {
+  auto* ctx = reinterpret_cast<CountingCtx*>(uncomp);
+  if (ctx->remaining == 0) return -1;
+
+  const size_t toRead = ctx->remaining < sizeof(ctx->buf) ? ctx->remaining : sizeof(ctx->buf);
+  memcpy(ctx->buf, ctx->src, toRead);
+  ctx->src += toRead;
+  ctx->remaining -= toRead;
+  ctx->delivered += toRead;
+
+  uncomp->source = ctx->buf + 1;
+  uncomp->source_limit = ctx->buf + toRead;
+  return ctx->buf[0];
+}
+
+// Inflate a whole stream through the callback in chunkSize pieces, reading output chunkSize at a time
+static bool inflateStreaming(const std::vector<uint8_t>& deflated, size_t chunkSize, std::string* out) {
+  CountingCtx ctx;
+  ctx.src = deflated.data();
+  ctx.remaining = deflated.size();
+  ctx.reader.init(true);
+  ctx.reader.setReadCallback(countingReadCb);
+
+  std::vector<uint8_t> chunk(chunkSize);
+  out->clear();
+  for (;;) {
+    size_t produced = 0;
+    const InflateStatus status = ctx.reader.readAtMost(chunk.data(), chunk.size(), &produced);
+    out->append(reinterpret_cast<const char*>(chunk.data()), produced);
+    if (status == InflateStatus::Done) return true;
+    if (status == InflateStatus::Error) return false;
+  }
+}
+
+// Mix of text and incompressible bytes, so streams contain stored, fixed and dynamic blocks
+static std::string makeMixedData(size_t size) {
+  std::string data = makeChapterText(size / 2);
+  uint32_t seed = 777;
+  while (data.size() < size) {
+    seed = seed * 1664525u + 1013904223u;
+    data += static_cast<char>(seed >> 24);
+    if ((seed & 0xFFF) == 0) data += makeChapterText(300);
+  }
+  return data;
+}
+
 int main() {
   TestUtils::TestRunner runner("InflateReader");
 
@@ -203,6 +294,217 @@ int main() {
                       "deinit/reinit: output matches");
   }
 
+  // ---- Checkpoints: record at block boundaries, resume from each ----
+  {
+    const std::string text = makeChapterText(600 * 1024);
+    const std::vector<uint8_t> deflated = rawDeflate(text);
+
+    struct Saved {
+      InflateCheckpoint cp;
+      std::vector<uint8_t> window;
+    };
+    std::vector<Saved> saved;
+
+    CountingCtx ctx;
+    ctx.src = deflated.data();
+    ctx.remaining = deflated.size();
+    ctx.reader.init(true);
+    ctx.reader.setReadCallback(countingReadCb);
+    ctx.reader.setStopAtBlockBoundary(true);
+
+    std::string result;
+    uint8_t chunk[1024];
+    bool error = false;
+    bool earlyCheckpointRejected = false;
+    int boundaries = 0;
+    for (;;) {
+      size_t produced = 0;
+      const InflateStatus status = ctx.reader.readAtMost(chunk, sizeof(chunk), &produced);
+      result.append(reinterpret_cast<const char*>(chunk), produced);
+      if (status != InflateStatus::Ok) {
+        error = status == InflateStatus::Error;
+        break;
+      }
+      if (!ctx.reader.atBlockBoundary()) continue;
+      boundaries++;
+
+      InflateCheckpoint cp;
+      if (result.size() < InflateReader::WINDOW_SIZE) {
+        earlyCheckpointRejected = !ctx.reader.makeCheckpoint(ctx.delivered, result.size(), &cp);
+        continue;
+      }
+      if (!saved.empty() && result.size() < saved.back().cp.outOffset + 64 * 1024) continue;
+      if (ctx.reader.makeCheckpoint(ctx.delivered, result.size(), &cp)) {
+        Saved s{cp, std::vector<uint8_t>(InflateReader::WINDOW_SIZE)};
+        const size_t split = ctx.reader.windowSplit();
+        memcpy(s.window.data(), ctx.reader.window() + split, InflateReader::WINDOW_SIZE - split);
+        memcpy(s.window.data() + InflateReader::WINDOW_SIZE - split, ctx.reader.window(), split);
+        saved.push_back(std::move(s));
+      }
+    }
+
+    runner.expectFalse(error, "checkpoints: recording pass inflates cleanly");
+    runner.expectTrue(result == text, "checkpoints: stopping at boundaries keeps output intact");
+    runner.expectTrue(boundaries > 4, "checkpoints: stream has several blocks");
+    runner.expectTrue(saved.size() >= 4, "checkpoints: recorded along the stream");
+
+    bool windowsMatch = true;
+    bool anyPendingBits = false;
+    for (const auto& s : saved) {
+      windowsMatch &= memcmp(s.window.data(), text.data() + s.cp.outOffset - InflateReader::WINDOW_SIZE,
+                             InflateReader::WINDOW_SIZE) == 0;
+      anyPendingBits |= s.cp.bitCount > 0;
+    }
+    runner.expectTrue(windowsMatch, "checkpoints: windows are the preceding output in order");
+    runner.expectTrue(anyPendingBits, "checkpoints: some start mid-byte");
+
+    // Resume each checkpoint in a fresh reader with fresh input
+    bool allResumed = true;
+    for (const auto& s : saved) {
+      CountingCtx resume;
+      resume.src = deflated.data() + s.cp.inOffset;
+      resume.remaining = deflated.size() - s.cp.inOffset;
+      resume.reader.init(true);
+      resume.reader.setReadCallback(countingReadCb);
+      memcpy(resume.reader.window(), s.window.data(), InflateReader::WINDOW_SIZE);
+      resume.reader.resumeAt(s.cp);
+
+      std::string rest;
+      InflateStatus status;
+      do {
+        size_t produced = 0;
+        status = resume.reader.readAtMost(chunk, sizeof(chunk), &produced);
+        rest.append(reinterpret_cast<const char*>(chunk), produced);
+      } while (status == InflateStatus::Ok);
+      allResumed &= status == InflateStatus::Done && rest == text.substr(s.cp.outOffset);
+    }
+    runner.expectTrue(allResumed, "checkpoints: every checkpoint resumes to the exact tail");
+
+    // Without the flag, readAtMost() only returns early at the end of the stream
+    CountingCtx plain;
+    plain.src = deflated.data();
+    plain.remaining = deflated.size();
+    plain.reader.init(true);
+    plain.reader.setReadCallback(countingReadCb);
+    int shortReads = 0;
+    InflateStatus status;
+    do {
+      size_t produced = 0;
+      status = plain.reader.readAtMost(chunk, sizeof(chunk), &produced);
+      if (status == InflateStatus::Ok && produced < sizeof(chunk)) shortReads++;
+    } while (status == InflateStatus::Ok);
+    runner.expectEq(0, shortReads, "checkpoints: no early returns unless requested");
+    runner.expectTrue(earlyCheckpointRejected, "checkpoints: refused before a full window");
+  }
+
+  // ---- zlib strategies: dynamic, fixed, RLE, stored and mixed blocks ----
+  {
+    const std::string text = makeChapterText(200 * 1024);
+    const std::string mixed = makeMixedData(200 * 1024);
+    const std::string runs(70000, 'a');
+    struct Case {
+      const char* name;
+      const std::string* data;
+      int level;
+      int strategy;
+    };
+    const Case cases[] = {
+        {"dynamic", &text, Z_BEST_COMPRESSION, Z_DEFAULT_STRATEGY},
+        {"fixed", &text, Z_DEFAULT_COMPRESSION, Z_FIXED},
+        {"rle", &text, Z_DEFAULT_COMPRESSION, Z_RLE},
+        {"huffman-only", &text, Z_DEFAULT_COMPRESSION, Z_HUFFMAN_ONLY},
+        {"stored", &text, Z_NO_COMPRESSION, Z_DEFAULT_STRATEGY},
+        {"mixed", &mixed, Z_DEFAULT_COMPRESSION, Z_DEFAULT_STRATEGY},
+        {"long runs", &runs, Z_BEST_COMPRESSION, Z_DEFAULT_STRATEGY},
+    };
+    for (const auto& c : cases) {
+      const std::vector<uint8_t> deflated = rawDeflate(*c.data, c.level, 8, c.strategy);
+      const std::string name = c.name;
+
+      std::string out;
+      const bool streamed = inflateStreaming(deflated, 1000, &out);
+      runner.expectTrue(streamed && out == *c.data, name + ": streaming output matches");
+
+      const bool tinyReads = inflateStreaming(deflated, 7, &out);
+      runner.expectTrue(tinyReads && out == *c.data, name + ": 7-byte reads match");
+
+      InflateReader r;
+      r.init(false);
+      r.setSource(deflated.data(), deflated.size());
+      std::vector<uint8_t> flat(c.data->size());
+      const bool ok = r.read(flat.data(), flat.size());
+      runner.expectTrue(ok && memcmp(flat.data(), c.data->data(), flat.size()) == 0,
+                        name + ": one-shot output matches");
+    }
+  }
+
+  // ---- Stored blocks ending in the last bytes of the input ----
+  // The bit buffer reads ahead to the end of the input, so these bytes are already buffered
+  // when the input runs out
+  {
+    const std::string data = makeMixedData(131072);
+    for (const size_t size : {1, 2, 65536, 65537, 131071, 131072}) {
+      const std::string stored = data.substr(0, size);
+      const std::vector<uint8_t> deflated = rawDeflate(stored, Z_NO_COMPRESSION, 8, Z_DEFAULT_STRATEGY);
+      const std::string name = "stored tail " + std::to_string(size);
+
+      std::string out;
+      const bool streamed = inflateStreaming(deflated, 1000, &out);
+      runner.expectTrue(streamed && out == stored, name + ": streaming output matches");
+
+      InflateReader r;
+      r.init(false);
+      r.setSource(deflated.data(), deflated.size());
+      std::vector<uint8_t> flat(stored.size());
+      const bool ok = r.read(flat.data(), flat.size());
+      runner.expectTrue(ok && memcmp(flat.data(), stored.data(), flat.size()) == 0,
+                        name + ": one-shot output matches");
+    }
+  }
+
+  // ---- Truncated input is an error, not garbage ----
+  {
+    const std::string text = makeChapterText(64 * 1024);
+    std::vector<uint8_t> deflated = rawDeflate(text, Z_BEST_COMPRESSION, 8, Z_DEFAULT_STRATEGY);
+    deflated.resize(deflated.size() / 2);
+    std::string out;
+    runner.expectFalse(inflateStreaming(deflated, 1000, &out), "truncated: streaming reports error");
+  }
+
+  // ---- Benchmark: MB/s of output, streaming through the ring buffer like ZipFile ----
+  {
+    constexpr int kRounds = 5;
+    const std::string text = makeChapterText(4 * 1024 * 1024);
+    const std::vector<uint8_t> deflated = rawDeflate(text, Z_DEFAULT_COMPRESSION, 8, Z_DEFAULT_STRATEGY);
+
+    bool allOk = true;
+    std::string out;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRounds; i++) allOk &= inflateStreaming(deflated, 4096, &out) && out == text;
+    const auto t1 = std::chrono::steady_clock::now();
+
+    std::vector<uint8_t> flat(text.size());
+    for (int i = 0; i < kRounds; i++) {
+      z_stream zs = {};
+      inflateInit2(&zs, -15);
+      zs.next_in = const_cast<Bytef*>(deflated.data());
+      zs.avail_in = deflated.size();
+      zs.next_out = flat.data();
+      zs.avail_out = flat.size();
+      inflate(&zs, Z_FINISH);
+      inflateEnd(&zs);
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    const double mb = static_cast<double>(text.size()) * kRounds / (1024.0 * 1024.0);
+    const double readerSec = std::chrono::duration<double>(t1 - t0).count();
+    const double zlibSec = std::chrono::duration<double>(t2 - t1).count();
+    printf("  InflateReader: %.1f MB/s, host zlib: %.1f MB/s (%.1f MB text, ratio %.2f)\n", mb / readerSec,
+           mb / zlibSec, text.size() / (1024.0 * 1024.0), static_cast<double>(deflated.size()) / text.size());
+    runner.expectTrue(allOk, "benchmark: output matches");
+    runner.expectTrue(readerSec > 0 && zlibSec > 0, "benchmark: both inflaters timed");
+  }
+
   runner.printSummary();
   return runner.allPassed() ? 0 : 1;
 }
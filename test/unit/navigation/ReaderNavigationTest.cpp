@@ -76,6 +76,19 @@ class ReaderNavigation {
         result.needsCacheReset = true;
         result.needsRender = true;
       }
+    } else if (type == ContentType::Txt) {
+      if (pageCount > 0 && current.sectionPage < pageCount - 1) {
+        result.position.sectionPage = current.sectionPage + 1;
+        result.needsRender = true;
+      } else if (cache && cache->isPartial()) {
+        result.position.sectionPage = current.sectionPage + 1;
+        result.needsRender = true;
+      } else if (current.spineIndex + 1 < static_cast<int>(totalPages)) {
+        result.position.spineIndex = current.spineIndex + 1;
+        result.position.sectionPage = 0;
+        result.needsCacheReset = true;
+        result.needsRender = true;
+      }
     } else {
       if (pageCount > 0 && current.sectionPage < pageCount - 1) {
         result.position.sectionPage = current.sectionPage + 1;
@@ -102,7 +115,7 @@ class ReaderNavigation {
         result.position.flatPage = current.flatPage - 1;
         result.needsRender = true;
       }
-    } else if (type == ContentType::Epub) {
+    } else if (type == ContentType::Epub || type == ContentType::Txt) {
       if (current.sectionPage > 0) {
         result.position.sectionPage = current.sectionPage - 1;
         result.needsRender = true;
@@ -384,5 +397,40 @@ int main() {
     runner.expectTrue(result.needsRender, "TXT partial: needsRender is true");
   }
 
+  // Test 23: TXT next() - moves to the next section at the end of a complete one
+  {
+    PageCache cache(20, false);
+    ReaderNavigation::Position pos;
+    pos.spineIndex = 2;
+    pos.sectionPage = 19;
+    auto result = ReaderNavigation::next(ContentType::Txt, pos, &cache, 5);
+    runner.expectEq(3, result.position.spineIndex, "TXT sections: next moves to section 3");
+    runner.expectEq(0, result.position.sectionPage, "TXT sections: next starts at page 0");
+    runner.expectTrue(result.needsCacheReset, "TXT sections: needsCacheReset is true");
+  }
+
+  // Test 24: TXT next() - stays at the end of the last section
+  {
+    PageCache cache(20, false);
+    ReaderNavigation::Position pos;
+    pos.spineIndex = 4;
+    pos.sectionPage = 19;
+    auto result = ReaderNavigation::next(ContentType::Txt, pos, &cache, 5);
+    runner.expectEq(4, result.position.spineIndex, "TXT sections: stays in last section");
+    runner.expectFalse(result.needsRender, "TXT sections: needsRender is false at end");
+  }
+
+  // Test 25: TXT prev() - goes to the last page of the previous section
+  {
+    PageCache cache(20, false);
+    ReaderNavigation::Position pos;
+    pos.spineIndex = 3;
+    pos.sectionPage = 0;
+    auto result = ReaderNavigation::prev(ContentType::Txt, pos, &cache);
+    runner.expectEq(2, result.position.spineIndex, "TXT sections: prev moves to section 2");
+    runner.expectEq(INT16_MAX, result.position.sectionPage, "TXT sections: prev targets the last page");
+    runner.expectTrue(result.needsCacheReset, "TXT sections: prev needsCacheReset is true");
+  }
+
   return runner.allPassed() ? 0 : 1;
 }
@@ -118,5 +118,32 @@ int main() {
   runner.expectFalse(ScriptDetector::isThaiCodepoint(0x0DFF), "isThai: U+0DFF before");
   runner.expectFalse(ScriptDetector::isThaiCodepoint(0x0E80), "isThai: U+0E80 after");
 
+  // ============================================
+  // scanScripts() tests
+  // ============================================
+
+  // Test 23: no special scripts
+  runner.expectEq(0, static_cast<int>(ScriptDetector::scanScripts(nullptr)), "scanScripts: nullptr");
+  runner.expectEq(0, static_cast<int>(ScriptDetector::scanScripts("")), "scanScripts: empty string");
+  runner.expectEq(0, static_cast<int>(ScriptDetector::scanScripts("Hello, world")), "scanScripts: ASCII only");
+  runner.expectEq(0, static_cast<int>(ScriptDetector::scanScripts("caf\xC3\xA9 \xD0\x9C\xD0\xB8\xD1\x80")),
+                  "scanScripts: Latin-1 and Cyrillic");
+
+  // Test 24: each script, alone and after ASCII
+  runner.expectEq(static_cast<int>(ScriptDetector::HAS_ARABIC),
+                  static_cast<int>(ScriptDetector::scanScripts("abc\xD8\xA8")), "scanScripts: Arabic");
+  runner.expectEq(static_cast<int>(ScriptDetector::HAS_THAI),
+                  static_cast<int>(ScriptDetector::scanScripts("\xE0\xB8\x81")), "scanScripts: Thai");
+  runner.expectEq(static_cast<int>(ScriptDetector::HAS_CJK),
+                  static_cast<int>(ScriptDetector::scanScripts("x\xE4\xB8\xAD")), "scanScripts: CJK");
+
+  // Test 25: mixed scripts set every flag, and agree with the contains*() functions
+  const char* mixed = "\xE0\xB8\x81 \xD8\xA8 \xE4\xB8\xAD";
+  runner.expectEq(static_cast<int>(ScriptDetector::HAS_ARABIC | ScriptDetector::HAS_THAI | ScriptDetector::HAS_CJK),
+                  static_cast<int>(ScriptDetector::scanScripts(mixed)), "scanScripts: Thai, Arabic and CJK");
+  runner.expectTrue(ScriptDetector::containsArabic(mixed) && ScriptDetector::containsThai(mixed) &&
+                        ScriptDetector::containsCjk(mixed),
+                    "scanScripts: contains*() agree on mixed text");
+
   return runner.allPassed() ? 0 : 1;
 }
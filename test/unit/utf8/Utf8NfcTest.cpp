@@ -249,5 +249,59 @@ int main() {
     runner.expectEqual(expected, std::string(buf.data(), len), "Heap path: 300+ codepoints with NFC at end");
   }
 
+  // ============================================
+  // Vietnamese sentence (NFD, as Vietnamese books often are)
+  // ============================================
+
+  {
+    // "Tiếng Việt có dấu" with every tone and vowel mark decomposed
+    std::string input = "Tie\xCC\x82\xCC\x81ng Vie\xCC\xA3\xCC\x82t co\xCC\x81 da\xCC\x82\xCC\x81u";
+    std::vector<char> buf(input.begin(), input.end());
+    buf.push_back('\0');
+    size_t len = utf8NormalizeNfc(buf.data(), input.size());
+    runner.expectEqual("Ti\xE1\xBA\xBFng Vi\xE1\xBB\x87t c\xC3\xB3 d\xE1\xBA\xA5u", std::string(buf.data(), len),
+                       "Vietnamese sentence: NFD → NFC");
+  }
+
+  // ============================================
+  // Quick check: text with nothing that composes is left alone
+  // ============================================
+
+  {
+    // Precomposed Cyrillic, Greek and Latin: no combining marks
+    char buf[] = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xCE\xB1\xCE\xB2 na\xC3\xAFve";
+    const std::string before(buf);
+    size_t len = utf8NormalizeNfc(buf, before.size());
+    runner.expectEqual(before, std::string(buf, len), "Quick check: precomposed text unchanged");
+  }
+
+  runner.expectTrue(mayCompose(0x0301), "Quick check: combining acute may compose");
+  runner.expectTrue(mayCompose(0x0345), "Quick check: ypogegrammeni may compose");
+  runner.expectFalse(mayCompose('e'), "Quick check: base letter does not");
+  runner.expectFalse(mayCompose(0x00E9), "Quick check: precomposed letter does not");
+  runner.expectFalse(mayCompose(0x20D0), "Quick check: combining mark outside the table does not");
+  runner.expectFalse(mayCompose(0x1F600), "Quick check: non-BMP does not");
+
+  // ============================================
+  // Perfect hash: every composition is found, nothing else is
+  // ============================================
+
+  {
+    size_t entries = 0;
+    bool allFound = true;
+    bool allFlagged = true;
+    for (const auto& entry : NFC_HASH_TABLE) {
+      if (entry.base == 0) continue;
+      entries++;
+      if (lookupComposition(entry.base, entry.combining) != entry.result) allFound = false;
+      if (!mayCompose(entry.combining)) allFlagged = false;
+    }
+    runner.expectEq(NFC_TABLE_SIZE, entries, "Perfect hash: holds every composition");
+    runner.expectTrue(allFound, "Perfect hash: every composition found");
+    runner.expectTrue(allFlagged, "Quick check: flags every combining mark in the table");
+    runner.expectEq(static_cast<uint32_t>(0), lookupComposition('x', 0x0301), "Perfect hash: x+acute not found");
+    runner.expectEq(static_cast<uint32_t>(0), lookupComposition(0x0301, 'e'), "Perfect hash: reversed pair not found");
+  }
+
   return runner.allPassed() ? 0 : 1;
 }
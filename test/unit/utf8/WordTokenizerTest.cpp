@@ -0,0 +1,126 @@
+#include "test_utils.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "WordTokenizer.h"
+
+namespace {
+
+// Tokens as strings, newlines as "\n"
+std::vector<std::string> tokenize(const std::string& text, const size_t maxWordLength = 100) {
+  std::vector<std::string> out;
+  WordTokenizer words(text.data(), text.size(), maxWordLength);
+  WordTokenizer::Token token;
+  while (words.next(token)) {
+    out.push_back(token.kind == WordTokenizer::Kind::NEWLINE ? "\n" : std::string(token.text, token.length));
+  }
+  return out;
+}
+
+std::string join(const std::vector<std::string>& tokens) {
+  std::string out;
+  for (const auto& t : tokens) {
+    if (!out.empty()) out += '|';
+    out += t;
+  }
+  return out;
+}
+
+// The byte-at-a-time split the parsers used before the tokenizer
+std::vector<std::string> referenceSplit(const std::string& text) {
+  std::vector<std::string> out;
+  std::string word;
+  for (const char c : text) {
+    if (c == ' ' || c == '\r' || c == '\n' || c == '\t') {
+      if (!word.empty()) out.push_back(word);
+      word.clear();
+      if (c == '\n') out.push_back("\n");
+    } else {
+      word += c;
+    }
+  }
+  if (!word.empty()) out.push_back(word);
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  TestUtils::TestRunner runner("WordTokenizer");
+
+  // ============================================
+  // Splitting
+  // ============================================
+
+  runner.expectEqual("The|quick|brown|fox", join(tokenize("The quick brown fox")), "Words split on spaces");
+  runner.expectEqual("a|b|c|d", join(tokenize("  a\tb\r c   d  ")), "Runs of spaces, tabs and CRs are skipped");
+  runner.expectEqual("one|\n|\n|two", join(tokenize("one\n\ntwo")), "Each LF is a token");
+  runner.expectEqual("", join(tokenize("")), "Empty buffer gives no tokens");
+  runner.expectEqual("", join(tokenize("   \t ")), "Whitespace only gives no tokens");
+  runner.expectEqual("extraordinarily|long-winded", join(tokenize("extraordinarily long-winded")),
+                     "Words longer than a machine word");
+  runner.expectEqual("x\x01y", join(tokenize("x\x01y")), "Control bytes other than whitespace stay in the word");
+
+  {
+    // Delimiters at every offset within a machine word
+    bool allMatch = true;
+    for (size_t pad = 0; pad < 16; pad++) {
+      const std::string text = std::string(pad, 'w') + " word\tand\r\nmore " + std::string(17 - pad, 'z');
+      if (tokenize(text) != referenceSplit(text)) allMatch = false;
+    }
+    runner.expectTrue(allMatch, "Matches byte-at-a-time split at every alignment");
+  }
+
+  // ============================================
+  // Flags
+  // ============================================
+
+  {
+    const std::string text = "plain caf\xC3\xA9 longerasciiword na\xC3\xAFvet\xC3\xA9s";
+    WordTokenizer words(text.data(), text.size(), 100);
+    WordTokenizer::Token token;
+    std::vector<bool> ascii;
+    while (words.next(token)) ascii.push_back(token.ascii);
+    runner.expectTrue(ascii.size() == 4 && ascii[0] && !ascii[1] && ascii[2] && !ascii[3],
+                      "ASCII flag per word");
+  }
+
+  {
+    const std::string text = "first second";
+    WordTokenizer words(text.data(), text.size(), 100);
+    WordTokenizer::Token token;
+    words.next(token);
+    runner.expectFalse(token.cut, "Word followed by a space is not cut");
+    words.next(token);
+    runner.expectTrue(token.cut, "Word at the end of the buffer is cut");
+    runner.expectEq(text.size(), words.consumed(text.data()), "Whole buffer consumed");
+  }
+
+  {
+    const std::string text = "tail\n";
+    WordTokenizer words(text.data(), text.size(), 100);
+    WordTokenizer::Token token;
+    words.next(token);
+    runner.expectFalse(token.cut, "Word followed by a newline is not cut");
+    runner.expectEq(static_cast<size_t>(4), words.consumed(text.data()), "Newline is left for the next call");
+  }
+
+  // ============================================
+  // Long words
+  // ============================================
+
+  runner.expectEqual("abcd|efgh|ij", join(tokenize("abcdefghij", 4)), "Long runs split at the maximum length");
+
+  {
+    // "ééééé" (2 bytes each): a 5-byte limit would fall inside the third character
+    const std::string text = "\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9\xC3\xA9";
+    const auto pieces = tokenize(text, 5);
+    runner.expectTrue(pieces.size() == 3 && pieces[0] == "\xC3\xA9\xC3\xA9" && pieces[1] == "\xC3\xA9\xC3\xA9" &&
+                          pieces[2] == "\xC3\xA9",
+                      "Long runs split at a character boundary");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
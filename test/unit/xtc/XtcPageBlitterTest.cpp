@@ -0,0 +1,206 @@
+#include "test_utils.h"
+
+#include <EInkDisplay.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "XtcPageBlitter.h"
+
+using papyrix::XtcPageBlitter;
+
+constexpr int W = EInkDisplay::DISPLAY_WIDTH;   // 800
+constexpr int H = EInkDisplay::DISPLAY_HEIGHT;  // 480
+
+enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
+
+// Mirrors rotateCoordinates() in GfxRenderer.cpp
+static void rotate(Orientation o, int x, int y, int* rx, int* ry) {
+  switch (o) {
+    case Portrait:
+      *rx = y;
+      *ry = H - 1 - x;
+      break;
+    case LandscapeClockwise:
+      *rx = W - 1 - x;
+      *ry = H - 1 - y;
+      break;
+    case PortraitInverted:
+      *rx = W - 1 - y;
+      *ry = x;
+      break;
+    case LandscapeCounterClockwise:
+      *rx = x;
+      *ry = y;
+      break;
+  }
+}
+
+// Mirrors transformFor() in XtcPageRenderer.cpp
+static XtcPageBlitter::Transform transformFor(Orientation o) {
+  switch (o) {
+    case Portrait:
+      return {0, 1, 0, -1, 0, H - 1};
+    case LandscapeClockwise:
+      return {-1, 0, W - 1, 0, -1, H - 1};
+    case PortraitInverted:
+      return {0, -1, W - 1, 1, 0, 0};
+    case LandscapeCounterClockwise:
+    default:
+      return {1, 0, 0, 0, 1, 0};
+  }
+}
+
+static int screenWidth(Orientation o) { return (o == Portrait || o == PortraitInverted) ? H : W; }
+static int screenHeight(Orientation o) { return (o == Portrait || o == PortraitInverted) ? W : H; }
+
+// Reference: per-pixel drawPixel() into the frame buffer, as the renderer used to do
+static void drawPixel(std::vector<uint8_t>& fb, Orientation o, int x, int y, bool state) {
+  if (x < 0 || y < 0 || x >= screenWidth(o) || y >= screenHeight(o)) return;
+  int rx, ry;
+  rotate(o, x, y, &rx, &ry);
+  const size_t idx = ry * EInkDisplay::DISPLAY_WIDTH_BYTES + rx / 8;
+  const uint8_t bit = 1 << (7 - rx % 8);
+  if (state) {
+    fb[idx] &= ~bit;
+  } else {
+    fb[idx] |= bit;
+  }
+}
+
+static std::vector<uint8_t> makeData(size_t size, uint32_t seed) {
+  std::vector<uint8_t> data(size);
+  for (auto& b : data) {
+    seed = seed * 1103515245u + 12345u;
+    // Mix of solid and noisy bytes hits both the skip and bit paths
+    const uint8_t r = seed >> 24;
+    b = (r < 40) ? 0x00 : (r < 80) ? 0xFF : r;
+  }
+  return data;
+}
+
+// Feed data through the blitter in chunks of chunkSize, matching loadPageStreaming()
+template <typename Fn>
+static void feed(const std::vector<uint8_t>& data, size_t chunkSize, Fn&& fn) {
+  for (size_t off = 0; off < data.size(); off += chunkSize) {
+    const size_t n = std::min(chunkSize, data.size() - off);
+    fn(&data[off], n, off);
+  }
+}
+
+// 2-bit pixel value from the XTCH planes (same as the old getPixelValue lambda)
+static uint8_t pixel2bit(const std::vector<uint8_t>& data, int pw, int ph, int x, int y) {
+  const size_t planeSize = (static_cast<size_t>(pw) * ph + 7) / 8;
+  const size_t colBytes = (ph + 7) / 8;
+  const size_t byteOffset = (pw - 1 - x) * colBytes + y / 8;
+  const int bitInByte = 7 - (y % 8);
+  const uint8_t bit1 = (data[byteOffset] >> bitInByte) & 1;
+  const uint8_t bit2 = (data[planeSize + byteOffset] >> bitInByte) & 1;
+  return (bit1 << 1) | bit2;
+}
+
+static bool check1Bit(Orientation o, int pw, int ph, size_t chunkSize) {
+  const auto data = makeData(static_cast<size_t>((pw + 7) / 8) * ph, pw * 31 + ph);
+  std::vector<uint8_t> expected(EInkDisplay::BUFFER_SIZE, 0xFF);
+  std::vector<uint8_t> actual(EInkDisplay::BUFFER_SIZE, 0xFF);
+
+  XtcPageBlitter blitter(actual.data(), transformFor(o), screenWidth(o), screenHeight(o), pw, ph);
+  feed(data, chunkSize, [&](const uint8_t* d, size_t n, size_t off) {
+    blitter.blitRowMajorChunk(d, n, off, XtcPageBlitter::Op::Black);
+  });
+
+  const size_t rowBytes = (pw + 7) / 8;
+  for (int y = 0; y < ph; y++) {
+    for (int x = 0; x < pw; x++) {
+      if (!((data[y * rowBytes + x / 8] >> (7 - x % 8)) & 1)) {
+        drawPixel(expected, o, x + blitter.offsetX(), y + blitter.offsetY(), true);
+      }
+    }
+  }
+  return expected == actual;
+}
+
+// pass: 0 = BW, 1 = LSB (value 1), 2 = MSB (value 1 or 2)
+static bool check2Bit(Orientation o, int pw, int ph, int pass, size_t chunkSize) {
+  const size_t planeSize = (static_cast<size_t>(pw) * ph + 7) / 8;
+  const auto data = makeData(planeSize * 2, pw * 17 + ph + pass);
+  const uint8_t clearColor = pass == 0 ? 0xFF : 0x00;
+  std::vector<uint8_t> expected(EInkDisplay::BUFFER_SIZE, clearColor);
+  std::vector<uint8_t> actual(EInkDisplay::BUFFER_SIZE, clearColor);
+
+  using Op = XtcPageBlitter::Op;
+  const Op ops[3][2] = {{Op::Black, Op::Black}, {Op::Mark, Op::MarkIfClear}, {Op::Mark, Op::Toggle}};
+  XtcPageBlitter blitter(actual.data(), transformFor(o), screenWidth(o), screenHeight(o), pw, ph);
+  feed(data, chunkSize, [&](const uint8_t* d, size_t n, size_t off) {
+    blitter.blitColumnMajorChunk(d, n, off, ops[pass][0], ops[pass][1]);
+  });
+
+  for (int y = 0; y < ph; y++) {
+    for (int x = 0; x < pw; x++) {
+      const uint8_t v = pixel2bit(data, pw, ph, x, y);
+      const int sx = x + blitter.offsetX();
+      const int sy = y + blitter.offsetY();
+      if (pass == 0 && v >= 1) drawPixel(expected, o, sx, sy, true);
+      if (pass == 1 && v == 1) drawPixel(expected, o, sx, sy, false);
+      if (pass == 2 && (v == 1 || v == 2)) drawPixel(expected, o, sx, sy, false);
+    }
+  }
+  return expected == actual;
+}
+
+int main() {
+  TestUtils::TestRunner runner("XtcPageBlitter");
+  const Orientation orientations[] = {Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise};
+  const char* names[] = {"portrait", "landscape_cw", "portrait_inverted", "landscape_ccw"};
+
+  // Test 1: Full-screen 1-bit pages match per-pixel drawing in every orientation
+  for (int i = 0; i < 4; i++) {
+    const Orientation o = orientations[i];
+    runner.expectTrue(check1Bit(o, screenWidth(o), screenHeight(o), 4096),
+                      (std::string("1bit_fullscreen_") + names[i]).c_str());
+  }
+
+  // Test 2: Full-screen 2-bit pages, all three plane combinations
+  for (int i = 0; i < 4; i++) {
+    const Orientation o = orientations[i];
+    for (int pass = 0; pass < 3; pass++) {
+      runner.expectTrue(check2Bit(o, screenWidth(o), screenHeight(o), pass, 4096),
+                        (std::string("2bit_fullscreen_") + names[i] + "_pass" + std::to_string(pass)).c_str());
+    }
+  }
+
+  // Test 3: Smaller odd-sized pages are centered (unaligned, partial bytes, odd chunk sizes)
+  // XTH columns only tile the plane exactly when the height is a multiple of 8, so 2-bit
+  // pages keep an aligned height and vary the width instead
+  for (int i = 0; i < 4; i++) {
+    const Orientation o = orientations[i];
+    runner.expectTrue(check1Bit(o, 301, 157, 333), (std::string("1bit_centered_") + names[i]).c_str());
+    for (int pass = 0; pass < 3; pass++) {
+      runner.expectTrue(check2Bit(o, 123, 224, pass, 1000),
+                        (std::string("2bit_centered_") + names[i] + "_pass" + std::to_string(pass)).c_str());
+    }
+  }
+
+  // Test 4: Pages larger than the screen are clipped without touching memory outside the buffer
+  for (int i = 0; i < 4; i++) {
+    const Orientation o = orientations[i];
+    runner.expectTrue(check1Bit(o, 900, 900, 4096), (std::string("1bit_clipped_") + names[i]).c_str());
+    runner.expectTrue(check2Bit(o, 900, 904, 1, 4096), (std::string("2bit_clipped_") + names[i]).c_str());
+  }
+
+  // Test 5: Centering offsets
+  {
+    std::vector<uint8_t> fb(EInkDisplay::BUFFER_SIZE, 0xFF);
+    XtcPageBlitter blitter(fb.data(), transformFor(Portrait), 480, 800, 400, 700);
+    runner.expectEq(40, blitter.offsetX(), "center_offset_x");
+    runner.expectEq(50, blitter.offsetY(), "center_offset_y");
+    XtcPageBlitter big(fb.data(), transformFor(Portrait), 480, 800, 600, 900);
+    runner.expectEq(0, big.offsetX(), "oversized_offset_x");
+    runner.expectEq(0, big.offsetY(), "oversized_offset_y");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
@@ -0,0 +1,264 @@
+#include "test_utils.h"
+
+#include <SDCardManager.h>
+#include <SdFat.h>
+#include <Xtc/XtcParser.h>
+#include <Xtc/XtcTypes.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Helper: build a multi-page XTC/XTCH file in memory, page i filled from seed i
+static std::string buildXtcFile(uint8_t bitDepth, uint16_t width, uint16_t height, uint16_t pageCount,
+                                std::vector<std::vector<uint8_t>>& pages) {
+  constexpr size_t headerSize = sizeof(xtc::XtcHeader);
+  constexpr size_t pageTableOffset = headerSize + 128 + 64;
+  const size_t bitmapSize = bitDepth == 2 ? ((static_cast<size_t>(width) * height + 7) / 8) * 2
+                                          : static_cast<size_t>((width + 7) / 8) * height;
+  const size_t pageDataSize = sizeof(xtc::XtgPageHeader) + bitmapSize;
+  const size_t dataOffset = pageTableOffset + pageCount * sizeof(xtc::PageTableEntry);
+
+  std::string buf(dataOffset + pageCount * pageDataSize, '\0');
+  auto* data = reinterpret_cast<uint8_t*>(&buf[0]);
+
+  auto* hdr = reinterpret_cast<xtc::XtcHeader*>(data);
+  hdr->magic = bitDepth == 2 ? xtc::XTCH_MAGIC : xtc::XTC_MAGIC;
+  hdr->versionMajor = 1;
+  hdr->pageCount = pageCount;
+  hdr->headerSize = 88;
+  hdr->pageTableOffset = pageTableOffset;
+  hdr->dataOffset = dataOffset;
+  hdr->titleOffset = headerSize;
+
+  pages.assign(pageCount, std::vector<uint8_t>(bitmapSize));
+  for (uint16_t i = 0; i < pageCount; i++) {
+    const size_t pageOffset = dataOffset + i * pageDataSize;
+    auto* pte = reinterpret_cast<xtc::PageTableEntry*>(data + pageTableOffset) + i;
+    pte->dataOffset = pageOffset;
+    pte->dataSize = static_cast<uint32_t>(pageDataSize);
+    pte->width = width;
+    pte->height = height;
+
+    auto* pageHdr = reinterpret_cast<xtc::XtgPageHeader*>(data + pageOffset);
+    pageHdr->magic = bitDepth == 2 ? xtc::XTH_MAGIC : xtc::XTG_MAGIC;
+    pageHdr->width = width;
+    pageHdr->height = height;
+    pageHdr->dataSize = static_cast<uint32_t>(bitmapSize);
+
+    uint32_t seed = 1000u + i;
+    for (auto& b : pages[i]) {
+      seed = seed * 1103515245u + 12345u;
+      b = static_cast<uint8_t>(seed >> 24);
+    }
+    memcpy(data + pageOffset + sizeof(xtc::XtgPageHeader), pages[i].data(), bitmapSize);
+  }
+  return buf;
+}
+
+// Stream a page and reassemble it, checking chunk offsets are contiguous
+static bool streamPage(xtc::XtcParser& parser, uint32_t page, size_t chunkSize, std::vector<uint8_t>& out) {
+  out.clear();
+  bool contiguous = true;
+  const auto err = parser.loadPageStreaming(
+      page,
+      [&](const uint8_t* data, size_t size, size_t offset) {
+        if (offset != out.size() || size > chunkSize) contiguous = false;
+        out.insert(out.end(), data, data + size);
+      },
+      chunkSize);
+  return err == xtc::XtcError::OK && contiguous;
+}
+
+int main() {
+  TestUtils::TestRunner runner("XtcParser");
+
+  // Test 1: Page table with more entries than one read batch
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    const std::string file = buildXtcFile(1, 64, 40, 70, pages);
+    SdMan.registerFile("/book.xtc", file);
+
+    xtc::XtcParser parser;
+    runner.expectTrue(parser.open("/book.xtc") == xtc::XtcError::OK, "table: opens");
+    runner.expectEq(static_cast<uint16_t>(70), parser.getPageCount(), "table: page count");
+
+    bool offsetsOk = true;
+    const size_t pageDataSize = sizeof(xtc::XtgPageHeader) + 8 * 40;
+    for (uint32_t i = 0; i < 70; i++) {
+      xtc::PageInfo info;
+      const auto* pte = reinterpret_cast<const xtc::PageTableEntry*>(file.data() + 248) + i;
+      if (!parser.getPageInfo(i, info) || info.offset != pte->dataOffset || info.size != pageDataSize ||
+          info.width != 64 || info.height != 40 || info.bitDepth != 1) {
+        offsetsOk = false;
+      }
+    }
+    runner.expectTrue(offsetsOk, "table: every entry matches the file");
+    xtc::PageInfo info;
+    runner.expectFalse(parser.getPageInfo(70, info), "table: out of range rejected");
+
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 69, 100, out) && out == pages[69], "table: last page streams");
+    std::vector<uint8_t> loaded(320);
+    runner.expectEq(static_cast<size_t>(320), parser.loadPage(33, loaded.data(), loaded.size()), "table: loadPage");
+    runner.expectTrue(loaded == pages[33], "table: loadPage data");
+  }
+
+  // Test 2: Read-ahead buffer smaller than the page serves the head from RAM and the rest from file
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    SdMan.registerFile("/book.xtc", buildXtcFile(1, 480, 100, 6, pages));
+
+    xtc::XtcParser parser;
+    parser.open("/book.xtc");
+    std::vector<uint8_t> buf(1000);
+    parser.setReadAheadBuffer(buf.data(), buf.size());
+    runner.expectTrue(parser.readAhead(3), "partial: readAhead succeeds");
+    runner.expectTrue(memcmp(buf.data(), pages[3].data(), buf.size()) == 0, "partial: buffer holds page head");
+
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 3, 333, out) && out == pages[3], "partial: streamed page intact");
+
+    // Other pages move the file position; the buffered page must still come out right
+    runner.expectTrue(streamPage(parser, 4, 4096, out) && out == pages[4], "partial: unbuffered page intact");
+    runner.expectTrue(streamPage(parser, 3, 4096, out) && out == pages[3], "partial: buffer reused across passes");
+
+    // Proves the head really comes from RAM: tampering with the buffer shows up in the output
+    buf[10] ^= 0xFF;
+    streamPage(parser, 3, 4096, out);
+    runner.expectTrue(out[10] != pages[3][10] && out[1000] == pages[3][1000], "partial: head served from buffer");
+  }
+
+  // Test 3: Read-ahead buffer larger than the page (2-bit) needs no file access at all
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    SdMan.registerFile("/book.xtch", buildXtcFile(2, 40, 32, 3, pages));
+
+    xtc::XtcParser parser;
+    parser.open("/book.xtch");
+    std::vector<uint8_t> buf(4096);
+    parser.setReadAheadBuffer(buf.data(), buf.size());
+    runner.expectTrue(parser.readAhead(2), "whole: readAhead succeeds");
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 2, 64, out) && out == pages[2], "whole: 2-bit page intact");
+    runner.expectTrue(streamPage(parser, 1, 64, out) && out == pages[1], "whole: other page intact");
+  }
+
+  // Test 4: Invalid read-ahead requests
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    SdMan.registerFile("/book.xtc", buildXtcFile(1, 16, 8, 2, pages));
+
+    xtc::XtcParser parser;
+    parser.open("/book.xtc");
+    runner.expectFalse(parser.readAhead(0), "invalid: no buffer attached");
+    std::vector<uint8_t> buf(64);
+    parser.setReadAheadBuffer(buf.data(), buf.size());
+    runner.expectFalse(parser.readAhead(2), "invalid: page out of range");
+    runner.expectTrue(parser.readAhead(1), "invalid: valid page still works");
+
+    // Detaching the buffer drops the buffered page
+    parser.setReadAheadBuffer(nullptr, 0);
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 1, 1024, out) && out == pages[1], "invalid: detached buffer reads file");
+  }
+
+  // Test 5: Reopening a file drops read-ahead state from the previous book
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> first;
+    std::vector<std::vector<uint8_t>> second;
+    SdMan.registerFile("/a.xtc", buildXtcFile(1, 16, 8, 2, first));
+    std::string other = buildXtcFile(1, 16, 8, 2, second);
+    // Same layout, different content
+    for (size_t i = other.size() - 16; i < other.size(); i++) other[i] = static_cast<char>(~other[i]);
+    second[1].assign(other.end() - 16, other.end());
+    SdMan.registerFile("/b.xtc", other);
+
+    xtc::XtcParser parser;
+    std::vector<uint8_t> buf(64);
+    parser.open("/a.xtc");
+    parser.setReadAheadBuffer(buf.data(), buf.size());
+    parser.readAhead(1);
+    parser.open("/b.xtc");
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 1, 1024, out) && out == second[1], "reopen: stale read-ahead dropped");
+  }
+
+  // Test 6: With chapters, 0x30 holds the chapter offset and the title stays at 0x38
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    std::string file = buildXtcFile(1, 16, 8, 3, pages);
+    auto* hdr = reinterpret_cast<xtc::XtcHeader*>(&file[0]);
+    const size_t chapterOffset = hdr->pageTableOffset;
+    const size_t pageTableOffset = chapterOffset + 96;
+    const size_t shift = 96;
+    // Make room for one chapter record in front of the page table
+    file.insert(chapterOffset, std::string(shift, '\0'));
+    hdr = reinterpret_cast<xtc::XtcHeader*>(&file[0]);
+    hdr->flags = 1u << 24;
+    hdr->pageTableOffset = pageTableOffset;
+    hdr->dataOffset += shift;
+    const uint64_t chapterOffset64 = chapterOffset;
+    memcpy(&file[0x30], &chapterOffset64, sizeof(chapterOffset64));
+    for (uint16_t i = 0; i < 3; i++) {
+      auto* pte = reinterpret_cast<xtc::PageTableEntry*>(&file[pageTableOffset]) + i;
+      pte->dataOffset += shift;
+    }
+    memcpy(&file[0x38], "Book Title", 10);
+    memcpy(&file[chapterOffset], "Chapter One", 11);
+    const uint16_t startPage = 1;
+    const uint16_t endPage = 3;
+    memcpy(&file[chapterOffset + 0x50], &startPage, sizeof(startPage));
+    memcpy(&file[chapterOffset + 0x52], &endPage, sizeof(endPage));
+    SdMan.registerFile("/chapters.xtc", file);
+
+    xtc::XtcParser parser;
+    runner.expectTrue(parser.open("/chapters.xtc") == xtc::XtcError::OK, "chapters: opens");
+    runner.expectEq(std::string("Book Title"), parser.getTitle(), "chapters: title read from 0x38");
+    runner.expectTrue(parser.hasChapters() && parser.getChapters().size() == 1, "chapters: one chapter");
+    if (!parser.getChapters().empty()) {
+      runner.expectEq(std::string("Chapter One"), parser.getChapters()[0].name, "chapters: name");
+      runner.expectEq(static_cast<uint16_t>(2), parser.getChapters()[0].endPage, "chapters: end page");
+    }
+    std::vector<uint8_t> out;
+    runner.expectTrue(streamPage(parser, 2, 1024, out) && out == pages[2], "chapters: page data intact");
+  }
+
+  // Test 7: A page pass reads header and planes in one sweep: one read per chunk, header included
+  {
+    SdMan.clearFiles();
+    std::vector<std::vector<uint8_t>> pages;
+    SdMan.registerFile("/book.xtch", buildXtcFile(2, 64, 48, 3, pages));  // 768-byte bitmap
+
+    xtc::XtcParser parser;
+    parser.open("/book.xtch");
+    std::vector<uint8_t> out;
+    FsFile::bulkReads = 0;
+    runner.expectTrue(streamPage(parser, 1, 1024, out) && out == pages[1], "sweep: whole page intact");
+    runner.expectEq(static_cast<size_t>(1), FsFile::bulkReads, "sweep: page in a single read");
+
+    FsFile::bulkReads = 0;
+    runner.expectTrue(streamPage(parser, 2, 256, out) && out == pages[2], "sweep: chunked page intact");
+    runner.expectEq(static_cast<size_t>(3), FsFile::bulkReads, "sweep: header shares the first chunk's read");
+
+    // A page smaller than the table's dimensions stops at its own end
+    std::string file = buildXtcFile(2, 64, 48, 2, pages);
+    const auto* hdr = reinterpret_cast<const xtc::XtcHeader*>(file.data());
+    const auto* pte = reinterpret_cast<const xtc::PageTableEntry*>(file.data() + hdr->pageTableOffset);
+    reinterpret_cast<xtc::XtgPageHeader*>(&file[pte->dataOffset])->height = 24;
+    SdMan.registerFile("/small.xtch", file);
+    parser.open("/small.xtch");
+    runner.expectTrue(streamPage(parser, 0, 1024, out) && out.size() == 384 &&
+                          std::equal(out.begin(), out.end(), pages[0].begin()),
+                      "sweep: page smaller than the table's size");
+  }
+
+  return runner.allPassed() ? 0 : 1;
+}
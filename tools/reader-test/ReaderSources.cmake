@@ -0,0 +1,119 @@
+# Source lists for the host builds of the reader pipeline. Included by tools/reader-test/CMakeLists.txt
+# and test/bench/CMakeLists.txt, so every path is absolute.
+
+set(READER_TEST_DIR ${CMAKE_CURRENT_LIST_DIR})
+get_filename_component(PROJECT_ROOT ${CMAKE_CURRENT_LIST_DIR}/../.. ABSOLUTE)
+
+# Parsers and layout, shared by reader-test, xtc-convert and the pipeline benchmark (test/bench)
+set(READER_SOURCES
+  ${READER_TEST_DIR}/device_settings.cpp
+  ${READER_TEST_DIR}/mocks/platform_stubs.cpp
+
+  # Content handlers
+  ${PROJECT_ROOT}/lib/Txt/src/Txt.cpp
+  ${PROJECT_ROOT}/lib/Markdown/src/Markdown.cpp
+  ${PROJECT_ROOT}/lib/Fb2/src/Fb2.cpp
+  ${PROJECT_ROOT}/lib/Fb2/src/Fb2Image.cpp
+  ${PROJECT_ROOT}/lib/Fb2/src/Fb2Index.cpp
+  ${PROJECT_ROOT}/lib/Fb2/src/Fb2Parser.cpp
+
+  # Text layout
+  ${PROJECT_ROOT}/lib/RenderTypes/src/ParsedText.cpp
+  ${PROJECT_ROOT}/lib/RenderTypes/src/blocks/TextBlock.cpp
+  ${PROJECT_ROOT}/lib/RenderTypes/src/blocks/ImageBlock.cpp
+  ${PROJECT_ROOT}/lib/RenderTypes/src/Page.cpp
+
+  # Arabic and Thai shaping (words are shaped at layout and cached)
+  ${PROJECT_ROOT}/lib/ArabicShaper/src/ArabicShaper.cpp
+  ${PROJECT_ROOT}/lib/ArabicShaper/src/ArabicCharacter.cpp
+  ${PROJECT_ROOT}/lib/ThaiShaper/src/ThaiCharacter.cpp
+  ${PROJECT_ROOT}/lib/ThaiShaper/src/ThaiClusterBuilder.cpp
+
+  # TXT + Markdown parsers
+  ${PROJECT_ROOT}/lib/PageCache/src/PlainTextParser.cpp
+  ${PROJECT_ROOT}/lib/Markdown/src/MarkdownParser.cpp
+  ${PROJECT_ROOT}/lib/Markdown/src/md_parser.c
+
+  # EPUB chain
+  ${PROJECT_ROOT}/lib/Epub/src/Epub.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/BookMetadataCache.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/parsers/ChapterHtmlSlimParser.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/parsers/ContainerParser.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/parsers/ContentOpfParser.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/parsers/TocNcxParser.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/parsers/TocNavParser.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/htmlEntities.cpp
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/css/CssParser.cpp
+  ${PROJECT_ROOT}/lib/PageCache/src/EpubChapterParser.cpp
+  ${PROJECT_ROOT}/lib/PageCache/src/PageCache.cpp
+
+  # Font support
+  ${PROJECT_ROOT}/lib/EpdFont/src/EpdFont.cpp
+  ${PROJECT_ROOT}/lib/EpdFont/src/EpdFontFamily.cpp
+
+  # Hyphenation
+  ${PROJECT_ROOT}/lib/Hyphenation/src/Hyphenation.cpp
+  ${PROJECT_ROOT}/lib/Hyphenation/src/HyphenationCommon.cpp
+  ${PROJECT_ROOT}/lib/Hyphenation/src/Hyphenator.cpp
+  ${PROJECT_ROOT}/lib/Hyphenation/src/LanguageRegistry.cpp
+  ${PROJECT_ROOT}/lib/Hyphenation/src/LiangHyphenation.cpp
+
+  # Support
+  ${PROJECT_ROOT}/lib/Html5/src/Html5Tokenizer.cpp
+  ${PROJECT_ROOT}/lib/ZipFile/src/ZipFile.cpp
+  ${PROJECT_ROOT}/lib/InflateReader/src/InflateReader.cpp
+  ${PROJECT_ROOT}/lib/uzlib/src/tinflate.c
+  ${PROJECT_ROOT}/lib/uzlib/src/adler32.c
+  ${PROJECT_ROOT}/lib/uzlib/src/crc32.c
+  ${PROJECT_ROOT}/lib/ScriptDetector/src/ScriptDetector.cpp
+  ${PROJECT_ROOT}/lib/Utf8/src/Utf8.cpp
+  ${PROJECT_ROOT}/lib/Utf8/src/Utf8Nfc.cpp
+  ${PROJECT_ROOT}/lib/FsHelpers/src/FsHelpers.cpp
+)
+
+set(READER_INCLUDE_DIRS
+  ${PROJECT_ROOT}/src
+  ${PROJECT_ROOT}/src/core
+  ${PROJECT_ROOT}/src/content
+  ${PROJECT_ROOT}/lib/Utf8/src
+  ${PROJECT_ROOT}/lib/Serialization/src
+  ${PROJECT_ROOT}/lib/AsyncTask/src
+  ${PROJECT_ROOT}/lib/RenderTypes/src
+  ${PROJECT_ROOT}/lib/Epub/src
+  ${PROJECT_ROOT}/lib/Epub/src/Epub
+  ${PROJECT_ROOT}/lib/Epub/src/Epub/css
+  ${PROJECT_ROOT}/lib/PageCache/src
+  ${PROJECT_ROOT}/lib/FsHelpers/src
+  ${PROJECT_ROOT}/lib/ScriptDetector/src
+  ${PROJECT_ROOT}/lib/Markdown/src
+  ${PROJECT_ROOT}/lib/Txt/src
+  ${PROJECT_ROOT}/lib/Fb2/src
+  ${PROJECT_ROOT}/lib/GfxRenderer/src
+  ${PROJECT_ROOT}/lib/EpdFont/src
+  ${PROJECT_ROOT}/lib/EpdFont/src/builtinFonts
+  ${PROJECT_ROOT}/lib/ArabicShaper/src
+  ${PROJECT_ROOT}/lib/ThaiShaper/src
+  ${PROJECT_ROOT}/lib/ZipFile/src
+  ${PROJECT_ROOT}/lib/InflateReader/src
+  ${PROJECT_ROOT}/lib/uzlib/src
+  ${PROJECT_ROOT}/lib/Hyphenation/src
+  ${PROJECT_ROOT}/lib/Html5/src
+  ${PROJECT_ROOT}/lib/ImageConverter/src
+)
+
+# Drawing: the real GfxRenderer instead of the metrics-only mock, for tools that render pages.
+# Targets using these put lib/GfxRenderer/src ahead of the mocks in their include path.
+set(READER_RENDER_SOURCES
+  ${PROJECT_ROOT}/lib/GfxRenderer/src/GfxRenderer.cpp
+  ${PROJECT_ROOT}/lib/GfxRenderer/src/Bitmap.cpp
+  ${PROJECT_ROOT}/lib/GfxRenderer/src/BitmapHelpers.cpp
+  ${PROJECT_ROOT}/lib/GfxRenderer/src/CoverHelpers.cpp
+  ${PROJECT_ROOT}/lib/GfxRenderer/src/DirtyTracker.cpp
+  ${PROJECT_ROOT}/lib/EpdFont/src/EpdFontLoader.cpp
+  ${PROJECT_ROOT}/lib/EpdFont/src/StreamingEpdFont.cpp
+  ${PROJECT_ROOT}/lib/ExternalFont/src/ExternalFont.cpp
+)
+
+set(READER_RENDER_INCLUDE_DIRS
+  ${PROJECT_ROOT}/lib/ExternalFont/src
+)
@@ -0,0 +1,136 @@
+#include "device_settings.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include <EpdFont.h>
+#include <EpdFontFamily.h>
+#include <GfxRenderer.h>
+#include <config.h>
+
+#include <builtinFonts/reader_2b.h>
+#include <builtinFonts/reader_bold_2b.h>
+#include <builtinFonts/reader_italic_2b.h>
+#include <builtinFonts/reader_large_2b.h>
+#include <builtinFonts/reader_large_bold_2b.h>
+#include <builtinFonts/reader_large_italic_2b.h>
+#include <builtinFonts/reader_medium_2b.h>
+#include <builtinFonts/reader_medium_bold_2b.h>
+#include <builtinFonts/reader_medium_italic_2b.h>
+#include <builtinFonts/reader_xsmall_bold_2b.h>
+#include <builtinFonts/reader_xsmall_italic_2b.h>
+#include <builtinFonts/reader_xsmall_regular_2b.h>
+
+namespace {
+
+// Built-in reader fonts, as src/main.cpp registers them (bold doubles as bold italic)
+struct BuiltinFont {
+  const char* name;
+  int id;
+  const EpdFontData* regular;
+  const EpdFontData* bold;
+  const EpdFontData* italic;
+};
+
+const BuiltinFont BUILTIN_FONTS[] = {
+    {"xsmall", READER_FONT_ID_XSMALL, &reader_xsmall_regular_2b, &reader_xsmall_bold_2b, &reader_xsmall_italic_2b},
+    {"small", READER_FONT_ID, &reader_2b, &reader_bold_2b, &reader_italic_2b},
+    {"medium", READER_FONT_ID_MEDIUM, &reader_medium_2b, &reader_medium_bold_2b, &reader_medium_italic_2b},
+    {"large", READER_FONT_ID_LARGE, &reader_large_2b, &reader_large_bold_2b, &reader_large_italic_2b},
+};
+
+// Settings::getIndentLevel / getSpacingLevel / getLineCompression and ParagraphAlignment
+struct NamedLayout {
+  const char* name;
+  uint8_t indentLevel;
+  uint8_t spacingLevel;
+};
+const NamedLayout LAYOUTS[] = {{"compact", 0, 0}, {"standard", 2, 1}, {"large", 3, 3}};
+
+struct NamedSpacing {
+  const char* name;
+  float lineCompression;
+};
+const NamedSpacing SPACINGS[] = {{"compact", 0.85f}, {"normal", 0.95f}, {"relaxed", 1.10f}, {"large", 1.20f}};
+
+struct NamedAlignment {
+  const char* name;
+};
+const NamedAlignment ALIGNMENTS[] = {{"justify"}, {"left"}, {"center"}, {"right"}};
+
+template <typename T, size_t N>
+int findNamed(const T (&table)[N], const char* name) {
+  for (size_t i = 0; i < N; i++) {
+    if (strcmp(table[i].name, name) == 0) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+}  // namespace
+
+bool DeviceSettings::parseOption(const int argc, char* argv[], int& i, bool& error) {
+  const char* arg = argv[i];
+  const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+  int found = 0;
+
+  if (strcmp(arg, "--no-hyphenation") == 0) {
+    hyphenation = false;
+    return true;
+  }
+  if (strcmp(arg, "--no-images") == 0) {
+    showImages = false;
+    return true;
+  }
+  if (strcmp(arg, "--no-statusbar") == 0) {
+    showStatusBar = false;
+    return true;
+  }
+
+  if (strcmp(arg, "--font") == 0) {
+    found = value ? findNamed(BUILTIN_FONTS, value) : -1;
+    if (found >= 0) font = found;
+  } else if (strcmp(arg, "--layout") == 0) {
+    found = value ? findNamed(LAYOUTS, value) : -1;
+    if (found >= 0) layout = found;
+  } else if (strcmp(arg, "--spacing") == 0) {
+    found = value ? findNamed(SPACINGS, value) : -1;
+    if (found >= 0) spacing = found;
+  } else if (strcmp(arg, "--align") == 0) {
+    found = value ? findNamed(ALIGNMENTS, value) : -1;
+    if (found >= 0) alignment = static_cast<uint8_t>(found);
+  } else {
+    return false;
+  }
+
+  if (found < 0) {
+    fprintf(stderr, "Bad value for %s: %s\n", arg, value ? value : "(missing)");
+    error = true;
+  }
+  i++;
+  return true;
+}
+
+void DeviceSettings::printUsage() {
+  fprintf(stderr, "  --font SIZE      xsmall | small | medium | large (default: medium)\n");
+  fprintf(stderr, "  --layout L       compact | standard | large (default: standard)\n");
+  fprintf(stderr, "  --spacing S      compact | normal | relaxed | large (default: normal)\n");
+  fprintf(stderr, "  --align A        justify | left | center | right (default: justify)\n");
+}
+
+const char* DeviceSettings::fontName() const { return BUILTIN_FONTS[font].name; }
+
+int DeviceSettings::fontId() const { return BUILTIN_FONTS[font].id; }
+
+RenderConfig DeviceSettings::renderConfig() const {
+  return RenderConfig(fontId(), SPACINGS[spacing].lineCompression, LAYOUTS[layout].indentLevel,
+                      LAYOUTS[layout].spacingLevel, alignment, hyphenation, showImages, VIEWPORT_WIDTH,
+                      showStatusBar ? VIEWPORT_HEIGHT : VIEWPORT_HEIGHT_NO_STATUSBAR);
+}
+
+void DeviceSettings::registerFont(GfxRenderer& gfx) const {
+  const BuiltinFont& f = BUILTIN_FONTS[font];
+  auto* regular = new EpdFont(f.regular);
+  auto* bold = new EpdFont(f.bold);
+  auto* italic = new EpdFont(f.italic);
+  gfx.insertFont(f.id, EpdFontFamily(regular, bold, italic, bold));
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <RenderConfig.h>
+
+class GfxRenderer;
+
+// Reader settings as the device applies them, named the way the settings menu shows them.
+// Shared by the host tools that have to lay out books exactly like the device does.
+struct DeviceSettings {
+  // ReaderState::getReaderViewport() in portrait: 480x800 panel, 3px bezel margins plus 5px padding
+  // left and right, 9px top, 23px more at the bottom for the status bar
+  static constexpr uint16_t VIEWPORT_WIDTH = 464;
+  static constexpr uint16_t VIEWPORT_HEIGHT = 765;
+  static constexpr uint16_t VIEWPORT_HEIGHT_NO_STATUSBAR = 788;
+  static constexpr int MARGIN_LEFT = 8;
+  static constexpr int MARGIN_TOP = 9;
+
+  int font = 2;     // Index into the built-in reader fonts (medium)
+  int layout = 1;   // standard
+  int spacing = 1;  // normal
+  uint8_t alignment = 0;
+  bool hyphenation = true;
+  bool showImages = true;
+  bool showStatusBar = true;
+
+  // Consumes argv[i] (and its value) if it is a settings option. Sets error for a bad value.
+  bool parseOption(int argc, char* argv[], int& i, bool& error);
+  static void printUsage();
+
+  const char* fontName() const;
+  int fontId() const;
+  RenderConfig renderConfig() const;
+  // Registers the selected reader font (regular, bold, italic) with the renderer. The fonts live
+  // until the process exits.
+  void registerFont(GfxRenderer& gfx) const;
+};
@@ -25,6 +25,9 @@
 #include <Txt.h>
 #include <LittleFS.h>
 
+#include "prebuild.h"
+#include "simulate.h"
+
 #include <builtinFonts/reader_2b.h>
 #include <builtinFonts/reader_bold_2b.h>
 #include <builtinFonts/reader_italic_2b.h>
@@ -122,6 +125,8 @@ static void usage() {
   fprintf(stderr, "  --no-statusbar   Use full viewport height (no status bar margin)\n");
   fprintf(stderr, "  --cache-dump     Dump text from existing device cache directory\n");
   fprintf(stderr, "  output_dir defaults to /tmp/papyrix-cache/\n");
+  prebuildUsage();
+  simulationUsage();
 }
 
 int main(int argc, char* argv[]) {
@@ -129,6 +134,12 @@ int main(int argc, char* argv[]) {
     usage();
     return 1;
   }
+  if (strcmp(argv[1], "--prebuild") == 0) {
+    return runPrebuild(argc - 2, argv + 2);
+  }
+  if (strcmp(argv[1], "--simulate-device") == 0) {
+    return runSimulation(argc - 2, argv + 2);
+  }
 
   bool dump = false;
   bool showStatusBar = true;
@@ -242,7 +253,7 @@ int main(int argc, char* argv[]) {
     printf("FB2: \"%s\" by %s (%d TOC entries)\n", fb2file.getTitle().c_str(), fb2file.getAuthor().c_str(),
            fb2file.tocCount());
 
-    Fb2Parser parser(filepath, gfx, config);
+    Fb2Parser parser(filepath, gfx, config, fb2file.getIndex(), config.showImages ? fb2file.getImageCachePath() : "");
     std::string cachePath = outputDir + "/pages_0.bin";
     PageCache cache(cachePath);
     cache.create(parser, config, batchSize);
@@ -16,15 +16,14 @@ inline bool renderCoverFromBmp(GfxRenderer&, const std::string&, int, int, int,
   return false;
 }
 
-inline bool renderCoverWithFallback(GfxRenderer&, const std::string&, const std::string&, int, int, int, int, int&, int,
-                                     bool = false) {
-  return false;
-}
-
 inline std::string findCoverImage(const std::string&, const std::string&) { return ""; }
 
 inline bool convertImageToBmp(const std::string&, const std::string&, const char*, bool) { return false; }
 
+inline bool convertImageToCoverAndThumb(const std::string&, const std::string&, const std::string&, const char*, bool) {
+  return false;
+}
+
 inline bool generateThumbFromCover(const std::string&, const std::string&, const char*) { return false; }
 
 }  // namespace CoverHelpers
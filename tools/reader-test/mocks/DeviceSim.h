@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Cost model for reader-test --simulate-device.
+//
+// The FsFile, SDCardManager and EInkDisplay mocks report every SD transaction and display
+// update here. While enabled, each one is counted and charged an estimated device time, so
+// changes to cache formats and I/O patterns can be compared without hardware. SdFat reads and
+// writes through a single 512-byte sector cache, so only accesses that leave the cached sector
+// cost an SD transaction. The defaults are rough figures for a microSD card on the ESP32-C3's
+// SPI bus and the SSD1677 panel (docs/device-specifications.md); override them with --model name=value.
+class DeviceSim {
+ public:
+  struct Model {
+    double sdReadMBps = 1.5;     // Sustained SD read over SPI
+    double sdWriteMBps = 0.5;    // Sustained SD write
+    double sdCommandUs = 200;    // Per transaction: command, card busy, block start
+    double sdOpenUs = 2000;      // Directory lookup (open, exists, mkdir, remove)
+    double sdSeekUs = 20;        // Cluster chain walk
+    double sdSyncUs = 3000;      // Closing a written file: flush, FAT and directory entry update
+    double cpuFactor = 30;       // Device CPU time per host CPU time (160 MHz RISC-V core)
+    double spiMHz = 40;          // Display SPI clock
+    double refreshFullMs = 1600;
+    double refreshHalfMs = 1720;
+    double refreshFastMs = 600;
+
+    // Sets one parameter from "name=value" (names as in params()). Returns false for an unknown
+    // name or a bad value.
+    bool set(const char* assignment);
+  };
+
+  struct Param {
+    const char* name;
+    double Model::*field;
+  };
+  static constexpr int PARAM_COUNT = 11;
+  static const Param* params() {
+    static const Param table[PARAM_COUNT] = {
+        {"sd_read_mbps", &Model::sdReadMBps},       {"sd_write_mbps", &Model::sdWriteMBps},
+        {"sd_command_us", &Model::sdCommandUs},     {"sd_open_us", &Model::sdOpenUs},
+        {"sd_seek_us", &Model::sdSeekUs},           {"sd_sync_us", &Model::sdSyncUs},
+        {"cpu_factor", &Model::cpuFactor},          {"spi_mhz", &Model::spiMHz},
+        {"refresh_full_ms", &Model::refreshFullMs}, {"refresh_half_ms", &Model::refreshHalfMs},
+        {"refresh_fast_ms", &Model::refreshFastMs},
+    };
+    return table;
+  }
+
+  // Request sizes, for the read and write histograms
+  static constexpr int SIZE_CLASSES = 4;
+  static constexpr size_t SIZE_CLASS_LIMITS[SIZE_CLASSES - 1] = {64, 512, 4096};
+
+  struct Counters {
+    uint64_t opens = 0;
+    uint64_t dirOps = 0;
+    uint64_t seeks = 0;
+    uint64_t reads[SIZE_CLASSES] = {};
+    uint64_t readBytes = 0;
+    uint64_t writes[SIZE_CLASSES] = {};
+    uint64_t writeBytes = 0;
+    uint64_t sdTransactions = 0;
+    uint64_t spiBytes = 0;
+    uint64_t refreshes = 0;
+    double sdUs = 0;
+    double displayUs = 0;
+
+    Counters operator-(const Counters& o) const {
+      Counters d = *this;
+      d.opens -= o.opens;
+      d.dirOps -= o.dirOps;
+      d.seeks -= o.seeks;
+      for (int i = 0; i < SIZE_CLASSES; i++) {
+        d.reads[i] -= o.reads[i];
+        d.writes[i] -= o.writes[i];
+      }
+      d.readBytes -= o.readBytes;
+      d.writeBytes -= o.writeBytes;
+      d.sdTransactions -= o.sdTransactions;
+      d.spiBytes -= o.spiBytes;
+      d.refreshes -= o.refreshes;
+      d.sdUs -= o.sdUs;
+      d.displayUs -= o.displayUs;
+      return d;
+    }
+  };
+
+  static DeviceSim& instance() {
+    static DeviceSim sim;
+    return sim;
+  }
+
+  bool enabled = false;
+  Model model;
+  Counters counters;
+
+  static int sizeClass(const size_t len) {
+    int c = 0;
+    while (c < SIZE_CLASSES - 1 && len > SIZE_CLASS_LIMITS[c]) c++;
+    return c;
+  }
+
+  // --- SD card (FsFile, SDCardManager) ---
+
+  uint32_t onOpen() {
+    if (enabled) {
+      counters.opens++;
+      counters.sdUs += model.sdOpenUs;
+    }
+    return ++nextFileId_;
+  }
+
+  void onDirOp() {
+    if (!enabled) return;
+    counters.dirOps++;
+    counters.sdUs += model.sdOpenUs;
+  }
+
+  void onSeek() {
+    if (!enabled) return;
+    counters.seeks++;
+    counters.sdUs += model.sdSeekUs;
+  }
+
+  void onRead(const uint32_t fileId, const size_t pos, const size_t len) {
+    if (!enabled || len == 0) return;
+    counters.reads[sizeClass(len)]++;
+    counters.readBytes += len;
+    chargeSectors(fileId, pos, len, model.sdReadMBps);
+  }
+
+  void onWrite(const uint32_t fileId, const size_t pos, const size_t len) {
+    if (!enabled || len == 0) return;
+    counters.writes[sizeClass(len)]++;
+    counters.writeBytes += len;
+    chargeSectors(fileId, pos, len, model.sdWriteMBps);
+  }
+
+  void onClose(const uint32_t fileId, const bool written) {
+    if (cachedFile_ == fileId) cachedFile_ = 0;
+    if (!enabled || !written) return;
+    counters.sdTransactions++;
+    counters.sdUs += model.sdSyncUs;
+  }
+
+  // --- Display (EInkDisplay) ---
+
+  void onSpiWrite(const size_t bytes) {
+    if (!enabled) return;
+    counters.spiBytes += bytes;
+    counters.displayUs += bytes * 8 / model.spiMHz;
+  }
+
+  // 0 = full, 1 = half, 2 = fast (EInkDisplay::RefreshMode)
+  void onRefresh(const int mode) {
+    if (!enabled) return;
+    counters.refreshes++;
+    const double ms = mode == 0 ? model.refreshFullMs : mode == 1 ? model.refreshHalfMs : model.refreshFastMs;
+    counters.displayUs += ms * 1000;
+  }
+
+ private:
+  static constexpr size_t SECTOR_SIZE = 512;
+
+  uint32_t nextFileId_ = 0;
+  uint32_t cachedFile_ = 0;
+  size_t cachedSector_ = 0;
+
+  // One transaction for the sectors outside the cache (multi-block for larger requests)
+  void chargeSectors(const uint32_t fileId, const size_t pos, const size_t len, const double mbps) {
+    size_t first = pos / SECTOR_SIZE;
+    const size_t last = (pos + len - 1) / SECTOR_SIZE;
+    if (fileId == cachedFile_ && first == cachedSector_) first++;
+    cachedFile_ = fileId;
+    cachedSector_ = last;
+    if (first > last) return;
+    counters.sdTransactions++;
+    counters.sdUs += model.sdCommandUs + (last - first + 1) * SECTOR_SIZE / mbps;
+  }
+};
+
+inline bool DeviceSim::Model::set(const char* assignment) {
+  const char* eq = strchr(assignment, '=');
+  if (!eq) return false;
+  char* end = nullptr;
+  const double value = strtod(eq + 1, &end);
+  if (end == eq + 1 || *end != '\0' || value < 0) return false;
+  const size_t nameLen = static_cast<size_t>(eq - assignment);
+  for (int i = 0; i < PARAM_COUNT; i++) {
+    const Param& p = params()[i];
+    if (strlen(p.name) == nameLen && strncmp(p.name, assignment, nameLen) == 0) {
+      this->*p.field = value;
+      return true;
+    }
+  }
+  return false;
+}
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <cstring>
 
+#include "DeviceSim.h"
+
 class EInkDisplay {
  public:
   enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
@@ -12,18 +14,48 @@ class EInkDisplay {
   static constexpr uint16_t DISPLAY_WIDTH_BYTES = DISPLAY_WIDTH / 8;
   static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH_BYTES * DISPLAY_HEIGHT;
 
+  struct Window {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+  };
+
   EInkDisplay(int8_t, int8_t, int8_t, int8_t, int8_t, int8_t) { memset(frameBuffer_, 0xFF, BUFFER_SIZE); }
 
   uint8_t* getFrameBuffer() const { return const_cast<uint8_t*>(frameBuffer_); }
   void clearScreen(uint8_t color = 0xFF) { memset(frameBuffer_, color, BUFFER_SIZE); }
-  void displayBuffer(RefreshMode, bool) {}
-  void displayWindow(int, int, int, int, bool) {}
+  // Updates only cost time under --simulate-device (DeviceSim): the driver sends the frame to both
+  // controller RAMs (BW and RED) over SPI, then waits for the refresh
+  void displayBuffer(const RefreshMode mode, bool) {
+    DeviceSim::instance().onSpiWrite(2 * BUFFER_SIZE);
+    DeviceSim::instance().onRefresh(mode);
+  }
+  void displayWindow(int, int, const int w, const int h, bool) {
+    DeviceSim::instance().onSpiWrite(2 * (static_cast<size_t>(w + 7) / 8) * h);
+    DeviceSim::instance().onRefresh(FAST_REFRESH);
+  }
+  bool displayWindows(const Window*, uint8_t, bool) { return false; }
   void drawImage(const uint8_t*, int, int, int, int) {}
   void grayscaleRevert() {}
-  void copyGrayscaleLsbBuffers(uint8_t*) {}
-  void copyGrayscaleMsbBuffers(uint8_t*) {}
-  void displayGrayBuffer(bool) {}
-  void cleanupGrayscaleBuffers(uint8_t*) {}
+  void copyGrayscaleLsbBuffers(uint8_t*) { DeviceSim::instance().onSpiWrite(BUFFER_SIZE); }
+  void copyGrayscaleMsbBuffers(uint8_t*) { DeviceSim::instance().onSpiWrite(BUFFER_SIZE); }
+  void writeGrayscaleBand(uint16_t, const uint16_t h, const uint8_t*, const uint8_t*) {
+    DeviceSim::instance().onSpiWrite(2 * static_cast<size_t>(DISPLAY_WIDTH_BYTES) * h);
+  }
+  void displayGrayBuffer(bool) { DeviceSim::instance().onRefresh(FAST_REFRESH); }
+  void cleanupGrayscaleBuffers(uint8_t*) { DeviceSim::instance().onSpiWrite(BUFFER_SIZE); }
+
+  // Refreshes complete immediately (for the real GfxRenderer in xtc-convert)
+  using RefreshHandle = uint32_t;
+  static constexpr uint8_t MAX_WINDOWS = 8;
+  RefreshHandle displayBufferAsync(const RefreshMode mode = FAST_REFRESH, const bool turnOff = false) {
+    displayBuffer(mode, turnOff);
+    return 0;
+  }
+  RefreshHandle displayWindowsAsync(const Window*, uint8_t, bool) { return 0; }
+  bool isRefreshComplete(RefreshHandle) { return true; }
+  void waitForRefresh() {}
 
  private:
   uint8_t frameBuffer_[BUFFER_SIZE];
@@ -2,6 +2,7 @@
 
 #include <EInkDisplay.h>
 #include <EpdFontFamily.h>
+#include <ScriptDetector.h>
 #include <ThaiCluster.h>
 #include <Utf8.h>
 
@@ -22,6 +23,10 @@ class GfxRenderer {
   enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
   enum Orientation { Portrait, LandscapeClockwise, PortraitInverted, LandscapeCounterClockwise };
 
+  static constexpr uint8_t TEXT_SCRIPT_MASK = 0x07;
+  static constexpr uint8_t TEXT_PRINTABLE = 0x40;
+  static constexpr uint8_t TEXT_FLAGS_SET = 0x80;
+
  private:
   EInkDisplay& einkDisplay;
   RenderMode renderMode;
@@ -91,8 +96,13 @@ class GfxRenderer {
     return (orientation == Portrait || orientation == PortraitInverted) ? EInkDisplay::DISPLAY_WIDTH
                                                                        : EInkDisplay::DISPLAY_HEIGHT;
   }
-  void displayBuffer(EInkDisplay::RefreshMode = EInkDisplay::FAST_REFRESH, bool = false) const {}
-  void displayWindow(int, int, int, int, bool = false) const {}
+  // Passed on so --simulate-device charges the display update
+  void displayBuffer(EInkDisplay::RefreshMode mode = EInkDisplay::FAST_REFRESH, bool turnOff = false) const {
+    einkDisplay.displayBuffer(mode, turnOff);
+  }
+  void displayWindow(int x, int y, int w, int h, bool turnOff = false) const {
+    einkDisplay.displayWindow(x, y, w, h, turnOff);
+  }
   void invertScreen() const {}
   void clearScreen(uint8_t = 0xFF) const {}
   void clearArea(int, int, int, int, uint8_t = 0xFF) const {}
@@ -127,6 +137,18 @@ class GfxRenderer {
   }
   void drawCenteredText(int, int, const char*, bool = true, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {}
   void drawText(int, int, int, const char*, bool = true, EpdFontFamily::Style = EpdFontFamily::REGULAR) const {}
+  void drawText(int, int, int, const char*, bool, EpdFontFamily::Style, uint8_t) const {}
+  void drawShapedText(int, int, int, const ThaiShaper::PositionedGlyph*, size_t, uint8_t, bool = true,
+                      EpdFontFamily::Style = EpdFontFamily::REGULAR) const {}
+  // Same flags as the device computes: they are part of the page cache format
+  uint8_t getTextFlags(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const {
+    auto it = fontMap.find(fontId);
+    if (text == nullptr || *text == '\0' || it == fontMap.end()) return TEXT_FLAGS_SET;
+    if (style != EpdFontFamily::REGULAR) getStreamingFont(fontId, style);
+    uint8_t flags = TEXT_FLAGS_SET | ScriptDetector::scanScripts(text);
+    if (it->second.hasPrintableChars(text, style)) flags |= TEXT_PRINTABLE;
+    return flags;
+  }
   int getSpaceWidth(int fontId) const {
     auto it = fontMap.find(fontId);
     if (it == fontMap.end()) return 5;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <FsHelpers.h>
+
 #include <functional>
 #include <string>
 
@@ -15,6 +17,13 @@ struct ImageConvertConfig {
   std::function<bool()> shouldAbort = nullptr;
 };
 
+struct ImageConvertOutput {
+  std::string path;
+  int maxWidth = 450;
+  int maxHeight = 750;
+  bool oneBit = false;
+};
+
 class ImageConverter {
  public:
   virtual ~ImageConverter() = default;
@@ -26,5 +35,20 @@ class ImageConverterFactory {
  public:
   static ImageConverter* getConverter(const std::string&) { return nullptr; }
   static bool convertToBmp(const std::string&, const std::string&, const ImageConvertConfig& = {}) { return false; }
-  static bool isSupported(const std::string&) { return false; }
+  static bool convertToBmps(const std::string&, const ImageConvertOutput*, int, const ImageConvertConfig& = {}) {
+    return false;
+  }
+  static bool canConvertMulti(const std::string&) { return false; }
+  // No image decoders on the host: every image is skipped, and the ones the device would show
+  // are counted so a caller can tell content was laid out without them
+  static bool isSupported(const std::string& path) {
+    if (FsHelpers::isImageFile(path)) {
+      skippedImages()++;
+    }
+    return false;
+  }
+  static int& skippedImages() {
+    static int count = 0;
+    return count;
+  }
 };
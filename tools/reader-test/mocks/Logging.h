@@ -0,0 +1,4 @@
+#pragma once
+
+// Redirect to platform stubs which define LOG_* macros
+#include "platform_stubs.h"
@@ -13,7 +13,10 @@ class SDCardManager {
   bool begin() { return true; }
   bool ready() const { return true; }
 
-  bool exists(const char* path) { return access(path, F_OK) == 0; }
+  bool exists(const char* path) {
+    DeviceSim::instance().onDirOp();
+    return access(sdHostPath(path).c_str(), F_OK) == 0;
+  }
 
   FsFile open(const char* path, int mode = O_RDONLY) {
     FsFile file;
@@ -39,20 +42,26 @@ class SDCardManager {
     return openFileForWrite(moduleName, path.c_str(), file);
   }
 
-  bool remove(const char* path) { return ::remove(path) == 0; }
+  bool remove(const char* path) {
+    DeviceSim::instance().onDirOp();
+    return ::remove(sdHostPath(path).c_str()) == 0;
+  }
 
   bool removeDir(const char* path) {
     // Simple recursive remove - for cache cleanup
+    DeviceSim::instance().onDirOp();
     std::string cmd = "rm -rf '";
-    cmd += path;
+    cmd += sdHostPath(path);
     cmd += "'";
     return system(cmd.c_str()) == 0;
   }
 
   bool mkdir(const char* path) {
+    DeviceSim::instance().onDirOp();
+    const std::string hostPath = sdHostPath(path);
     struct stat st;
-    if (stat(path, &st) == 0) return true;
-    return ::mkdir(path, 0755) == 0;
+    if (stat(hostPath.c_str(), &st) == 0) return true;
+    return ::mkdir(hostPath.c_str(), 0755) == 0;
   }
 
   static SDCardManager& getInstance() {
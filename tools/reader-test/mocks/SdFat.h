@@ -1,27 +1,54 @@
 #pragma once
 
+#include <fcntl.h>
+
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "DeviceSim.h"
 #include "Print.h"
 
-// File open mode flags
-#define O_RDONLY 0x00
-#define O_WRONLY 0x01
-#define O_RDWR 0x02
-#define O_CREAT 0x40
-#define O_TRUNC 0x80
+// Host directories standing in for SD card paths, longest prefix first. Without mounts, paths
+// are host paths as given.
+inline std::vector<std::pair<std::string, std::string>>& sdMounts() {
+  static std::vector<std::pair<std::string, std::string>> mounts;
+  return mounts;
+}
+
+inline void sdMount(const std::string& sdPrefix, const std::string& hostDir) {
+  auto& mounts = sdMounts();
+  mounts.emplace_back(sdPrefix == "/" ? "" : sdPrefix, hostDir);
+  std::sort(mounts.begin(), mounts.end(), [](const auto& a, const auto& b) { return a.first.size() > b.first.size(); });
+}
+
+inline std::string sdHostPath(const char* path) {
+  const std::string p = path ? path : "";
+  for (const auto& mount : sdMounts()) {
+    if (p.compare(0, mount.first.size(), mount.first) == 0 &&
+        (p.size() == mount.first.size() || p[mount.first.size()] == '/')) {
+      return mount.second + p.substr(mount.first.size());
+    }
+  }
+  return p;
+}
+
+// File open mode flags are the host's own from <fcntl.h>, so tools can also pass them to open()
 
-// FsFile backed by real FILE* I/O (inherits Print for stream compatibility)
+// FsFile backed by real FILE* I/O (inherits Print for stream compatibility). Opens, seeks, reads
+// and writes are reported to DeviceSim for --simulate-device.
 class FsFile : public Print {
  public:
   FsFile() = default;
   ~FsFile() { close(); }
 
   // Move-only (owns FILE*)
-  FsFile(FsFile&& other) noexcept : fp_(other.fp_), isOpen_(other.isOpen_), fileSize_(other.fileSize_) {
+  FsFile(FsFile&& other) noexcept
+      : fp_(other.fp_), isOpen_(other.isOpen_), fileSize_(other.fileSize_), id_(other.id_), written_(other.written_) {
     other.fp_ = nullptr;
     other.isOpen_ = false;
   }
@@ -31,6 +58,8 @@ class FsFile : public Print {
       fp_ = other.fp_;
       isOpen_ = other.isOpen_;
       fileSize_ = other.fileSize_;
+      id_ = other.id_;
+      written_ = other.written_;
       other.fp_ = nullptr;
       other.isOpen_ = false;
     }
@@ -56,13 +85,16 @@ class FsFile : public Print {
       fmode = "rb";
     }
 
-    fp_ = fopen(path, fmode);
+    const std::string hostPath = sdHostPath(path);
+    fp_ = fopen(hostPath.c_str(), fmode);
     if (!fp_ && (mode & O_CREAT)) {
-      fp_ = fopen(path, "w+b");
+      fp_ = fopen(hostPath.c_str(), "w+b");
     }
     if (!fp_) return false;
 
     isOpen_ = true;
+    id_ = DeviceSim::instance().onOpen();
+    written_ = false;
     // Cache file size
     fseek(fp_, 0, SEEK_END);
     fileSize_ = ftell(fp_);
@@ -72,6 +104,7 @@ class FsFile : public Print {
 
   void close() {
     if (fp_) {
+      DeviceSim::instance().onClose(id_, written_);
       fclose(fp_);
       fp_ = nullptr;
     }
@@ -81,13 +114,17 @@ class FsFile : public Print {
 
   int read() {
     if (!fp_) return -1;
+    const size_t pos = simPosition();
     int c = fgetc(fp_);
+    if (c >= 0) DeviceSim::instance().onRead(id_, pos, 1);
     return c;
   }
 
   int read(uint8_t* buf, size_t len) {
     if (!fp_) return -1;
+    const size_t pos = simPosition();
     size_t r = fread(buf, 1, len, fp_);
+    DeviceSim::instance().onRead(id_, pos, r);
     return static_cast<int>(r);
   }
 
@@ -96,20 +133,26 @@ class FsFile : public Print {
 
   size_t write(uint8_t c) override {
     if (!fp_) return 0;
-    return fwrite(&c, 1, 1, fp_) == 1 ? 1 : 0;
+    const size_t pos = simPosition();
+    if (fwrite(&c, 1, 1, fp_) != 1) return 0;
+    noteWrite(pos, 1);
+    return 1;
   }
 
   size_t write(const uint8_t* buf, size_t len) override {
     if (!fp_) return 0;
+    const size_t pos = simPosition();
     size_t w = fwrite(buf, 1, len, fp_);
+    noteWrite(pos, w);
     // Update cached size if we wrote past end
-    size_t pos = ftell(fp_);
-    if (pos > fileSize_) fileSize_ = pos;
+    const size_t end = ftell(fp_);
+    if (end > fileSize_) fileSize_ = end;
     return w;
   }
 
   bool seek(size_t pos) {
     if (!fp_) return false;
+    if (DeviceSim::instance().enabled && pos != position()) DeviceSim::instance().onSeek();
     return fseek(fp_, static_cast<long>(pos), SEEK_SET) == 0;
   }
 
@@ -117,11 +160,13 @@ class FsFile : public Print {
 
   bool seekEnd() {
     if (!fp_) return false;
+    DeviceSim::instance().onSeek();
     return fseek(fp_, 0, SEEK_END) == 0;
   }
 
   bool seekCur(int offset) {
     if (!fp_) return false;
+    if (offset != 0) DeviceSim::instance().onSeek();
     return fseek(fp_, offset, SEEK_CUR) == 0;
   }
 
@@ -151,4 +196,13 @@ class FsFile : public Print {
   FILE* fp_ = nullptr;
   bool isOpen_ = false;
   size_t fileSize_ = 0;
+  uint32_t id_ = 0;  // DeviceSim file id
+  bool written_ = false;
+
+  size_t simPosition() const { return DeviceSim::instance().enabled ? position() : 0; }
+
+  void noteWrite(const size_t pos, const size_t len) {
+    written_ = true;
+    DeviceSim::instance().onWrite(id_, pos, len);
+  }
 };
@@ -0,0 +1,449 @@
+// Library cache pre-builder
+//
+// Walks a copy of the SD card and writes the cache tree the device builds while opening and
+// reading each book: book metadata, complete section caches and anchor maps, under the same
+// <format>_<hash> names (FsHelpers::pathHash) and with the same PageCache format. Copy the
+// output to /.papyrix/cache on the card and the device opens the books without indexing them.
+//
+// Each book is built in its own worker process: the parsers, hyphenation and renderer keep
+// global state, so threads couldn't share them.
+//
+// Left to the device: covers, thumbnails and inline images, since the host has no image
+// decoders. A section that shows an image is not written, so the device lays it out itself; FB2
+// images are laid out from their headers, so those pages are written and the device only
+// converts the images when it first shows them.
+
+#include "prebuild.h"
+
+#include "device_settings.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <EInkDisplay.h>
+#include <Epub.h>
+#include <EpubChapterParser.h>
+#include <Fb2.h>
+#include <Fb2Parser.h>
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
+#include <ImageConverter.h>
+#include <Markdown.h>
+#include <MarkdownParser.h>
+#include <Page.h>
+#include <PageCache.h>
+#include <PlainTextParser.h>
+#include <RenderConfig.h>
+#include <SDCardManager.h>
+#include <Serialization.h>
+#include <Txt.h>
+#include <config.h>
+
+// Same format as ReaderState::saveAnchorMap()
+void saveAnchorMap(const ContentParser& parser, const std::string& cachePath) {
+  const auto& anchors = parser.getAnchorMap();
+  FsFile file;
+  if (!SdMan.openFileForWrite("PRE", cachePath + ".anchors", file)) return;
+  const uint16_t count = anchors.size() > UINT16_MAX ? 0 : static_cast<uint16_t>(anchors.size());
+  serialization::writePod(file, count);
+  for (uint16_t i = 0; i < count; i++) {
+    serialization::writeString(file, anchors[i].first);
+    serialization::writePod(file, anchors[i].second);
+  }
+  file.close();
+}
+
+namespace {
+
+struct Options {
+  std::string root;   // Host directory holding a copy of the SD card
+  std::string out;    // Host directory standing in for PAPYRIX_CACHE_DIR
+  std::string check;  // Device-built cache tree to compare against (optional)
+  unsigned jobs = 0;
+  bool verbose = false;
+  RenderConfig config;
+};
+
+struct Book {
+  std::string sdPath;  // Path as the device sees it ("/Books/a.epub")
+};
+
+bool isDir(const std::string& path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+void mkdirs(const std::string& path) {
+  for (size_t i = 1; i <= path.size(); i++) {
+    if (i == path.size() || path[i] == '/') mkdir(path.substr(0, i).c_str(), 0755);
+  }
+}
+
+bool isPrebuildable(const std::string& name) {
+  return FsHelpers::isEpubFile(name) || FsHelpers::isFb2File(name) || FsHelpers::isTxtFile(name) ||
+         FsHelpers::isMarkdownFile(name);
+}
+
+// Books the file browser lists: hidden entries and system folders are skipped
+void collectBooks(const std::string& hostDir, const std::string& sdDir, std::vector<Book>& books) {
+  DIR* d = opendir(hostDir.c_str());
+  if (!d) return;
+  std::vector<std::string> names;
+  while (const dirent* entry = readdir(d)) {
+    if (entry->d_name[0] == '.' || FsHelpers::isHiddenFsItem(entry->d_name)) continue;
+    names.emplace_back(entry->d_name);
+  }
+  closedir(d);
+  std::sort(names.begin(), names.end());
+
+  for (const auto& name : names) {
+    const std::string hostPath = hostDir + "/" + name;
+    const std::string sdPath = (sdDir == "/" ? "" : sdDir) + "/" + name;
+    if (isDir(hostPath)) {
+      collectBooks(hostPath, sdPath, books);
+    } else if (isPrebuildable(name)) {
+      books.push_back({sdPath});
+    }
+  }
+}
+
+// Parse the whole content in the batches ReaderState uses, so pages split at the same places as
+// on the device (layout carried across a batch boundary isn't always what one pass gives).
+// Returns the page count, or -1 when the device has to build this cache itself (parse failed,
+// or the content shows images the host can't convert).
+int buildCache(ContentParser& parser, const std::string& cachePath, const RenderConfig& config) {
+  const int imagesBefore = ImageConverterFactory::skippedImages();
+  PageCache cache(cachePath);
+  bool ok = cache.create(parser, config, PageCache::DEFAULT_CACHE_CHUNK);
+  while (ok && cache.isPartial()) {
+    ok = cache.extend(parser, PageCache::DEFAULT_CACHE_CHUNK);
+  }
+  if (!ok || ImageConverterFactory::skippedImages() != imagesBefore) {
+    cache.clear();
+    SdMan.remove((cachePath + ".anchors").c_str());
+    return -1;
+  }
+  saveAnchorMap(parser, cachePath);
+  return cache.pageCount();
+}
+
+// Runs in a worker process. The cache paths come out of the library classes unchanged, as on
+// the device; sdMount() maps them to the host directories.
+bool buildBook(const Book& book, GfxRenderer& gfx, const RenderConfig& config) {
+  const std::string contentCacheName = "/pages_" + std::to_string(config.fontId) + ".bin";
+  int pages = 0;
+  int skipped = 0;
+  const auto add = [&](const int sectionPages) {
+    if (sectionPages < 0) {
+      skipped++;
+    } else {
+      pages += sectionPages;
+    }
+  };
+
+  if (FsHelpers::isEpubFile(book.sdPath)) {
+    auto epub = std::make_shared<Epub>(book.sdPath, PAPYRIX_CACHE_DIR);
+    if (!epub->load()) {
+      fprintf(stderr, "FAIL %s: cannot load EPUB\n", book.sdPath.c_str());
+      return false;
+    }
+    epub->setupCacheDir();
+    const std::string sectionsDir = epub->getCachePath() + "/sections";
+    SdMan.mkdir(sectionsDir.c_str());
+    const std::string imageCachePath = config.showImages ? epub->getCachePath() + "/images" : "";
+    for (int i = 0; i < epub->getSpineItemsCount(); i++) {
+      EpubChapterParser parser(epub, i, gfx, config, imageCachePath);
+      add(buildCache(parser, sectionsDir + "/" + std::to_string(i) + ".bin", config));
+    }
+    fprintf(stderr, "OK   %s -> %s: %d sections, %d pages", book.sdPath.c_str(), epub->getCachePath().c_str(),
+            epub->getSpineItemsCount(), pages);
+  } else if (FsHelpers::isFb2File(book.sdPath)) {
+    Fb2 fb2(book.sdPath, PAPYRIX_CACHE_DIR);
+    if (!fb2.load()) {
+      fprintf(stderr, "FAIL %s: cannot load FB2\n", book.sdPath.c_str());
+      return false;
+    }
+    fb2.setupCacheDir();
+    Fb2Parser parser(book.sdPath, gfx, config, fb2.getIndex(), config.showImages ? fb2.getImageCachePath() : "");
+    add(buildCache(parser, fb2.getCachePath() + contentCacheName, config));
+    fprintf(stderr, "OK   %s -> %s: %d pages", book.sdPath.c_str(), fb2.getCachePath().c_str(), pages);
+  } else if (FsHelpers::isMarkdownFile(book.sdPath)) {
+    Markdown md(book.sdPath, PAPYRIX_CACHE_DIR);
+    if (!md.load()) {
+      fprintf(stderr, "FAIL %s: cannot load Markdown\n", book.sdPath.c_str());
+      return false;
+    }
+    md.setupCacheDir();
+    MarkdownParser parser(book.sdPath, gfx, config);
+    add(buildCache(parser, md.getCachePath() + contentCacheName, config));
+    fprintf(stderr, "OK   %s -> %s: %d pages", book.sdPath.c_str(), md.getCachePath().c_str(), pages);
+  } else {
+    Txt txt(book.sdPath, PAPYRIX_CACHE_DIR);
+    if (!txt.load()) {
+      fprintf(stderr, "FAIL %s: cannot load TXT\n", book.sdPath.c_str());
+      return false;
+    }
+    txt.setupCacheDir();
+    txt.setLayout(config.hash());
+    for (uint16_t i = 0; i < txt.sectionCount(); i++) {
+      PlainTextParser parser(book.sdPath, gfx, config, txt.sectionStart(i), txt.sectionEnd(i));
+      const int sectionPages = buildCache(parser, txt.getSectionCachePath(config.fontId, i), config);
+      add(sectionPages);
+      if (sectionPages > 0) txt.setSectionPages(i, static_cast<uint16_t>(sectionPages));
+    }
+    txt.saveIndex();
+    fprintf(stderr, "OK   %s -> %s: %d sections, %d pages", book.sdPath.c_str(), txt.getCachePath().c_str(),
+            txt.sectionCount(), pages);
+  }
+
+  if (skipped > 0) fprintf(stderr, " (%d left to the device)", skipped);
+  fprintf(stderr, "\n");
+  return true;
+}
+
+// One worker process per book, at most jobs at a time
+int buildAll(const Options& opt, const std::vector<Book>& books, GfxRenderer& gfx) {
+  int failed = 0;
+  size_t next = 0;
+  std::map<pid_t, size_t> workers;
+  while (next < books.size() || !workers.empty()) {
+    while (next < books.size() && workers.size() < opt.jobs) {
+      fflush(nullptr);
+      const pid_t pid = fork();
+      if (pid == 0) {
+        // Parser logging goes to stdout; keep only the per-book summary on stderr
+        if (!opt.verbose) freopen("/dev/null", "w", stdout);
+        sdMount("/", opt.root);
+        sdMount(PAPYRIX_CACHE_DIR, opt.out);
+        const bool ok = buildBook(books[next], gfx, opt.config);
+        fflush(nullptr);
+        _exit(ok ? 0 : 1);
+      }
+      if (pid < 0) {
+        perror("fork");
+        return -1;
+      }
+      workers[pid] = next++;
+    }
+
+    int status = 0;
+    const pid_t pid = wait(&status);
+    if (pid < 0) break;
+    const auto it = workers.find(pid);
+    if (it == workers.end()) continue;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      if (WIFSIGNALED(status)) {
+        fprintf(stderr, "FAIL %s: worker died (signal %d)\n", books[it->second].sdPath.c_str(), WTERMSIG(status));
+      }
+      failed++;
+    }
+    workers.erase(it);
+  }
+  return failed;
+}
+
+// --- Check mode ---
+
+bool readFile(const std::string& path, std::string& data) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  data.clear();
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+std::string pageBytes(const Page& page, const std::string& scratchPath) {
+  FsFile file;
+  std::string data;
+  if (file.open(scratchPath.c_str(), O_RDWR | O_CREAT | O_TRUNC) && page.serialize(file)) {
+    file.close();
+    readFile(scratchPath, data);
+  }
+  return data;
+}
+
+// PageCache header up to the page count: format version and the render settings
+constexpr size_t CACHE_SETTINGS_SIZE = 1 + 4 + 4 + 1 + 1 + 1 + 1 + 1 + 2 + 2;
+
+// Section caches are compared page by page: the device appends each extend batch with its own
+// lookup table, so the files differ byte-wise even when every page is the same. loadRaw() keeps
+// the device tree read-only (load() deletes a cache built with other settings).
+std::string compareCaches(const std::string& builtPath, const std::string& devicePath,
+                          const std::string& scratchPath) {
+  std::string builtData, deviceData;
+  readFile(builtPath, builtData);
+  readFile(devicePath, deviceData);
+  if (builtData.compare(0, CACHE_SETTINGS_SIZE, deviceData, 0, CACHE_SETTINGS_SIZE) != 0) {
+    return "device cache built with other settings or cache version";
+  }
+
+  PageCache built(builtPath);
+  PageCache device(devicePath);
+  if (!built.loadRaw() || !device.loadRaw()) return "cannot load cache";
+  if (!device.isPartial() && device.pageCount() != built.pageCount()) {
+    return "page count " + std::to_string(built.pageCount()) + " vs " + std::to_string(device.pageCount());
+  }
+  const uint16_t pages = std::min(built.pageCount(), device.pageCount());
+  for (uint16_t p = 0; p < pages; p++) {
+    const auto a = built.loadPage(p);
+    const auto b = device.loadPage(p);
+    if (!a || !b || pageBytes(*a, scratchPath) != pageBytes(*b, scratchPath)) {
+      return "page " + std::to_string(p) + " differs";
+    }
+  }
+  return "";
+}
+
+bool isSectionCache(const std::string& rel) {
+  const auto slash = rel.find_last_of('/');
+  const std::string name = rel.substr(slash + 1);
+  if (!FsHelpers::hasExtension(name, ".bin")) return false;
+  return rel.find("/sections/") != std::string::npos || name.compare(0, 6, "pages_") == 0;
+}
+
+void collectFiles(const std::string& dir, const std::string& rel, std::vector<std::string>& files) {
+  DIR* d = opendir(dir.c_str());
+  if (!d) return;
+  while (const dirent* entry = readdir(d)) {
+    const std::string name = entry->d_name;
+    if (name == "." || name == "..") continue;
+    if (isDir(dir + "/" + name)) {
+      collectFiles(dir + "/" + name, rel + "/" + name, files);
+    } else {
+      files.push_back(rel + "/" + name);
+    }
+  }
+  closedir(d);
+}
+
+int checkAgainstDevice(const Options& opt) {
+  std::vector<std::string> files;
+  collectFiles(opt.out, "", files);
+  std::sort(files.begin(), files.end());
+
+  const std::string scratchPath = opt.out + "/.page_scratch";
+  int same = 0;
+  int differ = 0;
+  int missing = 0;
+  for (const auto& rel : files) {
+    const std::string builtPath = opt.out + rel;
+    const std::string devicePath = opt.check + rel;
+    if (access(devicePath.c_str(), F_OK) != 0) {
+      missing++;
+      continue;
+    }
+
+    std::string problem;
+    if (isSectionCache(rel)) {
+      problem = compareCaches(builtPath, devicePath, scratchPath);
+    } else {
+      std::string a, b;
+      if (!readFile(builtPath, a) || !readFile(devicePath, b) || a != b) problem = "content differs";
+    }
+
+    if (problem.empty()) {
+      same++;
+    } else {
+      differ++;
+      printf("DIFF %s: %s\n", rel.c_str(), problem.c_str());
+    }
+  }
+  remove(scratchPath.c_str());
+
+  printf("Check: %d identical, %d different, %d not built on the device yet\n", same, differ, missing);
+  return differ == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+void prebuildUsage() {
+  fprintf(stderr, "       reader-test --prebuild <sd_root> [options]\n");
+  fprintf(stderr, "  Builds the device caches for every book under sd_root (a copy of the SD card)\n");
+  fprintf(stderr, "  --out DIR        Cache tree to write; copy it to /.papyrix/cache on the card\n");
+  fprintf(stderr, "                   (default: <sd_root>/.papyrix/cache)\n");
+  fprintf(stderr, "  --check DIR      Compare with a device-built cache tree (the card's /.papyrix/cache)\n");
+  fprintf(stderr, "  --jobs N         Books built in parallel (default: CPU count)\n");
+  DeviceSettings::printUsage();
+  fprintf(stderr, "  --no-hyphenation, --no-images, --no-statusbar, --verbose\n");
+}
+
+int runPrebuild(const int argc, char* argv[]) {
+  Options opt;
+  DeviceSettings settings;
+  bool badOption = false;
+
+  for (int i = 0; i < argc && !badOption; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (settings.parseOption(argc, argv, i, badOption)) continue;
+    if (strcmp(arg, "--out") == 0 && value) {
+      opt.out = argv[++i];
+    } else if (strcmp(arg, "--check") == 0 && value) {
+      opt.check = argv[++i];
+    } else if (strcmp(arg, "--jobs") == 0 && value) {
+      opt.jobs = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (strcmp(arg, "--verbose") == 0) {
+      opt.verbose = true;
+    } else if (arg[0] != '-' && opt.root.empty()) {
+      opt.root = arg;
+    } else {
+      fprintf(stderr, "Unknown prebuild option: %s\n", arg);
+      return 1;
+    }
+  }
+
+  if (badOption || opt.root.empty() || !isDir(opt.root)) {
+    prebuildUsage();
+    return 1;
+  }
+  while (opt.root.size() > 1 && opt.root.back() == '/') opt.root.pop_back();
+  if (opt.out.empty()) {
+    // Check mode builds into a scratch tree so the device caches under sd_root stay untouched
+    if (opt.check.empty()) {
+      opt.out = opt.root + PAPYRIX_CACHE_DIR;
+    } else {
+      char scratch[] = "/tmp/papyrix-prebuild-XXXXXX";
+      if (!mkdtemp(scratch)) {
+        perror("mkdtemp");
+        return 1;
+      }
+      opt.out = scratch;
+    }
+  }
+  if (opt.jobs == 0) opt.jobs = std::max(1u, std::thread::hardware_concurrency());
+  mkdirs(opt.out);
+
+  opt.config = settings.renderConfig();
+
+  // Set up once; every worker inherits the renderer and fonts
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  settings.registerFont(gfx);
+
+  std::vector<Book> books;
+  collectBooks(opt.root, "/", books);
+  fprintf(stderr, "Prebuilding %zu books into %s (%u jobs, font %s)\n", books.size(), opt.out.c_str(), opt.jobs,
+          settings.fontName());
+
+  const int failed = buildAll(opt, books, gfx);
+  if (failed < 0) return 1;
+  fprintf(stderr, "Done: %zu books, %d failed\n", books.size(), failed);
+
+  if (!opt.check.empty()) return checkAgainstDevice(opt);
+  return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+class ContentParser;
+
+// reader-test --prebuild: build the device's book caches on the host (see prebuild.cpp)
+int runPrebuild(int argc, char* argv[]);
+void prebuildUsage();
+
+// Writes the parser's anchor map next to a section cache, as ReaderState::saveAnchorMap() does
+void saveAnchorMap(const ContentParser& parser, const std::string& cachePath);
@@ -0,0 +1,434 @@
+// Device timing simulation
+//
+// Opens a book the way ReaderState does (load the content, cache the first section in
+// DEFAULT_CACHE_CHUNK batches, load and show the first page), then turns pages. The SD card and
+// display mocks charge every transaction to DeviceSim's latency model, and host CPU time is
+// scaled by the model's CPU factor, giving an estimate of the device's time to first page and
+// cost per page turn. Useful to compare cache formats and I/O changes without flashing; the
+// absolute numbers are only as good as the model.
+//
+// The book is opened twice: once with no cache (first open) and once with the cache the first
+// open left (reopen). --open-at opens it in the section holding a percentage of the book, the way
+// the reader reopens a saved position (a TXT checkpoint section or an EPUB spine item). Cache
+// extension, which the device does in the background while the reader looks at a page, is charged
+// to the page turn that triggers it. Drawing is not included, since reader-test's renderer only
+// measures text.
+
+#include "simulate.h"
+
+#include "device_settings.h"
+#include "prebuild.h"
+
+#include <dirent.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <DeviceSim.h>
+#include <EInkDisplay.h>
+#include <Epub.h>
+#include <EpubChapterParser.h>
+#include <Fb2.h>
+#include <Fb2Parser.h>
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
+#include <Markdown.h>
+#include <MarkdownParser.h>
+#include <Page.h>
+#include <PageCache.h>
+#include <PlainTextParser.h>
+#include <SDCardManager.h>
+#include <Txt.h>
+#include <config.h>
+
+namespace {
+
+// PapyrixSettings::getPagesPerRefreshValue() default: a half refresh every 15 pages
+constexpr int DEFAULT_PAGES_PER_REFRESH = 15;
+
+struct Options {
+  std::string book;
+  int turns = 30;
+  int openAt = 0;  // Percent
+  int pagesPerRefresh = DEFAULT_PAGES_PER_REFRESH;
+  bool verbose = false;
+  DeviceSettings settings;
+};
+
+double cpuMicros() {
+  timespec ts = {};
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Estimated device cost of a stretch of work
+struct Cost {
+  DeviceSim::Counters io;
+  double cpuUs = 0;  // Already scaled to the device
+
+  double totalMs() const { return (io.sdUs + io.displayUs + cpuUs) / 1000; }
+};
+
+class Meter {
+ public:
+  Meter() : start_(DeviceSim::instance().counters), cpuStart_(cpuMicros()) {}
+
+  Cost stop() const {
+    Cost cost;
+    cost.io = DeviceSim::instance().counters - start_;
+    cost.cpuUs = (cpuMicros() - cpuStart_) * DeviceSim::instance().model.cpuFactor;
+    return cost;
+  }
+
+ private:
+  DeviceSim::Counters start_;
+  double cpuStart_;
+};
+
+// The open book as ReaderState holds it: content, the current section's parser and page cache
+class Reader {
+ public:
+  Reader(const Options& opt, GfxRenderer& gfx, const RenderConfig& config)
+      : opt_(opt), gfx_(gfx), config_(config), pagesUntilFullRefresh_(1) {}
+
+  // Load the content and show the first page of the section to open at
+  bool open() {
+    if (!loadContent()) return false;
+    return openSection(startSection()) && showPage();
+  }
+
+  // Show the next page. Returns false at the end of the book. extended is set when the section
+  // cache had to grow or the next section had to be cached first.
+  bool turnPage(bool& extended) {
+    extended = false;
+    page_++;
+    if (cache_->needsExtension(page_)) {
+      extended = true;
+      if (!cache_->extend(*parser_, PageCache::DEFAULT_CACHE_CHUNK)) return false;
+      saveAnchorMap(*parser_, cache_->path());
+      recordSectionPages();
+    }
+    if (page_ >= cache_->pageCount()) {
+      if (section_ + 1 >= sections_) return false;
+      extended = true;
+      if (!openSection(section_ + 1)) return false;
+    }
+    return showPage();
+  }
+
+ private:
+  const Options& opt_;
+  GfxRenderer& gfx_;
+  const RenderConfig& config_;
+  std::shared_ptr<Epub> epub_;
+  std::unique_ptr<Txt> txt_;
+  std::string cacheDir_;  // Book cache directory (non-EPUB content)
+  int sections_ = 1;
+  int section_ = 0;
+  uint16_t page_ = 0;
+  std::unique_ptr<ContentParser> parser_;
+  std::unique_ptr<PageCache> cache_;
+  int pagesUntilFullRefresh_;
+
+  template <typename Content>
+  bool loadText() {
+    Content content(opt_.book, PAPYRIX_CACHE_DIR);
+    if (!content.load()) return false;
+    content.setupCacheDir();
+    cacheDir_ = content.getCachePath();
+    return true;
+  }
+
+  bool loadContent() {
+    if (FsHelpers::isEpubFile(opt_.book)) {
+      epub_ = std::make_shared<Epub>(opt_.book, PAPYRIX_CACHE_DIR);
+      if (!epub_->load()) return false;
+      epub_->setupCacheDir();
+      SdMan.mkdir((epub_->getCachePath() + "/sections").c_str());
+      sections_ = epub_->getSpineItemsCount();
+      return sections_ > 0;
+    }
+    if (FsHelpers::isFb2File(opt_.book)) return loadText<Fb2>();
+    if (FsHelpers::isMarkdownFile(opt_.book)) return loadText<Markdown>();
+    txt_.reset(new Txt(opt_.book, PAPYRIX_CACHE_DIR));
+    if (!txt_->load()) return false;
+    txt_->setupCacheDir();
+    sections_ = txt_->sectionCount();
+    return true;
+  }
+
+  int startSection() const {
+    if (txt_) return txt_->sectionForPercent(opt_.openAt);
+    return std::min(sections_ - 1, sections_ * opt_.openAt / 100);
+  }
+
+  std::unique_ptr<ContentParser> makeParser(const int section) {
+    if (epub_) return std::unique_ptr<ContentParser>(new EpubChapterParser(epub_, section, gfx_, config_, ""));
+    if (FsHelpers::isFb2File(opt_.book)) return std::unique_ptr<ContentParser>(new Fb2Parser(opt_.book, gfx_, config_));
+    if (FsHelpers::isMarkdownFile(opt_.book)) {
+      return std::unique_ptr<ContentParser>(new MarkdownParser(opt_.book, gfx_, config_));
+    }
+    return std::unique_ptr<ContentParser>(
+        new PlainTextParser(opt_.book, gfx_, config_, txt_->sectionStart(section), txt_->sectionEnd(section)));
+  }
+
+  std::string cachePath(const int section) const {
+    if (epub_) return epub_->getCachePath() + "/sections/" + std::to_string(section) + ".bin";
+    if (txt_) return txt_->getSectionCachePath(config_.fontId, section);
+    return cacheDir_ + "/pages_" + std::to_string(config_.fontId) + ".bin";
+  }
+
+  // ReaderState::recordTxtSectionPages()
+  void recordSectionPages() {
+    if (!txt_) return;
+    txt_->setLayout(config_.hash());
+    if (!cache_->isPartial()) txt_->setSectionPages(section_, cache_->pageCount());
+    txt_->saveIndex();
+  }
+
+  // ReaderState::createOrExtendCacheImpl(): use the cache on the card, or build its first batch
+  bool openSection(const int section) {
+    section_ = section;
+    page_ = 0;
+    parser_ = makeParser(section);
+    const std::string path = cachePath(section);
+    cache_.reset(new PageCache(path));
+    if (cache_->load(config_) && SdMan.exists((path + ".anchors").c_str())) {
+      if (!cache_->isPartial()) return cache_->pageCount() > 0;
+      if (!cache_->extend(*parser_, PageCache::DEFAULT_CACHE_CHUNK)) return false;
+    } else if (!cache_->create(*parser_, config_, PageCache::DEFAULT_CACHE_CHUNK)) {
+      return false;
+    }
+    saveAnchorMap(*parser_, path);
+    recordSectionPages();
+    return cache_->pageCount() > 0;
+  }
+
+  // ReaderState::renderCachedPage() and displayWithRefresh()
+  bool showPage() {
+    gfx_.clearScreen();
+    const auto page = cache_->loadPage(page_);
+    if (!page) return false;
+    page->render(gfx_, config_.fontId, DeviceSettings::MARGIN_LEFT, DeviceSettings::MARGIN_TOP);
+    if (pagesUntilFullRefresh_ <= 1) {
+      gfx_.displayBuffer(EInkDisplay::HALF_REFRESH);
+      pagesUntilFullRefresh_ = opt_.pagesPerRefresh;
+    } else {
+      gfx_.displayBuffer(EInkDisplay::FAST_REFRESH);
+      pagesUntilFullRefresh_--;
+    }
+    return true;
+  }
+};
+
+void printCostHeader() {
+  fprintf(stderr, "%-22s %9s %9s %9s %9s %6s %6s %7s %9s %7s %10s\n", "", "total ms", "SD ms", "display", "CPU ms",
+          "opens", "seeks", "reads", "KB read", "writes", "KB written");
+}
+
+void printCost(const char* label, const Cost& c, const double divisor = 1) {
+  uint64_t reads = 0;
+  uint64_t writes = 0;
+  for (int i = 0; i < DeviceSim::SIZE_CLASSES; i++) {
+    reads += c.io.reads[i];
+    writes += c.io.writes[i];
+  }
+  fprintf(stderr, "%-22s %9.0f %9.0f %9.0f %9.0f %6.1f %6.1f %7.1f %9.1f %7.1f %10.1f\n", label, c.totalMs() / divisor,
+          c.io.sdUs / 1000 / divisor, c.io.displayUs / 1000 / divisor, c.cpuUs / 1000 / divisor,
+          (c.io.opens + c.io.dirOps) / divisor, c.io.seeks / divisor, reads / divisor,
+          c.io.readBytes / 1024.0 / divisor, writes / divisor, c.io.writeBytes / 1024.0 / divisor);
+}
+
+void printSizes(const char* label, const Cost& c) {
+  fprintf(stderr, "%-22s reads %7llu %7llu %7llu %7llu   writes %7llu %7llu %7llu %7llu\n", label,
+          static_cast<unsigned long long>(c.io.reads[0]), static_cast<unsigned long long>(c.io.reads[1]),
+          static_cast<unsigned long long>(c.io.reads[2]), static_cast<unsigned long long>(c.io.reads[3]),
+          static_cast<unsigned long long>(c.io.writes[0]), static_cast<unsigned long long>(c.io.writes[1]),
+          static_cast<unsigned long long>(c.io.writes[2]), static_cast<unsigned long long>(c.io.writes[3]));
+}
+
+Cost add(Cost a, const Cost& b) {
+  a.cpuUs += b.cpuUs;
+  a.io.opens += b.io.opens;
+  a.io.dirOps += b.io.dirOps;
+  a.io.seeks += b.io.seeks;
+  for (int i = 0; i < DeviceSim::SIZE_CLASSES; i++) {
+    a.io.reads[i] += b.io.reads[i];
+    a.io.writes[i] += b.io.writes[i];
+  }
+  a.io.readBytes += b.io.readBytes;
+  a.io.writeBytes += b.io.writeBytes;
+  a.io.sdTransactions += b.io.sdTransactions;
+  a.io.spiBytes += b.io.spiBytes;
+  a.io.refreshes += b.io.refreshes;
+  a.io.sdUs += b.io.sdUs;
+  a.io.displayUs += b.io.displayUs;
+  return a;
+}
+
+void removeTree(const std::string& path) {
+  if (DIR* d = opendir(path.c_str())) {
+    while (const dirent* entry = readdir(d)) {
+      if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) removeTree(path + "/" + entry->d_name);
+    }
+    closedir(d);
+  }
+  remove(path.c_str());
+}
+
+}  // namespace
+
+void simulationUsage() {
+  fprintf(stderr, "       reader-test --simulate-device <book> [options]\n");
+  fprintf(stderr, "  Estimates device time to first page and per page turn (SD, display and CPU)\n");
+  fprintf(stderr, "  --turns N        Page turns to simulate (default: 30)\n");
+  fprintf(stderr, "  --open-at PERCENT\n");
+  fprintf(stderr, "                   Open the section holding this much of the book (default: 0)\n");
+  fprintf(stderr, "  --refresh-every N\n");
+  fprintf(stderr, "                   Pages per half refresh (default: %d)\n", DEFAULT_PAGES_PER_REFRESH);
+  fprintf(stderr, "  --model NAME=VALUE\n");
+  fprintf(stderr, "                   Override a latency model parameter:\n");
+  const DeviceSim::Model defaults;
+  for (int i = 0; i < DeviceSim::PARAM_COUNT; i++) {
+    const auto& p = DeviceSim::params()[i];
+    fprintf(stderr, "                     %s (default: %g)\n", p.name, defaults.*p.field);
+  }
+  fprintf(stderr, "  --verbose        Show parser logging\n");
+  DeviceSettings::printUsage();
+}
+
+int runSimulation(const int argc, char* argv[]) {
+  Options opt;
+  DeviceSim& sim = DeviceSim::instance();
+  bool badOption = false;
+
+  for (int i = 0; i < argc && !badOption; i++) {
+    const char* arg = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (opt.settings.parseOption(argc, argv, i, badOption)) continue;
+    if (strcmp(arg, "--turns") == 0 && value) {
+      opt.turns = atoi(argv[++i]);
+    } else if (strcmp(arg, "--open-at") == 0 && value) {
+      opt.openAt = std::max(0, std::min(atoi(argv[++i]), 100));
+    } else if (strcmp(arg, "--refresh-every") == 0 && value) {
+      opt.pagesPerRefresh = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(arg, "--model") == 0 && value) {
+      if (!sim.model.set(argv[++i])) {
+        fprintf(stderr, "Bad model parameter: %s\n", value);
+        badOption = true;
+      }
+    } else if (strcmp(arg, "--verbose") == 0) {
+      opt.verbose = true;
+    } else if (arg[0] != '-' && opt.book.empty()) {
+      opt.book = arg;
+    } else {
+      fprintf(stderr, "Unknown simulation option: %s\n", arg);
+      return 1;
+    }
+  }
+
+  const bool supported = FsHelpers::isEpubFile(opt.book) || FsHelpers::isFb2File(opt.book) ||
+                         FsHelpers::isTxtFile(opt.book) || FsHelpers::isMarkdownFile(opt.book);
+  if (badOption || !supported || access(opt.book.c_str(), R_OK) != 0) {
+    simulationUsage();
+    return 1;
+  }
+
+  // Parser logging goes to stdout
+  if (!opt.verbose) freopen("/dev/null", "w", stdout);
+
+  // Images need decoders the host doesn't have
+  opt.settings.showImages = false;
+  const RenderConfig config = opt.settings.renderConfig();
+
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  opt.settings.registerFont(gfx);
+
+  // A scratch card: the cache directory starts empty
+  char cacheDir[] = "/tmp/papyrix-simulate-XXXXXX";
+  if (!mkdtemp(cacheDir)) {
+    perror("mkdtemp");
+    return 1;
+  }
+  sdMount(PAPYRIX_CACHE_DIR, cacheDir);
+  SdMan.mkdir(PAPYRIX_DIR);
+  SdMan.mkdir(PAPYRIX_CACHE_DIR);
+
+  sim.enabled = true;
+  bool ok = true;
+  Cost firstOpen;
+  Cost reopen;
+  Cost plainTurns;
+  Cost extendTurns;
+  Cost slowest;
+  int plainCount = 0;
+  int extendCount = 0;
+  {
+    Meter meter;
+    Reader reader(opt, gfx, config);
+    ok = reader.open();
+    firstOpen = meter.stop();
+
+    for (int t = 0; ok && t < opt.turns; t++) {
+      Meter turnMeter;
+      bool extended = false;
+      if (!reader.turnPage(extended)) break;
+      const Cost cost = turnMeter.stop();
+      if (extended) {
+        extendTurns = add(extendTurns, cost);
+        extendCount++;
+      } else {
+        plainTurns = add(plainTurns, cost);
+        plainCount++;
+      }
+      if (cost.totalMs() > slowest.totalMs()) slowest = cost;
+    }
+  }
+  if (ok) {
+    Meter meter;
+    Reader reader(opt, gfx, config);
+    ok = reader.open();
+    reopen = meter.stop();
+  }
+  sim.enabled = false;
+  removeTree(cacheDir);
+
+  if (!ok) {
+    fprintf(stderr, "Cannot open %s\n", opt.book.c_str());
+    return 1;
+  }
+
+  const auto& m = sim.model;
+  fprintf(stderr, "Simulated device: %s (font %s, opened at %d%%, %d page turns)\n", opt.book.c_str(),
+          opt.settings.fontName(), opt.openAt, plainCount + extendCount);
+  fprintf(stderr,
+          "Model: SD %.1f MB/s read, %.1f MB/s write, %.0f us/command, %.0f us/open; CPU x%.0f; "
+          "SPI %.0f MHz; refresh %.0f/%.0f/%.0f ms (full/half/fast)\n\n",
+          m.sdReadMBps, m.sdWriteMBps, m.sdCommandUs, m.sdOpenUs, m.cpuFactor, m.spiMHz, m.refreshFullMs,
+          m.refreshHalfMs, m.refreshFastMs);
+  printCostHeader();
+  printCost("First page, no cache", firstOpen);
+  printCost("First page, reopened", reopen);
+  if (plainCount > 0) printCost("Page turn (cached)", plainTurns, plainCount);
+  if (extendCount > 0) printCost("Page turn (+caching)", extendTurns, extendCount);
+  if (plainCount + extendCount > 0) {
+    printCost("Page turn (average)", add(plainTurns, extendTurns), plainCount + extendCount);
+    printCost("Page turn (slowest)", slowest);
+  }
+
+  fprintf(stderr, "\nRequests by size %15s %7s %7s %7s %17s %7s %7s %7s\n", "<=64", "<=512", "<=4K", ">4K", "<=64",
+          "<=512", "<=4K", ">4K");
+  printSizes("First page, no cache", firstOpen);
+  printSizes("First page, reopened", reopen);
+  printSizes("Page turns", add(plainTurns, extendTurns));
+  return 0;
+}
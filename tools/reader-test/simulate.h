@@ -0,0 +1,5 @@
+#pragma once
+
+// reader-test --simulate-device: estimate device time to open a book and turn pages (see simulate.cpp)
+int runSimulation(int argc, char* argv[]);
+void simulationUsage();
@@ -0,0 +1,522 @@
+// XTC/XTCH converter
+//
+// Lays a book out with the reader's own parsers and settings, draws every page with the real
+// GfxRenderer and writes the result as an .xtc (1-bit XTG pages) or .xtch (2-bit XTH pages)
+// file. Chapters come from the book's TOC. The device shows such a file through XtcParser and
+// XtcPageRenderer, so it never has to lay the book out itself.
+//
+// Layout runs once, in order (the parsers and hyphenation keep global state). The pages are
+// then drawn by worker processes, each writing its share straight to the page's place in the
+// file, and every page is read back through XtcParser and XtcPageBlitter and compared with
+// what was drawn.
+//
+// Images are left out, since the host has no image decoders.
+
+#include <fcntl.h>
+#include <ftw.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <EInkDisplay.h>
+#include <Epub.h>
+#include <EpubChapterParser.h>
+#include <Fb2.h>
+#include <Fb2Parser.h>
+#include <FsHelpers.h>
+#include <GfxRenderer.h>
+#include <LittleFS.h>
+#include <Markdown.h>
+#include <MarkdownParser.h>
+#include <Page.h>
+#include <PlainTextParser.h>
+#include <SDCardManager.h>
+#include <Txt.h>
+#include <Xtc/XtcParser.h>
+#include <Xtc/XtcTypes.h>
+#include <rendering/XtcPageBlitter.h>
+
+#include "device_settings.h"
+
+// LittleFS global
+MockLittleFS LittleFS;
+
+namespace {
+
+using papyrix::XtcPageBlitter;
+
+// Pages cover the whole portrait screen; the text sits in the reader viewport
+constexpr uint16_t PAGE_WIDTH = xtc::DISPLAY_WIDTH;
+constexpr uint16_t PAGE_HEIGHT = xtc::DISPLAY_HEIGHT;
+constexpr size_t PLANE_SIZE = static_cast<size_t>(PAGE_WIDTH) * PAGE_HEIGHT / 8;
+static_assert(PLANE_SIZE == EInkDisplay::BUFFER_SIZE, "XTC page and frame buffer sizes differ");
+
+// File layout: header, title (128), author (64), chapter table (96 per chapter), page table,
+// then the pages. The chapter count is taken from the gap up to the page table.
+constexpr size_t TITLE_OFFSET = sizeof(xtc::XtcHeader);
+constexpr size_t TITLE_SIZE = 128;
+constexpr size_t AUTHOR_SIZE = 64;
+constexpr size_t CHAPTER_TABLE_OFFSET = TITLE_OFFSET + TITLE_SIZE + AUTHOR_SIZE;
+constexpr size_t CHAPTER_SIZE = 96;
+constexpr size_t CHAPTER_NAME_SIZE = 80;
+constexpr uint32_t HEADER_SIZE = 88;
+
+// Same logical -> panel mapping as GfxRenderer in Portrait (XtcPageRenderer's transformFor())
+constexpr XtcPageBlitter::Transform PORTRAIT = {0, 1, 0, -1, 0, EInkDisplay::DISPLAY_HEIGHT - 1};
+
+struct Options {
+  std::string input;
+  std::string output;
+  unsigned jobs = 0;
+  bool twoBit = false;
+  bool verbose = false;
+  DeviceSettings settings;
+};
+
+struct Book {
+  std::string title;
+  std::string author;
+  std::vector<std::unique_ptr<Page>> pages;
+  std::vector<xtc::ChapterInfo> chapters;  // 0-based pages
+};
+
+using AnchorMap = std::vector<std::pair<std::string, uint16_t>>;
+
+uint16_t anchorPage(const AnchorMap& anchors, const std::string& anchor) {
+  if (anchor.empty()) return 0;
+  for (const auto& entry : anchors) {
+    if (entry.first == anchor) return entry.second;
+  }
+  return 0;
+}
+
+// Longest prefix of at most maxBytes that doesn't cut a UTF-8 sequence
+std::string utf8Prefix(const std::string& s, size_t maxBytes) {
+  if (s.size() <= maxBytes) return s;
+  while (maxBytes > 0 && (static_cast<uint8_t>(s[maxBytes]) & 0xC0) == 0x80) maxBytes--;
+  return s.substr(0, maxBytes);
+}
+
+// Parse the whole content in one go (no batches, so no suspend and resume)
+bool layoutAll(ContentParser& parser, std::vector<std::unique_ptr<Page>>& pages) {
+  const auto add = [&pages](std::unique_ptr<Page> page) { pages.push_back(std::move(page)); };
+  while (true) {
+    const size_t before = pages.size();
+    if (!parser.parsePages(add, 0)) return false;
+    if (!parser.hasMoreContent() || pages.size() == before) return true;
+  }
+}
+
+bool layoutEpub(const std::string& path, const std::string& cacheDir, GfxRenderer& gfx, const RenderConfig& config,
+                Book& book) {
+  auto epub = std::make_shared<Epub>(path, cacheDir);
+  if (!epub->load()) {
+    fprintf(stderr, "Cannot load EPUB: %s\n", path.c_str());
+    return false;
+  }
+  epub->setupCacheDir();
+  book.title = epub->getTitle();
+  book.author = epub->getAuthor();
+
+  const int spineCount = epub->getSpineItemsCount();
+  std::vector<uint16_t> spineStart(spineCount);
+  std::vector<AnchorMap> anchors(spineCount);
+  for (int i = 0; i < spineCount; i++) {
+    spineStart[i] = static_cast<uint16_t>(std::min<size_t>(book.pages.size(), UINT16_MAX));
+    EpubChapterParser parser(epub, i, gfx, config, "");
+    if (!layoutAll(parser, book.pages)) {
+      fprintf(stderr, "Warning: spine item %d could not be laid out\n", i);
+    }
+    anchors[i] = parser.getAnchorMap();
+  }
+
+  for (int t = 0; t < epub->getTocItemsCount(); t++) {
+    const auto entry = epub->getTocItem(t);
+    if (entry.spineIndex < 0 || entry.spineIndex >= spineCount) continue;
+    const size_t page = spineStart[entry.spineIndex] + anchorPage(anchors[entry.spineIndex], entry.anchor);
+    book.chapters.push_back({entry.title, static_cast<uint16_t>(std::min<size_t>(page, UINT16_MAX)), 0});
+  }
+  return true;
+}
+
+bool layoutFb2(const std::string& path, const std::string& cacheDir, GfxRenderer& gfx, const RenderConfig& config,
+               Book& book) {
+  Fb2 fb2(path, cacheDir);
+  if (!fb2.load()) {
+    fprintf(stderr, "Cannot load FB2: %s\n", path.c_str());
+    return false;
+  }
+  fb2.setupCacheDir();
+  book.title = fb2.getTitle();
+  book.author = fb2.getAuthor();
+
+  Fb2Parser parser(path, gfx, config, fb2.getIndex(), config.showImages ? fb2.getImageCachePath() : "");
+  if (!layoutAll(parser, book.pages)) {
+    fprintf(stderr, "Cannot lay out FB2: %s\n", path.c_str());
+    return false;
+  }
+  // Fb2Parser records where each section starts as "section_<index>"
+  const AnchorMap& anchors = parser.getAnchorMap();
+  for (uint16_t t = 0; t < fb2.tocCount(); t++) {
+    const auto& item = fb2.getTocItem(t);
+    const uint16_t page = anchorPage(anchors, "section_" + std::to_string(item.sectionIndex));
+    book.chapters.push_back({item.title, page, 0});
+  }
+  return true;
+}
+
+// TXT and Markdown have no TOC
+template <typename Content, typename Parser>
+bool layoutText(const std::string& path, const std::string& cacheDir, GfxRenderer& gfx, const RenderConfig& config,
+                Book& book) {
+  Content content(path, cacheDir);
+  if (!content.load()) {
+    fprintf(stderr, "Cannot load %s\n", path.c_str());
+    return false;
+  }
+  content.setupCacheDir();
+  book.title = content.getTitle();
+
+  Parser parser(path, gfx, config);
+  if (!layoutAll(parser, book.pages)) {
+    fprintf(stderr, "Cannot lay out %s\n", path.c_str());
+    return false;
+  }
+  return true;
+}
+
+// A chapter runs up to the page before the next one starts (nested TOC entries may share a page)
+void finishChapters(Book& book) {
+  const uint16_t pageCount = static_cast<uint16_t>(book.pages.size());
+  auto& chapters = book.chapters;
+  chapters.erase(std::remove_if(chapters.begin(), chapters.end(),
+                                [pageCount](const xtc::ChapterInfo& c) { return c.startPage >= pageCount; }),
+                 chapters.end());
+  std::stable_sort(chapters.begin(), chapters.end(),
+                   [](const xtc::ChapterInfo& a, const xtc::ChapterInfo& b) { return a.startPage < b.startPage; });
+  for (size_t i = 0; i < chapters.size(); i++) {
+    const uint16_t next = i + 1 < chapters.size() ? chapters[i + 1].startPage : pageCount;
+    chapters[i].endPage = std::max<uint16_t>(chapters[i].startPage, next - 1);
+  }
+}
+
+size_t pageDataSize(const bool twoBit) { return sizeof(xtc::XtgPageHeader) + (twoBit ? 2 : 1) * PLANE_SIZE; }
+
+size_t pageTableOffset(const Book& book) { return CHAPTER_TABLE_OFFSET + book.chapters.size() * CHAPTER_SIZE; }
+
+size_t dataOffset(const Book& book) {
+  return pageTableOffset(book) + book.pages.size() * sizeof(xtc::PageTableEntry);
+}
+
+// Everything before the first page. Pages have a fixed size, so the page table is known up front.
+std::vector<uint8_t> buildHeader(const Book& book, const bool twoBit) {
+  std::vector<uint8_t> out(dataOffset(book), 0);
+  const bool hasChapters = !book.chapters.empty();
+
+  xtc::XtcHeader header = {};
+  header.magic = twoBit ? xtc::XTCH_MAGIC : xtc::XTC_MAGIC;
+  header.versionMajor = 1;
+  header.versionMinor = 0;
+  header.pageCount = static_cast<uint16_t>(book.pages.size());
+  header.flags = hasChapters ? 1u << 24 : 0;  // Byte 0x0B: chapter table present
+  header.headerSize = HEADER_SIZE;
+  header.pageTableOffset = pageTableOffset(book);
+  header.dataOffset = dataOffset(book);
+  memcpy(out.data(), &header, sizeof(header));
+  // 0x30 is the title offset without chapters and the 64-bit chapter table offset with them
+  const uint64_t offset30 = hasChapters ? CHAPTER_TABLE_OFFSET : TITLE_OFFSET;
+  memcpy(out.data() + 0x30, &offset30, sizeof(offset30));
+
+  const std::string title = utf8Prefix(book.title, TITLE_SIZE - 1);
+  const std::string author = utf8Prefix(book.author, AUTHOR_SIZE - 1);
+  memcpy(out.data() + TITLE_OFFSET, title.data(), title.size());
+  memcpy(out.data() + TITLE_OFFSET + TITLE_SIZE, author.data(), author.size());
+
+  for (size_t i = 0; i < book.chapters.size(); i++) {
+    const auto& chapter = book.chapters[i];
+    uint8_t* record = out.data() + CHAPTER_TABLE_OFFSET + i * CHAPTER_SIZE;
+    const std::string name = utf8Prefix(chapter.name, CHAPTER_NAME_SIZE - 1);
+    memcpy(record, name.data(), name.size());
+    // Stored 1-based
+    const uint16_t start = chapter.startPage + 1;
+    const uint16_t end = chapter.endPage + 1;
+    memcpy(record + 0x50, &start, sizeof(start));
+    memcpy(record + 0x52, &end, sizeof(end));
+  }
+
+  const size_t pageSize = pageDataSize(twoBit);
+  for (size_t i = 0; i < book.pages.size(); i++) {
+    xtc::PageTableEntry entry = {};
+    entry.dataOffset = dataOffset(book) + i * pageSize;
+    entry.dataSize = static_cast<uint32_t>(pageSize);
+    entry.width = PAGE_WIDTH;
+    entry.height = PAGE_HEIGHT;
+    memcpy(out.data() + pageTableOffset(book) + i * sizeof(entry), &entry, sizeof(entry));
+  }
+  return out;
+}
+
+// Frame buffers of one page: the BW pass, and for 2-bit output the two grayscale passes
+struct PageBuffers {
+  std::vector<uint8_t> bw = std::vector<uint8_t>(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> lsb = std::vector<uint8_t>(EInkDisplay::BUFFER_SIZE);
+  std::vector<uint8_t> msb = std::vector<uint8_t>(EInkDisplay::BUFFER_SIZE);
+};
+
+// The passes ReaderState draws a page in (grayscale passes start from a cleared buffer)
+void drawPass(GfxRenderer& gfx, Page& page, const int fontId, const GfxRenderer::RenderMode mode,
+              std::vector<uint8_t>& out) {
+  gfx.setRenderMode(mode);
+  gfx.clearScreen(mode == GfxRenderer::BW ? 0xFF : 0x00);
+  page.render(gfx, fontId, DeviceSettings::MARGIN_LEFT, DeviceSettings::MARGIN_TOP);
+  memcpy(out.data(), gfx.getFrameBuffer(), out.size());
+  gfx.setRenderMode(GfxRenderer::BW);
+}
+
+// Portrait page pixel (x, y) is panel pixel (y, H - 1 - x) in the frame buffer (1 = white)
+bool inked(const std::vector<uint8_t>& fb, const int x, const int y) {
+  const int physX = y;
+  const int physY = EInkDisplay::DISPLAY_HEIGHT - 1 - x;
+  return !(fb[physY * EInkDisplay::DISPLAY_WIDTH_BYTES + physX / 8] & (0x80 >> (physX & 7)));
+}
+
+// XTG: row-major, MSB = leftmost pixel, 0 = black
+void packXtg(const PageBuffers& buffers, uint8_t* out) {
+  constexpr int rowBytes = PAGE_WIDTH / 8;
+  memset(out, 0xFF, PLANE_SIZE);
+  for (int y = 0; y < PAGE_HEIGHT; y++) {
+    for (int x = 0; x < PAGE_WIDTH; x++) {
+      if (inked(buffers.bw, x, y)) out[y * rowBytes + x / 8] &= static_cast<uint8_t>(~(0x80 >> (x & 7)));
+    }
+  }
+}
+
+// XTH: columns right to left, 8 vertical pixels per byte, MSB = topmost. In portrait that is the
+// panel's own byte order, so both planes come straight from the frame buffers. Pixel value
+// (bit1 << 1 | bit2) is 3 for black, 2 for light gray (MSB pass only), 1 for dark gray (both
+// passes) and 0 for white.
+void packXth(const PageBuffers& buffers, uint8_t* out) {
+  uint8_t* plane1 = out;
+  uint8_t* plane2 = out + PLANE_SIZE;
+  for (size_t i = 0; i < PLANE_SIZE; i++) {
+    const uint8_t ink = static_cast<uint8_t>(~buffers.bw[i]);
+    const uint8_t dark = buffers.lsb[i];
+    const uint8_t gray = buffers.msb[i];
+    plane1[i] = static_cast<uint8_t>(ink & ~(gray & dark));
+    plane2[i] = static_cast<uint8_t>(ink & (dark | ~gray));
+  }
+}
+
+// One XtcPageRenderer pass over the page as written, compared with the buffer it was drawn from
+bool readBackPass(xtc::XtcParser& parser, const uint32_t pageIndex, const XtcPageBlitter::Op plane1Op,
+                  const XtcPageBlitter::Op plane2Op, const uint8_t clearColor, const std::vector<uint8_t>& expected,
+                  std::vector<uint8_t>& scratch) {
+  std::fill(scratch.begin(), scratch.end(), clearColor);
+  XtcPageBlitter blitter(scratch.data(), PORTRAIT, PAGE_WIDTH, PAGE_HEIGHT, parser.getWidth(), parser.getHeight());
+  const bool twoBit = parser.getBitDepth() == 2;
+  const auto err = parser.loadPageStreaming(pageIndex, [&](const uint8_t* data, size_t size, size_t offset) {
+    if (twoBit) {
+      blitter.blitColumnMajorChunk(data, size, offset, plane1Op, plane2Op);
+    } else {
+      blitter.blitRowMajorChunk(data, size, offset, plane1Op);
+    }
+  });
+  return err == xtc::XtcError::OK && scratch == expected;
+}
+
+// Reads the page as the device would. The file is opened afresh for each page: a stream kept
+// open could still hold the bytes read before the page was written.
+bool verifyPage(const std::string& path, const uint32_t pageIndex, const PageBuffers& buffers,
+                std::vector<uint8_t>& scratch) {
+  using Op = XtcPageBlitter::Op;
+  xtc::XtcParser parser;
+  if (parser.open(path.c_str()) != xtc::XtcError::OK) return false;
+  if (!readBackPass(parser, pageIndex, Op::Black, Op::Black, 0xFF, buffers.bw, scratch)) return false;
+  if (parser.getBitDepth() != 2) return true;
+  return readBackPass(parser, pageIndex, Op::Mark, Op::MarkIfClear, 0x00, buffers.lsb, scratch) &&
+         readBackPass(parser, pageIndex, Op::Mark, Op::Toggle, 0x00, buffers.msb, scratch);
+}
+
+// Runs in a worker process: draws pages worker, worker + jobs, ... and writes them in place
+bool renderPages(const Options& opt, const Book& book, GfxRenderer& gfx, const int fd, const unsigned worker) {
+  const int fontId = opt.settings.fontId();
+  const size_t pageSize = pageDataSize(opt.twoBit);
+  std::vector<uint8_t> record(pageSize, 0);
+  auto* pageHeader = reinterpret_cast<xtc::XtgPageHeader*>(record.data());
+  pageHeader->magic = opt.twoBit ? xtc::XTH_MAGIC : xtc::XTG_MAGIC;
+  pageHeader->width = PAGE_WIDTH;
+  pageHeader->height = PAGE_HEIGHT;
+  pageHeader->dataSize = static_cast<uint32_t>(pageSize - sizeof(xtc::XtgPageHeader));
+  uint8_t* bitmap = record.data() + sizeof(xtc::XtgPageHeader);
+
+  PageBuffers buffers;
+  std::vector<uint8_t> scratch(EInkDisplay::BUFFER_SIZE);
+  for (size_t i = worker; i < book.pages.size(); i += opt.jobs) {
+    Page& page = *book.pages[i];
+    drawPass(gfx, page, fontId, GfxRenderer::BW, buffers.bw);
+    if (opt.twoBit) {
+      drawPass(gfx, page, fontId, GfxRenderer::GRAYSCALE_LSB, buffers.lsb);
+      drawPass(gfx, page, fontId, GfxRenderer::GRAYSCALE_MSB, buffers.msb);
+      packXth(buffers, bitmap);
+    } else {
+      packXtg(buffers, bitmap);
+    }
+
+    const off_t offset = static_cast<off_t>(dataOffset(book) + i * pageSize);
+    if (pwrite(fd, record.data(), pageSize, offset) != static_cast<ssize_t>(pageSize)) {
+      perror("pwrite");
+      return false;
+    }
+    if (!verifyPage(opt.output, static_cast<uint32_t>(i), buffers, scratch)) {
+      fprintf(stderr, "Page %zu does not read back as drawn\n", i + 1);
+      return false;
+    }
+  }
+  return true;
+}
+
+// One worker process per share of the pages; each inherits the laid out book and the renderer
+int renderAll(const Options& opt, const Book& book, GfxRenderer& gfx, const int fd) {
+  std::vector<pid_t> workers;
+  for (unsigned w = 0; w < opt.jobs; w++) {
+    fflush(nullptr);
+    const pid_t pid = fork();
+    if (pid == 0) {
+      const bool ok = renderPages(opt, book, gfx, fd, w);
+      fflush(nullptr);
+      _exit(ok ? 0 : 1);
+    }
+    if (pid < 0) {
+      perror("fork");
+      break;
+    }
+    workers.push_back(pid);
+  }
+
+  int failed = workers.size() == opt.jobs ? 0 : 1;
+  for (const pid_t pid : workers) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed++;
+  }
+  return failed;
+}
+
+int removeEntry(const char* path, const struct stat*, int, struct FTW*) { return remove(path); }
+
+void usage() {
+  fprintf(stderr, "Usage: xtc-convert <book.epub|.fb2|.txt|.md> <out.xtc|out.xtch> [options]\n");
+  fprintf(stderr, "  Renders the book as the device lays it out into pre-rendered pages\n");
+  fprintf(stderr, "  .xtc is 1-bit black and white, .xtch 2-bit grayscale (anti-aliased text)\n");
+  fprintf(stderr, "  --jobs N         Pages rendered in parallel (default: CPU count)\n");
+  DeviceSettings::printUsage();
+  fprintf(stderr, "  --no-hyphenation, --verbose\n");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options opt;
+  bool badOption = false;
+  for (int i = 1; i < argc && !badOption; i++) {
+    const char* arg = argv[i];
+    if (opt.settings.parseOption(argc, argv, i, badOption)) continue;
+    if (strcmp(arg, "--jobs") == 0 && i + 1 < argc) {
+      opt.jobs = static_cast<unsigned>(atoi(argv[++i]));
+    } else if (strcmp(arg, "--verbose") == 0) {
+      opt.verbose = true;
+    } else if (arg[0] != '-' && opt.input.empty()) {
+      opt.input = arg;
+    } else if (arg[0] != '-' && opt.output.empty()) {
+      opt.output = arg;
+    } else {
+      fprintf(stderr, "Unknown option: %s\n", arg);
+      badOption = true;
+    }
+  }
+
+  const bool supported = FsHelpers::isEpubFile(opt.input) || FsHelpers::isFb2File(opt.input) ||
+                         FsHelpers::isTxtFile(opt.input) || FsHelpers::isMarkdownFile(opt.input);
+  const bool xtc = FsHelpers::hasExtension(opt.output, ".xtc");
+  const bool xtch = FsHelpers::hasExtension(opt.output, ".xtch");
+  if (badOption || !supported || (!xtc && !xtch)) {
+    usage();
+    return 1;
+  }
+  opt.twoBit = xtch;
+  if (opt.jobs == 0) opt.jobs = std::max(1u, std::thread::hardware_concurrency());
+
+  // Parser logging goes to stdout
+  if (!opt.verbose) freopen("/dev/null", "w", stdout);
+
+  // XTC pages have no status bar, and images can't be drawn on the host
+  opt.settings.showStatusBar = false;
+  opt.settings.showImages = false;
+  const RenderConfig config = opt.settings.renderConfig();
+
+  EInkDisplay display(0, 0, 0, 0, 0, 0);
+  GfxRenderer gfx(display);
+  gfx.begin();
+  opt.settings.registerFont(gfx);
+
+  // The parsers need a book cache directory; it is thrown away afterwards
+  char cacheDir[] = "/tmp/xtc-convert-XXXXXX";
+  if (!mkdtemp(cacheDir)) {
+    perror("mkdtemp");
+    return 1;
+  }
+
+  Book book;
+  bool ok;
+  if (FsHelpers::isEpubFile(opt.input)) {
+    ok = layoutEpub(opt.input, cacheDir, gfx, config, book);
+  } else if (FsHelpers::isFb2File(opt.input)) {
+    ok = layoutFb2(opt.input, cacheDir, gfx, config, book);
+  } else if (FsHelpers::isMarkdownFile(opt.input)) {
+    ok = layoutText<Markdown, MarkdownParser>(opt.input, cacheDir, gfx, config, book);
+  } else {
+    ok = layoutText<Txt, PlainTextParser>(opt.input, cacheDir, gfx, config, book);
+  }
+  nftw(cacheDir, removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+
+  if (!ok) return 1;
+  if (book.pages.empty() || book.pages.size() > UINT16_MAX) {
+    fprintf(stderr, "Cannot convert a book with %zu pages\n", book.pages.size());
+    return 1;
+  }
+  finishChapters(book);
+  opt.jobs = std::min<unsigned>(opt.jobs, static_cast<unsigned>(book.pages.size()));
+
+  const int fd = open(opt.output.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    perror(opt.output.c_str());
+    return 1;
+  }
+  const std::vector<uint8_t> header = buildHeader(book, opt.twoBit);
+  const off_t fileSize = static_cast<off_t>(header.size() + book.pages.size() * pageDataSize(opt.twoBit));
+  if (pwrite(fd, header.data(), header.size(), 0) != static_cast<ssize_t>(header.size()) ||
+      ftruncate(fd, fileSize) != 0) {
+    perror(opt.output.c_str());
+    close(fd);
+    return 1;
+  }
+
+  fprintf(stderr, "Rendering %zu pages, %zu chapters (%u jobs, font %s, %d-bit)\n", book.pages.size(),
+          book.chapters.size(), opt.jobs, opt.settings.fontName(), opt.twoBit ? 2 : 1);
+  const int failed = renderAll(opt, book, gfx, fd);
+  close(fd);
+  if (failed > 0) {
+    fprintf(stderr, "Failed: %d workers did not finish\n", failed);
+    remove(opt.output.c_str());
+    return 1;
+  }
+
+  fprintf(stderr, "Wrote %s\n", opt.output.c_str());
+  return 0;
+}